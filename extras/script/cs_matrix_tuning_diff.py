@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+
+#------------------------------------------------------------------------------
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 2009-2024 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+#-------------------------------------------------------------------------------
+
+"""
+Summarize or compare SpMV tuning cache files.
+
+Tuning cache files are written by the solver when tuning matrix.vector
+products (by default, to $HOME/.cache/code_saturne/matrix_tuning.csv).
+
+With a single file, a summary of all tuned configurations is printed,
+with the cost of each variant relative to the best one.
+
+With two files (for example copies made before and after a system
+software update), costs of matching variants are compared, and changes
+above the given threshold or changes in the selected variant are shown.
+"""
+
+import sys
+
+from argparse import ArgumentParser
+
+op_names = ('A.x', '(A-D).x')
+key_fields = ('machine', 'type', 'fill', 'db_size', 'alloc_mode',
+              'size_class', 'n_ranks', 'n_threads')
+
+# ------------------------------------------------------------------------------
+
+def read_cache(path):
+    """
+    Read a tuning cache file, returning a dictionary of
+    {key: {(variant, op, hd): cost}}
+    """
+
+    entries = {}
+
+    with open(path) as f:
+        for line in f:
+            if line.startswith('#'):
+                continue
+            fields = line.rstrip('\n').split(';')
+            if len(fields) != len(key_fields) + 4:
+                continue
+            key = tuple(fields[:len(key_fields)])
+            variant, op, hd, cost = fields[len(key_fields):]
+            cost = float(cost)
+            if cost <= 0:
+                continue
+            d = entries.setdefault(key, {})
+            d[(variant, int(op), hd)] = cost
+
+    return entries
+
+# ------------------------------------------------------------------------------
+
+def key_str(key):
+    """
+    Return a readable description of a configuration key.
+    """
+
+    k = dict(zip(key_fields, key))
+    return '%s, %s, %s (block %s), ~2^%s rows/rank, %s ranks x %s threads%s' \
+        % (k['machine'], k['type'], k['fill'], k['db_size'],
+           k['size_class'], k['n_ranks'], k['n_threads'],
+           ', device' if k['alloc_mode'] != '0' else '')
+
+# ------------------------------------------------------------------------------
+
+def best_variant(costs, op):
+    """
+    Return the (variant, hd) with lowest cost for a given operation.
+    """
+
+    c = [(v, k) for k, v in costs.items() if k[1] == op]
+    if not c:
+        return None
+    c.sort()
+    return (c[0][1][0], c[0][1][2])
+
+# ------------------------------------------------------------------------------
+
+def summarize(entries):
+    """
+    Print all tuned configurations.
+    """
+
+    for key in sorted(entries):
+        costs = entries[key]
+        print('\n' + key_str(key))
+        for op in range(len(op_names)):
+            c = sorted([(v, k) for k, v in costs.items() if k[1] == op])
+            if not c:
+                continue
+            c_min = c[0][0]
+            print('  y <= %s' % op_names[op])
+            for cost, k in c:
+                print('    %-34s %s %12.4e s  x %5.2f' \
+                      % (k[0], k[2], cost, cost/c_min))
+
+    # Combine matrix types (native, CSR, MSR, with or without MKL or
+    # CUDA) for a given fill type so that all variants may be compared.
+
+    merged = {}
+    for key, costs in entries.items():
+        m_key = key[:1] + ('all types',) + key[2:]
+        d = merged.setdefault(m_key, {})
+        for k, v in costs.items():
+            d[(key[1] + ': ' + k[0], k[1], k[2])] = v
+
+    if len(merged) < len(entries):
+        print('\nBest variants across matrix types:')
+        for key in sorted(merged):
+            print('\n' + key_str(key))
+            for op in range(len(op_names)):
+                c = sorted([(v, k) for k, v in merged[key].items()
+                            if k[1] == op])
+                if c:
+                    print('  y <= %-8s %-42s %s %12.4e s' \
+                          % (op_names[op], c[0][1][0], c[0][1][2], c[0][0]))
+
+# ------------------------------------------------------------------------------
+
+def compare(old, new, threshold):
+    """
+    Compare two sets of tuning results.
+
+    Returns the number of significant differences.
+    """
+
+    n_diffs = 0
+
+    for key in sorted(set(old) | set(new)):
+
+        if key not in new:
+            print('\nonly in first file: ' + key_str(key))
+            continue
+        if key not in old:
+            print('\nonly in second file: ' + key_str(key))
+            continue
+
+        lines = []
+        for op in range(len(op_names)):
+            b_old = best_variant(old[key], op)
+            b_new = best_variant(new[key], op)
+            if b_old != b_new:
+                lines.append('  y <= %s: selected variant changed: %s -> %s' \
+                             % (op_names[op], b_old[0] if b_old else None,
+                                b_new[0] if b_new else None))
+            for k in sorted(set(old[key]) | set(new[key])):
+                if k[1] != op:
+                    continue
+                c_old = old[key].get(k)
+                c_new = new[key].get(k)
+                if c_old is None or c_new is None:
+                    lines.append('  y <= %s: %-34s %s only in %s file' \
+                                 % (op_names[op], k[0], k[2],
+                                    'second' if c_old is None else 'first'))
+                    continue
+                r = c_new / c_old
+                if abs(r - 1) > threshold:
+                    lines.append('  y <= %s: %-34s %s %12.4e -> %12.4e s' \
+                                 '  (%+.1f%%)' \
+                                 % (op_names[op], k[0], k[2], c_old, c_new,
+                                    (r-1)*100))
+
+        if lines:
+            n_diffs += len(lines)
+            print('\n' + key_str(key))
+            for l in lines:
+                print(l)
+
+    if n_diffs == 0:
+        print('No differences above %.1f%%.' % (threshold*100))
+
+    return n_diffs
+
+# ------------------------------------------------------------------------------
+
+def main(argv):
+
+    parser = ArgumentParser(description=__doc__.strip().split('\n')[0])
+    parser.add_argument('files', nargs='+', metavar='FILE',
+                        help='tuning cache file(s); 1 to summarize, '
+                             '2 to compare')
+    parser.add_argument('-t', '--threshold', type=float, default=0.1,
+                        help='relative cost change threshold for '
+                             'comparisons (default: 0.1)')
+    args = parser.parse_args(argv)
+
+    if len(args.files) == 1:
+        summarize(read_cache(args.files[0]))
+        return 0
+    elif len(args.files) == 2:
+        n_diffs = compare(read_cache(args.files[0]),
+                          read_cache(args.files[1]),
+                          args.threshold)
+        return 1 if n_diffs > 0 else 0
+
+    parser.error('1 or 2 files expected')
+
+# ------------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -169,6 +169,30 @@ struct _ple_locator_t {
   double  exchange_cpu_time[2];    /* Variable exchange CPU time */
 };
 
+/*----------------------------------------------------------------------------
+ * Structure defining a pending variable exchange
+ *----------------------------------------------------------------------------*/
+
+struct _ple_locator_exchange_t {
+
+  ple_locator_t     *locator;      /* Associated locator */
+
+  void              *local_var;    /* Variable defined on local points */
+  const ple_lnum_t  *local_list;   /* Optional indirection for local_var */
+  size_t             nbytes;       /* Size of values for one point */
+  int                reverse;      /* Nonzero for reverse exchange */
+
+#if defined(PLE_HAVE_MPI)
+  int                n_requests;   /* Number of pending requests */
+  MPI_Request       *request;      /* Pending requests */
+  int               *dist_v_flag;  /* Flags sent to each intersecting rank */
+  int               *loc_v_flag;   /* Flags received from each
+                                      intersecting rank */
+  unsigned char     *loc_v_buf;    /* Buffer for values at local points */
+#endif
+
+};
+
 /*============================================================================
  * Local function pointer type documentation
  *============================================================================*/
@@ -1003,6 +1027,181 @@ _intersects_distant(ple_locator_t       *this_locator,
   return intersects;
 }
 
+/*----------------------------------------------------------------------------
+ * Distribute points to possibly intersecting distant ranks.
+ *
+ * Rather than testing each point against the extents of each intersecting
+ * rank, the extents are first binned on a regular grid spanning the point
+ * extents, so that each point is only tested against the ranks whose
+ * extents overlap its grid cell. Point ids are ordered by increasing
+ * value for each rank.
+ *
+ * parameters:
+ *   dim            <-- spatial dimension
+ *   intersects     <-- intersecting ranks info
+ *   idb            <-- base numbering for point list
+ *   n_points       <-- number of points to distribute
+ *   point_list     <-- optional indirection array to point_coords
+ *   point_coords   <-- coordinates of points to locate
+ *                      (dimension: dim * n_points)
+ *   rank_pts_idx   --> index of points for each intersecting rank
+ *                      (size: intersects->n + 1)
+ *   rank_pts       --> ids of points (0 to n_points-1) for each
+ *                      intersecting rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_points_by_rank(int                         dim,
+                const _rank_intersects_t   *intersects,
+                ple_lnum_t                  idb,
+                ple_lnum_t                  n_points,
+                const ple_lnum_t            point_list[],
+                const ple_coord_t           point_coords[],
+                ple_lnum_t                **rank_pts_idx,
+                ple_lnum_t                **rank_pts)
+{
+  int n_cells_dim = 1;
+  ple_lnum_t n_cells = 1;
+  double p_extents[6], inv_h[3];
+  ple_lnum_t *cell_idx = NULL, *cell_rank = NULL, *count = NULL;
+  ple_lnum_t *_rank_pts_idx = NULL, *_rank_pts = NULL;
+
+  const int n_ranks = intersects->n;
+  const int stride = dim * 2;
+
+  /* Grid with about 2 cells per intersecting rank */
+
+  if (n_ranks > 4 && n_points > 0) {
+    n_cells_dim = (int)ceil(pow(2.0*n_ranks, 1.0/dim));
+    if (n_cells_dim > 128)
+      n_cells_dim = 128;
+  }
+
+  for (int k = 0; k < dim; k++)
+    n_cells *= n_cells_dim;
+
+  PLE_MALLOC(_rank_pts_idx, n_ranks + 1, ple_lnum_t);
+  PLE_MALLOC(count, (n_cells > n_ranks) ? n_cells : n_ranks, ple_lnum_t);
+
+  for (int i = 0; i < n_ranks + 1; i++)
+    _rank_pts_idx[i] = 0;
+
+  _point_extents(dim, idb, n_points, point_list, point_coords, NULL,
+                 p_extents);
+
+  for (int k = 0; k < dim; k++) {
+    double l = p_extents[k + dim] - p_extents[k];
+    inv_h[k] = (l > 0) ? n_cells_dim / l : 0.;
+  }
+
+  /* Bin rank extents */
+
+  PLE_MALLOC(cell_idx, n_cells + 1, ple_lnum_t);
+
+  for (ple_lnum_t c = 0; c < n_cells + 1; c++)
+    cell_idx[c] = 0;
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    for (int i = 0; i < n_ranks; i++) {
+
+      const double *r_extents = intersects->extents + i*stride;
+      int c_min[3] = {0, 0, 0}, c_max[3] = {0, 0, 0};
+
+      if (_intersect_extents(dim, r_extents, p_extents) == false)
+        continue;
+
+      for (int k = 0; k < dim; k++) {
+        double x_min = (r_extents[k] - p_extents[k]) * inv_h[k];
+        double x_max = (r_extents[k + dim] - p_extents[k]) * inv_h[k];
+        c_min[k] = (x_min > 0) ? (int)x_min : 0;
+        c_max[k] = (x_max < n_cells_dim - 1) ? (int)x_max : n_cells_dim - 1;
+        if (c_min[k] > n_cells_dim - 1)
+          c_min[k] = n_cells_dim - 1;
+      }
+
+      for (int c0 = c_min[0]; c0 <= c_max[0]; c0++) {
+        for (int c1 = c_min[1]; c1 <= c_max[1]; c1++) {
+          for (int c2 = c_min[2]; c2 <= c_max[2]; c2++) {
+            ple_lnum_t c = c0;
+            if (dim > 1)
+              c = c*n_cells_dim + c1;
+            if (dim > 2)
+              c = c*n_cells_dim + c2;
+            if (pass == 0)
+              cell_idx[c+1] += 1;
+            else
+              cell_rank[cell_idx[c] + count[c]++] = i;
+          }
+        }
+      }
+
+    }
+
+    if (pass == 0) {
+      for (ple_lnum_t c = 0; c < n_cells; c++)
+        cell_idx[c+1] += cell_idx[c];
+      PLE_MALLOC(cell_rank, cell_idx[n_cells], ple_lnum_t);
+      for (ple_lnum_t c = 0; c < n_cells; c++)
+        count[c] = 0;
+    }
+
+  }
+
+  /* Count then list points within rank extents */
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    for (int i = 0; i < n_ranks; i++)
+      count[i] = 0;
+
+    for (ple_lnum_t j = 0; j < n_points; j++) {
+
+      const ple_lnum_t coord_idx = (point_list != NULL) ?
+        point_list[j] - idb : j;
+      const ple_coord_t *coords = point_coords + dim*coord_idx;
+
+      ple_lnum_t c = 0;
+      for (int k = 0; k < dim; k++) {
+        int ck = (int)((coords[k] - p_extents[k]) * inv_h[k]);
+        if (ck > n_cells_dim - 1)
+          ck = n_cells_dim - 1;
+        else if (ck < 0)
+          ck = 0;
+        c = c*n_cells_dim + ck;
+      }
+
+      for (ple_lnum_t l = cell_idx[c]; l < cell_idx[c+1]; l++) {
+        const int i = cell_rank[l];
+        if (_within_extents(dim,
+                            coords,
+                            intersects->extents + i*stride) == true) {
+          if (pass == 0)
+            _rank_pts_idx[i+1] += 1;
+          else
+            _rank_pts[_rank_pts_idx[i] + count[i]] = j;
+          count[i] += 1;
+        }
+      }
+
+    }
+
+    if (pass == 0) {
+      for (int i = 0; i < n_ranks; i++)
+        _rank_pts_idx[i+1] += _rank_pts_idx[i];
+      PLE_MALLOC(_rank_pts, _rank_pts_idx[n_ranks], ple_lnum_t);
+    }
+
+  }
+
+  PLE_FREE(count);
+  PLE_FREE(cell_rank);
+  PLE_FREE(cell_idx);
+
+  *rank_pts_idx = _rank_pts_idx;
+  *rank_pts = _rank_pts;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize location information from previous locator info,
  * in parallel mode.
@@ -1152,15 +1351,14 @@ _locate_distant(ple_locator_t               *this_locator,
   MPI_Status status;
 
   ple_lnum_t _n_points = 0;
-  double extents[6];
 
   double comm_timing[4] = {0., 0., 0., 0.};
 
   ple_lnum_t *_point_list = NULL, *_point_id = NULL, *send_id = NULL;
+  ple_lnum_t *rank_pts_idx = NULL, *rank_pts = NULL;
   const ple_lnum_t *_point_list_p = NULL;
 
   const int dim = this_locator->dim;
-  const int stride = dim * 2;
   const int have_tags = this_locator->have_tags;
   const ple_lnum_t idb = this_locator->point_id_base;
 
@@ -1212,6 +1410,17 @@ _locate_distant(ple_locator_t               *this_locator,
                                    location,
                                    mesh_extents_f);
 
+  /* Distribute points to intersecting ranks */
+
+  _points_by_rank(dim,
+                  &intersects,
+                  idb,
+                  _n_points,
+                  _point_list_p,
+                  point_coords,
+                  &rank_pts_idx,
+                  &rank_pts);
+
   /* Allocate buffers */
 
   PLE_MALLOC(send_coords, _n_points * dim, ple_coord_t);
@@ -1246,42 +1455,35 @@ _locate_distant(ple_locator_t               *this_locator,
     dist_index = i; /* Ordering (communication schema) not yet optimized */
     dist_rank  = intersects.rank[dist_index];
 
-    /* Prepare and send coords that should fit in each send buffer */
-    /* Reset buffers for current intersect rank */
+    /* Build partial buffer for current intersect rank */
 
     n_coords_loc = 0;
 
-    for (k = 0; k < stride; k++)
-      extents[k] = intersects.extents[dist_index*stride + k];
-
-    /* Build partial buffer */
-
-    for (j = 0; j < _n_points; j++) {
+    for (ple_lnum_t l = rank_pts_idx[dist_index];
+         l < rank_pts_idx[dist_index + 1];
+         l++) {
 
       ple_lnum_t coord_idx;
 
+      j = rank_pts[l];
+
       if (_point_list_p != NULL)
         coord_idx = _point_list_p[j] - idb;
       else
         coord_idx = j;
 
-      if (_within_extents(dim,
-                          &(point_coords[dim*coord_idx]),
-                          extents) == true) {
-
-        if (_point_id != NULL)
-          send_id[n_coords_loc] = _point_id[j] -idb;
-        else
-          send_id[n_coords_loc] = j;
+      if (_point_id != NULL)
+        send_id[n_coords_loc] = _point_id[j] -idb;
+      else
+        send_id[n_coords_loc] = j;
 
-        for (k = 0; k < dim; k++)
-          send_coords[n_coords_loc*dim + k] = point_coords[dim*coord_idx + k];
+      for (k = 0; k < dim; k++)
+        send_coords[n_coords_loc*dim + k] = point_coords[dim*coord_idx + k];
 
-        if (have_tags)
-          send_tag[n_coords_loc] = point_tag[j];
+      if (have_tags)
+        send_tag[n_coords_loc] = point_tag[send_id[n_coords_loc]];
 
-        n_coords_loc += 1;
-      }
+      n_coords_loc += 1;
 
     }
 
@@ -1390,6 +1592,9 @@ _locate_distant(ple_locator_t               *this_locator,
 
   /* Free temporary arrays */
 
+  PLE_FREE(rank_pts_idx);
+  PLE_FREE(rank_pts);
+
   PLE_FREE(send_id);
   PLE_FREE(send_tag);
   PLE_FREE(send_coords);
@@ -1690,870 +1895,763 @@ _locate_all_distant(ple_locator_t               *this_locator,
   this_locator->location_cpu_time[1] += comm_timing[1];
 }
 
-#endif /* defined(PLE_HAVE_MPI) */
-
 /*----------------------------------------------------------------------------
- * Initialize location information from previous locator info,
- * in serial mode.
+ * Initialize location information by relocating previously located points
+ * on their previous owner rank, in parallel mode.
  *
- * parameters:
- *   this_locator      <-> pointer to locator structure
- *   n_points          <-- number of points to locate
- *   location          --> number of distant element containing or closest
- *                         to each point, or -1 (size: n_points)
- *----------------------------------------------------------------------------*/
-
-static void
-_transfer_location_local(ple_locator_t  *this_locator,
-                         ple_lnum_t      n_points,
-                         ple_lnum_t      location[])
-{
-  ple_lnum_t j;
-
-  /* Initialize locations */
-
-  for (j = 0; j < n_points; j++)
-    location[j] = -1;
-
-  /* Update with existing location info *
-     exact location info is not necessary, so not determined;
-     all that is necessary is to mark located points as such */
-
-  if (this_locator->n_intersects == 1) {
-
-    const ple_lnum_t _n_points =    this_locator->local_points_idx[1]
-                                  - this_locator->local_points_idx[0];
-
-    const ple_lnum_t idb = this_locator->point_id_base;
-    const ple_lnum_t *_interior_list = this_locator->interior_list;
-
-    const ple_lnum_t *_local_point_ids = this_locator->local_point_ids;
-    const ple_lnum_t *dist_v_ptr = this_locator->distant_point_location;
-
-    for (j = 0; j < _n_points; j++) {
-      ple_lnum_t k = _interior_list[_local_point_ids[j] - idb];
-      location[k] = dist_v_ptr[j];
-    }
-
-  }
-
-  this_locator->n_intersects = 0;
-  PLE_FREE(this_locator->intersect_rank);
-  PLE_FREE(this_locator->comm_order);
-  PLE_FREE(this_locator->local_points_idx);
-  PLE_FREE(this_locator->distant_points_idx);
-  PLE_FREE(this_locator->local_point_ids);
-  PLE_FREE(this_locator->distant_point_location);
-  PLE_FREE(this_locator->distant_point_coords);
-
-  this_locator->n_interior = 0;
-  this_locator->n_exterior = 0;
-  PLE_FREE(this_locator->interior_list);
-  PLE_FREE(this_locator->exterior_list);
-}
-
-/*----------------------------------------------------------------------------
- * Determine or update possibly intersecting ranks for unlocated elements,
- * in parallel.
+ * The point set must be the same as for the previous location (though
+ * point coordinates and the mesh may have moved). Each previously located
+ * point is only sent to the rank on which it was located; it keeps that
+ * rank if it is found inside one of its elements (0 <= distance <= 1),
+ * and is marked as unlocated otherwise, so that the following global
+ * search is restricted to points which were lost.
+ *
+ * If the point set does not match the previous location on some rank,
+ * all points are marked as unlocated.
  *
  * parameters:
- *   this_locator       <-- pointer to locator structure
+ *   this_locator       <-> pointer to locator structure
  *   mesh               <-- pointer to mesh representation structure
  *   tolerance_base     <-- associated fixed tolerance
  *   tolerance_fraction <-- associated fraction of element bounding
  *                          boxes added to tolerance
  *   n_points           <-- number of points to locate
  *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
  *   point_coords       <-- coordinates of points to locate
  *                          (dimension: dim * n_points)
- *   location           <-> number of distant element containing or closest
+ *   location           --> number of distant element containing or closest
  *                          to each point, or -1 (size: n_points)
- *   mesh_extents_f     <-- pointer to function computing mesh or mesh
- *                          subset or element extents
- *
- * returns:
- *   local rank intersection info
+ *   location_rank_id   --> rank id for distant element containing or closest
+ *                          to each point, or -1
+ *   distance           <-> distance from point to element indicated by
+ *                          location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                          > 1 if outside (size: n_points)
+ *   mesh_locate_f      <-- function locating the points on local elements
  *----------------------------------------------------------------------------*/
 
-static _rank_intersects_t
-_intersects_local(ple_locator_t       *this_locator,
-                  const void          *mesh,
-                  float                tolerance_base,
-                  float                tolerance_fraction,
-                  ple_lnum_t           n_points,
-                  const ple_lnum_t     point_list[],
-                  const ple_coord_t    point_coords[],
-                  const ple_lnum_t     location[],
-                  ple_mesh_extents_t  *mesh_extents_f)
+static void
+_relocate_distant(ple_locator_t               *this_locator,
+                  const void                  *mesh,
+                  float                        tolerance_base,
+                  float                        tolerance_fraction,
+                  ple_lnum_t                   n_points,
+                  const ple_lnum_t             point_list[],
+                  const int                    point_tag[],
+                  const ple_coord_t            point_coords[],
+                  ple_lnum_t                   location[],
+                  ple_lnum_t                   location_rank_id[],
+                  float                        distance[],
+                  ple_mesh_elements_locate_t  *mesh_locate_f)
 {
-  int i;
-  int stride2;
-  double extents[12];
+  ple_lnum_t j, k;
+  int loc_flag, glob_flag;
+  ple_lnum_t *pt_id = NULL;
 
-  int j;
-  int n_intersects;
+  double comm_timing[4] = {0., 0., 0., 0.};
 
   const int dim = this_locator->dim;
+  const int have_tags = this_locator->have_tags;
+  const ple_lnum_t idb = this_locator->point_id_base;
+  const ple_lnum_t n_interior = this_locator->n_interior;
+  const ple_lnum_t *_interior_list = this_locator->interior_list;
 
-  _rank_intersects_t intersects;
-
-  /* Update intersects */
+  /* Initialize locations */
 
-  intersects.n = 0;
+  for (j = 0; j < n_points; j++) {
+    location[j] = -1;
+    location_rank_id[j] = -1;
+  }
 
-  mesh_extents_f(mesh,
-                 1,
-                 tolerance_fraction,
-                 extents);
+  /* Previous location info is usable only if the point set did not
+     change on any rank, since relocation exchanges are pairwise */
 
-  _point_extents(dim,
-                 this_locator->point_id_base,
-                 n_points,
-                 point_list,
-                 point_coords,
-                 location,
-                 extents + 2*dim);
+  loc_flag = (   this_locator->n_interior + this_locator->n_exterior
+              == n_points) ? 1 : 0;
 
-  for (i = 0; i < dim; i++) {
+  _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
 
-    if (extents[i] > -HUGE_VAL + tolerance_base)
-      extents[i]         -= tolerance_base;
-    else
-      extents[i] = -HUGE_VAL;
-    if (extents[i] < HUGE_VAL - tolerance_base)
-      extents[i +   dim] += tolerance_base;
-    else
-      extents[i +   dim] = HUGE_VAL;
+  MPI_Allreduce(&loc_flag, &glob_flag, 1, MPI_INT, MPI_MIN,
+                this_locator->comm);
 
-    if (extents[i + 2*dim] > -HUGE_VAL + tolerance_base)
-      extents[i + 2*dim] -= tolerance_base;
-    else
-      extents[i + 2*dim] = -HUGE_VAL;
-    if (extents[i + 3*dim] < HUGE_VAL - tolerance_base)
-      extents[i + 3*dim] += tolerance_base;
-    else
-      extents[i + 3*dim] = HUGE_VAL;
+  _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
 
-  }
+  if (glob_flag == 0)
+    this_locator->n_intersects = 0;
 
-  /* Determine possible overlap */
+  /* Local point id matching each previously located point
+     (the interior list refers to the point list if one is given) */
 
-  stride2 = dim * 2; /* Stride for one type of extent */
+  if (this_locator->n_intersects > 0) {
 
-  n_intersects = 0;
+    PLE_MALLOC(pt_id, n_interior, ple_lnum_t);
 
-  if (_intersect_extents(dim, extents, extents + (2*dim)) == true)
-    n_intersects += 1;
+    if (point_list == NULL) {
+      for (k = 0; k < n_interior; k++)
+        pt_id[k] = _interior_list[k] - idb;
+    }
+    else {
+      ple_lnum_t *inv_list = NULL;
+      ple_lnum_t n_max = 0;
+      for (j = 0; j < n_points; j++) {
+        if (point_list[j] - idb >= n_max)
+          n_max = point_list[j] - idb + 1;
+      }
+      PLE_MALLOC(inv_list, n_max, ple_lnum_t);
+      for (j = 0; j < n_max; j++)
+        inv_list[j] = -1;
+      for (j = 0; j < n_points; j++)
+        inv_list[point_list[j] - idb] = j;
+      for (k = 0; k < n_interior; k++) {
+        ple_lnum_t l = _interior_list[k] - idb;
+        pt_id[k] = (l < n_max) ? inv_list[l] : -1;
+      }
+      PLE_FREE(inv_list);
+    }
 
-  intersects.n = n_intersects;
-  PLE_MALLOC(intersects.extents, intersects.n * stride2, double);
+  }
 
-  /* Copy only element (and not point) extents */
+  /* Loop on previously communicating ranks
+     (the intersection is symmetric, so counts are known on both sides) */
 
-  for (j = 0; j < stride2; j++)
-    intersects.extents[j] = extents[j];
+  for (int li = 0; li < this_locator->n_intersects; li++) {
 
-  return intersects;
-}
-
-/*----------------------------------------------------------------------------
- * Prepare locator for use with a given mesh representation and point set.
- *
- * parameters:
- *   this_locator       <-> pointer to locator structure
- *   mesh               <-- pointer to mesh representation structure
- *   tolerance_base     <-- associated fixed tolerance
- *   tolerance_fraction <-- associated fraction of element bounding
- *                          boxes added to tolerance
- *   n_points           <-- number of points to locate
- *   point_list         <-- optional indirection array to point_coords
- *   point_tag          <-- optional point tag (size: n_points)
- *   point_coords       <-- coordinates of points to locate
- *                          (dimension: dim * n_points)
- *   distance           --> optional distance from point to matching element:
- *                          < 0 if unlocated; 0 - 1 if inside and > 1 if
- *                          outside a volume element, or absolute distance
- *                          to a surface element (size: n_points)
- *   mesh_extents_f     <-- function computing mesh or mesh subset extents
- *   mesh_locate_f      <-- function locating the closest local elements
- *----------------------------------------------------------------------------*/
-
-static void
-_locate_all_local(ple_locator_t               *this_locator,
-                  const void                  *mesh,
-                  float                        tolerance_base,
-                  float                        tolerance_fraction,
-                  ple_lnum_t                   n_points,
-                  const ple_lnum_t             point_list[],
-                  const int                    point_tag[],
-                  const ple_coord_t            point_coords[],
-                  ple_lnum_t                   location[],
-                  float                        distance[],
-                  ple_mesh_extents_t          *mesh_extents_f,
-                  ple_mesh_elements_locate_t  *mesh_locate_f)
-{
-  int l;
-  ple_lnum_t j, k;
-  ple_lnum_t n_coords, n_interior, n_exterior, coord_idx;
-  _rank_intersects_t intersects;
-
-  const int dim = this_locator->dim;
-  const int have_tags = this_locator->have_tags;
-  const ple_lnum_t idb = this_locator->point_id_base;
-
-  /* Update intersect for current point list */
-
-  intersects = _intersects_local(this_locator,
-                                 mesh,
-                                 tolerance_base,
-                                 tolerance_fraction,
-                                 n_points,
-                                 point_list,
-                                 point_coords,
-                                 location,
-                                 mesh_extents_f);
-
-  n_coords = 0;
-
-  this_locator->n_intersects = intersects.n;
+    int i = (this_locator->comm_order != NULL) ?
+      this_locator->comm_order[li] : li;
 
-  /* Build partial buffer */
+    MPI_Status status;
+    ple_coord_t *send_coords, *coords_dist;
+    int *send_tag = NULL, *tag_dist = NULL;
+    ple_lnum_t *location_loc, *location_dist;
+    float *distance_loc, *distance_dist;
 
-  if (intersects.n > 0) {
+    const int dist_rank = this_locator->intersect_rank[i];
 
-    ple_lnum_t *_location = location;
-    float *_distance = distance;
+    const ple_lnum_t n_coords_loc =   this_locator->local_points_idx[i+1]
+                                    - this_locator->local_points_idx[i];
+    const ple_lnum_t n_coords_dist =   this_locator->distant_points_idx[i+1]
+                                     - this_locator->distant_points_idx[i];
 
-    ple_lnum_t *id;
-    int *tag;
-    ple_coord_t *coords;
+    const ple_lnum_t *_local_point_ids
+      = this_locator->local_point_ids + this_locator->local_points_idx[i];
 
-    PLE_MALLOC(coords, n_points * dim, ple_coord_t);
-    PLE_MALLOC(id, n_points, ple_lnum_t);
+    /* Send current coordinates of points located on distant rank */
 
+    PLE_MALLOC(send_coords, n_coords_loc*dim, ple_coord_t);
     if (have_tags)
-      PLE_MALLOC(tag, n_points, int);
-    else
-      tag = NULL;
-
-    for (j = 0; j < n_points; j++) {
-
-      if (location[j] > -1) {
-        if (distance == NULL)
-          continue;
-        else if (distance[j] < 1)
-          continue;
+      PLE_MALLOC(send_tag, n_coords_loc, int);
+
+    for (k = 0; k < n_coords_loc; k++) {
+      j = pt_id[_local_point_ids[k]];
+      if (j > -1) {
+        ple_lnum_t coord_idx = (point_list != NULL) ? point_list[j] - idb : j;
+        for (int l = 0; l < dim; l++)
+          send_coords[k*dim + l] = point_coords[dim*coord_idx + l];
+        if (have_tags)
+          send_tag[k] = point_tag[j];
+      }
+      else {
+        for (int l = 0; l < dim; l++)
+          send_coords[k*dim + l] = 0.;
+        if (have_tags)
+          send_tag[k] = 0;
       }
+    }
 
-      if (point_list != NULL)
-        coord_idx = point_list[j] - idb;
-      else
-        coord_idx = j;
+    PLE_MALLOC(coords_dist, n_coords_dist*dim, ple_coord_t);
+    if (have_tags)
+      PLE_MALLOC(tag_dist, n_coords_dist, int);
 
-      if (_within_extents(dim,
-                          &(point_coords[dim*coord_idx]),
-                          intersects.extents) == true) {
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
 
-        for (k = 0; k < dim; k++)
-          coords[n_coords*dim + k]
-            = point_coords[dim*coord_idx + k];
+    MPI_Sendrecv(send_coords, (int)(n_coords_loc*dim),
+                 PLE_MPI_COORD, dist_rank, PLE_MPI_TAG,
+                 coords_dist, (int)(n_coords_dist*dim),
+                 PLE_MPI_COORD, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
 
-        id[n_coords] = j;
+    if (have_tags)
+      MPI_Sendrecv(send_tag, (int)(n_coords_loc),
+                   MPI_INT, dist_rank, PLE_MPI_TAG,
+                   tag_dist, (int)(n_coords_dist),
+                   MPI_INT, dist_rank, PLE_MPI_TAG,
+                   this_locator->comm, &status);
 
-        if (have_tags)
-          tag[n_coords] = point_tag[j];
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
 
-        n_coords += 1;
-      }
+    PLE_FREE(send_tag);
+    PLE_FREE(send_coords);
 
-    }
+    /* Locate received coords on local rank */
 
-    PLE_REALLOC(coords, n_coords * dim, ple_coord_t);
-    PLE_REALLOC(id, n_coords, ple_lnum_t);
-    if (have_tags)
-      PLE_REALLOC(tag, n_coords, int);
+    PLE_MALLOC(location_dist, n_coords_dist, ple_lnum_t);
+    PLE_MALLOC(distance_dist, n_coords_dist, float);
 
-    if (n_coords < n_points) {
-      PLE_MALLOC(_location, n_coords, ple_lnum_t);
-      for (j = 0; j < n_coords; j++)
-        _location[j] = location[id[j]];
-    }
-    if (distance == NULL || n_coords < n_points) {
-      PLE_MALLOC(_distance, n_coords, float);
-      if (distance == NULL) {
-        for (j = 0; j < n_coords; j++)
-          _distance[j] = -1.0;
-      }
-      else {
-        for (j = 0; j < n_coords; j++)
-          _distance[j] = distance[id[j]];
-      }
+    for (k = 0; k < n_coords_dist; k++) {
+      location_dist[k] = -1;
+      distance_dist[k] = -1.0;
     }
 
     mesh_locate_f(mesh,
                   tolerance_base,
                   tolerance_fraction,
-                  n_coords,
-                  coords,
-                  tag,
-                  _location,
-                  _distance);
-
-    PLE_FREE(coords);
-
-    if (n_coords < n_points) {
-      for (j = 0; j < n_coords; j++) {
-        if (_location[j] > -1) {
-          k = id[j];
-          if (distance != NULL) {
-            if (distance[k] <= _distance[j])
-              continue;
-            else
-              distance[k] = _distance[j];
-          }
-          location[k] = _location[j];
-        }
-      }
-    }
+                  n_coords_dist,
+                  coords_dist,
+                  tag_dist,
+                  location_dist,
+                  distance_dist);
 
-    if (_location != location)
-      PLE_FREE(_location);
+    PLE_FREE(tag_dist);
+    PLE_FREE(coords_dist);
 
-    if (_distance != distance)
-      PLE_FREE(_distance);
+    /* Exchange location return information with distant rank */
 
-    PLE_FREE(tag);
-    PLE_FREE(id);
+    PLE_MALLOC(location_loc, n_coords_loc, ple_lnum_t);
+    PLE_MALLOC(distance_loc, n_coords_loc, float);
 
-  }
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
 
-  PLE_FREE(intersects.extents);
+    MPI_Sendrecv(location_dist, (int)n_coords_dist,
+                 PLE_MPI_LNUM, dist_rank, PLE_MPI_TAG,
+                 location_loc, (int)n_coords_loc,
+                 PLE_MPI_LNUM, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
 
-  /* Reorganize location information */
-  /*---------------------------------*/
+    MPI_Sendrecv(distance_dist, (int)n_coords_dist,
+                 MPI_FLOAT, dist_rank, PLE_MPI_TAG,
+                 distance_loc, (int)n_coords_loc,
+                 MPI_FLOAT, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
 
-  /* Now that location is done, the location[] array contains
-     either -1 if a point was not located, or a local index;
-     the distance[] array is not needed anymore now that all comparisons have
-     been done */
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
 
-  this_locator->n_interior = 0;
-  this_locator->n_exterior = 0;
-  for (j = 0; j < n_points; j++) {
-    if (location[j] > -1)
-      this_locator->n_interior += 1;
-    else
-      this_locator->n_exterior += 1;
-  }
+    PLE_FREE(location_dist);
+    PLE_FREE(distance_dist);
 
-  PLE_MALLOC(this_locator->interior_list, this_locator->n_interior, ple_lnum_t);
-  PLE_MALLOC(this_locator->exterior_list, this_locator->n_exterior, ple_lnum_t);
+    /* Keep points still inside an element of their previous owner */
 
-  /* Organize total number of "local" and "distant" points */
+    for (k = 0; k < n_coords_loc; k++) {
+      j = pt_id[_local_point_ids[k]];
+      if (j > -1 && distance_loc[k] > -0.1 && distance_loc[k] <= 1.) {
+        location[j] = location_loc[k];
+        location_rank_id[j] = dist_rank;
+        distance[j] = distance_loc[k];
+      }
+    }
 
-  PLE_REALLOC(this_locator->local_points_idx, 2, ple_lnum_t);
-  PLE_REALLOC(this_locator->distant_points_idx, 2, ple_lnum_t);
+    PLE_FREE(location_loc);
+    PLE_FREE(distance_loc);
 
-  this_locator->local_points_idx[0] = 0;
-  this_locator->local_points_idx[1] = this_locator->n_interior;
+  } /* End of loop on MPI ranks */
 
-  this_locator->distant_points_idx[0] = 0;
-  this_locator->distant_points_idx[1] = this_locator->n_interior;
+  PLE_FREE(pt_id);
 
-  this_locator->local_point_ids = NULL; /* Not needed for single-process */
+  this_locator->n_intersects = 0;
+  PLE_FREE(this_locator->intersect_rank);
+  PLE_FREE(this_locator->comm_order);
+  PLE_FREE(this_locator->local_points_idx);
+  PLE_FREE(this_locator->distant_points_idx);
+  PLE_FREE(this_locator->local_point_ids);
+  PLE_FREE(this_locator->distant_point_location);
+  PLE_FREE(this_locator->distant_point_coords);
 
-  PLE_REALLOC(this_locator->distant_point_location,
-              this_locator->n_interior,
-              ple_lnum_t);
-  PLE_REALLOC(this_locator->distant_point_coords,
-              this_locator->n_interior * dim,
-              ple_coord_t);
+  this_locator->n_interior = 0;
+  this_locator->n_exterior = 0;
+  PLE_FREE(this_locator->interior_list);
+  PLE_FREE(this_locator->exterior_list);
 
-  n_interior = 0;
-  n_exterior = 0;
+  this_locator->location_wtime[1] += comm_timing[0];
+  this_locator->location_cpu_time[1] += comm_timing[1];
+}
 
-  for (j = 0; j < n_points; j++) {
-
-    if (point_list != NULL)
-      coord_idx = point_list[j] - idb;
-    else
-      coord_idx = j;
-
-    if (location[j] > -1) {
-      this_locator->distant_point_location[n_interior] = location[j];
-      for (l = 0; l < dim; l++) {
-        this_locator->distant_point_coords[n_interior*dim + l]
-          = point_coords[coord_idx*dim + l];
-      }
-      this_locator->interior_list[n_interior] = j + idb;
-      n_interior += 1;
-    }
-    else {
-      this_locator->exterior_list[n_exterior] = j + idb;
-      n_exterior += 1;
-    }
-
-  }
-
-}
-
-#if defined(PLE_HAVE_MPI)
+#endif /* defined(PLE_HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
- * Distribute variable defined on distant points to processes owning
- * the original points (i.e. distant processes).
- *
- * The exchange is symmetric if both variables are defined, receive
- * only if distant_var is NULL, or send only if local_var is NULL.
+ * Initialize location information from previous locator info,
+ * in serial mode.
  *
  * parameters:
- *   this_locator  <-- pointer to locator structure
- *   distant_var   <-> variable defined on distant points (ready to send)
- *   local_var     <-> variable defined on local points (received)
- *   local_list    <-- optional indirection list for local_var
- *   datatype      <-- variable type
- *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
- *   reverse       <-- if true, exchange is reversed
- *                     (receive values associated with distant points
- *                     from the processes owning the original points)
- *   interior      <-- if true, local_var is restricted to located points
+ *   this_locator      <-> pointer to locator structure
+ *   n_points          <-- number of points to locate
+ *   location          --> number of distant element containing or closest
+ *                         to each point, or -1 (size: n_points)
  *----------------------------------------------------------------------------*/
 
 static void
-_exchange_point_var_distant(ple_locator_t     *this_locator,
-                            void              *distant_var,
-                            void              *local_var,
-                            const ple_lnum_t  *local_list,
-                            MPI_Datatype       datatype,
-                            size_t             stride,
-                            bool               reverse,
-                            bool               interior)
+_transfer_location_local(ple_locator_t  *this_locator,
+                         ple_lnum_t      n_points,
+                         ple_lnum_t      location[])
 {
-  int dist_v_count, loc_v_count, size;
-  int dist_rank;
-  int dist_v_flag, loc_v_flag;
-  ple_lnum_t n_points_loc, n_points_loc_max, n_points_dist;
-  size_t dist_v_idx;
-  void *dist_v_ptr;
-  void *loc_v_buf;
+  ple_lnum_t j;
 
-  double comm_timing[4] = {0., 0., 0., 0.};
+  /* Initialize locations */
 
-  MPI_Aint lb, extent;
-  MPI_Status status;
+  for (j = 0; j < n_points; j++)
+    location[j] = -1;
 
-  /* Check extent of datatype */
+  /* Update with existing location info *
+     exact location info is not necessary, so not determined;
+     all that is necessary is to mark located points as such */
 
-  MPI_Type_get_extent(datatype, &lb, &extent);
-  MPI_Type_size(datatype, &size);
+  if (this_locator->n_intersects == 1) {
 
-  if (extent != size)
-    ple_error(__FILE__, __LINE__, 0,
-              _("_exchange_point_var() is not implemented for use with\n"
-                "MPI datatypes associated with structures using padding\n"
-                "(for which size != extent)."));
+    const ple_lnum_t _n_points =    this_locator->local_points_idx[1]
+                                  - this_locator->local_points_idx[0];
 
-  /* Initialization */
+    const ple_lnum_t idb = this_locator->point_id_base;
+    const ple_lnum_t *_interior_list = this_locator->interior_list;
 
-  n_points_loc_max = 0;
+    const ple_lnum_t *_local_point_ids = this_locator->local_point_ids;
+    const ple_lnum_t *dist_v_ptr = this_locator->distant_point_location;
+
+    for (j = 0; j < _n_points; j++) {
+      ple_lnum_t k = _interior_list[_local_point_ids[j] - idb];
+      location[k] = dist_v_ptr[j];
+    }
 
-  for (int i = 0; i < this_locator->n_intersects; i++) {
-    n_points_loc =    this_locator->local_points_idx[i+1]
-                    - this_locator->local_points_idx[i];
-    if (n_points_loc > n_points_loc_max)
-      n_points_loc_max = n_points_loc;
   }
 
-  PLE_MALLOC(loc_v_buf, n_points_loc_max*size*stride, char);
+  this_locator->n_intersects = 0;
+  PLE_FREE(this_locator->intersect_rank);
+  PLE_FREE(this_locator->comm_order);
+  PLE_FREE(this_locator->local_points_idx);
+  PLE_FREE(this_locator->distant_points_idx);
+  PLE_FREE(this_locator->local_point_ids);
+  PLE_FREE(this_locator->distant_point_location);
+  PLE_FREE(this_locator->distant_point_coords);
 
-  const ple_lnum_t *il = this_locator->interior_list;
+  this_locator->n_interior = 0;
+  this_locator->n_exterior = 0;
+  PLE_FREE(this_locator->interior_list);
+  PLE_FREE(this_locator->exterior_list);
+}
 
-  /* Loop on MPI ranks */
-  /*-------------------*/
+/*----------------------------------------------------------------------------
+ * Determine or update possibly intersecting ranks for unlocated elements,
+ * in parallel.
+ *
+ * parameters:
+ *   this_locator       <-- pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated fixed tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding
+ *                          boxes added to tolerance
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   location           <-> number of distant element containing or closest
+ *                          to each point, or -1 (size: n_points)
+ *   mesh_extents_f     <-- pointer to function computing mesh or mesh
+ *                          subset or element extents
+ *
+ * returns:
+ *   local rank intersection info
+ *----------------------------------------------------------------------------*/
 
-  for (int li = 0; li < this_locator->n_intersects; li++) {
+static _rank_intersects_t
+_intersects_local(ple_locator_t       *this_locator,
+                  const void          *mesh,
+                  float                tolerance_base,
+                  float                tolerance_fraction,
+                  ple_lnum_t           n_points,
+                  const ple_lnum_t     point_list[],
+                  const ple_coord_t    point_coords[],
+                  const ple_lnum_t     location[],
+                  ple_mesh_extents_t  *mesh_extents_f)
+{
+  int i;
+  int stride2;
+  double extents[12];
 
-    int i = (this_locator->comm_order != NULL) ?
-      this_locator->comm_order[li] : li;
+  int j;
+  int n_intersects;
 
-    const ple_lnum_t *_local_point_ids
-      = this_locator->local_point_ids + this_locator->local_points_idx[i];
+  const int dim = this_locator->dim;
 
-    dist_rank = this_locator->intersect_rank[i];
+  _rank_intersects_t intersects;
 
-    n_points_loc =    this_locator->local_points_idx[i+1]
-                    - this_locator->local_points_idx[i];
+  /* Update intersects */
 
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
+  intersects.n = 0;
 
-    if (distant_var != NULL && n_points_dist > 0)
-      dist_v_flag = 1;
-    else
-      dist_v_flag = 0;
+  mesh_extents_f(mesh,
+                 1,
+                 tolerance_fraction,
+                 extents);
 
-    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+  _point_extents(dim,
+                 this_locator->point_id_base,
+                 n_points,
+                 point_list,
+                 point_coords,
+                 location,
+                 extents + 2*dim);
 
-    MPI_Sendrecv(&dist_v_flag, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
-                 &loc_v_flag, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
-                 this_locator->comm, &status);
+  for (i = 0; i < dim; i++) {
 
-    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+    if (extents[i] > -HUGE_VAL + tolerance_base)
+      extents[i]         -= tolerance_base;
+    else
+      extents[i] = -HUGE_VAL;
+    if (extents[i] < HUGE_VAL - tolerance_base)
+      extents[i +   dim] += tolerance_base;
+    else
+      extents[i +   dim] = HUGE_VAL;
 
-    if (loc_v_flag == 1 && (local_var == NULL || n_points_loc == 0))
-      ple_error(__FILE__, __LINE__, 0,
-                _("Incoherent arguments to different instances in "
-                  "_exchange_point_var().\n"
-                  "Send and receive operations do not match "
-                  "(dist_rank = %d\n)\n"), dist_rank);
+    if (extents[i + 2*dim] > -HUGE_VAL + tolerance_base)
+      extents[i + 2*dim] -= tolerance_base;
+    else
+      extents[i + 2*dim] = -HUGE_VAL;
+    if (extents[i + 3*dim] < HUGE_VAL - tolerance_base)
+      extents[i + 3*dim] += tolerance_base;
+    else
+      extents[i + 3*dim] = HUGE_VAL;
 
-    dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
-    dist_v_count = n_points_dist * stride * dist_v_flag;
+  }
 
-    if (loc_v_flag > 0)
-      loc_v_count = n_points_loc*stride;
-    else
-      loc_v_count = 0;
+  /* Determine possible overlap */
 
-    /* Exchange information */
+  stride2 = dim * 2; /* Stride for one type of extent */
 
-    if (distant_var != NULL)
-      dist_v_ptr = (void *)(((char *)distant_var) + dist_v_idx);
-    else
-      dist_v_ptr = NULL;
+  n_intersects = 0;
 
-    if (reverse == false) {
+  if (_intersect_extents(dim, extents, extents + (2*dim)) == true)
+    n_intersects += 1;
 
-      _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+  intersects.n = n_intersects;
+  PLE_MALLOC(intersects.extents, intersects.n * stride2, double);
 
-      MPI_Sendrecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                   loc_v_buf, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                   this_locator->comm, &status);
+  /* Copy only element (and not point) extents */
 
-      _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+  for (j = 0; j < stride2; j++)
+    intersects.extents[j] = extents[j];
 
-      if (loc_v_flag > 0) {
-        if (local_list == NULL) {
-          const size_t nbytes = stride*size;
-          if (this_locator->n_exterior == 0 || interior) {
-            for (int k = 0; k < n_points_loc; k++) {
-              char *local_v_p = (char *)local_var + _local_point_ids[k]*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-          else {
-            for (int k = 0; k < n_points_loc; k++) {
-              char *local_v_p =   (char *)local_var
-                                + il[_local_point_ids[k]]*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-        }
-        else {
-          if (this_locator->n_exterior == 0 || interior) {
-            const size_t nbytes = stride*size;
-            const ple_lnum_t idb = this_locator->point_id_base;
-            for (int k = 0; k < n_points_loc; k++) {
-              char *local_v_p =   (char *)local_var
-                                + (local_list[_local_point_ids[k]] - idb)*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-          else {
-            const size_t nbytes = stride*size;
-            const ple_lnum_t idb = this_locator->point_id_base;
-            for (int k = 0; k < n_points_loc; k++) {
-              char *local_v_p =   (char *)local_var
-                                +  (local_list[il[_local_point_ids[k]]] - idb)
-                                  *nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-        }
-      }
-
-    }
-    else { /* if (reverse == true) */
-
-      if (loc_v_flag > 0) {
-        if (local_list == NULL) {
-          if (this_locator->n_exterior == 0 || interior) {
-            const size_t nbytes = stride*size;
-            for (int k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var + _local_point_ids[k]*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-          else {
-            const size_t nbytes = stride*size;
-            for (int k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var + il[_local_point_ids[k]]*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-        }
-        else {
-          const size_t nbytes = stride*size;
-          const ple_lnum_t idb = this_locator->point_id_base;
-          if (this_locator->n_exterior == 0 || interior) {
-            for (int k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var
-                  + (local_list[_local_point_ids[k]] - idb)*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-          else {
-            for (int k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var
-                  + (local_list[il[_local_point_ids[k]]] - idb)*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-        }
-      }
-
-      _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
-
-      MPI_Sendrecv(loc_v_buf, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                   dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                   this_locator->comm, &status);
-
-      _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
-
-    }
-
-  } /* End of loop on MPI ranks */
-
-  PLE_FREE(loc_v_buf);
-
-  this_locator->exchange_wtime[1] += comm_timing[0];
-  this_locator->exchange_cpu_time[1] += comm_timing[1];
+  return intersects;
 }
 
 /*----------------------------------------------------------------------------
- * Distribute variable defined on distant points to processes owning
- * the original points (i.e. distant processes).
- *
- * The exchange is symmetric if both variables are defined, receive
- * only if distant_var is NULL, or send only if local_var is NULL.
- *
- * This variant of the function uses asynchronous MPI calls.
+ * Prepare locator for use with a given mesh representation and point set.
  *
  * parameters:
- *   this_locator  <-- pointer to locator structure
- *   distant_var   <-> variable defined on distant points (ready to send)
- *   local_var     <-> variable defined on local points (received)
- *   local_list    <-- optional indirection list for local_var
- *   datatype      <-- variable type
- *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
- *   reverse       <-- if true, exchange is reversed
- *                     (receive values associated with distant points
- *                     from the processes owning the original points)
- *   interior      <-- if true, local_var is restricted to located points
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated fixed tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding
+ *                          boxes added to tolerance
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   distance           --> optional distance from point to matching element:
+ *                          < 0 if unlocated; 0 - 1 if inside and > 1 if
+ *                          outside a volume element, or absolute distance
+ *                          to a surface element (size: n_points)
+ *   mesh_extents_f     <-- function computing mesh or mesh subset extents
+ *   mesh_locate_f      <-- function locating the closest local elements
  *----------------------------------------------------------------------------*/
 
 static void
-_exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
-                                 void              *distant_var,
-                                 void              *local_var,
-                                 const ple_lnum_t  *local_list,
-                                 MPI_Datatype       datatype,
-                                 size_t             stride,
-                                 bool               reverse,
-                                 bool               interior)
+_locate_all_local(ple_locator_t               *this_locator,
+                  const void                  *mesh,
+                  float                        tolerance_base,
+                  float                        tolerance_fraction,
+                  ple_lnum_t                   n_points,
+                  const ple_lnum_t             point_list[],
+                  const int                    point_tag[],
+                  const ple_coord_t            point_coords[],
+                  ple_lnum_t                   location[],
+                  float                        distance[],
+                  ple_mesh_extents_t          *mesh_extents_f,
+                  ple_mesh_elements_locate_t  *mesh_locate_f)
 {
-  int dist_v_count, loc_v_count, size;
-  int dist_rank;
-  ple_lnum_t n_points_loc, n_points_loc_tot, n_points_dist;
-  size_t dist_v_idx;
-  unsigned char *dist_v_ptr, *loc_v_ptr;
+  int l;
+  ple_lnum_t j, k;
+  ple_lnum_t n_coords, n_interior, n_exterior, coord_idx;
+  _rank_intersects_t intersects;
 
-  MPI_Aint lb, extent;
-  void *loc_v_buf = NULL;
-  int *dist_v_flag = NULL, *loc_v_flag = NULL;
-  MPI_Status *status = NULL;
-  MPI_Request *request = NULL;
+  const int dim = this_locator->dim;
+  const int have_tags = this_locator->have_tags;
+  const ple_lnum_t idb = this_locator->point_id_base;
 
-  double comm_timing[4] = {0., 0., 0., 0.};
+  /* Update intersect for current point list */
 
-  /* Check extent of datatype */
+  intersects = _intersects_local(this_locator,
+                                 mesh,
+                                 tolerance_base,
+                                 tolerance_fraction,
+                                 n_points,
+                                 point_list,
+                                 point_coords,
+                                 location,
+                                 mesh_extents_f);
 
-  MPI_Type_get_extent(datatype, &lb, &extent);
-  MPI_Type_size(datatype, &size);
+  n_coords = 0;
 
-  if (extent != size)
-    ple_error(__FILE__, __LINE__, 0,
-              _("_exchange_point_var() is not implemented for use with\n"
-                "MPI datatypes associated with structures using padding\n"
-                "(for which size != extent)."));
+  this_locator->n_intersects = intersects.n;
 
-  /* Initialization */
+  /* Build partial buffer */
 
-  n_points_loc_tot
-    = this_locator->local_points_idx[this_locator->n_intersects];
+  if (intersects.n > 0) {
 
-  PLE_MALLOC(loc_v_flag, this_locator->n_intersects, int);
-  PLE_MALLOC(dist_v_flag, this_locator->n_intersects, int);
-  PLE_MALLOC(request, this_locator->n_intersects*2, MPI_Request);
-  PLE_MALLOC(status, this_locator->n_intersects*2, MPI_Status);
+    ple_lnum_t *_location = location;
+    float *_distance = distance;
 
-  PLE_MALLOC(loc_v_buf, n_points_loc_tot*size*stride, char);
+    ple_lnum_t *id;
+    int *tag;
+    ple_coord_t *coords;
 
-  const ple_lnum_t *il = this_locator->interior_list;
+    PLE_MALLOC(coords, n_points * dim, ple_coord_t);
+    PLE_MALLOC(id, n_points, ple_lnum_t);
 
-  /* First loop on distant ranks for argument checks */
-  /*-------------------------------------------------*/
+    if (have_tags)
+      PLE_MALLOC(tag, n_points, int);
+    else
+      tag = NULL;
 
-  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+    for (j = 0; j < n_points; j++) {
 
-  for (int i = 0; i < this_locator->n_intersects; i++) {
+      if (location[j] > -1) {
+        if (distance == NULL)
+          continue;
+        else if (distance[j] < 1)
+          continue;
+      }
 
-    dist_rank = this_locator->intersect_rank[i];
+      if (point_list != NULL)
+        coord_idx = point_list[j] - idb;
+      else
+        coord_idx = j;
 
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
+      if (_within_extents(dim,
+                          &(point_coords[dim*coord_idx]),
+                          intersects.extents) == true) {
 
-    if (distant_var != NULL && n_points_dist > 0)
-      dist_v_flag[i] = 1;
-    else
-      dist_v_flag[i] = 0;
+        for (k = 0; k < dim; k++)
+          coords[n_coords*dim + k]
+            = point_coords[dim*coord_idx + k];
 
-    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+        id[n_coords] = j;
 
-    MPI_Irecv(loc_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
-              this_locator->comm, &request[i*2]);
-    MPI_Isend(dist_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
-              this_locator->comm, &request[i*2+1]);
-  }
+        if (have_tags)
+          tag[n_coords] = point_tag[j];
 
-  MPI_Waitall(this_locator->n_intersects*2, request, status);
+        n_coords += 1;
+      }
 
-  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+    }
 
-  PLE_FREE(dist_v_flag);
+    PLE_REALLOC(coords, n_coords * dim, ple_coord_t);
+    PLE_REALLOC(id, n_coords, ple_lnum_t);
+    if (have_tags)
+      PLE_REALLOC(tag, n_coords, int);
 
-  for (int i = 0; i < this_locator->n_intersects; i++) {
+    if (n_coords < n_points) {
+      PLE_MALLOC(_location, n_coords, ple_lnum_t);
+      for (j = 0; j < n_coords; j++)
+        _location[j] = location[id[j]];
+    }
+    if (distance == NULL || n_coords < n_points) {
+      PLE_MALLOC(_distance, n_coords, float);
+      if (distance == NULL) {
+        for (j = 0; j < n_coords; j++)
+          _distance[j] = -1.0;
+      }
+      else {
+        for (j = 0; j < n_coords; j++)
+          _distance[j] = distance[id[j]];
+      }
+    }
 
-    dist_rank = this_locator->intersect_rank[i];
+    mesh_locate_f(mesh,
+                  tolerance_base,
+                  tolerance_fraction,
+                  n_coords,
+                  coords,
+                  tag,
+                  _location,
+                  _distance);
 
-    n_points_loc =   this_locator->local_points_idx[i+1]
-                   - this_locator->local_points_idx[i];
+    PLE_FREE(coords);
+
+    if (n_coords < n_points) {
+      for (j = 0; j < n_coords; j++) {
+        if (_location[j] > -1) {
+          k = id[j];
+          if (distance != NULL) {
+            if (distance[k] <= _distance[j])
+              continue;
+            else
+              distance[k] = _distance[j];
+          }
+          location[k] = _location[j];
+        }
+      }
+    }
+
+    if (_location != location)
+      PLE_FREE(_location);
+
+    if (_distance != distance)
+      PLE_FREE(_distance);
+
+    PLE_FREE(tag);
+    PLE_FREE(id);
 
-    if (loc_v_flag[i] == 1 && (local_var == NULL || n_points_loc == 0))
-      ple_error(__FILE__, __LINE__, 0,
-                _("Incoherent arguments to different instances in "
-                  "_exchange_point_var().\n"
-                  "Send and receive operations do not match "
-                  "(dist_rank = %d\n)\n"), dist_rank);
   }
 
-  /* Loop on distant ranks for exchange of data in standard mode */
-  /*-------------------------------------------------------------*/
+  PLE_FREE(intersects.extents);
 
-  if (reverse == false) {
+  /* Reorganize location information */
+  /*---------------------------------*/
 
-    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+  /* Now that location is done, the location[] array contains
+     either -1 if a point was not located, or a local index;
+     the distance[] array is not needed anymore now that all comparisons have
+     been done */
 
-    loc_v_ptr = loc_v_buf;
+  this_locator->n_interior = 0;
+  this_locator->n_exterior = 0;
+  for (j = 0; j < n_points; j++) {
+    if (location[j] > -1)
+      this_locator->n_interior += 1;
+    else
+      this_locator->n_exterior += 1;
+  }
 
-    for (int i = 0; i < this_locator->n_intersects; i++) {
+  PLE_MALLOC(this_locator->interior_list, this_locator->n_interior, ple_lnum_t);
+  PLE_MALLOC(this_locator->exterior_list, this_locator->n_exterior, ple_lnum_t);
 
-      dist_rank = this_locator->intersect_rank[i];
+  /* Organize total number of "local" and "distant" points */
 
-      n_points_loc =    this_locator->local_points_idx[i+1]
-                      - this_locator->local_points_idx[i];
+  PLE_REALLOC(this_locator->local_points_idx, 2, ple_lnum_t);
+  PLE_REALLOC(this_locator->distant_points_idx, 2, ple_lnum_t);
 
-      n_points_dist =   this_locator->distant_points_idx[i+1]
-                      - this_locator->distant_points_idx[i];
+  this_locator->local_points_idx[0] = 0;
+  this_locator->local_points_idx[1] = this_locator->n_interior;
 
-      dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
+  this_locator->distant_points_idx[0] = 0;
+  this_locator->distant_points_idx[1] = this_locator->n_interior;
 
-      if (distant_var != NULL)
-        dist_v_count = n_points_dist * stride;
-      else
-        dist_v_count = 0;
+  this_locator->local_point_ids = NULL; /* Not needed for single-process */
 
-      if (loc_v_flag[i] > 0)
-        loc_v_count = n_points_loc*stride;
-      else
-        loc_v_count = 0;
+  PLE_REALLOC(this_locator->distant_point_location,
+              this_locator->n_interior,
+              ple_lnum_t);
+  PLE_REALLOC(this_locator->distant_point_coords,
+              this_locator->n_interior * dim,
+              ple_coord_t);
 
-      /* Exchange information */
+  n_interior = 0;
+  n_exterior = 0;
 
-      if (distant_var != NULL)
-        dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
-      else
-        dist_v_ptr = NULL;
+  for (j = 0; j < n_points; j++) {
 
-      MPI_Irecv(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2]);
-      MPI_Isend(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2+1]);
+    if (point_list != NULL)
+      coord_idx = point_list[j] - idb;
+    else
+      coord_idx = j;
 
-      loc_v_ptr += loc_v_count*size;
+    if (location[j] > -1) {
+      this_locator->distant_point_location[n_interior] = location[j];
+      for (l = 0; l < dim; l++) {
+        this_locator->distant_point_coords[n_interior*dim + l]
+          = point_coords[coord_idx*dim + l];
+      }
+      this_locator->interior_list[n_interior] = j + idb;
+      n_interior += 1;
+    }
+    else {
+      this_locator->exterior_list[n_exterior] = j + idb;
+      n_exterior += 1;
     }
 
-    MPI_Waitall(this_locator->n_intersects*2, request, status);
-
-    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
   }
 
-  /* Loop on distant ranks for preparation or retrieval of buffer data */
-  /*-------------------------------------------------------------------*/
+}
 
-  loc_v_ptr = loc_v_buf;
+#if defined(PLE_HAVE_MPI)
 
-  for (int i = 0; i < this_locator->n_intersects; i++) {
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on distant points to processes owning
+ * the original points (i.e. distant processes).
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   datatype      <-- variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *   interior      <-- if true, local_var is restricted to located points
+ *----------------------------------------------------------------------------*/
 
-    const ple_lnum_t *_local_point_ids
-      = this_locator->local_point_ids + this_locator->local_points_idx[i];
+static void
+_exchange_point_var_distant(ple_locator_t     *this_locator,
+                            void              *distant_var,
+                            void              *local_var,
+                            const ple_lnum_t  *local_list,
+                            MPI_Datatype       datatype,
+                            size_t             stride,
+                            bool               reverse,
+                            bool               interior)
+{
+  int dist_v_count, loc_v_count, size;
+  int dist_rank;
+  int dist_v_flag, loc_v_flag;
+  ple_lnum_t n_points_loc, n_points_loc_max, n_points_dist;
+  size_t dist_v_idx;
+  void *dist_v_ptr;
+  void *loc_v_buf;
 
-    dist_rank = this_locator->intersect_rank[i];
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  MPI_Aint lb, extent;
+  MPI_Status status;
+
+  /* Check extent of datatype */
+
+  MPI_Type_get_extent(datatype, &lb, &extent);
+  MPI_Type_size(datatype, &size);
+
+  if (extent != size)
+    ple_error(__FILE__, __LINE__, 0,
+              _("_exchange_point_var() is not implemented for use with\n"
+                "MPI datatypes associated with structures using padding\n"
+                "(for which size != extent)."));
 
+  /* Initialization */
+
+  n_points_loc_max = 0;
+
+  for (int i = 0; i < this_locator->n_intersects; i++) {
     n_points_loc =    this_locator->local_points_idx[i+1]
-      - this_locator->local_points_idx[i];
+                    - this_locator->local_points_idx[i];
+    if (n_points_loc > n_points_loc_max)
+      n_points_loc_max = n_points_loc;
+  }
 
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
+  PLE_MALLOC(loc_v_buf, n_points_loc_max*size*stride, char);
 
-    dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
+  const ple_lnum_t *il = this_locator->interior_list;
 
-    if (distant_var != NULL)
-      dist_v_count = n_points_dist * stride;
-    else
-      dist_v_count = 0;
+  /* Loop on MPI ranks */
+  /*-------------------*/
 
-    if (loc_v_flag[i] > 0)
-      loc_v_count = n_points_loc*stride;
-    else
-      loc_v_count = 0;
+  for (int li = 0; li < this_locator->n_intersects; li++) {
 
-    /* Exchange information */
+    int i = (this_locator->comm_order != NULL) ?
+      this_locator->comm_order[li] : li;
 
-    if (distant_var != NULL)
-      dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
-    else
-      dist_v_ptr = NULL;
+    const ple_lnum_t *_local_point_ids
+      = this_locator->local_point_ids + this_locator->local_points_idx[i];
 
     dist_rank = this_locator->intersect_rank[i];
 
@@ -2563,47 +2661,92 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
     n_points_dist =   this_locator->distant_points_idx[i+1]
                     - this_locator->distant_points_idx[i];
 
-    if (reverse == false) {
+    if (distant_var != NULL && n_points_dist > 0)
+      dist_v_flag = 1;
+    else
+      dist_v_flag = 0;
 
-      if (loc_v_flag[i] > 0) {
-        if (local_list == NULL) {
-          const size_t nbytes = stride*size;
-          if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              char *local_v_p = (char *)local_var + _local_point_ids[k]*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Sendrecv(&dist_v_flag, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+                 &loc_v_flag, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    if (loc_v_flag == 1 && (local_var == NULL || n_points_loc == 0))
+      ple_error(__FILE__, __LINE__, 0,
+                _("Incoherent arguments to different instances in "
+                  "_exchange_point_var().\n"
+                  "Send and receive operations do not match "
+                  "(dist_rank = %d\n)\n"), dist_rank);
+
+    dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
+    dist_v_count = n_points_dist * stride * dist_v_flag;
+
+    if (loc_v_flag > 0)
+      loc_v_count = n_points_loc*stride;
+    else
+      loc_v_count = 0;
+
+    /* Exchange information */
+
+    if (distant_var != NULL)
+      dist_v_ptr = (void *)(((char *)distant_var) + dist_v_idx);
+    else
+      dist_v_ptr = NULL;
+
+    if (reverse == false) {
+
+      _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+      MPI_Sendrecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                   loc_v_buf, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                   this_locator->comm, &status);
+
+      _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+      if (loc_v_flag > 0) {
+        if (local_list == NULL) {
+          const size_t nbytes = stride*size;
+          if (this_locator->n_exterior == 0 || interior) {
+            for (int k = 0; k < n_points_loc; k++) {
+              char *local_v_p = (char *)local_var + _local_point_ids[k]*nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
                 local_v_p[l] = loc_v_buf_p[l];
             }
           }
           else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+            for (int k = 0; k < n_points_loc; k++) {
               char *local_v_p =   (char *)local_var
                                 + il[_local_point_ids[k]]*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
               for (size_t l = 0; l < nbytes; l++)
                 local_v_p[l] = loc_v_buf_p[l];
             }
           }
         }
         else {
-          const size_t nbytes = stride*size;
-          const ple_lnum_t idb = this_locator->point_id_base;
           if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+            const size_t nbytes = stride*size;
+            const ple_lnum_t idb = this_locator->point_id_base;
+            for (int k = 0; k < n_points_loc; k++) {
               char *local_v_p =   (char *)local_var
                                 + (local_list[_local_point_ids[k]] - idb)*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
               for (size_t l = 0; l < nbytes; l++)
                 local_v_p[l] = loc_v_buf_p[l];
             }
           }
           else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+            const size_t nbytes = stride*size;
+            const ple_lnum_t idb = this_locator->point_id_base;
+            for (int k = 0; k < n_points_loc; k++) {
               char *local_v_p =   (char *)local_var
                                 +  (local_list[il[_local_point_ids[k]]] - idb)
                                   *nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_buf + k*nbytes;
               for (size_t l = 0; l < nbytes; l++)
                 local_v_p[l] = loc_v_buf_p[l];
             }
@@ -2614,23 +2757,24 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
     }
     else { /* if (reverse == true) */
 
-      if (loc_v_flag[i] > 0) {
+      if (loc_v_flag > 0) {
         if (local_list == NULL) {
-          const size_t nbytes = stride*size;
           if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+            const size_t nbytes = stride*size;
+            for (int k = 0; k < n_points_loc; k++) {
               const char *local_v_p
                 = (const char *)local_var + _local_point_ids[k]*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
               for (size_t l = 0; l < nbytes; l++)
                 loc_v_buf_p[l] = local_v_p[l];
             }
           }
           else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+            const size_t nbytes = stride*size;
+            for (int k = 0; k < n_points_loc; k++) {
               const char *local_v_p
                 = (const char *)local_var + il[_local_point_ids[k]]*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
               for (size_t l = 0; l < nbytes; l++)
                 loc_v_buf_p[l] = local_v_p[l];
             }
@@ -2640,21 +2784,21 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
           const size_t nbytes = stride*size;
           const ple_lnum_t idb = this_locator->point_id_base;
           if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+            for (int k = 0; k < n_points_loc; k++) {
               const char *local_v_p
                 = (const char *)local_var
                   + (local_list[_local_point_ids[k]] - idb)*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
               for (size_t l = 0; l < nbytes; l++)
                 loc_v_buf_p[l] = local_v_p[l];
             }
           }
           else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+            for (int k = 0; k < n_points_loc; k++) {
               const char *local_v_p
                 = (const char *)local_var
                   + (local_list[il[_local_point_ids[k]]] - idb)*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
               for (size_t l = 0; l < nbytes; l++)
                 loc_v_buf_p[l] = local_v_p[l];
             }
@@ -2662,16 +2806,145 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
         }
       }
 
+      _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+      MPI_Sendrecv(loc_v_buf, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                   dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                   this_locator->comm, &status);
+
+      _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
     }
 
-    loc_v_ptr += loc_v_count*size;
+  } /* End of loop on MPI ranks */
+
+  PLE_FREE(loc_v_buf);
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on distant points to processes owning
+ * the original points (i.e. distant processes).
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * This variant of the function uses asynchronous MPI calls.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   datatype      <-- variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *   interior      <-- if true, local_var is restricted to located points
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
+                                 void              *distant_var,
+                                 void              *local_var,
+                                 const ple_lnum_t  *local_list,
+                                 MPI_Datatype       datatype,
+                                 size_t             stride,
+                                 bool               reverse,
+                                 bool               interior)
+{
+  int dist_v_count, loc_v_count, size;
+  int dist_rank;
+  ple_lnum_t n_points_loc, n_points_loc_tot, n_points_dist;
+  size_t dist_v_idx;
+  unsigned char *dist_v_ptr, *loc_v_ptr;
+
+  MPI_Aint lb, extent;
+  void *loc_v_buf = NULL;
+  int *dist_v_flag = NULL, *loc_v_flag = NULL;
+  MPI_Status *status = NULL;
+  MPI_Request *request = NULL;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  /* Check extent of datatype */
+
+  MPI_Type_get_extent(datatype, &lb, &extent);
+  MPI_Type_size(datatype, &size);
+
+  if (extent != size)
+    ple_error(__FILE__, __LINE__, 0,
+              _("_exchange_point_var() is not implemented for use with\n"
+                "MPI datatypes associated with structures using padding\n"
+                "(for which size != extent)."));
+
+  /* Initialization */
+
+  n_points_loc_tot
+    = this_locator->local_points_idx[this_locator->n_intersects];
+
+  PLE_MALLOC(loc_v_flag, this_locator->n_intersects, int);
+  PLE_MALLOC(dist_v_flag, this_locator->n_intersects, int);
+  PLE_MALLOC(request, this_locator->n_intersects*2, MPI_Request);
+  PLE_MALLOC(status, this_locator->n_intersects*2, MPI_Status);
+
+  PLE_MALLOC(loc_v_buf, n_points_loc_tot*size*stride, char);
+
+  const ple_lnum_t *il = this_locator->interior_list;
+
+  /* First loop on distant ranks for argument checks */
+  /*-------------------------------------------------*/
+
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+  for (int i = 0; i < this_locator->n_intersects; i++) {
+
+    dist_rank = this_locator->intersect_rank[i];
+
+    n_points_dist =   this_locator->distant_points_idx[i+1]
+                    - this_locator->distant_points_idx[i];
+
+    if (distant_var != NULL && n_points_dist > 0)
+      dist_v_flag[i] = 1;
+    else
+      dist_v_flag[i] = 0;
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
 
+    MPI_Irecv(loc_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &request[i*2]);
+    MPI_Isend(dist_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &request[i*2+1]);
   }
 
-  /* Loop on distant ranks for exchange of data in reverse mode */
-  /*------------------------------------------------------------*/
+  MPI_Waitall(this_locator->n_intersects*2, request, status);
 
-  if (reverse == true) {
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+  PLE_FREE(dist_v_flag);
+
+  for (int i = 0; i < this_locator->n_intersects; i++) {
+
+    dist_rank = this_locator->intersect_rank[i];
+
+    n_points_loc =   this_locator->local_points_idx[i+1]
+                   - this_locator->local_points_idx[i];
+
+    if (loc_v_flag[i] == 1 && (local_var == NULL || n_points_loc == 0))
+      ple_error(__FILE__, __LINE__, 0,
+                _("Incoherent arguments to different instances in "
+                  "_exchange_point_var().\n"
+                  "Send and receive operations do not match "
+                  "(dist_rank = %d\n)\n"), dist_rank);
+  }
+
+  /* Loop on distant ranks for exchange of data in standard mode */
+  /*-------------------------------------------------------------*/
+
+  if (reverse == false) {
 
     _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
 
@@ -2699,400 +2972,1140 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
       else
         loc_v_count = 0;
 
-      /* Exchange information */
+      /* Exchange information */
+
+      if (distant_var != NULL)
+        dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
+      else
+        dist_v_ptr = NULL;
+
+      MPI_Irecv(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &request[i*2]);
+      MPI_Isend(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &request[i*2+1]);
+
+      loc_v_ptr += loc_v_count*size;
+    }
+
+    MPI_Waitall(this_locator->n_intersects*2, request, status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+  }
+
+  /* Loop on distant ranks for preparation or retrieval of buffer data */
+  /*-------------------------------------------------------------------*/
+
+  loc_v_ptr = loc_v_buf;
+
+  for (int i = 0; i < this_locator->n_intersects; i++) {
+
+    const ple_lnum_t *_local_point_ids
+      = this_locator->local_point_ids + this_locator->local_points_idx[i];
+
+    dist_rank = this_locator->intersect_rank[i];
+
+    n_points_loc =    this_locator->local_points_idx[i+1]
+      - this_locator->local_points_idx[i];
+
+    n_points_dist =   this_locator->distant_points_idx[i+1]
+                    - this_locator->distant_points_idx[i];
+
+    dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
+
+    if (distant_var != NULL)
+      dist_v_count = n_points_dist * stride;
+    else
+      dist_v_count = 0;
+
+    if (loc_v_flag[i] > 0)
+      loc_v_count = n_points_loc*stride;
+    else
+      loc_v_count = 0;
+
+    /* Exchange information */
+
+    if (distant_var != NULL)
+      dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
+    else
+      dist_v_ptr = NULL;
+
+    dist_rank = this_locator->intersect_rank[i];
+
+    n_points_loc =    this_locator->local_points_idx[i+1]
+                    - this_locator->local_points_idx[i];
+
+    n_points_dist =   this_locator->distant_points_idx[i+1]
+                    - this_locator->distant_points_idx[i];
+
+    if (reverse == false) {
+
+      if (loc_v_flag[i] > 0) {
+        if (local_list == NULL) {
+          const size_t nbytes = stride*size;
+          if (this_locator->n_exterior == 0 || interior) {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              char *local_v_p = (char *)local_var + _local_point_ids[k]*nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                local_v_p[l] = loc_v_buf_p[l];
+            }
+          }
+          else {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              char *local_v_p =   (char *)local_var
+                                + il[_local_point_ids[k]]*nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                local_v_p[l] = loc_v_buf_p[l];
+            }
+          }
+        }
+        else {
+          const size_t nbytes = stride*size;
+          const ple_lnum_t idb = this_locator->point_id_base;
+          if (this_locator->n_exterior == 0 || interior) {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              char *local_v_p =   (char *)local_var
+                                + (local_list[_local_point_ids[k]] - idb)*nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                local_v_p[l] = loc_v_buf_p[l];
+            }
+          }
+          else {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              char *local_v_p =   (char *)local_var
+                                +  (local_list[il[_local_point_ids[k]]] - idb)
+                                  *nbytes;
+              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                local_v_p[l] = loc_v_buf_p[l];
+            }
+          }
+        }
+      }
+
+    }
+    else { /* if (reverse == true) */
+
+      if (loc_v_flag[i] > 0) {
+        if (local_list == NULL) {
+          const size_t nbytes = stride*size;
+          if (this_locator->n_exterior == 0 || interior) {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              const char *local_v_p
+                = (const char *)local_var + _local_point_ids[k]*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                loc_v_buf_p[l] = local_v_p[l];
+            }
+          }
+          else {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              const char *local_v_p
+                = (const char *)local_var + il[_local_point_ids[k]]*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                loc_v_buf_p[l] = local_v_p[l];
+            }
+          }
+        }
+        else {
+          const size_t nbytes = stride*size;
+          const ple_lnum_t idb = this_locator->point_id_base;
+          if (this_locator->n_exterior == 0 || interior) {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              const char *local_v_p
+                = (const char *)local_var
+                  + (local_list[_local_point_ids[k]] - idb)*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                loc_v_buf_p[l] = local_v_p[l];
+            }
+          }
+          else {
+            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+              const char *local_v_p
+                = (const char *)local_var
+                  + (local_list[il[_local_point_ids[k]]] - idb)*nbytes;
+              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+              for (size_t l = 0; l < nbytes; l++)
+                loc_v_buf_p[l] = local_v_p[l];
+            }
+          }
+        }
+      }
+
+    }
+
+    loc_v_ptr += loc_v_count*size;
+
+  }
+
+  /* Loop on distant ranks for exchange of data in reverse mode */
+  /*------------------------------------------------------------*/
+
+  if (reverse == true) {
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    loc_v_ptr = loc_v_buf;
+
+    for (int i = 0; i < this_locator->n_intersects; i++) {
+
+      dist_rank = this_locator->intersect_rank[i];
+
+      n_points_loc =    this_locator->local_points_idx[i+1]
+                      - this_locator->local_points_idx[i];
+
+      n_points_dist =   this_locator->distant_points_idx[i+1]
+                      - this_locator->distant_points_idx[i];
+
+      dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
+
+      if (distant_var != NULL)
+        dist_v_count = n_points_dist * stride;
+      else
+        dist_v_count = 0;
+
+      if (loc_v_flag[i] > 0)
+        loc_v_count = n_points_loc*stride;
+      else
+        loc_v_count = 0;
+
+      /* Exchange information */
+
+      if (distant_var != NULL)
+        dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
+      else
+        dist_v_ptr = NULL;
+
+      MPI_Irecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &request[i*2]);
+      MPI_Isend(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &request[i*2+1]);
+
+      loc_v_ptr += loc_v_count*size;
+    }
+
+    MPI_Waitall(this_locator->n_intersects*2, request, status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+  }
+
+  /* Free temporary arrays */
+
+  PLE_FREE(loc_v_buf);
+
+  PLE_FREE(loc_v_flag);
+  PLE_FREE(request);
+  PLE_FREE(status);
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Copy values between a buffer and a variable defined on located local
+ * points, for the points associated with a given distant rank.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   i             <-- intersecting rank id
+ *   local_var     <-> variable defined on located local points
+ *   local_list    <-- optional indirection list for local_var
+ *   nbytes        <-- size of values for one point
+ *   buf           <-> buffer for points located on rank i
+ *   to_local      <-- if true, copy from buffer to local_var,
+ *                     otherwise copy from local_var to buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_local_point_var_copy(const ple_locator_t  *this_locator,
+                      int                   i,
+                      void                 *local_var,
+                      const ple_lnum_t     *local_list,
+                      size_t                nbytes,
+                      unsigned char        *buf,
+                      bool                  to_local)
+{
+  const ple_lnum_t idb = this_locator->point_id_base;
+  const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                  - this_locator->local_points_idx[i];
+  const ple_lnum_t *_local_point_ids
+    = this_locator->local_point_ids + this_locator->local_points_idx[i];
+
+  for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+    ple_lnum_t p_id = _local_point_ids[k];
+    if (local_list != NULL)
+      p_id = local_list[p_id] - idb;
+    unsigned char *local_v_p = (unsigned char *)local_var + p_id*nbytes;
+    unsigned char *buf_p = buf + k*nbytes;
+    if (to_local)
+      memcpy(local_v_p, buf_p, nbytes);
+    else
+      memcpy(buf_p, local_v_p, nbytes);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Start a non-blocking exchange of a variable defined on distant points,
+ * in parallel mode.
+ *
+ * Messages (a flag, then values) are the same as for the blocking
+ * exchange algorithms, so this is compatible with distant ranks using
+ * either of them.
+ *
+ * parameters:
+ *   ex            <-> pointer to pending exchange structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   datatype      <-- MPI datatype of variable
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_distant_start(ple_locator_exchange_t  *ex,
+                                  void                    *distant_var,
+                                  MPI_Datatype             datatype,
+                                  size_t                   stride)
+{
+  ple_locator_t *this_locator = ex->locator;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  const int n_intersects = this_locator->n_intersects;
+  const size_t nbytes = ex->nbytes;
+
+  PLE_MALLOC(ex->dist_v_flag, n_intersects, int);
+  PLE_MALLOC(ex->loc_v_flag, n_intersects, int);
+  PLE_MALLOC(ex->request, n_intersects*4, MPI_Request);
+  PLE_MALLOC(ex->loc_v_buf,
+             this_locator->local_points_idx[n_intersects]*nbytes,
+             unsigned char);
+
+  ex->n_requests = n_intersects*4;
+
+  for (int i = 0; i < n_intersects*4; i++)
+    ex->request[i] = MPI_REQUEST_NULL;
+
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+  /* Exchange flags indicating whether values are sent from distant points */
+
+  for (int i = 0; i < n_intersects; i++) {
+
+    const int dist_rank = this_locator->intersect_rank[i];
+    const ple_lnum_t n_points_dist =   this_locator->distant_points_idx[i+1]
+                                     - this_locator->distant_points_idx[i];
+
+    ex->dist_v_flag[i] = (distant_var != NULL && n_points_dist > 0) ? 1 : 0;
+
+    MPI_Irecv(ex->loc_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &(ex->request[i*2]));
+    MPI_Isend(ex->dist_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &(ex->request[i*2+1]));
+
+  }
+
+  /* In reverse mode, send counts depend on the distant flags, and
+     values at local points must be packed before sending */
+
+  if (ex->reverse) {
+
+    MPI_Waitall(n_intersects*2, ex->request, MPI_STATUSES_IGNORE);
+
+    for (int i = 0; i < n_intersects; i++) {
+      const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                      - this_locator->local_points_idx[i];
+      if (   ex->loc_v_flag[i] == 1
+          && (ex->local_var == NULL || n_points_loc == 0))
+        ple_error(__FILE__, __LINE__, 0,
+                  _("Incoherent arguments to different instances in "
+                    "ple_locator_exchange_point_var_start().\n"
+                    "Send and receive operations do not match "
+                    "(dist_rank = %d\n)\n"), this_locator->intersect_rank[i]);
+      if (ex->loc_v_flag[i] == 1)
+        _local_point_var_copy(this_locator,
+                              i,
+                              ex->local_var,
+                              ex->local_list,
+                              nbytes,
+                              (  ex->loc_v_buf
+                               + this_locator->local_points_idx[i]*nbytes),
+                              false);
+    }
+
+  }
+
+  /* Post exchange of values */
+
+  for (int i = 0; i < n_intersects; i++) {
+
+    const int dist_rank = this_locator->intersect_rank[i];
+
+    const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                    - this_locator->local_points_idx[i];
+    const ple_lnum_t n_points_dist =   this_locator->distant_points_idx[i+1]
+                                     - this_locator->distant_points_idx[i];
+
+    unsigned char *loc_v_ptr
+      = ex->loc_v_buf + this_locator->local_points_idx[i]*nbytes;
+    unsigned char *dist_v_ptr = NULL;
+    int dist_v_count = 0;
+
+    if (distant_var != NULL) {
+      dist_v_ptr =   (unsigned char *)distant_var
+                   + this_locator->distant_points_idx[i]*nbytes;
+      dist_v_count = n_points_dist*stride;
+    }
+
+    if (ex->reverse) {
+      int loc_v_count = (ex->loc_v_flag[i] > 0) ? n_points_loc*stride : 0;
+      MPI_Irecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &(ex->request[n_intersects*2 + i*2]));
+      MPI_Isend(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &(ex->request[n_intersects*2 + i*2 + 1]));
+    }
+    else {
+      /* Distant flag not known yet: allow receiving all values */
+      MPI_Irecv(loc_v_ptr, n_points_loc*stride, datatype, dist_rank,
+                PLE_MPI_TAG, this_locator->comm,
+                &(ex->request[n_intersects*2 + i*2]));
+      MPI_Isend(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &(ex->request[n_intersects*2 + i*2 + 1]));
+    }
+
+  }
+
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Complete a non-blocking exchange of a variable defined on distant points,
+ * in parallel mode.
+ *
+ * parameters:
+ *   ex  <-> pointer to pending exchange structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_distant_wait(ple_locator_exchange_t  *ex)
+{
+  ple_locator_t *this_locator = ex->locator;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  const int n_intersects = this_locator->n_intersects;
+
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+  MPI_Waitall(ex->n_requests, ex->request, MPI_STATUSES_IGNORE);
+
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+  /* Unpack values received at local points */
+
+  if (ex->reverse == 0) {
+
+    for (int i = 0; i < n_intersects; i++) {
+      const ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                      - this_locator->local_points_idx[i];
+      if (   ex->loc_v_flag[i] == 1
+          && (ex->local_var == NULL || n_points_loc == 0))
+        ple_error(__FILE__, __LINE__, 0,
+                  _("Incoherent arguments to different instances in "
+                    "ple_locator_exchange_point_var_start().\n"
+                    "Send and receive operations do not match "
+                    "(dist_rank = %d\n)\n"), this_locator->intersect_rank[i]);
+      if (ex->loc_v_flag[i] == 1)
+        _local_point_var_copy(this_locator,
+                              i,
+                              ex->local_var,
+                              ex->local_list,
+                              ex->nbytes,
+                              (  ex->loc_v_buf
+                               + this_locator->local_points_idx[i]*ex->nbytes),
+                              true);
+    }
+
+  }
+
+  PLE_FREE(ex->loc_v_buf);
+  PLE_FREE(ex->request);
+  PLE_FREE(ex->loc_v_flag);
+  PLE_FREE(ex->dist_v_flag);
+  ex->n_requests = 0;
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on "distant points" to the original ("local")
+ * points.
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_local(ple_locator_t     *this_locator,
+                          void              *distant_var,
+                          void              *local_var,
+                          const ple_lnum_t  *local_list,
+                          size_t             type_size,
+                          size_t             stride,
+                          bool               reverse)
+{
+  ple_lnum_t i;
+  size_t j;
+  ple_lnum_t n_points_loc;
+
+  const size_t nbytes = stride*type_size;
+
+  /* Initialization */
+
+  if (this_locator->n_interior == 0)
+    return;
+
+  n_points_loc =   this_locator->local_points_idx[1]
+                 - this_locator->local_points_idx[0];
+
+  assert(n_points_loc == (  this_locator->distant_points_idx[1]
+                          - this_locator->distant_points_idx[0]));
+
+  /* Exchange information */
+
+  if (reverse == false) {
+
+    if (local_list == NULL)
+      memcpy(local_var, distant_var, n_points_loc*nbytes);
+
+    else {
+      const ple_lnum_t idb = this_locator->point_id_base;
+      for (i = 0; i < n_points_loc; i++) {
+        char *local_var_p = (char *)local_var + (local_list[i] - idb)*nbytes;
+        const char *distant_var_p = (const char *)distant_var + i*nbytes;
+        for (j = 0; j < nbytes; j++)
+          local_var_p[j] = distant_var_p[j];
+      }
+    }
+
+  }
+  else { /* if (reverse == true) */
+
+    if (local_list == NULL)
+      memcpy(distant_var, local_var, n_points_loc*nbytes);
+
+    else {
+      const ple_lnum_t idb = this_locator->point_id_base;
+      for (i = 0; i < n_points_loc; i++) {
+        const char *local_var_p
+          = (const char *)local_var + (local_list[i] - idb)*nbytes;
+        char *distant_var_p = (char *)distant_var + i*nbytes;
+        for (j = 0; j < nbytes; j++)
+          distant_var_p[j] = local_var_p[j];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on "distant points" to the original ("local")
+ * points.
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_local_incomplete(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     bool               reverse)
+{
+  const size_t nbytes = stride*type_size;
+
+  const ple_lnum_t *il = this_locator->interior_list;
+
+  /* Initialization */
+
+  if (this_locator->n_interior == 0)
+    return;
+
+  ple_lnum_t n_points_loc =   this_locator->local_points_idx[1]
+                            - this_locator->local_points_idx[0];
+
+  assert(n_points_loc == (  this_locator->distant_points_idx[1]
+                          - this_locator->distant_points_idx[0]));
+
+  /* Exchange information */
+
+  if (reverse == false) {
+
+    if (local_list == NULL) {
+      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
+        char *local_var_p = (char *)local_var + il[i]*nbytes;
+        const char *distant_var_p = (const char *)distant_var + i*nbytes;
+        for (size_t j = 0; j < nbytes; j++)
+          local_var_p[j] = distant_var_p[j];
+      }
+    }
+    else {
+      const ple_lnum_t idb = this_locator->point_id_base;
+      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
+        char *local_var_p = (char *)local_var + (local_list[il[i]] - idb)*nbytes;
+        const char *distant_var_p = (const char *)distant_var + i*nbytes;
+        for (size_t j = 0; j < nbytes; j++)
+          local_var_p[j] = distant_var_p[j];
+      }
+    }
+
+  }
+  else { /* if (reverse == true) */
+
+    if (local_list == NULL)
+      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
+        const char *local_var_p = (const char *)local_var + il[i]*nbytes;
+        char *distant_var_p = (char *)distant_var + i*nbytes;
+        for (size_t j = 0; j < nbytes; j++)
+          distant_var_p[j] = local_var_p[j];
+      }
+
+    else {
+      const ple_lnum_t idb = this_locator->point_id_base;
+      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
+        const char *local_var_p
+          = (const char *)local_var + (local_list[il[i]] - idb)*nbytes;
+        char *distant_var_p = (char *)distant_var + i*nbytes;
+        for (size_t j = 0; j < nbytes; j++)
+          distant_var_p[j] = local_var_p[j];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute variable defined on distant points to processes owning
+ * the original points (i.e. distant processes).
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * The caller should have defined the values of distant_var[] for the
+ * distant points, whose coordinates are given by
+ * ple_locator_get_dist_coords(), and which are located in the elements
+ * whose numbers are given by ple_locator_get_dist_locations().
+ *
+ * The local_var[] is defined at local points, restricted to located points
+ * (those whose numbers are returned by ple_locator_get_interior_list())
+ * if interior is set to 1.
+ *
+ * If the optional local_list indirection is used, it is assumed to use
+ * the same base numbering as that defined by the options for the previous
+ * call to ple_locator_set_mesh() or ple_locator_extend_search().
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in, out] distant_var  variable defined on distant points
+ *                              (ready to send); size: n_dist_points*stride
+ * \param[in, out] local_var    variable defined on local points
+ *                              (received); size: n_interior*stride
+ * \param[in]      local_list   optional indirection list for local_var
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ * \param[in]      interior     if true, local_var is restricted
+ *                              to located points.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var(ple_locator_t     *this_locator,
+                    void              *distant_var,
+                    void              *local_var,
+                    const ple_lnum_t  *local_list,
+                    size_t             type_size,
+                    size_t             stride,
+                    int                reverse,
+                    bool               interior)
+{
+  double w_start, w_end, cpu_start, cpu_end;
+
+  int mpi_flag = 0;
+  bool _reverse = reverse;
+
+  /* Initialize timing */
+
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
+
+#if defined(PLE_HAVE_MPI)
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+
+    if (type_size == sizeof(double))
+      datatype = MPI_DOUBLE;
+    else if (type_size == sizeof(float))
+      datatype = MPI_FLOAT;
+    else
+      ple_error(__FILE__, __LINE__, 0,
+                _("type_size passed to ple_locator_exchange_point_var() does\n"
+                  "not correspond to double or float."));
+
+    assert (datatype != MPI_DATATYPE_NULL);
+
+    if (this_locator->exchange_algorithm == _EXCHANGE_SENDRECV)
+      _exchange_point_var_distant(this_locator,
+                                  distant_var,
+                                  local_var,
+                                  local_list,
+                                  datatype,
+                                  stride,
+                                  _reverse,
+                                  interior);
+
+    else if (this_locator->exchange_algorithm == _EXCHANGE_ISEND_IRECV)
+      _exchange_point_var_distant_asyn(this_locator,
+                                       distant_var,
+                                       local_var,
+                                       local_list,
+                                       datatype,
+                                       stride,
+                                       _reverse,
+                                       interior);
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  if (!mpi_flag) {
+    if (this_locator->n_exterior == 0 || interior)
+      _exchange_point_var_local(this_locator,
+                                distant_var,
+                                local_var,
+                                local_list,
+                                type_size,
+                                stride,
+                                _reverse);
+    else
+      _exchange_point_var_local_incomplete(this_locator,
+                                           distant_var,
+                                           local_var,
+                                           local_list,
+                                           type_size,
+                                           stride,
+                                           _reverse);
+  }
+
+  /* Finalize timing */
+
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
+
+  this_locator->exchange_wtime[0] += (w_end - w_start);
+  this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
+}
+
+/*----------------------------------------------------------------------------
+ * Return timing information.
+ *
+ * When location on closest elements to force location of all points is
+ * active, location times include a total value, followed by the value
+ * associated with the location of closest elements stage.
+ *
+ * parameters:
+ *   this_locator      <-- pointer to locator structure
+ *   time_type         <-- 0 for total times, 1 for communication times
+ *   location_wtime    --> Location Wall-clock time (or NULL)
+ *   location_cpu_time --> Location CPU time (or NULL)
+ *   exchange_wtime    --> Variable exchange Wall-clock time (or NULL)
+ *   exchange_cpu_time --> Variable exchange CPU time (or NULL)
+ *----------------------------------------------------------------------------*/
+
+static void
+_get_times(const ple_locator_t  *this_locator,
+           int                   time_type,
+           double               *location_wtime,
+           double               *location_cpu_time,
+           double               *exchange_wtime,
+           double               *exchange_cpu_time)
+{
+  const ple_locator_t  *_locator = this_locator;
+
+  if (this_locator != NULL) {
+
+    if (location_wtime != NULL) {
+      *location_wtime = _locator->location_wtime[time_type];
+    }
+    if (location_cpu_time != NULL) {
+      *location_cpu_time = _locator->location_cpu_time[time_type];
+    }
+    if (exchange_wtime != NULL)
+      *exchange_wtime = _locator->exchange_wtime[time_type];
+    if (exchange_cpu_time != NULL)
+      *exchange_cpu_time = _locator->exchange_cpu_time[time_type];
+
+  }
+  else {
+
+    if (location_wtime != NULL) {
+      location_wtime[0] = 0.;
+      location_wtime[1] = 0.;
+    }
+    if (location_cpu_time != NULL) {
+      location_cpu_time[0] = 0.;
+      location_cpu_time[1] = 0.;
+    }
+    if (exchange_wtime != NULL)
+      *exchange_wtime = 0.;
+    if (exchange_cpu_time != NULL)
+      *exchange_cpu_time = 0.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Extend search for a locator, possibly relocating previously located
+ * points first.
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   options            <-- options array (size PLE_LOCATOR_N_OPTIONS),
+ *                          or NULL
+ *   tolerance_base     <-- associated fixed tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding
+ *                          boxes added to tolerance
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   distance           <-> optional distance from point to matching
+ *                          element (size: n_points; required if relocate
+ *                          is nonzero)
+ *   mesh_extents_f     <-- function computing mesh or mesh subset extents
+ *   mesh_locate_f      <-- function locating points in or on elements
+ *   relocate           <-- if nonzero, relocate previously located points
+ *                          on their previous owner rank instead of keeping
+ *                          their previous location
+ *----------------------------------------------------------------------------*/
+
+static void
+_extend_search(ple_locator_t               *this_locator,
+               const void                  *mesh,
+               const int                   *options,
+               float                        tolerance_base,
+               float                        tolerance_fraction,
+               ple_lnum_t                   n_points,
+               const ple_lnum_t             point_list[],
+               const int                    point_tag[],
+               const ple_coord_t            point_coords[],
+               float                        distance[],
+               ple_mesh_extents_t          *mesh_extents_f,
+               ple_mesh_elements_locate_t  *mesh_locate_f,
+               int                          relocate)
+{
+  int i;
+  double w_start, w_end, cpu_start, cpu_end;
+  ple_lnum_t  *location;
 
-      if (distant_var != NULL)
-        dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
-      else
-        dist_v_ptr = NULL;
+  double comm_timing[4] = {0., 0., 0., 0.};
+  int mpi_flag = 0;
 
-      MPI_Irecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2]);
-      MPI_Isend(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
-                this_locator->comm, &request[i*2+1]);
+  /* Initialize timing */
 
-      loc_v_ptr += loc_v_count*size;
-    }
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
 
-    MPI_Waitall(this_locator->n_intersects*2, request, status);
+  if (options != NULL)
+    this_locator->point_id_base = options[PLE_LOCATOR_NUMBERING];
+  else
+    this_locator->point_id_base = 0;
 
-    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+  const int idb = this_locator->point_id_base;
 
-  }
+  this_locator->have_tags = 0;
 
-  /* Free temporary arrays */
+  /* Prepare locator (MPI version) */
+  /*-------------------------------*/
 
-  PLE_FREE(loc_v_buf);
+#if defined(PLE_HAVE_MPI)
 
-  PLE_FREE(loc_v_flag);
-  PLE_FREE(request);
-  PLE_FREE(status);
+  const int dim = this_locator->dim;
 
-  this_locator->exchange_wtime[1] += comm_timing[0];
-  this_locator->exchange_cpu_time[1] += comm_timing[1];
-}
+  MPI_Initialized(&mpi_flag);
 
-#endif /* defined(PLE_HAVE_MPI) */
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
 
-/*----------------------------------------------------------------------------
- * Distribute variable defined on "distant points" to the original ("local")
- * points.
- *
- * The exchange is symmetric if both variables are defined, receive
- * only if distant_var is NULL, or send only if local_var is NULL.
- *
- * parameters:
- *   this_locator  <-- pointer to locator structure
- *   distant_var   <-> variable defined on distant points (ready to send)
- *   local_var     <-> variable defined on local points (received)
- *   local_list    <-- optional indirection list for local_var
- *   type_size     <-- sizeof (float or double) variable type
- *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
- *   reverse       <-- if true, exchange is reversed
- *                     (receive values associated with distant points
- *                     from the processes owning the original points)
- *----------------------------------------------------------------------------*/
+  if (mpi_flag) {
 
-static void
-_exchange_point_var_local(ple_locator_t     *this_locator,
-                          void              *distant_var,
-                          void              *local_var,
-                          const ple_lnum_t  *local_list,
-                          size_t             type_size,
-                          size_t             stride,
-                          bool               reverse)
-{
-  ple_lnum_t i;
-  size_t j;
-  ple_lnum_t n_points_loc;
+    /* Flag values
+       0: mesh dimension
+       1: space dimension
+       2: minimum algorithm version
+       3: maximum algorithm version
+       4: preferred algorithm version
+       5: have point tags */
 
-  const size_t nbytes = stride*type_size;
+    int globflag[6];
+    int locflag[6] = {-1,
+                      -1,
+                      1, /* equivalent to _LOCATE_BB_SENDRECV */
+                      -_LOCATE_BB_SENDRECV_ORDERED,
+                      this_locator->locate_algorithm,
+                      0};
+    ple_lnum_t  *location_rank_id;
 
-  /* Initialization */
+    /* Check that at least one of the local or distant nodal meshes
+       is non-NULL, and at least one of the local or distant
+       point sets is non null */
 
-  if (this_locator->n_interior == 0)
-    return;
+    if (mesh != NULL)
+      locflag[0] = dim;
 
-  n_points_loc =   this_locator->local_points_idx[1]
-                 - this_locator->local_points_idx[0];
+    if (n_points > 0)
+      locflag[1] = dim;
 
-  assert(n_points_loc == (  this_locator->distant_points_idx[1]
-                          - this_locator->distant_points_idx[0]));
+    if (n_points > 0 && point_tag != NULL)
+      locflag[5] = 1;
 
-  /* Exchange information */
+    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
 
-  if (reverse == false) {
+    MPI_Allreduce(locflag, globflag, 6, MPI_INT, MPI_MAX,
+                  this_locator->comm);
 
-    if (local_list == NULL)
-      memcpy(local_var, distant_var, n_points_loc*nbytes);
+    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
 
-    else {
-      const ple_lnum_t idb = this_locator->point_id_base;
-      for (i = 0; i < n_points_loc; i++) {
-        char *local_var_p = (char *)local_var + (local_list[i] - idb)*nbytes;
-        const char *distant_var_p = (const char *)distant_var + i*nbytes;
-        for (j = 0; j < nbytes; j++)
-          local_var_p[j] = distant_var_p[j];
-      }
-    }
+    if (globflag[0] < 0 || globflag[1] < 0)
+      return;
+    else if (mesh != NULL && globflag[1] != dim)
+      ple_error(__FILE__, __LINE__, 0,
+                _("Locator trying to use distant space dimension %d\n"
+                  "with local space dimension %d\n"),
+                globflag[1], dim);
+    else if (mesh == NULL && globflag[0] != dim)
+      ple_error(__FILE__, __LINE__, 0,
+                _("Locator trying to use local space dimension %d\n"
+                  "with distant space dimension %d\n"),
+                dim, globflag[0]);
 
-  }
-  else { /* if (reverse == true) */
+    /* Check algorithm versions and supported features */
 
-    if (local_list == NULL)
-      memcpy(distant_var, local_var, n_points_loc*nbytes);
+    globflag[3] = -globflag[3];
 
-    else {
-      const ple_lnum_t idb = this_locator->point_id_base;
-      for (i = 0; i < n_points_loc; i++) {
-        const char *local_var_p
-          = (const char *)local_var + (local_list[i] - idb)*nbytes;
-        char *distant_var_p = (char *)distant_var + i*nbytes;
-        for (j = 0; j < nbytes; j++)
-          distant_var_p[j] = local_var_p[j];
-      }
+    /* Compatibility with older versions */
+    for (i = 2; i < 5; i++) {
+      if (globflag[i] == 1)
+        globflag[i] = _LOCATE_BB_SENDRECV;
     }
 
-  }
-}
-
-/*----------------------------------------------------------------------------
- * Distribute variable defined on "distant points" to the original ("local")
- * points.
- *
- * The exchange is symmetric if both variables are defined, receive
- * only if distant_var is NULL, or send only if local_var is NULL.
- *
- * parameters:
- *   this_locator  <-- pointer to locator structure
- *   distant_var   <-> variable defined on distant points (ready to send)
- *   local_var     <-> variable defined on local points (received)
- *   local_list    <-- optional indirection list for local_var
- *   type_size     <-- sizeof (float or double) variable type
- *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
- *   reverse       <-- if true, exchange is reversed
- *                     (receive values associated with distant points
- *                     from the processes owning the original points)
- *----------------------------------------------------------------------------*/
-
-static void
-_exchange_point_var_local_incomplete(ple_locator_t     *this_locator,
-                                     void              *distant_var,
-                                     void              *local_var,
-                                     const ple_lnum_t  *local_list,
-                                     size_t             type_size,
-                                     size_t             stride,
-                                     bool               reverse)
-{
-  const size_t nbytes = stride*type_size;
-
-  const ple_lnum_t *il = this_locator->interior_list;
+    if (globflag[2] > globflag[3])
+      ple_error(__FILE__, __LINE__, 0,
+                _("Incompatible locator algorithm ranges:\n"
+                  "  global minimum algorithm id %d\n"
+                  "  global maximum algorithm id %d\n"
+                  "PLE library versions or builds are incompatible."),
+                globflag[2], globflag[3]);
 
-  /* Initialization */
+    if (globflag[4] < globflag[2])
+      globflag[4] = globflag[2];
+    if (globflag[4] > globflag[3])
+      globflag[4] = globflag[3];
 
-  if (this_locator->n_interior == 0)
-    return;
+    this_locator->locate_algorithm = globflag[4];
 
-  ple_lnum_t n_points_loc =   this_locator->local_points_idx[1]
-                            - this_locator->local_points_idx[0];
+    if (globflag[5] > 0)
+      this_locator->have_tags = 1;
 
-  assert(n_points_loc == (  this_locator->distant_points_idx[1]
-                          - this_locator->distant_points_idx[0]));
+    /* Free temporary memory */
 
-  /* Exchange information */
+    PLE_MALLOC(location, n_points, ple_lnum_t);
+    PLE_MALLOC(location_rank_id, n_points, ple_lnum_t);
 
-  if (reverse == false) {
+    if (relocate)
+      _relocate_distant(this_locator,
+                        mesh,
+                        tolerance_base,
+                        tolerance_fraction,
+                        n_points,
+                        point_list,
+                        point_tag,
+                        point_coords,
+                        location,
+                        location_rank_id,
+                        distance,
+                        mesh_locate_f);
+    else
+      _transfer_location_distant(this_locator,
+                                 n_points,
+                                 location,
+                                 location_rank_id);
 
-    if (local_list == NULL) {
-      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
-        char *local_var_p = (char *)local_var + il[i]*nbytes;
-        const char *distant_var_p = (const char *)distant_var + i*nbytes;
-        for (size_t j = 0; j < nbytes; j++)
-          local_var_p[j] = distant_var_p[j];
-      }
-    }
-    else {
-      const ple_lnum_t idb = this_locator->point_id_base;
-      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
-        char *local_var_p = (char *)local_var + (local_list[il[i]] - idb)*nbytes;
-        const char *distant_var_p = (const char *)distant_var + i*nbytes;
-        for (size_t j = 0; j < nbytes; j++)
-          local_var_p[j] = distant_var_p[j];
-      }
-    }
+    _locate_all_distant(this_locator,
+                        mesh,
+                        tolerance_base,
+                        tolerance_fraction,
+                        n_points,
+                        point_list,
+                        point_tag,
+                        point_coords,
+                        location,
+                        location_rank_id,
+                        distance,
+                        mesh_extents_f,
+                        mesh_locate_f);
 
+    PLE_FREE(location_rank_id);
   }
-  else { /* if (reverse == true) */
 
-    if (local_list == NULL)
-      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
-        const char *local_var_p = (const char *)local_var + il[i]*nbytes;
-        char *distant_var_p = (char *)distant_var + i*nbytes;
-        for (size_t j = 0; j < nbytes; j++)
-          distant_var_p[j] = local_var_p[j];
-      }
+#endif
 
-    else {
-      const ple_lnum_t idb = this_locator->point_id_base;
-      for (ple_lnum_t i = 0; i < n_points_loc; i++) {
-        const char *local_var_p
-          = (const char *)local_var + (local_list[il[i]] - idb)*nbytes;
-        char *distant_var_p = (char *)distant_var + i*nbytes;
-        for (size_t j = 0; j < nbytes; j++)
-          distant_var_p[j] = local_var_p[j];
-      }
-    }
+  /* Prepare locator (local version) */
+  /*---------------------------------*/
 
-  }
-}
+  if (!mpi_flag) {
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Distribute variable defined on distant points to processes owning
- * the original points (i.e. distant processes).
- *
- * The exchange is symmetric if both variables are defined, receive
- * only if distant_var is NULL, or send only if local_var is NULL.
- *
- * The caller should have defined the values of distant_var[] for the
- * distant points, whose coordinates are given by
- * ple_locator_get_dist_coords(), and which are located in the elements
- * whose numbers are given by ple_locator_get_dist_locations().
- *
- * The local_var[] is defined at local points, restricted to located points
- * (those whose numbers are returned by ple_locator_get_interior_list())
- * if interior is set to 1.
- *
- * If the optional local_list indirection is used, it is assumed to use
- * the same base numbering as that defined by the options for the previous
- * call to ple_locator_set_mesh() or ple_locator_extend_search().
- *
- * \param[in]      this_locator pointer to locator structure
- * \param[in, out] distant_var  variable defined on distant points
- *                              (ready to send); size: n_dist_points*stride
- * \param[in, out] local_var    variable defined on local points
- *                              (received); size: n_interior*stride
- * \param[in]      local_list   optional indirection list for local_var
- * \param[in]      type_size    sizeof (float or double) variable type
- * \param[in]      stride       dimension (1 for scalar,
- *                              3 for interleaved vector)
- * \param[in]      reverse      if nonzero, exchange is reversed
- *                              (receive values associated with distant points
- *                              from the processes owning the original points)
- * \param[in]      interior     if true, local_var is restricted
- *                              to located points.
- */
-/*----------------------------------------------------------------------------*/
+    if (mesh == NULL || n_points == 0)
+      return;
 
-static void
-_exchange_point_var(ple_locator_t     *this_locator,
-                    void              *distant_var,
-                    void              *local_var,
-                    const ple_lnum_t  *local_list,
-                    size_t             type_size,
-                    size_t             stride,
-                    int                reverse,
-                    bool               interior)
-{
-  double w_start, w_end, cpu_start, cpu_end;
+    if (point_tag != NULL)
+      this_locator->have_tags = 1;
 
-  int mpi_flag = 0;
-  bool _reverse = reverse;
+    PLE_MALLOC(location, n_points, ple_lnum_t);
 
-  /* Initialize timing */
+    /* Relocation from previous owner brings nothing in local mode,
+       as the whole local mesh is searched in a single pass */
 
-  w_start = ple_timer_wtime();
-  cpu_start = ple_timer_cpu_time();
+    if (relocate)
+      _clear_location_info(this_locator);
 
-#if defined(PLE_HAVE_MPI)
+    _transfer_location_local(this_locator,
+                             n_points,
+                             location);
 
-  MPI_Initialized(&mpi_flag);
+    _locate_all_local(this_locator,
+                      mesh,
+                      tolerance_base,
+                      tolerance_fraction,
+                      n_points,
+                      point_list,
+                      point_tag,
+                      point_coords,
+                      location,
+                      distance,
+                      mesh_extents_f,
+                      mesh_locate_f);
 
-  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
-    mpi_flag = 0;
+    PLE_FREE(location);
 
-  if (mpi_flag) {
+  }
 
-    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+  /* Update local_point_ids values */
+  /*-------------------------------*/
 
-    if (type_size == sizeof(double))
-      datatype = MPI_DOUBLE;
-    else if (type_size == sizeof(float))
-      datatype = MPI_FLOAT;
-    else
-      ple_error(__FILE__, __LINE__, 0,
-                _("type_size passed to ple_locator_exchange_point_var() does\n"
-                  "not correspond to double or float."));
+  if (   this_locator->n_interior > 0
+      && this_locator->local_point_ids != NULL) {
 
-    assert (datatype != MPI_DATATYPE_NULL);
+    ple_lnum_t  *reduced_index;
 
-    if (this_locator->exchange_algorithm == _EXCHANGE_SENDRECV)
-      _exchange_point_var_distant(this_locator,
-                                  distant_var,
-                                  local_var,
-                                  local_list,
-                                  datatype,
-                                  stride,
-                                  _reverse,
-                                  interior);
+    PLE_MALLOC(reduced_index, n_points, ple_lnum_t);
 
-    else if (this_locator->exchange_algorithm == _EXCHANGE_ISEND_IRECV)
-      _exchange_point_var_distant_asyn(this_locator,
-                                       distant_var,
-                                       local_var,
-                                       local_list,
-                                       datatype,
-                                       stride,
-                                       _reverse,
-                                       interior);
+    for (i = 0; i < n_points; i++)
+      reduced_index[i] = -1;
 
-  }
+    assert(  this_locator->local_points_idx[this_locator->n_intersects]
+           == this_locator->n_interior);
 
-#endif /* defined(PLE_HAVE_MPI) */
+    for (i = 0; i < this_locator->n_interior; i++)
+      reduced_index[this_locator->interior_list[i] - idb] = i;
 
-  if (!mpi_flag) {
-    if (this_locator->n_exterior == 0 || interior)
-      _exchange_point_var_local(this_locator,
-                                distant_var,
-                                local_var,
-                                local_list,
-                                type_size,
-                                stride,
-                                _reverse);
-    else
-      _exchange_point_var_local_incomplete(this_locator,
-                                           distant_var,
-                                           local_var,
-                                           local_list,
-                                           type_size,
-                                           stride,
-                                           _reverse);
-  }
+    /* Update this_locator->local_point_ids[] so that it refers
+       to an index in a dense [0, this_locator->n_interior] subset
+       of the local points */
 
-  /* Finalize timing */
+    for (i = 0; i < this_locator->n_interior; i++)
+      this_locator->local_point_ids[i]
+        = reduced_index[this_locator->local_point_ids[i]];
 
-  w_end = ple_timer_wtime();
-  cpu_end = ple_timer_cpu_time();
+    for (i = 0; i < this_locator->n_interior; i++)
+      assert(this_locator->local_point_ids[i] > -1);
 
-  this_locator->exchange_wtime[0] += (w_end - w_start);
-  this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
-}
+    PLE_FREE(reduced_index);
 
-/*----------------------------------------------------------------------------
- * Return timing information.
- *
- * When location on closest elements to force location of all points is
- * active, location times include a total value, followed by the value
- * associated with the location of closest elements stage.
- *
- * parameters:
- *   this_locator      <-- pointer to locator structure
- *   time_type         <-- 0 for total times, 1 for communication times
- *   location_wtime    --> Location Wall-clock time (or NULL)
- *   location_cpu_time --> Location CPU time (or NULL)
- *   exchange_wtime    --> Variable exchange Wall-clock time (or NULL)
- *   exchange_cpu_time --> Variable exchange CPU time (or NULL)
- *----------------------------------------------------------------------------*/
+  }
 
-static void
-_get_times(const ple_locator_t  *this_locator,
-           int                   time_type,
-           double               *location_wtime,
-           double               *location_cpu_time,
-           double               *exchange_wtime,
-           double               *exchange_cpu_time)
-{
-  const ple_locator_t  *_locator = this_locator;
+  /* If an initial point list was given, update
+     this_locator->interior_list and this_locator->exterior_list
+     so that they refer to the same point set as that initial
+     list (and not to an index within the selected point set) */
 
-  if (this_locator != NULL) {
+  if (point_list != NULL) {
 
-    if (location_wtime != NULL) {
-      *location_wtime = _locator->location_wtime[time_type];
-    }
-    if (location_cpu_time != NULL) {
-      *location_cpu_time = _locator->location_cpu_time[time_type];
-    }
-    if (exchange_wtime != NULL)
-      *exchange_wtime = _locator->exchange_wtime[time_type];
-    if (exchange_cpu_time != NULL)
-      *exchange_cpu_time = _locator->exchange_cpu_time[time_type];
+    for (i = 0; i < this_locator->n_interior; i++)
+      this_locator->interior_list[i]
+        = point_list[this_locator->interior_list[i] - idb];
 
-  }
-  else {
+    for (i = 0; i < this_locator->n_exterior; i++)
+      this_locator->exterior_list[i]
+        = point_list[this_locator->exterior_list[i] - idb];
 
-    if (location_wtime != NULL) {
-      location_wtime[0] = 0.;
-      location_wtime[1] = 0.;
-    }
-    if (location_cpu_time != NULL) {
-      location_cpu_time[0] = 0.;
-      location_cpu_time[1] = 0.;
-    }
-    if (exchange_wtime != NULL)
-      *exchange_wtime = 0.;
-    if (exchange_cpu_time != NULL)
-      *exchange_cpu_time = 0.;
   }
+
+  /* Finalize timing */
+
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
+
+  this_locator->location_wtime[0] += (w_end - w_start);
+  this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
+
+  this_locator->location_wtime[1] += comm_timing[0];
+  this_locator->location_cpu_time[1] += comm_timing[1];
 }
 
 /*============================================================================
@@ -3270,316 +4283,143 @@ ple_locator_set_mesh(ple_locator_t               *this_locator,
   /* Initialize timing */
 
   w_start = ple_timer_wtime();
-  cpu_start = ple_timer_cpu_time();
-
-  /* Other initializations */
-
-  this_locator->dim = dim;
-
-  if (distance != NULL) {
-    for (ple_lnum_t i = 0; i < n_points; i++)
-      distance[i] = -1;
-  }
-
-  /* Release information if previously present */
-
-  _clear_location_info(this_locator);
-
-  ple_locator_extend_search(this_locator,
-                            mesh,
-                            options,
-                            tolerance_base,
-                            tolerance_fraction,
-                            n_points,
-                            point_list,
-                            point_tag,
-                            point_coords,
-                            distance,
-                            mesh_extents_f,
-                            mesh_locate_f);
-
-  /* Finalize timing */
-
-  w_end = ple_timer_wtime();
-  cpu_end = ple_timer_cpu_time();
-
-  this_locator->location_wtime[0] += (w_end - w_start);
-  this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
-}
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Extend search for a locator for which set_mesh has already been
- *        called.
- *
- * \param[in, out] this_locator        pointer to locator structure
- * \param[in]      mesh                pointer to mesh representation structure
- * \param[in]      options             options array (size
- *                                     PLE_LOCATOR_N_OPTIONS), or NULL
- * \param[in]      tolerance_base      associated fixed tolerance
- * \param[in]      tolerance_fraction  associated fraction of element bounding
- *                                     boxes added to tolerance
- * \param[in]      n_points            number of points to locate
- * \param[in]      point_list          optional indirection array to point_coords
- * \param[in]      point_tag           optional point tag (size: n_points)
- * \param[in]      point_coords        coordinates of points to locate
- *                                     (dimension: dim * n_points)
- * \param[out]     distance            optional distance from point to matching
- *                                     element: < 0 if unlocated; 0 - 1 if inside
- *                                     and > 1 if outside a volume element, or
- *                                     absolute distance to a surface element
- *                                     (size: n_points)
- * \param[in]      mesh_extents_f      pointer to function computing mesh or mesh
- *                                     subset or element extents
- * \param[in]      mesh_locate_f       pointer to function wich updates the
- *                                     location[] and distance[] arrays
- *                                     associated with a set of points for
- *                                     points that are in an element of this
- *                                     mesh, or closer to one than to previously
- *                                     encountered elements.
- */
-/*----------------------------------------------------------------------------*/
-
-void
-ple_locator_extend_search(ple_locator_t               *this_locator,
-                          const void                  *mesh,
-                          const int                   *options,
-                          float                        tolerance_base,
-                          float                        tolerance_fraction,
-                          ple_lnum_t                   n_points,
-                          const ple_lnum_t             point_list[],
-                          const int                    point_tag[],
-                          const ple_coord_t            point_coords[],
-                          float                        distance[],
-                          ple_mesh_extents_t          *mesh_extents_f,
-                          ple_mesh_elements_locate_t  *mesh_locate_f)
-{
-  int i;
-  double w_start, w_end, cpu_start, cpu_end;
-  ple_lnum_t  *location;
-
-  double comm_timing[4] = {0., 0., 0., 0.};
-  int mpi_flag = 0;
-
-  /* Initialize timing */
-
-  w_start = ple_timer_wtime();
-  cpu_start = ple_timer_cpu_time();
-
-  if (options != NULL)
-    this_locator->point_id_base = options[PLE_LOCATOR_NUMBERING];
-  else
-    this_locator->point_id_base = 0;
-
-  const int idb = this_locator->point_id_base;
-
-  this_locator->have_tags = 0;
-
-  /* Prepare locator (MPI version) */
-  /*-------------------------------*/
-
-#if defined(PLE_HAVE_MPI)
-
-  const int dim = this_locator->dim;
-
-  MPI_Initialized(&mpi_flag);
-
-  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
-    mpi_flag = 0;
-
-  if (mpi_flag) {
-
-    /* Flag values
-       0: mesh dimension
-       1: space dimension
-       2: minimum algorithm version
-       3: maximum algorithm version
-       4: preferred algorithm version
-       5: have point tags */
-
-    int globflag[6];
-    int locflag[6] = {-1,
-                      -1,
-                      1, /* equivalent to _LOCATE_BB_SENDRECV */
-                      -_LOCATE_BB_SENDRECV_ORDERED,
-                      this_locator->locate_algorithm,
-                      0};
-    ple_lnum_t  *location_rank_id;
-
-    /* Check that at least one of the local or distant nodal meshes
-       is non-NULL, and at least one of the local or distant
-       point sets is non null */
-
-    if (mesh != NULL)
-      locflag[0] = dim;
-
-    if (n_points > 0)
-      locflag[1] = dim;
-
-    if (n_points > 0 && point_tag != NULL)
-      locflag[5] = 1;
-
-    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
-
-    MPI_Allreduce(locflag, globflag, 6, MPI_INT, MPI_MAX,
-                  this_locator->comm);
-
-    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
-
-    if (globflag[0] < 0 || globflag[1] < 0)
-      return;
-    else if (mesh != NULL && globflag[1] != dim)
-      ple_error(__FILE__, __LINE__, 0,
-                _("Locator trying to use distant space dimension %d\n"
-                  "with local space dimension %d\n"),
-                globflag[1], dim);
-    else if (mesh == NULL && globflag[0] != dim)
-      ple_error(__FILE__, __LINE__, 0,
-                _("Locator trying to use local space dimension %d\n"
-                  "with distant space dimension %d\n"),
-                dim, globflag[0]);
-
-    /* Check algorithm versions and supported features */
-
-    globflag[3] = -globflag[3];
-
-    /* Compatibility with older versions */
-    for (i = 2; i < 5; i++) {
-      if (globflag[i] == 1)
-        globflag[i] = _LOCATE_BB_SENDRECV;
-    }
-
-    if (globflag[2] > globflag[3])
-      ple_error(__FILE__, __LINE__, 0,
-                _("Incompatible locator algorithm ranges:\n"
-                  "  global minimum algorithm id %d\n"
-                  "  global maximum algorithm id %d\n"
-                  "PLE library versions or builds are incompatible."),
-                globflag[2], globflag[3]);
-
-    if (globflag[4] < globflag[2])
-      globflag[4] = globflag[2];
-    if (globflag[4] > globflag[3])
-      globflag[4] = globflag[3];
-
-    this_locator->locate_algorithm = globflag[4];
-
-    if (globflag[5] > 0)
-      this_locator->have_tags = 1;
-
-    /* Free temporary memory */
-
-    PLE_MALLOC(location, n_points, ple_lnum_t);
-    PLE_MALLOC(location_rank_id, n_points, ple_lnum_t);
-
-    _transfer_location_distant(this_locator,
-                               n_points,
-                               location,
-                               location_rank_id);
-
-    _locate_all_distant(this_locator,
-                        mesh,
-                        tolerance_base,
-                        tolerance_fraction,
-                        n_points,
-                        point_list,
-                        point_tag,
-                        point_coords,
-                        location,
-                        location_rank_id,
-                        distance,
-                        mesh_extents_f,
-                        mesh_locate_f);
-
-    PLE_FREE(location_rank_id);
-  }
-
-#endif
-
-  /* Prepare locator (local version) */
-  /*---------------------------------*/
-
-  if (!mpi_flag) {
-
-    if (mesh == NULL || n_points == 0)
-      return;
-
-    if (point_tag != NULL)
-      this_locator->have_tags = 1;
-
-    PLE_MALLOC(location, n_points, ple_lnum_t);
-
-    _transfer_location_local(this_locator,
-                             n_points,
-                             location);
-
-    _locate_all_local(this_locator,
-                      mesh,
-                      tolerance_base,
-                      tolerance_fraction,
-                      n_points,
-                      point_list,
-                      point_tag,
-                      point_coords,
-                      location,
-                      distance,
-                      mesh_extents_f,
-                      mesh_locate_f);
+  cpu_start = ple_timer_cpu_time();
 
-    PLE_FREE(location);
+  /* Other initializations */
+
+  this_locator->dim = dim;
 
+  if (distance != NULL) {
+    for (ple_lnum_t i = 0; i < n_points; i++)
+      distance[i] = -1;
   }
 
-  /* Update local_point_ids values */
-  /*-------------------------------*/
+  /* Release information if previously present */
 
-  if (   this_locator->n_interior > 0
-      && this_locator->local_point_ids != NULL) {
+  _clear_location_info(this_locator);
 
-    ple_lnum_t  *reduced_index;
+  ple_locator_extend_search(this_locator,
+                            mesh,
+                            options,
+                            tolerance_base,
+                            tolerance_fraction,
+                            n_points,
+                            point_list,
+                            point_tag,
+                            point_coords,
+                            distance,
+                            mesh_extents_f,
+                            mesh_locate_f);
 
-    PLE_MALLOC(reduced_index, n_points, ple_lnum_t);
+  /* Finalize timing */
 
-    for (i = 0; i < n_points; i++)
-      reduced_index[i] = -1;
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
 
-    assert(  this_locator->local_points_idx[this_locator->n_intersects]
-           == this_locator->n_interior);
+  this_locator->location_wtime[0] += (w_end - w_start);
+  this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
+}
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      reduced_index[this_locator->interior_list[i] - idb] = i;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update locator for a moved mesh or moved points, reusing the
+ *        previous location.
+ *
+ * This function has the same effect as \ref ple_locator_set_mesh, but
+ * when the locator was already set with the same point set (possibly with
+ * different coordinates), each previously located point is first searched
+ * only on the rank on which it was previously located. Only points which
+ * are not found inside an element of that rank (distance in the 0 - 1
+ * range) are handled by the global search, so the cost of the update
+ * is mostly related to the number of points which moved to another rank.
+ *
+ * If the point set changed on any rank, a full location is done.
+ *
+ * This function is collective on the locator's communicator, and must
+ * be called on all ranks instead of \ref ple_locator_set_mesh.
+ *
+ * \param[in, out] this_locator        pointer to locator structure
+ * \param[in]      mesh                pointer to mesh representation structure
+ * \param[in]      options             options array (size
+ *                                     PLE_LOCATOR_N_OPTIONS), or NULL
+ * \param[in]      tolerance_base      associated fixed tolerance
+ * \param[in]      tolerance_fraction  associated fraction of element bounding
+ *                                     boxes added to tolerance
+ * \param[in]      dim                 spatial dimension of mesh and points to
+ *                                     locate
+ * \param[in]      n_points            number of points to locate
+ * \param[in]      point_list          optional indirection array to point_coords
+ * \param[in]      point_tag           optional point tag (size: n_points)
+ * \param[in]      point_coords        coordinates of points to locate
+ *                                     (dimension: dim * n_points)
+ * \param[out]     distance            optional distance from point to matching
+ *                                     element: < 0 if unlocated; 0 - 1 if inside
+ *                                     and > 1 if outside a volume element, or
+ *                                     absolute distance to a surface element
+ *                                     (size: n_points)
+ * \param[in]      mesh_extents_f      pointer to function computing mesh or mesh
+ *                                     subset or element extents
+ * \param[in]      mesh_locate_f       pointer to function wich updates the
+ *                                     location[] and distance[] arrays
+ *                                     associated with a set of points for
+ *                                     points that are in an element of this
+ *                                     mesh, or closer to one than to previously
+ *                                     encountered elements.
+ */
+/*----------------------------------------------------------------------------*/
 
-    /* Update this_locator->local_point_ids[] so that it refers
-       to an index in a dense [0, this_locator->n_interior] subset
-       of the local points */
+void
+ple_locator_update_mesh(ple_locator_t               *this_locator,
+                        const void                  *mesh,
+                        const int                   *options,
+                        float                        tolerance_base,
+                        float                        tolerance_fraction,
+                        int                          dim,
+                        ple_lnum_t                   n_points,
+                        const ple_lnum_t             point_list[],
+                        const int                    point_tag[],
+                        const ple_coord_t            point_coords[],
+                        float                        distance[],
+                        ple_mesh_extents_t          *mesh_extents_f,
+                        ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  double w_start, w_end, cpu_start, cpu_end;
+  float *_distance = distance;
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      this_locator->local_point_ids[i]
-        = reduced_index[this_locator->local_point_ids[i]];
+  /* Initialize timing */
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      assert(this_locator->local_point_ids[i] > -1);
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
 
-    PLE_FREE(reduced_index);
+  /* Other initializations */
 
-  }
+  if (this_locator->dim != dim)
+    _clear_location_info(this_locator);
 
-  /* If an initial point list was given, update
-     this_locator->interior_list and this_locator->exterior_list
-     so that they refer to the same point set as that initial
-     list (and not to an index within the selected point set) */
+  this_locator->dim = dim;
 
-  if (point_list != NULL) {
+  if (distance == NULL)
+    PLE_MALLOC(_distance, n_points, float);
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      this_locator->interior_list[i]
-        = point_list[this_locator->interior_list[i] - idb];
+  for (ple_lnum_t i = 0; i < n_points; i++)
+    _distance[i] = -1;
 
-    for (i = 0; i < this_locator->n_exterior; i++)
-      this_locator->exterior_list[i]
-        = point_list[this_locator->exterior_list[i] - idb];
+  _extend_search(this_locator,
+                 mesh,
+                 options,
+                 tolerance_base,
+                 tolerance_fraction,
+                 n_points,
+                 point_list,
+                 point_tag,
+                 point_coords,
+                 _distance,
+                 mesh_extents_f,
+                 mesh_locate_f,
+                 1);
 
-  }
+  if (_distance != distance)
+    PLE_FREE(_distance);
 
   /* Finalize timing */
 
@@ -3588,9 +4428,68 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
 
   this_locator->location_wtime[0] += (w_end - w_start);
   this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
+}
 
-  this_locator->location_wtime[1] += comm_timing[0];
-  this_locator->location_cpu_time[1] += comm_timing[1];
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Extend search for a locator for which set_mesh has already been
+ *        called.
+ *
+ * \param[in, out] this_locator        pointer to locator structure
+ * \param[in]      mesh                pointer to mesh representation structure
+ * \param[in]      options             options array (size
+ *                                     PLE_LOCATOR_N_OPTIONS), or NULL
+ * \param[in]      tolerance_base      associated fixed tolerance
+ * \param[in]      tolerance_fraction  associated fraction of element bounding
+ *                                     boxes added to tolerance
+ * \param[in]      n_points            number of points to locate
+ * \param[in]      point_list          optional indirection array to point_coords
+ * \param[in]      point_tag           optional point tag (size: n_points)
+ * \param[in]      point_coords        coordinates of points to locate
+ *                                     (dimension: dim * n_points)
+ * \param[out]     distance            optional distance from point to matching
+ *                                     element: < 0 if unlocated; 0 - 1 if inside
+ *                                     and > 1 if outside a volume element, or
+ *                                     absolute distance to a surface element
+ *                                     (size: n_points)
+ * \param[in]      mesh_extents_f      pointer to function computing mesh or mesh
+ *                                     subset or element extents
+ * \param[in]      mesh_locate_f       pointer to function wich updates the
+ *                                     location[] and distance[] arrays
+ *                                     associated with a set of points for
+ *                                     points that are in an element of this
+ *                                     mesh, or closer to one than to previously
+ *                                     encountered elements.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_extend_search(ple_locator_t               *this_locator,
+                          const void                  *mesh,
+                          const int                   *options,
+                          float                        tolerance_base,
+                          float                        tolerance_fraction,
+                          ple_lnum_t                   n_points,
+                          const ple_lnum_t             point_list[],
+                          const int                    point_tag[],
+                          const ple_coord_t            point_coords[],
+                          float                        distance[],
+                          ple_mesh_extents_t          *mesh_extents_f,
+                          ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  _extend_search(this_locator,
+                 mesh,
+                 options,
+                 tolerance_base,
+                 tolerance_fraction,
+                 n_points,
+                 point_list,
+                 point_tag,
+                 point_coords,
+                 distance,
+                 mesh_extents_f,
+                 mesh_locate_f,
+                 0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3886,6 +4785,160 @@ ple_locator_exchange_point_var_all(ple_locator_t     *this_locator,
                       false);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a non-blocking exchange of a variable defined on distant
+ *        points with processes owning the original points.
+ *
+ * Arguments and behavior are those of \ref ple_locator_exchange_point_var,
+ * but the function returns once the exchange is initiated, so that
+ * work independent from the exchanged values may be done before calling
+ * \ref ple_locator_exchange_point_var_wait. Until then, distant_var and
+ * local_var must neither be freed nor (for the sent values) modified,
+ * and the locator must not be changed.
+ *
+ * In reverse mode, the small flag handshake with distant ranks is
+ * completed before returning; only the data transfer is overlapped.
+ *
+ * Several exchanges may be pending on the same locator, as long as
+ * they are started in the same order on all ranks.
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in, out] distant_var  variable defined on distant points
+ *                              (ready to send); size: n_dist_points*stride
+ * \param[in, out] local_var    variable defined on located local points
+ *                              (received); size: n_interior*stride
+ * \param[in]      local_list   optional indirection list for local_var
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ *
+ * \return pointer to pending exchange structure
+ */
+/*----------------------------------------------------------------------------*/
+
+ple_locator_exchange_t *
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse)
+{
+  int mpi_flag = 0;
+  ple_locator_exchange_t *ex = NULL;
+
+  PLE_MALLOC(ex, 1, ple_locator_exchange_t);
+
+  ex->locator = this_locator;
+  ex->local_var = local_var;
+  ex->local_list = local_list;
+  ex->nbytes = type_size*stride;
+  ex->reverse = (reverse) ? 1 : 0;
+
+#if defined(PLE_HAVE_MPI)
+
+  ex->n_requests = 0;
+  ex->request = NULL;
+  ex->dist_v_flag = NULL;
+  ex->loc_v_flag = NULL;
+  ex->loc_v_buf = NULL;
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    double w_start = ple_timer_wtime();
+    double cpu_start = ple_timer_cpu_time();
+
+    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+
+    if (type_size == sizeof(double))
+      datatype = MPI_DOUBLE;
+    else if (type_size == sizeof(float))
+      datatype = MPI_FLOAT;
+    else
+      ple_error(__FILE__, __LINE__, 0,
+                _("type_size passed to ple_locator_exchange_point_var_start()\n"
+                  "does not correspond to double or float."));
+
+    _exchange_point_var_distant_start(ex, distant_var, datatype, stride);
+
+    this_locator->exchange_wtime[0] += (ple_timer_wtime() - w_start);
+    this_locator->exchange_cpu_time[0] += (ple_timer_cpu_time() - cpu_start);
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  /* In local mode, the exchange is simply done immediately */
+
+  if (!mpi_flag)
+    _exchange_point_var(this_locator,
+                        distant_var,
+                        local_var,
+                        local_list,
+                        type_size,
+                        stride,
+                        reverse,
+                        true);
+
+  return ex;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a non-blocking exchange started with
+ *        \ref ple_locator_exchange_point_var_start.
+ *
+ * Received values are available in the matching local_var or distant_var
+ * array on return, and the exchange structure is freed.
+ *
+ * \param[in, out] exchange  pointer to pending exchange structure pointer
+ *                           (set to NULL on return)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_exchange_t  **exchange)
+{
+  if (exchange == NULL)
+    return;
+
+  ple_locator_exchange_t *ex = *exchange;
+
+  if (ex == NULL)
+    return;
+
+#if defined(PLE_HAVE_MPI)
+
+  if (ex->request != NULL) {
+
+    ple_locator_t *this_locator = ex->locator;
+
+    double w_start = ple_timer_wtime();
+    double cpu_start = ple_timer_cpu_time();
+
+    _exchange_point_var_distant_wait(ex);
+
+    this_locator->exchange_wtime[0] += (ple_timer_wtime() - w_start);
+    this_locator->exchange_cpu_time[0] += (ple_timer_cpu_time() - cpu_start);
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  PLE_FREE(ex);
+  *exchange = NULL;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return timing information.
@@ -160,6 +160,12 @@ typedef int
 
 typedef struct _ple_locator_t ple_locator_t;
 
+/*----------------------------------------------------------------------------
+ * Structure defining a pending (non-blocking) variable exchange
+ *----------------------------------------------------------------------------*/
+
+typedef struct _ple_locator_exchange_t ple_locator_exchange_t;
+
 /*=============================================================================
  * Static global variables
  *============================================================================*/
@@ -257,6 +263,62 @@ ple_locator_set_mesh(ple_locator_t               *this_locator,
                      ple_mesh_extents_t          *mesh_extents_f,
                      ple_mesh_elements_locate_t  *mesh_elements_locate_f);
 
+/*----------------------------------------------------------------------------
+ * Update locator for a moved mesh or moved points, reusing the
+ * previous location.
+ *
+ * This function has the same effect as ple_locator_set_mesh(), but when
+ * the locator was already set with the same point set (possibly with
+ * different coordinates), each previously located point is first searched
+ * only on the rank on which it was previously located. Only points which
+ * are not found inside an element of that rank are handled by the global
+ * search.
+ *
+ * This function is collective on the locator's communicator, and must
+ * be called on all ranks instead of ple_locator_set_mesh().
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   options            <-- options array (size PLE_LOCATOR_N_OPTIONS),
+ *                          or NULL
+ *   tolerance_base     <-- associated base tolerance (used for bounding
+ *                          box check only, not for location test)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   dim                <-- spatial dimension of mesh and points to locate
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   distance           --> optional distance from point to matching element:
+ *                          < 0 if unlocated; 0 - 1 if inside and > 1 if
+ *                          outside a volume element, or absolute distance
+ *                          to a surface element (size: n_points)
+ *   mesh_extents_f     <-- pointer to function computing mesh extents
+ *   locate_f           <-- pointer to function wich updates the location[]
+ *                          and distance[] arrays associated with a set of
+ *                          points for points that are in an element of this
+ *                          mesh, or closer to one than to previously
+ *                          encountered elements.
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_update_mesh(ple_locator_t               *this_locator,
+                        const void                  *mesh,
+                        const int                   *options,
+                        float                        tolerance_base,
+                        float                        tolerance_fraction,
+                        int                          dim,
+                        ple_lnum_t                   n_points,
+                        const ple_lnum_t             point_list[],
+                        const int                    point_tag[],
+                        const ple_coord_t            point_coords[],
+                        float                        distance[],
+                        ple_mesh_extents_t          *mesh_extents_f,
+                        ple_mesh_elements_locate_t  *mesh_elements_locate_f);
+
 /*----------------------------------------------------------------------------
  * Extend search for a locator for which set_mesh has already been called.
  *
@@ -505,6 +567,64 @@ ple_locator_exchange_point_var_all(ple_locator_t     *this_locator,
                                    size_t             stride,
                                    int                reverse);
 
+/*----------------------------------------------------------------------------
+ * Start a non-blocking exchange of a variable defined on distant points
+ * with processes owning the original points.
+ *
+ * Arguments and behavior are those of ple_locator_exchange_point_var(),
+ * but the function returns once the exchange is initiated, so that
+ * work independent from the exchanged values may be done before calling
+ * ple_locator_exchange_point_var_wait(). Until then, distant_var and
+ * local_var must neither be freed nor (for the sent values) modified,
+ * and the locator must not be changed.
+ *
+ * In reverse mode, the small flag handshake with distant ranks is
+ * completed before returning; only the data transfer is overlapped.
+ *
+ * Several exchanges may be pending on the same locator, as long as
+ * they are started in the same order on all ranks.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *                     size: n_dist_points*stride
+ *   local_var     <-> variable defined on located local points (received)
+ *                     size: n_interior*stride
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if nonzero, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *
+ * returns:
+ *   pointer to pending exchange structure
+ *----------------------------------------------------------------------------*/
+
+ple_locator_exchange_t *
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse);
+
+/*----------------------------------------------------------------------------
+ * Complete a non-blocking exchange started with
+ * ple_locator_exchange_point_var_start().
+ *
+ * Received values are available in the matching local_var or distant_var
+ * array on return, and the exchange structure is freed.
+ *
+ * parameters:
+ *   exchange <-> pointer to pending exchange structure pointer
+ *                (set to NULL on return)
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_exchange_t  **exchange);
+
 /*----------------------------------------------------------------------------
  * Return timing information.
  *
@@ -0,0 +1,170 @@
+dnl--------------------------------------------------------------------------------
+dnl
+dnl This file is part of code_saturne, a general-purpose CFD tool.
+dnl
+dnl Copyright (C) 1998-2024 EDF S.A.
+dnl
+dnl This program is free software; you can redistribute it and/or modify it under
+dnl the terms of the GNU General Public License as published by the Free Software
+dnl Foundation; either version 2 of the License, or (at your option) any later
+dnl version.
+dnl
+dnl This program is distributed in the hope that it will be useful, but WITHOUT
+dnl ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+dnl FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+dnl details.
+dnl
+dnl You should have received a copy of the GNU General Public License along with
+dnl this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+dnl Street, Fifth Floor, Boston, MA 02110-1301, USA.
+dnl
+dnl--------------------------------------------------------------------------------
+
+# CS_AC_TEST_ADIOS2
+#------------------
+# modifies or sets cs_have_adios2, ADIOS2_CPPFLAGS, ADIOS2_LDFLAGS,
+# and ADIOS2_LIBS depending on libraries found
+
+AC_DEFUN([CS_AC_TEST_ADIOS2], [
+
+cs_have_adios2=no
+cs_have_adios2_headers=no
+
+AC_ARG_VAR([ADIOS2_ROOT_DIR], [ADIOS2 root directory (superseded by --with-adios2=PATH)])
+
+AC_ARG_WITH(adios2,
+            [AS_HELP_STRING([--with-adios2=PATH],
+                            [specify prefix directory for ADIOS2])],
+            [if test "x$withval" = "xyes"; then
+               if test "x$ADIOS2_ROOT_DIR" != "x"; then
+                 with_adios2=$ADIOS2_ROOT_DIR
+               fi
+             fi],
+            [if test "x$ADIOS2_ROOT_DIR" != "x"; then
+               with_adios2=$ADIOS2_ROOT_DIR
+             else
+               with_adios2=check
+             fi])
+
+AC_ARG_WITH(adios2-include,
+            [AS_HELP_STRING([--with-adios2-include=PATH],
+                            [specify directory for ADIOS2 include files])],
+            [if test "x$with_adios2" = "xcheck"; then
+               with_adios2=yes
+             fi
+             ADIOS2_CPPFLAGS="-I$with_adios2_include"],
+            [if test "x$with_adios2" != "xno" -a "x$with_adios2" != "xyes" \
+	          -a "x$with_adios2" != "xcheck"; then
+               ADIOS2_CPPFLAGS="-I$with_adios2/include"
+             fi])
+
+AC_ARG_WITH(adios2-lib,
+            [AS_HELP_STRING([--with-adios2-lib=PATH],
+                            [specify directory for ADIOS2 library])],
+            [if test "x$with_adios2" = "xcheck"; then
+               with_adios2=yes
+             fi
+             ADIOS2_LDFLAGS="-L$with_adios2_lib"
+             # Add the libdir to the runpath for the preprocessor build
+             ADIOS2RUNPATH="${LDRPATH}${with_adios2_lib}"],
+            [if test "x$with_adios2" != "xno" -a "x$with_adios2" != "xyes" \
+	          -a "x$with_adios2" != "xcheck"; then
+               if test -d "$with_adios2/lib64" ; then
+                 ADIOS2_LDFLAGS="-L$with_adios2/lib64"
+                 ADIOS2RUNPATH="${LDRPATH}${with_adios2}/lib64"
+               else
+                 ADIOS2_LDFLAGS="-L$with_adios2/lib"
+                 ADIOS2RUNPATH="${LDRPATH}${with_adios2}/lib"
+               fi
+             fi])
+
+
+if test "x$with_adios2" != "xno" ; then
+
+  saved_CPPFLAGS="$CPPFLAGS"
+  saved_LDFLAGS="$LDFLAGS"
+  saved_LIBS="$LIBS"
+
+  if test "x$cs_have_mpi" = "xyes" ; then
+    ADIOS2_LIBS="-ladios2_c_mpi -ladios2_c"
+  else
+    ADIOS2_LIBS="-ladios2_c"
+  fi
+
+  CPPFLAGS="${CPPFLAGS} ${ADIOS2_CPPFLAGS} ${MPI_CPPFLAGS}"
+  LDFLAGS="${LDFLAGS} ${ADIOS2_LDFLAGS} ${MPI_LDFLAGS}"
+  LIBS="${ADIOS2_LIBS} ${MPI_LIBS} ${LIBS}"
+
+  # Check that a header file exists and that the version is compatible
+  # (adios2_init_mpi and adios2_init_serial appear in ADIOS2 2.8)
+  #-------------------------------------------------------------------
+
+  AC_COMPILE_IFELSE([AC_LANG_PROGRAM(
+[[#include <adios2_c.h>]],
+[[#if ADIOS2_VERSION_MAJOR < 2 || \
+     (ADIOS2_VERSION_MAJOR == 2 && ADIOS2_VERSION_MINOR < 8)
+# error ADIOS2 version >= 2.8 not found
+#endif
+]])],
+                    [AC_MSG_RESULT([ADIOS2 >= 2.8 headers found])
+                     cs_have_adios2_headers=yes
+                    ],
+                    [AC_MSG_RESULT([ADIOS2 >= 2.8 headers not found])
+                    ])
+
+  # Check for a matching library
+  #-----------------------------
+
+  if test "x$cs_have_adios2_headers" = "xyes"; then
+
+    AC_MSG_CHECKING([for ADIOS2 C library])
+
+    AC_LINK_IFELSE([AC_LANG_PROGRAM(
+[[#include <adios2_c.h>]],
+[[adios2_adios *adios = adios2_init_serial();
+  adios2_finalize(adios);]])],
+                   [ AC_DEFINE([HAVE_ADIOS2], 1, [ADIOS2 output support])
+                     cs_have_adios2=yes
+                   ],
+                   [])
+
+    AC_MSG_RESULT($cs_have_adios2)
+
+  fi
+
+  if test "x$cs_have_adios2" != "xyes"; then
+    ADIOS2_LIBS=""
+  fi
+
+  CPPFLAGS="$saved_CPPFLAGS"
+  LDFLAGS="$saved_LDFLAGS"
+  LIBS="$saved_LIBS"
+
+  unset saved_CPPFLAGS
+  unset saved_LDFLAGS
+  unset saved_LIBS
+
+  # Report ADIOS2 support
+  #----------------------
+
+  if test "x$cs_have_adios2" = "xno" ; then
+    if test "x$with_adios2" != "xcheck" ; then
+      AC_MSG_FAILURE([ADIOS2 support is requested, but test for ADIOS2 failed!])
+    else
+      AC_MSG_WARN([no ADIOS2 output support])
+    fi
+  fi
+
+fi
+
+unset cs_have_adios2_headers
+
+AM_CONDITIONAL(HAVE_ADIOS2, test x$cs_have_adios2 = xyes)
+
+AC_SUBST(cs_have_adios2)
+AC_SUBST(ADIOS2_CPPFLAGS)
+AC_SUBST(ADIOS2_LDFLAGS)
+AC_SUBST(ADIOS2_LIBS)
+AC_SUBST(ADIOS2RUNPATH)
+
+])dnl
@@ -128,6 +128,7 @@ class config:
                         'ple',                          # PLE
                         'eos', 'coolprop',              # Equations of state
                         'ccm', 'cgns', 'med', 'hdf5',   # Mesh filters
+                        'adios2',                       # Output library
                         'catalyst', 'melissa',          # co-processing libraries
                         'medcoupling',                  # MED coupling
                         'mumps',                        # Sparse direct solver
@@ -259,6 +260,7 @@ class config:
 
         self.libs['ccm']  = prerequisite('CCM', 'ccm', config_dict)
         self.libs['cgns'] = prerequisite('CGNS', 'cgns', config_dict)
+        self.libs['adios2'] = prerequisite('ADIOS2', 'adios2', config_dict)
         self.libs['hdf5'] = prerequisite('HDF5', 'hdf5', config_dict)
         self.libs['med']  = prerequisite('MED', 'med', config_dict)
 
@@ -750,6 +750,13 @@ class cs_math_parser:
                                     known_symbols.append('velocity')
                                     usr_defs.append(glob_tokens['velocity']+'\n')
 
+        # Output arrays of volume functions are accessed through local
+        # pointers, which may be captured by device kernels.
+        if func_type == "vol":
+            for fid in range(len(req_fields)):
+                usr_defs.append('cs_real_t *fvals_%d = fvals[%d];\n'
+                                % (fid, fid))
+
         #-------------------------
 
         if len(usr_defs) > 0:
@@ -758,13 +765,18 @@ class cs_math_parser:
         if len(usr_code) > 0:
             usr_code.append('\n')
 
+        # Local variables are declared inside the element loop when
+        # present, so that iterations are independent and may be run
+        # in parallel.
+        local_defs = usr_code if need_for_loop else usr_defs
+
         for t_i, t in enumerate(tokens):
             tk = t[0]
             # Check for assignments:
             if tk == "=" and t_i > 0:
                 tk0 = tokens[t_i-1][0]
                 if tk0 not in known_symbols:
-                    usr_defs.append('cs_real_t %s = -1.;\n' % tk0)
+                    local_defs.append('cs_real_t %s = -1.;\n' % tk0)
                     known_symbols.append(tk0)
 
 
@@ -779,9 +791,9 @@ class cs_math_parser:
                         raise Exception("Uknown field: %s" %(tk))
 
                     if fcomp < 0:
-                        new_v = new_v = 'fvals[%d][c_id]' % (fid)
+                        new_v = 'fvals_%d[c_id]' % (fid)
                     else:
-                        new_v = 'fvals[%d][c_id*%d + %d]' % (fid, fdim, fcomp)
+                        new_v = 'fvals_%d[c_id*%d + %d]' % (fid, fdim, fcomp)
 
                 elif func_type == 'bnd':
                     ir = req.index(tk)
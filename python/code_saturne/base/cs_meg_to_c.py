@@ -281,6 +281,43 @@ def parse_gui_expression(expression,
 # Utility functions
 #===============================================================================
 
+def write_dispatch_loop(usr_defs, usr_code, elt_id_name, out_ptrs):
+    """
+    Write a loop on zone elements using a dispatch context, so that it
+    is run on the device or using OpenMP threads. Values defined before
+    the loop (including notebook and field values pointers) are captured
+    by copy, and arrays they point to are checked for device access.
+    """
+
+    tab = '  '
+
+    ptrs = ['elt_ids', 'xyz']
+    for l in usr_defs.split('\n'):
+        m = re.search(r'\*\s*(\w+)\s*=', l)
+        if m and m.group(1) not in ptrs:
+            ptrs.append(m.group(1))
+    for p in out_ptrs:
+        if p not in ptrs:
+            ptrs.append(p)
+
+    usr_blck  = 2*tab + 'cs_dispatch_context ctx\n'
+    usr_blck += 2*tab + '  = cs_meg_dispatch_context({%s});\n\n' \
+                % ', '.join(ptrs)
+
+    usr_blck += 2*tab + 'ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE ' \
+                + '(cs_lnum_t e_id) {\n'
+    usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t %s = elt_ids[e_id];\n' \
+                % elt_id_name
+
+    usr_blck += usr_code
+
+    usr_blck += 2*tab + '});\n\n'
+    usr_blck += 2*tab + 'ctx.wait();\n'
+
+    return usr_blck
+
+#-------------------------------------------------------------------------------
+
 def break_expression(exp):
 
     expression_lines = []
@@ -550,12 +587,8 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
-        usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
-        usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t c_id = elt_ids[e_id];\n'
-
-        usr_blck += usr_code
+        usr_blck += write_dispatch_loop(usr_defs, usr_code, 'c_id', [])
 
-        usr_blck += 2*tab + '}\n'
         usr_blck += tab + '}\n'
 
         return usr_blck
@@ -662,13 +695,10 @@ class meg_to_c_interpreter:
         usr_blck += usr_defs
 
         if need_for_loop:
-            usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
-            usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t b_e_id = elt_ids[e_id];\n'
-
-        usr_blck += usr_code
-
-        if need_for_loop:
-            usr_blck += 2*tab + '}\n'
+            usr_blck += write_dispatch_loop(usr_defs, usr_code, 'b_e_id',
+                                            ['retvals'])
+        else:
+            usr_blck += usr_code
 
         usr_blck += tab + '}\n'
 
@@ -752,7 +782,7 @@ class meg_to_c_interpreter:
             'const cs_real_t *%s_vals = cs_field_by_name("%s")->val;' \
             % (f, knf_name)
 
-            loop_tokens[f] = 'const %s = %s_vals[c_id];' % (f, f)
+            loop_tokens[f] = 'const cs_real_t %s = %s_vals[c_id];' % (f, f)
 
         # ------------------------
 
@@ -780,12 +810,9 @@ class meg_to_c_interpreter:
 
         usr_blck += usr_defs
 
-        usr_blck += 2*tab + 'for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {\n'
-        usr_blck += 3*tab + '[[maybe_unused]] cs_lnum_t c_id = elt_ids[e_id];\n'
-
-        usr_blck += usr_code
+        usr_blck += write_dispatch_loop(usr_defs, usr_code, 'c_id',
+                                        ['retvals'])
 
-        usr_blck += 2*tab + '}\n'
         usr_blck += tab + '}\n'
 
         # Replace time table calls
@@ -128,10 +128,11 @@ class PerformanceTuningView(QWidget, Ui_PerformanceTuningForm):
         self.modelBlockIOWrite.addItem(self.tr("MPI I/O, non-collective"), 'mpi noncollective')
         self.modelBlockIOWrite.addItem(self.tr("MPI I/O, collective"), 'mpi collective')
 
-        self.modelAllToAll = ComboModel(self.comboBox_AllToAll, 2, 1)
+        self.modelAllToAll = ComboModel(self.comboBox_AllToAll, 3, 1)
 
         self.modelAllToAll.addItem(self.tr("Default (MPI_Alltoall/MPI_Alltoallv)"), 'default')
         self.modelAllToAll.addItem(self.tr("Crystal Router"), 'crystal router')
+        self.modelAllToAll.addItem(self.tr("Hierarchical (node aggregation)"), 'hierarchical')
 
         # Validators
 
@@ -367,7 +367,7 @@ class PerformanceTuningModel(Model):
         """
         Set all to all type.
         """
-        self.isInList(p, ('default', 'crystal router'))
+        self.isInList(p, ('default', 'crystal router', 'hierarchical'))
         if p == 'default':
             node = self.node_mgt.xmlGetNode('all_to_all')
             if node:
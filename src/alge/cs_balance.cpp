@@ -124,6 +124,19 @@ cs_balance_initialize(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finalize balance operators, logging which specialized kernels
+ *        were used for each field.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_finalize(void)
+{
+  cs_convection_diffusion_finalize();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Wrapper to the function which adds the explicit part of the
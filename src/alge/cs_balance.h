@@ -55,6 +55,16 @@ BEGIN_C_DECLS
 void
 cs_balance_initialize(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finalize balance operators, logging which specialized kernels
+ *        were used for each field.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Wrapper to the function which adds the explicit part of the
@@ -91,6 +91,77 @@ BEGIN_C_DECLS
 
 */
 
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Balance zone: cell selection and associated face classification */
+
+struct _cs_balance_by_zone_t {
+
+  char        *criteria;       /* selection criteria, or NULL */
+
+  cs_lnum_t    n_cells_ext;    /* mesh sizes at build time */
+  cs_lnum_t    n_i_faces_m;
+  cs_lnum_t    n_b_faces_m;
+
+  cs_lnum_t    n_cells;        /* number of selected cells */
+  cs_lnum_t   *cell_ids;       /* ids of selected cells */
+  cs_lnum_t   *cells_tag_ids;  /* 1 for selected cells (with ghosts),
+                                  0 otherwise */
+
+  cs_lnum_t    n_i_faces;      /* number of interior faces of the zone */
+  cs_lnum_t   *i_face_ids;     /* ids of interior faces of the zone */
+
+  cs_lnum_t    n_bi_faces;     /* number of zone boundary faces which are
+                                  interior faces of the mesh */
+  cs_lnum_t   *bi_face_ids;    /* ids of matching faces */
+  short int   *bi_face_side;   /* 0 if the first adjacent cell is in the
+                                  zone, 1 if the second one is */
+
+  cs_lnum_t    n_bb_faces;     /* number of zone boundary faces which are
+                                  boundary faces of the mesh */
+  cs_lnum_t   *bb_face_ids;    /* ids of matching faces */
+
+};
+
+/* Zone-independent data for the balance of a given scalar */
+
+typedef struct {
+
+  int          nt;             /* time step at which data was computed */
+  cs_lnum_t    n_cells_ext;    /* number of cells (with ghosts) */
+
+  bool         cpro_cp_owner;  /* true if cpro_cp is owned */
+  cs_real_t   *cpro_cp;        /* specific heat (or 1) */
+
+  int          limiter_choice; /* NVD/TVD limiter choice, or -1 */
+
+  cs_real_3_t *grad;           /* gradient */
+  cs_real_3_t *gradup;         /* upwind gradient, or NULL */
+  cs_real_3_t *gradst;         /* slope test gradient, or NULL */
+  cs_real_t   *local_max;      /* local maximum for limiters, or NULL */
+  cs_real_t   *local_min;      /* local minimum for limiters, or NULL */
+  cs_real_t   *courant;        /* cell Courant number, or NULL */
+  cs_real_t   *i_visc;         /* interior face viscosity */
+  cs_real_t   *b_visc;         /* boundary face viscosity */
+
+} _balance_scalar_data_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Zones defined by selection criteria, reused from one call to the next */
+
+static int                     _n_zones = 0;
+static cs_balance_by_zone_t  **_zones = NULL;
+
+/* Zone-independent scalar data, indexed by field id */
+
+static int                      _n_scalar_data = 0;
+static _balance_scalar_data_t  *_scalar_data = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -726,52 +797,23 @@ _balance_internal_faces(int              iupwin,
 
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*=============================================================================
- * Local Macro Definitions
- *============================================================================*/
-
-/*============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute the different terms of the balance of a given scalar,
- *        on a volume zone defined by selected cell ids/
- *
- * This function computes the balance relative to a given scalar
- * on a selected zone of the mesh.
- * We assume that we want to compute balances (convective and diffusive)
- * at the boundaries of the calculation domain represented below
- * (with different boundary types).
- *
- * In the case of the temperature, the energy balance in Joules will be
- * computed by multiplying by the specific heat.
+/*----------------------------------------------------------------------------
+ * Build face lists of a balance zone.
  *
- * \param[in]     scalar_name         scalar name
- * \param[in]     n_cells_sel         number of selected cells
- * \param[in]     cell_sel_ids        ids of selected cells
- * \param[out]    balance             array of computed balance terms
- *                                    (see \ref cs_balance_term_t)
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   bz           <-> pointer to balance zone structure
+ *   n_cells_sel  <-- number of selected cells
+ *   cell_sel_ids <-- ids of selected cells
+ *----------------------------------------------------------------------------*/
 
-void
-cs_balance_by_zone_compute(const char      *scalar_name,
-                           cs_lnum_t        n_cells_sel,
-                           const cs_lnum_t  cell_sel_ids[],
-                           cs_real_t        balance[CS_BALANCE_N_TERMS])
+static void
+_balance_zone_build(cs_balance_by_zone_t  *bz,
+                    cs_lnum_t              n_cells_sel,
+                    const cs_lnum_t        cell_sel_ids[])
 {
-  int idtvar = cs_glob_time_step_options->idtvar;
-
   const cs_mesh_t *m = cs_glob_mesh;
-  cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
-
   const cs_halo_t  *halo = m->halo;
 
-  const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const cs_lnum_t n_i_faces = m->n_i_faces;
   const cs_lnum_t n_b_faces = m->n_b_faces;
@@ -780,62 +822,186 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     = (const cs_lnum_2_t *)m->i_face_cells;
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *)m->b_face_cells;
-  const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict i_dist = fvq->i_dist;
-  const cs_real_t *restrict b_face_surf = fvq->b_face_surf;
-  const cs_real_t *restrict cell_vol = fvq->cell_vol;
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *)fvq->cell_cen;
-  const cs_real_3_t *restrict i_face_u_normal
-    = (const cs_real_3_t *)fvq->i_face_u_normal;
-  const cs_real_3_t *restrict i_face_cog
-    = (const cs_real_3_t *)fvq->i_face_cog;
-  const cs_real_3_t *restrict diipf
-    = (const cs_real_3_t *)fvq->diipf;
-  const cs_real_3_t *restrict djjpf
-    = (const cs_real_3_t *)fvq->djjpf;
-  const cs_real_3_t *restrict diipb
-    = (const cs_real_3_t *)fvq->diipb;
 
-  const int *bc_type = cs_glob_bc_type;
+  bz->n_cells_ext = n_cells_ext;
+  bz->n_i_faces_m = n_i_faces;
+  bz->n_b_faces_m = n_b_faces;
 
-  /* Parallel or device dispatch */
-  cs_dispatch_context ctx;
-  ctx.set_use_gpu(false);  /* balance_by_zone case not ported to GPU */
+  bz->n_cells = n_cells_sel;
+  BFT_MALLOC(bz->cell_ids, n_cells_sel, cs_lnum_t);
+  memcpy(bz->cell_ids, cell_sel_ids, n_cells_sel*sizeof(cs_lnum_t));
 
-  /* initialize output */
+  /* Synchronization for parallelism */
+  BFT_MALLOC(bz->cells_tag_ids, n_cells_ext, cs_lnum_t);
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    bz->cells_tag_ids[c_id] = 0;
+  }
+  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
+    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
+    bz->cells_tag_ids[c_id_sel] = 1;
+  }
+  if (halo != NULL) {
+    cs_halo_sync_num(halo, CS_HALO_STANDARD, bz->cells_tag_ids);
+  }
 
-  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
-    balance[i] = 0;
+  const cs_lnum_t *cells_tag_ids = bz->cells_tag_ids;
 
-  /* all boundary convective fluxes are upwind */
-  int icvflb = 0; // TODO handle total energy balance
-  int icvflf = 0;
+  /* Classify mesh faces with respect to the selected zone */
 
-  /* Get physical fields */
-  const cs_real_t *dt = CS_F_(dt)->val;
-  const cs_real_t *rho = CS_F_(rho)->val;
-  const cs_field_t *f = cs_field_by_name_try(scalar_name);
-  const int field_id = cs_field_id_by_name(scalar_name);
+  /* Check boundary faces:
+     if they are in the selected zone, they are boundary as well */
 
-  /* If the requested scalar field is not computed, return */
-  if (field_id == -1) {
-    bft_printf("Scalar field does not exist. Balance will not be computed.\n");
-    return;
+  bz->n_bb_faces = 0;
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (cells_tag_ids[b_face_cells[f_id]] == 1)
+      bz->n_bb_faces++;
   }
 
-  /* Get the calculation option from the field */
-  const cs_equation_param_t *eqp = cs_field_get_equation_param_const(f);
+  BFT_MALLOC(bz->bb_face_ids, bz->n_bb_faces, cs_lnum_t);
 
-  cs_real_t *pvar_local = NULL;
-  cs_real_t *pvar_distant = NULL;
-  cs_real_t  hint, rcodcl2, heq;
+  bz->n_bb_faces = 0;
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (cells_tag_ids[b_face_cells[f_id]] == 1)
+      bz->bb_face_ids[bz->n_bb_faces++] = f_id;
+  }
 
-  const cs_lnum_t *faces_local = NULL;
-  cs_lnum_t  n_local = 0;
-  cs_lnum_t  n_distant = 0;
-  const cs_lnum_t *faces_distant = NULL;
-  cs_internal_coupling_t *cpl = NULL;
+  /* Check internal faces:
+     if they are in the selected zone, they can be either
+     internal or boundary faces of the zone */
+
+  bz->n_i_faces = 0;
+  bz->n_bi_faces = 0;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    int n_in =   cells_tag_ids[i_face_cells[f_id][0]]
+               + cells_tag_ids[i_face_cells[f_id][1]];
+    if (n_in == 2)
+      bz->n_i_faces++;
+    else if (n_in == 1)
+      bz->n_bi_faces++;
+  }
+
+  BFT_MALLOC(bz->i_face_ids, bz->n_i_faces, cs_lnum_t);
+  BFT_MALLOC(bz->bi_face_ids, bz->n_bi_faces, cs_lnum_t);
+  BFT_MALLOC(bz->bi_face_side, bz->n_bi_faces, short int);
+
+  bz->n_i_faces = 0;
+  bz->n_bi_faces = 0;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    bool indic1 = (cells_tag_ids[i_face_cells[f_id][0]] == 1);
+    bool indic2 = (cells_tag_ids[i_face_cells[f_id][1]] == 1);
+
+    if (indic1 && indic2)
+      bz->i_face_ids[bz->n_i_faces++] = f_id;
+
+    else if (indic1 || indic2) {
+      /* Orientation: 0 if the face normal is outgoing from the zone
+         (first cell inside), 1 if it is reversed */
+      bz->bi_face_ids[bz->n_bi_faces] = f_id;
+      bz->bi_face_side[bz->n_bi_faces] = (indic1) ? 0 : 1;
+      bz->n_bi_faces++;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free arrays of a balance zone.
+ *
+ * parameters:
+ *   bz  <-> pointer to balance zone structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_balance_zone_clear(cs_balance_by_zone_t  *bz)
+{
+  BFT_FREE(bz->cell_ids);
+  BFT_FREE(bz->cells_tag_ids);
+  BFT_FREE(bz->i_face_ids);
+  BFT_FREE(bz->bi_face_ids);
+  BFT_FREE(bz->bi_face_side);
+  BFT_FREE(bz->bb_face_ids);
+}
+
+/*----------------------------------------------------------------------------
+ * Free per-scalar data arrays.
+ *
+ * parameters:
+ *   sd  <-> pointer to scalar balance data
+ *----------------------------------------------------------------------------*/
+
+static void
+_scalar_data_clear(_balance_scalar_data_t  *sd)
+{
+  if (sd->cpro_cp_owner)
+    BFT_FREE(sd->cpro_cp);
+  sd->cpro_cp = NULL;
+
+  BFT_FREE(sd->grad);
+  BFT_FREE(sd->gradup);
+  BFT_FREE(sd->gradst);
+  BFT_FREE(sd->local_max);
+  BFT_FREE(sd->local_min);
+  BFT_FREE(sd->courant);
+  BFT_FREE(sd->i_visc);
+  BFT_FREE(sd->b_visc);
+
+  sd->nt = -2;
+}
+
+/*----------------------------------------------------------------------------
+ * Return per-scalar data (specific heat, gradients, limiter data, and face
+ * viscosity) used for the balance of a given field, computing it if not
+ * already done for the current time step.
+ *
+ * This data is independent of the zone, so it is shared by the
+ * balances of all zones for a given field and time step.
+ *
+ * parameters:
+ *   f      <-- pointer to field
+ *   ctx    <-- reference to dispatch context
+ *
+ * returns:
+ *   pointer to scalar balance data
+ *----------------------------------------------------------------------------*/
+
+static const _balance_scalar_data_t *
+_scalar_data_get(const cs_field_t      *f,
+                 cs_dispatch_context   &ctx)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const int nt_cur = cs_glob_time_step->nt_cur;
+  const int field_id = f->id;
+
+  if (field_id >= _n_scalar_data) {
+    BFT_REALLOC(_scalar_data, field_id + 1, _balance_scalar_data_t);
+    for (int i = _n_scalar_data; i < field_id + 1; i++) {
+      _balance_scalar_data_t *sd = _scalar_data + i;
+      memset(sd, 0, sizeof(_balance_scalar_data_t));
+      sd->nt = -2;
+    }
+    _n_scalar_data = field_id + 1;
+  }
+
+  _balance_scalar_data_t *sd = _scalar_data + field_id;
+
+  if (sd->nt == nt_cur && sd->n_cells_ext == n_cells_ext)
+    return sd;
+
+  _scalar_data_clear(sd);
+
+  sd->nt = nt_cur;
+  sd->n_cells_ext = n_cells_ext;
+
+  /* Get the calculation option from the field */
+  const cs_equation_param_t *eqp = cs_field_get_equation_param_const(f);
 
   /* Temperature indicator.
      Will multiply by CP in order to have energy. */
@@ -843,194 +1009,86 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     = cs_field_get_key_int(f, cs_field_key_id("is_temperature"));
 
   /* Specific heat (CP) */
-  cs_real_t *cpro_cp = NULL;
   const int icp = cs_field_id_by_name("specific_heat");
+  sd->cpro_cp_owner = true;
   if (itemperature) {
-    if (icp != -1)
-      cpro_cp = CS_F_(cp)->val;
+    if (icp != -1) {
+      sd->cpro_cp = CS_F_(cp)->val;
+      sd->cpro_cp_owner = false;
+    }
     else {
       const double cp0 = cs_glob_fluid_properties->cp0;
-      BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
+      BFT_MALLOC(sd->cpro_cp, n_cells, cs_real_t);
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        cpro_cp[c_id] = cp0;
+        sd->cpro_cp[c_id] = cp0;
       }
     }
   }
   else {
-    BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
+    BFT_MALLOC(sd->cpro_cp, n_cells, cs_real_t);
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cpro_cp[c_id] = 1.;
+      sd->cpro_cp[c_id] = 1.;
     }
   }
 
-  /* Internal coupling initialization*/
-  if (eqp->icoupl > 0) {
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
-    const int coupling_id = cs_field_get_key_int(f, coupling_key_id);
-    cpl = cs_internal_coupling_by_id(coupling_id);
-    cs_internal_coupling_coupled_faces(cpl,
-                                       &n_local,
-                                       &faces_local,
-                                       &n_distant,
-                                       &faces_distant);
-  }
+  const cs_real_t *cpro_cp = sd->cpro_cp;
 
-  /* Zone cells selection variables*/
-  cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = NULL;
-  cs_lnum_t n_bb_faces_sel = 0;
-  cs_lnum_t *bb_face_sel_ids = NULL;
-  cs_lnum_t n_bi_faces_sel = 0;
-  cs_lnum_t *bi_face_sel_ids = NULL;
-  cs_lnum_2_t *bi_face_cells = NULL;
-  cs_lnum_t *cells_tag_ids = NULL;
+  /* Convective mass fluxes for inner and boundary faces */
+  int iflmas = cs_field_get_key_int(f, cs_field_key_id("inner_mass_flux_id"));
+  const cs_real_t *i_mass_flux = cs_field_by_id(iflmas)->val;
 
-  cs_real_t *local_min = NULL;
-  cs_real_t *local_max = NULL;
-  cs_real_t *courant = NULL;
+  int iflmab = cs_field_get_key_int(f, cs_field_key_id("boundary_mass_flux_id"));
+  const cs_real_t *b_mass_flux = cs_field_by_id(iflmab)->val;
 
-  cs_real_t *cv_limiter = NULL;
-  cs_real_t *df_limiter = NULL;
+  /* Choose gradient type */
 
-  const int key_lim_choice = cs_field_key_id("limiter_choice");
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
-  /* Initialize balance contributions
-    ---------------------------------
+  const int imrgra = eqp->imrgra;
+  cs_gradient_type_by_imrgra(imrgra,
+                             &gradient_type,
+                             &halo_type);
 
-    vol_balance   : volume contribution of unsteady terms
-    div_balance   : volume contribution due to to term in div(rho u)
-    mass_i_balance: contribution from mass injections
-    mass_o_balance: contribution from mass suctions
-    bi_i_balance  : contribution from inlet boundary faces of the selected zone
-                    which are internal in the total mesh
-    bi_o_balance  : contribution from outlet boundary faces of the selected zone
-                    which are internal in the total mesh
-    in_balance    : contribution from inlets
-    out_balance   : contribution from outlets
-    sym_balance   : contribution from symmetry boundaries
-    s_wall_balance: contribution from smooth walls
-    r_wall_balance: contribution from rough walls
-    cpl_balance   : contribution from coupled faces
-    i_cpl_balance : contribution from internal coupled faces
-    ndef_balance  : contribution from undefined faces
-    tot_balance   : total balance */
+  /* Limiters */
 
-  double vol_balance = 0.;
-  double tot_vol_balance2 = 0.;
-  double div_balance = 0.;
-  double mass_i_balance = 0.;
-  double mass_o_balance = 0.;
-  double bi_i_balance = 0.;
-  double bi_o_balance = 0.;
-  double in_balance = 0.;
-  double out_balance = 0.;
-  double sym_balance = 0.;
-  double s_wall_balance = 0.;
-  double r_wall_balance = 0.;
-  double cpl_balance = 0.;
-  double i_cpl_balance = 0.;
-  double ndef_balance = 0.;
-
-  /* Boundary condition coefficient for h */
-  const cs_real_t *a_F = f->bc_coeffs->a;
-  const cs_real_t *b_F = f->bc_coeffs->b;
-  const cs_real_t *af_F = f->bc_coeffs->af;
-  const cs_real_t *bf_F = f->bc_coeffs->bf;
-
-  /* Convective mass fluxes for inner and boundary faces */
-  int iflmas = cs_field_get_key_int(f, cs_field_key_id("inner_mass_flux_id"));
-  const cs_real_t *i_mass_flux = cs_field_by_id(iflmas)->val;
-
-  int iflmab = cs_field_get_key_int(f, cs_field_key_id("boundary_mass_flux_id"));
-  const cs_real_t *b_mass_flux = cs_field_by_id(iflmab)->val;
-
-  /* Choose gradient type */
-
-  cs_halo_type_t halo_type = CS_HALO_STANDARD;
-  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
-
-  const int imrgra = eqp->imrgra;
-  cs_gradient_type_by_imrgra(imrgra,
-                             &gradient_type,
-                             &halo_type);
-
-  /* Limiters */
-
-  int limiter_choice = -1;
-  int ischcp = eqp->ischcv;
-  if (field_id != -1) {
-    f = cs_field_by_id(field_id);
+  const int key_lim_choice = cs_field_key_id("limiter_choice");
 
-    /* NVD/TVD limiters */
-    if (ischcp == 4) {
-      limiter_choice = cs_field_get_key_int(f, key_lim_choice);
-      BFT_MALLOC(local_max, n_cells_ext, cs_real_t);
-      BFT_MALLOC(local_min, n_cells_ext, cs_real_t);
-      cs_field_local_extrema_scalar(field_id,
-                                    halo_type,
-                                    local_max,
-                                    local_min);
-      if (limiter_choice >= CS_NVD_VOF_HRIC) {
-        BFT_MALLOC(courant, n_cells_ext, cs_real_t);
-        cs_cell_courant_number(f, ctx, courant);
-      }
+  sd->limiter_choice = -1;
+
+  /* NVD/TVD limiters */
+  if (eqp->ischcv == 4) {
+    sd->limiter_choice = cs_field_get_key_int(f, key_lim_choice);
+    BFT_MALLOC(sd->local_max, n_cells_ext, cs_real_t);
+    BFT_MALLOC(sd->local_min, n_cells_ext, cs_real_t);
+    cs_field_local_extrema_scalar(field_id,
+                                  halo_type,
+                                  sd->local_max,
+                                  sd->local_min);
+    if (sd->limiter_choice >= CS_NVD_VOF_HRIC) {
+      BFT_MALLOC(sd->courant, n_cells_ext, cs_real_t);
+      cs_cell_courant_number(f, ctx, sd->courant);
     }
-
-    int cv_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
-    if (cv_limiter_id > -1)
-      cv_limiter = cs_field_by_id(cv_limiter_id)->val;
-
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
-    if (df_limiter_id > -1)
-      df_limiter = cs_field_by_id(df_limiter_id)->val;
   }
 
-  /* Allocate temporary array */
-  cs_real_t *f_reconstructed;
-  BFT_MALLOC(f_reconstructed, n_b_faces, cs_real_t);
-
   /* Reconstructed value */
-  cs_real_3_t *grad;
-  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(sd->grad, n_cells_ext, cs_real_3_t);
 
   halo_type = CS_HALO_STANDARD;
   cs_field_gradient_scalar(f,
                            true, /* use_previous_t */
                            1, /* inc */
-                           grad);
-
-  if (false) { //FIXME
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id]
-                               + grad[c_id][0]*diipb[f_id][0]
-                               + grad[c_id][1]*diipb[f_id][1]
-                               + grad[c_id][2]*diipb[f_id][2];
-    }
-
-  /* Non-reconstructed value */
-  } else {
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-      /* Associated boundary cell */
-      cs_lnum_t c_id = b_face_cells[f_id];
-      f_reconstructed[f_id] = f->val[c_id];
-    }
-  }
+                           sd->grad);
 
   int inc = 1;
 
   /* Compute the gradient for convective scheme (the slope test, limiter, SOLU, etc) */
-  cs_real_3_t *gradup = NULL;
-  cs_real_3_t *gradst = NULL;
   if (eqp->blencv > 0 && eqp->isstpc == 0) {
-    BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
+    BFT_MALLOC(sd->gradst, n_cells_ext, cs_real_3_t);
     for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradst[c_id][0] = 0.;
-      gradst[c_id][1] = 0.;
-      gradst[c_id][2] = 0.;
+      sd->gradst[c_id][0] = 0.;
+      sd->gradst[c_id][1] = 0.;
+      sd->gradst[c_id][2] = 0.;
     }
     /* Slope test gradient */
     if (eqp->iconv > 0)
@@ -1038,8 +1096,8 @@ cs_balance_by_zone_compute(const char      *scalar_name,
                              ctx,
                              inc,
                              halo_type,
-                             (const cs_real_3_t *)grad,
-                             gradst,
+                             (const cs_real_3_t *)sd->grad,
+                             sd->gradst,
                              f->val,
                              f->bc_coeffs,
                              i_mass_flux);
@@ -1049,11 +1107,11 @@ cs_balance_by_zone_compute(const char      *scalar_name,
      or Roe and Sweby limiters */
   if (eqp->blencv > 0
       && (eqp->ischcv==2 || eqp->ischcv==4)) {
-    BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
+    BFT_MALLOC(sd->gradup, n_cells_ext, cs_real_3_t);
     for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-      gradup[c_id][0] = 0.;
-      gradup[c_id][1] = 0.;
-      gradup[c_id][2] = 0.;
+      sd->gradup[c_id][0] = 0.;
+      sd->gradup[c_id][1] = 0.;
+      sd->gradup[c_id][2] = 0.;
     }
 
     if (eqp->iconv > 0)
@@ -1065,16 +1123,14 @@ cs_balance_by_zone_compute(const char      *scalar_name,
                          i_mass_flux,
                          b_mass_flux,
                          f->val,
-                         gradup);
+                         sd->gradup);
 
   }
 
   /* Face viscosity */
   int imvisf = eqp->imvisf;
-  cs_real_t *i_visc;
-  cs_real_t *b_visc;
-  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
+  BFT_MALLOC(sd->i_visc, n_i_faces, cs_real_t);
+  BFT_MALLOC(sd->b_visc, n_b_faces, cs_real_t);
 
   cs_real_t *c_visc = NULL;
   BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
@@ -1102,94 +1158,206 @@ cs_balance_by_zone_compute(const char      *scalar_name,
       c_visc[c_id] += cpro_cp[c_id] * c_visct[c_id]/turb_schmidt;
   }
 
-  cs_face_viscosity(m, fvq, imvisf, c_visc, i_visc, b_visc);
+  cs_face_viscosity(m, fvq, imvisf, c_visc, sd->i_visc, sd->b_visc);
 
-  /* Get user-selected zone
-     ====================== */
+  BFT_FREE(c_visc);
 
-  /* Initialize arrays */
+  return sd;
+}
 
-  /* Internal faces of the selected zone */
-  BFT_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
-  /* Boundary faces of the selected zone,
-     which are internal faces of the global mesh.
-     Faces -> cells connectivity */
-  BFT_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
-  BFT_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    i_face_sel_ids[f_id] = -1;
-    bi_face_sel_ids[f_id] = -1;
-    bi_face_cells[f_id][0] = -999;
-    bi_face_cells[f_id][1] = -999;
-  }
+/*----------------------------------------------------------------------------
+ * Compute the different terms of the balance of a given scalar on a zone.
+ *
+ * parameters:
+ *   bz           <-- pointer to balance zone structure
+ *   scalar_name  <-- scalar name
+ *   balance      --> array of computed balance terms
+ *----------------------------------------------------------------------------*/
 
-  /* Boundary faces of the selected zone,
-     which are also boundary faces of the global mesh */
-  BFT_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-    bb_face_sel_ids[f_id] = -1;
-  }
+static void
+_balance_zone_compute(const cs_balance_by_zone_t  *bz,
+                      const char                  *scalar_name,
+                      cs_real_t                    balance[CS_BALANCE_N_TERMS])
+{
+  int idtvar = cs_glob_time_step_options->idtvar;
 
-  /* Synchronization for parallelism */
-  BFT_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    cells_tag_ids[c_id] = 0;
-  }
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
-    cells_tag_ids[c_id_sel] = 1;
-  }
-  if (halo != NULL) {
-    cs_halo_sync_num(halo, halo_type, cells_tag_ids);
-  }
+  const cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
 
-  /* Classify mesh faces with respect to the selected zone */
+  const cs_lnum_t n_cells = m->n_cells;
 
-  /* Check boundary faces:
-     if they are in the selected zone, they are boundary as well */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *)m->b_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict b_face_surf = fvq->b_face_surf;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_u_normal
+    = (const cs_real_3_t *)fvq->i_face_u_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *)fvq->djjpf;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *)fvq->diipb;
 
-    cs_lnum_t c_id = b_face_cells[f_id];
+  const int *bc_type = cs_glob_bc_type;
 
-    if (cells_tag_ids[c_id] == 1) {
-      n_bb_faces_sel++;
-      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
-    }
+  /* Parallel or device dispatch */
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);  /* balance_by_zone case not ported to GPU */
+
+  /* initialize output */
+
+  for (int i = 0; i < CS_BALANCE_N_TERMS; i++)
+    balance[i] = 0;
+
+  /* all boundary convective fluxes are upwind */
+  int icvflb = 0; // TODO handle total energy balance
+  int icvflf = 0;
+
+  /* Get physical fields */
+  const cs_real_t *dt = CS_F_(dt)->val;
+  const cs_real_t *rho = CS_F_(rho)->val;
+  const cs_field_t *f = cs_field_by_name_try(scalar_name);
+
+  /* If the requested scalar field is not computed, return */
+  if (f == NULL) {
+    bft_printf("Scalar field does not exist. Balance will not be computed.\n");
+    return;
   }
 
-  /* Check internal faces:
-     if they are in the selected zone, they can be either
-     internal or boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  /* Get the calculation option from the field */
+  const cs_equation_param_t *eqp = cs_field_get_equation_param_const(f);
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+  /* Zone-independent data (shared by all zones at a given time step) */
+
+  const _balance_scalar_data_t *sd = _scalar_data_get(f, ctx);
+
+  const cs_real_t *cpro_cp = sd->cpro_cp;
+  const cs_real_3_t *grad = sd->grad;
+  const cs_real_3_t *gradup = sd->gradup;
+  const cs_real_3_t *gradst = sd->gradst;
+  const cs_real_t *local_max = sd->local_max;
+  const cs_real_t *local_min = sd->local_min;
+  const cs_real_t *courant = sd->courant;
+  const cs_real_t *i_visc = sd->i_visc;
+  const cs_real_t *b_visc = sd->b_visc;
+  const int limiter_choice = sd->limiter_choice;
+
+  /* Zone selection */
+
+  const cs_lnum_t n_cells_sel = bz->n_cells;
+  const cs_lnum_t *cell_sel_ids = bz->cell_ids;
+  const cs_lnum_t *cells_tag_ids = bz->cells_tag_ids;
+  const cs_lnum_t n_i_faces_sel = bz->n_i_faces;
+  const cs_lnum_t *i_face_sel_ids = bz->i_face_ids;
+  const cs_lnum_t n_bi_faces_sel = bz->n_bi_faces;
+  const cs_lnum_t *bi_face_sel_ids = bz->bi_face_ids;
+  const short int *bi_face_side = bz->bi_face_side;
+  const cs_lnum_t n_bb_faces_sel = bz->n_bb_faces;
+  const cs_lnum_t *bb_face_sel_ids = bz->bb_face_ids;
 
-    bool indic1 = false;
-    bool indic2 = false;
+  cs_real_t *pvar_local = NULL;
+  cs_real_t *pvar_distant = NULL;
+  cs_real_t  hint, rcodcl2, heq;
 
-    if (cells_tag_ids[c_id1] == 1)
-      indic1 = true;
-    if (cells_tag_ids[c_id2] == 1)
-      indic2 = true;
+  const cs_lnum_t *faces_local = NULL;
+  cs_lnum_t  n_local = 0;
+  cs_lnum_t  n_distant = 0;
+  const cs_lnum_t *faces_distant = NULL;
+  cs_internal_coupling_t *cpl = NULL;
 
-    if (indic1 && indic2) {
-      n_i_faces_sel++;
-      i_face_sel_ids[n_i_faces_sel-1] = f_id;
-    }
-    else if (indic1 || indic2) {
-      bi_face_sel_ids[n_bi_faces_sel] = f_id;
-      n_bi_faces_sel++;
-      /* Build the faces -> cells connectivity as done in
-         i_face_cells */
-      if (indic1)
-        bi_face_cells[f_id][0] = c_id1;
-      else
-        bi_face_cells[f_id][1] = c_id2;
-    }
+  /* Temperature indicator.
+     Will multiply by CP in order to have energy. */
+  const int itemperature
+    = cs_field_get_key_int(f, cs_field_key_id("is_temperature"));
 
+  const int icp = cs_field_id_by_name("specific_heat");
+
+  /* Internal coupling initialization*/
+  if (eqp->icoupl > 0) {
+    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    const int coupling_id = cs_field_get_key_int(f, coupling_key_id);
+    cpl = cs_internal_coupling_by_id(coupling_id);
+    cs_internal_coupling_coupled_faces(cpl,
+                                       &n_local,
+                                       &faces_local,
+                                       &n_distant,
+                                       &faces_distant);
   }
 
+  const cs_real_t *cv_limiter = NULL;
+  const cs_real_t *df_limiter = NULL;
+
+  int cv_limiter_id =
+    cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
+  if (cv_limiter_id > -1)
+    cv_limiter = cs_field_by_id(cv_limiter_id)->val;
+
+  int df_limiter_id =
+    cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+  if (df_limiter_id > -1)
+    df_limiter = cs_field_by_id(df_limiter_id)->val;
+
+  /* Initialize balance contributions
+    ---------------------------------
+
+    vol_balance   : volume contribution of unsteady terms
+    div_balance   : volume contribution due to to term in div(rho u)
+    mass_i_balance: contribution from mass injections
+    mass_o_balance: contribution from mass suctions
+    bi_i_balance  : contribution from inlet boundary faces of the selected zone
+                    which are internal in the total mesh
+    bi_o_balance  : contribution from outlet boundary faces of the selected zone
+                    which are internal in the total mesh
+    in_balance    : contribution from inlets
+    out_balance   : contribution from outlets
+    sym_balance   : contribution from symmetry boundaries
+    s_wall_balance: contribution from smooth walls
+    r_wall_balance: contribution from rough walls
+    cpl_balance   : contribution from coupled faces
+    i_cpl_balance : contribution from internal coupled faces
+    ndef_balance  : contribution from undefined faces
+    tot_balance   : total balance */
+
+  double vol_balance = 0.;
+  double tot_vol_balance2 = 0.;
+  double div_balance = 0.;
+  double mass_i_balance = 0.;
+  double mass_o_balance = 0.;
+  double bi_i_balance = 0.;
+  double bi_o_balance = 0.;
+  double in_balance = 0.;
+  double out_balance = 0.;
+  double sym_balance = 0.;
+  double s_wall_balance = 0.;
+  double r_wall_balance = 0.;
+  double cpl_balance = 0.;
+  double i_cpl_balance = 0.;
+  double ndef_balance = 0.;
+
+  /* Boundary condition coefficient for h */
+  const cs_real_t *a_F = f->bc_coeffs->a;
+  const cs_real_t *b_F = f->bc_coeffs->b;
+  const cs_real_t *af_F = f->bc_coeffs->af;
+  const cs_real_t *bf_F = f->bc_coeffs->bf;
+
+  /* Convective mass fluxes for inner and boundary faces */
+  int iflmas = cs_field_get_key_int(f, cs_field_key_id("inner_mass_flux_id"));
+  const cs_real_t *i_mass_flux = cs_field_by_id(iflmas)->val;
+
+  int iflmab = cs_field_get_key_int(f, cs_field_key_id("boundary_mass_flux_id"));
+  const cs_real_t *b_mass_flux = cs_field_by_id(iflmab)->val;
+
+  int ischcp = eqp->ischcv;
+
   /* Compute the balance at time step n
     ===================================
 
@@ -1240,15 +1408,15 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
     cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
     /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = bi_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = bi_face_cells[f_id_sel][1];
+    cs_lnum_t c_id1 = i_face_cells[f_id_sel][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id_sel][1];
 
     /* Contribution to flux from the only cell of the current face
        lying inside the selected zone
       (The cell is counted only once in parallel by checking that
        the c_id is not in the halo) */
 
-    if (c_id1 >= 0) {
+    if (bi_face_side[f_id] == 0) {
 
       if (c_id1 < n_cells)
         div_balance += i_mass_flux[f_id_sel] * dt[c_id1] * f->val[c_id1]
@@ -1276,7 +1444,6 @@ cs_balance_by_zone_compute(const char      *scalar_name,
                    * cpro_cp[c_id];
 
   }
-
   /* Mass source terms and mass accumulation term.
      In case of a mass source term, add contribution from Gamma*Tn+1 */
 
@@ -1573,8 +1740,8 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
     /* (The cell is counted only once in parallel by checking that
        the c_id is not in the halo) */
-    /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
+    /* Face normal well oriented (check bi_face_side array) */
+    if (bi_face_side[f_id] == 0) {
       if (c_id1 < n_cells) {
         if (i_mass_flux[f_id_sel] > 0)
           bi_o_balance -= bi_bterms[0]*dt[c_id1];
@@ -1594,28 +1761,6 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   }
 
-  /* Free memory */
-
-  BFT_FREE(grad);
-  BFT_FREE(gradup);
-  BFT_FREE(gradst);
-  BFT_FREE(f_reconstructed);
-  BFT_FREE(local_max);
-  BFT_FREE(local_min);
-  BFT_FREE(courant);
-
-  if (!itemperature || icp == -1)
-    BFT_FREE(cpro_cp);
-  BFT_FREE(c_visc);
-  BFT_FREE(i_visc);
-  BFT_FREE(b_visc);
-
-  BFT_FREE(cells_tag_ids);
-  BFT_FREE(bi_face_cells);
-  BFT_FREE(i_face_sel_ids);
-  BFT_FREE(bb_face_sel_ids);
-  BFT_FREE(bi_face_sel_ids);
-
   /* Sum of values on all ranks (parallel calculations) */
 
   balance[CS_BALANCE_TOTAL_NORMALIZED] = tot_vol_balance2; /* temporary */
@@ -1658,6 +1803,128 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     balance[CS_BALANCE_TOTAL_NORMALIZED] /= sqrt(tot_vol_balance2);
 }
 
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a balance zone from a list of selected cells.
+ *
+ * Face lists bounding the zone are built once, so that balances of
+ * several scalars or at several time steps can be computed on this zone
+ * without reclassifying mesh faces.
+ *
+ * The zone must be rebuilt if the mesh is modified.
+ *
+ * \param[in]  n_cells_sel   number of selected cells
+ * \param[in]  cell_sel_ids  ids of selected cells
+ *
+ * \return  pointer to created balance zone structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_balance_by_zone_t *
+cs_balance_by_zone_create(cs_lnum_t        n_cells_sel,
+                          const cs_lnum_t  cell_sel_ids[])
+{
+  cs_balance_by_zone_t *bz = NULL;
+  BFT_MALLOC(bz, 1, cs_balance_by_zone_t);
+
+  bz->criteria = NULL;
+  _balance_zone_build(bz, n_cells_sel, cell_sel_ids);
+
+  return bz;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a balance zone.
+ *
+ * \param[in, out]  bz  pointer to balance zone structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_destroy(cs_balance_by_zone_t  **bz)
+{
+  if (bz == NULL || *bz == NULL)
+    return;
+
+  cs_balance_by_zone_t *_bz = *bz;
+
+  _balance_zone_clear(_bz);
+  BFT_FREE(_bz->criteria);
+  BFT_FREE(*bz);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the different terms of the balance of a given scalar,
+ *        on a previously created balance zone.
+ *
+ * Gradients and face viscosities of the scalar are computed only once per
+ * time step, and shared by the balances on all zones.
+ *
+ * \param[in]     bz                  pointer to balance zone structure
+ * \param[in]     scalar_name         scalar name
+ * \param[out]    balance             array of computed balance terms
+ *                                    (see \ref cs_balance_term_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_compute_zone(const cs_balance_by_zone_t  *bz,
+                                const char                  *scalar_name,
+                                cs_real_t  balance[CS_BALANCE_N_TERMS])
+{
+  _balance_zone_compute(bz, scalar_name, balance);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the different terms of the balance of a given scalar,
+ *        on a volume zone defined by selected cell ids/
+ *
+ * This function computes the balance relative to a given scalar
+ * on a selected zone of the mesh.
+ * We assume that we want to compute balances (convective and diffusive)
+ * at the boundaries of the calculation domain represented below
+ * (with different boundary types).
+ *
+ * In the case of the temperature, the energy balance in Joules will be
+ * computed by multiplying by the specific heat.
+ *
+ * \param[in]     scalar_name         scalar name
+ * \param[in]     n_cells_sel         number of selected cells
+ * \param[in]     cell_sel_ids        ids of selected cells
+ * \param[out]    balance             array of computed balance terms
+ *                                    (see \ref cs_balance_term_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_compute(const char      *scalar_name,
+                           cs_lnum_t        n_cells_sel,
+                           const cs_lnum_t  cell_sel_ids[],
+                           cs_real_t        balance[CS_BALANCE_N_TERMS])
+{
+  cs_balance_by_zone_t bz;
+
+  bz.criteria = NULL;
+  _balance_zone_build(&bz, n_cells_sel, cell_sel_ids);
+
+  _balance_zone_compute(&bz, scalar_name, balance);
+
+  _balance_zone_clear(&bz);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute and log the different terms of the balance of a given scalar,
@@ -1676,6 +1943,9 @@ cs_balance_by_zone_compute(const char      *scalar_name,
  * In the case of the temperature, the energy balance in Joules will be
  * computed by multiplying by the specific heat.
  *
+ * The zone defined by a given selection criteria is built at the first
+ * call and reused by subsequent calls, as long as the mesh is not modified.
+ *
  * \param[in]     selection_crit      zone selection criterion
  * \param[in]     scalar_name         scalar name
  */
@@ -1690,22 +1960,51 @@ cs_balance_by_zone(const char  *selection_crit,
   const cs_mesh_t *m = cs_glob_mesh;
   const int nt_cur = cs_glob_time_step->nt_cur;
 
-  /* Select cells */
+  /* Find or build zone */
 
-  cs_lnum_t n_cells_sel = 0;
-  cs_lnum_t *cells_sel_ids = NULL;
+  cs_balance_by_zone_t *bz = NULL;
 
-  BFT_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
-  cs_selector_get_cell_list(selection_crit, &n_cells_sel, cells_sel_ids);
+  for (int i = 0; i < _n_zones; i++) {
+    if (strcmp(_zones[i]->criteria, selection_crit) == 0) {
+      bz = _zones[i];
+      break;
+    }
+  }
 
-  /* Compute balance */
+  if (   bz != NULL
+      && (   bz->n_cells_ext != m->n_cells_with_ghosts
+          || bz->n_i_faces_m != m->n_i_faces
+          || bz->n_b_faces_m != m->n_b_faces
+          || m->time_dep > CS_MESH_FIXED)) {
+    _balance_zone_clear(bz);
+    bz->n_cells = -1;
+  }
 
-  cs_balance_by_zone_compute(scalar_name,
-                             n_cells_sel,
-                             cells_sel_ids,
-                             balance);
+  if (bz == NULL) {
+    BFT_REALLOC(_zones, _n_zones + 1, cs_balance_by_zone_t *);
+    BFT_MALLOC(bz, 1, cs_balance_by_zone_t);
+    BFT_MALLOC(bz->criteria, strlen(selection_crit) + 1, char);
+    strcpy(bz->criteria, selection_crit);
+    bz->n_cells = -1;
+    _zones[_n_zones] = bz;
+    _n_zones += 1;
+  }
 
-  BFT_FREE(cells_sel_ids);
+  if (bz->n_cells < 0) {
+    cs_lnum_t n_cells_sel = 0;
+    cs_lnum_t *cells_sel_ids = NULL;
+
+    BFT_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
+    cs_selector_get_cell_list(selection_crit, &n_cells_sel, cells_sel_ids);
+
+    _balance_zone_build(bz, n_cells_sel, cells_sel_ids);
+
+    BFT_FREE(cells_sel_ids);
+  }
+
+  /* Compute balance */
+
+  _balance_zone_compute(bz, scalar_name, balance);
 
   /* Log results at time step n */
 
@@ -1747,6 +2046,27 @@ cs_balance_by_zone(const char  *selection_crit,
      balance[CS_BALANCE_TOTAL], balance[CS_BALANCE_TOTAL_NORMALIZED]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free balance zones defined by selection criteria and cached
+ *        scalar data used for balance computations.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_finalize(void)
+{
+  for (int i = 0; i < _n_zones; i++)
+    cs_balance_by_zone_destroy(&(_zones[i]));
+  BFT_FREE(_zones);
+  _n_zones = 0;
+
+  for (int i = 0; i < _n_scalar_data; i++)
+    _scalar_data_clear(_scalar_data + i);
+  BFT_FREE(_scalar_data);
+  _n_scalar_data = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
@@ -99,10 +99,66 @@ typedef enum {
 
 } cs_balance_p_term_t;
 
+/*! Opaque balance zone structure */
+
+typedef struct _cs_balance_by_zone_t  cs_balance_by_zone_t;
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a balance zone from a list of selected cells.
+ *
+ * Face lists bounding the zone are built once, so that balances of
+ * several scalars or at several time steps can be computed on this zone
+ * without reclassifying mesh faces.
+ *
+ * The zone must be rebuilt if the mesh is modified.
+ *
+ * \param[in]  n_cells_sel   number of selected cells
+ * \param[in]  cell_sel_ids  ids of selected cells
+ *
+ * \return  pointer to created balance zone structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_balance_by_zone_t *
+cs_balance_by_zone_create(cs_lnum_t        n_cells_sel,
+                          const cs_lnum_t  cell_sel_ids[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a balance zone.
+ *
+ * \param[in, out]  bz  pointer to balance zone structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_destroy(cs_balance_by_zone_t  **bz);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the different terms of the balance of a given scalar,
+ *        on a previously created balance zone.
+ *
+ * Gradients and face viscosities of the scalar are computed only once per
+ * time step, and shared by the balances on all zones.
+ *
+ * \param[in]     bz                  pointer to balance zone structure
+ * \param[in]     scalar_name         scalar name
+ * \param[out]    balance             array of computed balance terms
+ *                                    (see \ref cs_balance_term_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_compute_zone(const cs_balance_by_zone_t  *bz,
+                                const char                  *scalar_name,
+                                cs_real_t  balance[CS_BALANCE_N_TERMS]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the different terms of the balance of a given scalar,
@@ -158,6 +214,16 @@ void
 cs_balance_by_zone(const char  *selection_crit,
                    const char  *scalar_name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free balance zones defined by selection criteria and cached
+ *        scalar data used for balance computations.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
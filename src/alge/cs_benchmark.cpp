@@ -88,6 +88,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_benchmark.h"
+#include "cs_benchmark_kernels.h"
 #include "cs_benchmark_matrix.h"
 
 #if defined(HAVE_CUDA)
@@ -1267,6 +1268,8 @@ cs_benchmark(int  mpi_trace_mode)
                            x,
                            y);
 
+  cs_benchmark_kernels(n_time_runs);
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
@@ -0,0 +1,714 @@
+/*============================================================================
+ * Kernel-level micro-benchmarks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C and C++ library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_base_accel.h"
+#include "cs_block_dist.h"
+#include "cs_boundary_conditions.h"
+#include "cs_convection_diffusion.h"
+#include "cs_field.h"
+#include "cs_gradient.h"
+#include "cs_halo.h"
+#include "cs_log.h"
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_parall.h"
+#include "cs_parameters.h"
+#include "cs_part_to_block.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_benchmark_kernels.h"
+
+/*----------------------------------------------------------------------------*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Structure Definitions
+ *============================================================================*/
+
+/* Timing result for a given kernel */
+
+typedef struct {
+
+  char    name[48];   /* kernel name */
+  double  wt;         /* wall-clock time per run (max over ranks) */
+  double  bytes;      /* modeled memory traffic per run (sum over ranks) */
+  double  flops;      /* modeled floating-point operations per run
+                         (sum over ranks) */
+  double  roofline;   /* fraction of roofline bound, or -1 if unknown */
+
+} _kernel_result_t;
+
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+static int               _n_results = 0;
+static int               _n_results_max = 0;
+static _kernel_result_t *_results = nullptr;
+
+static double            _peak_gbs = -1;     /* global peak bandwidth */
+static double            _peak_gflops = -1;  /* global peak flop rate */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Read a per-rank peak value from the environment.
+ *
+ * parameters:
+ *   name <-- environment variable name
+ *
+ * returns:
+ *   peak value summed over ranks, or -1 if undefined
+ *----------------------------------------------------------------------------*/
+
+static double
+_env_peak(const char  *name)
+{
+  double retval = -1;
+
+  const char *s = getenv(name);
+  if (s != nullptr) {
+    double v = atof(s);
+    if (v > 0)
+      retval = v * cs_glob_n_ranks;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize ranks before or after a timed section.
+ *----------------------------------------------------------------------------*/
+
+static void
+_barrier(void)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Return mean wall-clock time of a function over a number of runs.
+ *
+ * A first (untimed) run is done to exclude one-time setup costs.
+ *
+ * parameters:
+ *   n_runs <-- number of timed runs
+ *   f      <-- function to time
+ *
+ * returns:
+ *   mean wall-clock time per run
+ *----------------------------------------------------------------------------*/
+
+template <typename F>
+static double
+_time_runs(int    n_runs,
+           F    &&f)
+{
+  f();
+
+  _barrier();
+  double t0 = cs_timer_wtime();
+
+  for (int run_id = 0; run_id < n_runs; run_id++)
+    f();
+
+  _barrier();
+  double t1 = cs_timer_wtime();
+
+  return (t1 - t0) / n_runs;
+}
+
+/*----------------------------------------------------------------------------
+ * Record and log a kernel timing result.
+ *
+ * parameters:
+ *   name  <-- kernel name
+ *   wt    <-- local wall-clock time per run
+ *   bytes <-- local modeled memory traffic per run
+ *   flops <-- local modeled floating-point operations per run
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_result(const char  *name,
+            double       wt,
+            double       bytes,
+            double       flops)
+{
+  double v[2] = {bytes, flops};
+  cs_parall_sum(2, CS_DOUBLE, v);
+  cs_parall_max(1, CS_DOUBLE, &wt);
+
+  if (_n_results >= _n_results_max) {
+    _n_results_max = CS_MAX(2*_n_results_max, 16);
+    BFT_REALLOC(_results, _n_results_max, _kernel_result_t);
+  }
+
+  _kernel_result_t *r = _results + _n_results;
+  _n_results += 1;
+
+  strncpy(r->name, name, 47);
+  r->name[47] = '\0';
+  r->wt = wt;
+  r->bytes = v[0];
+  r->flops = v[1];
+  r->roofline = -1;
+
+  double gbs = (wt > 0) ? r->bytes / wt * 1e-9 : 0;
+  double gflops = (wt > 0) ? r->flops / wt * 1e-9 : 0;
+
+  /* Roofline bound: min(peak flops, arithmetic intensity * peak bandwidth) */
+
+  if (_peak_gbs > 0 && r->bytes > 0) {
+    double bound = r->flops / r->bytes * _peak_gbs;
+    if (_peak_gflops > 0 && r->flops > 0) {
+      bound = CS_MIN(bound, _peak_gflops);
+      r->roofline = gflops / bound;
+    }
+    else
+      r->roofline = gbs / _peak_gbs;
+  }
+
+  char roof_s[16] = "       -";
+  if (r->roofline >= 0)
+    snprintf(roof_s, 15, "%8.3f", r->roofline);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  %-32s %12.5e %10.3f %10.3f %s\n",
+                r->name, r->wt, gbs, gflops, roof_s);
+}
+
+/*----------------------------------------------------------------------------
+ * Write recorded results to a JSON file (on rank 0).
+ *
+ * parameters:
+ *   path        <-- output file path
+ *   n_time_runs <-- number of timing runs for each measure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_json(const char  *path,
+            int          n_time_runs)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  FILE *f = fopen(path, "w");
+  if (f == nullptr) {
+    bft_printf(_("Warning: unable to open file \"%s\" for writing.\n"), path);
+    return;
+  }
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  fprintf(f, "{\n");
+  fprintf(f, "  \"n_ranks\": %d,\n", cs_glob_n_ranks);
+  fprintf(f, "  \"n_threads\": %d,\n", cs_glob_n_threads);
+  fprintf(f, "  \"n_g_cells\": %llu,\n", (unsigned long long)m->n_g_cells);
+  fprintf(f, "  \"n_g_i_faces\": %llu,\n", (unsigned long long)m->n_g_i_faces);
+  fprintf(f, "  \"n_g_b_faces\": %llu,\n", (unsigned long long)m->n_g_b_faces);
+  fprintf(f, "  \"n_time_runs\": %d,\n", n_time_runs);
+  if (_peak_gbs > 0)
+    fprintf(f, "  \"peak_gbs\": %g,\n", _peak_gbs);
+  else
+    fprintf(f, "  \"peak_gbs\": null,\n");
+  if (_peak_gflops > 0)
+    fprintf(f, "  \"peak_gflops\": %g,\n", _peak_gflops);
+  else
+    fprintf(f, "  \"peak_gflops\": null,\n");
+
+  fprintf(f, "  \"kernels\": [\n");
+
+  for (int i = 0; i < _n_results; i++) {
+    const _kernel_result_t *r = _results + i;
+    double gbs = (r->wt > 0) ? r->bytes / r->wt * 1e-9 : 0;
+    double gflops = (r->wt > 0) ? r->flops / r->wt * 1e-9 : 0;
+    fprintf(f,
+            "    {\"name\": \"%s\", \"time\": %.6e, \"bytes\": %.6e, "
+            "\"flops\": %.6e, \"gbs\": %.6g, \"gflops\": %.6g, ",
+            r->name, r->wt, r->bytes, r->flops, gbs, gflops);
+    if (r->roofline >= 0)
+      fprintf(f, "\"roofline_fraction\": %.6g}", r->roofline);
+    else
+      fprintf(f, "\"roofline_fraction\": null}");
+    fprintf(f, "%s\n", (i < _n_results - 1) ? "," : "");
+  }
+
+  fprintf(f, "  ]\n");
+  fprintf(f, "}\n");
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Time scalar gradient reconstruction of each type.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *   bc_coeffs   <-- boundary condition coefficients
+ *   var         <-> variable values (with ghost cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_bench_gradients(int                          n_time_runs,
+                 const cs_field_bc_coeffs_t  *bc_coeffs,
+                 cs_real_t                    var[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  cs_real_3_t *grad;
+  CS_MALLOC_HD(grad, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+
+  const int n_types = 4;
+  const cs_gradient_type_t types[] = {CS_GRADIENT_GREEN_ITER,
+                                      CS_GRADIENT_LSQ,
+                                      CS_GRADIENT_GREEN_LSQ,
+                                      CS_GRADIENT_GREEN_VTX};
+
+  /* Face-based traffic model: face -> cells connectivity, values,
+     face vector and weight, and gradient contributions to both cells;
+     cell-based gradient update with a 3x3 matrix. */
+
+  const double b_i = 2*sizeof(cs_lnum_t) + 12*sizeof(cs_real_t);
+  const double b_b = sizeof(cs_lnum_t) + 9*sizeof(cs_real_t);
+  const double b_c = 15*sizeof(cs_real_t);
+
+  const double bytes =   b_i*m->n_i_faces + b_b*m->n_b_faces
+                       + b_c*m->n_cells;
+  const double flops = 12.*m->n_i_faces + 8.*m->n_b_faces + 18.*m->n_cells;
+
+  for (int t_id = 0; t_id < n_types; t_id++) {
+
+    /* Use 2 sweeps with a zero tolerance so that the work done by the
+       iterative variant does not depend on convergence. */
+
+    double wt = _time_runs(n_time_runs, [&]() {
+      cs_gradient_scalar("benchmark",
+                         types[t_id],
+                         CS_HALO_STANDARD,
+                         1,                        /* inc */
+                         2,                        /* n_r_sweeps */
+                         0,                        /* hyd_p_flag */
+                         1,                        /* w_stride */
+                         0,                        /* verbosity */
+                         CS_GRADIENT_LIMIT_NONE,
+                         0.,                       /* epsilon */
+                         1.5,                      /* clip_coeff */
+                         nullptr,                  /* f_ext */
+                         bc_coeffs,
+                         var,
+                         nullptr,                  /* c_weight */
+                         nullptr,                  /* cpl */
+                         grad);
+    });
+
+    char name[48];
+    snprintf(name, 47, "gradient_%s", cs_gradient_type_name[types[t_id]]);
+    name[47] = '\0';
+    for (char *p = name; *p != '\0'; p++) {
+      if (*p == ' ' || *p == '-')
+        *p = '_';
+    }
+
+    _add_result(name, wt, bytes, flops);
+  }
+
+  CS_FREE_HD(grad);
+}
+
+/*----------------------------------------------------------------------------
+ * Time explicit convection-diffusion right-hand side computation.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *   bc_coeffs   <-- boundary condition coefficients
+ *   var         <-> variable values (with ghost cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_bench_convection_diffusion(int                          n_time_runs,
+                            const cs_field_bc_coeffs_t  *bc_coeffs,
+                            cs_real_t                    var[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  cs_real_t *i_massflux, *b_massflux, *i_visc, *b_visc, *rhs;
+  CS_MALLOC_HD(i_massflux, n_i_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(i_visc, n_i_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(b_massflux, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(b_visc, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(rhs, n_cells_ext, cs_real_t, cs_alloc_mode);
+
+  const cs_nreal_3_t *i_face_u_normal
+    = cs_glob_mesh_quantities->i_face_u_normal;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    i_massflux[f_id] = i_face_u_normal[f_id][0];
+    i_visc[f_id] = 1.;
+  }
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    b_massflux[f_id] = 0.;
+    b_visc[f_id] = 0.;
+  }
+
+  /* Boundary condition types are not defined yet in benchmark mode */
+
+  const int *bc_type_prev = cs_glob_bc_type;
+  int *bc_type;
+  BFT_MALLOC(bc_type, n_b_faces, int);
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++)
+    bc_type[f_id] = 0;
+  cs_glob_bc_type = bc_type;
+
+  cs_equation_param_t eqp = cs_parameters_equation_param_default();
+  eqp.iconv = 1;
+  eqp.idiff = 1;
+  eqp.ischcv = 1;
+  eqp.isstpc = 1;
+  eqp.blencv = 1.;
+  eqp.ircflu = 1;
+
+  /* Face-based traffic model, excluding the gradient computation:
+     connectivity, mass flux, viscosity, weights and reconstruction
+     vectors, values and gradients of both cells, and right-hand side
+     updates. */
+
+  const double b_i = 2*sizeof(cs_lnum_t) + 23*sizeof(cs_real_t);
+  const double b_b = sizeof(cs_lnum_t) + 15*sizeof(cs_real_t);
+
+  const double bytes = b_i*n_i_faces + b_b*n_b_faces;
+  const double flops = 60.*n_i_faces + 30.*n_b_faces;
+
+  double wt = _time_runs(n_time_runs, [&]() {
+    cs_convection_diffusion_gradient_cache_invalidate(var);
+    cs_convection_diffusion_scalar(0,              /* idtvar */
+                                   -1,             /* f_id */
+                                   eqp,
+                                   0,              /* icvflb */
+                                   1,              /* inc */
+                                   1,              /* imasac */
+                                   var,
+                                   var,
+                                   nullptr,        /* icvfli */
+                                   bc_coeffs,
+                                   i_massflux,
+                                   b_massflux,
+                                   i_visc,
+                                   b_visc,
+                                   rhs);
+  });
+
+  _add_result("convection_diffusion_scalar", wt, bytes, flops);
+
+  cs_convection_diffusion_gradient_cache_invalidate(var);
+
+  cs_glob_bc_type = bc_type_prev;
+  BFT_FREE(bc_type);
+
+  CS_FREE_HD(rhs);
+  CS_FREE_HD(b_visc);
+  CS_FREE_HD(b_massflux);
+  CS_FREE_HD(i_visc);
+  CS_FREE_HD(i_massflux);
+}
+
+/*----------------------------------------------------------------------------
+ * Time halo synchronization for various strides.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *----------------------------------------------------------------------------*/
+
+static void
+_bench_halo(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_halo_t *halo = m->halo;
+
+  if (halo == nullptr)
+    return;
+
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int strides[] = {1, 3, 6, 9};
+
+  cs_real_t *v;
+  CS_MALLOC_HD(v, (size_t)n_cells_ext*9, cs_real_t, cs_alloc_mode);
+
+  for (size_t i = 0; i < (size_t)n_cells_ext*9; i++)
+    v[i] = 1.;
+
+  for (int s_id = 0; s_id < 4; s_id++) {
+
+    const int stride = strides[s_id];
+
+    /* Packed values are read and sent, received values written */
+
+    const double bytes
+      = 2. * (  halo->n_send_elts[CS_HALO_STANDARD]
+              + halo->n_elts[CS_HALO_STANDARD]) * stride * sizeof(cs_real_t);
+
+    double wt = _time_runs(n_time_runs, [&]() {
+      cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, v, stride);
+    });
+
+    char name[48];
+    snprintf(name, 47, "halo_sync_stride_%d", stride);
+
+    _add_result(name, wt, bytes, 0);
+  }
+
+  CS_FREE_HD(v);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Time redistribution of cell values to a block distribution using
+ * all-to-all and part-to-block operators.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *----------------------------------------------------------------------------*/
+
+static void
+_bench_redistribution(int  n_time_runs)
+{
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const int stride = 3;
+
+  const cs_gnum_t *cell_gnum = m->global_cell_num;
+  cs_gnum_t *_cell_gnum = nullptr;
+  if (cell_gnum == nullptr) {
+    BFT_MALLOC(_cell_gnum, n_cells, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      _cell_gnum[i] = i + 1;
+    cell_gnum = _cell_gnum;
+  }
+
+  cs_block_dist_info_t bi
+    = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                  cs_glob_n_ranks,
+                                  1,
+                                  0,
+                                  m->n_g_cells);
+
+  const cs_lnum_t n_block
+    = (cs_lnum_t)(bi.gnum_range[1] - bi.gnum_range[0]);
+
+  cs_real_t *v, *v_block;
+  BFT_MALLOC(v, (size_t)n_cells*stride, cs_real_t);
+  BFT_MALLOC(v_block, (size_t)n_block*stride, cs_real_t);
+
+  for (size_t i = 0; i < (size_t)n_cells*stride; i++)
+    v[i] = 1.;
+
+  /* Values are read and sent, received values written */
+
+  const double bytes = 2. * n_cells * stride * sizeof(cs_real_t);
+
+  /* All-to-all distributor */
+
+  double wt = _time_runs(n_time_runs, [&]() {
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_cells, 0, cell_gnum, bi,
+                                        cs_glob_mpi_comm);
+    cs_all_to_all_destroy(&d);
+  });
+
+  _add_result("all_to_all_create", wt, 0, 0);
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create_from_block(n_cells, 0, cell_gnum, bi,
+                                      cs_glob_mpi_comm);
+
+  wt = _time_runs(n_time_runs, [&]() {
+    cs_real_t *v_dest = cs_all_to_all_copy_array(d, stride, false, v);
+    BFT_FREE(v_dest);
+  });
+
+  cs_all_to_all_destroy(&d);
+
+  _add_result("all_to_all_copy_stride_3", wt, bytes, 0);
+
+  /* Part-to-block distributor */
+
+  wt = _time_runs(n_time_runs, [&]() {
+    cs_part_to_block_t *p
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm, bi, n_cells,
+                                        cell_gnum);
+    cs_part_to_block_destroy(&p);
+  });
+
+  _add_result("part_to_block_create", wt, 0, 0);
+
+  cs_part_to_block_t *p
+    = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm, bi, n_cells,
+                                      cell_gnum);
+
+  wt = _time_runs(n_time_runs, [&]() {
+    cs_part_to_block_copy_array(p, CS_REAL_TYPE, stride, v, v_block);
+  });
+
+  cs_part_to_block_destroy(&p);
+
+  _add_result("part_to_block_copy_stride_3", wt, bytes, 0);
+
+  BFT_FREE(v_block);
+  BFT_FREE(v);
+  BFT_FREE(_cell_gnum);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Time main computational kernels on the global mesh.
+ *
+ * Gradient reconstruction, convection-diffusion right-hand side, halo
+ * synchronization and redistribution operators are timed. Achieved
+ * bandwidth and flop rate (based on simple traffic and operation count
+ * models) are logged and written to "benchmark_kernels.json". If the
+ * CS_BENCHMARK_PEAK_GBS and CS_BENCHMARK_PEAK_GFLOPS environment variables
+ * define per-rank peak values, the fraction of the roofline bound is
+ * also reported.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_kernels(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  _peak_gbs = _env_peak("CS_BENCHMARK_PEAK_GBS");
+  _peak_gflops = _env_peak("CS_BENCHMARK_PEAK_GFLOPS");
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "Timing for computational kernels\n"
+                "================================\n\n"
+                "  %-32s %12s %10s %10s %8s\n",
+                "kernel", "time/run", "GB/s", "GFLOP/s", "roofline");
+
+  /* Linear variable with homogeneous Neumann boundary conditions */
+
+  cs_real_t *var;
+  CS_MALLOC_HD(var, n_cells_ext, cs_real_t, cs_alloc_mode);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    var[i] = mq->cell_cen[i*3] + 2.*mq->cell_cen[i*3 + 1];
+
+  cs_field_bc_coeffs_t bc_coeffs;
+  cs_field_bc_coeffs_init(&bc_coeffs);
+  CS_MALLOC_HD(bc_coeffs.a, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs.b, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs.af, n_b_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(bc_coeffs.bf, n_b_faces, cs_real_t, cs_alloc_mode);
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    bc_coeffs.a[f_id] = 0.;
+    bc_coeffs.b[f_id] = 1.;
+    bc_coeffs.af[f_id] = 0.;
+    bc_coeffs.bf[f_id] = 0.;
+  }
+
+  _bench_gradients(n_time_runs, &bc_coeffs, var);
+
+  _bench_convection_diffusion(n_time_runs, &bc_coeffs, var);
+
+  _bench_halo(n_time_runs);
+
+#if defined(HAVE_MPI)
+  _bench_redistribution(n_time_runs);
+#endif
+
+  _write_json("benchmark_kernels.json", n_time_runs);
+
+  CS_FREE_HD(bc_coeffs.bf);
+  CS_FREE_HD(bc_coeffs.af);
+  CS_FREE_HD(bc_coeffs.b);
+  CS_FREE_HD(bc_coeffs.a);
+  CS_FREE_HD(var);
+
+  BFT_FREE(_results);
+  _n_results = 0;
+  _n_results_max = 0;
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,66 @@
+#ifndef __CS_BENCHMARK_KERNELS_H__
+#define __CS_BENCHMARK_KERNELS_H__
+
+/*============================================================================
+ * Kernel-level micro-benchmarks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Time main computational kernels on the global mesh.
+ *
+ * Gradient reconstruction, convection-diffusion right-hand side, halo
+ * synchronization and redistribution operators are timed. Achieved
+ * bandwidth and flop rate (based on simple traffic and operation count
+ * models) are logged and written to "benchmark_kernels.json". If the
+ * CS_BENCHMARK_PEAK_GBS and CS_BENCHMARK_PEAK_GFLOPS environment variables
+ * define per-rank peak values, the fraction of the roofline bound is
+ * also reported.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each measure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_kernels(int  n_time_runs);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_BENCHMARK_KERNELS_H__ */
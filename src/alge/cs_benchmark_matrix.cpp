@@ -590,6 +590,37 @@ _variant_build_list(int                             n_fill_types,
                  &n_variants_max,
                  m_variant);
 
+    _variant_add("MSR, SELL-C-sigma",
+                 NULL,
+                 CS_MATRIX_MSR,
+                 n_fill_types,
+                 fill_types,
+                 op_flag_ae,
+                 "sell",
+                 NULL,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#if defined(HAVE_CUDA)
+
+    if (cs_get_device_id() > -1)
+      _variant_add("MSR, CUDA SELL-C-sigma",
+                   NULL,
+                   CS_MATRIX_MSR,
+                   n_fill_types,
+                   fill_types,
+                   op_flag_ae,
+                   "cuda_sell",
+                   NULL,
+                   NULL,
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+
+#endif /* defined(HAVE_CUDA) */
+
 #if defined(HAVE_HYPRE)
 
     _variant_add("HYPRE (PARCSR)",
@@ -50,6 +50,7 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_base_accel.h"
 #include "cs_blas.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
@@ -99,6 +100,23 @@ BEGIN_C_DECLS
 typedef  cs_real_t  cs_weight_t;  /* will allow testing single precision
                                      if set to float */
 
+/* Vertex-based (gather) form of the linear regression interpolation,
+   where each vertex value is a weighted sum of adjacent cell and
+   boundary face values */
+
+typedef struct {
+
+  cs_lnum_t    *c_idx;  /* vertex -> cells index (size: n_vertices + 1) */
+  cs_lnum_t    *c_ids;  /* vertex -> cells adjacency */
+  cs_weight_t  *c_w;    /* associated weights */
+
+  cs_lnum_t    *b_idx;  /* vertex -> boundary faces index
+                           (size: n_vertices + 1) */
+  cs_lnum_t    *b_ids;  /* vertex -> boundary faces adjacency */
+  cs_weight_t  *b_w;    /* associated weights */
+
+} cs_cell_to_vertex_lr_v2c_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -106,6 +124,8 @@ typedef  cs_real_t  cs_weight_t;  /* will allow testing single precision
 bool          _set[3] = {false, false, false};
 cs_weight_t  *_weights[3][2] = {{NULL, NULL}, {NULL, NULL}, {NULL, NULL}};
 
+static cs_cell_to_vertex_lr_v2c_t  *_lr_v2c = NULL;
+
 /* Short names for gradient computation types */
 
 const char *cs_cell_to_vertex_type_name[]
@@ -403,6 +423,99 @@ _cell_to_vertex_f_lsq(int  tr_ignore)
     cs_math_sym_44_factor_ldlt(w + v_id*10);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build vertex-based weights for the linear regression interpolation.
+ *
+ * As the vertex value is obtained by a partial solve of the (factored)
+ * local least-squares system, it is linear in the right-hand side, so
+ * that it may be written as a weighted sum of adjacent cell and boundary
+ * face values. Weights are stored in vertex -> cells and vertex -> boundary
+ * faces CSR arrays, so that interpolation is a simple gather, with no
+ * geometric quantities needed.
+ *
+ * The least-squares factorization must have been computed first.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cell_to_vertex_lr_v2c(void)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_adjacency_t  *c2v = cs_glob_mesh_adjacencies->c2v;
+
+  const cs_lnum_t n_vertices = m->n_vertices;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const cs_weight_t *ldlt = _weights[CS_CELL_TO_VERTEX_LR][0];
+
+  BFT_MALLOC(_lr_v2c, 1, cs_cell_to_vertex_lr_v2c_t);
+
+  for (int e_type = 0; e_type < 2; e_type++) {
+
+    const cs_lnum_t  n_elts = (e_type == 0) ? n_cells : n_b_faces;
+    const cs_lnum_t *e2v_idx = (e_type == 0) ? c2v->idx : m->b_face_vtx_idx;
+    const cs_lnum_t *e2v_ids = (e_type == 0) ? c2v->ids : m->b_face_vtx_lst;
+    const cs_real_t *e_coo = (e_type == 0) ? mq->cell_cen : mq->b_face_cog;
+
+    cs_lnum_t *v2e_idx, *v2e_ids;
+    cs_weight_t *v2e_w;
+
+    CS_MALLOC_HD(v2e_idx, n_vertices + 1, cs_lnum_t, cs_alloc_mode);
+    CS_MALLOC_HD(v2e_ids, e2v_idx[n_elts], cs_lnum_t, cs_alloc_mode);
+    CS_MALLOC_HD(v2e_w, e2v_idx[n_elts], cs_weight_t, cs_alloc_mode);
+
+    /* Transpose element -> vertices adjacency */
+
+    for (cs_lnum_t v_id = 0; v_id < n_vertices + 1; v_id++)
+      v2e_idx[v_id] = 0;
+
+    for (cs_lnum_t j = 0; j < e2v_idx[n_elts]; j++)
+      v2e_idx[e2v_ids[j] + 1] += 1;
+
+    for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
+      v2e_idx[v_id + 1] += v2e_idx[v_id];
+
+    cs_lnum_t *v2e_count;
+    BFT_MALLOC(v2e_count, n_vertices, cs_lnum_t);
+
+    for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
+      v2e_count[v_id] = 0;
+
+    for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+      const cs_real_t *_e_coo = e_coo + e_id*3;
+      for (cs_lnum_t j = e2v_idx[e_id]; j < e2v_idx[e_id+1]; j++) {
+        cs_lnum_t v_id = e2v_ids[j];
+        const cs_real_t *v_coo = m->vtx_coord + v_id*3;
+        cs_real_t rhs[4] = {_e_coo[0]-v_coo[0],
+                            _e_coo[1]-v_coo[1],
+                            _e_coo[2]-v_coo[2],
+                            1.};
+        cs_lnum_t k = v2e_idx[v_id] + v2e_count[v_id];
+        v2e_ids[k] = e_id;
+        v2e_w[k] = cs_math_sym_44_partial_solve_ldlt(ldlt + v_id*10, rhs);
+        v2e_count[v_id] += 1;
+      }
+    }
+
+    BFT_FREE(v2e_count);
+
+    if (e_type == 0) {
+      _lr_v2c->c_idx = v2e_idx;
+      _lr_v2c->c_ids = v2e_ids;
+      _lr_v2c->c_w = v2e_w;
+    }
+    else {
+      _lr_v2c->b_idx = v2e_idx;
+      _lr_v2c->b_ids = v2e_ids;
+      _lr_v2c->b_w = v2e_w;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Interpolate cell values to vertex values for a scalar arrray.
@@ -430,7 +543,6 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t   method,
   CS_UNUSED(verbosity);
 
   const cs_mesh_t  *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
   const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
 
   const cs_lnum_t n_vertices = m->n_vertices;
@@ -640,90 +752,44 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t   method,
     {
       if (! _set[CS_CELL_TO_VERTEX_LR])
         _cell_to_vertex_f_lsq(tr_ignore);
+      if (_lr_v2c == NULL)
+        _cell_to_vertex_lr_v2c();
 
-      cs_real_t  *rhs;
-      cs_lnum_t  rhs_size = n_vertices*4;
-      BFT_MALLOC(rhs, rhs_size, cs_real_t);
-      for (cs_lnum_t i = 0; i < rhs_size; i++)
-        rhs[i] = 0;
+      const cs_lnum_t *v2c_idx = _lr_v2c->c_idx;
+      const cs_lnum_t *v2c_ids = _lr_v2c->c_ids;
+      const cs_weight_t *v2c_w = _lr_v2c->c_w;
+      const cs_lnum_t *v2b_idx = _lr_v2c->b_idx;
+      const cs_lnum_t *v2b_ids = _lr_v2c->b_ids;
+      const cs_weight_t *v2b_w = _lr_v2c->b_w;
+      const cs_lnum_t *b_face_cells = m->b_face_cells;
 
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        const cs_real_t *c_coo = mq->cell_cen + c_id*3;
-        cs_real_t _c_var = c_var[c_id];
-        cs_lnum_t s_id = c2v_idx[c_id];
-        cs_lnum_t e_id = c2v_idx[c_id+1];
-        for (cs_lnum_t j = s_id; j < e_id; j++) {
-          cs_lnum_t v_id = c2v_ids[j];
-          const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-          cs_real_t r_coo[3]
-            = {c_coo[0]-v_coo[0], c_coo[1]-v_coo[1], c_coo[2]-v_coo[2]};
-          cs_real_t  *_rhs = rhs + v_id*4;
-          _rhs[0] += r_coo[0] * _c_var;
-          _rhs[1] += r_coo[1] * _c_var;
-          _rhs[2] += r_coo[2] * _c_var;
-          _rhs[3] += c_var[c_id];
-        }
-      }
-
-      if (b_var == NULL) {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          cs_lnum_t c_id = m->b_face_cells[f_id];
-          cs_real_t _b_var = c_var[c_id];
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            cs_real_t  *_rhs = rhs + v_id*4;
-            _rhs[0] += r_coo[0] * _b_var;
-            _rhs[1] += r_coo[1] * _b_var;
-            _rhs[2] += r_coo[2] * _b_var;
-            _rhs[3] += _b_var;
-          }
+#     pragma omp parallel for if(n_vertices > CS_THR_MIN)
+      for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+        cs_real_t s = 0;
+        for (cs_lnum_t j = v2c_idx[v_id]; j < v2c_idx[v_id+1]; j++)
+          s += v2c_w[j] * c_var[v2c_ids[j]];
+        if (b_var == NULL) {
+          for (cs_lnum_t j = v2b_idx[v_id]; j < v2b_idx[v_id+1]; j++)
+            s += v2b_w[j] * c_var[b_face_cells[v2b_ids[j]]];
         }
-      }
-      else {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          cs_real_t _b_var = b_var[f_id];
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            cs_real_t  *_rhs = rhs + v_id*4;
-            _rhs[0] += r_coo[0] * _b_var;
-            _rhs[1] += r_coo[1] * _b_var;
-            _rhs[2] += r_coo[2] * _b_var;
-            _rhs[3] += _b_var;
-          }
+        else {
+          for (cs_lnum_t j = v2b_idx[v_id]; j < v2b_idx[v_id+1]; j++)
+            s += v2b_w[j] * b_var[v2b_ids[j]];
         }
+        v_var[v_id] = s;
       }
 
+      /* Partial solve being linear, contributions from other ranks
+         may be added to the vertex values directly */
+
       if (m->vtx_interfaces != NULL)
         cs_interface_set_sum_tr(m->vtx_interfaces,
                                 m->n_vertices,
-                                4,
+                                1,
                                 true,
                                 CS_REAL_TYPE,
                                 tr_ignore,
-                                rhs);
-
-      const cs_weight_t *ldlt = _weights[CS_CELL_TO_VERTEX_LR][0];
-
-#     pragma omp parallel for if(n_vertices > CS_THR_MIN)
-      for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
-        const cs_real_t  *_ldlt = ldlt + v_id*10;
-        const cs_real_t  *_rhs = rhs + v_id*4;
-        v_var[v_id] = cs_math_sym_44_partial_solve_ldlt(_ldlt, _rhs);
-      }
-
-      BFT_FREE(rhs);
+                                v_var);
     }
     break;
   default:
@@ -1106,7 +1172,18 @@ cs_cell_to_vertex_free(void)
 {
   for (int i = 0; i < 3; i++) {
     for (int j = 0; j < 2; j++)
-    BFT_FREE(_weights[i][j]);
+      BFT_FREE(_weights[i][j]);
+    _set[i] = false;
+  }
+
+  if (_lr_v2c != NULL) {
+    CS_FREE_HD(_lr_v2c->c_idx);
+    CS_FREE_HD(_lr_v2c->c_ids);
+    CS_FREE_HD(_lr_v2c->c_w);
+    CS_FREE_HD(_lr_v2c->b_idx);
+    CS_FREE_HD(_lr_v2c->b_ids);
+    CS_FREE_HD(_lr_v2c->b_w);
+    BFT_FREE(_lr_v2c);
   }
 }
 
@@ -109,10 +109,240 @@
  * Local type definitions
  *============================================================================*/
 
+/* Specialized interior faces kernel usage info, by field */
+
+typedef struct {
+
+  int                 variant;    /* last kernel variant used, -1 for
+                                     generic kernels, -2 if unused */
+  unsigned long long  n_calls;    /* number of calls */
+  unsigned long long  n_spec;     /* number of calls using a specialized
+                                     kernel variant */
+
+} cs_cd_kernel_variant_t;
+
+/* Cached cell gradient of a field's values */
+
+typedef struct {
+
+  const cs_real_t             *pvar;       /* associated values, or NULL */
+  const cs_field_bc_coeffs_t  *bc_coeffs;  /* associated BC coefficients */
+  int                          inc;        /* associated increment flag */
+  cs_halo_type_t               halo_type;  /* associated halo type */
+  bool                         updatable;  /* may be updated for an
+                                              increment (unlimited,
+                                              unweighted least-squares) */
+  cs_real_3_t                 *grad;       /* cached gradient */
+
+} cs_cd_gradient_cache_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int                      _n_cd_kernel_variants = 0;
+static cs_cd_kernel_variant_t  *_cd_kernel_variants = nullptr;
+
+/* Gradient cache (field id, or -1 when inactive) */
+
+static int                      _gradient_cache_f_id = -1;
+static int                      _gradient_cache_next = 0;
+static cs_cd_gradient_cache_t   _gradient_cache[2]
+  = {{nullptr, nullptr, 0, CS_HALO_STANDARD, false, nullptr},
+     {nullptr, nullptr, 0, CS_HALO_STANDARD, false, nullptr}};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return id of a specialized scalar interior faces kernel variant.
+ *
+ * parameters:
+ *   scheme     <-- convection scheme (-1 for pure upwind, ischcv otherwise)
+ *   ircflp     <-- reconstruct fluxes ?
+ *   vectorize  <-- vectorized host loop ?
+ *
+ * return:
+ *   variant id
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_cd_variant_id(int   scheme,
+               bool  ircflp,
+               bool  vectorize)
+{
+  int variant = (scheme + 1)*2;
+  if (ircflp)
+    variant += 1;
+  if (vectorize)
+    variant += 8;
+
+  return variant;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the description of a scalar interior faces kernel variant.
+ *
+ * parameters:
+ *   variant  <-- variant id, or -1 for generic kernels
+ *   name     --> variant description
+ *----------------------------------------------------------------------------*/
+
+static void
+_cd_variant_name(int   variant,
+                 char  name[64])
+{
+  const char *scheme_name[] = {N_("upwind"),
+                               N_("legacy SOLU"),
+                               N_("centered"),
+                               N_("SOLU")};
+
+  if (variant < 0)
+    snprintf(name, 63, "%s", _("generic"));
+  else
+    snprintf(name, 63, "%s%s, %s",
+             _(scheme_name[(variant%8)/2]),
+             (variant%2) ? _(" + reconstruction") : "",
+             (variant >= 8) ? _("vectorized") : _("dispatch"));
+
+  name[63] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Update and log the interior faces kernel variant used for a field.
+ *
+ * The variant is logged upon first use and when it changes.
+ *
+ * parameters:
+ *   f        <-- pointer to field
+ *   variant  <-- variant id, or -1 for generic kernels
+ *----------------------------------------------------------------------------*/
+
+static void
+_cd_variant_update(const cs_field_t  *f,
+                   int                variant)
+{
+  if (f->id >= _n_cd_kernel_variants) {
+    int n_fields = cs_field_n_fields();
+    BFT_REALLOC(_cd_kernel_variants, n_fields, cs_cd_kernel_variant_t);
+    for (int i = _n_cd_kernel_variants; i < n_fields; i++) {
+      _cd_kernel_variants[i].variant = -2;
+      _cd_kernel_variants[i].n_calls = 0;
+      _cd_kernel_variants[i].n_spec = 0;
+    }
+    _n_cd_kernel_variants = n_fields;
+  }
+
+  cs_cd_kernel_variant_t *v = _cd_kernel_variants + f->id;
+
+  v->n_calls += 1;
+  if (variant > -1)
+    v->n_spec += 1;
+
+  if (variant != v->variant) {
+    char name[64];
+    _cd_variant_name(variant, name);
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _(" %s: interior faces convection/diffusion kernel: %s\n"),
+                  f->name, name);
+    v->variant = variant;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy a cached cell gradient if one is available for given values.
+ *
+ * parameters:
+ *   f           <-- pointer to field, or NULL
+ *   bc_coeffs   <-- boundary condition structure for the variable
+ *   inc         <-- 0 if an increment, 1 otherwise
+ *   pvar        <-- variable values
+ *   grad        --> cell gradient
+ *
+ * return:
+ *   true if the gradient was found in the cache, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_cache_get(const cs_field_t            *f,
+                    const cs_field_bc_coeffs_t  *bc_coeffs,
+                    int                          inc,
+                    const cs_real_t             *pvar,
+                    cs_real_3_t                 *grad)
+{
+  if (f == nullptr || f->id != _gradient_cache_f_id)
+    return false;
+
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  for (int i = 0; i < 2; i++) {
+    const cs_cd_gradient_cache_t *c = _gradient_cache + i;
+    if (   c->pvar == pvar && c->bc_coeffs == bc_coeffs && c->inc == inc
+        && c->grad != nullptr) {
+      cs_array_real_copy(n_cells_ext*3,
+                         (const cs_real_t *)c->grad,
+                         (cs_real_t *)grad);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Save a cell gradient in the cache, if active for the given field.
+ *
+ * parameters:
+ *   f           <-- pointer to field, or NULL
+ *   bc_coeffs   <-- boundary condition structure for the variable
+ *   inc         <-- 0 if an increment, 1 otherwise
+ *   halo_type   <-- halo type used for the gradient
+ *   updatable   <-- true if the gradient may be updated for an increment
+ *   pvar        <-- variable values
+ *   grad        <-- cell gradient
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_cache_set(const cs_field_t            *f,
+                    const cs_field_bc_coeffs_t  *bc_coeffs,
+                    int                          inc,
+                    cs_halo_type_t               halo_type,
+                    bool                         updatable,
+                    const cs_real_t             *pvar,
+                    const cs_real_3_t           *grad)
+{
+  if (f == nullptr || f->id != _gradient_cache_f_id)
+    return;
+
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  /* Replace entry for the same values if present, oldest otherwise */
+
+  int c_id = _gradient_cache_next;
+  for (int i = 0; i < 2; i++) {
+    if (_gradient_cache[i].pvar == pvar)
+      c_id = i;
+  }
+  if (c_id == _gradient_cache_next)
+    _gradient_cache_next = (_gradient_cache_next + 1) % 2;
+
+  cs_cd_gradient_cache_t *c = _gradient_cache + c_id;
+
+  if (c->grad == nullptr)
+    CS_MALLOC_HD(c->grad, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+
+  c->pvar = pvar;
+  c->bc_coeffs = bc_coeffs;
+  c->inc = inc;
+  c->halo_type = halo_type;
+  c->updatable = updatable;
+
+  cs_array_real_copy(n_cells_ext*3,
+                     (const cs_real_t *)grad,
+                     (cs_real_t *)c->grad);
+}
+
 /*----------------------------------------------------------------------------
  * Return the equivalent heat transfer coefficient. If both terms are
  * below a given tolerance, 0. is returned.
@@ -2993,6 +3223,416 @@ _face_convection_scalar_steady(const cs_field_t           *f,
   BFT_FREE(courant);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute interior face fluxes of the explicit part of a scalar transport
+ * equation's convection/diffusion terms, with the convection scheme and
+ * reconstruction options fixed at compile time.
+ *
+ * Handled schemes are pure upwind (scheme = -1), and legacy SOLU (0),
+ * centered (1) and SOLU (2) without slope test (isstpc = 1).
+ *
+ * template parameters:
+ *   is_thermal  true for the temperature (regarding thermal scheme)
+ *   scheme      convection scheme (-1 for pure upwind, ischcv otherwise)
+ *   ircflp      reconstruct fluxes ?
+ *
+ * parameters:
+ *   face_id      <-- interior face id
+ *   ii           <-- first adjacent cell id
+ *   jj           <-- second adjacent cell id
+ *   iconvp       <-- convection flag
+ *   idiffp       <-- diffusion flag
+ *   imasac       <-- take mass accumulation into account?
+ *   thetap       <-- time scheme weighting coefficient
+ *   blencp       <-- proportion of centered or SOLU scheme
+ *   df_limiter   <-- diffusion limiter, or NULL
+ *   weight       <-- interior faces geometric weight
+ *   cell_cen     <-- cell centers
+ *   i_face_cog   <-- interior face centers of gravity
+ *   diipf        <-- interior faces II' vector
+ *   djjpf        <-- interior faces JJ' vector
+ *   grad         <-- cell gradient of the variable
+ *   s_grad       <-- cell gradient used by the SOLU schemes
+ *   pvar         <-- variable values
+ *   xcpp         <-- specific heat (for thermal scalars), or NULL
+ *   i_massflux   <-- mass flux at interior faces
+ *   i_visc       <-- face viscosity at interior faces
+ *   fluxi        --> flux contribution for cell ii
+ *   fluxj        --> flux contribution for cell jj
+ *----------------------------------------------------------------------------*/
+
+template <bool is_thermal, int scheme, bool ircflp>
+CS_F_HOST_DEVICE static inline void
+_i_face_scalar_unsteady_flux(cs_lnum_t                    face_id,
+                             cs_lnum_t                    ii,
+                             cs_lnum_t                    jj,
+                             int                          iconvp,
+                             int                          idiffp,
+                             int                          imasac,
+                             cs_real_t                    thetap,
+                             cs_real_t                    blencp,
+                             const cs_real_t    *restrict df_limiter,
+                             const cs_real_t    *restrict weight,
+                             const cs_real_3_t  *restrict cell_cen,
+                             const cs_real_3_t  *restrict i_face_cog,
+                             const cs_real_3_t  *restrict diipf,
+                             const cs_real_3_t  *restrict djjpf,
+                             const cs_real_3_t  *restrict grad,
+                             const cs_real_3_t  *restrict s_grad,
+                             const cs_real_t    *restrict pvar,
+                             const cs_real_t    *restrict xcpp,
+                             const cs_real_t    *restrict i_massflux,
+                             const cs_real_t    *restrict i_visc,
+                             cs_real_t                   *fluxi,
+                             cs_real_t                   *fluxj)
+{
+  cs_real_t cpi = 1.0, cpj = 1.0;
+  if (is_thermal) {
+    cpi = xcpp[ii];
+    cpj = xcpp[jj];
+  }
+
+  cs_real_t pip = pvar[ii], pjp = pvar[jj];
+
+  if (ircflp) {
+    cs_real_t bldfrp = 1.;
+    if (df_limiter != NULL)  /* Local limiter of the reconstruction */
+      bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
+                            0.);
+
+    cs_real_t recoi, recoj;
+    cs_i_compute_quantities(bldfrp,
+                            diipf[face_id], djjpf[face_id],
+                            grad[ii], grad[jj],
+                            pvar[ii], pvar[jj],
+                            &recoi, &recoj,
+                            &pip, &pjp);
+  }
+
+  cs_real_t pif = pvar[ii], pjf = pvar[jj];
+
+  if (scheme == 0 || scheme == 2) {
+
+    /* Legacy SOLU or SOLU */
+
+    cs_solu_f_val(cell_cen[ii],
+                  i_face_cog[face_id],
+                  s_grad[ii],
+                  pvar[ii],
+                  &pif);
+    cs_solu_f_val(cell_cen[jj],
+                  i_face_cog[face_id],
+                  s_grad[jj],
+                  pvar[jj],
+                  &pjf);
+
+  }
+  else if (scheme == 1) {
+
+    /* Centered */
+
+    const cs_real_t w_f = weight[face_id];
+    pif = w_f*pip + (1.-w_f)*pjp;
+    pjf = pif;
+
+  }
+
+  /* Blending */
+
+  if (scheme >= 0) {
+    pif = blencp * pif + (1. - blencp) * pvar[ii];
+    pjf = blencp * pjf + (1. - blencp) * pvar[jj];
+  }
+
+  cs_real_t _fluxi = 0., _fluxj = 0.;
+
+  /* Convective flux */
+
+  if (iconvp == 1) {
+    cs_real_t _i_massflux = i_massflux[face_id];
+    cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
+    cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
+
+    _fluxi += cpi*(  thetap*(flui*pif + fluj*pjf)
+                   - imasac*_i_massflux*pvar[ii]);
+
+    _fluxj += cpj*(  thetap*(flui*pif + fluj*pjf)
+                   - imasac*_i_massflux*pvar[jj]);
+  }
+
+  /* Diffusive flux (no relaxation) */
+
+  cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
+
+  *fluxi = _fluxi + diff_contrib;
+  *fluxj = _fluxj + diff_contrib;
+}
+
+/*----------------------------------------------------------------------------
+ * Add interior face contributions of the explicit part of a scalar
+ * transport equation's convection/diffusion terms, with the convection
+ * scheme and reconstruction options fixed at compile time.
+ *
+ * With a vectorized interior faces numbering (CS_RENUMBER_I_FACES_SIMD),
+ * no cell appears twice in a block of CS_NUMBERING_SIMD_SIZE consecutive
+ * faces, so on the host, the face loop may be vectorized. Otherwise,
+ * the loop is run through the dispatch context.
+ *
+ * template parameters:
+ *   is_thermal  true for the temperature (regarding thermal scheme)
+ *   scheme      convection scheme (-1 for pure upwind, ischcv otherwise)
+ *   ircflp      reconstruct fluxes ?
+ *
+ * parameters:
+ *   ctx          <-> reference to dispatch context
+ *   i_sum_type   <-- interior faces sum type for the dispatch context
+ *   vectorize    <-- use vectorized host loop ?
+ *   m            <-- pointer to mesh structure
+ *   fvq          <-- pointer to finite volume quantities
+ *   iconvp       <-- convection flag
+ *   idiffp       <-- diffusion flag
+ *   imasac       <-- take mass accumulation into account?
+ *   thetap       <-- time scheme weighting coefficient
+ *   blencp       <-- proportion of centered or SOLU scheme
+ *   df_limiter   <-- diffusion limiter, or NULL
+ *   grad         <-- cell gradient of the variable
+ *   gradup       <-- upwind cell gradient for SOLU scheme, or NULL
+ *   pvar         <-- variable values
+ *   xcpp         <-- specific heat (for thermal scalars), or NULL
+ *   i_massflux   <-- mass flux at interior faces
+ *   i_visc       <-- face viscosity at interior faces
+ *   rhs          <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+template <bool is_thermal, int scheme, bool ircflp>
+static void
+_i_faces_scalar_unsteady_specialized
+  (cs_dispatch_context         &ctx,
+   cs_dispatch_sum_type_t       i_sum_type,
+   bool                         vectorize,
+   const cs_mesh_t             *m,
+   const cs_mesh_quantities_t  *fvq,
+   int                          iconvp,
+   int                          idiffp,
+   int                          imasac,
+   cs_real_t                    thetap,
+   cs_real_t                    blencp,
+   const cs_real_t    *restrict df_limiter,
+   const cs_real_3_t  *restrict grad,
+   const cs_real_3_t  *restrict gradup,
+   const cs_real_t    *restrict pvar,
+   const cs_real_t    *restrict xcpp,
+   const cs_real_t    *restrict i_massflux,
+   const cs_real_t    *restrict i_visc,
+   cs_real_t          *restrict rhs)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *)fvq->djjpf;
+
+  const cs_real_3_t *restrict s_grad = (scheme == 2) ? gradup : grad;
+
+  if (vectorize) {
+
+    assert(m->i_face_numbering->type == CS_NUMBERING_VECTORIZE);
+
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
+#   else
+#     pragma dir nodep
+#     pragma GCC ivdep
+#     pragma _NEC ivdep
+#   endif
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+      cs_lnum_t ii = i_face_cells[face_id][0];
+      cs_lnum_t jj = i_face_cells[face_id][1];
+
+      cs_real_t fluxi, fluxj;
+
+      _i_face_scalar_unsteady_flux<is_thermal, scheme, ircflp>
+        (face_id, ii, jj,
+         iconvp, idiffp, imasac, thetap, blencp,
+         df_limiter, weight, cell_cen, i_face_cog, diipf, djjpf,
+         grad, s_grad, pvar, xcpp, i_massflux, i_visc,
+         &fluxi, &fluxj);
+
+      if (ii < n_cells)
+        rhs[ii] -= fluxi;
+      if (jj < n_cells)
+        rhs[jj] += fluxj;
+
+    }
+
+  }
+  else {
+
+    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+
+      cs_lnum_t ii = i_face_cells[face_id][0];
+      cs_lnum_t jj = i_face_cells[face_id][1];
+
+      cs_real_t fluxi, fluxj;
+
+      _i_face_scalar_unsteady_flux<is_thermal, scheme, ircflp>
+        (face_id, ii, jj,
+         iconvp, idiffp, imasac, thetap, blencp,
+         df_limiter, weight, cell_cen, i_face_cog, diipf, djjpf,
+         grad, s_grad, pvar, xcpp, i_massflux, i_visc,
+         &fluxi, &fluxj);
+
+      if (ii < n_cells)
+        cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
+      if (jj < n_cells)
+        cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
+
+    });
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add interior face contributions of the explicit part of a scalar
+ * transport equation's convection/diffusion terms using a compile-time
+ * specialized kernel, if the equation options allow it.
+ *
+ * The runtime option tuple (convection scheme, reconstruction) is mapped
+ * to a template instance once per call, rather than branching per face.
+ *
+ * parameters:
+ *   ctx          <-> reference to dispatch context
+ *   i_sum_type   <-- interior faces sum type for the dispatch context
+ *   m            <-- pointer to mesh structure
+ *   fvq          <-- pointer to finite volume quantities
+ *   eqp          <-- associated equation parameters
+ *   imasac       <-- take mass accumulation into account?
+ *   df_limiter   <-- diffusion limiter, or NULL
+ *   grad         <-- cell gradient of the variable
+ *   gradup       <-- upwind cell gradient for SOLU scheme, or NULL
+ *   pvar         <-- variable values
+ *   xcpp         <-- specific heat (for thermal scalars), or NULL
+ *   i_massflux   <-- mass flux at interior faces
+ *   i_visc       <-- face viscosity at interior faces
+ *   rhs          <-> right hand side
+ *
+ * returns:
+ *   id of the specialized variant used, or -1 if the generic kernels
+ *   must be used
+ *----------------------------------------------------------------------------*/
+
+template <bool is_thermal>
+static int
+_try_i_faces_scalar_unsteady_specialized
+  (cs_dispatch_context         &ctx,
+   cs_dispatch_sum_type_t       i_sum_type,
+   const cs_mesh_t             *m,
+   const cs_mesh_quantities_t  *fvq,
+   const cs_equation_param_t   &eqp,
+   int                          imasac,
+   const cs_real_t             *df_limiter,
+   const cs_real_3_t           *grad,
+   const cs_real_3_t           *gradup,
+   const cs_real_t             *pvar,
+   const cs_real_t             *xcpp,
+   const cs_real_t             *i_massflux,
+   const cs_real_t             *i_visc,
+   cs_real_t                   *rhs)
+{
+  typedef void
+    (i_faces_kernel_t)(cs_dispatch_context         &ctx,
+                       cs_dispatch_sum_type_t       i_sum_type,
+                       bool                         vectorize,
+                       const cs_mesh_t             *m,
+                       const cs_mesh_quantities_t  *fvq,
+                       int                          iconvp,
+                       int                          idiffp,
+                       int                          imasac,
+                       cs_real_t                    thetap,
+                       cs_real_t                    blencp,
+                       const cs_real_t    *restrict df_limiter,
+                       const cs_real_3_t  *restrict grad,
+                       const cs_real_3_t  *restrict gradup,
+                       const cs_real_t    *restrict pvar,
+                       const cs_real_t    *restrict xcpp,
+                       const cs_real_t    *restrict i_massflux,
+                       const cs_real_t    *restrict i_visc,
+                       cs_real_t          *restrict rhs);
+
+  /* Map runtime options to kernel instance */
+
+  int scheme = -2;
+  if (eqp.iconv == 0 || !(eqp.blencv > 0.))
+    scheme = -1;
+  else if (eqp.isstpc == 1 && eqp.ischcv >= 0 && eqp.ischcv <= 2)
+    scheme = eqp.ischcv;
+
+  if (scheme == -2 || (scheme == 2 && gradup == nullptr))
+    return -1;
+
+  const bool ircflp = (eqp.ircflu == 1) ? true : false;
+
+  bool vectorize = false;
+  if (   i_sum_type == CS_DISPATCH_SUM_SIMPLE
+      && m->i_face_numbering->type == CS_NUMBERING_VECTORIZE)
+    vectorize = true;
+
+  i_faces_kernel_t *kernel = nullptr;
+
+  if (ircflp) {
+    switch (scheme) {
+    case -1:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, -1, true>;
+      break;
+    case 0:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, 0, true>;
+      break;
+    case 1:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, 1, true>;
+      break;
+    default:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, 2, true>;
+    }
+  }
+  else {
+    switch (scheme) {
+    case -1:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, -1, false>;
+      break;
+    case 0:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, 0, false>;
+      break;
+    case 1:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, 1, false>;
+      break;
+    default:
+      kernel = _i_faces_scalar_unsteady_specialized<is_thermal, 2, false>;
+    }
+  }
+
+  kernel(ctx, i_sum_type, vectorize,
+         m, fvq,
+         eqp.iconv, eqp.idiff, imasac,
+         eqp.theta, eqp.blencv,
+         df_limiter,
+         grad, gradup,
+         pvar, xcpp,
+         i_massflux, i_visc,
+         rhs);
+
+  return _cd_variant_id(scheme, ircflp, vectorize);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add the explicit part of the convection/diffusion terms of a
@@ -3284,23 +3924,31 @@ _convection_diffusion_scalar_unsteady
       }
     }
 
-    cs_gradient_scalar_synced_input(var_name,
-                                    gradient_type,
-                                    halo_type,
-                                    inc,
-                                    nswrgp,
-                                    0, /* hyd_p_flag */
-                                    w_stride,
-                                    iwarnp,
-                                    imligp,
-                                    epsrgp,
-                                    climgp,
-                                    NULL, /* f_ext exterior force */
-                                    bc_coeffs,
-                                    _pvar,
-                                    gweight, /* Weighted gradient */
-                                    cpl,
-                                    grad);
+    if (! _gradient_cache_get(f, bc_coeffs, inc, _pvar, grad)) {
+      cs_gradient_scalar_synced_input(var_name,
+                                      gradient_type,
+                                      halo_type,
+                                      inc,
+                                      nswrgp,
+                                      0, /* hyd_p_flag */
+                                      w_stride,
+                                      iwarnp,
+                                      imligp,
+                                      epsrgp,
+                                      climgp,
+                                      NULL, /* f_ext exterior force */
+                                      bc_coeffs,
+                                      _pvar,
+                                      gweight, /* Weighted gradient */
+                                      cpl,
+                                      grad);
+
+      bool updatable = (   gradient_type == CS_GRADIENT_LSQ
+                        && imligp == CS_GRADIENT_LIMIT_NONE
+                        && gweight == NULL && cpl == NULL) ? true : false;
+      _gradient_cache_set(f, bc_coeffs, inc, halo_type, updatable,
+                          _pvar, grad);
+    }
 
   }
   else {
@@ -3382,10 +4030,37 @@ _convection_diffusion_scalar_unsteady
     ctx.wait();
   }
 
+  /* --> Kernels specialized by option set (vectorized for compatible
+         CS_RENUMBER_I_FACES_SIMD interior faces numbering)
+     ================================================================*/
+
+  int i_variant
+    = _try_i_faces_scalar_unsteady_specialized<is_thermal>(ctx,
+                                                           i_sum_type,
+                                                           m,
+                                                           fvq,
+                                                           eqp,
+                                                           imasac,
+                                                           df_limiter,
+                                                           grad,
+                                                           gradup,
+                                                           _pvar,
+                                                           xcpp,
+                                                           i_massflux,
+                                                           i_visc,
+                                                           rhs);
+
+  if (f != nullptr)
+    _cd_variant_update(f, i_variant);
+
+  if (i_variant > -1) {
+    /* Interior face contributions already added */
+  }
+
   /* --> Pure upwind flux
      =====================*/
 
-  if (pure_upwind) {
+  else if (pure_upwind) {
 
     ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
 
@@ -4329,33 +5004,41 @@ _face_convection_scalar_unsteady(const cs_field_t           *f,
         if (eqp.idiff > 0) {
           int key_id = cs_field_key_id("gradient_weighting_id");
           int diff_id = cs_field_get_key_int(f, key_id);
-          if (diff_id > -1) {
-            cs_field_t *weight_f = cs_field_by_id(diff_id);
-            gweight = weight_f->val;
-            w_stride = weight_f->dim;
-            cs_field_synchronize(weight_f, halo_type);
-          }
-        }
-      }
-    }
-
-    cs_gradient_scalar_synced_input(var_name,
-                                    gradient_type,
-                                    halo_type,
-                                    inc,
-                                    nswrgp,
-                                    0, /* hyd_p_flag */
-                                    w_stride,
-                                    iwarnp,
-                                    imligp,
-                                    epsrgp,
-                                    climgp,
-                                    NULL, /* f_ext exterior force */
-                                    bc_coeffs,
-                                    _pvar,
-                                    gweight, /* Weighted gradient */
-                                    cpl,
-                                    grad);
+          if (diff_id > -1) {
+            cs_field_t *weight_f = cs_field_by_id(diff_id);
+            gweight = weight_f->val;
+            w_stride = weight_f->dim;
+            cs_field_synchronize(weight_f, halo_type);
+          }
+        }
+      }
+    }
+
+    if (! _gradient_cache_get(f, bc_coeffs, inc, _pvar, grad)) {
+      cs_gradient_scalar_synced_input(var_name,
+                                      gradient_type,
+                                      halo_type,
+                                      inc,
+                                      nswrgp,
+                                      0, /* hyd_p_flag */
+                                      w_stride,
+                                      iwarnp,
+                                      imligp,
+                                      epsrgp,
+                                      climgp,
+                                      NULL, /* f_ext exterior force */
+                                      bc_coeffs,
+                                      _pvar,
+                                      gweight, /* Weighted gradient */
+                                      cpl,
+                                      grad);
+
+      bool updatable = (   gradient_type == CS_GRADIENT_LSQ
+                        && imligp == CS_GRADIENT_LIMIT_NONE
+                        && gweight == NULL && cpl == NULL) ? true : false;
+      _gradient_cache_set(f, bc_coeffs, inc, halo_type, updatable,
+                          _pvar, grad);
+    }
 
   }
   else {
@@ -8158,7 +8841,8 @@ cs_convection_diffusion_vector(int                         idtvar,
     cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
     cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
 
-    ctx_c.wait();  /* We now need bndcel, computed by ctx_c */
+    /* We now need bndcel, computed by ctx_c */
+    ctx.wait_for(ctx_c);
 
     /* Interior faces */
 
@@ -11408,6 +12092,258 @@ cs_face_diffusion_potential(const int                   f_id,
   ctx_b.wait();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the face mass flux with the face gradient of a pressure
+ * (or pressure increment) and of its last, non reconstructed, increment,
+ * and optionally compute the divergence of the updated mass flux.
+ *
+ * This is equivalent to a call to \ref cs_face_diffusion_potential with
+ * pvar, followed by a call with dpvar, inc = 0 and nswrgp = 0, and to
+ * a call to \ref cs_divergence on the resulting mass flux, but all
+ * face contributions are handled in a single pass over the faces.
+ *
+ * \param[in]     f_id          field id (or -1)
+ * \param[in]     m             pointer to mesh
+ * \param[in]     fvq           pointer to finite volume quantities
+ * \param[in]     inc           indicator for pvar
+ *                               - 0 when solving an increment
+ *                               - 1 otherwise
+ * \param[in]     imrgra        indicator
+ *                               - 0 iterative gradient
+ *                               - 1 least squares gradient
+ * \param[in]     nswrgp        number of reconstruction sweeps for the
+ *                               gradients of pvar
+ * \param[in]     imligp        clipping gradient method
+ *                               - < 0 no clipping
+ *                               - = 0 thank to neighbooring gradients
+ *                               - = 1 thank to the mean gradient
+ * \param[in]     iphydp        hydrostatic pressure indicator
+ * \param[in]     iwgrp         indicator
+ *                               - 1 weight gradient by vicosity*porosity
+ *                               - weighting determined by field options
+ * \param[in]     iwarnp        verbosity
+ * \param[in]     epsrgp        relative precision for the gradient
+ *                               reconstruction
+ * \param[in]     climgp        clipping coeffecient for the computation of
+ *                               the gradient
+ * \param[in]     frcxt         body force creating the hydrostatic pressure
+ * \param[in]     pvar          solved variable (reconstructed contribution)
+ * \param[in]     dpvar         last increment (non reconstructed
+ *                               contribution, homogeneous BCs)
+ * \param[in]     bc_coeffs     boundary condition structure for the variable
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the r.h.s.
+ * \param[in]     visel         viscosity by cell
+ * \param[in,out] i_massflux    mass flux at interior faces
+ * \param[in,out] b_massflux    mass flux at boundary faces
+ * \param[out]    diverg        divergence of the updated mass flux, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_face_diffusion_potential_fused(const int                   f_id,
+                                  const cs_mesh_t            *m,
+                                  cs_mesh_quantities_t       *fvq,
+                                  int                         inc,
+                                  int                         imrgra,
+                                  int                         nswrgp,
+                                  int                         imligp,
+                                  int                         iphydp,
+                                  int                         iwgrp,
+                                  int                         iwarnp,
+                                  double                      epsrgp,
+                                  double                      climgp,
+                                  cs_real_3_t       *restrict frcxt,
+                                  cs_real_t         *restrict pvar,
+                                  cs_real_t         *restrict dpvar,
+                                  const cs_field_bc_coeffs_t *bc_coeffs,
+                                  const cs_real_t             i_visc[],
+                                  const cs_real_t             b_visc[],
+                                  cs_real_t         *restrict visel,
+                                  cs_real_t         *restrict i_massflux,
+                                  cs_real_t         *restrict b_massflux,
+                                  cs_real_t         *restrict diverg)
+{
+  const cs_real_t *cofafp = bc_coeffs->af;
+  const cs_real_t *cofbfp = bc_coeffs->bf;
+
+  const cs_halo_t  *halo = m->halo;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *)m->b_face_cells;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict i_f_face_surf = fvq->i_f_face_surf;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *)fvq->djjpf;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *)fvq->diipb;
+
+  /* Parallel or device dispatch. A single context is used since
+     the divergence is shared by interior and boundary face loops */
+  cs_dispatch_context ctx;
+  cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+  cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
+
+  const bool compute_div = (diverg != NULL);
+
+  int w_stride = 1;
+  cs_real_t *gweight = NULL;
+
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
+  if (imrgra < 0)
+    imrgra = 0;
+
+  cs_gradient_type_by_imrgra(imrgra,
+                             &gradient_type,
+                             &halo_type);
+
+  /* Handle parallelism and periodicity */
+
+  if (halo != NULL) {
+    cs_halo_sync_var(halo, halo_type, pvar);
+    cs_halo_sync_var(halo, halo_type, dpvar);
+  }
+
+  /* Gradient of pvar (only needed with reconstruction) */
+
+  cs_real_3_t *grad = NULL;
+
+  if (nswrgp > 1) {
+
+    cs_field_t *f = NULL;
+    char var_name[64];
+
+    if (f_id > -1) {
+      f = cs_field_by_id(f_id);
+      snprintf(var_name, 63, "%s", f->name);
+    }
+    else
+      strncpy(var_name, "[face mass flux update]", 63);
+    var_name[63] = '\0';
+
+    CS_MALLOC_HD(grad, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+
+    if (iwgrp > 0) {
+      gweight = visel;
+      if (halo != NULL)
+        cs_halo_sync_var(halo, halo_type, gweight);
+    }
+
+    else if (f_id > -1) {
+      /* Get the calculation option from the field */
+      const cs_equation_param_t *eqp
+        = cs_field_get_equation_param_const(f);
+      if (f->type & CS_FIELD_VARIABLE && eqp->iwgrec == 1) {
+        if (eqp->idiff > 0) {
+          int key_id = cs_field_key_id("gradient_weighting_id");
+          int diff_id = cs_field_get_key_int(f, key_id);
+          if (diff_id > -1) {
+            cs_field_t *weight_f = cs_field_by_id(diff_id);
+            gweight = weight_f->val;
+            w_stride = weight_f->dim;
+            cs_field_synchronize(weight_f, halo_type);
+          }
+        }
+      }
+    }
+
+    cs_gradient_scalar_synced_input(var_name,
+                                    gradient_type,
+                                    halo_type,
+                                    inc,
+                                    nswrgp,
+                                    iphydp,
+                                    w_stride,
+                                    iwarnp,
+                                    (cs_gradient_limit_t)imligp,
+                                    epsrgp,
+                                    climgp,
+                                    frcxt,
+                                    bc_coeffs,
+                                    (const cs_real_t *)pvar,
+                                    gweight, /* Weighted gradient */
+                                    NULL, /* internal coupling */
+                                    grad);
+
+    if (halo != NULL)
+      cs_halo_sync_var(halo, halo_type, visel);
+
+  }
+
+  const bool reconstruct = (grad != NULL);
+
+  if (compute_div) {
+    ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      diverg[c_id] = 0.;
+    });
+  }
+
+  /* Mass flow through interior faces */
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t f_mass_flux
+      = i_visc[face_id]*(pvar[ii] - pvar[jj] + dpvar[ii] - dpvar[jj]);
+
+    if (reconstruct) {
+      cs_real_t dpf[3], dij[3];
+      for (int k = 0; k < 3; k++) {
+        dpf[k] = 0.5*(visel[ii]*grad[ii][k] + visel[jj]*grad[jj][k]);
+        /*---> Dij = IJ - (IJ.N) N = II' - JJ' */
+        dij[k] = diipf[face_id][k] - djjpf[face_id][k];
+      }
+      f_mass_flux +=   cs_math_3_dot_product(dpf, dij)
+                     * i_f_face_surf[face_id]/i_dist[face_id];
+    }
+
+    const cs_real_t flux = i_massflux[face_id] + f_mass_flux;
+    i_massflux[face_id] = flux;
+
+    if (compute_div) {
+      if (ii < n_cells)
+        cs_dispatch_sum(&diverg[ii], flux, i_sum_type);
+      if (jj < n_cells)
+        cs_dispatch_sum(&diverg[jj], -flux, i_sum_type);
+    }
+  });
+
+  /* Mass flow through boundary faces */
+
+  ctx.parallel_for_b_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
+    cs_lnum_t ii = b_face_cells[face_id];
+
+    cs_real_t pip = pvar[ii];
+    if (reconstruct)
+      pip += cs_math_3_dot_product(grad[ii], diipb[face_id]);
+
+    cs_real_t pfac =   inc*cofafp[face_id]
+                     + cofbfp[face_id]*(pip + dpvar[ii]);
+
+    const cs_real_t flux = b_massflux[face_id] + b_visc[face_id]*pfac;
+    b_massflux[face_id] = flux;
+
+    if (compute_div)
+      cs_dispatch_sum(&diverg[ii], flux, b_sum_type);
+  });
+
+  ctx.wait();
+
+  CS_FREE_HD(grad);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add the explicit part of the pressure gradient term to the mass flux
@@ -12645,6 +13581,170 @@ cs_anisotropic_diffusion_potential(const int                   f_id,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate reuse of the cell gradients computed by scalar
+ *        convection/diffusion operators for a given field.
+ *
+ * While active, the gradient computed for given values of the field's
+ * variable (or of its previous time step values) is saved, and reused by
+ * subsequent unsteady convection/diffusion operator calls on the same array
+ * (for example explicit and implicit balance passes, estimators, and
+ * face flux rebuilding), so that the gradient-based reconstruction is not
+ * redone. The caller must call
+ * \ref cs_convection_diffusion_gradient_cache_invalidate whenever values
+ * of an array used with the cache are modified.
+ *
+ * \param[in]  f_id  field id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_gradient_cache_start(int  f_id)
+{
+  if (_gradient_cache_f_id != f_id)
+    cs_convection_diffusion_gradient_cache_end();
+
+  _gradient_cache_f_id = f_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate cached gradients associated with a given array, whose
+ *        values have been or will be modified.
+ *
+ * \param[in]  pvar  pointer to array of variable values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_gradient_cache_invalidate(const cs_real_t  *pvar)
+{
+  for (int i = 0; i < 2; i++) {
+    if (_gradient_cache[i].pvar == pvar)
+      _gradient_cache[i].pvar = nullptr;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update cached gradients associated with a given array for an
+ *        increment of its values.
+ *
+ * This must be called when the increment is added to the values. When
+ * the cached gradient is a non-limited, unweighted least-squares gradient,
+ * it is updated using \ref cs_gradient_scalar_lsq_update, so only cells
+ * where the increment exceeds the given tolerance (and their neighbors)
+ * are updated. Otherwise, the matching cache entry is invalidated.
+ *
+ * \param[in]       pvar       pointer to array of variable values
+ * \param[in, out]  dpvar      variable increment (synchronized here)
+ * \param[in]       tolerance  increment tolerance
+ *
+ * \return  true if a cached gradient was updated, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_convection_diffusion_gradient_cache_update(const cs_real_t  *pvar,
+                                              cs_real_t        *dpvar,
+                                              double            tolerance)
+{
+  bool updated = false;
+
+  for (int i = 0; i < 2; i++) {
+    cs_cd_gradient_cache_t *c = _gradient_cache + i;
+    if (c->pvar != pvar)
+      continue;
+
+    if (   c->updatable && c->inc == 1 && c->grad != nullptr
+        && updated == false) {
+      const cs_field_t *f = cs_field_by_id(_gradient_cache_f_id);
+      updated = cs_gradient_scalar_lsq_update(f->name,
+                                              c->halo_type,
+                                              tolerance,
+                                              c->bc_coeffs,
+                                              dpvar,
+                                              c->grad);
+    }
+
+    if (updated == false)
+      c->pvar = nullptr;
+  }
+
+  return updated;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Deactivate reuse of scalar convection/diffusion cell gradients
+ *        and free associated cache.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_gradient_cache_end(void)
+{
+  for (int i = 0; i < 2; i++) {
+    _gradient_cache[i].pvar = nullptr;
+    _gradient_cache[i].bc_coeffs = nullptr;
+    CS_FREE_HD(_gradient_cache[i].grad);
+  }
+
+  _gradient_cache_f_id = -1;
+  _gradient_cache_next = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log which specialized interior faces kernel variants were used
+ *        for scalar convection/diffusion terms of each field, and free
+ *        associated tracking info.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_finalize(void)
+{
+  int n_used = 0;
+  for (int i = 0; i < _n_cd_kernel_variants; i++) {
+    if (_cd_kernel_variants[i].n_calls > 0)
+      n_used++;
+  }
+
+  if (n_used > 0) {
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Scalar convection/diffusion interior faces kernels\n"
+                    "--------------------------------------------------\n\n"
+                    "  %-32s %12s %12s  %s\n"),
+                  _("field"), _("calls"), _("specialized"),
+                  _("last variant"));
+
+    for (int i = 0; i < _n_cd_kernel_variants; i++) {
+      const cs_cd_kernel_variant_t *v = _cd_kernel_variants + i;
+      if (v->n_calls == 0)
+        continue;
+      char name[64];
+      _cd_variant_name(v->variant, name);
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  %-32s %12llu %12llu  %s\n",
+                    cs_field_by_id(i)->name,
+                    v->n_calls, v->n_spec, name);
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+    cs_log_separator(CS_LOG_PERFORMANCE);
+
+  }
+
+  BFT_FREE(_cd_kernel_variants);
+  _n_cd_kernel_variants = 0;
+
+  cs_convection_diffusion_gradient_cache_end();
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -720,6 +720,81 @@ cs_face_diffusion_potential(const int                   f_id,
                             cs_real_t                  *i_massflux,
                             cs_real_t                  *b_massflux);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Update the face mass flux with the face gradient of a pressure
+ * (or pressure increment) and of its last, non reconstructed, increment,
+ * and optionally compute the divergence of the updated mass flux.
+ *
+ * This is equivalent to a call to \ref cs_face_diffusion_potential with
+ * pvar, followed by a call with dpvar, inc = 0 and nswrgp = 0, and to
+ * a call to \ref cs_divergence on the resulting mass flux, but all
+ * face contributions are handled in a single pass over the faces.
+ *
+ * \param[in]     f_id          field id (or -1)
+ * \param[in]     m             pointer to mesh
+ * \param[in]     fvq           pointer to finite volume quantities
+ * \param[in]     inc           indicator for pvar
+ *                               - 0 when solving an increment
+ *                               - 1 otherwise
+ * \param[in]     imrgra        indicator
+ *                               - 0 iterative gradient
+ *                               - 1 least squares gradient
+ * \param[in]     nswrgp        number of reconstruction sweeps for the
+ *                               gradients of pvar
+ * \param[in]     imligp        clipping gradient method
+ *                               - < 0 no clipping
+ *                               - = 0 thank to neighbooring gradients
+ *                               - = 1 thank to the mean gradient
+ * \param[in]     iphydp        hydrostatic pressure indicator
+ * \param[in]     iwgrp         indicator
+ *                               - 1 weight gradient by vicosity*porosity
+ *                               - weighting determined by field options
+ * \param[in]     iwarnp        verbosity
+ * \param[in]     epsrgp        relative precision for the gradient
+ *                               reconstruction
+ * \param[in]     climgp        clipping coeffecient for the computation of
+ *                               the gradient
+ * \param[in]     frcxt         body force creating the hydrostatic pressure
+ * \param[in]     pvar          solved variable (reconstructed contribution)
+ * \param[in]     dpvar         last increment (non reconstructed
+ *                               contribution, homogeneous BCs)
+ * \param[in]     bc_coeffs     boundary condition structure for the variable
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the r.h.s.
+ * \param[in]     visel         viscosity by cell
+ * \param[in,out] i_massflux    mass flux at interior faces
+ * \param[in,out] b_massflux    mass flux at boundary faces
+ * \param[out]    diverg        divergence of the updated mass flux, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_face_diffusion_potential_fused(const int                   f_id,
+                                  const cs_mesh_t            *m,
+                                  cs_mesh_quantities_t       *fvq,
+                                  int                         inc,
+                                  int                         imrgra,
+                                  int                         nswrgp,
+                                  int                         imligp,
+                                  int                         iphydp,
+                                  int                         iwgrp,
+                                  int                         iwarnp,
+                                  double                      epsrgp,
+                                  double                      climgp,
+                                  cs_real_3_t                *frcxt,
+                                  cs_real_t                  *pvar,
+                                  cs_real_t                  *dpvar,
+                                  const cs_field_bc_coeffs_t *bc_coeffs,
+                                  const cs_real_t             i_visc[],
+                                  const cs_real_t             b_visc[],
+                                  cs_real_t                  *visel,
+                                  cs_real_t                  *i_massflux,
+                                  cs_real_t                  *b_massflux,
+                                  cs_real_t                  *diverg);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Add the explicit part of the pressure gradient term to the mass flux
@@ -965,6 +1040,81 @@ cs_anisotropic_diffusion_potential(const int                   f_id,
                                    const cs_real_t             weighb[],
                                    cs_real_t                  *diverg);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate reuse of the cell gradients computed by scalar
+ *        convection/diffusion operators for a given field.
+ *
+ * While active, the gradient computed for given values of the field's
+ * variable (or of its previous time step values) is saved, and reused by
+ * subsequent unsteady convection/diffusion operator calls on the same array.
+ * The caller must call cs_convection_diffusion_gradient_cache_invalidate
+ * whenever values of an array used with the cache are modified.
+ *
+ * \param[in]  f_id  field id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_gradient_cache_start(int  f_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate cached gradients associated with a given array, whose
+ *        values have been or will be modified.
+ *
+ * \param[in]  pvar  pointer to array of variable values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_gradient_cache_invalidate(const cs_real_t  *pvar);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update cached gradients associated with a given array for an
+ *        increment of its values.
+ *
+ * This must be called when the increment is added to the values. When
+ * the cached gradient is a non-limited, unweighted least-squares gradient,
+ * it is updated using \ref cs_gradient_scalar_lsq_update, so only cells
+ * where the increment exceeds the given tolerance (and their neighbors)
+ * are updated. Otherwise, the matching cache entry is invalidated.
+ *
+ * \param[in]       pvar       pointer to array of variable values
+ * \param[in, out]  dpvar      variable increment (synchronized here)
+ * \param[in]       tolerance  increment tolerance
+ *
+ * \return  true if a cached gradient was updated, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_convection_diffusion_gradient_cache_update(const cs_real_t  *pvar,
+                                              cs_real_t        *dpvar,
+                                              double            tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Deactivate reuse of scalar convection/diffusion cell gradients
+ *        and free associated cache.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_gradient_cache_end(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log which specialized interior faces kernel variants were used
+ *        for scalar convection/diffusion terms of each field, and free
+ *        associated tracking info.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
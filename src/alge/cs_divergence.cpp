@@ -368,14 +368,29 @@ cs_mass_flux(const cs_mesh_t             *m,
 
   ctx_c.wait();
 
-  /* ---> Periodicity and parallelism treatment */
+  /* ---> Periodicity and parallelism treatment
+
+     The halo exchange is started here, and completed only when ghost
+     values are needed, so as to overlap it with the boundary face
+     computations and with interior faces not adjacent to ghost cells. */
+
+  bool halo_pending = false;
 
   if (halo != NULL) {
-    cs_halo_sync_var_strided(halo, halo_type, (cs_real_t *)qdm, 3);
-    if (cs_glob_mesh->n_init_perio > 0)
-      cs_halo_perio_sync_var_vect(halo, halo_type, (cs_real_t *)qdm, 3);
+    cs_halo_sync_pack(halo, halo_type, CS_REAL_TYPE, 3, qdm, NULL, NULL);
+    cs_halo_sync_start(halo, qdm, NULL);
+    halo_pending = true;
   }
 
+  auto halo_wait = [&]() {
+    if (halo_pending) {
+      cs_halo_sync_wait(halo, qdm, NULL);
+      if (cs_glob_mesh->n_init_perio > 0)
+        cs_halo_perio_sync_var_vect(halo, halo_type, (cs_real_t *)qdm, 3);
+      halo_pending = false;
+    }
+  };
+
   /* Standard mass flux */
   if (itypfl == 1) {
 
@@ -485,9 +500,10 @@ cs_mass_flux(const cs_mesh_t             *m,
 
   if (nswrgu <= 1) {
 
-    /* Interior faces */
+    /* Interior faces (overlapping the halo exchange) */
 
-    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+    ctx.parallel_for_i_faces_overlap
+      (m, halo_wait, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
       cs_lnum_t ii = i_face_cells[face_id][0];
       cs_lnum_t jj = i_face_cells[face_id][1];
       cs_lnum_t _p = is_p*face_id;
@@ -522,6 +538,8 @@ cs_mass_flux(const cs_mesh_t             *m,
   ctx.wait();
   ctx_c.wait();
 
+  halo_wait();
+
   /*==========================================================================
     4. Compute mass flux with reconstruction method if the mesh is
        non orthogonal
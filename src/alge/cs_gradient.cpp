@@ -59,6 +59,8 @@
 #include "cs_blas.h"
 #include "cs_boundary_conditions.h"
 #include "cs_cell_to_vertex.h"
+#include "cs_comm_stats.h"
+#include "cs_dispatch.h"
 #include "cs_ext_neighborhood.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
@@ -73,6 +75,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_porous_model.h"
+#include "cs_profiling.h"
 #include "cs_prototypes.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
@@ -137,6 +140,33 @@ typedef struct {
 
 } cs_gradient_quantities_t;
 
+/* Saved scalar least-squares cocg at boundary cells, for a given set
+   of boundary condition coefficients */
+
+typedef struct {
+
+  const cs_real_t  *coefb_p;        /* associated coefb array (search key) */
+  bool              extended;       /* extended neighborhood used ? */
+  int               fvq_count;      /* mesh quantities computation count */
+
+  cs_real_t        *coefb;          /* copy of coefb values used */
+  cs_cocg_6_t      *cocg_b;         /* inverted cocg at boundary cells */
+
+} cs_gradient_lsq_b_cocg_t;
+
+/* Timed gradient computation phases (the remainder of the total
+   time is spent in face and cell loops) */
+
+typedef enum {
+
+  CS_GRADIENT_PHASE_COCG,     /* cocg matrix setup */
+  CS_GRADIENT_PHASE_HALO,     /* halo synchronization */
+  CS_GRADIENT_PHASE_CLIP,     /* clipping and regularization */
+
+  CS_GRADIENT_N_PHASES
+
+} cs_gradient_phase_t;
+
 /* Basic per gradient computation options and logging */
 /*----------------------------------------------------*/
 
@@ -152,6 +182,15 @@ typedef struct _cs_gradient_info_t {
   unsigned long        n_iter_tot;         /* Total number of iterations */
 
   cs_timer_counter_t   t_tot;              /* Total time used */
+  cs_timer_counter_t   t_phase[CS_GRADIENT_N_PHASES];  /* Time per phase */
+
+  double               bytes_iter;         /* Estimated bytes moved per
+                                              additional iteration */
+  double               flops_iter;         /* Estimated floating-point
+                                              operations per iteration */
+  double               bytes_tot;          /* Total estimated bytes moved */
+  double               flops_tot;          /* Total estimated floating-point
+                                              operations */
 
 } cs_gradient_info_t;
 
@@ -180,11 +219,28 @@ const char *cs_gradient_type_name[]
 static cs_timer_counter_t   _gradient_t_tot;     /* Total time in gradients */
 static int _gradient_stat_id = -1;
 
+static cs_timer_counter_t   _gradient_t_phase[CS_GRADIENT_N_PHASES];
+static int _gradient_phase_stat_id[CS_GRADIENT_N_PHASES] = {-1, -1, -1};
+
+static const char *_gradient_phase_name[]
+  = {N_("cocg setup"),
+     N_("halo synchronization"),
+     N_("clipping")};
+
+/* Info structure of gradient being currently computed, or NULL */
+
+static cs_gradient_info_t  *_gradient_info_cur = nullptr;
+
 /* Gradient quantities */
 
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = nullptr;
 
+/* Saved boundary cocg for scalar least-squares gradients */
+
+static int                        _n_lsq_b_cocg = 0;
+static cs_gradient_lsq_b_cocg_t  *_lsq_b_cocg = nullptr;
+
 /* Multithread assembly algorithm selection */
 
 const cs_e2n_sum_t _e2n_sum_type = CS_E2N_SUM_SCATTER;
@@ -287,6 +343,24 @@ _gradient_quantities_destroy(void)
   _n_gradient_quantities = 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free saved boundary cocg values for scalar least-squares gradients.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_lsq_b_cocg_destroy(void)
+{
+  for (int i = 0; i < _n_lsq_b_cocg; i++) {
+    CS_FREE_HD(_lsq_b_cocg[i].coefb);
+    CS_FREE_HD(_lsq_b_cocg[i].cocg_b);
+  }
+
+  BFT_FREE(_lsq_b_cocg);
+  _n_lsq_b_cocg = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Factorize dense p*p symmetric matrices.
  * Only the lower triangular part is stored and the factorization is performed
@@ -390,6 +464,13 @@ _gradient_info_create(const char          *name,
   new_info->n_iter_tot = 0;
 
   CS_TIMER_COUNTER_INIT(new_info->t_tot);
+  for (int i = 0; i < CS_GRADIENT_N_PHASES; i++)
+    CS_TIMER_COUNTER_INIT(new_info->t_phase[i]);
+
+  new_info->bytes_iter = 0;
+  new_info->flops_iter = 0;
+  new_info->bytes_tot = 0;
+  new_info->flops_tot = 0;
 
   return new_info;
 }
@@ -432,6 +513,137 @@ _gradient_info_update_iter(cs_gradient_info_t  *this_info,
     this_info->n_iter_min = n_iter;
 
   this_info->n_iter_tot += n_iter;
+
+  this_info->bytes_tot += n_iter * this_info->bytes_iter;
+  this_info->flops_tot += n_iter * this_info->flops_iter;
+}
+
+/*----------------------------------------------------------------------------
+ * Add elapsed time to a given gradient computation phase.
+ *
+ * The time is added to the global phase counters, to the associated
+ * timer statistics, and to the info structure of the gradient being
+ * currently computed, if any.
+ *
+ * parameters:
+ *   phase <-- gradient computation phase
+ *   t0    <-- phase start time
+ *   t1    <-- phase end time
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_phase_add(cs_gradient_phase_t   phase,
+                    const cs_timer_t     *t0,
+                    const cs_timer_t     *t1)
+{
+  cs_timer_counter_add_diff(&(_gradient_t_phase[phase]), t0, t1);
+
+  if (_gradient_info_cur != nullptr)
+    cs_timer_counter_add_diff(&(_gradient_info_cur->t_phase[phase]), t0, t1);
+
+  if (_gradient_phase_stat_id[phase] > -1)
+    cs_timer_stats_add_diff(_gradient_phase_stat_id[phase], t0, t1);
+}
+
+/*----------------------------------------------------------------------------
+ * Add the estimated memory traffic and operation count of a
+ * gradient computation call, and prepare estimates for its iterations.
+ *
+ * This is a simple streaming model, based on mesh sizes: indirect data
+ * is assumed to be loaded once per adjacency, and cache reuse is ignored.
+ * It is intended to estimate the arithmetic intensity and effective
+ * bandwidth of the different gradient types, not to replace a profiler.
+ *
+ * parameters:
+ *   this_info <-> pointer to gradient info structure
+ *   m         <-- pointer to associated mesh structure
+ *   halo_type <-- halo type (extended or not)
+ *   stride    <-- number of variable components (1, 3, or 6)
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_info_update_traffic(cs_gradient_info_t  *this_info,
+                              const cs_mesh_t     *m,
+                              cs_halo_type_t       halo_type,
+                              int                  stride)
+{
+  const double r_s = sizeof(cs_real_t);
+  const double l_s = sizeof(cs_lnum_t);
+  const double s = stride, g = 3*stride;
+
+  const double n_cells = m->n_cells;
+  const double n_i_faces = m->n_i_faces;
+  const double n_b_faces = m->n_b_faces;
+
+  /* Green-Gauss pass: face weight, normal and reconstruction vector on
+     interior faces, normal and I'I vector on boundary faces;
+     right-hand side contributions are read and written. */
+
+  double gg_bytes =   n_i_faces * (2*l_s + 7*r_s + 2*s*r_s + 4*g*r_s)
+                    + n_b_faces * (l_s + 6*r_s + (2*s + s*s)*r_s + 2*g*r_s)
+                    + n_cells * (s + 9 + 2*g)*r_s;
+  double gg_flops =   n_i_faces * 20*s
+                    + n_b_faces * (10 + 2*s)*s
+                    + n_cells * 18*s;
+
+  /* Additional gradient reads for reconstruction sweeps */
+
+  double gg_rc_bytes = (2*n_i_faces + n_b_faces) * g*r_s;
+
+  /* Least-squares pass: cell centers on interior faces and extended
+     neighbors, normal, distance and I'I vector on boundary faces. */
+
+  double n_ext = 0;
+  if (halo_type == CS_HALO_EXTENDED && m->cell_cells_idx != nullptr)
+    n_ext = m->cell_cells_idx[m->n_cells];
+
+  double lsq_bytes =   n_i_faces * (2*l_s + 6*r_s + 2*s*r_s + 4*g*r_s)
+                     + n_ext * (l_s + 3*r_s + s*r_s + 2*g*r_s)
+                     + n_b_faces * (l_s + 7*r_s + (2*s + s*s)*r_s + 2*g*r_s)
+                     + n_cells * (s + 6 + 2*g)*r_s;
+  double lsq_flops =   (n_i_faces + n_ext) * (8 + 12*s)
+                     + n_b_faces * (10 + 12*s)
+                     + n_cells * 15*s;
+
+  double bytes_call = 0, bytes_iter = 0, flops_call = 0, flops_iter = 0;
+
+  switch (this_info->type) {
+  case CS_GRADIENT_GREEN_ITER:
+    bytes_call = gg_bytes;
+    flops_call = gg_flops;
+    bytes_iter = gg_bytes + gg_rc_bytes;
+    flops_iter = gg_flops + (2*n_i_faces + n_b_faces) * 6*s;
+    break;
+  case CS_GRADIENT_LSQ:
+    bytes_call = lsq_bytes;
+    flops_call = lsq_flops;
+    break;
+  case CS_GRADIENT_GREEN_LSQ:
+    bytes_call = lsq_bytes + gg_bytes + gg_rc_bytes;
+    flops_call = lsq_flops + gg_flops + (2*n_i_faces + n_b_faces) * 6*s;
+    break;
+  case CS_GRADIENT_GREEN_VTX:
+    {
+      /* Add cell to vertex interpolation */
+      const cs_adjacency_t *c2v = (cs_glob_mesh_adjacencies != nullptr) ?
+        cs_glob_mesh_adjacencies->c2v : nullptr;
+      double n_c2v = (c2v != nullptr) ? c2v->idx[m->n_cells] : 0;
+      bytes_call = gg_bytes + n_c2v * (l_s + (1 + 2*s)*r_s);
+      flops_call = gg_flops + n_c2v * 2*s;
+    }
+    break;
+  case CS_GRADIENT_GREEN_R:
+    bytes_call = gg_bytes + gg_rc_bytes + n_cells * (9 + g)*r_s;
+    flops_call = gg_flops + (2*n_i_faces + n_b_faces) * 6*s + n_cells * 18*s;
+    break;
+  default:
+    break;
+  }
+
+  this_info->bytes_iter = bytes_iter;
+  this_info->flops_iter = flops_iter;
+  this_info->bytes_tot += bytes_call;
+  this_info->flops_tot += flops_call;
 }
 
 /*----------------------------------------------------------------------------
@@ -462,6 +674,45 @@ _gradient_info_dump(cs_gradient_info_t *this_info)
   cs_log_printf(CS_LOG_PERFORMANCE,
                 _("  Total elapsed time:    %.3f\n"),
                 this_info->t_tot.nsec*1e-9);
+
+  if (n_calls < 1 || this_info->t_tot.nsec < 1)
+    return;
+
+  /* Time per phase */
+
+  double t_tot = this_info->t_tot.nsec*1e-9;
+  double t_loops = t_tot;
+
+  for (int i = 0; i < CS_GRADIENT_N_PHASES; i++) {
+    double t_p = this_info->t_phase[i].nsec*1e-9;
+    t_loops -= t_p;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "    %-22s %12.3f (%5.1f %%)\n",
+                  _(_gradient_phase_name[i]), t_p, 100.*t_p/t_tot);
+  }
+  if (t_loops < 0)
+    t_loops = 0;
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "    %-22s %12.3f (%5.1f %%)\n",
+                _("face and cell loops"), t_loops, 100.*t_loops/t_tot);
+
+  /* Estimated memory traffic and arithmetic intensity
+     (summed over ranks, as gradient computations are collective) */
+
+  double est[2] = {this_info->bytes_tot, this_info->flops_tot};
+
+  cs_parall_sum(2, CS_DOUBLE, est);
+
+  if (est[0] > 0 && t_loops > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Estimated data moved:  %.3g GiB "
+                    "(%.3g GiB/s in loops)\n"
+                    "  Estimated intensity:   %.3g flop/byte "
+                    "(%.3g Gflop/s in loops)\n"),
+                  est[0]/(1024.*1024.*1024.),
+                  est[0]/(1024.*1024.*1024.)/t_loops,
+                  est[1]/est[0],
+                  est[1]*1e-9/t_loops);
 }
 
 /*----------------------------------------------------------------------------
@@ -683,11 +934,14 @@ _sync_scalar_gradient_halo(const cs_mesh_t  *m,
                            cs_real_3_t       grad[])
 {
   if (m->halo != nullptr) {
+    cs_timer_t t0 = cs_timer_time();
     cs_halo_sync_var_strided
       (m->halo, halo_type, (cs_real_t *)grad, 3);
     if (m->have_rotation_perio)
       cs_halo_perio_sync_var_vect
         (m->halo, halo_type, (cs_real_t *)grad, 3);
+    cs_timer_t t1 = cs_timer_time();
+    _gradient_phase_add(CS_GRADIENT_PHASE_HALO, &t0, &t1);
   }
 }
 
@@ -710,6 +964,7 @@ _sync_strided_gradient_halo(const cs_mesh_t         *m,
                             cs_real_t (*restrict grad)[stride][3])
 {
   if (m->halo != nullptr) {
+    cs_timer_t t0 = cs_timer_time();
     cs_halo_sync_var_strided(m->halo, halo_type, (cs_real_t *)grad, stride*3);
     if (m->have_rotation_perio) {
       if (stride == 1)
@@ -721,6 +976,8 @@ _sync_strided_gradient_halo(const cs_mesh_t         *m,
                                              halo_type,
                                              (cs_real_t *)grad);
     }
+    cs_timer_t t1 = cs_timer_time();
+    _gradient_phase_add(CS_GRADIENT_PHASE_HALO, &t0, &t1);
   }
 }
 
@@ -1137,6 +1394,98 @@ _scalar_gradient_clipping(const cs_mesh_t              *m,
   BFT_FREE(_clip_factor);
 }
 
+/*----------------------------------------------------------------------------
+ * Select the face to cell sum algorithm for Green-Gauss gradients.
+ *
+ * When the dispatch context would require atomic sums for face loops
+ * (i.e. on device), or a gather algorithm is requested through
+ * cs_glob_e2n_sum_type, a cell-based gather using the cells to
+ * interior and boundary faces adjacencies is used, so that each cell
+ * is handled by a single thread and no atomic sums are needed.
+ *
+ * parameters:
+ *   ctx <-- reference to dispatch context
+ *   m   <-- pointer to associated mesh structure
+ *
+ * returns:
+ *   sum type to use for face contributions
+ *----------------------------------------------------------------------------*/
+
+static cs_dispatch_sum_type_t
+_gg_sum_type(cs_dispatch_context  &ctx,
+             const cs_mesh_t      *m)
+{
+  cs_dispatch_sum_type_t sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+
+  if (   sum_type != CS_DISPATCH_SUM_ATOMIC
+      && cs_glob_e2n_sum_type != CS_E2N_SUM_GATHER)
+    return sum_type;
+
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  if (m != cs_glob_mesh || ma == nullptr)
+    return sum_type;
+
+  if (ma->cell_i_faces == nullptr)
+    cs_mesh_adjacencies_update_cell_i_faces();
+
+  if (ma->cell_i_faces != nullptr && ma->cell_b_faces_idx != nullptr)
+    sum_type = CS_DISPATCH_SUM_GATHER;
+
+  return sum_type;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the (possibly cell-weighted) interpolation weight of an
+ * interior face for scalar Green-Gauss gradients.
+ *
+ * parameters:
+ *   f_id       <-- interior face id
+ *   ii         <-- first adjacent cell id
+ *   jj         <-- second adjacent cell id
+ *   weight     <-- face interpolation weights
+ *   c_weight_s <-- scalar cell weights, or nullptr
+ *   c_weight_t <-- symmetric tensor cell weights, or nullptr
+ *
+ * returns:
+ *   weight associated with cell ii
+ *----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline cs_real_t
+_i_face_ktpond(cs_lnum_t           f_id,
+               cs_lnum_t           ii,
+               cs_lnum_t           jj,
+               const cs_real_t     weight[],
+               const cs_real_t     c_weight_s[],
+               const cs_real_6_t   c_weight_t[])
+{
+  cs_real_t ktpond = weight[f_id]; /* no cell weighting */
+
+  if (c_weight_s != nullptr) {
+    ktpond =   weight[f_id] * c_weight_s[ii]
+             / (       weight[f_id] * c_weight_s[ii]
+                + (1.0-weight[f_id])* c_weight_s[jj]);
+  }
+  else if (c_weight_t != nullptr) {
+    cs_real_t sum[6], inv_sum[6];
+
+    for (cs_lnum_t kk = 0; kk < 6; kk++)
+      sum[kk] =        weight[f_id] *c_weight_t[ii][kk]
+                + (1.0-weight[f_id])*c_weight_t[jj][kk];
+
+    cs_math_sym_33_inv_cramer(sum, inv_sum);
+
+    ktpond =   weight[f_id] / 3.0
+             * (  inv_sum[0]*c_weight_t[ii][0]
+                + inv_sum[1]*c_weight_t[ii][1]
+                + inv_sum[2]*c_weight_t[ii][2]
+                + 2.0 * (  inv_sum[3]*c_weight_t[ii][3]
+                         + inv_sum[4]*c_weight_t[ii][4]
+                         + inv_sum[5]*c_weight_t[ii][5]));
+  }
+
+  return ktpond;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize gradient and right-hand side for scalar gradient reconstruction.
  *
@@ -1254,10 +1603,115 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
       grad[cell_id][j] = 0.0;
   }
 
+  /* Cell-based gather of face contributions (no atomic sums needed) */
+  /*-----------------------------------------------------------------*/
+
+  cs_dispatch_context ctx;
+
+  if (_gg_sum_type(ctx, m) == CS_DISPATCH_SUM_GATHER) {
+
+    const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+    const cs_lnum_t *restrict cell_cells_idx = ma->cell_cells_idx;
+    const cs_lnum_t *restrict cell_i_faces = ma->cell_i_faces;
+    const short int *restrict cell_i_faces_sgn = ma->cell_i_faces_sgn;
+    const cs_lnum_t *restrict cell_b_faces_idx = ma->cell_b_faces_idx;
+    const cs_lnum_t *restrict cell_b_faces = ma->cell_b_faces;
+
+    const bool *c_coupled_faces
+      = (cpl != nullptr) ? (const bool *)cpl->coupled_faces : nullptr;
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+
+      cs_real_t g[3] = {0., 0., 0.};
+
+      /* Contribution from interior faces */
+
+      const cs_lnum_t s_id = cell_cells_idx[c_id];
+      const cs_lnum_t e_id = cell_cells_idx[c_id + 1];
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        const cs_lnum_t f_id = cell_i_faces[i];
+        const cs_lnum_t ii = i_face_cells[f_id][0];
+        const cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_t ktpond = _i_face_ktpond(f_id, ii, jj, weight,
+                                          c_weight_s, c_weight_t);
+
+        cs_real_t pfaci = 0., pfacj = 0.;
+
+        if (hyd_p_flag == 1) {
+          cs_real_t poro_0 = (is_porous) ? i_poro_duq_0[f_id] : 0.;
+          cs_real_t poro_1 = (is_porous) ? i_poro_duq_1[f_id] : 0.;
+
+          pfaci
+            =  ktpond
+                 * (  cs_math_3_distance_dot_product(cell_f_cen[ii],
+                                                     i_f_face_cog[f_id],
+                                                     f_ext[ii])
+                    + poro_0)
+            +  (1.0 - ktpond)
+                 * (  cs_math_3_distance_dot_product(cell_f_cen[jj],
+                                                     i_f_face_cog[f_id],
+                                                     f_ext[jj])
+                    + poro_1);
+          pfacj = pfaci;
+        }
+
+        pfaci += (1.0-ktpond) * (pvar[jj] - pvar[ii]);
+        pfacj -=      ktpond  * (pvar[jj] - pvar[ii]);
+
+        cs_real_t pfac = (cell_i_faces_sgn[i] > 0) ? pfaci : -pfacj;
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          g[j] += pfac * i_f_face_normal[f_id][j];
+      }
+
+      /* Contribution from boundary faces */
+
+      const cs_lnum_t s_id_b = cell_b_faces_idx[c_id];
+      const cs_lnum_t e_id_b = cell_b_faces_idx[c_id + 1];
+
+      for (cs_lnum_t i = s_id_b; i < e_id_b; i++) {
+        const cs_lnum_t f_id = cell_b_faces[i];
+
+        cs_real_t pfac =   inc*coefap[f_id]
+                         + (coefbp[f_id]-1.0)*pvar[c_id];
+
+        if (hyd_p_flag == 1) {
+          cs_real_t poro = (is_porous) ? b_poro_duq[f_id] : 0.;
+          pfac += coefbp[f_id]
+                  * (  cs_math_3_distance_dot_product(cell_f_cen[c_id],
+                                                      b_f_face_cog[f_id],
+                                                      f_ext[c_id])
+                     + poro);
+        }
+        else if (c_coupled_faces != nullptr) {
+          if (c_coupled_faces[f_id])
+            continue;
+        }
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          g[j] += pfac * b_f_face_normal[f_id][j];
+      }
+
+      for (cs_lnum_t j = 0; j < 3; j++)
+        grad[c_id][j] = g[j];
+
+    });
+
+    ctx.wait();
+
+    /* Contribution from coupled faces */
+    if (hyd_p_flag != 1 && cpl != nullptr)
+      cs_internal_coupling_initialize_scalar_gradient
+        (cpl, c_weight, pvar, grad);
+
+  }
+
   /* Case with hydrostatic pressure */
   /*--------------------------------*/
 
-  if (hyd_p_flag == 1) {
+  else if (hyd_p_flag == 1) {
 
     /* Contribution from interior faces */
 
@@ -1684,6 +2138,8 @@ _compute_cell_cocg_it(const cs_mesh_t               *m,
                       const cs_internal_coupling_t  *ce,
                       cs_gradient_quantities_t      *gq)
 {
+  cs_timer_t t0 = cs_timer_time();
+
   /* Local variables */
 
   const int n_cells = m->n_cells;
@@ -1762,6 +2218,9 @@ _compute_cell_cocg_it(const cs_mesh_t               *m,
   for (cell_id = 0; cell_id < n_cells; cell_id++)
     cs_math_33_inv_cramer_in_place(cocg[cell_id]);
 
+  cs_timer_t t1 = cs_timer_time();
+  _gradient_phase_add(CS_GRADIENT_PHASE_COCG, &t0, &t1);
+
   return cocg;
 }
 
@@ -2375,6 +2834,8 @@ _compute_cell_cocg_lsq(const cs_mesh_t               *m,
                        cs_gradient_quantities_t      *gq)
 
 {
+  cs_timer_t t0 = cs_timer_time();
+
   const int n_cells = m->n_cells;
   const int n_cells_ext = m->n_cells_with_ghosts;
   const int n_i_groups = m->i_face_numbering->n_groups;
@@ -2559,6 +3020,9 @@ _compute_cell_cocg_lsq(const cs_mesh_t               *m,
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     _math_6_inv_cramer_sym_in_place(cocg[c_id]);
   }
+
+  cs_timer_t t1 = cs_timer_time();
+  _gradient_phase_add(CS_GRADIENT_PHASE_COCG, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------
@@ -2672,6 +3136,8 @@ _recompute_lsq_scalar_cocg(const cs_mesh_t                *m,
                            const cs_cocg_t               (*restrict cocgb)[6],
                            cs_cocg_t                     (*restrict cocg)[6])
 {
+  cs_timer_t t0 = cs_timer_time();
+
   const cs_real_t *coefbp = bc_coeffs->b;
   const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
   const cs_lnum_t *restrict cell_b_faces_idx
@@ -2720,6 +3186,156 @@ _recompute_lsq_scalar_cocg(const cs_mesh_t                *m,
     _math_6_inv_cramer_sym_in_place(cocg[c_id]);
 
   } /* loop on boundary cells */
+
+  cs_timer_t t1 = cs_timer_time();
+  _gradient_phase_add(CS_GRADIENT_PHASE_COCG, &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------
+ * Restore scalar least-squares cocg at boundaries from saved values,
+ * if those are still valid for the given boundary conditions.
+ *
+ * Saved values are valid if the mesh quantities were not recomputed
+ * (i.e. no mesh motion) and the BC coefficients are unchanged.
+ * If values are not valid, the matching saved values entry is returned
+ * through saved_id, so it may be updated using
+ * _lsq_scalar_b_cocg_save after cocg is recomputed.
+ *
+ * parameters:
+ *   m          <-- pointer to associated mesh structure
+ *   extended   <-- use extended neighborhood ?
+ *   accel      <-- does cocg point to device memory ?
+ *   bc_coeffs  <-- B.C. structure for boundary face normals
+ *   cocg       <-> cocg values, updated at boundary cells if restored
+ *   saved_id   --> id of matching saved values entry
+ *
+ * returns:
+ *   true if cocg values were restored, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_lsq_scalar_b_cocg_restore(const cs_mesh_t             *m,
+                           bool                         extended,
+                           bool                         accel,
+                           const cs_field_bc_coeffs_t  *bc_coeffs,
+                           cs_cocg_6_t                 *cocg,
+                           int                         *saved_id)
+{
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const cs_real_t *coefbp = bc_coeffs->b;
+
+  const int fvq_count = cs_mesh_quantities_compute_count();
+
+  int s_id = 0;
+  while (s_id < _n_lsq_b_cocg) {
+    if (   _lsq_b_cocg[s_id].coefb_p == coefbp
+        && _lsq_b_cocg[s_id].extended == extended)
+      break;
+    s_id++;
+  }
+
+  *saved_id = s_id;
+
+  if (s_id >= _n_lsq_b_cocg) {
+    BFT_REALLOC(_lsq_b_cocg, _n_lsq_b_cocg + 1, cs_gradient_lsq_b_cocg_t);
+    cs_gradient_lsq_b_cocg_t *sb = _lsq_b_cocg + _n_lsq_b_cocg;
+    sb->coefb_p = coefbp;
+    sb->extended = extended;
+    sb->fvq_count = -1;
+    CS_MALLOC_HD(sb->coefb, n_b_faces, cs_real_t, CS_ALLOC_HOST);
+    CS_MALLOC_HD(sb->cocg_b, n_b_cells, cs_cocg_6_t, cs_alloc_mode);
+    _n_lsq_b_cocg += 1;
+    return false;
+  }
+
+  cs_gradient_lsq_b_cocg_t *sb = _lsq_b_cocg + s_id;
+
+  if (sb->fvq_count != fvq_count)
+    return false;
+
+  /* Compare BC coefficients (on host, where they are always available) */
+
+  const cs_real_t *restrict coefb_s = sb->coefb;
+  cs_lnum_t n_diff = 0;
+
+# pragma omp parallel for reduction(+:n_diff) if(n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (coefbp[f_id] < coefb_s[f_id] || coefbp[f_id] > coefb_s[f_id])
+      n_diff += 1;
+  }
+
+  if (n_diff > 0)
+    return false;
+
+  /* Restore values */
+
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(accel);
+
+  const cs_lnum_t *b_cells = m->b_cells;
+  const cs_cocg_6_t *cocg_b = sb->cocg_b;
+
+  if (accel) {
+    b_cells = (const cs_lnum_t *)cs_get_device_ptr_const_pf(m->b_cells);
+    cocg_b = (const cs_cocg_6_t *)cs_get_device_ptr_const_pf(sb->cocg_b);
+  }
+
+  ctx.parallel_for(n_b_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+    cs_lnum_t c_id = b_cells[ii];
+    for (cs_lnum_t ll = 0; ll < 6; ll++)
+      cocg[c_id][ll] = cocg_b[ii][ll];
+  });
+  ctx.wait();
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Save scalar least-squares cocg at boundaries for reuse by subsequent
+ * gradients using the same boundary conditions.
+ *
+ * parameters:
+ *   m          <-- pointer to associated mesh structure
+ *   accel      <-- does cocg point to device memory ?
+ *   bc_coeffs  <-- B.C. structure for boundary face normals
+ *   cocg       <-- cocg values
+ *   saved_id   <-- id of matching saved values entry
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_b_cocg_save(const cs_mesh_t             *m,
+                        bool                         accel,
+                        const cs_field_bc_coeffs_t  *bc_coeffs,
+                        const cs_cocg_6_t           *cocg,
+                        int                          saved_id)
+{
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+
+  cs_gradient_lsq_b_cocg_t *sb = _lsq_b_cocg + saved_id;
+
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(accel);
+
+  const cs_lnum_t *b_cells = m->b_cells;
+  cs_cocg_6_t *cocg_b = sb->cocg_b;
+
+  if (accel) {
+    b_cells = (const cs_lnum_t *)cs_get_device_ptr_const_pf(m->b_cells);
+    cocg_b = (cs_cocg_6_t *)cs_get_device_ptr(sb->cocg_b);
+  }
+
+  ctx.parallel_for(n_b_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+    cs_lnum_t c_id = b_cells[ii];
+    for (cs_lnum_t ll = 0; ll < 6; ll++)
+      cocg_b[ii][ll] = cocg[c_id][ll];
+  });
+
+  cs_array_real_copy(m->n_b_faces, bc_coeffs->b, sb->coefb);
+
+  ctx.wait();
+
+  sb->fvq_count = cs_mesh_quantities_compute_count();
 }
 
 /*----------------------------------------------------------------------------
@@ -2793,6 +3409,18 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   _get_cell_cocg_lsq(m, halo_type, accel, fvq, &cocg, &cocgb);
 
+  /* Boundary cocg values depend on BC coefficients; reuse saved
+     values when those are unchanged */
+
+  int b_cocg_id = -1;
+  if (recompute_cocg) {
+    bool extended = (   halo_type == CS_HALO_EXTENDED
+                     && m->cell_cells_idx) ? true : false;
+    if (_lsq_scalar_b_cocg_restore(m, extended, accel, bc_coeffs,
+                                   cocg, &b_cocg_id))
+      recompute_cocg = false;
+  }
+
 #if defined(HAVE_CUDA)
 
   if (accel) {
@@ -2808,6 +3436,9 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
                                 cocgb,
                                 grad);
 
+    if (recompute_cocg)
+      _lsq_scalar_b_cocg_save(m, accel, bc_coeffs, cocg, b_cocg_id);
+
     return;
   }
 
@@ -2818,12 +3449,14 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   /* Compute cocg and save contribution at boundaries */
 
-  if (recompute_cocg)
+  if (recompute_cocg) {
     _recompute_lsq_scalar_cocg(m,
                                fvq,
                                bc_coeffs,
                                cocgb,
                                cocg);
+    _lsq_scalar_b_cocg_save(m, false, bc_coeffs, cocg, b_cocg_id);
+  }
 
   /* Compute Right-Hand Side */
   /*-------------------------*/
@@ -2900,29 +3533,464 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   /* Contribution from extended neighborhood */
 
-  if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != nullptr) {
+  if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != nullptr) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_t pfac, dc[3], fctb[4];
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
+
+        pfac =   (rhsv[jj][3] - rhsv[ii][3])
+               / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          fctb[ll] = dc[ll] * pfac;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhsv[ii][ll] += fctb[ll];
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Contribution from boundary faces */
+
+# pragma omp parallel for
+  for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+    for (cs_lnum_t f_id = b_group_index[t_id*2];
+         f_id < b_group_index[t_id*2 + 1];
+         f_id++) {
+
+      cs_lnum_t ii = b_face_cells[f_id];
+
+      cs_real_t unddij = 1. / b_dist[f_id];
+      cs_real_t udbfs = 1. / b_face_surf[f_id];
+      cs_real_t umcbdd = (1. - coefbp[f_id]) * unddij;
+
+      cs_real_t dsij[3];
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dsij[ll] =   udbfs * b_face_normal[f_id][ll]
+                   + umcbdd*diipb[f_id][ll];
+
+      cs_real_t pfac =   (coefap[f_id]*inc + (coefbp[f_id] -1.)
+                       * rhsv[ii][3]) * unddij;
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhsv[ii][ll] += dsij[ll] * pfac;
+
+    } /* loop on faces */
+
+  } /* loop on threads */
+
+  /* Compute gradient */
+  /*------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    grad[c_id][0] =   cocg[c_id][0] *rhsv[c_id][0]
+                    + cocg[c_id][3] *rhsv[c_id][1]
+                    + cocg[c_id][5] *rhsv[c_id][2];
+    grad[c_id][1] =   cocg[c_id][3] *rhsv[c_id][0]
+                    + cocg[c_id][1] *rhsv[c_id][1]
+                    + cocg[c_id][4] *rhsv[c_id][2];
+    grad[c_id][2] =   cocg[c_id][5] *rhsv[c_id][0]
+                    + cocg[c_id][4] *rhsv[c_id][1]
+                    + cocg[c_id][2] *rhsv[c_id][2];
+  }
+
+  /* Synchronize halos */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, grad);
+
+  BFT_FREE(rhsv);
+}
+
+/*----------------------------------------------------------------------------
+ * Update a least-squares cell gradient for a local increment of the
+ * variable.
+ *
+ * The least-squares gradient being linear in the variable for given
+ * boundary conditions (and without limiters), the gradient of
+ * (pvar + dpvar) is that of pvar plus the homogeneous gradient of dpvar.
+ * Only increments whose absolute value exceeds the given tolerance are
+ * accounted for, so only cells marked by such increments and their
+ * neighbors are updated.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   bc_coeffs      <-- B.C. structure for boundary face normals
+ *   tolerance      <-- increment tolerance
+ *   dpvar          <-- variable increment (synchronized)
+ *   grad           <-> gradient of pvar, updated to that of pvar + dpvar
+ *
+ * returns:
+ *   number of local cells updated
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_lsq_scalar_gradient_update(const cs_mesh_t                *m,
+                            const cs_mesh_quantities_t     *fvq,
+                            cs_halo_type_t                  halo_type,
+                            const cs_field_bc_coeffs_t     *bc_coeffs,
+                            double                          tolerance,
+                            const cs_real_t                 dpvar[],
+                            cs_real_3_t           *restrict grad)
+{
+  const cs_real_t *coefbp = bc_coeffs->b;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+
+  if (ma->cell_i_faces == nullptr)
+    cs_mesh_adjacencies_update_cell_i_faces();
+
+  const cs_lnum_t *restrict c2c_idx = ma->cell_cells_idx;
+  const cs_lnum_t *restrict c2c = ma->cell_cells;
+  const cs_lnum_t *restrict c2f = ma->cell_i_faces;
+  const cs_lnum_t *restrict cell_b_faces_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *restrict cell_b_faces = ma->cell_b_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+
+  bool extended = (   halo_type == CS_HALO_EXTENDED
+                   && m->cell_cells_idx) ? true : false;
+
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_f_cen
+    = (const cs_real_3_t *)fvq->cell_f_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *)fvq->diipb;
+
+  /* Boundary cocg values must match the BC coefficients */
+
+  cs_cocg_6_t  *restrict cocgb = nullptr;
+  cs_cocg_6_t  *restrict cocg = nullptr;
+
+  _get_cell_cocg_lsq(m, halo_type, false, fvq, &cocg, &cocgb);
+
+  int b_cocg_id = -1;
+  if (! _lsq_scalar_b_cocg_restore(m, extended, false, bc_coeffs,
+                                   cocg, &b_cocg_id)) {
+    _recompute_lsq_scalar_cocg(m, fvq, bc_coeffs, cocgb, cocg);
+    _lsq_scalar_b_cocg_save(m, false, bc_coeffs, cocg, b_cocg_id);
+  }
+
+  /* Mark cells with significant increments */
+
+  char *dirty;
+  BFT_MALLOC(dirty, n_cells_ext, char);
+
+# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    dirty[c_id] = (cs_math_fabs(dpvar[c_id]) > tolerance) ? 1 : 0;
+
+  /* Build list of cells whose gradient is affected */
+
+  cs_lnum_t n_u_cells = 0;
+  cs_lnum_t *u_cell_ids;
+  BFT_MALLOC(u_cell_ids, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    bool affected = dirty[c_id];
+    for (cs_lnum_t i = c2c_idx[c_id]; i < c2c_idx[c_id+1] && !affected; i++)
+      affected = dirty[c2c[i]];
+    if (extended) {
+      for (cs_lnum_t i = cell_cells_idx[c_id];
+           i < cell_cells_idx[c_id+1] && !affected;
+           i++)
+        affected = dirty[cell_cells_lst[i]];
+    }
+    if (affected)
+      u_cell_ids[n_u_cells++] = c_id;
+  }
+
+  /* Gather increment contributions for affected cells */
+
+# pragma omp parallel for if(n_u_cells > CS_THR_MIN)
+  for (cs_lnum_t u_id = 0; u_id < n_u_cells; u_id++) {
+
+    cs_lnum_t ii = u_cell_ids[u_id];
+
+    cs_real_t dp_i = (dirty[ii]) ? dpvar[ii] : 0.;
+    cs_real_t rhs[3] = {0., 0., 0.};
+
+    /* Contribution from interior faces */
+
+    for (cs_lnum_t i = c2c_idx[ii]; i < c2c_idx[ii+1]; i++) {
+      cs_lnum_t f_id = c2f[i];
+      cs_lnum_t jj = i_face_cells[f_id][0];
+      if (jj == ii)
+        jj = i_face_cells[f_id][1];
+
+      cs_real_t dp_j = (dirty[jj]) ? dpvar[jj] : 0.;
+
+      cs_real_t dc[3];
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
+
+      /* (P_j - P_i) / ||d||^2 */
+      cs_real_t pfac =   (dp_j - dp_i)
+                       / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhs[ll] += dc[ll] * pfac;
+    }
+
+    /* Contribution from extended neighborhood */
+
+    if (extended) {
+      for (cs_lnum_t i = cell_cells_idx[ii]; i < cell_cells_idx[ii+1]; i++) {
+        cs_lnum_t jj = cell_cells_lst[i];
+
+        cs_real_t dp_j = (dirty[jj]) ? dpvar[jj] : 0.;
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
+
+        cs_real_t pfac =   (dp_j - dp_i)
+                         / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhs[ll] += dc[ll] * pfac;
+      }
+    }
+
+    /* Contribution from boundary faces (homogeneous conditions) */
+
+    if (dirty[ii]) {
+      for (cs_lnum_t i = cell_b_faces_idx[ii];
+           i < cell_b_faces_idx[ii+1];
+           i++) {
+        cs_lnum_t f_id = cell_b_faces[i];
+
+        cs_real_t unddij = 1. / b_dist[f_id];
+        cs_real_t udbfs = 1. / b_face_surf[f_id];
+        cs_real_t umcbdd = (1. - coefbp[f_id]) * unddij;
+
+        cs_real_t pfac = (coefbp[f_id] - 1.) * dp_i * unddij;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhs[ll] += (  udbfs * b_face_normal[f_id][ll]
+                      + umcbdd*diipb[f_id][ll]) * pfac;
+      }
+    }
+
+    /* Update gradient */
+
+    grad[ii][0] +=   cocg[ii][0] *rhs[0]
+                   + cocg[ii][3] *rhs[1]
+                   + cocg[ii][5] *rhs[2];
+    grad[ii][1] +=   cocg[ii][3] *rhs[0]
+                   + cocg[ii][1] *rhs[1]
+                   + cocg[ii][4] *rhs[2];
+    grad[ii][2] +=   cocg[ii][5] *rhs[0]
+                   + cocg[ii][4] *rhs[1]
+                   + cocg[ii][2] *rhs[2];
+
+  }
+
+  BFT_FREE(u_cell_ids);
+  BFT_FREE(dirty);
+
+  /* Synchronize halos */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, grad);
+
+  return n_u_cells;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple variables using least-squares
+ * reconstruction, with a single pass over the mesh faces.
+ *
+ * Face geometry and the cocg (except at boundary cells, where it depends
+ * on the BC coefficients of each variable) are loaded once for all
+ * variables.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   n_vars         <-- number of variables
+ *   bc_coeffs      <-- B.C. structure for each variable
+ *   pvar           <-- variables
+ *   grad           --> gradients of pvar (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t                *m,
+                           const cs_mesh_quantities_t     *fvq,
+                           cs_halo_type_t                  halo_type,
+                           cs_real_t                       inc,
+                           int                             n_vars,
+                           const cs_field_bc_coeffs_t     *bc_coeffs[],
+                           cs_real_t                      *pvar[],
+                           cs_real_3_t                    *grad[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *)m->b_face_cells;
+  const cs_lnum_t *restrict b_cells
+    = (const cs_lnum_t *)m->b_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_f_cen
+    = (const cs_real_3_t *)fvq->cell_f_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *)fvq->diipb;
+
+  const bool extended = (   halo_type == CS_HALO_EXTENDED
+                         && cell_cells_idx != nullptr) ? true : false;
+
+  cs_cocg_6_t  *restrict cocgb = nullptr;
+  cs_cocg_6_t  *restrict cocg = nullptr;
+
+  _get_cell_cocg_lsq(m, halo_type, false, fvq, &cocg, &cocgb);
+
+  /* Boundary cocg for each variable (shared cocg is left with
+     values of the last variable, as for successive single calls) */
+
+  cs_cocg_6_t *cocg_bv;
+  BFT_MALLOC(cocg_bv, (size_t)n_vars*n_b_cells, cs_cocg_6_t);
+
+  for (int v_id = 0; v_id < n_vars; v_id++) {
+    int b_cocg_id = -1;
+    if (! _lsq_scalar_b_cocg_restore(m, extended, false, bc_coeffs[v_id],
+                                     cocg, &b_cocg_id)) {
+      _recompute_lsq_scalar_cocg(m, fvq, bc_coeffs[v_id], cocgb, cocg);
+      _lsq_scalar_b_cocg_save(m, false, bc_coeffs[v_id], cocg, b_cocg_id);
+    }
+    cs_cocg_6_t *_cocg_b = cocg_bv + (size_t)v_id*n_b_cells;
+#   pragma omp parallel for if(n_b_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      for (cs_lnum_t ll = 0; ll < 6; ll++)
+        _cocg_b[ii][ll] = cocg[b_cells[ii]][ll];
+    }
+  }
+
+  /* Compute Right-Hand Sides (interleaved by cell) */
+  /*-----------------------------------------------*/
+
+  const cs_lnum_t r_stride = 3*n_vars;
+
+  cs_real_t  *restrict rhs;
+  BFT_MALLOC(rhs, (size_t)n_cells_ext*r_stride, cs_real_t);
+
+# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    for (cs_lnum_t k = 0; k < r_stride; k++)
+      rhs[c_id*r_stride + k] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
+
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        cs_real_t *rhs_i = rhs + ii*r_stride;
+        cs_real_t *rhs_j = rhs + jj*r_stride;
+
+        for (int v_id = 0; v_id < n_vars; v_id++) {
+          /* (P_j - P_i) / ||d||^2 */
+          cs_real_t pfac = (pvar[v_id][jj] - pvar[v_id][ii]) * ddc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            rhs_i[v_id*3 + ll] += dc[ll] * pfac;
+            rhs_j[v_id*3 + ll] += dc[ll] * pfac;
+          }
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (extended) {
 
 #   pragma omp parallel for
     for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      cs_real_t *rhs_i = rhs + ii*r_stride;
       for (cs_lnum_t cidx = cell_cells_idx[ii];
            cidx < cell_cells_idx[ii+1];
            cidx++) {
 
         cs_lnum_t jj = cell_cells_lst[cidx];
 
-        cs_real_t pfac, dc[3], fctb[4];
-
+        cs_real_t dc[3];
         for (cs_lnum_t ll = 0; ll < 3; ll++)
           dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
 
-        pfac =   (rhsv[jj][3] - rhsv[ii][3])
-               / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
-
-        for (cs_lnum_t ll = 0; ll < 3; ll++)
-          fctb[ll] = dc[ll] * pfac;
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (cs_lnum_t ll = 0; ll < 3; ll++)
-          rhsv[ii][ll] += fctb[ll];
+        for (int v_id = 0; v_id < n_vars; v_id++) {
+          cs_real_t pfac = (pvar[v_id][jj] - pvar[v_id][ii]) * ddc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhs_i[v_id*3 + ll] += dc[ll] * pfac;
+        }
 
       }
     }
@@ -2942,44 +4010,93 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
       cs_real_t unddij = 1. / b_dist[f_id];
       cs_real_t udbfs = 1. / b_face_surf[f_id];
-      cs_real_t umcbdd = (1. - coefbp[f_id]) * unddij;
 
-      cs_real_t dsij[3];
-      for (cs_lnum_t ll = 0; ll < 3; ll++)
-        dsij[ll] =   udbfs * b_face_normal[f_id][ll]
-                   + umcbdd*diipb[f_id][ll];
+      cs_real_t *rhs_i = rhs + ii*r_stride;
 
-      cs_real_t pfac =   (coefap[f_id]*inc + (coefbp[f_id] -1.)
-                       * rhsv[ii][3]) * unddij;
+      for (int v_id = 0; v_id < n_vars; v_id++) {
+        const cs_real_t coefap = bc_coeffs[v_id]->a[f_id];
+        const cs_real_t coefbp = bc_coeffs[v_id]->b[f_id];
 
-      for (cs_lnum_t ll = 0; ll < 3; ll++)
-        rhsv[ii][ll] += dsij[ll] * pfac;
+        cs_real_t umcbdd = (1. - coefbp) * unddij;
+
+        cs_real_t pfac =   (coefap*inc + (coefbp -1.)
+                         * pvar[v_id][ii]) * unddij;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhs_i[v_id*3 + ll] += (  udbfs * b_face_normal[f_id][ll]
+                                 + umcbdd*diipb[f_id][ll]) * pfac;
+      }
 
     } /* loop on faces */
 
   } /* loop on threads */
 
-  /* Compute gradient */
-  /*------------------*/
+  /* Compute gradients */
+  /*-------------------*/
 
-# pragma omp parallel for
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    grad[c_id][0] =   cocg[c_id][0] *rhsv[c_id][0]
-                    + cocg[c_id][3] *rhsv[c_id][1]
-                    + cocg[c_id][5] *rhsv[c_id][2];
-    grad[c_id][1] =   cocg[c_id][3] *rhsv[c_id][0]
-                    + cocg[c_id][1] *rhsv[c_id][1]
-                    + cocg[c_id][4] *rhsv[c_id][2];
-    grad[c_id][2] =   cocg[c_id][5] *rhsv[c_id][0]
-                    + cocg[c_id][4] *rhsv[c_id][1]
-                    + cocg[c_id][2] *rhsv[c_id][2];
+    const cs_real_t *rhs_c = rhs + c_id*r_stride;
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      const cs_real_t *r = rhs_c + v_id*3;
+      grad[v_id][c_id][0] =   cocg[c_id][0] *r[0]
+                            + cocg[c_id][3] *r[1]
+                            + cocg[c_id][5] *r[2];
+      grad[v_id][c_id][1] =   cocg[c_id][3] *r[0]
+                            + cocg[c_id][1] *r[1]
+                            + cocg[c_id][4] *r[2];
+      grad[v_id][c_id][2] =   cocg[c_id][5] *r[0]
+                            + cocg[c_id][4] *r[1]
+                            + cocg[c_id][2] *r[2];
+    }
+  }
+
+  /* Boundary cells use the cocg matching each variable's BC's */
+
+# pragma omp parallel for if(n_b_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+    cs_lnum_t c_id = b_cells[ii];
+    const cs_real_t *rhs_c = rhs + c_id*r_stride;
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      const cs_real_t *r = rhs_c + v_id*3;
+      const cs_cocg_t *c = cocg_bv[(size_t)v_id*n_b_cells + ii];
+      grad[v_id][c_id][0] = c[0]*r[0] + c[3]*r[1] + c[5]*r[2];
+      grad[v_id][c_id][1] = c[3]*r[0] + c[1]*r[1] + c[4]*r[2];
+      grad[v_id][c_id][2] = c[5]*r[0] + c[4]*r[1] + c[2]*r[2];
+    }
   }
 
+  BFT_FREE(rhs);
+  BFT_FREE(cocg_bv);
+
   /* Synchronize halos */
 
-  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, grad);
+  if (m->halo != nullptr) {
+    cs_timer_t t0 = cs_timer_time();
+
+    int *stride;
+    cs_real_t **g_var;
+    BFT_MALLOC(stride, n_vars, int);
+    BFT_MALLOC(g_var, n_vars, cs_real_t *);
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      stride[v_id] = 3;
+      g_var[v_id] = (cs_real_t *)grad[v_id];
+    }
 
-  BFT_FREE(rhsv);
+    cs_halo_sync_multi(m->halo, CS_HALO_STANDARD, n_vars, stride, g_var);
+
+    if (m->have_rotation_perio) {
+      for (int v_id = 0; v_id < n_vars; v_id++)
+        cs_halo_perio_sync_var_vect
+          (m->halo, CS_HALO_STANDARD, g_var[v_id], 3);
+    }
+
+    BFT_FREE(g_var);
+    BFT_FREE(stride);
+
+    cs_timer_t t1 = cs_timer_time();
+    _gradient_phase_add(CS_GRADIENT_PHASE_HALO, &t0, &t1);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -3085,14 +4202,23 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
   /* Reconstruct gradients using least squares for non-orthogonal meshes */
   /*---------------------------------------------------------------------*/
 
-  /* Compute cocg and save contribution at boundaries */
+  /* Compute cocg and save contribution at boundaries
+     (reusing saved values when BC coefficients are unchanged) */
 
-  if (recompute_cocg)
-    _recompute_lsq_scalar_cocg(m,
-                               fvq,
-                               bc_coeffs,
-                               cocgb,
-                               cocg);
+  if (recompute_cocg) {
+    bool extended = (   halo_type == CS_HALO_EXTENDED
+                     && m->cell_cells_idx) ? true : false;
+    int b_cocg_id = -1;
+    if (! _lsq_scalar_b_cocg_restore(m, extended, false, bc_coeffs,
+                                     cocg, &b_cocg_id)) {
+      _recompute_lsq_scalar_cocg(m,
+                                 fvq,
+                                 bc_coeffs,
+                                 cocgb,
+                                 cocg);
+      _lsq_scalar_b_cocg_save(m, false, bc_coeffs, cocg, b_cocg_id);
+    }
+  }
 
   /* Compute Right-Hand Side */
   /*-------------------------*/
@@ -3841,10 +4967,133 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
       grad[cell_id][j] = 0.0;
   }
 
+  /* Cell-based gather of face contributions (no atomic sums needed) */
+  /*-----------------------------------------------------------------*/
+
+  cs_dispatch_context ctx;
+
+  if (_gg_sum_type(ctx, m) == CS_DISPATCH_SUM_GATHER) {
+
+    const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+    const cs_lnum_t *restrict cell_cells_idx = ma->cell_cells_idx;
+    const cs_lnum_t *restrict cell_i_faces = ma->cell_i_faces;
+    const short int *restrict cell_i_faces_sgn = ma->cell_i_faces_sgn;
+    const cs_lnum_t *restrict cell_b_faces_idx = ma->cell_b_faces_idx;
+    const cs_lnum_t *restrict cell_b_faces = ma->cell_b_faces;
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+
+      cs_real_t g[3] = {0., 0., 0.};
+
+      /* Contribution from interior faces */
+
+      const cs_lnum_t s_id = cell_cells_idx[c_id];
+      const cs_lnum_t e_id = cell_cells_idx[c_id + 1];
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        const cs_lnum_t f_id = cell_i_faces[i];
+        const cs_lnum_t c_id1 = i_face_cells[f_id][0];
+        const cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+        cs_real_t ktpond = _i_face_ktpond(f_id, c_id1, c_id2, weight,
+                                          c_weight_s, c_weight_t);
+
+        cs_real_t pfaci = 0., pfacj = 0., rfac = 0.;
+
+        if (hyd_p_flag == 1) {
+          cs_real_t poro_0 = (is_porous) ? i_poro_duq_0[f_id] : 0.;
+          cs_real_t poro_1 = (is_porous) ? i_poro_duq_1[f_id] : 0.;
+
+          cs_real_t fexd[3];
+          for (cs_lnum_t j = 0; j < 3; j++)
+            fexd[j] = 0.5 * (f_ext[c_id1][j] + f_ext[c_id2][j]);
+
+          pfaci
+            =  ktpond
+                 * (  cs_math_3_distance_dot_product(cell_f_cen[c_id1],
+                                                     i_f_face_cog[f_id],
+                                                     f_ext[c_id1])
+                    + poro_0)
+            +  (1.0 - ktpond)
+                 * (  cs_math_3_distance_dot_product(cell_f_cen[c_id2],
+                                                     i_f_face_cog[f_id],
+                                                     f_ext[c_id2])
+                    + poro_1);
+          pfacj = pfaci;
+
+          rfac =   weight[f_id]
+                   * cs_math_3_distance_dot_product(i_f_face_cog[f_id],
+                                                    cell_f_cen[c_id1],
+                                                    fexd)
+                 + (1.0 - weight[f_id])
+                   * cs_math_3_distance_dot_product(i_f_face_cog[f_id],
+                                                    cell_f_cen[c_id2],
+                                                    fexd);
+        }
+
+        pfaci += (1.0-ktpond) * (c_var[c_id2] - c_var[c_id1]);
+        pfacj -=      ktpond  * (c_var[c_id2] - c_var[c_id1]);
+
+        /* Reconstruction part */
+        rfac += 0.5 *
+                (  dofij[f_id][0]*(r_grad[c_id1][0]+r_grad[c_id2][0])
+                 + dofij[f_id][1]*(r_grad[c_id1][1]+r_grad[c_id2][1])
+                 + dofij[f_id][2]*(r_grad[c_id1][2]+r_grad[c_id2][2]));
+
+        cs_real_t pfac = (cell_i_faces_sgn[i] > 0) ?  (pfaci + rfac)
+                                                   : -(pfacj + rfac);
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          g[j] += pfac * i_f_face_normal[f_id][j];
+      }
+
+      /* Contribution from boundary faces */
+
+      const cs_lnum_t s_id_b = cell_b_faces_idx[c_id];
+      const cs_lnum_t e_id_b = cell_b_faces_idx[c_id + 1];
+
+      for (cs_lnum_t i = s_id_b; i < e_id_b; i++) {
+        const cs_lnum_t f_id = cell_b_faces[i];
+
+        cs_real_t pfac =   inc*coefap[f_id]
+                         + (coefbp[f_id]-1.0)*c_var[c_id];
+        cs_real_t rfac = 0.;
+
+        if (hyd_p_flag == 1) {
+          cs_real_t poro = (is_porous) ? b_poro_duq[f_id] : 0.;
+          pfac += coefbp[f_id]
+                  * (  cs_math_3_distance_dot_product(cell_f_cen[c_id],
+                                                      b_f_face_cog[f_id],
+                                                      f_ext[c_id])
+                     + poro);
+          rfac = coefbp[f_id]
+                 * (  diipb[f_id][0] * (r_grad[c_id][0] - f_ext[c_id][0])
+                    + diipb[f_id][1] * (r_grad[c_id][1] - f_ext[c_id][1])
+                    + diipb[f_id][2] * (r_grad[c_id][2] - f_ext[c_id][2]));
+        }
+        else
+          rfac = coefbp[f_id]
+                 * (  diipb[f_id][0] * r_grad[c_id][0]
+                    + diipb[f_id][1] * r_grad[c_id][1]
+                    + diipb[f_id][2] * r_grad[c_id][2]);
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          g[j] += (pfac + rfac) * b_f_face_normal[f_id][j];
+      }
+
+      for (cs_lnum_t j = 0; j < 3; j++)
+        grad[c_id][j] = g[j];
+
+    });
+
+    ctx.wait();
+
+  }
+
   /* Case with hydrostatic pressure */
   /*--------------------------------*/
 
-  if (hyd_p_flag == 1) {
+  else if (hyd_p_flag == 1) {
 
     /* Contribution from interior faces */
 
@@ -4672,20 +5921,6 @@ _fv_vtx_based_scalar_gradient(const cs_mesh_t                *m,
 
   /* Vertex values are not needed after this stage */
 
-  cs_real_t mean[4] = {0, 0, 0, 0};
-  for (cs_lnum_t i = 0; i < n_cells; i++)
-    mean[0] += c_var[i];
-  mean[0] /= n_cells;
-  for (cs_lnum_t i = 0; i < m->n_vertices; i++)
-    mean[1] += v_var[i];
-  mean[1] /= m->n_vertices;
-  for (cs_lnum_t i = 0; i < m->n_i_faces; i++)
-    mean[2] += i_f_var[i];
-  mean[2] /= m->n_i_faces;
-  for (cs_lnum_t i = 0; i < m->n_b_faces; i++)
-    mean[3] += b_f_var[i];
-  mean[3] /= m->n_b_faces;
-
   BFT_FREE(v_var);
 
   /* Case with hydrostatic pressure
@@ -6045,6 +7280,151 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
   BFT_FREE(rhs);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute Green-Gauss face contributions to the gradient of a symmetric
+ * tensor using a cell-based gather (with no atomic sums).
+ *
+ * Each cell is handled by a single thread, looping on its interior and
+ * boundary faces through the mesh adjacencies, with fixed 6x3 local
+ * arrays. When reconstruction is active, the result includes the
+ * -V.grad term of the iterative reconstruction right-hand side.
+ *
+ * template parameters:
+ *   reconstruct   if true, use face reconstruction based on grad
+ *
+ * parameters:
+ *   ctx            <-- reference to dispatch context
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   bc_coeffs_ts   <-- B.C. structure for boundary face normals
+ *   pvar           <-- variable
+ *   grad           <-- current gradient of pvar (if reconstruct)
+ *   rhs            --> face contributions for each cell
+ *----------------------------------------------------------------------------*/
+
+template <bool reconstruct>
+static void
+_gg_tensor_gather(cs_dispatch_context           &ctx,
+                  const cs_mesh_t               *m,
+                  const cs_mesh_quantities_t    *fvq,
+                  int                            inc,
+                  const cs_field_bc_coeffs_t    *bc_coeffs_ts,
+                  const cs_real_6_t   *restrict  pvar,
+                  const cs_real_63_t  *restrict  grad,
+                  cs_real_63_t        *restrict  rhs)
+{
+  const cs_real_6_t  *restrict coefat
+    = (const cs_real_6_t *)bc_coeffs_ts->a;
+  const cs_real_66_t *restrict coefbt
+    = (const cs_real_66_t *)bc_coeffs_ts->b;
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t *restrict cell_cells_idx = ma->cell_cells_idx;
+  const cs_lnum_t *restrict cell_i_faces = ma->cell_i_faces;
+  const short int *restrict cell_i_faces_sgn = ma->cell_i_faces_sgn;
+  const cs_lnum_t *restrict cell_b_faces_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *restrict cell_b_faces = ma->cell_b_faces;
+
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
+  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
+    cell_f_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict i_f_face_normal
+    = (const cs_real_3_t *)fvq->i_f_face_normal;
+  const cs_real_3_t *restrict b_f_face_normal
+    = (const cs_real_3_t *)fvq->b_f_face_normal;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *)fvq->diipb;
+  const cs_real_3_t *restrict dofij
+    = (const cs_real_3_t *)fvq->dofij;
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+
+    cs_real_t r[6][3];
+
+    for (cs_lnum_t i = 0; i < 6; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++)
+        r[i][j] = (reconstruct) ? - cell_f_vol[c_id] * grad[c_id][i][j] : 0.;
+    }
+
+    /* Contribution from interior faces (the face normal being oriented
+       from ii to jj, w and the reconstruction sign depend on the side) */
+
+    const cs_lnum_t s_id = cell_cells_idx[c_id];
+    const cs_lnum_t e_id = cell_cells_idx[c_id + 1];
+
+    for (cs_lnum_t idx = s_id; idx < e_id; idx++) {
+      const cs_lnum_t f_id = cell_i_faces[idx];
+      const cs_lnum_t ii = i_face_cells[f_id][0];
+      const cs_lnum_t jj = i_face_cells[f_id][1];
+
+      cs_real_t s = 1., w = 1. - weight[f_id];
+      if (cell_i_faces_sgn[idx] < 0) {
+        s = -1.;
+        w = weight[f_id];
+      }
+
+      for (cs_lnum_t i = 0; i < 6; i++) {
+        cs_real_t pfac = w * (pvar[jj][i] - pvar[ii][i]);
+
+        if (reconstruct)
+          pfac += s * 0.5 * (  (grad[ii][i][0] + grad[jj][i][0])
+                             * dofij[f_id][0]
+                             + (grad[ii][i][1] + grad[jj][i][1])
+                             * dofij[f_id][1]
+                             + (grad[ii][i][2] + grad[jj][i][2])
+                             * dofij[f_id][2]);
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          r[i][j] += pfac * i_f_face_normal[f_id][j];
+      }
+    }
+
+    /* Contribution from boundary faces */
+
+    const cs_lnum_t s_id_b = cell_b_faces_idx[c_id];
+    const cs_lnum_t e_id_b = cell_b_faces_idx[c_id + 1];
+
+    for (cs_lnum_t idx = s_id_b; idx < e_id_b; idx++) {
+      const cs_lnum_t f_id = cell_b_faces[idx];
+
+      /* Reconstructed value at I' minus value at I, for each component */
+
+      cs_real_t vecfac[6];
+      for (cs_lnum_t k = 0; k < 6; k++) {
+        vecfac[k] = pvar[c_id][k];
+        if (reconstruct)
+          vecfac[k] +=   grad[c_id][k][0] * diipb[f_id][0]
+                       + grad[c_id][k][1] * diipb[f_id][1]
+                       + grad[c_id][k][2] * diipb[f_id][2];
+      }
+
+      for (cs_lnum_t i = 0; i < 6; i++) {
+        cs_real_t pfac = inc*coefat[f_id][i] - pvar[c_id][i];
+        for (cs_lnum_t k = 0; k < 6; k++)
+          pfac += coefbt[f_id][i][k] * vecfac[k];
+
+        for (cs_lnum_t j = 0; j < 3; j++)
+          r[i][j] += pfac * b_f_face_normal[f_id][j];
+      }
+    }
+
+    for (cs_lnum_t i = 0; i < 6; i++) {
+      for (cs_lnum_t j = 0; j < 3; j++)
+        rhs[c_id][i][j] = r[i][j];
+    }
+
+  });
+
+  ctx.wait();
+}
+
 /*----------------------------------------------------------------------------
  * Compute the gradient of a vector with an iterative technique in order to
  * handle non-orthoganalities (n_r_sweeps > 1).
@@ -6126,6 +7506,13 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
 
   BFT_MALLOC(rhs, n_cells_ext, cs_real_63_t);
 
+  /* Use cell-based gather of face contributions when scatter
+     would require atomic sums */
+
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+  const cs_dispatch_sum_type_t sum_type = _gg_sum_type(ctx, m);
+
   /* Gradient reconstruction to handle non-orthogonal meshes */
   /*---------------------------------------------------------*/
 
@@ -6145,105 +7532,115 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
 
       /* Computation of the Right Hand Side*/
 
-#     pragma omp parallel for
-      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-        for (cs_lnum_t i = 0; i < 6; i++) {
-          for (cs_lnum_t j = 0; j < 3; j++)
-            rhs[c_id][i][j] = - cell_f_vol[c_id] * grad[c_id][i][j];
-        }
-      }
-
-      /* Interior face treatment */
+      if (sum_type == CS_DISPATCH_SUM_GATHER)
+        _gg_tensor_gather<true>(ctx, m, fvq, inc, bc_coeffs_ts,
+                                pvar, grad, rhs);
 
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+      else {
 
 #       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-
-          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               f_id++) {
-
-            cs_lnum_t c_id1 = i_face_cells[f_id][0];
-            cs_lnum_t c_id2 = i_face_cells[f_id][1];
-            cs_real_t pond = weight[f_id];
-
-            /*
-               Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
-                                        + (1-\alpha_\ij) \varia_\cellj\f$
-                       but for the cell \f$ \celli \f$ we remove
-                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-                       and for the cell \f$ \cellj \f$ we remove
-                       \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
-            */
-
-            for (cs_lnum_t i = 0; i < 6; i++) {
-
-              /* Reconstruction part */
-              cs_real_t
-                pfaci = 0.5 * (    (grad[c_id1][i][0] + grad[c_id2][i][0])
-                                 * dofij[f_id][0]
-                               +   (grad[c_id1][i][1] + grad[c_id2][i][1])
-                                 * dofij[f_id][1]
-                               +   (grad[c_id1][i][2] + grad[c_id2][i][2])
-                                 * dofij[f_id][2]);
-              cs_real_t pfacj = pfaci;
+        for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+          for (cs_lnum_t i = 0; i < 6; i++) {
+            for (cs_lnum_t j = 0; j < 3; j++)
+              rhs[c_id][i][j] = - cell_f_vol[c_id] * grad[c_id][i][j];
+          }
+        }
 
-              pfaci += (1.0-pond) * (pvar[c_id2][i] - pvar[c_id1][i]);
-              pfacj -=       pond * (pvar[c_id2][i] - pvar[c_id1][i]);
-              for (cs_lnum_t j = 0; j < 3; j++) {
-                rhs[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
-                rhs[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
+        /* Interior face treatment */
+
+        for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#         pragma omp parallel for
+          for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+            for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+                 f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+                 f_id++) {
+
+              cs_lnum_t c_id1 = i_face_cells[f_id][0];
+              cs_lnum_t c_id2 = i_face_cells[f_id][1];
+              cs_real_t pond = weight[f_id];
+
+              /*
+                 Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
+                                          + (1-\alpha_\ij) \varia_\cellj\f$
+                         but for the cell \f$ \celli \f$ we remove
+                         \f$ \varia_\celli \sum_\face \vect{S}_\face
+                             = \vect{0} \f$
+                         and for the cell \f$ \cellj \f$ we remove
+                         \f$ \varia_\cellj \sum_\face \vect{S}_\face
+                             = \vect{0} \f$
+              */
+
+              for (cs_lnum_t i = 0; i < 6; i++) {
+
+                /* Reconstruction part */
+                cs_real_t
+                  pfaci = 0.5 * (    (grad[c_id1][i][0] + grad[c_id2][i][0])
+                                   * dofij[f_id][0]
+                                 +   (grad[c_id1][i][1] + grad[c_id2][i][1])
+                                   * dofij[f_id][1]
+                                 +   (grad[c_id1][i][2] + grad[c_id2][i][2])
+                                   * dofij[f_id][2]);
+                cs_real_t pfacj = pfaci;
+
+                pfaci += (1.0-pond) * (pvar[c_id2][i] - pvar[c_id1][i]);
+                pfacj -=       pond * (pvar[c_id2][i] - pvar[c_id1][i]);
+                for (cs_lnum_t j = 0; j < 3; j++) {
+                  rhs[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
+                  rhs[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
+                }
               }
-            }
 
-          } /* loop on faces */
+            } /* loop on faces */
 
-        } /* loop on threads */
+          } /* loop on threads */
 
-      } /* loop on thread groups */
+        } /* loop on thread groups */
 
-      /* Boundary face treatment */
+        /* Boundary face treatment */
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-        for (cs_lnum_t f_id = b_group_index[t_id*2];
-             f_id < b_group_index[t_id*2 + 1];
-             f_id++) {
+          for (cs_lnum_t f_id = b_group_index[t_id*2];
+               f_id < b_group_index[t_id*2 + 1];
+               f_id++) {
 
-          cs_lnum_t c_id = b_face_cells[f_id];
+            cs_lnum_t c_id = b_face_cells[f_id];
 
-          for (cs_lnum_t i = 0; i < 6; i++) {
+            /* Reconstructed values at I' (computed once for all components) */
 
-            /*
-              Remark: for the cell \f$ \celli \f$ we remove
-                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-            */
+            cs_real_t vecfac[6];
+            for (cs_lnum_t k = 0; k < 6; k++)
+              vecfac[k] =   pvar[c_id][k]
+                          + grad[c_id][k][0] * diipb[f_id][0]
+                          + grad[c_id][k][1] * diipb[f_id][1]
+                          + grad[c_id][k][2] * diipb[f_id][2];
 
-            cs_real_t pfac = inc*coefat[f_id][i];
+            for (cs_lnum_t i = 0; i < 6; i++) {
 
-            for (cs_lnum_t k = 0; k < 6; k++) {
-              /* Reconstruction part */
-              cs_real_t vecfac =   grad[c_id][k][0] * diipb[f_id][0]
-                                 + grad[c_id][k][1] * diipb[f_id][1]
-                                 + grad[c_id][k][2] * diipb[f_id][2];
-              pfac += coefbt[f_id][i][k] * vecfac;
+              /*
+                Remark: for the cell \f$ \celli \f$ we remove
+                         \f$ \varia_\celli \sum_\face \vect{S}_\face
+                             = \vect{0} \f$
+              */
 
-              if (i == k)
-                pfac += (coefbt[f_id][i][k] - 1.0) * pvar[c_id][k];
-              else
-                pfac += coefbt[f_id][i][k] * pvar[c_id][k];
-            }
+              cs_real_t pfac = inc*coefat[f_id][i] - pvar[c_id][i];
 
-            for (cs_lnum_t j = 0; j < 3; j++)
-              rhs[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
+              for (cs_lnum_t k = 0; k < 6; k++)
+                pfac += coefbt[f_id][i][k] * vecfac[k];
 
-          }
+              for (cs_lnum_t j = 0; j < 3; j++)
+                rhs[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
 
-        } /* loop on faces */
+            }
 
-      } /* loop on threads */
+          } /* loop on faces */
+
+        } /* loop on threads */
+
+      }
 
       /* Increment of the gradient */
 
@@ -8255,6 +9652,7 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
   /* Compute gradient */
   /*------------------*/
 
+# pragma omp parallel for if(n_cells >= CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     for (cs_lnum_t i = 0; i < 6; i++) {
       gradt[c_id][i][0] =   rhs[c_id][i][0] * cocg[c_id][0]
@@ -8409,78 +9807,87 @@ _initialize_tensor_gradient(const cs_mesh_t              *m,
     }
   }
 
-  /* Interior faces contribution */
+  /* Use cell-based gather of face contributions when scatter
+     would require atomic sums */
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
 
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+  if (_gg_sum_type(ctx, m) == CS_DISPATCH_SUM_GATHER)
+    _gg_tensor_gather<false>(ctx, m, fvq, inc, bc_coeffs_ts,
+                             pvar, nullptr, grad);
 
-      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           f_id++) {
+  else {
 
-        cs_lnum_t c_id1 = i_face_cells[f_id][0];
-        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+    /* Interior faces contribution */
 
-        cs_real_t pond = weight[f_id];
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-        /*
-           Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
-                                    + (1-\alpha_\ij) \varia_\cellj\f$
-                   but for the cell \f$ \celli \f$ we remove
-                   \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-                   and for the cell \f$ \cellj \f$ we remove
-                   \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
-        */
-        for (cs_lnum_t i = 0; i < 6; i++) {
-          cs_real_t pfaci = (1.0-pond) * (pvar[c_id2][i] - pvar[c_id1][i]);
-          cs_real_t pfacj =     - pond * (pvar[c_id2][i] - pvar[c_id1][i]);
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            grad[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
-            grad[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t c_id1 = i_face_cells[f_id][0];
+          cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+          cs_real_t pond = weight[f_id];
+
+          /*
+             Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
+                                      + (1-\alpha_\ij) \varia_\cellj\f$
+                     but for the cell \f$ \celli \f$ we remove
+                     \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
+                     and for the cell \f$ \cellj \f$ we remove
+                     \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
+          */
+          for (cs_lnum_t i = 0; i < 6; i++) {
+            cs_real_t pfaci = (1.0-pond) * (pvar[c_id2][i] - pvar[c_id1][i]);
+            cs_real_t pfacj =     - pond * (pvar[c_id2][i] - pvar[c_id1][i]);
+            for (cs_lnum_t j = 0; j < 3; j++) {
+              grad[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
+              grad[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
+            }
           }
-        }
 
-      } /* End of loop on faces */
+        } /* End of loop on faces */
 
-    } /* End of loop on threads */
+      } /* End of loop on threads */
 
-  } /* End of loop on thread groups */
+    } /* End of loop on thread groups */
 
-  /* Boundary face treatment */
+    /* Boundary face treatment */
 
-# pragma omp parallel for
-  for (int t_id = 0; t_id < n_b_threads; t_id++) {
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    for (cs_lnum_t f_id = b_group_index[t_id*2];
-         f_id < b_group_index[t_id*2 + 1];
-         f_id++) {
+      for (cs_lnum_t f_id = b_group_index[t_id*2];
+           f_id < b_group_index[t_id*2 + 1];
+           f_id++) {
 
-      cs_lnum_t c_id = b_face_cells[f_id];
+        cs_lnum_t c_id = b_face_cells[f_id];
 
-      /*
-        Remark: for the cell \f$ \celli \f$ we remove
-                 \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-      */
-      for (cs_lnum_t i = 0; i < 6; i++) {
-        cs_real_t pfac = inc*coefat[f_id][i];
+        /*
+          Remark: for the cell \f$ \celli \f$ we remove
+                   \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
+        */
+        for (cs_lnum_t i = 0; i < 6; i++) {
+          cs_real_t pfac = inc*coefat[f_id][i] - pvar[c_id][i];
 
-        for (cs_lnum_t k = 0; k < 6; k++) {
-          if (i == k)
-            pfac += (coefbt[f_id][i][k] - 1.0) * pvar[c_id][k];
-          else
-            pfac += coefbt[f_id][i][k] * pvar[c_id][k] ;
+          for (cs_lnum_t k = 0; k < 6; k++)
+            pfac += coefbt[f_id][i][k] * pvar[c_id][k];
 
+          for (cs_lnum_t j = 0; j < 3; j++)
+            grad[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
         }
 
-        for (cs_lnum_t j = 0; j < 3; j++)
-          grad[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
-      }
+      } /* loop on faces */
 
-    } /* loop on faces */
+    } /* loop on threads */
 
-  } /* loop on threads */
+  }
 
 # pragma omp parallel for
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
@@ -8846,6 +10253,8 @@ _gradient_scalar(const char                    *var_name,
     BFT_FREE(bc_coeffs_loc);
   }
 
+  cs_timer_t t0 = cs_timer_time();
+
   _scalar_gradient_clipping(mesh,
                             fvq,
                             cs_glob_mesh_adjacencies,
@@ -8859,6 +10268,9 @@ _gradient_scalar(const char                    *var_name,
 
   if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
     cs_bad_cells_regularisation_vector(grad, 0);
+
+  cs_timer_t t1 = cs_timer_time();
+  _gradient_phase_add(CS_GRADIENT_PHASE_CLIP, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -9112,6 +10524,8 @@ _gradient_vector(const char                     *var_name,
     BFT_FREE(bc_coeffs_v_loc);
   }
 
+  cs_timer_t t0 = cs_timer_time();
+
   _strided_gradient_clipping(mesh,
                              fvq,
                              madj,
@@ -9125,6 +10539,9 @@ _gradient_vector(const char                     *var_name,
 
   if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
     cs_bad_cells_regularisation_tensor((cs_real_9_t *)grad, 0);
+
+  cs_timer_t t1 = cs_timer_time();
+  _gradient_phase_add(CS_GRADIENT_PHASE_CLIP, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -9317,6 +10734,8 @@ _gradient_tensor(const char                 *var_name,
     BFT_FREE(bc_coeffs_ts_loc);
   }
 
+  cs_timer_t t0 = cs_timer_time();
+
   _strided_gradient_clipping(mesh,
                              fvq,
                              madj,
@@ -9327,6 +10746,9 @@ _gradient_tensor(const char                 *var_name,
                              var_name,
                              (const cs_real_6_t *)var,
                              grad);
+
+  cs_timer_t t1 = cs_timer_time();
+  _gradient_phase_add(CS_GRADIENT_PHASE_CLIP, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -9878,12 +11300,23 @@ cs_gradient_initialize(void)
   }
 
   CS_TIMER_COUNTER_INIT(_gradient_t_tot);
+  for (int i = 0; i < CS_GRADIENT_N_PHASES; i++)
+    CS_TIMER_COUNTER_INIT(_gradient_t_phase[i]);
 
   int stats_root = cs_timer_stats_id_by_name("operations");
   if (stats_root > -1) {
     _gradient_stat_id = cs_timer_stats_create("operations",
                                               "gradients",
                                               "gradients reconstruction");
+
+    const char *phase_stat_name[] = {"gradients_cocg",
+                                     "gradients_halo",
+                                     "gradients_clip"};
+    for (int i = 0; i < CS_GRADIENT_N_PHASES; i++)
+      _gradient_phase_stat_id[i]
+        = cs_timer_stats_create("gradients",
+                                phase_stat_name[i],
+                                _gradient_phase_name[i]);
   }
 }
 
@@ -9897,12 +11330,19 @@ void
 cs_gradient_finalize(void)
 {
   _gradient_quantities_destroy();
+  _lsq_b_cocg_destroy();
 
   cs_log_printf(CS_LOG_PERFORMANCE,
                 _("\n"
                   "Total elapsed time for all gradient computations:  %.3f s\n"),
                 _gradient_t_tot.nsec*1e-9);
 
+  for (int i = 0; i < CS_GRADIENT_N_PHASES; i++)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-22s %12.3f s\n",
+                  _(_gradient_phase_name[i]),
+                  _gradient_t_phase[i].nsec*1e-9);
+
   /* Free system info */
 
   for (int ii = 0; ii < cs_glob_gradient_n_systems; ii++) {
@@ -9942,6 +11382,8 @@ cs_gradient_free_quantities(void)
     BFT_FREE(gq->cocg_lsq_ext);
 
   }
+
+  _lsq_b_cocg_destroy();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -9998,13 +11440,22 @@ cs_gradient_scalar(const char                    *var_name,
 
   t0 = cs_timer_time();
 
-  if (update_stats == true)
+  cs_profiling_range_push("gradient", var_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name);
+
+  if (update_stats == true) {
     gradient_info = _find_or_add_system(var_name, gradient_type);
+    _gradient_info_update_traffic(gradient_info, mesh, halo_type, 1);
+  }
+
+  _gradient_info_cur = gradient_info;
 
   /* Synchronize variable */
 
   if (mesh->halo != nullptr) {
 
+    cs_timer_t t_h0 = cs_timer_time();
+
     cs_halo_sync_var(mesh->halo, halo_type, var);
 
     if (c_weight != nullptr) {
@@ -10021,6 +11472,9 @@ cs_gradient_scalar(const char                    *var_name,
       cs_halo_perio_sync_var_vect(mesh->halo, halo_type, (cs_real_t *)f_ext, 3);
     }
 
+    cs_timer_t t_h1 = cs_timer_time();
+    _gradient_phase_add(CS_GRADIENT_PHASE_HALO, &t_h0, &t_h1);
+
   }
 
   _gradient_scalar(var_name,
@@ -10043,6 +11497,9 @@ cs_gradient_scalar(const char                    *var_name,
                    cpl,
                    grad);
 
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
@@ -10052,6 +11509,161 @@ cs_gradient_scalar(const char                    *var_name,
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
   }
 
+  _gradient_info_cur = nullptr;
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields.
+ *
+ * This is equivalent to calling \ref cs_gradient_scalar for each variable
+ * (with no hydrostatic pressure, weighting, or internal coupling), but
+ * for the least-squares gradient with host execution, all gradients are
+ * computed in a single pass over the mesh faces, so face geometry and
+ * cocg values are loaded only once. Other cases fall back to successive
+ * computations.
+ *
+ * \param[in]       var_name       variable name for each variable
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       n_vars         number of variables
+ * \param[in]       bc_coeffs      boundary condition structure
+ *                                 for each variable
+ * \param[in, out]  var            gradient's base variables
+ * \param[out]      grad           gradients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                   *var_name[],
+                         cs_gradient_type_t            gradient_type,
+                         cs_halo_type_t                halo_type,
+                         int                           inc,
+                         int                           n_r_sweeps,
+                         int                           verbosity,
+                         cs_gradient_limit_t           clip_mode,
+                         double                        epsilon,
+                         double                        clip_coeff,
+                         int                           n_vars,
+                         const cs_field_bc_coeffs_t   *bc_coeffs[],
+                         cs_real_t                    *var[],
+                         cs_real_3_t                  *grad[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  bool fused = (   gradient_type == CS_GRADIENT_LSQ
+                && n_vars > 1
+                && cs_get_device_id() < 0) ? true : false;
+
+  for (int v_id = 0; v_id < n_vars && fused; v_id++) {
+    if (bc_coeffs[v_id] == nullptr)
+      fused = false;
+    else if (bc_coeffs[v_id]->a == nullptr || bc_coeffs[v_id]->b == nullptr)
+      fused = false;
+  }
+
+  if (fused == false) {
+    for (int v_id = 0; v_id < n_vars; v_id++)
+      cs_gradient_scalar(var_name[v_id],
+                         gradient_type,
+                         halo_type,
+                         inc,
+                         n_r_sweeps,
+                         0,        /* hyd_p_flag */
+                         1,        /* w_stride */
+                         verbosity,
+                         clip_mode,
+                         epsilon,
+                         clip_coeff,
+                         nullptr,  /* f_ext */
+                         bc_coeffs[v_id],
+                         var[v_id],
+                         nullptr,  /* c_weight */
+                         nullptr,  /* cpl */
+                         grad[v_id]);
+    return;
+  }
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_profiling_range_push("gradient", var_name[0]);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name[0]);
+
+  /* Synchronize variables */
+
+  if (mesh->halo != nullptr) {
+    cs_timer_t t_h0 = cs_timer_time();
+    int *stride;
+    BFT_MALLOC(stride, n_vars, int);
+    for (int v_id = 0; v_id < n_vars; v_id++)
+      stride[v_id] = 1;
+    cs_halo_sync_multi(mesh->halo, halo_type, n_vars, stride, var);
+    BFT_FREE(stride);
+    cs_timer_t t_h1 = cs_timer_time();
+    _gradient_phase_add(CS_GRADIENT_PHASE_HALO, &t_h0, &t_h1);
+  }
+
+  _lsq_scalar_gradient_multi(mesh,
+                             fvq,
+                             halo_type,
+                             inc,
+                             n_vars,
+                             bc_coeffs,
+                             var,
+                             grad);
+
+  cs_timer_t t_c0 = cs_timer_time();
+
+  for (int v_id = 0; v_id < n_vars; v_id++) {
+    _scalar_gradient_clipping(mesh,
+                              fvq,
+                              cs_glob_mesh_adjacencies,
+                              halo_type,
+                              clip_mode,
+                              verbosity,
+                              clip_coeff,
+                              var_name[v_id],
+                              var[v_id],
+                              grad[v_id]);
+
+    if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+      cs_bad_cells_regularisation_vector(grad[v_id], 0);
+  }
+
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
+  cs_timer_t t1 = cs_timer_time();
+  _gradient_phase_add(CS_GRADIENT_PHASE_CLIP, &t_c0, &t1);
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  /* Share elapsed time between variables for logging */
+
+  cs_timer_counter_t dt;
+  CS_TIMER_COUNTER_INIT(dt);
+  cs_timer_counter_add_diff(&dt, &t0, &t1);
+  dt.nsec /= n_vars;
+
+  for (int v_id = 0; v_id < n_vars; v_id++) {
+    cs_gradient_info_t *gradient_info
+      = _find_or_add_system(var_name[v_id], gradient_type);
+    gradient_info->n_calls += 1;
+    CS_TIMER_COUNTER_ADD(gradient_info->t_tot, gradient_info->t_tot, dt);
+    _gradient_info_update_traffic(gradient_info, mesh, halo_type, 1);
+  }
+
   if (_gradient_stat_id > -1)
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
@@ -10104,15 +11716,23 @@ cs_gradient_vector(const char                    *var_name,
 
   t0 = cs_timer_time();
 
+  cs_profiling_range_push("gradient", var_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name);
+
   if (update_stats == true) {
     gradient_info = _find_or_add_system(var_name, gradient_type);
+    _gradient_info_update_traffic(gradient_info, mesh, halo_type, 3);
   }
 
+  _gradient_info_cur = gradient_info;
+
   /* By default, handle the gradient as a tensor
      (i.e. we assume it is the gradient of a vector field) */
 
   if (mesh->halo != nullptr) {
 
+    cs_timer_t t_h0 = cs_timer_time();
+
     cs_halo_sync_var_strided(mesh->halo, halo_type, (cs_real_t *)var, 3);
     if (cs_glob_mesh->have_rotation_perio)
       cs_halo_perio_sync_var_vect(mesh->halo, halo_type, (cs_real_t *)var, 3);
@@ -10120,6 +11740,9 @@ cs_gradient_vector(const char                    *var_name,
     if (c_weight != nullptr)
       cs_halo_sync_var(mesh->halo, halo_type, c_weight);
 
+    cs_timer_t t_h1 = cs_timer_time();
+    _gradient_phase_add(CS_GRADIENT_PHASE_HALO, &t_h0, &t_h1);
+
   }
 
   /* Compute gradient */
@@ -10140,6 +11763,9 @@ cs_gradient_vector(const char                    *var_name,
                    cpl,
                    gradv);
 
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
@@ -10149,6 +11775,8 @@ cs_gradient_vector(const char                    *var_name,
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
   }
 
+  _gradient_info_cur = nullptr;
+
   if (_gradient_stat_id > -1)
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
@@ -10197,17 +11825,26 @@ cs_gradient_tensor(const char                  *var_name,
 
   t0 = cs_timer_time();
 
+  cs_profiling_range_push("gradient", var_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name);
+
   if (update_stats == true) {
     gradient_info = _find_or_add_system(var_name, gradient_type);
+    _gradient_info_update_traffic(gradient_info, mesh, halo_type, 6);
   }
 
+  _gradient_info_cur = gradient_info;
+
   /* By default, handle the gradient as a tensor
      (i.e. we assume it is the gradient of a vector field) */
 
   if (mesh->halo != nullptr) {
+    cs_timer_t t_h0 = cs_timer_time();
     cs_halo_sync_var_strided(mesh->halo, halo_type, (cs_real_t *)var, 6);
     if (mesh->have_rotation_perio)
       cs_halo_perio_sync_var_sym_tens(mesh->halo, halo_type, (cs_real_t *)var);
+    cs_timer_t t_h1 = cs_timer_time();
+    _gradient_phase_add(CS_GRADIENT_PHASE_HALO, &t_h0, &t_h1);
   }
 
   /* Compute gradient */
@@ -10226,6 +11863,9 @@ cs_gradient_tensor(const char                  *var_name,
                    (const cs_real_6_t *)var,
                    grad);
 
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
@@ -10235,6 +11875,8 @@ cs_gradient_tensor(const char                  *var_name,
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
   }
 
+  _gradient_info_cur = nullptr;
+
   if (_gradient_stat_id > -1)
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
@@ -10309,8 +11951,15 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
 
   t0 = cs_timer_time();
 
-  if (update_stats == true)
+  cs_profiling_range_push("gradient", var_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name);
+
+  if (update_stats == true) {
     gradient_info = _find_or_add_system(var_name, gradient_type);
+    _gradient_info_update_traffic(gradient_info, cs_glob_mesh, halo_type, 1);
+  }
+
+  _gradient_info_cur = gradient_info;
 
   _gradient_scalar(var_name,
                    gradient_info,
@@ -10332,6 +11981,9 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
                    cpl,
                    grad);
 
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
@@ -10341,8 +11993,93 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
   }
 
+  _gradient_info_cur = nullptr;
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update a least-squares cell gradient of a scalar variable
+ *         for an increment of that variable.
+ *
+ * Given the gradient of a variable computed using the
+ * \ref CS_GRADIENT_LSQ type with the same boundary conditions
+ * (and with no clipping, weighting, internal coupling, or hydrostatic
+ * pressure), the gradient of the incremented variable is obtained by
+ * adding the contribution of the increment. Only increment values
+ * whose absolute value exceeds the given tolerance are accounted for,
+ * so that only the matching cells and their neighbors are updated.
+ * A zero tolerance leads to an exact update (up to rounding).
+ *
+ * The update is not available for runs on accelerator devices or with
+ * bad cells regularisation; false is returned in that case, and the
+ * gradient is left unchanged.
+ *
+ * \param[in]       var_name   variable name
+ * \param[in]       halo_type  halo type
+ * \param[in]       tolerance  increment tolerance
+ * \param[in]       bc_coeffs  boundary condition structure
+ * \param[in, out]  dvar       variable increment (synchronized here)
+ * \param[in, out]  grad       gradient, updated
+ *
+ * \return  true if the gradient was updated, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_scalar_lsq_update(const char                  *var_name,
+                              cs_halo_type_t               halo_type,
+                              double                       tolerance,
+                              const cs_field_bc_coeffs_t  *bc_coeffs,
+                              cs_real_t                    dvar[],
+                              cs_real_t                    grad[][3])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  if (   cs_get_device_id() > -1
+      || cs_glob_mesh_adjacencies == nullptr
+      || (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+      || bc_coeffs == nullptr)
+    return false;
+
+  if (bc_coeffs->b == nullptr)
+    return false;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_profiling_range_push("gradient", var_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name);
+
+  if (mesh->halo != nullptr)
+    cs_halo_sync_var(mesh->halo, halo_type, dvar);
+
+  _lsq_scalar_gradient_update(mesh,
+                              fvq,
+                              halo_type,
+                              bc_coeffs,
+                              tolerance,
+                              dvar,
+                              grad);
+
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
+  cs_timer_t t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  cs_gradient_info_t *gradient_info
+    = _find_or_add_system(var_name, CS_GRADIENT_LSQ);
+  gradient_info->n_calls += 1;
+  cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+
   if (_gradient_stat_id > -1)
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+
+  return true;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -10395,8 +12132,15 @@ cs_gradient_vector_synced_input(const char                 *var_name,
 
   t0 = cs_timer_time();
 
-  if (update_stats == true)
+  cs_profiling_range_push("gradient", var_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name);
+
+  if (update_stats == true) {
     gradient_info = _find_or_add_system(var_name, gradient_type);
+    _gradient_info_update_traffic(gradient_info, cs_glob_mesh, halo_type, 3);
+  }
+
+  _gradient_info_cur = gradient_info;
 
   /* Compute gradient */
 
@@ -10416,6 +12160,9 @@ cs_gradient_vector_synced_input(const char                 *var_name,
                    cpl,
                    grad);
 
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
@@ -10425,6 +12172,8 @@ cs_gradient_vector_synced_input(const char                 *var_name,
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
   }
 
+  _gradient_info_cur = nullptr;
+
   if (_gradient_stat_id > -1)
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
@@ -10475,8 +12224,15 @@ cs_gradient_tensor_synced_input(const char                  *var_name,
 
   t0 = cs_timer_time();
 
-  if (update_stats == true)
+  cs_profiling_range_push("gradient", var_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(var_name);
+
+  if (update_stats == true) {
     gradient_info = _find_or_add_system(var_name, gradient_type);
+    _gradient_info_update_traffic(gradient_info, cs_glob_mesh, halo_type, 6);
+  }
+
+  _gradient_info_cur = gradient_info;
 
   /* Compute gradient */
 
@@ -10494,6 +12250,9 @@ cs_gradient_tensor_synced_input(const char                  *var_name,
                    var,
                    grad);
 
+  cs_profiling_range_pop("gradient");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
@@ -10503,6 +12262,8 @@ cs_gradient_tensor_synced_input(const char                  *var_name,
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
   }
 
+  _gradient_info_cur = nullptr;
+
   if (_gradient_stat_id > -1)
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
@@ -166,6 +166,50 @@ cs_gradient_scalar(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      grad[][3]);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief  Compute cell gradients of multiple scalar fields.
+ *
+ * This is equivalent to calling \ref cs_gradient_scalar for each variable
+ * (with no hydrostatic pressure, weighting, or internal coupling), but
+ * for the least-squares gradient with host execution, all gradients are
+ * computed in a single pass over the mesh faces, so face geometry and
+ * cocg values are loaded only once. Other cases fall back to successive
+ * computations.
+ *
+ * \param[in]       var_name       variable name for each variable
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       n_vars         number of variables
+ * \param[in]       bc_coeffs      boundary condition structure
+ *                                 for each variable
+ * \param[in, out]  var            gradient's base variables
+ * \param[out]      grad           gradients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                   *var_name[],
+                         cs_gradient_type_t            gradient_type,
+                         cs_halo_type_t                halo_type,
+                         int                           inc,
+                         int                           n_r_sweeps,
+                         int                           verbosity,
+                         cs_gradient_limit_t           clip_mode,
+                         double                        epsilon,
+                         double                        clip_coeff,
+                         int                           n_vars,
+                         const cs_field_bc_coeffs_t   *bc_coeffs[],
+                         cs_real_t                    *var[],
+                         cs_real_3_t                  *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief  Compute cell gradient of vector field.
@@ -290,6 +334,43 @@ cs_gradient_scalar_synced_input(const char                    *var_name,
                                 const cs_internal_coupling_t  *cpl,
                                 cs_real_t                      grad[][3]);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief  Update a least-squares cell gradient of a scalar variable
+ *         for an increment of that variable.
+ *
+ * Given the gradient of a variable computed using the
+ * \ref CS_GRADIENT_LSQ type with the same boundary conditions
+ * (and with no clipping, weighting, internal coupling, or hydrostatic
+ * pressure), the gradient of the incremented variable is obtained by
+ * adding the contribution of the increment. Only increment values
+ * whose absolute value exceeds the given tolerance are accounted for,
+ * so that only the matching cells and their neighbors are updated.
+ * A zero tolerance leads to an exact update (up to rounding).
+ *
+ * The update is not available for runs on accelerator devices or with
+ * bad cells regularisation; false is returned in that case, and the
+ * gradient is left unchanged.
+ *
+ * \param[in]       var_name   variable name
+ * \param[in]       halo_type  halo type
+ * \param[in]       tolerance  increment tolerance
+ * \param[in]       bc_coeffs  boundary condition structure
+ * \param[in, out]  dvar       variable increment (synchronized here)
+ * \param[in, out]  grad       gradient, updated
+ *
+ * \return  true if the gradient was updated, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_scalar_lsq_update(const char                  *var_name,
+                              cs_halo_type_t               halo_type,
+                              double                       tolerance,
+                              const cs_field_bc_coeffs_t  *bc_coeffs,
+                              cs_real_t                    dvar[],
+                              cs_real_t                    grad[][3]);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief  Compute cell gradient of vector field.
@@ -97,6 +97,12 @@
 #define HUGE_VAL  1.E+12
 #endif
 
+/* Handshake rounds and numbering chunk size for pairwise aggregation
+   through a dispatch context */
+
+#define PW_DISPATCH_N_ROUNDS  8
+#define PW_DISPATCH_CHUNK   256
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -289,7 +295,7 @@ static cs_matrix_variant_t **_grid_tune_variant = NULL;
  */
 /*----------------------------------------------------------------------------*/
 
-static inline cs_lnum_t
+CS_F_HOST_DEVICE static inline cs_lnum_t
 _l_id_binary_search(cs_lnum_t        l_id_array_size,
                     cs_lnum_t        l_id,
                     const cs_lnum_t  l_id_array[])
@@ -3134,6 +3140,219 @@ _pairwise_msr(cs_lnum_t                  f_n_rows,
   return c_n_rows;
 }
 
+/*----------------------------------------------------------------------------
+ * Symmetric hash of a pair of row ids, used to break ties between
+ * equivalent neighbors consistently from both sides of a pair.
+ *
+ * parameters:
+ *   i <-- first row id
+ *   j <-- second row id
+ *
+ * returns:
+ *   hash value
+ *----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline unsigned
+_pair_hash(cs_lnum_t  i,
+           cs_lnum_t  j)
+{
+  unsigned a = (i < j) ? i : j, b = (i < j) ? j : i;
+  unsigned h = a*2654435761u ^ (b + 0x9e3779b9u + (a << 6) + (a >> 2));
+  h ^= h >> 16;
+  h *= 0x7feb352du;
+  h ^= h >> 15;
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply one step of the pairwise aggregation algorithm for a
+ *        matrix expected to be an M-matrix, using a dispatch context.
+ *
+ * This variant is based on a handshaking algorithm, so that all rows may
+ * be handled in parallel (and on an accelerator device): at each round,
+ * each unmatched row selects its strongest unmatched neighbor (using the
+ * same criterion as \ref _pairwise_msr, with ties broken by a symmetric
+ * hash of the pair), and rows which select each other are paired. Rows still unmatched after \ref PW_DISPATCH_N_ROUNDS rounds
+ * remain single. Coarse rows are numbered in increasing order of the
+ * lowest matching fine row, so results are independent of the
+ * execution order.
+ *
+ * Pairs are usually slightly less balanced than with the sequential
+ * algorithm, which selects rows by increasing count of remaining
+ * neighbors, so this is only used when the grid is built on the device.
+ *
+ * \param[in, out]  ctx           reference to dispatch context
+ * \param[in]       alloc_mode    allocation mode for work arrays
+ * \param[in]       f_n_rows      number of rows in fine grid
+ * \param[in]       beta          aggregation criterion
+ * \param[in]       dd_threshold  diagonal dominance threshold; if > 0,
+ *                                ignore rows whose diagonal dominance is
+ *                                above this threshold
+ * \param[in]       row_index     matrix row index (separate diagonal)
+ * \param[in]       col_id        matrix column ids
+ * \param[in]       d_val         matrix diagonal values (scalar)
+ * \param[in]       x_val         matrix extradiagonal values (scalar)
+ * \param[out]      f_c_row       fine to coarse rows mapping
+ *
+ * \return  local number of resulting coarse rows
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_pairwise_msr_dispatch(cs_dispatch_context        &ctx,
+                       cs_alloc_mode_t             alloc_mode,
+                       cs_lnum_t                   f_n_rows,
+                       const cs_real_t             beta,
+                       const cs_real_t             dd_threshold,
+                       const cs_lnum_t  *restrict  row_index,
+                       const cs_lnum_t  *restrict  col_id,
+                       const cs_real_t  *restrict  d_val,
+                       const cs_real_t  *restrict  x_val,
+                       cs_lnum_t        *restrict  f_c_row)
+{
+  if (f_n_rows < 1)
+    return 0;
+
+  const cs_lnum_t n_chunks
+    = (f_n_rows + PW_DISPATCH_CHUNK - 1) / PW_DISPATCH_CHUNK;
+
+  /* Allocate working arrays */
+
+  cs_real_t  *a_max; /* max per line */
+  cs_lnum_t  *pick;  /* selected neighbor for current round */
+  cs_lnum_t  *mate;  /* matched row (or -1) */
+  cs_lnum_t  *c_shift;
+
+  CS_MALLOC_HD(a_max, f_n_rows, cs_real_t, alloc_mode);
+  CS_MALLOC_HD(pick, f_n_rows, cs_lnum_t, alloc_mode);
+  CS_MALLOC_HD(mate, f_n_rows, cs_lnum_t, alloc_mode);
+
+  /* Chunk shifts are scanned on the host */
+  CS_MALLOC_HD(c_shift, n_chunks + 1, cs_lnum_t,
+               (alloc_mode > CS_ALLOC_HOST) ?
+               CS_ALLOC_HOST_DEVICE_SHARED : CS_ALLOC_HOST);
+
+  /* Computation of the maximum over line ii and test if the line ii is
+   * ignored (same criteria as the sequential variant). */
+
+  ctx.parallel_for(f_n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+    cs_real_t sum = 0.0, _a_max = 0.0;
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {
+      cs_real_t xv = x_val[jj];
+      sum += (xv < 0) ? -xv : xv;
+      if (xv < 0 && -xv > _a_max)
+        _a_max = -xv;
+    }
+    a_max[ii] = _a_max;
+    mate[ii] = -1;
+    if (dd_threshold > 0 && d_val[ii] > dd_threshold * sum)
+      f_c_row[ii] = -1;
+    else
+      f_c_row[ii] = -2;
+  });
+
+  /* Handshaking rounds */
+
+  for (int round = 0; round < PW_DISPATCH_N_ROUNDS; round++) {
+
+    ctx.parallel_for(f_n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+      cs_lnum_t jj = -1;
+      if (f_c_row[ii] == -2 && mate[ii] < 0) {
+        cs_real_t _a_min = HUGE_VAL;
+        unsigned h_max = 0;
+        for (cs_lnum_t kk_idx = row_index[ii];
+             kk_idx < row_index[ii+1];
+             kk_idx++) {
+          cs_lnum_t kk = col_id[kk_idx];
+          if (kk < f_n_rows && kk != ii && f_c_row[kk] == -2 && mate[kk] < 0) {
+            cs_real_t xv = x_val[kk_idx];
+            unsigned h = _pair_hash(ii, kk);
+            if (xv < _a_min || (xv <= _a_min && h > h_max)) {
+              _a_min = xv;
+              h_max = h;
+              jj = kk;
+            }
+          }
+        }
+        if (_a_min >= -beta*a_max[ii])
+          jj = -1;
+      }
+      pick[ii] = jj;
+    });
+
+    double n_new = 0;
+    ctx.parallel_for_reduce_sum
+      (f_n_rows, n_new, [=] CS_F_HOST_DEVICE (cs_lnum_t ii, double &sum) {
+        cs_lnum_t jj = pick[ii];
+        if (jj > -1 && pick[jj] == ii) {
+          mate[ii] = jj;
+          sum += 1;
+        }
+      });
+    ctx.wait();
+
+    if (n_new < 1)
+      break;
+  }
+
+  /* Count leaders (lowest row of each aggregate) per chunk */
+
+  ctx.parallel_for(n_chunks, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    cs_lnum_t s_id = c_id*PW_DISPATCH_CHUNK;
+    cs_lnum_t e_id = s_id + PW_DISPATCH_CHUNK;
+    if (e_id > f_n_rows)
+      e_id = f_n_rows;
+    cs_lnum_t n = 0;
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      if (f_c_row[ii] == -2 && (mate[ii] < 0 || mate[ii] > ii))
+        n++;
+    }
+    c_shift[c_id + 1] = n;
+  });
+  ctx.wait();
+
+  c_shift[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++)
+    c_shift[c_id + 1] += c_shift[c_id];
+
+  const cs_lnum_t c_n_rows = c_shift[n_chunks];
+
+  /* Number leaders, then propagate to matched rows */
+
+  ctx.parallel_for(n_chunks, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    cs_lnum_t s_id = c_id*PW_DISPATCH_CHUNK;
+    cs_lnum_t e_id = s_id + PW_DISPATCH_CHUNK;
+    if (e_id > f_n_rows)
+      e_id = f_n_rows;
+    cs_lnum_t c_row_id = c_shift[c_id];
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      if (f_c_row[ii] == -2 && (mate[ii] < 0 || mate[ii] > ii))
+        pick[ii] = c_row_id++;
+      else
+        pick[ii] = -1;
+    }
+  });
+
+  ctx.parallel_for(f_n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+    if (f_c_row[ii] == -2) {
+      cs_lnum_t jj = mate[ii];
+      f_c_row[ii] = (jj > -1 && jj < ii) ? pick[jj] : pick[ii];
+    }
+  });
+  ctx.wait();
+
+  /* Free working arrays */
+
+  CS_FREE_HD(c_shift);
+  CS_FREE_HD(mate);
+  CS_FREE_HD(pick);
+  CS_FREE_HD(a_max);
+
+  return c_n_rows;
+}
+
  /*----------------------------------------------------------------------------
  * Build a coarse grid level from the previous level using an
  * automatic criterion and pairwise aggregation variant 1,
@@ -3177,14 +3396,14 @@ _automatic_aggregation_pw_msr(const cs_grid_t  *f,
   const cs_lnum_t eb_size = f->eb_size;
 
   if (db_size > 1) {
-    BFT_MALLOC(_d_val, f_n_rows, cs_real_t);
+    CS_MALLOC_HD(_d_val, f_n_rows, cs_real_t, f->alloc_mode);
     _reduce_block(f_n_rows, db_size, d_val, _d_val);
     d_val = _d_val;
   }
 
   if (eb_size > 1) {
     cs_lnum_t f_n_enz = row_index[f_n_rows];
-    BFT_MALLOC(_x_val, f_n_enz, cs_real_t);
+    CS_MALLOC_HD(_x_val, f_n_enz, cs_real_t, f->alloc_mode);
     _reduce_block(f_n_enz, eb_size, x_val, _x_val);
     x_val = _x_val;
   }
@@ -3193,19 +3412,39 @@ _automatic_aggregation_pw_msr(const cs_grid_t  *f,
     bft_printf("\n     %s: beta %5.3e; diag_dominance_threshold: %5.3e\n",
                __func__, beta, dd_threshold);
 
-  cs_lnum_t c_n_rows = _pairwise_msr(f_n_rows,
-                                     beta,
-                                     dd_threshold,
-                                     row_index,
-                                     col_id,
-                                     d_val,
-                                     x_val,
-                                     f_c_row);
+  /* When the grid is device-resident, use the handshaking variant */
+
+  cs_dispatch_context ctx;
+  if (f->alloc_mode == CS_ALLOC_HOST)
+    ctx.set_use_gpu(false);
+
+  cs_lnum_t c_n_rows = 0;
+
+  if (ctx.use_gpu())
+    c_n_rows = _pairwise_msr_dispatch(ctx,
+                                      f->alloc_mode,
+                                      f_n_rows,
+                                      beta,
+                                      dd_threshold,
+                                      row_index,
+                                      col_id,
+                                      d_val,
+                                      x_val,
+                                      f_c_row);
+  else
+    c_n_rows = _pairwise_msr(f_n_rows,
+                             beta,
+                             dd_threshold,
+                             row_index,
+                             col_id,
+                             d_val,
+                             x_val,
+                             f_c_row);
 
   /* Free working arrays */
 
-  BFT_FREE(_d_val);
-  BFT_FREE(_x_val);
+  CS_FREE_HD(_d_val);
+  CS_FREE_HD(_x_val);
 
   if (cs_glob_timer_kernels_flag > 0) {
     std::chrono::high_resolution_clock::time_point
@@ -4032,7 +4271,7 @@ _coarse_msr_struct(cs_lnum_t          f_n_rows,
                    cs_lnum_t        **c_col_ids)
 {
   cs_lnum_t *restrict c_row_idx;
-  BFT_MALLOC(c_row_idx, c_n_rows+1, cs_lnum_t);
+  CS_MALLOC_HD(c_row_idx, c_n_rows+1, cs_lnum_t, alloc_mode);
   c_row_idx[0] = 0;
 
   cs_lnum_t *t_c_scan = nullptr;
@@ -6132,23 +6371,41 @@ _compute_coarse_quantities_conv_diff(const cs_grid_t  *fine_grid,
 }
 
 /*----------------------------------------------------------------------------
- * Build a coarse level from a finer level with an MSR matrix.
+ * Compute coarse MSR matrix values from a finer MSR matrix, given the
+ * coarse structure and the coarse to fine rows adjacency.
  *
  * parameters:
- *   fine_grid   <-- Fine grid structure
- *   coarse_grid <-> Coarse grid structure
+ *   fine_grid     <-- fine grid structure
+ *   coarse_grid   <-- coarse grid structure
+ *   f_row_index   <-- fine matrix row index
+ *   f_col_id      <-- fine matrix column ids
+ *   f_d_val       <-- fine matrix diagonal values
+ *   f_x_val       <-- fine matrix extradiagonal values
+ *   c_f_row_index <-- coarse to fine rows index
+ *   c_f_row_ids   <-- coarse to fine row ids
+ *   c_row_index   <-- coarse matrix row index
+ *   c_col_id      <-- coarse matrix column ids
+ *   c_d_val       --> coarse matrix diagonal values
+ *   c_x_val       --> coarse matrix extradiagonal values
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
-                               cs_grid_t        *coarse_grid)
-
+_coarse_msr_values(const cs_grid_t  *fine_grid,
+                   const cs_grid_t  *coarse_grid,
+                   const cs_lnum_t  *f_row_index,
+                   const cs_lnum_t  *f_col_id,
+                   const cs_real_t  *f_d_val,
+                   const cs_real_t  *f_x_val,
+                   const cs_lnum_t  *c_f_row_index,
+                   const cs_lnum_t  *c_f_row_ids,
+                   const cs_lnum_t  *c_row_index,
+                   const cs_lnum_t  *c_col_id,
+                   cs_real_t        *restrict c_d_val,
+                   cs_real_t        *restrict c_x_val)
 {
-  std::chrono::high_resolution_clock::time_point t_start;
-  if (cs_glob_timer_kernels_flag > 0)
-    t_start = std::chrono::high_resolution_clock::now();
-
-  int n_f_threads = cs_parall_n_threads(fine_grid->n_rows, CS_THR_MIN);
+  cs_dispatch_context ctx;
+  if (coarse_grid->alloc_mode == CS_ALLOC_HOST)
+    ctx.set_use_gpu(false);
 
   const cs_lnum_t db_size = fine_grid->db_size;
   const cs_lnum_t db_stride = db_size*db_size;
@@ -6156,71 +6413,14 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
   const cs_lnum_t eb_size = fine_grid->eb_size;
   const cs_lnum_t eb_stride = eb_size*eb_size;
 
-  const cs_lnum_t f_n_rows = fine_grid->n_rows;
-
   const cs_lnum_t c_n_rows = coarse_grid->n_rows;
   const cs_lnum_t *f_c_row = coarse_grid->coarse_row;
 
-  /* Fine matrix in the MSR format */
-
-  const cs_lnum_t  *f_row_index, *f_col_id;
-  const cs_real_t  *f_d_val, *f_x_val;
-
-  cs_matrix_get_msr_arrays(fine_grid->matrix,
-                           &f_row_index,
-                           &f_col_id,
-                           &f_d_val,
-                           &f_x_val);
-
-  /* Determine reverse coarse to fine adjacency */
-
-  cs_lnum_t *c_f_row_index = nullptr, *c_f_row_ids = nullptr;
-  cs_lnum_t *c_row_index_0 = nullptr;
-
-  _coarse_to_fine_adjacency_msr(f_n_rows,
-                                c_n_rows,
-                                coarse_grid->alloc_mode,
-                                n_f_threads,
-                                f_c_row,
-                                f_row_index,
-                                &c_f_row_index,
-                                &c_f_row_ids,
-                                &c_row_index_0);
-
-  /* Coarse matrix elements in the MSR format */
-
-  /* Build structure
-     --------------- */
-
-  cs_lnum_t *c_row_index,  *c_col_id;
-
-  _coarse_msr_struct(f_n_rows,
-                     c_n_rows,
-                     coarse_grid->alloc_mode,
-                     f_row_index,
-                     f_col_id,
-                     f_c_row,
-                     c_f_row_index,
-                     c_f_row_ids,
-                     c_row_index_0,
-                     &c_row_index,
-                     &c_col_id);
-
-  /* Assign values
-     ------------- */
-
-  cs_lnum_t c_nnz = c_row_index[c_n_rows];
-
-  cs_real_t *restrict c_d_val, *restrict c_x_val;
-  CS_MALLOC_HD(c_d_val, c_n_rows*db_stride, cs_real_t, coarse_grid->alloc_mode);
-  CS_MALLOC_HD(c_x_val, c_nnz*eb_stride, cs_real_t, coarse_grid->alloc_mode);
-
   /* Scalar case */
 
   if (db_size == 1) {
 
-    #pragma omp parallel for num_threads(n_f_threads)
-    for (cs_lnum_t ic = 0; ic < c_n_rows; ic++) {
+    ctx.parallel_for(c_n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ic) {
 
       const cs_lnum_t s_id = c_row_index[ic];
       const cs_lnum_t n_cols = c_row_index[ic+1] - s_id;
@@ -6259,7 +6459,7 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
         } /* Loop in fine columns */
       } /* Loop on fine rows */
 
-    } /* OpenMP loop on coarse rows */
+    }); /* Loop on coarse rows */
 
   }
 
@@ -6267,8 +6467,7 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
   else {
 
-    #pragma omp parallel for num_threads(n_f_threads)
-    for (cs_lnum_t ic = 0; ic < c_n_rows; ic++) {
+    ctx.parallel_for(c_n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ic) {
 
       const cs_lnum_t s_id = c_row_index[ic];
       const cs_lnum_t n_cols = c_row_index[ic+1] - s_id;
@@ -6325,10 +6524,107 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
         } /* Loop in fine columns */
       } /* Loop on fine rows */
 
-    } /* OPenMP loop on coarse rows */
+    }); /* Loop on coarse rows */
 
   }
 
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------
+ * Build a coarse level from a finer level with an MSR matrix.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
+                               cs_grid_t        *coarse_grid)
+
+{
+  std::chrono::high_resolution_clock::time_point t_start;
+  if (cs_glob_timer_kernels_flag > 0)
+    t_start = std::chrono::high_resolution_clock::now();
+
+  int n_f_threads = cs_parall_n_threads(fine_grid->n_rows, CS_THR_MIN);
+
+  const cs_lnum_t db_stride = fine_grid->db_size*fine_grid->db_size;
+  const cs_lnum_t eb_stride = fine_grid->eb_size*fine_grid->eb_size;
+
+  const cs_lnum_t f_n_rows = fine_grid->n_rows;
+
+  const cs_lnum_t c_n_rows = coarse_grid->n_rows;
+  const cs_lnum_t *f_c_row = coarse_grid->coarse_row;
+
+  /* Fine matrix in the MSR format */
+
+  const cs_lnum_t  *f_row_index, *f_col_id;
+  const cs_real_t  *f_d_val, *f_x_val;
+
+  cs_matrix_get_msr_arrays(fine_grid->matrix,
+                           &f_row_index,
+                           &f_col_id,
+                           &f_d_val,
+                           &f_x_val);
+
+  /* Determine reverse coarse to fine adjacency */
+
+  cs_lnum_t *c_f_row_index = nullptr, *c_f_row_ids = nullptr;
+  cs_lnum_t *c_row_index_0 = nullptr;
+
+  _coarse_to_fine_adjacency_msr(f_n_rows,
+                                c_n_rows,
+                                coarse_grid->alloc_mode,
+                                n_f_threads,
+                                f_c_row,
+                                f_row_index,
+                                &c_f_row_index,
+                                &c_f_row_ids,
+                                &c_row_index_0);
+
+  /* Coarse matrix elements in the MSR format */
+
+  /* Build structure
+     --------------- */
+
+  cs_lnum_t *c_row_index,  *c_col_id;
+
+  _coarse_msr_struct(f_n_rows,
+                     c_n_rows,
+                     coarse_grid->alloc_mode,
+                     f_row_index,
+                     f_col_id,
+                     f_c_row,
+                     c_f_row_index,
+                     c_f_row_ids,
+                     c_row_index_0,
+                     &c_row_index,
+                     &c_col_id);
+
+  /* Assign values
+     ------------- */
+
+  cs_lnum_t c_nnz = c_row_index[c_n_rows];
+
+  cs_real_t *restrict c_d_val, *restrict c_x_val;
+  CS_MALLOC_HD(c_d_val, c_n_rows*db_stride, cs_real_t, coarse_grid->alloc_mode);
+  CS_MALLOC_HD(c_x_val, c_nnz*eb_stride, cs_real_t, coarse_grid->alloc_mode);
+
+  _coarse_msr_values(fine_grid,
+                     coarse_grid,
+                     f_row_index,
+                     f_col_id,
+                     f_d_val,
+                     f_x_val,
+                     c_f_row_index,
+                     c_f_row_ids,
+                     c_row_index,
+                     c_col_id,
+                     c_d_val,
+                     c_x_val);
+
   /* Now build matrix */
 
   _build_coarse_matrix_msr(coarse_grid, fine_grid->symmetric,
@@ -7490,6 +7786,39 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Use a single-precision copy of a coarse grid's matrix coefficients
+ * for matrix-vector products.
+ *
+ * Only scalar MSR matrices of host-based coarse grids (level > 0) are
+ * handled; the call is ignored for other grids. Products are still
+ * accumulated in double precision.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_single_precision(cs_grid_t  *g)
+{
+  assert(g != NULL);
+
+  if (   g->level < 1 || g->_matrix == NULL
+      || g->db_size != 1 || g->alloc_mode > CS_ALLOC_HOST)
+    return;
+
+  if (cs_matrix_get_type(g->_matrix) != CS_MATRIX_MSR)
+    return;
+
+  cs_matrix_fill_type_t mft
+    = cs_matrix_get_fill_type(g->symmetric, g->db_size, g->eb_size);
+
+  cs_matrix_variant_t *mv = cs_matrix_variant_create(g->_matrix);
+  cs_matrix_variant_set_func(mv, mft, CS_MATRIX_SPMV_N_TYPES, NULL, "f32");
+  cs_matrix_variant_apply(g->_matrix, mv);
+  cs_matrix_variant_destroy(&mv);
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -7550,6 +7879,8 @@ cs_grid_get_comm_merge(MPI_Comm  parent,
  *   alloc_mode                 <-- Memory allocation mode
  *   coarsening_type            <-- Coarsening criteria type
  *   aggregation_limit          <-- Maximum allowed fine rows per coarse rows
+ *   aggressive                 <-- If true, apply a second aggregation pass
+ *                                  (aggregating distance-2 neighbors)
  *   verbosity                  <-- Verbosity level
  *   merge_stride               <-- Associated merge stride
  *   merge_rows_mean_threshold  <-- mean number of rows under which
@@ -7567,6 +7898,7 @@ cs_grid_coarsen(const cs_grid_t      *f,
                 cs_alloc_mode_t       alloc_mode,
                 cs_grid_coarsening_t  coarsening_type,
                 int                   aggregation_limit,
+                bool                  aggressive,
                 int                   verbosity,
                 int                   merge_stride,
                 int                   merge_rows_mean_threshold,
@@ -7701,6 +8033,12 @@ cs_grid_coarsen(const cs_grid_t      *f,
     }
   }
 
+  /* Aggressive coarsening is obtained by coarsening the resulting grid
+     once more, and keeping only the coarsest grid */
+
+  if (aggressive && recurse < 2)
+    recurse = 2;
+
   _coarsen(f, c);
 
   if (verbosity > 3)
@@ -7846,10 +8184,14 @@ cs_grid_coarsen(const cs_grid_t      *f,
   if (recurse > 1) {
 
     /* Build coarser grid from coarse grid */
+    int cc_aggregation_limit
+      = (aggressive) ? aggregation_limit : aggregation_limit / recurse;
+
     cs_grid_t *cc = cs_grid_coarsen(c,
                                     c->alloc_mode,
                                     coarsening_type,
-                                    aggregation_limit / recurse,
+                                    cc_aggregation_limit,
+                                    false, // aggressive
                                     verbosity,
                                     0, // merge_stride,
                                     0, // merge_rows_mean_threshold,
@@ -8048,6 +8390,128 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Update the matrix coefficients of a coarse grid from a finer grid,
+ * keeping the existing aggregation and coarse matrix structure.
+ *
+ * The fine grid is assigned as the new parent of the coarse grid; it must
+ * have the same number of rows and matrix structure as the grid from
+ * which the coarse grid was built.
+ *
+ * Only coarse grids built from an MSR matrix without P0/P1 relaxation
+ * and without merging at that level may be updated in this manner.
+ *
+ * parameters:
+ *   f <-- Fine grid structure
+ *   c <-> Coarse grid structure
+ *
+ * returns:
+ *   true if coefficients were updated, false if the coarse grid
+ *   must be rebuilt
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_coarse_coefficients(const cs_grid_t  *f,
+                                   cs_grid_t        *c)
+{
+  assert(f != NULL && c != NULL);
+
+  if (   c->level != f->level + 1
+      || c->coarse_row == NULL || c->_matrix == NULL
+      || c->relaxation > 0
+      || c->db_size != f->db_size || c->eb_size != f->eb_size
+      || c->symmetric != cs_matrix_is_symmetric(f->matrix))
+    return false;
+
+  if (   cs_matrix_get_type(f->matrix) != CS_MATRIX_MSR
+      || cs_matrix_get_type(c->matrix) != CS_MATRIX_MSR)
+    return false;
+
+#if defined(HAVE_MPI)
+  if (c->next_merge_stride != f->next_merge_stride)
+    return false;
+#endif
+
+  int n_f_threads = cs_parall_n_threads(f->n_rows, CS_THR_MIN);
+
+  const cs_lnum_t db_stride = f->db_size*f->db_size;
+  const cs_lnum_t eb_stride = f->eb_size*f->eb_size;
+
+  /* Fine and coarse matrices in the MSR format */
+
+  const cs_lnum_t  *f_row_index, *f_col_id;
+  const cs_real_t  *f_d_val, *f_x_val;
+
+  cs_matrix_get_msr_arrays(f->matrix,
+                           &f_row_index,
+                           &f_col_id,
+                           &f_d_val,
+                           &f_x_val);
+
+  const cs_lnum_t  *c_row_index, *c_col_id;
+
+  cs_matrix_get_msr_arrays(c->matrix,
+                           &c_row_index,
+                           &c_col_id,
+                           NULL,
+                           NULL);
+
+  /* Determine reverse coarse to fine adjacency */
+
+  cs_lnum_t *c_f_row_index = nullptr, *c_f_row_ids = nullptr;
+  cs_lnum_t *c_row_index_0 = nullptr;
+
+  _coarse_to_fine_adjacency_msr(f->n_rows,
+                                c->n_rows,
+                                c->alloc_mode,
+                                n_f_threads,
+                                c->coarse_row,
+                                f_row_index,
+                                &c_f_row_index,
+                                &c_f_row_ids,
+                                &c_row_index_0);
+
+  /* Assign values */
+
+  cs_lnum_t c_nnz = c_row_index[c->n_rows];
+
+  cs_real_t *c_d_val, *c_x_val;
+  CS_MALLOC_HD(c_d_val, c->n_rows*db_stride, cs_real_t, c->alloc_mode);
+  CS_MALLOC_HD(c_x_val, c_nnz*eb_stride, cs_real_t, c->alloc_mode);
+
+  c->parent = f;
+
+  _coarse_msr_values(f,
+                     c,
+                     f_row_index,
+                     f_col_id,
+                     f_d_val,
+                     f_x_val,
+                     c_f_row_index,
+                     c_f_row_ids,
+                     c_row_index,
+                     c_col_id,
+                     c_d_val,
+                     c_x_val);
+
+  cs_matrix_release_coefficients(c->_matrix);
+
+  cs_matrix_transfer_coefficients_msr(c->_matrix,
+                                      c->symmetric,
+                                      c->db_size,
+                                      c->eb_size,
+                                      c_row_index,
+                                      c_col_id,
+                                      &c_d_val,
+                                      &c_x_val);
+
+  CS_FREE(c_row_index_0);
+  CS_FREE(c_f_row_ids);
+  CS_FREE(c_f_row_index);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Project coarse grid row numbers to base grid.
  *
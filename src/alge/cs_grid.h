@@ -260,6 +260,21 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Use a single-precision copy of a coarse grid's matrix coefficients
+ * for matrix-vector products.
+ *
+ * Only scalar MSR matrices of host-based coarse grids (level > 0) are
+ * handled; the call is ignored for other grids. Products are still
+ * accumulated in double precision.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_single_precision(cs_grid_t  *g);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -300,6 +315,8 @@ cs_grid_get_comm_merge(MPI_Comm  parent,
  *   alloc_mode                 <-- Memory allocation mode
  *   coarsening_type            <-- Coarsening criteria type
  *   aggregation_limit          <-- Maximum allowed fine rows per coarse rows
+ *   aggressive                 <-- If true, apply a second aggregation pass
+ *                                  (aggregating distance-2 neighbors)
  *   verbosity                  <-- Verbosity level
  *   merge_stride               <-- Associated merge stride
  *   merge_rows_mean_threshold  <-- mean number of rows under which
@@ -317,6 +334,7 @@ cs_grid_coarsen(const cs_grid_t      *f,
                 cs_alloc_mode_t       alloc_mode,
                 cs_grid_coarsening_t  coarsening_type,
                 int                   aggregation_limit,
+                bool                  aggressive,
                 int                   verbosity,
                 int                   merge_stride,
                 int                   merge_rows_mean_threshold,
@@ -342,6 +360,30 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
                           int               merge_stride,
                           int               verbosity);
 
+/*----------------------------------------------------------------------------
+ * Update the matrix coefficients of a coarse grid from a finer grid,
+ * keeping the existing aggregation and coarse matrix structure.
+ *
+ * The fine grid is assigned as the new parent of the coarse grid; it must
+ * have the same number of rows and matrix structure as the grid from
+ * which the coarse grid was built.
+ *
+ * Only coarse grids built from an MSR matrix without P0/P1 relaxation
+ * and without merging at that level may be updated in this manner.
+ *
+ * parameters:
+ *   f <-- Fine grid structure
+ *   c <-> Coarse grid structure
+ *
+ * returns:
+ *   true if coefficients were updated, false if the coarse grid
+ *   must be rebuilt
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_coarse_coefficients(const cs_grid_t  *f,
+                                   cs_grid_t        *c);
+
 /*----------------------------------------------------------------------------
  * Project coarse grid row numbers to base grid.
  *
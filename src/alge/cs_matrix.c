@@ -4043,6 +4043,7 @@ _matrix_create(cs_matrix_type_t  type)
 
   m->n_rows = 0;
   m->n_cols_ext = 0;
+  m->n_no_adj_halo_elts = -1;
 
   m->symmetric = false;
 
@@ -4667,6 +4668,7 @@ cs_matrix_create_by_local_restrict(const cs_matrix_t  *src)
   BFT_MALLOC(m, 1, cs_matrix_t);
   memcpy(m, src, sizeof(cs_matrix_t));
   m->n_cols_ext = m->n_rows;
+  m->n_no_adj_halo_elts = m->n_rows;
 
   m->structure = NULL;
   m->_structure = NULL;
@@ -5118,6 +5120,137 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set native scalar matrix coefficients so that extra-diagonal terms
+ *        are computed on the fly from interior face values (matrix-free
+ *        operator).
+ *
+ * Extra-diagonal terms match those built by \ref cs_matrix_wrapper_scalar
+ * (upwind convection and non-reconstructed diffusion), so only the
+ * diagonal (which includes boundary and source term contributions)
+ * needs to be assembled. All arrays are shared with the caller, and must
+ * remain available until coefficients are released.
+ *
+ * Only matrices of native type with scalar coefficients are handled,
+ * so this excludes solvers requiring assembled coefficients (such as
+ * multigrid or Gauss-Seidel).
+ *
+ * \param[in, out]  matrix      pointer to matrix structure
+ * \param[in]       iconvp      1 if convection is active, 0 otherwise
+ * \param[in]       idiffp      1 if diffusion is active, 0 otherwise
+ * \param[in]       thetap      weighting coefficient for the theta-scheme
+ * \param[in]       i_massflux  mass flux at interior faces
+ *                              (NULL if iconvp = 0)
+ * \param[in]       i_visc      face viscosity at interior faces
+ * \param[in]       xcpp        cell specific heat if convection is
+ *                              multiplied by Cp, or NULL
+ * \param[in]       da          diagonal values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_matrix_free(cs_matrix_t      *matrix,
+                                       int               iconvp,
+                                       int               idiffp,
+                                       double            thetap,
+                                       const cs_real_t  *i_massflux,
+                                       const cs_real_t  *i_visc,
+                                       const cs_real_t  *xcpp,
+                                       const cs_real_t  *da)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0, _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_NATIVE)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Matrix format %s does not handle matrix-free coefficients."),
+       matrix->type_name);
+
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+
+  bool symmetric = (iconvp == 0) ? true : false;
+
+  cs_matrix_set_coefficients(matrix,
+                             symmetric,
+                             1,
+                             1,
+                             ms->n_edges,
+                             ms->edges,
+                             da,
+                             NULL);
+
+  cs_matrix_native_mf_t  mf = {.iconvp = iconvp,
+                               .idiffp = idiffp,
+                               .thetap = thetap,
+                               .i_massflux = i_massflux,
+                               .i_visc = i_visc,
+                               .xcpp = xcpp,
+                               .fill_type = matrix->fill_type};
+
+  cs_matrix_spmv_set_native_matrix_free(matrix, &mf);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set MSR scalar matrix coefficients so that the matrix.vector
+ * product is computed by a given operator function (matrix-free operator).
+ *
+ * Only the diagonal is stored (and shared with the caller), so that
+ * diagonal-based preconditioners may be used, but solvers requiring
+ * assembled extra-diagonal coefficients (such as multigrid or
+ * Gauss-Seidel) are excluded. The operator input must remain available
+ * until coefficients are released.
+ *
+ * \param[in, out]  matrix     pointer to matrix structure
+ * \param[in]       symmetric  indicates if the operator is symmetric
+ * \param[in]       da         diagonal values
+ * \param[in]       op_func    function computing y = A.x
+ * \param[in]       op_input   pointer to the input structure of op_func
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_operator(cs_matrix_t           *matrix,
+                                    bool                   symmetric,
+                                    const cs_real_t       *da,
+                                    cs_matrix_operator_t  *op_func,
+                                    void                  *op_input)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0, _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_MSR)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Matrix format %s does not handle matrix-free operators."),
+       matrix->type_name);
+
+  cs_base_check_bool(&symmetric);
+
+  _set_fill_info(matrix, symmetric, 1, 1);
+
+  /* Only the diagonal is mapped; no extra-diagonal values are stored */
+
+  cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  mc->symmetric = symmetric;
+  _map_or_copy_d_coeffs_msr(matrix, false, da);
+
+  mc->eb_size = 1;
+  CS_FREE(mc->_e_val);
+  mc->e_val = NULL;
+
+  matrix->xa = NULL;
+
+  cs_matrix_operator_mf_t  mf = {.func = op_func,
+                                 .input = op_input,
+                                 .fill_type = matrix->fill_type};
+
+  cs_matrix_spmv_set_operator_matrix_free(matrix, &mf);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set matrix coefficients, copying values to private arrays.
@@ -6133,6 +6266,70 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
               cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.block product Y = A.X for a set of interleaved vectors.
+ *
+ * Vector values are interleaved, so value i of vector k is found at
+ * position i*n_vecs + k; x must thus be sized for n_cols_ext*n_vecs values.
+ *
+ * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, all vectors are multiplied in a single
+ * pass over matrix coefficients; for other matrices, it falls back to
+ * successive matrix.vector products.
+ *
+ * \param[in]       matrix         pointer to matrix structure
+ * \param[in]       n_vecs         number of interleaved vectors
+ * \param[in, out]  x              multiplying vectors values
+ *                                 (ghost values updated)
+ * \param[out]      y              resulting vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(const cs_matrix_t   *matrix,
+                                int                  n_vecs,
+                                cs_real_t           *restrict x,
+                                cs_real_t           *restrict y)
+{
+  assert(matrix != NULL);
+
+  if (n_vecs < 1)
+    return;
+
+  if (matrix->halo != NULL)
+    cs_halo_sync_var_strided(matrix->halo, CS_HALO_STANDARD, x, n_vecs);
+
+  if (cs_matrix_spmv_multi(matrix, n_vecs, x, y))
+    return;
+
+  /* Fallback: de-interleave and multiply vectors one by one */
+
+  const cs_lnum_t n_rows = matrix->n_rows;
+  const cs_lnum_t n_cols_ext = matrix->n_cols_ext;
+
+  cs_real_t *_x, *_y;
+  BFT_MALLOC(_x, n_cols_ext, cs_real_t);
+  BFT_MALLOC(_y, n_rows, cs_real_t);
+
+  for (int k = 0; k < n_vecs; k++) {
+
+#   pragma omp parallel for  if(n_cols_ext > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_cols_ext; i++)
+      _x[i] = x[i*n_vecs + k];
+
+    cs_matrix_vector_multiply_nosync(matrix, _x, _y);
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      y[i*n_vecs + k] = _y[i];
+
+  }
+
+  BFT_FREE(_y);
+  BFT_FREE(_x);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Partial matrix.vector product.
@@ -6486,6 +6683,29 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
 #endif /* defined(HAVE_OPENMP) */
 
+    _variant_add(_("MSR, SELL-C-sigma"),
+                 m->type,
+                 m->fill_type,
+                 m->numbering,
+                 "sell",
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#if defined(HAVE_CUDA)
+
+    if (cs_get_device_id() > -1)
+      _variant_add(_("MSR, CUDA SELL-C-sigma"),
+                   m->type,
+                   m->fill_type,
+                   m->numbering,
+                   "cuda_sell",
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+
+#endif /* defined(HAVE_CUDA) */
+
   }
 
   n_variants_max = *n_variants;
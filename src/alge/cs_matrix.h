@@ -126,6 +126,15 @@ typedef struct {
 
 } cs_matrix_row_info_t;
 
+/* Function applying an operator y = A.x (matrix-free) on the local rows of
+   a matrix. Any required parallel exchange of x values is handled by the
+   function itself. */
+
+typedef void
+(cs_matrix_operator_t)(void             *input,
+                       const cs_real_t  *x,
+                       cs_real_t        *y);
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -559,6 +568,67 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
                            const cs_real_t    *da,
                            const cs_real_t    *xa);
 
+/*----------------------------------------------------------------------------
+ * Set native scalar matrix coefficients so that extra-diagonal terms are
+ * computed on the fly from interior face values (matrix-free operator).
+ *
+ * Extra-diagonal terms match those built by cs_matrix_wrapper_scalar
+ * (upwind convection and non-reconstructed diffusion), so only the
+ * diagonal (which includes boundary and source term contributions)
+ * needs to be assembled. All arrays are shared with the caller, and must
+ * remain available until coefficients are released.
+ *
+ * Only matrices of native type with scalar coefficients are handled,
+ * so this excludes solvers requiring assembled coefficients (such as
+ * multigrid or Gauss-Seidel).
+ *
+ * parameters:
+ *   matrix     <-> pointer to matrix structure
+ *   iconvp     <-- 1 if convection is active, 0 otherwise
+ *   idiffp     <-- 1 if diffusion is active, 0 otherwise
+ *   thetap     <-- weighting coefficient for the theta-scheme
+ *   i_massflux <-- mass flux at interior faces (NULL if iconvp = 0)
+ *   i_visc     <-- face viscosity at interior faces
+ *   xcpp       <-- cell specific heat if convection is multiplied by Cp,
+ *                  or NULL
+ *   da         <-- diagonal values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_matrix_free(cs_matrix_t      *matrix,
+                                       int               iconvp,
+                                       int               idiffp,
+                                       double            thetap,
+                                       const cs_real_t  *i_massflux,
+                                       const cs_real_t  *i_visc,
+                                       const cs_real_t  *xcpp,
+                                       const cs_real_t  *da);
+
+/*----------------------------------------------------------------------------
+ * Set MSR scalar matrix coefficients so that the matrix.vector product is
+ * computed by a given operator function (matrix-free operator).
+ *
+ * Only the diagonal is stored (and shared with the caller), so that
+ * diagonal-based preconditioners may be used, but solvers requiring
+ * assembled extra-diagonal coefficients (such as multigrid or
+ * Gauss-Seidel) are excluded. The operator input must remain available
+ * until coefficients are released.
+ *
+ * parameters:
+ *   matrix    <-> pointer to matrix structure
+ *   symmetric <-- indicates if the operator is symmetric
+ *   da        <-- diagonal values
+ *   op_func   <-- function computing y = A.x
+ *   op_input  <-- pointer to the input structure of op_func
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_operator(cs_matrix_t           *matrix,
+                                    bool                   symmetric,
+                                    const cs_real_t       *da,
+                                    cs_matrix_operator_t  *op_func,
+                                    void                  *op_input);
+
 /*----------------------------------------------------------------------------
  * Set matrix coefficients, copying values to private arrays.
  *
@@ -985,6 +1055,30 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
                                  cs_real_t          *x,
                                  cs_real_t          *y);
 
+/*----------------------------------------------------------------------------
+ * Matrix.block product Y = A.X for a set of interleaved vectors.
+ *
+ * Vector values are interleaved, so value i of vector k is found at
+ * position i*n_vecs + k; x must thus be sized for n_cols_ext*n_vecs values.
+ *
+ * This function includes a halo update of x prior to multiplication by A.
+ * For scalar CSR and MSR matrices, all vectors are multiplied in a single
+ * pass over matrix coefficients; for other matrices, it falls back to
+ * successive matrix.vector products.
+ *
+ * parameters:
+ *   matrix --> pointer to matrix structure
+ *   n_vecs --> number of interleaved vectors
+ *   x      <-> multipliying vectors values (ghost values updated)
+ *   y      <-- resulting vectors
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(const cs_matrix_t  *matrix,
+                                int                 n_vecs,
+                                cs_real_t          *x,
+                                cs_real_t          *y);
+
 /*----------------------------------------------------------------------------
  * Partial matrix.vector product.
  *
@@ -1132,6 +1226,8 @@ cs_matrix_variant_apply_tuned(cs_matrix_t          *m,
  *     default
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
+ *     sell            (SELL-C-sigma mapping, for CS_MATRIX_SCALAR*)
+ *     f32             (single-precision coefficients, for CS_MATRIX_SCALAR*)
  *
  * parameters:
  *   mv         <->  pointer to matrix variant
@@ -2221,8 +2221,6 @@ _matrix_assembler_values_add_ll_g(cs_matrix_assembler_values_t  *mav,
 
 }
 
-#if defined(HAVE_MPI)
-
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add coefficient values based on local row ids and column indexes,
@@ -2293,6 +2291,8 @@ _matrix_assembler_values_add_llx_g(cs_matrix_assembler_values_t  *mav,
 
 }
 
+#if defined(HAVE_MPI)
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add coefficient values based on local row ids and global column ids,
@@ -2931,6 +2931,49 @@ cs_matrix_assembler_get_col_ids(const cs_matrix_assembler_t  *ma)
   return ma->c_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute matrix assembler column indexes for given entries.
+ *
+ * The returned indexes are relative to the start of each row in the
+ * column ids array (see \ref cs_matrix_assembler_get_col_ids), with
+ * -1 used for diagonal entries when the diagonal is stored separately.
+ * They may be computed once and reused with
+ * \ref cs_matrix_assembler_values_add_idx, so that later assembly steps
+ * with an unchanged sparsity pattern do not require any search.
+ *
+ * \param[in]   ma       pointer to matrix assembler structure
+ * \param[in]   n        number of entries
+ * \param[in]   row_id   local row ids associated with entries
+ * \param[in]   col_id   local column ids associated with entries
+ * \param[out]  col_idx  column indexes associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_get_col_idx(const cs_matrix_assembler_t  *ma,
+                                cs_lnum_t                     n,
+                                const cs_lnum_t               row_id[],
+                                const cs_lnum_t               col_id[],
+                                cs_lnum_t                     col_idx[])
+{
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    cs_lnum_t l_r_id = row_id[k];
+    cs_lnum_t l_c_id = col_id[k];
+
+    cs_lnum_t n_cols = ma->r_idx[l_r_id+1] - ma->r_idx[l_r_id];
+
+    col_idx[k] = _l_id_binary_search(n_cols,
+                                     l_c_id,
+                                     ma->c_id + ma->r_idx[l_r_id]);
+
+    assert(col_idx[k] > -1 || (ma->separate_diag && l_c_id == l_r_id));
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return info on the number of neighbor ranks a matrix assembler
@@ -3248,6 +3291,85 @@ cs_matrix_assembler_values_add(cs_matrix_assembler_values_t  *mav,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using local
+ *        row ids and precomputed column indexes.
+ *
+ * Column indexes are those returned by \ref cs_matrix_assembler_get_col_idx.
+ * This is equivalent to \ref cs_matrix_assembler_values_add, but avoids
+ * searching for column positions, so it is well suited to repeated
+ * assembly of matrices with a fixed sparsity pattern.
+ *
+ * The same rules as for \ref cs_matrix_assembler_values_add apply
+ * regarding block sizes and calls from different threads.
+ *
+ * \param[in, out]  mav      pointer to matrix assembler values structure
+ * \param[in]       n        number of entries
+ * \param[in]       row_id   local row ids associated with entries
+ * \param[in]       col_idx  column indexes associated with entries
+ * \param[in]       val      values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_idx(cs_matrix_assembler_values_t  *mav,
+                                   cs_lnum_t                      n,
+                                   const cs_lnum_t                row_id[],
+                                   const cs_lnum_t                col_idx[],
+                                   const cs_real_t                val[])
+{
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  if (n < 1)
+    return;
+
+  /* Base stride on first type of value encountered */
+
+  cs_lnum_t stride = 0;
+
+  cs_lnum_t l_c_id0 = row_id[0];
+  if (col_idx[0] > -1)
+    l_c_id0 = ma->c_id[ma->r_idx[row_id[0]] + col_idx[0]];
+
+  if (row_id[0] == l_c_id0)
+    stride = mav->db_size * mav->db_size;
+  else
+    stride = mav->eb_size * mav->eb_size;
+
+  if (mav->add_values != NULL) {
+
+    if (ma->separate_diag == mav->separate_diag)
+      mav->add_values(mav->matrix,
+                      n,
+                      stride,
+                      row_id,
+                      col_idx,
+                      val);
+
+    else
+      _matrix_assembler_values_add_cnv_idx(mav,
+                                           n,
+                                           stride,
+                                           row_id,
+                                           col_idx,
+                                           val);
+
+  }
+
+  else { /* use a global id-based function */
+
+    assert(mav->add_values_g != NULL);
+
+    _matrix_assembler_values_add_llx_g(mav,
+                                       n,
+                                       stride,
+                                       row_id,
+                                       col_idx,
+                                       val);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add values to a matrix assembler values structure using global
@@ -482,6 +482,32 @@ cs_matrix_assembler_get_row_index(const cs_matrix_assembler_t  *ma);
 const cs_lnum_t *
 cs_matrix_assembler_get_col_ids(const cs_matrix_assembler_t  *ma);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute matrix assembler column indexes for given entries.
+ *
+ * The returned indexes are relative to the start of each row in the
+ * column ids array (see \ref cs_matrix_assembler_get_col_ids), with
+ * -1 used for diagonal entries when the diagonal is stored separately.
+ * They may be computed once and reused with
+ * \ref cs_matrix_assembler_values_add_idx, so that later assembly steps
+ * with an unchanged sparsity pattern do not require any search.
+ *
+ * \param[in]   ma       pointer to matrix assembler structure
+ * \param[in]   n        number of entries
+ * \param[in]   row_id   local row ids associated with entries
+ * \param[in]   col_id   local column ids associated with entries
+ * \param[out]  col_idx  column indexes associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_get_col_idx(const cs_matrix_assembler_t  *ma,
+                                cs_lnum_t                     n,
+                                const cs_lnum_t               row_id[],
+                                const cs_lnum_t               col_id[],
+                                cs_lnum_t                     col_idx[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return info on the number of neighbor ranks a matrix assembler
@@ -615,6 +641,34 @@ cs_matrix_assembler_values_add(cs_matrix_assembler_values_t  *mav,
                                const cs_lnum_t                col_id[],
                                const cs_real_t                val[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using local
+ *        row ids and precomputed column indexes.
+ *
+ * Column indexes are those returned by \ref cs_matrix_assembler_get_col_idx.
+ * This is equivalent to \ref cs_matrix_assembler_values_add, but avoids
+ * searching for column positions, so it is well suited to repeated
+ * assembly of matrices with a fixed sparsity pattern.
+ *
+ * The same rules as for \ref cs_matrix_assembler_values_add apply
+ * regarding block sizes and calls from different threads.
+ *
+ * \param[in, out]  mav      pointer to matrix assembler values structure
+ * \param[in]       n        number of entries
+ * \param[in]       row_id   local row ids associated with entries
+ * \param[in]       col_idx  column indexes associated with entries
+ * \param[in]       val      values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_idx(cs_matrix_assembler_values_t  *mav,
+                                   cs_lnum_t                      n,
+                                   const cs_lnum_t                row_id[],
+                                   const cs_lnum_t                col_idx[],
+                                   const cs_real_t                val[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add values to a matrix assembler values structure using global
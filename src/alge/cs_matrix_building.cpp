@@ -125,7 +125,7 @@
  * \param[in]     b_visc        \f$ S_\fib \f$
  *                               at border faces for the matrix
  * \param[out]    da            diagonal part of the matrix
- * \param[out]    xa            extra diagonal part of the matrix
+ * \param[out]    xa            extra diagonal part of the matrix, or NULL
  */
 /*----------------------------------------------------------------------------*/
 
@@ -168,18 +168,20 @@ _sym_matrix_scalar(const cs_mesh_t            *m,
       cs_lnum_t ii = i_face_cells[f_id][0];
       cs_lnum_t jj = i_face_cells[f_id][1];
 
-      xa[f_id] = -thetap*i_visc[f_id];
+      cs_real_t _xa = -thetap*i_visc[f_id];
+      if (xa != nullptr)
+        xa[f_id] = _xa;
 
       if (ii < n_cells)
-        cs_dispatch_sum(&da[ii], -xa[f_id], i_sum_type);
+        cs_dispatch_sum(&da[ii], -_xa, i_sum_type);
       if (jj < n_cells)
-        cs_dispatch_sum(&da[jj], -xa[f_id], i_sum_type);
+        cs_dispatch_sum(&da[jj], -_xa, i_sum_type);
 
     });
 
   }
 
-  else {
+  else if (xa != nullptr) {
 
     ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
       xa[f_id] = 0.;
@@ -245,7 +247,8 @@ _sym_matrix_scalar(const cs_mesh_t            *m,
  *                               at border faces for the matrix
  * \param[in]     xcpp          array of specific heat (Cp)
  * \param[out]    da            diagonal part of the matrix
- * \param[out]    xa            extra interleaved diagonal part of the matrix
+ * \param[out]    xa            extra interleaved diagonal part of the matrix,
+ *                               or NULL
  */
 /*----------------------------------------------------------------------------*/
 
@@ -304,8 +307,13 @@ _matrix_scalar(const cs_mesh_t            *m,
 
     /* Computation of extradiagonal terms */
 
-    xa[f_id][0] = thetap*(iconvp*cpi*flui -idiffp*i_visc[f_id]);
-    xa[f_id][1] = thetap*(iconvp*cpj*fluj -idiffp*i_visc[f_id]);
+    cs_real_t xa_ij = thetap*(iconvp*cpi*flui -idiffp*i_visc[f_id]);
+    cs_real_t xa_ji = thetap*(iconvp*cpj*fluj -idiffp*i_visc[f_id]);
+
+    if (xa != nullptr) {
+      xa[f_id][0] = xa_ij;
+      xa[f_id][1] = xa_ji;
+    }
 
     /* D_ii =  theta (m_ij)^+ - m_ij
      *      = -X_ij - (1-theta)*m_ij
@@ -313,8 +321,8 @@ _matrix_scalar(const cs_mesh_t            *m,
      *      = -X_ji + (1-theta)*m_ij
      */
 
-    cs_real_t ifac = xa[f_id][0] + iconvp * (1.-thetap) * cpi * _i_massflux;
-    cs_real_t jfac = xa[f_id][1] - iconvp * (1.-thetap) * cpj * _i_massflux;
+    cs_real_t ifac = xa_ij + iconvp * (1.-thetap) * cpi * _i_massflux;
+    cs_real_t jfac = xa_ji - iconvp * (1.-thetap) * cpj * _i_massflux;
 
     if (ii < n_cells)
       cs_dispatch_sum(&da[ii], -ifac, i_sum_type);
@@ -1165,6 +1173,9 @@ BEGIN_C_DECLS
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar (or its counterpart for
  * symmetric matrices)
+ *
+ * xa may be NULL, in which case only the diagonal is built (for use
+ * with matrix-free extra-diagonal terms).
  *----------------------------------------------------------------------------*/
 
 void
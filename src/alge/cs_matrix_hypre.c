@@ -607,6 +607,33 @@ _setup_coeffs(cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Prepare a previously assembled HYPRE matrix for new coefficients.
+ *
+ * The HYPRE IJ matrix and its sparsity pattern are kept, values are reset
+ * to zero, and the transfer buffers are reallocated if needed.
+ *
+ * parameters:
+ *   coeffs <-> HYPRE Matrix coefficients handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_reuse_structure(cs_matrix_coeffs_hypre_t  *coeffs)
+{
+  assert(coeffs->matrix_state > 0);
+
+  cs_alloc_mode_t  amode = CS_ALLOC_HOST;
+  if (coeffs->memory_location != HYPRE_MEMORY_HOST)
+    amode = CS_ALLOC_HOST_DEVICE_SHARED;
+
+  if (coeffs->row_buf == NULL)
+    CS_MALLOC_HD(coeffs->row_buf, coeffs->max_chunk_size, HYPRE_BigInt, amode);
+  if (coeffs->col_buf == NULL)
+    CS_MALLOC_HD(coeffs->col_buf, coeffs->max_chunk_size, HYPRE_BigInt, amode);
+
+  HYPRE_IJMatrixSetConstantValues(coeffs->hm, 0.);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Function for initialization of HYPRE matrix coefficients using
@@ -719,6 +746,8 @@ _assembler_values_init(void        *matrix_p,
 
     HYPRE_IJMatrixInitialize_v2(hm, coeffs->memory_location);
   }
+  else
+    _reuse_structure(coeffs);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1051,10 +1080,10 @@ _assembler_values_end(void  *matrix_p)
 
   HYPRE_IJMatrixAssemble(hm);
 
-  if (coeffs->matrix_state == 0) {
+  CS_FREE_HD(coeffs->row_buf);
+  CS_FREE_HD(coeffs->col_buf);
 
-    CS_FREE_HD(coeffs->row_buf);
-    CS_FREE_HD(coeffs->col_buf);
+  if (coeffs->matrix_state == 0) {
 
     MPI_Comm comm = cs_glob_mpi_comm;
     if (comm == MPI_COMM_NULL)
@@ -1613,6 +1642,8 @@ _set_coeffs_ij(cs_matrix_t        *matrix,
 
     HYPRE_IJMatrixInitialize_v2(hm, coeffs->memory_location);
   }
+  else
+    _reuse_structure(coeffs);
 
   HYPRE_Int max_chunk_size = coeffs->max_chunk_size / 2;
 
@@ -1779,6 +1810,29 @@ _release_coeffs_ij(cs_matrix_t  *matrix)
 {
   cs_matrix_coeffs_hypre_t  *coeffs = matrix->coeffs;
 
+  /* Keep HYPRE matrix and vectors, so that the sparsity pattern
+     and associated communication structures are reused when new
+     coefficients are set (the matrix structure does not change
+     during the lifetime of the matrix). */
+
+  if (matrix->coeffs != NULL) {
+    if (coeffs->matrix_state == 1)
+      coeffs->matrix_state = 2;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free HYPRE ParCSR matrix and associated vectors.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_hypre_ij(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeffs_hypre_t  *coeffs = matrix->coeffs;
+
   if (matrix->coeffs != NULL) {
 
     if (coeffs->matrix_state > 0) {
@@ -1816,7 +1870,7 @@ static void
 _destroy_coeffs_ij(cs_matrix_t  *matrix)
 {
   if (matrix->coeffs != NULL) {
-    _release_coeffs_ij(matrix);
+    _free_hypre_ij(matrix);
     BFT_FREE(matrix->coeffs);
   }
 }
@@ -75,7 +75,10 @@ typedef struct _cs_matrix_coeffs_hypre_t {
 
   int  matrix_state;                       /* Matrix state:
                                               0: not created
-                                              1: created and assembled */
+                                              1: created and assembled
+                                              2: created, coefficients
+                                                 released (structure kept
+                                                 for reuse) */
 
   HYPRE_Int max_chunk_size;                /* Chunk size */
   HYPRE_BigInt  *row_buf;                  /* row ids buffer */
@@ -259,6 +259,114 @@ typedef struct _cs_matrix_coeff_dist_t {
 
 } cs_matrix_coeff_dist_t;
 
+/* SELL-C-sigma (sliced ELLPACK) representation */
+/*----------------------------------------------*/
+
+/* This representation is built as an auxiliary mapping of the extra-diagonal
+   part of a scalar MSR matrix (using the ext_lib_map member of the matrix
+   structure), so that matrices remain usable as MSR by all other operators
+   (multigrid coarsening, smoothers, ...).
+
+   Rows are sorted by decreasing length inside windows of sigma rows, then
+   grouped in chunks of chunk_size consecutive (sorted) rows. Each chunk is
+   padded to its longest row and stored column-major, so that the SpMV
+   inner loop runs over chunk_size independent rows with unit stride
+   (SIMD lanes or CUDA warp threads). Padding uses zero coefficients
+   referencing the row itself. */
+
+typedef struct _cs_matrix_sell_map_t {
+
+  cs_lnum_t         n_rows;          /* Local number of rows */
+  cs_lnum_t         chunk_size;      /* Number of rows per chunk (C) */
+  cs_lnum_t         sigma;           /* Row sorting window size */
+  cs_lnum_t         n_chunks;        /* Number of chunks */
+
+  cs_lnum_t        *chunk_index;     /* Start of each chunk in col_id and
+                                        val arrays (size: n_chunks + 1) */
+  cs_lnum_t        *row_id;          /* Original row id of each chunk slot,
+                                        or -1 for padding rows
+                                        (size: n_chunks*chunk_size) */
+  cs_lnum_t        *col_id;          /* Padded column ids */
+  cs_real_t        *val;             /* Padded coefficient values */
+
+  const cs_real_t  *e_val_src;       /* Mapped MSR extra-diagonal values,
+                                        used to check for updates */
+
+} cs_matrix_sell_map_t;
+
+/* Single-precision copy of MSR coefficients */
+/*-------------------------------------------*/
+
+/* This auxiliary mapping (using the ext_lib_map member of the matrix
+   structure) holds a float copy of the coefficients of a scalar MSR
+   matrix, so that SpMV operations read half as many bytes per coefficient.
+   Products are still accumulated in double precision, and the reference
+   (double) coefficients remain available to other operators. */
+
+typedef struct _cs_matrix_msr_f32_map_t {
+
+  cs_lnum_t         n_rows;          /* Local number of rows */
+  cs_lnum_t         n_e_vals;        /* Number of extra-diagonal values */
+
+  float            *d_val;           /* Diagonal values */
+  float            *e_val;           /* Extra-diagonal values */
+
+  const cs_real_t  *d_val_src;       /* Mapped MSR diagonal values,
+                                        used to check for updates */
+  const cs_real_t  *e_val_src;       /* Mapped MSR extra-diagonal values,
+                                        used to check for updates */
+
+} cs_matrix_msr_f32_map_t;
+
+/* Matrix-free face-based scalar operator */
+/*----------------------------------------*/
+
+/* This auxiliary definition (using the ext_lib_map member of the matrix
+   structure) allows native scalar matrices to compute extra-diagonal
+   contributions directly from interior face mass flux and viscosity
+   arrays (using the same upwind convection and non-reconstructed diffusion
+   terms as cs_matrix_building), so that extra-diagonal coefficients need
+   not be assembled or stored. The SpMV functions replaced by the
+   matrix-free ones are restored when the definition is removed. */
+
+typedef struct _cs_matrix_native_mf_t {
+
+  int               iconvp;          /* 1 if convection is active */
+  int               idiffp;          /* 1 if diffusion is active */
+  double            thetap;          /* theta-scheme coefficient */
+
+  const cs_real_t  *i_massflux;      /* Mass flux at interior faces */
+  const cs_real_t  *i_visc;          /* Face viscosity at interior faces */
+  const cs_real_t  *xcpp;            /* Cell specific heat if convection
+                                        is multiplied by Cp, or NULL */
+
+  /* Saved SpMV functions for the associated fill type */
+
+  cs_matrix_fill_type_t        fill_type;
+  cs_matrix_vector_product_t  *vector_multiply[CS_MATRIX_SPMV_N_TYPES];
+
+} cs_matrix_native_mf_t;
+
+/* Matrix-free operator given by a function */
+/*------------------------------------------*/
+
+/* This auxiliary definition (using the ext_lib_map member of the matrix
+   structure) allows scalar MSR matrices to delegate the matrix.vector
+   product to a function (for instance, applying cellwise operators on the
+   fly), only diagonal coefficients being stored. */
+
+typedef struct _cs_matrix_operator_mf_t {
+
+  cs_matrix_operator_t        *func;   /* Operator function */
+  void                        *input;  /* Operator function input */
+
+  /* Saved SpMV functions for the associated fill type */
+
+  cs_matrix_fill_type_t        fill_type;
+  cs_matrix_vector_product_t  *vector_multiply[CS_MATRIX_SPMV_N_TYPES];
+
+} cs_matrix_operator_mf_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
@@ -299,6 +407,12 @@ struct _cs_matrix_t {
   cs_lnum_t              n_rows;       /* Local number of rows */
   cs_lnum_t              n_cols_ext;   /* Local number of columns + ghosts */
 
+  cs_lnum_t              n_no_adj_halo_elts;  /* Number of leading rows
+                                                 (or edges for native
+                                                 matrices) not referencing
+                                                 ghost columns, or -1 if
+                                                 not determined yet */
+
   cs_matrix_fill_type_t  fill_type;    /* Matrix fill type */
 
   bool                   symmetric;    /* true if coefficients are symmetric */
@@ -37,6 +37,8 @@
 #include <assert.h>
 #include <math.h>
 
+#include <algorithm>
+
 #if defined(HAVE_MPI)
 #include <mpi.h>
 #endif
@@ -102,6 +104,16 @@ BEGIN_C_DECLS
 
 static const cs_lnum_t _cs_cl = (CS_CL_SIZE/8);
 
+/* SELL-C-sigma chunk size for host SpMV (using 8 rows per chunk matches
+   the number of double precision lanes in 512-bit SIMD registers, and
+   2 registers for 256-bit SIMD) */
+
+static const cs_lnum_t _sell_chunk_size_host = 8;
+
+/* SELL-C-sigma row sorting window, as a multiple of the chunk size */
+
+static const cs_lnum_t _sell_sigma_mult = 32;
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -541,6 +553,251 @@ _set_mkl_sparse_sycl_map(cs_matrix_t   *matrix)
 
 #endif // defined(HAVE_MKL_SPARSE_IE)
 
+/*----------------------------------------------------------------------------
+ * Unset matrix SELL-C-sigma mapping.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unset_sell_map(cs_matrix_t   *matrix)
+{
+  cs_matrix_sell_map_t *sm
+    = (cs_matrix_sell_map_t *)matrix->ext_lib_map;
+
+  if (sm == nullptr)
+    return;
+
+  CS_FREE_HD(sm->chunk_index);
+  CS_FREE_HD(sm->row_id);
+  CS_FREE_HD(sm->col_id);
+  CS_FREE_HD(sm->val);
+
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Unset matrix single-precision coefficients mapping.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unset_msr_f32_map(cs_matrix_t   *matrix)
+{
+  cs_matrix_msr_f32_map_t *fm
+    = (cs_matrix_msr_f32_map_t *)matrix->ext_lib_map;
+
+  if (fm == nullptr)
+    return;
+
+  BFT_FREE(fm->d_val);
+  BFT_FREE(fm->e_val);
+
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Unset matrix-free native operator definition, restoring previous
+ * SpMV functions.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unset_native_mf(cs_matrix_t   *matrix)
+{
+  cs_matrix_native_mf_t *mf
+    = (cs_matrix_native_mf_t *)matrix->ext_lib_map;
+
+  if (mf == nullptr)
+    return;
+
+  for (int i = 0; i < CS_MATRIX_SPMV_N_TYPES; i++)
+    matrix->vector_multiply[mf->fill_type][i] = mf->vector_multiply[i];
+
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Unset matrix-free operator function definition, restoring previous
+ * SpMV functions.
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unset_operator_mf(cs_matrix_t   *matrix)
+{
+  cs_matrix_operator_mf_t *mf
+    = (cs_matrix_operator_mf_t *)matrix->ext_lib_map;
+
+  if (mf == nullptr)
+    return;
+
+  for (int i = 0; i < CS_MATRIX_SPMV_N_TYPES; i++)
+    matrix->vector_multiply[mf->fill_type][i] = mf->vector_multiply[i];
+
+  BFT_FREE(matrix->ext_lib_map);
+  matrix->destroy_adaptor = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Build SELL-C-sigma structure (row permutation, chunk index, and padded
+ * column ids) from an MSR matrix structure.
+ *
+ * parameters:
+ *   ms         <-- pointer to MSR matrix structure
+ *   alloc_mode <-- allocation mode
+ *   sm         <-> pointer to SELL-C-sigma mapping
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_map_build_structure(const cs_matrix_struct_dist_t  *ms,
+                          cs_alloc_mode_t                 alloc_mode,
+                          cs_matrix_sell_map_t           *sm)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t c_size = sm->chunk_size;
+  const cs_lnum_t sigma = sm->sigma;
+  const cs_lnum_t *restrict row_index = ms->e.row_index;
+  const cs_lnum_t *restrict e_col_id = ms->e.col_id;
+
+  sm->n_rows = n_rows;
+  sm->n_chunks = (n_rows + c_size - 1) / c_size;
+
+  const cs_lnum_t n_chunks = sm->n_chunks;
+  const cs_lnum_t n_slots = n_chunks*c_size;
+
+  CS_MALLOC_HD(sm->chunk_index, n_chunks + 1, cs_lnum_t, alloc_mode);
+  CS_MALLOC_HD(sm->row_id, n_slots, cs_lnum_t, alloc_mode);
+
+  cs_lnum_t *restrict row_id = sm->row_id;
+
+  /* Sort rows by decreasing length inside each sorting window;
+     as windows are multiples of the chunk size, chunks never
+     span multiple windows. */
+
+  const cs_lnum_t n_windows = (n_rows + sigma - 1) / sigma;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t w_id = 0; w_id < n_windows; w_id++) {
+    cs_lnum_t s_id = w_id*sigma;
+    cs_lnum_t e_id = std::min(s_id + sigma, n_rows);
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++)
+      row_id[ii] = ii;
+    std::stable_sort(row_id + s_id,
+                     row_id + e_id,
+                     [row_index](cs_lnum_t a, cs_lnum_t b) {
+                       return (  row_index[a+1] - row_index[a]
+                               > row_index[b+1] - row_index[b]);
+                     });
+  }
+
+  for (cs_lnum_t ii = n_rows; ii < n_slots; ii++)
+    row_id[ii] = -1;
+
+  /* Chunk widths and index */
+
+  sm->chunk_index[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    cs_lnum_t c_width = 0;
+    for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+      cs_lnum_t ii = row_id[c_id*c_size + l_id];
+      if (ii > -1)
+        c_width = std::max(c_width, row_index[ii+1] - row_index[ii]);
+    }
+    sm->chunk_index[c_id+1] = sm->chunk_index[c_id] + c_width*c_size;
+  }
+
+  /* Padded column ids (padding references the row itself, or the first
+     row for empty slots, so as to remain in cache) */
+
+  CS_MALLOC_HD(sm->col_id, sm->chunk_index[n_chunks], cs_lnum_t, alloc_mode);
+
+  cs_lnum_t *restrict col_id = sm->col_id;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t s_id = sm->chunk_index[c_id];
+    const cs_lnum_t c_width = (sm->chunk_index[c_id+1] - s_id) / c_size;
+    for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+      cs_lnum_t ii = row_id[c_id*c_size + l_id];
+      cs_lnum_t n_cols = 0, pad_id = 0;
+      if (ii > -1) {
+        n_cols = row_index[ii+1] - row_index[ii];
+        pad_id = ii;
+      }
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        col_id[s_id + jj*c_size + l_id] = e_col_id[row_index[ii] + jj];
+      for (cs_lnum_t jj = n_cols; jj < c_width; jj++)
+        col_id[s_id + jj*c_size + l_id] = pad_id;
+    }
+  }
+
+  CS_MALLOC_HD(sm->val, sm->chunk_index[n_chunks], cs_real_t, alloc_mode);
+
+  if (alloc_mode > CS_ALLOC_HOST) {
+    cs_sync_h2d(sm->chunk_index);
+    cs_sync_h2d(sm->row_id);
+    cs_sync_h2d(sm->col_id);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Pack MSR extra-diagonal coefficients into SELL-C-sigma mapping.
+ *
+ * parameters:
+ *   ms         <-- pointer to MSR matrix structure
+ *   alloc_mode <-- allocation mode
+ *   e_val      <-- MSR extra-diagonal values
+ *   sm         <-> pointer to SELL-C-sigma mapping
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_map_pack_values(const cs_matrix_struct_dist_t  *ms,
+                      cs_alloc_mode_t                 alloc_mode,
+                      const cs_real_t                *e_val,
+                      cs_matrix_sell_map_t           *sm)
+{
+  const cs_lnum_t c_size = sm->chunk_size;
+  const cs_lnum_t n_chunks = sm->n_chunks;
+  const cs_lnum_t *restrict row_index = ms->e.row_index;
+  const cs_lnum_t *restrict row_id = sm->row_id;
+
+  cs_real_t *restrict val = sm->val;
+
+# pragma omp parallel for  if(sm->n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t s_id = sm->chunk_index[c_id];
+    const cs_lnum_t c_width = (sm->chunk_index[c_id+1] - s_id) / c_size;
+    for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+      cs_lnum_t ii = row_id[c_id*c_size + l_id];
+      cs_lnum_t n_cols = 0;
+      if (ii > -1) {
+        n_cols = row_index[ii+1] - row_index[ii];
+        const cs_real_t *restrict m_row = e_val + row_index[ii];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          val[s_id + jj*c_size + l_id] = m_row[jj];
+      }
+      for (cs_lnum_t jj = n_cols; jj < c_width; jj++)
+        val[s_id + jj*c_size + l_id] = 0.;
+    }
+  }
+
+  sm->e_val_src = e_val;
+
+  if (alloc_mode > CS_ALLOC_HOST)
+    cs_sync_h2d(sm->val);
+}
+
 /*----------------------------------------------------------------------------
  * Compute matrix-vector product for one dense block: y[i] = a[i].x[i]
  *
@@ -911,6 +1168,140 @@ _6_6_zero_range(cs_real_t  *restrict y,
     y[ii] = 0.0;
 }
 
+/*----------------------------------------------------------------------------
+ * Add extra-diagonal contributions of a range of edges to a local
+ * matrix.vector product with native matrix.
+ *
+ * parameters:
+ *   symmetric <-- true if extra-diagonal terms are symmetric
+ *   s_id      <-- start id of edge range
+ *   e_id      <-- past-the-end id of edge range
+ *   edges     <-- edges (symmetric row <-> column) connectivity
+ *   xa        <-- extra-diagonal values
+ *   x         <-- multipliying vector values
+ *   y         <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_native_e_range(bool                          symmetric,
+                cs_lnum_t                     s_id,
+                cs_lnum_t                     e_id,
+                const cs_lnum_2_t  *restrict  edges,
+                const cs_real_t    *restrict  xa,
+                const cs_real_t    *restrict  x,
+                cs_real_t          *restrict  y)
+{
+  if (symmetric) {
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      y[ii] += xa[face_id] * x[jj];
+      y[jj] += xa[face_id] * x[ii];
+    }
+  }
+  else {
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      y[ii] += xa[2*face_id] * x[jj];
+      y[jj] += xa[2*face_id + 1] * x[ii];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add extra-diagonal contributions of a range of edges to a local
+ * matrix.vector product with native matrix, blocked version.
+ *
+ * parameters:
+ *   symmetric <-- true if extra-diagonal terms are symmetric
+ *   db_size   <-- diagonal block size
+ *   s_id      <-- start id of edge range
+ *   e_id      <-- past-the-end id of edge range
+ *   edges     <-- edges (symmetric row <-> column) connectivity
+ *   xa        <-- extra-diagonal values
+ *   x         <-- multipliying vector values
+ *   y         <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_b_native_e_range(bool                          symmetric,
+                  cs_lnum_t                     db_size,
+                  cs_lnum_t                     s_id,
+                  cs_lnum_t                     e_id,
+                  const cs_lnum_2_t  *restrict  edges,
+                  const cs_real_t    *restrict  xa,
+                  const cs_real_t    *restrict  x,
+                  cs_real_t          *restrict  y)
+{
+  if (symmetric) {
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+        y[ii*db_size + kk] += xa[face_id] * x[jj*db_size + kk];
+        y[jj*db_size + kk] += xa[face_id] * x[ii*db_size + kk];
+      }
+    }
+  }
+  else {
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+        y[ii*db_size + kk] += xa[2*face_id]     * x[jj*db_size + kk];
+        y[jj*db_size + kk] += xa[2*face_id + 1] * x[ii*db_size + kk];
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add extra-diagonal contributions of a range of edges to a local
+ * matrix.vector product with native matrix, with full extra-diagonal
+ * blocks.
+ *
+ * parameters:
+ *   symmetric <-- true if extra-diagonal terms are symmetric
+ *   eb_size   <-- extra-diagonal block size
+ *   s_id      <-- start id of edge range
+ *   e_id      <-- past-the-end id of edge range
+ *   edges     <-- edges (symmetric row <-> column) connectivity
+ *   xa        <-- extra-diagonal values
+ *   x         <-- multipliying vector values
+ *   y         <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_bb_native_e_range(bool                          symmetric,
+                   cs_lnum_t                     eb_size,
+                   cs_lnum_t                     s_id,
+                   cs_lnum_t                     e_id,
+                   const cs_lnum_2_t  *restrict  edges,
+                   const cs_real_t    *restrict  xa,
+                   const cs_real_t    *restrict  x,
+                   cs_real_t          *restrict  y)
+{
+  const cs_lnum_t  eb_size_2 = eb_size*eb_size;
+
+  if (symmetric) {
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      _dense_eb_ax_add(ii, jj, face_id, eb_size, eb_size_2, xa, x, y);
+      _dense_eb_ax_add(jj, ii, face_id, eb_size, eb_size_2, xa, x, y);
+    }
+  }
+  else {
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = edges[face_id][0];
+      cs_lnum_t jj = edges[face_id][1];
+      _dense_eb_ax_add(ii, jj, 2*face_id, eb_size, eb_size_2, xa, x, y);
+      _dense_eb_ax_add(jj, ii, 2*face_id + 1, eb_size, eb_size_2, xa, x, y);
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Start synchronization of ghost values prior to matrix.vector product
  *
@@ -988,6 +1379,53 @@ _pre_vector_multiply_sync_x_end(const cs_matrix_t   *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with scalar MSR matrix, the product being
+ * delegated to an operator function (matrix-free).
+ *
+ * The operator function handles parallel exchanges itself, so the sync
+ * argument is ignored.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_operator_mf(cs_matrix_t  *matrix,
+                         bool          exclude_diag,
+                         bool          sync,
+                         cs_real_t    *restrict x,
+                         cs_real_t    *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+  const cs_matrix_operator_mf_t  *mf
+    = (const cs_matrix_operator_mf_t *)matrix->ext_lib_map;
+
+  CS_UNUSED(sync);
+
+  assert(matrix->destroy_adaptor == _unset_operator_mf);
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  mf->func(mf->input, x, y);
+
+  if (exclude_diag && mc->d_val != nullptr) {
+    const cs_real_t *restrict da = mc->d_val;
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      y[ii] -= da[ii]*x[ii];
+  }
+
+  _zero_range(y, n_rows, ms->n_cols_ext);
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with native matrix.
  *
@@ -1006,8 +1444,6 @@ _mat_vec_p_l_native(cs_matrix_t  *matrix,
                     cs_real_t    *restrict x,
                     cs_real_t    *restrict y)
 {
-  cs_lnum_t  ii, jj, face_id;
-
   const cs_matrix_struct_native_t  *ms
     = (const cs_matrix_struct_native_t *)matrix->structure;
   const cs_matrix_coeff_dist_t  *mc
@@ -1029,43 +1465,96 @@ _mat_vec_p_l_native(cs_matrix_t  *matrix,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
+  /* Extra-diagonal terms not referencing ghost values are computed
+     while ghost values are exchanged */
+
+  const cs_lnum_t n_l_edges
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
+
+  if (mc->e_val != NULL)
+    _native_e_range(mc->symmetric, 0, n_l_edges,
+                    ms->edges, xa, x, y);
+
   /* Finalize ghost cell comunication if overlap used */
 
   if (hs != NULL)
     cs_halo_sync_wait(matrix->halo, x, hs);
 
-  /* non-diagonal terms */
+  /* Remaining extra-diagonal terms */
 
-  if (mc->e_val != NULL) {
+  if (mc->e_val != NULL)
+    _native_e_range(mc->symmetric, n_l_edges, ms->n_edges,
+                    ms->edges, xa, x, y);
+}
 
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+/*----------------------------------------------------------------------------
+ * Add extra-diagonal contributions of a range of faces to a local
+ * matrix.vector product, computing coefficients from face values.
+ *
+ * parameters:
+ *   mf        <-- pointer to matrix-free operator definition
+ *   face_cel  <-- face -> cells connectivity
+ *   s_id      <-- start id of face range
+ *   e_id      <-- past-the-end id of face range
+ *   x         <-- multipliying vector values
+ *   y         <-> resulting vector
+ *----------------------------------------------------------------------------*/
 
-    if (mc->symmetric) {
+static inline void
+_native_mf_face_range(const cs_matrix_native_mf_t  *mf,
+                      const cs_lnum_2_t            *restrict face_cel,
+                      cs_lnum_t                     s_id,
+                      cs_lnum_t                     e_id,
+                      const cs_real_t              *restrict x,
+                      cs_real_t                    *restrict y)
+{
+  const cs_real_t  t_diff = mf->thetap * mf->idiffp;
+  const cs_real_t  *restrict i_visc = mf->i_visc;
+
+  /* Diffusion only (symmetric) */
+
+  if (mf->iconvp == 0) {
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = face_cel[face_id][0];
+      cs_lnum_t jj = face_cel[face_id][1];
+      cs_real_t xa = -t_diff*i_visc[face_id];
+      y[ii] += xa * x[jj];
+      y[jj] += xa * x[ii];
+    }
+    return;
+  }
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        y[ii] += xa[face_id] * x[jj];
-        y[jj] += xa[face_id] * x[ii];
-      }
+  /* Upwind convection and diffusion */
 
-    }
-    else {
+  const cs_real_t  t_conv = mf->thetap * mf->iconvp;
+  const cs_real_t  *restrict i_massflux = mf->i_massflux;
+  const cs_real_t  *restrict xcpp = mf->xcpp;
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        y[ii] += xa[2*face_id] * x[jj];
-        y[jj] += xa[2*face_id + 1] * x[ii];
-      }
+  for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+    cs_lnum_t ii = face_cel[face_id][0];
+    cs_lnum_t jj = face_cel[face_id][1];
 
+    cs_real_t _i_massflux = i_massflux[face_id];
+    cs_real_t flui =  0.5*(_i_massflux - fabs(_i_massflux));
+    cs_real_t fluj = -0.5*(_i_massflux + fabs(_i_massflux));
+
+    cs_real_t cpi = 1.0, cpj = 1.0;
+    if (xcpp != NULL) {
+      cpi = xcpp[ii];
+      cpj = xcpp[jj];
     }
 
+    cs_real_t xa_ij = t_conv*cpi*flui - t_diff*i_visc[face_id];
+    cs_real_t xa_ji = t_conv*cpj*fluj - t_diff*i_visc[face_id];
+
+    y[ii] += xa_ij * x[jj];
+    y[jj] += xa_ji * x[ii];
   }
 }
 
 /*----------------------------------------------------------------------------
- * Matrix.vector product y = A.x with native matrix.
+ * Matrix.vector product y = A.x with native scalar matrix, computing
+ * extra-diagonal terms from face values (matrix-free).
  *
  * parameters:
  *   matrix       <-- pointer to matrix structure
@@ -1076,21 +1565,20 @@ _mat_vec_p_l_native(cs_matrix_t  *matrix,
  *----------------------------------------------------------------------------*/
 
 static void
-_b_mat_vec_p_l_native(cs_matrix_t  *matrix,
-                      bool          exclude_diag,
-                      bool          sync,
-                      cs_real_t    *restrict x,
-                      cs_real_t    *restrict y)
+_mat_vec_p_l_native_mf(cs_matrix_t  *matrix,
+                       bool          exclude_diag,
+                       bool          sync,
+                       cs_real_t    *restrict x,
+                       cs_real_t    *restrict y)
 {
-  cs_lnum_t  ii, jj, kk, face_id;
-
   const cs_matrix_struct_native_t  *ms
     = (const cs_matrix_struct_native_t *)matrix->structure;
   const cs_matrix_coeff_dist_t  *mc
     = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+  const cs_matrix_native_mf_t  *mf
+    = (const cs_matrix_native_mf_t *)matrix->ext_lib_map;
 
-  const cs_real_t  *restrict xa = mc->e_val;
-  const cs_lnum_t db_size = matrix->db_size;
+  assert(matrix->destroy_adaptor == _unset_native_mf);
 
   /* Initialize ghost cell communication */
 
@@ -1099,50 +1587,66 @@ _b_mat_vec_p_l_native(cs_matrix_t  *matrix,
 
   /* Diagonal part of matrix.vector product */
 
-  if (! exclude_diag) {
-    _b_diag_vec_p_l(mc->d_val, x, y, ms->n_rows, db_size);
-    _b_zero_range(y, ms->n_rows, ms->n_cols_ext, db_size);
+  if (! exclude_diag && mc->d_val != NULL) {
+    _diag_vec_p_l(mc->d_val, x, y, ms->n_rows);
+    _zero_range(y, ms->n_rows, ms->n_cols_ext);
   }
   else
-    _b_zero_range(y, 0, ms->n_cols_ext, db_size);
+    _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
+  /* non-diagonal terms; those not referencing ghost values are
+     computed while ghost values are exchanged */
 
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  const cs_numbering_t *numbering = matrix->numbering;
 
-  /* non-diagonal terms */
+  if (numbering != NULL && numbering->type == CS_NUMBERING_THREADS) {
 
-  if (mc->e_val != NULL) {
+    const int n_threads = numbering->n_threads;
+    const int n_groups = numbering->n_groups;
+    const int n_l_groups
+      = (hs != NULL) ? numbering->n_no_adj_halo_groups : n_groups;
+    const cs_lnum_t *group_index = numbering->group_index;
 
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+    for (int g_id = 0; g_id < n_groups; g_id++) {
 
-    if (mc->symmetric) {
+      /* Finalize ghost cell comunication if overlap used */
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < db_size; kk++) {
-          y[ii*db_size + kk] += xa[face_id] * x[jj*db_size + kk];
-          y[jj*db_size + kk] += xa[face_id] * x[ii*db_size + kk];
-        }
+      if (g_id == n_l_groups && hs != NULL) {
+        cs_halo_sync_wait(matrix->halo, x, hs);
+        hs = NULL;
       }
-    }
-    else {
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < db_size; kk++) {
-          y[ii*db_size + kk] += xa[2*face_id]     * x[jj*db_size + kk];
-          y[jj*db_size + kk] += xa[2*face_id + 1] * x[ii*db_size + kk];
-        }
-      }
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++)
+        _native_mf_face_range(mf,
+                              face_cel_p,
+                              group_index[(t_id*n_groups + g_id)*2],
+                              group_index[(t_id*n_groups + g_id)*2 + 1],
+                              x,
+                              y);
 
     }
 
+    if (hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
+
   }
+  else {
+
+    const cs_lnum_t n_l_edges
+      = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
 
+    _native_mf_face_range(mf, face_cel_p, 0, n_l_edges, x, y);
+
+    /* Finalize ghost cell comunication if overlap used */
+
+    if (hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
+
+    _native_mf_face_range(mf, face_cel_p, n_l_edges, ms->n_edges, x, y);
+
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1157,23 +1661,19 @@ _b_mat_vec_p_l_native(cs_matrix_t  *matrix,
  *----------------------------------------------------------------------------*/
 
 static void
-_bb_mat_vec_p_l_native(cs_matrix_t  *matrix,
-                       bool          exclude_diag,
-                       bool          sync,
-                       cs_real_t    *restrict x,
-                       cs_real_t    *restrict y)
+_b_mat_vec_p_l_native(cs_matrix_t  *matrix,
+                      bool          exclude_diag,
+                      bool          sync,
+                      cs_real_t    *restrict x,
+                      cs_real_t    *restrict y)
 {
-  cs_lnum_t  ii, jj, face_id;
-
   const cs_matrix_struct_native_t  *ms
     = (const cs_matrix_struct_native_t *)matrix->structure;
   const cs_matrix_coeff_dist_t  *mc
     = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
 
   const cs_real_t  *restrict xa = mc->e_val;
-  const cs_lnum_t  db_size = matrix->db_size;
-  const cs_lnum_t  eb_size = matrix->eb_size;
-  const cs_lnum_t  eb_size_2 = eb_size*eb_size;
+  const cs_lnum_t db_size = matrix->db_size;
 
   /* Initialize ghost cell communication */
 
@@ -1189,39 +1689,89 @@ _bb_mat_vec_p_l_native(cs_matrix_t  *matrix,
   else
     _b_zero_range(y, 0, ms->n_cols_ext, db_size);
 
+  /* Extra-diagonal terms not referencing ghost values are computed
+     while ghost values are exchanged */
+
+  const cs_lnum_t n_l_edges
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
+
+  if (mc->e_val != NULL)
+    _b_native_e_range(mc->symmetric, db_size, 0, n_l_edges,
+                      ms->edges, xa, x, y);
+
   /* Finalize ghost cell comunication if overlap used */
 
   if (hs != NULL)
     _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  /* non-diagonal terms */
+  /* Remaining extra-diagonal terms */
 
-  if (mc->e_val != NULL) {
+  if (mc->e_val != NULL)
+    _b_native_e_range(mc->symmetric, db_size, n_l_edges, ms->n_edges,
+                      ms->edges, xa, x, y);
+}
 
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with native matrix.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
 
-    if (mc->symmetric) {
+static void
+_bb_mat_vec_p_l_native(cs_matrix_t  *matrix,
+                       bool          exclude_diag,
+                       bool          sync,
+                       cs_real_t    *restrict x,
+                       cs_real_t    *restrict y)
+{
+  const cs_matrix_struct_native_t  *ms
+    = (const cs_matrix_struct_native_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        _dense_eb_ax_add(ii, jj, face_id, eb_size, eb_size_2, xa, x, y);
-        _dense_eb_ax_add(jj, ii, face_id, eb_size, eb_size_2, xa, x, y);
-      }
-    }
-    else {
+  const cs_real_t  *restrict xa = mc->e_val;
+  const cs_lnum_t  db_size = matrix->db_size;
+  const cs_lnum_t  eb_size = matrix->eb_size;
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        _dense_eb_ax_add(ii, jj, 2*face_id, eb_size, eb_size_2, xa, x, y);
-        _dense_eb_ax_add(jj, ii, 2*face_id + 1, eb_size, eb_size_2, xa, x, y);
-      }
+  /* Initialize ghost cell communication */
 
-    }
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  /* Diagonal part of matrix.vector product */
 
+  if (! exclude_diag) {
+    _b_diag_vec_p_l(mc->d_val, x, y, ms->n_rows, db_size);
+    _b_zero_range(y, ms->n_rows, ms->n_cols_ext, db_size);
   }
+  else
+    _b_zero_range(y, 0, ms->n_cols_ext, db_size);
+
+  /* Extra-diagonal terms not referencing ghost values are computed
+     while ghost values are exchanged */
+
+  const cs_lnum_t n_l_edges
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
+
+  if (mc->e_val != NULL)
+    _bb_native_e_range(mc->symmetric, eb_size, 0, n_l_edges,
+                       ms->edges, xa, x, y);
+
+  /* Finalize ghost cell comunication if overlap used */
+
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
+  /* Remaining extra-diagonal terms */
+
+  if (mc->e_val != NULL)
+    _bb_native_e_range(mc->symmetric, eb_size, n_l_edges, ms->n_edges,
+                       ms->edges, xa, x, y);
 }
 
 /*----------------------------------------------------------------------------
@@ -1244,8 +1794,6 @@ _3_3_mat_vec_p_l_native(cs_matrix_t  *matrix,
                         cs_real_t    *restrict x,
                         cs_real_t    *restrict y)
 {
-  cs_lnum_t  ii, jj, kk, face_id;
-
   const cs_matrix_struct_native_t  *ms
     = (const cs_matrix_struct_native_t *)matrix->structure;
   const cs_matrix_coeff_dist_t  *mc
@@ -1269,43 +1817,26 @@ _3_3_mat_vec_p_l_native(cs_matrix_t  *matrix,
   else
     _3_3_zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication */
-
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
-
-  /* non-diagonal terms */
-
-  if (mc->e_val != NULL) {
-
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  /* Extra-diagonal terms not referencing ghost values are computed
+     while ghost values are exchanged */
 
-    if (mc->symmetric) {
+  const cs_lnum_t n_l_edges
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 3; kk++) {
-          y[ii*3 + kk] += xa[face_id] * x[jj*3 + kk];
-          y[jj*3 + kk] += xa[face_id] * x[ii*3 + kk];
-        }
-      }
-    }
-    else {
+  if (mc->e_val != NULL)
+    _b_native_e_range(mc->symmetric, 3, 0, n_l_edges,
+                      ms->edges, xa, x, y);
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 3; kk++) {
-          y[ii*3 + kk] += xa[2*face_id]     * x[jj*3 + kk];
-          y[jj*3 + kk] += xa[2*face_id + 1] * x[ii*3 + kk];
-        }
-      }
+  /* Finalize ghost cell comunication if overlap used */
 
-    }
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  }
+  /* Remaining extra-diagonal terms */
 
+  if (mc->e_val != NULL)
+    _b_native_e_range(mc->symmetric, 3, n_l_edges, ms->n_edges,
+                      ms->edges, xa, x, y);
 }
 
 /*----------------------------------------------------------------------------
@@ -1328,8 +1859,6 @@ _6_6_mat_vec_p_l_native(cs_matrix_t  *matrix,
                         cs_real_t   *restrict x,
                         cs_real_t   *restrict y)
 {
-  cs_lnum_t  ii, jj, kk, face_id;
-
   const cs_matrix_struct_native_t  *ms
     = (const cs_matrix_struct_native_t *)matrix->structure;
   const cs_matrix_coeff_dist_t  *mc
@@ -1353,43 +1882,26 @@ _6_6_mat_vec_p_l_native(cs_matrix_t  *matrix,
   else
     _6_6_zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
-
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
-
-  /* non-diagonal terms */
-
-  if (mc->e_val != NULL) {
-
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  /* Extra-diagonal terms not referencing ghost values are computed
+     while ghost values are exchanged */
 
-    if (mc->symmetric) {
+  const cs_lnum_t n_l_edges
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 6; kk++) {
-          y[ii*6 + kk] += xa[face_id] * x[jj*6 + kk];
-          y[jj*6 + kk] += xa[face_id] * x[ii*6 + kk];
-        }
-      }
-    }
-    else {
+  if (mc->e_val != NULL)
+    _b_native_e_range(mc->symmetric, 6, 0, n_l_edges,
+                      ms->edges, xa, x, y);
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        for (kk = 0; kk < 6; kk++) {
-          y[ii*6 + kk] += xa[2*face_id]     * x[jj*6 + kk];
-          y[jj*6 + kk] += xa[2*face_id + 1] * x[ii*6 + kk];
-        }
-      }
+  /* Finalize ghost cell comunication if overlap used */
 
-    }
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  }
+  /* Remaining extra-diagonal terms */
 
+  if (mc->e_val != NULL)
+    _b_native_e_range(mc->symmetric, 6, n_l_edges, ms->n_edges,
+                      ms->edges, xa, x, y);
 }
 
 /*----------------------------------------------------------------------------
@@ -1468,12 +1980,11 @@ _mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
-
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
+  /* non-diagonal terms; those not referencing ghost values are
+     computed while ghost values are exchanged */
 
-  /* non-diagonal terms */
+  const int n_l_groups
+    = (hs != NULL) ? matrix->numbering->n_no_adj_halo_groups : n_groups;
 
   if (mc->e_val != NULL) {
 
@@ -1483,6 +1994,11 @@ _mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
 
       for (int g_id = 0; g_id < n_groups; g_id++) {
 
+        if (g_id == n_l_groups && hs != NULL) {
+          cs_halo_sync_wait(matrix->halo, x, hs);
+          hs = NULL;
+        }
+
 #       pragma omp parallel for
         for (int t_id = 0; t_id < n_threads; t_id++) {
 
@@ -1501,6 +2017,11 @@ _mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
 
       for (int g_id = 0; g_id < n_groups; g_id++) {
 
+        if (g_id == n_l_groups && hs != NULL) {
+          cs_halo_sync_wait(matrix->halo, x, hs);
+          hs = NULL;
+        }
+
 #       pragma omp parallel for
         for (int t_id = 0; t_id < n_threads; t_id++) {
 
@@ -1517,6 +2038,11 @@ _mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
     }
 
   }
+
+  /* Finalize ghost cell comunication if not done above */
+
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
 }
 
 /*----------------------------------------------------------------------------
@@ -1565,12 +2091,11 @@ _b_mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
   else
     _b_zero_range(y, 0, ms->n_cols_ext, db_size);
 
-  /* Finalize ghost cell comunication if overlap used */
-
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+  /* non-diagonal terms; those not referencing ghost values are
+     computed while ghost values are exchanged */
 
-  /* non-diagonal terms */
+  const int n_l_groups
+    = (hs != NULL) ? matrix->numbering->n_no_adj_halo_groups : n_groups;
 
   if (mc->e_val != NULL) {
 
@@ -1580,6 +2105,11 @@ _b_mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
 
       for (int g_id = 0; g_id < n_groups; g_id++) {
 
+        if (g_id == n_l_groups && hs != NULL) {
+          _pre_vector_multiply_sync_x_end(matrix, hs, x);
+          hs = NULL;
+        }
+
 #       pragma omp parallel for
         for (int t_id = 0; t_id < n_threads; t_id++) {
 
@@ -1601,6 +2131,11 @@ _b_mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
 
       for (int g_id = 0; g_id < n_groups; g_id++) {
 
+        if (g_id == n_l_groups && hs != NULL) {
+          _pre_vector_multiply_sync_x_end(matrix, hs, x);
+          hs = NULL;
+        }
+
 #       pragma omp parallel for
         for (int t_id = 0; t_id < n_threads; t_id++) {
 
@@ -1620,6 +2155,11 @@ _b_mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
     }
 
   }
+
+  /* Finalize ghost cell comunication if not done above */
+
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 }
 
 /*----------------------------------------------------------------------------
@@ -1660,21 +2200,31 @@ _mat_vec_p_l_native_omp_atomic(cs_matrix_t  *matrix,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
+  /* non-diagonal terms; those not referencing ghost values are
+     computed while ghost values are exchanged */
 
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
+  const cs_lnum_t n_l_edges
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
 
-  /* non-diagonal terms */
+  for (int e_pass = 0; e_pass < 2; e_pass++) {
 
-  if (mc->e_val != NULL) {
+    const cs_lnum_t s_id = (e_pass == 0) ? 0 : n_l_edges;
+    const cs_lnum_t e_id = (e_pass == 0) ? n_l_edges : ms->n_edges;
+
+    /* Finalize ghost cell comunication if overlap used */
+
+    if (e_pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
+
+    if (mc->e_val == NULL)
+      continue;
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
     if (mc->symmetric) {
 
 #     pragma omp parallel for
-      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+      for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
 #       pragma omp atomic
@@ -1686,7 +2236,7 @@ _mat_vec_p_l_native_omp_atomic(cs_matrix_t  *matrix,
     else {
 
 #     pragma omp parallel for
-      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+      for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
 #       pragma omp atomic
@@ -1739,21 +2289,31 @@ _b_mat_vec_p_l_native_omp_atomic(cs_matrix_t  *matrix,
   else
     _b_zero_range(y, 0, ms->n_cols_ext, db_size);
 
-  /* Finalize ghost cell comunication if overlap used */
+  /* non-diagonal terms; those not referencing ghost values are
+     computed while ghost values are exchanged */
 
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+  const cs_lnum_t n_l_edges
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : ms->n_edges;
 
-  /* non-diagonal terms */
+  for (int e_pass = 0; e_pass < 2; e_pass++) {
 
-  if (mc->e_val != NULL) {
+    const cs_lnum_t s_id = (e_pass == 0) ? 0 : n_l_edges;
+    const cs_lnum_t e_id = (e_pass == 0) ? n_l_edges : ms->n_edges;
+
+    /* Finalize ghost cell comunication if overlap used */
+
+    if (e_pass == 1 && hs != NULL)
+      _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+    if (mc->e_val == NULL)
+      continue;
 
     const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
     if (mc->symmetric) {
 
 #     pragma omp parallel for
-      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+      for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
         for (cs_lnum_t kk = 0; kk < db_size; kk++) {
@@ -1768,7 +2328,7 @@ _b_mat_vec_p_l_native_omp_atomic(cs_matrix_t  *matrix,
     else {
 
 #     pragma omp parallel for
-      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
+      for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
         cs_lnum_t ii = face_cel_p[face_id][0];
         cs_lnum_t jj = face_cel_p[face_id][1];
         for (cs_lnum_t kk = 0; kk < db_size; kk++) {
@@ -1900,54 +2460,66 @@ _mat_vec_p_l_csr(cs_matrix_t  *matrix,
     = (const cs_matrix_coeff_csr_t *)matrix->coeffs;
   cs_lnum_t  n_rows = ms->n_rows;
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
+    if (r_pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
+    /* Standard case */
 
-      y[ii] = sii;
+    if (!exclude_diag) {
 
-    }
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
-  }
+        const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+        const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+        cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+        cs_real_t sii = 0.0;
 
-  /* Exclude diagonal */
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          sii += (m_row[jj]*x[col_id[jj]]);
 
-  else {
+        y[ii] = sii;
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      }
 
-      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
-      const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
-      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
-      cs_real_t sii = 0.0;
+    }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        if (col_id[jj] != ii)
-          sii += (m_row[jj]*x[col_id[jj]]);
-      }
+    /* Exclude diagonal */
+
+    else {
+
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+        const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+        const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+        cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+        cs_real_t sii = 0.0;
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          if (col_id[jj] != ii)
+            sii += (m_row[jj]*x[col_id[jj]]);
+        }
 
-      y[ii] = sii;
+        y[ii] = sii;
 
+      }
     }
+
   }
 }
 
@@ -2116,54 +2688,65 @@ _mat_vec_p_l_msr(cs_matrix_t  *matrix,
   const cs_lnum_t  *e_col_id = ms->e.col_id;
   const cs_lnum_t  *e_row_index = ms->e.row_index;
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
-      cs_real_t sii = 0.0;
+    if (r_pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
+    /* Standard case */
 
-      y[ii] = sii + mc->d_val[ii]*x[ii];
+    if (!exclude_diag && mc->d_val != NULL) {
 
-    }
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
-  }
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+        cs_real_t sii = 0.0;
 
-  /* Exclude diagonal */
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          sii += (m_row[jj]*x[col_id[jj]]);
 
-  else {
+        y[ii] = sii + mc->d_val[ii]*x[ii];
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      }
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
-      cs_real_t sii = 0.0;
+    }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-        sii += (m_row[jj]*x[col_id[jj]]);
+    /* Exclude diagonal */
+
+    else {
 
-      y[ii] = sii;
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+        cs_real_t sii = 0.0;
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          sii += (m_row[jj]*x[col_id[jj]]);
+
+        y[ii] = sii;
+
+      }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2194,103 +2777,315 @@ _mat_vec_p_l_msr_omp_sched(cs_matrix_t  *matrix,
   const cs_lnum_t  *e_col_id = ms->e.col_id;
   const cs_lnum_t  *e_row_index = ms->e.row_index;
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      cs_lnum_t n_s_rows = cs_align(n_rows * 0.9, _cs_cl);
-      if (n_s_rows > n_rows)
-        n_s_rows = n_rows;
+    if (r_pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_s_rows; ii++) {
+    /* Standard case */
 
-        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
-        cs_real_t sii = 0.0;
+    if (!exclude_diag && mc->d_val != NULL) {
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          sii += (m_row[jj]*x[col_id[jj]]);
+#     pragma omp parallel if(e_id - s_id > CS_THR_MIN)
+      {
 
-        y[ii] = sii + mc->d_val[ii]*x[ii];
+        cs_lnum_t n_s_rows = s_id + cs_align((e_id - s_id) * 0.9, _cs_cl);
+        if (n_s_rows > e_id)
+          n_s_rows = e_id;
+
+#       pragma omp for nowait
+        for (cs_lnum_t ii = s_id; ii < n_s_rows; ii++) {
+
+          const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+          const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+          cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+          cs_real_t sii = 0.0;
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            sii += (m_row[jj]*x[col_id[jj]]);
+
+          y[ii] = sii + mc->d_val[ii]*x[ii];
+
+        }
+
+#       pragma omp for schedule(dynamic, CS_THR_MIN)
+        for (cs_lnum_t ii = n_s_rows; ii < e_id; ii++) {
+
+          const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+          const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+          cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+          cs_real_t sii = 0.0;
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            sii += (m_row[jj]*x[col_id[jj]]);
+
+          y[ii] = sii + mc->d_val[ii]*x[ii];
+
+        }
 
       }
 
-#     pragma omp for schedule(dynamic, CS_THR_MIN)
-      for (cs_lnum_t ii = n_s_rows; ii < n_rows; ii++) {
+    }
 
-        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
-        cs_real_t sii = 0.0;
+    /* Exclude diagonal */
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          sii += (m_row[jj]*x[col_id[jj]]);
+    else {
 
-        y[ii] = sii + mc->d_val[ii]*x[ii];
+#     pragma omp parallel if(e_id - s_id > CS_THR_MIN)
+      {
+
+        cs_lnum_t n_s_rows = s_id + cs_align((e_id - s_id) * 0.9, _cs_cl);
+        if (n_s_rows > e_id)
+          n_s_rows = e_id;
+
+#       pragma omp for nowait
+        for (cs_lnum_t ii = s_id; ii < n_s_rows; ii++) {
+
+          const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+          const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+          cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+          cs_real_t sii = 0.0;
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            sii += (m_row[jj]*x[col_id[jj]]);
+
+          y[ii] = sii;
+
+        }
+
+#       pragma omp for schedule(dynamic, CS_THR_MIN)
+        for (cs_lnum_t ii = n_s_rows; ii < e_id; ii++) {
+
+          const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+          const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+          cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+          cs_real_t sii = 0.0;
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            sii += (m_row[jj]*x[col_id[jj]]);
+
+          y[ii] = sii;
+
+        }
 
       }
 
     }
 
   }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma mapping of
+ * MSR matrix, for the host chunk size.
+ *
+ * parameters:
+ *   sm     <-- pointer to SELL-C-sigma mapping
+ *   d_val  <-- diagonal values, or NULL to exclude diagonal
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_c_vec_p_l(const cs_matrix_sell_map_t  *sm,
+                const cs_real_t             *restrict d_val,
+                const cs_real_t             *restrict x,
+                cs_real_t                   *restrict y)
+{
+  const cs_lnum_t  c_size = _sell_chunk_size_host;
+  const cs_lnum_t  n_chunks = sm->n_chunks;
 
-  /* Exclude diagonal */
+  assert(sm->chunk_size == c_size);
 
-  else {
+# pragma omp parallel for  if(sm->n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
+    const cs_lnum_t s_id = sm->chunk_index[c_id];
+    const cs_lnum_t c_width = (sm->chunk_index[c_id+1] - s_id) / c_size;
+    const cs_lnum_t *restrict c_col_id = sm->col_id + s_id;
+    const cs_real_t *restrict c_val = sm->val + s_id;
+    const cs_lnum_t *restrict c_row_id = sm->row_id + c_id*c_size;
+
+    cs_real_t s[c_size];
+    for (cs_lnum_t l_id = 0; l_id < c_size; l_id++)
+      s[l_id] = 0.;
+
+    for (cs_lnum_t jj = 0; jj < c_width; jj++) {
+      const cs_lnum_t *restrict col_id = c_col_id + jj*c_size;
+      const cs_real_t *restrict m_col = c_val + jj*c_size;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t l_id = 0; l_id < c_size; l_id++)
+        s[l_id] += m_col[l_id] * x[col_id[l_id]];
+    }
 
-      cs_lnum_t n_s_rows = cs_align(n_rows * 0.9, _cs_cl);
-      if (n_s_rows > n_rows)
-        n_s_rows = n_rows;
+    if (d_val != NULL) {
+      for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+        cs_lnum_t ii = c_row_id[l_id];
+        if (ii > -1)
+          y[ii] = s[l_id] + d_val[ii]*x[ii];
+      }
+    }
+    else {
+      for (cs_lnum_t l_id = 0; l_id < c_size; l_id++) {
+        cs_lnum_t ii = c_row_id[l_id];
+        if (ii > -1)
+          y[ii] = s[l_id];
+      }
+    }
 
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_s_rows; ii++) {
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix, using SELL-C-sigma
+ * mapping of extra-diagonal terms.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_sell(cs_matrix_t  *matrix,
+                      bool          exclude_diag,
+                      bool          sync,
+                      cs_real_t    *restrict x,
+                      cs_real_t    *restrict y)
+{
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  /* Map matrix if not yet done */
+
+  const cs_matrix_sell_map_t *sm
+    = cs_matrix_spmv_sell_map(matrix, _sell_chunk_size_host);
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* Rows with no extra-diagonal terms belong to zero-width chunks,
+     so all rows are handled here. */
+
+  const cs_real_t *d_val = (!exclude_diag) ? mc->d_val : NULL;
+
+  _sell_c_vec_p_l(sm, d_val, x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix, using single-precision
+ * copy of coefficients (with double-precision accumulation).
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_f32(cs_matrix_t  *matrix,
+                     bool          exclude_diag,
+                     bool          sync,
+                     cs_real_t    *restrict x,
+                     cs_real_t    *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+
+  /* Map matrix if not yet done */
+
+  const cs_matrix_msr_f32_map_t *fm = cs_matrix_spmv_msr_f32_map(matrix);
+
+  const float *restrict e_val = fm->e_val;
+
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
+
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
+
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
+
+    if (r_pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
+
+    /* Standard case */
+
+    if (!exclude_diag && fm->d_val != NULL) {
+
+      const float *restrict d_val = fm->d_val;
+
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
         const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        const float *restrict m_row = e_val + e_row_index[ii];
         cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
         cs_real_t sii = 0.0;
 
         for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          sii += (m_row[jj]*x[col_id[jj]]);
+          sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
 
-        y[ii] = sii;
+        y[ii] = sii + (cs_real_t)d_val[ii]*x[ii];
 
       }
 
-#     pragma omp for schedule(dynamic, CS_THR_MIN)
-      for (cs_lnum_t ii = n_s_rows; ii < n_rows; ii++) {
+    }
+
+    /* Exclude diagonal */
+
+    else {
+
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
         const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        const float *restrict m_row = e_val + e_row_index[ii];
         cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
         cs_real_t sii = 0.0;
 
         for (cs_lnum_t jj = 0; jj < n_cols; jj++)
-          sii += (m_row[jj]*x[col_id[jj]]);
+          sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
 
         y[ii] = sii;
 
       }
-
     }
 
   }
-
 }
 
 /*----------------------------------------------------------------------------
@@ -2323,61 +3118,72 @@ _b_mat_vec_p_l_msr_generic(cs_matrix_t  *matrix,
   const cs_lnum_t  *e_col_id = ms->e.col_id;
   const cs_lnum_t  *e_row_index = ms->e.row_index;
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    if (r_pass == 1 && hs != NULL)
+      _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      _dense_b_ax(ii, db_size, db_size_2, mc->d_val, x, y);
+    /* Standard case */
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < db_size; kk++) {
-          y[ii*db_size + kk]
-            += (m_row[jj]*x[col_id[jj]*db_size + kk]);
+    if (!exclude_diag && mc->d_val != NULL) {
+
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+
+        _dense_b_ax(ii, db_size, db_size_2, mc->d_val, x, y);
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+            y[ii*db_size + kk]
+              += (m_row[jj]*x[col_id[jj]*db_size + kk]);
+          }
         }
+
       }
 
     }
 
-  }
-
-  /* Exclude diagonal */
+    /* Exclude diagonal */
 
-  else {
+    else {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      for (cs_lnum_t kk = 0; kk < db_size; kk++)
-        y[ii*db_size + kk] = 0.;
+        for (cs_lnum_t kk = 0; kk < db_size; kk++)
+          y[ii*db_size + kk] = 0.;
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < db_size; kk++) {
-          y[ii*db_size + kk]
-            += (m_row[jj]*x[col_id[jj]*db_size + kk]);
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+            y[ii*db_size + kk]
+              += (m_row[jj]*x[col_id[jj]*db_size + kk]);
+          }
         }
-      }
 
+      }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2410,57 +3216,68 @@ _b_mat_vec_p_l_msr_3(cs_matrix_t  *matrix,
 
   assert(matrix->db_size == 3);
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    if (r_pass == 1 && hs != NULL)
+      _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      _dense_3_3_ax(ii, mc->d_val, x, y);
+    /* Standard case */
+
+    if (!exclude_diag && mc->d_val != NULL) {
+
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+
+        _dense_3_3_ax(ii, mc->d_val, x, y);
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < 3; kk++)
+            y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+        }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
       }
 
     }
 
-  }
+    /* Exclude diagonal */
 
-  /* Exclude diagonal */
+    else {
 
-  else {
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] = 0.;
 
-      for (cs_lnum_t kk = 0; kk < 3; kk++)
-        y[ii*3 + kk] = 0.;
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < 3; kk++)
+            y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
+        }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 3; kk++)
-          y[ii*3 + kk] += (m_row[jj]*x[col_id[jj]*3 + kk]);
       }
-
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2493,57 +3310,68 @@ _b_mat_vec_p_l_msr_6(cs_matrix_t  *matrix,
 
   assert(matrix->db_size == 6);
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    if (r_pass == 1 && hs != NULL)
+      _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      _dense_6_6_ax(ii, mc->d_val, x, y);
+    /* Standard case */
+
+    if (!exclude_diag && mc->d_val != NULL) {
+
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+
+        _dense_6_6_ax(ii, mc->d_val, x, y);
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < 6; kk++)
+            y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+        }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
       }
 
     }
 
-  }
+    /* Exclude diagonal */
 
-  /* Exclude diagonal */
+    else {
 
-  else {
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          y[ii*6 + kk] = 0.;
 
-      for (cs_lnum_t kk = 0; kk < 6; kk++)
-        y[ii*6 + kk] = 0.;
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < 6; kk++)
+            y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+        }
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
       }
-
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2604,75 +3432,86 @@ _bb_mat_vec_p_l_msr_3(cs_matrix_t  *matrix,
   const cs_lnum_t  *e_col_id = ms->e.col_id;
   const cs_lnum_t  *e_row_index = ms->e.row_index;
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*9);
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    if (r_pass == 1 && hs != NULL)
+      _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      _dense_3_3_ax(ii, mc->d_val, x, y);
+    /* Standard case */
 
-      cs_real_t * _y = y + ii*3;
+    if (!exclude_diag && mc->d_val != NULL) {
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        _y[0] += (  m_row[jj*9]         * x[col_id[jj]*3]
-                  + m_row[jj*9 + 1]     * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 2]     * x[col_id[jj]*3 + 2]);
-        _y[1] += (  m_row[jj*9 + 3]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 3 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 3 + 2] * x[col_id[jj]*3 + 2]);
-        _y[2] += (  m_row[jj*9 + 6]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 6 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 6 + 2] * x[col_id[jj]*3 + 2]);
-      }
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
-    }
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*9);
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-  }
+        _dense_3_3_ax(ii, mc->d_val, x, y);
 
-  /* Exclude diagonal */
+        cs_real_t * _y = y + ii*3;
 
-  else {
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          _y[0] += (  m_row[jj*9]         * x[col_id[jj]*3]
+                    + m_row[jj*9 + 1]     * x[col_id[jj]*3 + 1]
+                    + m_row[jj*9 + 2]     * x[col_id[jj]*3 + 2]);
+          _y[1] += (  m_row[jj*9 + 3]     * x[col_id[jj]*3]
+                    + m_row[jj*9 + 3 + 1] * x[col_id[jj]*3 + 1]
+                    + m_row[jj*9 + 3 + 2] * x[col_id[jj]*3 + 2]);
+          _y[2] += (  m_row[jj*9 + 6]     * x[col_id[jj]*3]
+                    + m_row[jj*9 + 6 + 1] * x[col_id[jj]*3 + 1]
+                    + m_row[jj*9 + 6 + 2] * x[col_id[jj]*3 + 2]);
+        }
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      }
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*9);
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    }
 
-      cs_real_t * _y = y + (ii*3);
+    /* Exclude diagonal */
 
-      for (cs_lnum_t kk = 0; kk < 3; kk++)
-        _y[kk] = 0.;
+    else {
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        _y[0] += (  m_row[jj*9]         * x[col_id[jj]*3]
-                  + m_row[jj*9 + 1]     * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 2]     * x[col_id[jj]*3 + 2]);
-        _y[1] += (  m_row[jj*9 + 3]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 3 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 3 + 2] * x[col_id[jj]*3 + 2]);
-        _y[2] += (  m_row[jj*9 + 6]     * x[col_id[jj]*3]
-                  + m_row[jj*9 + 6 + 1] * x[col_id[jj]*3 + 1]
-                  + m_row[jj*9 + 6 + 2] * x[col_id[jj]*3 + 2]);
-      }
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row =  mc->e_val + (e_row_index[ii]*9);
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
+        cs_real_t * _y = y + (ii*3);
+
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          _y[kk] = 0.;
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          _y[0] += (  m_row[jj*9]         * x[col_id[jj]*3]
+                    + m_row[jj*9 + 1]     * x[col_id[jj]*3 + 1]
+                    + m_row[jj*9 + 2]     * x[col_id[jj]*3 + 2]);
+          _y[1] += (  m_row[jj*9 + 3]     * x[col_id[jj]*3]
+                    + m_row[jj*9 + 3 + 1] * x[col_id[jj]*3 + 1]
+                    + m_row[jj*9 + 3 + 2] * x[col_id[jj]*3 + 2]);
+          _y[2] += (  m_row[jj*9 + 6]     * x[col_id[jj]*3]
+                    + m_row[jj*9 + 6 + 1] * x[col_id[jj]*3 + 1]
+                    + m_row[jj*9 + 6 + 2] * x[col_id[jj]*3 + 2]);
+        }
+
+      }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2707,71 +3546,82 @@ _bb_mat_vec_p_l_msr_generic(cs_matrix_t  *matrix,
   const cs_lnum_t  *e_col_id = ms->e.col_id;
   const cs_lnum_t  *e_row_index = ms->e.row_index;
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
   cs_halo_state_t *hs
     = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
-  if (hs != NULL)
-    _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-  /* Standard case */
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row =   mc->e_val
-                                        + (e_row_index[ii]*eb_size_2);
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    if (r_pass == 1 && hs != NULL)
+      _pre_vector_multiply_sync_x_end(matrix, hs, x);
 
-      _dense_b_ax(ii, db_size, db_size_2, mc->d_val, x, y);
+    /* Standard case */
 
-      cs_real_t * _y = y + (ii*db_size);
+    if (!exclude_diag && mc->d_val != NULL) {
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < db_size; kk++) {
-          for (cs_lnum_t ll = 0; ll < db_size; ll++) {
-            _y[kk] += (  m_row[jj*eb_size_2 + kk*eb_size + ll]
-                       * x[col_id[jj]*db_size + ll]);
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row =   mc->e_val
+                                          + (e_row_index[ii]*eb_size_2);
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+
+        _dense_b_ax(ii, db_size, db_size_2, mc->d_val, x, y);
+
+        cs_real_t * _y = y + (ii*db_size);
+
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+            for (cs_lnum_t ll = 0; ll < db_size; ll++) {
+              _y[kk] += (  m_row[jj*eb_size_2 + kk*eb_size + ll]
+                         * x[col_id[jj]*db_size + ll]);
+            }
           }
         }
+
       }
 
     }
 
-  }
-
-  /* Exclude diagonal */
+    /* Exclude diagonal */
 
-  else {
+    else {
 
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+#     pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
 
-      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
-      const cs_real_t *restrict m_row =   mc->e_val
-                                        + (e_row_index[ii]*eb_size_2);
-      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+        const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+        const cs_real_t *restrict m_row =   mc->e_val
+                                          + (e_row_index[ii]*eb_size_2);
+        cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      cs_real_t * _y = y + (ii*db_size);
+        cs_real_t * _y = y + (ii*db_size);
 
-      for (cs_lnum_t kk = 0; kk < db_size; kk++)
-        _y[kk] = 0.;
+        for (cs_lnum_t kk = 0; kk < db_size; kk++)
+          _y[kk] = 0.;
 
-      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-        for (cs_lnum_t kk = 0; kk < db_size; kk++) {
-          for (cs_lnum_t ll = 0; ll < db_size; ll++) {
-            _y[kk] += (  m_row[jj*eb_size_2 + kk*eb_size + ll]
-                       * x[col_id[jj]*db_size + ll]);
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+          for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+            for (cs_lnum_t ll = 0; ll < db_size; ll++) {
+              _y[kk] += (  m_row[jj*eb_size_2 + kk*eb_size + ll]
+                         * x[col_id[jj]*db_size + ll]);
+            }
           }
         }
-      }
 
+      }
     }
-  }
 
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -3866,6 +4716,410 @@ const char *default_name = s_not_impl;
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
+/*============================================================================
+ * Semi-private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build or update the SELL-C-sigma mapping of a scalar MSR matrix.
+ *
+ * The mapping is stored as the matrix's ext_lib_map, and released
+ * along with matrix coefficients. It is rebuilt if the chunk size
+ * or the mapped coefficients differ.
+ *
+ * parameters:
+ *   matrix     <-> pointer to matrix structure
+ *   chunk_size <-- number of rows per chunk
+ *
+ * returns:
+ *   pointer to SELL-C-sigma mapping
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_sell_map_t *
+cs_matrix_spmv_sell_map(cs_matrix_t  *matrix,
+                        cs_lnum_t     chunk_size)
+{
+  assert(matrix->type == CS_MATRIX_MSR && matrix->eb_size == 1);
+
+  const cs_matrix_struct_dist_t *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  /* Remove mapping of another type or chunk size */
+
+  if (matrix->destroy_adaptor != _unset_sell_map) {
+    if (matrix->destroy_adaptor != nullptr)
+      matrix->destroy_adaptor(matrix);
+  }
+  else {
+    cs_matrix_sell_map_t *sm = (cs_matrix_sell_map_t *)matrix->ext_lib_map;
+    if (sm->chunk_size != chunk_size)
+      _unset_sell_map(matrix);
+  }
+
+  cs_matrix_sell_map_t *sm = (cs_matrix_sell_map_t *)matrix->ext_lib_map;
+
+  if (sm == nullptr) {
+    BFT_MALLOC(sm, 1, cs_matrix_sell_map_t);
+    sm->n_rows = 0;
+    sm->chunk_size = chunk_size;
+    sm->sigma = chunk_size * _sell_sigma_mult;
+    sm->n_chunks = 0;
+    sm->chunk_index = nullptr;
+    sm->row_id = nullptr;
+    sm->col_id = nullptr;
+    sm->val = nullptr;
+    sm->e_val_src = nullptr;
+
+    matrix->ext_lib_map = (void *)sm;
+    matrix->destroy_adaptor = _unset_sell_map;
+
+    _sell_map_build_structure(ms, matrix->alloc_mode, sm);
+  }
+
+  /* Values are repacked only when the coefficients are reassigned */
+
+  if (sm->e_val_src != mc->e_val)
+    _sell_map_pack_values(ms, matrix->alloc_mode, mc->e_val, sm);
+
+  return sm;
+}
+
+/*----------------------------------------------------------------------------
+ * Build or update the single-precision coefficients copy of a scalar
+ * MSR matrix.
+ *
+ * The mapping is stored as the matrix's ext_lib_map, and released
+ * along with matrix coefficients. Values are converted again if the
+ * mapped coefficients differ.
+ *
+ * parameters:
+ *   matrix     <-> pointer to matrix structure
+ *
+ * returns:
+ *   pointer to single-precision coefficients mapping
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_msr_f32_map_t *
+cs_matrix_spmv_msr_f32_map(cs_matrix_t  *matrix)
+{
+  assert(matrix->type == CS_MATRIX_MSR && matrix->eb_size == 1);
+
+  const cs_matrix_struct_dist_t *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  /* Remove mapping of another type */
+
+  if (   matrix->destroy_adaptor != _unset_msr_f32_map
+      && matrix->destroy_adaptor != nullptr)
+    matrix->destroy_adaptor(matrix);
+
+  cs_matrix_msr_f32_map_t *fm
+    = (cs_matrix_msr_f32_map_t *)matrix->ext_lib_map;
+
+  if (fm == nullptr) {
+    BFT_MALLOC(fm, 1, cs_matrix_msr_f32_map_t);
+    fm->n_rows = ms->n_rows;
+    fm->n_e_vals = (ms->n_rows > 0) ? ms->e.row_index[ms->n_rows] : 0;
+    fm->d_val = nullptr;
+    fm->e_val = nullptr;
+    fm->d_val_src = nullptr;
+    fm->e_val_src = nullptr;
+
+    BFT_MALLOC(fm->e_val, fm->n_e_vals, float);
+
+    matrix->ext_lib_map = (void *)fm;
+    matrix->destroy_adaptor = _unset_msr_f32_map;
+  }
+
+  /* Values are converted only when the coefficients are reassigned */
+
+  if (fm->d_val_src != mc->d_val) {
+    if (mc->d_val != nullptr) {
+      const cs_lnum_t n_rows = fm->n_rows;
+      if (fm->d_val == nullptr)
+        BFT_MALLOC(fm->d_val, n_rows, float);
+#     pragma omp parallel for  if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_rows; i++)
+        fm->d_val[i] = (float)(mc->d_val[i]);
+    }
+    else
+      BFT_FREE(fm->d_val);
+    fm->d_val_src = mc->d_val;
+  }
+
+  if (fm->e_val_src != mc->e_val) {
+    const cs_lnum_t n_e_vals = fm->n_e_vals;
+#   pragma omp parallel for  if(n_e_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_e_vals; i++)
+      fm->e_val[i] = (float)(mc->e_val[i]);
+    fm->e_val_src = mc->e_val;
+  }
+
+  return fm;
+}
+
+/*----------------------------------------------------------------------------
+ * Switch a native scalar matrix to matrix-free extra-diagonal terms.
+ *
+ * The definition is copied and stored as the matrix's ext_lib_map, and
+ * released (restoring previous SpMV functions) along with matrix
+ * coefficients. Arrays referenced by the definition must remain
+ * available as long as the matrix is used.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *   mf     <-- matrix-free operator definition
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_spmv_set_native_matrix_free(cs_matrix_t                  *matrix,
+                                      const cs_matrix_native_mf_t  *mf)
+{
+  assert(   matrix->type == CS_MATRIX_NATIVE
+         && matrix->db_size == 1 && matrix->eb_size == 1);
+
+  if (matrix->destroy_adaptor != nullptr)
+    matrix->destroy_adaptor(matrix);
+
+  cs_matrix_native_mf_t *_mf;
+  BFT_MALLOC(_mf, 1, cs_matrix_native_mf_t);
+  memcpy(_mf, mf, sizeof(cs_matrix_native_mf_t));
+
+  _mf->fill_type = matrix->fill_type;
+  for (int i = 0; i < CS_MATRIX_SPMV_N_TYPES; i++) {
+    _mf->vector_multiply[i] = matrix->vector_multiply[_mf->fill_type][i];
+    matrix->vector_multiply[_mf->fill_type][i] = _mat_vec_p_l_native_mf;
+  }
+
+  matrix->ext_lib_map = (void *)_mf;
+  matrix->destroy_adaptor = _unset_native_mf;
+}
+
+/*----------------------------------------------------------------------------
+ * Switch a scalar MSR matrix to a matrix-free operator function.
+ *
+ * The definition is copied and stored as the matrix's ext_lib_map, and
+ * released (restoring previous SpMV functions) along with matrix
+ * coefficients.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *   mf     <-- matrix-free operator definition
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_spmv_set_operator_matrix_free(cs_matrix_t                    *matrix,
+                                        const cs_matrix_operator_mf_t  *mf)
+{
+  assert(   matrix->type == CS_MATRIX_MSR
+         && matrix->db_size == 1 && matrix->eb_size == 1);
+
+  if (matrix->destroy_adaptor != nullptr)
+    matrix->destroy_adaptor(matrix);
+
+  cs_matrix_operator_mf_t *_mf;
+  BFT_MALLOC(_mf, 1, cs_matrix_operator_mf_t);
+  memcpy(_mf, mf, sizeof(cs_matrix_operator_mf_t));
+
+  _mf->fill_type = matrix->fill_type;
+  for (int i = 0; i < CS_MATRIX_SPMV_N_TYPES; i++) {
+    _mf->vector_multiply[i] = matrix->vector_multiply[_mf->fill_type][i];
+    matrix->vector_multiply[_mf->fill_type][i] = _mat_vec_p_l_operator_mf;
+  }
+
+  matrix->ext_lib_map = (void *)_mf;
+  matrix->destroy_adaptor = _unset_operator_mf;
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.block product Y = A.X for interleaved vectors, with no prior
+ * halo update of X.
+ *
+ * Vector values are interleaved, so that value i of vector k is
+ * found at position i*n_vecs + k. Each matrix coefficient is thus loaded
+ * only once for all vectors.
+ *
+ * Only scalar CSR and MSR matrices are handled here; for other
+ * matrix types, false is returned and the caller should fall back
+ * to individual matrix.vector products.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   n_vecs <-- number of interleaved vectors
+ *   x      <-- multipliying vectors values
+ *   y      --> resulting vectors
+ *
+ * returns:
+ *   true if the product was computed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_spmv_multi(const cs_matrix_t  *matrix,
+                     cs_lnum_t           n_vecs,
+                     const cs_real_t    *restrict x,
+                     cs_real_t          *restrict y)
+{
+  if (   matrix->fill_type != CS_MATRIX_SCALAR
+      && matrix->fill_type != CS_MATRIX_SCALAR_SYM)
+    return false;
+
+  if (matrix->type == CS_MATRIX_CSR) {
+
+    const cs_matrix_struct_csr_t  *ms
+      = (const cs_matrix_struct_csr_t *)matrix->structure;
+    const cs_matrix_coeff_csr_t  *mc
+      = (const cs_matrix_coeff_csr_t *)matrix->coeffs;
+    const cs_lnum_t  n_rows = ms->n_rows;
+
+#   pragma omp parallel for  if(n_rows*n_vecs > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t *restrict y_i = y + ii*n_vecs;
+
+      for (cs_lnum_t k = 0; k < n_vecs; k++)
+        y_i[k] = 0.;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t a_ij = m_row[jj];
+        const cs_real_t *restrict x_j = x + col_id[jj]*n_vecs;
+        for (cs_lnum_t k = 0; k < n_vecs; k++)
+          y_i[k] += a_ij*x_j[k];
+      }
+
+    }
+
+  }
+
+  else if (matrix->type == CS_MATRIX_MSR) {
+
+    const cs_matrix_struct_dist_t  *ms
+      = (const cs_matrix_struct_dist_t *)matrix->structure;
+    const cs_matrix_coeff_dist_t  *mc
+      = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+    const cs_lnum_t  n_rows = ms->n_rows;
+    const cs_lnum_t  *e_col_id = ms->e.col_id;
+    const cs_lnum_t  *e_row_index = ms->e.row_index;
+    const cs_real_t  *d_val = mc->d_val;
+
+#   pragma omp parallel for  if(n_rows*n_vecs > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+      const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
+      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+      const cs_real_t *restrict x_i = x + ii*n_vecs;
+      cs_real_t *restrict y_i = y + ii*n_vecs;
+
+      if (d_val != NULL) {
+        const cs_real_t d_ii = d_val[ii];
+        for (cs_lnum_t k = 0; k < n_vecs; k++)
+          y_i[k] = d_ii*x_i[k];
+      }
+      else {
+        for (cs_lnum_t k = 0; k < n_vecs; k++)
+          y_i[k] = 0.;
+      }
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t a_ij = m_row[jj];
+        const cs_real_t *restrict x_j = x + col_id[jj]*n_vecs;
+        for (cs_lnum_t k = 0; k < n_vecs; k++)
+          y_i[k] += a_ij*x_j[k];
+      }
+
+    }
+
+  }
+
+  else
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of leading rows (or graph edges for native matrices)
+ * of a matrix which do not reference ghost columns.
+ *
+ * The value is determined on first call and cached in the matrix.
+ * Products for these rows (or edges) may be computed while the halo
+ * exchange of the multiplying vector is in progress, so overlap is
+ * best when elements adjacent to ghost cells are numbered last
+ * (see cs_renumber_set_algorithm).
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *
+ * returns:
+ *   number of leading rows or edges not referencing ghost columns
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_matrix_spmv_n_no_adj_halo(cs_matrix_t  *matrix)
+{
+  if (matrix->n_no_adj_halo_elts > -1)
+    return matrix->n_no_adj_halo_elts;
+
+  const cs_lnum_t n_rows = matrix->n_rows;
+  const cs_matrix_struct_csr_t *ms_csr = NULL;
+
+  cs_lnum_t n_no_adj_halo = 0;
+
+  switch(matrix->type) {
+  case CS_MATRIX_NATIVE:
+    {
+      const cs_matrix_struct_native_t  *ms
+        = (const cs_matrix_struct_native_t *)matrix->structure;
+      n_no_adj_halo = ms->n_edges;
+      for (cs_lnum_t e_id = 0; e_id < ms->n_edges; e_id++) {
+        if (ms->edges[e_id][0] >= n_rows || ms->edges[e_id][1] >= n_rows) {
+          n_no_adj_halo = e_id;
+          break;
+        }
+      }
+    }
+    break;
+  case CS_MATRIX_CSR:
+    ms_csr = (const cs_matrix_struct_csr_t *)matrix->structure;
+    break;
+  case CS_MATRIX_MSR:
+    ms_csr = &(((const cs_matrix_struct_dist_t *)matrix->structure)->e);
+    break;
+  case CS_MATRIX_DIST:
+    /* Halo terms are already stored separately */
+    n_no_adj_halo = n_rows;
+    break;
+  default:
+    break;
+  }
+
+  if (ms_csr != NULL) {
+    const cs_lnum_t *row_index = ms_csr->row_index;
+    const cs_lnum_t *col_id = ms_csr->col_id;
+    n_no_adj_halo = n_rows;
+    for (cs_lnum_t ii = 0; ii < n_rows && n_no_adj_halo == n_rows; ii++) {
+      for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++) {
+        if (col_id[jj] >= n_rows) {
+          n_no_adj_halo = ii;
+          break;
+        }
+      }
+    }
+  }
+
+  matrix->n_no_adj_halo_elts = n_no_adj_halo;
+
+  return n_no_adj_halo;
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -3930,9 +5184,12 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m)
  *   CS_MATRIX_MSR
  *     default
  *     omp_sched       (Improved OpenMP scheduling, for CS_MATRIX_SCALAR*)
+ *     sell            (SELL-C-sigma mapping, for CS_MATRIX_SCALAR*)
+ *     f32             (single-precision coefficients, for CS_MATRIX_SCALAR*)
  *     mkl             (with MKL)
  *     mkl_sycl        (with MKL, using SYCL offload)
  *     cuda            (CUDA-accelerated)
+ *     cuda_sell       (CUDA-accelerated SELL-C-sigma, for CS_MATRIX_SCALAR*)
  *     cusparse        (with cuSPARSE)
  *
  *   CS_MATRIX_DIST
@@ -4337,6 +5594,48 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
       }
     }
 
+    else if (!strcmp(func_name, "sell")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_msr_sell;
+        _spmv[1] = _mat_vec_p_l_msr_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "f32")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_msr_f32;
+        _spmv[1] = _mat_vec_p_l_msr_f32;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "cuda_sell")) {
+#if defined(HAVE_CUDA)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = cs_matrix_spmv_cuda_msr_sell;
+        _spmv[1] = cs_matrix_spmv_cuda_msr_sell;
+        _spmv_xy_hd[0] = 'd';
+        _spmv_xy_hd[1] = 'd';
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
     break;
 
   /* Distributed
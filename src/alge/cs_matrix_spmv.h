@@ -58,6 +58,124 @@ BEGIN_C_DECLS
  * Semi-private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Build or update the SELL-C-sigma mapping of a scalar MSR matrix.
+ *
+ * The mapping is stored as the matrix's ext_lib_map, and released
+ * along with matrix coefficients. It is rebuilt if the chunk size
+ * or the mapped coefficients differ.
+ *
+ * parameters:
+ *   matrix     <-> pointer to matrix structure
+ *   chunk_size <-- number of rows per chunk
+ *
+ * returns:
+ *   pointer to SELL-C-sigma mapping
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_sell_map_t *
+cs_matrix_spmv_sell_map(cs_matrix_t  *matrix,
+                        cs_lnum_t     chunk_size);
+
+/*----------------------------------------------------------------------------
+ * Build or update the single-precision coefficients copy of a scalar
+ * MSR matrix.
+ *
+ * The mapping is stored as the matrix's ext_lib_map, and released
+ * along with matrix coefficients. Values are converted again if the
+ * mapped coefficients differ.
+ *
+ * parameters:
+ *   matrix     <-> pointer to matrix structure
+ *
+ * returns:
+ *   pointer to single-precision coefficients mapping
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_msr_f32_map_t *
+cs_matrix_spmv_msr_f32_map(cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------
+ * Switch a native scalar matrix to matrix-free extra-diagonal terms.
+ *
+ * The definition is copied and stored as the matrix's ext_lib_map, and
+ * released (restoring previous SpMV functions) along with matrix
+ * coefficients. Arrays referenced by the definition must remain
+ * available as long as the matrix is used.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *   mf     <-- matrix-free operator definition
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_spmv_set_native_matrix_free(cs_matrix_t                  *matrix,
+                                      const cs_matrix_native_mf_t  *mf);
+
+/*----------------------------------------------------------------------------
+ * Switch a scalar MSR matrix to a matrix-free operator function.
+ *
+ * The definition is copied and stored as the matrix's ext_lib_map, and
+ * released (restoring previous SpMV functions) along with matrix
+ * coefficients.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *   mf     <-- matrix-free operator definition
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_spmv_set_operator_matrix_free(cs_matrix_t                    *matrix,
+                                        const cs_matrix_operator_mf_t  *mf);
+
+/*----------------------------------------------------------------------------
+ * Matrix.block product Y = A.X for interleaved vectors, with no prior
+ * halo update of X.
+ *
+ * Vector values are interleaved, so that value i of vector k is
+ * found at position i*n_vecs + k. Each matrix coefficient is thus loaded
+ * only once for all vectors.
+ *
+ * Only scalar CSR and MSR matrices are handled here; for other
+ * matrix types, false is returned and the caller should fall back
+ * to individual matrix.vector products.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   n_vecs <-- number of interleaved vectors
+ *   x      <-- multipliying vectors values
+ *   y      --> resulting vectors
+ *
+ * returns:
+ *   true if the product was computed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_spmv_multi(const cs_matrix_t  *matrix,
+                     cs_lnum_t           n_vecs,
+                     const cs_real_t    *restrict x,
+                     cs_real_t          *restrict y);
+
+/*----------------------------------------------------------------------------
+ * Return the number of leading rows (or graph edges for native matrices)
+ * of a matrix which do not reference ghost columns.
+ *
+ * The value is determined on first call and cached in the matrix.
+ * Products for these rows (or edges) may be computed while the halo
+ * exchange of the multiplying vector is in progress, so overlap is
+ * best when elements adjacent to ghost cells are numbered last
+ * (see cs_renumber_set_algorithm).
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *
+ * returns:
+ *   number of leading rows or edges not referencing ghost columns
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_matrix_spmv_n_no_adj_halo(cs_matrix_t  *matrix);
+
 /*----------------------------------------------------------------------------
  * Assign default sparse matrix-vector product functions for a given matrix.
  *
@@ -92,9 +210,12 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m);
  *   CS_MATRIX_MSR
  *     default
  *     omp_sched       (Improved OpenMP scheduling, for CS_MATRIX_SCALAR*)
+ *     sell            (SELL-C-sigma mapping, for CS_MATRIX_SCALAR*)
+ *     f32             (single-precision coefficients, for CS_MATRIX_SCALAR*)
  *     mkl             (with MKL)
  *     mkl_sycl        (with MKL, using SYCL offload)
  *     cuda            (CUDA-accelerated)
+ *     cuda_sell       (CUDA-accelerated SELL-C-sigma, for CS_MATRIX_SCALAR*)
  *     cusparse        (with cuSPARSE)
  *
  *   CS_MATRIX_DIST
@@ -266,7 +266,8 @@ _mat_vect_p_l_native_exdiag_sym(cs_lnum_t           n_edges,
 /*----------------------------------------------------------------------------*/
 /* \brief Local matrix.vector product y = A.x with CSR matrix arrays.
  *
- * \param[in]   n_rows     number of local rows
+ * \param[in]   s_id       start row id
+ * \param[in]   e_id       past-the-end row id
  * \param[in]   row_index  pointer to matrix rows index
  * \param[in]   col_id     pointer to matrix column id
  * \param[in]   val        pointer to matrix values
@@ -276,17 +277,18 @@ _mat_vect_p_l_native_exdiag_sym(cs_lnum_t           n_edges,
 /*----------------------------------------------------------------------------*/
 
 __global__ static void
-_mat_vect_p_l_csr(cs_lnum_t         n_rows,
+_mat_vect_p_l_csr(cs_lnum_t         s_id,
+                   cs_lnum_t         e_id,
                   const cs_lnum_t  *__restrict__ row_index,
                   const cs_lnum_t  *__restrict__ col_id,
                   const cs_real_t  *__restrict__ val,
                   const cs_real_t  *__restrict__ x,
                   cs_real_t        *__restrict__ y)
 {
-  cs_lnum_t ii = blockIdx.x * blockDim.x + threadIdx.x;
+  cs_lnum_t ii = s_id + blockIdx.x * blockDim.x + threadIdx.x;
   cs_lnum_t jj;
 
-  if (ii < n_rows) {
+  if (ii < e_id) {
     cs_real_t sii = 0.0;
     const cs_lnum_t *__restrict__ _col_id = col_id + row_index[ii];
     const cs_real_t *__restrict__ m_row  = val + row_index[ii];
@@ -303,7 +305,8 @@ _mat_vect_p_l_csr(cs_lnum_t         n_rows,
 /* \brief Local matrix.vector product y = A.x with CSR matrix arrays,
  *        excluding diagonal part.
  *
- * \param[in]   n_rows     number of local rows
+ * \param[in]   s_id       start row id
+ * \param[in]   e_id       past-the-end row id
  * \param[in]   row_index  pointer to matrix rows index
  * \param[in]   col_id     pointer to matrix column id
  * \param[in]   val        pointer to matrix values
@@ -313,16 +316,17 @@ _mat_vect_p_l_csr(cs_lnum_t         n_rows,
 /*----------------------------------------------------------------------------*/
 
 __global__ static void
-_mat_vect_p_l_csr_exdiag(cs_lnum_t         n_rows,
+_mat_vect_p_l_csr_exdiag(cs_lnum_t         s_id,
+                          cs_lnum_t         e_id,
                          const cs_lnum_t  *__restrict__ row_index,
                          const cs_lnum_t  *__restrict__ col_id,
                          const cs_real_t  *__restrict__ val,
                          const cs_real_t  *__restrict__ x,
                          cs_real_t        *__restrict__ y)
 {
-  cs_lnum_t ii = blockIdx.x * blockDim.x + threadIdx.x;
+  cs_lnum_t ii = s_id + blockIdx.x * blockDim.x + threadIdx.x;
 
-  if (ii < n_rows) {
+  if (ii < e_id) {
     cs_real_t        sii            = 0.0;
     const cs_lnum_t *__restrict__ _col_id = col_id + row_index[ii];
     const cs_real_t *__restrict__ m_row  = val + row_index[ii];
@@ -377,7 +381,8 @@ _mat_vect_p_l_csr_substract_diag(cs_lnum_t         n_rows,
 /*----------------------------------------------------------------------------*/
 /* \brief Local matrix.vector product y = A.x with MSR matrix arrays.
  *
- * \param[in]   n_rows     number of local rows
+ * \param[in]   s_id       start row id
+ * \param[in]   e_id       past-the-end row id
  * \param[in]   row_index  pointer to matrix rows index
  * \param[in]   col_id     pointer to matrix column id
  * \param[in]   d_val      pointer to diagonal matrix values
@@ -388,7 +393,8 @@ _mat_vect_p_l_csr_substract_diag(cs_lnum_t         n_rows,
 /*----------------------------------------------------------------------------*/
 
 __global__ static void
-_mat_vect_p_l_msr(cs_lnum_t         n_rows,
+_mat_vect_p_l_msr(cs_lnum_t         s_id,
+                   cs_lnum_t         e_id,
                   const cs_lnum_t  *__restrict__ row_index,
                   const cs_lnum_t  *__restrict__ col_id,
                   const cs_real_t  *__restrict__ d_val,
@@ -396,9 +402,9 @@ _mat_vect_p_l_msr(cs_lnum_t         n_rows,
                   const cs_real_t  *__restrict__ x,
                   cs_real_t        *__restrict__ y)
 {
-  cs_lnum_t ii = blockIdx.x * blockDim.x + threadIdx.x;
+  cs_lnum_t ii = s_id + blockIdx.x * blockDim.x + threadIdx.x;
 
-  if (ii < n_rows) {
+  if (ii < e_id) {
     const cs_lnum_t *__restrict__ _col_id = col_id + row_index[ii];
     const cs_real_t *__restrict__ m_row  = x_val + row_index[ii];
 
@@ -413,6 +419,62 @@ _mat_vect_p_l_msr(cs_lnum_t         n_rows,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/* \brief Local matrix.vector product y = A.x with MSR matrix using
+ *        SELL-C-sigma mapping of extra-diagonal terms.
+ *
+ * One thread is used per chunk slot, so when the chunk size is a multiple
+ * of the warp size, accesses to padded column ids and values are coalesced.
+ *
+ * \param[in]   n_slots      number of chunk slots (n_chunks*chunk_size)
+ * \param[in]   chunk_size   number of rows per chunk
+ * \param[in]   chunk_index  start of each chunk in col_id and x_val
+ * \param[in]   row_id       original row id of each slot, or -1
+ * \param[in]   col_id       padded column ids
+ * \param[in]   d_val        pointer to diagonal matrix values, or NULL
+ * \param[in]   x_val        padded extradiagonal matrix values
+ * \param[in]   x            multipliying vector values
+ * \param[out]  y            resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+__global__ static void
+_mat_vect_p_l_msr_sell(cs_lnum_t         n_slots,
+                       cs_lnum_t         chunk_size,
+                       const cs_lnum_t  *__restrict__ chunk_index,
+                       const cs_lnum_t  *__restrict__ row_id,
+                       const cs_lnum_t  *__restrict__ col_id,
+                       const cs_real_t  *__restrict__ d_val,
+                       const cs_real_t  *__restrict__ x_val,
+                       const cs_real_t  *__restrict__ x,
+                       cs_real_t        *__restrict__ y)
+{
+  cs_lnum_t s_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+  if (s_id < n_slots) {
+    cs_lnum_t ii = row_id[s_id];
+    if (ii > -1) {
+      cs_lnum_t c_id = s_id / chunk_size;
+      cs_lnum_t l_id = s_id % chunk_size;
+      cs_lnum_t start_id = chunk_index[c_id];
+      cs_lnum_t c_width = (chunk_index[c_id + 1] - start_id) / chunk_size;
+
+      const cs_lnum_t *__restrict__ _col_id = col_id + start_id + l_id;
+      const cs_real_t *__restrict__ m_col = x_val + start_id + l_id;
+
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < c_width; jj++)
+        sii += m_col[jj*chunk_size] * __ldg(x + _col_id[jj*chunk_size]);
+
+      if (d_val != NULL)
+        sii += d_val[ii] * x[ii];
+
+      y[ii] = sii;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /* \brief Local diagonal contribution y = Da.x  + y.
  *
@@ -1322,25 +1384,42 @@ cs_matrix_spmv_cuda_csr(cs_matrix_t  *matrix,
     = (const cs_real_t *)cs_get_device_ptr_const_pf
                            (const_cast<cs_real_t *>(mc->val));
 
-  /* Ghost cell communication */
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
 
-  if (sync) {
-    cs_halo_state_t *hs = _pre_vector_multiply_sync_x_start(matrix, d_x);
-    cs_halo_sync_wait(matrix->halo, d_x, hs);
-  }
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, d_x) : NULL;
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
 
   /* Compute SpMV */
 
   unsigned int blocksize = 256;
-  unsigned int gridsize
-    = (unsigned int)ceil((double)ms->n_rows / blocksize);
 
-  if (!exclude_diag)
-    _mat_vect_p_l_csr<<<gridsize, blocksize, 0, _stream>>>
-      (ms->n_rows, row_index, col_id, val, d_x, d_y);
-  else
-    _mat_vect_p_l_csr_exdiag<<<gridsize, blocksize, 0, _stream>>>
-      (ms->n_rows, row_index, col_id, val, d_x, d_y);
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
+
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
+
+    if (r_pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, d_x, hs);
+
+    if (e_id <= s_id)
+      continue;
+
+    unsigned int gridsize
+      = (unsigned int)ceil((double)(e_id - s_id) / blocksize);
+
+    if (!exclude_diag)
+      _mat_vect_p_l_csr<<<gridsize, blocksize, 0, _stream>>>
+        (s_id, e_id, row_index, col_id, val, d_x, d_y);
+    else
+      _mat_vect_p_l_csr_exdiag<<<gridsize, blocksize, 0, _stream>>>
+        (s_id, e_id, row_index, col_id, val, d_x, d_y);
+
+  }
 
   if (_stream == 0) {
     cudaStreamSynchronize(0);
@@ -1539,6 +1618,90 @@ cs_matrix_spmv_cuda_msr(cs_matrix_t  *matrix,
     = (const cs_real_t *)cs_get_device_ptr_const_pf
                            (const_cast<cs_real_t *>(mc->e_val));
 
+  /* Ghost cell communication; rows not referencing ghost values
+     are computed while it is in progress */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, d_x) : NULL;
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t n_l_rows
+    = (hs != NULL) ? cs_matrix_spmv_n_no_adj_halo(matrix) : n_rows;
+
+  /* Compute SpMV */
+
+  unsigned int blocksize = 256;
+
+  for (int r_pass = 0; r_pass < 2; r_pass++) {
+
+    const cs_lnum_t s_id = (r_pass == 0) ? 0 : n_l_rows;
+    const cs_lnum_t e_id = (r_pass == 0) ? n_l_rows : n_rows;
+
+    if (r_pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, d_x, hs);
+
+    if (e_id <= s_id)
+      continue;
+
+    unsigned int gridsize
+      = (unsigned int)ceil((double)(e_id - s_id) / blocksize);
+
+    if (!exclude_diag)
+      _mat_vect_p_l_msr<<<gridsize, blocksize, 0, _stream>>>
+        (s_id, e_id, row_index, col_id, d_val, x_val, d_x, d_y);
+    else
+      _mat_vect_p_l_csr<<<gridsize, blocksize, 0, _stream>>>
+        (s_id, e_id, row_index, col_id, x_val, d_x, d_y);
+
+  }
+
+  if (_stream == 0) {
+    cudaStreamSynchronize(0);
+    CS_CUDA_CHECK(cudaGetLastError());
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.vector product y = A.x with MSR matrix, scalar CUDA version
+ *        using a SELL-C-sigma mapping of extra-diagonal terms.
+ *
+ * \param[in]   matrix        pointer to matrix structure
+ * \param[in]   exclude_diag  exclude diagonal if true,
+ * \param[in]   sync          synchronize ghost cells if true
+ * \param[in]   d_x           multipliying vector values (on device)
+ * \param[out]  d_y           resulting vector (on device)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_spmv_cuda_msr_sell(cs_matrix_t  *matrix,
+                             bool          exclude_diag,
+                             bool          sync,
+                             cs_real_t     d_x[],
+                             cs_real_t     d_y[])
+{
+  const cs_matrix_coeff_dist_t *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  /* Map matrix if not yet done (using warp-sized chunks) */
+
+  const cs_matrix_sell_map_t *sm = cs_matrix_spmv_sell_map(matrix, 32);
+
+  const cs_lnum_t *__restrict__ chunk_index
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(sm->chunk_index);
+  const cs_lnum_t *__restrict__ row_id
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(sm->row_id);
+  const cs_lnum_t *__restrict__ col_id
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(sm->col_id);
+  const cs_real_t *__restrict__ x_val
+    = (const cs_real_t *)cs_get_device_ptr_const_pf(sm->val);
+
+  const cs_real_t *__restrict__ d_val = NULL;
+  if (!exclude_diag)
+    d_val = (const cs_real_t *)cs_get_device_ptr_const_pf
+                                 (const_cast<cs_real_t *>(mc->d_val));
+
   /* Ghost cell communication */
 
   if (sync) {
@@ -1548,16 +1711,16 @@ cs_matrix_spmv_cuda_msr(cs_matrix_t  *matrix,
 
   /* Compute SpMV */
 
+  cs_lnum_t n_slots = sm->n_chunks * sm->chunk_size;
+
   unsigned int blocksize = 256;
   unsigned int gridsize
-    = (unsigned int)ceil((double)ms->n_rows / blocksize);
+    = (unsigned int)ceil((double)n_slots / blocksize);
 
-  if (!exclude_diag)
-    _mat_vect_p_l_msr<<<gridsize, blocksize, 0, _stream>>>
-      (ms->n_rows, row_index, col_id, d_val, x_val, d_x, d_y);
-  else
-    _mat_vect_p_l_csr<<<gridsize, blocksize, 0, _stream>>>
-      (ms->n_rows, row_index, col_id, x_val, d_x, d_y);
+  if (n_slots > 0)
+    _mat_vect_p_l_msr_sell<<<gridsize, blocksize, 0, _stream>>>
+      (n_slots, sm->chunk_size, chunk_index, row_id, col_id,
+       d_val, x_val, d_x, d_y);
 
   if (_stream == 0) {
     cudaStreamSynchronize(0);
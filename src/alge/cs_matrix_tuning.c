@@ -75,10 +75,12 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_file.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
 #include "cs_numbering.h"
+#include "cs_parall.h"
 #include "cs_prototypes.h"
 #include "cs_timer.h"
 
@@ -101,6 +103,11 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Tuning cache: maximum key and line lengths */
+
+#define CS_MATRIX_TUNING_KEY_LEN  256
+#define CS_MATRIX_TUNING_LINE_LEN  512
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -358,6 +365,332 @@ _matrix_tune_spmv_select(const cs_matrix_t    *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return path of tuning results cache file.
+ *
+ * The CS_MATRIX_TUNING_CACHE environment variable may be used to define
+ * the path, or disable the cache if set to "off" or an empty string.
+ * By default, $HOME/.cache/code_saturne/matrix_tuning.csv is used.
+ *
+ * parameters:
+ *   path     --> cache file path
+ *   path_max <-- maximum path length
+ *
+ * returns:
+ *   true if a cache file is used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_tuning_cache_path(char    *path,
+                   size_t   path_max)
+{
+  path[0] = '\0';
+
+  const char *s = getenv("CS_MATRIX_TUNING_CACHE");
+
+  if (s != NULL) {
+    if (strlen(s) == 0 || strcmp(s, "off") == 0)
+      return false;
+    snprintf(path, path_max, "%s", s);
+  }
+  else {
+    const char *home = getenv("HOME");
+    if (home == NULL)
+      return false;
+    snprintf(path, path_max, "%s/.cache/code_saturne/matrix_tuning.csv", home);
+  }
+
+  path[path_max - 1] = '\0';
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Build key identifying a tuning configuration.
+ *
+ * The key includes the machine's CPU model (or the value of the
+ * CS_MATRIX_TUNING_MACHINE environment variable), the matrix type,
+ * fill type, block size and allocation mode, the power of 2 immediately
+ * above the maximum local number of rows, and the numbers of ranks
+ * and threads.
+ *
+ * This function must be called by all ranks.
+ *
+ * parameters:
+ *   m   <-- associated matrix
+ *   key --> key string (size: CS_MATRIX_TUNING_KEY_LEN)
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_key(const cs_matrix_t  *m,
+            char                key[CS_MATRIX_TUNING_KEY_LEN])
+{
+  char machine[128] = "unknown";
+
+  const char *s = getenv("CS_MATRIX_TUNING_MACHINE");
+
+  if (s != NULL)
+    snprintf(machine, 127, "%s", s);
+
+#if defined(__linux__)
+
+  else {
+    FILE *fp = fopen("/proc/cpuinfo", "r");
+    if (fp != NULL) {
+      char line[256];
+      while (fgets(line, 256, fp) != NULL) {
+        if (strncmp(line, "model name", 10) == 0) {
+          char *p = strchr(line, ':');
+          if (p != NULL) {
+            for (p++; *p == ' '; p++);
+            snprintf(machine, 127, "%s", p);
+          }
+          break;
+        }
+      }
+      fclose(fp);
+    }
+  }
+
+#endif
+
+  /* Remove separators and trailing whitespace */
+
+  for (char *p = machine; *p != '\0'; p++) {
+    if (*p == ';')
+      *p = ',';
+    else if (*p == '\n' || *p == '\r')
+      *p = '\0';
+  }
+  for (int i = strlen(machine) - 1; i > 0 && machine[i] == ' '; i--)
+    machine[i] = '\0';
+
+  int size_class = 0;
+  cs_gnum_t n_rows = cs_matrix_get_n_rows(m);
+  cs_parall_max(1, CS_GNUM_TYPE, &n_rows);
+  while (((cs_gnum_t)1 << size_class) < n_rows)
+    size_class++;
+
+  snprintf(key, CS_MATRIX_TUNING_KEY_LEN,
+           "%s;%s;%s;%d;%d;%d;%d;%d",
+           machine,
+           cs_matrix_get_type_name(m),
+           cs_matrix_fill_type_name[m->fill_type],
+           (int)(m->db_size),
+           (int)(m->alloc_mode),
+           size_class,
+           cs_glob_n_ranks,
+           cs_glob_n_threads);
+
+  key[CS_MATRIX_TUNING_KEY_LEN - 1] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Read SpMV costs from tuning cache.
+ *
+ * Costs are only used if all variant and operation combinations
+ * are present in the cache for the given key.
+ *
+ * This function must be called by all ranks.
+ *
+ * parameters:
+ *   path        <-- cache file path
+ *   key         <-- tuning configuration key
+ *   n_variants  <-- number of variants in array
+ *   m_variant   <-- array of matrix variants
+ *   spmv_cost   --> SpMV cost
+ *
+ * returns:
+ *   true if costs were read from the cache, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_tuning_cache_read(const char                 *path,
+                   const char                 *key,
+                   int                         n_variants,
+                   const cs_matrix_variant_t  *m_variant,
+                   double                      spmv_cost[])
+{
+  const int n_costs = n_variants*CS_MATRIX_SPMV_N_TYPES;
+  int n_found = 0;
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *fp = fopen(path, "r");
+
+    if (fp != NULL) {
+
+      const size_t key_len = strlen(key);
+      bool *found;
+      BFT_MALLOC(found, n_costs, bool);
+      for (int i = 0; i < n_costs; i++)
+        found[i] = false;
+
+      char line[CS_MATRIX_TUNING_LINE_LEN];
+
+      while (fgets(line, CS_MATRIX_TUNING_LINE_LEN, fp) != NULL) {
+
+        if (strncmp(line, key, key_len) != 0 || line[key_len] != ';')
+          continue;
+
+        /* Remaining fields: variant;op;hd;cost */
+
+        char *v_name = line + key_len + 1;
+        char *p = strchr(v_name, ';');
+        if (p == NULL)
+          continue;
+        *p = '\0';
+
+        int op_type;
+        char hd;
+        double cost;
+        if (sscanf(p+1, "%d;%c;%lg", &op_type, &hd, &cost) != 3)
+          continue;
+        if (op_type < 0 || op_type >= CS_MATRIX_SPMV_N_TYPES)
+          continue;
+
+        for (int i = 0; i < n_variants; i++) {
+          const cs_matrix_variant_t *v = m_variant + i;
+          const int j = i*CS_MATRIX_SPMV_N_TYPES + op_type;
+          if (   found[j] == false
+              && strcmp(v->name[op_type], v_name) == 0
+              && v->vector_multiply_xy_hd[op_type] == hd) {
+            spmv_cost[j] = cost;
+            found[j] = true;
+            n_found += 1;
+            break;
+          }
+        }
+
+      }
+
+      fclose(fp);
+
+      /* Variants not usable in this configuration were not measured */
+
+      for (int i = 0; i < n_variants; i++) {
+        for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+          const int k = i*CS_MATRIX_SPMV_N_TYPES + j;
+          if (found[k] == false && m_variant[i].vector_multiply[j] == NULL) {
+            spmv_cost[k] = -1;
+            n_found += 1;
+          }
+        }
+      }
+
+      BFT_FREE(found);
+
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    MPI_Bcast(&n_found, 1, MPI_INT, 0, cs_glob_mpi_comm);
+    if (n_found == n_costs)
+      MPI_Bcast(spmv_cost, n_costs, MPI_DOUBLE, 0, cs_glob_mpi_comm);
+  }
+
+#endif
+
+  return (n_found == n_costs) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Write SpMV costs to tuning cache.
+ *
+ * Previous entries with the same key are replaced. The cache file is
+ * written by rank 0 only; errors are not fatal.
+ *
+ * parameters:
+ *   path        <-- cache file path
+ *   key         <-- tuning configuration key
+ *   n_variants  <-- number of variants in array
+ *   m_variant   <-- array of matrix variants
+ *   spmv_cost   <-- SpMV cost
+ *----------------------------------------------------------------------------*/
+
+static void
+_tuning_cache_write(const char                 *path,
+                    const char                 *key,
+                    int                         n_variants,
+                    const cs_matrix_variant_t  *m_variant,
+                    const double                spmv_cost[])
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  /* Make sure parent directories are present */
+
+  char *dir_path;
+  BFT_MALLOC(dir_path, strlen(path) + 1, char);
+  strcpy(dir_path, path);
+  for (char *p = dir_path + 1; *p != '\0'; p++) {
+    if (*p == '/') {
+      *p = '\0';
+      if (cs_file_isdir(dir_path) == 0)
+        cs_file_mkdir_default(dir_path);
+      *p = '/';
+    }
+  }
+  BFT_FREE(dir_path);
+
+  char *tmp_path;
+  BFT_MALLOC(tmp_path, strlen(path) + 5, char);
+  sprintf(tmp_path, "%s.tmp", path);
+
+  FILE *fp_out = fopen(tmp_path, "w");
+
+  if (fp_out == NULL) {
+    bft_printf(_("\n Warning: unable to write matrix tuning cache \"%s\".\n"),
+               path);
+    BFT_FREE(tmp_path);
+    return;
+  }
+
+  /* Copy other entries */
+
+  const size_t key_len = strlen(key);
+  char line[CS_MATRIX_TUNING_LINE_LEN];
+
+  FILE *fp_in = fopen(path, "r");
+
+  if (fp_in != NULL) {
+    while (fgets(line, CS_MATRIX_TUNING_LINE_LEN, fp_in) != NULL) {
+      if (strncmp(line, key, key_len) == 0 && line[key_len] == ';')
+        continue;
+      fputs(line, fp_out);
+    }
+    fclose(fp_in);
+  }
+  else
+    fprintf(fp_out,
+            "# machine;type;fill;db_size;alloc_mode;size_class;"
+            "n_ranks;n_threads;variant;op;hd;cost\n");
+
+  /* New entries */
+
+  for (int i = 0; i < n_variants; i++) {
+    const cs_matrix_variant_t *v = m_variant + i;
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+      if (v->vector_multiply[j] == NULL)
+        continue;
+      fprintf(fp_out, "%s;%s;%d;%c;%.6e\n",
+              key, v->name[j], j, v->vector_multiply_xy_hd[j],
+              spmv_cost[i*CS_MATRIX_SPMV_N_TYPES + j]);
+    }
+  }
+
+  fclose(fp_out);
+
+  if (rename(tmp_path, path) != 0)
+    bft_printf(_("\n Warning: unable to write matrix tuning cache \"%s\".\n"),
+               path);
+
+  BFT_FREE(tmp_path);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -374,6 +707,13 @@ _matrix_tune_spmv_select(const cs_matrix_t    *m,
  * is returned; the second one applies to the host only, the third one
  * to the device only.
  *
+ * Measured costs are stored in a tuning cache file, and reused by later
+ * runs on the same machine and with the same matrix characteristics
+ * and parallelism. The cache file is
+ * $HOME/.cache/code_saturne/matrix_tuning.csv by default, or may be
+ * defined using the CS_MATRIX_TUNING_CACHE environment variable ("off"
+ * to disable). Setting CS_MATRIX_TUNING_REFRESH forces new measures.
+ *
  * \param[in]  m           associated matrix
  * \param[in]  verbosity   verbosity level
  * \param[in]  n_measure   minimum number of measuring runs
@@ -411,11 +751,43 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
     double *spmv_cost;
     BFT_MALLOC(spmv_cost, n_variants*CS_MATRIX_SPMV_N_TYPES, double);
 
-    _matrix_tune_test(m,
-                      n_measure,
-                      n_variants,
-                      m_variant,
-                      spmv_cost);
+    /* Reuse results from previous runs if available */
+
+    char cache_path[512], key[CS_MATRIX_TUNING_KEY_LEN];
+    bool use_cache = _tuning_cache_path(cache_path, 512);
+    bool cached = false;
+
+    if (use_cache) {
+      _tuning_key(m, key);
+      if (getenv("CS_MATRIX_TUNING_REFRESH") == NULL)
+        cached = _tuning_cache_read(cache_path,
+                                    key,
+                                    n_variants,
+                                    m_variant,
+                                    spmv_cost);
+    }
+
+    if (cached) {
+      if (verbosity > 0)
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("\n"
+                        "Using cached tuning results from \"%s\".\n"),
+                      cache_path);
+    }
+    else {
+      _matrix_tune_test(m,
+                        n_measure,
+                        n_variants,
+                        m_variant,
+                        spmv_cost);
+
+      if (use_cache)
+        _tuning_cache_write(cache_path,
+                            key,
+                            n_variants,
+                            m_variant,
+                            spmv_cost);
+    }
 
     _matrix_tune_spmv_select(m,
                              verbosity,
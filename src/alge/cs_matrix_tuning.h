@@ -67,6 +67,13 @@ BEGIN_C_DECLS
  * is returned; the second one applies to the host only, the third one
  * to the device only.
  *
+ * Measured costs are stored in a tuning cache file, and reused by later
+ * runs on the same machine and with the same matrix characteristics
+ * and parallelism. The cache file is
+ * $HOME/.cache/code_saturne/matrix_tuning.csv by default, or may be
+ * defined using the CS_MATRIX_TUNING_CACHE environment variable ("off"
+ * to disable). Setting CS_MATRIX_TUNING_REFRESH forces new measures.
+ *
  * \param[in]  m           associated matrix
  * \param[in]  verbosity   verbosity level
  * \param[in]  n_measure   minimum number of measuring runs
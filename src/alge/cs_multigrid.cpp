@@ -74,6 +74,7 @@
 #include "cs_sles.h"
 #include "cs_sles_it.h"
 #include "cs_sles_pc.h"
+#include "cs_sles_telemetry.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
 #include "cs_time_step.h"
@@ -268,6 +269,48 @@ typedef struct _cs_multigrid_setup_data_t {
 
 } cs_multigrid_setup_data_t;
 
+/* Replicated dense direct solver for coarsest level */
+/*---------------------------------------------------*/
+
+typedef struct _cs_mg_coarse_direct_t {
+
+  cs_lnum_t      n_rows;         /* Local number of rows */
+  cs_lnum_t      n_g_rows;       /* Number of rows of replicated system */
+  cs_lnum_t      row_shift;      /* Replicated id of first local row */
+
+#if defined(HAVE_MPI)
+  MPI_Comm       comm;           /* Associated communicator */
+  int           *counts;         /* Number of rows per rank */
+  int           *displs;         /* Rows displacement per rank */
+#endif
+
+  cs_lnum_t     *piv;            /* Row permutation (partial pivoting) */
+  cs_real_t     *lu;             /* Dense LU factorization */
+  cs_real_t     *b;              /* Replicated right-hand side or solution */
+
+} cs_mg_coarse_direct_t;
+
+/* Coarse grids saved for reuse */
+/*-------------------------------*/
+
+typedef struct _cs_multigrid_reuse_t {
+
+  unsigned          n_grids;       /* Number of saved coarse grids */
+  cs_grid_t       **grids;         /* Saved coarse grids (level 1 and up) */
+
+  const cs_lnum_t  *f_row_index;   /* Fine matrix row index, used to check
+                                      the matrix structure is unchanged */
+  cs_lnum_t         f_n_rows;      /* Fine matrix number of rows */
+  cs_lnum_t         f_n_cols_ext;  /* Fine matrix number of columns */
+
+  int               n_reuse;       /* Number of successive setups
+                                      reusing the saved grids */
+  unsigned          n_cycles_ref;  /* Number of cycles for solve following
+                                      the last full rebuild */
+  bool              rebuild;       /* Force full rebuild at next setup */
+
+} cs_multigrid_reuse_t;
+
 /* Grid hierarchy */
 /*----------------*/
 
@@ -299,6 +342,25 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  int        f32_level_min;      /* If > 0, coarse grids of this level and
+                                    above use single-precision matrix
+                                    coefficients for matrix-vector products */
+
+  int        aggressive_levels;  /* Number of first levels built using
+                                    aggressive coarsening */
+  cs_gnum_t  coarse_direct_max;  /* If > 0, global number of rows under
+                                    which coarsening stops, and the coarsest
+                                    level is solved by a replicated dense
+                                    direct solver */
+
+  int        reuse_max;          /* If > 0, maximum number of successive
+                                    setups reusing the coarse grids
+                                    aggregation, with only their matrix
+                                    coefficients recomputed */
+  double     reuse_cycles_ratio; /* Force full rebuild when the number of
+                                    cycles exceeds this ratio times that
+                                    following the last full rebuild */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -349,6 +411,10 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  cs_multigrid_reuse_t       *reuse;        /* Coarse grids saved for
+                                               reuse by next setup,
+                                               or nullptr */
+
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   int                         plot_time_stamp;  /* plotting time stamp;
                                                    if < 0, use wall clock */
@@ -550,6 +616,28 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                   (unsigned long long)(mg->merge_glob_threshold));
 #endif
 
+  if (mg->f32_level_min > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Single-precision coefficients from level: %d\n"),
+                  mg->f32_level_min);
+
+  if (mg->aggressive_levels > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Aggressive coarsening levels:      %d\n"),
+                  mg->aggressive_levels);
+
+  if (mg->coarse_direct_max > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarsest level direct solve under: %llu rows\n"),
+                  (unsigned long long)(mg->coarse_direct_max));
+
+  if (mg->reuse_max > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse grids reuse:\n"
+                    "    max. successive setups:          %d\n"
+                    "    rebuild cycles ratio:            %g\n"),
+                  mg->reuse_max, mg->reuse_cycles_ratio);
+
   cs_log_printf(CS_LOG_SETUP,
                 _("  Cycle type:                        %s\n"),
                 _(cs_multigrid_type_name[mg->type]));
@@ -899,6 +987,107 @@ _multigrid_setup_data_create(void)
   return mgd;
 }
 
+/*----------------------------------------------------------------------------
+ * Return coarse grids reuse structure for a multigrid solver, creating
+ * it if needed.
+ *
+ * parameters:
+ *   mg <-> multigrid structure
+ *
+ * returns:
+ *   pointer to reuse structure, or nullptr if reuse is not active
+ *   or not handled for this solver.
+ *----------------------------------------------------------------------------*/
+
+static cs_multigrid_reuse_t *
+_multigrid_reuse_get(cs_multigrid_t  *mg)
+{
+  if (   mg->reuse_max < 1
+      || mg->subtype != CS_MULTIGRID_MAIN
+      || mg->type == CS_MULTIGRID_K_CYCLE_HPC)
+    return nullptr;
+
+  if (mg->reuse == nullptr) {
+    cs_multigrid_reuse_t *r;
+    BFT_MALLOC(r, 1, cs_multigrid_reuse_t);
+    r->n_grids = 0;
+    r->grids = nullptr;
+    r->f_row_index = nullptr;
+    r->f_n_rows = -1;
+    r->f_n_cols_ext = -1;
+    r->n_reuse = 0;
+    r->n_cycles_ref = 0;
+    r->rebuild = false;
+    mg->reuse = r;
+  }
+
+  return mg->reuse;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy coarse grids saved for reuse.
+ *
+ * parameters:
+ *   r <-> pointer to reuse structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_reuse_discard(cs_multigrid_reuse_t  *r)
+{
+  for (unsigned i = 0; i < r->n_grids; i++)
+    cs_grid_destroy(r->grids + i);
+  BFT_FREE(r->grids);
+
+  r->n_grids = 0;
+  r->f_row_index = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Save coarse grids of the current hierarchy for reuse by the next setup.
+ *
+ * Saved grids are removed from the current hierarchy. Nothing is saved
+ * (so that the next setup fully rebuilds the hierarchy) if a rebuild was
+ * requested, or the maximum number of successive reuses is reached.
+ *
+ * parameters:
+ *   mg <-> multigrid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_reuse_save(cs_multigrid_t  *mg)
+{
+  cs_multigrid_reuse_t *r = _multigrid_reuse_get(mg);
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  if (r == nullptr || mgd->n_levels < 2)
+    return;
+
+  _multigrid_reuse_discard(r);
+
+  if (r->rebuild || r->n_reuse >= mg->reuse_max) {
+    r->rebuild = false;
+    r->n_reuse = 0;
+    return;
+  }
+
+  const cs_matrix_t *a = cs_grid_get_matrix(mgd->grid_hierarchy[0]);
+
+  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+    return;
+
+  cs_matrix_get_msr_arrays(a, &(r->f_row_index), nullptr, nullptr, nullptr);
+  r->f_n_rows = cs_matrix_get_n_rows(a);
+  r->f_n_cols_ext = cs_matrix_get_n_columns(a);
+
+  r->n_grids = mgd->n_levels - 1;
+  BFT_MALLOC(r->grids, r->n_grids, cs_grid_t *);
+
+  for (unsigned i = 0; i < r->n_grids; i++) {
+    r->grids[i] = mgd->grid_hierarchy[i+1];
+    mgd->grid_hierarchy[i+1] = nullptr;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Add grid to multigrid structure hierarchy.
  *
@@ -1060,6 +1249,73 @@ _multigrid_add_level(cs_multigrid_t  *mg,
   mgd->n_levels += 1;
 }
 
+/*----------------------------------------------------------------------------
+ * Add coarse grids saved by a previous setup to the hierarchy, updating
+ * only their matrix coefficients.
+ *
+ * Grids which cannot be updated (and all coarser grids) are discarded.
+ *
+ * parameters:
+ *   mg        <-> multigrid structure
+ *   f         <-- fine grid
+ *   verbosity <-- verbosity level
+ *
+ * returns:
+ *   number of reused grids
+ *----------------------------------------------------------------------------*/
+
+static unsigned
+_multigrid_reuse_grids(cs_multigrid_t   *mg,
+                       const cs_grid_t  *f,
+                       int               verbosity)
+{
+  cs_multigrid_reuse_t *r = _multigrid_reuse_get(mg);
+
+  if (r == nullptr)
+    return 0;
+
+  unsigned n_reused = 0;
+
+  if (r->n_grids > 0) {
+
+    const cs_matrix_t *a = cs_grid_get_matrix(f);
+    const cs_lnum_t *f_row_index = nullptr;
+
+    if (cs_matrix_get_type(a) == CS_MATRIX_MSR)
+      cs_matrix_get_msr_arrays(a, &f_row_index, nullptr, nullptr, nullptr);
+
+    if (   f_row_index == r->f_row_index
+        && cs_matrix_get_n_rows(a) == r->f_n_rows
+        && cs_matrix_get_n_columns(a) == r->f_n_cols_ext) {
+
+      const cs_grid_t *g = f;
+
+      for (n_reused = 0; n_reused < r->n_grids; n_reused++) {
+        cs_grid_t *c = r->grids[n_reused];
+        if (cs_grid_update_coarse_coefficients(g, c) == false)
+          break;
+        if (verbosity > 2)
+          bft_printf(_("\n   reusing level %2u grid\n"),
+                     mg->setup_data->n_levels);
+        r->grids[n_reused] = nullptr;
+        _multigrid_add_level(mg, c);
+        g = c;
+      }
+
+    }
+
+  }
+
+  _multigrid_reuse_discard(r);
+
+  if (n_reused > 0)
+    r->n_reuse += 1;
+  else
+    r->n_reuse = 0;
+
+  return n_reused;
+}
+
 /*----------------------------------------------------------------------------
  * Add postprocessing info to multigrid hierarchy
  *
@@ -1751,6 +2007,367 @@ _multigrid_create_k_cycle_bottom(cs_multigrid_t  *parent)
   return mg;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if the replicated direct solver may be used for a given grid.
+ *
+ * parameters:
+ *   mg <-- multigrid structure
+ *   g  <-- grid
+ *
+ * returns:
+ *   true if the grid may be solved directly, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_coarse_direct_is_usable(const cs_multigrid_t  *mg,
+                         const cs_grid_t       *g)
+{
+  if (   mg->coarse_direct_max < 1
+      || mg->subtype == CS_MULTIGRID_BOTTOM
+      || mg->lv_mg[2] != nullptr)
+    return false;
+
+  const cs_matrix_t *a = cs_grid_get_matrix(g);
+
+  if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+      || cs_matrix_get_diag_block_size(a) != 1
+      || cs_matrix_get_extra_diag_block_size(a) != 1)
+    return false;
+
+  /* Grid may be too large if coarsening stopped for another reason */
+
+  cs_gnum_t n_g_rows = 0;
+  cs_grid_get_info(g, nullptr, nullptr, nullptr, nullptr, nullptr,
+                   nullptr, nullptr, nullptr, &n_g_rows);
+
+  if (n_g_rows > mg->coarse_direct_max)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Create replicated direct solver context for coarsest level.
+ *
+ * parameters:
+ *   g <-- associated grid
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static cs_mg_coarse_direct_t *
+_coarse_direct_create(const cs_grid_t  *g)
+{
+  cs_mg_coarse_direct_t *c;
+
+  BFT_MALLOC(c, 1, cs_mg_coarse_direct_t);
+
+  c->n_rows = 0;
+  c->n_g_rows = 0;
+  c->row_shift = 0;
+
+#if defined(HAVE_MPI)
+  c->comm = cs_grid_get_comm(g);
+  c->counts = nullptr;
+  c->displs = nullptr;
+#else
+  CS_UNUSED(g);
+#endif
+
+  c->piv = nullptr;
+  c->lu = nullptr;
+  c->b = nullptr;
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy replicated direct solver context.
+ *
+ * parameters:
+ *   context <-> pointer to context pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_coarse_direct_destroy(void  **context)
+{
+  cs_mg_coarse_direct_t *c = (cs_mg_coarse_direct_t *)(*context);
+
+  if (c == nullptr)
+    return;
+
+#if defined(HAVE_MPI)
+  BFT_FREE(c->counts);
+  BFT_FREE(c->displs);
+#endif
+
+  BFT_FREE(c->piv);
+  BFT_FREE(c->lu);
+  BFT_FREE(c->b);
+
+  BFT_FREE(c);
+  *context = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Setup replicated direct solver: the coarse matrix is gathered on all
+ * ranks of the grid's communicator and LU-factorized there, so that
+ * each solve only requires gathering the right-hand side.
+ *
+ * Zero pivots (such as for singular pure Neumann problems) are replaced
+ * by 1, fixing the associated solution component.
+ *
+ * parameters:
+ *   context   <-> pointer to solver context
+ *   name      <-- pointer to name of linear system
+ *   a         <-- associated matrix
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_coarse_direct_setup(void               *context,
+                     const char         *name,
+                     const cs_matrix_t  *a,
+                     int                 verbosity)
+{
+  cs_mg_coarse_direct_t *c = (cs_mg_coarse_direct_t *)context;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+
+  c->n_rows = n_rows;
+  c->n_g_rows = n_rows;
+  c->row_shift = 0;
+
+#if defined(HAVE_MPI)
+
+  int n_ranks = 1;
+
+  if (c->comm != MPI_COMM_NULL) {
+    int rank_id;
+    MPI_Comm_size(c->comm, &n_ranks);
+    MPI_Comm_rank(c->comm, &rank_id);
+    BFT_REALLOC(c->counts, n_ranks, int);
+    BFT_REALLOC(c->displs, n_ranks, int);
+    int _n_rows = n_rows;
+    MPI_Allgather(&_n_rows, 1, MPI_INT, c->counts, 1, MPI_INT, c->comm);
+    c->n_g_rows = 0;
+    for (int i = 0; i < n_ranks; i++) {
+      c->displs[i] = c->n_g_rows;
+      c->n_g_rows += c->counts[i];
+    }
+    c->row_shift = c->displs[rank_id];
+  }
+
+#endif
+
+  const cs_lnum_t n = c->n_g_rows;
+
+  BFT_REALLOC(c->piv, n, cs_lnum_t);
+  BFT_REALLOC(c->lu, (size_t)n*n, cs_real_t);
+  BFT_REALLOC(c->b, n, cs_real_t);
+
+  if (n_rows == 0)
+    return;
+
+  /* Replicated column ids (exchanged as reals, exact at these sizes) */
+
+  cs_real_t *g_col_id;
+  BFT_MALLOC(g_col_id, n_cols_ext, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    g_col_id[i] = c->row_shift + i;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  if (halo != nullptr)
+    cs_halo_sync_var(halo, CS_HALO_STANDARD, g_col_id);
+
+  /* Local rows of dense matrix */
+
+  const cs_lnum_t  *row_index, *col_id;
+  const cs_real_t  *d_val, *x_val;
+
+  cs_matrix_get_msr_arrays(a, &row_index, &col_id, &d_val, &x_val);
+
+  cs_real_t *a_l = c->lu + (size_t)(c->row_shift)*n;
+
+  for (size_t i = 0; i < (size_t)n_rows*n; i++)
+    a_l[i] = 0.;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_real_t *a_row = a_l + (size_t)i*n;
+    a_row[c->row_shift + i] += d_val[i];
+    for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+      cs_lnum_t k = (cs_lnum_t)(g_col_id[col_id[j]]);
+      a_row[k] += x_val[j];
+    }
+  }
+
+  BFT_FREE(g_col_id);
+
+#if defined(HAVE_MPI)
+
+  if (n_ranks > 1) {
+    int *counts, *displs;
+    BFT_MALLOC(counts, n_ranks, int);
+    BFT_MALLOC(displs, n_ranks, int);
+    for (int i = 0; i < n_ranks; i++) {
+      counts[i] = c->counts[i]*n;
+      displs[i] = c->displs[i]*n;
+    }
+    MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                   c->lu, counts, displs, CS_MPI_REAL, c->comm);
+    BFT_FREE(displs);
+    BFT_FREE(counts);
+  }
+
+#endif
+
+  /* LU factorization with partial pivoting */
+
+  cs_real_t *restrict lu = c->lu;
+
+  cs_real_t a_max = 0;
+  for (size_t i = 0; i < (size_t)n*n; i++)
+    a_max = CS_MAX(a_max, fabs(lu[i]));
+
+  const cs_real_t eps = 1e-13 * a_max;
+  cs_lnum_t n_zero_pivots = 0;
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    cs_lnum_t p = k;
+    cs_real_t p_max = fabs(lu[(size_t)k*n + k]);
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      cs_real_t v = fabs(lu[(size_t)i*n + k]);
+      if (v > p_max) {
+        p_max = v;
+        p = i;
+      }
+    }
+    c->piv[k] = p;
+
+    if (p != k) {
+      for (cs_lnum_t j = 0; j < n; j++) {
+        cs_real_t t = lu[(size_t)k*n + j];
+        lu[(size_t)k*n + j] = lu[(size_t)p*n + j];
+        lu[(size_t)p*n + j] = t;
+      }
+    }
+
+    if (p_max <= eps) {
+      lu[(size_t)k*n + k] = 1.;
+      for (cs_lnum_t i = k+1; i < n; i++)
+        lu[(size_t)i*n + k] = 0.;
+      n_zero_pivots++;
+      continue;
+    }
+
+    const cs_real_t *restrict row_k = lu + (size_t)k*n;
+    const cs_real_t d_inv = 1. / row_k[k];
+
+#   pragma omp parallel for  if((n - k)*(n - k) > CS_THR_MIN)
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      cs_real_t *restrict row_i = lu + (size_t)i*n;
+      cs_real_t l = row_i[k] * d_inv;
+      row_i[k] = l;
+      for (cs_lnum_t j = k+1; j < n; j++)
+        row_i[j] -= l * row_k[j];
+    }
+
+  }
+
+  if (verbosity > 1)
+    bft_printf(_("   %s: replicated direct solver, %ld rows"
+                 " (%ld zero pivots)\n"),
+               name, (long)n, (long)n_zero_pivots);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve using replicated direct solver.
+ *
+ * parameters and return value are those of cs_sles_solve_t.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_coarse_direct_solve(void                *context,
+                     const char          *name,
+                     const cs_matrix_t   *a,
+                     int                  verbosity,
+                     double               precision,
+                     double               r_norm,
+                     int                 *n_iter,
+                     double              *residual,
+                     const cs_real_t     *rhs,
+                     cs_real_t           *vx_ini,
+                     cs_real_t           *vx,
+                     size_t               aux_size,
+                     void                *aux_vectors)
+{
+  CS_UNUSED(name);
+  CS_UNUSED(a);
+  CS_UNUSED(verbosity);
+  CS_UNUSED(precision);
+  CS_UNUSED(r_norm);
+  CS_UNUSED(vx_ini);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  cs_mg_coarse_direct_t *c = (cs_mg_coarse_direct_t *)context;
+
+  *n_iter = 1;
+  *residual = 0.;
+
+  if (c->n_rows == 0)
+    return CS_SLES_CONVERGED;
+
+  const cs_lnum_t n = c->n_g_rows;
+  const cs_real_t *restrict lu = c->lu;
+  cs_real_t *restrict b = c->b;
+
+  /* Gather right-hand side */
+
+#if defined(HAVE_MPI)
+  if (n > c->n_rows)
+    MPI_Allgatherv(rhs, c->n_rows, CS_MPI_REAL,
+                   b, c->counts, c->displs, CS_MPI_REAL, c->comm);
+  else
+#endif
+    memcpy(b, rhs, n*sizeof(cs_real_t));
+
+  /* Forward and backward substitution */
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+    cs_lnum_t p = c->piv[k];
+    if (p != k) {
+      cs_real_t t = b[k];
+      b[k] = b[p];
+      b[p] = t;
+    }
+  }
+
+  for (cs_lnum_t i = 1; i < n; i++) {
+    const cs_real_t *restrict row_i = lu + (size_t)i*n;
+    cs_real_t s = b[i];
+    for (cs_lnum_t j = 0; j < i; j++)
+      s -= row_i[j]*b[j];
+    b[i] = s;
+  }
+
+  for (cs_lnum_t i = n-1; i > -1; i--) {
+    const cs_real_t *restrict row_i = lu + (size_t)i*n;
+    cs_real_t s = b[i];
+    for (cs_lnum_t j = i+1; j < n; j++)
+      s -= row_i[j]*b[j];
+    b[i] = s / row_i[i];
+  }
+
+  memcpy(vx, b + c->row_shift, c->n_rows*sizeof(cs_real_t));
+
+  return CS_SLES_CONVERGED;
+}
+
 /*----------------------------------------------------------------------------
  * Allocate working array for coarse right hand sides and corrections.
  *
@@ -2120,7 +2737,14 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
     cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[i*2]);
 
     mg_sles->context = nullptr;
-    if (mg->info.precision_mult[2] < 0) {
+
+    if (_coarse_direct_is_usable(mg, g)) {
+      mg_sles->context = _coarse_direct_create(g);
+      mg_sles->setup_func = _coarse_direct_setup;
+      mg_sles->solve_func = _coarse_direct_solve;
+      mg_sles->destroy_func = _coarse_direct_destroy;
+    }
+    else if (mg->info.precision_mult[2] < 0) {
       mg_sles->context
         = cs_multigrid_smoother_create(mg->info.type[2+k],
                                        mg->info.poly_degree[2+k],
@@ -2148,7 +2772,7 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
     }
 
 #if defined(HAVE_MPI)
-    {
+    if (mg_sles->solve_func != _coarse_direct_solve) {
       cs_sles_it_t  *context = (cs_sles_it_t *)mg_sles->context;
       cs_sles_it_set_mpi_reduce_comm(context,
                                      cs_grid_get_comm(mgd->grid_hierarchy[i]),
@@ -2325,16 +2949,54 @@ _setup_hierarchy(void             *context,
 
   bool add_grid = true;
 
+  /* Reuse coarse grids from previous setup if possible; if all saved grids
+     could be reused, the hierarchy is complete, otherwise coarsening
+     continues from the coarsest reused grid. */
+
+  if (mg->reuse != nullptr) {
+
+    unsigned n_saved = mg->reuse->n_grids;
+    unsigned n_reused = _multigrid_reuse_grids(mg, f, verbosity);
+
+    if (n_reused > 0) {
+      g = mg->setup_data->grid_hierarchy[n_reused];
+      cs_grid_get_info(g,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       &n_coarse_ranks,
+                       &n_rows,
+                       &n_cols_ext,
+                       &n_entries,
+                       &n_g_rows);
+      mg_lv_info = mg->lv_info + n_reused;
+      if (n_reused == n_saved)
+        add_grid = false;
+    }
+
+    t2 = cs_timer_time();
+    cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t1, &t2);
+    t1 = t2;
+
+  }
+
   while (add_grid) {
 
     n_g_rows_prev = n_g_rows;
     n_coarse_ranks_prev = n_coarse_ranks;
 
-    /* Recursion test */
+    /* Recursion test; when the coarsest level is solved directly,
+       no further coarsening is needed once it is small enough */
 
     if ((int)(mg->setup_data->n_levels) >= mg->n_levels_max)
       break;
 
+    if (   mg->setup_data->n_levels > 1
+        && n_g_rows <= mg->coarse_direct_max
+        && _coarse_direct_is_usable(mg, g))
+      break;
+
     /* Build coarser grid from previous grid */
 
     if (verbosity > 2)
@@ -2355,10 +3017,13 @@ _setup_hierarchy(void             *context,
       cs_grid_coarsening_t coarsening_type = mg->coarsening_type[fg_i];
       int aggregation_limit = mg->aggregation_limit[fg_i];
 
+      bool aggressive = (grid_lv <= mg->aggressive_levels) ? true : false;
+
       g = cs_grid_coarsen(g,
                           amode,
                           coarsening_type,
                           aggregation_limit,
+                          aggressive,
                           verbosity,
                           mg->merge_stride,
                           mg->merge_mean_threshold,
@@ -2402,6 +3067,9 @@ _setup_hierarchy(void             *context,
 
     if (add_grid) {
 
+      if (mg->f32_level_min > 0 && grid_lv >= mg->f32_level_min)
+        cs_grid_set_matrix_single_precision(g);
+
       _multigrid_add_level(mg, g); /* Assign to hierarchy */
 
       /* Print coarse mesh stats */
@@ -2848,6 +3516,8 @@ _convergence_test(cs_multigrid_t        *mg,
 
   *residual = sqrt(_dot_xx(mg, n_f_rows, rhs));
 
+  cs_sles_telemetry_add_residual(mg, *residual);
+
   if (cycle_id == 1)
     initial_residual = *residual;
 
@@ -4540,6 +5210,13 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
+  mg->f32_level_min = 0;
+
+  mg->aggressive_levels = 0;
+  mg->coarse_direct_max = 0;
+
+  mg->reuse_max = 0;
+  mg->reuse_cycles_ratio = 1.5;
 
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
@@ -4574,6 +5251,7 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->n_levels_post = 0;
 
   mg->setup_data = nullptr;
+  mg->reuse = nullptr;
 
   BFT_MALLOC(mg->lv_info, mg->n_levels_max, cs_multigrid_level_info_t);
 
@@ -4632,6 +5310,11 @@ cs_multigrid_destroy(void  **context)
   if (mg == nullptr)
     return;
 
+  if (mg->reuse != nullptr) {
+    _multigrid_reuse_discard(mg->reuse);
+    BFT_FREE(mg->reuse);
+  }
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_row_num != nullptr) {
@@ -5011,6 +5694,127 @@ cs_multigrid_set_max_cycles(cs_multigrid_t     *mg,
   info->n_max_cycles = n_max_cycles;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the coarsest levels of a multigrid hierarchy to use
+ *        single-precision matrix coefficients.
+ *
+ * Coarse grid matrices of the given level and above then use a float copy
+ * of their coefficients for matrix-vector products (with double-precision
+ * accumulation), halving the memory traffic of residual computations and
+ * Jacobi-type smoothers on those levels. Solution and work vectors, and
+ * the outer solver, remain in double precision.
+ *
+ * This applies only to scalar host-based coarse grids, and is ignored
+ * for others.
+ *
+ * \param[in, out]  mg         pointer to multigrid info and context
+ * \param[in]       level_min  first coarse level using single precision,
+ *                             or < 1 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_single_precision(cs_multigrid_t  *mg,
+                                         int              level_min)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->f32_level_min = (level_min > 0) ? level_min : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow reuse of a multigrid coarse grid hierarchy across setups.
+ *
+ * When active, the aggregation and structure of coarse grids are kept
+ * from one setup to the next (typically across time steps), and only
+ * their matrix coefficients are recomputed (Galerkin product), as long
+ * as the fine matrix keeps the same structure.
+ *
+ * A full rebuild occurs after reuse_max successive setups, or when the
+ * number of cycles required by a solve exceeds cycles_ratio times that
+ * of the solve following the last full rebuild.
+ *
+ * This is handled only for coarse grids built from MSR matrices without
+ * P0/P1 relaxation; other grids are rebuilt.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       reuse_max     maximum number of successive setups
+ *                                reusing coarse grids, or < 1 to disable
+ * \param[in]       cycles_ratio  cycles ratio forcing a full rebuild
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse(cs_multigrid_t  *mg,
+                       int              reuse_max,
+                       double           cycles_ratio)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->reuse_max = (reuse_max > 0) ? reuse_max : 0;
+  mg->reuse_cycles_ratio = cycles_ratio;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set aggressive coarsening for the first levels of a multigrid
+ *        hierarchy.
+ *
+ * For those levels, a second aggregation pass is applied to the coarse
+ * grid (so that aggregates include distance-2 neighbors), reducing the
+ * number of levels and associated global synchronizations per cycle.
+ *
+ * \param[in, out]  mg        pointer to multigrid info and context
+ * \param[in]       n_levels  number of first levels using aggressive
+ *                            coarsening, or < 1 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_aggressive_coarsening(cs_multigrid_t  *mg,
+                                       int              n_levels)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->aggressive_levels = (n_levels > 0) ? n_levels : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use a replicated dense direct solver for the coarsest level
+ *        of a multigrid hierarchy.
+ *
+ * Coarsening stops once the global number of rows is under the given
+ * threshold, and the coarsest matrix is then gathered and factorized on
+ * all ranks of that level's communicator (a sub-communicator when ranks
+ * were merged), so that each coarse solve requires a single gather
+ * operation instead of an iterative solve with multiple reductions.
+ *
+ * This is used only for scalar matrices; other cases are solved
+ * with the coarse iterative solver.
+ *
+ * \param[in, out]  mg          pointer to multigrid info and context
+ * \param[in]       n_g_rows    global number of rows under which the
+ *                              coarsest level is solved directly,
+ *                              or 0 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct(cs_multigrid_t  *mg,
+                               cs_gnum_t        n_g_rows)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->coarse_direct_max = n_g_rows;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Indicate if a multigrid solver requires an MSR matrix input.
@@ -5210,6 +6014,8 @@ cs_multigrid_solve(void                *context,
 
     /* Restart solve timer */
     t0 = cs_timer_time();
+    cs_sles_telemetry_add_setup_time(  (t0.sec - t1.sec)
+                                     + (t0.nsec - t1.nsec)*1e-9);
   }
 
   if (mg_info->is_pc == false && verbosity > 1)
@@ -5386,6 +6192,16 @@ cs_multigrid_solve(void                *context,
     mg_info->n_cycles[1] = n_cycles;
   }
 
+  /* Request full rebuild of reused coarse grids if convergence degrades */
+
+  if (mg->reuse != nullptr) {
+    cs_multigrid_reuse_t *r = mg->reuse;
+    if (r->n_reuse == 0)
+      r->n_cycles_ref = n_cycles;
+    else if (n_cycles > mg->reuse_cycles_ratio * r->n_cycles_ref)
+      r->rebuild = true;
+  }
+
   /* Update number of resolutions and timing data */
 
   mg_info->n_calls[1] += 1;
@@ -5445,7 +6261,9 @@ cs_multigrid_free(void  *context)
     }
     BFT_FREE(mgd->sles_hierarchy);
 
-    /* Destroy grid hierarchy */
+    /* Save coarse grids for reuse if needed, and destroy grid hierarchy */
+
+    _multigrid_reuse_save(mg);
 
     for (int i = mgd->n_levels - 1; i > -1; i--)
       cs_grid_destroy(mgd->grid_hierarchy + i);
@@ -313,6 +313,102 @@ void
 cs_multigrid_set_max_cycles(cs_multigrid_t     *mg,
                             int                 n_max_cycles);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Set the coarsest levels of a multigrid hierarchy to use
+ *        single-precision matrix coefficients.
+ *
+ * Coarse grid matrices of the given level and above then use a float copy
+ * of their coefficients for matrix-vector products (with double-precision
+ * accumulation), halving the memory traffic of residual computations and
+ * Jacobi-type smoothers on those levels. Solution and work vectors, and
+ * the outer solver, remain in double precision.
+ *
+ * This applies only to scalar host-based coarse grids, and is ignored
+ * for others.
+ *
+ * \param[in, out]  mg         pointer to multigrid info and context
+ * \param[in]       level_min  first coarse level using single precision,
+ *                             or < 1 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_single_precision(cs_multigrid_t  *mg,
+                                         int              level_min);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Allow reuse of a multigrid coarse grid hierarchy across setups.
+ *
+ * When active, the aggregation and structure of coarse grids are kept
+ * from one setup to the next (typically across time steps), and only
+ * their matrix coefficients are recomputed (Galerkin product), as long
+ * as the fine matrix keeps the same structure.
+ *
+ * A full rebuild occurs after reuse_max successive setups, or when the
+ * number of cycles required by a solve exceeds cycles_ratio times that
+ * of the solve following the last full rebuild.
+ *
+ * This is handled only for coarse grids built from MSR matrices without
+ * P0/P1 relaxation; other grids are rebuilt.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       reuse_max     maximum number of successive setups
+ *                                reusing coarse grids, or < 1 to disable
+ * \param[in]       cycles_ratio  cycles ratio forcing a full rebuild
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse(cs_multigrid_t  *mg,
+                       int              reuse_max,
+                       double           cycles_ratio);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Set aggressive coarsening for the first levels of a multigrid
+ *        hierarchy.
+ *
+ * For those levels, a second aggregation pass is applied to the coarse
+ * grid (so that aggregates include distance-2 neighbors), reducing the
+ * number of levels and associated global synchronizations per cycle.
+ *
+ * \param[in, out]  mg        pointer to multigrid info and context
+ * \param[in]       n_levels  number of first levels using aggressive
+ *                            coarsening, or < 1 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_aggressive_coarsening(cs_multigrid_t  *mg,
+                                       int              n_levels);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Use a replicated dense direct solver for the coarsest level
+ *        of a multigrid hierarchy.
+ *
+ * Coarsening stops once the global number of rows is under the given
+ * threshold, and the coarsest matrix is then gathered and factorized on
+ * all ranks of that level's communicator (a sub-communicator when ranks
+ * were merged), so that each coarse solve requires a single gather
+ * operation instead of an iterative solve with multiple reductions.
+ *
+ * This is used only for scalar matrices; other cases are solved
+ * with the coarse iterative solver.
+ *
+ * \param[in, out]  mg          pointer to multigrid info and context
+ * \param[in]       n_g_rows    global number of rows under which the
+ *                              coarsest level is solved directly,
+ *                              or 0 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct(cs_multigrid_t  *mg,
+                               cs_gnum_t        n_g_rows);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Indicate if a multigrid solver requires an MSR matrix input.
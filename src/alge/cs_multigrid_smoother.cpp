@@ -36,6 +36,7 @@
 #include <string.h>
 #include <assert.h>
 #include <math.h>
+#include <float.h>
 
 #if defined(HAVE_MPI)
 #include <mpi.h>
@@ -91,6 +92,11 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Number of Lanczos steps used to estimate the spectrum
+   for the Chebyshev smoother */
+
+#define CHEBYSHEV_N_LANCZOS 10
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -105,6 +111,11 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Targeted Chebyshev smoother eigenvalue bounds, relative
+   to the estimated largest eigenvalue of D^-1.A */
+
+static const double _chebyshev_eig_ratio[2] = {0.1, 1.1};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1310,6 +1321,277 @@ _block_jacobi(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+/*----------------------------------------------------------------------------
+ * Estimate the largest eigenvalue of D^-1.A for the Chebyshev smoother.
+ *
+ * A few Lanczos steps are applied to the symmetrized operator
+ * D^-1/2.A.D^-1/2 (which has the same spectrum as D^-1.A), and the
+ * largest eigenvalue of the resulting tridiagonal matrix is determined
+ * by bisection (using Sturm sequences).
+ *
+ * Host arrays are used, so this may be called for matrices whose
+ * coefficients are also mirrored on device.
+ *
+ * parameters:
+ *   c <-- pointer to solver context info
+ *   a <-- linear equation matrix
+ *
+ * returns:
+ *   estimated largest eigenvalue
+ *----------------------------------------------------------------------------*/
+
+static double
+_chebyshev_eig_max(const cs_sles_it_t  *c,
+                   const cs_matrix_t   *a)
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const int n_max_steps = CHEBYSHEV_N_LANCZOS;
+  double alpha[CHEBYSHEV_N_LANCZOS], beta[CHEBYSHEV_N_LANCZOS + 1];
+
+  cs_real_t *d_s, *v_p, *v, *vt, *w;
+  BFT_MALLOC(d_s, n_rows, cs_real_t);
+  BFT_MALLOC(v_p, n_rows, cs_real_t);
+  BFT_MALLOC(v, n_rows, cs_real_t);
+  BFT_MALLOC(vt, n_cols, cs_real_t);
+  BFT_MALLOC(w, n_rows, cs_real_t);
+
+  /* Pseudo-random (but reproducible) starting vector, so as not to
+     miss high frequency modes */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    d_s[ii] = sqrt(CS_ABS(ad_inv[ii]));
+    unsigned h = (unsigned)ii * 2654435761u;
+    v[ii] = (double)(h >> 8) / (double)(1u << 24) - 0.5;
+    v_p[ii] = 0.;
+  }
+
+  double s = sqrt(_dot_product_xx(c, v));
+  if (s > DBL_MIN) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      v[ii] /= s;
+  }
+
+  /* Lanczos steps */
+
+  int n_steps = 0;
+  beta[0] = 0.;
+
+  for (int j = 0; j < n_max_steps; j++) {
+
+    /* w = D^-1/2.A.D^-1/2.v */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vt[ii] = d_s[ii]*v[ii];
+
+    cs_matrix_vector_multiply(a, vt, w);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      w[ii] *= d_s[ii];
+
+    alpha[j] = _dot_product(c, w, v);
+
+    const double a_j = alpha[j], b_j = beta[j];
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      w[ii] -= a_j*v[ii] + b_j*v_p[ii];
+
+    beta[j+1] = sqrt(_dot_product_xx(c, w));
+    n_steps = j+1;
+
+    if (beta[j+1] <= 1e-12*CS_ABS(a_j))  /* invariant subspace found */
+      break;
+
+    const double b_inv = 1. / beta[j+1];
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      v_p[ii] = v[ii];
+      v[ii] = w[ii]*b_inv;
+    }
+
+  }
+
+  BFT_FREE(w);
+  BFT_FREE(vt);
+  BFT_FREE(v);
+  BFT_FREE(v_p);
+  BFT_FREE(d_s);
+
+  /* Largest eigenvalue of tridiagonal matrix: Gershgorin bounds,
+     then bisection based on Sturm sequence counts */
+
+  double lo = HUGE_VAL, hi = -HUGE_VAL;
+  for (int i = 0; i < n_steps; i++) {
+    double r = CS_ABS(beta[i]);
+    if (i < n_steps - 1)
+      r += CS_ABS(beta[i+1]);
+    lo = CS_MIN(lo, alpha[i] - r);
+    hi = CS_MAX(hi, alpha[i] + r);
+  }
+
+  for (int k = 0; k < 60 && hi - lo > 1e-6*CS_ABS(hi); k++) {
+    double x = 0.5*(lo + hi);
+    int n_lower = 0;
+    double q = 1.;
+    for (int i = 0; i < n_steps; i++) {
+      double b2 = (i > 0) ? beta[i]*beta[i] : 0.;
+      if (CS_ABS(q) < DBL_MIN)
+        q = DBL_MIN;
+      q = alpha[i] - x - b2/q;
+      if (q < 0)
+        n_lower += 1;
+    }
+    if (n_lower == n_steps)
+      hi = x;
+    else
+      lo = x;
+  }
+
+  return hi;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using a Jacobi-preconditioned Chebyshev
+ * polynomial smoother.
+ *
+ * The polynomial degree is given by the number of iterations, and
+ * each iteration requires only one matrix.vector product, with no
+ * global reduction. The eigenvalue bounds are derived from the largest
+ * eigenvalue of D^-1.A estimated during setup, so as to damp the upper
+ * part of the spectrum.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              --> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_chebyshev(cs_sles_it_t              *c,
+           const cs_matrix_t         *a,
+           cs_lnum_t                  diag_block_size,
+           cs_sles_it_convergence_t  *convergence,
+           const cs_real_t           *rhs,
+           cs_real_t                 *restrict vx_ini,
+           cs_real_t                 *restrict vx,
+           size_t                     aux_size,
+           void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+
+  cs_real_t *_aux_vectors;
+  cs_real_t *restrict rk, *restrict dk, *restrict zk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+    const size_t n_wa = 3;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = (cs_real_t *)aux_vectors;
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    zk = _aux_vectors + wa_size*2;
+  }
+
+  /* Polynomial coefficients */
+
+  const double *eig_bounds = c->setup_data->eig_bounds;
+  const double theta = 0.5*(eig_bounds[1] + eig_bounds[0]);
+  const double delta = 0.5*(eig_bounds[1] - eig_bounds[0]);
+
+  const double sigma = theta / delta;
+  double rho = 1. / sigma;
+
+  /* Initial residual and direction */
+
+  if (vx_ini != vx) {
+    assert(vx_ini == nullptr);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      vx[ii] = 0.;
+      rk[ii] = rhs[ii];
+      dk[ii] = ad_inv[ii]*rk[ii] / theta;
+    }
+  }
+  else {
+    cs_matrix_vector_multiply(a, vx, rk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = rhs[ii] - rk[ii];
+      dk[ii] = ad_inv[ii]*rk[ii] / theta;
+    }
+  }
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 1; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    cs_matrix_vector_multiply(a, dk, zk);
+
+    const double rho_n = 1. / (2.*sigma - rho);
+    const double c_d = rho_n*rho, c_r = 2.*rho_n/delta;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      vx[ii] += dk[ii];
+      rk[ii] -= zk[ii];
+      dk[ii] = c_d*dk[ii] + c_r*ad_inv[ii]*rk[ii];
+    }
+
+    rho = rho_n;
+
+  }
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    vx[ii] += dk[ii];
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
@@ -2125,6 +2407,7 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
   case CS_SLES_TS_F_GAUSS_SEIDEL:
   case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_CHEBYSHEV:
     break;
 
   case CS_SLES_PCG:
@@ -2189,6 +2472,7 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   c->setup_data = NULL;
   c->add_data = NULL;
   c->shared = NULL;
+  c->recycle = NULL;
 
   return c;
 }
@@ -2249,6 +2533,13 @@ cs_multigrid_smoother_setup(void               *context,
     block_nn_inverse = true;
   }
 
+  else if (c->type == CS_SLES_CHEBYSHEV) {
+    /* Force to Jacobi for block matrices */
+    if (diag_block_size > 1)
+      c->type = CS_SLES_JACOBI;
+    block_nn_inverse = true;
+  }
+
   switch (c->type) {
 
   case CS_SLES_PCG:
@@ -2340,6 +2631,15 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _ts_b_gauss_seidel_msr;
     break;
 
+  case CS_SLES_CHEBYSHEV:
+    c->solve = _chebyshev;
+#if defined(HAVE_CUDA)
+    if (on_device) {
+      c->solve = cs_sles_it_cuda_chebyshev;
+    }
+#endif
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -2354,6 +2654,18 @@ cs_multigrid_smoother_setup(void               *context,
   cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size,
                         block_nn_inverse);
 
+  /* Estimate spectrum for polynomial smoother */
+
+  if (c->type == CS_SLES_CHEBYSHEV) {
+    double eig_max = _chebyshev_eig_max(c, a);
+    for (int i = 0; i < 2; i++)
+      c->setup_data->eig_bounds[i] = _chebyshev_eig_ratio[i] * eig_max;
+
+    if (verbosity > 1)
+      bft_printf(_("  Chebyshev smoother eigenvalue bounds: [%g, %g]\n"),
+                 c->setup_data->eig_bounds[0], c->setup_data->eig_bounds[1]);
+  }
+
   /* Now finish */
   assert(c->update_stats == false);
 }
@@ -103,6 +103,7 @@ cs_param_mumps_create(void)
   mumpsp->mem_coef = -1;            /* No additional memory range */
   mumpsp->block_analysis = 0;       /* No clustered analysis */
   mumpsp->ir_steps = 0;             /* No iterative refinement */
+  mumpsp->keep_analysis = false;    /* New analysis at each setup */
 
   return mumpsp;
 }
@@ -133,6 +134,7 @@ cs_param_mumps_copy(const cs_param_mumps_t  *mumpsp)
   cpy->mem_coef = mumpsp->mem_coef;
   cpy->block_analysis = mumpsp->block_analysis;
   cpy->ir_steps = mumpsp->ir_steps;
+  cpy->keep_analysis = mumpsp->keep_analysis;
 
   return cpy;
 }
@@ -252,6 +254,10 @@ cs_param_mumps_log(const char              *name,
     cs_log_printf(CS_LOG_SETUP, "  * %s | Iterative_Refinement:      %d\n",
                   name, CS_ABS(mumpsp->ir_steps));
 
+  if (mumpsp->keep_analysis)
+    cs_log_printf(CS_LOG_SETUP, "  * %s | Keep_Analysis:            %s\n",
+                  name, cs_base_strtf(mumpsp->keep_analysis));
+
   if (fabs(mumpsp->blr_threshold) > FLT_MIN)
     cs_log_printf(CS_LOG_SETUP, "  * %s | BLR_threshold:             %e\n",
                   name, mumpsp->blr_threshold);
@@ -201,6 +201,10 @@ typedef struct {
 
   int     ir_steps;         /*!< Number of steps for the Iterative Refinement */
 
+  bool    keep_analysis;    /*!< Keep the MUMPS instance between setups, and
+                                 skip the analysis step when the sparsity
+                                 pattern of the matrix is unchanged */
+
 } cs_param_mumps_t;
 
 /*============================================================================
@@ -1684,6 +1684,37 @@ cs_param_sles_mumps_advanced(cs_param_sles_t                *slesp,
   mumpsp->advanced_optim = advanced_optim;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether the MUMPS analysis should be kept between successive
+ *        setups. When activated, the MUMPS instance is not freed between
+ *        solves, and only a new factorization is performed if the sparsity
+ *        pattern of the matrix is unchanged. This structure is allocated
+ *        and initialized if needed.
+ *
+ * \param[in, out] slesp          pointer to a cs_param_sles_t structure
+ * \param[in]      keep_analysis  true to keep the analysis when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_param_sles_mumps_keep_analysis(cs_param_sles_t  *slesp,
+                                  bool              keep_analysis)
+{
+  if (slesp == nullptr)
+    return;
+
+  if (slesp->context_param == nullptr)
+    slesp->context_param = cs_param_mumps_create();
+
+  /* One assumes that the existing context structure is related to MUMPS */
+
+  cs_param_mumps_t *mumpsp =
+    static_cast<cs_param_mumps_t *>(slesp->context_param);
+
+  mumpsp->keep_analysis = keep_analysis;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Check the availability of Hypre solvers from the PETSc library
@@ -468,6 +468,23 @@ cs_param_sles_mumps_advanced(cs_param_sles_t                *slesp,
                              cs_param_mumps_memory_usage_t   mem_usage,
                              bool                            advanced_optim);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether the MUMPS analysis should be kept between successive
+ *        setups. When activated, the MUMPS instance is not freed between
+ *        solves, and only a new factorization is performed if the sparsity
+ *        pattern of the matrix is unchanged. This structure is allocated
+ *        and initialized if needed.
+ *
+ * \param[in, out] slesp          pointer to a cs_param_sles_t structure
+ * \param[in]      keep_analysis  true to keep the analysis when possible
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_param_sles_mumps_keep_analysis(cs_param_sles_t  *slesp,
+                                  bool              keep_analysis);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Check the availability of Hypre solvers from the PETSc library
@@ -55,6 +55,7 @@
 #include "cs_array.h"
 #include "cs_blas.h"
 #include "cs_cdo_solve.h"
+#include "cs_dispatch.h"
 #include "cs_log.h"
 #include "cs_parameters.h"
 #include "cs_saddle_system.h"
@@ -153,6 +154,60 @@ _get_id(int  m,
   return j + i*m - (i*(i + 1))/2;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the dispatch context used for the vector operations of a block
+ *        preconditioner. These operations are performed on the device when
+ *        the (1,1)-block matrix is defined on the device.
+ *
+ * \param[in] m11  matrix related to the (1,1)-block (or nullptr)
+ *
+ * \return a dispatch context
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_dispatch_context
+_block_dispatch_context(const cs_matrix_t  *m11)
+{
+  cs_dispatch_context  dctx;
+
+  cs_alloc_mode_t  amode =
+    (m11 != nullptr) ? cs_matrix_get_alloc_mode(m11) : CS_ALLOC_HOST;
+  dctx.set_use_gpu(amode > CS_ALLOC_HOST);
+
+  return dctx;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a product with the unassembled M21 operator may be
+ *        performed on the device (all arrays have to be device-accessible)
+ *
+ * \param[in] m21_adj  adjacency related to the M21 operator
+ * \param[in] m21_val  values associated to the M21 operator
+ * \param[in] x        input array
+ * \param[in] y        resulting array
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_m21_on_device(const cs_adjacency_t  *m21_adj,
+               const cs_real_t       *m21_val,
+               const cs_real_t       *x,
+               const cs_real_t       *y)
+{
+  if (   cs_check_device_ptr(m21_adj->idx) == CS_ALLOC_HOST
+      || cs_check_device_ptr(m21_adj->ids) == CS_ALLOC_HOST
+      || cs_check_device_ptr(m21_val) == CS_ALLOC_HOST
+      || cs_check_device_ptr(x) == CS_ALLOC_HOST
+      || cs_check_device_ptr(y) == CS_ALLOC_HOST)
+    return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the scalar multiplication of a vector split into the x1 and
@@ -174,8 +229,16 @@ _scalar_scaling(cs_saddle_solver_t  *solver,
     static_cast<cs_saddle_solver_context_block_pcd_t *>(solver->context);
   cs_real_t  *x1 = x, *x2 = x + ctx->b11_max_size;
 
-  cs_array_real_scale(solver->n1_scatter_dofs, 1, nullptr, scalar, x1);
-  cs_array_real_scale(solver->n2_scatter_dofs, 1, nullptr, scalar, x2);
+  cs_dispatch_context  dctx = _block_dispatch_context(ctx->m11);
+
+  dctx.parallel_for(solver->n1_scatter_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    x1[i] *= scalar;
+  });
+  dctx.parallel_for(solver->n2_scatter_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    x2[i] *= scalar;
+  });
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -297,13 +360,16 @@ _add_scaled_vector(cs_saddle_solver_t  *solver,
   cs_real_t  *x1 = x, *x2 = x + ctx->b11_max_size;
   const cs_real_t  *y1 = y, *y2 = y + ctx->b11_max_size;
 
-# pragma omp parallel for if (solver->n1_scatter_dofs > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < solver->n1_scatter_dofs; i++)
-    x1[i] += mu*y1[i];
+  cs_dispatch_context  dctx = _block_dispatch_context(ctx->m11);
 
-# pragma omp parallel for if (solver->n2_scatter_dofs > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < solver->n2_scatter_dofs; i++)
+  dctx.parallel_for(solver->n1_scatter_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    x1[i] += mu*y1[i];
+  });
+  dctx.parallel_for(solver->n2_scatter_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
     x2[i] += mu*y2[i];
+  });
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -950,6 +1016,7 @@ _solve_m11_approximation(cs_saddle_solver_t                   *solver,
  *         - Uzawa-CG algorithm
  *
  * \param[in, out] solver       pointer to a saddle-point solver structure
+ * \param[in, out] dctx         dispatch context for vector operations
  * \param[in, out] schur_sles   SLES related to the Schur complement (if needed)
  * \param[in]      schur_mat    matrix for the Schur complement (if needed)
  * \param[in       inv_m22      diagonal inverseof the M22 mass matrix
@@ -963,6 +1030,7 @@ _solve_m11_approximation(cs_saddle_solver_t                   *solver,
 
 static int
 _solve_schur_approximation(cs_saddle_solver_t  *solver,
+                           cs_dispatch_context &dctx,
                            cs_sles_t           *schur_sles,
                            cs_matrix_t         *schur_mat,
                            const cs_real_t     *inv_m22,
@@ -988,11 +1056,12 @@ _solve_schur_approximation(cs_saddle_solver_t  *solver,
   case CS_PARAM_SADDLE_SCHUR_MASS_SCALED:
     assert(inv_m22 != nullptr);
 
-#   pragma omp parallel for if (n2_elts > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
-      z_schur[i2] = inv_m22[i2] * r_schur[i2]; /* TODO: multiply or divide ?
-                                                  Uza:divide
-                                                  Block pcd:multiply */
+    /* TODO: multiply or divide ? Uza:divide, Block pcd:multiply */
+
+    dctx.parallel_for(n2_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+      z_schur[i2] = inv_m22[i2] * r_schur[i2];
+    });
+    dctx.wait();
     break;
 
   default:
@@ -1023,9 +1092,10 @@ _solve_schur_approximation(cs_saddle_solver_t  *solver,
 
         assert(inv_m22 != nullptr);
 
-#       pragma omp parallel for if (n2_elts > CS_THR_MIN)
-        for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
+        dctx.parallel_for(n2_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
           z_schur[i2] = scaling*z_schur[i2] + inv_m22[i2]*r_schur[i2];
+        });
+        dctx.wait();
 
       } /* Hybrid approximations */
 
@@ -1067,6 +1137,8 @@ _diag_schur_pc_apply(cs_saddle_solver_t                   *solver,
 
   assert(solver != nullptr && ctx != nullptr && r != nullptr);
 
+  cs_dispatch_context  dctx = _block_dispatch_context(ctx->m11);
+
   /* 1. Solve M11.z1 = r1
      ==================== */
 
@@ -1081,6 +1153,7 @@ _diag_schur_pc_apply(cs_saddle_solver_t                   *solver,
   cs_real_t  *r2 = r + ctx->b11_max_size;
 
   n_iter += _solve_schur_approximation(solver,
+                                       dctx,
                                        ctx->schur_sles,
                                        ctx->schur_matrix,
                                        ctx->m22_mass_diag,  /* inv_m22 */
@@ -1122,6 +1195,8 @@ _lower_schur_pc_apply(cs_saddle_solver_t                   *solver,
   assert(solver != nullptr && ctx != nullptr && r != nullptr);
   assert(pc_wsp != nullptr);
 
+  cs_dispatch_context  dctx = _block_dispatch_context(ctx->m11);
+
   /* 1. Solve m11 z1 = r1
      ==================== */
 
@@ -1139,9 +1214,10 @@ _lower_schur_pc_apply(cs_saddle_solver_t                   *solver,
                            z, ctx->m21_adj, ctx->m21_val,
                            r2_tilda);
 
-# pragma omp parallel for if (solver->n2_scatter_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < solver->n2_scatter_dofs; i2++)
+  dctx.parallel_for(solver->n2_scatter_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
     r2_tilda[i2] = r2[i2] - r2_tilda[i2];
+  });
+  dctx.wait();
 
   /* 3. Solve S z2 = r2_tilda (S -> Schur approximation for the m22 block)
      ===================================================================== */
@@ -1149,6 +1225,7 @@ _lower_schur_pc_apply(cs_saddle_solver_t                   *solver,
   cs_real_t  *z2 = z + ctx->b11_max_size;
 
   n_iter += _solve_schur_approximation(solver,
+                                       dctx,
                                        ctx->schur_sles,
                                        ctx->schur_matrix,
                                        ctx->m22_mass_diag,  /* inv_m22 */
@@ -1191,6 +1268,8 @@ _upper_schur_pc_apply(cs_saddle_solver_t                   *solver,
   assert(solver != nullptr && ctx != nullptr && r != nullptr);
   assert(pc_wsp != nullptr);
 
+  cs_dispatch_context  dctx = _block_dispatch_context(ctx->m11);
+
   cs_real_t  *z2 = z + ctx->b11_max_size;
   cs_real_t  *r2 = r + ctx->b11_max_size;
 
@@ -1198,6 +1277,7 @@ _upper_schur_pc_apply(cs_saddle_solver_t                   *solver,
      =============================================================== */
 
   n_iter += _solve_schur_approximation(solver,
+                                       dctx,
                                        ctx->schur_sles,
                                        ctx->schur_matrix,
                                        ctx->m22_mass_diag,  /* inv_m22 */
@@ -1223,9 +1303,10 @@ _upper_schur_pc_apply(cs_saddle_solver_t                   *solver,
                          1, false, CS_REAL_TYPE, /* stride, interlaced */
                          r1_tilda);
 
-# pragma omp parallel for if (solver->n1_scatter_dofs > CS_THR_MIN)
-  for (cs_lnum_t i1 = 0; i1 < solver->n1_scatter_dofs; i1++)
+  dctx.parallel_for(solver->n1_scatter_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
     r1_tilda[i1] = r[i1] - r1_tilda[i1];
+  });
+  dctx.wait();
 
   /* 3. Solve m11 z1 = r1_tilda
      ========================== */
@@ -1274,6 +1355,8 @@ _sgs_schur_pc_apply(cs_saddle_solver_t                   *solver,
   const cs_range_set_t  *rset = ctx->b11_range_set;
   const cs_matrix_t  *m11 = ctx->m11;
 
+  cs_dispatch_context  dctx = _block_dispatch_context(m11);
+
   /* 1. Solve m11 z1_hat = r1
      ======================== */
 
@@ -1293,9 +1376,10 @@ _sgs_schur_pc_apply(cs_saddle_solver_t                   *solver,
 
   const cs_real_t  *r2 = r + ctx->b11_max_size;
 
-# pragma omp parallel for if (n2_elts > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
+  dctx.parallel_for(n2_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
     r2_hat[i2] = r2_hat[i2] - r2[i2];
+  });
+  dctx.wait();
 
   /* 3. Solve S z2 = r2_hat (S -> Schur approximation for the m22 block)
      =================================================================== */
@@ -1303,6 +1387,7 @@ _sgs_schur_pc_apply(cs_saddle_solver_t                   *solver,
   cs_real_t  *z2 = z + ctx->b11_max_size;
 
   n_iter += _solve_schur_approximation(solver,
+                                       dctx,
                                        ctx->schur_sles,
                                        ctx->schur_matrix,
                                        ctx->m22_mass_diag,  /* inv_m22 */
@@ -1343,9 +1428,10 @@ _sgs_schur_pc_apply(cs_saddle_solver_t                   *solver,
 
   /* Last update z1 = -z1 + 2 z1_hat (still in gather wiew for both arrays) */
 
-# pragma omp parallel for if (rset->n_elts[0] > CS_THR_MIN)
-  for (cs_lnum_t i1 = 0; i1 < rset->n_elts[0]; i1++)
+  dctx.parallel_for(rset->n_elts[0], [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
     z[i1] = 2*z1_hat[i1] - z[i1];
+  });
+  dctx.wait();
 
   /* Move back: gather --> scatter view */
 
@@ -1391,6 +1477,8 @@ _uza_schur_pc_apply(cs_saddle_solver_t                   *solver,
   const cs_lnum_t  n2_elts = solver->n2_scatter_dofs;
   const cs_range_set_t  *rset = ctx->b11_range_set;
 
+  cs_dispatch_context  dctx = _block_dispatch_context(ctx->m11);
+
   /* 1. Solve m11 z1 = r1
      ==================== */
 
@@ -1408,9 +1496,10 @@ _uza_schur_pc_apply(cs_saddle_solver_t                   *solver,
 
   const cs_real_t  *r2 = r + ctx->b11_max_size;
 
-# pragma omp parallel for if (n2_elts > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
+  dctx.parallel_for(n2_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
     r2_hat[i2] = r2[i2] - r2_hat[i2];
+  });
+  dctx.wait();
 
   /* 3. Solve S z2 = r2_hat (S -> Schur approximation for the m22 block)
      =================================================================== */
@@ -1418,6 +1507,7 @@ _uza_schur_pc_apply(cs_saddle_solver_t                   *solver,
   cs_real_t  *z2 = z + ctx->b11_max_size;
 
   n_iter += _solve_schur_approximation(solver,
+                                       dctx,
                                        ctx->schur_sles,
                                        ctx->schur_matrix,
                                        ctx->m22_mass_diag,  /* inv_m22 */
@@ -1467,13 +1557,13 @@ _uza_schur_pc_apply(cs_saddle_solver_t                   *solver,
   assert(fabs(denum)>0);
   double zeta =  cs_dot(n2_elts, z2, r2_hat)/denum;
 
-# pragma omp parallel for if (n1_elts > CS_THR_MIN)
-  for (cs_lnum_t i1 = 0; i1 < n1_elts; i1++)
+  dctx.parallel_for(n1_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
     z[i1] += zeta * z1_tilda[i1];
-
-# pragma omp parallel for if (n2_elts > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
+  });
+  dctx.parallel_for(n2_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
     z2[i2] *= -zeta;
+  });
+  dctx.wait();
 
   return n_iter;
 }
@@ -1550,6 +1640,11 @@ _set_pc_by_block(const cs_saddle_solver_t                   *solver,
     bft_error(__FILE__, __LINE__, 0,
               "%s: Invalid Schur approximation\n", __func__);
 
+  /* The workspace is accessible from the device if the (1,1)-block is */
+
+  const cs_alloc_mode_t  amode =
+    (ctx->m11 != nullptr) ? cs_matrix_get_alloc_mode(ctx->m11) : CS_ALLOC_HOST;
+
   switch (saddlep->precond) {
 
   case CS_PARAM_SADDLE_PRECOND_NONE:
@@ -1560,25 +1655,25 @@ _set_pc_by_block(const cs_saddle_solver_t                   *solver,
 
   case CS_PARAM_SADDLE_PRECOND_LOWER:
     *wsp_size = ctx->b22_max_size;
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    CS_MALLOC_HD(*p_wsp, *wsp_size, cs_real_t, amode);
 
     return _lower_schur_pc_apply;
 
   case CS_PARAM_SADDLE_PRECOND_SGS:
     *wsp_size = 2*ctx->b11_max_size;
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    CS_MALLOC_HD(*p_wsp, *wsp_size, cs_real_t, amode);
 
     return _sgs_schur_pc_apply;
 
   case CS_PARAM_SADDLE_PRECOND_UPPER:
     *wsp_size = ctx->b11_max_size;
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    CS_MALLOC_HD(*p_wsp, *wsp_size, cs_real_t, amode);
 
     return _upper_schur_pc_apply;
 
   case CS_PARAM_SADDLE_PRECOND_UZAWA:
     *wsp_size = 2*(ctx->b11_max_size + ctx->b22_max_size);
-    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+    CS_MALLOC_HD(*p_wsp, *wsp_size, cs_real_t, amode);
 
     return _uza_schur_pc_apply;
 
@@ -2496,25 +2591,28 @@ cs_saddle_solver_m12_multiply_vector(cs_lnum_t              n2_dofs,
 {
   assert(n2_dofs == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+  const cs_lnum_t  *idx = m21_adj->idx, *ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  dctx.set_use_gpu(_m21_on_device(m21_adj, m21_val, x2, m12x2));
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     const cs_real_t  _x2 = x2[i2];
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++) {
+    for (cs_lnum_t j = idx[i2]; j < idx[i2+1]; j++) {
 
       const cs_real_t  *m21_vals = m21_val + 3*j;
-      cs_real_t  *_m12x2 = m12x2 + 3*m21_adj->ids[j];
+      const cs_real_t  contrib[3] = {m21_vals[0] * _x2,
+                                     m21_vals[1] * _x2,
+                                     m21_vals[2] * _x2};
 
-#     pragma omp critical
-      {
-        _m12x2[0] += m21_vals[0] * _x2;
-        _m12x2[1] += m21_vals[1] * _x2;
-        _m12x2[2] += m21_vals[2] * _x2;
-      }
+      cs_dispatch_sum<3>(m12x2 + 3*ids[j], contrib, CS_DISPATCH_SUM_ATOMIC);
 
     } /* Loop on x1 elements associated to a given x2 DoF */
 
-  } /* Loop on x2 DoFs */
+  }); /* Loop on x2 DoFs */
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2543,15 +2641,21 @@ cs_saddle_solver_m12_multiply_scalar(cs_lnum_t              n2_elts,
 {
   assert(n2_elts == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_elts > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++) {
+  const cs_lnum_t  *idx = m21_adj->idx, *ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  dctx.set_use_gpu(_m21_on_device(m21_adj, m21_val, x2, m12x2));
+
+  dctx.parallel_for(n2_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     const cs_real_t  _x2 = x2[i2];
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
-#     pragma omp atomic
-      m12x2[m21_adj->ids[j]] += _x2 * m21_val[j];
+    for (cs_lnum_t j = idx[i2]; j < idx[i2+1]; j++)
+      cs_dispatch_sum(m12x2 + ids[j], _x2 * m21_val[j],
+                      CS_DISPATCH_SUM_ATOMIC);
+
+  }); /* Loop on x2 DoFs */
 
-  } /* Loop on x2 DoFs */
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2577,16 +2681,22 @@ cs_saddle_solver_m21_multiply_vector(cs_lnum_t              n2_dofs,
 {
   assert(n2_dofs == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+  const cs_lnum_t  *idx = m21_adj->idx, *ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  dctx.set_use_gpu(_m21_on_device(m21_adj, m21_val, x1, m21x1));
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     cs_real_t  _m21x1 = 0.;
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
-      _m21x1 += cs_math_3_dot_product(m21_val + 3*j, x1 + 3*m21_adj->ids[j]);
+    for (cs_lnum_t j = idx[i2]; j < idx[i2+1]; j++)
+      _m21x1 += cs_math_3_dot_product(m21_val + 3*j, x1 + 3*ids[j]);
 
     m21x1[i2] = _m21x1;
 
-  } /* Loop on x2 elements */
+  }); /* Loop on x2 elements */
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2612,16 +2722,22 @@ cs_saddle_solver_m21_multiply_scalar(cs_lnum_t              n2_dofs,
 {
   assert(n2_dofs == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+  const cs_lnum_t  *idx = m21_adj->idx, *ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  dctx.set_use_gpu(_m21_on_device(m21_adj, m21_val, x1, m21x1));
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     cs_real_t  _m21x1 = 0.;
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
-      _m21x1 += m21_val[j] * x1[m21_adj->ids[j]];
+    for (cs_lnum_t j = idx[i2]; j < idx[i2+1]; j++)
+      _m21x1 += m21_val[j] * x1[ids[j]];
 
     m21x1[i2] = _m21x1;
 
-  } /* Loop on x2 elements */
+  }); /* Loop on x2 elements */
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2863,7 +2979,7 @@ cs_saddle_solver_context_block_pcd_clean(
 
   BFT_FREE(ctx->schur_diag);
   BFT_FREE(ctx->schur_xtra);
-  BFT_FREE(ctx->m22_mass_diag);
+  CS_FREE(ctx->m22_mass_diag);
   BFT_FREE(ctx->m11_inv_diag);
 }
 
@@ -4088,7 +4204,7 @@ cs_saddle_solver_minres(cs_saddle_solver_t  *solver,
   /* Free temporary workspace */
 
   BFT_FREE(wsp);
-  BFT_FREE(pc_wsp);
+  CS_FREE(pc_wsp);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4318,7 +4434,7 @@ cs_saddle_solver_gcr(cs_saddle_solver_t  *solver,
   BFT_FREE(gamma);
   BFT_FREE(alpha);
   BFT_FREE(wsp);
-  BFT_FREE(pc_wsp);
+  CS_FREE(pc_wsp);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4748,9 +4864,12 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
   for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
     rk[i2] = rhs2[i2] - rk[i2];
 
-  /* Solve S.zk = rk */
+  /* Solve S.zk = rk (vector operations are performed on the host) */
+
+  cs_dispatch_context  dctx = _block_dispatch_context(nullptr);
 
   n_iter = _solve_schur_approximation(solver,
+                                      dctx,
                                       ctx->schur_sles,
                                       ctx->schur_matrix,
                                       ctx->inv_m22,
@@ -4824,6 +4943,7 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
   /* Solve the Schur complement approximation: smat.zk = dwk */
 
     n_iter = _solve_schur_approximation(solver,
+                                        dctx,
                                         ctx->schur_sles,
                                         ctx->schur_matrix,
                                         ctx->inv_m22,        /* inv_m22 */
@@ -4984,12 +5104,15 @@ cs_saddle_solver_simple(cs_saddle_solver_t  *solver,
   for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
     rk[i2] = rhs2[i2] + rk[i2];
 
-  /* Solve S.dx2 = rk */
+  /* Solve S.dx2 = rk (vector operations are performed on the host) */
+
+  cs_dispatch_context  dctx = _block_dispatch_context(nullptr);
 
   cs_real_t *dx2 = nullptr;
   BFT_MALLOC(dx2, n2_elts, cs_real_t);
 
   n_iter = _solve_schur_approximation(solver,
+                                      dctx,
                                       ctx->schur_sles,
                                       ctx->schur_matrix,
                                       ctx->inv_m22,
@@ -51,6 +51,7 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_comm_stats.h"
 #include "cs_field.h"
 #include "cs_log.h"
 #include "cs_halo.h"
@@ -62,9 +63,12 @@
 #include "cs_matrix_util.h"
 #include "cs_parall.h"
 #include "cs_post.h"
+#include "cs_profiling.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
 #include "cs_time_step.h"
+#include "cs_sles_it.h"
+#include "cs_sles_telemetry.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -946,6 +950,12 @@ cs_sles_initialize(void)
                                           "linear_solvers",
                                           "linear solvers");
   }
+
+  const char *s = getenv("CS_SLES_TELEMETRY");
+  if (s != nullptr) {
+    if (strlen(s) > 0)
+      cs_sles_telemetry_enable(s);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -984,6 +994,8 @@ cs_sles_finalize(void)
   }
 
   cs_map_name_to_id_destroy(&_type_name_map);
+
+  cs_sles_telemetry_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1641,6 +1653,11 @@ cs_sles_setup(cs_sles_t          *sles,
   if (sles->setup_func != nullptr) {
     const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
     sles->setup_func(sles->context, sles_name, a, sles->verbosity);
+    if (cs_sles_telemetry_is_active()) {
+      cs_timer_t t_s = cs_timer_time();
+      cs_sles_telemetry_add_setup_time(  (t_s.sec - t0.sec)
+                                       + (t_s.nsec - t0.nsec)*1e-9);
+    }
   }
 
   /* Prepare residual postprocessing if required */
@@ -1718,6 +1735,10 @@ cs_sles_solve(cs_sles_t           *sles,
 
   const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
 
+  cs_profiling_range_push("sles_solve", sles_name);
+  const char *prev_comm_ctx = cs_comm_stats_set_context(sles_name);
+  cs_sles_telemetry_solve_begin(sles->context);
+
 #if 0
   /* Dump linear system to file (for experimenting with external tools) */
   cs_matrix_dump_linear_system(a, rhs, sles_name);
@@ -1813,11 +1834,144 @@ cs_sles_solve(cs_sles_t           *sles,
     BFT_FREE(resr);
   }
 
+  cs_profiling_range_pop("sles_solve");
+  cs_comm_stats_set_context(prev_comm_ctx);
+
   cs_timer_stats_switch(t_top_id);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
 
+  cs_sles_telemetry_solve_end(sles_name,
+                              cs_sles_get_type(sles),
+                              a,
+                              state,
+                              *n_iter,
+                              precision,
+                              r_norm,
+                              *residual,
+                              (t1.sec - t0.sec) + (t1.nsec - t0.nsec)*1e-9);
+
+  return state;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sparse linear system resolution for a set of independent
+ *        systems sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so value i of system k
+ * is found at position i*n_vecs + k; vx must thus be sized for
+ * n_cols_ext*n_vecs values.
+ *
+ * When the solver is a native iterative solver which allows it
+ * (see \ref cs_sles_it_solve_multi), systems are solved simultaneously,
+ * amortizing matrix coefficient loads and global reductions over all
+ * right-hand sides. Otherwise, or if the grouped solve does not
+ * converge, systems are solved one by one using \ref cs_sles_solve
+ * (so the usual error handler applies).
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       n_vecs         number of systems
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residual normalization, per system
+ * \param[out]      n_iter         number of iterations, per system
+ * \param[out]      residual       residual, per system
+ * \param[in]       rhs            right hand sides (interleaved)
+ * \param[in, out]  vx             system solutions (interleaved)
+ *
+ * \return  convergence state of the least converged system
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    int                  n_vecs,
+                    double               precision,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residual[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx)
+{
+  cs_sles_convergence_state_t state = CS_SLES_CONVERGED;
+
+  if (n_vecs < 1)
+    return state;
+
+  if (sles->context == nullptr)
+    _cs_sles_define_default(sles->f_id, sles->name, a);
+
+  /* Grouped solve when possible */
+
+  if (sles->solve_func == cs_sles_it_solve) {
+
+    cs_timer_t t0 = cs_timer_time();
+    int t_top_id = cs_timer_stats_switch(_sles_stat_id);
+
+    sles->n_calls += 1;
+
+    const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
+
+    state = cs_sles_it_solve_multi(sles->context,
+                                   sles_name,
+                                   a,
+                                   n_vecs,
+                                   sles->verbosity,
+                                   precision,
+                                   r_norm,
+                                   n_iter,
+                                   residual,
+                                   rhs,
+                                   vx);
+
+    cs_timer_stats_switch(t_top_id);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
+
+    if (state >= CS_SLES_MAX_ITERATION)
+      return state;
+
+  }
+
+  /* Otherwise, solve systems one by one */
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+
+  cs_real_t *_rhs, *_vx;
+  BFT_MALLOC(_rhs, n_rows, cs_real_t);
+  BFT_MALLOC(_vx, n_cols, cs_real_t);
+
+  state = CS_SLES_CONVERGED;
+
+  for (int k = 0; k < n_vecs; k++) {
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      _rhs[ii] = rhs[ii*n_vecs + k];
+      _vx[ii] = vx[ii*n_vecs + k];
+    }
+
+    cs_sles_convergence_state_t _state
+      = cs_sles_solve(sles, a, precision, r_norm[k], n_iter + k,
+                      residual + k, _rhs, _vx, 0, nullptr);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii*n_vecs + k] = _vx[ii];
+
+    if (_state < state)
+      state = _state;
+
+  }
+
+  BFT_FREE(_vx);
+  BFT_FREE(_rhs);
+
   return state;
 }
 
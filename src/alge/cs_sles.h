@@ -697,6 +697,47 @@ cs_sles_solve(cs_sles_t           *sles,
               size_t               aux_size,
               void                *aux_vectors);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sparse linear system resolution for a set of independent
+ *        systems sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so value i of system k
+ * is found at position i*n_vecs + k; vx must thus be sized for
+ * n_cols_ext*n_vecs values.
+ *
+ * When the solver is a native iterative solver which allows it
+ * (see \ref cs_sles_it_solve_multi), systems are solved simultaneously,
+ * amortizing matrix coefficient loads and global reductions over all
+ * right-hand sides. Otherwise, or if the grouped solve does not
+ * converge, systems are solved one by one using \ref cs_sles_solve
+ * (so the usual error handler applies).
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       n_vecs         number of systems
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residual normalization, per system
+ * \param[out]      n_iter         number of iterations, per system
+ * \param[out]      residual       residual, per system
+ * \param[in]       rhs            right hand sides (interleaved)
+ * \param[in, out]  vx             system solutions (interleaved)
+ *
+ * \return  convergence state of the least converged system
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    int                  n_vecs,
+                    double               precision,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residual[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Free sparse linear equation solver setup.
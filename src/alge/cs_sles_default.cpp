@@ -52,6 +52,7 @@
 #include "cs_base.h"
 #include "cs_field.h"
 #include "cs_field_default.h"
+#include "cs_file.h"
 #include "cs_grid.h"
 #include "cs_halo.h"
 #include "cs_internal_coupling.h"
@@ -63,6 +64,7 @@
 #include "cs_matrix_default.h"
 #include "cs_matrix_util.h"
 #include "cs_multigrid.h"
+#include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_sles.h"
 #include "cs_sles_it.h"
@@ -95,10 +97,44 @@ BEGIN_C_DECLS
 
 #define CS_SLES_DEFAULT_N_SETUPS 2  /* Number of concurrent setups allowed */
 
+#define CS_SLES_AUTOTUNE_N_MAX 8    /* Maximum candidates per system type */
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
 
+/* Candidate solver configuration for autotuning */
+
+typedef struct {
+
+  const char           *name;       /* Configuration name (used in file) */
+  cs_sles_it_type_t     it_type;    /* Iterative solver type, or
+                                       CS_SLES_N_IT_TYPES for multigrid */
+  int                   multigrid;  /* 0: none; 1: preconditioner;
+                                       2: solver */
+  cs_multigrid_type_t   mg_type;    /* Multigrid cycle type */
+  int                   n_smooth;   /* Descent and ascent smoother
+                                       iterations, or 0 for default */
+
+} _autotune_candidate_t;
+
+/* Autotuning state for a given field's system */
+
+typedef struct {
+
+  bool      symmetric;                         /* Candidate set */
+  int       candidate;                         /* Current candidate,
+                                                  or -1 if not tuned */
+  int       n_solves;                          /* Solves with current
+                                                  candidate */
+  bool      tuned;                             /* Trials complete */
+  bool      apply;                             /* Candidate must be
+                                                  (re)defined */
+  double    wtime[CS_SLES_AUTOTUNE_N_MAX];    /* Cumulative wall-clock time
+                                                  per candidate */
+
+} _autotune_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -111,6 +147,36 @@ static const int _poly_degree_default = 0;
 static const int _n_max_iter_default = 10000;
 static const int _n_max_iter_default_jacobi = 100;
 
+/* Autotuning candidates and state */
+
+static const _autotune_candidate_t _autotune_sym[] = {
+  {"fcg_mg_v",     CS_SLES_FCG, 1, CS_MULTIGRID_V_CYCLE, 0},
+  {"fcg_mg_v_s1",  CS_SLES_FCG, 1, CS_MULTIGRID_V_CYCLE, 1},
+  {"fcg_mg_k",     CS_SLES_FCG, 1, CS_MULTIGRID_K_CYCLE, 0},
+  {"fcg_mg_k_hpc", CS_SLES_FCG, 1, CS_MULTIGRID_K_CYCLE_HPC, 0},
+  {"mg_v",         CS_SLES_N_IT_TYPES, 2, CS_MULTIGRID_V_CYCLE, 0},
+  {"pcg_jacobi",   CS_SLES_PCG, 0, CS_MULTIGRID_N_TYPES, 0}
+};
+
+static const _autotune_candidate_t _autotune_nsym[] = {
+  {"p_sym_gs",     CS_SLES_P_SYM_GAUSS_SEIDEL, 0, CS_MULTIGRID_N_TYPES, 0},
+  {"bicgstab",     CS_SLES_BICGSTAB, 0, CS_MULTIGRID_N_TYPES, 0},
+  {"gcr",          CS_SLES_GCR, 0, CS_MULTIGRID_N_TYPES, 0},
+  {"gmres",        CS_SLES_GMRES, 0, CS_MULTIGRID_N_TYPES, 0}
+};
+
+static const int _autotune_n_sym
+  = sizeof(_autotune_sym) / sizeof(_autotune_candidate_t);
+static const int _autotune_n_nsym
+  = sizeof(_autotune_nsym) / sizeof(_autotune_candidate_t);
+
+static const char _autotune_input[] = "restart/sles_autotune";
+static const char _autotune_output[] = "checkpoint/sles_autotune";
+
+static int           _autotune_n_solves = 0;
+static int           _autotune_n_fields = 0;
+static _autotune_t  *_autotune = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -134,6 +200,7 @@ _sles_default_native(int                f_id,
                      bool               symmetric)
 {
   int multigrid = 0;
+  int mg_reuse_max = 0;
   cs_sles_it_type_t sles_it_type = CS_SLES_N_IT_TYPES;
   int n_max_iter = _n_max_iter_default;
 
@@ -191,6 +258,25 @@ _sles_default_native(int                f_id,
       sles_it_type = CS_SLES_FCG;
       multigrid = 2;
     }
+    /* Electric and magnetic potentials (cs_elec_model.cpp): pure diffusion
+       with slowly varying conductivity, so coarse grids may be kept from
+       one time step to the next, only refreshing their coefficients */
+    else if (   !strcmp(f->name, "elec_pot_r")
+             || !strcmp(f->name, "elec_pot_i")
+             || !strcmp(f->name, "vec_potential")) {
+      sles_it_type = CS_SLES_FCG;
+      multigrid = 1;
+      mg_reuse_max = 10;
+    }
+    /* ALE mesh velocity (cs_ale.cpp): pure diffusion solved at each time
+       step on a mesh whose connectivity does not change, so coarse grids
+       may also be kept, as the solve already starts from the previous
+       mesh velocity */
+    else if (!strcmp(f->name, "mesh_velocity")) {
+      sles_it_type = CS_SLES_FCG;
+      multigrid = 1;
+      mg_reuse_max = 10;
+    }
   }
 
   /* Final default */
@@ -240,12 +326,21 @@ _sles_default_native(int                f_id,
                                           -1, /* poly_degree */
                                           n_max_iter);
       cs_sles_pc_t *pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
+      if (mg_reuse_max > 0)
+        cs_multigrid_set_reuse
+          (static_cast<cs_multigrid_t *>(cs_sles_pc_get_context(pc)),
+           mg_reuse_max,
+           1.5);
       cs_sles_it_transfer_pc(c, &pc);
       cs_sles_t *sc = cs_sles_find(f_id, name);
       cs_sles_set_error_handler(sc, cs_sles_default_error);
     }
-    else
-      cs_multigrid_define(f_id, name, CS_MULTIGRID_V_CYCLE);
+    else {
+      cs_multigrid_t *mg
+        = cs_multigrid_define(f_id, name, CS_MULTIGRID_V_CYCLE);
+      if (mg_reuse_max > 0)
+        cs_multigrid_set_reuse(mg, mg_reuse_max, 1.5);
+    }
 
   }
   else if (multigrid == 2)
@@ -508,6 +603,282 @@ _sles_setup_matrix_by_assembler(int               f_id,
   _matrix_setup[setup_id][1] = a; /* so it is freed later */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return autotuning candidates array and size for a system type.
+ *
+ * \param[in]   symmetric     indicates if matrix is symmetric
+ * \param[out]  n_candidates  number of candidates
+ *
+ * \return  pointer to candidates array
+ */
+/*----------------------------------------------------------------------------*/
+
+static const _autotune_candidate_t *
+_autotune_candidates(bool   symmetric,
+                     int   *n_candidates)
+{
+  if (symmetric) {
+    *n_candidates = _autotune_n_sym;
+    return _autotune_sym;
+  }
+  else {
+    *n_candidates = _autotune_n_nsym;
+    return _autotune_nsym;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a field's solver based on an autotuning candidate.
+ *
+ * \param[in]  f_id  associated field id
+ * \param[in]  at    associated autotuning state
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_autotune_define(int                 f_id,
+                 const _autotune_t  *at)
+{
+  int n_candidates = 0;
+  const _autotune_candidate_t *c
+    = _autotune_candidates(at->symmetric, &n_candidates) + at->candidate;
+
+  cs_sles_it_type_t it_type = c->it_type;
+
+  /* Gauss-Seidel variants are not available on device */
+
+  if (   cs_get_device_id() > -1
+      && it_type == CS_SLES_P_SYM_GAUSS_SEIDEL)
+    it_type = CS_SLES_JACOBI;
+
+  cs_multigrid_t *mg = nullptr;
+
+  if (c->multigrid == 1) {
+    cs_sles_it_t *sc = cs_sles_it_define(f_id,
+                                         nullptr,
+                                         it_type,
+                                         -1, /* poly_degree */
+                                         _n_max_iter_default);
+    cs_sles_pc_t *pc = cs_multigrid_pc_create(c->mg_type);
+    mg = static_cast<cs_multigrid_t *>(cs_sles_pc_get_context(pc));
+    cs_sles_it_transfer_pc(sc, &pc);
+    cs_sles_set_error_handler(cs_sles_find(f_id, nullptr),
+                              cs_sles_default_error);
+  }
+  else if (c->multigrid == 2)
+    mg = cs_multigrid_define(f_id, nullptr, c->mg_type);
+
+  else {
+    cs_sles_it_t *sc = cs_sles_it_define(f_id,
+                                         nullptr,
+                                         it_type,
+                                         _poly_degree_default,
+                                         _n_max_iter_default);
+    if (it_type == CS_SLES_JACOBI || it_type == CS_SLES_P_SYM_GAUSS_SEIDEL) {
+      cs_sles_it_set_fallback_threshold(sc,
+                                        CS_SLES_ITERATING,
+                                        _n_max_iter_default);
+      int n_fallback_iter = _n_max_iter_default_jacobi;
+      if (it_type == CS_SLES_JACOBI)
+        n_fallback_iter *= 2;
+      cs_sles_it_set_n_max_iter(sc, n_fallback_iter);
+    }
+  }
+
+  if (mg != nullptr && c->n_smooth > 0)
+    cs_multigrid_set_solver_options
+      (mg,
+       CS_SLES_PCG, CS_SLES_PCG, CS_SLES_PCG,
+       100,          /* n max cycles */
+       c->n_smooth,  /* n max iter for descent */
+       c->n_smooth,  /* n max iter for ascent */
+       500,
+       0, 0, 0,      /* precond degree */
+       1, 1, 1);     /* precision multiplier */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read previous autotuning results.
+ *
+ * Each line of the file contains a field name and the name of the
+ * selected candidate. The file is read on rank 0 and broadcast.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_autotune_read(void)
+{
+  int n_chars = 0;
+  char *buf = nullptr;
+
+  if (cs_glob_rank_id < 1 && cs_file_isreg(_autotune_input)) {
+    FILE *fp = fopen(_autotune_input, "r");
+    if (fp != nullptr) {
+      fseek(fp, 0, SEEK_END);
+      n_chars = ftell(fp);
+      fseek(fp, 0, SEEK_SET);
+      BFT_MALLOC(buf, n_chars + 1, char);
+      n_chars = fread(buf, 1, n_chars, fp);
+      buf[n_chars] = '\0';
+      fclose(fp);
+    }
+  }
+
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &n_chars);
+  if (n_chars < 1) {
+    BFT_FREE(buf);
+    return;
+  }
+
+  if (buf == nullptr)
+    BFT_MALLOC(buf, n_chars + 1, char);
+  cs_parall_bcast(0, n_chars + 1, CS_CHAR, buf);
+
+  char *line = strtok(buf, "\n");
+  while (line != nullptr) {
+    char f_name[128], c_name[64];
+    if (line[0] != '#' && sscanf(line, "%127s %63s", f_name, c_name) == 2) {
+      const cs_field_t *f = cs_field_by_name_try(f_name);
+      if (f != nullptr && f->id < _autotune_n_fields) {
+        _autotune_t *at = _autotune + f->id;
+        int n_candidates = 0;
+        const _autotune_candidate_t *c
+          = _autotune_candidates(at->symmetric, &n_candidates);
+        for (int i = 0; i < n_candidates && at->candidate > -1; i++) {
+          if (strcmp(c[i].name, c_name) == 0) {
+            at->candidate = i;
+            at->tuned = true;
+            at->apply = true;
+          }
+        }
+      }
+    }
+    line = strtok(nullptr, "\n");
+  }
+
+  BFT_FREE(buf);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write autotuning results for use by subsequent runs.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_autotune_write(void)
+{
+  if (cs_glob_rank_id > 0)
+    return;
+
+  int n_tuned = 0;
+  for (int f_id = 0; f_id < _autotune_n_fields; f_id++) {
+    if (_autotune[f_id].tuned)
+      n_tuned++;
+  }
+  if (n_tuned == 0)
+    return;
+
+  if (cs_file_mkdir_default("checkpoint") != 0)
+    return;
+
+  FILE *fp = fopen(_autotune_output, "w");
+  if (fp == nullptr) {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Unable to write linear solver autotuning file \"%s\".\n"),
+               _autotune_output);
+    return;
+  }
+
+  fprintf(fp, "# field_name solver_configuration\n");
+
+  for (int f_id = 0; f_id < _autotune_n_fields; f_id++) {
+    const _autotune_t *at = _autotune + f_id;
+    if (at->tuned) {
+      int n_candidates = 0;
+      const _autotune_candidate_t *c
+        = _autotune_candidates(at->symmetric, &n_candidates);
+      fprintf(fp, "%s %s\n",
+              cs_field_by_id(f_id)->name, c[at->candidate].name);
+    }
+  }
+
+  fclose(fp);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update autotuning state after a solve.
+ *
+ * \param[in]  f_id    associated field id
+ * \param[in]  cvg     convergence state
+ * \param[in]  wtime   wall-clock time of solve (including setup)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_autotune_update(int                          f_id,
+                 cs_sles_convergence_state_t  cvg,
+                 double                       wtime)
+{
+  _autotune_t *at = _autotune + f_id;
+
+  int n_candidates = 0;
+  const _autotune_candidate_t *c
+    = _autotune_candidates(at->symmetric, &n_candidates);
+
+  /* Non-converging candidates are discarded; the convergence state
+     is the same on all ranks, so this does not need synchronization. */
+
+  if (cvg < CS_SLES_CONVERGED)
+    at->wtime[at->candidate] = HUGE_VAL;
+  else
+    at->wtime[at->candidate] += wtime;
+
+  at->n_solves += 1;
+  if (at->n_solves < _autotune_n_solves && cvg >= CS_SLES_CONVERGED)
+    return;
+
+  at->n_solves = 0;
+  at->apply = true;
+
+  if (at->candidate + 1 < n_candidates) {
+    at->candidate += 1;
+    return;
+  }
+
+  /* All candidates tried: select fastest (based on slowest rank) */
+
+  cs_parall_max(n_candidates, CS_DOUBLE, at->wtime);
+
+  int c_id = 0;
+  for (int i = 1; i < n_candidates; i++) {
+    if (at->wtime[i] < at->wtime[c_id])
+      c_id = i;
+  }
+
+  at->candidate = c_id;
+  at->tuned = true;
+
+  const cs_field_t *f = cs_field_by_id(f_id);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  "Linear solver autotuning for \"%s\" (%d solves each):\n"),
+                f->name, _autotune_n_solves);
+  for (int i = 0; i < n_candidates; i++) {
+    if (at->wtime[i] < HUGE_VAL)
+      cs_log_printf(CS_LOG_DEFAULT, "  %c %-14s %12.5e s\n",
+                    (i == c_id) ? '*' : ' ', c[i].name, at->wtime[i]);
+    else
+      cs_log_printf(CS_LOG_DEFAULT, "    %-14s %12s\n",
+                    c[i].name, _("failed"));
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -555,6 +926,21 @@ cs_sles_default_setup(void)
 
   const int n_fields = cs_field_n_fields();
 
+  if (_autotune_n_solves > 0) {
+    _autotune_n_fields = n_fields;
+    BFT_REALLOC(_autotune, n_fields, _autotune_t);
+    for (int f_id = 0; f_id < n_fields; f_id++) {
+      _autotune_t *at = _autotune + f_id;
+      at->symmetric = true;
+      at->candidate = -1;
+      at->n_solves = 0;
+      at->tuned = false;
+      at->apply = false;
+      for (int i = 0; i < CS_SLES_AUTOTUNE_N_MAX; i++)
+        at->wtime[i] = 0;
+    }
+  }
+
   /* Define solver for all variable fields if not already done,
      based on convection/diffusion */
 
@@ -576,6 +962,15 @@ cs_sles_default_setup(void)
         if (eqp != nullptr) {
           bool symmetric = (eqp->iconv > 0) ? false : true;
           _sles_default_native(f_id, nullptr, CS_MATRIX_N_TYPES, symmetric);
+
+          /* Only default definitions of uncoupled systems are tuned */
+          int coupling_id
+            = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
+          if (_autotune_n_solves > 0 && coupling_id < 0) {
+            _autotune[f_id].symmetric = symmetric;
+            _autotune[f_id].candidate = 0;
+            _autotune[f_id].apply = true;
+          }
         }
       }
 
@@ -583,6 +978,11 @@ cs_sles_default_setup(void)
 
   }
 
+  /* Previous autotuning results replace trials when available */
+
+  if (_autotune_n_solves > 0)
+    _autotune_read();
+
   /* Logging */
 
   cs_log_printf(CS_LOG_SETUP, "\n");
@@ -606,10 +1006,44 @@ cs_sles_default_finalize(void)
 {
   cs_sles_log(CS_LOG_PERFORMANCE);
 
+  if (_autotune != nullptr) {
+    _autotune_write();
+    BFT_FREE(_autotune);
+    _autotune_n_fields = 0;
+  }
+
   cs_multigrid_finalize();
   cs_sles_finalize();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate automatic tuning of default linear solvers.
+ *
+ * For each variable field whose solver is defined by default
+ * (and not coupled), the candidate solver and preconditioner
+ * configurations adapted to the system type are each used for a given
+ * number of successive solves, and the configuration with the lowest
+ * cumulative time to solution (including setup) is then kept for the
+ * rest of the computation.
+ *
+ * Selected configurations are saved to "checkpoint/sles_autotune" at
+ * the end of the computation, and read from "restart/sles_autotune"
+ * if present, in which case the trials are skipped for the matching fields.
+ *
+ * This function must be called before \ref cs_sles_default_setup
+ * (i.e. in \ref cs_user_linear_solvers) to be effective.
+ *
+ * \param[in]  n_solves  number of solves per candidate, or 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_autotune(int  n_solves)
+{
+  _autotune_n_solves = CS_MAX(n_solves, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return default verbosity associated to a field id, name couple.
@@ -808,6 +1242,26 @@ cs_sles_solve_native(int                  f_id,
       setup_id++;
   }
 
+  /* Autotuning: time this solve, and switch configuration
+     if needed (only when no setup is active) */
+
+  bool autotune = false;
+  double t0 = 0;
+
+  if (f_id > -1 && f_id < _autotune_n_fields) {
+    _autotune_t *at = _autotune + f_id;
+    if (at->candidate > -1) {
+      if (at->apply && setup_id >= _n_setups) {
+        _autotune_define(f_id, at);
+        at->apply = false;
+      }
+      if (!at->tuned && !at->apply) {
+        autotune = true;
+        t0 = cs_timer_wtime();
+      }
+    }
+  }
+
   if (setup_id >= _n_setups) {
 
     _n_setups += 1;
@@ -902,6 +1356,9 @@ cs_sles_solve_native(int                  f_id,
                       0,
                       nullptr);
 
+  if (autotune)
+    _autotune_update(f_id, cvg, cs_timer_wtime() - t0);
+
   BFT_FREE(_rhs);
   if (_vx != vx) {
     size_t stride = diag_block_size;
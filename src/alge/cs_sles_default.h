@@ -110,6 +110,23 @@ cs_sles_default_get_verbosity(int          f_id,
 void
 cs_sles_default_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Activate automatic tuning of default linear solvers.
+ *
+ * For each default (uncoupled) variable field solver, candidate
+ * configurations are each used for n_solves successive solves, and the
+ * fastest one is kept. Selections are saved to "checkpoint/sles_autotune",
+ * and reused from "restart/sles_autotune" by subsequent runs.
+ *
+ * This function must be called before cs_sles_default_setup.
+ *
+ * parameters:
+ *   n_solves <-- number of solves per candidate, or 0 to deactivate
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_set_autotune(int  n_solves);
+
 /*----------------------------------------------------------------------------
  * Call sparse linear equation solver setup for convection-diffusion
  * systems
@@ -54,6 +54,7 @@
 
 #include "cs_sles_it.h"
 #include "cs_sles_it_priv.h"
+#include "cs_sles_telemetry.h"
 
 #if defined(HAVE_CUDA)
 #include "cs_base_cuda.h"
@@ -143,10 +144,12 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Pipelined Conjugate Gradient"),
      N_("User-defined iterative solver"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
+     N_("Chebyshev polynomial"),
 };
 
 /*=============================================================================
@@ -214,6 +217,8 @@ _convergence_test(cs_sles_it_t              *c,
   convergence->n_iterations = n_iter;
   convergence->residual = residual;
 
+  cs_sles_telemetry_add_residual(c, residual);
+
   /* Plot convergence if requested */
 
   if (c->plot != nullptr) {
@@ -323,7 +328,7 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[4];
-    MPI_Allreduce(s, _sum, 4, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_comm_allreduce(s, _sum, 4, MPI_DOUBLE, MPI_SUM, c->comm);
     memcpy(s, _sum, 4*sizeof(double));
   }
 
@@ -541,6 +546,443 @@ _conjugate_gradient(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute dot products rk.rk, rk.gk, and aw_i.gk for each recycled vector,
+ * summing result over all ranks with a single reduction.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   rk     <-- residual vector
+ *   gk     <-- preconditioned residual vector
+ *   s      --> resulting dot products (size: 2 + n_vecs)
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_products_deflation(const cs_sles_it_t  *c,
+                        const cs_real_t     *rk,
+                        const cs_real_t     *gk,
+                        double               s[])
+{
+  const cs_sles_it_recycle_t *rc = c->recycle;
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  if (rk != nullptr)
+    cs_dot_xx_xy(n_rows, rk, gk, s, s+1);
+  else
+    s[0] = 0, s[1] = 0;
+
+  for (int i = 0; i < rc->n_vecs; i++)
+    s[2+i] = cs_dot(n_rows, rc->aw + i*rc->stride, gk);
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL)
+    cs_comm_allreduce(MPI_IN_PLACE, s, 2 + rc->n_vecs, MPI_DOUBLE, MPI_SUM,
+                      c->comm);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Update y -= sum_i(coef_i.w_i) for a set of recycled vectors.
+ *
+ * parameters:
+ *   rc      <-- pointer to recycled subspace
+ *   n_rows  <-- number of rows
+ *   w       <-- recycled vectors (w or aw)
+ *   coef    <-- associated coefficients
+ *   y       <-> updated vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_deflation_update(const cs_sles_it_recycle_t  *rc,
+                  cs_lnum_t                    n_rows,
+                  const cs_real_t             *w,
+                  const double                 coef[],
+                  cs_real_t                   *restrict y)
+{
+  const cs_lnum_t stride = rc->stride;
+  const int n_vecs = rc->n_vecs;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_real_t s = 0;
+    for (int i = 0; i < n_vecs; i++)
+      s += coef[i] * w[i*stride + ii];
+    y[ii] -= s;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Prepare the recycled subspace for a given matrix.
+ *
+ * The subspace is reset if the system size changed. Otherwise, if the
+ * matrix was updated since the previous solve, the A.w products are
+ * recomputed and the basis is A-orthonormalized again (using classical
+ * Gram-Schmidt with reorthogonalization). Vectors which become
+ * (numerically) dependent are dropped.
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   a       <-- matrix
+ *   n_cols  <-- number of columns (including halo)
+ *----------------------------------------------------------------------------*/
+
+static void
+_recycle_prepare(cs_sles_it_t       *c,
+                 const cs_matrix_t  *a,
+                 cs_lnum_t           n_cols)
+{
+  cs_sles_it_recycle_t *rc = c->recycle;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t stride = CS_SIMD_SIZE(n_cols);
+
+  if (rc->n_rows != n_rows || rc->stride != stride) {
+    BFT_FREE(rc->w);
+    BFT_FREE(rc->aw);
+    rc->n_rows = n_rows;
+    rc->stride = stride;
+    BFT_MALLOC(rc->w, rc->n_max*stride, cs_real_t);
+    BFT_MALLOC(rc->aw, rc->n_max*stride, cs_real_t);
+    rc->n_vecs = 0;
+    rc->next = 0;
+    rc->stale = false;
+    return;
+  }
+
+  if (rc->stale == false)
+    return;
+
+  double s[2 + CS_SLES_IT_RECYCLE_MAX];
+
+  int n_vecs = rc->n_vecs;
+  rc->n_vecs = 0;
+
+  for (int i = 0; i < n_vecs; i++) {
+
+    cs_real_t *w_i = rc->w + rc->n_vecs*stride;
+    cs_real_t *aw_i = rc->aw + rc->n_vecs*stride;
+
+    if (w_i != rc->w + i*stride)
+      memcpy(w_i, rc->w + i*stride, n_rows*sizeof(cs_real_t));
+
+    cs_matrix_vector_multiply(a, w_i, aw_i);
+
+    double a_norm2_ref = _dot_product(c, w_i, aw_i);
+
+    for (int k = 0; k < 2; k++) {
+      _dot_products_deflation(c, nullptr, w_i, s);
+      _deflation_update(rc, n_rows, rc->w, s+2, w_i);
+      _deflation_update(rc, n_rows, rc->aw, s+2, aw_i);
+    }
+
+    double a_norm2 = _dot_product(c, w_i, aw_i);
+
+    if (a_norm2 > 1e-12*a_norm2_ref && a_norm2 > DBL_MIN) {
+      const cs_real_t scale = 1. / sqrt(a_norm2);
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        w_i[ii] *= scale;
+        aw_i[ii] *= scale;
+      }
+      rc->n_vecs += 1;
+    }
+
+  }
+
+  rc->next = rc->n_vecs % rc->n_max;
+  rc->stale = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Add the solution increment of a deflated CG solve to the recycled subspace.
+ *
+ * Since the increment is (up to rounding and matrix changes) A-orthogonal
+ * to the current subspace, and its product by A is known from the residual
+ * update, no additional matrix-vector product is needed.
+ *
+ * parameters:
+ *   c    <-- pointer to solver context info
+ *   vk   <-> solution increment (overwritten)
+ *   avk  <-> product of solution increment by A (overwritten)
+ *----------------------------------------------------------------------------*/
+
+static void
+_recycle_add(cs_sles_it_t  *c,
+             cs_real_t     *restrict vk,
+             cs_real_t     *restrict avk)
+{
+  cs_sles_it_recycle_t *rc = c->recycle;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  double s[2 + CS_SLES_IT_RECYCLE_MAX];
+
+  double a_norm2_ref = _dot_product(c, vk, avk);
+
+  /* Do not account for the vector to be replaced */
+
+  int n_vecs = rc->n_vecs;
+  if (n_vecs == rc->n_max) {
+    int last = n_vecs - 1;
+    if (rc->next != last) {
+      memcpy(rc->w + rc->next*rc->stride, rc->w + last*rc->stride,
+             n_rows*sizeof(cs_real_t));
+      memcpy(rc->aw + rc->next*rc->stride, rc->aw + last*rc->stride,
+             n_rows*sizeof(cs_real_t));
+    }
+    rc->n_vecs = last;
+  }
+
+  _dot_products_deflation(c, nullptr, vk, s);
+  _deflation_update(rc, n_rows, rc->w, s+2, vk);
+  _deflation_update(rc, n_rows, rc->aw, s+2, avk);
+
+  double a_norm2 = _dot_product(c, vk, avk);
+
+  if (a_norm2 > 1e-12*a_norm2_ref && a_norm2 > DBL_MIN) {
+    cs_real_t *w_n = rc->w + rc->n_vecs*rc->stride;
+    cs_real_t *aw_n = rc->aw + rc->n_vecs*rc->stride;
+    const cs_real_t scale = 1. / sqrt(a_norm2);
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      w_n[ii] = vk[ii] * scale;
+      aw_n[ii] = avk[ii] * scale;
+    }
+    rc->n_vecs += 1;
+  }
+
+  rc->next = (n_vecs == rc->n_max) ? (rc->next + 1) % rc->n_max : 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using deflated preconditioned conjugate gradient.
+ *
+ * The deflation subspace W is built from the solution increments of
+ * previous solves, which are dominated by the slowly converging (low)
+ * modes, and is kept A-orthonormal, so that W^t.A.W = I.
+ * The initial guess is first corrected by a Galerkin projection on W,
+ * then search directions are kept A-orthogonal to W, following the
+ * deflated PCG algorithm of Saad, Yeung, Erhel and Guyomarc'h (2000).
+ * The dot products needed for the deflation are grouped with those
+ * of the regular algorithm, so no additional reduction is required
+ * per iteration.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_deflated_conjugate_gradient(cs_sles_it_t              *c,
+                             const cs_matrix_t         *a,
+                             cs_lnum_t                  diag_block_size,
+                             cs_sles_it_convergence_t  *convergence,
+                             const cs_real_t           *rhs,
+                             cs_real_t                 *restrict vx_ini,
+                             cs_real_t                 *restrict vx,
+                             size_t                     aux_size,
+                             void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  ro_0, ro_1, alpha, rk_gkm1, rk_gk, beta, residual;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict dk, *restrict gk;
+  cs_real_t  *restrict zk, *restrict vk, *restrict avk;
+
+  double s[2 + CS_SLES_IT_RECYCLE_MAX];
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != nullptr);
+  assert(c->recycle != nullptr);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+  {
+    const size_t n_wa = 6;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == nullptr || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = static_cast<cs_real_t *>(aux_vectors);
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    gk = _aux_vectors + wa_size*2;
+    zk = _aux_vectors + wa_size*3;
+    vk = _aux_vectors + wa_size*4;
+    avk = _aux_vectors + wa_size*5;
+  }
+
+  cs_sles_it_recycle_t *rc = c->recycle;
+
+  _recycle_prepare(c, a, n_cols);
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residual */
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x0 */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] -= rhs[ii];
+  }
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = -rhs[ii];
+      vx[ii] = 0.;
+    }
+  }
+
+  /* Galerkin projection of the initial guess on the recycled subspace:
+     x0 <- x0 - W.W^t.rk, rk <- rk - A.W.W^t.rk */
+
+  if (rc->n_vecs > 0) {
+    for (int i = 0; i < rc->n_vecs; i++)
+      s[2+i] = cs_dot(n_rows, rc->w + i*rc->stride, rk);
+#if defined(HAVE_MPI)
+    if (c->comm != MPI_COMM_NULL)
+      cs_comm_allreduce(MPI_IN_PLACE, s+2, rc->n_vecs, MPI_DOUBLE, MPI_SUM,
+                        c->comm);
+#endif
+    _deflation_update(rc, n_rows, rc->w, s+2, vx);
+    _deflation_update(rc, n_rows, rc->aw, s+2, rk);
+  }
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    vk[ii] = 0.;
+    avk[ii] = 0.;
+  }
+
+  /* Preconditioning */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rk,
+                          gk);
+
+  /* Descent direction, A-orthogonal to W */
+  /*--------------------------------------*/
+
+  _dot_products_deflation(c, rk, gk, s);
+
+  residual = sqrt(s[0]);
+  rk_gkm1 = s[1];
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    dk[ii] = gk[ii];
+
+  _deflation_update(rc, n_rows, rc->w, s+2, dk);
+
+  /* If no solving required, finish here */
+
+  c->setup_data->initial_residual = residual;
+  cvg = _convergence_test(c, n_iter, residual, convergence);
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    if (n_iter > 0) {
+
+      /* Preconditioning */
+
+      c->setup_data->pc_apply(c->setup_data->pc_context, rk, gk);
+
+      /* Compute residual, descent and deflation parameters */
+
+      _dot_products_deflation(c, rk, gk, s);
+
+      residual = sqrt(s[0]);
+      rk_gk = s[1];
+
+      /* Convergence test for end of previous iteration */
+
+      if (n_iter > 1)
+        cvg = _convergence_test(c, n_iter, residual, convergence);
+
+      if (cvg != CS_SLES_ITERATING)
+        break;
+
+      beta = (CS_ABS(rk_gkm1) > DBL_MIN) ? rk_gk / rk_gkm1 : 0.;
+      rk_gkm1 = rk_gk;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        dk[ii] = gk[ii] + (beta * dk[ii]);
+
+      _deflation_update(rc, n_rows, rc->w, s+2, dk);
+
+    }
+
+    n_iter += 1;
+
+    cs_matrix_vector_multiply(a, dk, zk);
+
+    _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+
+    cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
+    alpha =  - ro_0 * d_ro_1;
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] += (alpha * dk[ii]);
+        vk[ii] += (alpha * dk[ii]);
+      }
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        rk[ii] += (alpha * zk[ii]);
+        avk[ii] += (alpha * zk[ii]);
+      }
+    }
+
+    /* Convergence test on first iteration (later ones are tested
+       after preconditioning, grouping reductions) */
+
+    if (n_iter == 1) {
+      residual = sqrt(_dot_product_xx(c, rk));
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+    }
+
+  }
+
+  /* Enrich recycled subspace with the solution increment */
+
+  if (n_iter > 0 && cvg != CS_SLES_DIVERGED && cvg != CS_SLES_BREAKDOWN)
+    _recycle_add(c, vk, avk);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using flexible preconditioned conjugate gradient.
  *
@@ -1144,6 +1586,217 @@ _conjugate_gradient_sr(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant, described in \cite Ghysels:2014, requires a single global
+ * reduction per iteration, which is started before the preconditioning
+ * and matrix-vector product, and completed only after those operations,
+ * so that reduction latency may be overlapped with computation.
+ *
+ * It requires more work arrays and vector operations than the standard
+ * version, and may lose some accuracy due to the recurrences used, so it
+ * is mostly useful when global synchronization costs dominate.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx_ini,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  alpha = 0., beta = 0., gamma_km1 = 0., residual;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict zk, *restrict qk, *restrict sk;
+  cs_real_t  *restrict pk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != nullptr);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == nullptr || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = static_cast<cs_real_t *>(aux_vectors);
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  cs_sles_pc_apply_t  *pc_apply = c->setup_data->pc_apply;
+  void *pc_context = c->setup_data->pc_context;
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residual (using r = b - A.x convention here) */
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x0 */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] = rhs[ii] - rk[ii];
+  }
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = rhs[ii];
+      vx[ii] = 0.;
+    }
+  }
+
+  /* u = M.r, w = A.u */
+
+  if (pc_apply != nullptr)
+    pc_apply(pc_context, rk, uk);
+  else
+    memcpy(uk, rk, n_rows * sizeof(cs_real_t));
+
+  cs_matrix_vector_multiply(a, uk, wk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    zk[ii] = 0.;
+    qk[ii] = 0.;
+    sk[ii] = 0.;
+    pk[ii] = 0.;
+  }
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Start reduction of r.r, r.u and u.w */
+
+    double s[3];
+
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s, s+1, s+2);
+
+#if defined(HAVE_MPI)
+
+    double s_loc[3] = {s[0], s[1], s[2]};
+    MPI_Request request = MPI_REQUEST_NULL;
+
+    if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+      MPI_Iallreduce(s_loc, s, 3, MPI_DOUBLE, MPI_SUM, c->comm, &request);
+#else
+      cs_comm_allreduce(s_loc, s, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    /* Overlap: m = M.w, n = A.m */
+
+    if (pc_apply != nullptr)
+      pc_apply(pc_context, wk, mk);
+    else
+      memcpy(mk, wk, n_rows * sizeof(cs_real_t));
+
+    cs_matrix_vector_multiply(a, mk, nk);
+
+#if defined(HAVE_MPI)
+    if (request != MPI_REQUEST_NULL)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
+
+    const double gamma_k = s[1], delta_k = s[2];
+
+    /* Convergence test */
+
+    residual = sqrt(s[0]);
+
+    if (n_iter == 0)
+      c->setup_data->initial_residual = residual;
+
+    cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* Descent parameters */
+
+    if (n_iter > 0) {
+      beta = (CS_ABS(gamma_km1) > DBL_MIN) ? gamma_k / gamma_km1 : 0.;
+      double d = (CS_ABS(alpha) > DBL_MIN) ?
+        delta_k - beta * gamma_k / alpha : delta_k;
+      alpha = (CS_ABS(d) > DBL_MIN) ? gamma_k / d : 0.;
+    }
+    else {
+      beta = 0.;
+      alpha = (CS_ABS(delta_k) > DBL_MIN) ? gamma_k / delta_k : 0.;
+    }
+
+    gamma_km1 = gamma_k;
+
+    n_iter += 1;
+
+    /* Update recurrences (fused in a single pass) */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      zk[ii] = nk[ii] + beta * zk[ii];
+      qk[ii] = mk[ii] + beta * qk[ii];
+      sk[ii] = wk[ii] + beta * sk[ii];
+      pk[ii] = uk[ii] + beta * pk[ii];
+      vx[ii] += alpha * pk[ii];
+      rk[ii] -= alpha * sk[ii];
+      uk[ii] -= alpha * qk[ii];
+      wk[ii] -= alpha * zk[ii];
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using non-preconditioned conjugate gradient.
  *
@@ -1639,17 +2292,33 @@ _conjugate_residual_3(cs_sles_it_t              *c,
 
     c->setup_data->pc_apply(c->setup_data->pc_context, rk, wk);
 
-    cs_matrix_vector_multiply(a, wk, zk);
+    cs_matrix_vector_multiply(a, wk, zk);
+
+    /* Dot products are reduced together */
+
+    {
+#if defined(HAVE_MPI)
+      cs_parall_deferred_sum dsum(c->comm);
+#else
+      cs_parall_deferred_sum dsum;
+#endif
+      double s[5];
+
+      cs_dot_xy_yz(n_rows, rk, zk, rkm1, s, s+1);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        tmp[ii] = rk[ii] - rkm1[ii];
 
-    _dot_products_xy_yz(c, rk, zk, rkm1, &ak, &bk);
+      cs_dot_xy_yz(n_rows, rk, tmp, rkm1, s+2, s+3);
 
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      tmp[ii] = rk[ii] - rkm1[ii];
+      s[4] = cs_dot_xx(n_rows, zk);
 
-    _dot_products_xy_yz(c, rk, tmp, rkm1, &ck, &dk);
+      dsum.add(5, s, s);
+      dsum.flush();
 
-    ek = _dot_product_xx(c, zk);
+      ak = s[0]; bk = s[1]; ck = s[2]; dk = s[3]; ek = s[4];
+    }
 
     denom = (ck-dk)*ek - ((ak-bk)*(ak-bk));
 
@@ -1794,7 +2463,7 @@ _jacobi(cs_sles_it_t              *c,
 
       if (c->comm != MPI_COMM_NULL) {
         double _sum;
-        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
         res2 = _sum;
       }
 
@@ -1859,7 +2528,7 @@ _jacobi(cs_sles_it_t              *c,
 
       if (c->comm != MPI_COMM_NULL) {
         double _sum;
-        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
         res2 = _sum;
       }
 
@@ -1997,7 +2666,7 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
       res2 = _sum;
     }
 
@@ -2047,7 +2716,7 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
       res2 = _sum;
     }
 
@@ -2173,7 +2842,7 @@ _block_jacobi(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
       res2 = _sum;
     }
 
@@ -2223,7 +2892,7 @@ _block_jacobi(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
       res2 = _sum;
     }
 
@@ -3017,8 +3686,13 @@ _gcr(cs_sles_it_t              *c,
           ck_n[ii] += - gkj[ii_jn] * ck_j[ii];
       }
 
+      /* Norm of c_n and c_n.r_k are reduced together, the latter
+         being scaled afterwards */
+
       const int  iter_shift = (n_c_iter+1) * n_c_iter / 2 + n_c_iter;
-      gkj[iter_shift] = sqrt(_dot_product(c, ck_n, ck_n));
+      double ck_n_ck_n, ck_n_rk;
+      _dot_products_xx_xy(c, ck_n, rk, &ck_n_ck_n, &ck_n_rk);
+      gkj[iter_shift] = sqrt(ck_n_ck_n);
 
       if (fabs(gkj[iter_shift]) > 0) {
 
@@ -3027,7 +3701,7 @@ _gcr(cs_sles_it_t              *c,
         for (cs_lnum_t ii = 0; ii < n_rows; ii++)
           ck_n[ii] *= scale;
 
-        alpha[n_c_iter] = _dot_product(c, ck_n, rk);
+        alpha[n_c_iter] = ck_n_rk * scale;
 
       }
       else
@@ -3518,7 +4192,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
 
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
-      MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+      cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
       res2 = _sum;
     }
 
@@ -3684,7 +4358,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
 
       if (c->comm != MPI_COMM_NULL) {
         double _sum;
-        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
         res2 = _sum;
       }
 
@@ -3927,7 +4601,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 
       if (c->comm != MPI_COMM_NULL) {
         double _sum;
-        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        cs_comm_allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
         res2 = _sum;
       }
 
@@ -4124,6 +4798,321 @@ _fallback(cs_sles_it_t                    *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute 2 dot products for each of a set of interleaved vectors,
+ * summing result over all ranks.
+ *
+ * For vector k, s[k] = x1.y1 and s[n_vecs + k] = x2.y2.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   n_vecs <-- number of interleaved vectors
+ *   x1     <-- first vector in s1 = x1.y1
+ *   y1     <-- second vector in s1 = x1.y1
+ *   x2     <-- first vector in s2 = x2.y2
+ *   y2     <-- second vector in s2 = x2.y2
+ *   s      --> resulting dot products (size: 2*n_vecs)
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_products_multi(const cs_sles_it_t  *c,
+                    int                  n_vecs,
+                    const cs_real_t     *restrict x1,
+                    const cs_real_t     *restrict y1,
+                    const cs_real_t     *restrict x2,
+                    const cs_real_t     *restrict y2,
+                    double               s[])
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  for (int k = 0; k < 2*n_vecs; k++)
+    s[k] = 0.;
+
+# pragma omp parallel if(n_rows*n_vecs > CS_THR_MIN)
+  {
+    double *_s;
+    BFT_MALLOC(_s, 2*n_vecs, double);
+    for (int k = 0; k < 2*n_vecs; k++)
+      _s[k] = 0.;
+
+#   pragma omp for nowait
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t s_id = ii*n_vecs;
+      for (int k = 0; k < n_vecs; k++) {
+        _s[k]          += x1[s_id + k] * y1[s_id + k];
+        _s[n_vecs + k] += x2[s_id + k] * y2[s_id + k];
+      }
+    }
+
+#   pragma omp critical
+    {
+      for (int k = 0; k < 2*n_vecs; k++)
+        s[k] += _s[k];
+    }
+
+    BFT_FREE(_s);
+  }
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL)
+    cs_comm_allreduce(MPI_IN_PLACE, s, 2*n_vecs, MPI_DOUBLE, MPI_SUM, c->comm);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Convergence test for one of a set of simultaneously solved systems.
+ *
+ * parameters:
+ *   c            <-- pointer to solver context info
+ *   name         <-- system name
+ *   verbosity    <-- verbosity level
+ *   precision    <-- solver precision
+ *   r_norm       <-- residual normalization
+ *   r_ini        <-- initial residual
+ *   n_iter       <-- number of iterations done
+ *   residual     <-- non normalized residual
+ *
+ * returns:
+ *   convergence status.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_convergence_test_multi(const cs_sles_it_t  *c,
+                        const char          *name,
+                        int                  verbosity,
+                        double               precision,
+                        double               r_norm,
+                        double               r_ini,
+                        unsigned             n_iter,
+                        double               residual)
+{
+  if (precision > 0 && residual < precision * r_norm)
+    return CS_SLES_CONVERGED;
+
+  else if (n_iter >= c->n_max_iter) {
+    if (verbosity > -1) {
+      bft_printf("%s [%s]:\n", cs_sles_it_type_name[c->type], name);
+      bft_printf(_("  n_iter: %5d, res_abs: %11.4e, norm: %11.4e,"
+                   " res_init: %11.4e\n"),
+                 n_iter, residual, r_norm, r_ini);
+      if (precision > 0.)
+        bft_printf(_(" @@ Warning: non convergence\n"));
+    }
+    return CS_SLES_MAX_ITERATION;
+  }
+
+  else if (   (residual > r_ini * 10000.0 && residual > 100.)
+           || isnan(residual) || isinf(residual)) {
+    bft_printf(_("\n\n"
+                 "%s [%s]: divergence after %u iterations:\n"
+                 "  initial residual: %11.4e; current residual: %11.4e\n"),
+               cs_sles_it_type_name[c->type], name,
+               n_iter, r_ini, residual);
+    return CS_SLES_DIVERGED;
+  }
+
+  return CS_SLES_ITERATING;
+}
+
+/*----------------------------------------------------------------------------
+ * Simultaneous solution of A.vx = Rhs for a set of interleaved right-hand
+ * sides using preconditioned conjugate gradient.
+ *
+ * Each system has its own descent parameters, but matrix.vector products
+ * are done for all systems in a single pass, and global reductions are
+ * grouped. Systems which have converged are frozen (their descent
+ * parameter is set to zero) until all systems are done.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c         <-- pointer to solver context info
+ *   name      <-- system name
+ *   a         <-- matrix
+ *   n_vecs    <-- number of interleaved systems
+ *   verbosity <-- verbosity level
+ *   precision <-- solver precision
+ *   r_norm    <-- residual normalization, per system
+ *   n_iter    --> number of iterations, per system
+ *   residual  --> residual, per system
+ *   rhs       <-- right hand sides (interleaved)
+ *   vx        <-> system solutions (interleaved)
+ *
+ * returns:
+ *   convergence state of the least converged system
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_multi(cs_sles_it_t       *c,
+                          const char         *name,
+                          const cs_matrix_t  *a,
+                          int                 n_vecs,
+                          int                 verbosity,
+                          double              precision,
+                          const double        r_norm[],
+                          int                 n_iter[],
+                          double              residual[],
+                          const cs_real_t    *rhs,
+                          cs_real_t          *restrict vx)
+{
+  cs_real_t  *restrict rk, *restrict dk, *restrict gk, *restrict zk;
+  cs_real_t  *restrict _r, *restrict _g;
+
+  cs_sles_it_setup_t *sd = c->setup_data;
+  const cs_lnum_t n_rows = sd->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+  const cs_lnum_t n = n_rows * n_vecs;
+
+  /* Allocate work arrays */
+
+  BFT_MALLOC(rk, n, cs_real_t);
+  BFT_MALLOC(dk, n_cols*n_vecs, cs_real_t);
+  BFT_MALLOC(gk, n, cs_real_t);
+  BFT_MALLOC(zk, n, cs_real_t);
+  BFT_MALLOC(_r, n_cols, cs_real_t);
+  BFT_MALLOC(_g, n_cols, cs_real_t);
+
+  double *s, *rk_gkm1, *alpha, *beta, *w_g, *r_ini;
+  BFT_MALLOC(s, 2*n_vecs, double);
+  BFT_MALLOC(rk_gkm1, n_vecs, double);
+  BFT_MALLOC(alpha, n_vecs, double);
+  BFT_MALLOC(beta, n_vecs, double);
+  BFT_MALLOC(w_g, n_vecs, double);
+  BFT_MALLOC(r_ini, n_vecs, double);
+
+  cs_sles_convergence_state_t *cvg;
+  BFT_MALLOC(cvg, n_vecs, cs_sles_convergence_state_t);
+
+  /* Initial residuals: rk = A.x0 - b */
+
+  cs_matrix_vector_multiply_multi(a, n_vecs, vx, rk);
+
+# pragma omp parallel for if(n > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n; ii++)
+    rk[ii] -= rhs[ii];
+
+  unsigned _n_iter = 0;
+  int n_active = n_vecs;
+
+  for (int k = 0; k < n_vecs; k++) {
+    cvg[k] = CS_SLES_ITERATING;
+    n_iter[k] = 0;
+    rk_gkm1[k] = 0.;
+  }
+
+  while (true) {
+
+    /* Preconditioning, one system at a time */
+
+    for (int k = 0; k < n_vecs; k++) {
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        _r[ii] = rk[ii*n_vecs + k];
+
+      sd->pc_apply(sd->pc_context, _r, _g);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        gk[ii*n_vecs + k] = _g[ii];
+
+    }
+
+    /* Residuals and descent parameters (grouped reduction) */
+
+    _dot_products_multi(c, n_vecs, rk, rk, rk, gk, s);
+
+    for (int k = 0; k < n_vecs; k++) {
+      if (cvg[k] != CS_SLES_ITERATING)
+        continue;
+      residual[k] = sqrt(s[k]);
+      if (_n_iter == 0)
+        r_ini[k] = residual[k];
+      cvg[k] = _convergence_test_multi(c, name, verbosity, precision,
+                                       r_norm[k], r_ini[k],
+                                       _n_iter, residual[k]);
+      n_iter[k] = _n_iter;
+      if (cvg[k] != CS_SLES_ITERATING)
+        n_active -= 1;
+    }
+
+    if (n_active == 0)
+      break;
+
+    _n_iter += 1;
+
+    /* Update descent directions; frozen systems keep a zero direction */
+
+    for (int k = 0; k < n_vecs; k++) {
+      double rk_gk = s[n_vecs + k];
+      if (cvg[k] == CS_SLES_ITERATING) {
+        beta[k] = (CS_ABS(rk_gkm1[k]) > DBL_MIN) ? rk_gk / rk_gkm1[k] : 0.;
+        w_g[k] = 1.;
+      }
+      else {
+        beta[k] = 0.;
+        w_g[k] = 0.;
+      }
+      rk_gkm1[k] = rk_gk;
+    }
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t s_id = ii*n_vecs;
+      for (int k = 0; k < n_vecs; k++)
+        dk[s_id + k] = w_g[k]*gk[s_id + k] + beta[k]*dk[s_id + k];
+    }
+
+    /* Single pass matrix.vector product for all systems */
+
+    cs_matrix_vector_multiply_multi(a, n_vecs, dk, zk);
+
+    _dot_products_multi(c, n_vecs, rk, dk, dk, zk, s);
+
+    for (int k = 0; k < n_vecs; k++) {
+      cs_real_t d_ro_1 = (CS_ABS(s[n_vecs + k]) > DBL_MIN) ?
+        1. / s[n_vecs + k] : 0.;
+      alpha[k] = (cvg[k] != CS_SLES_ITERATING) ? 0. : - s[k] * d_ro_1;
+    }
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t s_id = ii*n_vecs;
+      for (int k = 0; k < n_vecs; k++) {
+        vx[s_id + k] += alpha[k] * dk[s_id + k];
+        rk[s_id + k] += alpha[k] * zk[s_id + k];
+      }
+    }
+
+  }
+
+  /* Return the least converged state */
+
+  cs_sles_convergence_state_t cvg_min = CS_SLES_CONVERGED;
+  for (int k = 0; k < n_vecs; k++) {
+    if (cvg[k] < cvg_min)
+      cvg_min = cvg[k];
+  }
+
+  BFT_FREE(cvg);
+  BFT_FREE(r_ini);
+  BFT_FREE(w_g);
+  BFT_FREE(beta);
+  BFT_FREE(alpha);
+  BFT_FREE(rk_gkm1);
+  BFT_FREE(s);
+  BFT_FREE(_g);
+  BFT_FREE(_r);
+  BFT_FREE(zk);
+  BFT_FREE(gk);
+  BFT_FREE(dk);
+  BFT_FREE(rk);
+
+  return cvg_min;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -4334,6 +5323,7 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   c->setup_data = nullptr;
   c->add_data = nullptr;
   c->shared = nullptr;
+  c->recycle = nullptr;
 
   /* Fallback mechanism */
 
@@ -4382,6 +5372,7 @@ cs_sles_it_destroy(void **context)
       BFT_FREE(c->add_data->order);
       BFT_FREE(c->add_data);
     }
+    cs_sles_it_set_recycling(c, 0);
     BFT_FREE(c);
     *context = c;
   }
@@ -4424,6 +5415,10 @@ cs_sles_it_copy(const void  *context)
     if (c->type == CS_SLES_GMRES || c->type == CS_SLES_GCR)
       d->restart_interval = c->restart_interval;
 
+    /* Recycled subspace settings (not its contents) */
+    if (c->recycle != nullptr)
+      cs_sles_it_set_recycling(d, c->recycle->n_max);
+
 #if defined(HAVE_MPI)
     d->comm = c->comm;
 #endif
@@ -4461,6 +5456,10 @@ cs_sles_it_log(const void  *context,
       cs_log_printf(log_type,
                     "  Restart interval:                  %d\n",
                     c->restart_interval);
+    if (c->type == CS_SLES_PCG && c->recycle != nullptr)
+      cs_log_printf(log_type,
+                    "  Recycled subspace size:            %d\n",
+                    c->recycle->n_max);
     cs_log_printf(log_type,
                   _("  Maximum number of iterations:      %d\n"),
                   c->n_max_iter);
@@ -4617,6 +5616,11 @@ cs_sles_it_setup(void               *context,
       if (n_m_rows < (cs_gnum_t)_pcg_sr_threshold)
         single_reduce = true;
 #endif
+      if (c->recycle != nullptr && c->pc != nullptr) {
+        c->solve = _deflated_conjugate_gradient;
+        c->recycle->stale = true;
+        break;
+      }
       if (!single_reduce) {
         if (c->pc != nullptr)
           c->solve = _conjugate_gradient;
@@ -4647,6 +5651,10 @@ cs_sles_it_setup(void               *context,
     c->solve = _conjugate_gradient_ip;
     break;
 
+  case CS_SLES_PIPELINED_PCG:
+    c->solve = _conjugate_gradient_pipelined;
+    break;
+
   case CS_SLES_JACOBI:
     if (diag_block_size == 1)
       c->solve = _jacobi;
@@ -4795,8 +5803,14 @@ cs_sles_it_solve(void                *context,
       cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
     }
 
+    cs_timer_t t_s0 = cs_timer_time();
+
     cs_sles_it_setup(c, name, a, verbosity);
 
+    cs_timer_t t_s1 = cs_timer_time();
+    cs_sles_telemetry_add_setup_time(  (t_s1.sec - t_s0.sec)
+                                     + (t_s1.nsec - t_s0.nsec)*1e-9);
+
     if (c->update_stats) /* Restart solve timer */
       t0 = cs_timer_time();
 
@@ -4978,6 +5992,174 @@ cs_sles_it_solve(void                *context,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call iterative sparse linear equation solver for a set of
+ *        independent systems sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so value i of system k
+ * is found at position i*n_vecs + k; vx must thus be sized for
+ * n_cols_ext*n_vecs values, and is considered initialized on entry.
+ *
+ * With a scalar matrix and the conjugate gradient solver (and the solve
+ * not restricted to a subset of ranks), systems are solved simultaneously,
+ * using a single matrix pass per iteration for all right-hand sides and
+ * grouped global reductions. Otherwise, systems are solved one by one.
+ *
+ * \param[in, out]  context        pointer to iterative solver info and context
+ *                                 (actual type: cs_sles_it_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       n_vecs         number of systems
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residual normalization, per system
+ * \param[out]      n_iter         number of iterations, per system
+ * \param[out]      residual       residual, per system
+ * \param[in]       rhs            right hand sides (interleaved)
+ * \param[in, out]  vx             system solutions (interleaved)
+ *
+ * \return  convergence state of the least converged system
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  n_vecs,
+                       int                  verbosity,
+                       double               precision,
+                       const double         r_norm[],
+                       int                  n_iter[],
+                       double               residual[],
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx)
+{
+  cs_sles_it_t *c = static_cast<cs_sles_it_t *>(context);
+
+  cs_sles_convergence_state_t cvg = CS_SLES_CONVERGED;
+
+  if (n_vecs < 1)
+    return cvg;
+
+  bool simultaneous = (   c->type == CS_SLES_PCG
+                       && cs_matrix_get_diag_block_size(a) == 1
+                       && c->on_device == false
+                       && n_vecs > 1);
+
+#if defined(HAVE_MPI)
+  if (c->comm != c->caller_comm)
+    simultaneous = false;
+#endif
+
+  /* Solve systems one by one if they cannot be grouped */
+
+  if (simultaneous == false) {
+
+    const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+
+    cs_real_t *_rhs, *_vx;
+    BFT_MALLOC(_rhs, n_rows, cs_real_t);
+    BFT_MALLOC(_vx, n_cols, cs_real_t);
+
+    for (int k = 0; k < n_vecs; k++) {
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        _rhs[ii] = rhs[ii*n_vecs + k];
+        _vx[ii] = vx[ii*n_vecs + k];
+      }
+
+      cs_sles_convergence_state_t _cvg
+        = cs_sles_it_solve(c, name, a, verbosity, precision, r_norm[k],
+                           n_iter + k, residual + k, _rhs, _vx, _vx,
+                           0, nullptr);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        vx[ii*n_vecs + k] = _vx[ii];
+
+      if (_cvg < cvg)
+        cvg = _cvg;
+
+    }
+
+    BFT_FREE(_vx);
+    BFT_FREE(_rhs);
+
+    return cvg;
+  }
+
+  /* Simultaneous solve */
+
+  cs_timer_t t0 = {0, 0}, t1;
+
+  if (c->update_stats == true)
+    t0 = cs_timer_time();
+
+  if (c->setup_data == nullptr) {
+
+    if (c->update_stats) { /* Stop solve timer to switch to setup timer */
+      t1 = cs_timer_time();
+      cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+    }
+
+    cs_timer_t t_s0 = cs_timer_time();
+
+    cs_sles_it_setup(c, name, a, verbosity);
+
+    cs_timer_t t_s1 = cs_timer_time();
+    cs_sles_telemetry_add_setup_time(  (t_s1.sec - t_s0.sec)
+                                     + (t_s1.nsec - t_s0.nsec)*1e-9);
+
+    if (c->update_stats) /* Restart solve timer */
+      t0 = cs_timer_time();
+
+  }
+
+  if (c->pc != nullptr) {
+    double r_norm_min = r_norm[0];
+    for (int k = 1; k < n_vecs; k++)
+      r_norm_min = CS_MIN(r_norm_min, r_norm[k]);
+    cs_sles_pc_set_tolerance(c->pc, precision, r_norm_min);
+  }
+
+  c->setup_data->initial_residual = -1;
+
+  cvg = _conjugate_gradient_multi(c, name, a, n_vecs, verbosity, precision,
+                                  r_norm, n_iter, residual, rhs, vx);
+
+  if (c->update_stats == true) {
+
+    t1 = cs_timer_time();
+
+    for (int k = 0; k < n_vecs; k++) {
+
+      unsigned _n_iter = n_iter[k];
+
+      c->n_solves += 1;
+
+      if (c->n_iterations_tot == 0)
+        c->n_iterations_min = _n_iter;
+      else if (c->n_iterations_min > _n_iter)
+        c->n_iterations_min = _n_iter;
+      if (c->n_iterations_max < _n_iter)
+        c->n_iterations_max = _n_iter;
+
+      c->n_iterations_last = _n_iter;
+      c->n_iterations_tot += _n_iter;
+
+    }
+
+    cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+
+  }
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free iterative sparse linear equation solver setup context.
@@ -5365,6 +6547,70 @@ cs_sles_it_set_restart_interval(cs_sles_it_t  *context,
   context->restart_interval = interval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the size of the subspace recycled from one solve to the next.
+ *
+ * This is currently only used by the preconditioned conjugate gradient
+ * (\ref CS_SLES_PCG), which then switches to a deflated variant: the
+ * solution increments of previous solves (which are dominated by the
+ * slowly converging low modes) are kept in an A-orthonormal basis,
+ * used both to improve the initial guess and to deflate the search
+ * directions. This is mostly useful for sequences of slowly varying
+ * systems, such as pressure in transient computations.
+ *
+ * Setting a value < 1 deactivates recycling and frees the subspace.
+ * The value is limited to 16.
+ *
+ * \param[in, out]  context    pointer to iterative solver info and context
+ * \param[in]       n_vectors  maximum number of recycled vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_recycling(cs_sles_it_t  *context,
+                         int            n_vectors)
+{
+  if (context == nullptr)
+    return;
+
+  cs_sles_it_recycle_t *rc = context->recycle;
+
+  if (n_vectors < 1) {
+    if (rc != nullptr) {
+      BFT_FREE(rc->w);
+      BFT_FREE(rc->aw);
+      BFT_FREE(context->recycle);
+    }
+    return;
+  }
+
+  if (n_vectors > CS_SLES_IT_RECYCLE_MAX)
+    n_vectors = CS_SLES_IT_RECYCLE_MAX;
+
+  if (rc == nullptr) {
+    BFT_MALLOC(rc, 1, cs_sles_it_recycle_t);
+    rc->n_max = 0;
+    rc->w = nullptr;
+    rc->aw = nullptr;
+    context->recycle = rc;
+  }
+  else if (rc->n_max == n_vectors)
+    return;
+
+  /* Any change of size resets the subspace */
+
+  BFT_FREE(rc->w);
+  BFT_FREE(rc->aw);
+
+  rc->n_max = n_vectors;
+  rc->n_vecs = 0;
+  rc->next = 0;
+  rc->stale = false;
+  rc->n_rows = -1;
+  rc->stride = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define the max. number of iterations before stopping the algorithm
@@ -68,6 +68,9 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_PIPELINED_PCG,       /*!< Pipelined preconditioned conjugate
+                                    gradient (single non-blocking reduction
+                                    per iteration) */
   CS_SLES_USER_DEFINED,        /*!< User-defined iterative solver */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
@@ -75,6 +78,8 @@ typedef enum {
 
   CS_SLES_TS_F_GAUSS_SEIDEL,   /*!< Truncated forward Gauss-Seidel smoother */
   CS_SLES_TS_B_GAUSS_SEIDEL,   /*!< Truncated backward Gauss-Seidel smoother */
+  CS_SLES_CHEBYSHEV,           /*!< Jacobi-preconditioned Chebyshev polynomial
+                                    smoother */
 
   CS_SLES_N_SMOOTHER_TYPES     /*!< Number of resolution algorithms
                                     including smoother only */
@@ -274,6 +279,50 @@ cs_sles_it_solve(void                *context,
                  size_t               aux_size,
                  void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Call iterative sparse linear equation solver for a set of independent
+ * systems sharing the same matrix.
+ *
+ * Right-hand sides and solutions are interleaved, so value i of system k
+ * is found at position i*n_vecs + k; vx must thus be sized for
+ * n_cols_ext*n_vecs values, and is considered initialized on entry.
+ *
+ * With a scalar matrix and the conjugate gradient solver (and the solve
+ * not restricted to a subset of ranks), systems are solved simultaneously,
+ * using a single matrix pass per iteration for all right-hand sides and
+ * grouped global reductions. Otherwise, systems are solved one by one.
+ *
+ * parameters:
+ *   context       <-> pointer to iterative sparse linear solver info
+ *                     (actual type: cs_sles_it_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   n_vecs        <-- number of systems
+ *   verbosity     <-- verbosity level
+ *   precision     <-- solver precision
+ *   r_norm        <-- residual normalization, per system
+ *   n_iter        --> number of iterations, per system
+ *   residual      --> residual, per system
+ *   rhs           <-- right hand sides (interleaved)
+ *   vx            <-> system solutions (interleaved)
+ *
+ * returns:
+ *   convergence state of the least converged system
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  n_vecs,
+                       int                  verbosity,
+                       double               precision,
+                       const double         r_norm[],
+                       int                  n_iter[],
+                       double               residual[],
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------
  * Free iterative sparse linear equation solver setup context.
  *
@@ -517,6 +566,30 @@ void
 cs_sles_it_set_restart_interval(cs_sles_it_t  *context,
                                 int            interval);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the size of the subspace recycled from one solve to the next.
+ *
+ * This is currently only used by the preconditioned conjugate gradient
+ * (\ref CS_SLES_PCG), which then switches to a deflated variant: the
+ * solution increments of previous solves (which are dominated by the
+ * slowly converging low modes) are kept in an A-orthonormal basis,
+ * used both to improve the initial guess and to deflate the search
+ * directions. This is mostly useful for sequences of slowly varying
+ * systems, such as pressure in transient computations.
+ *
+ * Setting a value < 1 deactivates recycling and frees the subspace.
+ * The value is limited to 16.
+ *
+ * \param[in, out]  context    pointer to iterative solver info and context
+ * \param[in]       n_vectors  maximum number of recycled vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_recycling(cs_sles_it_t  *context,
+                         int            n_vectors);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define the max. number of iterations before stopping the algorithm
@@ -1194,6 +1194,123 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
 
 BEGIN_C_DECLS
 
+/*----------------------------------------------------------------------------
+ * Chebyshev smoother initialization: rk <- rhs - rk; dk <- D^-1.rk / theta.
+ *
+ * parameters:
+ *   n_rows    <-- number of rows
+ *   theta_inv <-- inverse of center of targeted eigenvalue interval
+ *   ad_inv    <-- inverse of diagonal
+ *   rhs       <-- right hand side
+ *   rk        <-> A.vx on input, residual on output
+ *   dk        --> initial update direction
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_chebyshev_init(cs_lnum_t                      n_rows,
+                cs_real_t                      theta_inv,
+                const cs_real_t  *__restrict__ ad_inv,
+                const cs_real_t  *__restrict__ rhs,
+                cs_real_t        *__restrict__ rk,
+                cs_real_t        *__restrict__ dk)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n_rows) {
+    cs_real_t r = rhs[ii] - rk[ii];
+    rk[ii] = r;
+    dk[ii] = ad_inv[ii]*r*theta_inv;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Chebyshev smoother initialization when initial solution is zero:
+ * vx <- 0; rk <- rhs; dk <- D^-1.rk / theta.
+ *
+ * parameters:
+ *   n_rows    <-- number of rows
+ *   theta_inv <-- inverse of center of targeted eigenvalue interval
+ *   ad_inv    <-- inverse of diagonal
+ *   rhs       <-- right hand side
+ *   vx        --> solution
+ *   rk        --> residual
+ *   dk        --> initial update direction
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_chebyshev_init_vx0(cs_lnum_t                      n_rows,
+                    cs_real_t                      theta_inv,
+                    const cs_real_t  *__restrict__ ad_inv,
+                    const cs_real_t  *__restrict__ rhs,
+                    cs_real_t        *__restrict__ vx,
+                    cs_real_t        *__restrict__ rk,
+                    cs_real_t        *__restrict__ dk)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n_rows) {
+    vx[ii] = 0.;
+    rk[ii] = rhs[ii];
+    dk[ii] = ad_inv[ii]*rhs[ii]*theta_inv;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Chebyshev smoother iteration, with zk = A.dk:
+ * vx <- vx + dk; rk <- rk - zk; dk <- c_d.dk + c_r.D^-1.rk.
+ *
+ * parameters:
+ *   n_rows <-- number of rows
+ *   c_d    <-- previous direction coefficient
+ *   c_r    <-- preconditioned residual coefficient
+ *   ad_inv <-- inverse of diagonal
+ *   zk     <-- A.dk
+ *   vx     <-> solution
+ *   rk     <-> residual
+ *   dk     <-> update direction
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_chebyshev_update(cs_lnum_t                      n_rows,
+                  cs_real_t                      c_d,
+                  cs_real_t                      c_r,
+                  const cs_real_t  *__restrict__ ad_inv,
+                  const cs_real_t  *__restrict__ zk,
+                  cs_real_t        *__restrict__ vx,
+                  cs_real_t        *__restrict__ rk,
+                  cs_real_t        *__restrict__ dk)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n_rows) {
+    cs_real_t d = dk[ii];
+    cs_real_t r = rk[ii] - zk[ii];
+    vx[ii] += d;
+    rk[ii] = r;
+    dk[ii] = c_d*d + c_r*ad_inv[ii]*r;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute y <- y + x.
+ *
+ * parameters:
+ *   n  <-- number of elements
+ *   x  <-- vector of elements
+ *   y  <-> vector of elements
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_chebyshev_add(cs_lnum_t                      n,
+               const cs_real_t  *__restrict__ x,
+               cs_real_t        *__restrict__ y)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n)
+    y[ii] += x[ii];
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -1437,6 +1554,165 @@ cs_sles_it_cuda_jacobi(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using a Jacobi-preconditioned Chebyshev
+ * polynomial smoother (CUDA version).
+ *
+ * The polynomial degree is given by the maximum number of iterations,
+ * and eigenvalue bounds are those determined at setup. Each iteration
+ * requires only one matrix.vector product, with no global reduction.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_cuda_chebyshev(cs_sles_it_t              *c,
+                          const cs_matrix_t         *a,
+                          cs_lnum_t                  diag_block_size,
+                          cs_sles_it_convergence_t  *convergence,
+                          const cs_real_t           *rhs,
+                          cs_real_t                 *vx_ini,
+                          cs_real_t                 *vx,
+                          size_t                     aux_size,
+                          void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+
+  unsigned n_iter = 0;
+
+  bool local_stream = false;
+  cudaStream_t stream;
+  stream = cs_matrix_spmv_cuda_get_stream();
+  if (stream == 0) {
+    local_stream = true;
+    cudaStreamCreate(&stream);
+  }
+
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+
+  size_t vec_size = n_cols * sizeof(cs_real_t);
+
+  /* Prefetch in case it is needed (see Jacobi variant) */
+  {
+    cs_alloc_mode_t amode_vx = cs_check_device_ptr(vx);
+    cs_alloc_mode_t amode_rhs = cs_check_device_ptr(rhs);
+
+    if (amode_vx == CS_ALLOC_HOST_DEVICE_SHARED && vx_ini == vx)
+      cs_cuda_prefetch_h2d(vx, vec_size);
+
+    if (amode_rhs == CS_ALLOC_HOST_DEVICE_SHARED)
+      cs_cuda_prefetch_h2d(rhs, vec_size);
+  }
+
+  assert(c->setup_data != NULL);
+
+  const cs_real_t *__restrict__ ad_inv
+    = cs_get_device_ptr_const(c->setup_data->ad_inv);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  /* Allocate or map work arrays
+     --------------------------- */
+
+  cs_real_t *_aux_vectors = NULL;
+  const size_t n_wa = 3;
+  const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+  if (n_cols > 0) {
+    if (   aux_vectors == NULL
+        || cs_cuda_is_device_ptr(aux_vectors) == false
+        || aux_size/sizeof(cs_real_t) < (wa_size * n_wa)) {
+#if defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
+      cudaMalloc(&_aux_vectors, wa_size * n_wa *sizeof(cs_real_t));
+#else
+      cudaMallocManaged(&_aux_vectors, wa_size * n_wa *sizeof(cs_real_t));
+#endif
+    }
+    else
+      _aux_vectors = (cs_real_t *)aux_vectors;
+  }
+
+  cs_real_t *__restrict__ rk = _aux_vectors;
+  cs_real_t *__restrict__ dk = _aux_vectors + wa_size;
+  cs_real_t *__restrict__ zk = _aux_vectors + wa_size*2;
+
+  const unsigned int blocksize = 256;
+  unsigned int gridsize = cs_cuda_grid_size(n_rows, blocksize);
+
+  if (local_stream)
+    cs_matrix_spmv_cuda_set_stream(stream);
+
+  /* Polynomial coefficients */
+
+  const double *eig_bounds = c->setup_data->eig_bounds;
+  const double theta = 0.5*(eig_bounds[1] + eig_bounds[0]);
+  const double delta = 0.5*(eig_bounds[1] - eig_bounds[0]);
+
+  const double sigma = theta / delta;
+  double rho = 1. / sigma;
+
+  /* Initial residual and direction
+     ------------------------------ */
+
+  if (vx_ini != vx)
+    _chebyshev_init_vx0<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, 1./theta, ad_inv, rhs, vx, rk, dk);
+  else {
+    cs_matrix_vector_multiply_d(a, vx, rk);
+    _chebyshev_init<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, 1./theta, ad_inv, rhs, rk, dk);
+  }
+
+  /* Current iteration
+     ----------------- */
+
+  for (n_iter = 1; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    cudaStreamSynchronize(stream);
+
+    cs_matrix_vector_multiply_d(a, dk, zk);
+
+    const double rho_n = 1. / (2.*sigma - rho);
+
+    _chebyshev_update<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, rho_n*rho, 2.*rho_n/delta, ad_inv, zk, vx, rk, dk);
+
+    rho = rho_n;
+
+  }
+
+  _chebyshev_add<<<gridsize, blocksize, 0, stream>>>(n_rows, dk, vx);
+
+  cudaStreamSynchronize(stream);
+
+  if (_aux_vectors != (cs_real_t *)aux_vectors)
+    cudaFree(_aux_vectors);
+
+  if (local_stream) {
+    cs_matrix_spmv_cuda_set_stream(0);
+    cudaStreamDestroy(stream);
+  }
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using block Jacobi (CUDA version).
  *
@@ -93,6 +93,43 @@ cs_sles_it_cuda_jacobi(cs_sles_it_t              *c,
                        size_t                     aux_size,
                        void                      *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using a Jacobi-preconditioned Chebyshev
+ * polynomial smoother (CUDA version).
+ *
+ * The polynomial degree is given by the maximum number of iterations,
+ * and eigenvalue bounds are those determined at setup. Each iteration
+ * requires only one matrix.vector product, with no global reduction.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_cuda_chebyshev(cs_sles_it_t              *c,
+                          const cs_matrix_t         *a,
+                          cs_lnum_t                  diag_block_size,
+                          cs_sles_it_convergence_t  *convergence,
+                          const cs_real_t           *rhs,
+                          cs_real_t                 *vx_ini,
+                          cs_real_t                 *vx,
+                          size_t                     aux_size,
+                          void                      *aux_vectors);
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using block Jacobi.
  *
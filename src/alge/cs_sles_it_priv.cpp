@@ -240,6 +240,8 @@ cs_sles_it_setup_priv(cs_sles_it_t       *c,
     sd->_ad_inv = nullptr;
     sd->pc_context = nullptr;
     sd->pc_apply = nullptr;
+    sd->eig_bounds[0] = 0;
+    sd->eig_bounds[1] = 0;
   }
 
   sd->n_rows = cs_matrix_get_n_rows(a) * diag_block_size;
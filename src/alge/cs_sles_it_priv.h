@@ -54,6 +54,7 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_comm_stats.h"
 #include "cs_file.h"
 #include "cs_log.h"
 #include "cs_halo.h"
@@ -89,6 +90,10 @@ BEGIN_C_DECLS
 
 #define DB_SIZE_MAX 9
 
+/* Maximum number of vectors in a recycled (deflation) subspace */
+
+#define CS_SLES_IT_RECYCLE_MAX 16
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -138,6 +143,10 @@ typedef struct _cs_sles_it_setup_t {
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
+  double               eig_bounds[2];    /* eigenvalue bounds of D^-1.A
+                                            targeted by polynomial
+                                            smoothers (if used) */
+
 } cs_sles_it_setup_t;
 
 /* Solver additional data */
@@ -149,6 +158,27 @@ typedef struct _cs_sles_it_add_t {
 
 } cs_sles_it_add_t;
 
+/* Recycled (deflation) subspace data */
+/*------------------------------------*/
+
+typedef struct _cs_sles_it_recycle_t {
+
+  int                  n_max;            /* maximum number of vectors */
+  int                  n_vecs;           /* current number of vectors */
+  int                  next;             /* id of next vector to replace
+                                            when the subspace is full */
+
+  bool                 stale;            /* true if the matrix changed
+                                            since the last solve */
+
+  cs_lnum_t            n_rows;           /* number of associated rows */
+  cs_lnum_t            stride;           /* allocated size of each vector */
+
+  cs_real_t           *w;                /* A-orthonormal basis vectors */
+  cs_real_t           *aw;               /* associated A.w products */
+
+} cs_sles_it_recycle_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -220,6 +250,8 @@ struct _cs_sles_it_t {
 
   cs_sles_it_setup_t          *setup_data; /* setup data */
 
+  cs_sles_it_recycle_t        *recycle;    /* recycled subspace, or NULL */
+
   /* Alternative solvers (fallback or heuristics) */
 
   cs_sles_convergence_state_t  fallback_cvg;  /* threshold for fallback
@@ -277,7 +309,7 @@ _dot_product(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum;
-    MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_comm_allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
     s = _sum;
   }
 
@@ -309,7 +341,7 @@ _dot_product_xx(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum;
-    MPI_Allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_comm_allreduce(&s, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
     s = _sum;
   }
 
@@ -344,7 +376,7 @@ _dot_products_xx_xy(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[2];
-    MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_comm_allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
     s[0] = _sum[0];
     s[1] = _sum[1];
   }
@@ -383,7 +415,7 @@ _dot_products_xy_yz(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[2];
-    MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_comm_allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
     s[0] = _sum[0];
     s[1] = _sum[1];
   }
@@ -425,7 +457,7 @@ _dot_products_xx_xy_yz(const cs_sles_it_t  *c,
   if (c->comm != MPI_COMM_NULL) {
     double _sum[3];
 
-    MPI_Allreduce(s, _sum, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_comm_allreduce(s, _sum, 3, MPI_DOUBLE, MPI_SUM, c->comm);
     s[0] = _sum[0];
     s[1] = _sum[1];
     s[2] = _sum[2];
@@ -472,7 +504,7 @@ _dot_products_xx_yy_xy_xz_yz(const cs_sles_it_t  *c,
 
   if (c->comm != MPI_COMM_NULL) {
     double _sum[5];
-    MPI_Allreduce(s, _sum, 5, MPI_DOUBLE, MPI_SUM, c->comm);
+    cs_comm_allreduce(s, _sum, 5, MPI_DOUBLE, MPI_SUM, c->comm);
     memcpy(s, _sum, 5*sizeof(double));
   }
 
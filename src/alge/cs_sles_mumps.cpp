@@ -155,6 +155,7 @@ struct _cs_sles_mumps_t {
 
   int                  n_tries;       /* Number of analysis/facto done */
   int                  n_setups;      /* Number of times system setup */
+  int                  n_analyses;    /* Number of analysis steps done */
   int                  n_solves;      /* Number of times system solved since
                                        * it's a direct solver thus
                                        * n_solves = n_iterations_tot */
@@ -2530,6 +2531,216 @@ _automatic_smumps_settings_before_facto(const cs_param_sles_t   *slesp,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the MUMPS instance (and thus its analysis) has to be kept
+ *        from one setup to another
+ *
+ * \param[in] c   pointer to the context structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_keep_analysis(const cs_sles_mumps_t  *c)
+{
+  if (c->sles_param == nullptr)
+    return false;
+
+  const cs_param_mumps_t *mumpsp
+    = static_cast<const cs_param_mumps_t *>(c->sles_param->context_param);
+
+  if (mumpsp == nullptr)
+    return false;
+
+  return mumpsp->keep_analysis;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Terminate the MUMPS instance and free the arrays defining the
+ *        linear system
+ *
+ * \param[in, out] c   pointer to the context structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_mumps_struct(cs_sles_mumps_t  *c)
+{
+  if (c->mumps_struct == nullptr)
+    return;
+
+  if (_is_dmumps(c)) {
+    DMUMPS_STRUC_C *dmumps = static_cast<DMUMPS_STRUC_C *>(c->mumps_struct);
+
+    dmumps->job = MUMPS_JOB_END;
+    dmumps_c(dmumps);
+
+    if (cs_glob_n_ranks == 1) {
+
+      BFT_FREE(dmumps->irn);
+      BFT_FREE(dmumps->jcn);
+      BFT_FREE(dmumps->a);
+
+    }
+    else {
+
+      BFT_FREE(dmumps->irn_loc);
+      BFT_FREE(dmumps->jcn_loc);
+      BFT_FREE(dmumps->a_loc);
+
+    }
+
+    BFT_FREE(dmumps);
+
+  }
+  else {
+    SMUMPS_STRUC_C *smumps = static_cast<SMUMPS_STRUC_C *>(c->mumps_struct);
+
+    smumps->job = MUMPS_JOB_END;
+    smumps_c(smumps);
+
+    if (cs_glob_n_ranks == 1) {
+
+      BFT_FREE(smumps->irn);
+      BFT_FREE(smumps->jcn);
+      BFT_FREE(smumps->a);
+
+    }
+    else {
+
+      BFT_FREE(smumps->irn_loc);
+      BFT_FREE(smumps->jcn_loc);
+      BFT_FREE(smumps->a_loc);
+
+    }
+
+    BFT_FREE(smumps);
+
+  }
+
+  c->mumps_struct = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Detach the sparsity pattern of the linear system stored in a MUMPS
+ *        instance kept from a previous setup. Values are freed since they
+ *        are always redefined.
+ *
+ * \param[in, out] c     pointer to the context structure
+ * \param[out]     nnz   number of (local) non-zero entries
+ * \param[out]     irn   (local) row indices to free by the caller
+ * \param[out]     jcn   (local) column indices to free by the caller
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_detach_pattern(cs_sles_mumps_t   *c,
+                MUMPS_INT8        *nnz,
+                MUMPS_INT        **irn,
+                MUMPS_INT        **jcn)
+{
+  if (_is_dmumps(c)) {
+    DMUMPS_STRUC_C *dmumps = static_cast<DMUMPS_STRUC_C *>(c->mumps_struct);
+
+    if (cs_glob_n_ranks == 1) {
+
+      *nnz = dmumps->nnz, *irn = dmumps->irn, *jcn = dmumps->jcn;
+      dmumps->irn = nullptr, dmumps->jcn = nullptr;
+      BFT_FREE(dmumps->a);
+
+    }
+    else {
+
+      *nnz = dmumps->nnz_loc, *irn = dmumps->irn_loc, *jcn = dmumps->jcn_loc;
+      dmumps->irn_loc = nullptr, dmumps->jcn_loc = nullptr;
+      BFT_FREE(dmumps->a_loc);
+
+    }
+
+  }
+  else {
+    SMUMPS_STRUC_C *smumps = static_cast<SMUMPS_STRUC_C *>(c->mumps_struct);
+
+    if (cs_glob_n_ranks == 1) {
+
+      *nnz = smumps->nnz, *irn = smumps->irn, *jcn = smumps->jcn;
+      smumps->irn = nullptr, smumps->jcn = nullptr;
+      BFT_FREE(smumps->a);
+
+    }
+    else {
+
+      *nnz = smumps->nnz_loc, *irn = smumps->irn_loc, *jcn = smumps->jcn_loc;
+      smumps->irn_loc = nullptr, smumps->jcn_loc = nullptr;
+      BFT_FREE(smumps->a_loc);
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the sparsity pattern currently stored in the MUMPS
+ *        instance is identical (on all ranks) to a previous one
+ *
+ * \param[in] c          pointer to the context structure
+ * \param[in] prev_nnz   previous number of (local) non-zero entries
+ * \param[in] prev_irn   previous (local) row indices
+ * \param[in] prev_jcn   previous (local) column indices
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_same_pattern(const cs_sles_mumps_t  *c,
+              MUMPS_INT8              prev_nnz,
+              const MUMPS_INT        *prev_irn,
+              const MUMPS_INT        *prev_jcn)
+{
+  MUMPS_INT8  nnz = 0;
+  const MUMPS_INT  *irn = nullptr, *jcn = nullptr;
+
+  if (_is_dmumps(c)) {
+    const DMUMPS_STRUC_C *dmumps
+      = static_cast<const DMUMPS_STRUC_C *>(c->mumps_struct);
+
+    if (cs_glob_n_ranks == 1)
+      nnz = dmumps->nnz, irn = dmumps->irn, jcn = dmumps->jcn;
+    else
+      nnz = dmumps->nnz_loc, irn = dmumps->irn_loc, jcn = dmumps->jcn_loc;
+  }
+  else {
+    const SMUMPS_STRUC_C *smumps
+      = static_cast<const SMUMPS_STRUC_C *>(c->mumps_struct);
+
+    if (cs_glob_n_ranks == 1)
+      nnz = smumps->nnz, irn = smumps->irn, jcn = smumps->jcn;
+    else
+      nnz = smumps->nnz_loc, irn = smumps->irn_loc, jcn = smumps->jcn_loc;
+  }
+
+  int  differ = 0;
+
+  if (nnz != prev_nnz)
+    differ = 1;
+  else if (nnz > 0) {
+    size_t  size = nnz*sizeof(MUMPS_INT);
+    if (   memcmp(irn, prev_irn, size) != 0
+        || memcmp(jcn, prev_jcn, size) != 0)
+      differ = 1;
+  }
+
+  cs_parall_max(1, CS_INT_TYPE, &differ);
+
+  return (differ == 0);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -2685,6 +2896,7 @@ cs_sles_mumps_create(const cs_param_sles_t       *slesp,
 
   c->n_tries = 0;
   c->n_setups = 0;
+  c->n_analyses = 0;
   c->n_solves = 0;
 
   CS_TIMER_COUNTER_INIT(c->t_setup);
@@ -2757,60 +2969,11 @@ cs_sles_mumps_free(void  *context)
   cs_timer_t t0;
   t0 = cs_timer_time();
 
-  if (c->mumps_struct != nullptr) {
+  /* When the analysis is kept, the MUMPS instance is terminated only when the
+     context is destroyed */
 
-    if (_is_dmumps(c)) {
-      DMUMPS_STRUC_C *dmumps = static_cast<DMUMPS_STRUC_C *>(c->mumps_struct);
-
-      dmumps->job = MUMPS_JOB_END;
-      dmumps_c(dmumps);
-
-      if (cs_glob_n_ranks == 1) {
-
-        BFT_FREE(dmumps->irn);
-        BFT_FREE(dmumps->jcn);
-        BFT_FREE(dmumps->a);
-
-      }
-      else {
-
-        BFT_FREE(dmumps->irn_loc);
-        BFT_FREE(dmumps->jcn_loc);
-        BFT_FREE(dmumps->a_loc);
-
-      }
-
-      BFT_FREE(dmumps);
-
-    }
-    else {
-      SMUMPS_STRUC_C *smumps = static_cast<SMUMPS_STRUC_C *>(c->mumps_struct);
-
-      smumps->job = MUMPS_JOB_END;
-      smumps_c(smumps);
-
-      if (cs_glob_n_ranks == 1) {
-
-        BFT_FREE(smumps->irn);
-        BFT_FREE(smumps->jcn);
-        BFT_FREE(smumps->a);
-
-      }
-      else {
-
-        BFT_FREE(smumps->irn_loc);
-        BFT_FREE(smumps->jcn_loc);
-        BFT_FREE(smumps->a_loc);
-
-      }
-
-      BFT_FREE(smumps);
-
-    }
-
-    c->mumps_struct = nullptr;
-
-  } /* MUMPS structure is not freed */
+  if (!_keep_analysis(c))
+    _free_mumps_struct(c);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&(c->t_setup), &t0, &t1);
@@ -2834,6 +2997,7 @@ cs_sles_mumps_destroy(void   **context)
     /* Free structure */
 
     cs_sles_mumps_free(c);
+    _free_mumps_struct(c);
     BFT_FREE(c);
     *context = c;
 
@@ -2901,14 +3065,30 @@ cs_sles_mumps_setup(void               *context,
 
   cs_sles_mumps_t *c = static_cast<cs_sles_mumps_t *>(context);
 
-  c->mumps_struct = nullptr;
+  /* A MUMPS instance may have been kept from a previous setup. Its sparsity
+     pattern is detached to be compared to the new one so that the analysis
+     is skipped when the pattern is unchanged. */
+
+  bool  reuse_instance = (c->mumps_struct != nullptr);
+  bool  do_analysis = true;
+
+  MUMPS_INT8  prev_nnz = 0;
+  MUMPS_INT  *prev_irn = nullptr, *prev_jcn = nullptr;
+
+  if (reuse_instance)
+    _detach_pattern(c, &prev_nnz, &prev_irn, &prev_jcn);
 
   /* 1. Initialize the MUMPS structure */
   /* --------------------------------- */
 
   cs_fp_exception_disable_trap();
 
-  if (_is_dmumps(c)) {
+  if (reuse_instance) {
+
+    /* Nothing to do */
+
+  }
+  else if (_is_dmumps(c)) {
 
     /* Sanity checks: DMUMPS_COMPLEX = DMUMPS_REAL = double
      * (see mumps_c_types.h) */
@@ -3130,6 +3310,15 @@ cs_sles_mumps_setup(void               *context,
 
   } /* End of switch */
 
+  if (reuse_instance) {
+
+    do_analysis = !_same_pattern(c, prev_nnz, prev_irn, prev_jcn);
+
+    BFT_FREE(prev_irn);
+    BFT_FREE(prev_jcn);
+
+  }
+
   /* 3. Analysis and factorization */
   /* ----------------------------- */
 
@@ -3142,20 +3331,26 @@ cs_sles_mumps_setup(void               *context,
 
     do {
 
-      /* Analysis step */
+      /* Analysis step (skipped if the previous one is still valid) */
       /* ------------- */
 
-      dmumps->job = MUMPS_JOB_ANALYSIS;
+      if (do_analysis) {
 
-      _automatic_dmumps_settings_before_analysis(c->type, c->sles_param,
-                                                 dmumps);
+        dmumps->job = MUMPS_JOB_ANALYSIS;
 
-      /* Window to enable advanced user settings (before analysis) */
+        _automatic_dmumps_settings_before_analysis(c->type, c->sles_param,
+                                                   dmumps);
 
-      if (c->setup_hook != nullptr)
-        c->setup_hook(c->sles_param, c->hook_context, dmumps);
+        /* Window to enable advanced user settings (before analysis) */
 
-      dmumps_c(dmumps);
+        if (c->setup_hook != nullptr)
+          c->setup_hook(c->sles_param, c->hook_context, dmumps);
+
+        dmumps_c(dmumps);
+
+        c->n_analyses += 1;
+
+      }
 
       /* Factorization step */
       /* ------------------ */
@@ -3176,6 +3371,8 @@ cs_sles_mumps_setup(void               *context,
       infog1 = dmumps->INFOG(1);
       infog2 = dmumps->INFOG(2);
 
+      do_analysis = true; /* A new try always performs a new analysis */
+
     } while (_try_again_dmumps(c));
 
   }
@@ -3184,20 +3381,26 @@ cs_sles_mumps_setup(void               *context,
 
     do {
 
-      /* Analysis step */
+      /* Analysis step (skipped if the previous one is still valid) */
       /* ------------- */
 
-      smumps->job = MUMPS_JOB_ANALYSIS;
+      if (do_analysis) {
 
-      _automatic_smumps_settings_before_analysis(c->type, c->sles_param,
-                                                 smumps);
+        smumps->job = MUMPS_JOB_ANALYSIS;
 
-      /* Window to enable advanced user settings (before analysis) */
+        _automatic_smumps_settings_before_analysis(c->type, c->sles_param,
+                                                   smumps);
 
-      if (c->setup_hook != nullptr)
-        c->setup_hook(c->sles_param, c->hook_context, smumps);
+        /* Window to enable advanced user settings (before analysis) */
 
-      smumps_c(smumps);
+        if (c->setup_hook != nullptr)
+          c->setup_hook(c->sles_param, c->hook_context, smumps);
+
+        smumps_c(smumps);
+
+        c->n_analyses += 1;
+
+      }
 
       /* Factorization step */
       /* ------------------ */
@@ -3218,6 +3421,8 @@ cs_sles_mumps_setup(void               *context,
       infog1 = smumps->INFOG(1);
       infog2 = smumps->INFOG(2);
 
+      do_analysis = true; /* A new try always performs a new analysis */
+
     } while(_try_again_smumps(c));
 
   } /* single-precision case */
@@ -3575,20 +3780,22 @@ cs_sles_mumps_log(const void  *context,
                     _("\n"
                       "  Preconditioner type:           MUMPS\n"
                       "  Number of setups:              %12d\n"
+                      "  Number of analyses:            %12d\n"
                       "  Number of solves:              %12d\n"
                       "  Total setup time:              %12.3f\n"
                       "  Total solution time:           %12.3f\n"),
-                    c->n_setups, c->n_solves,
+                    c->n_setups, c->n_analyses, c->n_solves,
                     c->t_setup.nsec*1e-9, c->t_solve.nsec*1e-9);
     else
       cs_log_printf(log_type,
                     _("\n"
                       "  Solver type:                   MUMPS\n"
                       "  Number of setups:              %12d\n"
+                      "  Number of analyses:            %12d\n"
                       "  Number of solves:              %12d\n"
                       "  Total setup time:              %12.3f\n"
                       "  Total solution time:           %12.3f\n"),
-                    c->n_setups, c->n_solves,
+                    c->n_setups, c->n_analyses, c->n_solves,
                     c->t_setup.nsec*1e-9, c->t_solve.nsec*1e-9);
 
   }
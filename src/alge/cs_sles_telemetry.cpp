@@ -0,0 +1,426 @@
+/*============================================================================
+ * Structured telemetry for sparse linear equation solvers.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+
+#include "cs_base.h"
+#include "cs_parall.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_sles_telemetry.h"
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_sles_telemetry.cpp
+        Structured telemetry for sparse linear equation solvers.
+
+  Records are written in the JSON lines format (one JSON object per line),
+  so as to be easily ingested by monitoring tools. Only rank 0 writes
+  records; records are accumulated in a memory buffer which is written
+  when full, at explicit flush calls, and at finalization, so as to
+  avoid small writes in the solver loop.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Buffer size above which records are written */
+
+#define _FLUSH_SIZE  (1024*1024)
+
+/* Maximum number of residuals recorded per solve */
+
+#define _N_RESIDUALS_MAX  1000
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static bool    _active = false;
+static FILE   *_f = nullptr;
+static char   *_path = nullptr;
+
+static size_t  _buf_size = 0;
+static size_t  _buf_max = 0;
+static char   *_buf = nullptr;
+
+static int          _depth = 0;           /* solve nesting depth */
+static const void  *_top_context = nullptr;
+
+static int      _n_residuals = 0;
+static int      _n_residuals_tot = 0;
+static double  *_residuals = nullptr;
+
+static double   _setup_time = 0;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Append formatted string to record buffer.
+ *
+ * parameters:
+ *   format <-- format string, as printf() and family
+ *   ...    <-- variable arguments based on format
+ *----------------------------------------------------------------------------*/
+
+static void
+_append(const char  *format,
+        ...)
+{
+  va_list  arg_ptr;
+
+  va_start(arg_ptr, format);
+  int l = vsnprintf(_buf + _buf_size, _buf_max - _buf_size, format, arg_ptr);
+  va_end(arg_ptr);
+
+  if (_buf_size + l + 1 > _buf_max) {
+    _buf_max = CS_MAX(_buf_max*2, _buf_size + l + 1);
+    BFT_REALLOC(_buf, _buf_max, char);
+    va_start(arg_ptr, format);
+    vsnprintf(_buf + _buf_size, _buf_max - _buf_size, format, arg_ptr);
+    va_end(arg_ptr);
+  }
+
+  _buf_size += l;
+}
+
+/*----------------------------------------------------------------------------
+ * Append JSON string value to record buffer.
+ *
+ * parameters:
+ *   s <-- string to append (quotes and control characters are escaped)
+ *----------------------------------------------------------------------------*/
+
+static void
+_append_string(const char  *s)
+{
+  _append("\"");
+
+  if (s != nullptr) {
+    for (const char *p = s; *p != '\0'; p++) {
+      if (*p == '"' || *p == '\\')
+        _append("\\%c", *p);
+      else if ((unsigned char)(*p) < 0x20)
+        _append("\\u%04x", (unsigned)(*p));
+      else
+        _append("%c", *p);
+    }
+  }
+
+  _append("\"");
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate structured solver telemetry.
+ *
+ * One JSON object per line is written to the given file for each
+ * top-level linear system solve, with the time step number, system name,
+ * solver type, global matrix size, iteration count, residual history,
+ * and setup and solve times. Records are buffered and written by blocks.
+ *
+ * Telemetry is also activated at initialization if the
+ * CS_SLES_TELEMETRY environment variable is set to a file name.
+ *
+ * \param[in]  path  output file name, or nullptr for "sles_telemetry.jsonl"
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_enable(const char  *path)
+{
+  const char *_p = (path != nullptr) ? path : "sles_telemetry.jsonl";
+
+  if (_active) {
+    if (strcmp(_p, _path) == 0)
+      return;
+    cs_sles_telemetry_finalize();
+  }
+
+  BFT_MALLOC(_path, strlen(_p) + 1, char);
+  strcpy(_path, _p);
+
+  if (cs_glob_rank_id < 1) {
+    _f = fopen(_path, "w");
+    if (_f == nullptr)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening solver telemetry file: \"%s\"."), _path);
+    _buf_max = _FLUSH_SIZE + 4096;
+    BFT_MALLOC(_buf, _buf_max, char);
+    BFT_MALLOC(_residuals, _N_RESIDUALS_MAX, double);
+  }
+
+  _buf_size = 0;
+  _depth = 0;
+  _setup_time = 0;
+
+  _active = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether solver telemetry is active.
+ *
+ * \return  true if telemetry is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_telemetry_is_active(void)
+{
+  return _active;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark the beginning of a linear system solve.
+ *
+ * Only the outermost solve is recorded; residuals are only recorded
+ * for the matching solver context, so that inner solves (coarse
+ * grid solvers, smoothers, preconditioners) are ignored.
+ *
+ * \param[in]  context  pointer to solver context
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_solve_begin(const void  *context)
+{
+  if (_active == false)
+    return;
+
+  if (_depth == 0) {
+    _top_context = context;
+    _n_residuals = 0;
+    _n_residuals_tot = 0;
+  }
+
+  _depth += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record a residual for the current solve.
+ *
+ * \param[in]  context   pointer to calling solver context
+ * \param[in]  residual  current (non-normalized) residual
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_add_residual(const void  *context,
+                               double       residual)
+{
+  if (_residuals == nullptr || _depth < 1 || context != _top_context)
+    return;
+
+  if (_n_residuals < _N_RESIDUALS_MAX)
+    _residuals[_n_residuals++] = residual;
+  _n_residuals_tot += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Account for solver setup time.
+ *
+ * Setup time is attributed to the next recorded solve.
+ *
+ * \param[in]  t  elapsed setup time, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_add_setup_time(double  t)
+{
+  if (_active)
+    _setup_time += t;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark the end of a linear system solve and record it.
+ *
+ * This function must be called by all ranks when telemetry is active.
+ *
+ * \param[in]  name          linear system name
+ * \param[in]  solver_type   solver type name
+ * \param[in]  a             matrix
+ * \param[in]  state         convergence state
+ * \param[in]  n_iter        number of iterations
+ * \param[in]  precision     solver precision
+ * \param[in]  r_norm        residual normalization
+ * \param[in]  residual      final residual
+ * \param[in]  solve_time    elapsed solve time, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_solve_end(const char                   *name,
+                            const char                   *solver_type,
+                            const cs_matrix_t            *a,
+                            cs_sles_convergence_state_t   state,
+                            int                           n_iter,
+                            double                        precision,
+                            double                        r_norm,
+                            double                        residual,
+                            double                        solve_time)
+{
+  if (_active == false)
+    return;
+
+  _depth -= 1;
+  if (_depth > 0)
+    return;
+
+  const cs_lnum_t block_size = cs_matrix_get_diag_block_size(a);
+
+  cs_gnum_t n_g_rows = cs_matrix_get_n_rows(a);
+  cs_parall_counter(&n_g_rows, 1);
+
+  if (cs_glob_rank_id < 1) {
+
+    const char *state_name[] = {"diverged", "breakdown", "max_iteration",
+                                "iterating", "converged"};
+
+    const cs_time_step_t *ts = cs_glob_time_step;
+
+    _append("{\"event\": \"solve\", \"nt\": %d, \"t\": %.10g, \"name\": ",
+            ts->nt_cur, ts->t_cur);
+    _append_string(name);
+    _append(", \"solver\": ");
+    _append_string(solver_type);
+    _append(", \"n_rows\": %llu, \"block_size\": %d, \"n_ranks\": %d,"
+            " \"state\": \"%s\", \"n_iter\": %d, \"precision\": %.6g,"
+            " \"r_norm\": %.6g, \"residual\": %.6g,"
+            " \"setup_time\": %.6g, \"solve_time\": %.6g,"
+            " \"residuals\": [",
+            (unsigned long long)n_g_rows, (int)block_size, cs_glob_n_ranks,
+            state_name[state - CS_SLES_DIVERGED], n_iter, precision,
+            r_norm, residual, _setup_time, solve_time);
+    for (int i = 0; i < _n_residuals; i++)
+      _append((i > 0) ? ", %.6g" : "%.6g", _residuals[i]);
+    _append("]");
+    if (_n_residuals_tot > _n_residuals)
+      _append(", \"n_residuals\": %d", _n_residuals_tot);
+    _append("}\n");
+
+    if (_buf_size > _FLUSH_SIZE)
+      cs_sles_telemetry_flush();
+
+  }
+
+  _setup_time = 0;
+  _top_context = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write buffered telemetry records.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_flush(void)
+{
+  if (_f == nullptr || _buf_size == 0)
+    return;
+
+  size_t n_written = fwrite(_buf, 1, _buf_size, _f);
+  if (n_written < _buf_size)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error writing solver telemetry file: \"%s\"."), _path);
+  fflush(_f);
+
+  _buf_size = 0;
+  _buf[0] = '\0';
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Flush telemetry records, close output, and free associated data.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_finalize(void)
+{
+  if (_active == false)
+    return;
+
+  cs_sles_telemetry_flush();
+
+  if (_f != nullptr) {
+    if (fclose(_f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing solver telemetry file: \"%s\"."), _path);
+    _f = nullptr;
+  }
+
+  BFT_FREE(_residuals);
+  BFT_FREE(_buf);
+  BFT_FREE(_path);
+  _buf_size = 0;
+  _buf_max = 0;
+
+  _active = false;
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,168 @@
+#ifndef __CS_SLES_TELEMETRY_H__
+#define __CS_SLES_TELEMETRY_H__
+
+/*============================================================================
+ * Structured telemetry for sparse linear equation solvers.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate structured solver telemetry.
+ *
+ * One JSON object per line is written to the given file for each
+ * top-level linear system solve, with the time step number, system name,
+ * solver type, global matrix size, iteration count, residual history,
+ * and setup and solve times. Records are buffered and written by blocks.
+ *
+ * Telemetry is also activated at initialization if the
+ * CS_SLES_TELEMETRY environment variable is set to a file name.
+ *
+ * \param[in]  path  output file name, or nullptr for "sles_telemetry.jsonl"
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_enable(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether solver telemetry is active.
+ *
+ * \return  true if telemetry is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_telemetry_is_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark the beginning of a linear system solve.
+ *
+ * Only the outermost solve is recorded; residuals are only recorded
+ * for the matching solver context, so that inner solves (coarse
+ * grid solvers, smoothers, preconditioners) are ignored.
+ *
+ * \param[in]  context  pointer to solver context
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_solve_begin(const void  *context);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Record a residual for the current solve.
+ *
+ * \param[in]  context   pointer to calling solver context
+ * \param[in]  residual  current (non-normalized) residual
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_add_residual(const void  *context,
+                               double       residual);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Account for solver setup time.
+ *
+ * Setup time is attributed to the next recorded solve.
+ *
+ * \param[in]  t  elapsed setup time, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_add_setup_time(double  t);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark the end of a linear system solve and record it.
+ *
+ * This function must be called by all ranks when telemetry is active.
+ *
+ * \param[in]  name          linear system name
+ * \param[in]  solver_type   solver type name
+ * \param[in]  a             matrix
+ * \param[in]  state         convergence state
+ * \param[in]  n_iter        number of iterations
+ * \param[in]  precision     solver precision
+ * \param[in]  r_norm        residual normalization
+ * \param[in]  residual      final residual
+ * \param[in]  solve_time    elapsed solve time, in seconds
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_solve_end(const char                   *name,
+                            const char                   *solver_type,
+                            const cs_matrix_t            *a,
+                            cs_sles_convergence_state_t   state,
+                            int                           n_iter,
+                            double                        precision,
+                            double                        r_norm,
+                            double                        residual,
+                            double                        solve_time);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write buffered telemetry records.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_flush(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Flush telemetry records, close output, and free associated data.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_telemetry_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_SLES_TELEMETRY_H__ */
@@ -48,6 +48,7 @@
 #include "cs_all_to_all.h"
 #include "cs_ast_coupling.h"
 #include "cs_balance.h"
+#include "cs_balance_by_zone.h"
 #include "cs_base.h"
 #include "cs_base_fortran.h"
 #include "cs_benchmark.h"
@@ -56,6 +57,7 @@
 #include "cs_calcium.h"
 #include "cs_cdo_main.h"
 #include "cs_cell_to_vertex.h"
+#include "cs_comm_stats.h"
 #include "cs_control.h"
 #include "cs_coupling.h"
 #include "cs_ctwr.h"
@@ -81,9 +83,11 @@
 #include "cs_ibm.h"
 #include "cs_join.h"
 #include "cs_les_inflow.h"
+#include "cs_load_imbalance.h"
 #include "cs_log.h"
 #include "cs_log_setup.h"
 #include "cs_log_iteration.h"
+#include "cs_mem_footprint.h"
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
@@ -105,6 +109,7 @@
 #include "cs_preprocess.h"
 #include "cs_preprocessor_data.h"
 #include "cs_probe.h"
+#include "cs_probe_spectra.h"
 #include "cs_property.h"
 #include "cs_prototypes.h"
 #include "cs_random.h"
@@ -112,6 +117,7 @@
 #include "cs_restart_map.h"
 #include "cs_runaway_check.h"
 #include "cs_setup.h"
+#include "cs_startup_log.h"
 #include "cs_sles.h"
 #include "cs_sles_default.h"
 #include "cs_sat_coupling.h"
@@ -202,6 +208,8 @@ _run(void)
 
   cs_base_sigint_handler_set(_sigint_handler);
 
+  cs_startup_log_phase("system and device initialization");
+
   /* System information */
 
 #if defined(HAVE_MPI)
@@ -273,10 +281,14 @@ _run(void)
   cs_sles_initialize();
   cs_sles_set_default_verbosity(cs_sles_default_get_verbosity);
 
+  cs_startup_log_phase("mesh headers reading");
+
   cs_preprocessor_data_read_headers(cs_glob_mesh,
                                     cs_glob_mesh_builder,
                                     false);
 
+  cs_startup_log_phase("zones and couplings definition");
+
   cs_gui_zones();
   cs_user_zones();
 
@@ -298,6 +310,10 @@ _run(void)
 
     int _rank_id = cs_glob_rank_id, _n_ranks = cs_glob_n_ranks;
 
+    cs_startup_log_phase("calculation setup");
+    int t_top_id
+      = cs_timer_stats_switch(cs_timer_stats_id_by_name("calculation_setup"));
+
     cs_base_fortran_bft_printf_to_f();
 
     const char default_restart_mesh[] = "restart_mesh_input";
@@ -334,6 +350,7 @@ _run(void)
 
     cs_base_fortran_bft_printf_to_c();
 
+    cs_timer_stats_switch(t_top_id);
     cs_timer_stats_set_start_time(cs_glob_time_step->nt_cur);
 
   }
@@ -344,6 +361,8 @@ _run(void)
      this is done after main calculation initialization so that the user
      may have the option of assigning a name to this instance. */
 
+  cs_startup_log_phase("couplings and post-processing initialization");
+
 #if defined(HAVE_MPI)
   cs_coupling_discover_mpi_apps(opts.app_name, NULL);
 #endif
@@ -371,12 +390,17 @@ _run(void)
 
   /* Print info on fields and associated keys and other setup options */
 
-  if (opts.verif == false && opts.preprocess == false && opts.benchmark <= 0)
+  if (opts.verif == false && opts.preprocess == false && opts.benchmark <= 0) {
+    cs_startup_log_phase("setup logging");
     cs_log_setup();
+  }
 
   /* Preprocess mesh */
 
   cs_preprocess_mesh(halo_type);
+
+  cs_startup_log_phase("mesh adjacencies and post-processing meshes");
+
   cs_mesh_adjacencies_initialize();
 
   /* Initialization for turbomachinery computations */
@@ -422,12 +446,15 @@ _run(void)
   }
 
   if (opts.benchmark > 0) {
+    cs_startup_log_finalize();
     int mpi_trace_mode = (opts.benchmark == 2) ? 1 : 0;
     cs_benchmark(mpi_trace_mode);
   }
 
   if (opts.preprocess == false && opts.benchmark <= 0) {
 
+    cs_startup_log_phase("solver structures initialization");
+
     /* Check that mesh seems valid */
 
     cs_mesh_quantities_check_vol(cs_glob_mesh,
@@ -468,6 +495,8 @@ _run(void)
 
           cs_base_fortran_bft_printf_to_c();
 
+          cs_startup_log_finalize();
+
           /*----------------------------------------------
            * Call main calculation function (CDO Kernel)
            *----------------------------------------------*/
@@ -517,6 +546,8 @@ _run(void)
            * Call user calculation function
            *--------------------------------*/
 
+          cs_startup_log_finalize();
+
           cs_user_solver(cs_glob_mesh,
                          cs_glob_mesh_quantities);
 
@@ -528,8 +559,10 @@ _run(void)
 
     }
 
-    /* Finalize gradient computation */
+    /* Finalize balance and gradient computation */
 
+    cs_balance_finalize();
+    cs_balance_by_zone_finalize();
     cs_gradient_finalize();
 
     /* Finalize synthetic inlet condition generation */
@@ -621,6 +654,7 @@ _run(void)
 
   /* Free post processing or logging related structures */
 
+  cs_probe_spectra_finalize();
   cs_probe_finalize();
   cs_post_finalize();
   cs_log_iteration_destroy_all();
@@ -651,6 +685,12 @@ _run(void)
 
   cs_base_finalize_sequence();
 
+  /* Per-rank load imbalance report (requires mesh and timer statistics) */
+
+  cs_startup_log_finalize();
+  cs_load_imbalance_log();
+  cs_mem_footprint_log(_("end of computation"));
+
   /* Free main mesh after printing some statistics */
 
   cs_cell_to_vertex_free();
@@ -670,6 +710,7 @@ _run(void)
   /* CPU times and memory management finalization */
 
   cs_all_to_all_log_finalize();
+  cs_comm_stats_log_finalize();
   cs_io_log_finalize();
 
   cs_timer_stats_finalize();
@@ -697,6 +738,8 @@ main(int    argc,
 
   (void)cs_timer_wtime();
 
+  cs_startup_log_phase("base initialization");
+
   /* First analysis of the command line to determine if MPI is required,
      and MPI initialization if it is. */
 
@@ -769,6 +812,7 @@ main(int    argc,
 
   const char s_param[] = "setup.xml";
   if (cs_file_isreg(s_param)) {
+    cs_startup_log_phase("setup.xml parsing");
     cs_gui_load_file(s_param);
     cs_notebook_load_from_file();
   }
@@ -37,7 +37,7 @@
 !> \param[in]     dt            time step (per cell)
 !_______________________________________________________________________________
 
-subroutine compute_gaseous_chemistry ( dt ) &
+subroutine compute_gaseous_chemistry ( dt, c_cost ) &
   bind(C, name='cs_f_compute_gaseous_chemistry')
 
 !===============================================================================
@@ -68,9 +68,33 @@ implicit none
 
 procedure() :: fexchem_1, fexchem_2, fexchem_3, fexchem_4, chem_roschem
 
+interface
+
+  function cs_atmo_chemistry_isat_retrieve(n_conc, n_in, x, n_out, y) &
+    result(found)                                                     &
+    bind(C, name='cs_atmo_chemistry_isat_retrieve')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int), value :: n_conc, n_in, n_out
+    real(kind=c_double), dimension(*), intent(in) :: x
+    real(kind=c_double), dimension(*), intent(inout) :: y
+    integer(c_int) :: found
+  end function cs_atmo_chemistry_isat_retrieve
+
+  subroutine cs_atmo_chemistry_isat_add(n_conc, n_in, x, n_out, y) &
+    bind(C, name='cs_atmo_chemistry_isat_add')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int), value :: n_conc, n_in, n_out
+    real(kind=c_double), dimension(*), intent(in) :: x, y
+  end subroutine cs_atmo_chemistry_isat_add
+
+end interface
+
 ! Arguments
 
 real(c_double), dimension(*), intent(in) :: dt
+type(c_ptr), value :: c_cost
 
 ! Local Variables
 
@@ -87,15 +111,30 @@ double precision dtc
 integer ncycle
 double precision dtrest
 
+!  Variables used for tabulation (inputs: concentrations, source terms,
+!  kinetic rates, density and time step)
+integer(c_int) n_isat_conc, n_isat_in, found
+double precision xisat(2*nespg+nrg+2)
+
 double precision, dimension(:), pointer :: crom
+double precision, dimension(:), pointer :: cost
 type(pmapper_double_r1), dimension(:), allocatable :: cvar_espg, cvara_espg
 
 !===============================================================================
 
 allocate(cvar_espg(nespg), cvara_espg(nespg))
 
+n_isat_conc = 2*nespg
+n_isat_in = 2*nespg + nrg + 2
+
 call field_get_val_s(icrom, crom)
 
+! Optional measured cost (number of chemistry integration steps per cell)
+cost => null()
+if (c_associated(c_cost)) then
+  call c_f_pointer(c_cost, cost, [ncel])
+endif
+
 ! Arrays of pointers containing the fields values for each species
 ! (loop on cells outside loop on species)
 do ii = 1, nespg
@@ -162,18 +201,45 @@ do iel = 1, ncel
 
   endif ! End test isepchemistry
 
-  ! Rosenbrock resoluion
+  ! Retrieval of tabulated result (if tabulation is active)
+
+  do ii = 1, nespg
+    xisat(ii) = dlconc(ii)
+    xisat(nespg+ii) = source(ii)
+  enddo
+  do ii = 1, nrg
+    xisat(2*nespg+ii) = rk(ii)
+  enddo
+  xisat(n_isat_in-1) = rom
+  xisat(n_isat_in) = dtc
+
+  found = cs_atmo_chemistry_isat_retrieve(n_isat_conc, n_isat_in, xisat, &
+                                          nespg, dlconc)
+
+  if (found.eq.0) then
+
+    ! Rosenbrock resoluion
+
+    ! The maximum time step used for chemistry resolution is dtchemmax
+    if (dtc.le.dtchemmax) then
+      call chem_roschem (dlconc,source,source,conv_factor,dtc,rk,rk)
+      ncycle = 0
+    else
+      ncycle = int(dtc/dtchemmax)
+      dtrest = mod(dtc,dtchemmax)
+      do ii = 1, ncycle
+        call chem_roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk)
+      enddo
+      call chem_roschem (dlconc,source,source,conv_factor,dtrest,rk,rk)
+    endif
+
+    call cs_atmo_chemistry_isat_add(n_isat_conc, n_isat_in, xisat, &
+                                    nespg, dlconc)
+
+    if (associated(cost)) then
+      cost(iel) = cost(iel) + dble(ncycle + 1)
+    endif
 
-  ! The maximum time step used for chemistry resolution is dtchemmax
-  if (dtc.le.dtchemmax) then
-    call chem_roschem (dlconc,source,source,conv_factor,dtc,rk,rk)
-  else
-    ncycle = int(dtc/dtchemmax)
-    dtrest = mod(dtc,dtchemmax)
-    do ii = 1, ncycle
-      call chem_roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk)
-    enddo
-    call chem_roschem (dlconc,source,source,conv_factor,dtrest,rk,rk)
   endif
 
   ! Update of values at current time step
@@ -567,6 +567,8 @@ cs_at_opt_interp_create(const char   *name)
 
   if (!reall) {
     oi->b_proj = NULL;
+    oi->obs_lu = NULL;
+    oi->obs_lu_n = NULL;
     oi->relax = NULL;
     oi->times = NULL;
     oi->times_read = NULL;
@@ -581,6 +583,8 @@ cs_at_opt_interp_create(const char   *name)
   }
   else {
     BFT_FREE(oi->b_proj);
+    BFT_FREE(oi->obs_lu);
+    BFT_FREE(oi->obs_lu_n);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->times);
     BFT_FREE(oi->times_read);
@@ -661,6 +665,8 @@ cs_at_opt_interps_destroy(void)
   for (int i = 0; i < _n_opt_interps; i++) {
     cs_at_opt_interp_t  *oi = _opt_interps + i;
     BFT_FREE(oi->b_proj);
+    BFT_FREE(oi->obs_lu);
+    BFT_FREE(oi->obs_lu_n);
     BFT_FREE(oi->relax);
     BFT_FREE(oi->obs_cov);
     BFT_FREE(oi->times);
@@ -1377,8 +1383,11 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
 
+  /* The matrix is symmetric: only its upper part is computed */
+
+# pragma omp parallel for if (n_obs > CS_THR_MIN) schedule(dynamic)
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
+    for (cs_lnum_t jj = ii; jj < n_obs; jj++) {
       for (int pp = 0; pp < dim; pp++)
         b_proj[dim*(ii*n_obs + jj) + pp] = 0;
 
@@ -1399,6 +1408,9 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
                                               * influ;
         }
       }
+
+      for (int pp = 0; pp < dim; pp++)
+        b_proj[dim*(jj*n_obs + ii) + pp] = b_proj[dim*(ii*n_obs + jj) + pp];
     }
   }
 }
@@ -1555,13 +1567,13 @@ cs_at_opt_interp_get_active_obs(cs_measures_set_t   *ms,
         for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
           sum += CS_ABS(oi->time_weights[m_dim*ii+kk] - temp[m_dim*ii+kk]);
         }
-        BFT_FREE(temp);
         (*inverse)[kk] = (sum > 1.e-6); // FIXME define tolerance
 
       } /* end if on n_active_obs */
 
     } /* end for on measures dimension */
 
+    BFT_FREE(temp);
     BFT_FREE(ao_count);
 
   } /* end if steady */
@@ -1628,7 +1640,6 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   const int stride = m_dim + 3; /* dimension of field + dimension of space */
 
   int a_l_size = n_active_obs;
-  int a_size = cs_math_sq(a_l_size);
 
   cs_real_t *inc = NULL;
   BFT_MALLOC(inc, a_l_size, cs_real_t);
@@ -1639,6 +1650,8 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
     int r_id0 = 0;
     if (cs_glob_rank_id > -1) r_id0 = ig->rank_connect[obs_id];
 
+    inc[ii] = 0.;
+
     if (cs_glob_rank_id < 0 || cs_glob_rank_id == r_id0) {
       inc[ii] = ms->measures[oi->active_time[m_dim*obs_id+mc_id]];
 
@@ -1650,15 +1663,9 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
     }
   }
 
-  /* exchange innovation */
+  /* exchange innovation (each value is only set on its owning rank) */
 
-  if (cs_glob_rank_id > -1) {
-    for (int ii = 0; ii < n_active_obs; ii++) {
-      int obs_id = ao_idx[ii];
-      int r_id0 = ig->rank_connect[obs_id];
-      cs_parall_bcast(r_id0, 1, CS_DOUBLE, &(inc[ii]));
-    }
-  }
+  cs_parall_sum(a_l_size, CS_REAL_TYPE, inc);
 
 #if _OI_DEBUG_
   bft_printf("\n   * Observation increments\n    ");
@@ -1669,18 +1676,32 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   bft_printf("\n");
 #endif
 
-  cs_real_t *alu = NULL;
-  if (inverse) {
+  /* The LU factorization of HB(H)t+R is kept for each measures component
+     and only recomputed when active observations or their weights change */
+
+  const int n_obs = ms->nb_measures;
+
+  if (oi->obs_lu == NULL) {
+    BFT_MALLOC(oi->obs_lu, (size_t)m_dim*n_obs*n_obs, cs_real_t);
+    BFT_MALLOC(oi->obs_lu_n, m_dim, int);
+    for (int kk = 0; kk < m_dim; kk++)
+      oi->obs_lu_n[kk] = 0;
+  }
+
+  cs_real_t *alu = oi->obs_lu + (size_t)mc_id*n_obs*n_obs;
+
+  if (inverse || oi->obs_lu_n[mc_id] != n_active_obs) {
     cs_real_t *a = _assembly_adding_obs_covariance(ms,
                                                    oi,
                                                    ao_idx,
                                                    n_active_obs,
                                                    mc_id);
-    BFT_MALLOC(alu, a_size, cs_real_t);
 
     cs_math_fact_lu(1, a_l_size, a, alu);
     BFT_FREE(a);
 
+    oi->obs_lu_n[mc_id] = n_active_obs;
+
 #if _OI_DEBUG_
     bft_printf("\n   * LU Matrix\n");
     for (int ii = 0; ii < n_active_obs; ii++) {
@@ -1705,33 +1726,52 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
 
   cs_math_fw_and_bw_lu(alu, a_l_size, vect, inc);
 
-  BFT_FREE(alu);
   BFT_FREE(inc);
 
+  /* Gather coordinates and weights of projection points of active
+     observations, so that the loop on cells only accesses contiguous data */
+
+  cs_lnum_t n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++)
+    n_pts += proj_idx[ao_idx[ll]+1] - proj_idx[ao_idx[ll]];
+
+  cs_real_4_t *pts = NULL;
+  BFT_MALLOC(pts, n_pts, cs_real_4_t);
+
+  n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++) {
+    for (int mm = proj_idx[ao_idx[ll]];
+         mm < proj_idx[ao_idx[ll]+1];
+         mm++) {
+      pts[n_pts][0] = (proj + mm*stride)[m_dim  ];
+      pts[n_pts][1] = (proj + mm*stride)[m_dim+1];
+      pts[n_pts][2] = (proj + mm*stride)[m_dim+2];
+      pts[n_pts][3] = (proj + mm*stride)[mc_id] * vect[ll];
+      n_pts++;
+    }
+  }
+
+  BFT_FREE(vect);
+
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  const int c_id = ms->comp_ids[mc_id];
 
+# pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
-    f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
-      f->val_pre[ii*f_dim+ms->comp_ids[mc_id]];
-
-    for (int ll = 0; ll < n_active_obs; ll++) {
-      for (int mm = proj_idx[ao_idx[ll]];
-           mm < proj_idx[ao_idx[ll]+1];
-           mm++) {
-        cs_real_t x = (proj + mm*stride)[m_dim  ];
-        cs_real_t y = (proj + mm*stride)[m_dim+1];
-        cs_real_t z = (proj + mm*stride)[m_dim+2];
-        f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] +=  (proj + mm*stride)[mc_id] * vect[ll]
-                                                   * _b_matrix(cell_cen[ii][0],
-                                                               cell_cen[ii][1],
-                                                               cell_cen[ii][2],
-                                                               x, y, z, ir_xy2, ir_z2);
-      }
-    }
+    cs_real_t val = f->val_pre[ii*f_dim+c_id];
+
+    for (cs_lnum_t pp = 0; pp < n_pts; pp++)
+      val += pts[pp][3] * _b_matrix(cell_cen[ii][0],
+                                    cell_cen[ii][1],
+                                    cell_cen[ii][2],
+                                    pts[pp][0], pts[pp][1], pts[pp][2],
+                                    ir_xy2, ir_z2);
+
+    f_oia->val[ii*f_dim+c_id] = val;
   }
 
-  BFT_FREE(vect);
+  BFT_FREE(pts);
 }
 
 /*----------------------------------------------------------------------------*/
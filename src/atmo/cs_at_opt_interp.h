@@ -71,6 +71,8 @@ typedef struct _cs_at_opt_interp_t {
   cs_lnum_t               *model_to_obs_proj_idx;
   cs_lnum_t               *model_to_obs_proj_c_ids;
   cs_real_t               *b_proj;
+  cs_real_t               *obs_lu;
+  int                     *obs_lu_n;
   cs_real_t                ir[2];
   cs_real_t               *relax;
   int                      nb_times;
@@ -54,6 +54,7 @@
 
 #include "cs_air_props.h"
 #include "cs_array.h"
+#include "cs_atmo_chemistry_isat.h"
 #include "cs_atmo_profile_std.h"
 #include "cs_base.h"
 #include "cs_boundary_conditions.h"
@@ -4948,6 +4949,7 @@ cs_atmo_finalize(void)
   BFT_FREE(_atmo_option.soil_cat_thermal_inertia);
   BFT_FREE(_atmo_option.soil_cat_thermal_roughness);
 
+  cs_atmo_chemistry_isat_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
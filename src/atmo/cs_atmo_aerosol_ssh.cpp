@@ -101,6 +101,41 @@ static bool _update_ssh_thermo = false;
 static bool _verbose = false;
 static cs_real_t _ssh_time_offset = 0.0;
 
+/* Number of cells gathered per batch in time advance */
+static cs_lnum_t _batch_size = 1024;
+
+#if defined(HAVE_DLOPEN)
+
+/* SSH-aerosol functions used for each cell, resolved once */
+
+typedef void (*_ssh_void_t)(void);
+typedef void (*_ssh_double_t)(double *);
+
+typedef struct {
+
+  _ssh_double_t  set_pressure;
+  _ssh_double_t  set_temperature;
+  _ssh_double_t  set_relhumidity;
+  _ssh_void_t    update_humidity;
+  _ssh_double_t  set_gas;
+  _ssh_double_t  get_gas;
+  _ssh_double_t  set_aero;
+  _ssh_double_t  set_aero_num;
+  _ssh_double_t  get_aero;
+  _ssh_double_t  get_aero_num;
+  _ssh_void_t    init_again;
+  _ssh_void_t    emission;
+  _ssh_void_t    gaschemistry;
+  _ssh_void_t    aerodyn;
+  _ssh_void_t    output;
+
+} _ssh_api_t;
+
+static _ssh_api_t  _ssh_api;
+static bool        _ssh_api_resolved = false;
+
+#endif /* defined(HAVE_DLOPEN)*/
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -323,6 +358,109 @@ _exchange_double_array(void               *handle,
   fct(array);
 }
 
+/*----------------------------------------------------------------------------
+ * Resolve SSH-aerosol functions used for each cell.
+ *----------------------------------------------------------------------------*/
+
+static void
+_ssh_api_resolve(void)
+{
+  if (_ssh_api_resolved)
+    return;
+
+  void *h = _aerosol_so;
+
+#define _RESOLVE(_f, _t, _name) \
+  _ssh_api._f = (_t)cs_base_get_dl_function_pointer(h, _name, true);
+
+  _RESOLVE(set_pressure, _ssh_double_t, "api_sshaerosol_set_pressure_");
+  _RESOLVE(set_temperature, _ssh_double_t, "api_sshaerosol_set_temperature_");
+  _RESOLVE(set_relhumidity, _ssh_double_t, "api_sshaerosol_set_relhumidity_");
+  _RESOLVE(update_humidity, _ssh_void_t, "api_sshaerosol_update_humidity_");
+  _RESOLVE(set_gas, _ssh_double_t, "api_sshaerosol_set_gas_");
+  _RESOLVE(get_gas, _ssh_double_t, "api_sshaerosol_get_gas_");
+  _RESOLVE(set_aero, _ssh_double_t, "api_sshaerosol_set_aero_");
+  _RESOLVE(set_aero_num, _ssh_double_t, "api_sshaerosol_set_aero_num_");
+  _RESOLVE(get_aero, _ssh_double_t, "api_sshaerosol_get_aero_");
+  _RESOLVE(get_aero_num, _ssh_double_t, "api_sshaerosol_get_aero_num_");
+  _RESOLVE(init_again, _ssh_void_t, "api_sshaerosol_init_again_");
+  _RESOLVE(emission, _ssh_void_t, "api_sshaerosol_emission_");
+  _RESOLVE(gaschemistry, _ssh_void_t, "api_sshaerosol_gaschemistry_");
+  _RESOLVE(aerodyn, _ssh_void_t, "api_sshaerosol_aerodyn_");
+  _RESOLVE(output, _ssh_void_t, "api_sshaerosol_output_");
+
+#undef _RESOLVE
+
+  _ssh_api_resolved = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Advance gaseous chemistry and aerosol dynamics for a batch of cells.
+ *
+ * Thermodynamic arrays are ignored if null.
+ *
+ * parameters:
+ *   n_b_cells  <-- number of cells in batch
+ *   output     <-- call SSH-aerosol output for first cell of batch
+ *   pres       <-- pressure (Pa) per cell, or null
+ *   temp       <-- temperature (K) per cell, or null
+ *   rh         <-- relative humidity per cell, or null
+ *   gas        <-> gas concentrations (microg/m^3), interleaved
+ *   aero       <-> aerosol concentrations (microg/m^3) and
+ *                  numbers (molecules/m^3), interleaved
+ *----------------------------------------------------------------------------*/
+
+static void
+_ssh_advance_batch(cs_lnum_t   n_b_cells,
+                   bool        output,
+                   cs_real_t  *pres,
+                   cs_real_t  *temp,
+                   cs_real_t  *rh,
+                   cs_real_t  *gas,
+                   cs_real_t  *aero)
+{
+  const int n_species = cs_glob_atmo_chemistry->n_species;
+  const int _size = cs_glob_atmo_chemistry->n_layer
+                  * cs_glob_atmo_chemistry->n_size;
+  const int _sizetot = _size + cs_glob_atmo_chemistry->n_size;
+
+  const bool frozen_gas = cs_glob_atmo_chemistry->frozen_gas_chem;
+
+  for (cs_lnum_t i = 0; i < n_b_cells; i++) {
+
+    double *_gas = gas + i*n_species;
+    double *_aero = aero + i*_sizetot;
+
+    if (pres != NULL)
+      _ssh_api.set_pressure(pres + i);
+    if (temp != NULL)
+      _ssh_api.set_temperature(temp + i);
+    if (rh != NULL)
+      _ssh_api.set_relhumidity(rh + i);
+    if (temp != NULL)
+      _ssh_api.update_humidity();
+
+    _ssh_api.set_gas(_gas);
+    _ssh_api.set_aero(_aero);
+    _ssh_api.set_aero_num(_aero + _size);
+
+    _ssh_api.init_again();
+    _ssh_api.emission();
+    _ssh_api.gaschemistry();
+    _ssh_api.aerodyn();
+
+    /* Using this is not recommended */
+    if (output && i == 0)
+      _ssh_api.output();
+
+    if (!frozen_gas)
+      _ssh_api.get_gas(_gas);
+    _ssh_api.get_aero(_aero);
+    _ssh_api.get_aero_num(_aero + _size);
+
+  }
+}
+
 #endif /* defined(HAVE_DLOPEN)*/
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -540,6 +678,7 @@ cs_atmo_aerosol_ssh_finalize(void)
 
   /* dlclose: release the shared library */
   cs_base_dlclose(_lib_path, _aerosol_so);
+  _ssh_api_resolved = false;
 #else
   bft_error(__FILE__, __LINE__, 0,
             _("Shared library support not available.\n"
@@ -793,151 +932,142 @@ cs_atmo_aerosol_ssh_time_advance(void)
               _("Time scheme currently incompatible with SSH-aerosol\n"));
   }
 
-  /* Loop over cells, update chemistry and aerosols */
-  for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id++) {
-
-    /* Conversion from ppm (mg/kg) to microg / m^3 */
-    const cs_real_t ppm_to_microg = 1e3 * CS_F_(rho)->val[cell_id];
-    const cs_real_t microg_to_ppm = 1. / ppm_to_microg;
+  /* Cells are processed by batches: inputs are gathered in contiguous
+     arrays, SSH-aerosol is called for each cell of the batch,
+     and results are scattered back to fields. */
 
-    /* Set the Pressure */
-    if (_update_ssh_thermo) {
-      double pres = cs_field_by_name("total_pressure")->val[cell_id];
-      _send_double(_aerosol_so, "api_sshaerosol_set_pressure_", pres);
-    }
+  _ssh_api_resolve();
 
-    /* Set the Temperature (K) */
-    if (_update_ssh_thermo) {
-      double temp;
-      if (   cs_glob_thermal_model->thermal_variable
-          == CS_THERMAL_MODEL_TEMPERATURE) {
-        temp = cs_field_by_name("temperature")->val[cell_id];
-        if (   cs_glob_thermal_model->temperature_scale
-            == CS_TEMPERATURE_SCALE_CELSIUS)
-          temp -= cs_physical_constants_celsius_to_kelvin;
-      }
-      else {
-        /* We have enthalpy, use reference temperature */
-        temp = cs_glob_fluid_properties->t0;
-      }
-      _send_double(_aerosol_so, "api_sshaerosol_set_temperature_", temp);
-    }
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_species = cs_glob_atmo_chemistry->n_species;
+  const int _size = cs_glob_atmo_chemistry->n_layer
+                  * cs_glob_atmo_chemistry->n_size;
+  const int _sizetot = _size + cs_glob_atmo_chemistry->n_size;
+  const cs_real_t *rho = CS_F_(rho)->val;
+
+  cs_real_t **c_vals;
+  BFT_MALLOC(c_vals, n_species + _sizetot, cs_real_t *);
+  for (int i = 0; i < n_species + _sizetot; i++) {
+    const int fid = cs_glob_atmo_chemistry->species_to_field_id[i];
+    c_vals[i] = cs_field_by_id(fid)->val;
+  }
 
-    /* Set the pH */
-    if (false) {
-      /* Atmospheric module of code_saturne does not provide pH yet */
-      double ph = 7;
-      _send_double(_aerosol_so, "api_sshaerosol_set_ph_", ph);
+  const cs_real_t *cvar_pres = NULL, *cvar_temp = NULL;
+  const cs_real_t *cvar_totwt = NULL, *cvar_liqwt = NULL;
+  if (_update_ssh_thermo) {
+    cvar_pres = cs_field_by_name("total_pressure")->val;
+    if (   cs_glob_thermal_model->thermal_variable
+        == CS_THERMAL_MODEL_TEMPERATURE)
+      cvar_temp = cs_field_by_name("temperature")->val;
+    cs_field_t* fld = cs_field_by_name_try("total_water");
+    if (fld != NULL) {
+      cvar_totwt = fld->val;
+      cvar_liqwt = cs_field_by_name("liquid_water")->val;
     }
+  }
 
-    /* Set the relative humidity */
-    if (_update_ssh_thermo) {
-      cs_field_t* fld = cs_field_by_name_try("total_water");
-      if (fld != NULL) {
-        cs_real_t totwt = fld->val[cell_id];
-        cs_real_t liqwt = cs_field_by_name("liquid_water")->val[cell_id];
-        if (fabs(1. - liqwt) < cs_math_epzero)
-          bft_error
-            (__FILE__,__LINE__, 0,
-             _("Error when computing the relative humidity for SSH-aerosol."));
-        double rh = (totwt - liqwt)/(1. - liqwt);
-        _send_double(_aerosol_so, "api_sshaerosol_set_relhumidity_", rh);
-      }
-    }
+  const cs_lnum_t b_size = CS_MIN(_batch_size, n_cells);
 
-    /* Update the specific humidity */
-    if (_update_ssh_thermo)
-      _call(_aerosol_so, "api_sshaerosol_update_humidity_");
+  cs_real_t *gas, *aero, *pres = NULL, *temp = NULL, *rh = NULL;
+  BFT_MALLOC(gas, b_size*n_species, cs_real_t);
+  BFT_MALLOC(aero, b_size*_sizetot, cs_real_t);
+  if (_update_ssh_thermo) {
+    BFT_MALLOC(pres, b_size, cs_real_t);
+    BFT_MALLOC(temp, b_size, cs_real_t);
+    if (cvar_totwt != NULL)
+      BFT_MALLOC(rh, b_size, cs_real_t);
+  }
 
-    /* Update SSH gaseous concentrations */
-    {
-      double data[cs_glob_atmo_chemistry->n_species];
-      for (int i = 0; i < cs_glob_atmo_chemistry->n_species; i++) {
-        const int fid = cs_glob_atmo_chemistry->species_to_field_id[i];
-        data[i] = cs_field_by_id(fid)->val[cell_id] * ppm_to_microg;
+  for (cs_lnum_t s_id = 0; s_id < n_cells; s_id += b_size) {
+
+    const cs_lnum_t n_b_cells = CS_MIN(b_size, n_cells - s_id);
+
+    /* Gather inputs */
+
+    for (cs_lnum_t i = 0; i < n_b_cells; i++) {
+      const cs_lnum_t cell_id = s_id + i;
+
+      /* Conversion from ppm (mg/kg) to microg / m^3 */
+      const cs_real_t ppm_to_microg = 1e3 * rho[cell_id];
+
+      if (_update_ssh_thermo) {
+        pres[i] = cvar_pres[cell_id];
+
+        /* Temperature (K) */
+        if (cvar_temp != NULL) {
+          temp[i] = cvar_temp[cell_id];
+          if (   cs_glob_thermal_model->temperature_scale
+              == CS_TEMPERATURE_SCALE_CELSIUS)
+            temp[i] -= cs_physical_constants_celsius_to_kelvin;
+        }
+        else {
+          /* We have enthalpy, use reference temperature */
+          temp[i] = cs_glob_fluid_properties->t0;
+        }
+
+        /* Relative humidity */
+        if (rh != NULL) {
+          cs_real_t totwt = cvar_totwt[cell_id];
+          cs_real_t liqwt = cvar_liqwt[cell_id];
+          if (fabs(1. - liqwt) < cs_math_epzero)
+            bft_error
+              (__FILE__,__LINE__, 0,
+               _("Error when computing the relative humidity "
+                 "for SSH-aerosol."));
+          rh[i] = (totwt - liqwt)/(1. - liqwt);
+        }
       }
-      cs_atmo_aerosol_ssh_set_gas(data);
-    }
 
-    /* Update SSH aerosols concentrations and numbers */
-    {
-      const int _size = cs_glob_atmo_chemistry->n_layer
-                      * cs_glob_atmo_chemistry->n_size;
-      const int _sizetot = _size + cs_glob_atmo_chemistry->n_size;
-      double data[_sizetot];
-
-      /* Concentrations are converted to microg / m^3 */
-      for (int i = 0; i < _size; i++) {
-        const int ics = i + cs_glob_atmo_chemistry->n_species;
-        const int fid = cs_glob_atmo_chemistry->species_to_field_id[ics];
-        data[i] = cs_field_by_id(fid)->val[cell_id] * ppm_to_microg;
-      }
-      /* Numbers are converted to molecules / m^3 */
-      for (int i = 0; i < cs_glob_atmo_chemistry->n_size; i++) {
-        const int ii = i + _size;
-        const int ics = ii + cs_glob_atmo_chemistry->n_species;
-        const int fid = cs_glob_atmo_chemistry->species_to_field_id[ics];
-        data[ii] = cs_field_by_id(fid)->val[cell_id] * CS_F_(rho)->val[cell_id];
-      }
-      cs_atmo_aerosol_ssh_set_aero(data);
+      /* Gaseous concentrations */
+      cs_real_t *_gas = gas + i*n_species;
+      for (int j = 0; j < n_species; j++)
+        _gas[j] = c_vals[j][cell_id] * ppm_to_microg;
+
+      /* Aerosol concentrations are converted to microg / m^3,
+         and numbers to molecules / m^3 */
+      cs_real_t *_aero = aero + i*_sizetot;
+      for (int j = 0; j < _size; j++)
+        _aero[j] = c_vals[n_species + j][cell_id] * ppm_to_microg;
+      for (int j = _size; j < _sizetot; j++)
+        _aero[j] = c_vals[n_species + j][cell_id] * rho[cell_id];
     }
 
-    /* Update concentration-dependent arrays in SSH-aerosol */
-    _call(_aerosol_so, "api_sshaerosol_init_again_");
-
-    /* Emissions */
-    _call(_aerosol_so, "api_sshaerosol_emission_");
+    /* Update chemistry and aerosols */
 
-    /* Call the gaseous chemistry */
-    _call(_aerosol_so, "api_sshaerosol_gaschemistry_");
+    _ssh_advance_batch(n_b_cells,
+                       (_allow_ssh_postprocess && cs_glob_rank_id <= 0
+                        && s_id == 0),
+                       pres, temp, rh,
+                       gas, aero);
 
-    /* Call the aerosols dynamic */
-    _call(_aerosol_so, "api_sshaerosol_aerodyn_");
+    /* Scatter results */
 
-    /* Using this is not recommended */
-    if (_allow_ssh_postprocess && cs_glob_rank_id <= 0 && cell_id == 0) {
-      _call(_aerosol_so, "api_sshaerosol_output_");
-    }
-
-    /* Update CS gaseous concentrations */
-    if (!cs_glob_atmo_chemistry->frozen_gas_chem) {
-      double data[cs_glob_atmo_chemistry->n_species];
-      cs_atmo_aerosol_ssh_get_gas(data);
-      for (int i = 0; i < cs_glob_atmo_chemistry->n_species; i++) {
-        const int fid = cs_glob_atmo_chemistry->species_to_field_id[i];
-        cs_field_by_id(fid)->val[cell_id] = data[i] * microg_to_ppm;
-      }
-    }
+    for (cs_lnum_t i = 0; i < n_b_cells; i++) {
+      const cs_lnum_t cell_id = s_id + i;
+      const cs_real_t microg_to_ppm = 1. / (1e3 * rho[cell_id]);
 
-    /* Update the CS aerosols concentrations and numbers */
-    {
-      const int _size = cs_glob_atmo_chemistry->n_layer
-                      * cs_glob_atmo_chemistry->n_size;
-      const int _sizetot = _size + cs_glob_atmo_chemistry->n_size;
-      double data[_sizetot];
-
-      /* Get concentrations and numbers */
-      cs_atmo_aerosol_ssh_get_aero(data);
-
-      /* Update CS aerosols concentrations */
-      for (int i = 0; i < _size; i++) {
-        const int ics = i + cs_glob_atmo_chemistry->n_species;
-        const int fid = cs_glob_atmo_chemistry->species_to_field_id[ics];
-        cs_field_by_id(fid)->val[cell_id] = data[i] * microg_to_ppm;
-      }
-
-      /* Update CS aerosols numbers */
-      for (int i = 0; i < cs_glob_atmo_chemistry->n_size; i++) {
-        const int ii = i + _size;
-        const int ics = ii + cs_glob_atmo_chemistry->n_species;
-        const int fid = cs_glob_atmo_chemistry->species_to_field_id[ics];
-        cs_field_by_id(fid)->val[cell_id] = data[ii] / CS_F_(rho)->val[cell_id];
+      if (!cs_glob_atmo_chemistry->frozen_gas_chem) {
+        const cs_real_t *_gas = gas + i*n_species;
+        for (int j = 0; j < n_species; j++)
+          c_vals[j][cell_id] = _gas[j] * microg_to_ppm;
       }
 
+      const cs_real_t *_aero = aero + i*_sizetot;
+      for (int j = 0; j < _size; j++)
+        c_vals[n_species + j][cell_id] = _aero[j] * microg_to_ppm;
+      for (int j = _size; j < _sizetot; j++)
+        c_vals[n_species + j][cell_id] = _aero[j] / rho[cell_id];
     }
 
   }
 
+  BFT_FREE(gas);
+  BFT_FREE(aero);
+  BFT_FREE(pres);
+  BFT_FREE(temp);
+  BFT_FREE(rh);
+  BFT_FREE(c_vals);
+
 #else
   bft_error(__FILE__, __LINE__, 0,
             _("Shared library support not available.\n"
@@ -945,6 +1075,25 @@ cs_atmo_aerosol_ssh_time_advance(void)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of cells gathered per batch when advancing
+ *        chemistry and aerosols with SSH-aerosol.
+ *
+ * Inputs of a batch of cells are gathered in contiguous arrays before
+ * calling SSH-aerosol for each cell, and results are then scattered
+ * back to the species fields.
+ *
+ * \param[in]  batch_size  number of cells per batch (default: 1024)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_aerosol_ssh_set_batch_size(cs_lnum_t  batch_size)
+{
+  _batch_size = CS_MAX(batch_size, 1);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
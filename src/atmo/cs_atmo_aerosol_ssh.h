@@ -159,6 +159,22 @@ cs_atmo_aerosol_ssh_get_gas(cs_real_t*);
 void
 cs_atmo_aerosol_ssh_time_advance(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of cells gathered per batch when advancing
+ *        chemistry and aerosols with SSH-aerosol.
+ *
+ * Inputs of a batch of cells are gathered in contiguous arrays before
+ * calling SSH-aerosol for each cell, and results are then scattered
+ * back to the species fields.
+ *
+ * \param[in]  batch_size  number of cells per batch (default: 1024)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_aerosol_ssh_set_batch_size(cs_lnum_t  batch_size);
+
 END_C_DECLS
 
 #endif /* __CS_ATMO_AEROSOL_SSH_H__ */
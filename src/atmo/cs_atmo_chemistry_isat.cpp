@@ -0,0 +1,391 @@
+/*============================================================================
+ * In situ tabulation of atmospheric gaseous chemistry integration
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_log.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_atmo_chemistry_isat.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_atmo_chemistry_isat.c
+
+  In situ tabulation of atmospheric gaseous chemistry integration.
+
+  Inputs of the chemistry integration are mapped to integer bin coordinates
+  (logarithmic in magnitude, with sign), and integration results are
+  stored in an open addressing hash table keyed by two independent
+  hashes of these coordinates. Since all inputs of a retrieved record lie
+  in the same bins as the query, the relative difference of each input is
+  bounded by the bin width, which controls the retrieval error.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+typedef struct {
+
+  cs_real_t   rtol;          /* relative bin width (<= 0 if inactive) */
+  cs_real_t   atol;          /* absolute threshold for concentrations */
+  cs_lnum_t   max_records;   /* maximum number of records */
+
+  int         n_out;         /* number of outputs per record */
+  cs_lnum_t   n_records;     /* number of records */
+  cs_lnum_t   n_slots;       /* number of hash table slots (power of 2) */
+
+  cs_lnum_t  *slot_record;   /* record id for each slot, or -1 */
+  uint64_t   *record_key;    /* primary and secondary keys per record */
+  cs_real_t  *record_val;    /* outputs per record */
+
+  unsigned long long  n_queries;  /* number of retrieval queries */
+  unsigned long long  n_hits;     /* number of successful retrievals */
+
+} cs_atmo_chemistry_isat_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_atmo_chemistry_isat_t  _isat = {
+  .rtol = -1,
+  .atol = 0,
+  .max_records = 0,
+  .n_out = 0,
+  .n_records = 0,
+  .n_slots = 0,
+  .slot_record = nullptr,
+  .record_key = nullptr,
+  .record_val = nullptr,
+  .n_queries = 0,
+  .n_hits = 0
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute primary and secondary keys of a set of inputs.
+ *
+ * parameters:
+ *   n_conc <-- number of leading inputs using absolute threshold
+ *   n_in   <-- number of inputs
+ *   x      <-- inputs
+ *   key    --> primary and secondary keys
+ *----------------------------------------------------------------------------*/
+
+static void
+_isat_keys(int              n_conc,
+           int              n_in,
+           const cs_real_t  x[],
+           uint64_t         key[2])
+{
+  const double inv_log_r = 1. / log1p(_isat.rtol);
+
+  uint64_t h0 = 14695981039346656037ULL;  /* FNV-1a offset basis */
+  uint64_t h1 = 0x9e3779b97f4a7c15ULL;
+
+  for (int i = 0; i < n_in; i++) {
+
+    double a = fabs(x[i]);
+    int64_t q = 0;
+
+    if (a > 0 && (i >= n_conc || a >= _isat.atol)) {
+      q = (int64_t)floor(log(a) * inv_log_r);
+      q = 4*q + ((x[i] > 0) ? 1 : 2);
+    }
+
+    uint64_t u = (uint64_t)q;
+
+    for (int j = 0; j < 8; j++) {
+      h0 ^= (u >> (8*j)) & 0xff;
+      h0 *= 1099511628211ULL;                /* FNV-1a prime */
+    }
+
+    h1 ^= u + 0x9e3779b97f4a7c15ULL + (h1 << 6) + (h1 >> 2);
+    h1 *= 0xbf58476d1ce4e5b9ULL;
+    h1 ^= h1 >> 31;
+  }
+
+  key[0] = h0;
+  key[1] = h1;
+}
+
+/*----------------------------------------------------------------------------
+ * Find the hash table slot matching given keys.
+ *
+ * parameters:
+ *   key <-- primary and secondary keys
+ *
+ * returns:
+ *   slot id for matching record, or first empty slot
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_isat_slot(const uint64_t  key[2])
+{
+  const cs_lnum_t mask = _isat.n_slots - 1;
+
+  cs_lnum_t s_id = (cs_lnum_t)(key[0] & (uint64_t)mask);
+
+  while (_isat.slot_record[s_id] > -1) {
+    const uint64_t *r_key = _isat.record_key + 2*_isat.slot_record[s_id];
+    if (r_key[0] == key[0] && r_key[1] == key[1])
+      break;
+    s_id = (s_id + 1) & mask;
+  }
+
+  return s_id;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate in situ tabulation of the gaseous chemistry integration.
+ *
+ * The integration result of a cell is reused for another cell (or time
+ * step) when all its inputs (concentrations, source terms, kinetic rates,
+ * density and time step) fall in the same tabulation bin, bins being
+ * spaced logarithmically with relative width rtol (concentrations and
+ * source terms smaller than atol in absolute value being considered
+ * as zero). Once the table contains max_records entries, it is only
+ * used for retrieval.
+ *
+ * \param[in]  rtol         relative bin width, or <= 0 to deactivate
+ * \param[in]  atol         absolute threshold for concentrations
+ *                          and source terms
+ * \param[in]  max_records  maximum number of tabulated records
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_isat_set(cs_real_t  rtol,
+                           cs_real_t  atol,
+                           cs_lnum_t  max_records)
+{
+  BFT_FREE(_isat.slot_record);
+  BFT_FREE(_isat.record_key);
+  BFT_FREE(_isat.record_val);
+
+  _isat.rtol = rtol;
+  _isat.atol = CS_MAX(atol, 0.);
+  _isat.max_records = CS_MAX(max_records, 0);
+  _isat.n_out = 0;
+  _isat.n_records = 0;
+  _isat.n_slots = 0;
+
+  if (_isat.rtol <= 0 || _isat.max_records < 1)
+    return;
+
+  /* Keep load factor below 1/2 */
+
+  _isat.n_slots = 1;
+  while (_isat.n_slots < 2*_isat.max_records)
+    _isat.n_slots *= 2;
+
+  BFT_MALLOC(_isat.slot_record, _isat.n_slots, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < _isat.n_slots; i++)
+    _isat.slot_record[i] = -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Retrieve a tabulated chemistry integration result.
+ *
+ * \param[in]   n_conc  number of leading inputs using absolute threshold
+ * \param[in]   n_in    number of inputs
+ * \param[in]   x       inputs
+ * \param[in]   n_out   number of outputs
+ * \param[out]  y       outputs (unchanged if not found)
+ *
+ * \return  1 if a matching record was found, 0 otherwise
+ *          (or if tabulation is not active)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_atmo_chemistry_isat_retrieve(int              n_conc,
+                                int              n_in,
+                                const cs_real_t  x[],
+                                int              n_out,
+                                cs_real_t        y[])
+{
+  if (_isat.n_slots < 1 || _isat.n_records < 1)
+    return 0;
+
+  assert(n_out == _isat.n_out);
+
+  _isat.n_queries += 1;
+
+  uint64_t key[2];
+  _isat_keys(n_conc, n_in, x, key);
+
+  cs_lnum_t r_id = _isat.slot_record[_isat_slot(key)];
+  if (r_id < 0)
+    return 0;
+
+  const cs_real_t *r_val = _isat.record_val + (size_t)r_id*n_out;
+  for (int i = 0; i < n_out; i++)
+    y[i] = r_val[i];
+
+  _isat.n_hits += 1;
+
+  return 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a chemistry integration result to the table.
+ *
+ * \param[in]  n_conc  number of leading inputs using absolute threshold
+ * \param[in]  n_in    number of inputs
+ * \param[in]  x       inputs
+ * \param[in]  n_out   number of outputs
+ * \param[in]  y       outputs
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_isat_add(int              n_conc,
+                           int              n_in,
+                           const cs_real_t  x[],
+                           int              n_out,
+                           const cs_real_t  y[])
+{
+  if (_isat.n_slots < 1 || _isat.n_records >= _isat.max_records)
+    return;
+
+  if (_isat.record_val == nullptr) {
+    _isat.n_out = n_out;
+    BFT_MALLOC(_isat.record_key, 2*_isat.max_records, uint64_t);
+    BFT_MALLOC(_isat.record_val, (size_t)n_out*_isat.max_records, cs_real_t);
+  }
+  else if (n_out != _isat.n_out)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: number of outputs (%d) differs from that of "
+                "existing records (%d)."),
+              __func__, n_out, _isat.n_out);
+
+  uint64_t key[2];
+  _isat_keys(n_conc, n_in, x, key);
+
+  cs_lnum_t s_id = _isat_slot(key);
+  if (_isat.slot_record[s_id] > -1)
+    return;
+
+  cs_lnum_t r_id = _isat.n_records;
+  _isat.n_records += 1;
+
+  _isat.slot_record[s_id] = r_id;
+  _isat.record_key[2*r_id] = key[0];
+  _isat.record_key[2*r_id + 1] = key[1];
+
+  cs_real_t *r_val = _isat.record_val + (size_t)r_id*n_out;
+  for (int i = 0; i < n_out; i++)
+    r_val[i] = y[i];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log tabulation statistics and free the table.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_isat_finalize(void)
+{
+  if (_isat.n_slots > 0) {
+
+    unsigned long long counts[3] = {_isat.n_queries,
+                                    _isat.n_hits,
+                                    (unsigned long long)_isat.n_records};
+    cs_parall_sum(3, CS_UINT64, counts);
+
+    double ratio = (counts[0] > 0) ? (double)counts[1] / counts[0] : 0.;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Atmospheric chemistry tabulation:\n\n"
+                    "  Number of queries:       %llu\n"
+                    "  Number of retrievals:    %llu (%5.1f %%)\n"
+                    "  Number of records:       %llu\n"),
+                  counts[0], counts[1], ratio*100., counts[2]);
+
+  }
+
+  BFT_FREE(_isat.slot_record);
+  BFT_FREE(_isat.record_key);
+  BFT_FREE(_isat.record_val);
+
+  _isat.n_slots = 0;
+  _isat.n_records = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,122 @@
+#ifndef __CS_ATMO_CHEMISTRY_ISAT_H__
+#define __CS_ATMO_CHEMISTRY_ISAT_H__
+
+/*============================================================================
+ * In situ tabulation of atmospheric gaseous chemistry integration
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate in situ tabulation of the gaseous chemistry integration.
+ *
+ * The integration result of a cell is reused for another cell (or time
+ * step) when all its inputs (concentrations, source terms, kinetic rates,
+ * density and time step) fall in the same tabulation bin, bins being
+ * spaced logarithmically with relative width rtol (concentrations and
+ * source terms smaller than atol in absolute value being considered
+ * as zero). Once the table contains max_records entries, it is only
+ * used for retrieval.
+ *
+ * \param[in]  rtol         relative bin width, or <= 0 to deactivate
+ * \param[in]  atol         absolute threshold for concentrations
+ *                          and source terms
+ * \param[in]  max_records  maximum number of tabulated records
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_isat_set(cs_real_t  rtol,
+                           cs_real_t  atol,
+                           cs_lnum_t  max_records);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Retrieve a tabulated chemistry integration result.
+ *
+ * \param[in]   n_conc  number of leading inputs using absolute threshold
+ * \param[in]   n_in    number of inputs
+ * \param[in]   x       inputs
+ * \param[in]   n_out   number of outputs
+ * \param[out]  y       outputs (unchanged if not found)
+ *
+ * \return  1 if a matching record was found, 0 otherwise
+ *          (or if tabulation is not active)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_atmo_chemistry_isat_retrieve(int              n_conc,
+                                int              n_in,
+                                const cs_real_t  x[],
+                                int              n_out,
+                                cs_real_t        y[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a chemistry integration result to the table.
+ *
+ * \param[in]  n_conc  number of leading inputs using absolute threshold
+ * \param[in]  n_in    number of inputs
+ * \param[in]  x       inputs
+ * \param[in]  n_out   number of outputs
+ * \param[in]  y       outputs
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_isat_add(int              n_conc,
+                           int              n_in,
+                           const cs_real_t  x[],
+                           int              n_out,
+                           const cs_real_t  y[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log tabulation statistics and free the table.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_isat_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_ATMO_CHEMISTRY_ISAT_H__ */
@@ -35,6 +35,7 @@
 #include "cs_atmo_aerosol_ssh.h"
 #include "cs_at_opt_interp.h"
 #include "cs_atmo.h"
+#include "cs_atmo_chemistry_isat.h"
 #include "cs_atmo_profile_std.h"
 #include "cs_at_opt_interp.h"
 #include "cs_atprke.h"
@@ -1412,16 +1412,32 @@ cs_ale_update_mesh(int  itrale)
   cs_real_3_t *disala = (cs_real_3_t *)(f_displ->val_pre);
   cs_real_3_t *xyzno0 = (cs_real_3_t *)(cs_field_by_name("vtx_coord0")->val);
 
-  /* Update geometry */
+  /* Update geometry, keeping track of vertices which actually moved
+     so that only the quantities of the affected elements are updated */
+
+  cs_lnum_t n_moved_vtx = 0;
+  cs_lnum_t *moved_vtx_ids;
+  BFT_MALLOC(moved_vtx_ids, n_vertices, cs_lnum_t);
 
   for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+    bool moved = false;
     for (cs_lnum_t idim = 0; idim < ndim; idim++) {
-      vtx_coord[v_id][idim] = xyzno0[v_id][idim] + disale[v_id][idim];
+      cs_real_t x = xyzno0[v_id][idim] + disale[v_id][idim];
+      if (x != vtx_coord[v_id][idim])
+        moved = true;
+      vtx_coord[v_id][idim] = x;
       disala[v_id][idim] = vtx_coord[v_id][idim] - xyzno0[v_id][idim];
     }
+    if (moved)
+      moved_vtx_ids[n_moved_vtx++] = v_id;
   }
 
-  cs_ale_update_mesh_quantities(&(mq->min_vol), &(mq->max_vol), &(mq->tot_vol));
+  cs_gradient_free_quantities();
+  cs_cell_to_vertex_free();
+  cs_mesh_quantities_update_moved(m, mq, n_moved_vtx, moved_vtx_ids);
+  cs_mesh_bad_cells_detect(m, mq);
+
+  BFT_FREE(moved_vtx_ids);
 
   /* Abort at the end of the current time-step if there is a negative volume */
 
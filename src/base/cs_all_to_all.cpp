@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,6 +49,7 @@
 #include "cs_base.h"
 #include "cs_assert.h"
 #include "cs_block_dist.h"
+#include "cs_comm_stats.h"
 #include "cs_crystal_router.h"
 #include "cs_log.h"
 #include "cs_order.h"
@@ -85,6 +87,11 @@ BEGIN_C_DECLS
   \var CS_ALL_TO_ALL_CRYSTAL_ROUTER
        Use crystal router algorithm
 
+  \var CS_ALL_TO_ALL_HIERARCHICAL
+       Use MPI_Alltoallv sequences, with data aggregated per node
+       through shared memory, so that only one rank per node takes
+       part in inter-node exchanges
+
   \paragraph all_to_all_flags Using flags
   \parblock
 
@@ -124,6 +131,30 @@ typedef enum {
 
 } cs_all_to_all_timer_t;
 
+/* Node-level topology for hierarchical exchanges */
+
+typedef struct {
+
+  MPI_Comm        comm;              /* Duplicate of associated communicator
+                                        (used for comparison) */
+  MPI_Comm        node_comm;         /* Shared-memory communicator for
+                                        local node */
+  MPI_Comm        leader_comm;       /* Communicator of node leaders
+                                        (MPI_COMM_NULL on other ranks) */
+
+  int             n_ranks;           /* Number of ranks in communicator */
+  int             n_nodes;           /* Number of nodes */
+  int             node_id;           /* Id of local node */
+  int             node_rank_id;      /* Rank id on local node */
+  int             node_n_ranks;      /* Number of ranks on local node */
+
+  int            *node_rank_idx;     /* Index of ranks per node
+                                        (size: n_nodes + 1) */
+  int            *node_ranks;        /* Ranks of each node, ordered by
+                                        rank id on that node */
+
+} _hier_comm_t;
+
 /* Base structure for MPI_Alltoall exchanges */
 
 typedef struct {
@@ -157,6 +188,9 @@ typedef struct {
   int             n_ranks;           /* Number of ranks associated with
                                         communicator */
 
+  _hier_comm_t   *hr;                /* Node-level topology if exchanges
+                                        are hierarchical, or nullptr */
+
 } _mpi_all_to_all_caller_t;
 
 /* Base structure for cs_rank_neighbors-based exchanges */
@@ -271,6 +305,11 @@ static cs_rank_neighbors_exchange_t _hybrid_meta_type
 static size_t              _all_to_all_calls[3] = {0, 0, 0};
 static cs_timer_counter_t  _all_to_all_timers[3];
 
+/* Node-level topology for hierarchical exchanges (cached for the
+   last communicator used) */
+
+static _hier_comm_t  *_hier_comm = nullptr;
+
 /* Instrumentation */
 
 static int        _n_trace = 0;
@@ -399,6 +438,411 @@ _compute_displ(int        n_ranks,
   return total_count;
 }
 
+#if (MPI_VERSION >= 3)
+
+/*----------------------------------------------------------------------------
+ * Destroy node-level topology info for hierarchical exchanges.
+ *
+ * parameters:
+ *   hr <-> pointer to pointer to node-level topology structure
+ *---------------------------------------------------------------------------*/
+
+static void
+_hier_comm_destroy(_hier_comm_t  **hr)
+{
+  if (*hr != nullptr) {
+    _hier_comm_t *_hr = *hr;
+    BFT_FREE(_hr->node_ranks);
+    BFT_FREE(_hr->node_rank_idx);
+    if (_hr->leader_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&(_hr->leader_comm));
+    MPI_Comm_free(&(_hr->node_comm));
+    MPI_Comm_free(&(_hr->comm));
+    BFT_FREE(*hr);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build node-level topology info for hierarchical exchanges.
+ *
+ * Ranks sharing memory are grouped by node, and the first rank of each
+ * node acts as its leader.
+ *
+ * parameters:
+ *   comm <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to new node-level topology structure
+ *---------------------------------------------------------------------------*/
+
+static _hier_comm_t *
+_hier_comm_create(MPI_Comm  comm)
+{
+  _hier_comm_t *hr;
+  BFT_MALLOC(hr, 1, _hier_comm_t);
+
+  int rank_id;
+  MPI_Comm_rank(comm, &rank_id);
+  MPI_Comm_size(comm, &(hr->n_ranks));
+
+  MPI_Comm_dup(comm, &(hr->comm));
+
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank_id,
+                      MPI_INFO_NULL, &(hr->node_comm));
+  MPI_Comm_rank(hr->node_comm, &(hr->node_rank_id));
+  MPI_Comm_size(hr->node_comm, &(hr->node_n_ranks));
+
+  MPI_Comm_split(comm,
+                 (hr->node_rank_id == 0) ? 0 : MPI_UNDEFINED,
+                 rank_id,
+                 &(hr->leader_comm));
+
+  int node_info[2] = {0, 0};
+  if (hr->leader_comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(hr->leader_comm, node_info);
+    MPI_Comm_size(hr->leader_comm, node_info + 1);
+  }
+  MPI_Bcast(node_info, 2, MPI_INT, 0, hr->node_comm);
+
+  hr->node_id = node_info[0];
+  hr->n_nodes = node_info[1];
+
+  /* Global ranks of each node */
+
+  int *rank_node;
+  BFT_MALLOC(rank_node, hr->n_ranks*2, int);
+
+  int l_info[2] = {hr->node_id, hr->node_rank_id};
+  MPI_Allgather(l_info, 2, MPI_INT, rank_node, 2, MPI_INT, comm);
+
+  BFT_MALLOC(hr->node_rank_idx, hr->n_nodes + 1, int);
+  BFT_MALLOC(hr->node_ranks, hr->n_ranks, int);
+
+  for (int i = 0; i < hr->n_nodes + 1; i++)
+    hr->node_rank_idx[i] = 0;
+  for (int i = 0; i < hr->n_ranks; i++)
+    hr->node_rank_idx[rank_node[i*2] + 1] += 1;
+  for (int i = 0; i < hr->n_nodes; i++)
+    hr->node_rank_idx[i+1] += hr->node_rank_idx[i];
+  for (int i = 0; i < hr->n_ranks; i++)
+    hr->node_ranks[hr->node_rank_idx[rank_node[i*2]] + rank_node[i*2+1]] = i;
+
+  BFT_FREE(rank_node);
+
+  return hr;
+}
+
+#endif /* (MPI_VERSION >= 3) */
+
+/*----------------------------------------------------------------------------
+ * Return node-level topology info for hierarchical exchanges.
+ *
+ * Info is cached for the last communicator used, and rebuilt if
+ * a communicator which is neither identical nor congruent is given.
+ *
+ * parameters:
+ *   comm <-- associated MPI communicator
+ *
+ * returns:
+ *   pointer to node-level topology structure, or nullptr if not available
+ *---------------------------------------------------------------------------*/
+
+static _hier_comm_t *
+_hier_comm_get(MPI_Comm  comm)
+{
+#if (MPI_VERSION >= 3)
+
+  if (_hier_comm != nullptr) {
+    int result;
+    MPI_Comm_compare(_hier_comm->comm, comm, &result);
+    if (result == MPI_IDENT || result == MPI_CONGRUENT)
+      return _hier_comm;
+    _hier_comm_destroy(&_hier_comm);
+  }
+
+  _hier_comm = _hier_comm_create(comm);
+
+  return _hier_comm;
+
+#else
+
+  CS_UNUSED(comm);
+  return nullptr;
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Hierarchical (node-aware) equivalent of MPI_Alltoallv.
+ *
+ * Data sent by the ranks of a node is aggregated by the node leader
+ * through a shared-memory window, the leaders exchange aggregated data
+ * (so the number of messages is n_nodes^2 instead of n_ranks^2), and
+ * data is then scattered back to the node's ranks through the same window.
+ * Data exchanged between ranks of a same node is copied directly.
+ *
+ * Arguments match those of MPI_Alltoallv, with counts and displacements
+ * in datatype units. The datatype must be contiguous.
+ *
+ * parameters:
+ *   hr         <-- node-level topology structure
+ *   sendbuf    <-- send buffer
+ *   send_count <-- number of elements sent to each rank
+ *   send_displ <-- displacement of elements sent to each rank
+ *   datatype   <-- element datatype
+ *   recvbuf    --> receive buffer
+ *   recv_count <-- number of elements received from each rank
+ *   recv_displ <-- displacement of elements received from each rank
+ *   comm       <-- associated communicator (for fallback)
+ *---------------------------------------------------------------------------*/
+
+static void
+_hier_alltoallv(const _hier_comm_t  *hr,
+                const void          *sendbuf,
+                const int            send_count[],
+                const int            send_displ[],
+                MPI_Datatype         datatype,
+                void                *recvbuf,
+                const int            recv_count[],
+                const int            recv_displ[],
+                MPI_Comm             comm)
+{
+  int type_size;
+  MPI_Aint type_lb, type_extent;
+  MPI_Type_size(datatype, &type_size);
+  MPI_Type_get_extent(datatype, &type_lb, &type_extent);
+
+  /* Use regular call when aggregation is not useful or possible */
+
+  if (   hr == nullptr
+      || hr->n_nodes == 1 || hr->n_nodes == hr->n_ranks
+      || type_lb != 0 || type_extent != type_size) {
+    MPI_Alltoallv(sendbuf, send_count, send_displ, datatype,
+                  recvbuf, recv_count, recv_displ, datatype,
+                  comm);
+    return;
+  }
+
+#if (MPI_VERSION >= 3)
+
+  const size_t ts = type_size;
+  const int n_ranks = hr->n_ranks;
+  const int n_l_ranks = hr->node_n_ranks;
+  const bool is_leader = (hr->leader_comm != MPI_COMM_NULL);
+
+  const unsigned char *_sendbuf = static_cast<const unsigned char *>(sendbuf);
+  unsigned char *_recvbuf = static_cast<unsigned char *>(recvbuf);
+
+  /* Gather send and receive counts of local ranks on node leader */
+
+  int *sr_count, *l_sr_count = nullptr;
+  BFT_MALLOC(sr_count, n_ranks*2, int);
+
+  size_t n_send = 0, n_recv = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    sr_count[i] = send_count[i];
+    sr_count[n_ranks + i] = recv_count[i];
+    n_send += send_count[i];
+    n_recv += recv_count[i];
+  }
+
+  if (is_leader)
+    BFT_MALLOC(l_sr_count, (size_t)n_l_ranks*n_ranks*2, int);
+
+  MPI_Gather(sr_count, n_ranks*2, MPI_INT,
+             l_sr_count, n_ranks*2, MPI_INT,
+             0, hr->node_comm);
+
+  BFT_FREE(sr_count);
+
+  /* Shared window: send data, then receive data, for each local rank;
+     send data is ordered by destination rank, and receive data by
+     source rank. */
+
+  unsigned char *w_base = nullptr;
+  MPI_Win win;
+
+  MPI_Win_allocate_shared((MPI_Aint)((n_send + n_recv)*ts), 1,
+                          MPI_INFO_NULL, hr->node_comm, &w_base, &win);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+  {
+    size_t k = 0;
+    for (int i = 0; i < n_ranks; i++) {
+      size_t n = send_count[i];
+      if (n > 0)
+        memcpy(w_base + k*ts, _sendbuf + (size_t)send_displ[i]*ts, n*ts);
+      k += n;
+    }
+  }
+
+  MPI_Win_sync(win);
+  MPI_Barrier(hr->node_comm);
+  MPI_Win_sync(win);
+
+  /* Aggregation and exchange between node leaders */
+
+  if (is_leader) {
+
+    const int n_nodes = hr->n_nodes;
+    const int *node_rank_idx = hr->node_rank_idx;
+    const int *node_ranks = hr->node_ranks;
+    const int *l_ranks = node_ranks + node_rank_idx[hr->node_id];
+
+    /* Segments and element displacements per local rank */
+
+    unsigned char **s_seg, **r_seg;
+    size_t *s_l_displ, *r_l_displ;
+    BFT_MALLOC(s_seg, n_l_ranks, unsigned char *);
+    BFT_MALLOC(r_seg, n_l_ranks, unsigned char *);
+    BFT_MALLOC(s_l_displ, (size_t)n_l_ranks*n_ranks, size_t);
+    BFT_MALLOC(r_l_displ, (size_t)n_l_ranks*n_ranks, size_t);
+
+    for (int l_id = 0; l_id < n_l_ranks; l_id++) {
+      MPI_Aint w_size;
+      int disp_unit;
+      void *seg_ptr;
+      MPI_Win_shared_query(win, l_id, &w_size, &disp_unit, &seg_ptr);
+      const int *_s_count = l_sr_count + (size_t)l_id*n_ranks*2;
+      const int *_r_count = _s_count + n_ranks;
+      size_t *_s_displ = s_l_displ + (size_t)l_id*n_ranks;
+      size_t *_r_displ = r_l_displ + (size_t)l_id*n_ranks;
+      size_t s_tot = 0, r_tot = 0;
+      for (int i = 0; i < n_ranks; i++) {
+        _s_displ[i] = s_tot;
+        _r_displ[i] = r_tot;
+        s_tot += _s_count[i];
+        r_tot += _r_count[i];
+      }
+      s_seg[l_id] = static_cast<unsigned char *>(seg_ptr);
+      r_seg[l_id] = s_seg[l_id] + s_tot*ts;
+    }
+
+    /* Counts per node; data sent to node m is ordered by destination
+       rank on m, then by local source rank. */
+
+    int *n_count, *n_displ;
+    BFT_MALLOC(n_count, n_nodes*4, int);
+    BFT_MALLOC(n_displ, n_nodes*4, int);
+    int *n_send_count = n_count, *n_recv_count = n_count + n_nodes*2;
+    int *n_send_displ = n_displ, *n_recv_displ = n_displ + n_nodes*2;
+
+    size_t n_send_tot = 0, n_recv_tot = 0;
+    for (int m = 0; m < n_nodes; m++) {
+      size_t n_s = 0, n_r = 0;
+      if (m != hr->node_id) {
+        for (int j = node_rank_idx[m]; j < node_rank_idx[m+1]; j++) {
+          int r_id = node_ranks[j];
+          for (int l_id = 0; l_id < n_l_ranks; l_id++) {
+            const int *_s_count = l_sr_count + (size_t)l_id*n_ranks*2;
+            n_s += _s_count[r_id];
+            n_r += _s_count[n_ranks + r_id];
+          }
+        }
+      }
+      if (n_send_tot + n_s > INT_MAX || n_recv_tot + n_r > INT_MAX)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s: aggregated node data too large for MPI counts."),
+                  __func__);
+      n_send_count[m] = n_s;
+      n_recv_count[m] = n_r;
+      n_send_displ[m] = n_send_tot;
+      n_recv_displ[m] = n_recv_tot;
+      n_send_tot += n_s;
+      n_recv_tot += n_r;
+    }
+
+    unsigned char *n_send_buf, *n_recv_buf;
+    BFT_MALLOC(n_send_buf, n_send_tot*ts, unsigned char);
+    BFT_MALLOC(n_recv_buf, n_recv_tot*ts, unsigned char);
+
+    /* Pack data for other nodes, and copy data for local node directly */
+
+    for (int m = 0; m < n_nodes; m++) {
+      unsigned char *p = n_send_buf + (size_t)n_send_displ[m]*ts;
+      for (int j = node_rank_idx[m]; j < node_rank_idx[m+1]; j++) {
+        int r_id = node_ranks[j];
+        for (int l_id = 0; l_id < n_l_ranks; l_id++) {
+          size_t n = l_sr_count[(size_t)l_id*n_ranks*2 + r_id];
+          if (n == 0)
+            continue;
+          const unsigned char *s_p
+            = s_seg[l_id] + s_l_displ[(size_t)l_id*n_ranks + r_id]*ts;
+          if (m != hr->node_id) {
+            memcpy(p, s_p, n*ts);
+            p += n*ts;
+          }
+          else {
+            int d_id = j - node_rank_idx[m];
+            int s_r_id = l_ranks[l_id];
+            memcpy(r_seg[d_id] + r_l_displ[(size_t)d_id*n_ranks + s_r_id]*ts,
+                   s_p, n*ts);
+          }
+        }
+      }
+    }
+
+    MPI_Alltoallv(n_send_buf, n_send_count, n_send_displ, datatype,
+                  n_recv_buf, n_recv_count, n_recv_displ, datatype,
+                  hr->leader_comm);
+
+    BFT_FREE(n_send_buf);
+
+    /* Dispatch received data to local rank segments; data received from
+       node m is ordered by local destination rank, then by source rank
+       on m. */
+
+    for (int m = 0; m < n_nodes; m++) {
+      if (m == hr->node_id)
+        continue;
+      const unsigned char *p = n_recv_buf + (size_t)n_recv_displ[m]*ts;
+      for (int l_id = 0; l_id < n_l_ranks; l_id++) {
+        const int *_r_count = l_sr_count + (size_t)l_id*n_ranks*2 + n_ranks;
+        const size_t *_r_displ = r_l_displ + (size_t)l_id*n_ranks;
+        for (int j = node_rank_idx[m]; j < node_rank_idx[m+1]; j++) {
+          int s_r_id = node_ranks[j];
+          size_t n = _r_count[s_r_id];
+          if (n > 0) {
+            memcpy(r_seg[l_id] + _r_displ[s_r_id]*ts, p, n*ts);
+            p += n*ts;
+          }
+        }
+      }
+    }
+
+    BFT_FREE(n_recv_buf);
+    BFT_FREE(n_displ);
+    BFT_FREE(n_count);
+    BFT_FREE(r_l_displ);
+    BFT_FREE(s_l_displ);
+    BFT_FREE(r_seg);
+    BFT_FREE(s_seg);
+    BFT_FREE(l_sr_count);
+  }
+
+  MPI_Win_sync(win);
+  MPI_Barrier(hr->node_comm);
+  MPI_Win_sync(win);
+
+  /* Copy received data from shared window */
+
+  {
+    const unsigned char *r_base = w_base + n_send*ts;
+    size_t k = 0;
+    for (int i = 0; i < n_ranks; i++) {
+      size_t n = recv_count[i];
+      if (n > 0)
+        memcpy(_recvbuf + (size_t)recv_displ[i]*ts, r_base + k*ts, n*ts);
+      k += n;
+    }
+  }
+
+  MPI_Win_unlock_all(win);
+  MPI_Win_free(&win);
+
+#endif /* (MPI_VERSION >= 3) */
+}
+
 /*----------------------------------------------------------------------------
  * First stage of creation for an MPI_Alltoall(v) caller for strided data.
  *
@@ -436,6 +880,8 @@ _alltoall_caller_create_meta(int        flags,
   dc->send_buffer = nullptr;
   dc->_send_buffer = nullptr;
 
+  dc->hr = nullptr;
+
   BFT_MALLOC(dc->send_count, dc->n_ranks, int);
   BFT_MALLOC(dc->recv_count, dc->n_ranks, int);
   BFT_MALLOC(dc->send_displ, dc->n_ranks + 1, int);
@@ -915,9 +1361,25 @@ _alltoall_caller_exchange_meta(_mpi_all_to_all_caller_t  *dc,
     _n_trace += 1;
   }
 
-  MPI_Alltoall(dc->send_count, 1, MPI_INT,
-               dc->recv_count, 1, MPI_INT,
-               dc->comm);
+  if (dc->hr != nullptr) {
+    int *ones, *displ;
+    BFT_MALLOC(ones, dc->n_ranks, int);
+    BFT_MALLOC(displ, dc->n_ranks, int);
+    for (int i = 0; i < dc->n_ranks; i++) {
+      ones[i] = 1;
+      displ[i] = i;
+    }
+    _hier_alltoallv(dc->hr,
+                    dc->send_count, ones, displ, MPI_INT,
+                    dc->recv_count, ones, displ,
+                    dc->comm);
+    BFT_FREE(displ);
+    BFT_FREE(ones);
+  }
+  else
+    MPI_Alltoall(dc->send_count, 1, MPI_INT,
+                 dc->recv_count, 1, MPI_INT,
+                 dc->comm);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_METADATA,
@@ -1004,9 +1466,17 @@ _alltoall_caller_exchange_s(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
-  MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
-                _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
-                dc->comm);
+  if (dc->hr != nullptr)
+    _hier_alltoallv(dc->hr,
+                    dc->send_buffer, dc->send_count, dc->send_displ,
+                    dc->comp_type,
+                    _recv_data, dc->recv_count, dc->recv_displ,
+                    dc->comm);
+  else
+    MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ,
+                  dc->comp_type,
+                  _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
+                  dc->comm);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
@@ -1164,9 +1634,17 @@ _alltoall_caller_exchange_i(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
-  MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
-                _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
-                dc->comm);
+  if (dc->hr != nullptr)
+    _hier_alltoallv(dc->hr,
+                    dc->send_buffer, dc->send_count, dc->send_displ,
+                    dc->comp_type,
+                    _recv_data, dc->recv_count, dc->recv_displ,
+                    dc->comm);
+  else
+    MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ,
+                  dc->comp_type,
+                  _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
+                  dc->comm);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
@@ -2406,6 +2884,10 @@ cs_all_to_all_create(size_t            n_elts,
 
   if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT)
     d->dc = _alltoall_caller_create_meta(flags, comm);
+  else if (d->type == CS_ALL_TO_ALL_HIERARCHICAL) {
+    d->dc = _alltoall_caller_create_meta(flags, comm);
+    d->dc->hr = _hier_comm_get(comm);
+  }
   else if (d->type == CS_ALL_TO_ALL_HYBRID)
     d->hc = _hybrid_pex_create_meta(flags, comm);
 
@@ -2497,6 +2979,10 @@ cs_all_to_all_create_from_block(size_t                 n_elts,
 
   if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT)
     d->dc = _alltoall_caller_create_meta(flags, comm);
+  else if (d->type == CS_ALL_TO_ALL_HIERARCHICAL) {
+    d->dc = _alltoall_caller_create_meta(flags, comm);
+    d->dc->hr = _hier_comm_get(comm);
+  }
   else if (d->type == CS_ALL_TO_ALL_HYBRID)
     d->hc = _hybrid_pex_create_meta(flags, comm);
 
@@ -2643,6 +3129,7 @@ cs_all_to_all_n_elts_dest(cs_all_to_all_t  *d)
     t0 = cs_timer_time();
 
     switch(d->type) {
+    case CS_ALL_TO_ALL_HIERARCHICAL:
     case CS_ALL_TO_ALL_MPI_DEFAULT:
       {
         _alltoall_caller_exchange_meta(d->dc,
@@ -2832,6 +3319,7 @@ cs_all_to_all_copy_array(cs_all_to_all_t   *d,
 
   switch(d->type) {
 
+  case CS_ALL_TO_ALL_HIERARCHICAL:
   case CS_ALL_TO_ALL_MPI_DEFAULT:
     {
       if (d->n_elts_dest < 0) { /* Exchange metadata if not done yet */
@@ -3036,6 +3524,13 @@ cs_all_to_all_copy_array(cs_all_to_all_t   *d,
                             &t0, &t1);
   _all_to_all_calls[CS_ALL_TO_ALL_TIME_TOTAL] += 1;
 
+  {
+    size_t n_elts = (reverse) ? d->n_elts_dest : d->n_elts_src;
+    cs_comm_stats_add(CS_COMM_STATS_ALL_TO_ALL, 1,
+                      n_elts*stride*cs_datatype_size[datatype], 0,
+                      (t1.sec - t0.sec) + (t1.nsec - t0.nsec)*1e-9);
+  }
+
   return _dest_data;
 }
 
@@ -3206,6 +3701,7 @@ cs_all_to_all_copy_indexed(cs_all_to_all_t  *d,
 
   switch(d->type) {
 
+  case CS_ALL_TO_ALL_HIERARCHICAL:
   case CS_ALL_TO_ALL_MPI_DEFAULT:
     {
       if (d->n_elts_dest < 0) { /* Exchange metadata if not done yet */
@@ -3462,6 +3958,7 @@ cs_all_to_all_get_src_rank(cs_all_to_all_t  *d)
 
   switch(d->type) {
 
+  case CS_ALL_TO_ALL_HIERARCHICAL:
   case CS_ALL_TO_ALL_MPI_DEFAULT:
     {
       const _mpi_all_to_all_caller_t *dc = d->dc;
@@ -3573,6 +4070,10 @@ cs_all_to_all_log_finalize(void)
 
 #if defined(HAVE_MPI)
 
+#if (MPI_VERSION >= 3)
+  _hier_comm_destroy(&_hier_comm);
+#endif
+
   if (_all_to_all_calls[0] <= 0)
     return;
 
@@ -3589,6 +4090,10 @@ cs_all_to_all_log_finalize(void)
   case CS_ALL_TO_ALL_CRYSTAL_ROUTER:
     snprintf(method_name, 96, N_("Crystal Router algorithm"));
     break;
+  case CS_ALL_TO_ALL_HIERARCHICAL:
+    snprintf(method_name, 96,
+             N_("Hierarchical (node aggregation), MPI_Alltoallv"));
+    break;
   }
   method_name[95] = '\0';
 
@@ -68,7 +68,8 @@ typedef enum {
 
   CS_ALL_TO_ALL_MPI_DEFAULT,
   CS_ALL_TO_ALL_HYBRID,
-  CS_ALL_TO_ALL_CRYSTAL_ROUTER
+  CS_ALL_TO_ALL_CRYSTAL_ROUTER,
+  CS_ALL_TO_ALL_HIERARCHICAL
 
 } cs_all_to_all_type_t;
 
@@ -0,0 +1,454 @@
+#ifndef __CS_ARRAY_PRIMITIVES_H__
+#define __CS_ARRAY_PRIMITIVES_H__
+
+/*============================================================================
+ * Parallel array primitives (scan, sort, segmented reduction, compaction)
+ * based on dispatch contexts.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#if defined(__cplusplus)
+#include <type_traits>
+#endif
+
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "bft_mem.h"
+
+#include "cs_base_accel.h"
+#include "cs_dispatch.h"
+#include "cs_parall.h"
+
+#if defined(__NVCC__)
+#include <cub/cub.cuh>
+#endif
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(__cplusplus)
+
+/*
+  These primitives follow the execution policy of the given dispatch context:
+  when the context runs on a CUDA device, the CUB library (shipped with the
+  CUDA toolkit) is used for scans and sorts, and arrays must be accessible
+  from the device. Otherwise, OpenMP-parallel host implementations are used.
+  Functions return only once results are available.
+*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Parallel exclusive prefix sum of an array.
+ *
+ * out[0] = 0, out[i] = in[0] + ... + in[i-1]. The output array may be
+ * the same as the input array (in-place scan).
+ *
+ * \tparam  T  value type
+ *
+ * \param[in, out]  ctx  reference to dispatch context
+ * \param[in]       n    number of elements
+ * \param[in]       in   input values
+ * \param[out]      out  scanned values
+ *
+ * \return  sum of all input values
+ */
+/*----------------------------------------------------------------------------*/
+
+template <typename T>
+T
+cs_array_exclusive_scan([[maybe_unused]] cs_dispatch_context  &ctx,
+                        cs_lnum_t                              n,
+                        const T                                in[],
+                        T                                      out[])
+{
+  if (n < 1)
+    return 0;
+
+#if defined(__NVCC__)
+
+  if (ctx.use_gpu()) {
+
+    cudaStream_t stream = ctx.cuda_stream();
+
+    /* Save last input value first, as the scan may be in-place */
+
+    T last[2];
+    cudaMemcpyAsync(last, in + n - 1, sizeof(T), cudaMemcpyDefault, stream);
+
+    size_t tmp_size = 0;
+    cub::DeviceScan::ExclusiveSum(nullptr, tmp_size, in, out, n, stream);
+
+    unsigned char *d_tmp = nullptr;
+    CS_MALLOC_HD(d_tmp, tmp_size, unsigned char, CS_ALLOC_DEVICE);
+
+    cub::DeviceScan::ExclusiveSum(d_tmp, tmp_size, in, out, n, stream);
+
+    cudaMemcpyAsync(last + 1, out + n - 1, sizeof(T), cudaMemcpyDefault,
+                    stream);
+    cudaStreamSynchronize(stream);
+
+    CS_FREE_HD(d_tmp);
+
+    return last[0] + last[1];
+  }
+
+#endif
+
+  /* Host: each thread scans its own contiguous block, offset by
+     the sum of preceding blocks. */
+
+#if defined(HAVE_OPENMP)
+  const int n_t_max = omp_get_max_threads();
+#else
+  const int n_t_max = 1;
+#endif
+
+  T *t_sum;
+  BFT_MALLOC(t_sum, n_t_max + 1, T);
+  t_sum[0] = 0;
+
+  int n_t = 1;
+
+  # pragma omp parallel if (n > CS_THR_MIN)
+  {
+#if defined(HAVE_OPENMP)
+    const int t_id = omp_get_thread_num();
+#else
+    const int t_id = 0;
+#endif
+
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(T), &s_id, &e_id);
+
+    T s = 0;
+    for (cs_lnum_t i = s_id; i < e_id; i++)
+      s += in[i];
+    t_sum[t_id + 1] = s;
+
+    # pragma omp barrier
+    # pragma omp single
+    {
+#if defined(HAVE_OPENMP)
+      n_t = omp_get_num_threads();
+#endif
+      for (int i = 0; i < n_t; i++)
+        t_sum[i+1] += t_sum[i];
+    }
+
+    s = t_sum[t_id];
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      T v = in[i];
+      out[i] = s;
+      s += v;
+    }
+  }
+
+  T total = t_sum[n_t];
+
+  BFT_FREE(t_sum);
+
+  return total;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Parallel stable sort of unsigned integer keys, returning the
+ *        matching ordering.
+ *
+ * This is a least significant digit radix sort, suited to global numbers
+ * (cs_gnum_t) or to Morton codes encoded in unsigned integers. As the sort
+ * is stable, elements with equal keys keep their initial relative order.
+ *
+ * \tparam  K  key type (unsigned integer type)
+ *
+ * \param[in, out]  ctx          reference to dispatch context
+ * \param[in]       n            number of elements
+ * \param[in]       keys         keys to sort
+ * \param[out]      order        ordering of keys (keys[order[i]] is
+ *                               increasing with i)
+ * \param[out]      sorted_keys  sorted keys, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+template <typename K>
+void
+cs_array_sort_by_key([[maybe_unused]] cs_dispatch_context  &ctx,
+                     cs_lnum_t                              n,
+                     const K                                keys[],
+                     cs_lnum_t                              order[],
+                     K                                     *sorted_keys = nullptr)
+{
+  static_assert(std::is_unsigned<K>::value,
+                "cs_array_sort_by_key requires unsigned integer keys");
+
+  if (n < 1)
+    return;
+
+#if defined(__NVCC__)
+
+  if (ctx.use_gpu()) {
+
+    cudaStream_t stream = ctx.cuda_stream();
+
+    cs_lnum_t *id_in = nullptr;
+    CS_MALLOC_HD(id_in, n, cs_lnum_t, CS_ALLOC_DEVICE);
+
+    K *k_out = sorted_keys;
+    if (k_out == nullptr)
+      CS_MALLOC_HD(k_out, n, K, CS_ALLOC_DEVICE);
+
+    ctx.parallel_for(n, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+      id_in[i] = i;
+    });
+
+    size_t tmp_size = 0;
+    cub::DeviceRadixSort::SortPairs(nullptr, tmp_size,
+                                    keys, k_out, id_in, order, n,
+                                    0, sizeof(K)*8, stream);
+
+    unsigned char *d_tmp = nullptr;
+    CS_MALLOC_HD(d_tmp, tmp_size, unsigned char, CS_ALLOC_DEVICE);
+
+    cub::DeviceRadixSort::SortPairs(d_tmp, tmp_size,
+                                    keys, k_out, id_in, order, n,
+                                    0, sizeof(K)*8, stream);
+
+    cudaStreamSynchronize(stream);
+
+    CS_FREE_HD(d_tmp);
+    CS_FREE_HD(id_in);
+    if (k_out != sorted_keys)
+      CS_FREE_HD(k_out);
+
+    return;
+  }
+
+#endif
+
+  /* Host: 8-bit digits, skipping leading digits which are zero
+     for all keys. */
+
+  const int n_digits = 256;
+
+  K k_max = 0;
+  for (cs_lnum_t i = 0; i < n; i++)
+    k_max = (keys[i] > k_max) ? keys[i] : k_max;
+
+  int n_passes = 0;
+  while (n_passes < (int)sizeof(K) && (k_max >> (8*n_passes)) > 0)
+    n_passes++;
+
+#if defined(HAVE_OPENMP)
+  const int n_t_max = omp_get_max_threads();
+#else
+  const int n_t_max = 1;
+#endif
+
+  K *k_buf[2];
+  cs_lnum_t *o_buf[2], *count;
+  BFT_MALLOC(k_buf[0], n, K);
+  BFT_MALLOC(k_buf[1], n, K);
+  BFT_MALLOC(o_buf[0], n, cs_lnum_t);
+  BFT_MALLOC(o_buf[1], n, cs_lnum_t);
+  BFT_MALLOC(count, (size_t)n_digits*n_t_max, cs_lnum_t);
+
+  # pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n; i++) {
+    k_buf[0][i] = keys[i];
+    o_buf[0][i] = i;
+  }
+
+  int src = 0;
+
+  for (int p = 0; p < n_passes; p++) {
+
+    const int shift = 8*p;
+    const K *k_src = k_buf[src];
+    const cs_lnum_t *o_src = o_buf[src];
+    K *k_dst = k_buf[1 - src];
+    cs_lnum_t *o_dst = o_buf[1 - src];
+
+    # pragma omp parallel if (n > CS_THR_MIN)
+    {
+#if defined(HAVE_OPENMP)
+      const int t_id = omp_get_thread_num();
+      const int n_t = omp_get_num_threads();
+#else
+      const int t_id = 0;
+      const int n_t = 1;
+#endif
+
+      cs_lnum_t s_id, e_id;
+      cs_parall_thread_range(n, sizeof(K), &s_id, &e_id);
+
+      cs_lnum_t *t_count = count + (size_t)n_digits*t_id;
+      for (int d = 0; d < n_digits; d++)
+        t_count[d] = 0;
+      for (cs_lnum_t i = s_id; i < e_id; i++)
+        t_count[(k_src[i] >> shift) & 0xff] += 1;
+
+      # pragma omp barrier
+
+      /* Digit-major, thread-minor offsets ensure stability */
+
+      # pragma omp single
+      {
+        cs_lnum_t s = 0;
+        for (int d = 0; d < n_digits; d++) {
+          for (int t = 0; t < n_t; t++) {
+            cs_lnum_t c = count[(size_t)n_digits*t + d];
+            count[(size_t)n_digits*t + d] = s;
+            s += c;
+          }
+        }
+      }
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+        cs_lnum_t j = t_count[(k_src[i] >> shift) & 0xff]++;
+        k_dst[j] = k_src[i];
+        o_dst[j] = o_src[i];
+      }
+    }
+
+    src = 1 - src;
+  }
+
+  memcpy(order, o_buf[src], n*sizeof(cs_lnum_t));
+  if (sorted_keys != nullptr)
+    memcpy(sorted_keys, k_buf[src], n*sizeof(K));
+
+  BFT_FREE(count);
+  BFT_FREE(o_buf[1]);
+  BFT_FREE(o_buf[0]);
+  BFT_FREE(k_buf[1]);
+  BFT_FREE(k_buf[0]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Parallel sum of values over segments defined by an index.
+ *
+ * out[s] = sum of vals[j] for idx[s] <= j < idx[s+1].
+ *
+ * \tparam  T  value type
+ *
+ * \param[in, out]  ctx     reference to dispatch context
+ * \param[in]       n_segs  number of segments
+ * \param[in]       idx     segment index (size: n_segs + 1)
+ * \param[in]       vals    values
+ * \param[out]      out     sum of values per segment
+ */
+/*----------------------------------------------------------------------------*/
+
+template <typename T>
+void
+cs_array_segmented_sum(cs_dispatch_context  &ctx,
+                       cs_lnum_t             n_segs,
+                       const cs_lnum_t       idx[],
+                       const T               vals[],
+                       T                     out[])
+{
+  ctx.parallel_for(n_segs, [=] CS_F_HOST_DEVICE (cs_lnum_t s) {
+    T sum = 0;
+    for (cs_lnum_t j = idx[s]; j < idx[s+1]; j++)
+      sum += vals[j];
+    out[s] = sum;
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Parallel stream compaction: build the ordered list of element ids
+ *        verifying a given predicate.
+ *
+ * The predicate is evaluated once per element, in the dispatch context,
+ * so it must be callable on the device when the context runs there.
+ *
+ * \tparam  P  predicate type (callable with a cs_lnum_t, returning a bool)
+ *
+ * \param[in, out]  ctx   reference to dispatch context
+ * \param[in]       n     number of elements
+ * \param[in]       pred  predicate
+ * \param[out]      ids   ids of selected elements (size: n)
+ *
+ * \return  number of selected elements
+ */
+/*----------------------------------------------------------------------------*/
+
+template <typename P>
+cs_lnum_t
+cs_array_compact(cs_dispatch_context  &ctx,
+                 cs_lnum_t             n,
+                 P                     pred,
+                 cs_lnum_t             ids[])
+{
+  if (n < 1)
+    return 0;
+
+  cs_lnum_t *pos = nullptr;
+  CS_MALLOC_HD(pos, n, cs_lnum_t, ctx.alloc_mode());
+
+  ctx.parallel_for(n, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    pos[i] = (pred(i)) ? 1 : 0;
+  });
+  ctx.wait();
+
+  const cs_lnum_t n_sel = cs_array_exclusive_scan(ctx, n, pos, pos);
+
+  ctx.parallel_for(n, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    cs_lnum_t next = (i < n - 1) ? pos[i+1] : n_sel;
+    if (next > pos[i])
+      ids[pos[i]] = i;
+  });
+  ctx.wait();
+
+  CS_FREE_HD(pos);
+
+  return n_sel;
+}
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* defined(__cplusplus) */
+
+#endif /* __CS_ARRAY_PRIMITIVES_H__ */
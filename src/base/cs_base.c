@@ -875,6 +875,9 @@ _cs_base_mpi_fin(void)
   if (   cs_glob_mpi_comm != MPI_COMM_NULL
       && cs_glob_mpi_comm != MPI_COMM_WORLD)
     MPI_Comm_free(&cs_glob_mpi_comm);
+
+  if (cs_glob_ensemble_peer_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&cs_glob_ensemble_peer_comm);
 }
 
 
@@ -1001,6 +1004,66 @@ _mpi_node_info(void)
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Split the main communicator into ensemble members if requested.
+ *
+ * When the CS_ENSEMBLE_N_MEMBERS environment variable is set to a value
+ * greater than 1, the ranks of this application are split into as many
+ * contiguous, equally-sized groups, each running an independent instance
+ * of the computation in its own "member_<id>" subdirectory (numbered
+ * from 1). cs_glob_mpi_comm is then restricted to the local member, and
+ * cs_glob_ensemble_peer_comm groups ranks with the same id in each member,
+ * allowing members to share data which does not depend on the member.
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_base_mpi_ensemble_setup(void)
+{
+  const char *s = getenv("CS_ENSEMBLE_N_MEMBERS");
+  if (s == NULL)
+    return;
+
+  int n_members = atoi(s);
+  if (n_members < 2)
+    return;
+
+  int n_ranks, rank;
+  MPI_Comm_size(cs_glob_mpi_comm, &n_ranks);
+  MPI_Comm_rank(cs_glob_mpi_comm, &rank);
+
+  if (n_ranks % n_members != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Ensemble mode: %d MPI ranks cannot be split evenly\n"
+                "into %d members."), n_ranks, n_members);
+
+  const int member_n_ranks = n_ranks / n_members;
+  const int member_id = rank / member_n_ranks;
+
+  MPI_Comm member_comm, peer_comm;
+  MPI_Comm_split(cs_glob_mpi_comm, member_id, rank, &member_comm);
+  MPI_Comm_split(cs_glob_mpi_comm, rank % member_n_ranks, member_id,
+                 &peer_comm);
+
+  if (cs_glob_mpi_comm != MPI_COMM_WORLD)
+    MPI_Comm_free(&cs_glob_mpi_comm);
+
+  cs_glob_mpi_comm = member_comm;
+  cs_glob_ensemble_peer_comm = peer_comm;
+  cs_glob_ensemble_n_members = n_members;
+  cs_glob_ensemble_member_id = member_id;
+
+  /* Each member runs in its own directory, so as to separate
+     inputs (other than shared data) and outputs */
+
+  char dir_name[32];
+  snprintf(dir_name, 32, "member_%04d", member_id + 1);
+
+  if (chdir(dir_name) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Ensemble mode: cannot change to member directory \"%s\"."),
+              dir_name);
+}
+
 /*----------------------------------------------------------------------------
  * Complete MPI setup.
  *
@@ -1044,6 +1107,8 @@ _cs_base_mpi_setup(const char *app_name)
   else
     cs_glob_mpi_comm = MPI_COMM_WORLD;
 
+  _cs_base_mpi_ensemble_setup();
+
   MPI_Comm_size(cs_glob_mpi_comm, &nbr);
   MPI_Comm_rank(cs_glob_mpi_comm, &rank);
 
@@ -1082,6 +1147,125 @@ _cs_base_mpi_setup(const char *app_name)
 
 #endif /* HAVE_MPI */
 
+/*----------------------------------------------------------------------------
+ * Compare allocation sites by decreasing size at sampled peak (qsort
+ * function).
+ *
+ * parameters:
+ *   x <-> pointer to first site
+ *   y <-> pointer to second site
+ *
+ * returns:
+ *   < 0 if x has a larger size at peak than y, > 0 if smaller, 0 if equal
+ *----------------------------------------------------------------------------*/
+
+static int
+_cs_base_mem_site_compare(const void  *x,
+                          const void  *y)
+{
+  const bft_mem_site_t *s0 = x, *s1 = y;
+
+  if (s0->peak_size > s1->peak_size)
+    return -1;
+  else if (s0->peak_size < s1->peak_size)
+    return 1;
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Log sampled memory statistics by allocation site and by subsystem
+ * (source subdirectory) if sampled allocation tracking is active.
+ *
+ * Statistics are those of the local rank (so rank 0 for the log).
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_base_mem_sampling_log(void)
+{
+  const int n_sites = bft_mem_sampling_n_sites();
+
+  if (n_sites < 1)
+    return;
+
+  const double mib = 1. / (1024.*1024.);
+  const int n_max_log = 25, n_max_sub = 64;
+
+  size_t cur_size, max_size, n_dropped;
+  bft_mem_sampling_summary(&cur_size, &max_size, &n_dropped);
+
+  bft_mem_site_t *sites = malloc(n_sites * sizeof(bft_mem_site_t));
+  for (int i = 0; i < n_sites; i++)
+    bft_mem_sampling_site_info(i, sites + i);
+
+  qsort(sites, n_sites, sizeof(bft_mem_site_t), _cs_base_mem_site_compare);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nSampled memory allocations (local):\n\n"
+                  "  Estimated peak memory:   %12.3f MiB\n"
+                  "  Dropped samples:         %12llu\n\n"
+                  "  Largest sites at peak:        at peak (MiB)"
+                  "    maximum (MiB)\n"),
+                max_size*mib, (unsigned long long)n_dropped);
+
+  for (int i = 0; i < n_sites && i < n_max_log; i++) {
+    if (sites[i].peak_size == 0)
+      break;
+    const char *name = strrchr(sites[i].file_name, '/');
+    name = (name != NULL) ? name + 1 : sites[i].file_name;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "    %-32s:%6d %12.3f %16.3f\n",
+                  name, sites[i].line_num,
+                  sites[i].peak_size*mib, sites[i].max_size*mib);
+  }
+
+  /* Aggregate by subsystem, based on the source file's directory name */
+
+  int n_sub = 0;
+  char sub_name[64][32];
+  size_t sub_size[64];
+
+  for (int i = 0; i < n_sites; i++) {
+    const char *f = sites[i].file_name;
+    const char *e = strrchr(f, '/');
+    const char *b = e;
+    char name[32] = "-";
+    if (e != NULL) {
+      for (b = e; b > f && *(b-1) != '/'; b--);
+      size_t l = e - b;
+      if (l > 31)
+        l = 31;
+      strncpy(name, b, l);
+      name[l] = '\0';
+    }
+    int j;
+    for (j = 0; j < n_sub; j++) {
+      if (strcmp(sub_name[j], name) == 0)
+        break;
+    }
+    if (j == n_sub) {
+      if (n_sub >= n_max_sub)
+        continue;
+      strcpy(sub_name[j], name);
+      sub_size[j] = 0;
+      n_sub++;
+    }
+    sub_size[j] += sites[i].peak_size;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n  Subsystems at peak:            at peak (MiB)\n"));
+
+  for (int j = 0; j < n_sub; j++) {
+    if (sub_size[j] > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "    %-32s       %12.3f\n",
+                    sub_name[j], sub_size[j]*mib);
+  }
+
+  free(sites);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1270,6 +1454,17 @@ cs_base_mpi_init(int    *argc,
   int arg_id = 0, flag = 0;
   int use_mpi = false;
 
+#if defined(HAVE_OPENMP)
+
+  /* Full thread support is required by asynchronous checkpointing,
+     and is requested only when explicitely set, as it may be costly */
+
+  int thread_level = MPI_THREAD_FUNNELED;
+  if (getenv("CS_MPI_THREAD_MULTIPLE") != NULL)
+    thread_level = MPI_THREAD_MULTIPLE;
+
+#endif
+
   if (getenv("PMIX_RANK") != NULL)
     use_mpi = true;
 
@@ -1309,7 +1504,7 @@ cs_base_mpi_init(int    *argc,
     if (!flag) {
 #if defined(HAVE_OPENMP)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, thread_level, &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1337,7 +1532,7 @@ cs_base_mpi_init(int    *argc,
     if (!flag) {
 #if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      MPI_Init_thread(argc, argv, thread_level, &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1684,6 +1879,21 @@ cs_base_mem_init(void)
     cs_glob_base_bft_mem_init = true;
 
   }
+
+  /* Sampled allocation tracking (average bytes between samples) */
+
+  long long sample_period = 0;
+  const char *sample_s = getenv("CS_MEM_SAMPLING");
+  if (sample_s != NULL)
+    sample_period = atoll(sample_s);
+
+  /* Memory footprint report (by subsystem) requires sampled tracking */
+
+  if (sample_period <= 0 && getenv("CS_MEM_FOOTPRINT") != NULL)
+    sample_period = 65536;
+
+  if (sample_period > 0)
+    bft_mem_sampling_set(sample_period);
 }
 
 /*----------------------------------------------------------------------------
@@ -1841,6 +2051,8 @@ cs_base_mem_finalize(void)
 
   }
 
+  _cs_base_mem_sampling_log();
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
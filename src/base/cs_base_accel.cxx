@@ -31,6 +31,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -39,6 +40,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <map>
+#include <vector>
 
 #if defined(SYCL_LANGUAGE_VERSION)
 #include <sycl/sycl.hpp>
@@ -51,6 +53,8 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "cs_log.h"
+
 #if defined(HAVE_CUDA)
 #include "cs_base_cuda.h"
 #endif
@@ -73,6 +77,16 @@
  * Local Type Definitions
  *============================================================================*/
 
+/* Cached (pooled) block */
+
+typedef struct {
+
+  void  *host_ptr;     /* host pointer (or nullptr) */
+  void  *device_ptr;   /* device pointer (or nullptr) */
+  int    epoch;        /* pool epoch at which block was released */
+
+} cs_mem_pool_block_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -84,6 +98,25 @@
 static bool _initialized = false;
 static bool _ignore_prefetch = false;
 
+/* Optional counting of host/device transfers (0: h2d, 1: d2h) */
+
+static bool       _count_transfers = false;
+static cs_gnum_t  _n_transfers[2] = {0, 0};
+static cs_gnum_t  _n_transfer_bytes[2] = {0, 0};
+
+/* Pool of released blocks for pinned, shared, and device allocation modes,
+   indexed by mode and rounded capacity. */
+
+static bool  _pool_active = true;
+static int   _pool_epoch = 0;
+
+static std::map<size_t, std::vector<cs_mem_pool_block_t>>  _pool[3];
+
+static size_t  _pool_bytes = 0;
+static size_t  _pool_bytes_max = 0;
+static unsigned long long  _pool_n_hits = 0;
+static unsigned long long  _pool_n_misses = 0;
+
 /*! Default "host+device" allocation mode */
 /*----------------------------------------*/
 
@@ -158,6 +191,287 @@ _realloc_host(void            *host_ptr,
                        var_name, file_name, line_num);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Increment host/device transfer counters if active.
+ *
+ * \param [in]  direction  0 for host to device, 1 for device to host
+ * \param [in]  size       number of bytes transferred
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_add_transfer(int     direction,
+              size_t  size)
+{
+  if (_count_transfers) {
+    _n_transfers[direction] += 1;
+    _n_transfer_bytes[direction] += size;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the pool index associated with an allocation mode.
+ *
+ * \param [in]  mode  allocation mode
+ *
+ * \returns pool index, or -1 if blocks of this mode are not pooled.
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+_pool_id(cs_alloc_mode_t  mode)
+{
+  if (_pool_active == false)
+    return -1;
+
+  switch(mode) {
+  case CS_ALLOC_HOST_DEVICE_PINNED:
+    return 0;
+  case CS_ALLOC_HOST_DEVICE_SHARED:
+    return 1;
+  case CS_ALLOC_DEVICE:
+    return 2;
+  default:
+    return -1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the capacity of a block of a given size.
+ *
+ * For pooled modes, sizes are rounded up to one of 4 size classes per
+ * power of 2 (so that at most 25% more memory is allocated), with a
+ * minimum of 256 bytes, so that released blocks may be reused for
+ * slightly different sizes.
+ *
+ * \param [in]  mode  allocation mode
+ * \param [in]  size  requested size
+ *
+ * \returns block capacity.
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_pool_capacity(cs_alloc_mode_t  mode,
+               size_t           size)
+{
+  if (_pool_id(mode) < 0)
+    return size;
+
+  if (size <= 256)
+    return 256;
+
+  size_t base = 256;
+  while (base*2 < size)
+    base *= 2;
+
+  size_t step = base / 4;
+
+  return base + ((size - base + step - 1) / step) * step;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free memory on host and device for a given memory block.
+ *
+ * \param [in]  me         memory block info
+ * \param [in]  var_name   allocated variable name string
+ * \param [in]  file_name  name of calling source file
+ * \param [in]  line_num   line number in calling source file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_block(const cs_mem_block_t  *me,
+            const char            *var_name,
+            const char            *file_name,
+            int                    line_num)
+{
+#if !defined(HAVE_CUDA)
+  CS_UNUSED(file_name);
+  CS_UNUSED(line_num);
+#endif
+
+  if (me->mode < CS_ALLOC_HOST_DEVICE_PINNED)
+    bft_mem_free(me->host_ptr, var_name, nullptr, 0);
+
+  else if (me->host_ptr != nullptr) {
+
+#if defined(HAVE_CUDA)
+
+    if (me->mode == CS_ALLOC_HOST_DEVICE_SHARED)
+      cs_cuda_mem_free(me->host_ptr, var_name, file_name, line_num);
+    else
+      cs_cuda_mem_free_host(me->host_ptr, var_name, file_name, line_num);
+
+#elif defined(SYCL_LANGUAGE_VERSION)
+
+    sycl::free(me->host_ptr, cs_glob_sycl_queue);
+
+#elif defined(HAVE_OPENMP_TARGET)
+
+    omp_target_free(me->host_ptr, cs_glob_omp_target_device_id);
+
+#endif
+
+  }
+
+  if (me->device_ptr != nullptr && me->device_ptr != me->host_ptr) {
+
+#if defined(HAVE_CUDA)
+
+    cs_cuda_mem_free(me->device_ptr, var_name, file_name, line_num);
+
+#elif defined(SYCL_LANGUAGE_VERSION)
+
+    sycl::free(me->device_ptr, cs_glob_sycl_queue);
+
+#elif defined(HAVE_OPENMP_TARGET)
+
+    omp_target_free(me->device_ptr, cs_glob_omp_target_device_id);
+
+#endif
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get a released block from the pool.
+ *
+ * \param [in]   mode  allocation mode
+ * \param [in]   size  requested size
+ * \param [out]  me    matching memory block info (pointers set
+ *                     if a pooled block is available)
+ *
+ * \returns true if a pooled block was found, false otherwise.
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_pool_get(cs_alloc_mode_t   mode,
+          size_t            size,
+          cs_mem_block_t   *me)
+{
+  int p_id = _pool_id(mode);
+  if (p_id < 0)
+    return false;
+
+  auto it = _pool[p_id].find(_pool_capacity(mode, size));
+
+  if (it == _pool[p_id].end() || it->second.empty()) {
+    _pool_n_misses += 1;
+    return false;
+  }
+
+  cs_mem_pool_block_t b = it->second.back();
+  it->second.pop_back();
+
+  me->host_ptr = b.host_ptr;
+  me->device_ptr = b.device_ptr;
+
+  _pool_bytes -= it->first;
+  _pool_n_hits += 1;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Release a block to the pool instead of freeing it.
+ *
+ * \param [in]  me  memory block info
+ *
+ * \returns true if the block was added to the pool, false otherwise.
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_pool_put(const cs_mem_block_t  *me)
+{
+  int p_id = _pool_id(me->mode);
+  if (p_id < 0)
+    return false;
+
+  size_t capacity = _pool_capacity(me->mode, me->size);
+
+  cs_mem_pool_block_t b = {
+    .host_ptr = me->host_ptr,
+    .device_ptr = me->device_ptr,
+    .epoch = _pool_epoch};
+
+  /* The device copy of a pinned block is not kept, as its values
+     would not match those of the next user of the host block. */
+
+  if (me->mode == CS_ALLOC_HOST_DEVICE_PINNED && me->device_ptr != nullptr) {
+    cs_mem_block_t me_d = {
+      .host_ptr = nullptr,
+      .device_ptr = me->device_ptr,
+      .size = me->size,
+      .mode = me->mode};
+    _free_block(&me_d, "me.device_ptr", __FILE__, __LINE__);
+    b.device_ptr = nullptr;
+  }
+
+  _pool[p_id][capacity].push_back(b);
+
+  _pool_bytes += capacity;
+  if (_pool_bytes > _pool_bytes_max)
+    _pool_bytes_max = _pool_bytes;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free pooled blocks released before a given epoch.
+ *
+ * \param [in]  epoch  blocks released at an earlier epoch are freed
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_pool_free_before(int  epoch)
+{
+  const cs_alloc_mode_t p_mode[3] = {CS_ALLOC_HOST_DEVICE_PINNED,
+                                     CS_ALLOC_HOST_DEVICE_SHARED,
+                                     CS_ALLOC_DEVICE};
+
+  for (int p_id = 0; p_id < 3; p_id++) {
+
+    for (auto it = _pool[p_id].begin(); it != _pool[p_id].end(); ) {
+
+      std::vector<cs_mem_pool_block_t> &v = it->second;
+      size_t n_keep = 0;
+
+      for (size_t i = 0; i < v.size(); i++) {
+        if (v[i].epoch < epoch) {
+          cs_mem_block_t me = {
+            .host_ptr = v[i].host_ptr,
+            .device_ptr = v[i].device_ptr,
+            .size = it->first,
+            .mode = p_mode[p_id]};
+          _free_block(&me, "pooled block", __FILE__, __LINE__);
+          _pool_bytes -= it->first;
+        }
+        else
+          v[n_keep++] = v[i];
+      }
+
+      v.resize(n_keep);
+
+      if (v.empty())
+        it = _pool[p_id].erase(it);
+      else
+        ++it;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialize memory mapping on device.
@@ -182,6 +496,13 @@ _initialize(void)
     if (i > 0)
       _ignore_prefetch = true;
   }
+
+  const char s_pool[] = "CS_HD_MEM_POOL";
+  if (getenv(s_pool) != NULL) {
+    int i = atoi(getenv(s_pool));
+    if (i < 1)
+      _pool_active = false;
+  }
 }
 
 #if defined(SYCL_LANGUAGE_VERSION)
@@ -509,10 +830,19 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
     .size = ni * size,
     .mode = mode};
 
+  /* Allocated capacity (rounded up for pooled modes) */
+
+  const size_t a_size = _pool_capacity(mode, me.size);
+
   if (mode < CS_ALLOC_HOST_DEVICE_PINNED) {
     me.host_ptr = bft_mem_malloc(ni, size, var_name, nullptr, 0);
   }
 
+  // Reuse a previously released block of matching capacity if available
+
+  else if (_pool_get(mode, me.size, &me))
+    assert(me.host_ptr != nullptr || me.device_ptr != nullptr);
+
   // Device allocation will be postponed later thru call to
   // cs_get_device_ptr. This applies for CS_ALLOC_HOST_DEVICE
   // and CS_ALLOC_HOST_DEVICE_PINNED modes
@@ -520,13 +850,13 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
 #if defined(HAVE_CUDA)
 
   else if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
-    me.host_ptr = cs_cuda_mem_malloc_host(me.size,
+    me.host_ptr = cs_cuda_mem_malloc_host(a_size,
                                           var_name,
                                           file_name,
                                           line_num);
 
   else if (mode == CS_ALLOC_HOST_DEVICE_SHARED) {
-    me.host_ptr = cs_cuda_mem_malloc_managed(me.size,
+    me.host_ptr = cs_cuda_mem_malloc_managed(a_size,
                                              var_name,
                                              file_name,
                                              line_num);
@@ -534,7 +864,7 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
   }
 
   else if (mode == CS_ALLOC_DEVICE)
-    me.device_ptr = cs_cuda_mem_malloc_device(me.size,
+    me.device_ptr = cs_cuda_mem_malloc_device(a_size,
                                               var_name,
                                               file_name,
                                               line_num);
@@ -542,13 +872,13 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
 #elif defined(SYCL_LANGUAGE_VERSION)
 
   else if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
-    me.host_ptr = _sycl_mem_malloc_host(me.size,
+    me.host_ptr = _sycl_mem_malloc_host(a_size,
                                         var_name,
                                         file_name,
                                         line_num);
 
   else if (mode == CS_ALLOC_HOST_DEVICE_SHARED) {
-    me.host_ptr = _sycl_mem_malloc_shared(me.size,
+    me.host_ptr = _sycl_mem_malloc_shared(a_size,
                                           var_name,
                                           file_name,
                                           line_num);
@@ -556,7 +886,7 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
   }
 
   else if (mode == CS_ALLOC_DEVICE)
-    me.device_ptr = _sycl_mem_malloc_device(me.size,
+    me.device_ptr = _sycl_mem_malloc_device(a_size,
                                             var_name,
                                             file_name,
                                             line_num);
@@ -564,13 +894,13 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
 #elif defined(HAVE_OPENMP_TARGET)
 
   else if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
-    me.host_ptr = _omp_target_mem_malloc_host(me.size,
+    me.host_ptr = _omp_target_mem_malloc_host(a_size,
                                               var_name,
                                               file_name,
                                               line_num);
 
   else if (mode == CS_ALLOC_HOST_DEVICE_SHARED) {
-    me.host_ptr = _omp_target_mem_malloc_managed(me.size,
+    me.host_ptr = _omp_target_mem_malloc_managed(a_size,
                                                  var_name,
                                                  file_name,
                                                  line_num);
@@ -578,7 +908,7 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
   }
 
   else if (mode == CS_ALLOC_DEVICE)
-    me.device_ptr = _omp_target_mem_malloc_device(me.size,
+    me.device_ptr = _omp_target_mem_malloc_device(a_size,
                                                   var_name,
                                                   file_name,
                                                   line_num);
@@ -659,6 +989,22 @@ cs_realloc_hd(void            *ptr,
       return me.device_ptr;
   }
 
+  /* Pooled blocks may be resized in place within their capacity */
+
+  if (   mode == me.mode && mode != CS_ALLOC_HOST_DEVICE_PINNED
+      && _pool_id(mode) > -1
+      && _pool_capacity(mode, new_size) == _pool_capacity(mode, me.size)) {
+    cs_mem_block_t me_old = me;
+    me.size = new_size;
+    if (file_name != nullptr)
+      bft_mem_update_block_info(var_name, file_name, line_num,
+                                &me_old, &me);
+    if (me.host_ptr != nullptr)
+      return me.host_ptr;
+    else
+      return me.device_ptr;
+  }
+
   cs_mem_block_t me_old = me;
   me.mode = mode;
 
@@ -747,47 +1093,8 @@ cs_free_hd(void        *ptr,
 
   cs_mem_block_t me = bft_mem_get_block_info_try(ptr);
 
-  if (me.mode < CS_ALLOC_HOST_DEVICE_PINNED)
-    bft_mem_free(me.host_ptr, var_name, nullptr, 0);
-
-  else if (me.host_ptr != nullptr) {
-
-#if defined(HAVE_CUDA)
-
-    if (me.mode == CS_ALLOC_HOST_DEVICE_SHARED)
-      cs_cuda_mem_free(me.host_ptr, var_name, file_name, line_num);
-    else
-      cs_cuda_mem_free_host(me.host_ptr, var_name, file_name, line_num);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-    sycl::free(me.host_ptr, cs_glob_sycl_queue);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
-    omp_target_free(me.host_ptr, cs_glob_omp_target_device_id);
-
-#endif
-
-  }
-
-  if (me.device_ptr != nullptr && me.device_ptr != me.host_ptr) {
-
-#if defined(HAVE_CUDA)
-
-    cs_cuda_mem_free(me.device_ptr, var_name, file_name, line_num);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-    sycl::free(me.device_ptr, cs_glob_sycl_queue);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
-    omp_target_free(me.device_ptr, cs_glob_omp_target_device_id);
-
-#endif
-
-  }
+  if (_pool_put(&me) == false)
+    _free_block(&me, var_name, file_name, line_num);
 
   if (file_name != nullptr)
     bft_mem_update_block_info(var_name, file_name, line_num,
@@ -1272,6 +1579,7 @@ cs_sync_h2d(const void  *ptr)
     break;
 
   case CS_ALLOC_HOST_DEVICE:
+    _add_transfer(0, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_h2d(me.device_ptr, me.host_ptr, me.size);
@@ -1289,6 +1597,7 @@ cs_sync_h2d(const void  *ptr)
     break;
 
   case CS_ALLOC_HOST_DEVICE_PINNED:
+    _add_transfer(0, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_h2d_async(me.device_ptr, me.host_ptr, me.size);
@@ -1310,6 +1619,8 @@ cs_sync_h2d(const void  *ptr)
     if (_ignore_prefetch)
       return;
 
+    _add_transfer(0, me.size);
+
     #if defined(HAVE_CUDA)
     {
       cs_cuda_prefetch_h2d(me.device_ptr, me.size);
@@ -1371,6 +1682,7 @@ cs_sync_h2d_future(const void  *ptr)
   switch (me.mode) {
 
   case CS_ALLOC_HOST_DEVICE:
+    _add_transfer(0, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_h2d(me.device_ptr, me.host_ptr, me.size);
@@ -1388,6 +1700,7 @@ cs_sync_h2d_future(const void  *ptr)
     break;
 
   case CS_ALLOC_HOST_DEVICE_PINNED:
+    _add_transfer(0, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_h2d_async(me.device_ptr, me.host_ptr, me.size);
@@ -1447,6 +1760,7 @@ cs_sync_d2h(void  *ptr)
     break;
 
   case CS_ALLOC_HOST_DEVICE:
+    _add_transfer(1, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_d2h(me.host_ptr, me.device_ptr, me.size);
@@ -1464,6 +1778,7 @@ cs_sync_d2h(void  *ptr)
     break;
 
   case CS_ALLOC_HOST_DEVICE_PINNED:
+    _add_transfer(1, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_d2h_async(me.host_ptr, me.device_ptr, me.size);
@@ -1485,6 +1800,8 @@ cs_sync_d2h(void  *ptr)
     if (_ignore_prefetch)
       return;
 
+    _add_transfer(1, me.size);
+
     #if defined(HAVE_CUDA)
     {
       cs_cuda_prefetch_d2h(me.host_ptr, me.size);
@@ -1541,6 +1858,7 @@ cs_sync_d2h_if_needed(void  *ptr)
   switch (me.mode) {
 
   case CS_ALLOC_HOST_DEVICE:
+    _add_transfer(1, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_d2h(me.host_ptr, me.device_ptr, me.size);
@@ -1558,6 +1876,7 @@ cs_sync_d2h_if_needed(void  *ptr)
     break;
 
   case CS_ALLOC_HOST_DEVICE_PINNED:
+    _add_transfer(1, me.size);
     #if defined(HAVE_CUDA)
     {
       cs_cuda_copy_d2h_async(me.host_ptr, me.device_ptr, me.size);
@@ -1676,6 +1995,8 @@ cs_copy_h2d(void        *dest,
   if (src == NULL)
     return;
 
+  _add_transfer(0, size);
+
 #if defined(HAVE_CUDA)
 
   cs_cuda_copy_h2d(dest, src, size);
@@ -1713,6 +2034,8 @@ cs_copy_d2h(void        *dest,
   if (src == NULL)
     return;
 
+  _add_transfer(1, size);
+
 #if defined(HAVE_CUDA)
 
   cs_cuda_copy_d2h(dest, src, size);
@@ -1766,6 +2089,125 @@ cs_copy_d2d(void        *dest,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start counting host/device transfers.
+ *
+ * Counters are reset, then incremented by each synchronization or copy
+ * implying a transfer (or prefetch) between host and device, until
+ * \ref cs_transfer_count_stop is called.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_transfer_count_start(void)
+{
+  for (int i = 0; i < 2; i++) {
+    _n_transfers[i] = 0;
+    _n_transfer_bytes[i] = 0;
+  }
+
+  _count_transfers = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Stop counting host/device transfers and return the local counts
+ *        since the matching call to \ref cs_transfer_count_start.
+ *
+ * \param [out]  n_transfers  number of host to device and device to host
+ *                            transfers
+ * \param [out]  n_bytes      number of bytes transferred from host to device
+ *                            and from device to host
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_transfer_count_stop(cs_gnum_t  n_transfers[2],
+                       cs_gnum_t  n_bytes[2])
+{
+  _count_transfers = false;
+
+  for (int i = 0; i < 2; i++) {
+    n_transfers[i] = _n_transfers[i];
+    n_bytes[i] = _n_transfer_bytes[i];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate pooling of released host/device blocks.
+ *
+ * When active, blocks allocated with the CS_ALLOC_HOST_DEVICE_PINNED,
+ * CS_ALLOC_HOST_DEVICE_SHARED, or CS_ALLOC_DEVICE modes are not freed
+ * by \ref cs_free_hd, but kept for reuse by later allocations of the same
+ * size class. Deactivating the pool frees all cached blocks.
+ *
+ * The pool is active by default, unless the CS_HD_MEM_POOL environment
+ * variable is set to 0.
+ *
+ * \param [in]  active  true to activate, false to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_pool_set_active(bool  active)
+{
+  if (_initialized == false)
+   _initialize();
+
+  if (active == false)
+    _pool_free_before(INT_MAX);
+
+  _pool_active = active;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free pooled blocks which were not reused since the previous call,
+ *        and start a new pool epoch.
+ *
+ * This is usually called once per time step, so that temporary arrays
+ * of a given step reuse those of the previous one, while memory cached
+ * for sizes which are not requested anymore is returned to the system.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_pool_trim(void)
+{
+  _pool_free_before(_pool_epoch);
+  _pool_epoch += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log pool statistics and free all pooled blocks.
+ *
+ * Blocks released after this call are pooled again if the pool is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_pool_release(void)
+{
+  if (_pool_n_hits + _pool_n_misses > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Host/device memory pool (local):\n\n"
+                    "  Number of reused blocks:       %llu\n"
+                    "  Number of allocated blocks:    %llu\n"
+                    "  Maximum cached memory (MiB):   %.3f\n"),
+                  _pool_n_hits, _pool_n_misses,
+                  (double)_pool_bytes_max / (1024.*1024.));
+
+  _pool_free_before(INT_MAX);
+
+  _pool_n_hits = 0;
+  _pool_n_misses = 0;
+  _pool_bytes_max = 0;
+}
+
 #if defined(HAVE_SYCL)
 
 /*----------------------------------------------------------------------------*/
@@ -878,6 +878,138 @@ cs_copy_d2d(void        *dest,
 
 #endif /* defined(HAVE_ACCEL) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start counting host/device transfers.
+ *
+ * Counters are reset, then incremented by each synchronization or copy
+ * implying a transfer (or prefetch) between host and device, until
+ * \ref cs_transfer_count_stop is called.
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_transfer_count_start(void);
+
+#else
+
+static inline void
+cs_transfer_count_start(void)
+{
+}
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Stop counting host/device transfers and return the local counts
+ *        since the matching call to \ref cs_transfer_count_start.
+ *
+ * \param [out]  n_transfers  number of host to device and device to host
+ *                            transfers
+ * \param [out]  n_bytes      number of bytes transferred from host to device
+ *                            and from device to host
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_transfer_count_stop(cs_gnum_t  n_transfers[2],
+                       cs_gnum_t  n_bytes[2]);
+
+#else
+
+static inline void
+cs_transfer_count_stop(cs_gnum_t  n_transfers[2],
+                       cs_gnum_t  n_bytes[2])
+{
+  n_transfers[0] = 0; n_transfers[1] = 0;
+  n_bytes[0] = 0; n_bytes[1] = 0;
+}
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate pooling of released host/device blocks.
+ *
+ * When active, blocks allocated with the CS_ALLOC_HOST_DEVICE_PINNED,
+ * CS_ALLOC_HOST_DEVICE_SHARED, or CS_ALLOC_DEVICE modes are not freed
+ * by \ref cs_free_hd, but kept for reuse by later allocations of the same
+ * size class. Deactivating the pool frees all cached blocks.
+ *
+ * The pool is active by default, unless the CS_HD_MEM_POOL environment
+ * variable is set to 0.
+ *
+ * \param [in]  active  true to activate, false to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_mem_pool_set_active(bool  active);
+
+#else
+
+static inline void
+cs_mem_pool_set_active(bool  active)
+{
+  CS_UNUSED(active);
+}
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free pooled blocks which were not reused since the previous call,
+ *        and start a new pool epoch.
+ *
+ * This is usually called once per time step, so that temporary arrays
+ * of a given step reuse those of the previous one, while memory cached
+ * for sizes which are not requested anymore is returned to the system.
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_mem_pool_trim(void);
+
+#else
+
+static inline void
+cs_mem_pool_trim(void)
+{
+}
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log pool statistics and free all pooled blocks.
+ *
+ * Blocks released after this call are pooled again if the pool is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_mem_pool_release(void);
+
+#else
+
+static inline void
+cs_mem_pool_release(void)
+{
+}
+
+#endif
+
 #if defined(HAVE_OPENMP_TARGET)
 
 /*----------------------------------------------------------------------------*/
@@ -42,6 +42,10 @@
 #include "cs_base.h"
 #include "cs_log.h"
 
+#if defined(HAVE_MPI) && defined(OMPI_MAJOR_VERSION)
+#include <mpi-ext.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -784,7 +788,7 @@ cs_base_cuda_select_default_device(void)
   if (_cs_glob_stream_pf == 0)
     cudaStreamCreate(&_cs_glob_stream_pf);
 
-  /* Finally, determine whether we may use graphs for some kernel launches. */
+  /* Determine whether we may use graphs for some kernel launches. */
 
   const char s[] = "CS_CUDA_ALLOW_GRAPH";
   if (getenv(s) != nullptr) {
@@ -792,6 +796,24 @@ cs_base_cuda_select_default_device(void)
     cs_glob_cuda_allow_graph = (i <= 0) ? false : true;
   }
 
+  /* Finally, check whether MPI is CUDA-aware, so that halo exchanges
+     may work directly on device buffers. The build-time Open MPI
+     extension flag is not sufficient, so use the run-time query, and
+     allow forcing the setting using an environment variable. */
+
+#if defined(HAVE_MPI)
+#if defined(OMPI_HAVE_MPI_EXT_CUDA) && OMPI_HAVE_MPI_EXT_CUDA
+  if (MPIX_Query_cuda_support() == 1)
+    cs_mpi_device_support = 1;
+#endif
+
+  const char s_mpi[] = "CS_MPI_DEVICE_SUPPORT";
+  if (getenv(s_mpi) != nullptr) {
+    int i = atoi(getenv(s_mpi));
+    cs_mpi_device_support = (i <= 0) ? 0 : 1;
+  }
+#endif
+
   return device_id;
 }
 
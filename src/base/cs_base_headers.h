@@ -95,6 +95,7 @@
 #include "cs_prototypes.h"
 #include "cs_random.h"
 #include "cs_renumber.h"
+#include "cs_repartition.h"
 #include "cs_restart.h"
 #include "cs_restart_map.h"
 #include "cs_rotation.h"
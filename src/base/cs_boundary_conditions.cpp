@@ -153,6 +153,15 @@ const int *cs_glob_bc_type = NULL;
 
 cs_boundary_condition_pm_info_t  *cs_glob_bc_pm_info = NULL;
 
+/*============================================================================
+ * External function prototypes
+ *============================================================================*/
+
+/* Bindings to Fortran routines */
+
+void
+cs_f_boundary_conditions_map(void);
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -2476,6 +2485,53 @@ cs_boundary_conditions_free(void)
   BFT_FREE(_b_head_loss);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the boundary conditions face arrays after the mesh's
+ *        boundary faces have changed (for example, after repartitioning).
+ *
+ * Face types and legacy zone info are reset to their default values,
+ * as they are redefined at each time step, and boundary mapping locators
+ * are rebuilt when next needed.
+ *
+ * Fortran mesh sizes must have been updated before calling this function.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_update_mesh(void)
+{
+  for (int i = 0; i < _n_bc_maps; i++) {
+    cs_bc_map_t *bc_map = _bc_maps + i;
+    if (bc_map->locator != NULL)
+      bc_map->locator = ple_locator_destroy(bc_map->locator);
+  }
+
+  CS_FREE_HD(_bc_type);
+  BFT_FREE(_bc_pm_face_zone);
+  BFT_FREE(_b_head_loss);
+
+  bool have_iautom = false;
+  if (cs_glob_bc_pm_info != NULL) {
+    if (cs_glob_bc_pm_info->iautom != NULL)
+      have_iautom = true;
+    BFT_FREE(cs_glob_bc_pm_info->iautom);
+    BFT_FREE(cs_glob_bc_pm_info->izfppp);
+    BFT_FREE(cs_glob_bc_pm_info->itrifb);
+  }
+
+  cs_boundary_conditions_create();
+
+  if (have_iautom && cs_glob_bc_pm_info->iautom == NULL) {
+    const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+    BFT_MALLOC(cs_glob_bc_pm_info->iautom, n_b_faces, int);
+    for (cs_lnum_t ii = 0; ii < n_b_faces; ii++)
+      cs_glob_bc_pm_info->iautom[ii] = 0;
+  }
+
+  cs_f_boundary_conditions_map();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Prepare (reset) condition coefficients for all variable fields.
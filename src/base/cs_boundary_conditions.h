@@ -328,6 +328,20 @@ cs_boundary_conditions_create(void);
 void
 cs_boundary_conditions_free(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the boundary conditions face arrays after the mesh's
+ *        boundary faces have changed (for example, after repartitioning).
+ *
+ * Face types and legacy zone info are reset to their default values,
+ * as they are redefined at each time step, and boundary mapping locators
+ * are rebuilt when next needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_update_mesh(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Prepare (reset) condition coefficients for all variable fields.
@@ -650,6 +650,60 @@ _boundary_condition_ale_type(const cs_mesh_t             *m,
   BFT_FREE(_rcodcl1_mesh_u);
 }
 
+/*----------------------------------------------------------------------------
+ * Group boundary faces by boundary condition code.
+ *
+ * Faces whose code is the i-th entry of codes[] are listed (in increasing
+ * face id order) in face_ids[code_idx[i]:code_idx[i+1]]; faces with other
+ * codes are not listed.
+ *
+ * parameters:
+ *   n_b_faces <-- number of boundary faces
+ *   icodcl    <-- boundary condition code per face
+ *   n_codes   <-- number of codes handled
+ *   codes     <-- codes handled
+ *   code_idx  --> index of faces per code (size: n_codes + 1)
+ *   face_ids  --> face ids grouped by code (size: n_b_faces)
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_face_ids_by_code(cs_lnum_t   n_b_faces,
+                    const int   icodcl[],
+                    int         n_codes,
+                    const int   codes[],
+                    cs_lnum_t   code_idx[],
+                    cs_lnum_t   face_ids[])
+{
+  for (int i = 0; i < n_codes + 1; i++)
+    code_idx[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    for (int i = 0; i < n_codes; i++) {
+      if (icodcl[f_id] == codes[i]) {
+        code_idx[i+1] += 1;
+        break;
+      }
+    }
+  }
+
+  for (int i = 0; i < n_codes; i++)
+    code_idx[i+1] += code_idx[i];
+
+  cs_lnum_t shift[8];
+  assert(n_codes <= 8);
+  for (int i = 0; i < n_codes; i++)
+    shift[i] = code_idx[i];
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    for (int i = 0; i < n_codes; i++) {
+      if (icodcl[f_id] == codes[i]) {
+        face_ids[shift[i]++] = f_id;
+        break;
+      }
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute boundary condition code for 1D thermal model
  * coupled with condensation
@@ -1457,144 +1511,154 @@ cs_boundary_conditions_set_coeffs(int        nvar,
 
   { /* Dirichlet and Neumann */
 
-    cs_real_t *rcodcl1_vel = vel->bc_coeffs->rcodcl1;
-    cs_real_t *rcodcl2_vel = vel->bc_coeffs->rcodcl2;
-    cs_real_t *rcodcl3_vel = vel->bc_coeffs->rcodcl3;
+    const cs_real_t *rcodcl1_vel = vel->bc_coeffs->rcodcl1;
+    const cs_real_t *rcodcl2_vel = vel->bc_coeffs->rcodcl2;
+    const cs_real_t *rcodcl3_vel = vel->bc_coeffs->rcodcl3;
 
-    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    /* Faces are grouped by condition type, so that each type is handled
+       by a branch-free loop on a compact face list. */
 
-      const cs_lnum_t c_id = b_face_cells[f_id];
+    const int n_codes = 6;
+    const int codes[6] = {1, 3, 2, 13, 14, 11};
+    cs_lnum_t code_idx[7];
+    cs_lnum_t *code_face_ids;
+    BFT_MALLOC(code_face_ids, n_b_faces, cs_lnum_t);
 
-      /* physical properties */
-      const cs_real_t visclc = viscl[c_id];
-      const cs_real_t visctc = visct[c_id];
-      cs_real_t hint = 0.0;
+    _b_face_ids_by_code(n_b_faces, icodcl_vel,
+                        n_codes, codes, code_idx, code_face_ids);
 
-      /* geometric quantities */
-      const cs_real_t distbf = b_dist[f_id];
+    /* Exchange coefficient based on molecular (and turbulent) viscosity */
 
+    auto _hint = [&](cs_lnum_t f_id) -> cs_real_t {
+      const cs_lnum_t c_id = b_face_cells[f_id];
       if (itytur == 3)
-        hint = visclc / distbf;
+        return viscl[c_id] / b_dist[f_id];
       else
-        hint = (visclc + visctc) / distbf;
-
-      cs_real_t qimpv[3]   = {0., 0., 0.};
-      cs_real_t hextv[3]   = {0., 0., 0.};
-      cs_real_t pimpv[3]   = {0., 0., 0.};
-      cs_real_t cflv[3]    = {0., 0., 0.};
+        return (viscl[c_id] + visct[c_id]) / b_dist[f_id];
+    };
 
-      /* Dirichlet boundary conditions
-         ----------------------------- */
+    /* Dirichlet boundary conditions
+       ----------------------------- */
 
-      if (icodcl_vel[f_id] == 1) {
-
-        for (cs_lnum_t k = 0; k < 3; k++)
-          pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
-
-        for (cs_lnum_t k = 0; k < 3; k++)
-          hextv[k] = rcodcl2_vel[n_b_faces*k + f_id];
-
-        cs_boundary_conditions_set_dirichlet_vector(f_id,
-                                                    vel->bc_coeffs,
-                                                    pimpv,
-                                                    hint,
-                                                    hextv);
+    for (cs_lnum_t i = code_idx[0]; i < code_idx[1]; i++) {
+      const cs_lnum_t f_id = code_face_ids[i];
 
+      cs_real_t pimpv[3], hextv[3];
+      for (cs_lnum_t k = 0; k < 3; k++) {
+        pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
+        hextv[k] = rcodcl2_vel[n_b_faces*k + f_id];
       }
 
-      /* Neumann boundary conditions
-         --------------------------- */
+      cs_boundary_conditions_set_dirichlet_vector(f_id,
+                                                  vel->bc_coeffs,
+                                                  pimpv,
+                                                  _hint(f_id),
+                                                  hextv);
+    }
 
-      else if (icodcl_vel[f_id] == 3) {
+    /* Neumann boundary conditions
+       --------------------------- */
 
-        /* coupled solving of the velocity components */
+    for (cs_lnum_t i = code_idx[1]; i < code_idx[2]; i++) {
+      const cs_lnum_t f_id = code_face_ids[i];
 
-        for (cs_lnum_t k = 0; k < 3; k++)
-          qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
+      /* coupled solving of the velocity components */
 
-        cs_boundary_conditions_set_neumann_vector(f_id,
-                                                  vel->bc_coeffs,
-                                                  qimpv,
-                                                  hint);
-      }
+      cs_real_t qimpv[3];
+      for (cs_lnum_t k = 0; k < 3; k++)
+        qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
 
-      /* Convective boundary conditions
-         ------------------------------ */
+      cs_boundary_conditions_set_neumann_vector(f_id,
+                                                vel->bc_coeffs,
+                                                qimpv,
+                                                _hint(f_id));
+    }
+
+    /* Convective boundary conditions
+       ------------------------------ */
 
-      else if (icodcl_vel[f_id] == 2 && iterns <= 1) {
+    if (iterns <= 1) {
+      for (cs_lnum_t i = code_idx[2]; i < code_idx[3]; i++) {
+        const cs_lnum_t f_id = code_face_ids[i];
 
         /* Coupled solving of the velocity components */
-        for (cs_lnum_t k = 0; k < 3; k++)
-          pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
 
-        for (cs_lnum_t k = 0; k < 3; k++)
+        cs_real_t pimpv[3], cflv[3];
+        for (cs_lnum_t k = 0; k < 3; k++) {
+          pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
           cflv[k] = rcodcl2_vel[n_b_faces*k + f_id];
+        }
 
         cs_boundary_conditions_set_convective_outlet_vector(f_id,
                                                             vel->bc_coeffs,
                                                             pimpv,
                                                             cflv,
-                                                            hint);
+                                                            _hint(f_id));
       }
+    }
 
-      /* Imposed value for the convection operator, imposed flux for diffusion
-         --------------------------------------------------------------------- */
-
-      else if (icodcl_vel[f_id] == 13) {
-
-        for (cs_lnum_t k = 0; k < 3; k++)
-          pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
-
-        for (cs_lnum_t k = 0; k < 3; k++)
-          qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
+    /* Imposed value for the convection operator, imposed flux for diffusion
+       --------------------------------------------------------------------- */
 
-        cs_boundary_conditions_set_dirichlet_conv_neumann_diff_vector
-          (f_id, vel->bc_coeffs, pimpv, qimpv);
+    for (cs_lnum_t i = code_idx[3]; i < code_idx[4]; i++) {
+      const cs_lnum_t f_id = code_face_ids[i];
 
+      cs_real_t pimpv[3], qimpv[3];
+      for (cs_lnum_t k = 0; k < 3; k++) {
+        pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
+        qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
       }
 
-      /* Convective boundary for Marangoni effects
-         (generalized symmetry condition)
-         ----------------------------------------- */
-
-      else if (icodcl_vel[f_id] == 14) {
-
-        for (cs_lnum_t k = 0; k < 3; k++)
-          pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
+      cs_boundary_conditions_set_dirichlet_conv_neumann_diff_vector
+        (f_id, vel->bc_coeffs, pimpv, qimpv);
+    }
 
-        for (cs_lnum_t k = 0; k < 3; k++)
-          qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
+    /* Convective boundary for Marangoni effects
+       (generalized symmetry condition)
+       ----------------------------------------- */
 
-        /* Coupled solving of the velocity components */
+    for (cs_lnum_t i = code_idx[4]; i < code_idx[5]; i++) {
+      const cs_lnum_t f_id = code_face_ids[i];
 
-        cs_boundary_conditions_set_generalized_sym_vector(f_id,
-                                                          vel->bc_coeffs,
-                                                          pimpv,
-                                                          qimpv,
-                                                          hint,
-                                                          b_face_u_normal[f_id]);
+      cs_real_t pimpv[3], qimpv[3];
+      for (cs_lnum_t k = 0; k < 3; k++) {
+        pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
+        qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
       }
 
-      /* Neumann on the normal component, Dirichlet on tangential components
-         ------------------------------------------------------------------- */
+      /* Coupled solving of the velocity components */
 
-      else if (icodcl_vel[f_id] == 11) {
+      cs_boundary_conditions_set_generalized_sym_vector(f_id,
+                                                        vel->bc_coeffs,
+                                                        pimpv,
+                                                        qimpv,
+                                                        _hint(f_id),
+                                                        b_face_u_normal[f_id]);
+    }
 
-        /* Dirichlet to impose on the tangential components */
-        for (cs_lnum_t k = 0; k < 3; k++)
-          pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
+    /* Neumann on the normal component, Dirichlet on tangential components
+       ------------------------------------------------------------------- */
 
-        /* Flux to impose on the normal component */
-        for (cs_lnum_t k = 0; k < 3; k++)
-          qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
+    for (cs_lnum_t i = code_idx[5]; i < code_idx[6]; i++) {
+      const cs_lnum_t f_id = code_face_ids[i];
 
-        /* coupled solving of the velocity components */
+      /* Dirichlet to impose on the tangential components,
+         flux to impose on the normal component */
 
-        cs_boundary_conditions_set_generalized_dirichlet_vector
-          (f_id, vel->bc_coeffs, pimpv,
-           qimpv, hint, b_face_u_normal[f_id]);
+      cs_real_t pimpv[3], qimpv[3];
+      for (cs_lnum_t k = 0; k < 3; k++) {
+        pimpv[k] = rcodcl1_vel[n_b_faces*k + f_id];
+        qimpv[k] = rcodcl3_vel[n_b_faces*k + f_id];
       }
+
+      /* coupled solving of the velocity components */
+
+      cs_boundary_conditions_set_generalized_dirichlet_vector
+        (f_id, vel->bc_coeffs, pimpv,
+         qimpv, _hint(f_id), b_face_u_normal[f_id]);
     }
+
+    BFT_FREE(code_face_ids);
   }
 
   /*--------------------------------------------------------------------------
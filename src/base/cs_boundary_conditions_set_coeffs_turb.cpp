@@ -99,6 +99,63 @@ static const cs_lnum_t _jv2t[6] = {0, 1, 2, 1, 2, 2};
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build compact lists of wall faces.
+ *
+ * Faces are listed in increasing id order, so that loops on these lists
+ * handle faces in the same order as loops on all boundary faces.
+ *
+ * \param[in]   n_b_faces         number of boundary faces
+ * \param[in]   icodcl_vel        velocity boundary condition codes
+ * \param[out]  n_wall_faces      number of smooth and rough wall faces
+ * \param[out]  wall_face_ids     ids of smooth and rough wall faces
+ * \param[out]  n_s_wall_faces    number of smooth wall faces
+ * \param[out]  s_wall_face_ids   ids of smooth wall faces
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_wall_face_lists(cs_lnum_t     n_b_faces,
+                 const int     icodcl_vel[],
+                 cs_lnum_t    *n_wall_faces,
+                 cs_lnum_t   **wall_face_ids,
+                 cs_lnum_t    *n_s_wall_faces,
+                 cs_lnum_t   **s_wall_face_ids)
+{
+  cs_lnum_t _n_wall_faces = 0, _n_s_wall_faces = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (icodcl_vel[f_id] == 5) {
+      _n_wall_faces++;
+      _n_s_wall_faces++;
+    }
+    else if (icodcl_vel[f_id] == 6)
+      _n_wall_faces++;
+  }
+
+  cs_lnum_t *_wall_face_ids, *_s_wall_face_ids;
+  BFT_MALLOC(_wall_face_ids, _n_wall_faces, cs_lnum_t);
+  BFT_MALLOC(_s_wall_face_ids, _n_s_wall_faces, cs_lnum_t);
+
+  _n_wall_faces = 0;
+  _n_s_wall_faces = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (icodcl_vel[f_id] == 5) {
+      _wall_face_ids[_n_wall_faces++] = f_id;
+      _s_wall_face_ids[_n_s_wall_faces++] = f_id;
+    }
+    else if (icodcl_vel[f_id] == 6)
+      _wall_face_ids[_n_wall_faces++] = f_id;
+  }
+
+  *n_wall_faces = _n_wall_faces;
+  *wall_face_ids = _wall_face_ids;
+  *n_s_wall_faces = _n_s_wall_faces;
+  *s_wall_face_ids = _s_wall_face_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute boundary coefficients for smooth/rough walls for scalar.
@@ -106,6 +163,8 @@ static const cs_lnum_t _jv2t[6] = {0, 1, 2, 1, 2, 2};
  * \param[in]     f_sc          scalar field
  * \param[in]     isvhb         id of field whose exchange coeffient should be
  *                               saved at the walls, or -1.
+ * \param[in]     n_wall_faces  number of smooth and rough wall faces
+ * \param[in]     wall_face_ids ids of smooth and rough wall faces
  * \param[in]     byplus        dimensionless distance to the wall
  * \param[in]     bdplus        dimensionless shift to the wall
  *                              for scalable wall functions
@@ -127,6 +186,8 @@ static const cs_lnum_t _jv2t[6] = {0, 1, 2, 1, 2, 2};
 static void
 _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
                                                int          isvhb,
+                                               cs_lnum_t    n_wall_faces,
+                                               const cs_lnum_t  wall_face_ids[],
                                                cs_real_t    byplus[],
                                                cs_real_t    bdplus[],
                                                cs_real_t    buk[],
@@ -352,11 +413,9 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
   BFT_MALLOC(yptp, n_b_faces, cs_real_t);
 
   /* Loop on boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (cs_lnum_t w_id = 0; w_id < n_wall_faces; w_id++) {
 
-    /* Test on the presence of a smooth/rough wall condition (start) */
-    if (icodcl_vel[f_id] != 5 && icodcl_vel[f_id] != 6)
-      continue;
+    const cs_lnum_t f_id = wall_face_ids[w_id];
 
     const cs_lnum_t c_id = b_face_cells[f_id];
 
@@ -517,10 +576,9 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
   cs_field_t *f_al = cs_field_by_composite_name_try(f_sc->name, "alpha");
 
   /* Loop on boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (cs_lnum_t w_id = 0; w_id < n_wall_faces; w_id++) {
 
-    if (icodcl_vel[f_id] != 5 && icodcl_vel[f_id] != 6)
-      continue;
+    const cs_lnum_t f_id = wall_face_ids[w_id];
 
     const cs_real_t yplus = byplus[f_id];
     const cs_real_t dplus = bdplus[f_id];
@@ -920,6 +978,8 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
  * \brief Compute boundary coefficients for smooth walls for vector.
  *
  * \param[in]     f_v           vector field
+ * \param[in]     n_s_wall_faces   number of smooth wall faces
+ * \param[in]     s_wall_face_ids  ids of smooth wall faces
  * \param[in]     byplus        dimensionless distance to the wall
  * \param[in]     bdplus        dimensionless shift to the wall
  *                              for scalable wall functions
@@ -929,6 +989,8 @@ _cs_boundary_conditions_set_coeffs_turb_scalar(cs_field_t  *f_sc,
 
 static void
 _cs_boundary_conditions_set_coeffs_turb_vector(cs_field_t  *f_v,
+                                               cs_lnum_t    n_s_wall_faces,
+                                               const cs_lnum_t  s_wall_face_ids[],
                                                cs_real_t    byplus[],
                                                cs_real_t    bdplus[],
                                                cs_real_t    buk[])
@@ -1007,7 +1069,6 @@ _cs_boundary_conditions_set_coeffs_turb_vector(cs_field_t  *f_v,
   cs_real_t *hint;
   BFT_MALLOC(hint, n_b_faces, cs_real_t);
 
-  const int *icodcl_vel = CS_F_(vel)->bc_coeffs->icodcl;
   const int *icodcl_v = f_v->bc_coeffs->icodcl;
   const cs_real_t *rcodcl1_v = f_v->bc_coeffs->rcodcl1;
   const cs_real_t *rcodcl2_v = f_v->bc_coeffs->rcodcl2;
@@ -1015,11 +1076,9 @@ _cs_boundary_conditions_set_coeffs_turb_vector(cs_field_t  *f_v,
   cs_real_t yptp = 0.0, ypth = 0.0;;
 
   /* Loop on boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (cs_lnum_t w_id = 0; w_id < n_s_wall_faces; w_id++) {
 
-    /* Test on the presence of a smooth wall condition (start) */
-    if (icodcl_vel[f_id] != 5)
-      continue;
+    const cs_lnum_t f_id = s_wall_face_ids[w_id];
 
     /* Geometric quantities */
     const cs_lnum_t c_id = b_face_cells[f_id];
@@ -1100,11 +1159,9 @@ _cs_boundary_conditions_set_coeffs_turb_vector(cs_field_t  *f_v,
     cs_ic_field_set_exchcoeff(f_v, hbnd);
 
   /* Loop on boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (cs_lnum_t w_id = 0; w_id < n_s_wall_faces; w_id++) {
 
-    /* Test on the presence of a smooth wall condition (start) */
-    if (icodcl_vel[f_id] != 5)
-      continue;
+    const cs_lnum_t f_id = s_wall_face_ids[w_id];
 
     const cs_real_t yplus = byplus[f_id];
     const cs_real_t dplus = bdplus[f_id];
@@ -2108,6 +2165,18 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
   const int *icodcl_vel = vel->bc_coeffs->icodcl;
   cs_real_t *rcodcl1_vel = vel->bc_coeffs->rcodcl1;
 
+  /* Compact lists of wall faces */
+
+  cs_lnum_t n_wall_faces = 0, n_s_wall_faces = 0;
+  cs_lnum_t *wall_face_ids = nullptr, *s_wall_face_ids = nullptr;
+
+  _wall_face_lists(n_b_faces,
+                   icodcl_vel,
+                   &n_wall_faces,
+                   &wall_face_ids,
+                   &n_s_wall_faces,
+                   &s_wall_face_ids);
+
   cs_real_t *coftur = nullptr, *hfltur = nullptr;
   if (cs_turbomachinery_get_model() == CS_TURBOMACHINERY_TRANSIENT) {
     cs_turbomachinery_get_wall_bc_coeffs(&coftur, &hfltur);
@@ -2116,11 +2185,9 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
   /* Loop on boundary faces
      ----------------------*/
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (cs_lnum_t w_id = 0; w_id < n_wall_faces; w_id++) {
 
-    /* Test on the presence of a smooth/rough wall condition (start) */
-    if (icodcl_vel[f_id] != 5 && icodcl_vel[f_id] != 6)
-      continue;
+    const cs_lnum_t f_id = wall_face_ids[w_id];
 
     const cs_lnum_t c_id = b_face_cells[f_id];
 
@@ -3775,7 +3842,7 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
 
       if (f_scal->dim == 1) {
         _cs_boundary_conditions_set_coeffs_turb_scalar
-          (f_scal, isvhb, byplus, bdplus,
+          (f_scal, isvhb, n_wall_faces, wall_face_ids, byplus, bdplus,
            bpro_uk, bpro_ustar, bcfnns, bdlmo, hbord,
           theipb, &tetmax, &tetmin, &tplumx, &tplumn);
 
@@ -3784,6 +3851,8 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
       /* Vector field */
       else {
         _cs_boundary_conditions_set_coeffs_turb_vector(f_scal,
+                                                       n_s_wall_faces,
+                                                       s_wall_face_ids,
                                                        byplus,
                                                        bdplus,
                                                        bpro_uk);
@@ -3837,6 +3906,9 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
   BFT_FREE(bdplus);
   BFT_FREE(bdlmo);
 
+  BFT_FREE(wall_face_ids);
+  BFT_FREE(s_wall_face_ids);
+
   /* Logging
      ======= */
 
@@ -0,0 +1,420 @@
+/*============================================================================
+ * Communication statistics by communication site.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_log.h"
+#include "cs_map.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_comm_stats.h"
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_comm_stats.cpp
+        Communication statistics by communication site.
+
+  Message counts, bytes, neighbor counts and wait times are accumulated
+  by communication site, defined by a communication type (halo
+  synchronization, all-to-all exchange, or global reduction) and the
+  current context (usually the name of a field or linear system), set
+  by the callers of operators which communicate. This is done using
+  internal calls in the communication operators, so no MPI profiling
+  (PMPI) interface is needed.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Statistics for a given communication site */
+
+typedef struct {
+
+  cs_comm_stats_type_t  type;         /* communication type */
+
+  unsigned long long    n_calls;      /* number of calls */
+  unsigned long long    n_messages;   /* number of messages sent */
+  unsigned long long    n_bytes;      /* number of bytes sent */
+  int                   n_neighbors;  /* max. number of neighbors */
+  double                wait_time;    /* cumulative wait time */
+
+} _comm_site_t;
+
+/* Last site used for a given type */
+
+typedef struct {
+
+  char  context[64];   /* context name (copy, as context strings
+                          may be transient) */
+  int   site_id;       /* matching site id */
+
+} _comm_site_cache_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char *_type_name[] = {"halo", "all_to_all", "allreduce"};
+
+static const char *_context = nullptr;
+
+static cs_map_name_to_id_t  *_site_map = nullptr;
+
+static int            _n_sites = 0;
+static int            _n_sites_max = 0;
+static _comm_site_t  *_sites = nullptr;
+
+static _comm_site_cache_t  _cache[CS_COMM_STATS_N_TYPES]
+  = {{"", -1}, {"", -1}, {"", -1}};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return id of a communication site, creating it if needed.
+ *
+ * parameters:
+ *   type    <-- communication type
+ *   context <-- context name
+ *
+ * returns:
+ *   id of matching site
+ *----------------------------------------------------------------------------*/
+
+static int
+_site_id(cs_comm_stats_type_t   type,
+         const char            *context)
+{
+  char key[128];
+  snprintf(key, 127, "%s: %s", _type_name[type], context);
+  key[127] = '\0';
+
+  if (_site_map == nullptr)
+    _site_map = cs_map_name_to_id_create();
+
+  int site_id = cs_map_name_to_id(_site_map, key);
+
+  if (site_id >= _n_sites) {
+    _n_sites = site_id + 1;
+    if (_n_sites > _n_sites_max) {
+      _n_sites_max = CS_MAX(2*_n_sites_max, 16);
+      BFT_REALLOC(_sites, _n_sites_max, _comm_site_t);
+    }
+    _comm_site_t *s = _sites + site_id;
+    s->type = type;
+    s->n_calls = 0;
+    s->n_messages = 0;
+    s->n_bytes = 0;
+    s->n_neighbors = 0;
+    s->wait_time = 0;
+  }
+
+  return site_id;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the current communication context.
+ *
+ * Communications are accounted for by type and context, so the context
+ * name (for example the name of a field or linear system) determines the
+ * communication site. The given string is not copied, so it must remain
+ * valid until the context is changed.
+ *
+ * \param[in]  name  context name, or nullptr
+ *
+ * \return  previous context name, to be restored by the caller
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_comm_stats_set_context(const char  *name)
+{
+  const char *retval = _context;
+  _context = name;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Account for a communication in the current context.
+ *
+ * \param[in]  type         communication type
+ * \param[in]  n_messages   number of messages sent
+ * \param[in]  n_bytes      number of bytes sent
+ * \param[in]  n_neighbors  number of neighbor ranks, or 0 if not relevant
+ * \param[in]  wait_time    time spent in the communication (or waiting
+ *                          for its completion)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_stats_add(cs_comm_stats_type_t  type,
+                  int                   n_messages,
+                  size_t                n_bytes,
+                  int                   n_neighbors,
+                  double                wait_time)
+{
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  /* Avoid a map lookup when the context did not change for this type */
+
+  _comm_site_cache_t *c = _cache + type;
+  const char *ctx = (_context != nullptr) ? _context : "-";
+
+  if (c->site_id < 0 || strncmp(c->context, ctx, 63) != 0) {
+    strncpy(c->context, ctx, 63);
+    c->context[63] = '\0';
+    c->site_id = _site_id(type, ctx);
+  }
+
+  _comm_site_t *s = _sites + c->site_id;
+
+  s->n_calls += 1;
+  s->n_messages += n_messages;
+  s->n_bytes += n_bytes;
+  s->n_neighbors = CS_MAX(s->n_neighbors, n_neighbors);
+  s->wait_time += wait_time;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log communication statistics summary and free associated data.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_stats_log_finalize(void)
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    /* Sites are identified by name, and may differ between ranks;
+       use those of rank 0, and group others by type */
+
+    int n_g_sites = _n_sites;
+    MPI_Bcast(&n_g_sites, 1, MPI_INT, 0, cs_glob_mpi_comm);
+
+    unsigned long long buf_size = 0;
+    char *keys = nullptr;
+
+    if (cs_glob_rank_id == 0) {
+      for (int i = 0; i < _n_sites; i++)
+        buf_size += strlen(cs_map_name_to_id_reverse(_site_map, i)) + 1;
+    }
+    MPI_Bcast(&buf_size, 1, MPI_UNSIGNED_LONG_LONG, 0, cs_glob_mpi_comm);
+
+    BFT_MALLOC(keys, buf_size + 1, char);
+    if (cs_glob_rank_id == 0) {
+      size_t shift = 0;
+      for (int i = 0; i < _n_sites; i++) {
+        const char *k = cs_map_name_to_id_reverse(_site_map, i);
+        strcpy(keys + shift, k);
+        shift += strlen(k) + 1;
+      }
+    }
+    MPI_Bcast(keys, buf_size, MPI_CHAR, 0, cs_glob_mpi_comm);
+
+    /* Values per global site: calls, messages, bytes, wait time (sums),
+       neighbors and wait time (max.); additional "other" site per type */
+
+    const int n_vals = n_g_sites + CS_COMM_STATS_N_TYPES;
+
+    double *sums, *maxs;
+    int *g_type;
+    BFT_MALLOC(sums, n_vals*4, double);
+    BFT_MALLOC(maxs, n_vals*2, double);
+    BFT_MALLOC(g_type, n_vals, int);
+
+    for (int i = 0; i < n_vals*4; i++)
+      sums[i] = 0;
+    for (int i = 0; i < n_vals*2; i++)
+      maxs[i] = 0;
+
+    bool *matched;
+    BFT_MALLOC(matched, _n_sites + 1, bool);
+    for (int i = 0; i < _n_sites; i++)
+      matched[i] = false;
+
+    size_t shift = 0;
+    for (int g_id = 0; g_id < n_g_sites; g_id++) {
+      const char *k = keys + shift;
+      shift += strlen(k) + 1;
+      g_type[g_id] = -1;
+      int l_id = (_site_map != nullptr) ?
+        cs_map_name_to_id_try(_site_map, k) : -1;
+      if (l_id > -1) {
+        matched[l_id] = true;
+        g_type[g_id] = _sites[l_id].type;
+      }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, g_type, n_g_sites, MPI_INT, MPI_MAX,
+                  cs_glob_mpi_comm);
+    for (int t_id = 0; t_id < CS_COMM_STATS_N_TYPES; t_id++)
+      g_type[n_g_sites + t_id] = t_id;
+
+    shift = 0;
+    for (int g_id = 0; g_id < n_vals; g_id++) {
+
+      int l_id = -1;
+      if (g_id < n_g_sites) {
+        const char *k = keys + shift;
+        shift += strlen(k) + 1;
+        if (_site_map != nullptr)
+          l_id = cs_map_name_to_id_try(_site_map, k);
+      }
+
+      for (int s_id = 0; s_id < _n_sites; s_id++) {
+        const _comm_site_t *s = _sites + s_id;
+        bool add = false;
+        if (g_id < n_g_sites)
+          add = (s_id == l_id);
+        else
+          add = (!matched[s_id] && (int)s->type == g_type[g_id]);
+        if (add) {
+          sums[g_id*4]     += s->n_calls;
+          sums[g_id*4 + 1] += s->n_messages;
+          sums[g_id*4 + 2] += s->n_bytes;
+          sums[g_id*4 + 3] += s->wait_time;
+          maxs[g_id*2]      = CS_MAX(maxs[g_id*2], s->n_neighbors);
+          maxs[g_id*2 + 1]  = CS_MAX(maxs[g_id*2 + 1], s->wait_time);
+        }
+      }
+    }
+
+    MPI_Allreduce(MPI_IN_PLACE, sums, n_vals*4, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(MPI_IN_PLACE, maxs, n_vals*2, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+
+    /* Log */
+
+    const double n_ranks = cs_glob_n_ranks;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Communication statistics by site "
+                    "(calls and wait times per rank):\n\n"
+                    "  %-36s %10s %12s %12s %10s %6s %10s %10s\n"),
+                  _("site"), _("calls"), _("messages"), _("MiB"),
+                  _("KiB/msg"), _("neigh."), _("wait mean"), _("wait max"));
+
+    for (int t_id = 0; t_id < CS_COMM_STATS_N_TYPES; t_id++) {
+
+      shift = 0;
+      for (int g_id = 0; g_id < n_vals; g_id++) {
+
+        char label[40];
+        if (g_id < n_g_sites) {
+          const char *k = keys + shift;
+          shift += strlen(k) + 1;
+          snprintf(label, 39, "%s", k);
+        }
+        else
+          snprintf(label, 39, "%s: %s", _type_name[g_type[g_id]],
+                   _("(other)"));
+        label[39] = '\0';
+
+        if (g_type[g_id] != t_id || sums[g_id*4] <= 0)
+          continue;
+
+        const double *s = sums + g_id*4;
+        const double *m = maxs + g_id*2;
+
+        double kib_msg = (s[1] > 0) ? s[2] / s[1] / 1024. : 0;
+
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      "  %-36s %10.0f %12.0f %12.3f %10.3f %6d %10.3f %10.3f\n",
+                      label, s[0]/n_ranks, s[1], s[2]/1048576., kib_msg,
+                      (int)m[0], s[3]/n_ranks, m[1]);
+      }
+
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+    cs_log_separator(CS_LOG_PERFORMANCE);
+
+    BFT_FREE(matched);
+    BFT_FREE(g_type);
+    BFT_FREE(maxs);
+    BFT_FREE(sums);
+    BFT_FREE(keys);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(_sites);
+  _n_sites = 0;
+  _n_sites_max = 0;
+
+  if (_site_map != nullptr)
+    cs_map_name_to_id_destroy(&_site_map);
+
+  for (int t_id = 0; t_id < CS_COMM_STATS_N_TYPES; t_id++) {
+    _cache[t_id].context[0] = '\0';
+    _cache[t_id].site_id = -1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
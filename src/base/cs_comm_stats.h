@@ -0,0 +1,158 @@
+#ifndef __CS_COMM_STATS_H__
+#define __CS_COMM_STATS_H__
+
+/*============================================================================
+ * Communication statistics by communication site.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stddef.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Communication type */
+
+typedef enum {
+
+  CS_COMM_STATS_HALO,         /*!< halo synchronization */
+  CS_COMM_STATS_ALL_TO_ALL,   /*!< all-to-all exchange */
+  CS_COMM_STATS_ALLREDUCE,    /*!< global reduction */
+
+  CS_COMM_STATS_N_TYPES
+
+} cs_comm_stats_type_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the current communication context.
+ *
+ * Communications are accounted for by type and context, so the context
+ * name (for example the name of a field or linear system) determines the
+ * communication site. The given string is not copied, so it must remain
+ * valid until the context is changed.
+ *
+ * \param[in]  name  context name, or nullptr
+ *
+ * \return  previous context name, to be restored by the caller
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_comm_stats_set_context(const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Account for a communication in the current context.
+ *
+ * \param[in]  type         communication type
+ * \param[in]  n_messages   number of messages sent
+ * \param[in]  n_bytes      number of bytes sent
+ * \param[in]  n_neighbors  number of neighbor ranks, or 0 if not relevant
+ * \param[in]  wait_time    time spent in the communication (or waiting
+ *                          for its completion)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_stats_add(cs_comm_stats_type_t  type,
+                  int                   n_messages,
+                  size_t                n_bytes,
+                  int                   n_neighbors,
+                  double                wait_time);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log communication statistics summary and free associated data.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_comm_stats_log_finalize(void);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Accounted wrapper for MPI_Allreduce.
+ *
+ * Arguments are those of MPI_Allreduce.
+ *
+ * \return  MPI error code
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+cs_comm_allreduce(const void    *sendbuf,
+                  void          *recvbuf,
+                  int            count,
+                  MPI_Datatype   datatype,
+                  MPI_Op         op,
+                  MPI_Comm       comm)
+{
+  double t0 = MPI_Wtime();
+
+  int retval = MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+
+  int type_size = 0;
+  MPI_Type_size(datatype, &type_size);
+
+  cs_comm_stats_add(CS_COMM_STATS_ALLREDUCE, 1, (size_t)count*type_size, 0,
+                    MPI_Wtime() - t0);
+
+  return retval;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_COMM_STATS_H__ */
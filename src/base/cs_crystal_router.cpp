@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -132,7 +133,32 @@ struct  _cs_crystal_router_t { /* Crystal router information */
   size_t          buffer_size[2];     /* buffer size values */
   size_t          buffer_size_max[2]; /* max buffer size values reached */
   size_t          alloc_tot_max;      /* max total allocation reached */
-  unsigned char  *buffer[2];
+  unsigned char  *buffer[2];          /* current and next stage data */
+
+  size_t          chunk_size;         /* maximum message size */
+  size_t          chunk_buf_size;     /* allocated size of send chunks */
+  unsigned char  *chunk_buf[2];       /* send chunk buffers */
+  MPI_Request     chunk_req[2];       /* send chunk requests */
+  int             n_recv_req;         /* number of receive requests */
+  int             n_recv_req_max;     /* allocated receive requests */
+  MPI_Request    *recv_req;           /* receive requests */
+
+  int             stage_n_sub;        /* number of ranks in sub-group */
+  int             stage_b_low;        /* first rank of sub-group */
+  int             stage_b_high;       /* first rank of sub-group high half */
+  int             stage_target;       /* target rank for current stage */
+  int             stage_send_high;    /* 1 if data for high half is sent,
+                                         0 if data for low half is sent */
+  bool            stage_active;       /* true if a stage is in progress */
+
+  size_t          scan_id;            /* next element to partition */
+  size_t          scan_shift;         /* starting byte of next element */
+  size_t          elt_done;           /* bytes of current element packed */
+  size_t          keep_shift;         /* bytes of data kept in stage */
+  size_t          send_size;          /* bytes to send in stage */
+  size_t          send_done;          /* bytes packed in stage */
+  size_t          chunk_fill;         /* bytes in current send chunk */
+  int             chunk_cur;          /* current send chunk buffer id */
 
   MPI_Comm        comm;               /* associated MPI communicator */
   MPI_Datatype    mpi_type;           /* Associated MPI datatype */
@@ -153,7 +179,9 @@ struct  _cs_crystal_router_t { /* Crystal router information */
 static size_t              _cr_calls = 0;
 static cs_timer_counter_t  _cr_timers[2];
 
-const float  _realloc_f_threshold = 0.7;
+/* Maximum message size for exchanges (larger payloads are split) */
+
+static size_t  _cr_chunk_size = 8 << 20;
 
 /*============================================================================
  * Local function defintions
@@ -173,80 +201,47 @@ const float  _realloc_f_threshold = 0.7;
  *   count of associated datatype elements for matching buffer size
  *---------------------------------------------------------------------------*/
 
-static  size_t
-_comm_type_count(cs_crystal_router_t  *cr,
-                 cs_lnum_t             n_elts,
-                 cs_lnum_t             n_vals)
+static inline size_t
+_data_size(cs_crystal_router_t  *cr,
+           size_t                n_elts,
+           size_t                n_vals)
 {
   size_t retval;
 
-  if (cr->n_vals_shift == 0) { /* strided */
-    retval = n_elts;
-  }
-  else { /* indexed */
-    size_t n = n_elts*cr->comp_size + n_vals*cr->elt_size;
-    retval = n / cr->mpi_type_size;
-  }
+  if (cr->n_vals_shift == 0) /* strided */
+    retval = n_elts * cr->comp_size;
+  else /* indexed */
+    retval = n_elts*cr->comp_size + n_vals*cr->elt_size;
 
   return retval;
 }
 
 /*----------------------------------------------------------------------------
- * Return number of values matching a given number of elements and MPI
- * datatype values.
+ * Return chunk size matching a given maximum message size.
  *
- * parameters:
- *   cr         <-- associated crystal router structure
- *   n_elts     <-- number of elements
- *   n_mpi_vals <-- number of MPI element
- *
- * returns:
- *   count of associated datatype elements for matching buffer size
- *---------------------------------------------------------------------------*/
-
-static  size_t
-_comm_type_count_to_n_vals(cs_crystal_router_t  *cr,
-                           cs_lnum_t             n_elts,
-                           int                   n_mpi_elts)
-{
-  size_t retval;
-
-  if (cr->n_vals_shift == 0) { /* strided */
-    retval = n_elts * cr->stride;
-  }
-  else { /* indexed */
-    size_t n = n_mpi_elts*cr->mpi_type_size - n_elts*cr->comp_size;
-    retval = n / cr->elt_size;
-  }
-
-  return retval;
-}
-
-/*----------------------------------------------------------------------------
- * Return Crystal Router datatype count matching a given number of values.
+ * The chunk size is a multiple of the MPI datatype size, and fits
+ * in an MPI count.
  *
  * parameters:
- *   cr      <-- associated crystal router structure
- *   n_elts  <-- number of elements
- *   n_vals  <-- number of associated values (used only for indexed cases)
+ *   max_size       <-- requested maximum message size, in bytes
+ *   mpi_type_size  <-- size of associated MPI datatype
  *
  * returns:
- *   count of associated datatype elements for matching buffer size
+ *   chunk size, in bytes
  *---------------------------------------------------------------------------*/
 
 static inline size_t
-_data_size(cs_crystal_router_t  *cr,
-           cs_lnum_t             n_elts,
-           cs_lnum_t             n_vals)
+_chunk_size(size_t  max_size,
+            size_t  mpi_type_size)
 {
-  size_t retval;
+  size_t n = max_size / mpi_type_size;
 
-  if (cr->n_vals_shift == 0) /* strided */
-    retval = n_elts * cr->comp_size;
-  else /* indexed */
-    retval = n_elts*cr->comp_size + n_vals*cr->elt_size;
+  if (n < 1)
+    n = 1;
+  else if (n > INT_MAX)
+    n = INT_MAX;
 
-  return retval;
+  return n*mpi_type_size;
 }
 
 /*----------------------------------------------------------------------------
@@ -323,6 +318,32 @@ _crystal_create(size_t         n_elts,
 
   cr->alloc_tot_max = 0;
 
+  cr->chunk_size = _cr_chunk_size;
+  cr->chunk_buf_size = 0;
+  for (int i = 0; i < 2; i++) {
+    cr->chunk_buf[i] = nullptr;
+    cr->chunk_req[i] = MPI_REQUEST_NULL;
+  }
+  cr->n_recv_req = 0;
+  cr->n_recv_req_max = 0;
+  cr->recv_req = nullptr;
+
+  cr->stage_n_sub = 0;
+  cr->stage_b_low = 0;
+  cr->stage_b_high = 0;
+  cr->stage_target = -1;
+  cr->stage_send_high = 0;
+  cr->stage_active = false;
+
+  cr->scan_id = 0;
+  cr->scan_shift = 0;
+  cr->elt_done = 0;
+  cr->keep_shift = 0;
+  cr->send_size = 0;
+  cr->send_done = 0;
+  cr->chunk_fill = 0;
+  cr->chunk_cur = 0;
+
   return cr;
 }
 
@@ -370,6 +391,8 @@ _crystal_create_meta_s(size_t         n_elts,
   MPI_Type_contiguous(cr->mpi_type_size, MPI_BYTE, &(cr->mpi_type));
   MPI_Type_commit(&(cr->mpi_type));
 
+  cr->chunk_size = _chunk_size(cr->chunk_size, cr->mpi_type_size);
+
   /* Allocate buffers */
 
   cr->buffer_size[0] = n_elts*cr->comp_size;
@@ -440,6 +463,8 @@ _crystal_create_meta_i(size_t            n_elts,
   MPI_Type_contiguous(cr->mpi_type_size, MPI_BYTE, &(cr->mpi_type));
   MPI_Type_commit(&(cr->mpi_type));
 
+  cr->chunk_size = _chunk_size(cr->chunk_size, cr->mpi_type_size);
+
   /* Allocate buffers */
 
   if (src_id == nullptr)
@@ -687,293 +712,360 @@ _dump(const cs_crystal_router_t  *cr,
 #endif /* _dump functions for debugging */
 
 /*----------------------------------------------------------------------------
- * Partition strided data for exchange with a crystal router.
+ * Return number of values and size of an element in a crystal router buffer.
  *
  * parameters:
- *   cr      <-> associated crystal router structure
- *   send_id <-> id of "send" buffer" (1 if low = buf0, 0 if low = buf1)
- *   cutoff  <-- cutoff rank
+ *   cr      <-- associated crystal router structure
+ *   p       <-- pointer to element in buffer
+ *   n_vals  --> number of values associated with element
+ *
+ * returns:
+ *   size of element (metadata and values) in buffer
  *---------------------------------------------------------------------------*/
 
-static void
-_crystal_partition_strided(cs_crystal_router_t  *cr,
-                           int                   send_id,
-                           int                   cutoff)
+static inline size_t
+_buffer_elt_size(const cs_crystal_router_t  *cr,
+                 const unsigned char        *p,
+                 size_t                     *n_vals)
 {
-  cs_lnum_t i;
-
-  cs_lnum_t n0 = 0, n1 = 0;
-
-  const cs_lnum_t n = cr->n_elts[0];
-  const int id0 = (send_id + 1) % 2;
-  const int id1 = send_id;
-  const size_t comp_size = cr->comp_size;
-
-  assert(send_id == 0 || send_id == 1);
-
-  if (   cr->buffer_size[1] < cr->buffer_size[0]
-      || cr->buffer_size[1] > cr->buffer_size[0]*_realloc_f_threshold) {
-    cr->buffer_size[1] = cr->buffer_size[0];
-    BFT_REALLOC(cr->buffer[1], cr->buffer_size[1], unsigned char);
-    if (cr->buffer_size[1] > cr->buffer_size_max[1])
-      cr->buffer_size_max[1] = cr->buffer_size[1];
-    size_t alloc_tot = cr->buffer_size[0] + cr->buffer_size[1];
-    if (alloc_tot > cr->alloc_tot_max)
-      cr->alloc_tot_max = alloc_tot;
-  }
-
-  if (id0 == 0) {
-    for (i = 0; i < n; i++) {
-      unsigned char *src = cr->buffer[0] + i*comp_size;
-      int *r = (int *)src;
-      if (r[0] >= cutoff)
-        break;
-    }
-    n0 = i;
+  if (cr->n_vals_shift == 0) { /* strided */
+    *n_vals = cr->stride;
+    return cr->comp_size;
   }
-  else {
-    for (i = 0; i < n; i++) {
-      unsigned char *src = cr->buffer[0] + i*comp_size;
-      int *r = (int *)src;
-      if (r[0] < cutoff)
-        break;
-    }
-    n1 = i;
+  else { /* indexed */
+    cs_lnum_t n_sub;
+    memcpy(&n_sub, p + cr->n_vals_shift, sizeof(cs_lnum_t));
+    *n_vals = n_sub;
+    return cr->comp_size + n_sub*cr->elt_size;
   }
+}
 
-  while (i < n) {
-    unsigned char *src = cr->buffer[0] + i*comp_size;
-    int *r = (int *)src;
-    if (r[0] < cutoff) {
-      unsigned char *dest = cr->buffer[id0] + n0*comp_size;
-      memcpy(dest, src, comp_size);
-      n0++;
-    }
-    else {
-      unsigned char *dest = cr->buffer[id1] + n1*comp_size;
-      memcpy(dest, src, comp_size);
-      n1++;
+/*----------------------------------------------------------------------------
+ * Complete or test a request.
+ *
+ * parameters:
+ *   request   <-> pointer to request
+ *   blocking  <-- if true, wait for completion; otherwise, only test
+ *
+ * returns:
+ *   true if request is complete, false otherwise
+ *---------------------------------------------------------------------------*/
+
+static inline bool
+_crystal_request_done(MPI_Request  *request,
+                      bool          blocking)
+{
+  int flag = 1;
+
+  if (*request != MPI_REQUEST_NULL) {
+    if (blocking) {
+      cs_timer_t t0 = cs_timer_time();
+      MPI_Wait(request, MPI_STATUS_IGNORE);
+      cs_timer_t t1 = cs_timer_time();
+      cs_timer_counter_add_diff(_cr_timers + 1, &t0, &t1);
     }
-    i++;
+    else
+      MPI_Test(request, &flag, MPI_STATUS_IGNORE);
   }
 
-  assert(n0 + n1 == n);
-
-  cr->n_elts[id0] = n0;
-  cr->n_elts[id1] = n1;
-
-  cr->n_vals[id0] = n0*cr->stride;
-  cr->n_vals[id1] = n1*cr->stride;
+  return (flag) ? true : false;
 }
 
 /*----------------------------------------------------------------------------
- * Partition indexed data for exchange with a crystal router.
+ * Initialize a stage of exchange with a crystal router.
+ *
+ * Data sent to the other half of the current rank sub-group is counted,
+ * counts are exchanged with the target rank(s), the buffer for data kept
+ * and received is allocated, and receives are posted.
+ *
+ * Data is exchanged as a byte stream split into chunks of at most
+ * cr->chunk_size bytes, so that memory used for sending is bounded,
+ * and packing of further chunks overlaps with communication.
  *
  * parameters:
- *   cr      <-> associated crystal router structure
- *   send_id <-> id of "send" buffer" (1 if low = buf0, 0 if low = buf1)
- *   cutoff  <-- cutoff rank
+ *   cr <-> associated crystal router structure
  *---------------------------------------------------------------------------*/
 
 static void
-_crystal_partition_indexed(cs_crystal_router_t  *cr,
-                           int                   send_id,
-                           int                   cutoff)
+_crystal_stage_init(cs_crystal_router_t  *cr)
 {
-  cs_lnum_t i;
+  const int n_sub_ranks = cr->stage_n_sub;
+  const int n_low = n_sub_ranks / 2;
+  const int b_high = cr->stage_b_low + n_low;
 
-  cs_lnum_t n0 = 0, n1 = 0;
+  int target = -1;
+  int n_recv = 1;
+
+  assert(n_sub_ranks > 1);
+
+  if (cr->rank_id < b_high) {
+    target = cr->rank_id + n_low;
+    if ((n_sub_ranks & 1) && (cr->rank_id == b_high - 1))
+      n_recv = 2;
+    cr->stage_send_high = 1;
+  }
+  else {
+    target = cr->rank_id - n_low;
+    if (target == b_high) {
+      target--;
+      n_recv = 0;
+    }
+    cr->stage_send_high = 0;
+  }
 
-  const cs_lnum_t n = cr->n_elts[0];
-  const int id0 = (send_id + 1) % 2;
-  const int id1 = send_id;
-  const size_t comp_size = cr->comp_size;
-  const size_t elt_size = cr->elt_size;
-  const size_t n_vals_shift = cr->n_vals_shift;
+  cr->stage_b_high = b_high;
+  cr->stage_target = target;
 
-  assert(send_id == 0 || send_id == 1);
+  /* Count data to send */
 
-  unsigned char *src = cr->buffer[0];
+  const size_t n = cr->n_elts[0];
+  const unsigned char *p = cr->buffer[0];
 
-  size_t r0_shift = 0;
-  size_t r1_shift = 0;
+  uint64_t send_info[2] = {0, 0};
 
-  if (id0 == 0) {
-    for (i = 0; i < n; i++) {
-      int *r = (int *)src;
-      cs_lnum_t *n_sub = (cs_lnum_t *)(src + n_vals_shift);
-      size_t sub_size = comp_size + n_sub[0]*elt_size;
-      if (r[0] >= cutoff)
-        break;
-      r0_shift += sub_size;
-      src += sub_size;
+  for (size_t i = 0; i < n; i++) {
+    const int *r = (const int *)p;
+    size_t n_vals;
+    size_t sub_size = _buffer_elt_size(cr, p, &n_vals);
+    if ((r[0] >= b_high) == (cr->stage_send_high == 1)) {
+      send_info[0] += 1;
+      send_info[1] += n_vals;
     }
-    n0 = i;
+    p += sub_size;
   }
-  else {
-    for (i = 0; i < n; i++) {
-      int *r = (int *)src;
-      cs_lnum_t *n_sub = (cs_lnum_t *)(src + n_vals_shift);
-      size_t sub_size = comp_size + n_sub[0]*elt_size;
-      if (r[0] < cutoff)
-        break;
-      r1_shift += sub_size;
-      src += sub_size;
-    }
-    n1 = i;
+
+  /* Exchange counts */
+
+  cs_timer_t t0 = cs_timer_time();
+
+  uint64_t recv_info[4] = {0, 0, 0, 0};
+  MPI_Request request[3] = {MPI_REQUEST_NULL,
+                            MPI_REQUEST_NULL,
+                            MPI_REQUEST_NULL};
+
+  MPI_Isend(send_info, 2, MPI_UINT64_T, target, cr->rank_id,
+            cr->comm, &request[0]);
+
+  for (int i = 0; i < n_recv; i++)
+    MPI_Irecv(recv_info + i*2, 2, MPI_UINT64_T, target+i, target+i,
+              cr->comm, request+i+1);
+
+  MPI_Waitall(n_recv + 1, request, MPI_STATUSES_IGNORE);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(_cr_timers + 1, &t0, &t1);
+
+  /* Buffer for next stage: data kept, then received data */
+
+  cr->n_elts[1] = n - send_info[0];
+  cr->n_vals[1] = cr->n_vals[0] - send_info[1];
+
+  const size_t keep_size = _data_size(cr, cr->n_elts[1], cr->n_vals[1]);
+  size_t recv_size[2] = {0, 0};
+
+  cr->buffer_size[1] = keep_size;
+  for (int i = 0; i < n_recv; i++) {
+    recv_size[i] = _data_size(cr, recv_info[i*2], recv_info[i*2+1]);
+    cr->buffer_size[1] += recv_size[i];
   }
 
-  size_t r0_end = r0_shift;
-  size_t r1_end = r1_shift;
-  cs_lnum_t i_start = i;
-  unsigned char *src_start = src;
+  BFT_MALLOC(cr->buffer[1], cr->buffer_size[1], unsigned char);
+  if (cr->buffer_size[1] > cr->buffer_size_max[0])
+    cr->buffer_size_max[0] = cr->buffer_size[1];
 
-  /* Count to minimize memory allocation
-     (extra reads, but hopefully a good tradeoff) */
+  /* Send chunk buffers */
 
-  while (i < n) {
-    int *r = (int *)src;
-    cs_lnum_t *n_sub = (cs_lnum_t *)(src + n_vals_shift);
-    size_t sub_size = comp_size + n_sub[0]*elt_size;
-    if (r[0] < cutoff) {
-      r0_end += sub_size;
-    }
-    else {
-      r1_end += sub_size;
-    }
-    i++;
-    src += sub_size;
+  cr->send_size = _data_size(cr, send_info[0], send_info[1]);
+  cr->send_done = 0;
+
+  size_t chunk_buf_size = CS_MIN(cr->chunk_size, cr->send_size);
+  if (chunk_buf_size > cr->chunk_buf_size) {
+    cr->chunk_buf_size = chunk_buf_size;
+    for (int i = 0; i < 2; i++)
+      BFT_REALLOC(cr->chunk_buf[i], cr->chunk_buf_size, unsigned char);
+    if (cr->chunk_buf_size*2 > cr->buffer_size_max[1])
+      cr->buffer_size_max[1] = cr->chunk_buf_size*2;
   }
 
-  cr->buffer_size[1] = (id0 == 0) ? r1_end : r0_end;
-  BFT_REALLOC(cr->buffer[1], cr->buffer_size[1], unsigned char);
-  if (cr->buffer_size[1] > cr->buffer_size_max[1])
-    cr->buffer_size_max[1] = cr->buffer_size[1];
-  size_t alloc_tot = cr->buffer_size[0] + cr->buffer_size[1];
+  size_t alloc_tot =   cr->buffer_size[0] + cr->buffer_size[1]
+                     + cr->chunk_buf_size*2;
   if (alloc_tot > cr->alloc_tot_max)
     cr->alloc_tot_max = alloc_tot;
 
-  i = i_start;
-  src = src_start;
+  /* Post receives (chunks are received directly at their final place) */
 
-  while (i < n) {
-    int *r = (int *)src;
-    cs_lnum_t *n_sub = (cs_lnum_t *)(src + n_vals_shift);
-    size_t sub_size = comp_size + n_sub[0]*elt_size;
-    if (r[0] < cutoff) {
-      unsigned char *dest = cr->buffer[id0] + r0_shift;
-      for (size_t j = 0; j < sub_size; j++)
-        dest[j] = src[j];
-      r0_shift += sub_size;
-      n0++;
-    }
-    else {
-      unsigned char *dest = cr->buffer[id1] + r1_shift;
-      for (size_t j = 0; j < sub_size; j++)
-        dest[j] = src[j];
-      r1_shift += sub_size;
-      n1++;
+  int n_recv_req = 0;
+  for (int i = 0; i < n_recv; i++)
+    n_recv_req += (recv_size[i] + cr->chunk_size - 1) / cr->chunk_size;
+
+  if (n_recv_req > cr->n_recv_req_max) {
+    cr->n_recv_req_max = n_recv_req;
+    BFT_REALLOC(cr->recv_req, cr->n_recv_req_max, MPI_Request);
+  }
+  cr->n_recv_req = n_recv_req;
+
+  size_t r_shift = keep_size;
+  int req_id = 0;
+
+  for (int i = 0; i < n_recv; i++) {
+    size_t r_end = r_shift + recv_size[i];
+    while (r_shift < r_end) {
+      size_t c_size = CS_MIN(cr->chunk_size, r_end - r_shift);
+      MPI_Irecv(cr->buffer[1] + r_shift, c_size / cr->mpi_type_size,
+                cr->mpi_type, target+i, target+i, cr->comm,
+                cr->recv_req + req_id);
+      r_shift += c_size;
+      req_id++;
     }
-    i++;
-    src += sub_size;
+    cr->n_elts[1] += recv_info[i*2];
+    cr->n_vals[1] += recv_info[i*2+1];
   }
 
-  assert(n0 + n1 == n);
+  /* Initialize partitioning state */
 
-  cr->n_elts[id0] = n0;
-  cr->n_elts[id1] = n1;
+  cr->scan_id = 0;
+  cr->scan_shift = 0;
+  cr->elt_done = 0;
+  cr->keep_shift = 0;
+  cr->chunk_fill = 0;
+  cr->chunk_cur = 0;
 
-  cr->n_vals[id0] = (r0_shift - n0*comp_size)/elt_size;
-  cr->n_vals[id1] = (r1_shift - n1*comp_size)/elt_size;
+  cr->stage_active = true;
 }
 
 /*----------------------------------------------------------------------------
- * Send and receive data with a crystal router for one stage.
+ * Progress a stage of exchange with a crystal router.
+ *
+ * Elements kept locally are copied to the next stage buffer, and elements
+ * to send are packed in send chunks, which are sent as soon as they are
+ * full. In non-blocking mode, this function returns as soon as progress
+ * would require waiting for a previous send chunk or for final completion.
  *
  * parameters:
- *   cr        <-> associated crystal router structure
- *   target    <-- base target rank to send/receive from
- *   n_recv    <-- number of ranks to receive from
+ *   cr       <-> associated crystal router structure
+ *   blocking <-- if true, complete the stage; otherwise, return
+ *                when progress would require waiting
+ *
+ * returns:
+ *   true if stage is complete, false otherwise
  *---------------------------------------------------------------------------*/
 
-static  void
-_crystal_sendrecv(cs_crystal_router_t  *cr,
-                  int                   target,
-                  int                   n_recv)
+static bool
+_crystal_stage_progress(cs_crystal_router_t  *cr,
+                        bool                  blocking)
 {
-  cs_timer_t t0 = cs_timer_time();
+  const size_t n = cr->n_elts[0];
+  const int b_high = cr->stage_b_high;
+  const bool send_high = (cr->stage_send_high == 1);
 
-  assert(n_recv <= 2);
+  /* Partition and pack data */
 
-  cs_lnum_t send_size[2];
-  uint64_t test_size;
+  while (cr->scan_id < n) {
 
-  MPI_Status status[3];
-  MPI_Request request[3] = {MPI_REQUEST_NULL,
-                            MPI_REQUEST_NULL,
-                            MPI_REQUEST_NULL};
-  cs_lnum_t recv_size[4] = {0, 0, 0, 0};
-
-  /* Send message to target process */
+    const unsigned char *src = cr->buffer[0] + cr->scan_shift;
+    const int *r = (const int *)src;
+    size_t n_vals;
+    size_t sub_size = _buffer_elt_size(cr, src, &n_vals);
 
-  test_size = _comm_type_count(cr, cr->n_elts[1], cr->n_vals[1]);
+    if ((r[0] >= b_high) != send_high) {
+      memcpy(cr->buffer[1] + cr->keep_shift, src, sub_size);
+      cr->keep_shift += sub_size;
+    }
 
-  send_size[0] = cr->n_elts[1];
-  send_size[1] = test_size;
+    else {
+      while (cr->elt_done < sub_size) {
+        int c_id = cr->chunk_cur;
+        if (cr->chunk_fill == 0) {
+          if (_crystal_request_done(cr->chunk_req + c_id, blocking) == false)
+            return false;
+        }
+        size_t c_size = CS_MIN(cr->chunk_size, cr->send_size - cr->send_done
+                                               + cr->chunk_fill);
+        size_t l_size = CS_MIN(sub_size - cr->elt_done,
+                               c_size - cr->chunk_fill);
+        memcpy(cr->chunk_buf[c_id] + cr->chunk_fill,
+               src + cr->elt_done,
+               l_size);
+        cr->chunk_fill += l_size;
+        cr->elt_done += l_size;
+        cr->send_done += l_size;
+        if (cr->chunk_fill == c_size) {
+          MPI_Isend(cr->chunk_buf[c_id], c_size / cr->mpi_type_size,
+                    cr->mpi_type, cr->stage_target, cr->rank_id,
+                    cr->comm, cr->chunk_req + c_id);
+          cr->chunk_cur = (c_id + 1) % 2;
+          cr->chunk_fill = 0;
+        }
+      }
+      cr->elt_done = 0;
+    }
 
-  if ((uint64_t)send_size[1] != test_size)
-    bft_error(__FILE__, __LINE__, 0,
-              "Crystal router:"
-              "  Message to send would have size too large for C int: %llu",
-              (unsigned long long)test_size);
+    cr->scan_id += 1;
+    cr->scan_shift += sub_size;
 
-  MPI_Isend(&send_size, 2, CS_MPI_LNUM, target, cr->rank_id,
-            cr->comm, &request[0]);
+  }
 
-  for (int i = 0; i < n_recv; i++)
-    MPI_Irecv(recv_size+i*2, 2, CS_MPI_LNUM, target+i, target+i,
-              cr->comm, request+i+1);
+  assert(cr->send_done == cr->send_size);
 
-  MPI_Waitall(n_recv + 1, request, status);
+  /* Wait for completion */
 
-  size_t loc_size = _data_size(cr, cr->n_elts[0], cr->n_vals[0]);
-  for (int i = 0; i < n_recv; i++)
-    loc_size += _data_size(cr, recv_size[i*2], recv_size[i*2+1]);
-  if (   loc_size > cr->buffer_size[0]
-      || loc_size < cr->buffer_size[0]*_realloc_f_threshold) {
-    cr->buffer_size[0] = loc_size;
-    BFT_REALLOC(cr->buffer[0], cr->buffer_size[0], unsigned char);
-    if (cr->buffer_size[0] > cr->buffer_size_max[0])
-      cr->buffer_size_max[0] = cr->buffer_size[0];
-    size_t alloc_tot = cr->buffer_size[0] + cr->buffer_size[1];
-    if (alloc_tot > cr->alloc_tot_max)
-      cr->alloc_tot_max = alloc_tot;
+  if (blocking) {
+    cs_timer_t t0 = cs_timer_time();
+    MPI_Waitall(2, cr->chunk_req, MPI_STATUSES_IGNORE);
+    MPI_Waitall(cr->n_recv_req, cr->recv_req, MPI_STATUSES_IGNORE);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(_cr_timers + 1, &t0, &t1);
+  }
+  else {
+    int flag[2] = {1, 1};
+    MPI_Testall(2, cr->chunk_req, flag, MPI_STATUSES_IGNORE);
+    if (cr->n_recv_req > 0)
+      MPI_Testall(cr->n_recv_req, cr->recv_req, flag + 1,
+                  MPI_STATUSES_IGNORE);
+    if (flag[0] == 0 || flag[1] == 0)
+      return false;
   }
 
-  MPI_Isend(cr->buffer[1], send_size[1], cr->mpi_type,
-            target, cr->rank_id, cr->comm, request);
+  /* Data of next stage replaces current data */
 
-  cr->n_elts[1] = 0;
+  BFT_FREE(cr->buffer[0]);
+  cr->buffer[0] = cr->buffer[1];
+  cr->buffer_size[0] = cr->buffer_size[1];
+  cr->n_elts[0] = cr->n_elts[1];
+  cr->n_vals[0] = cr->n_vals[1];
 
-  for (int i = 0; i < n_recv; i++) {
+  cr->buffer[1] = nullptr;
+  cr->buffer_size[1] = 0;
+  cr->n_elts[1] = 0;
+  cr->n_vals[1] = 0;
+  cr->n_recv_req = 0;
 
-    unsigned char *r_ptr =   cr->buffer[0]
-                           + _data_size(cr, cr->n_elts[0], cr->n_vals[0]);
+  /* Ready for next stage */
 
-    MPI_Irecv(r_ptr, recv_size[i*2 + 1], cr->mpi_type,
-              target+i, target+i, cr->comm, request+1+i);
+  if (cr->rank_id < b_high)
+    cr->stage_n_sub = cr->stage_n_sub / 2;
+  else {
+    cr->stage_n_sub -= cr->stage_n_sub / 2;
+    cr->stage_b_low = b_high;
+  }
 
-    cr->n_elts[0] += recv_size[i*2];
-    cr->n_vals[0] += _comm_type_count_to_n_vals(cr,
-                                                recv_size[i*2],
-                                                recv_size[i*2 + 1]);
+  cr->stage_active = false;
 
+#if _CR_DEBUG_DUMP
+  {
+    char comment[80];
+    if (cr->stage_n_sub > 1) {
+      snprintf(comment, 79, "Crystal Router after sendrecv, n_sub = %d",
+               cr->stage_n_sub);
+    }
+    else {
+      snprintf(comment, 79, "Crystal Router after exchange");
+    }
+    _dump(cr, comment);
   }
+#endif
 
-  MPI_Waitall(n_recv+1, request, status);
-
-  cs_timer_t t1 = cs_timer_time();
-  cs_timer_counter_add_diff(_cr_timers + 1, &t0, &t1);
+  return true;
 }
 
 /*----------------------------------------------------------------------------
@@ -1807,6 +1899,9 @@ cs_crystal_router_destroy(cs_crystal_router_t  **cr)
       cs_crystal_router_t *_cr = *cr;
       if (_cr->mpi_type != MPI_BYTE)
         MPI_Type_free(&(_cr->mpi_type));
+      BFT_FREE(_cr->recv_req);
+      BFT_FREE(_cr->chunk_buf[1]);
+      BFT_FREE(_cr->chunk_buf[0]);
       BFT_FREE(_cr->buffer[1]);
       BFT_FREE(_cr->buffer[0]);
       BFT_FREE(*cr);
@@ -1830,84 +1925,79 @@ cs_crystal_router_destroy(cs_crystal_router_t  **cr)
 void
 cs_crystal_router_exchange(cs_crystal_router_t  *cr)
 {
-  cs_assert(cr != nullptr);
-
-  cs_timer_t t0 = cs_timer_time();
-
-  int target = -1;
-  int send_part = 0;
-  int b_low = 0;
-  int n_sub_ranks = cr->n_ranks;
+  cs_crystal_router_exchange_start(cr);
+  cs_crystal_router_exchange_wait(cr);
+}
 
-  while (n_sub_ranks > 1) {
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a non-blocking data exchange with a Crystal Router.
+ *
+ * The first exchange stage is initiated, and data is sent as far as
+ * possible without waiting. Other operations not involving the
+ * Crystal Router may then be done before calling
+ * \ref cs_crystal_router_exchange_wait to complete the exchange.
+ *
+ * Large stage payloads are sent in chunks whose size may be set with
+ * \ref cs_crystal_router_set_chunk_size, so that send buffer memory remains
+ * bounded.
+ *
+ * \param[in, out]  cr   pointer to associated Crystal Router
+ */
+/*----------------------------------------------------------------------------*/
 
-    int n_recv = 1;
-    int n_low = n_sub_ranks / 2;
-    int b_high = b_low + n_low;
+void
+cs_crystal_router_exchange_start(cs_crystal_router_t  *cr)
+{
+  cs_assert(cr != nullptr);
+  cs_assert(cr->stage_active == false);
 
-    if (cr->rank_id < b_high) {
-      target = cr->rank_id + n_low;
-      if ((n_sub_ranks & 1) && (cr->rank_id == b_high - 1))
-        n_recv = 2;
-      send_part = 1;
-    }
-    else {
-      target = cr->rank_id - n_low;
-      if (target == b_high) {
-        target--;
-        n_recv = 0;
-      }
-      send_part = 0;
-    }
+  cs_timer_t t0 = cs_timer_time();
 
-    /* Partition data */
+  cr->stage_n_sub = cr->n_ranks;
+  cr->stage_b_low = 0;
 
-    if (cr->n_vals_shift == 0)
-      _crystal_partition_strided(cr, send_part, b_high);
-    else
-      _crystal_partition_indexed(cr, send_part, b_high);
+  if (cr->stage_n_sub > 1) {
+    _crystal_stage_init(cr);
+    _crystal_stage_progress(cr, false);
+  }
 
-#if _CR_DEBUG_DUMP
-    {
-      char comment[80];
-      snprintf(comment, 79, "Crystal Router after partition, n_sub = %d",
-               n_sub_ranks);
-      _dump(cr, comment);
-    }
-#endif
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(_cr_timers, &t0, &t1);
+}
 
-    /* Send message to target process */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a data exchange started with
+ *        \ref cs_crystal_router_exchange_start.
+ *
+ * Order of data from a same source rank is preserved.
+ *
+ * \param[in, out]  cr   pointer to associated Crystal Router
+ */
+/*----------------------------------------------------------------------------*/
 
-    _crystal_sendrecv(cr, target, n_recv);
+void
+cs_crystal_router_exchange_wait(cs_crystal_router_t  *cr)
+{
+  cs_assert(cr != nullptr);
 
-    /* Ready for next exchange */
+  cs_timer_t t0 = cs_timer_time();
 
-    if (cr->rank_id < b_high)
-      n_sub_ranks = n_low;
-    else {
-      n_sub_ranks -= n_low;
-      b_low = b_high;
-    }
+  while (cr->stage_active || cr->stage_n_sub > 1) {
+    if (cr->stage_active == false)
+      _crystal_stage_init(cr);
+    _crystal_stage_progress(cr, true);
+  }
 
-#if _CR_DEBUG_DUMP
-    {
-      char comment[80];
-      if (n_sub_ranks > 1) {
-        snprintf(comment, 79, "Crystal Router after sendrecv, n_sub = %d",
-                 n_sub_ranks);
-      }
-      else {
-        snprintf(comment, 79, "Crystal Router after exchange");
-      }
-      _dump(cr, comment);
-    }
-#endif
+  /* Only keep received data */
 
-  }
+  for (int i = 0; i < 2; i++)
+    BFT_FREE(cr->chunk_buf[i]);
+  cr->chunk_buf_size = 0;
 
-  cr->n_elts[1] = 0;
-  cr->buffer_size[1] = 0;
-  BFT_FREE(cr->buffer[1]);
+  BFT_FREE(cr->recv_req);
+  cr->n_recv_req_max = 0;
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_cr_timers, &t0, &t1);
@@ -2196,6 +2286,25 @@ cs_crystal_router_get_max_sizes(cs_crystal_router_t  *cr,
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum message size used by Crystal Router exchanges.
+ *
+ * Data sent at each exchange stage is split in messages of at most this
+ * size, and at most two such messages are buffered for sending, so this
+ * also bounds the send buffer memory. The setting applies to Crystal
+ * Routers created afterwards.
+ *
+ * \param[in]  chunk_size  maximum message size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_crystal_router_set_chunk_size(size_t  chunk_size)
+{
+  _cr_chunk_size = chunk_size;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log performance information relative to Crystal Router exchange.
@@ -177,6 +177,40 @@ cs_crystal_router_destroy(cs_crystal_router_t  **cr);
 void
 cs_crystal_router_exchange(cs_crystal_router_t  *cr);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a non-blocking data exchange with a Crystal Router.
+ *
+ * The first exchange stage is initiated, and data is sent as far as
+ * possible without waiting. Other operations not involving the
+ * Crystal Router may then be done before calling
+ * \ref cs_crystal_router_exchange_wait to complete the exchange.
+ *
+ * Large stage payloads are sent in chunks whose size may be set with
+ * \ref cs_crystal_router_set_chunk_size, so that send buffer memory remains
+ * bounded.
+ *
+ * \param[in, out]  cr   pointer to associated Crystal Router
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_crystal_router_exchange_start(cs_crystal_router_t  *cr);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a data exchange started with
+ *        \ref cs_crystal_router_exchange_start.
+ *
+ * Order of data from a same source rank is preserved.
+ *
+ * \param[in, out]  cr   pointer to associated Crystal Router
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_crystal_router_exchange_wait(cs_crystal_router_t  *cr);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get number of elements associated with Crystal Router.
@@ -286,6 +320,22 @@ cs_crystal_router_get_max_sizes(cs_crystal_router_t  *cr,
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum message size used by Crystal Router exchanges.
+ *
+ * Data sent at each exchange stage is split in messages of at most this
+ * size, and at most two such messages are buffered for sending, so this
+ * also bounds the send buffer memory. The setting applies to Crystal
+ * Routers created afterwards.
+ *
+ * \param[in]  chunk_size  maximum message size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_crystal_router_set_chunk_size(size_t  chunk_size);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log performance information relative to Crystal Router exchange.
@@ -178,10 +178,17 @@ int  cs_glob_node_rank_id = 0;   /*!< Rank on node in main MPI communicator */
 int  cs_glob_node_n_ranks = 1;   /*!< Number of ranks on node of main
                                       MPI communicator */
 
+int  cs_glob_ensemble_n_members = 1;  /*!< Number of ensemble members */
+int  cs_glob_ensemble_member_id = 0;  /*!< Id of local ensemble member */
+
 #if defined(HAVE_MPI)
 
 MPI_Comm  cs_glob_mpi_comm = MPI_COMM_NULL;   /* Main MPI intra-communicator */
 
+MPI_Comm  cs_glob_ensemble_peer_comm = MPI_COMM_NULL; /* Ranks with same id
+                                                         in each ensemble
+                                                         member */
+
 #endif
 
 /*=============================================================================
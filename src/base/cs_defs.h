@@ -542,7 +542,7 @@ typedef enum {
  * Macros for function type qualifiers
  *----------------------------------------------------------------------------*/
 
-#ifdef __NVCC__
+#if defined(__NVCC__) || defined(__HIPCC__)
 
 #define CS_F_HOST __host__
 #define CS_F_DEVICE __device__
@@ -614,10 +614,16 @@ extern int  cs_glob_node_rank_id;  /* Rank on node in main MPI communicator */
 extern int  cs_glob_node_n_ranks;  /* Number of ranks on node of main
                                       MPI communicator */
 
+extern int  cs_glob_ensemble_n_members;  /* Number of ensemble members */
+extern int  cs_glob_ensemble_member_id;  /* Id of local ensemble member */
+
 #if defined(HAVE_MPI) && !defined(CS_IGNORE_MPI)
 
 extern MPI_Comm       cs_glob_mpi_comm;      /* Main MPI intra-communicator */
 
+extern MPI_Comm       cs_glob_ensemble_peer_comm;  /* Ranks with same id in
+                                                      each ensemble member */
+
 #endif
 
 /*----------------------------------------------------------------------------
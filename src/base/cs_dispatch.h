@@ -43,6 +43,10 @@
 #include <sycl/sycl.hpp>
 #endif
 
+#if defined(__HIPCC__)
+#include <hip/hip_runtime.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -81,10 +85,95 @@ typedef enum {
 
   CS_DISPATCH_SUM_SIMPLE,  /*!< Simple sum (assumes data race-avoiding
                                 numbering/coloring) */
-  CS_DISPATCH_SUM_ATOMIC   /*!< Atomic sum */
+  CS_DISPATCH_SUM_ATOMIC,  /*!< Atomic sum */
+  CS_DISPATCH_SUM_GATHER   /*!< Gather sum: loop on destination elements
+                                using an adjacency, so that each value is
+                                only summed by its owning thread (no
+                                atomics needed) */
 
 } cs_dispatch_sum_type_t;
 
+/*!
+ * Reusable graph of kernel launches.
+ *
+ * With CUDA, when graphs are allowed (CS_CUDA_ALLOW_GRAPH environment
+ * variable), the kernels launched in a sequence are captured at each
+ * use, and the instantiated graph is only updated when the sequence's
+ * topology is unchanged, so kernel arguments may differ between uses.
+ * The sequence must not synchronize its stream. Otherwise, the sequence
+ * is simply run.
+ */
+
+class cs_dispatch_graph {
+
+#if defined(__NVCC__) && (CUDART_VERSION >= 11040)
+
+private:
+
+  cudaGraphExec_t  exec_;  /*!< Instantiated graph, or nullptr */
+
+public:
+
+  cs_dispatch_graph(void)
+    : exec_(nullptr)
+  {}
+
+  cs_dispatch_graph(const cs_dispatch_graph&) = delete;
+  cs_dispatch_graph& operator=(const cs_dispatch_graph&) = delete;
+
+  ~cs_dispatch_graph() {
+    if (exec_ != nullptr)
+      cudaGraphExecDestroy(exec_);
+  }
+
+  //! Capture kernels launched by a function on a stream, and launch them
+  //! as a graph.
+  template <class F>
+  void
+  launch(cudaStream_t  stream,
+         F&&           f) {
+    cudaStreamCaptureStatus c_status = cudaStreamCaptureStatusNone;
+    cudaStreamIsCapturing(stream, &c_status);
+
+    if (   cs_glob_cuda_allow_graph == false
+        || c_status != cudaStreamCaptureStatusNone) {
+      f();
+      return;
+    }
+
+    cudaGraph_t graph;
+    cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal);
+    f();
+    cudaStreamEndCapture(stream, &graph);
+
+    if (exec_ != nullptr) {
+#if (CUDART_VERSION >= 12000)
+      cudaGraphExecUpdateResultInfo u_info;
+      cudaError_t u_status = cudaGraphExecUpdate(exec_, graph, &u_info);
+#else
+      cudaGraphNode_t u_node;
+      cudaGraphExecUpdateResult u_result;
+      cudaError_t u_status = cudaGraphExecUpdate(exec_, graph,
+                                                 &u_node, &u_result);
+#endif
+      if (u_status != cudaSuccess) {  /* topology changed */
+        cudaGetLastError();
+        cudaGraphExecDestroy(exec_);
+        exec_ = nullptr;
+      }
+    }
+
+    if (exec_ == nullptr)
+      cudaGraphInstantiateWithFlags(&exec_, graph, 0);
+
+    cudaGraphDestroy(graph);
+    cudaGraphLaunch(exec_, stream);
+  }
+
+#endif // defined(__NVCC__) && (CUDART_VERSION >= 11040)
+
+};
+
 /*!
  * Provide default implementations of a cs_context based on parallel_for
  * function. This class is a mixin that use CRTP (Curiously Recurring
@@ -115,6 +204,14 @@ public:
                        F&&               f,
                        Args&&...         args);
 
+  // Assembly loop over all internal faces, overlapping a communication
+  template <class C, class F, class... Args>
+  decltype(auto)
+  parallel_for_i_faces_overlap(const cs_mesh_t*  m,
+                               C&&               comm_wait,
+                               F&&               f,
+                               Args&&...         args);
+
   // Parallel reduction with simple sum.
   // Must be redefined by the child class
   template <class F, class... Args>
@@ -122,6 +219,12 @@ public:
   parallel_for_reduce_sum
     (cs_lnum_t n, double& sum, F&& f, Args&&... args) = delete;
 
+  // Run a sequence of loops, replayed as a graph where supported
+  template <class F>
+  bool
+  graph_launch(cs_dispatch_graph&  g,
+               F&&                 f);
+
   // Query sum type for assembly loop over all interior faces
   // Must be redefined by the child class
   bool
@@ -158,6 +261,29 @@ decltype(auto) cs_dispatch_context_mixin<Derived>::parallel_for_b_faces
                                          static_cast<Args&&>(args)...);
 }
 
+// Default implementation of parallel_for_i_faces_overlap, completing
+// the communication before the loop
+template <class Derived>
+template <class C, class F, class... Args>
+decltype(auto) cs_dispatch_context_mixin<Derived>::parallel_for_i_faces_overlap
+  (const cs_mesh_t* m, C&& comm_wait, F&& f, Args&&... args) {
+  comm_wait();
+  return static_cast<Derived*>(this)->parallel_for_i_faces
+                                        (m,
+                                         static_cast<F&&>(f),
+                                         static_cast<Args&&>(args)...);
+}
+
+// Default implementation of graph_launch, simply running the sequence
+template <class Derived>
+template <class F>
+bool cs_dispatch_context_mixin<Derived>::graph_launch
+  ([[maybe_unused]] cs_dispatch_graph&  g,
+   F&&                                  f) {
+  f();
+  return true;
+}
+
 // Default implementation of get interior faces sum type
 template <class Derived>
 bool cs_dispatch_context_mixin<Derived>::try_get_parallel_for_i_faces_sum_type
@@ -186,11 +312,13 @@ private:
 
   cs_lnum_t  n_min_for_threads;  /*!< Run on single thread
                                    under this threshold */
+  bool       use_tasks_;         /*!< Use OpenMP tasks to overlap
+                                   communication with computation */
 
 public:
 
   cs_host_context()
-    : n_min_for_threads(CS_THR_MIN)
+    : n_min_for_threads(CS_THR_MIN), use_tasks_(true)
   {}
 
 public:
@@ -207,6 +335,18 @@ public:
     return this->n_min_for_threads;
   }
 
+  //! Set whether OpenMP tasks may be used to overlap communication.
+  void
+  set_use_cpu_tasks(bool  use_tasks) {
+    this->use_tasks_ = use_tasks;
+  }
+
+  //! Check whether OpenMP tasks may be used to overlap communication.
+  bool
+  use_cpu_tasks(void) {
+    return this->use_tasks_;
+  }
+
   //! Iterate using a plain omp parallel for
   template <class F, class... Args>
   bool
@@ -239,6 +379,85 @@ public:
     return true;
   }
 
+  //! Loop over the interior faces of a mesh using a specific numbering
+  //! that avoids conflicts between threads, overlapping a communication
+  //! (usually the completion of a halo synchronization).
+  //!
+  //! The main thread calls comm_wait (so the MPI_THREAD_FUNNELED level
+  //! is sufficient), while another thread generates one task per
+  //! thread range of each group, restricted to faces not adjacent to
+  //! ghost cells; those tasks are executed by the remaining threads,
+  //! and by the main thread once the communication is complete.
+  //! Faces adjacent to ghost cells are then handled by all threads.
+  template <class C, class F, class... Args>
+  bool
+  parallel_for_i_faces_overlap(const cs_mesh_t*  m,
+                               C&&               comm_wait,
+                               F&&               f,
+                               Args&&...         args) {
+#if defined(HAVE_OPENMP)
+    if (   use_tasks_ == false || m->halo == nullptr
+        || omp_get_max_threads() < 2 || omp_in_parallel()) {
+      comm_wait();
+      return parallel_for_i_faces(m, f, args...);
+    }
+
+    const int n_i_groups  = m->i_face_numbering->n_groups;
+    const int n_i_threads = m->i_face_numbering->n_threads;
+    const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+    const cs_lnum_2_t *restrict i_face_cells = m->i_face_cells;
+    const cs_lnum_t n_cells = m->n_cells;
+
+    #pragma omp parallel
+    {
+      const int t_rank = omp_get_thread_num();
+
+      if (t_rank == 0)
+        comm_wait();
+
+      else if (t_rank == 1) {
+        for (int g_id = 0; g_id < n_i_groups; g_id++) {
+          for (int t_id = 0; t_id < n_i_threads; t_id++) {
+            #pragma omp task
+            {
+              for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+                   f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+                   f_id++) {
+                if (   i_face_cells[f_id][0] < n_cells
+                    && i_face_cells[f_id][1] < n_cells)
+                  f(f_id, args...);
+              }
+            }
+          }
+          // Ranges of successive groups may share cells
+          #pragma omp taskwait
+        }
+      }
+
+      // All tasks are completed at this barrier
+      #pragma omp barrier
+
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+        #pragma omp for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+               f_id++) {
+            if (   i_face_cells[f_id][0] >= n_cells
+                || i_face_cells[f_id][1] >= n_cells)
+              f(f_id, args...);
+          }
+        }
+      }
+    }
+
+    return true;
+#else
+    comm_wait();
+    return parallel_for_i_faces(m, f, args...);
+#endif
+  }
+
   //! Loop over the boundary faces of a mesh using a specific numbering
   //! that avoids conflicts between threads.
   template <class F, class... Args>
@@ -308,6 +527,25 @@ __global__ void cs_cuda_kernel_parallel_for(cs_lnum_t n, F f, Args... args) {
   }
 }
 
+/* Kernel that loops over a sub-range [s_id, e_id[ of integers and calls
+   a device functor (used for conflict-free groups of interior faces).
+   All arguments *must* be passed by value to avoid passing CPU references
+   to the GPU. */
+
+template <class F, class... Args>
+__global__ void
+cs_cuda_kernel_parallel_for_range(cs_lnum_t  s_id,
+                                  cs_lnum_t  e_id,
+                                  F          f,
+                                  Args...    args) {
+  // grid_size-stride loop
+  for (cs_lnum_t id = s_id + blockIdx.x * blockDim.x + threadIdx.x;
+       id < e_id;
+       id += blockDim.x * gridDim.x) {
+    f(id, args...);
+  }
+}
+
 /* Default kernel that loops over an integer range and calls a device functor.
    This kernel uses a grid_size-stride loop and thus guarantees that all
    integers are processed, even if the grid is smaller.
@@ -504,6 +742,8 @@ public:
   }
 
   //! Try to launch on the GPU and return false if not available
+  //! With a colored interior faces numbering, one kernel is launched
+  //! per color, so that scatter sums do not require atomics.
   template <class F, class... Args>
   bool
   parallel_for_i_faces(const cs_mesh_t* m, F&& f, Args&&... args) {
@@ -512,6 +752,34 @@ public:
       return false;
     }
 
+    const cs_numbering_t *i_numbering = m->i_face_numbering;
+    if (i_numbering != nullptr && i_numbering->colored) {
+      const int n_groups = i_numbering->n_groups;
+      const int n_threads = i_numbering->n_threads;
+      const cs_lnum_t *group_index = i_numbering->group_index;
+      auto launch_groups = [&]() {
+        for (int g_id = 0; g_id < n_groups; g_id++) {
+          cs_lnum_t s_id = group_index[g_id*2];
+          cs_lnum_t e_id = group_index[((n_threads-1)*n_groups + g_id)*2 + 1];
+          cs_lnum_t n_g = e_id - s_id;
+          long g_grid_size = grid_size_;
+          if (g_grid_size < 1) {
+            g_grid_size = (n_g % block_size_) ?
+              n_g/block_size_ + 1 : n_g/block_size_;
+          }
+          if (n_g > 0)
+            cs_cuda_kernel_parallel_for_range
+              <<<g_grid_size, block_size_, 0, stream_>>>
+              (s_id, e_id, f, args...);
+        }
+      };
+      /* One kernel per color: replay as a graph to reduce launch
+         overhead (one graph per call site, i.e. per functor type). */
+      static cs_dispatch_graph groups_graph;
+      graph_launch(groups_graph, launch_groups);
+      return true;
+    }
+
     long l_grid_size = grid_size_;
     if (l_grid_size < 1) {
       l_grid_size = (n % block_size_) ? n/block_size_ + 1 : n/block_size_;
@@ -586,6 +854,23 @@ public:
     return true;
   }
 
+  //! Run a sequence of loops on the associated stream, captured and
+  //! replayed as a CUDA graph if allowed; return false if not on GPU
+  template <class F>
+  bool
+  graph_launch(cs_dispatch_graph&  g,
+               F&&                 f) {
+    if (device_ < 0 || use_gpu_ == false) {
+      return false;
+    }
+#if (CUDART_VERSION >= 11040)
+    g.launch(stream_, static_cast<F&&>(f));
+#else
+    f();
+#endif
+    return true;
+  }
+
   //! Synchronize associated stream
   void
   wait(void) {
@@ -593,6 +878,25 @@ public:
       cudaStreamSynchronize(stream_);
   }
 
+  //! Make work submitted to this context after this call wait for
+  //! completion of work already submitted to another context.
+  //! When both contexts run on the GPU, this uses an event recorded on
+  //! the other stream, so the host is not blocked.
+  void
+  wait_for(cs_device_context  &other) {
+    if (other.use_gpu() == false || other.stream_ == stream_)
+      return;
+    if (device_ < 0 || use_gpu_ == false) {
+      other.wait();
+      return;
+    }
+    cudaEvent_t event;
+    cudaEventCreateWithFlags(&event, cudaEventDisableTiming);
+    cudaEventRecord(event, other.stream_);
+    cudaStreamWaitEvent(stream_, event, 0);
+    cudaEventDestroy(event);  /* released once the wait is resolved */
+  }
+
   // Get interior faces sum type associated with this context
   bool
   try_get_parallel_for_i_faces_sum_type(const cs_mesh_t         *m,
@@ -601,7 +905,10 @@ public:
       return false;
     }
 
-    st = CS_DISPATCH_SUM_ATOMIC;
+    if (m->i_face_numbering != nullptr && m->i_face_numbering->colored)
+      st = CS_DISPATCH_SUM_SIMPLE;
+    else
+      st = CS_DISPATCH_SUM_ATOMIC;
     return true;
   }
 
@@ -715,19 +1022,20 @@ public:
       return false;
     }
 
-    // TODO: use persistent allocation as we do in CUDA BLAS to avoid
-    //       excess allocation/deallocation.
-    double *sum_ptr = (double *)sycl::malloc_shared(sizeof(double), queue_);
+    // Persistent allocation, to avoid allocation/deallocation per call.
+    static double *sum_ptr = nullptr;
+    if (sum_ptr == nullptr)
+      sum_ptr = (double *)sycl::malloc_shared(sizeof(double), queue_);
 
     queue_.parallel_for(n,
-                        sycl::reduction(sum_ptr, 0., sycl::plus<double>()),
+                        sycl::reduction(sum_ptr, 0., sycl::plus<double>(),
+                                        sycl::property::reduction
+                                          ::initialize_to_identity{}),
                         static_cast<F&&>(f),
                         static_cast<Args&&>(args)...).wait();
 
     sum_ = sum_ptr[0];
 
-    sycl::free((void *)sum_ptr, queue_);
-
     return true;
   }
 
@@ -738,6 +1046,29 @@ public:
       queue_.wait();
   }
 
+  //! Run a sequence of loops (not captured with SYCL);
+  //! return false if not on GPU
+  template <class F>
+  bool
+  graph_launch([[maybe_unused]] cs_dispatch_graph&  g,
+               F&&                                  f) {
+    if (is_gpu == false || use_gpu_ == false) {
+      return false;
+    }
+    f();
+    return true;
+  }
+
+  //! Make work submitted to this context after this call wait for
+  //! completion of work already submitted to another context.
+  //! Only work on a same in-order queue is ordered without waiting.
+  void
+  wait_for(cs_device_context  &other) {
+    if (   other.use_gpu()
+        && !(queue_ == other.queue_ && queue_.is_in_order()))
+      other.wait();
+  }
+
   // Get interior faces sum type associated with this context
   bool
   try_get_parallel_for_i_faces_sum_type(const cs_mesh_t         *m,
@@ -764,7 +1095,275 @@ public:
 
 };
 
-#endif  // __NVCC__ or SYCL
+#elif defined(__HIPCC__)
+
+/* Kernel that loops over an integer range and calls a device functor
+   (grid_size-stride loop). All arguments *must* be passed by value. */
+
+template <class F, class... Args>
+__global__ void
+cs_hip_kernel_parallel_for(cs_lnum_t  n,
+                           F          f,
+                           Args...    args) {
+  for (cs_lnum_t id = blockIdx.x * blockDim.x + threadIdx.x; id < n;
+       id += blockDim.x * gridDim.x) {
+    f(id, args...);
+  }
+}
+
+/* Kernel that loops over an integer range and calls a device functor
+   with sum reduction. Each block reduces its contributions in shared
+   memory (block size must be a power of 2), then adds them atomically
+   to the result. */
+
+template <class F, class... Args>
+__global__ void
+cs_hip_kernel_parallel_for_reduce_sum(cs_lnum_t   n,
+                                      double     *res,
+                                      F           f,
+                                      Args...     args) {
+  extern __shared__ double stmp[];
+  const cs_lnum_t tid = threadIdx.x;
+
+  stmp[tid] = 0;
+
+  for (cs_lnum_t id = blockIdx.x * blockDim.x + threadIdx.x; id < n;
+       id += blockDim.x * gridDim.x) {
+    f(id, stmp[tid], args...);
+  }
+
+  for (unsigned int s = blockDim.x/2; s > 0; s >>= 1) {
+    __syncthreads();
+    if (tid < s)
+      stmp[tid] += stmp[tid + s];
+  }
+
+  if (tid == 0)
+    atomicAdd(res, stmp[0]);
+}
+
+/*!
+ * Context to execute loops with HIP on the device
+ *
+ * No HIP-specific allocator is used, so arrays must be accessible from the
+ * device through unified memory (APU, or XNACK enabled).
+ */
+
+class cs_device_context : public cs_dispatch_context_mixin<cs_device_context> {
+
+private:
+
+  long          grid_size_;   /*!< Associated grid size; if <= 0, each kernel
+                                launch will use a grid size based on
+                                the number of elements. */
+  long          block_size_;  /*!< Associated block size */
+  hipStream_t   stream_;      /*!< Associated HIP stream */
+  int           device_;      /*!< Associated HIP device id */
+
+  bool          use_gpu_;     /*!< Run on GPU if available */
+
+  //! Persistent reduction buffer (device memory)
+  static double *
+  reduce_buffer_(void) {
+    static double *buf = nullptr;
+    if (buf == nullptr)
+      hipMalloc((void **)&buf, sizeof(double));
+    return buf;
+  }
+
+  //! Grid size for n elements
+  long
+  grid_size_for_(cs_lnum_t  n) {
+    long l_grid_size = grid_size_;
+    if (l_grid_size < 1)
+      l_grid_size = (n % block_size_) ? n/block_size_ + 1 : n/block_size_;
+    return l_grid_size;
+  }
+
+public:
+
+  //! Constructor
+
+  cs_device_context(void)
+    : grid_size_(0), block_size_(256), stream_(nullptr), device_(-1),
+      use_gpu_(true)
+  {
+    int n_devices = 0;
+    if (hipGetDeviceCount(&n_devices) == hipSuccess && n_devices > 0)
+      hipGetDevice(&device_);
+  }
+
+  cs_device_context(hipStream_t  stream)
+    : cs_device_context()
+  {
+    stream_ = stream;
+  }
+
+  //! Change grid_size configuration, but keep the stream and device
+
+  void
+  set_hip_grid(long  grid_size,
+               long  block_size) {
+    this->grid_size_ = grid_size;
+    this->block_size_ = block_size;
+  }
+
+  //! Change stream, but keeps the grid and device configuration
+
+  void
+  set_hip_stream(hipStream_t  stream) {
+    this->stream_ = stream;
+  }
+
+  //! Get associated stream
+
+  hipStream_t
+  hip_stream(void) {
+    return this->stream_;
+  }
+
+  //! Set or unset execution on GPU
+
+  void
+  set_use_gpu(bool  use_gpu) {
+    this->use_gpu_ = use_gpu;
+  }
+
+  //! Check whether we are trying to run on GPU
+
+  bool
+  use_gpu(void) {
+    return (device_ >= 0 && use_gpu_);
+  }
+
+  //! Check preferred allocation mode depending on execution policy
+  //! (host allocation, accessed through unified memory)
+
+  cs_alloc_mode_t
+  alloc_mode(void) {
+    return CS_ALLOC_HOST;
+  }
+
+  cs_alloc_mode_t
+  alloc_mode([[maybe_unused]] bool readable_on_cpu) {
+    return CS_ALLOC_HOST;
+  }
+
+public:
+
+  //! Try to launch on the GPU and return false if not available
+  template <class F, class... Args>
+  bool
+  parallel_for(cs_lnum_t n, F&& f, Args&&... args) {
+    if (device_ < 0 || use_gpu_ == false) {
+      return false;
+    }
+
+    if (n > 0)
+      cs_hip_kernel_parallel_for
+        <<<grid_size_for_(n), block_size_, 0, stream_>>>
+        (n, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+
+    return true;
+  }
+
+  //! Launch kernel on the GPU with simple sum reduction
+  //! The reduction involves an implicit wait().
+  template <class F, class... Args>
+  bool
+  parallel_for_reduce_sum(cs_lnum_t n,
+                          double&   sum,
+                          F&&       f,
+                          Args&&... args) {
+    sum = 0;
+    if (device_ < 0 || use_gpu_ == false) {
+      return false;
+    }
+    if (n == 0)
+      return true;
+
+    double *res = reduce_buffer_();
+    hipMemsetAsync(res, 0, sizeof(double), stream_);
+
+    int smem_size = block_size_ * sizeof(double);
+    cs_hip_kernel_parallel_for_reduce_sum
+      <<<grid_size_for_(n), block_size_, smem_size, stream_>>>
+      (n, res, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+
+    hipMemcpyAsync(&sum, res, sizeof(double), hipMemcpyDeviceToHost,
+                   stream_);
+    hipStreamSynchronize(stream_);
+
+    return true;
+  }
+
+  //! Synchronize associated stream
+  void
+  wait(void) {
+    if (device_ > -1 && use_gpu_)
+      hipStreamSynchronize(stream_);
+  }
+
+  //! Run a sequence of loops (not captured with HIP);
+  //! return false if not on GPU
+  template <class F>
+  bool
+  graph_launch([[maybe_unused]] cs_dispatch_graph&  g,
+               F&&                                  f) {
+    if (device_ < 0 || use_gpu_ == false) {
+      return false;
+    }
+    f();
+    return true;
+  }
+
+  //! Make work submitted to this context after this call wait for
+  //! completion of work already submitted to another context,
+  //! using an event so the host is not blocked.
+  void
+  wait_for(cs_device_context  &other) {
+    if (other.use_gpu() == false || other.stream_ == stream_)
+      return;
+    if (device_ < 0 || use_gpu_ == false) {
+      other.wait();
+      return;
+    }
+    hipEvent_t event;
+    hipEventCreateWithFlags(&event, hipEventDisableTiming);
+    hipEventRecord(event, other.stream_);
+    hipStreamWaitEvent(stream_, event, 0);
+    hipEventDestroy(event);
+  }
+
+  // Get interior faces sum type associated with this context
+  bool
+  try_get_parallel_for_i_faces_sum_type
+    ([[maybe_unused]] const cs_mesh_t  *m,
+     cs_dispatch_sum_type_t            &st) {
+    if (device_ < 0 || use_gpu_ == false) {
+      return false;
+    }
+
+    st = CS_DISPATCH_SUM_ATOMIC;
+    return true;
+  }
+
+  // Get boundary faces sum type associated with this context
+  bool
+  try_get_parallel_for_b_faces_sum_type
+    ([[maybe_unused]] const cs_mesh_t  *m,
+     cs_dispatch_sum_type_t            &st) {
+    if (device_ < 0 || use_gpu_ == false) {
+      return false;
+    }
+
+    st = CS_DISPATCH_SUM_ATOMIC;
+    return true;
+  }
+
+};
+
+#endif  // __NVCC__, SYCL or HIP
 
 /*!
  * Context to group unused options and catch missing execution paths.
@@ -803,7 +1402,8 @@ public:
 
 #endif  // __NVCC__
 
-#if !defined(__NVCC__) && !defined(SYCL_LANGUAGE_VERSION)
+#if    !defined(__NVCC__) && !defined(SYCL_LANGUAGE_VERSION) \
+    && !defined(__HIPCC__)
 
   /* Fill-in for device methods */
 
@@ -834,7 +1434,11 @@ public:
   wait(void) {
   }
 
-#endif  // ! __NVCC__ && ! SYCL_LANGUAGE_VERSION
+  void
+  wait_for([[maybe_unused]] cs_void_context  &other) {
+  }
+
+#endif  // ! __NVCC__ && ! SYCL_LANGUAGE_VERSION && ! __HIPCC__
 
 public:
 
@@ -898,6 +1502,29 @@ public:
     };
   }
 
+  template <class C, class F, class... Args>
+  auto parallel_for_i_faces_overlap(const cs_mesh_t*  m,
+                                    C&&               comm_wait,
+                                    F&&               f,
+                                    Args&&...         args) {
+    // Ensure the communication is completed exactly once, even if
+    // a context completes it before finding it cannot run the loop.
+    bool comm_done = false;
+    auto comm_once = [&]() {
+      if (comm_done == false) {
+        comm_wait();
+        comm_done = true;
+      }
+    };
+    bool launched = false;
+    [[maybe_unused]] decltype(nullptr) try_execute[] = {
+      (   launched = launched
+       || Contexts::parallel_for_i_faces_overlap(m, comm_once, f, args...),
+          nullptr)...
+    };
+    comm_once();
+  }
+
   template <class F, class... Args>
   auto parallel_for(cs_lnum_t n, F&& f, Args&&... args) {
     bool launched = false;
@@ -918,6 +1545,15 @@ public:
     };
   }
 
+  template <class F>
+  auto graph_launch(cs_dispatch_graph& g, F&& f) {
+    bool launched = false;
+    [[maybe_unused]] decltype(nullptr) try_execute[] = {
+      (   launched = launched
+       || Contexts::graph_launch(g, f), nullptr)...
+    };
+  }
+
   cs_dispatch_sum_type_t
   get_parallel_for_i_faces_sum_type(const cs_mesh_t* m) {
     cs_dispatch_sum_type_t sum_type = CS_DISPATCH_SUM_ATOMIC;
@@ -946,13 +1582,14 @@ public:
 
 /*----------------------------------------------------------------------------*/
 /*!
- * Default cs_dispatch_context that is a combination of (CPU) and GPU (CUDA)
- * context if available.
+ * Default cs_dispatch_context that is a combination of (CPU) and GPU
+ * (CUDA, SYCL or HIP) context if available.
  */
 /*----------------------------------------------------------------------------*/
 
 class cs_dispatch_context : public cs_combined_context<
-#if defined(__NVCC__) || defined(SYCL_LANGUAGE_VERSION)
+#if    defined(__NVCC__) || defined(SYCL_LANGUAGE_VERSION) \
+    || defined(__HIPCC__)
   cs_device_context,
 #endif
   cs_host_context,
@@ -962,7 +1599,8 @@ class cs_dispatch_context : public cs_combined_context<
 
 private:
   using base_t = cs_combined_context<
-#if defined(__NVCC__) || defined(SYCL_LANGUAGE_VERSION)
+#if    defined(__NVCC__) || defined(SYCL_LANGUAGE_VERSION) \
+    || defined(__HIPCC__)
   cs_device_context,
 #endif
   cs_host_context,
@@ -991,6 +1629,15 @@ public:
 
   `cs_dispatch_context ctx(cs_device_context(), {});`
 
+  Independent kernels may be run concurrently using contexts associated
+  with different streams, with dependencies expressed using events rather
+  than host synchronization, for example:
+
+  `cs_dispatch_context ctx, ctx_b;`
+  `ctx_b.set_cuda_stream(1);`
+  `ctx_b.parallel_for(n_b_faces, ...);  // runs alongside ctx work`
+  `ctx.wait_for(ctx_b);               // later ctx work sees ctx_b results`
+
 */
 
 /*=============================================================================
@@ -1035,7 +1682,8 @@ cs_dispatch_sum(T                       *dest,
     atomicAdd(dest, src);
 #endif
   }
-  else if (sum_type == CS_DISPATCH_SUM_SIMPLE) {
+  else if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+           || sum_type == CS_DISPATCH_SUM_GATHER) {
     *dest += src;
   }
 }
@@ -1048,7 +1696,8 @@ cs_dispatch_sum(T                       *dest,
                 const T                  src,
                 cs_dispatch_sum_type_t   sum_type)
 {
-  if (sum_type == CS_DISPATCH_SUM_SIMPLE) {
+  if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+      || sum_type == CS_DISPATCH_SUM_GATHER) {
     *dest += src;
   }
   else if (sum_type == CS_DISPATCH_SUM_ATOMIC) {
@@ -1059,7 +1708,29 @@ cs_dispatch_sum(T                       *dest,
   }
 }
 
-#else  // ! CUDA or SYCL
+#elif defined(__HIPCC__)
+
+template <typename T>
+__host__ __device__ inline void
+cs_dispatch_sum(T                       *dest,
+                const T                  src,
+                cs_dispatch_sum_type_t   sum_type)
+{
+  if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+      || sum_type == CS_DISPATCH_SUM_GATHER) {
+    *dest += src;
+  }
+  else if (sum_type == CS_DISPATCH_SUM_ATOMIC) {
+#if defined(__HIP_DEVICE_COMPILE__)
+    atomicAdd(dest, src);
+#else
+    #pragma omp atomic
+    *dest += src;
+#endif
+  }
+}
+
+#else  // ! CUDA, SYCL or HIP
 
 template <typename T>
 inline void
@@ -1067,7 +1738,8 @@ cs_dispatch_sum(T                       *dest,
                 const T                  src,
                 cs_dispatch_sum_type_t   sum_type)
 {
-  if (sum_type == CS_DISPATCH_SUM_SIMPLE) {
+  if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+      || sum_type == CS_DISPATCH_SUM_GATHER) {
     *dest += src;
   }
   else if (sum_type == CS_DISPATCH_SUM_ATOMIC) {
@@ -1102,7 +1774,8 @@ cs_dispatch_sum(T                       *dest,
                 const T                 *src,
                 cs_dispatch_sum_type_t   sum_type)
 {
-  if (sum_type == CS_DISPATCH_SUM_SIMPLE) {
+  if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+      || sum_type == CS_DISPATCH_SUM_GATHER) {
     for (cs_lnum_t i = 0; i < dim; i++) {
       dest[i] += src[i];
     }
@@ -1136,7 +1809,8 @@ cs_dispatch_sum(T                       *dest,
                 const T                 *src,
                 cs_dispatch_sum_type_t   sum_type)
 {
-  if (sum_type == CS_DISPATCH_SUM_SIMPLE) {
+  if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+      || sum_type == CS_DISPATCH_SUM_GATHER) {
     for (size_t i = 0; i < dim; i++) {
       dest[i] += src[i];
     }
@@ -1151,7 +1825,33 @@ cs_dispatch_sum(T                       *dest,
   }
 }
 
-#else  // ! CUDA or SYCL
+#elif defined(__HIPCC__)
+
+template <size_t dim, typename T>
+__host__ __device__ inline void
+cs_dispatch_sum(T                       *dest,
+                const T                 *src,
+                cs_dispatch_sum_type_t   sum_type)
+{
+  if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+      || sum_type == CS_DISPATCH_SUM_GATHER) {
+    for (size_t i = 0; i < dim; i++) {
+      dest[i] += src[i];
+    }
+  }
+  else if (sum_type == CS_DISPATCH_SUM_ATOMIC) {
+    for (size_t i = 0; i < dim; i++) {
+#if defined(__HIP_DEVICE_COMPILE__)
+      atomicAdd(&dest[i], src[i]);
+#else
+      #pragma omp atomic
+      dest[i] += src[i];
+#endif
+    }
+  }
+}
+
+#else  // ! CUDA, SYCL or HIP
 
 template <size_t dim, typename T>
 inline void
@@ -1159,7 +1859,8 @@ cs_dispatch_sum(T                       *dest,
                 const T                 *src,
                 cs_dispatch_sum_type_t   sum_type)
 {
-  if (sum_type == CS_DISPATCH_SUM_SIMPLE) {
+  if (   sum_type == CS_DISPATCH_SUM_SIMPLE
+      || sum_type == CS_DISPATCH_SUM_GATHER) {
     for (size_t i = 0; i < dim; i++) {
       dest[i] += src[i];
     }
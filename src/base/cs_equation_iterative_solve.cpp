@@ -826,21 +826,34 @@ _equation_iterative_solve_strided(int                   idtvar,
       /* ||E.dx^(k-1)-E.0||^2 */
       cs_real_t nadxkm1 = nadxk;
 
+      /* Dot products are reduced together */
+      cs_parall_deferred_sum dsum;
+      cs_real_t paxkrk = 0.;
+
       /* ||E.dx^k-E.0||^2 */
-      nadxk = cs_gdot(stride*n_cells, (cs_real_t *)adxk, (cs_real_t *)adxk);
+      dsum.add(cs_dot(stride*n_cells, (cs_real_t *)adxk, (cs_real_t *)adxk),
+               &nadxk);
 
       /* < E.dx^k-E.0; r^k > */
-      cs_real_t paxkrk = cs_gdot(stride*n_cells,
-                                 (cs_real_t *)smbrp,
-                                 (cs_real_t *)adxk);
+      dsum.add(cs_dot(stride*n_cells, (cs_real_t *)smbrp, (cs_real_t *)adxk),
+               &paxkrk);
 
-      /* Relaxation with respect to dx^k and dx^(k-1) */
       if (iswdyp >= 2) {
         /* < E.dx^(k-1)-E.0; r^k > */
-        paxm1rk = cs_gdot(stride*n_cells, (cs_real_t *)smbrp, (cs_real_t *)adxkm1);
+        dsum.add(cs_dot(stride*n_cells,
+                        (cs_real_t *)smbrp, (cs_real_t *)adxkm1),
+                 &paxm1rk);
 
         /* < E.dx^(k-1)-E.0; E.dx^k-E.0 > */
-        paxm1ax = cs_gdot(stride*n_cells, (cs_real_t *)adxk, (cs_real_t *)adxkm1);
+        dsum.add(cs_dot(stride*n_cells,
+                        (cs_real_t *)adxk, (cs_real_t *)adxkm1),
+                 &paxm1ax);
+      }
+
+      dsum.flush();
+
+      /* Relaxation with respect to dx^k and dx^(k-1) */
+      if (iswdyp >= 2) {
 
         if (   (nadxkm1 > 1.e-30*rnorm2)
             && (nadxk*nadxkm1 - cs_math_pow2(paxm1ax)) > 1.e-30*rnorm2)
@@ -1345,6 +1358,27 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
     coupling_id = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
   }
 
+  /* Optional reuse of convection/diffusion gradients when the
+     values they are based on are not modified */
+
+  bool gradient_reuse = false;
+  if (f != nullptr && idtvar >= 0) {
+    if (cs_field_get_key_int(f, cs_field_key_id("gradient_reuse")) > 0)
+      gradient_reuse = true;
+  }
+
+  /* When reusing gradients, those may be updated only where the
+     increment of a sweep is significant, instead of being recomputed */
+
+  double gradient_update_tol = -1.;
+  if (gradient_reuse)
+    gradient_update_tol
+      = cs_field_get_key_double(f,
+                                cs_field_key_id("gradient_update_tolerance"));
+
+  if (gradient_reuse)
+    cs_convection_diffusion_gradient_cache_start(f_id);
+
   /* Determine if we are in a case with special requirements */
 
   if (coupling_id < 0 && iconvp > 0) {
@@ -1485,6 +1519,9 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
     pvar[cell_id] = pvark[cell_id];
   });
 
+  if (gradient_reuse)
+    cs_convection_diffusion_gradient_cache_invalidate(pvar);
+
   /* In the following, cs_balance_scalar is called with inc=1,
      except for Weight Matrix (nswrsp=-1) */
   inc = 1;
@@ -1703,20 +1740,29 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       /* ||E.dx^(k-1)-E.0||^2 */
       nadxkm1 = nadxk;
 
+      /* Dot products are reduced together */
+      cs_parall_deferred_sum dsum;
+
       /* ||E.dx^k-E.0||^2 */
-      nadxk = cs_gdot(n_cells, adxk, adxk);
+      dsum.add(cs_dot(n_cells, adxk, adxk), &nadxk);
 
       /* < E.dx^k-E.0; r^k > */
-      paxkrk = cs_gdot(n_cells, smbrp, adxk);
+      dsum.add(cs_dot(n_cells, smbrp, adxk), &paxkrk);
 
-      /* Relaxation with respect to dx^k and dx^(k-1) */
       if (iswdyp >= 2) {
 
         /* < E.dx^(k-1)-E.0; r^k > */
-        paxm1rk = cs_gdot(n_cells, smbrp, adxkm1);
+        dsum.add(cs_dot(n_cells, smbrp, adxkm1), &paxm1rk);
 
         /* < E.dx^(k-1)-E.0; E.dx^k-E.0 > */
-        paxm1ax = cs_gdot(n_cells, adxk, adxkm1);
+        dsum.add(cs_dot(n_cells, adxk, adxkm1), &paxm1ax);
+
+      }
+
+      dsum.flush();
+
+      /* Relaxation with respect to dx^k and dx^(k-1) */
+      if (iswdyp >= 2) {
 
         if (   nadxkm1 > 1e-30*rnorm2
             && (nadxk*nadxkm1-pow(paxm1ax,2)) > 1e-30*rnorm2)
@@ -1795,6 +1841,15 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
     ctx.wait();
 
+    if (gradient_reuse) {
+      bool updated = false;
+      if (iswdyp <= 0 && gradient_update_tol >= 0.)
+        updated = cs_convection_diffusion_gradient_cache_update
+                    (pvar, dpvar, gradient_update_tol);
+      if (updated == false)
+        cs_convection_diffusion_gradient_cache_invalidate(pvar);
+    }
+
     /*  ---> Handle parallelism and periodicity */
     if (cs_glob_rank_id >= 0 || m->n_init_perio > 0) {
       cs_mesh_sync_var_scal(pvar);
@@ -2053,6 +2108,9 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   cs_sles_free_native(f_id, var_name);
 
+  if (gradient_reuse)
+    cs_convection_diffusion_gradient_cache_end();
+
   ctx.wait();
 
   /*  Free memory */
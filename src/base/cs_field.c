@@ -119,6 +119,9 @@ BEGIN_C_DECLS
   \var  cs_field_t::dim
         Field dimension (usually 1 for scalar, 3 for vector, or 6 for
         symmetric tensor)
+  \var  cs_field_t::interleaved
+        true if values of multidimensional fields are interleaved
+        (default), false if they are stored by component
   \var  cs_field_t::location_id
         Id of matching mesh location
   \var  cs_field_t::n_time_vals
@@ -148,6 +151,10 @@ BEGIN_C_DECLS
 
 #define _CS_FIELD_S_ALLOC_SIZE       16
 
+/* Maximum number of time values per field */
+
+#define _CS_FIELD_N_TIME_VALS_MAX     3
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -227,6 +234,11 @@ static int _k_label = -1;
 
 static cs_field_key_val_t  *_key_vals = NULL;
 
+/* Host/device residency of values:
+   _residency[field_id*_CS_FIELD_N_TIME_VALS_MAX + time_id] */
+
+static unsigned char  *_residency = NULL;
+
 /* Names for logging */
 
 static const int _n_type_flags = 8;
@@ -451,6 +463,9 @@ _field_create(const char   *name,
       _n_fields_max *= 2;
     BFT_REALLOC(_fields, _n_fields_max, cs_field_t *);
     BFT_REALLOC(_key_vals, _n_keys_max*_n_fields_max, cs_field_key_val_t);
+    BFT_REALLOC(_residency,
+                _n_fields_max*_CS_FIELD_N_TIME_VALS_MAX,
+                unsigned char);
   }
 
   /* Allocate fields descriptor block if necessary
@@ -487,6 +502,7 @@ _field_create(const char   *name,
   f->id = field_id;
   f->type = type_flag;
   f->dim = dim;
+  f->interleaved = true;
   f->location_id = location_id;
   f->n_time_vals = 1;
 
@@ -500,6 +516,10 @@ _field_create(const char   *name,
 
   f->is_owner = true;
 
+  for (int t_id = 0; t_id < _CS_FIELD_N_TIME_VALS_MAX; t_id++)
+    _residency[field_id*_CS_FIELD_N_TIME_VALS_MAX + t_id]
+      = CS_FIELD_VALID_HOST;
+
   /* Mark key values as not set */
 
   for (key_id = 0; key_id < _n_keys_max; key_id++) {
@@ -547,6 +567,20 @@ _add_val(cs_lnum_t   n_elts,
   return val;
 }
 
+/*----------------------------------------------------------------------------
+ * Mark all values of a field as residing on the host only.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_reset_residency(const cs_field_t  *f)
+{
+  for (int t_id = 0; t_id < _CS_FIELD_N_TIME_VALS_MAX; t_id++)
+    _residency[f->id*_CS_FIELD_N_TIME_VALS_MAX + t_id] = CS_FIELD_VALID_HOST;
+}
+
 /*----------------------------------------------------------------------------
  * Find an id matching a key or define a new key and associated id.
  *
@@ -1794,8 +1828,10 @@ cs_field_set_n_time_vals(cs_field_t  *f,
   f->n_time_vals = _n_time_vals;
 
   BFT_REALLOC(f->vals, f->n_time_vals, cs_real_t *);
-  for (int i = n_time_vals_ini; i < f->n_time_vals; i++)
+  for (int i = n_time_vals_ini; i < f->n_time_vals; i++) {
     f->vals[i] = NULL;
+    _residency[f->id*_CS_FIELD_N_TIME_VALS_MAX + i] = CS_FIELD_VALID_HOST;
+  }
 
   /* If allocation or mapping has already been done */
 
@@ -1816,6 +1852,111 @@ cs_field_set_n_time_vals(cs_field_t  *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the storage layout of a multidimensional field's values.
+ *
+ * By default, values are interleaved (all components of a given element
+ * are contiguous). Non-interleaved values are stored by component, each
+ * component block covering all elements of the location including ghosts,
+ * so component j of element i is val[j*n_elts + i], with n_elts the 3rd
+ * value returned by \ref cs_mesh_location_get_n_elts.
+ *
+ * Kernels may access either layout without copies through the views
+ * defined in cs_field_view.h. Halo synchronization, postprocessing output
+ * and checkpoint/restart handle both layouts, but gradient and solver
+ * operators require interleaved values, so solved variables may not
+ * use the non-interleaved layout.
+ *
+ * This must be called before values are allocated or mapped.
+ *
+ * \param[in, out]  f            pointer to field structure
+ * \param[in]       interleaved  true for interleaved values, false for
+ *                               values stored by component
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_interleaved(cs_field_t  *f,
+                         bool         interleaved)
+{
+  assert(f != NULL);
+
+  if (f->val != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: values of field \"%s\" are already allocated or mapped,\n"
+                "so their layout may not be changed."),
+              __func__, f->name);
+
+  if ((f->type & CS_FIELD_VARIABLE) && interleaved == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: field \"%s\" is a solved variable,\n"
+                "whose values must be interleaved."),
+              __func__, f->name);
+
+  f->interleaved = (f->dim > 1) ? interleaved : true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Convert values of a field between its own layout and an
+ *         interleaved layout.
+ *
+ * Values are defined on all elements of the field's location, including
+ * ghosts. If src and dest are identical, conversion is done in place
+ * (using a temporary copy). For interleaved fields, values are simply
+ * copied if src and dest differ.
+ *
+ * \param[in]   f           pointer to field structure
+ * \param[in]   interleave  true to convert from field layout to interleaved,
+ *                          false to convert from interleaved to field layout
+ * \param[in]   src         source values
+ * \param[out]  dest        converted values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_interleave_values(const cs_field_t  *f,
+                           bool               interleave,
+                           const cs_real_t    src[],
+                           cs_real_t          dest[])
+{
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(f->location_id)[2];
+  const cs_lnum_t dim = f->dim;
+
+  if (f->interleaved) {
+    if (src != dest)
+      memcpy(dest, src, n_elts*dim*sizeof(cs_real_t));
+    return;
+  }
+
+  const cs_real_t *_src = src;
+  cs_real_t *tmp = NULL;
+
+  if (src == dest) {
+    BFT_MALLOC(tmp, n_elts*dim, cs_real_t);
+    memcpy(tmp, src, n_elts*dim*sizeof(cs_real_t));
+    _src = tmp;
+  }
+
+  if (interleave) {
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      for (cs_lnum_t j = 0; j < dim; j++)
+        dest[i*dim + j] = _src[j*n_elts + i];
+    }
+  }
+  else {
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      for (cs_lnum_t j = 0; j < dim; j++)
+        dest[j*n_elts + i] = _src[i*dim + j];
+    }
+  }
+
+  BFT_FREE(tmp);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate arrays for field values.
@@ -1842,6 +1983,8 @@ cs_field_allocate_values(cs_field_t  *f)
     f->val = f->vals[0];
     if (f->n_time_vals > 1)
       f->val_pre = f->vals[1];
+
+    _reset_residency(f);
   }
 }
 
@@ -1879,6 +2022,8 @@ cs_field_map_values(cs_field_t   *f,
     f->val_pre = val_pre;
     f->vals[1] = val_pre;
   }
+
+  _reset_residency(f);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2321,6 +2466,13 @@ cs_field_current_to_previous(cs_field_t  *f)
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
     const cs_lnum_t _n_elts = n_elts[2];
 
+    /* Values are shifted on the host */
+
+    for (int kk = 0; kk < f->n_time_vals - 1; kk++)
+      cs_field_get_host_values(f, kk, false);
+    for (int kk = 1; kk < f->n_time_vals; kk++)
+      cs_field_set_residency(f, kk, CS_FIELD_VALID_HOST);
+
 #   pragma omp parallel if (_n_elts > CS_THR_MIN)
     {
       const int dim = f->dim;
@@ -2363,6 +2515,192 @@ cs_field_current_to_previous(cs_field_t  *f)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return flags indicating where up-to-date values of a field reside.
+ *
+ * \param[in]  f     pointer to field structure
+ * \param[in]  t_id  time id (0 for current, 1 for previous, ...)
+ *
+ * \return  combination of \ref CS_FIELD_VALID_HOST and
+ *          \ref CS_FIELD_VALID_DEVICE
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_field_get_residency(const cs_field_t  *f,
+                       int                t_id)
+{
+  assert(f != NULL && t_id < f->n_time_vals);
+
+  return _residency[f->id*_CS_FIELD_N_TIME_VALS_MAX + t_id];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate where up-to-date values of a field reside.
+ *
+ * This should be called by code modifying values through a pointer
+ * not obtained with \ref cs_field_get_host_values or
+ * \ref cs_field_get_device_values.
+ *
+ * \param[in]  f          pointer to field structure
+ * \param[in]  t_id       time id (0 for current, 1 for previous, ...)
+ * \param[in]  residency  combination of \ref CS_FIELD_VALID_HOST and
+ *                        \ref CS_FIELD_VALID_DEVICE
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_residency(const cs_field_t  *f,
+                       int                t_id,
+                       int                residency)
+{
+  assert(f != NULL && t_id < f->n_time_vals);
+  assert(residency & (CS_FIELD_VALID_HOST | CS_FIELD_VALID_DEVICE));
+
+  _residency[f->id*_CS_FIELD_N_TIME_VALS_MAX + t_id]
+    = residency & (CS_FIELD_VALID_HOST | CS_FIELD_VALID_DEVICE);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to up-to-date field values on the host.
+ *
+ * Values are synchronized from the device only if the host copy is
+ * out of date. With write access, the device copy is then considered
+ * out of date.
+ *
+ * \param[in]  f      pointer to field structure
+ * \param[in]  t_id   time id (0 for current, 1 for previous, ...)
+ * \param[in]  write  true if values will be modified
+ *
+ * \return  pointer to host values
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_field_get_host_values(const cs_field_t  *f,
+                         int                t_id,
+                         bool               write)
+{
+  assert(f != NULL && t_id < f->n_time_vals);
+
+  cs_real_t *val = f->vals[t_id];
+  unsigned char *r = _residency + f->id*_CS_FIELD_N_TIME_VALS_MAX + t_id;
+
+  if (val == NULL)
+    return val;
+
+  if (!(*r & CS_FIELD_VALID_HOST)) {
+    cs_alloc_mode_t mode = cs_check_device_ptr(val);
+    if (mode != CS_ALLOC_HOST && mode != CS_ALLOC_DEVICE)
+      cs_sync_d2h(val);
+    *r |= CS_FIELD_VALID_HOST;
+  }
+
+  if (write)
+    *r = CS_FIELD_VALID_HOST;
+
+  return val;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to up-to-date field values on the device.
+ *
+ * Values are synchronized from the host only if the device copy is
+ * out of date. With write access, the host copy is then considered
+ * out of date. For values allocated on the host only, the host pointer
+ * is returned.
+ *
+ * \param[in]  f      pointer to field structure
+ * \param[in]  t_id   time id (0 for current, 1 for previous, ...)
+ * \param[in]  write  true if values will be modified
+ *
+ * \return  pointer to device values
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_field_get_device_values(const cs_field_t  *f,
+                           int                t_id,
+                           bool               write)
+{
+  assert(f != NULL && t_id < f->n_time_vals);
+
+  cs_real_t *val = f->vals[t_id];
+  unsigned char *r = _residency + f->id*_CS_FIELD_N_TIME_VALS_MAX + t_id;
+
+  if (val == NULL)
+    return val;
+
+  if (cs_check_device_ptr(val) == CS_ALLOC_HOST)
+    return val;
+
+  if (!(*r & CS_FIELD_VALID_DEVICE)) {
+    cs_sync_h2d(val);
+    *r |= CS_FIELD_VALID_DEVICE;
+  }
+
+  if (write)
+    *r = CS_FIELD_VALID_DEVICE;
+
+  return (cs_real_t *)cs_get_device_ptr(val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start transfer of field values to the device if the device copy
+ *        is out of date.
+ *
+ * The transfer is asynchronous when the allocation mode allows it,
+ * so this may be called ahead of the computation stage using the values.
+ *
+ * \param[in]  f     pointer to field structure, or NULL
+ * \param[in]  t_id  time id (0 for current, 1 for previous, ...)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_prefetch_device(const cs_field_t  *f,
+                         int                t_id)
+{
+  if (f == NULL || t_id >= f->n_time_vals)
+    return;
+
+  cs_real_t *val = f->vals[t_id];
+  unsigned char *r = _residency + f->id*_CS_FIELD_N_TIME_VALS_MAX + t_id;
+
+  if (val == NULL || (*r & CS_FIELD_VALID_DEVICE))
+    return;
+
+  if (cs_check_device_ptr(val) == CS_ALLOC_HOST)
+    return;
+
+  cs_sync_h2d(val);
+  *r |= CS_FIELD_VALID_DEVICE;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Ensure host values of all fields are up to date.
+ *
+ * This is intended to be called before host-only operations on all fields,
+ * such as postprocessing or checkpoint output.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_host_all(void)
+{
+  for (int i = 0; i < _n_fields; i++) {
+    const cs_field_t  *f = _fields[i];
+    for (int t_id = 0; t_id < f->n_time_vals; t_id++)
+      cs_field_get_host_values(f, t_id, false);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy all defined fields.
@@ -2414,6 +2752,7 @@ cs_field_destroy_all(void)
   _cs_field_free_struct();
 
   BFT_FREE(_key_vals);
+  BFT_FREE(_residency);
 
   _n_fields = 0;
   _n_fields_max = 0;
@@ -79,6 +79,20 @@ BEGIN_C_DECLS
 
 /*! @} */
 
+/*!
+ * @defgroup field_residency Flags specifying where valid field values reside
+ *
+ * @{
+ */
+
+/*! host copy of values is up to date */
+#define CS_FIELD_VALID_HOST          (1 << 0)
+
+/*! device copy of values is up to date */
+#define CS_FIELD_VALID_DEVICE        (1 << 1)
+
+/*! @} */
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -137,6 +151,10 @@ typedef struct {
 
   int                     dim;          /* Field dimension */
 
+  bool                    interleaved;  /* Values interleaved by element
+                                           (default), or stored by
+                                           component if false */
+
   int                     location_id;  /* Id of matching location */
 
   int                     n_time_vals;  /* Number of time values */
@@ -327,6 +345,50 @@ void
 cs_field_set_n_time_vals(cs_field_t  *f,
                          int          n_time_vals);
 
+/*----------------------------------------------------------------------------
+ * Set the storage layout of a multidimensional field's values.
+ *
+ * By default, values are interleaved (all components of a given element
+ * are contiguous). Non-interleaved values are stored by component, each
+ * component block covering all elements of the location including ghosts,
+ * so component j of element i is val[j*n_elts + i], with n_elts the 3rd
+ * value returned by cs_mesh_location_get_n_elts().
+ *
+ * This must be called before values are allocated or mapped.
+ *
+ * parameters:
+ *   f           <-> pointer to field structure
+ *   interleaved <-- true for interleaved values, false for values
+ *                   stored by component
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_interleaved(cs_field_t  *f,
+                         bool         interleaved);
+
+/*----------------------------------------------------------------------------
+ * Convert values of a field between its own layout and an interleaved
+ * layout.
+ *
+ * Values are defined on all elements of the field's location, including
+ * ghosts. If src and dest are identical, conversion is done in place
+ * (using a temporary copy). For interleaved fields, values are simply
+ * copied if src and dest differ.
+ *
+ * parameters:
+ *   f          <-- pointer to field structure
+ *   interleave <-- true to convert from field layout to interleaved,
+ *                  false to convert from interleaved to field layout
+ *   src        <-- source values
+ *   dest       --> converted values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_interleave_values(const cs_field_t  *f,
+                           bool               interleave,
+                           const cs_real_t    src[],
+                           cs_real_t          dest[]);
+
 /*----------------------------------------------------------------------------
  * Allocate arrays for field values.
  *
@@ -437,6 +499,109 @@ cs_field_set_values(cs_field_t  *f,
 void
 cs_field_current_to_previous(cs_field_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Return flags indicating where up-to-date values of a field reside.
+ *
+ * parameters:
+ *   f    <-- pointer to field structure
+ *   t_id <-- time id (0 for current, 1 for previous, ...)
+ *
+ * returns:
+ *   combination of CS_FIELD_VALID_HOST and CS_FIELD_VALID_DEVICE
+ *----------------------------------------------------------------------------*/
+
+int
+cs_field_get_residency(const cs_field_t  *f,
+                       int                t_id);
+
+/*----------------------------------------------------------------------------
+ * Indicate where up-to-date values of a field reside.
+ *
+ * This should be called by code modifying values through a pointer
+ * not obtained with cs_field_get_host_values or
+ * cs_field_get_device_values.
+ *
+ * parameters:
+ *   f         <-- pointer to field structure
+ *   t_id      <-- time id (0 for current, 1 for previous, ...)
+ *   residency <-- combination of CS_FIELD_VALID_HOST and
+ *                 CS_FIELD_VALID_DEVICE
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_residency(const cs_field_t  *f,
+                       int                t_id,
+                       int                residency);
+
+/*----------------------------------------------------------------------------
+ * Return pointer to up-to-date field values on the host.
+ *
+ * Values are synchronized from the device only if the host copy is
+ * out of date. With write access, the device copy is then considered
+ * out of date.
+ *
+ * parameters:
+ *   f     <-- pointer to field structure
+ *   t_id  <-- time id (0 for current, 1 for previous, ...)
+ *   write <-- true if values will be modified
+ *
+ * returns:
+ *   pointer to host values
+ *----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_field_get_host_values(const cs_field_t  *f,
+                         int                t_id,
+                         bool               write);
+
+/*----------------------------------------------------------------------------
+ * Return pointer to up-to-date field values on the device.
+ *
+ * Values are synchronized from the host only if the device copy is
+ * out of date. With write access, the host copy is then considered
+ * out of date. For values allocated on the host only, the host pointer
+ * is returned.
+ *
+ * parameters:
+ *   f     <-- pointer to field structure
+ *   t_id  <-- time id (0 for current, 1 for previous, ...)
+ *   write <-- true if values will be modified
+ *
+ * returns:
+ *   pointer to device values
+ *----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_field_get_device_values(const cs_field_t  *f,
+                           int                t_id,
+                           bool               write);
+
+/*----------------------------------------------------------------------------
+ * Start transfer of field values to the device if the device copy
+ * is out of date.
+ *
+ * The transfer is asynchronous when the allocation mode allows it,
+ * so this may be called ahead of the computation stage using the values.
+ *
+ * parameters:
+ *   f    <-- pointer to field structure, or NULL
+ *   t_id <-- time id (0 for current, 1 for previous, ...)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_prefetch_device(const cs_field_t  *f,
+                         int                t_id);
+
+/*----------------------------------------------------------------------------
+ * Ensure host values of all fields are up to date.
+ *
+ * This is intended to be called before host-only operations on all fields,
+ * such as postprocessing or checkpoint output.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_host_all(void);
+
 /*----------------------------------------------------------------------------
  * Destroy all defined fields.
  *----------------------------------------------------------------------------*/
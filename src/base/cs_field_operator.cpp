@@ -138,6 +138,44 @@ cs_f_field_set_volume_average(int       f_id,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Apply rotation periodicity to values of a multidimensional field whose
+ * values are stored by component, using a temporary interleaved copy.
+ *
+ * parameters:
+ *   f         <-> pointer to field
+ *   halo      <-- pointer to halo structure
+ *   halo_type <-- halo type
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_perio_sync_non_interleaved(cs_field_t       *f,
+                                  const cs_halo_t  *halo,
+                                  cs_halo_type_t    halo_type)
+{
+  if (   cs_glob_mesh->have_rotation_perio == 0
+      || (f->dim != 3 && f->dim != 6 && f->dim != 9))
+    return;
+
+  cs_field_interleave_values(f, true, f->val, f->val);
+
+  switch(f->dim) {
+  case 9:
+    cs_halo_perio_sync_var_tens(halo, halo_type, f->val);
+    break;
+  case 6:
+    cs_halo_perio_sync_var_sym_tens(halo, halo_type, f->val);
+    break;
+  case 3:
+    cs_halo_perio_sync_var_vect(halo, halo_type, f->val, 3);
+    break;
+  default:
+    break;
+  }
+
+  cs_field_interleave_values(f, false, f->val, f->val);
+}
+
 /*----------------------------------------------------------------------------
  * Interpolate field values at a given set of points using P0 interpolation.
  *
@@ -156,12 +194,20 @@ _field_interpolate_by_mean(const cs_field_t   *f,
                            const cs_lnum_t     point_location[],
                            cs_real_t          *val)
 {
+  /* Element and component strides of field values */
+
+  cs_lnum_t e_stride = f->dim, c_stride = 1;
+  if (f->interleaved == false) {
+    e_stride = 1;
+    c_stride = cs_mesh_location_get_n_elts(f->location_id)[2];
+  }
+
   for (cs_lnum_t i = 0; i < n_points; i++) {
 
     cs_lnum_t cell_id = point_location[i];
 
     for (cs_lnum_t j = 0; j < f->dim; j++)
-      val[i*f->dim + j] =  f->val[cell_id*f->dim + j];
+      val[i*f->dim + j] =  f->val[cell_id*e_stride + j*c_stride];
 
   }
 }
@@ -199,6 +245,11 @@ _field_interpolate_by_gradient(const cs_field_t   *f,
               _("Field gradient interpolation for field %s :\n"
                 " not implemented for fields on location %s."),
               f->name, cs_mesh_location_type_name[f->location_id]);
+  else if (f->interleaved == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field gradient interpolation for field %s :\n"
+                " not implemented for non-interleaved values."),
+              f->name);
 
   /* Compute field cell gradient */
 
@@ -1524,6 +1575,19 @@ cs_field_synchronize(cs_field_t      *f,
       if (f->dim == 1)
         cs_halo_sync_var(halo, halo_type, f->val);
 
+      else if (f->interleaved == false) {
+
+        /* Components stored separately (including ghost values) */
+
+        const cs_lnum_t n_cols = cs_glob_mesh->n_cells_with_ghosts;
+        for (int j = 0; j < f->dim; j++)
+          cs_halo_sync_var(halo, halo_type, f->val + j*n_cols);
+
+        if (cs_glob_mesh->n_init_perio > 0)
+          _field_perio_sync_non_interleaved(f, halo, halo_type);
+
+      }
+
       else {
 
         cs_halo_sync_var_strided(halo, halo_type, f->val, f->dim);
@@ -1552,6 +1616,96 @@ cs_field_synchronize(cs_field_t      *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize current parallel and periodic values of several fields.
+ *
+ * Values of all fields based on CS_MESH_LOCATION_CELLS are exchanged
+ * together, so that a single message is used with each neighboring rank;
+ * fields based on other locations are ignored, as in
+ * \ref cs_field_synchronize.
+ *
+ * \param[in]       n_fields    number of fields
+ * \param[in, out]  fields      pointers to fields
+ * \param[in]       halo_type   halo type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_synchronize_multi(int              n_fields,
+                           cs_field_t      *fields[],
+                           cs_halo_type_t   halo_type)
+{
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+
+  if (halo == NULL)
+    return;
+
+  /* Fields stored by component are synchronized component by component */
+
+  int n_vars_max = 0;
+  for (int i = 0; i < n_fields; i++)
+    n_vars_max += (fields[i]->interleaved) ? 1 : fields[i]->dim;
+
+  int n_vars = 0;
+  int *stride;
+  cs_real_t **var;
+  BFT_MALLOC(stride, n_vars_max, int);
+  BFT_MALLOC(var, n_vars_max, cs_real_t *);
+
+  const cs_lnum_t n_cols = cs_glob_mesh->n_cells_with_ghosts;
+
+  for (int i = 0; i < n_fields; i++) {
+    cs_field_t *f = fields[i];
+    if (f->location_id != CS_MESH_LOCATION_CELLS)
+      continue;
+    if (f->interleaved) {
+      stride[n_vars] = f->dim;
+      var[n_vars] = f->val;
+      n_vars++;
+    }
+    else {
+      for (int j = 0; j < f->dim; j++) {
+        stride[n_vars] = 1;
+        var[n_vars] = f->val + j*n_cols;
+        n_vars++;
+      }
+    }
+  }
+
+  cs_halo_sync_multi(halo, halo_type, n_vars, stride, var);
+
+  BFT_FREE(var);
+  BFT_FREE(stride);
+
+  /* Rotation periodicity is applied field by field */
+
+  if (cs_glob_mesh->n_init_perio > 0) {
+    for (int i = 0; i < n_fields; i++) {
+      cs_field_t *f = fields[i];
+      if (f->location_id != CS_MESH_LOCATION_CELLS)
+        continue;
+      if (f->interleaved == false) {
+        _field_perio_sync_non_interleaved(f, halo, halo_type);
+        continue;
+      }
+      switch(f->dim) {
+      case 9:
+        cs_halo_perio_sync_var_tens(halo, halo_type, f->val);
+        break;
+      case 6:
+        cs_halo_perio_sync_var_sym_tens(halo, halo_type, f->val);
+        break;
+      case 3:
+        cs_halo_perio_sync_var_vect(halo, halo_type, f->val, 3);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
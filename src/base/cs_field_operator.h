@@ -281,6 +281,26 @@ void
 cs_field_synchronize(cs_field_t      *f,
                      cs_halo_type_t   halo_type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize current parallel and periodic values of several fields.
+ *
+ * Values of all fields based on CS_MESH_LOCATION_CELLS are exchanged
+ * together, so that a single message is used with each neighboring rank;
+ * fields based on other locations are ignored, as in
+ * \ref cs_field_synchronize.
+ *
+ * \param[in]       n_fields    number of fields
+ * \param[in, out]  fields      pointers to fields
+ * \param[in]       halo_type   halo type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_synchronize_multi(int              n_fields,
+                           cs_field_t      *fields[],
+                           cs_halo_type_t   halo_type);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
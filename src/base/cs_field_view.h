@@ -0,0 +1,194 @@
+#ifndef __CS_FIELD_VIEW_H__
+#define __CS_FIELD_VIEW_H__
+
+/*============================================================================
+ * Layout-independent views on field values.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_field.h"
+#include "cs_mesh_location.h"
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(__cplusplus)
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Storage layout of multidimensional values */
+
+typedef enum {
+
+  CS_LAYOUT_INTERLEAVED,      /*!< components of an element are contiguous
+                                   (array of structures) */
+  CS_LAYOUT_NON_INTERLEAVED   /*!< values of a component are contiguous
+                                   (structure of arrays) */
+
+} cs_layout_t;
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Zero-copy strided view on multidimensional values.
+ *
+ * The layout and dimension are template parameters, so that kernels
+ * templated on the view type are compiled with constant strides for
+ * each layout. For non-interleaved values, the component stride is the
+ * number of allocated elements.
+ *
+ * \tparam  L    storage layout
+ * \tparam  Dim  number of components
+ * \tparam  T    value type
+ */
+/*----------------------------------------------------------------------------*/
+
+template <cs_layout_t L, int Dim, typename T = cs_real_t>
+class cs_strided_view {
+
+public:
+
+  static constexpr cs_layout_t layout = L;
+  static constexpr int         dim = Dim;
+
+  /*--------------------------------------------------------------------------*/
+  /*!
+   * \brief Constructor.
+   *
+   * \param[in]  vals     pointer to values
+   * \param[in]  n_alloc  number of allocated elements
+   */
+  /*--------------------------------------------------------------------------*/
+
+  CS_F_HOST_DEVICE
+  cs_strided_view(T          *vals,
+                  cs_lnum_t   n_alloc)
+    : _vals(vals), _n_alloc(n_alloc)
+  {
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*!
+   * \brief Access to a given component of a given element.
+   *
+   * \param[in]  i  element id
+   * \param[in]  j  component id
+   *
+   * \return  reference to matching value
+   */
+  /*--------------------------------------------------------------------------*/
+
+  CS_F_HOST_DEVICE inline T &
+  operator()(cs_lnum_t  i,
+             int        j) const
+  {
+    return (L == CS_LAYOUT_INTERLEAVED) ?
+      _vals[i*Dim + j] : _vals[j*_n_alloc + i];
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*!
+   * \brief Return pointer to values.
+   */
+  /*--------------------------------------------------------------------------*/
+
+  CS_F_HOST_DEVICE inline T *
+  data() const
+  {
+    return _vals;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*!
+   * \brief Return number of allocated elements.
+   */
+  /*--------------------------------------------------------------------------*/
+
+  CS_F_HOST_DEVICE inline cs_lnum_t
+  n_alloc() const
+  {
+    return _n_alloc;
+  }
+
+private:
+
+  T          *_vals;     /* pointer to values */
+  cs_lnum_t   _n_alloc;  /* number of allocated elements */
+
+};
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call a function with a view matching a field's values layout.
+ *
+ * The function (usually a generic lambda) is instantiated for both
+ * layouts, and called with the view matching the field's layout, so
+ * that no temporary transposition of values is needed.
+ *
+ * \tparam  Dim  field dimension
+ *
+ * \param[in, out]  f     pointer to field
+ * \param[in]       t_id  time id (0 for current, 1 for previous, ...)
+ * \param[in]       func  function called with the matching view
+ */
+/*----------------------------------------------------------------------------*/
+
+template <int Dim, typename F>
+void
+cs_field_view_apply(const cs_field_t  *f,
+                    int                t_id,
+                    F                &&func)
+{
+  assert(f->dim == Dim && t_id < f->n_time_vals);
+
+  const cs_lnum_t n_alloc = cs_mesh_location_get_n_elts(f->location_id)[2];
+
+  if (f->interleaved)
+    func(cs_strided_view<CS_LAYOUT_INTERLEAVED, Dim>(f->vals[t_id],
+                                                     n_alloc));
+  else
+    func(cs_strided_view<CS_LAYOUT_NON_INTERLEAVED, Dim>(f->vals[t_id],
+                                                         n_alloc));
+}
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* defined(__cplusplus) */
+
+#endif /* __CS_FIELD_VIEW_H__ */
@@ -69,6 +69,13 @@
 #include <dirent.h>
 #endif
 
+#if    defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) \
+    && defined(HAVE_FCNTL_H) && defined(HAVE_UNISTD_H)
+#define _CS_FILE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
@@ -214,6 +221,8 @@ struct _cs_file_t {
   MPI_File           fh;           /* MPI file handle */
   MPI_Info           info;         /* MPI file info */
   MPI_Offset         offset;       /* MPI file offset */
+  cs_file_off_t      stripe_size;  /* File system stripe size for aligned
+                                      writes, or 0 */
 #else
   cs_file_off_t      offset;       /* File offset */
 #endif
@@ -222,6 +231,12 @@ struct _cs_file_t {
   size_t             in_mem_max_size; /* Max size in memory */
   unsigned char     *in_mem_data;     /* Data in memory */
 
+  bool               use_map;      /* Use memory-mapped reads
+                                      (same value on all ranks) */
+  size_t             map_size;     /* Size of mapped file */
+  size_t             map_pos;      /* Position in mapped file */
+  unsigned char     *map_data;     /* Memory-mapped file data */
+
 };
 
 /* Associated typedef documentation (for cs_file.h) */
@@ -304,6 +319,10 @@ static cs_file_mpi_positioning_t
 static cs_file_access_t _default_access_r = CS_FILE_DEFAULT;
 static cs_file_access_t _default_access_w = CS_FILE_DEFAULT;
 
+/* Use memory-mapped reads for standard C IO when possible */
+
+static bool _default_mmap_r = false;
+
 /* Communicator and hints used for file operations */
 
 #if defined(HAVE_MPI)
@@ -315,6 +334,9 @@ static MPI_Comm _mpi_io_comm = MPI_COMM_NULL;
 static MPI_Info _mpi_io_hints_r = MPI_INFO_NULL;
 static MPI_Info _mpi_io_hints_w = MPI_INFO_NULL;
 
+static int      _mpi_aggregators_per_node = 0;
+static bool     _mpi_stripe_align = false;
+
 #endif
 
 #if defined(HAVE_ZLIB)
@@ -573,6 +595,66 @@ _swap_endian(void        *dest,
     memcpy(dest, src, ni);
 }
 
+#if defined(_CS_FILE_MMAP)
+
+/*----------------------------------------------------------------------------
+ * Map a file to memory for reading.
+ *
+ * parameters:
+ *   f    <-- pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_map(cs_file_t  *f)
+{
+  int retval = 0;
+  struct stat s;
+
+  assert(f->mode == CS_FILE_MODE_READ);
+
+  int fd = open(f->name, O_RDONLY);
+
+  if (fd < 0 || fstat(fd, &s) != 0) {
+    retval = errno;
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening file \"%s\":\n\n"
+                "  %s"), f->name, strerror(errno));
+    if (fd > -1)
+      close(fd);
+    return retval;
+  }
+
+  f->map_size = s.st_size;
+  f->map_pos = 0;
+
+  /* Empty files can not be mapped, but are still considered open */
+
+  if (f->map_size > 0) {
+    void *p = mmap(nullptr, f->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+      retval = errno;
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error mapping file \"%s\" to memory:\n\n"
+                  "  %s"), f->name, strerror(errno));
+    }
+    else {
+      f->map_data = (unsigned char *)p;
+#if defined(HAVE_MADVISE)
+      madvise(p, f->map_size, MADV_SEQUENTIAL);
+#endif
+    }
+  }
+
+  close(fd);
+
+  return retval;
+}
+
+#endif /* defined(_CS_FILE_MMAP) */
+
 /*----------------------------------------------------------------------------
  * Open a file using standard C IO.
  *
@@ -590,9 +672,14 @@ _file_open(cs_file_t  *f)
 
   assert(f != nullptr);
 
-  if (f->sh != nullptr)
+  if (f->sh != nullptr || f->map_data != nullptr)
     return 0;
 
+#if defined(_CS_FILE_MMAP)
+  if (f->use_map)
+    return _file_map(f);
+#endif
+
   /* Compressed with gzip ? (currently for reading only) */
 
 #if defined(HAVE_ZLIB)
@@ -674,6 +761,16 @@ _file_close(cs_file_t  *f)
   if (f->sh != nullptr)
     retval = fclose(f->sh);
 
+#if defined(_CS_FILE_MMAP)
+
+  else if (f->map_data != nullptr) {
+    retval = munmap(f->map_data, f->map_size);
+    f->map_data = nullptr;
+    f->map_size = 0;
+  }
+
+#endif
+
   /* Compressed with gzip ? (currently for reading only) */
 
 #if defined(HAVE_ZLIB)
@@ -754,6 +851,49 @@ _file_read_in_memory(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Read data to a buffer from a memory-mapped file.
+ *
+ * parameters:
+ *   f    <-- cs_file_t descriptor
+ *   buf  --> pointer to location receiving data
+ *   size <-- size of each item of data in bytes
+ *   ni   <-- number of items to read
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_read_mapped(cs_file_t  *f,
+                  void       *buf,
+                  size_t      size,
+                  size_t      ni)
+{
+  size_t retval = 0;
+
+  size_t  nb = size*ni;
+
+  if (f->map_pos + nb > f->map_size) {
+    if (f->map_pos < f->map_size)
+      nb = ((f->map_size - f->map_pos) / size) * size;
+    else
+      nb = 0;
+    if (f->allow_eof == false)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Premature end of file \"%s\""), f->name);
+  }
+
+  if (nb > 0) {
+    memcpy(buf, f->map_data + f->map_pos, nb);
+    f->map_pos += nb;
+  }
+
+  retval = nb / size;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read data to a buffer using standard C IO.
  *
@@ -833,6 +973,11 @@ _file_read(cs_file_t  *f,
 
 #endif /* defined(HAVE_ZLIB) */
 
+  else if (f->use_map) {
+    retval = _file_read_mapped(f, buf, size, ni);
+    return retval;
+  }
+
   else if (f->method == CS_FILE_IN_MEMORY_SERIAL && f->rank == 0) {
     retval = _file_read_in_memory(f, buf, size, ni);
     return retval;
@@ -1021,6 +1166,24 @@ _file_seek(cs_file_t       *f,
 #endif /* SIZEOF_LONG */
   }
 
+  else if (f->use_map) {
+
+    cs_file_off_t pos = offset;
+    if (whence == CS_FILE_SEEK_CUR)
+      pos += (cs_file_off_t)(f->map_pos);
+    else if (whence == CS_FILE_SEEK_END)
+      pos += (cs_file_off_t)(f->map_size);
+
+    if (pos < 0) {
+      retval = -1;
+      bft_error(__FILE__, __LINE__, 0, _(err_fmt),
+                f->name, strerror(EINVAL));
+    }
+    else
+      f->map_pos = pos;
+
+  }
+
 #if defined(HAVE_ZLIB)
 
   else if (f->gzh != nullptr) {
@@ -1088,6 +1251,9 @@ _file_tell(cs_file_t  *f)
 
   }
 
+  else if (f->use_map)
+    offset = (cs_file_off_t)(f->map_pos);
+
   if (offset < 0)
     bft_error(__FILE__, __LINE__, 0,
               _("Error obtaining position in file \"%s\":\n\n  %s"),
@@ -1173,6 +1339,26 @@ _cs_file_gets(char             *s,
 
 #endif /* defined(HAVE_ZLIB) */
 
+  else if (f->use_map) {
+
+    /* Position is mutable even for a const file descriptor,
+       as with the stdio stream. */
+
+    cs_file_t *_f = (cs_file_t *)f;
+    size_t n = 0;
+
+    while (n + 1 < (size_t)size && _f->map_pos < _f->map_size) {
+      s[n] = _f->map_data[_f->map_pos++];
+      if (s[n++] == '\n')
+        break;
+    }
+    if (n > 0) {
+      s[n] = '\0';
+      retval = s;
+    }
+
+  }
+
   else {
     if (cs_glob_n_ranks > 1)
       bft_error(__FILE__, __LINE__, 0,
@@ -1209,7 +1395,11 @@ _cs_file_gets(char             *s,
 
   int is_eof = 0;
   if (allow_eof) {
-    if (feof(f->sh) != 0)
+    if (f->use_map) {
+      if (f->map_pos >= f->map_size)
+        is_eof = 1;
+    }
+    else if (feof(f->sh) != 0)
       is_eof = 1;
 
 #if defined(HAVE_ZLIB)
@@ -1432,7 +1622,7 @@ _file_read_block_p(cs_file_t  *f,
 
     cs_file_off_t offset = f->offset + ((global_num_start - 1) * size);
 
-    if (f->sh == nullptr)
+    if (f->sh == nullptr && f->map_data == nullptr)
       _file_open(f);
 
     if (_file_seek(f, offset, CS_FILE_SEEK_SET) == 0)
@@ -1944,6 +2134,181 @@ _mpi_io_error_message
               "Error type: %s"), file_name, buffer);
 }
 
+/*----------------------------------------------------------------------------
+ * Query the file system stripe size of a file opened using MPI IO.
+ *
+ * The "striping_unit" value of the info object actually used by MPI-IO
+ * is used if available; otherwise, the preferred block size of the file
+ * is used if it appears to correspond to a parallel file system
+ * (i.e. is at least 64 KiB). The result is identical on all ranks of
+ * the file's IO communicator.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_file_query_stripe_size(cs_file_t  *f)
+{
+  long long stripe_size = 0;
+
+  f->stripe_size = 0;
+
+  if (f->io_comm == MPI_COMM_NULL || f->fh == MPI_FILE_NULL)
+    return;
+
+  int io_rank = 0;
+  MPI_Comm_rank(f->io_comm, &io_rank);
+
+  if (io_rank == 0) {
+
+#if MPI_VERSION > 1
+    MPI_Info info_used;
+    if (MPI_File_get_info(f->fh, &info_used) == MPI_SUCCESS) {
+      int flag = 0;
+      char val[MPI_MAX_INFO_VAL + 1];
+      MPI_Info_get(info_used, "striping_unit", MPI_MAX_INFO_VAL, val, &flag);
+      if (flag) {
+        val[MPI_MAX_INFO_VAL] = '\0';
+        stripe_size = atoll(val);
+      }
+      MPI_Info_free(&info_used);
+    }
+#endif
+
+#if defined(HAVE_SYS_STAT_H)
+    if (stripe_size <= 0) {
+      struct stat s;
+      if (stat(f->name, &s) == 0 && s.st_blksize >= 65536)
+        stripe_size = s.st_blksize;
+    }
+#endif
+
+    if (stripe_size < 0)
+      stripe_size = 0;
+
+  }
+
+  MPI_Bcast(&stripe_size, 1, MPI_LONG_LONG, 0, f->io_comm);
+
+  f->stripe_size = stripe_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Redistribute data between IO ranks so that each rank's block starts
+ * on a file system stripe boundary.
+ *
+ * The first block keeps its start, and the last block keeps its end.
+ * As block starts are only moved forward by less than the stripe size,
+ * data is only sent to lower ranks, and each exchanged piece is smaller
+ * than the stripe size.
+ *
+ * Only ranks of the file's IO communicator should call this function
+ * (collectively).
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   buf              <-- pointer to local block data
+ *   size             <-- size of each item of data in bytes
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   byte_range       --> local start and past-the-end byte offsets
+ *                        relative to the file offset (0 to n-1 numbering)
+ *
+ * returns:
+ *   pointer to newly allocated aligned block data
+ *----------------------------------------------------------------------------*/
+
+static unsigned char *
+_stripe_align_blocks(cs_file_t   *f,
+                     const void  *buf,
+                     size_t       size,
+                     cs_gnum_t    global_num_start,
+                     cs_gnum_t    global_num_end,
+                     long long    byte_range[2])
+{
+  static const int tag = 's'+'t'+'r'+'i'+'p'+'e';
+
+  const long long stripe_size = f->stripe_size;
+  const long long base = f->offset;
+
+  int io_rank, n_io_ranks;
+  MPI_Comm_rank(f->io_comm, &io_rank);
+  MPI_Comm_size(f->io_comm, &n_io_ranks);
+
+  /* Original (b) and aligned (a) absolute byte ranges of all ranks */
+
+  long long l_range[2] = {base + (long long)((global_num_start-1)*size),
+                          base + (long long)((global_num_end-1)*size)};
+
+  long long *b_range, *a_start;
+  BFT_MALLOC(b_range, n_io_ranks*2, long long);
+  BFT_MALLOC(a_start, n_io_ranks + 1, long long);
+
+  MPI_Allgather(l_range, 2, MPI_LONG_LONG, b_range, 2, MPI_LONG_LONG,
+                f->io_comm);
+
+  const long long g_start = b_range[0];
+  const long long g_end = b_range[n_io_ranks*2 - 1];
+
+  a_start[0] = g_start;
+  for (int i = 1; i < n_io_ranks; i++) {
+    long long a = b_range[i*2];
+    a += (stripe_size - (a % stripe_size)) % stripe_size;
+    a_start[i] = CS_MIN(CS_MAX(a, a_start[i-1]), g_end);
+  }
+  a_start[n_io_ranks] = g_end;
+
+  long long a_range[2] = {a_start[io_rank], a_start[io_rank + 1]};
+
+  unsigned char *a_buf = nullptr;
+  BFT_MALLOC(a_buf, a_range[1] - a_range[0], unsigned char);
+
+  MPI_Request *request = nullptr;
+  BFT_MALLOC(request, n_io_ranks*2, MPI_Request);
+  int n_requests = 0;
+
+  for (int i = 0; i < n_io_ranks; i++) {
+
+    /* Part of the local original block in the aligned block of rank i */
+
+    long long s0 = CS_MAX(l_range[0], a_start[i]);
+    long long s1 = CS_MIN(l_range[1], a_start[i+1]);
+
+    if (s1 > s0) {
+      const unsigned char *src = (const unsigned char *)buf + s0 - l_range[0];
+      if (i == io_rank)
+        memcpy(a_buf + s0 - a_range[0], src, s1 - s0);
+      else
+        MPI_Isend(src, (int)(s1 - s0), MPI_BYTE, i, tag, f->io_comm,
+                  request + n_requests++);
+    }
+
+    /* Part of the original block of rank i in the local aligned block */
+
+    if (i != io_rank) {
+      long long r0 = CS_MAX(b_range[i*2], a_range[0]);
+      long long r1 = CS_MIN(b_range[i*2+1], a_range[1]);
+      if (r1 > r0)
+        MPI_Irecv(a_buf + r0 - a_range[0], (int)(r1 - r0), MPI_BYTE, i, tag,
+                  f->io_comm, request + n_requests++);
+    }
+
+  }
+
+  MPI_Waitall(n_requests, request, MPI_STATUSES_IGNORE);
+
+  BFT_FREE(request);
+  BFT_FREE(a_start);
+  BFT_FREE(b_range);
+
+  byte_range[0] = a_range[0] - base;
+  byte_range[1] = a_range[1] - base;
+
+  return a_buf;
+}
+
 /*----------------------------------------------------------------------------
  * Open a file using MPI IO.
  *
@@ -1999,6 +2364,11 @@ _mpi_file_open(cs_file_t       *f,
   if (retval != MPI_SUCCESS)
     _mpi_io_error_message(f->name, retval);
 
+  else if (   _mpi_stripe_align
+           && f->mode != CS_FILE_MODE_READ
+           && f->method > CS_FILE_MPI_INDEPENDENT)
+    _mpi_file_query_stripe_size(f);
+
   if (f->mode == CS_FILE_MODE_APPEND)
     f->offset = cs_file_tell(f);
 
@@ -2470,6 +2840,97 @@ _mpi_file_write_block_ip(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Write data to a file, each associated process providing a contiguous part
+ * of this data, after redistribution so that each IO rank's block starts
+ * on a file system stripe boundary.
+ *
+ * Each process should provide a (possibly empty) block of the data,
+ * and we should have:
+ *   global_num_start at rank 0 = 1
+ *   global_num_start at rank i+1 = global_num_end at rank i.
+ * Otherwise, behavior (especially positioning for future reads) is undefined.
+ *
+ * Explicit offsets are always used here, and data is written in chunks
+ * so that blocks larger than 2 GiB may be handled.
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   buf              <-- pointer to location containing data
+ *   size             <-- size of each item of data in bytes
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully written;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_mpi_file_write_block_aligned(cs_file_t  *f,
+                              void       *buf,
+                              size_t      size,
+                              cs_gnum_t   global_num_start,
+                              cs_gnum_t   global_num_end)
+{
+  size_t retval = 0;
+
+  if (f->io_comm == MPI_COMM_NULL)
+    return retval;
+
+  long long byte_range[2];
+  unsigned char *a_buf = _stripe_align_blocks(f,
+                                              buf,
+                                              size,
+                                              global_num_start,
+                                              global_num_end,
+                                              byte_range);
+
+  const int chunk_size = 1 << 20;
+  long long n_bytes = byte_range[1] - byte_range[0];
+  int count[2] = {(int)(n_bytes / chunk_size), (int)(n_bytes % chunk_size)};
+  MPI_Offset disp[2] = {f->offset + byte_range[0],
+                        f->offset + byte_range[0]
+                        + (MPI_Offset)count[0]*chunk_size};
+
+  MPI_Datatype ent_type[2] = {MPI_BYTE, MPI_BYTE};
+  MPI_Type_contiguous(chunk_size, MPI_BYTE, &(ent_type[0]));
+  MPI_Type_commit(&(ent_type[0]));
+
+  int errcode = MPI_SUCCESS;
+  long long n_written = 0;
+
+  if (f->method != CS_FILE_MPI_COLLECTIVE)
+    errcode = _mpi_file_ensure_isopen(f);
+
+  for (int i = 0; i < 2 && errcode == MPI_SUCCESS; i++) {
+    MPI_Status status;
+    int w_count = 0;
+    const unsigned char *w_buf = a_buf + (disp[i] - disp[0]);
+    if (f->method == CS_FILE_MPI_COLLECTIVE)
+      errcode = MPI_File_write_at_all(f->fh, disp[i], w_buf, count[i],
+                                      ent_type[i], &status);
+    else if (count[i] > 0)
+      errcode = MPI_File_write_at(f->fh, disp[i], w_buf, count[i],
+                                  ent_type[i], &status);
+    if (count[i] > 0 && errcode == MPI_SUCCESS) {
+      MPI_Get_count(&status, ent_type[i], &w_count);
+      n_written += (i == 0) ? (long long)w_count*chunk_size : w_count;
+    }
+  }
+
+  if (errcode != MPI_SUCCESS)
+    _mpi_io_error_message(f->name, errcode);
+
+  MPI_Type_free(&(ent_type[0]));
+  BFT_FREE(a_buf);
+
+  if (n_written == n_bytes)
+    retval = global_num_end - global_num_start;
+
+  return retval;
+}
+
 #endif /* defined(HAVE_MPI_IO) */
 
 /*----------------------------------------------------------------------------
@@ -2581,6 +3042,7 @@ cs_file_open(const char        *name,
 #if defined(HAVE_MPI_IO)
   f->fh = MPI_FILE_NULL;
   f->info = hints;
+  f->stripe_size = 0;
 #endif
 #endif
 
@@ -2590,6 +3052,11 @@ cs_file_open(const char        *name,
   f->in_mem_max_size = 0;
   f->in_mem_data = nullptr;
 
+  f->use_map = false;
+  f->map_size = 0;
+  f->map_pos = 0;
+  f->map_data = nullptr;
+
   BFT_MALLOC(f->name, strlen(name) + 1, char);
   strcpy(f->name, name);
 
@@ -2661,6 +3128,19 @@ cs_file_open(const char        *name,
               name);
 #endif
 
+  /* Use memory-mapped reads with standard C IO if requested
+     (gzipped files are read through zlib) */
+
+#if defined(_CS_FILE_MMAP)
+  if (   _default_mmap_r
+      && f->mode == CS_FILE_MODE_READ
+      && f->method <= CS_FILE_STDIO_PARALLEL) {
+    size_t l = strlen(f->name);
+    if (l < 4 || strncmp((f->name + l-3), ".gz", 3) != 0)
+      f->use_map = true;
+  }
+#endif
+
   /* Open file. In case of failure, destroy the allocated structure;
      this is only useful with a non-default error handler,
      as the program is terminated by default */
@@ -2790,7 +3270,7 @@ cs_file_free(cs_file_t  *f)
 {
   cs_file_t  *_f = f;
 
-  if (_f->sh != nullptr)
+  if (_f->sh != nullptr || _f->map_data != nullptr)
     _file_close(_f);
 
 #if defined(HAVE_MPI)
@@ -2826,6 +3306,38 @@ cs_file_in_memory_get_data(cs_file_t  *f)
   return (void *)f->in_mem_data;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Detach data from a file in memory.
+ *
+ * Only for files opened using CS_FILE_IN_MEMORY_SERIAL. Ownership of the
+ * data is transferred to the caller, and the file is left empty.
+ *
+ * \param[in, out]  f   cs_file_t descriptor
+ * \param[out]      nb  number of bytes of data
+ *
+ * \return pointer to file data (to be freed by caller).
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_file_in_memory_detach_data(cs_file_t  *f,
+                              size_t     *nb)
+{
+  assert(f != nullptr);
+  assert(f->method == CS_FILE_IN_MEMORY_SERIAL);
+
+  void *data = (void *)f->in_mem_data;
+  *nb = f->in_mem_size;
+
+  f->in_mem_size = 0;
+  f->in_mem_max_size = 0;
+  f->in_mem_data = nullptr;
+  f->offset = 0;
+
+  return data;
+}
+
 /*----------------------------------------------------------------------------
  * Allow global read attemps past end of file without throwing an error.
  *
@@ -3314,6 +3826,100 @@ cs_file_read_block(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Access data in a file without copy, each associated process
+ * obtaining a view of a contiguous part of this data.
+ *
+ * This function behaves as \ref cs_file_read_block, except that no data
+ * is copied: if the file is memory-mapped and accessible on all ranks
+ * (i.e. using \ref CS_FILE_STDIO_PARALLEL, or in serial mode), with no
+ * endianness conversion or rank stepping required, a pointer to the
+ * mapped data is returned, and the file position updated. Otherwise,
+ * this function returns false on all ranks and the file position
+ * is unchanged, so the caller may fall back to \ref cs_file_read_block.
+ *
+ * The returned view is read-only, and is valid until the file is closed.
+ *
+ * \param[in]   f                 cs_file_t descriptor
+ * \param[in]   size              size of each item of data in bytes
+ * \param[in]   stride            number of (interlaced) values per block item
+ * \param[in]   global_num_start  global number of first block item
+ *                                (1 to n numbering)
+ * \param[in]   global_num_end    global number of past-the end block item
+ *                                (1 to n numbering)
+ * \param[out]  view              pointer to local data block (may be
+ *                                nullptr for an empty block)
+ *
+ * \return true if a view is available, false otherwise (in which case
+ *         no data is read)
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_read_block_view(cs_file_t    *f,
+                        size_t        size,
+                        size_t        stride,
+                        cs_gnum_t     global_num_start,
+                        cs_gnum_t     global_num_end,
+                        const void  **view)
+{
+  *view = nullptr;
+
+  /* Check conditions, which are the same on all ranks */
+
+  if (   f->use_map == false
+      || f->swap_endian == true
+      || (f->method != CS_FILE_STDIO_PARALLEL && f->n_ranks > 1))
+    return false;
+
+#if defined(HAVE_MPI)
+  if (f->rank_step > 1)
+    return false;
+#endif
+
+  /* Avoid handing out misaligned views */
+
+  if (size > 1 && f->offset % size != 0)
+    return false;
+
+  cs_gnum_t global_num_end_last = global_num_end;
+
+  cs_gnum_t _global_num_start = (global_num_start-1)*stride + 1;
+  cs_gnum_t _global_num_end = (global_num_end-1)*stride + 1;
+
+  assert(global_num_end >= global_num_start);
+
+  if (_global_num_end > _global_num_start) {
+
+    /* Only rank 0 initially opened the file, so open here if needed */
+
+    if (f->sh == nullptr && f->map_data == nullptr)
+      _file_open(f);
+
+    size_t offset = f->offset + (_global_num_start - 1) * size;
+    size_t nb = (_global_num_end - _global_num_start) * size;
+
+    if (offset + nb > f->map_size)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Premature end of file \"%s\""), f->name);
+
+    *view = f->map_data + offset;
+
+  }
+
+  /* Update offset */
+
+#if defined(HAVE_MPI)
+  if (f->n_ranks > 1)
+    MPI_Bcast(&global_num_end_last, 1, CS_MPI_GNUM, f->n_ranks-1, f->comm);
+#endif
+
+  f->offset += ((global_num_end_last - 1) * size * stride);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Write data to a file, each associated process providing a
@@ -3515,15 +4121,28 @@ cs_file_write_block_buffer(cs_file_t  *f,
 
   case CS_FILE_MPI_INDEPENDENT:
   case CS_FILE_MPI_NON_COLLECTIVE:
+    if (f->stripe_size > 0)
+      retval = _mpi_file_write_block_aligned(f,
+                                             _buf,
+                                             size,
+                                             _global_num_start,
+                                             _global_num_end);
+    else
       retval = _mpi_file_write_block_noncoll(f,
                                              _buf,
                                              size,
                                              _global_num_start,
                                              _global_num_end);
-      break;
+    break;
 
   case CS_FILE_MPI_COLLECTIVE:
-    if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
+    if (f->stripe_size > 0)
+      retval = _mpi_file_write_block_aligned(f,
+                                             _buf,
+                                             size,
+                                             _global_num_start,
+                                             _global_num_end);
+    else if (_mpi_io_positioning == CS_FILE_MPI_EXPLICIT_OFFSETS)
       retval = _mpi_file_write_block_eo(f,
                                         _buf,
                                         size,
@@ -3614,6 +4233,8 @@ cs_file_seek(cs_file_t       *f,
 
     if (f->sh != nullptr)
       f->offset = cs_file_tell(f) + offset;
+    else if (f->map_data != nullptr)
+      f->offset = f->map_size + offset;
 
 #if defined(HAVE_MPI_IO)
     if (f->fh != MPI_FILE_NULL) {
@@ -3645,7 +4266,7 @@ cs_file_seek(cs_file_t       *f,
 
   /* Now update actual file position */
 
-  if (f->sh != nullptr)
+  if (f->sh != nullptr || f->map_data != nullptr)
       retval = _file_seek(f, offset, whence);
 
 #if defined(HAVE_MPI_IO)
@@ -3683,7 +4304,8 @@ cs_file_tell(cs_file_t  *f)
 {
   cs_file_off_t retval = f->offset;
 
-  if (f->method == CS_FILE_STDIO_SERIAL && f->rank == 0 && f->sh != nullptr)
+  if (   f->method == CS_FILE_STDIO_SERIAL && f->rank == 0
+      && (f->sh != nullptr || f->use_map))
     retval = _file_tell(f);
   else if (f->method == CS_FILE_IN_MEMORY_SERIAL && f->rank == 0)
     retval = _file_tell_in_memory(f);
@@ -3830,6 +4452,12 @@ cs_file_dump(const cs_file_t  *f)
 #endif
 #endif
 
+  if (f->use_map)
+    bft_printf("Mapped data:                 %p\n"
+               "Mapped size:                 %llu\n",
+               (const void *)f->map_data,
+               (unsigned long long)(f->map_size));
+
   bft_printf("\n");
 }
 
@@ -3847,12 +4475,16 @@ cs_file_free_defaults(void)
   _default_access_r = CS_FILE_DEFAULT;
   _default_access_w = CS_FILE_DEFAULT;
 
+  _default_mmap_r = false;
+
   /* Communicator and hints used for file operations */
 
 #if defined(HAVE_MPI)
   _mpi_defaults_are_set = false;
   _mpi_rank_step = 1;
   _mpi_comm = MPI_COMM_NULL;
+  _mpi_aggregators_per_node = 0;
+  _mpi_stripe_align = false;
 
   if (_mpi_io_comm != MPI_COMM_NULL) {
     MPI_Comm_free(&_mpi_io_comm);
@@ -4199,6 +4831,85 @@ cs_file_block_comm(int       block_rank_step,
   return new_comm;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the default IO aggregation options for file access.
+ *
+ * Data of distributed block reads and writes is gathered on a given number
+ * of aggregator ranks per compute node, by setting the default block rank
+ * step (see \ref cs_file_set_default_comm) based on the number of ranks
+ * per node. Ranks are assumed to be numbered contiguously on each node.
+ * When MPI-IO is used for writing, the "cb_config_list" hint is also set
+ * accordingly, so that MPI-IO two-phase aggregation (if used) matches
+ * these aggregators.
+ *
+ * If stripe alignment is requested, the file system stripe size is queried
+ * when opening a file for writing with collective or non-collective
+ * MPI-IO, and data is redistributed among aggregators before writing
+ * so that each aggregator's block starts on a stripe boundary, avoiding
+ * lock contention between aggregators (especially on Lustre).
+ *
+ * \param[in]  n_aggregators_per_node  number of aggregator ranks per node,
+ *                                     or 0 to keep the current block
+ *                                     rank step
+ * \param[in]  stripe_align            align blocks written with MPI-IO
+ *                                     to the file system stripe size
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_aggregation(int   n_aggregators_per_node,
+                                bool  stripe_align)
+{
+  _mpi_stripe_align = stripe_align;
+
+  if (n_aggregators_per_node < 1 || cs_glob_mpi_comm == MPI_COMM_NULL)
+    return;
+
+  /* Determine maximum number of ranks per node */
+
+  int node_size = 1;
+
+#if MPI_VERSION > 2
+  {
+    int l_node_size = 1;
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &node_comm);
+    MPI_Comm_size(node_comm, &l_node_size);
+    MPI_Comm_free(&node_comm);
+    MPI_Allreduce(&l_node_size, &node_size, 1, MPI_INT, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  if (n_aggregators_per_node > node_size)
+    n_aggregators_per_node = node_size;
+
+  _mpi_aggregators_per_node = n_aggregators_per_node;
+
+  int rank_step = node_size / n_aggregators_per_node;
+
+  cs_file_set_default_comm(rank_step, MPI_COMM_SELF);
+
+  /* Match MPI-IO aggregators */
+
+#if defined(HAVE_MPI_IO)
+#  if MPI_VERSION > 1
+
+  if (_default_access_w > CS_FILE_STDIO_PARALLEL) {
+    char val[32];
+    snprintf(val, 31, "*:%d", n_aggregators_per_node);
+    val[31] = '\0';
+    if (_mpi_io_hints_w == MPI_INFO_NULL)
+      MPI_Info_create(&_mpi_io_hints_w);
+    MPI_Info_set(_mpi_io_hints_w, "cb_config_list", val);
+  }
+
+#  endif /* MPI_VERSION > 1 */
+#endif /* defined(HAVE_MPI_IO) */
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
@@ -4241,6 +4952,50 @@ cs_file_set_mpi_io_positioning(cs_file_mpi_positioning_t  positioning)
   _mpi_io_positioning = positioning;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether memory-mapped reads are used for files read
+ *        with standard C IO.
+ *
+ * \return true if memory-mapped reads are used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_get_mmap_read(void)
+{
+  return _default_mmap_r;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether memory-mapped reads are used for files read
+ *        with standard C IO.
+ *
+ * When active, files opened for reading with the \ref CS_FILE_STDIO_SERIAL
+ * or \ref CS_FILE_STDIO_PARALLEL methods are mapped to memory rather than
+ * read through a stream, so that the operating system's page cache is
+ * shared by all ranks on a node, and block reads may be accessed without
+ * copies using \ref cs_file_read_block_view. Files compressed with gzip
+ * are not mapped.
+ *
+ * This setting only affects files opened after it is called, and is
+ * ignored if memory mapping is not available on this system.
+ *
+ * \param[in]  use_mmap  true to use memory-mapped reads, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_mmap_read(bool  use_mmap)
+{
+#if defined(_CS_FILE_MMAP)
+  _default_mmap_r = use_mmap;
+#else
+  CS_UNUSED(use_mmap);
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print information on default options for file access.
@@ -4320,6 +5075,27 @@ cs_file_defaults_info(void)
                     _("  I/O rank step:        %d\n"), block_rank_step);
   }
 
+  if (_mpi_aggregators_per_node > 0) {
+    for (log_id = 0; log_id < 2; log_id++)
+      cs_log_printf(logs[log_id],
+                    _("  I/O aggregators:      %d per node\n"),
+                    _mpi_aggregators_per_node);
+  }
+
+  if (_mpi_stripe_align) {
+    for (log_id = 0; log_id < 2; log_id++)
+      cs_log_printf(logs[log_id],
+                    _("  I/O write alignment:  %s\n"),
+                    _("file system stripe size"));
+  }
+
+  if (_default_mmap_r) {
+    for (log_id = 0; log_id < 2; log_id++)
+      cs_log_printf(logs[log_id],
+                    _("  I/O read mapping:     %s\n"),
+                    _("memory-mapped for standard IO"));
+  }
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -262,6 +262,24 @@ cs_file_get_name(const cs_file_t  *f);
 void *
 cs_file_in_memory_get_data(cs_file_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Detach data from a file in memory.
+ *
+ * Only for files opened using CS_FILE_IN_MEMORY_SERIAL. Ownership of the
+ * data is transferred to the caller, and the file is left empty.
+ *
+ * parameters:
+ *   f  <-> cs_file_t descriptor
+ *   nb --> number of bytes of data
+ *
+ * return:
+ *   pointer to file data (to be freed by caller).
+ *----------------------------------------------------------------------------*/
+
+void *
+cs_file_in_memory_detach_data(cs_file_t  *f,
+                              size_t     *nb);
+
 /*----------------------------------------------------------------------------
  * Allow global read attemps past end of file without throwing an error.
  *
@@ -392,6 +410,40 @@ cs_file_read_block(cs_file_t  *f,
                    cs_gnum_t   global_num_start,
                    cs_gnum_t   global_num_end);
 
+/*----------------------------------------------------------------------------
+ * Access data in a file without copy, each associated process obtaining
+ * a view of a contiguous part of this data.
+ *
+ * This function behaves as cs_file_read_block(), except that no data is
+ * copied: if the file is memory-mapped and accessible on all ranks, with
+ * no endianness conversion or rank stepping required, a pointer to the
+ * mapped data is returned. Otherwise, false is returned on all ranks and
+ * the file position is unchanged.
+ *
+ * The returned view is read-only, and is valid until the file is closed.
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   size             <-- size of each item of data in bytes
+ *   stride           <-- number of (interlaced) values per block item
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   view             --> pointer to local data block (may be nullptr
+ *                        for an empty block)
+ *
+ * returns:
+ *   true if a view is available, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_file_read_block_view(cs_file_t    *f,
+                        size_t        size,
+                        size_t        stride,
+                        cs_gnum_t     global_num_start,
+                        cs_gnum_t     global_num_end,
+                        const void  **view);
+
 /*----------------------------------------------------------------------------
  * Write data to a file, each associated process providing a contiguous part
  * of this data.
@@ -683,6 +735,26 @@ MPI_Comm
 cs_file_block_comm(int       block_rank_step,
                    MPI_Comm  comm);
 
+/*----------------------------------------------------------------------------
+ * Set the default IO aggregation options for file access.
+ *
+ * Data of distributed block reads and writes is gathered on a given number
+ * of aggregator ranks per compute node, by setting the default block rank
+ * step based on the number of ranks per node. If stripe alignment is
+ * requested, blocks written with MPI-IO are redistributed among aggregators
+ * so that each starts on a file system stripe boundary.
+ *
+ * parameters:
+ *   n_aggregators_per_node <-- number of aggregator ranks per node,
+ *                              or 0 to keep the current block rank step
+ *   stripe_align           <-- align blocks written with MPI-IO to the
+ *                              file system stripe size
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_aggregation(int   n_aggregators_per_node,
+                                bool  stripe_align);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -717,6 +789,31 @@ cs_file_get_mpi_io_positioning(void);
 void
 cs_file_set_mpi_io_positioning(cs_file_mpi_positioning_t  positioning);
 
+/*----------------------------------------------------------------------------
+ * Indicate whether memory-mapped reads are used for files read
+ * with standard C IO.
+ *
+ * returns:
+ *   true if memory-mapped reads are used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_file_get_mmap_read(void);
+
+/*----------------------------------------------------------------------------
+ * Set whether memory-mapped reads are used for files read
+ * with standard C IO.
+ *
+ * This setting only affects files opened after it is called, and is
+ * ignored if memory mapping is not available on this system.
+ *
+ * parameters:
+ *   use_mmap <-- true to use memory-mapped reads, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_mmap_read(bool  use_mmap);
+
 /*----------------------------------------------------------------------------
  * Print information on default options for file access.
  *----------------------------------------------------------------------------*/
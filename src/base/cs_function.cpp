@@ -90,6 +90,20 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Cached function values */
+
+typedef struct {
+
+  int             location_id;  /* mesh location id of cached values */
+  int             time_stamp;   /* time step of cached values, or -1 */
+  cs_lnum_t       n_elts;       /* number of cached elements */
+  unsigned char  *vals;         /* cached values */
+
+  int             n_deps;       /* number of field dependencies */
+  int            *dep_ids;      /* ids of fields on which values depend */
+
+} cs_function_cache_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -98,6 +112,8 @@ static int  _n_functions = 0;
 static int  _n_functions_max = 0;
 
 static cs_function_t  **_functions = nullptr;
+
+static cs_function_cache_t  *_cache = nullptr;
 static cs_map_name_to_id_t  *_function_map = nullptr;
 
 /* Names for logging */
@@ -193,6 +209,7 @@ _function_create(const char    *name,
     else
       _n_functions_max *= 2;
     BFT_REALLOC(_functions, _n_functions_max, cs_function_t *);
+    BFT_REALLOC(_cache, _n_functions_max, cs_function_cache_t);
   }
 
   /* Allocate functions descriptor block if necessary
@@ -243,9 +260,79 @@ _function_create(const char    *name,
   f->type |= CS_FUNCTION_USER;  /* to be unset explicitely for predefined
                                    functions */
 
+  cs_function_cache_t *c = _cache + function_id;
+  c->location_id = -1;
+  c->time_stamp = -1;
+  c->n_elts = 0;
+  c->vals = nullptr;
+  c->n_deps = 0;
+  c->dep_ids = nullptr;
+
   return f;
 }
 
+/*----------------------------------------------------------------------------
+ * Evaluate function values, without using the cache.
+ *
+ * parameters:
+ *   f           <-- pointer to associated function handle
+ *   ts          <-- pointer to time step status, or nullptr
+ *   location_id <-- base associated mesh location id
+ *   n_elts      <-- number of associated elements
+ *   elt_ids     <-- ids of associated elements, or nullptr
+ *   vals        --> pointer to output values
+ *----------------------------------------------------------------------------*/
+
+static void
+_evaluate(const cs_function_t   *f,
+          const cs_time_step_t  *ts,
+          int                    location_id,
+          cs_lnum_t              n_elts,
+          const cs_lnum_t       *elt_ids,
+          void                  *vals)
+{
+  if (f->eval_func != nullptr)
+    f->eval_func(location_id,
+                 n_elts,
+                 elt_ids,
+                 f->func_input,
+                 vals);
+
+  else if (f->analytic_func != nullptr) {
+
+    const double t_cur = (ts != nullptr) ? ts->t_cur : 0.;
+
+    const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+    const cs_mesh_location_type_t loc_type
+      = cs_mesh_location_get_type(location_id);
+    const cs_real_t *base_coords = nullptr;
+    if (loc_type == CS_MESH_LOCATION_CELLS)
+      base_coords = (const cs_real_t *)(mq->cell_cen);
+    else if (loc_type == CS_MESH_LOCATION_INTERIOR_FACES)
+      base_coords = (const cs_real_t *)(mq->i_face_cog);
+    else if (loc_type == CS_MESH_LOCATION_BOUNDARY_FACES)
+      base_coords = (const cs_real_t *)(mq->b_face_cog);
+    else if (loc_type == CS_MESH_LOCATION_VERTICES)
+      base_coords = (const cs_real_t *)(cs_glob_mesh->vtx_coord);
+
+    f->analytic_func(t_cur,
+                     n_elts,
+                     elt_ids,
+                     base_coords,
+                     true,
+                     f->func_input,
+                     static_cast<cs_real_t *>(vals));
+  }
+
+  else if (f->dof_func != nullptr) {
+    f->dof_func(n_elts,
+                elt_ids,
+                true,
+                f->func_input,
+                static_cast<cs_real_t *>(vals));
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Add type flag info to the current position in the setup log.
  *
@@ -416,6 +503,8 @@ cs_function_destroy_all(void)
   for (int i = 0; i < _n_functions; i++) {
     cs_function_t  *f = _functions[i];
     BFT_FREE(f->label);
+    BFT_FREE(_cache[i].vals);
+    BFT_FREE(_cache[i].dep_ids);
   }
 
   for (int i = 0; i < _n_functions; i++) {
@@ -424,6 +513,7 @@ cs_function_destroy_all(void)
   }
 
   BFT_FREE(_functions);
+  BFT_FREE(_cache);
 
   cs_map_name_to_id_destroy(&_function_map);
 
@@ -773,7 +863,12 @@ cs_function_log_all_settings(void)
  * \c n_elts * <value dimension> for the associated data type, in the same
  * order as \c elt_ids if present.)
  *
+ * For functions with the \ref CS_FUNCTION_CACHED flag, values are
+ * evaluated on all elements of the location at the first call of a given
+ * time step, and later calls in the same time step only extract them.
+ *
  * \param[in]       f            pointer to associated function handle
+ * \param[in]       ts           pointer to time step status, or nullptr
  * \param[in]       location_id  base associated mesh location id
  * \param[in]       n_elts       number of associated elements
  * \param[in]       elt_ids      ids of associated elements, or nullptr if no
@@ -791,45 +886,96 @@ cs_function_evaluate(const cs_function_t   *f,
                      const cs_lnum_t       *elt_ids,
                      void                  *vals)
 {
-  if (f->eval_func != nullptr)
-    f->eval_func(location_id,
-                 n_elts,
-                 elt_ids,
-                 f->func_input,
-                 vals);
+  if (ts != nullptr)
+    _functions[f->id]->time_stamp = ts->nt_cur;
 
-  else if (f->analytic_func != nullptr) {
+  if (!(f->type & CS_FUNCTION_CACHED) || ts == nullptr) {
+    _evaluate(f, ts, location_id, n_elts, elt_ids, vals);
+    return;
+  }
 
-    const double t_cur = (ts != nullptr) ? ts->t_cur : 0.;
+  /* Cached values are evaluated on all elements of the location,
+     once per time step */
 
-    const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-    const cs_mesh_location_type_t loc_type
-      = cs_mesh_location_get_type(location_id);
-    const cs_real_t *base_coords = nullptr;
-    if (loc_type == CS_MESH_LOCATION_CELLS)
-      base_coords = (const cs_real_t *)(mq->cell_cen);
-    else if (loc_type == CS_MESH_LOCATION_INTERIOR_FACES)
-      base_coords = (const cs_real_t *)(mq->i_face_cog);
-    else if (loc_type == CS_MESH_LOCATION_BOUNDARY_FACES)
-      base_coords = (const cs_real_t *)(mq->b_face_cog);
-    else if (loc_type == CS_MESH_LOCATION_VERTICES)
-      base_coords = (const cs_real_t *)(cs_glob_mesh->vtx_coord);
+  cs_function_cache_t *c = _cache + f->id;
 
-    f->analytic_func(t_cur,
-                     n_elts,
-                     elt_ids,
-                     base_coords,
-                     true,
-                     f->func_input,
-                     static_cast<cs_real_t *>(vals));
+  const size_t elt_size = cs_datatype_size[f->datatype] * f->dim;
+
+  if (c->time_stamp != ts->nt_cur || c->location_id != location_id) {
+    const cs_lnum_t n_loc_elts = cs_mesh_location_get_n_elts(location_id)[0];
+    BFT_REALLOC(c->vals, n_loc_elts*elt_size, unsigned char);
+    _evaluate(f, ts, location_id, n_loc_elts, nullptr, c->vals);
+    c->location_id = location_id;
+    c->time_stamp = ts->nt_cur;
+    c->n_elts = n_loc_elts;
   }
 
-  else if (f->dof_func != nullptr) {
-    f->dof_func(n_elts,
-                elt_ids,
-                true,
-                f->func_input,
-                static_cast<cs_real_t *>(vals));
+  assert(n_elts <= c->n_elts);
+
+  unsigned char *_vals = static_cast<unsigned char *>(vals);
+  const unsigned char *c_vals = c->vals;
+
+  if (elt_ids == nullptr)
+    memcpy(_vals, c_vals, n_elts*elt_size);
+  else {
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      memcpy(_vals + i*elt_size, c_vals + elt_ids[i]*elt_size, elt_size);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate that values of a cached function depend on a field.
+ *
+ * Cached values are discarded when \ref cs_function_cache_invalidate
+ * is called for one of the function's dependencies.
+ *
+ * \param[in, out]  f         pointer to associated function handle
+ * \param[in]       field_id  id of field on which values depend
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_function_add_field_dependency(cs_function_t  *f,
+                                 int             field_id)
+{
+  cs_function_cache_t *c = _cache + f->id;
+
+  for (int i = 0; i < c->n_deps; i++) {
+    if (c->dep_ids[i] == field_id)
+      return;
+  }
+
+  BFT_REALLOC(c->dep_ids, c->n_deps + 1, int);
+  c->dep_ids[c->n_deps] = field_id;
+  c->n_deps += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Discard cached values of functions depending on a given field.
+ *
+ * Cached values are automatically discarded at the next time step, so
+ * this only needs to be called when a field is modified after functions
+ * depending on it have been evaluated in the same time step.
+ *
+ * \param[in]  field_id  id of modified field, or -1 for all functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_function_cache_invalidate(int  field_id)
+{
+  for (int f_id = 0; f_id < _n_functions; f_id++) {
+    cs_function_cache_t *c = _cache + f_id;
+    bool depends = (field_id < 0);
+    for (int i = 0; i < c->n_deps && !depends; i++) {
+      if (c->dep_ids[i] == field_id)
+        depends = true;
+    }
+    if (depends)
+      c->time_stamp = -1;
   }
 }
 
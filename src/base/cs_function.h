@@ -76,6 +76,9 @@ BEGIN_C_DECLS
 /*! no sub-tasking (may be called inside task with no sync issues) */
 #define CS_FUNCTION_NO_SUB_TASK         (1 << 5)
 
+/*! values are cached and reused for all evaluations of a time step */
+#define CS_FUNCTION_CACHED              (1 << 6)
+
 /*! @} */
 
 /*============================================================================
@@ -365,7 +368,12 @@ cs_function_log_all_settings(void);
  * \c n_elts * <value dimension> for the associated data type, in the same
  * order as \c elt_ids if present.)
  *
+ * For functions with the \ref CS_FUNCTION_CACHED flag, values are
+ * evaluated on all elements of the location at the first call of a given
+ * time step, and later calls in the same time step only extract them.
+ *
  * \param[in]       f            pointer to associated function handle
+ * \param[in]       ts           pointer to time step status, or NULL
  * \param[in]       location_id  base associated mesh location id
  * \param[in]       n_elts       number of associated elements
  * \param[in]       elt_ids      ids of associated elements, or NULL if no
@@ -383,6 +391,37 @@ cs_function_evaluate(const cs_function_t   *f,
                      const cs_lnum_t       *elt_ids,
                      void                  *vals);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate that values of a cached function depend on a field.
+ *
+ * Cached values are discarded when \ref cs_function_cache_invalidate
+ * is called for one of the function's dependencies.
+ *
+ * \param[in, out]  f         pointer to associated function handle
+ * \param[in]       field_id  id of field on which values depend
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_function_add_field_dependency(cs_function_t  *f,
+                                 int             field_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Discard cached values of functions depending on a given field.
+ *
+ * Cached values are automatically discarded at the next time step, so
+ * this only needs to be called when a field is modified after functions
+ * depending on it have been evaluated in the same time step.
+ *
+ * \param[in]  field_id  id of modified field, or -1 for all functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_function_cache_invalidate(int  field_id);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
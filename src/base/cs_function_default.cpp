@@ -761,7 +761,9 @@ cs_function_define_boundary_stress(void)
 
   cs_function_set_label(f, "Stress");
 
-  f->type = CS_FUNCTION_INTENSIVE;
+  f->type = CS_FUNCTION_INTENSIVE | CS_FUNCTION_CACHED;
+
+  cs_function_add_field_dependency(f, cs_field_id_by_name("boundary_forces"));
 
   f->post_vis = CS_POST_ON_LOCATION;
 
@@ -795,7 +797,9 @@ cs_function_define_boundary_stress_normal(void)
 
   cs_function_set_label(f, "Normal Stress");
 
-  f->type = CS_FUNCTION_INTENSIVE;
+  f->type = CS_FUNCTION_INTENSIVE | CS_FUNCTION_CACHED;
+
+  cs_function_add_field_dependency(f, cs_field_id_by_name("boundary_forces"));
 
   f->post_vis = CS_POST_ON_LOCATION;
 
@@ -829,7 +833,9 @@ cs_function_define_boundary_stress_tangential(void)
 
   cs_function_set_label(f, "Shear Stress");
 
-  f->type = CS_FUNCTION_INTENSIVE;
+  f->type = CS_FUNCTION_INTENSIVE | CS_FUNCTION_CACHED;
+
+  cs_function_add_field_dependency(f, cs_field_id_by_name("boundary_forces"));
 
   f->post_vis = CS_POST_ON_LOCATION;
 
@@ -883,7 +889,11 @@ cs_function_define_boundary_thermal_flux(void)
 
   cs_function_set_label(f, "Input thermal flux");
 
-  f->type = CS_FUNCTION_INTENSIVE;
+  f->type = CS_FUNCTION_INTENSIVE | CS_FUNCTION_CACHED;
+
+  cs_function_add_field_dependency(f, f_t->id);
+  for (int i = 0; i < 2; i++)
+    cs_function_add_field_dependency(f, cs_field_id_by_name(names[i]));
 
   f->post_vis = CS_POST_ON_LOCATION;
 
@@ -941,7 +951,11 @@ cs_function_define_boundary_nusselt(void)
 
     cs_function_set_label(f, "Dimensionless heat flux");
 
-    f->type = CS_FUNCTION_INTENSIVE;
+    f->type = CS_FUNCTION_INTENSIVE | CS_FUNCTION_CACHED;
+
+    cs_function_add_field_dependency(f, f_t->id);
+    for (int i = 0; i < 2; i++)
+      cs_function_add_field_dependency(f, cs_field_id_by_name(names[i]));
 
     f->post_vis = CS_POST_ON_LOCATION;
 
@@ -973,7 +987,9 @@ cs_function_define_q_criterion(void)
 
   cs_function_set_label(f, "Q criterion");
 
-  f->type = CS_FUNCTION_INTENSIVE;
+  f->type = CS_FUNCTION_INTENSIVE | CS_FUNCTION_CACHED;
+
+  cs_function_add_field_dependency(f, cs_field_id_by_name("velocity"));
 
   f->post_vis = CS_POST_ON_LOCATION;
 
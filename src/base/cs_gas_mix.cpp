@@ -103,6 +103,17 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Predefined property laws of gas species */
+
+typedef enum {
+
+  _LAW_H2O_G,       /* steam */
+  _LAW_HE,          /* helium */
+  _LAW_H2,          /* hydrogen */
+  _LAW_O2_N2        /* oxygen or nitrogen */
+
+} _species_law_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -152,15 +163,44 @@ const cs_gas_mix_t  *cs_glob_gas_mix = &_gas_mix;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the predefined property law of a gas species.
+ *
+ * \param[in]     name          name of the field associated to the gas species
+ *
+ * \return  associated law
+ */
+/*----------------------------------------------------------------------------*/
+
+static _species_law_t
+_species_law(const char  *name)
+{
+  _species_law_t law = _LAW_O2_N2;
+
+  if (strcmp(name, "y_h2o_g") == 0)
+    law = _LAW_H2O_G;
+  else if (strcmp(name, "y_he") == 0)
+    law = _LAW_HE;
+  else if (strcmp(name, "y_h2") == 0)
+    law = _LAW_H2;
+  else if (   strcmp(name, "y_o2") == 0
+           || strcmp(name, "y_n2") == 0)
+    law = _LAW_O2_N2;
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: no predefined properties for field %s."),
+              __func__, name);
+
+  return law;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the dynamic viscosity and
  *        conductivity coefficient associated to each gas species.
  *
- * TODO: replace name with enum to avoid test on string, as this
- *       function is called in a loop.
- *
- * \param[in]     name          name of the field associated to the gas species
+ * \param[in]     law           property law of the gas species
  * \param[in]     tk            temperature variable in kelvin
  * \param[in]     spro          constants used for the physcial laws
  * \param[out]    mu            dynamic viscosity associated to the gas species
@@ -169,7 +209,7 @@ const cs_gas_mix_t  *cs_glob_gas_mix = &_gas_mix;
 /*----------------------------------------------------------------------------*/
 
 static void
-_compute_mu_lambda(const char                       *name,
+_compute_mu_lambda(_species_law_t                    law,
                    const cs_real_t                   tk,
                    const cs_gas_mix_species_prop_t   spro,
                    cs_real_t                        *mu,
@@ -195,30 +235,23 @@ _compute_mu_lambda(const char                       *name,
    *      mu = mu_a .(tk) + mu_b, with t in (°K)
    *      lambda = lambda_a .(tk) + lambda_b, with t (°K) */
 
-  if (strcmp(name, "y_h2o_g") == 0) {
+  switch (law) {
+  case _LAW_H2O_G:
     _mu     = spro.mu_a    *(tk-tkelvin) + spro.mu_b;
     _lambda = spro.lambda_a*(tk-tkelvin) + spro.lambda_b;
-  }
-  else if (strcmp(name, "y_he") == 0) {
+    break;
+  case _LAW_HE:
     _mu     = spro.mu_a     * pow(tk/tkelvin, 0.7);
     _lambda = spro.lambda_a * pow(tk/tkelvin, 0.7);
-  }
-  else if (strcmp(name, "y_h2") == 0) {
+    break;
+  case _LAW_H2:
     _mu     = spro.mu_a     * (tk-tkelvin) + spro.mu_b;
     _lambda = spro.lambda_a * tk + spro.lambda_b;
-  }
-  else if (   strcmp(name, "y_o2") == 0
-           || strcmp(name, "y_n2") == 0) {
+    break;
+  default:
     _mu     = spro.mu_a     * tk + spro.mu_b;
     _lambda = spro.lambda_a * tk + spro.lambda_b;
   }
-  else {
-    _mu = -1;
-    _lambda = -1;
-    bft_error(__FILE__, __LINE__, 0,
-              _("%s: no predefined properties for field %s."),
-              __func__, name);
-  }
 
   *mu = _mu;
   *lambda = _lambda;
@@ -848,6 +881,38 @@ cs_gas_mix_physical_properties(void)
   if (cs_glob_velocity_pressure_model->idilat == 3)
     pressure = cs_glob_fluid_properties->pther;
 
+  /* Gather species values and properties once, so as to avoid
+   * querying fields and keys for each cell; the deduced species
+   * is stored last. */
+
+  const int n_s_solved = _gas_mix.n_species_solved;
+  const int n_sp = n_s_solved + 1;
+
+  const cs_real_t **sp_y = nullptr;
+  cs_gas_mix_species_prop_t *sp_prop = nullptr;
+  _species_law_t *sp_law = nullptr;
+
+  BFT_MALLOC(sp_y, n_sp, const cs_real_t *);
+  BFT_MALLOC(sp_prop, n_sp, cs_gas_mix_species_prop_t);
+  BFT_MALLOC(sp_law, n_sp, _species_law_t);
+
+  for (int s_id = 0; s_id < n_sp; s_id++) {
+    const cs_field_t *f_s = f;
+    if (s_id < n_s_solved)
+      f_s = cs_field_by_id(_gas_mix.species_to_field_id[s_id]);
+    sp_y[s_id] = f_s->val;
+    cs_field_get_key_struct(f_s, k_id, sp_prop + s_id);
+    sp_law[s_id] = _species_law(f_s->name);
+  }
+
+  /* Species-major work arrays: molar fraction, viscosity and
+     conductivity of each species */
+
+  cs_real_t *x_s = nullptr, *mu_s = nullptr, *lambda_s = nullptr;
+  BFT_MALLOC(x_s, (size_t)n_sp*n_cells, cs_real_t);
+  BFT_MALLOC(mu_s, (size_t)n_sp*n_cells, cs_real_t);
+  BFT_MALLOC(lambda_s, (size_t)n_sp*n_cells, cs_real_t);
+
 # pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
 
@@ -873,17 +938,12 @@ cs_gas_mix_physical_properties(void)
     steam_binary_diffusion[c_id] = x_0;
 
     /* Mass fraction array of the different species */
-    for (int spe_id = 0; spe_id < _gas_mix.n_species_solved; spe_id++) {
-      const int f_spe_id = _gas_mix.species_to_field_id[spe_id];
-      const cs_field_t *f_spe = cs_field_by_id(f_spe_id);
-      const cs_real_t *cvar_yk = f_spe->val;
-
-      cs_gas_mix_species_prop_t s_k;
-      cs_field_get_key_struct(f_spe, k_id, &s_k);
+    for (int spe_id = 0; spe_id < n_s_solved; spe_id++) {
+      const cs_real_t y_k = sp_y[spe_id][c_id];
 
-      y_d[c_id] -= cvar_yk[c_id];
-      mix_mol_mas[c_id] += cvar_yk[c_id]/s_k.mol_mas;
-      mol_mas_ncond[c_id] += cvar_yk[c_id] / s_k.mol_mas;
+      y_d[c_id] -= y_k;
+      mix_mol_mas[c_id] += y_k/sp_prop[spe_id].mol_mas;
+      mol_mas_ncond[c_id] += y_k / sp_prop[spe_id].mol_mas;
     }
 
     // Clipping
@@ -894,7 +954,7 @@ cs_gas_mix_physical_properties(void)
     mix_mol_mas[c_id] = x_1/mix_mol_mas[c_id];
     mol_mas_ncond[c_id] = (x_1 - y_d[c_id])/mol_mas_ncond[c_id];
 
-    for (int spe_id = 0; spe_id < _gas_mix.n_species_solved + 1; spe_id++) {
+    for (int spe_id = 0; spe_id < n_sp; spe_id++) {
       /* Mixture specific heat function of species specific heat (cpk)
        * and mass fraction of each gas species (yk), as below:
        *             -----------------------------
@@ -908,15 +968,12 @@ cs_gas_mix_physical_properties(void)
        *      - CS_GAS_MIX = CS_GAS_MIX_AIR_HELIUM or
        *        CS_GAS_MIX_AIR_HYDROGEN, a noncondensable gas
        *      - CS_GAS_MIX > CS_GAS_MIX_AIR_STEAM, a condensable gas (steam) */
-      const int f_spe_id = _gas_mix.species_to_field_id[spe_id];
-      const cs_field_t *f_spe = cs_field_by_id(f_spe_id);
-      if (spe_id == _gas_mix.n_species_solved)
-        f_spe = f;
-      const cs_real_t *cvar_yk = f_spe->val;
-
-      cs_gas_mix_species_prop_t s_k;
-      cs_field_get_key_struct(f_spe, k_id, &s_k);
-      cpro_cp[c_id] += cvar_yk[c_id]*s_k.cp;
+      const cs_real_t y_k = sp_y[spe_id][c_id];
+      cpro_cp[c_id] += y_k*sp_prop[spe_id].cp;
+
+      /* Molar fraction */
+      x_s[spe_id*n_cells + c_id]
+        = y_k*mix_mol_mas[c_id]/sp_prop[spe_id].mol_mas;
     }
 
   }
@@ -950,99 +1007,98 @@ cs_gas_mix_physical_properties(void)
    * the physical properties associated to the gas
    * mixture with or without condensable gas */
 
-  /* Loop on all species */
-  for (int spe_id = 0; spe_id < _gas_mix.n_species_solved + 1; spe_id++) {
+  /* Viscosity and conductivity of each species */
+
+  const int ivsuth = cs_glob_fluid_properties->ivsuth;
 
-    const cs_field_t *f_spe = f;
-    if (spe_id < _gas_mix.n_species_solved) {
-      const int f_spe_id = _gas_mix.species_to_field_id[spe_id];
-      f_spe = cs_field_by_id(f_spe_id);
+  for (int spe_id = 0; spe_id < n_sp; spe_id++) {
+
+    const _species_law_t law = sp_law[spe_id];
+    const cs_gas_mix_species_prop_t s_i = sp_prop[spe_id];
+    cs_real_t *_mu = mu_s + spe_id*n_cells;
+    cs_real_t *_lambda = lambda_s + spe_id*n_cells;
+
+    if (ivsuth == 0) {
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++)
+        _compute_mu_lambda(law, tempk[c_id], s_i,
+                           _mu + c_id, _lambda + c_id);
+    }
+    else {
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++)
+        _compute_mu_lambda_suth(tempk[c_id], s_i,
+                                _mu + c_id, _lambda + c_id);
     }
 
-    cs_gas_mix_species_prop_t s_i;
-    const cs_real_t *cvar_yi = f_spe->val;
-    cs_field_get_key_struct(f_spe, k_id, &s_i);
-
-    cs_real_t  mu_i, lambda_i,  mu_j, lambda_j;
-
-    const int ivsuth = cs_glob_fluid_properties->ivsuth;
-    if (ivsuth == 1) {
-      if (   (strcmp(f_spe->name, "y_he")    != 0)
-          && (strcmp(f_spe->name, "y_h2")    != 0)
-          && (strcmp(f_spe->name, "y_o2")    != 0)
-          && (strcmp(f_spe->name, "y_n2")    != 0)
-          && (strcmp(f_spe->name, "y_h2o_g") != 0)   )
-        bft_error(__FILE__, __LINE__, 0,
-                  _("%s: no predefined properties for field %s."),
-                  __func__, f_spe->name);
+  }
+
+  /* Pairwise mixing coefficients of the Wilke rule, which only
+   * depend on the molar masses:
+   *   phi_ij = a_ij (1 + (f_i/f_j)^(1/2) b_ij)^2
+   * with a_ij = 1/sqrt(8) (1 + M_i/M_j)^(-1/2), b_ij = (M_j/M_i)^(1/4) */
+
+  cs_real_t *phi_a = nullptr, *phi_b = nullptr;
+  BFT_MALLOC(phi_a, n_sp*n_sp, cs_real_t);
+  BFT_MALLOC(phi_b, n_sp*n_sp, cs_real_t);
+
+  for (int i = 0; i < n_sp; i++) {
+    for (int j = 0; j < n_sp; j++) {
+      const cs_real_t m_i = sp_prop[i].mol_mas, m_j = sp_prop[j].mol_mas;
+      phi_a[i*n_sp + j] = (1.0/sqrt(8.0)) * pow(1.0 + m_i/m_j, -0.5);
+      phi_b[i*n_sp + j] = pow(m_j/m_i, 0.25);
     }
+  }
 
-    /* TODO: use local arrays to store s_j and field name or identifiers,
-     *       so as to avoid querying them for each field for each cell. */
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
 
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
+    for (int i = 0; i < n_sp; i++) {
 
-      if (ivsuth == 0)
-        _compute_mu_lambda(f_spe->name, tempk[c_id], s_i,
-                           &mu_i, &lambda_i);
-      else
-        _compute_mu_lambda_suth(tempk[c_id], s_i,
-                                &mu_i, &lambda_i);
+      const cs_real_t mu_i = mu_s[i*n_cells + c_id];
+      const cs_real_t lambda_i = lambda_s[i*n_cells + c_id];
 
       cs_real_t xsum_mu = 0.0, xsum_lambda = 0.0;
 
-      for (int s_id = 0; s_id < _gas_mix.n_species_solved + 1; s_id++) {
+      for (int j = 0; j < n_sp; j++) {
 
-        const cs_field_t *f_s = f;
-        if (s_id < _gas_mix.n_species_solved) {
-          const int f_s_id = _gas_mix.species_to_field_id[s_id];
-          f_s = cs_field_by_id(f_s_id);
-        }
+        const cs_real_t a_ij = phi_a[i*n_sp + j];
+        const cs_real_t b_ij = phi_b[i*n_sp + j];
 
-        cs_gas_mix_species_prop_t s_j;
-        const cs_real_t *cvar_yj = f_s->val;
-        cs_field_get_key_struct(f_s, k_id, &s_j);
-
-        if (ivsuth == 0)
-          _compute_mu_lambda(f_s->name, tempk[c_id], s_j,
-                             &mu_j, &lambda_j);
-        else
-          _compute_mu_lambda_suth(tempk[c_id], s_j,
-                                  &mu_j, &lambda_j);
+        const cs_real_t mu_j = mu_s[j*n_cells + c_id];
+        const cs_real_t lambda_j = lambda_s[j*n_cells + c_id];
 
         const cs_real_t phi_mu
-          =   (1.0/sqrt(8.0))
-            * pow(1.0 + s_i.mol_mas/s_j.mol_mas, -0.5)
-            * pow(1.0 + pow(mu_i/mu_j, 0.5)
-            * pow(s_j.mol_mas/s_i.mol_mas, 0.25), 2);
+          = a_ij * cs_math_pow2(1.0 + sqrt(mu_i/mu_j)*b_ij);
 
         const cs_real_t phi_lambda
-          =   (1.0/sqrt(8.0))
-            * pow(1.0 + s_i.mol_mas/s_j.mol_mas, -0.5)
-            * pow(1.0 + pow(lambda_i/lambda_j, 0.5)
-            * pow(s_j.mol_mas / s_i.mol_mas, 0.25), 2);
+          = a_ij * cs_math_pow2(1.0 + sqrt(lambda_i/lambda_j)*b_ij);
 
-        const cs_real_t x_k = cvar_yj[c_id]*mix_mol_mas[c_id]/s_j.mol_mas;
+        const cs_real_t x_k = x_s[j*n_cells + c_id];
         xsum_mu += x_k * phi_mu;
         xsum_lambda += x_k * phi_lambda;
       }
 
       /* Mixture viscosity defined as function of the scalars
          ----------------------------------------------------- */
-      const cs_real_t x_k
-        = cvar_yi[c_id]*mix_mol_mas[c_id]/s_i.mol_mas;
+      const cs_real_t x_k = x_s[i*n_cells + c_id];
       cpro_viscl[c_id] = cpro_viscl[c_id] + x_k * mu_i / xsum_mu;
 
       lambda[c_id] += x_k * lambda_i / xsum_lambda;
 
-    } //loop on cells
-  } // end of loop on species
+    } // end of loop on species
+  } // loop on cells
+
+  BFT_FREE(phi_a);
+  BFT_FREE(phi_b);
+  BFT_FREE(mu_s);
+  BFT_FREE(lambda_s);
 
   /* Dynamic viscosity and conductivity coefficient
    * the physical properties filled for the gas mixture */
 
   /* Same diffusivity for all the scalars except the enthalpy */
-  for (int spe_id = 0; spe_id < _gas_mix.n_species_solved; spe_id++) {
+  for (int spe_id = 0; spe_id < n_s_solved; spe_id++) {
 
     const int f_spe_id = _gas_mix.species_to_field_id[spe_id];
     const cs_field_t *f_spe = cs_field_by_id(f_spe_id);
@@ -1054,6 +1110,21 @@ cs_gas_mix_physical_properties(void)
 
   const cs_real_t patm = 101320.0;
 
+  /* Steam binary diffusion coefficient factor of each species,
+     which only depends on species properties */
+
+  cs_real_t *a1_s = nullptr;
+  BFT_MALLOC(a1_s, n_sp, cs_real_t);
+
+  for (int spe_id = 0; spe_id < n_s_solved; spe_id++) {
+    const cs_gas_mix_species_prop_t s_i = sp_prop[spe_id];
+    const cs_real_t xmab
+      = sqrt(2.0/( 1.0 / (s_d.mol_mas*1000.0) +1.0 / (s_i.mol_mas*1000.0)));
+    const cs_real_t xvab
+      = pow(pow(s_d.vol_dif, 1.0/3.0) + pow(s_i.vol_dif, 1.0/3.0), 2.0);
+    a1_s[spe_id] = 1.43e-7 / (xmab * xvab) * patm;
+  }
+
   /* Steam binary diffusion */
 # pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
@@ -1061,22 +1132,9 @@ cs_gas_mix_physical_properties(void)
     cs_real_t x_ncond_tot = 0.0;
     const cs_real_t ratio_tkpr = pow(tempk[c_id], 1.75)/pressure;
 
-    for (int spe_id = 0; spe_id < _gas_mix.n_species_solved; spe_id++) {
-      const int f_spe_id = _gas_mix.species_to_field_id[spe_id];
-      const cs_field_t *f_spe = cs_field_by_id(f_spe_id);
-
-      const cs_real_t *cvar_yi = f_spe->val;
-      cs_gas_mix_species_prop_t s_i;
-      cs_field_get_key_struct(f_spe, k_id, &s_i);
-
-      const cs_real_t y_k = cvar_yi[c_id];
-      const cs_real_t x_k = y_k * mix_mol_mas[c_id] / s_i.mol_mas;
-      const cs_real_t xmab
-        = sqrt(2.0/( 1.0 / (s_d.mol_mas*1000.0) +1.0 / (s_i.mol_mas*1000.0)));
-      const cs_real_t xvab
-        = pow(pow(s_d.vol_dif, 1.0/3.0) + pow(s_i.vol_dif, 1.0/3.0), 2.0);
-      const cs_real_t a1 = 1.43e-7 / (xmab * xvab) * patm;
-      steam_binary_diffusion[c_id] += x_k / (a1 * ratio_tkpr);
+    for (int spe_id = 0; spe_id < n_s_solved; spe_id++) {
+      const cs_real_t x_k = x_s[spe_id*n_cells + c_id];
+      steam_binary_diffusion[c_id] += x_k / (a1_s[spe_id] * ratio_tkpr);
       x_ncond_tot += x_k;
     }
 
@@ -1084,6 +1142,12 @@ cs_gas_mix_physical_properties(void)
 
   }
 
+  BFT_FREE(a1_s);
+  BFT_FREE(x_s);
+  BFT_FREE(sp_y);
+  BFT_FREE(sp_prop);
+  BFT_FREE(sp_law);
+
   if (cs_glob_physical_model_flag[CS_COMPRESSIBLE] < 0) {
 #   pragma omp parallel for if (n_cells > CS_THR_MIN)
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++)
@@ -44,10 +44,14 @@
 
 #include "cs_base.h"
 #include "cs_base_accel.h"
+#include "cs_comm_stats.h"
 #if defined(HAVE_CUDA)
 #include "cs_base_cuda.h"
 #endif
+#include "cs_log.h"
 #include "cs_order.h"
+#include "cs_profiling.h"
+#include "cs_timer.h"
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
@@ -93,10 +97,40 @@ BEGIN_C_DECLS
  * Local macro definitions
  *============================================================================*/
 
+/* Maximum number of persistent request sets per halo state */
+
+#define CS_HALO_N_PERSISTENT_MAX 8
+
 /*=============================================================================
  * Local type definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/* Set of persistent requests for a given halo, exchange type and buffers */
+
+typedef struct {
+
+  const cs_halo_t  *halo;         /* Associated halo */
+  int               n_c_domains;  /* Number of communicating domains
+                                     (used to check halo consistency) */
+
+  cs_halo_type_t    sync_mode;    /* Standard or extended */
+  cs_datatype_t     data_type;    /* Datatype */
+  int               stride;       /* Number of values per location */
+
+  const void       *send_buffer;  /* Associated send buffer */
+  const void       *recv_buffer;  /* Associated receive buffer */
+
+  int               n_recv;       /* Number of receive requests */
+  int               n_requests;   /* Total number of requests */
+  MPI_Request      *request;      /* Array of persistent requests
+                                     (receives first, then sends) */
+
+} cs_halo_persistent_t;
+
+#endif
+
 /* Structure to maintain halo exchange state */
 
 struct _cs_halo_state_t {
@@ -125,6 +159,10 @@ struct _cs_halo_state_t {
   void        *send_buffer;       /* Send buffer (maintained by this object) */
   void        *recv_buffer;       /* Recv. buffer (maintained by this object) */
 
+  size_t       recv_buffer_d_size;  /* Size of device receive buffer */
+  void        *recv_buffer_d;       /* Device receive buffer, for persistent
+                                       communication with device-aware MPI */
+
 #if defined(HAVE_MPI)
 
   int          request_size;      /* Size of requests and status arrays */
@@ -134,6 +172,11 @@ struct _cs_halo_state_t {
 
   MPI_Win       win;              /* MPI-3 RMA window */
 
+  int           persistent_id;    /* Id of persistent request set used for
+                                     current exchange, or -1 */
+  int           n_persistent;     /* Number of persistent request sets */
+  cs_halo_persistent_t  *persistent;  /* Persistent request sets */
+
 #endif
 
 };
@@ -162,6 +205,15 @@ static cs_halo_state_t *_halo_state = nullptr;
 /* Halo communications mode */
 static cs_halo_comm_mode_t _halo_comm_mode = CS_HALO_COMM_P2P;
 
+/* Was the communications mode set explicitely ? */
+static bool _halo_comm_mode_is_set = false;
+
+/* Time spent waiting for halo exchange completion */
+static cs_timer_counter_t _halo_wait_t = {.nsec = 0};
+
+/* Halo type names (for profiler annotations) */
+static const char *_halo_type_name[] = {"standard", "extended"};
+
 END_C_DECLS
 
 /*============================================================================
@@ -236,6 +288,307 @@ _update_requests(const cs_halo_t  *halo,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Free persistent request sets of a halo state.
+ *
+ * parameters:
+ *   halo       <-- pointer to associated halo, or nullptr for all sets
+ *   hs         <-> pointer to halo state structure
+ *---------------------------------------------------------------------------*/
+
+static void
+_free_persistent_requests(const cs_halo_t  *halo,
+                          cs_halo_state_t  *hs)
+{
+  if (hs == nullptr || hs->n_persistent == 0)
+    return;
+
+  int mpi_flag = 0;
+  MPI_Finalized(&mpi_flag);
+
+  int j = 0;
+  for (int i = 0; i < hs->n_persistent; i++) {
+    cs_halo_persistent_t *p = hs->persistent + i;
+    if (halo == nullptr || p->halo == halo) {
+      if (mpi_flag == 0) {
+        for (int r_id = 0; r_id < p->n_requests; r_id++)
+          MPI_Request_free(&(p->request[r_id]));
+      }
+      BFT_FREE(p->request);
+    }
+    else
+      hs->persistent[j++] = *p;
+  }
+  hs->n_persistent = j;
+
+  if (j == 0)
+    BFT_FREE(hs->persistent);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Ensure the host receive buffer of a halo state has a given minimum size.
+ *
+ * If the buffer is reallocated, persistent requests using it are released.
+ *
+ * parameters:
+ *   hs         <-> pointer to halo state
+ *   recv_size  <-- required buffer size, in bytes
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_recv_buffer(cs_halo_state_t  *hs,
+                    size_t            recv_size)
+{
+  if (hs->recv_buffer_size < recv_size) {
+#if defined(HAVE_MPI)
+    _free_persistent_requests(nullptr, hs);
+#endif
+    hs->recv_buffer_size = recv_size;
+    CS_FREE_HD(hs->recv_buffer);
+    CS_MALLOC_HD(hs->recv_buffer, hs->recv_buffer_size, unsigned char,
+                 _halo_buffer_alloc_mode);
+  }
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Return id of persistent request set matching current exchange,
+ * building it if needed.
+ *
+ * parameters:
+ *   halo        <-- pointer to cs_halo_t structure.
+ *   send_buffer <-- send buffer (host or device)
+ *   recv_buffer <-- receive buffer for all ghost values (host or device)
+ *   hs          <-> pointer to halo state structure.
+ *
+ * returns:
+ *   id of persistent request set in halo state
+ *---------------------------------------------------------------------------*/
+
+static int
+_get_persistent_requests(const cs_halo_t  *halo,
+                         const void       *send_buffer,
+                         void             *recv_buffer,
+                         cs_halo_state_t  *hs)
+{
+  for (int i = 0; i < hs->n_persistent; i++) {
+    const cs_halo_persistent_t *p = hs->persistent + i;
+    if (   p->halo == halo
+        && p->n_c_domains == halo->n_c_domains
+        && p->sync_mode == hs->sync_mode
+        && p->data_type == hs->data_type
+        && p->stride == hs->stride
+        && p->send_buffer == send_buffer
+        && p->recv_buffer == recv_buffer)
+      return i;
+  }
+
+  /* Not found; free oldest set if the maximum number is reached */
+
+  if (hs->persistent == nullptr)
+    BFT_MALLOC(hs->persistent, CS_HALO_N_PERSISTENT_MAX, cs_halo_persistent_t);
+
+  if (hs->n_persistent >= CS_HALO_N_PERSISTENT_MAX) {
+    cs_halo_persistent_t *p = hs->persistent;
+    for (int r_id = 0; r_id < p->n_requests; r_id++)
+      MPI_Request_free(&(p->request[r_id]));
+    BFT_FREE(p->request);
+    for (int i = 1; i < hs->n_persistent; i++)
+      hs->persistent[i-1] = hs->persistent[i];
+    hs->n_persistent -= 1;
+  }
+
+  cs_halo_persistent_t *p = hs->persistent + hs->n_persistent;
+
+  p->halo = halo;
+  p->n_c_domains = halo->n_c_domains;
+  p->sync_mode = hs->sync_mode;
+  p->data_type = hs->data_type;
+  p->stride = hs->stride;
+  p->send_buffer = send_buffer;
+  p->recv_buffer = recv_buffer;
+
+  BFT_MALLOC(p->request, halo->n_c_domains*2, MPI_Request);
+
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  cs_lnum_t stride = hs->stride;
+  size_t elt_size = cs_datatype_size[hs->data_type] * stride;
+
+  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[hs->data_type];
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  int request_count = 0;
+
+  /* Receive data from distant ranks */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                        - halo->index[2*rank_id]);
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0) {
+      size_t start = (size_t)(halo->index[2*rank_id]);
+      unsigned char *dest = (unsigned char *)recv_buffer + start*elt_size;
+
+      MPI_Recv_init(dest,
+                    length*stride,
+                    mpi_datatype,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(p->request[request_count++]));
+    }
+
+  }
+
+  p->n_recv = request_count;
+
+  /* Send data to distant ranks */
+
+  const unsigned char *buffer = (const unsigned char *)send_buffer;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id]*elt_size;
+    cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                        - halo->send_index[2*rank_id]);
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Send_init(buffer + start,
+                    length*stride,
+                    mpi_datatype,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(p->request[request_count++]));
+
+  }
+
+  p->n_requests = request_count;
+
+  hs->n_persistent += 1;
+
+  return hs->n_persistent - 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Launch update of ghost values using persistent requests.
+ *
+ * Values are received in a receive buffer of the halo state, and copied
+ * to the variable array upon completion. For device arrays (which require
+ * device-aware MPI), both send and receive buffers are on the device.
+ *
+ * parameters:
+ *   halo       <-- pointer to cs_halo_t structure.
+ *   hs         <-> pointer to halo state structure.
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_sync_start_persistent(const cs_halo_t  *halo,
+                            cs_halo_state_t  *hs)
+{
+  size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+  size_t recv_size = halo->n_elts[hs->sync_mode] * elt_size;
+
+  const void *send_buffer = hs->send_buffer_cur;
+  void *recv_buffer = nullptr;
+
+#if defined(HAVE_ACCEL)
+
+  if (hs->var_location > CS_ALLOC_HOST) {
+    if (hs->recv_buffer_d_size < recv_size) {
+      /* Buffer address changes, so matching requests are released */
+      _free_persistent_requests(nullptr, hs);
+      hs->recv_buffer_d_size = recv_size;
+      CS_FREE_HD(hs->recv_buffer_d);
+      CS_MALLOC_HD(hs->recv_buffer_d, hs->recv_buffer_d_size, unsigned char,
+                   CS_ALLOC_DEVICE);
+    }
+    send_buffer = cs_get_device_ptr_const(send_buffer);
+    recv_buffer = hs->recv_buffer_d;
+  }
+
+#endif
+
+  if (recv_buffer == nullptr) {
+    _update_recv_buffer(hs, recv_size);
+    recv_buffer = hs->recv_buffer;
+  }
+
+  _update_requests(halo, hs);
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      hs->local_rank_id = rank_id;
+  }
+
+  hs->persistent_id = _get_persistent_requests(halo,
+                                               send_buffer,
+                                               recv_buffer,
+                                               hs);
+
+  cs_halo_persistent_t *p = hs->persistent + hs->persistent_id;
+
+  if (p->n_recv > 0)
+    MPI_Startall(p->n_recv, p->request);
+
+  /* We may wait for posting all receives (sometimes recommended) */
+
+  if (_halo_use_barrier)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+  if (p->n_requests > p->n_recv)
+    MPI_Startall(p->n_requests - p->n_recv, p->request + p->n_recv);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete update of ghost values using persistent requests.
+ *
+ * parameters:
+ *   halo       <-- pointer to cs_halo_t structure.
+ *   val        <-> pointer to variable value array
+ *   hs         <-> pointer to halo state structure.
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_sync_complete_persistent(const cs_halo_t  *halo,
+                               void             *val,
+                               cs_halo_state_t  *hs)
+{
+  cs_halo_persistent_t *p = hs->persistent + hs->persistent_id;
+
+  if (p->n_requests > 0)
+    MPI_Waitall(p->n_requests, p->request, hs->status);
+
+  /* Copy received values to ghost elements
+     (local rank values, if present, are handled later) */
+
+  size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+  size_t n_loc_elts = halo->n_local_elts;
+
+  size_t n_bytes = halo->n_elts[hs->sync_mode]*elt_size;
+
+  unsigned char *restrict _val_dest
+    = (unsigned char *)val + n_loc_elts*elt_size;
+
+  if (p->n_recv > 0) {
+    if (hs->var_location == CS_ALLOC_HOST)
+      memcpy(_val_dest, p->recv_buffer, n_bytes);
+#if defined(HAVE_ACCEL)
+    else
+      cs_copy_d2d(_val_dest, p->recv_buffer, n_bytes);
+#endif
+  }
+
+  hs->persistent_id = -1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Exchange send shift in send buffer for one-sided get.
@@ -348,6 +701,108 @@ _sync_local(const cs_halo_t  *halo,
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Post non-blocking point-to-point exchanges of halo values.
+ *
+ * The halo state must have been initialized (see
+ * cs_halo_sync_pack_init_state).
+ *
+ * parameters:
+ *   halo       <-- pointer to halo structure
+ *   buffer     <-- packed send buffer
+ *   ghost_dest <-> start of destination array section for ghost values
+ *   hs         <-> pointer to halo state
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_sync_start_p2p(const cs_halo_t  *halo,
+                     unsigned char    *buffer,
+                     unsigned char    *ghost_dest,
+                     cs_halo_state_t  *hs)
+{
+#if defined(HAVE_MPI)
+
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  cs_lnum_t stride = hs->stride;
+  size_t elt_size = cs_datatype_size[hs->data_type] * stride;
+
+  _update_requests(halo, hs);
+
+  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[hs->data_type];
+
+  int request_count = 0;
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  /* Receive data from distant ranks */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                        - halo->index[2*rank_id]) * stride;
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      if (length > 0) {
+        size_t start = (size_t)(halo->index[2*rank_id]);
+        unsigned char *dest = ghost_dest + start*elt_size;
+
+        MPI_Irecv(dest,
+                  length*hs->stride,
+                  mpi_datatype,
+                  halo->c_domain_rank[rank_id],
+                  halo->c_domain_rank[rank_id],
+                  cs_glob_mpi_comm,
+                  &(hs->request[request_count++]));
+      }
+
+    }
+    else
+      hs->local_rank_id = rank_id;
+  }
+
+  /* We may wait for posting all receives (sometimes recommended) */
+
+  if (_halo_use_barrier)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+  /* Send data to distant ranks */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id]*elt_size;
+    cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                        - halo->send_index[2*rank_id]);
+
+    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+      MPI_Isend(buffer + start,
+                length*stride,
+                mpi_datatype,
+                halo->c_domain_rank[rank_id],
+                local_rank,
+                cs_glob_mpi_comm,
+                &(hs->request[request_count++]));
+
+  }
+
+  hs->n_requests = request_count;
+
+#else /* defined(HAVE_MPI) */
+
+  CS_UNUSED(buffer);
+  CS_UNUSED(ghost_dest);
+
+  const int local_rank = 0;
+
+  /* Receive data from distant ranks */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      hs->local_rank_id = rank_id;
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
 #if defined(HAVE_MPI)
 #if (MPI_VERSION >= 3)
 
@@ -650,7 +1105,7 @@ cs_halo_create_complete(cs_halo_t  *halo)
   }
 
   /* Create group for one-sided communication */
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     const int local_rank = CS_MAX(cs_glob_rank_id, 0);
     int n_group_ranks = 0;
     int *group_ranks = nullptr;
@@ -1082,6 +1537,8 @@ cs_halo_destroy(cs_halo_t  **halo)
   cs_halo_t  *_halo = *halo;
 
 #if defined(HAVE_MPI)
+  _free_persistent_requests(_halo, _halo_state);
+
   if (_halo->c_domain_group != MPI_GROUP_NULL)
     MPI_Group_free(&(_halo->c_domain_group));
 
@@ -1135,13 +1592,18 @@ cs_halo_state_create(void)
     .send_buffer_size = 0,
     .recv_buffer_size = 0,
     .send_buffer = nullptr,
-    .recv_buffer = nullptr
+    .recv_buffer = nullptr,
+    .recv_buffer_d_size = 0,
+    .recv_buffer_d = nullptr
 #if defined(HAVE_MPI)
     ,
     .request_size = 0,
     .request = nullptr,
     .status = nullptr,
-    .win = MPI_WIN_NULL
+    .win = MPI_WIN_NULL,
+    .persistent_id = -1,
+    .n_persistent = 0,
+    .persistent = nullptr
 
 #endif
   };
@@ -1177,8 +1639,10 @@ cs_halo_state_destroy(cs_halo_state_t  **halo_state)
 
     CS_FREE_HD(hs->send_buffer);
     CS_FREE_HD(hs->recv_buffer);
+    CS_FREE_HD(hs->recv_buffer_d);
 
 #if defined(HAVE_MPI)
+    _free_persistent_requests(nullptr, hs);
     BFT_FREE(hs->request);
     BFT_FREE(hs->status);
 #endif
@@ -1710,13 +2174,27 @@ cs_halo_sync_start(const cs_halo_t  *halo,
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_start_one_sided(halo, val, _hs);
     return;
   }
 #endif
 
-  cs_lnum_t end_shift = (_hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+#if defined(HAVE_MPI)
+  if (_halo_comm_mode == CS_HALO_COMM_PERSISTENT) {
+    bool use_persistent = (_hs->var_location == CS_ALLOC_HOST);
+#if defined(HAVE_ACCEL)
+    /* Device arrays are exchanged directly with device-aware MPI */
+    if (cs_mpi_device_support)
+      use_persistent = true;
+#endif
+    if (use_persistent) {
+      _halo_sync_start_persistent(halo, _hs);
+      return;
+    }
+  }
+#endif
+
   cs_lnum_t stride = _hs->stride;
   size_t elt_size = cs_datatype_size[_hs->data_type] * stride;
   size_t n_loc_elts = halo->n_local_elts;
@@ -1767,80 +2245,7 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
 #endif /* defined(HAVE_ACCEL) */
 
-#if defined(HAVE_MPI)
-
-  _update_requests(halo, _hs);
-
-  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[_hs->data_type];
-
-  int request_count = 0;
-  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
-
-  /* Receive data from distant ranks */
-
-  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
-                        - halo->index[2*rank_id]) * stride;
-
-    if (halo->c_domain_rank[rank_id] != local_rank) {
-
-      if (length > 0) {
-        size_t start = (size_t)(halo->index[2*rank_id]);
-        unsigned char *dest = _val_dest + start*elt_size;
-
-        MPI_Irecv(dest,
-                  length*_hs->stride,
-                  mpi_datatype,
-                  halo->c_domain_rank[rank_id],
-                  halo->c_domain_rank[rank_id],
-                  cs_glob_mpi_comm,
-                  &(_hs->request[request_count++]));
-      }
-
-    }
-    else
-      _hs->local_rank_id = rank_id;
-  }
-
-  /* We may wait for posting all receives (sometimes recommended) */
-
-  if (_halo_use_barrier)
-    MPI_Barrier(cs_glob_mpi_comm);
-
-  /* Send data to distant ranks */
-
-  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-    cs_lnum_t start = halo->send_index[2*rank_id]*elt_size;
-    cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
-                        - halo->send_index[2*rank_id]);
-
-    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
-      MPI_Isend(buffer + start,
-                length*stride,
-                mpi_datatype,
-                halo->c_domain_rank[rank_id],
-                local_rank,
-                cs_glob_mpi_comm,
-                &(_hs->request[request_count++]));
-
-  }
-
-  _hs->n_requests = request_count;
-
-#else /* defined(HAVE_MPI) */
-
-  const int local_rank = 0;
-
-  /* Receive data from distant ranks */
-
-  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-    if (halo->c_domain_rank[rank_id] == local_rank)
-      _hs->local_rank_id = rank_id;
-  }
-
-#endif /* defined(HAVE_MPI) */
+  _halo_sync_start_p2p(halo, buffer, _val_dest, _hs);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1871,9 +2276,21 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
 
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
+  /* Communication statistics (before state is reset) */
+
+  const int n_neighbors = halo->n_c_domains - ((_hs->local_rank_id > -1) ? 1:0);
+  const size_t n_bytes =   halo->n_send_elts[_hs->sync_mode]
+                         * cs_datatype_size[_hs->data_type] * _hs->stride;
+
+  cs_timer_t t_w0 = cs_timer_time();
+
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_complete_one_sided(halo, val, _hs);
+    cs_timer_t t_w1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_halo_wait_t, &t_w0, &t_w1);
+    cs_comm_stats_add(CS_COMM_STATS_HALO, n_neighbors, n_bytes, n_neighbors,
+                      (t_w1.sec - t_w0.sec) + (t_w1.nsec - t_w0.nsec)*1e-9);
     return;
   }
 #endif
@@ -1882,11 +2299,20 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
 
   /* Wait for all exchanges */
 
-  if (_hs->n_requests > 0)
+  if (_hs->persistent_id > -1)
+    _halo_sync_complete_persistent(halo, val, _hs);
+
+  else if (_hs->n_requests > 0)
     MPI_Waitall(_hs->n_requests, _hs->request, _hs->status);
 
 #endif /* defined(HAVE_MPI) */
 
+  cs_timer_t t_w1 = cs_timer_time();
+  cs_timer_counter_add_diff(&_halo_wait_t, &t_w0, &t_w1);
+
+  cs_comm_stats_add(CS_COMM_STATS_HALO, n_neighbors, n_bytes, n_neighbors,
+                    (t_w1.sec - t_w0.sec) + (t_w1.nsec - t_w0.nsec)*1e-9);
+
 #if defined(HAVE_ACCEL)
 
   if (   cs_mpi_device_support == 0
@@ -1956,6 +2382,8 @@ cs_halo_sync(const cs_halo_t  *halo,
   if (halo == nullptr)
     return;
 
+  cs_profiling_range_push("halo_sync", _halo_type_name[sync_mode]);
+
   cs_halo_sync_pack(halo,
                     sync_mode,
                     data_type,
@@ -1967,6 +2395,8 @@ cs_halo_sync(const cs_halo_t  *halo,
   cs_halo_sync_start(halo, val, nullptr);
 
   cs_halo_sync_wait(halo, val, nullptr);
+
+  cs_profiling_range_pop("halo_sync");
 }
 
 #if defined(HAVE_ACCEL)
@@ -2000,6 +2430,8 @@ cs_halo_sync_d(const cs_halo_t  *halo,
 
   cs_halo_state_t  *hs = _halo_state;
 
+  cs_profiling_range_push("halo_sync", _halo_type_name[sync_mode]);
+
   cs_halo_sync_pack_d(halo,
                       sync_mode,
                       data_type,
@@ -2010,6 +2442,8 @@ cs_halo_sync_d(const cs_halo_t  *halo,
 
   cs_halo_sync_start(halo, val, hs);
   cs_halo_sync_wait(halo, val, hs);
+
+  cs_profiling_range_pop("halo_sync");
 }
 
 #endif /* defined(HAVE_ACCEL) */
@@ -2110,6 +2544,130 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
   cs_halo_sync(halo, sync_mode, CS_REAL_TYPE, stride, var);
 }
 
+/*----------------------------------------------------------------------------
+ * Update several arrays of strided variable (floating-point) values in case
+ * of parallelism or periodicity, using a single exchange.
+ *
+ * Values of all arrays are packed in a common buffer, so that only
+ * one message is exchanged with each neighboring rank, rather than
+ * one message per array. Arrays must reside in host memory.
+ *
+ * As with cs_halo_sync_var_strided, rotation periodicity is not handled
+ * here, and must be applied to each array separately if needed.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   n_vars    <-- number of arrays to synchronize
+ *   stride    <-- number of (interlaced) values by entity for each array
+ *   var       <-> pointers to variable value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_multi(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   int               n_vars,
+                   const int         stride[],
+                   cs_real_t        *var[])
+{
+  if (halo == nullptr || n_vars < 1)
+    return;
+
+  if (n_vars == 1) {
+    cs_halo_sync(halo, sync_mode, CS_REAL_TYPE, stride[0], var[0]);
+    return;
+  }
+
+  cs_halo_state_t  *hs = _halo_state;
+
+  cs_lnum_t t_stride = 0;
+  for (int v_id = 0; v_id < n_vars; v_id++)
+    t_stride += stride[v_id];
+
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+
+  cs_real_t *send_buf
+    = (cs_real_t *)cs_halo_sync_pack_init_state(halo,
+                                                sync_mode,
+                                                CS_REAL_TYPE,
+                                                t_stride,
+                                                nullptr,
+                                                hs);
+
+  /* Pack values of all arrays, interleaved by element */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t start = halo->send_index[2*rank_id];
+    cs_lnum_t end = halo->send_index[2*rank_id + end_shift];
+
+#   pragma omp parallel for if (end - start > CS_THR_MIN)
+    for (cs_lnum_t i = start; i < end; i++) {
+      cs_lnum_t e_id = halo->send_list[i];
+      cs_real_t *_buf = send_buf + i*t_stride;
+      for (int v_id = 0; v_id < n_vars; v_id++) {
+        const cs_real_t *_var = var[v_id] + e_id*stride[v_id];
+        for (int k = 0; k < stride[v_id]; k++)
+          _buf[k] = _var[k];
+        _buf += stride[v_id];
+      }
+    }
+
+  }
+
+  /* Exchange packed values using the receive buffer */
+
+  _update_recv_buffer(hs, halo->n_elts[sync_mode]*t_stride*sizeof(cs_real_t));
+
+  cs_real_t *recv_buf = (cs_real_t *)(hs->recv_buffer);
+
+  _halo_sync_start_p2p(halo,
+                       (unsigned char *)send_buf,
+                       (unsigned char *)recv_buf,
+                       hs);
+
+#if defined(HAVE_MPI)
+  if (hs->n_requests > 0)
+    MPI_Waitall(hs->n_requests, hs->request, hs->status);
+#endif
+
+  /* Copy local values in case of periodicity */
+
+  if (hs->local_rank_id > -1) {
+    int r_id = hs->local_rank_id;
+    cs_lnum_t length = (  halo->send_index[2*r_id + end_shift]
+                        - halo->send_index[2*r_id]);
+    memcpy(recv_buf + halo->index[2*r_id]*t_stride,
+           send_buf + halo->send_index[2*r_id]*t_stride,
+           length*t_stride*sizeof(cs_real_t));
+  }
+
+  /* Unpack to ghost values of each array */
+
+  const cs_lnum_t n_loc_elts = halo->n_local_elts;
+  const cs_lnum_t n_elts = halo->n_elts[sync_mode];
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    const cs_real_t *_buf = recv_buf + i*t_stride;
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      cs_real_t *_var = var[v_id] + (n_loc_elts + i)*stride[v_id];
+      for (int k = 0; k < stride[v_id]; k++)
+        _var[k] = _buf[k];
+      _buf += stride[v_id];
+    }
+  }
+
+  /* Cleanup */
+
+  hs->sync_mode = CS_HALO_STANDARD;
+  hs->data_type = CS_DATATYPE_NULL;
+  hs->stride = 0;
+  hs->send_buffer_cur = nullptr;
+  hs->n_requests = 0;
+  hs->local_rank_id  = -1;
+}
+
 /*----------------------------------------------------------------------------
  * Return MPI_Barrier usage flag.
  *
@@ -2163,8 +2721,93 @@ cs_halo_get_comm_mode(void)
 void
 cs_halo_set_comm_mode(cs_halo_comm_mode_t  mode)
 {
-  if (mode >= CS_HALO_COMM_P2P && mode <= CS_HALO_COMM_RMA_GET)
+  if (mode >= CS_HALO_COMM_P2P && mode <= CS_HALO_COMM_PERSISTENT) {
     _halo_comm_mode = mode;
+    _halo_comm_mode_is_set = true;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select default communication mode for halo exchange based on
+ *        a short benchmark.
+ *
+ * Non-blocking and persistent point-to-point modes are timed on the
+ * given halo, and the fastest one (based on the slowest rank) is set as
+ * the default mode. If a communication mode was set explicitely using
+ * \ref cs_halo_set_comm_mode, it is kept.
+ *
+ * This function must be called simultaneously by all ranks.
+ *
+ * \param[in]  halo  pointer to halo structure used for the benchmark
+ *
+ * \return  selected communication mode
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_comm_mode_t
+cs_halo_select_comm_mode(const cs_halo_t  *halo)
+{
+#if defined(HAVE_MPI)
+
+  if (halo == nullptr || cs_glob_n_ranks < 2 || _halo_comm_mode_is_set)
+    return _halo_comm_mode;
+
+  /* Use a small number of exchanges with a moderate stride, representative
+     of gradient or matrix-vector product synchronizations */
+
+  const int n_runs = 20;
+  const int stride = 3;
+  const int n_modes = 2;
+  const cs_halo_comm_mode_t modes[] = {CS_HALO_COMM_P2P,
+                                       CS_HALO_COMM_PERSISTENT};
+
+  cs_lnum_t n_vals = (halo->n_local_elts + halo->n_elts[CS_HALO_EXTENDED]);
+
+  cs_real_t *val;
+  BFT_MALLOC(val, n_vals*stride, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_vals*stride; i++)
+    val[i] = i%stride;
+
+  double t_mode[2];
+
+  for (int m_id = 0; m_id < n_modes; m_id++) {
+    _halo_comm_mode = modes[m_id];
+
+    /* Warm-up run (also builds persistent requests) */
+    cs_halo_sync(halo, CS_HALO_STANDARD, CS_REAL_TYPE, stride, val);
+
+    MPI_Barrier(cs_glob_mpi_comm);
+    double t0 = cs_timer_wtime();
+    for (int run_id = 0; run_id < n_runs; run_id++)
+      cs_halo_sync(halo, CS_HALO_STANDARD, CS_REAL_TYPE, stride, val);
+    t_mode[m_id] = cs_timer_wtime() - t0;
+  }
+
+  double t_max[2];
+  MPI_Allreduce(t_mode, t_max, n_modes, MPI_DOUBLE, MPI_MAX,
+                cs_glob_mpi_comm);
+
+  BFT_FREE(val);
+
+  _halo_comm_mode = (t_max[1] < t_max[0]) ? modes[1] : modes[0];
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nHalo exchange mode selection (%d exchanges)\n\n"
+                  "  non-blocking point-to-point:  %.3g s\n"
+                  "  persistent point-to-point:    %.3g s\n"
+                  "  selected: %s\n"),
+                n_runs, t_max[0], t_max[1],
+                (_halo_comm_mode == CS_HALO_COMM_PERSISTENT) ?
+                _("persistent") : _("non-blocking"));
+
+#else
+
+  CS_UNUSED(halo);
+
+#endif /* defined(HAVE_MPI) */
+
+  return _halo_comm_mode;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2195,6 +2838,19 @@ cs_halo_set_buffer_alloc_mode(cs_alloc_mode_t  mode)
   _halo_buffer_alloc_mode = mode;
 }
 
+/*----------------------------------------------------------------------------
+ * Return time spent waiting for completion of halo exchanges.
+ *
+ * returns:
+ *   cumulative wait time (in seconds)
+ *---------------------------------------------------------------------------*/
+
+double
+cs_halo_get_wait_time(void)
+{
+  return _halo_wait_t.nsec*1e-9;
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
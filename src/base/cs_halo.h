@@ -66,8 +66,10 @@ typedef enum {
 typedef enum {
 
   CS_HALO_COMM_P2P,      /*!< non-blocking point-to-point communication */
-  CS_HALO_COMM_RMA_GET   /*!< MPI-3 one-sided with get semantics and
+  CS_HALO_COMM_RMA_GET,  /*!< MPI-3 one-sided with get semantics and
                            active target synchronization */
+  CS_HALO_COMM_PERSISTENT  /*!< persistent point-to-point communication,
+                             with requests reused across exchanges */
 
 } cs_halo_comm_mode_t;
 
@@ -635,6 +637,32 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
                          cs_real_t         var[],
                          int               stride);
 
+/*----------------------------------------------------------------------------
+ * Update several arrays of strided variable (floating-point) values in case
+ * of parallelism or periodicity, using a single exchange.
+ *
+ * Values of all arrays are packed in a common buffer, so that only
+ * one message is exchanged with each neighboring rank, rather than
+ * one message per array. Arrays must reside in host memory.
+ *
+ * As with cs_halo_sync_var_strided, rotation periodicity is not handled
+ * here, and must be applied to each array separately if needed.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   n_vars    <-- number of arrays to synchronize
+ *   stride    <-- number of (interlaced) values by entity for each array
+ *   var       <-> pointers to variable value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_multi(const cs_halo_t  *halo,
+                   cs_halo_type_t    sync_mode,
+                   int               n_vars,
+                   const int         stride[],
+                   cs_real_t        *var[]);
+
 /*----------------------------------------------------------------------------
  * Return MPI_Barrier usage flag.
  *
@@ -679,6 +707,27 @@ cs_halo_get_comm_mode(void);
 void
 cs_halo_set_comm_mode(cs_halo_comm_mode_t  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select default communication mode for halo exchange based on
+ *        a short benchmark.
+ *
+ * Non-blocking and persistent point-to-point modes are timed on the
+ * given halo, and the fastest one (based on the slowest rank) is set as
+ * the default mode. If a communication mode was set explicitely using
+ * \ref cs_halo_set_comm_mode, it is kept.
+ *
+ * This function must be called simultaneously by all ranks.
+ *
+ * \param[in]  halo  pointer to halo structure used for the benchmark
+ *
+ * \return  selected communication mode
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_comm_mode_t
+cs_halo_select_comm_mode(const cs_halo_t  *halo);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get default host/device allocation mode for message packing arrays.
@@ -701,6 +750,16 @@ cs_halo_get_buffer_alloc_mode(void);
 void
 cs_halo_set_buffer_alloc_mode(cs_alloc_mode_t  mode);
 
+/*----------------------------------------------------------------------------
+ * Return time spent waiting for completion of halo exchanges.
+ *
+ * returns:
+ *   cumulative wait time (in seconds)
+ *---------------------------------------------------------------------------*/
+
+double
+cs_halo_get_wait_time(void);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
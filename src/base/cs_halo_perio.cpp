@@ -47,6 +47,8 @@
 #include "fvm_periodicity.h"
 
 #include "cs_base.h"
+#include "cs_base_accel.h"
+#include "cs_dispatch.h"
 #include "cs_halo.h"
 #include "cs_interface.h"
 #include "cs_mesh.h"
@@ -96,14 +98,6 @@ typedef struct {
  * Static global variables
  *============================================================================*/
 
-/* Table giving the Reynolds stress component for [i][j] */
-
-/* Warning: old fashion to store Rij */
-
-static const int _symt[3][3] = {{0, 3, 5},
-                                {3, 1, 4},
-                                {5, 4, 2}};
-
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -164,9 +158,9 @@ _apply_vector_transfo(cs_real_t    matrix[3][4],
  *   xyz          <-> array of coordinates
  *----------------------------------------------------------------------------*/
 
-static void
-_apply_vector_rotation(cs_real_t    matrix[3][4],
-                       cs_real_t   *xyz)
+CS_F_HOST_DEVICE static inline void
+_apply_vector_rotation(const cs_real_t  matrix[3][4],
+                       cs_real_t        *xyz)
 {
   cs_lnum_t  i;
 
@@ -191,9 +185,9 @@ _apply_vector_rotation(cs_real_t    matrix[3][4],
  *   tensor              <-> incoming 3x3 tensor
  *----------------------------------------------------------------------------*/
 
-static void
-_apply_tensor_rotation(cs_real_t   matrix[3][4],
-                       cs_real_t   *tensor)
+CS_F_HOST_DEVICE static inline void
+_apply_tensor_rotation(const cs_real_t  matrix[3][4],
+                       cs_real_t        *tensor)
 {
   cs_lnum_t  i, j, k, l;
 
@@ -227,9 +221,9 @@ _apply_tensor_rotation(cs_real_t   matrix[3][4],
  *   tensor              <-> incoming (6) symmetric tensor
  *----------------------------------------------------------------------------*/
 
-static void
-_apply_sym_tensor_rotation(cs_real_t   matrix[3][4],
-                           cs_real_t   *tensor)
+CS_F_HOST_DEVICE static inline void
+_apply_sym_tensor_rotation(const cs_real_t  matrix[3][4],
+                           cs_real_t        *tensor)
 {
   cs_lnum_t  i, j, k, l;
 
@@ -266,9 +260,8 @@ _apply_sym_tensor_rotation(cs_real_t   matrix[3][4],
   tensor[1] = t0[1][1];
   tensor[2] = t0[2][2];
   tensor[3] = t0[0][1];
-  tensor[3] = t0[1][0];
-  tensor[4] = t0[2][1];
-  tensor[5] = t0[2][0];
+  tensor[4] = t0[1][2];
+  tensor[5] = t0[0][2];
 
 }
 
@@ -286,20 +279,26 @@ _apply_sym_tensor_rotation(cs_real_t   matrix[3][4],
  *                           (in fact 3x6 due to symmetry)
  *----------------------------------------------------------------------------*/
 
-static void
-_apply_tensor3sym_rotation(cs_real_t   matrix[3][4],
-                           cs_real_t   *tensor)
+CS_F_HOST_DEVICE static inline void
+_apply_tensor3sym_rotation(const cs_real_t  matrix[3][4],
+                           cs_real_t        *tensor)
 {
   cs_lnum_t  i, j, k, p, q, r;
 
   cs_real_t  t1[3][3][3], t2[3][3][3];
 
+  /* Reynolds stress component for [i][j] (Rij stored old fashion) */
+
+  const int symt[3][3] = {{0, 3, 5},
+                          {3, 1, 4},
+                          {5, 4, 2}};
+
   for (p = 0; p < 3; p++) {
     for (q = 0; q < 3; q++) {
       for (k = 0; k < 3; k++) {
         t1[p][q][k] = 0.;
         for (r = 0; r < 3; r++)
-          t1[p][q][k] += matrix[k][r] * tensor[3*_symt[p][q] + r];
+          t1[p][q][k] += matrix[k][r] * tensor[3*symt[p][q] + r];
       }
     }
   }
@@ -321,7 +320,7 @@ _apply_tensor3sym_rotation(cs_real_t   matrix[3][4],
   for (i = 0; i < 3; i++) {
     for (j = 0; j < 3; j++) {
       for (k = 0; k < 3; k++)
-        tensor[3*_symt[i][j] + k] = t2[i][j][k];
+        tensor[3*symt[i][j] + k] = t2[i][j][k];
     }
   }
 
@@ -349,6 +348,70 @@ _test_halo_compatibility(const cs_halo_t  *halo)
               halo->n_transforms, (int)(cs_glob_mesh->n_transforms));
 }
 
+/*----------------------------------------------------------------------------
+ * Return ranges of halo elements associated with a given transformation
+ * and communicating rank.
+ *
+ * Standard and extended halo elements are not contiguous, so both ranges
+ * are returned; a single loop of n_std + n_ext iterations may then cover
+ * both.
+ *
+ * parameters:
+ *   halo      --> pointer to halo structure
+ *   sync_mode --> kind of halo treatment (standard or extended)
+ *   t_id      --> transformation id
+ *   rank_id   --> communicating rank id in halo
+ *   s_std     <-- start of standard range (relative to halo start)
+ *   n_std     <-- number of elements in standard range
+ *   s_ext     <-- start of extended range (relative to halo start)
+ *   n_ext     <-- number of elements in extended range
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_perio_ranges(const cs_halo_t  *halo,
+              cs_halo_type_t    sync_mode,
+              int               t_id,
+              int               rank_id,
+              cs_lnum_t        *s_std,
+              cs_lnum_t        *n_std,
+              cs_lnum_t        *s_ext,
+              cs_lnum_t        *n_ext)
+{
+  const cs_lnum_t  shift = 4*halo->n_c_domains*t_id + 4*rank_id;
+
+  *s_std = halo->perio_lst[shift];
+  *n_std = halo->perio_lst[shift + 1];
+
+  if (sync_mode == CS_HALO_EXTENDED) {
+    *s_ext = halo->perio_lst[shift + 2];
+    *n_ext = halo->perio_lst[shift + 3];
+  }
+  else {
+    *s_ext = 0;
+    *n_ext = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize a dispatch context for periodic rotation of halo values.
+ *
+ * Rotations are applied on the device when the array is device-accessible,
+ * so that a halo synchronized on the device does not need to be copied
+ * back to the host.
+ *
+ * parameters:
+ *   ctx <-> dispatch context
+ *   var --> values to update
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_perio_ctx_init(cs_dispatch_context  &ctx,
+                const cs_real_t       var[])
+{
+  if (cs_check_device_ptr(var) == CS_ALLOC_HOST)
+    ctx.set_use_gpu(false);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -442,55 +505,50 @@ cs_halo_perio_sync_var_vect(const cs_halo_t  *halo,
       || cs_glob_mesh->have_rotation_perio == 0)
     return;
 
-  int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
-
-  cs_real_t matrix[3][4];
-
   fvm_periodicity_type_t perio_type = FVM_PERIODICITY_NULL;
 
   const int  n_transforms = halo->n_transforms;
   const cs_lnum_t  n_elts   = halo->n_local_elts;
-  const fvm_periodicity_t  *periodicity = cs_glob_mesh->periodicity;
+  const fvm_periodicity_t *periodicity = cs_glob_mesh->periodicity;
 
   assert(halo != nullptr);
   assert(incvar == 3);
 
   _test_halo_compatibility(halo);
 
-  for (t_id = 0; t_id < n_transforms; t_id++) {
-
-    shift = 4 * halo->n_c_domains * t_id;
-
-    perio_type = fvm_periodicity_get_type(periodicity, t_id);
+  cs_dispatch_context ctx;
+  _perio_ctx_init(ctx, var);
 
-    if (perio_type >= FVM_PERIODICITY_ROTATION) {
+  /* Standard and extended ranges are handled in a single loop
+     for each transformation and rank */
 
-      fvm_periodicity_get_matrix(periodicity, t_id, matrix);
+  for (int t_id = 0; t_id < n_transforms; t_id++) {
 
-      for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    perio_type = fvm_periodicity_get_type(periodicity, t_id);
 
-        start_std = n_elts + halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
+    if (perio_type < FVM_PERIODICITY_ROTATION)
+      continue;
 
-        for (i = start_std; i < end_std; i++)
-          _apply_vector_rotation(matrix, var + i*incvar);
+    cs_real_t  matrix[3][4];
+    fvm_periodicity_get_matrix(periodicity, t_id, matrix);
 
-        if (sync_mode == CS_HALO_EXTENDED) {
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-          start_ext = n_elts + halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+      cs_lnum_t  s_std, n_std, s_ext, n_ext;
+      _perio_ranges(halo, sync_mode, t_id, rank_id,
+                    &s_std, &n_std, &s_ext, &n_ext);
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_vector_rotation(matrix, var + i*incvar);
+      ctx.parallel_for(n_std + n_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+        cs_lnum_t i = (ii < n_std) ? s_std + ii : s_ext + ii - n_std;
+        i += n_elts;
+        _apply_vector_rotation(matrix, var + 3*i);
+      });
 
-        }
-
-      } /* End of loop on ranks */
+    } /* End of loop on ranks */
 
-    } /* End of the treatment of rotation */
+  } /* End of loop on transformations for the local rank */
 
-  } /* End of loop on transformations */
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------
@@ -512,11 +570,6 @@ cs_halo_perio_sync_var_tens(const cs_halo_t  *halo,
       || cs_glob_mesh->have_rotation_perio == 0)
     return;
 
-  int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
-
-  cs_real_t  matrix[3][4];
-
   fvm_periodicity_type_t perio_type = FVM_PERIODICITY_NULL;
 
   const int  n_transforms = halo->n_transforms;
@@ -527,39 +580,39 @@ cs_halo_perio_sync_var_tens(const cs_halo_t  *halo,
 
   _test_halo_compatibility(halo);
 
-  for (t_id = 0; t_id < n_transforms; t_id++) {
-
-    shift = 4 * halo->n_c_domains * t_id;
-
-    perio_type = fvm_periodicity_get_type(periodicity, t_id);
-
-    if (perio_type >= FVM_PERIODICITY_ROTATION) {
+  cs_dispatch_context ctx;
+  _perio_ctx_init(ctx, var);
 
-      fvm_periodicity_get_matrix(periodicity, t_id, matrix);
+  /* Standard and extended ranges are handled in a single loop
+     for each transformation and rank */
 
-      for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+  for (int t_id = 0; t_id < n_transforms; t_id++) {
 
-        start_std = halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
-
-        for (i = start_std; i < end_std; i++)
-          _apply_tensor_rotation(matrix, var + 9*(n_elts+i));
+    perio_type = fvm_periodicity_get_type(periodicity, t_id);
 
-        if (sync_mode == CS_HALO_EXTENDED) {
+    if (perio_type < FVM_PERIODICITY_ROTATION)
+      continue;
 
-          start_ext = halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+    cs_real_t  matrix[3][4];
+    fvm_periodicity_get_matrix(periodicity, t_id, matrix);
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_tensor_rotation(matrix, var + 9*(n_elts+i));
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-        } /* End of the treatment of rotation */
+      cs_lnum_t  s_std, n_std, s_ext, n_ext;
+      _perio_ranges(halo, sync_mode, t_id, rank_id,
+                    &s_std, &n_std, &s_ext, &n_ext);
 
-      } /* End if halo is extended */
+      ctx.parallel_for(n_std + n_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+        cs_lnum_t i = (ii < n_std) ? s_std + ii : s_ext + ii - n_std;
+        i += n_elts;
+        _apply_tensor_rotation(matrix, var + 9*i);
+      });
 
     } /* End of loop on ranks */
 
   } /* End of loop on transformations for the local rank */
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------
@@ -582,11 +635,6 @@ cs_halo_perio_sync_var_sym_tens(const cs_halo_t  *halo,
       || cs_glob_mesh->have_rotation_perio == 0)
     return;
 
-  int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
-
-  cs_real_t  matrix[3][4];
-
   fvm_periodicity_type_t perio_type = FVM_PERIODICITY_NULL;
 
   const int  n_transforms = halo->n_transforms;
@@ -597,39 +645,39 @@ cs_halo_perio_sync_var_sym_tens(const cs_halo_t  *halo,
 
   _test_halo_compatibility(halo);
 
-  for (t_id = 0; t_id < n_transforms; t_id++) {
-
-    shift = 4 * halo->n_c_domains * t_id;
-
-    perio_type = fvm_periodicity_get_type(periodicity, t_id);
+  cs_dispatch_context ctx;
+  _perio_ctx_init(ctx, var);
 
-    if (perio_type >= FVM_PERIODICITY_ROTATION) {
+  /* Standard and extended ranges are handled in a single loop
+     for each transformation and rank */
 
-      fvm_periodicity_get_matrix(periodicity, t_id, matrix);
+  for (int t_id = 0; t_id < n_transforms; t_id++) {
 
-      for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-        start_std = halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
-
-        for (i = start_std; i < end_std; i++)
-          _apply_sym_tensor_rotation(matrix, var + 6*(n_elts+i));
+    perio_type = fvm_periodicity_get_type(periodicity, t_id);
 
-        if (sync_mode == CS_HALO_EXTENDED) {
+    if (perio_type < FVM_PERIODICITY_ROTATION)
+      continue;
 
-          start_ext = halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+    cs_real_t  matrix[3][4];
+    fvm_periodicity_get_matrix(periodicity, t_id, matrix);
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_sym_tensor_rotation(matrix, var + 6*(n_elts+i));
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-        } /* End of the treatment of rotation */
+      cs_lnum_t  s_std, n_std, s_ext, n_ext;
+      _perio_ranges(halo, sync_mode, t_id, rank_id,
+                    &s_std, &n_std, &s_ext, &n_ext);
 
-      } /* End if halo is extended */
+      ctx.parallel_for(n_std + n_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+        cs_lnum_t i = (ii < n_std) ? s_std + ii : s_ext + ii - n_std;
+        i += n_elts;
+        _apply_sym_tensor_rotation(matrix, var + 6*i);
+      });
 
     } /* End of loop on ranks */
 
   } /* End of loop on transformations for the local rank */
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------
@@ -652,11 +700,6 @@ cs_halo_perio_sync_var_sym_tens_grad(const cs_halo_t  *halo,
       || cs_glob_mesh->have_rotation_perio == 0)
     return;
 
-  int  rank_id, t_id;
-  cs_lnum_t  i, shift, start_std, end_std, start_ext, end_ext;
-
-  cs_real_t  matrix[3][4];
-
   fvm_periodicity_type_t perio_type = FVM_PERIODICITY_NULL;
 
   const int  n_transforms = halo->n_transforms;
@@ -667,39 +710,39 @@ cs_halo_perio_sync_var_sym_tens_grad(const cs_halo_t  *halo,
 
   _test_halo_compatibility(halo);
 
-  for (t_id = 0; t_id < n_transforms; t_id++) {
-
-    shift = 4 * halo->n_c_domains * t_id;
-
-    perio_type = fvm_periodicity_get_type(periodicity, t_id);
+  cs_dispatch_context ctx;
+  _perio_ctx_init(ctx, var);
 
-    if (perio_type >= FVM_PERIODICITY_ROTATION) {
+  /* Standard and extended ranges are handled in a single loop
+     for each transformation and rank */
 
-      fvm_periodicity_get_matrix(periodicity, t_id, matrix);
+  for (int t_id = 0; t_id < n_transforms; t_id++) {
 
-      for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-        start_std =n_elts +  halo->perio_lst[shift + 4*rank_id];
-        end_std = start_std + halo->perio_lst[shift + 4*rank_id + 1];
-
-        for (i = start_std; i < end_std; i++)
-          _apply_tensor3sym_rotation(matrix, var + 18*i);
+    perio_type = fvm_periodicity_get_type(periodicity, t_id);
 
-        if (sync_mode == CS_HALO_EXTENDED) {
+    if (perio_type < FVM_PERIODICITY_ROTATION)
+      continue;
 
-          start_ext = n_elts + halo->perio_lst[shift + 4*rank_id + 2];
-          end_ext = start_ext + halo->perio_lst[shift + 4*rank_id + 3];
+    cs_real_t  matrix[3][4];
+    fvm_periodicity_get_matrix(periodicity, t_id, matrix);
 
-          for (i = start_ext; i < end_ext; i++)
-            _apply_tensor3sym_rotation(matrix, var + 18*i);
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-        } /* End of the treatment of rotation */
+      cs_lnum_t  s_std, n_std, s_ext, n_ext;
+      _perio_ranges(halo, sync_mode, t_id, rank_id,
+                    &s_std, &n_std, &s_ext, &n_ext);
 
-      } /* End if halo is extended */
+      ctx.parallel_for(n_std + n_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+        cs_lnum_t i = (ii < n_std) ? s_std + ii : s_ext + ii - n_std;
+        i += n_elts;
+        _apply_tensor3sym_rotation(matrix, var + 18*i);
+      });
 
     } /* End of loop on ranks */
 
   } /* End of loop on transformations for the local rank */
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
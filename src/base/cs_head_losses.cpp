@@ -53,6 +53,7 @@
 #include "cs_parall.h"
 #include "cs_mesh_location.h"
 #include "cs_prototypes.h"
+#include "cs_volume_zone.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -87,6 +88,12 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Cache for constant head loss coefficients, indexed by zone id */
+
+static int            _n_cache_zones = 0;
+static bool          *_zone_is_constant = nullptr;
+static cs_real_6_t  **_zone_cku = nullptr;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -95,6 +102,30 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Ensure the zone cache arrays are sized for the current number of zones.
+ *
+ * parameters:
+ *   n_zones <-- number of volume zones
+ *----------------------------------------------------------------------------*/
+
+static void
+_ensure_cache_size(int  n_zones)
+{
+  if (n_zones <= _n_cache_zones)
+    return;
+
+  BFT_REALLOC(_zone_is_constant, n_zones, bool);
+  BFT_REALLOC(_zone_cku, n_zones, cs_real_6_t *);
+
+  for (int i = _n_cache_zones; i < n_zones; i++) {
+    _zone_is_constant[i] = false;
+    _zone_cku[i] = nullptr;
+  }
+
+  _n_cache_zones = n_zones;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -148,6 +179,18 @@ cs_head_losses_compute(cs_real_6_t cku[])
       const cs_lnum_t n_z_cells = z->n_elts;
       cs_real_6_t *_cku = cku + n_p_cells;
 
+      /* Reuse precomputed values for constant zones */
+
+      const bool is_constant
+        = (   i < _n_cache_zones && _zone_is_constant[i]
+           && z->time_varying == false);
+
+      if (is_constant && _zone_cku[i] != nullptr) {
+        memcpy(_cku, _zone_cku[i], n_z_cells*sizeof(cs_real_6_t));
+        n_p_cells += n_z_cells;
+        continue;
+      }
+
       /* Initialize */
 
       for (cs_lnum_t j = 0; j < n_z_cells; j++) {
@@ -160,6 +203,11 @@ cs_head_losses_compute(cs_real_6_t cku[])
       cs_gui_head_losses(z, cvara_vel, _cku);
       cs_user_head_losses(z, _cku);
 
+      if (is_constant) {
+        BFT_MALLOC(_zone_cku[i], n_z_cells, cs_real_6_t);
+        memcpy(_zone_cku[i], _cku, n_z_cells*sizeof(cs_real_6_t));
+      }
+
       /* update previous cells accumulator */
 
       n_p_cells += n_z_cells;
@@ -169,6 +217,53 @@ cs_head_losses_compute(cs_real_6_t cku[])
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate that head loss coefficients of a given zone are constant
+ *        in time.
+ *
+ * Coefficients of such zones are computed once (at the first call to
+ * \ref cs_head_losses_compute), then reused at subsequent time steps.
+ * This should only be used when the user and GUI definitions do not depend
+ * on the time or on the flow (the GUI definition depends on the velocity
+ * norm, so this is mostly useful for user-defined zones).
+ *
+ * \param[in]  zone_name  name of associated volume zone
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_head_losses_set_constant(const char  *zone_name)
+{
+  const cs_zone_t *z = cs_volume_zone_by_name(zone_name);
+
+  if (! (z->type & CS_VOLUME_ZONE_HEAD_LOSS))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: zone \"%s\" is not a head loss zone."),
+              __func__, zone_name);
+
+  _ensure_cache_size(cs_volume_zone_n_zones());
+
+  _zone_is_constant[z->id] = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free head loss coefficients cache.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_head_losses_finalize(void)
+{
+  for (int i = 0; i < _n_cache_zones; i++)
+    BFT_FREE(_zone_cku[i]);
+
+  BFT_FREE(_zone_cku);
+  BFT_FREE(_zone_is_constant);
+  _n_cache_zones = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -64,6 +64,33 @@ BEGIN_C_DECLS
 void
 cs_head_losses_compute(cs_real_6_t cku[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate that head loss coefficients of a given zone are constant
+ *        in time.
+ *
+ * Coefficients of such zones are computed once (at the first call to
+ * \ref cs_head_losses_compute), then reused at subsequent time steps.
+ * This should only be used when the user and GUI definitions do not depend
+ * on the time or on the flow (the GUI definition depends on the velocity
+ * norm, so this is mostly useful for user-defined zones).
+ *
+ * \param[in]  zone_name  name of associated volume zone
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_head_losses_set_constant(const char  *zone_name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free head loss coefficients cache.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_head_losses_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -2259,6 +2259,174 @@ _add_global_equiv_periodic(cs_interface_set_t       *ifs,
   BFT_FREE(part_equiv);
 }
 
+/*----------------------------------------------------------------------------
+ * Creation of a list of interfaces between elements of a same type,
+ * restricted to a known set of neighboring ranks.
+ *
+ * Instead of a global all-to-all exchange through blocks distributed
+ * by global number, each rank sends its ordered list of global numbers
+ * to its neighbors only, and matches are determined by merging ordered
+ * lists, so the cost depends on the neighborhood, not on the number of
+ * ranks.
+ *
+ * All ranks sharing elements must be present in the neighbor lists
+ * (which must be symmetric).
+ *
+ * parameters:
+ *   ifs            <-> pointer to structure that should be updated
+ *   n_elts         <-- local number of elements
+ *   global_num     <-- global number (id) associated with each element
+ *   n_neighbors    <-- number of neighboring ranks
+ *   neighbor_rank  <-- neighboring rank ids
+ *   comm           <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_global_equiv_neighbors(cs_interface_set_t  *ifs,
+                            cs_lnum_t            n_elts,
+                            const cs_gnum_t      global_num[],
+                            int                  n_neighbors,
+                            const int            neighbor_rank[],
+                            MPI_Comm             comm)
+{
+  int  local_rank;
+  MPI_Comm_rank(comm, &local_rank);
+
+  /* Local ordered list of global numbers */
+
+  cs_lnum_t *order = cs_order_gnum(nullptr, global_num, n_elts);
+
+  cs_gnum_t *s_gnum;
+  BFT_MALLOC(s_gnum, n_elts, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < n_elts; i++)
+    s_gnum[i] = global_num[order[i]];
+
+  /* List of distant neighbors */
+
+  int n_nb = 0;
+  int *nb_rank;
+  BFT_MALLOC(nb_rank, n_neighbors, int);
+  for (int i = 0; i < n_neighbors; i++) {
+    if (neighbor_rank[i] != local_rank)
+      nb_rank[n_nb++] = neighbor_rank[i];
+  }
+
+  /* Exchange counts, then ordered global numbers and matching ids */
+
+  MPI_Request *request;
+  MPI_Status *status;
+  BFT_MALLOC(request, 4*n_nb, MPI_Request);
+  BFT_MALLOC(status, 4*n_nb, MPI_Status);
+
+  cs_lnum_t *recv_index;
+  BFT_MALLOC(recv_index, n_nb+1, cs_lnum_t);
+
+  const int local_tag = 'i'+'f'+'n';
+
+  for (int i = 0; i < n_nb; i++)
+    MPI_Irecv(recv_index + i + 1, 1, CS_MPI_LNUM, nb_rank[i],
+              local_tag, comm, &(request[i]));
+  for (int i = 0; i < n_nb; i++)
+    MPI_Isend(&n_elts, 1, CS_MPI_LNUM, nb_rank[i],
+              local_tag, comm, &(request[n_nb + i]));
+
+  MPI_Waitall(2*n_nb, request, status);
+
+  recv_index[0] = 0;
+  for (int i = 0; i < n_nb; i++)
+    recv_index[i+1] += recv_index[i];
+
+  cs_gnum_t *recv_gnum;
+  cs_lnum_t *recv_id;
+  BFT_MALLOC(recv_gnum, recv_index[n_nb], cs_gnum_t);
+  BFT_MALLOC(recv_id, recv_index[n_nb], cs_lnum_t);
+
+  for (int i = 0; i < n_nb; i++) {
+    int n_recv = recv_index[i+1] - recv_index[i];
+    MPI_Irecv(recv_gnum + recv_index[i], n_recv, CS_MPI_GNUM, nb_rank[i],
+              local_tag + 1, comm, &(request[2*i]));
+    MPI_Irecv(recv_id + recv_index[i], n_recv, CS_MPI_LNUM, nb_rank[i],
+              local_tag + 2, comm, &(request[2*i + 1]));
+  }
+  for (int i = 0; i < n_nb; i++) {
+    MPI_Isend(s_gnum, n_elts, CS_MPI_GNUM, nb_rank[i],
+              local_tag + 1, comm, &(request[2*n_nb + 2*i]));
+    MPI_Isend(order, n_elts, CS_MPI_LNUM, nb_rank[i],
+              local_tag + 2, comm, &(request[2*n_nb + 2*i + 1]));
+  }
+
+  MPI_Waitall(4*n_nb, request, status);
+
+  BFT_FREE(status);
+  BFT_FREE(request);
+
+  /* Match ordered lists; a first pass counts, a second pass builds
+     flat equivalence data (see _interfaces_from_flat_equiv):
+     {local_num, 1, distant_num, distant_rank} for each match */
+
+  cs_lnum_t n_vals = 0;
+  cs_lnum_t *equiv = nullptr;
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    cs_lnum_t n_matches = 0;
+
+    for (int i = 0; i < n_nb; i++) {
+
+      const cs_gnum_t *d_gnum = recv_gnum + recv_index[i];
+      const cs_lnum_t *d_id = recv_id + recv_index[i];
+      const cs_lnum_t n_d = recv_index[i+1] - recv_index[i];
+
+      cs_lnum_t j = 0, k = 0;
+      while (j < n_elts && k < n_d) {
+        if (s_gnum[j] < d_gnum[k])
+          j++;
+        else if (s_gnum[j] > d_gnum[k])
+          k++;
+        else {
+          const cs_gnum_t g = s_gnum[j];
+          cs_lnum_t k_s = k;
+          for (; j < n_elts && s_gnum[j] == g; j++) {
+            for (k = k_s; k < n_d && d_gnum[k] == g; k++) {
+              if (pass == 1) {
+                cs_lnum_t *e = equiv + n_matches*4;
+                e[0] = order[j] + 1;
+                e[1] = 1;
+                e[2] = d_id[k] + 1;
+                e[3] = nb_rank[i];
+              }
+              n_matches++;
+            }
+          }
+        }
+      }
+
+    }
+
+    if (pass == 0) {
+      n_vals = n_matches*4;
+      BFT_MALLOC(equiv, n_vals, cs_lnum_t);
+    }
+
+  }
+
+  BFT_FREE(recv_id);
+  BFT_FREE(recv_gnum);
+  BFT_FREE(recv_index);
+  BFT_FREE(nb_rank);
+  BFT_FREE(s_gnum);
+  BFT_FREE(order);
+
+  /* Add interface */
+
+  _interfaces_from_flat_equiv(ifs,
+                              1,
+                              n_vals,
+                              equiv);
+
+  BFT_FREE(equiv);
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -3592,6 +3760,93 @@ cs_interface_set_create(cs_lnum_t                 n_elts,
   return ifs;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Creation of a list of interfaces between elements of a same type,
+ *        using a known set of neighboring ranks.
+ *
+ * This variant of \ref cs_interface_set_create does not handle periodicity,
+ * but only exchanges data with the given neighboring ranks (for example
+ * those of an existing vertex interface set or halo), avoiding the global
+ * all-to-all exchanges required when those ranks are unknown. It is thus
+ * much cheaper at high rank counts.
+ *
+ * All ranks sharing elements with the local rank must appear in the
+ * neighbor list, and neighborhoods must be symmetric.
+ *
+ * \param[in]  n_elts             number of local elements considered
+ *                                (size of parent_element_id[])
+ * \param[in]  parent_element_id  pointer to list of selected elements
+ *                                local ids (0 to n-1), or nullptr if all
+ *                                first n_elts elements are used
+ * \param[in]  global_number      pointer to list of global (i.e. domain
+ *                                splitting independent) element numbers
+ * \param[in]  n_neighbors        number of neighboring ranks
+ * \param[in]  neighbor_rank      neighboring rank ids
+ *
+ * \return  pointer to list of interfaces (nullptr in serial mode)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_interface_set_t *
+cs_interface_set_create_from_neighbors(cs_lnum_t        n_elts,
+                                       const cs_lnum_t  parent_element_id[],
+                                       const cs_gnum_t  global_number[],
+                                       int              n_neighbors,
+                                       const int        neighbor_rank[])
+{
+  if (cs_glob_n_ranks < 2)
+    return nullptr;
+
+  cs_interface_set_t  *ifs;
+
+  BFT_MALLOC(ifs, 1, cs_interface_set_t);
+  ifs->size = 0;
+  ifs->interfaces = nullptr;
+  ifs->periodicity = nullptr;
+  ifs->match_id_rc = 0;
+
+#if defined(HAVE_MPI)
+
+  ifs->comm = cs_glob_mpi_comm;
+
+  const cs_gnum_t  *global_num = global_number;
+  cs_gnum_t  *_global_num = nullptr;
+
+  if (parent_element_id != nullptr) {
+    BFT_MALLOC(_global_num, n_elts, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      _global_num[i] = global_number[parent_element_id[i]];
+    global_num = _global_num;
+  }
+
+  _add_global_equiv_neighbors(ifs,
+                              n_elts,
+                              global_num,
+                              n_neighbors,
+                              neighbor_rank,
+                              cs_glob_mpi_comm);
+
+  BFT_FREE(_global_num);
+
+#else
+
+  CS_UNUSED(n_elts);
+  CS_UNUSED(parent_element_id);
+  CS_UNUSED(global_number);
+  CS_UNUSED(n_neighbors);
+  CS_UNUSED(neighbor_rank);
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Finish preparation of interface set and return */
+
+  _order_by_elt_id(ifs);
+  _match_id_to_send_order(ifs);
+
+  return ifs;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destruction of an interface set.
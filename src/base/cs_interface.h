@@ -219,6 +219,41 @@ cs_interface_set_create(cs_lnum_t                 n_elts,
                         const cs_lnum_t           n_periodic_couples[],
                         const cs_gnum_t    *const periodic_couples[]);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Creation of a list of interfaces between elements of a same type,
+ *        using a known set of neighboring ranks.
+ *
+ * This variant of \ref cs_interface_set_create does not handle periodicity,
+ * but only exchanges data with the given neighboring ranks (for example
+ * those of an existing vertex interface set or halo), avoiding the global
+ * all-to-all exchanges required when those ranks are unknown. It is thus
+ * much cheaper at high rank counts.
+ *
+ * All ranks sharing elements with the local rank must appear in the
+ * neighbor list, and neighborhoods must be symmetric.
+ *
+ * \param[in]  n_elts             number of local elements considered
+ *                                (size of parent_element_id[])
+ * \param[in]  parent_element_id  pointer to list of selected elements
+ *                                local ids (0 to n-1), or NULL if all
+ *                                first n_elts elements are used
+ * \param[in]  global_number      pointer to list of global (i.e. domain
+ *                                splitting independent) element numbers
+ * \param[in]  n_neighbors        number of neighboring ranks
+ * \param[in]  neighbor_rank      neighboring rank ids
+ *
+ * \return  pointer to list of interfaces (NULL in serial mode)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_interface_set_t *
+cs_interface_set_create_from_neighbors(cs_lnum_t        n_elts,
+                                       const cs_lnum_t  parent_element_id[],
+                                       const cs_gnum_t  global_number[],
+                                       int              n_neighbors,
+                                       const int        neighbor_rank[]);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Destruction of an interface set.
@@ -241,6 +241,7 @@ _destroy_entity(cs_internal_coupling_t  *cpl)
   BFT_FREE(cpl->c_tag);
   BFT_FREE(cpl->faces_local);
   BFT_FREE(cpl->faces_distant);
+  BFT_FREE(cpl->cells_distant);
   BFT_FREE(cpl->g_weight);
   BFT_FREE(cpl->ci_cj_vect);
   BFT_FREE(cpl->offset_vect);
@@ -317,6 +318,40 @@ _compute_geometrical_face_weight(const cs_internal_coupling_t  *cpl)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute r_weight around coupling interface based on diffusivity c_weight,
+ * with c_weight values already exchanged.
+ *
+ * parameters:
+ *   cpl             <-- pointer to coupling structure
+ *   c_weight        <-- diffusivity
+ *   c_weight_local  <-- diffusivity of coupled cells (size: n_local)
+ *   r_weight        --> physical face weight
+ *----------------------------------------------------------------------------*/
+
+static void
+_physical_face_weight_local(const cs_internal_coupling_t  *cpl,
+                            const cs_real_t                c_weight[],
+                            const cs_real_t                c_weight_local[],
+                            cs_real_t                      rweight[])
+{
+  const cs_lnum_t n_local = cpl->n_local;
+  const cs_lnum_t *faces_local = cpl->faces_local;
+  const cs_real_t* g_weight = cpl->g_weight;
+
+  const cs_mesh_t* m = cs_glob_mesh;
+  const cs_lnum_t *restrict b_face_cells = (const cs_lnum_t *)m->b_face_cells;
+
+  for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+    cs_lnum_t face_id = faces_local[ii];
+    cs_lnum_t cell_id = b_face_cells[face_id];
+    cs_real_t ki = c_weight[cell_id];
+    cs_real_t kj = c_weight_local[ii];
+    cs_real_t pond = g_weight[ii];
+    rweight[ii] = kj / ( pond * ki + (1. - pond) * kj);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute r_weight around coupling interface based on diffusivity c_weight.
  *
@@ -331,14 +366,7 @@ _compute_physical_face_weight(const cs_internal_coupling_t  *cpl,
                               const cs_real_t                c_weight[],
                               cs_real_t                      rweight[])
 {
-  cs_lnum_t face_id, cell_id;
-
   const cs_lnum_t n_local = cpl->n_local;
-  const cs_lnum_t *faces_local = cpl->faces_local;
-  const cs_real_t* g_weight = cpl->g_weight;
-
-  const cs_mesh_t* m = cs_glob_mesh;
-  const cs_lnum_t *restrict b_face_cells = (const cs_lnum_t *)m->b_face_cells;
 
   /* Exchange c_weight */
 
@@ -351,14 +379,7 @@ _compute_physical_face_weight(const cs_internal_coupling_t  *cpl,
 
   /* Compute rweight */
 
-  for (cs_lnum_t ii = 0; ii < n_local; ii++) {
-    face_id = faces_local[ii];
-    cell_id = b_face_cells[face_id];
-    cs_real_t ki = c_weight[cell_id];
-    cs_real_t kj = c_weight_local[ii];
-    cs_real_t pond = g_weight[ii];
-    rweight[ii] = kj / ( pond * ki + (1. - pond) * kj);
-  }
+  _physical_face_weight_local(cpl, c_weight, c_weight_local, rweight);
 
   /* Free memory */
   BFT_FREE(c_weight_local);
@@ -517,6 +538,7 @@ _cpl_initialize(cs_internal_coupling_t *cpl)
 
   cpl->n_distant = 0;
   cpl->faces_distant = NULL;
+  cpl->cells_distant = NULL;
 
   cpl->coupled_faces = NULL;
 
@@ -855,6 +877,12 @@ _locator_initialize(cs_mesh_t               *m,
   for (cs_lnum_t i = 0; i < cpl->n_distant; i++)
     cpl->faces_distant[i] = faces_distant_num[i] - 1;
 
+  /* Adjacent cells, used to gather exchanged cell values */
+
+  BFT_MALLOC(cpl->cells_distant, cpl->n_distant, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < cpl->n_distant; i++)
+    cpl->cells_distant[i] = m->b_face_cells[cpl->faces_distant[i]];
+
   /* Geometric quantities */
 
   BFT_MALLOC(cpl->g_weight, cpl->n_local, cs_real_t);
@@ -1353,27 +1381,39 @@ cs_internal_coupling_iterative_scalar_gradient(
   const cs_real_3_t *restrict b_f_face_normal
     = (const cs_real_3_t *)fvq->b_f_face_normal;
 
-  /* Exchange grad and pvar */
+  /* Exchange grad, pvar and c_weight (if present) in a single exchange */
   cs_real_3_t *grad_local = NULL;
   BFT_MALLOC(grad_local, n_local, cs_real_3_t);
   cs_real_t *pvar_local = NULL;
   BFT_MALLOC(pvar_local, n_local, cs_real_t);
-  cs_internal_coupling_exchange_by_cell_id(cpl,
-                                           3,
-                                           (const cs_real_t *)grad,
-                                           (cs_real_t *)grad_local);
-  cs_internal_coupling_exchange_by_cell_id(cpl,
-                                           1,
-                                           pvar,
-                                           pvar_local);
+  cs_real_t *c_weight_local = NULL;
+  if (c_weight != NULL)
+    BFT_MALLOC(c_weight_local, n_local, cs_real_t);
+
+  {
+    const int strides[3] = {3, 1, 1};
+    const cs_real_t *tabs[3] = {(const cs_real_t *)grad,
+                                (const cs_real_t *)pvar,
+                                c_weight};
+    cs_real_t *locals[3] = {(cs_real_t *)grad_local,
+                            (cs_real_t *)pvar_local,
+                            c_weight_local};
+    cs_internal_coupling_exchange_by_cell_id_n(cpl,
+                                               (c_weight != NULL) ? 3 : 2,
+                                               strides,
+                                               tabs,
+                                               locals);
+  }
 
   /* Preliminary step in case of heterogenous diffusivity */
 
   if (c_weight != NULL) { /* Heterogenous diffusivity */
     BFT_MALLOC(r_weight, n_local, cs_real_t);
-    _compute_physical_face_weight(cpl,
-                                  c_weight, /* diffusivity */
-                                  r_weight); /* physical face weight */
+    _physical_face_weight_local(cpl,
+                                c_weight,       /* diffusivity */
+                                c_weight_local,
+                                r_weight);      /* physical face weight */
+    BFT_FREE(c_weight_local);
     /* Redefinition of rweight_* :
          Before : (1-g_weight)*rweight <==> 1 - ktpond
          Modif : rweight = ktpond
@@ -1457,27 +1497,39 @@ cs_internal_coupling_iterative_vector_gradient(
   const cs_real_3_t *restrict b_f_face_normal
     = (const cs_real_3_t *)fvq->b_f_face_normal;
 
-  /* Exchange grad and pvar */
+  /* Exchange grad, pvar and c_weight (if present) in a single exchange */
   cs_real_33_t *grad_local = NULL;
   BFT_MALLOC(grad_local, n_local, cs_real_33_t);
   cs_real_3_t *pvar_local = NULL;
   BFT_MALLOC(pvar_local, n_local, cs_real_3_t);
-  cs_internal_coupling_exchange_by_cell_id(cpl,
-                                           9,
-                                           (const cs_real_t *)grad,
-                                           (cs_real_t *)grad_local);
-  cs_internal_coupling_exchange_by_cell_id(cpl,
-                                           3,
-                                           (const cs_real_t *)pvar,
-                                           (cs_real_t *)pvar_local);
+  cs_real_t *c_weight_local = NULL;
+  if (c_weight != NULL)
+    BFT_MALLOC(c_weight_local, n_local, cs_real_t);
+
+  {
+    const int strides[3] = {9, 3, 1};
+    const cs_real_t *tabs[3] = {(const cs_real_t *)grad,
+                                (const cs_real_t *)pvar,
+                                c_weight};
+    cs_real_t *locals[3] = {(cs_real_t *)grad_local,
+                            (cs_real_t *)pvar_local,
+                            c_weight_local};
+    cs_internal_coupling_exchange_by_cell_id_n(cpl,
+                                               (c_weight != NULL) ? 3 : 2,
+                                               strides,
+                                               tabs,
+                                               locals);
+  }
 
   /* Preliminary step in case of heterogenous diffusivity */
 
   if (c_weight != NULL) { /* Heterogenous diffusivity */
     BFT_MALLOC(r_weight, n_local, cs_real_t);
-    _compute_physical_face_weight(cpl,
-                                  c_weight, /* diffusivity */
-                                  r_weight); /* physical face weight */
+    _physical_face_weight_local(cpl,
+                                c_weight,       /* diffusivity */
+                                c_weight_local,
+                                r_weight);      /* physical face weight */
+    BFT_FREE(c_weight_local);
     /* Redefinition of rweight_* :
          Before : (1-g_weight)*rweight <==> 1 - ktpond
          Modif : rweight = ktpond
@@ -1565,27 +1617,39 @@ cs_internal_coupling_iterative_tensor_gradient(
   const cs_real_3_t *restrict b_f_face_normal
     = (const cs_real_3_t *)fvq->b_f_face_normal;
 
-  /* Exchange grad and pvar */
+  /* Exchange grad, pvar and c_weight (if present) in a single exchange */
   cs_real_63_t *grad_local = NULL;
   BFT_MALLOC(grad_local, n_local, cs_real_63_t);
   cs_real_6_t *pvar_local = NULL;
   BFT_MALLOC(pvar_local, n_local, cs_real_6_t);
-  cs_internal_coupling_exchange_by_cell_id(cpl,
-                                           18,
-                                           (const cs_real_t *)grad,
-                                           (cs_real_t *)grad_local);
-  cs_internal_coupling_exchange_by_cell_id(cpl,
-                                           6,
-                                           (const cs_real_t *)pvar,
-                                           (cs_real_t *)pvar_local);
+  cs_real_t *c_weight_local = NULL;
+  if (c_weight != NULL)
+    BFT_MALLOC(c_weight_local, n_local, cs_real_t);
+
+  {
+    const int strides[3] = {18, 6, 1};
+    const cs_real_t *tabs[3] = {(const cs_real_t *)grad,
+                                (const cs_real_t *)pvar,
+                                c_weight};
+    cs_real_t *locals[3] = {(cs_real_t *)grad_local,
+                            (cs_real_t *)pvar_local,
+                            c_weight_local};
+    cs_internal_coupling_exchange_by_cell_id_n(cpl,
+                                               (c_weight != NULL) ? 3 : 2,
+                                               strides,
+                                               tabs,
+                                               locals);
+  }
 
   /* Preliminary step in case of heterogenous diffusivity */
 
   if (c_weight != NULL) { /* Heterogenous diffusivity */
     BFT_MALLOC(r_weight, n_local, cs_real_t);
-    _compute_physical_face_weight(cpl,
-                                  c_weight, /* diffusivity */
-                                  r_weight); /* physical face weight */
+    _physical_face_weight_local(cpl,
+                                c_weight,       /* diffusivity */
+                                c_weight_local,
+                                r_weight);      /* physical face weight */
+    BFT_FREE(c_weight_local);
     /* Redefinition of rweight_* :
          Before : (1-g_weight)*rweight <==> 1 - ktpond
          Modif : rweight = ktpond
@@ -1935,25 +1999,16 @@ cs_internal_coupling_exchange_by_cell_id(const cs_internal_coupling_t  *cpl,
                                          const cs_real_t                tab[],
                                          cs_real_t                      local[])
 {
-  int jj;
-  cs_lnum_t face_id, cell_id;
-
   const cs_lnum_t n_distant = cpl->n_distant;
-  const cs_lnum_t *faces_distant = cpl->faces_distant;
-
-  const cs_mesh_t* m = cs_glob_mesh;
-
-  const cs_lnum_t *restrict b_face_cells
-    = (const cs_lnum_t *)m->b_face_cells;
+  const cs_lnum_t *cells_distant = cpl->cells_distant;
 
   /* Initialize distant array */
 
   cs_real_t *distant = NULL;
   BFT_MALLOC(distant, n_distant*stride, cs_real_t);
   for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
-    face_id = faces_distant[ii];
-    cell_id = b_face_cells[face_id];
-    for (jj = 0; jj < stride; jj++)
+    cs_lnum_t cell_id = cells_distant[ii];
+    for (int jj = 0; jj < stride; jj++)
       distant[stride * ii + jj] = tab[stride * cell_id + jj];
   }
 
@@ -1967,6 +2022,76 @@ cs_internal_coupling_exchange_by_cell_id(const cs_internal_coupling_t  *cpl,
   BFT_FREE(distant);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Exchange several variables between groups using cell id.
+ *
+ * All variables are packed so that a single exchange is done.
+ *
+ * \param[in]  cpl      pointer to coupling entity
+ * \param[in]  n_vars   number of exchanged variables
+ * \param[in]  strides  number of values (interlaced) by entity per variable
+ * \param[in]  tabs     variables exchanged
+ * \param[out] locals   local data per variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_internal_coupling_exchange_by_cell_id_n(const cs_internal_coupling_t  *cpl,
+                                           int                n_vars,
+                                           const int          strides[],
+                                           const cs_real_t   *tabs[],
+                                           cs_real_t         *locals[])
+{
+  const cs_lnum_t n_local = cpl->n_local;
+  const cs_lnum_t n_distant = cpl->n_distant;
+  const cs_lnum_t *cells_distant = cpl->cells_distant;
+
+  int stride = 0;
+  for (int v = 0; v < n_vars; v++)
+    stride += strides[v];
+
+  /* Pack distant values */
+
+  cs_real_t *distant = NULL, *local = NULL;
+  BFT_MALLOC(distant, n_distant*stride, cs_real_t);
+  BFT_MALLOC(local, n_local*stride, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
+    cs_lnum_t cell_id = cells_distant[ii];
+    cs_real_t *_distant = distant + stride*ii;
+    for (int v = 0; v < n_vars; v++) {
+      const int s_v = strides[v];
+      for (int jj = 0; jj < s_v; jj++)
+        _distant[jj] = tabs[v][s_v * cell_id + jj];
+      _distant += s_v;
+    }
+  }
+
+  /* Exchange variables */
+
+  cs_internal_coupling_exchange_var(cpl,
+                                    stride,
+                                    distant,
+                                    local);
+
+  /* Unpack local values */
+
+  for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+    const cs_real_t *_local = local + stride*ii;
+    for (int v = 0; v < n_vars; v++) {
+      const int s_v = strides[v];
+      for (int jj = 0; jj < s_v; jj++)
+        locals[v][s_v * ii + jj] = _local[jj];
+      _local += s_v;
+    }
+  }
+
+  /* Free memory */
+  BFT_FREE(local);
+  BFT_FREE(distant);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Exchange variable between groups using face id.
@@ -86,6 +86,7 @@ typedef struct {
 
   cs_lnum_t  n_distant; /* Number of faces in faces_distant */
   cs_lnum_t *faces_distant; /* Distant boundary faces associated with locator */
+  cs_lnum_t *cells_distant; /* Cells adjacent to faces_distant */
 
   /* Face i is coupled in this entity if coupled_faces[i] = true */
   bool *coupled_faces;
@@ -260,6 +261,27 @@ cs_internal_coupling_exchange_by_cell_id(const cs_internal_coupling_t  *cpl,
                                          const cs_real_t                tab[],
                                          cs_real_t                      local[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Exchange several variables between groups using cell id.
+ *
+ * All variables are packed so that a single exchange is done.
+ *
+ * \param[in]  cpl      pointer to coupling entity
+ * \param[in]  n_vars   number of exchanged variables
+ * \param[in]  strides  number of values (interlaced) by entity per variable
+ * \param[in]  tabs     variables exchanged
+ * \param[out] locals   local data per variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_internal_coupling_exchange_by_cell_id_n(const cs_internal_coupling_t  *cpl,
+                                           int                n_vars,
+                                           const int          strides[],
+                                           const cs_real_t   *tabs[],
+                                           cs_real_t         *locals[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Exchange variable between groups using face id.
@@ -170,6 +170,9 @@ struct _cs_io_t {
 
 #if defined(HAVE_MPI)
   MPI_Comm            comm;           /* Assigned communicator */
+  MPI_Comm            peer_comm;      /* Communicator of ranks sharing
+                                         read data (rank 0 reads),
+                                         or MPI_COMM_NULL */
 #endif
 };
 
@@ -417,6 +420,7 @@ _cs_io_create(cs_io_mode_t   mode,
 
 #if defined(HAVE_MPI)
   cs_io->comm = MPI_COMM_NULL;
+  cs_io->peer_comm = MPI_COMM_NULL;
 #endif
 
   return cs_io;
@@ -1344,6 +1348,36 @@ _cs_io_convert_read(void           *buffer,
   }
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Broadcast data read by rank 0 of a peer communicator.
+ *
+ * Data is sent in chunks, so as to handle sizes beyond the range of int.
+ *
+ * parameters:
+ *   buf       <-> data buffer
+ *   size      <-- data size, in bytes
+ *   peer_comm <-- associated peer communicator
+ *----------------------------------------------------------------------------*/
+
+static void
+_bcast_from_peer(void           *buf,
+                 size_t          size,
+                 MPI_Comm        peer_comm)
+{
+  const size_t chunk_size = 1 << 30;
+
+  unsigned char *_buf = (unsigned char *)buf;
+
+  for (size_t i = 0; i < size; i += chunk_size) {
+    size_t n = CS_MIN(chunk_size, size - i);
+    MPI_Bcast(_buf + i, (int)n, MPI_BYTE, 0, peer_comm);
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Read a section body.
  *
@@ -1453,9 +1487,25 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
       cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
     }
 
+    /* When data is shared with peers, only the first peer reads it,
+       and others simply move past the section's data */
+
+    int peer_rank = 0;
+
+#if defined(HAVE_MPI)
+    if (inp->peer_comm != MPI_COMM_NULL)
+      MPI_Comm_rank(inp->peer_comm, &peer_rank);
+#endif
+
     /* Read local or global values */
 
-    if (global_num_start > 0 && global_num_end > 0) {
+    if (peer_rank > 0) {
+      cs_file_off_t offset = cs_file_tell(inp->f);
+      offset += header->n_vals * (cs_file_off_t)type_size;
+      cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
+    }
+
+    else if (global_num_start > 0 && global_num_end > 0) {
       cs_file_read_block(inp->f,
                          _buf,
                          type_size,
@@ -1475,6 +1525,11 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
         log->data_size[0] += n_vals*type_size;
     }
 
+#if defined(HAVE_MPI)
+    if (inp->peer_comm != MPI_COMM_NULL && n_vals > 0)
+      _bcast_from_peer(_buf, n_vals*type_size, inp->peer_comm);
+#endif
+
   }
 
   /* If data is embedded in header, simply point to it */
@@ -2200,6 +2255,92 @@ cs_io_finalize(cs_io_t **cs_io)
   BFT_FREE(*cs_io);
 }
 
+/*----------------------------------------------------------------------------
+ * Free a kernel IO structure associated with a file in memory,
+ * transferring ownership of the file's data to the caller.
+ *
+ * In write mode, the end-of-file section is written first, so the
+ * returned data may be used to initialize a structure for reading.
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *   nb    --> size of data
+ *   data  --> pointer to data (to be freed by caller)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_finalize_to_mem(cs_io_t   **cs_io,
+                      size_t     *nb,
+                      void      **data)
+{
+  cs_io_t *_cs_io = *cs_io;
+
+  if (_cs_io->mode == CS_IO_MODE_WRITE)
+    cs_io_write_global("EOF", 0, 0, 0, 0, CS_DATATYPE_NULL, nullptr, _cs_io);
+
+  *data = cs_file_in_memory_detach_data(_cs_io->f, nb);
+
+  if (_cs_io->index != nullptr)
+    _destroy_index(_cs_io);
+
+  _file_close(_cs_io);
+
+  _cs_io->buffer_size = 0;
+  BFT_FREE(_cs_io->buffer);
+
+  BFT_FREE(*cs_io);
+}
+
+/*----------------------------------------------------------------------------
+ * Stop logging operations on a kernel IO structure.
+ *
+ * This is required when the structure is used by a background thread,
+ * as shared log data is not protected against concurrent updates.
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_disable_log(cs_io_t  *cs_io)
+{
+  assert(cs_io != nullptr);
+
+  cs_io->log_id = -1;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Share data read through a kernel IO structure with peer ranks.
+ *
+ * Section data is then only read from the file by rank 0 of the peer
+ * communicator, and broadcast to other peers, which must read the same
+ * sections with the same block distribution (for example the same rank
+ * in identical instances of the same computation). Section headers are
+ * still read by all ranks.
+ *
+ * parameters:
+ *   inp       <-> kernel IO structure
+ *   peer_comm <-- communicator of ranks sharing data, or MPI_COMM_NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_shared_read(cs_io_t   *inp,
+                      MPI_Comm   peer_comm)
+{
+  assert(inp != nullptr);
+  assert(inp->mode == CS_IO_MODE_READ);
+
+  int n_peers = 1;
+  if (peer_comm != MPI_COMM_NULL)
+    MPI_Comm_size(peer_comm, &n_peers);
+
+  inp->peer_comm = (n_peers > 1) ? peer_comm : MPI_COMM_NULL;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Return a pointer to a kernel IO structure's name.
  *
@@ -2832,6 +2973,116 @@ cs_io_read_block(const cs_io_sec_header_t  *header,
                           cs_io);
 }
 
+/*----------------------------------------------------------------------------
+ * Access a section body without copy, assigning a different block to each
+ * processor.
+ *
+ * This function behaves as cs_io_read_block(), except that when the
+ * data is embedded in the header, or the underlying file is memory-mapped
+ * (see cs_file_read_block_view()), and no type conversion is required,
+ * a read-only pointer to the data is returned instead of a copy.
+ * Otherwise, false is returned on all ranks and nothing is read, so the
+ * caller may fall back to cs_io_read_block().
+ *
+ * The returned view is valid until the next header is read (for embedded
+ * data) or until the file is closed (for mapped data).
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   view             --> pointer to local data block (may be nullptr
+ *                        for an empty block)
+ *   cs_io            --> kernel IO structure
+ *
+ * returns:
+ *   true if a view is available, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_read_block_view(const cs_io_sec_header_t  *header,
+                      cs_gnum_t                  global_num_start,
+                      cs_gnum_t                  global_num_end,
+                      const void               **view,
+                      cs_io_t                   *cs_io)
+{
+  double t_start = 0.;
+  size_t  stride = 1;
+  cs_io_log_t  *log = nullptr;
+  bool retval = false;
+
+  assert(cs_io != nullptr);
+  assert(global_num_start > 0);
+  assert(global_num_end >= global_num_start);
+
+  *view = nullptr;
+
+  if (header->elt_type != header->type_read)
+    return false;
+
+  if (cs_io->log_id > -1) {
+    log = _cs_io_log[cs_io->mode] + cs_io->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  if (header->n_location_vals > 1)
+    stride = header->n_location_vals;
+
+  size_t type_size = cs_datatype_size[header->type_read];
+  cs_file_off_t n_vals = (global_num_end - global_num_start)*stride;
+
+  /* If data is embedded in header, simply point to it */
+
+  if (cs_io->data != nullptr) {
+    if (n_vals > 0)
+      *view =   ((const unsigned char *)cs_io->data)
+              + (global_num_start - 1) * stride * type_size;
+    cs_io->data = nullptr;
+    retval = true;
+  }
+
+  /* Otherwise, try to access mapped file */
+
+  else {
+
+    if (cs_io->body_align > 0) {
+      cs_file_off_t offset = cs_file_tell(cs_io->f);
+      size_t ba = cs_io->body_align;
+      offset += (ba - (offset % ba)) % ba;
+      cs_file_seek(cs_io->f, offset, CS_FILE_SEEK_SET);
+    }
+
+    retval = cs_file_read_block_view(cs_io->f,
+                                     type_size,
+                                     stride,
+                                     global_num_start,
+                                     global_num_end,
+                                     view);
+
+    if (retval && log != nullptr)
+      log->data_size[1] += (global_num_end - global_num_start)*type_size;
+
+  }
+
+  if (retval) {
+
+    if (log != nullptr)
+      log->wtimes[1] += cs_timer_wtime() - t_start;
+
+    if (header->n_vals != 0 && cs_io->echo > CS_IO_ECHO_HEADERS)
+      _echo_data(cs_io->echo,
+                 n_vals,
+                 (global_num_start-1)*stride + 1,
+                 (global_num_end-1)*stride + 1,
+                 header->elt_type,
+                 *view);
+
+  }
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body, assigning a different block to each processor,
  * when the body corresponds to an index.
@@ -3450,14 +3701,24 @@ cs_io_log_finalize(void)
           _data_mult[k] = l;
         }
 
+        /* Achieved bandwidth (MiB/s) */
+
+        double _bw[2] = {0, 0};
+        for (k = 0; k < 2; k++) {
+          if (log->wtimes[k] > 0)
+            _bw[k] = (double)(log->data_size[k]) / (log->wtimes[k]*1048576.);
+        }
+
         cs_log_printf(CS_LOG_PERFORMANCE,
                       _("  %s\n"
-                        "    global: %12.5f s, %12.3f %ciB\n"
-                        "    local:  %12.5f s, %12.3f %ciB\n"
+                        "    global: %12.5f s, %12.3f %ciB, %12.3f MiB/s\n"
+                        "    local:  %12.5f s, %12.3f %ciB, %12.3f MiB/s\n"
                         "    open:   %12.5f s, %u open(s)\n"),
                       key,
                       log->wtimes[0], _data_size[0], unit[_data_mult[0]],
+                      _bw[0],
                       log->wtimes[1], _data_size[1], unit[_data_mult[1]],
+                      _bw[1],
                       log->wtimes[2], log->n_opens);
       }
 #endif
@@ -3467,16 +3728,21 @@ cs_io_log_finalize(void)
         int k = 0;
         double _data_size =   (double)(log->data_size[0] + log->data_size[1])
                             / 1024.;
+        double _wtime = log->wtimes[0] + log->wtimes[1];
+        double _bw = 0;
+        if (_wtime > 0)
+          _bw =   (double)(log->data_size[0] + log->data_size[1])
+                / (_wtime*1048576.);
 
         for (k = 0; _data_size > 1024. && k < 8; k++)
           _data_size /= 1024.;
 
         cs_log_printf(CS_LOG_PERFORMANCE,
                       _("  %s\n"
-                        "    data: %12.5f s, %12.3f %ciB\n"
+                        "    data: %12.5f s, %12.3f %ciB, %12.3f MiB/s\n"
                         "    open: %12.5f s, %u open(s)\n"),
                       key,
-                      log->wtimes[0] + log->wtimes[1], _data_size, unit[k],
+                      _wtime, _data_size, unit[k], _bw,
                       log->wtimes[2], log->n_opens);
       }
     }
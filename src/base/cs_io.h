@@ -239,6 +239,59 @@ cs_io_initialize_with_index_from_mem(const char        *file_name,
 void
 cs_io_finalize(cs_io_t **pp_io);
 
+/*----------------------------------------------------------------------------
+ * Free a kernel IO structure associated with a file in memory,
+ * transferring ownership of the file's data to the caller.
+ *
+ * In write mode, the end-of-file section is written first, so the
+ * returned data may be used to initialize a structure for reading.
+ *
+ * parameters:
+ *   pp_io <-> kernel IO structure
+ *   nb    --> size of data
+ *   data  --> pointer to data (to be freed by caller)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_finalize_to_mem(cs_io_t   **pp_io,
+                      size_t     *nb,
+                      void      **data);
+
+/*----------------------------------------------------------------------------
+ * Stop logging operations on a kernel IO structure.
+ *
+ * This is required when the structure is used by a background thread,
+ * as shared log data is not protected against concurrent updates.
+ *
+ * parameters:
+ *   pp_io <-> kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_disable_log(cs_io_t  *pp_io);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Share data read through a kernel IO structure with peer ranks.
+ *
+ * Section data is then only read from the file by rank 0 of the peer
+ * communicator, and broadcast to other peers, which must read the same
+ * sections with the same block distribution (for example the same rank
+ * in identical instances of the same computation). Section headers are
+ * still read by all ranks.
+ *
+ * parameters:
+ *   inp       <-> kernel IO structure
+ *   peer_comm <-- communicator of ranks sharing data, or MPI_COMM_NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_set_shared_read(cs_io_t   *inp,
+                      MPI_Comm   peer_comm);
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Return a pointer to a preprocessor IO structure's name.
  *
@@ -462,6 +515,40 @@ cs_io_read_block(const cs_io_sec_header_t  *header,
                  void                      *elts,
                  cs_io_t                   *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Access a section body without copy, assigning a different block to each
+ * processor.
+ *
+ * This function behaves as cs_io_read_block(), except that when the
+ * data is embedded in the header, or the underlying file is memory-mapped
+ * (see cs_file_read_block_view()), and no type conversion is required,
+ * a read-only pointer to the data is returned instead of a copy.
+ * Otherwise, false is returned on all ranks and nothing is read, so the
+ * caller may fall back to cs_io_read_block().
+ *
+ * The returned view is valid until the next header is read (for embedded
+ * data) or until the file is closed (for mapped data).
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   view             --> pointer to local data block (may be NULL
+ *                        for an empty block)
+ *   pp_io            --> kernel IO structure
+ *
+ * returns:
+ *   true if a view is available, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_read_block_view(const cs_io_sec_header_t  *header,
+                      cs_gnum_t                  global_num_start,
+                      cs_gnum_t                  global_num_end,
+                      const void               **view,
+                      cs_io_t                   *pp_io);
+
 /*----------------------------------------------------------------------------
  * Read a message body, assigning a different block to each processor,
  * when the body corresponds to an index.
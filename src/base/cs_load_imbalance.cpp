@@ -0,0 +1,361 @@
+/*============================================================================
+ * Per-rank load imbalance analysis.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_halo.h"
+#include "cs_log.h"
+#include "cs_mesh.h"
+#include "cs_timer_stats.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_load_imbalance.h"
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_load_imbalance.cpp
+        Per-rank load imbalance analysis.
+
+  Times reduced across ranks do not show which ranks are slow, nor in
+  which phase. This analysis gathers per-rank elapsed times of timer
+  statistics, so as to determine the imbalance of each phase, and relate
+  the slowest ranks to their partition characteristics.
+
+  Halo exchange wait times are included, as ranks waiting for slower
+  neighbors spend the time they gain on their own work in these waits.
+  Time outside halo exchange waits is thus used to rank the slowest ranks.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of partition characteristics per rank */
+
+#define _N_PART_VALS 4
+
+/* Number of slowest ranks logged */
+
+#define _N_SLOWEST_RANKS 5
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Write per-rank values to a CSV file.
+ *
+ * parameters:
+ *   path     <-- output file path
+ *   n_stats  <-- number of timer statistics
+ *   n_vals   <-- number of time values per rank
+ *   part     <-- partition characteristics per rank
+ *   t        <-- time values per rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_csv(const char       *path,
+           int               n_stats,
+           int               n_vals,
+           const cs_gnum_t   part[],
+           const double      t[])
+{
+  FILE *f = fopen(path, "w");
+  if (f == nullptr) {
+    bft_printf(_("Warning: unable to open file \"%s\" for writing.\n"), path);
+    return;
+  }
+
+  fprintf(f, "rank,n_cells,n_ghost_cells,n_i_faces,n_neighbors");
+  for (int s_id = 0; s_id < n_stats; s_id++)
+    fprintf(f, ",\"%s\"", cs_timer_stats_get_label(s_id));
+  fprintf(f, ",\"halo wait\",\"compute\"\n");
+
+  for (int r_id = 0; r_id < cs_glob_n_ranks; r_id++) {
+    const cs_gnum_t *p = part + (size_t)r_id*_N_PART_VALS;
+    const double *tr = t + (size_t)r_id*n_vals;
+    fprintf(f, "%d,%llu,%llu,%llu,%llu", r_id,
+            (unsigned long long)p[0], (unsigned long long)p[1],
+            (unsigned long long)p[2], (unsigned long long)p[3]);
+    for (int v_id = 0; v_id < n_vals; v_id++)
+      fprintf(f, ",%.6g", tr[v_id]);
+    fprintf(f, "\n");
+  }
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Log imbalance of per-rank values.
+ *
+ * parameters:
+ *   n_stats  <-- number of timer statistics
+ *   n_vals   <-- number of time values per rank
+ *   part     <-- partition characteristics per rank
+ *   t        <-- time values per rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_imbalance(int               n_stats,
+               int               n_vals,
+               const cs_gnum_t   part[],
+               const double      t[])
+{
+  const int n_ranks = cs_glob_n_ranks;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Load imbalance by timer statistic:\n\n"
+                  "  %-32s %10s %10s %10s %8s %10s\n"),
+                _("statistic"), _("mean (s)"), _("min (s)"), _("max (s)"),
+                _("max/mean"), _("max rank"));
+
+  for (int v_id = 0; v_id < n_vals; v_id++) {
+
+    double t_min = t[v_id], t_max = t[v_id], t_sum = 0;
+    int r_max = 0;
+
+    for (int r_id = 0; r_id < n_ranks; r_id++) {
+      double tr = t[(size_t)r_id*n_vals + v_id];
+      t_sum += tr;
+      if (tr < t_min)
+        t_min = tr;
+      if (tr > t_max) {
+        t_max = tr;
+        r_max = r_id;
+      }
+    }
+
+    double t_mean = t_sum / n_ranks;
+    if (t_max <= 0)
+      continue;
+
+    char label[33];
+    if (v_id < n_stats) {
+      int depth = 0;
+      for (int p_id = cs_timer_stats_get_parent_id(v_id);
+           p_id > -1;
+           p_id = cs_timer_stats_get_parent_id(p_id))
+        depth++;
+      depth = CS_MIN(depth, 8);
+      snprintf(label, 33, "%*s%s", 2*depth, "",
+               cs_timer_stats_get_label(v_id));
+    }
+    else
+      snprintf(label, 33, "%s",
+               (v_id == n_stats) ? _("halo exchange wait") : _("compute"));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-32s %10.3f %10.3f %10.3f %8.3f %10d\n",
+                  label, t_mean, t_min, t_max, t_max/t_mean, r_max);
+  }
+
+  /* Slowest ranks based on compute time (last value) */
+
+  const int n_slowest = CS_MIN(_N_SLOWEST_RANKS, n_ranks);
+  int slowest[_N_SLOWEST_RANKS];
+
+  for (int i = 0; i < n_slowest; i++) {
+    slowest[i] = -1;
+    double t_max = -1;
+    for (int r_id = 0; r_id < n_ranks; r_id++) {
+      bool selected = false;
+      for (int j = 0; j < i; j++) {
+        if (slowest[j] == r_id)
+          selected = true;
+      }
+      double tr = t[(size_t)r_id*n_vals + n_vals - 1];
+      if (!selected && tr > t_max) {
+        t_max = tr;
+        slowest[i] = r_id;
+      }
+    }
+  }
+
+  double part_mean[_N_PART_VALS] = {0, 0, 0, 0};
+  double t_c_mean = 0;
+  for (int r_id = 0; r_id < n_ranks; r_id++) {
+    for (int k = 0; k < _N_PART_VALS; k++)
+      part_mean[k] += part[(size_t)r_id*_N_PART_VALS + k];
+    t_c_mean += t[(size_t)r_id*n_vals + n_vals - 1];
+  }
+  for (int k = 0; k < _N_PART_VALS; k++)
+    part_mean[k] /= n_ranks;
+  t_c_mean /= n_ranks;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Slowest ranks (time outside halo exchange waits):\n\n"
+                  "  %10s %10s %12s %12s %12s %10s\n"),
+                _("rank"), _("compute"), _("cells"), _("ghost cells"),
+                _("i. faces"), _("neighbors"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  %10s %10.3f %12.0f %12.0f %12.0f %10.1f\n",
+                _("mean"), t_c_mean, part_mean[0], part_mean[1],
+                part_mean[2], part_mean[3]);
+
+  for (int i = 0; i < n_slowest; i++) {
+    const int r_id = slowest[i];
+    const cs_gnum_t *p = part + (size_t)r_id*_N_PART_VALS;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %10d %10.3f %12llu %12llu %12llu %10llu\n",
+                  r_id, t[(size_t)r_id*n_vals + n_vals - 1],
+                  (unsigned long long)p[0], (unsigned long long)p[1],
+                  (unsigned long long)p[2], (unsigned long long)p[3]);
+  }
+
+  /* Compare compute time and cell count imbalance */
+
+  double t_c_max = t[(size_t)slowest[0]*n_vals + n_vals - 1];
+  cs_gnum_t n_cells_max = 0;
+  for (int r_id = 0; r_id < n_ranks; r_id++)
+    n_cells_max = CS_MAX(n_cells_max, part[(size_t)r_id*_N_PART_VALS]);
+
+  if (t_c_mean > 0 && part_mean[0] > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "  compute time imbalance (max/mean): %8.3f\n"
+                    "  cell count imbalance (max/mean):   %8.3f\n"),
+                  t_c_max/t_c_mean, n_cells_max/part_mean[0]);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log a per-rank load imbalance report and export per-rank times.
+ *
+ * Elapsed times of timer statistics and halo exchange wait times are
+ * gathered from all ranks. For each statistic, the max/mean ratio and the
+ * slowest rank are logged to the performance log, followed by the
+ * slowest ranks (based on time outside halo exchange waits) with their
+ * partition characteristics (cells, ghost cells, and neighbor ranks).
+ *
+ * Per-rank values are also written to "load_imbalance.csv" for
+ * visualization.
+ *
+ * This function must be called by all ranks, before the main mesh
+ * and timer statistics are destroyed. It does nothing in serial runs.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_imbalance_log(void)
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  /* Local values: statistics times, halo wait time, and compute time
+     (root statistic time minus halo wait time) */
+
+  const int n_stats = cs_timer_stats_n_stats();
+  const int n_vals = n_stats + 2;
+
+  double *t_l;
+  BFT_MALLOC(t_l, n_vals, double);
+
+  for (int s_id = 0; s_id < n_stats; s_id++)
+    t_l[s_id] = cs_timer_stats_get_wtime(s_id);
+
+  t_l[n_stats] = cs_halo_get_wait_time();
+  t_l[n_stats + 1] = (n_stats > 0) ? t_l[0] - t_l[n_stats] : 0.;
+
+  cs_gnum_t part_l[_N_PART_VALS] = {0, 0, 0, 0};
+  if (m != nullptr) {
+    part_l[0] = m->n_cells;
+    part_l[1] = m->n_cells_with_ghosts - m->n_cells;
+    part_l[2] = m->n_i_faces;
+    if (m->halo != nullptr)
+      part_l[3] = m->halo->n_c_domains;
+  }
+
+  /* Gather to rank 0 */
+
+  double *t = nullptr;
+  cs_gnum_t *part = nullptr;
+
+  if (cs_glob_rank_id == 0) {
+    BFT_MALLOC(t, (size_t)n_vals*cs_glob_n_ranks, double);
+    BFT_MALLOC(part, (size_t)_N_PART_VALS*cs_glob_n_ranks, cs_gnum_t);
+  }
+
+  MPI_Gather(t_l, n_vals, MPI_DOUBLE, t, n_vals, MPI_DOUBLE,
+             0, cs_glob_mpi_comm);
+  MPI_Gather(part_l, _N_PART_VALS, CS_MPI_GNUM, part, _N_PART_VALS,
+             CS_MPI_GNUM, 0, cs_glob_mpi_comm);
+
+  if (cs_glob_rank_id == 0) {
+    _log_imbalance(n_stats, n_vals, part, t);
+    _write_csv("load_imbalance.csv", n_stats, n_vals, part, t);
+  }
+
+  BFT_FREE(part);
+  BFT_FREE(t);
+  BFT_FREE(t_l);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,69 @@
+#ifndef __CS_LOAD_IMBALANCE_H__
+#define __CS_LOAD_IMBALANCE_H__
+
+/*============================================================================
+ * Per-rank load imbalance analysis.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log a per-rank load imbalance report and export per-rank times.
+ *
+ * Elapsed times of timer statistics and halo exchange wait times are
+ * gathered from all ranks. For each statistic, the max/mean ratio and the
+ * slowest rank are logged to the performance log, followed by the
+ * slowest ranks (based on time outside halo exchange waits) with their
+ * partition characteristics (cells, ghost cells, and neighbor ranks).
+ *
+ * Per-rank values are also written to "load_imbalance.csv" for
+ * visualization.
+ *
+ * This function must be called by all ranks, before the main mesh
+ * and timer statistics are destroyed. It does nothing in serial runs.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_load_imbalance_log(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LOAD_IMBALANCE_H__ */
@@ -62,6 +62,7 @@
 #include "cs_physical_model.h"
 #include "cs_prototypes.h"
 #include "cs_range_set.h"
+#include "cs_sles_telemetry.h"
 #include "cs_time_moment.h"
 #include "cs_time_plot.h"
 #include "cs_time_step.h"
@@ -982,18 +983,27 @@ _log_fields_and_functions(void)
     if (log_count < 1)
       continue;
 
-    /* Group MPI operations if required */
-
-    cs_parall_min(log_count, CS_DOUBLE, vmin);
-    cs_parall_max(log_count, CS_DOUBLE, vmax);
-    cs_parall_sum(log_count, CS_DOUBLE, vsum);
+    /* Group MPI operations if required; sums are reduced together,
+       overlapping minima and maxima */
 
 #   if defined(HAVE_MPI)
     cs_parall_counter_max(&have_weight, 1);
-    if (have_weight)
-      cs_parall_sum(log_count, CS_DOUBLE, wsum);
 #   endif
 
+    {
+      cs_parall_deferred_sum dsum;
+
+      dsum.add(log_count, vsum, vsum);
+      if (have_weight)
+        dsum.add(log_count, wsum, wsum);
+      dsum.start();
+
+      cs_parall_min(log_count, CS_DOUBLE, vmin);
+      cs_parall_max(log_count, CS_DOUBLE, vmax);
+
+      dsum.wait();
+    }
+
     /* Print headers */
 
     max_name_width = CS_MIN(max_name_width, 63);
@@ -1157,10 +1167,18 @@ _log_sstats(void)
 
   /* Group MPI operations if required */
 
-  cs_parall_min(_sstats_val_size, CS_DOUBLE, vmin);
-  cs_parall_max(_sstats_val_size, CS_DOUBLE, vmax);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, vsum);
-  cs_parall_sum(_sstats_val_size, CS_DOUBLE, wsum);
+  {
+    cs_parall_deferred_sum dsum;
+
+    dsum.add(_sstats_val_size, vsum, vsum);
+    dsum.add(_sstats_val_size, wsum, wsum);
+    dsum.start();
+
+    cs_parall_min(_sstats_val_size, CS_DOUBLE, vmin);
+    cs_parall_max(_sstats_val_size, CS_DOUBLE, vmax);
+
+    dsum.wait();
+  }
 
   /* Loop on statistics */
 
@@ -1702,6 +1720,8 @@ cs_log_iteration(void)
   cs_ctwr_log_balance();
 
   cs_notebook_log();
+
+  cs_sles_telemetry_flush();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -124,6 +124,10 @@ struct _cs_medcoupling_intersector_t {
   int                             matrix_needs_update;
   cs_real_t                      *intersect_vals;
 
+  int                             have_init_transfo; // init_transfo is set
+  cs_real_t                       init_transfo[3][4]; // last transformation
+                                                      // applied from init
+
 };
 
 /*============================================================================
@@ -164,6 +168,7 @@ _create_intersector(void)
   mi->ext_mesh             = NULL;
   mi->intersect_vals       = NULL;
   mi->matrix_needs_update  = 1;
+  mi->have_init_transfo    = 0;
 
   return mi;
 }
@@ -1158,8 +1163,13 @@ cs_medcoupling_intersector_translate(cs_medcoupling_intersector_t  *mi,
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
+  if (   translation[0] == 0. && translation[1] == 0.
+      && translation[2] == 0.)
+    return;
+
   mi->source_mesh->translate(translation);
   mi->matrix_needs_update = 1;
+  mi->have_init_transfo = 0;
 
   cs_real_t matrix[3][4];
 
@@ -1222,8 +1232,12 @@ cs_medcoupling_intersector_rotate(cs_medcoupling_intersector_t  *mi,
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
+  if (angle == 0.)
+    return;
+
   mi->source_mesh->rotate(invariant, axis, angle);
   mi->matrix_needs_update = 1;
+  mi->have_init_transfo = 0;
 
   cs_real_t matrix[3][4];
   cs_rotation_matrix(angle, axis, invariant, matrix);
@@ -1279,8 +1293,12 @@ cs_medcoupling_intersector_scale_auto(cs_medcoupling_intersector_t *mi,
   for (int i = 3; i < 3; i++)
     cog[i] = com->getIJ(0,i);
 
+  if (factor == 1.)
+    return;
+
   mi->source_mesh->scale(cog, factor);
   mi->matrix_needs_update = 1;
+  mi->have_init_transfo = 0;
 
   cs_real_t matrix[3][4];
 
@@ -1355,6 +1373,13 @@ cs_medcoupling_intersector_transform_from_init(cs_medcoupling_intersector_t  *mi
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
+  /* Nothing to do (and intersections remain valid) if the same
+     transformation was already applied */
+  if (mi->have_init_transfo) {
+    if (memcmp(mi->init_transfo, matrix, sizeof(mi->init_transfo)) == 0)
+      return;
+  }
+
   cs_coord_3_t *_new_coords = NULL ;
   const cs_lnum_t n_vtx = mi->source_mesh->getNumberOfNodes();
   const cs_lnum_t n_b_vtx = mi->n_b_vertices;
@@ -1380,6 +1405,9 @@ cs_medcoupling_intersector_transform_from_init(cs_medcoupling_intersector_t  *mi
 
   mi->matrix_needs_update = 1;
 
+  memcpy(mi->init_transfo, matrix, sizeof(mi->init_transfo));
+  mi->have_init_transfo = 1;
+
   BFT_FREE(_new_coords);
 #endif
 }
@@ -125,6 +125,20 @@ struct _cs_medcoupling_remapper_t {
   void                     *remapper;
 #endif
 
+  /* Cached interpolation matrix (CSR, one row per target element,
+     columns referring to the full source field, weights normalized
+     so that each row sums to 1) */
+
+  int                       matrix_needs_update;
+
+  cs_lnum_t                 n_rows;       /* number of target elements */
+  cs_lnum_t                 n_out_elts;   /* size of output arrays */
+  cs_lnum_t                *row_out_id;   /* output id of each row,
+                                             or NULL for identity */
+  cs_lnum_t                *row_index;
+  cs_lnum_t                *col_id;
+  cs_real_t                *coeffs;
+
 };
 
 /*============================================================================
@@ -302,6 +316,16 @@ _create_remapper(const char                        *name,
   r->bbox_source_mesh
     = dynamic_cast<MEDCouplingUMesh *>(r->source_fields[0]->getMesh());
 
+  // Interpolation matrix is built at first setup
+
+  r->matrix_needs_update = 1;
+  r->n_rows = 0;
+  r->n_out_elts = 0;
+  r->row_out_id = NULL;
+  r->row_index = NULL;
+  r->col_id = NULL;
+  r->coeffs = NULL;
+
   return r;
 }
 
@@ -504,6 +528,126 @@ _copy_values_with_bbox(cs_medcoupling_remapper_t  *r,
   return new_vals;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Store the interpolation matrix of the MEDCoupling remapper
+ *
+ * The matrix is converted to CSR form and rows are normalized, which
+ * matches the IntensiveMaximum nature used for transfers, so that
+ * values may later be interpolated without MEDCoupling field objects.
+ *
+ * \param[in] r           pointer to the cs_medcoupling_remapper_t struct
+ * \param[in] n_out_elts  size of output arrays
+ * \param[in] row_out_id  output id of each matrix row, or NULL
+ * \param[in] col_map     source entity id of each matrix column, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cache_matrix(cs_medcoupling_remapper_t  *r,
+              cs_lnum_t                   n_out_elts,
+              const cs_lnum_t            *row_out_id,
+              const mcIdType             *col_map)
+{
+  const std::vector<std::map<mcIdType, double> > &mat
+    = r->remapper->getCrossDomainMatrix();
+
+  const cs_lnum_t n_rows = mat.size();
+
+  r->n_rows = n_rows;
+  r->n_out_elts = n_out_elts;
+
+  BFT_REALLOC(r->row_index, n_rows + 1, cs_lnum_t);
+
+  r->row_index[0] = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r->row_index[i+1] = r->row_index[i] + mat[i].size();
+
+  const cs_lnum_t nnz = r->row_index[n_rows];
+
+  BFT_REALLOC(r->col_id, nnz, cs_lnum_t);
+  BFT_REALLOC(r->coeffs, nnz, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_real_t w_sum = 0.;
+    cs_lnum_t j = r->row_index[i];
+    for (std::map<mcIdType, double>::const_iterator it = mat[i].begin();
+         it != mat[i].end();
+         ++it, j++) {
+      r->col_id[j] = (col_map != NULL) ? col_map[it->first] : it->first;
+      r->coeffs[j] = it->second;
+      w_sum += it->second;
+    }
+    if (w_sum > 0.) {
+      for (j = r->row_index[i]; j < r->row_index[i+1]; j++)
+        r->coeffs[j] /= w_sum;
+    }
+  }
+
+  if (row_out_id != NULL) {
+    BFT_REALLOC(r->row_out_id, n_rows, cs_lnum_t);
+    memcpy(r->row_out_id, row_out_id, n_rows*sizeof(cs_lnum_t));
+  }
+  else
+    BFT_FREE(r->row_out_id);
+
+  r->matrix_needs_update = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Interpolate values for a given field using the cached matrix
+ *
+ * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
+ * \param[in] field_id     id of the field to interpolate (in list given before)
+ * \param[in] default_val  value to apply for elements not intersected by
+ *                         source mesh
+ *
+ * \return  pointer to cs_real_t array containing new values
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_copy_values_cached(cs_medcoupling_remapper_t  *r,
+                    int                         field_id,
+                    double                      default_val)
+{
+  cs_real_t *new_vals = NULL;
+
+  const cs_lnum_t n_rows = r->n_rows;
+  const cs_lnum_t *row_index = r->row_index;
+  const cs_lnum_t *col_id = r->col_id;
+  const cs_real_t *coeffs = r->coeffs;
+  const cs_lnum_t *row_out_id = r->row_out_id;
+
+  const DataArrayDouble *src_array = r->source_fields[field_id]->getArray();
+  const cs_lnum_t dim = src_array->getNumberOfComponents();
+  const double *src_vals = src_array->getConstPointer();
+
+  const cs_lnum_t n_vals = dim * r->n_out_elts;
+
+  BFT_MALLOC(new_vals, n_vals, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    new_vals[i] = default_val;
+
+#   pragma omp parallel for if (n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    if (row_index[i+1] == row_index[i])
+      continue;
+    cs_lnum_t e_id = (row_out_id != NULL) ? row_out_id[i] : i;
+    cs_real_t *v = new_vals + e_id*dim;
+    for (cs_lnum_t k = 0; k < dim; k++)
+      v[k] = 0.;
+    for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+      const double *s = src_vals + col_id[j]*dim;
+      for (cs_lnum_t k = 0; k < dim; k++)
+        v[k] += coeffs[j] * s[k];
+    }
+  }
+
+  return new_vals;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief update the interpolation matrix without using the reduced bbox
@@ -526,6 +670,8 @@ _setup_no_bbox(cs_medcoupling_remapper_t *r)
     r->remapper->prepare(source_field->getMesh(),
                          r->target_mesh->med_mesh,
                          r->interp_method);
+
+    _cache_matrix(r, n_elts, NULL, NULL);
   }
 }
 
@@ -560,6 +706,42 @@ _setup_with_bbox(cs_medcoupling_remapper_t  *r)
     r->remapper->prepare(source_field->getMesh(),
                          r->target_mesh->med_mesh,
                          r->interp_method);
+
+    // Cache the matrix, with columns referring to the full source field;
+    // the subfield numbering is that of its parent cells (P0) or the
+    // renumbering of the reduced nodes (P1).
+
+    const cs_lnum_t *row_out_id = NULL;
+    if (r->target_mesh->elt_list != NULL)
+      row_out_id = r->target_mesh->new_to_old;
+
+    if (r->source_fields[0]->getTypeOfField() == MEDCoupling::ON_NODES) {
+      DataArrayIdType *o2n = NULL;
+      MEDCouplingPointSet *sub_mesh
+        = r->bbox_source_mesh->buildPartAndReduceNodes(subcells->begin(),
+                                                       subcells->end(),
+                                                       o2n);
+
+      const mcIdType n_sub_nodes = sub_mesh->getNumberOfNodes();
+      const mcIdType n_nodes = o2n->getNumberOfTuples();
+      const mcIdType *_o2n = o2n->getConstPointer();
+
+      std::vector<mcIdType> n2o(n_sub_nodes);
+      for (mcIdType i = 0; i < n_nodes; i++) {
+        if (_o2n[i] > -1)
+          n2o[_o2n[i]] = i;
+      }
+
+      _cache_matrix(r, cs_glob_mesh->n_cells, row_out_id, n2o.data());
+
+      o2n->decrRef();
+      sub_mesh->decrRef();
+    }
+    else
+      _cache_matrix(r, cs_glob_mesh->n_cells, row_out_id, subcells->begin());
+
+    source_field->decrRef();
+    subcells->decrRef();
   }
 }
 
@@ -587,6 +769,11 @@ _cs_medcoupling_remapper_destroy(cs_medcoupling_remapper_t *r)
   //r->bbox_source_mesh->decrRef();
   delete r->remapper;
 
+  BFT_FREE(r->row_out_id);
+  BFT_FREE(r->row_index);
+  BFT_FREE(r->col_id);
+  BFT_FREE(r->coeffs);
+
   // Mesh will deallocated afterwards since it can be shared
   r->target_mesh = NULL;
 
@@ -769,6 +956,8 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
   if (key == NULL || value == NULL)
     return;
 
+  r->matrix_needs_update = 1;
+
   if (strcmp(key, "Precision") == 0) {
     double epsilon = atof(value);
     if (epsilon > 0)
@@ -814,6 +1003,10 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
 /*!
  * \brief update the interpolation matrix of the remapper
  *
+ * Intersections are computed only at the first call, or if the source
+ * mesh was translated or rotated (or options changed) since the previous
+ * call; loading other time iterations keeps the current matrix.
+ *
  * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
  */
 /*----------------------------------------------------------------------------*/
@@ -829,6 +1022,12 @@ cs_medcoupling_remapper_setup(cs_medcoupling_remapper_t  *r)
 #else
   cs_lnum_t n_elts = r->target_mesh->n_elts;
 
+  // Intersections are only recomputed when the source mesh was moved
+  // or options changed since the last setup.
+
+  if (r->matrix_needs_update == 0)
+    return;
+
   if (n_elts > 0) {
     // List of subcells intersecting the local mesh bounding box
     const cs_real_t *rbbox = r->target_mesh->bbox;
@@ -870,7 +1069,9 @@ cs_medcoupling_remapper_copy_values(cs_medcoupling_remapper_t  *r,
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
-  if (r->target_mesh->elt_dim == 2) {
+  if (r->matrix_needs_update == 0) {
+    new_vals = _copy_values_cached(r, field_id, default_val);
+  } else if (r->target_mesh->elt_dim == 2) {
     new_vals = _copy_values_no_bbox(r, field_id, default_val);
   } else if (r->target_mesh->elt_dim == 3) {
     new_vals = _copy_values_with_bbox(r, field_id, default_val);
@@ -898,9 +1099,14 @@ cs_medcoupling_remapper_translate(cs_medcoupling_remapper_t  *r,
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
+  if (   translation[0] == 0. && translation[1] == 0.
+      && translation[2] == 0.)
+    return;
+
   for (int i = 0; i < r->n_fields; i++) {
     r->source_fields[i]->getMesh()->translate(translation);
   }
+  r->matrix_needs_update = 1;
 #endif
 }
 
@@ -926,9 +1132,13 @@ cs_medcoupling_remapper_rotate(cs_medcoupling_remapper_t  *r,
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
+  if (angle == 0.)
+    return;
+
   for (int i = 0; i < r->n_fields; i++) {
     r->source_fields[i]->getMesh()->rotate(invariant, axis, angle);
   }
+  r->matrix_needs_update = 1;
 #endif
 }
 
@@ -140,6 +140,10 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
 /*!
  * \brief update the interpolation matrix of the remapper
  *
+ * Intersections are computed only at the first call, or if the source
+ * mesh was translated or rotated (or options changed) since the previous
+ * call; loading other time iterations keeps the current matrix.
+ *
  * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
  */
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,290 @@
+/*============================================================================
+ * Memory footprint accounting by subsystem.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_mem_usage.h"
+
+#include "cs_log.h"
+#include "cs_mesh.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mem_footprint.h"
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mem_footprint.cpp
+        Memory footprint accounting by subsystem.
+
+  Allocations are attributed to an owner (subsystem) based on the source
+  file in which they occur, as recorded by the allocation macros, so no
+  explicit tagging is needed in allocating code. Host memory statistics
+  rely on sampled allocation tracking, which may be activated using the
+  CS_MEM_SAMPLING (sampling period in bytes) or CS_MEM_FOOTPRINT
+  environment variables.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Association of source file name prefix to owner */
+
+typedef struct {
+
+  const char      *prefix;   /* file base name prefix */
+  cs_mem_owner_t   owner;    /* associated owner */
+
+} _owner_prefix_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char *_owner_name[] = {N_("mesh"),
+                                    N_("mesh quantities"),
+                                    N_("fields"),
+                                    N_("matrices and AMG"),
+                                    N_("gradients"),
+                                    N_("halos"),
+                                    N_("Lagrangian"),
+                                    N_("CDO"),
+                                    N_("other")};
+
+/* Prefixes are tested in order, so longer prefixes must appear first */
+
+static const _owner_prefix_t _owner_prefix[] = {
+  {"cs_mesh_quantities", CS_MEM_OWNER_MESH_QUANTITIES},
+  {"cs_mesh",            CS_MEM_OWNER_MESH},
+  {"cs_preprocessor",    CS_MEM_OWNER_MESH},
+  {"cs_join",            CS_MEM_OWNER_MESH},
+  {"cs_partition",       CS_MEM_OWNER_MESH},
+  {"cs_renumber",        CS_MEM_OWNER_MESH},
+  {"cs_field",           CS_MEM_OWNER_FIELDS},
+  {"cs_matrix",          CS_MEM_OWNER_MATRICES},
+  {"cs_grid",            CS_MEM_OWNER_MATRICES},
+  {"cs_multigrid",       CS_MEM_OWNER_MATRICES},
+  {"cs_sles",            CS_MEM_OWNER_MATRICES},
+  {"cs_gradient",        CS_MEM_OWNER_GRADIENTS},
+  {"cs_halo",            CS_MEM_OWNER_HALOS},
+  {"cs_interface",       CS_MEM_OWNER_HALOS},
+  {"cs_range_set",       CS_MEM_OWNER_HALOS},
+  {"cs_rank_neighbors",  CS_MEM_OWNER_HALOS},
+  {"cs_lagr",            CS_MEM_OWNER_LAGRANGIAN}
+};
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the owner associated with an allocation site.
+ *
+ * \param[in]  file_name  name of source file in which allocation occurs
+ *
+ * \return  associated memory owner
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mem_owner_t
+cs_mem_footprint_owner(const char  *file_name)
+{
+  if (file_name == nullptr)
+    return CS_MEM_OWNER_OTHER;
+
+  /* Source subdirectory, if present in name */
+
+  if (strstr(file_name, "/lagr/") != nullptr)
+    return CS_MEM_OWNER_LAGRANGIAN;
+  else if (strstr(file_name, "/cdo/") != nullptr)
+    return CS_MEM_OWNER_CDO;
+
+  /* Base name prefix */
+
+  const char *b = strrchr(file_name, '/');
+  b = (b != nullptr) ? b + 1 : file_name;
+
+  const int n_prefixes = sizeof(_owner_prefix) / sizeof(_owner_prefix_t);
+
+  for (int i = 0; i < n_prefixes; i++) {
+    const char *p = _owner_prefix[i].prefix;
+    if (strncmp(b, p, strlen(p)) == 0)
+      return _owner_prefix[i].owner;
+  }
+
+  return CS_MEM_OWNER_OTHER;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log memory footprint by owner.
+ *
+ * Current memory and memory at peak are logged for each owner, summed
+ * over ranks and for the rank with the highest value. Host memory is
+ * based on sampled allocation tracking (see \ref bft_mem_sampling_set),
+ * device memory is tracked exactly.
+ *
+ * This function must be called by all ranks. It does nothing if
+ * neither sampled tracking nor device memory is active.
+ *
+ * \param[in]  stage_name  name of current computation stage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_footprint_log(const char  *stage_name)
+{
+  const int n_h_sites = bft_mem_sampling_n_sites();
+  const int n_d_sites = bft_mem_device_n_sites();
+
+  int active = (n_h_sites > 0 || n_d_sites > 0) ? 1 : 0;
+  cs_parall_max(1, CS_INT_TYPE, &active);
+
+  if (active == 0)
+    return;
+
+  /* Values per owner: host current, host at peak,
+     device current, device at peak; last row for totals */
+
+  const int n_owners = CS_MEM_OWNER_N;
+
+  double sums[CS_MEM_OWNER_N + 1][4], maxs[CS_MEM_OWNER_N + 1][4];
+
+  for (int i = 0; i < n_owners + 1; i++) {
+    for (int j = 0; j < 4; j++)
+      sums[i][j] = 0;
+  }
+
+  for (int i = 0; i < n_h_sites; i++) {
+    bft_mem_site_t site;
+    bft_mem_sampling_site_info(i, &site);
+    cs_mem_owner_t o = cs_mem_footprint_owner(site.file_name);
+    sums[o][0] += site.cur_size;
+    sums[o][1] += site.peak_size;
+  }
+
+  for (int i = 0; i < n_d_sites; i++) {
+    bft_mem_site_t site;
+    bft_mem_device_site_info(i, &site);
+    cs_mem_owner_t o = cs_mem_footprint_owner(site.file_name);
+    sums[o][2] += site.cur_size;
+    sums[o][3] += site.peak_size;
+  }
+
+  for (int i = 0; i < n_owners; i++) {
+    for (int j = 0; j < 4; j++)
+      sums[n_owners][j] += sums[i][j];
+  }
+
+  memcpy(maxs, sums, sizeof(sums));
+
+  cs_parall_sum((n_owners + 1)*4, CS_DOUBLE, (double *)sums);
+  cs_parall_max((n_owners + 1)*4, CS_DOUBLE, (double *)maxs);
+
+  /* Measured process peak memory (kB) for comparison */
+
+  double pr_max[2] = {(double)bft_mem_usage_max_pr_size(), 0};
+  pr_max[1] = pr_max[0];
+  cs_parall_sum(1, CS_DOUBLE, pr_max);
+  cs_parall_max(1, CS_DOUBLE, pr_max + 1);
+
+  /* Log */
+
+  const double mib = 1. / (1024.*1024.);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Memory footprint by owner (%s):\n\n"
+                  "                     "
+                  "          host (MiB)            "
+                  "        device (MiB)\n"
+                  "  %-18s %10s %10s %10s %10s %10s %10s\n"),
+                stage_name, _("owner"),
+                _("current"), _("at peak"), _("max. rank"),
+                _("current"), _("at peak"), _("max. rank"));
+
+  for (int i = 0; i < n_owners + 1; i++) {
+    if (i == n_owners)
+      cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+    else if (sums[i][0] + sums[i][1] + sums[i][2] + sums[i][3] <= 0)
+      continue;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-18s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                  (i < n_owners) ? _(_owner_name[i]) : _("total"),
+                  sums[i][0]*mib, sums[i][1]*mib, maxs[i][1]*mib,
+                  sums[i][2]*mib, sums[i][3]*mib, maxs[i][3]*mib);
+  }
+
+  if (sums[n_owners][1] > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n  Host values are estimated from sampled allocations.\n"));
+
+  if (pr_max[0] > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Measured process peak memory: %10.1f MiB"
+                    " (max. rank: %.1f MiB)\n"),
+                  pr_max[0]/1024., pr_max[1]/1024.);
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  if (m != nullptr) {
+    if (m->n_g_cells > 0) {
+      double n_g_cells = m->n_g_cells;
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  Memory at peak per cell:      %10.1f bytes (host),"
+                      " %.1f bytes (device)\n"),
+                    sums[n_owners][1]/n_g_cells, sums[n_owners][3]/n_g_cells);
+    }
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+}
+
+/*----------------------------------------------------------------------------*/
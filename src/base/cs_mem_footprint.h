@@ -0,0 +1,102 @@
+#ifndef __CS_MEM_FOOTPRINT_H__
+#define __CS_MEM_FOOTPRINT_H__
+
+/*============================================================================
+ * Memory footprint accounting by subsystem.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Memory owner (subsystem) */
+
+typedef enum {
+
+  CS_MEM_OWNER_MESH,             /*!< mesh and mesh building */
+  CS_MEM_OWNER_MESH_QUANTITIES,  /*!< mesh quantities */
+  CS_MEM_OWNER_FIELDS,           /*!< fields */
+  CS_MEM_OWNER_MATRICES,         /*!< matrices, AMG levels and solvers */
+  CS_MEM_OWNER_GRADIENTS,        /*!< gradient reconstruction */
+  CS_MEM_OWNER_HALOS,            /*!< halos and parallel interfaces */
+  CS_MEM_OWNER_LAGRANGIAN,       /*!< Lagrangian particles */
+  CS_MEM_OWNER_CDO,              /*!< CDO/HHO schemes */
+  CS_MEM_OWNER_OTHER,            /*!< other */
+
+  CS_MEM_OWNER_N
+
+} cs_mem_owner_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the owner associated with an allocation site.
+ *
+ * \param[in]  file_name  name of source file in which allocation occurs
+ *
+ * \return  associated memory owner
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mem_owner_t
+cs_mem_footprint_owner(const char  *file_name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log memory footprint by owner.
+ *
+ * Current memory and memory at peak are logged for each owner, summed
+ * over ranks and for the rank with the highest value. Host memory is
+ * based on sampled allocation tracking (see \ref bft_mem_sampling_set),
+ * device memory is tracked exactly.
+ *
+ * This function must be called by all ranks. It does nothing if
+ * neither sampled tracking nor device memory is active.
+ *
+ * \param[in]  stage_name  name of current computation stage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_footprint_log(const char  *stage_name);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MEM_FOOTPRINT_H__ */
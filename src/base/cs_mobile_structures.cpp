@@ -149,6 +149,23 @@ typedef struct {
 
   cs_real_t  *dtstr;         /*!< time step used to solve structure movements */
 
+  /* Acceleration of implicit coupling iterations */
+
+  cs_mobile_structures_accel_t  accel_type;  /*!< acceleration type */
+
+  int         accel_n_reuse; /*!< number of previous time steps whose
+                              *   secant information is reused */
+  int         accel_n;       /*!< size of accelerated values (3*n_structs) */
+  int         accel_n_cols;  /*!< number of secant columns */
+  int        *accel_col_nt;  /*!< time step associated with each column */
+  cs_real_t  *accel_v;       /*!< residual differences (per column) */
+  cs_real_t  *accel_w;       /*!< displacement differences (per column) */
+  cs_real_t  *accel_r;       /*!< residual at previous coupling iteration */
+  cs_real_t  *accel_xt;      /*!< Newmark displacement at previous
+                              *   coupling iteration */
+  bool        accel_prev;    /*!< previous iteration values available */
+  cs_real_t   accel_omega;   /*!< Aitken relaxation factor */
+
   /* Association with mesh */
 
   int        *idfstr;        /*!< structure number associated to each
@@ -183,6 +200,10 @@ static cs_real_t *_pr_save = nullptr;
 
 static int _post_out_stat_id = -1;
 
+/* Initial relaxation factor for accelerated implicit coupling */
+
+static const cs_real_t _accel_omega_0 = 0.5;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -255,6 +276,20 @@ _mobile_structures_create(void)
 
   ms->dtstr = nullptr;
 
+  /* Implicit coupling acceleration */
+
+  ms->accel_type = CS_MOBILE_STRUCTURES_ACCEL_IQN_ILS;
+  ms->accel_n_reuse = 1;
+  ms->accel_n = 0;
+  ms->accel_n_cols = 0;
+  ms->accel_col_nt = nullptr;
+  ms->accel_v = nullptr;
+  ms->accel_w = nullptr;
+  ms->accel_r = nullptr;
+  ms->accel_xt = nullptr;
+  ms->accel_prev = false;
+  ms->accel_omega = _accel_omega_0;
+
   /* Plot info */
 
   ms->n_plots = 0;
@@ -274,6 +309,29 @@ _mobile_structures_create(void)
   return ms;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free implicit coupling acceleration data.
+ *
+ * \param[in, out]  ms  pointer to mobile structures
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_accel_free(cs_mobile_structures_t  *ms)
+{
+  BFT_FREE(ms->accel_col_nt);
+  BFT_FREE(ms->accel_v);
+  BFT_FREE(ms->accel_w);
+  BFT_FREE(ms->accel_r);
+  BFT_FREE(ms->accel_xt);
+
+  ms->accel_n = 0;
+  ms->accel_n_cols = 0;
+  ms->accel_prev = false;
+  ms->accel_omega = _accel_omega_0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Destroy a mobile structures handling structure.
@@ -308,6 +366,8 @@ _mobile_structures_destroy(cs_mobile_structures_t  **ms)
 
   BFT_FREE(_ms->dtstr);
 
+  _accel_free(_ms);
+
   /* Plot info */
 
   for (int fmt = CS_TIME_PLOT_DAT; fmt <= CS_TIME_PLOT_CSV; fmt++) {
@@ -704,6 +764,264 @@ _output_time_plots(cs_mobile_structures_t  *ms,
   BFT_FREE(vartmp);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute an IQN-ILS update of structure displacements.
+ *
+ * The secant columns are orthogonalized (most recent first) using a
+ * modified Gram-Schmidt QR decomposition, and nearly linearly dependent
+ * columns are filtered out. The least-squares problem min ||V.a + r|| is
+ * then solved, and the new displacement is given by x = xt + W.a.
+ *
+ * \param[in]   n       number of values
+ * \param[in]   n_cols  number of secant columns
+ * \param[in]   v       residual differences (size: n_cols*n)
+ * \param[in]   w       displacement differences (size: n_cols*n)
+ * \param[in]   r       current residual
+ * \param[in]   xt      current Newmark displacement
+ * \param[out]  x       updated displacement
+ *
+ * \return  true if the update was computed, false if all columns were
+ *          filtered out
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_iqn_ils_update(int              n,
+                int              n_cols,
+                const cs_real_t  v[],
+                const cs_real_t  w[],
+                const cs_real_t  r[],
+                const cs_real_t  xt[],
+                cs_real_t        x[])
+{
+  const cs_real_t filter_eps = 1e-6;
+
+  cs_real_t *q, *rr, *a;
+  int *col_id;
+  BFT_MALLOC(q, n_cols*n, cs_real_t);
+  BFT_MALLOC(rr, n_cols*n_cols, cs_real_t);
+  BFT_MALLOC(a, n_cols, cs_real_t);
+  BFT_MALLOC(col_id, n_cols, int);
+
+  int m = 0;
+
+  for (int k = 0; k < n_cols; k++) {
+
+    cs_real_t *qm = q + m*n;
+    cs_real_t norm0 = 0.;
+    for (int i = 0; i < n; i++) {
+      qm[i] = v[k*n + i];
+      norm0 += qm[i]*qm[i];
+    }
+    norm0 = sqrt(norm0);
+
+    for (int j = 0; j < m; j++) {
+      const cs_real_t *qj = q + j*n;
+      cs_real_t d = 0.;
+      for (int i = 0; i < n; i++)
+        d += qj[i]*qm[i];
+      for (int i = 0; i < n; i++)
+        qm[i] -= d*qj[i];
+      rr[j*n_cols + m] = d;
+    }
+
+    cs_real_t norm = 0.;
+    for (int i = 0; i < n; i++)
+      norm += qm[i]*qm[i];
+    norm = sqrt(norm);
+
+    /* Filter columns (nearly) linearly dependent on more recent ones */
+
+    if (norm0 <= 0. || norm <= filter_eps*norm0)
+      continue;
+
+    for (int i = 0; i < n; i++)
+      qm[i] /= norm;
+    rr[m*n_cols + m] = norm;
+    col_id[m] = k;
+    m++;
+
+  }
+
+  if (m > 0) {
+
+    /* Solve R.a = -Q^t.r */
+
+    for (int j = 0; j < m; j++) {
+      const cs_real_t *qj = q + j*n;
+      a[j] = 0.;
+      for (int i = 0; i < n; i++)
+        a[j] -= qj[i]*r[i];
+    }
+
+    for (int j = m-1; j > -1; j--) {
+      for (int l = j+1; l < m; l++)
+        a[j] -= rr[j*n_cols + l]*a[l];
+      a[j] /= rr[j*n_cols + j];
+    }
+
+    for (int i = 0; i < n; i++)
+      x[i] = xt[i];
+
+    for (int j = 0; j < m; j++) {
+      const cs_real_t *wj = w + col_id[j]*n;
+      for (int i = 0; i < n; i++)
+        x[i] += a[j]*wj[i];
+    }
+
+  }
+
+  BFT_FREE(col_id);
+  BFT_FREE(a);
+  BFT_FREE(rr);
+  BFT_FREE(q);
+
+  return (m > 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update predicted displacement of internal structures for the
+ *         next implicit coupling iteration.
+ *
+ * The fixed-point iteration x <- xt (with xt the displacement computed by
+ * the Newmark scheme from fluid forces obtained with displacement x) is
+ * accelerated using IQN-ILS or Aitken relaxation.
+ *
+ * \param[in, out]  ms      pointer to mobile structures
+ * \param[in]       italim  implicit coupling iteration number
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_implicit_update(cs_mobile_structures_t  *ms,
+                 int                      italim)
+{
+  const int n = 3*ms->n_structs;
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  cs_real_t *x = (cs_real_t *)ms->xstp;
+  const cs_real_t *xt = (const cs_real_t *)ms->xstr;
+
+  /* First iteration of a time step or no acceleration:
+     start from the last computed displacement */
+
+  if (   ms->accel_type == CS_MOBILE_STRUCTURES_ACCEL_NONE
+      || italim == 1) {
+
+    for (int i = 0; i < n; i++)
+      x[i] = xt[i];
+
+    if (ms->accel_type == CS_MOBILE_STRUCTURES_ACCEL_NONE)
+      return;
+
+    if (ms->accel_n != n) {
+      _accel_free(ms);
+      ms->accel_n = n;
+      const int max_cols = n*(ms->accel_n_reuse + 1);
+      BFT_MALLOC(ms->accel_col_nt, max_cols, int);
+      BFT_MALLOC(ms->accel_v, max_cols*n, cs_real_t);
+      BFT_MALLOC(ms->accel_w, max_cols*n, cs_real_t);
+      BFT_MALLOC(ms->accel_r, n, cs_real_t);
+      BFT_MALLOC(ms->accel_xt, n, cs_real_t);
+    }
+
+    /* Discard secant information from older time steps */
+
+    int n_cols = 0;
+    for (int k = 0; k < ms->accel_n_cols; k++) {
+      if (ms->accel_col_nt[k] >= nt_cur - ms->accel_n_reuse) {
+        if (n_cols < k) {
+          ms->accel_col_nt[n_cols] = ms->accel_col_nt[k];
+          memcpy(ms->accel_v + n_cols*n, ms->accel_v + k*n,
+                 n*sizeof(cs_real_t));
+          memcpy(ms->accel_w + n_cols*n, ms->accel_w + k*n,
+                 n*sizeof(cs_real_t));
+        }
+        n_cols++;
+      }
+    }
+    ms->accel_n_cols = n_cols;
+
+    ms->accel_prev = false;
+    ms->accel_omega = _accel_omega_0;
+
+    return;
+  }
+
+  cs_real_t *r;
+  BFT_MALLOC(r, n, cs_real_t);
+
+  for (int i = 0; i < n; i++)
+    r[i] = xt[i] - x[i];
+
+  if (ms->accel_prev) {
+
+    const cs_real_t *r_prev = ms->accel_r;
+    const cs_real_t *xt_prev = ms->accel_xt;
+
+    cs_real_t num = 0., den = 0.;
+    for (int i = 0; i < n; i++) {
+      cs_real_t dr = r[i] - r_prev[i];
+      num += r_prev[i]*dr;
+      den += dr*dr;
+    }
+
+    if (den > 0.) {
+
+      /* Aitken relaxation factor */
+
+      ms->accel_omega *= -num/den;
+
+      /* Add secant column (most recent first, oldest dropped if full) */
+
+      if (ms->accel_type == CS_MOBILE_STRUCTURES_ACCEL_IQN_ILS) {
+        const int max_cols = n*(ms->accel_n_reuse + 1);
+        int n_cols = CS_MIN(ms->accel_n_cols, max_cols - 1);
+        for (int k = n_cols; k > 0; k--) {
+          ms->accel_col_nt[k] = ms->accel_col_nt[k-1];
+          memcpy(ms->accel_v + k*n, ms->accel_v + (k-1)*n,
+                 n*sizeof(cs_real_t));
+          memcpy(ms->accel_w + k*n, ms->accel_w + (k-1)*n,
+                 n*sizeof(cs_real_t));
+        }
+        ms->accel_col_nt[0] = nt_cur;
+        for (int i = 0; i < n; i++) {
+          ms->accel_v[i] = r[i] - r_prev[i];
+          ms->accel_w[i] = xt[i] - xt_prev[i];
+        }
+        ms->accel_n_cols = n_cols + 1;
+      }
+
+    }
+
+  }
+
+  /* Save values for next iteration before updating x */
+
+  for (int i = 0; i < n; i++) {
+    ms->accel_r[i] = r[i];
+    ms->accel_xt[i] = xt[i];
+  }
+  ms->accel_prev = true;
+
+  bool updated = false;
+
+  if (   ms->accel_type == CS_MOBILE_STRUCTURES_ACCEL_IQN_ILS
+      && ms->accel_n_cols > 0)
+    updated = _iqn_ils_update(n, ms->accel_n_cols,
+                              ms->accel_v, ms->accel_w,
+                              r, xt, x);
+
+  if (updated == false) {
+    for (int i = 0; i < n; i++)
+      x[i] += ms->accel_omega*r[i];
+  }
+
+  BFT_FREE(r);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -991,9 +1309,21 @@ cs_mobile_structures_log_setup(void)
                   ("\n"
                    "  Implicit coupling scheme\n"
                    "    maximum number of inner iterations: %d\n"
-                   "    convergence threshold:              %g\n\n"),
+                   "    convergence threshold:              %g\n"),
                   cs_glob_mobile_structures_i_max,
                   cs_glob_mobile_structures_i_eps);
+
+    const char *accel_name[] = {N_("none"),
+                                N_("Aitken"),
+                                N_("IQN-ILS")};
+    cs_log_printf(log,
+                  _("    acceleration:                       %s\n"),
+                  _(accel_name[ms->accel_type]));
+    if (ms->accel_type == CS_MOBILE_STRUCTURES_ACCEL_IQN_ILS)
+      cs_log_printf(log,
+                    _("    reused time steps:                  %d\n"),
+                    ms->accel_n_reuse);
+    cs_log_printf(log, "\n");
   }
 
   if (n_ast_structs > 0) {
@@ -1094,6 +1424,38 @@ cs_mobile_structures_set_newmark_coefficients(cs_real_t  alpha,
   ms->gamnmk = gamma;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set acceleration of implicit coupling iterations for internal
+ *         mobile structures.
+ *
+ * With IQN-ILS, secant information (differences of displacement residuals
+ * and of structure displacements between coupling iterations) from the
+ * n_reuse previous time steps is also used.
+ *
+ * \param[in]   type     acceleration type
+ * \param[in]   n_reuse  number of previous time steps whose secant
+ *                       information is reused (IQN-ILS only)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mobile_structures_set_implicit_acceleration
+  (cs_mobile_structures_accel_t  type,
+   int                           n_reuse)
+{
+  cs_mobile_structures_t *ms = _mobile_structures;
+  if (ms == nullptr) {
+    ms = _mobile_structures_create();
+    _mobile_structures = ms;
+  }
+
+  _accel_free(ms);
+
+  ms->accel_type = type;
+  ms->accel_n_reuse = CS_MAX(n_reuse, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Predict displacement of mobile structures with ALE.
@@ -1172,13 +1534,8 @@ cs_mobile_structures_prediction(int  itrale,
 
       /* Implicit coupling scheme */
 
-      else {
-        for (int i = 0; i < n_structs; i++) {
-          for (int j= 0; j < 3; j++) {
-            ms->xstp[i][j] = ms->xstr[i][j];
-          }
-        }
-      }
+      else
+        _implicit_update(ms, italim);
 
     }
 
@@ -48,6 +48,20 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*! Acceleration of implicit coupling iterations for internal structures */
+
+typedef enum {
+
+  CS_MOBILE_STRUCTURES_ACCEL_NONE,     /*!< fixed-point iterations */
+  CS_MOBILE_STRUCTURES_ACCEL_AITKEN,   /*!< Aitken dynamic relaxation */
+  CS_MOBILE_STRUCTURES_ACCEL_IQN_ILS   /*!< interface quasi-Newton with
+                                            inverse Jacobian from a
+                                            least-squares model (IQN-ILS),
+                                            with Aitken relaxation as
+                                            fallback */
+
+} cs_mobile_structures_accel_t;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -141,6 +155,26 @@ cs_mobile_structures_set_newmark_coefficients(cs_real_t  alpha,
                                               cs_real_t  beta,
                                               cs_real_t  gamma);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set acceleration of implicit coupling iterations for internal
+ *         mobile structures.
+ *
+ * With IQN-ILS, secant information (differences of displacement residuals
+ * and of structure displacements between coupling iterations) from the
+ * n_reuse previous time steps is also used.
+ *
+ * \param[in]   type     acceleration type
+ * \param[in]   n_reuse  number of previous time steps whose secant
+ *                       information is reused (IQN-ILS only)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mobile_structures_set_implicit_acceleration
+  (cs_mobile_structures_accel_t  type,
+   int                           n_reuse);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Predict displacement of mobile structures with ALE.
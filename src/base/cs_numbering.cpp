@@ -532,6 +532,7 @@ cs_numbering_create_default(cs_lnum_t  n_elts)
 
   numbering->n_no_adj_halo_groups = 0;
   numbering->n_no_adj_halo_elts = 0;
+  numbering->colored = false;
 
   BFT_MALLOC(numbering->group_index, 2, cs_lnum_t);
   numbering->group_index[0] = 0;
@@ -569,6 +570,7 @@ cs_numbering_create_vectorized(cs_lnum_t  n_elts,
 
   numbering->n_no_adj_halo_groups = 0;
   numbering->n_no_adj_halo_elts = 0;
+  numbering->colored = false;
 
   BFT_MALLOC(numbering->group_index, 2, cs_lnum_t);
   numbering->group_index[0] = 0;
@@ -612,6 +614,7 @@ cs_numbering_create_threaded(int        n_threads,
 
   numbering->n_no_adj_halo_groups = 0;
   numbering->n_no_adj_halo_elts = 0;
+  numbering->colored = false;
 
   BFT_MALLOC(numbering->group_index, n_threads*2*n_groups, cs_lnum_t);
 
@@ -755,12 +758,14 @@ cs_numbering_dump(const cs_numbering_t  *numbering)
              "  n_threads:             %d\n"
              "  n_groups:              %d\n"
              "  n_no_adj_halo_groups:  %d\n"
-             "  n_no_adj_halo_elts:    %ld\n",
+             "  n_no_adj_halo_elts:    %ld\n"
+             "  colored:               %d\n",
              (const void *)numbering, cs_numbering_type_name[numbering->type],
              numbering->vector_size,
              numbering->n_threads, numbering->n_groups,
              numbering->n_no_adj_halo_groups,
-             (long)(numbering->n_no_adj_halo_elts));
+             (long)(numbering->n_no_adj_halo_elts),
+             (int)(numbering->colored));
 
   if (numbering->group_index != nullptr) {
 
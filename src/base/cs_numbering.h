@@ -99,6 +99,12 @@ typedef struct {
   cs_lnum_t  n_no_adj_halo_elts;  /* Number of elements not adjacent to
                                      halo elements */
 
+  bool       colored;             /* If true, elements of a given group are
+                                     contiguous across threads, and no two
+                                     elements of a group share an adjacent
+                                     element, so each group may be processed
+                                     with one device thread per element */
+
   cs_lnum_t *group_index;         /* For thread t and group g, the start and
                                      past-the-end ids for entities in a given
                                      group and thread are respectively:
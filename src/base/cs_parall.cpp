@@ -321,8 +321,8 @@ _cs_parall_allreduce(MPI_Comm        comm,
 
   memcpy(locval, val, data_size);
 
-  MPI_Allreduce(locval, val, n, cs_datatype_to_mpi[datatype], operation,
-                comm);
+  cs_comm_allreduce(locval, val, n, cs_datatype_to_mpi[datatype], operation,
+                    comm);
 
   if (locval != _locval)
     BFT_FREE(locval);
@@ -1475,4 +1475,254 @@ cs_parall_min(cs_execution_context  *ec,
 
 #endif // !defined(HAVE_MPI_IN_PLACE) && defined(HAVE_MPI)
 
+/*=============================================================================
+ * Deferred sum class methods
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Constructor, using the default communicator.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_parall_deferred_sum::cs_parall_deferred_sum(void)
+  : _n_vals(0), _n_segs(0),
+    _n_vals_max(_n_inline), _n_segs_max(_n_inline),
+    _started(false),
+    _vals(_vals_inline), _sums(_sums_inline),
+    _seg_dest(_seg_dest_inline), _seg_size(_seg_size_inline)
+{
+#if defined(HAVE_MPI)
+  _comm = (cs_glob_n_ranks > 1) ? cs_glob_mpi_comm : MPI_COMM_NULL;
+  _request = MPI_REQUEST_NULL;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Constructor, using the communicator of an execution context.
+ *
+ * \param[in]  ec  pointer to execution context
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_parall_deferred_sum::cs_parall_deferred_sum(const cs_execution_context  *ec)
+  : cs_parall_deferred_sum()
+{
+#if defined(HAVE_MPI)
+  _comm = (ec->use_mpi()) ? ec->comm() : MPI_COMM_NULL;
+#endif
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Constructor, using a given communicator.
+ *
+ * \param[in]  comm  associated communicator, or MPI_COMM_NULL for local sums
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_parall_deferred_sum::cs_parall_deferred_sum(MPI_Comm  comm)
+  : cs_parall_deferred_sum()
+{
+  _comm = comm;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destructor.
+ *
+ * Pending reductions are completed, so that results are available.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_parall_deferred_sum::~cs_parall_deferred_sum(void)
+{
+  if (_started)
+    wait();
+
+  if (_vals != _vals_inline) {
+    BFT_FREE(_vals);
+    BFT_FREE(_sums);
+  }
+  if (_seg_dest != _seg_dest_inline) {
+    BFT_FREE(_seg_dest);
+    BFT_FREE(_seg_size);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Ensure buffers are large enough for additional values
+ *        and one additional segment.
+ *
+ * \param[in]  n_vals_add  number of values to add
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum::_reserve(int  n_vals_add)
+{
+  if (_n_vals + n_vals_add > _n_vals_max) {
+    int n_vals_max = _n_vals_max*2;
+    while (n_vals_max < _n_vals + n_vals_add)
+      n_vals_max *= 2;
+    if (_vals == _vals_inline) {
+      BFT_MALLOC(_vals, n_vals_max, double);
+      BFT_MALLOC(_sums, n_vals_max, double);
+      memcpy(_vals, _vals_inline, _n_vals*sizeof(double));
+    }
+    else {
+      BFT_REALLOC(_vals, n_vals_max, double);
+      BFT_REALLOC(_sums, n_vals_max, double);
+    }
+    _n_vals_max = n_vals_max;
+  }
+
+  if (_n_segs + 1 > _n_segs_max) {
+    int n_segs_max = _n_segs_max*2;
+    if (_seg_dest == _seg_dest_inline) {
+      BFT_MALLOC(_seg_dest, n_segs_max, double *);
+      BFT_MALLOC(_seg_size, n_segs_max, int);
+      memcpy(_seg_dest, _seg_dest_inline, _n_segs*sizeof(double *));
+      memcpy(_seg_size, _seg_size_inline, _n_segs*sizeof(int));
+    }
+    else {
+      BFT_REALLOC(_seg_dest, n_segs_max, double *);
+      BFT_REALLOC(_seg_size, n_segs_max, int);
+    }
+    _n_segs_max = n_segs_max;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Queue a local value for reduction.
+ *
+ * If a reduction is in progress, it is completed first.
+ *
+ * \param[in]   local_val  local value
+ * \param[out]  result     global sum, available after \ref wait
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum::add(double   local_val,
+                            double  *result)
+{
+  add(1, &local_val, result);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Queue local values for reduction.
+ *
+ * If a reduction is in progress, it is completed first.
+ *
+ * \param[in]   n           number of values
+ * \param[in]   local_vals  local values
+ * \param[out]  results     global sums, available after \ref wait
+ *                          (may be the same array as local_vals)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum::add(int           n,
+                            const double  local_vals[],
+                            double        results[])
+{
+  if (n < 1)
+    return;
+
+  if (_started)
+    wait();
+
+  _reserve(n);
+
+  memcpy(_vals + _n_vals, local_vals, n*sizeof(double));
+  _n_vals += n;
+
+  /* Contiguous results are merged in a single segment */
+
+  if (   _n_segs > 0
+      && _seg_dest[_n_segs-1] + _seg_size[_n_segs-1] == results)
+    _seg_size[_n_segs-1] += n;
+  else {
+    _seg_dest[_n_segs] = results;
+    _seg_size[_n_segs] = n;
+    _n_segs += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start the reduction of queued values.
+ *
+ * When the MPI library allows it, a non-blocking reduction is used,
+ * so that other computations may be done until \ref wait is called.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum::start(void)
+{
+  if (_started || _n_vals < 1)
+    return;
+
+  _started = true;
+
+#if defined(HAVE_MPI)
+
+  if (_comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(_vals, _sums, _n_vals, MPI_DOUBLE, MPI_SUM, _comm,
+                   &_request);
+#else
+    MPI_Allreduce(_vals, _sums, _n_vals, MPI_DOUBLE, MPI_SUM, _comm);
+#endif
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  memcpy(_sums, _vals, _n_vals*sizeof(double));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete the reduction of queued values and copy results.
+ *
+ * If no reduction was started, one is started first.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_deferred_sum::wait(void)
+{
+  if (_started == false) {
+    if (_n_vals < 1)
+      return;
+    start();
+  }
+
+#if defined(HAVE_MPI)
+  if (_request != MPI_REQUEST_NULL)
+    MPI_Wait(&_request, MPI_STATUS_IGNORE);
+#endif
+
+  const double *s = _sums;
+  for (int i = 0; i < _n_segs; i++) {
+    memcpy(_seg_dest[i], s, _seg_size[i]*sizeof(double));
+    s += _seg_size[i];
+  }
+
+  _n_vals = 0;
+  _n_segs = 0;
+  _started = false;
+}
+
 /*----------------------------------------------------------------------------*/
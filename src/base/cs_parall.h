@@ -32,6 +32,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_defs.h"
+#include "cs_comm_stats.h"
 #include "cs_execution_context.h"
 
 #if defined(__cplusplus)
@@ -93,8 +94,8 @@ cs_parall_counter(cs_gnum_t   cpt[],
                   const int   n)
 {
   if (cs_glob_n_ranks > 1) {
-    MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
-                  cs_glob_mpi_comm);
+    cs_comm_allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
+                      cs_glob_mpi_comm);
   }
 }
 
@@ -122,8 +123,8 @@ cs_parall_counter_max(cs_lnum_t   cpt[],
                       const int   n)
 {
   if (cs_glob_n_ranks > 1) {
-    MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
-                  cs_glob_mpi_comm);
+    cs_comm_allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
+                      cs_glob_mpi_comm);
   }
 }
 
@@ -153,8 +154,8 @@ cs_parall_sum(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_SUM,
-                  cs_glob_mpi_comm);
+    cs_comm_allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype],
+                      MPI_SUM, cs_glob_mpi_comm);
   }
 }
 
@@ -186,8 +187,8 @@ cs_parall_max(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MAX,
-                  cs_glob_mpi_comm);
+    cs_comm_allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype],
+                      MPI_MAX, cs_glob_mpi_comm);
   }
 }
 
@@ -219,8 +220,8 @@ cs_parall_min(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_MIN,
-                  cs_glob_mpi_comm);
+    cs_comm_allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype],
+                      MPI_MIN, cs_glob_mpi_comm);
   }
 }
 
@@ -712,8 +713,7 @@ cs_parall_counter(cs_execution_context  *ec,
                   const int              n)
 {
   if (ec->use_mpi()) {
-    MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM,
-                  ec->comm());
+    cs_comm_allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_GNUM, MPI_SUM, ec->comm());
   }
 }
 
@@ -744,8 +744,7 @@ cs_parall_counter_max(cs_execution_context  *ec,
                       const int              n)
 {
   if (ec->use_mpi()) {
-    MPI_Allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX,
-                  ec->comm());
+    cs_comm_allreduce(MPI_IN_PLACE, cpt, n, CS_MPI_LNUM, MPI_MAX, ec->comm());
   }
 }
 
@@ -778,9 +777,8 @@ cs_parall_sum(cs_execution_context  *ec,
               void                  *val)
 {
   if (ec->use_mpi()) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n,
-                  cs_datatype_to_mpi[datatype], MPI_SUM,
-                  ec->comm());
+    cs_comm_allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype],
+                      MPI_SUM, ec->comm());
   }
 }
 
@@ -815,9 +813,8 @@ cs_parall_max(cs_execution_context  *ec,
               void                  *val)
 {
   if (ec->use_mpi()) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n,
-                  cs_datatype_to_mpi[datatype], MPI_MAX,
-                  ec->comm());
+    cs_comm_allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype],
+                      MPI_MAX, ec->comm());
   }
 }
 
@@ -852,9 +849,8 @@ cs_parall_min(cs_execution_context  *ec,
               void                  *val)
 {
   if (ec->use_mpi()) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n,
-                  cs_datatype_to_mpi[datatype], MPI_MIN,
-                  ec->comm());
+    cs_comm_allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype],
+                      MPI_MIN, ec->comm());
   }
 }
 
@@ -1586,6 +1582,104 @@ cs_parall_min_strided
 
 #endif // defined(HAVE_MPI)
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Deferred sum of floating-point values over all ranks.
+ *
+ * Local partial sums (such as those of dot products and norms in iterative
+ * solvers) are queued using \ref add, and reduced together using a single
+ * all-reduce operation, which is non-blocking when the MPI library allows
+ * it, so that it may be overlapped with other computations between
+ * \ref start and \ref wait. Global sums are then copied to the locations
+ * provided when queuing values.
+ *
+ * Values added while a reduction is in progress are queued for the
+ * next reduction, once the current one is completed.
+ */
+/*----------------------------------------------------------------------------*/
+
+class cs_parall_deferred_sum {
+
+public:
+
+  //! Constructor, using the default communicator.
+  cs_parall_deferred_sum(void);
+
+  //! Constructor, using the communicator of an execution context.
+  cs_parall_deferred_sum(const cs_execution_context  *ec);
+
+#if defined(HAVE_MPI)
+
+  //! Constructor, using a given communicator (MPI_COMM_NULL for local sums).
+  cs_parall_deferred_sum(MPI_Comm  comm);
+
+#endif
+
+  //! Destructor; pending reductions are completed.
+  ~cs_parall_deferred_sum(void);
+
+  // Copy is not allowed, as buffers and pending requests are owned.
+  cs_parall_deferred_sum(const cs_parall_deferred_sum&) = delete;
+  cs_parall_deferred_sum& operator=(const cs_parall_deferred_sum&) = delete;
+
+  //! Queue a local value, whose global sum is copied to result.
+  void
+  add(double   local_val,
+      double  *result);
+
+  //! Queue local values, whose global sums are copied to results
+  //! (which may be the same array as local_vals).
+  void
+  add(int           n,
+      const double  local_vals[],
+      double        results[]);
+
+  //! Start the reduction of queued values.
+  void
+  start(void);
+
+  //! Complete the reduction of queued values and copy results.
+  void
+  wait(void);
+
+  //! Reduce queued values and copy results.
+  void
+  flush(void)
+  {
+    start();
+    wait();
+  }
+
+private:
+
+  void
+  _reserve(int  n_vals_add);
+
+  static const int  _n_inline = 16;  /* size of inline buffers */
+
+  int       _n_vals;                 /* number of queued values */
+  int       _n_segs;                 /* number of result segments */
+  int       _n_vals_max;             /* values buffer capacity */
+  int       _n_segs_max;             /* segments buffer capacity */
+  bool      _started;                /* reduction in progress ? */
+
+  double   *_vals;                   /* local values */
+  double   *_sums;                   /* global sums */
+  double  **_seg_dest;               /* result location of each segment */
+  int      *_seg_size;               /* number of values of each segment */
+
+  double    _vals_inline[_n_inline];
+  double    _sums_inline[_n_inline];
+  double   *_seg_dest_inline[_n_inline];
+  int       _seg_size_inline[_n_inline];
+
+#if defined(HAVE_MPI)
+  MPI_Comm     _comm;                /* associated communicator */
+  MPI_Request  _request;             /* pending request */
+#endif
+
+};
+
 #endif //__cplusplus
 
 /*----------------------------------------------------------------------------*/
@@ -1093,6 +1093,13 @@ cs_parameters_define_field_keys(void)
   cs_field_define_key_int("convection_limiter_id", -1, CS_FIELD_VARIABLE);
   cs_field_define_key_int("diffusion_limiter_id", -1, CS_FIELD_VARIABLE);
 
+  /* Reuse convection/diffusion gradients across passes of a same sweep */
+  cs_field_define_key_int("gradient_reuse", 0, CS_FIELD_VARIABLE);
+  /* Increment tolerance for partial update of reused gradients
+     during sweeps (< 0 for full recomputation) */
+  cs_field_define_key_double("gradient_update_tolerance", -1.,
+                             CS_FIELD_VARIABLE);
+
   cs_field_define_key_int("coupling_entity", -1, 0);
 
   /*
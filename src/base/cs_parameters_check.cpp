@@ -1372,7 +1372,7 @@ cs_parameters_check(void)
 
   if (   cs_glob_mesh->n_init_perio > 0
       && cs_glob_wall_distance_options->need_compute
-      && cs_glob_wall_distance_options->method == 2)
+      && cs_glob_wall_distance_options->method >= 2)
     cs_parameters_error
       (CS_ABORT_DELAYED,
        _("in periodic boundary condition definitions"),
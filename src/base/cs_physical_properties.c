@@ -169,6 +169,32 @@ static void                     *_cs_coolprop_dl_lib = NULL;
 
 #endif
 
+/* Optional tabulation of properties computed by external libraries
+   (EOS or CoolProp), on a uniform grid of the thermodynamic plane */
+
+typedef struct {
+
+  cs_real_t   x_min[2];    /* table lower bounds */
+  cs_real_t   x_max[2];    /* table upper bounds */
+  cs_real_t  *val;         /* values at nodes */
+  char       *direct;      /* 1 for table cells where the interpolation
+                              error is too high, 0 otherwise */
+
+} _phys_prop_tab_t;
+
+static int        _tab_n[2] = {0, 0};        /* nodes per axis */
+static bool       _tab_adapt = true;         /* adapt ranges to values */
+static cs_real_t  _tab_range[2][2];          /* fixed ranges */
+static cs_real_t  _tab_rtol = 1e-4;          /* interpolation tolerance */
+
+static _phys_prop_tab_t  _tab[CS_PHYS_PROP_SPEED_OF_SOUND + 1];
+
+static unsigned long long  _tab_n_builds = 0;      /* number of builds */
+static unsigned long long  _tab_n_queries = 0;     /* tabulated queries */
+static unsigned long long  _tab_n_direct = 0;      /* direct calls for values
+                                                      outside tables or with
+                                                      insufficient accuracy */
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -193,6 +219,339 @@ _thermal_table_create(void)
   return tt;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a property directly using the external property library.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_direct(cs_phys_prop_type_t  property,
+                  cs_lnum_t            n_vals,
+                  const cs_real_t      var1[],
+                  const cs_real_t      var2[],
+                  cs_real_t            val[])
+{
+#if defined(HAVE_EOS) /* always a plugin */
+  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_EOS) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      n_vals,
+                      (double *)var1,
+                      (double *)var2,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_COOLPROP) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           _cs_coolprop_backend,
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#endif
+
+  CS_UNUSED(property);
+  CS_UNUSED(n_vals);
+  CS_UNUSED(var1);
+  CS_UNUSED(var2);
+  CS_UNUSED(val);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute Catmull-Rom cubic interpolation weights and base index along
+ * one table axis.
+ *
+ * parameters:
+ *   u  <-- coordinate in node index units (0 <= u <= n-1)
+ *   n  <-- number of nodes along axis
+ *   id --> ids of the 4 nodes used (clipped to table)
+ *   w  --> associated weights
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_cubic_weights(cs_real_t  u,
+               int        n,
+               int        id[4],
+               cs_real_t  w[4])
+{
+  int i = CS_MIN((int)u, n - 2);
+  cs_real_t t = u - i;
+  cs_real_t t2 = t*t, t3 = t2*t;
+
+  w[0] = 0.5*(-t3 + 2.*t2 - t);
+  w[1] = 0.5*(3.*t3 - 5.*t2 + 2.);
+  w[2] = 0.5*(-3.*t3 + 4.*t2 + t);
+  w[3] = 0.5*(t3 - t2);
+
+  for (int j = 0; j < 4; j++)
+    id[j] = CS_MIN(CS_MAX(i - 1 + j, 0), n - 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Bicubic interpolation in a property table.
+ *
+ * parameters:
+ *   t <-- property table
+ *   u <-- coordinate along first axis, in node index units
+ *   v <-- coordinate along second axis, in node index units
+ *
+ * returns:
+ *   interpolated value
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_tab_interpolate(const _phys_prop_tab_t  *t,
+                 cs_real_t                u,
+                 cs_real_t                v)
+{
+  const int n0 = _tab_n[0];
+
+  int iu[4], iv[4];
+  cs_real_t wu[4], wv[4];
+
+  _cubic_weights(u, n0, iu, wu);
+  _cubic_weights(v, _tab_n[1], iv, wv);
+
+  cs_real_t f = 0;
+  for (int j = 0; j < 4; j++) {
+    const cs_real_t *t_j = t->val + (size_t)iv[j]*n0;
+    f += wv[j] * (  wu[0]*t_j[iu[0]] + wu[1]*t_j[iu[1]]
+                  + wu[2]*t_j[iu[2]] + wu[3]*t_j[iu[3]]);
+  }
+
+  return f;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the table of a property over a given range.
+ *
+ * The interpolation error is estimated at the center of each table cell,
+ * and cells in which it exceeds the tolerance are marked for direct
+ * computation.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   x_min    <-- lower bounds
+ *   x_max    <-- upper bounds
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_build(cs_phys_prop_type_t  property,
+           const cs_real_t      x_min[2],
+           const cs_real_t      x_max[2])
+{
+  _phys_prop_tab_t *t = _tab + property;
+
+  const int n0 = _tab_n[0], n1 = _tab_n[1];
+  const cs_lnum_t n_nodes = n0*n1;
+  const cs_lnum_t n_cells = (n0-1)*(n1-1);
+
+  for (int i = 0; i < 2; i++) {
+    t->x_min[i] = x_min[i];
+    t->x_max[i] = x_max[i];
+  }
+
+  const cs_real_t dx0 = (x_max[0] - x_min[0]) / (n0 - 1);
+  const cs_real_t dx1 = (x_max[1] - x_min[1]) / (n1 - 1);
+
+  cs_real_t *x0, *x1, *f_c;
+  BFT_MALLOC(x0, n_nodes, cs_real_t);
+  BFT_MALLOC(x1, n_nodes, cs_real_t);
+  BFT_MALLOC(f_c, n_cells, cs_real_t);
+  BFT_REALLOC(t->val, n_nodes, cs_real_t);
+  BFT_REALLOC(t->direct, n_cells, char);
+
+  /* Values at nodes */
+
+  for (cs_lnum_t k = 0; k < n_nodes; k++) {
+    x0[k] = x_min[0] + (k % n0)*dx0;
+    x1[k] = x_min[1] + (k / n0)*dx1;
+  }
+
+  _phys_prop_direct(property, n_nodes, x0, x1, t->val);
+
+  /* Values at cell centers, for error control */
+
+  for (cs_lnum_t k = 0; k < n_cells; k++) {
+    x0[k] = x_min[0] + ((k % (n0-1)) + 0.5)*dx0;
+    x1[k] = x_min[1] + ((k / (n0-1)) + 0.5)*dx1;
+  }
+
+  _phys_prop_direct(property, n_cells, x0, x1, f_c);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t k = 0; k < n_cells; k++) {
+    cs_real_t f_i = _tab_interpolate(t, (k % (n0-1)) + 0.5, (k / (n0-1)) + 0.5);
+    t->direct[k] = (CS_ABS(f_i - f_c[k]) > _tab_rtol*CS_ABS(f_c[k])) ? 1 : 0;
+  }
+
+  BFT_FREE(x0);
+  BFT_FREE(x1);
+  BFT_FREE(f_c);
+
+  _tab_n_builds += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a property by interpolation in a table.
+ *
+ * With adaptive ranges, the table is (re)built so as to cover all values.
+ * Values outside a fixed table range or in table cells with insufficient
+ * accuracy are computed directly.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_compute(cs_phys_prop_type_t  property,
+             cs_lnum_t            n_vals,
+             const cs_real_t      var1[],
+             const cs_real_t      var2[],
+             cs_real_t            val[])
+{
+  _phys_prop_tab_t *t = _tab + property;
+
+  if (_tab_adapt) {
+
+    cs_real_t v_min[2] = {var1[0], var2[0]};
+    cs_real_t v_max[2] = {var1[0], var2[0]};
+
+    for (cs_lnum_t i = 1; i < n_vals; i++) {
+      v_min[0] = CS_MIN(v_min[0], var1[i]);
+      v_max[0] = CS_MAX(v_max[0], var1[i]);
+      v_min[1] = CS_MIN(v_min[1], var2[i]);
+      v_max[1] = CS_MAX(v_max[1], var2[i]);
+    }
+
+    bool rebuild = (t->val == NULL);
+    if (!rebuild) {
+      for (int j = 0; j < 2; j++) {
+        if (v_min[j] < t->x_min[j] || v_max[j] > t->x_max[j])
+          rebuild = true;
+      }
+    }
+
+    /* Extend range with a margin so as to limit rebuilds */
+
+    if (rebuild) {
+      for (int j = 0; j < 2; j++) {
+        if (t->val != NULL) {
+          v_min[j] = CS_MIN(v_min[j], t->x_min[j]);
+          v_max[j] = CS_MAX(v_max[j], t->x_max[j]);
+        }
+        cs_real_t d = 0.1*(v_max[j] - v_min[j]);
+        if (d <= 0)
+          d = CS_MAX(1e-3*CS_ABS(v_max[j]), 1e-12);
+        v_min[j] -= d;
+        v_max[j] += d;
+      }
+      _tab_build(property, v_min, v_max);
+    }
+
+  }
+  else if (t->val == NULL) {
+    const cs_real_t x_min[2] = {_tab_range[0][0], _tab_range[1][0]};
+    const cs_real_t x_max[2] = {_tab_range[0][1], _tab_range[1][1]};
+    _tab_build(property, x_min, x_max);
+  }
+
+  const int n0 = _tab_n[0], n1 = _tab_n[1];
+
+  const cs_real_t inv_dx0 = (n0 - 1) / (t->x_max[0] - t->x_min[0]);
+  const cs_real_t inv_dx1 = (n1 - 1) / (t->x_max[1] - t->x_min[1]);
+
+  char *direct;
+  BFT_MALLOC(direct, n_vals, char);
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+
+    cs_real_t u = (var1[i] - t->x_min[0]) * inv_dx0;
+    cs_real_t v = (var2[i] - t->x_min[1]) * inv_dx1;
+
+    if (!(u >= 0 && u <= n0 - 1 && v >= 0 && v <= n1 - 1)) {
+      direct[i] = 1;
+      continue;
+    }
+
+    int iu = CS_MIN((int)u, n0 - 2), iv = CS_MIN((int)v, n1 - 2);
+
+    direct[i] = t->direct[iv*(n0-1) + iu];
+    if (direct[i] == 0)
+      val[i] = _tab_interpolate(t, u, v);
+  }
+
+  /* Direct computation outside of tabulated range or accurate cells */
+
+  cs_lnum_t n_direct = 0;
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    n_direct += direct[i];
+
+  if (n_direct > 0) {
+
+    cs_lnum_t *d_ids;
+    cs_real_t *d_var1, *d_var2, *d_val;
+    BFT_MALLOC(d_ids, n_direct, cs_lnum_t);
+    BFT_MALLOC(d_var1, n_direct, cs_real_t);
+    BFT_MALLOC(d_var2, n_direct, cs_real_t);
+    BFT_MALLOC(d_val, n_direct, cs_real_t);
+
+    n_direct = 0;
+    for (cs_lnum_t i = 0; i < n_vals; i++) {
+      if (direct[i]) {
+        d_ids[n_direct] = i;
+        d_var1[n_direct] = var1[i];
+        d_var2[n_direct] = var2[i];
+        n_direct++;
+      }
+    }
+
+    _phys_prop_direct(property, n_direct, d_var1, d_var2, d_val);
+
+    for (cs_lnum_t j = 0; j < n_direct; j++)
+      val[d_ids[j]] = d_val[j];
+
+    BFT_FREE(d_ids);
+    BFT_FREE(d_var1);
+    BFT_FREE(d_var2);
+    BFT_FREE(d_val);
+
+  }
+
+  BFT_FREE(direct);
+
+  _tab_n_queries += n_vals;
+  _tab_n_direct += n_direct;
+}
+
+/*----------------------------------------------------------------------------
+ * Free property tables.
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_free(void)
+{
+  for (int i = 0; i < CS_PHYS_PROP_SPEED_OF_SOUND + 1; i++) {
+    BFT_FREE(_tab[i].val);
+    BFT_FREE(_tab[i].direct);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get xdef of a property on a given zone.
@@ -425,6 +784,14 @@ cs_thermal_table_finalize(void)
     }
     BFT_FREE(_cs_coolprop_backend);
 #endif
+    if (_tab_n_queries > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  Tabulated values (%d x %d nodes):  %llu\n"
+                      "    computed directly:               %llu\n"
+                      "    number of table builds:          %llu\n"),
+                    _tab_n[0], _tab_n[1], _tab_n_queries, _tab_n_direct,
+                    _tab_n_builds);
+    _tab_free();
     BFT_FREE(cs_glob_thermal_table->material);
     BFT_FREE(cs_glob_thermal_table->method);
     BFT_FREE(cs_glob_thermal_table);
@@ -506,6 +873,67 @@ cs_physical_properties_set_coolprop_backend(const char  *backend)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate tabulation of properties computed by the EOS or CoolProp
+ *        libraries.
+ *
+ * When active, properties are computed by the property library on a uniform
+ * grid of the thermodynamic plane, and then interpolated (bicubic
+ * interpolation) from that table. The interpolation error is estimated
+ * at the center of each table cell when building the table, and values
+ * in cells where it exceeds the given relative tolerance (such as near
+ * phase boundaries), or outside of the table range, are computed directly
+ * by the library.
+ *
+ * If ranges are not given, the table range is adapted to the values
+ * queried (with a margin), and the table rebuilt when values fall outside.
+ * Otherwise, bounds are expressed in the units used by the library
+ * (SI units, temperatures in Kelvin).
+ *
+ * \param[in]  n_nodes  number of nodes along each plane axis,
+ *                      or 0 to deactivate tabulation
+ * \param[in]  rtol     relative interpolation tolerance
+ * \param[in]  range_1  lower and upper bounds along first plane axis,
+ *                      or NULL for adaptive range
+ * \param[in]  range_2  lower and upper bounds along second plane axis,
+ *                      or NULL for adaptive range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_physical_properties_set_tabulation(const int        n_nodes[2],
+                                      cs_real_t        rtol,
+                                      const cs_real_t  range_1[2],
+                                      const cs_real_t  range_2[2])
+{
+  _tab_free();
+
+  _tab_n[0] = 0;
+  _tab_n[1] = 0;
+
+  if (n_nodes[0] < 2 || n_nodes[1] < 2)
+    return;
+
+  _tab_adapt = (range_1 == NULL || range_2 == NULL);
+
+  if (_tab_adapt == false) {
+    if (range_1[1] <= range_1[0] || range_2[1] <= range_2[0])
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: invalid tabulation range ([%g, %g] x [%g, %g])."),
+                __func__, range_1[0], range_1[1], range_2[0], range_2[1]);
+    for (int i = 0; i < 2; i++) {
+      _tab_range[0][i] = range_1[i];
+      _tab_range[1][i] = range_2[i];
+    }
+  }
+
+  for (int i = 0; i < 2; i++)
+    _tab_n[i] = n_nodes[i];
+
+  _tab_rtol = rtol;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute a physical property.
@@ -582,28 +1010,11 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
 
   /* Compute proper */
 
-#if defined(HAVE_EOS) /* always a plugin */
-  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_EOS) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_COOLPROP) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           _cs_coolprop_backend,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#endif
+  if (   _tab_n[0] > 1 && _n_vals > 1
+      && cs_glob_thermal_table->type != CS_PHYS_PROP_TABLE_USER)
+    _tab_compute(property, _n_vals, var1_c, var2_c, val);
+  else
+    _phys_prop_direct(property, _n_vals, var1_c, var2_c, val);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_physprop_lib_t_tot, &t0, &t1);
@@ -134,6 +134,40 @@ cs_physical_properties_get_coolprop_backend(void);
 void
 cs_physical_properties_set_coolprop_backend(const char  *backend);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate tabulation of properties computed by the EOS or CoolProp
+ *        libraries.
+ *
+ * When active, properties are computed by the property library on a uniform
+ * grid of the thermodynamic plane, and then interpolated (bicubic
+ * interpolation) from that table. The interpolation error is estimated
+ * at the center of each table cell when building the table, and values
+ * in cells where it exceeds the given relative tolerance (such as near
+ * phase boundaries), or outside of the table range, are computed directly
+ * by the library.
+ *
+ * If ranges are not given, the table range is adapted to the values
+ * queried (with a margin), and the table rebuilt when values fall outside.
+ * Otherwise, bounds are expressed in the units used by the library
+ * (SI units, temperatures in Kelvin).
+ *
+ * \param[in]  n_nodes  number of nodes along each plane axis,
+ *                      or 0 to deactivate tabulation
+ * \param[in]  rtol     relative interpolation tolerance
+ * \param[in]  range_1  lower and upper bounds along first plane axis,
+ *                      or NULL for adaptive range
+ * \param[in]  range_2  lower and upper bounds along second plane axis,
+ *                      or NULL for adaptive range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_physical_properties_set_tabulation(const int        n_nodes[2],
+                                      cs_real_t        rtol,
+                                      const cs_real_t  range_1[2],
+                                      const cs_real_t  range_2[2]);
+
 /*----------------------------------------------------------------------------
  * Compute a physical property.
  *
@@ -121,7 +121,8 @@ static cs_porosity_from_scan_opt_t _porosity_from_scan_opt = {
   .use_staircase = false,
   .eigenvalue_criteria = 1e-3,
   .use_restart = false,
-  .cog_location = CS_COG_FROM_FLUID_FACES
+  .cog_location = CS_COG_FROM_FLUID_FACES,
+  .n_points_per_chunk = 1000000
 };
 
 /*============================================================================
@@ -141,83 +142,232 @@ static  ple_locator_t  *_locator = nullptr;  /* PLE locator */
  * Incremental local solid plane computation at cells from scan points.
  * So that the summed squared distance to all points is minimized.
  *
+ * Contributions of all points are accumulated (the threshold on the number
+ * of points per cell is applied when computing the planes), so that
+ * results do not depend on the way points are split between calls.
+ *
  * parameters:
- *   m               <-- pointer to mesh
- *   n_points        <-- total number of points
+ *   n_points        <-- number of points
  *   elt_ids         <-- point to cell id
- *   n_points_cell   <-- number of points in cell
  *   cen_cell        <-- center of gravity of cell
- *   mom_mat         --> incremental second moment matrix
+ *   point_coords    <-- point coordinates
+ *   mom_mat         <-> incremental second moment matrix
+ *   mom_comp        <-> compensation of the second moment matrix summation
  *----------------------------------------------------------------------------*/
 
 static void
-_incremental_solid_plane_from_points(const cs_mesh_t   *m,
-                                     cs_lnum_t          n_points,
+_incremental_solid_plane_from_points(cs_lnum_t          n_points,
                                      const cs_lnum_t    elt_ids[],
-                                     const cs_real_t    n_points_cell[],
                                      const cs_real_t    cen_cell[][3],
                                      const cs_real_t    point_coords[][3],
-                                     cs_real_t          mom_mat[][3][3])
+                                     cs_real_t          mom_mat[][3][3],
+                                     cs_real_t          mom_comp[][3][3])
 {
-  cs_real_33_t  *c, *d, *z, *t;
-  BFT_MALLOC(c, m->n_cells, cs_real_33_t);
-  BFT_MALLOC(d, m->n_cells, cs_real_33_t);
-  BFT_MALLOC(z, m->n_cells, cs_real_33_t);
-  BFT_MALLOC(t, m->n_cells, cs_real_33_t);
-  const cs_real_t threshold = _porosity_from_scan_opt.threshold;
+  // Loop over points
 
-  // Initialization
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
 
-  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+    cs_lnum_t c_id = elt_ids[p_id];
+
+    cs_real_t point_local[3];
+    for (cs_lnum_t i = 0; i < 3; i++)
+      point_local[i] = (point_coords[p_id][i] - cen_cell[c_id][i]);
+
+    // Kahan summation
     for (cs_lnum_t i = 0; i < 3; i++) {
       for (cs_lnum_t j = 0; j < 3; j++) {
-        c[c_id][i][j] = 0.;
-        d[c_id][i][j] = 0.;
-        t[c_id][i][j] = 0.;
-        z[c_id][i][j] = 0.;
+        cs_real_t z = point_local[i] * point_local[j] - mom_comp[c_id][i][j];
+        cs_real_t t = mom_mat[c_id][i][j] + z;
+        mom_comp[c_id][i][j] = (t - mom_mat[c_id][i][j]) - z;
+        mom_mat[c_id][i][j] = t;
       }
     }
-  }
 
-  // Loop over points
+  } // Loop over points
+}
 
-  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+/*----------------------------------------------------------------------------
+ * Read a given number of points from a scan points file.
+ *
+ * parameters:
+ *   file          <-- scan points file
+ *   n_points      <-- number of points to read
+ *   point_coords  --> transformed point coordinates
+ *   colors        --> point colors
+ *   min_vec       <-> bounding box min. coordinates
+ *   max_vec       <-> bounding box max. coordinates
+ *----------------------------------------------------------------------------*/
 
-    cs_lnum_t c_id = elt_ids[p_id];
+static void
+_read_scan_points(FILE         *file,
+                  cs_lnum_t     n_points,
+                  cs_real_3_t  *point_coords,
+                  float        *colors,
+                  cs_real_t     min_vec[3],
+                  cs_real_t     max_vec[3])
+{
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    int num, green, red, blue;
+    cs_real_4_t xyz;
+    for (int j = 0; j < 3; j++)
+      point_coords[i][j] = 0.;
+
+    if (fscanf(file, "%lf", &(xyz[0])) != 1)
+      bft_error
+        (__FILE__,__LINE__, 0,
+         _("Porosity from scan: Error while reading dataset. Line %d\n"),
+         (int)i);
+    if (fscanf(file, "%lf", &(xyz[1])) != 1)
+      bft_error
+        (__FILE__,__LINE__, 0,
+         _("Porosity from scan: Error while reading dataset."));
+    if (fscanf(file, "%lf", &(xyz[2])) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset."));
+
+    /* Translation and rotation */
+    xyz[3] = 1.;
+    for (int j = 0; j < 3; j++) {
+      for (int k = 0; k < 4; k++)
+        point_coords[i][j]
+          += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
+
+      /* Compute bounding box*/
+      min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
+      max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
+    }
 
-    if (n_points_cell[c_id] > threshold) { // At least three points required
+    /* Intensities */
+    if (fscanf(file, "%d", &num) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset."));
 
-      cs_real_t point_local[3];
-      for (cs_lnum_t i = 0; i < 3; i++)
-        point_local[i] = (point_coords[p_id][i] - cen_cell[c_id][i]);
-
-      // Kahan summation
-      for (cs_lnum_t i = 0; i < 3; i++) {
-        for (cs_lnum_t j = 0; j < 3; j++) {
-          z[c_id][i][j] = point_local[i] * point_local[j]
-                            - c[c_id][i][j];
-          t[c_id][i][j] = d[c_id][i][j] + z[c_id][i][j];
-          c[c_id][i][j] = (t[c_id][i][j] - d[c_id][i][j])
-                            - z[c_id][i][j];
-          d[c_id][i][j] = t[c_id][i][j];
-        }
-      }
-    }
+    /* Red */
+    if (fscanf(file, "%d", &red) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset (red). "
+                  "npoints read %d\n"), (int)i);
+    /* Green */
+    if (fscanf(file, "%d", &green) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset (green). "
+                  "npoints read %d\n"), (int)i);
+    /* Blue */
+    if (fscanf(file, "%d\n", &blue) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset (blue). "
+                  "npoints read %d\n"), (int)i);
 
-  } // Loop over points
+    /* When colors are written as int, Paraview interprets them in [0, 255]
+     * when they are written as float, Paraview interprets them in [0., 1.]
+     * */
+    colors[3*i + 0] = red/255.;
+    colors[3*i + 1] = green/255.;
+    colors[3*i + 2] = blue/255.;
+  }
+}
 
-  BFT_FREE(z);
-  BFT_FREE(t);
-  BFT_FREE(c);
+/*----------------------------------------------------------------------------
+ * Locate a set of scan points (defined on rank 0) on the mesh and
+ * accumulate their contributions to cell quantities.
+ *
+ * parameters:
+ *   mq              <-- pointer to mesh quantities
+ *   location_mesh   <-- location mesh
+ *   n_points        <-- number of points (on rank 0)
+ *   point_coords    <-- point coordinates
+ *   colors          <-- point colors
+ *   nb_scan         <-> number of points per cell
+ *   cen_points      <-> points center of gravity (relative to cell center)
+ *   cell_color      <-> cumulated points color
+ *   mom_mat         <-> incremental second moment matrix
+ *   mom_comp        <-> compensation of the second moment matrix summation
+ *----------------------------------------------------------------------------*/
 
-  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
-    for (cs_lnum_t i = 0; i < 3; i++)
-      for (cs_lnum_t j = 0; j < 3; j++)
-          mom_mat[c_id][i][j] += d[c_id][i][j];
+static void
+_locate_scan_points(const cs_mesh_quantities_t  *mq,
+                    fvm_nodal_t                 *location_mesh,
+                    cs_lnum_t                    n_points,
+                    cs_real_3_t                 *point_coords,
+                    float                       *colors,
+                    cs_real_t                   *nb_scan,
+                    cs_real_t                   *cen_points,
+                    cs_real_t                   *cell_color,
+                    cs_real_33_t                *mom_mat,
+                    cs_real_33_t                *mom_comp)
+{
+  int options[PLE_LOCATOR_N_OPTIONS];
+  for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
+    options[i] = 0;
+  options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
 
-  } // Loop over cells
+#if defined(PLE_HAVE_MPI)
+  _locator = ple_locator_create(cs_glob_mpi_comm,
+                                cs_glob_n_ranks,
+                                0);
+#else
+  _locator = ple_locator_create();
+#endif
+
+  cs_lnum_t _n_points = (cs_glob_rank_id < 1) ? n_points : 0;
+  cs_real_t *_point_coords
+    = (cs_glob_rank_id < 1) ? (cs_real_t *)point_coords : nullptr;
+
+  ple_locator_set_mesh(_locator,
+                       location_mesh,
+                       options,
+                       0., /* tolerance_base */
+                       0.1, /* tolerance */
+                       3, /* dim */
+                       _n_points,
+                       nullptr,
+                       nullptr, /* point_tag */
+                       _point_coords,
+                       nullptr, /* distance */
+                       cs_coupling_mesh_extents,
+                       cs_coupling_point_in_mesh_p);
+
+  /* Shift from 1-base to 0-based locations */
+  ple_locator_shift_locations(_locator, -1);
+
+  /* Number of distant points located on local mesh. */
+  cs_lnum_t n_points_dist = ple_locator_get_n_dist_points(_locator);
+
+  const cs_lnum_t *dist_loc = ple_locator_get_dist_locations(_locator);
+  const ple_coord_t *dist_coords = ple_locator_get_dist_coords(_locator);
+
+  float *dist_colors = nullptr;
+  BFT_MALLOC(dist_colors, 3*n_points_dist, float);
+
+  ple_locator_exchange_point_var(_locator,
+                                 dist_colors,
+                                 colors,
+                                 nullptr,
+                                 sizeof(float),
+                                 3,
+                                 1);
+
+  for (cs_lnum_t i = 0; i < n_points_dist; i++) {
+    cs_lnum_t c_id = dist_loc[i];
+    nb_scan[c_id] += 1.;
+    for (cs_lnum_t idim = 0; idim < 3; idim++) {
+      cen_points[c_id*3+idim]
+        += (dist_coords[i*3 + idim] - mq->cell_cen[c_id*3+idim]);
+
+      cell_color[c_id*3+idim] += dist_colors[i*3 + idim];
+    }
+  }
+
+  _incremental_solid_plane_from_points(n_points_dist,
+                                       dist_loc,
+                                       (const cs_real_3_t *)mq->cell_cen,
+                                       (const cs_real_3_t *)dist_coords,
+                                       mom_mat,
+                                       mom_comp);
+
+  BFT_FREE(dist_colors);
 
-  BFT_FREE(d);
+  _locator = ple_locator_destroy(_locator);
 }
 
 /*----------------------------------------------------------------------------
@@ -360,14 +510,13 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
   cs_real_t *cell_color =
     (cs_real_t *)cs_field_by_name("cell_scan_points_color")->val;
 
-  /* Immersed solid roughness */
-  cs_real_t *c_w_face_rough =
-    (cs_real_t *)cs_field_by_name("solid_roughness")->val;
-
-  /* Covariance matrix for solid plane computation */
-  cs_real_33_t *mom_mat;
+  /* Covariance matrix for solid plane computation
+     (and compensation for its summation) */
+  cs_real_33_t *mom_mat, *mom_comp;
   BFT_MALLOC(mom_mat, m->n_cells, cs_real_33_t);
+  BFT_MALLOC(mom_comp, m->n_cells, cs_real_33_t);
   memset(mom_mat, 0., m->n_cells * sizeof(cs_real_33_t));
+  memset(mom_comp, 0., m->n_cells * sizeof(cs_real_33_t));
 
   /* Loop on file_names */
   char *tok;
@@ -380,6 +529,19 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
 
   tok = strtok(file_names, sep);
 
+  /* Pointer to field */
+  cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
+
+  /* Location mesh where points will be localized */
+  fvm_nodal_t *location_mesh =
+    cs_mesh_connect_cells_to_nodal(m,
+                                   "pts_location_mesh",
+                                   false, // no family info
+                                   m->n_cells,
+                                   nullptr);
+
+  fvm_nodal_make_vertices_private(location_mesh);
+
   while (tok != nullptr) {
     char *f_name;
     BFT_MALLOC(f_name,
@@ -390,35 +552,36 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     bft_printf(_("\n\n  Open file:\n"
           "    %s\n\n"),
         f_name);
-    FILE *file = fopen(f_name, "rt");
-    if (file == nullptr)
-      bft_error(__FILE__,__LINE__, 0,
-          _("Porosity from scan: Could not open file."));
+
+    /* Points are only read by the first rank, then distributed to the
+       ranks containing them by the locator */
+
+    FILE *file = nullptr;
+    if (cs_glob_rank_id < 1) {
+      file = fopen(f_name, "rt");
+      if (file == nullptr)
+        bft_error(__FILE__,__LINE__, 0,
+            _("Porosity from scan: Could not open file."));
+    }
 
     /* next file to be read */
     tok = strtok(nullptr, sep);
     long int n_read_points = 0;
     long int n_points = 0;
-    if (fscanf(file, "%ld\n", &n_read_points) != 1)
-      bft_error(__FILE__,__LINE__, 0,
-                _("Porosity from scan: Could not read the number of lines."));
+    if (cs_glob_rank_id < 1) {
+      if (fscanf(file, "%ld\n", &n_read_points) != 1)
+        bft_error(__FILE__,__LINE__, 0,
+                  _("Porosity from scan: Could not read the number of lines."));
+    }
+    if (cs_glob_n_ranks > 1) {
+      cs_gnum_t _n_read_points = n_read_points;
+      cs_parall_bcast(0, 1, CS_GNUM_TYPE, &_n_read_points);
+      n_read_points = _n_read_points;
+    }
 
     bft_printf(_("  Porosity from scan: %ld points to be read.\n\n"),
                n_read_points);
 
-    /* Pointer to field */
-    cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
-
-    /* Location mesh where points will be localized */
-    fvm_nodal_t *location_mesh =
-      cs_mesh_connect_cells_to_nodal(m,
-                                     "pts_location_mesh",
-                                     false, // no family info
-                                     m->n_cells,
-                                     nullptr);
-
-    fvm_nodal_make_vertices_private(location_mesh);
-
     /* Read multiple scan files
      * ------------------------ */
 
@@ -428,80 +591,137 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
                    "                               %ld points to be read.\n\n"),
                  n_scan, n_points);
 
-
-      cs_real_3_t *point_coords;
-      float *colors;
-      BFT_MALLOC(point_coords, n_points, cs_real_3_t);
-      BFT_MALLOC(colors, 3*n_points, float);
+      /* Points are read and located by chunks of bounded size, unless
+         they are postprocessed (which requires the whole scan) */
+
+      long int n_chunk_max = n_points;
+      if (   !_porosity_from_scan_opt.postprocess_points
+          && _porosity_from_scan_opt.n_points_per_chunk > 0)
+        n_chunk_max
+          = CS_MIN(n_points,
+                   (long int)_porosity_from_scan_opt.n_points_per_chunk);
+
+      cs_real_3_t *point_coords = nullptr;
+      float *colors = nullptr;
+      if (cs_glob_rank_id < 1) {
+        BFT_MALLOC(point_coords, n_chunk_max, cs_real_3_t);
+        BFT_MALLOC(colors, 3*n_chunk_max, float);
+      }
 
       cs_real_3_t min_vec = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
       cs_real_3_t max_vec = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
 
-      /* Read points */
-      for (int i = 0; i < n_points; i++ ) {
-        int num, green, red, blue;
-        cs_real_4_t xyz;
-        for (int j = 0; j < 3; j++)
-          point_coords[i][j] = 0.;
-
-        if (fscanf(file, "%lf", &(xyz[0])) != 1)
-          bft_error
-            (__FILE__,__LINE__, 0,
-             _("Porosity from scan: Error while reading dataset. Line %d\n"), i);
-        if (fscanf(file, "%lf", &(xyz[1])) != 1)
-          bft_error
-            (__FILE__,__LINE__, 0,
-             _("Porosity from scan: Error while reading dataset."));
-        if (fscanf(file, "%lf", &(xyz[2])) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset."));
-
-        /* Translation and rotation */
-        xyz[3] = 1.;
-        for (int j = 0; j < 3; j++) {
-          for (int k = 0; k < 4; k++)
-            point_coords[i][j]
-              += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
-
-          /* Compute bounding box*/
-          min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
-          max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
+      for (long int n_done = 0; n_done < n_points; n_done += n_chunk_max) {
+
+        cs_lnum_t n_chunk = CS_MIN(n_chunk_max, n_points - n_done);
+
+        /* Read points */
+        if (cs_glob_rank_id < 1)
+          _read_scan_points(file, n_chunk, point_coords, colors,
+                            min_vec, max_vec);
+
+        /* FVM meshes for writers (whole scan in a single chunk) */
+        if (_porosity_from_scan_opt.postprocess_points) {
+          char *fvm_name;
+          if (_porosity_from_scan_opt.output_name == nullptr) {
+            BFT_MALLOC(fvm_name,
+                       strlen(f_name) + 3 + 1,
+                       char);
+            strcpy(fvm_name, f_name);
+          }
+          else {
+            BFT_MALLOC(fvm_name,
+                       strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
+                       char);
+            strcpy(fvm_name, _porosity_from_scan_opt.output_name);
+          }
+          char suffix[13];
+          sprintf(suffix, "_%02d", n_scan);
+          strcat(fvm_name, suffix);
+
+          /* Build FVM mesh from scanned points */
+          fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
+
+          /* Only the first rank writes points for now */
+          cs_gnum_t *vtx_gnum = nullptr;
+
+          if (cs_glob_rank_id < 1) {
+            /* Update the points set structure */
+            fvm_nodal_define_vertex_list(pts_mesh, n_chunk, nullptr);
+            fvm_nodal_set_shared_vertices(pts_mesh,
+                                          (cs_coord_t *)point_coords);
+
+            BFT_MALLOC(vtx_gnum, n_chunk, cs_gnum_t);
+            for (cs_lnum_t i = 0; i < n_chunk; i++)
+              vtx_gnum[i] = i + 1;
+
+          }
+          fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
+
+          /* Free if allocated */
+          BFT_FREE(vtx_gnum);
+
+          /* Create default writer */
+          fvm_writer_t *writer
+            = fvm_writer_init(fvm_name,
+                              "postprocessing",
+                              cs_post_get_default_format(),
+                              cs_post_get_default_format_options(),
+                              FVM_WRITER_FIXED_MESH);
+
+          fvm_writer_export_nodal(writer, pts_mesh);
+
+          const void *var_ptr[1] = {nullptr};
+
+          var_ptr[0] = colors;
+
+          fvm_writer_export_field(writer,
+                                  pts_mesh,
+                                  "color",
+                                  FVM_WRITER_PER_NODE,
+                                  3,
+                                  CS_INTERLACE,
+                                  0,
+                                  0,
+                                  CS_FLOAT,
+                                  -1,
+                                  0.0,
+                                  (const void * *)var_ptr);
+
+          /* Free and destroy */
+          fvm_writer_finalize(writer);
+          pts_mesh = fvm_nodal_destroy(pts_mesh);
+          BFT_FREE(fvm_name);
         }
 
-        /* Intensities */
-        if (fscanf(file, "%d", &num) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset."));
-
-        /* Red */
-        if (fscanf(file, "%d", &red) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset (red). "
-                      "npoints read %d\n"), i);
-        /* Green */
-        if (fscanf(file, "%d", &green) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset (green). "
-                      "npoints read %d\n"), i);
-        /* Blue */
-        if (fscanf(file, "%d\n", &blue) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset (blue). "
-                      "npoints read %d\n"), i);
-
-        /* When colors are written as int, Paraview interprets them in [0, 255]
-         * when they are written as float, Paraview interprets them in [0., 1.]
-         * */
-        colors[3*i + 0] = red/255.;
-        colors[3*i + 1] = green/255.;
-        colors[3*i + 2] = blue/255.;
-      }
+        /* Locate points on the location mesh and accumulate
+           their contributions */
+
+        _locate_scan_points(mq,
+                            location_mesh,
+                            n_chunk,
+                            point_coords,
+                            colors,
+                            f_nb_scan->val,
+                            cen_points,
+                            cell_color,
+                            mom_mat,
+                            mom_comp);
+
+      } /* End loop on chunks */
 
       /* Check EOF was correctly reached */
-      if (fgets(line, sizeof(line), file) != nullptr)
-        n_read_points = strtol(line, nullptr, 10);
-      else
-        n_read_points = 0;
+      if (cs_glob_rank_id < 1) {
+        if (fgets(line, sizeof(line), file) != nullptr)
+          n_read_points = strtol(line, nullptr, 10);
+        else
+          n_read_points = 0;
+      }
+      if (cs_glob_n_ranks > 1) {
+        cs_gnum_t _n_read_points = n_read_points;
+        cs_parall_bcast(0, 1, CS_GNUM_TYPE, &_n_read_points);
+        n_read_points = _n_read_points;
+      }
 
       /* Bounding box*/
       bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
@@ -519,206 +739,31 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
           (_("  Porosity from scan: %ld additional points to be read.\n\n"),
            n_read_points);
 
-      /* FVM meshes for writers */
-      if (_porosity_from_scan_opt.postprocess_points) {
-        char *fvm_name;
-        if (_porosity_from_scan_opt.output_name == nullptr) {
-          BFT_MALLOC(fvm_name,
-                     strlen(f_name) + 3 + 1,
-                     char);
-          strcpy(fvm_name, f_name);
-        }
-        else {
-          BFT_MALLOC(fvm_name,
-                     strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
-                     char);
-          strcpy(fvm_name, _porosity_from_scan_opt.output_name);
-        }
-        char suffix[13];
-        sprintf(suffix, "_%02d", n_scan);
-        strcat(fvm_name, suffix);
-
-        /* Build FVM mesh from scanned points */
-        fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
-
-        /* Only the first rank writes points for now */
-        cs_gnum_t *vtx_gnum = nullptr;
-
-        if (cs_glob_rank_id < 1) {
-          /* Update the points set structure */
-          fvm_nodal_define_vertex_list(pts_mesh, n_points, nullptr);
-          fvm_nodal_set_shared_vertices(pts_mesh, (cs_coord_t *)point_coords);
-
-          BFT_MALLOC(vtx_gnum, n_points, cs_gnum_t);
-          for (cs_lnum_t i = 0; i < n_points; i++)
-            vtx_gnum[i] = i + 1;
-
-        }
-        fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
-
-        /* Free if allocated */
-        BFT_FREE(vtx_gnum);
-
-        /* Create default writer */
-        fvm_writer_t *writer
-          = fvm_writer_init(fvm_name,
-                            "postprocessing",
-                            cs_post_get_default_format(),
-                            cs_post_get_default_format_options(),
-                            FVM_WRITER_FIXED_MESH);
-
-        fvm_writer_export_nodal(writer, pts_mesh);
-
-        const void *var_ptr[1] = {nullptr};
-
-        var_ptr[0] = colors;
-
-        fvm_writer_export_field(writer,
-                                pts_mesh,
-                                "color",
-                                FVM_WRITER_PER_NODE,
-                                3,
-                                CS_INTERLACE,
-                                0,
-                                0,
-                                CS_FLOAT,
-                                -1,
-                                0.0,
-                                (const void * *)var_ptr);
-
-        /* Free and destroy */
-        fvm_writer_finalize(writer);
-        pts_mesh = fvm_nodal_destroy(pts_mesh);
-        BFT_FREE(fvm_name);
-        BFT_FREE(f_name);
-      }
-
-      /* Now build locator
-       * Locate points on this location mesh */
-      /*-------------------------------------*/
-
-      int options[PLE_LOCATOR_N_OPTIONS];
-      for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
-        options[i] = 0;
-      options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
-
-#if defined(PLE_HAVE_MPI)
-      _locator = ple_locator_create(cs_glob_mpi_comm,
-                                    cs_glob_n_ranks,
-                                    0);
-#else
-      _locator = ple_locator_create();
-#endif
-
-      cs_lnum_t _n_points = (cs_glob_rank_id < 1) ? n_points : 0;
-      cs_real_t *_point_coords = (cs_glob_rank_id < 1) ? (cs_real_t *)point_coords : nullptr;
-
-      ple_locator_set_mesh(_locator,
-                           location_mesh,
-                           options,
-                           0., /* tolerance_base */
-                           0.1, /* tolerance */
-                           3, /* dim */
-                           _n_points,
-                           nullptr,
-                           nullptr, /* point_tag */
-                           _point_coords,
-                           nullptr, /* distance */
-                           cs_coupling_mesh_extents,
-                           cs_coupling_point_in_mesh_p);
-
-      /* Shift from 1-base to 0-based locations */
-      ple_locator_shift_locations(_locator, -1);
-
-      /* dump locator */
-#if 0
-      ple_locator_dump(_locator);
-#endif
-
-      /* Number of distant points located on local mesh. */
-      cs_lnum_t n_points_dist = ple_locator_get_n_dist_points(_locator);
-
-#if 0
-      bft_printf("ple_locator_get_n_dist_points = %d, n_points = %ld\n",
-                 n_points_dist, n_points);
-#endif
-
-      const cs_lnum_t *dist_loc = ple_locator_get_dist_locations(_locator);
-      const ple_coord_t *dist_coords = ple_locator_get_dist_coords(_locator);
-
-      float *dist_colors = nullptr;
-      BFT_MALLOC(dist_colors, 3*n_points_dist, float);
-
-      ple_locator_exchange_point_var(_locator,
-                                     dist_colors,
-                                     colors,
-                                     nullptr,
-                                     sizeof(float),
-                                     3,
-                                     1);
-
-      for (cs_lnum_t i = 0; i < n_points_dist; i++) {
-        cs_lnum_t c_id = dist_loc[i];
-        f_nb_scan->val[c_id] += 1.;
-        for (cs_lnum_t idim = 0; idim < 3; idim++) {
-          cen_points[c_id*3+idim]
-            += (dist_coords[i*3 + idim] - mq->cell_cen[c_id*3+idim]);
-
-          cell_color[c_id*3+idim] += dist_colors[i*3 + idim];
-        }
-      }
-
-      _incremental_solid_plane_from_points(m,
-                                           n_points_dist,
-                                           dist_loc,
-                                           (const cs_real_t   *)f_nb_scan->val,
-                                           (const cs_real_3_t *)mq->cell_cen,
-                                           (const cs_real_3_t *)dist_coords,
-                                           mom_mat);
-
-      BFT_FREE(dist_colors);
-
-      /* Solid face roughness from point cloud is computed as the RMS of points
-       *  distance to the reconstructed plane */
-      cs_real_t vec_w_point[3]  = {0., 0., 0.};
-      cs_real_t w_point_dist =  0.;
-
-      for (cs_lnum_t i = 0; i < n_points_dist; i++) {
-        cs_lnum_t c_id = dist_loc[i];
-
-        if (f_nb_scan->val[c_id] > 1.)  { // at least 2 points to compute distance
-
-          for (cs_lnum_t idim = 0; idim < 3; idim++)
-            vec_w_point[idim] = dist_coords[i*3 + idim]
-                              - cen_points[c_id*3+idim];
-          //TODO compute roughness incrementally
-          //w_point_dist = cs_math_3_dot_product(vec_w_point, c_w_face_normal[c_id]);
-
-          c_w_face_rough[c_id] += 2 * sqrt(w_point_dist * w_point_dist)
-                                / f_nb_scan->val[c_id];
-        }
-      }
-      //TODO compute the minimum distance between point to suggest a minimum resolution
+      //TODO compute the solid face roughness from the point cloud as the RMS
+      //     of points distance to the reconstructed plane
+      //TODO compute the minimum distance between point to suggest a minimum
+      //     resolution
 
       /* Free memory */
-      _locator = ple_locator_destroy(_locator);
       BFT_FREE(point_coords);
       BFT_FREE(colors);
 
     } /* End loop on multiple scans */
 
-    if (fclose(file) != 0)
-      bft_error(__FILE__,__LINE__, 0,
-                _("Porosity from scan: Could not close the file."));
+    if (cs_glob_rank_id < 1) {
+      if (fclose(file) != 0)
+        bft_error(__FILE__,__LINE__, 0,
+                  _("Porosity from scan: Could not close the file."));
+    }
 
-    /* Nodal mesh is not needed anymore */
-    location_mesh = fvm_nodal_destroy(location_mesh);
+    BFT_FREE(f_name);
 
   } /* End of multiple files */
 
-  /* Finalization */
+  /* Nodal mesh is not needed anymore */
+  location_mesh = fvm_nodal_destroy(location_mesh);
 
-  const cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
+  /* Finalization */
 
   // Normal vector to the solid plane
   cs_real_3_t *restrict c_w_face_normal
@@ -744,6 +789,7 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
 
   /* Free memory */
   BFT_FREE(mom_mat);
+  BFT_FREE(mom_comp);
   BFT_FREE(file_names);
 
   /* Parallel synchronisation */
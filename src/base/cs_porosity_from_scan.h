@@ -96,6 +96,9 @@ typedef struct {
   cs_real_t eigenvalue_criteria;
   int       use_restart;
   cs_ibm_cog_location_t cog_location;
+  /*! Maximum number of points read and located at once
+     (ignored when points are postprocessed) */
+  cs_gnum_t n_points_per_chunk;
 
 } cs_porosity_from_scan_opt_t;
 
@@ -57,6 +57,7 @@
 #include "cs_lagr_extract.h"
 #include "cs_log.h"
 #include "cs_lagr_query.h"
+#include "cs_lagr_trajectory.h"
 #include "cs_meg_prototypes.h"
 #include "cs_mesh.h"
 #include "cs_mesh_connect.h"
@@ -64,6 +65,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_prototypes.h"
+#include "cs_restart.h"
 #include "cs_selector.h"
 #include "cs_time_control.h"
 #include "cs_timer.h"
@@ -257,6 +259,14 @@ typedef struct {
 
   fvm_writer_t  *writer;        /* Associated FVM writer */
 
+  int            stagger_nt;    /* Maximum output delay (in time steps)
+                                   allowed to spread output, or 0 */
+  int            nt_due;        /* Time step at which a delayed output
+                                   was due, or -1 */
+  int            stagger_active;   /* Active status chosen by scheduler */
+  cs_gnum_t      output_size_prev; /* Writer output size at previous check */
+  double         io_size;       /* Predicted output size (from last output) */
+
 } cs_post_writer_t;
 
 /* Post-processing mesh structure */
@@ -307,6 +317,14 @@ typedef struct {
   bool                    centers_only;  /* Build only associated centers,
                                             not full elements. */
 
+  int                     n_agg_passes;  /* Number of pairwise cell
+                                            agglomeration passes for
+                                            decimated meshes, or 0 */
+  cs_lnum_t               n_agg;         /* Number of local agglomerates */
+  cs_lnum_t              *c_agg_id;      /* Agglomerate id of each parent
+                                            cell (-1 if not selected) for
+                                            decimated meshes, or NULL */
+
   int                     n_writers;     /* Number of associated writers */
   int                    *writer_id;     /* Array of associated writer ids */
   int                    *nt_last;       /* Time step number for the last
@@ -336,6 +354,16 @@ typedef struct {
 
 } cs_post_mesh_t;
 
+/* Agglomeration candidate pair (for decimated meshes) */
+/*-----------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t   a_id[2];    /* Agglomerate ids (a_id[0] < a_id[1]) */
+  double      surf;       /* Shared faces surface */
+
+} cs_post_agg_pair_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -396,6 +424,10 @@ static char *_field_sync = NULL;
 
 static int  _post_out_stat_id = -1;
 
+/* Time step at which delayed writer output was last scheduled */
+
+static int  _stagger_nt_cur = -2;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -611,6 +643,23 @@ _init_writer(cs_post_writer_t  *writer)
 
 }
 
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending asynchronous output of all writers.
+ *
+ * This must be called before modifying or freeing exported meshes, as
+ * writers using asynchronous output may still reference them.
+ *----------------------------------------------------------------------------*/
+
+static void
+_wait_writers(void)
+{
+  for (int i = 0; i < _cs_post_n_writers; i++) {
+    cs_post_writer_t  *writer = _cs_post_writers + i;
+    if (writer->writer != NULL)
+      fvm_writer_wait(writer->writer);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Free a writer's forced output time values.
  *
@@ -873,6 +922,145 @@ _cs_post_writer_id(const int  writer_id)
   return id;
 }
 
+/*----------------------------------------------------------------------------
+ * Spread output of writers allowing delayed output over neighboring
+ * time steps.
+ *
+ * Output of writers allowing a delay (see cs_post_writer_set_stagger)
+ * is deferred when other output is already scheduled at the current
+ * time step, or if a checkpoint is due, unless the writer's delay window
+ * is exhausted. Outputs are packed by increasing deadline, using the
+ * predicted output size of each writer (based on its previous output),
+ * so that the size written at a given time step does not exceed that of
+ * the largest scheduled output unless a deadline requires it.
+ *
+ * This function may be called several times for a given time step,
+ * in which case the choices made at the first call are kept.
+ *
+ * parameters:
+ *   ts <-- time step status structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_stagger_writers(const cs_time_step_t  *ts)
+{
+  int n_staggered = 0;
+
+  for (int i = 0; i < _cs_post_n_writers; i++) {
+    if ((_cs_post_writers + i)->stagger_nt > 0)
+      n_staggered++;
+  }
+
+  if (n_staggered == 0 || ts->nt_cur < 0)
+    return;
+
+  /* Keep choices for repeated calls at the same time step */
+
+  if (ts->nt_cur == _stagger_nt_cur) {
+    for (int i = 0; i < _cs_post_n_writers; i++) {
+      cs_post_writer_t  *w = _cs_post_writers + i;
+      if (w->stagger_nt > 0 && w->active > -1)
+        w->active = w->stagger_active;
+    }
+    return;
+  }
+
+  _stagger_nt_cur = ts->nt_cur;
+
+  /* Update predicted output sizes, and determine output size
+     which is not deferrable at this time step */
+
+  double load = 0, max_size = 0;
+
+  int n_candidates = 0;
+  int *candidate_id;
+  BFT_MALLOC(candidate_id, n_staggered, int);
+
+  for (int i = 0; i < _cs_post_n_writers; i++) {
+
+    cs_post_writer_t  *w = _cs_post_writers + i;
+
+    if (w->writer != NULL) {
+      cs_gnum_t output_size = fvm_writer_get_output_size(w->writer);
+      if (output_size > w->output_size_prev) {
+        w->io_size = output_size - w->output_size_prev;
+        w->output_size_prev = output_size;
+      }
+    }
+
+    if (w->active < 0)
+      continue;
+
+    if (w->stagger_nt > 0) {
+      if (w->active == 1 && w->nt_due < 0)
+        w->nt_due = ts->nt_cur;
+      if (w->nt_due > -1) {
+        max_size = CS_MAX(max_size, w->io_size);
+        candidate_id[n_candidates++] = i;
+      }
+    }
+    else if (w->active == 1) {
+      load += w->io_size;
+      max_size = CS_MAX(max_size, w->io_size);
+    }
+
+  }
+
+  /* Order candidates by increasing deadline (short list) */
+
+  for (int i = 1; i < n_candidates; i++) {
+    int c_id = candidate_id[i];
+    const cs_post_writer_t  *w = _cs_post_writers + c_id;
+    int deadline = w->nt_due + w->stagger_nt;
+    int j = i - 1;
+    while (j >= 0) {
+      const cs_post_writer_t  *wj = _cs_post_writers + candidate_id[j];
+      if (wj->nt_due + wj->stagger_nt <= deadline)
+        break;
+      candidate_id[j+1] = candidate_id[j];
+      j--;
+    }
+    candidate_id[j+1] = c_id;
+  }
+
+  /* Output scheduled as soon as possible, but deferred if it would
+     increase the load beyond the largest single output */
+
+  bool checkpoint = (n_candidates > 0) ?
+    cs_restart_checkpoint_required(ts) : false;
+
+  bool at_bounds = (ts->nt_cur >= ts->nt_max || ts->nt_cur == ts->nt_prev);
+
+  for (int i = 0; i < n_candidates; i++) {
+
+    cs_post_writer_t  *w = _cs_post_writers + candidate_id[i];
+
+    bool required = (   at_bounds
+                     || ts->nt_cur >= w->nt_due + w->stagger_nt
+                     || w->io_size <= 0);
+
+    bool fits = (   checkpoint == false
+                 && (load <= 0 || load + w->io_size <= max_size));
+
+    if (required || fits) {
+      w->active = 1;
+      w->nt_due = -1;
+      load += w->io_size;
+    }
+    else
+      w->active = 0;
+
+  }
+
+  BFT_FREE(candidate_id);
+
+  for (int i = 0; i < _cs_post_n_writers; i++) {
+    cs_post_writer_t  *w = _cs_post_writers + i;
+    if (w->stagger_nt > 0)
+      w->stagger_active = w->active;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Search for position in the array of writers of a writer with a given id,
  * allowing the writer not to be present.
@@ -1132,8 +1320,10 @@ _predefine_mesh(int        mesh_id,
       BFT_FREE(post_mesh->nt_last);
 
       post_mesh->exp_mesh = NULL;
-      if (post_mesh->_exp_mesh != NULL)
+      if (post_mesh->_exp_mesh != NULL) {
+        _wait_writers();
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+      }
 
       break;
 
@@ -1181,6 +1371,10 @@ _predefine_mesh(int        mesh_id,
   post_mesh->time_varying = time_varying;
   post_mesh->centers_only = false;
 
+  post_mesh->n_agg_passes = 0;
+  post_mesh->n_agg = 0;
+  post_mesh->c_agg_id = NULL;
+
   for (j = 0; j < 5; j++) {
     post_mesh->criteria[j] = NULL;
     post_mesh->sel_func[j] = NULL;
@@ -1246,8 +1440,10 @@ _free_mesh(int _mesh_id)
   int i;
   cs_post_mesh_t  *post_mesh = _cs_post_meshes + _mesh_id;
 
-  if (post_mesh->_exp_mesh != NULL)
+  if (post_mesh->_exp_mesh != NULL) {
+    _wait_writers();
     post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+  }
 
   BFT_FREE(post_mesh->writer_id);
   BFT_FREE(post_mesh->nt_last);
@@ -1258,6 +1454,7 @@ _free_mesh(int _mesh_id)
 
   BFT_FREE(post_mesh->name);
   BFT_FREE(post_mesh->a_field_info);
+  BFT_FREE(post_mesh->c_agg_id);
 
   /* Shift remaining meshes */
 
@@ -1304,6 +1501,205 @@ _check_mesh_cat_id(cs_post_mesh_t  *post_mesh)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compare agglomeration candidate pairs (by agglomerate ids).
+ *
+ * parameters:
+ *   x <-- pointer to first pair
+ *   y <-- pointer to second pair
+ *
+ * returns:
+ *   -1 if x < y, 1 if x > y, 0 if equal
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_agg_pair_ids(const void  *x,
+                      const void  *y)
+{
+  const cs_post_agg_pair_t *p0 = x, *p1 = y;
+
+  for (int i = 0; i < 2; i++) {
+    if (p0->a_id[i] < p1->a_id[i])
+      return -1;
+    else if (p0->a_id[i] > p1->a_id[i])
+      return 1;
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare agglomeration candidate pairs (by decreasing shared surface).
+ *
+ * parameters:
+ *   x <-- pointer to first pair
+ *   y <-- pointer to second pair
+ *
+ * returns:
+ *   -1 if x has a larger surface than y, 1 if smaller, 0 if equal
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_agg_pair_surf(const void  *x,
+                       const void  *y)
+{
+  const cs_post_agg_pair_t *p0 = x, *p1 = y;
+
+  if (p0->surf > p1->surf)
+    return -1;
+  else if (p0->surf < p1->surf)
+    return 1;
+
+  return _compare_agg_pair_ids(x, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Agglomerate selected cells of a decimated post-processing mesh and
+ * build the matching exportable mesh.
+ *
+ * Each pass merges pairs of neighboring agglomerates, preferring pairs
+ * sharing the largest face surface, so as to obtain compact agglomerates.
+ * Agglomerates do not cross rank boundaries.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to post-processing mesh
+ *   n_cells   <-- number of selected cells
+ *   cell_list <-- list of selected cells, or NULL if all cells selected
+ *
+ * returns:
+ *   pointer to exportable mesh
+ *----------------------------------------------------------------------------*/
+
+static fvm_nodal_t *
+_define_decimated_export_mesh(cs_post_mesh_t   *post_mesh,
+                              cs_lnum_t         n_cells,
+                              const cs_lnum_t   cell_list[])
+{
+  const cs_mesh_t *mesh = cs_glob_mesh;
+  const cs_lnum_t n_m_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_real_t *i_face_surf = cs_glob_mesh_quantities->i_face_surf;
+
+  /* Initial agglomerates are the selected cells */
+
+  BFT_REALLOC(post_mesh->c_agg_id, n_m_cells, cs_lnum_t);
+  cs_lnum_t *c_agg_id = post_mesh->c_agg_id;
+
+  cs_lnum_t n_agg = 0;
+
+  if (cell_list == NULL || n_cells >= n_m_cells) {
+    for (cs_lnum_t i = 0; i < n_m_cells; i++)
+      c_agg_id[i] = i;
+    n_agg = n_m_cells;
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_m_cells; i++)
+      c_agg_id[i] = -1;
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      c_agg_id[cell_list[i]] = n_agg++;
+  }
+
+  /* Pairwise agglomeration passes */
+
+  cs_lnum_t *a_new;
+  cs_post_agg_pair_t *pairs;
+  BFT_MALLOC(a_new, n_agg, cs_lnum_t);
+  BFT_MALLOC(pairs, n_i_faces, cs_post_agg_pair_t);
+
+  for (int pass = 0; pass < post_mesh->n_agg_passes; pass++) {
+
+    /* Candidate pairs, merged by agglomerate ids */
+
+    cs_lnum_t n_pairs = 0;
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      cs_lnum_t c_id0 = mesh->i_face_cells[f_id][0];
+      cs_lnum_t c_id1 = mesh->i_face_cells[f_id][1];
+      if (c_id0 >= n_m_cells || c_id1 >= n_m_cells)
+        continue;
+      cs_lnum_t a_id0 = c_agg_id[c_id0], a_id1 = c_agg_id[c_id1];
+      if (a_id0 < 0 || a_id1 < 0 || a_id0 == a_id1)
+        continue;
+      pairs[n_pairs].a_id[0] = CS_MIN(a_id0, a_id1);
+      pairs[n_pairs].a_id[1] = CS_MAX(a_id0, a_id1);
+      pairs[n_pairs].surf = i_face_surf[f_id];
+      n_pairs++;
+    }
+
+    qsort(pairs, n_pairs, sizeof(cs_post_agg_pair_t), _compare_agg_pair_ids);
+
+    cs_lnum_t n_u_pairs = 0;
+    for (cs_lnum_t i = 0; i < n_pairs; i++) {
+      if (   n_u_pairs > 0
+          && _compare_agg_pair_ids(pairs + n_u_pairs - 1, pairs + i) == 0)
+        pairs[n_u_pairs - 1].surf += pairs[i].surf;
+      else
+        pairs[n_u_pairs++] = pairs[i];
+    }
+
+    qsort(pairs, n_u_pairs, sizeof(cs_post_agg_pair_t),
+          _compare_agg_pair_surf);
+
+    /* Greedy matching */
+
+    cs_lnum_t n_agg_new = 0;
+
+    for (cs_lnum_t i = 0; i < n_agg; i++)
+      a_new[i] = -1;
+
+    for (cs_lnum_t i = 0; i < n_u_pairs; i++) {
+      cs_lnum_t a_id0 = pairs[i].a_id[0], a_id1 = pairs[i].a_id[1];
+      if (a_new[a_id0] < 0 && a_new[a_id1] < 0) {
+        a_new[a_id0] = n_agg_new;
+        a_new[a_id1] = n_agg_new;
+        n_agg_new++;
+      }
+    }
+
+    for (cs_lnum_t i = 0; i < n_agg; i++) {
+      if (a_new[i] < 0)
+        a_new[i] = n_agg_new++;
+    }
+
+    for (cs_lnum_t i = 0; i < n_m_cells; i++) {
+      if (c_agg_id[i] > -1)
+        c_agg_id[i] = a_new[c_agg_id[i]];
+    }
+
+    n_agg = n_agg_new;
+
+  }
+
+  BFT_FREE(pairs);
+  BFT_FREE(a_new);
+
+  post_mesh->n_agg = n_agg;
+
+  /* Global agglomerate numbering and exportable mesh */
+
+  fvm_io_num_t *io_num = fvm_io_num_create_from_scan(n_agg);
+
+  cs_gnum_t *agg_gnum;
+  BFT_MALLOC(agg_gnum, n_agg, cs_gnum_t);
+  if (n_agg > 0)
+    memcpy(agg_gnum,
+           fvm_io_num_get_global_num(io_num),
+           n_agg*sizeof(cs_gnum_t));
+
+  io_num = fvm_io_num_destroy(io_num);
+
+  fvm_nodal_t *exp_mesh
+    = cs_mesh_connect_agglomerated_cells_to_nodal(mesh,
+                                                  post_mesh->name,
+                                                  n_agg,
+                                                  c_agg_id,
+                                                  agg_gnum);
+
+  BFT_FREE(agg_gnum);
+
+  return exp_mesh;
+}
+
 /*----------------------------------------------------------------------------
  * Create a post-processing mesh; lists of cells or faces to extract are
  * sorted upon exit, whether they were sorted upon calling or not.
@@ -1345,7 +1741,10 @@ _define_export_mesh(cs_post_mesh_t  *post_mesh,
 
   if (post_mesh->centers_only == false) {
 
-    if (post_mesh->ent_flag[0] == 1) {
+    if (post_mesh->ent_flag[0] == 1 && post_mesh->n_agg_passes > 0)
+      exp_mesh = _define_decimated_export_mesh(post_mesh, n_cells, cell_list);
+
+    else if (post_mesh->ent_flag[0] == 1) {
 
       if (n_cells >= cs_glob_mesh->n_cells)
         exp_mesh = cs_mesh_connect_cells_to_nodal(cs_glob_mesh,
@@ -1543,6 +1942,23 @@ _define_particle_export_mesh(cs_post_mesh_t        *post_mesh,
 
       assert(ts->nt_cur > 0);
 
+      /* With buffering, segments are only output once per chunk,
+         so the segments of all buffered time steps replace those
+         of the current time step */
+
+      if (cs_lagr_trajectory_buffer_is_active()) {
+        bool is_last = (ts->nt_max > 0 && ts->nt_cur >= ts->nt_max);
+        if (cs_lagr_trajectory_buffer_append(p_set,
+                                             n_particles,
+                                             particle_list,
+                                             is_last) == false) {
+          post_mesh->exp_mesh = NULL;
+          post_mesh->_exp_mesh = NULL;
+          return;
+        }
+        n_particles = cs_lagr_trajectory_buffer_get_coords(&coords);
+      }
+
       BFT_MALLOC(mesh_name, strlen(post_mesh->name) + 32, char);
       sprintf(mesh_name, "%s_%05d", post_mesh->name, ts->nt_cur);
 
@@ -1555,16 +1971,20 @@ _define_particle_export_mesh(cs_post_mesh_t        *post_mesh,
       for (i = 0; i < n_particles*2; i++)
         vertex_num[i] = i+1;
 
-      BFT_MALLOC(coords, n_particles*2, cs_coord_3_t);
+      if (coords == NULL) {
+
+        BFT_MALLOC(coords, n_particles*2, cs_coord_3_t);
 
-      cs_lagr_get_trajectory_values(p_set,
-                                    CS_LAGR_COORDS,
-                                    CS_REAL_TYPE,
-                                    3,
-                                    -1,
-                                    n_particles,
-                                    particle_list,
-                                    coords);
+        cs_lagr_get_trajectory_values(p_set,
+                                      CS_LAGR_COORDS,
+                                      CS_REAL_TYPE,
+                                      3,
+                                      -1,
+                                      n_particles,
+                                      particle_list,
+                                      coords);
+
+      }
 
       fvm_nodal_append_by_transfer(exp_mesh,
                                    n_particles,
@@ -1950,8 +2370,10 @@ _redefine_mesh(cs_post_mesh_t        *post_mesh,
   if (post_mesh->exp_mesh != NULL) {
     if (post_mesh->_exp_mesh == NULL)
       return;
-    else
+    else {
+      _wait_writers();
       post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+    }
   }
   post_mesh->exp_mesh = NULL;
 
@@ -2328,6 +2750,98 @@ _cs_post_write_mesh(cs_post_mesh_t        *post_mesh,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Average cell values on agglomerates of a decimated mesh.
+ *
+ * Values are weighted by cell volumes. The resulting variable is
+ * interlaced, and of type cs_real_t.
+ *
+ * parameters:
+ *   post_mesh <-- pointer to post-processing mesh
+ *   var_dim   <-- variable dimension
+ *   interlace <-- for vector, interlace if 1, no interlace if 0
+ *   datatype  <-- variable's data type
+ *   cel_vals  <-- values at parent cells
+ *   var_tmp[] --> averaged values (size: n_agg*var_dim)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_post_agg_var_cells(const cs_post_mesh_t  *post_mesh,
+                       int                    var_dim,
+                       cs_interlace_t         interlace,
+                       cs_datatype_t          datatype,
+                       const void            *cel_vals,
+                       cs_real_t              var_tmp[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_agg = post_mesh->n_agg;
+  const cs_lnum_t *c_agg_id = post_mesh->c_agg_id;
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
+  /* Strides for component j of cell i: i*s_e + j*s_c */
+
+  const cs_lnum_t s_e = (interlace == CS_INTERLACE) ? var_dim : 1;
+  const cs_lnum_t s_c = (interlace == CS_INTERLACE) ?
+    1 : cs_glob_mesh->n_cells_with_ghosts;
+
+  cs_real_t *agg_vol;
+  BFT_MALLOC(agg_vol, n_agg, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_agg; i++)
+    agg_vol[i] = 0.;
+  for (cs_lnum_t i = 0; i < n_agg*var_dim; i++)
+    var_tmp[i] = 0.;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+
+    const cs_lnum_t a_id = c_agg_id[i];
+    if (a_id < 0)
+      continue;
+
+    agg_vol[a_id] += cell_vol[i];
+
+    for (cs_lnum_t j = 0; j < var_dim; j++) {
+      const cs_lnum_t k = i*s_e + j*s_c;
+      double v = 0.;
+      switch (datatype) {
+      case CS_DOUBLE:
+        v = ((const double *)cel_vals)[k];
+        break;
+      case CS_FLOAT:
+        v = ((const float *)cel_vals)[k];
+        break;
+      case CS_INT32:
+        v = ((const int32_t *)cel_vals)[k];
+        break;
+      case CS_INT64:
+        v = ((const int64_t *)cel_vals)[k];
+        break;
+      case CS_UINT32:
+        v = ((const uint32_t *)cel_vals)[k];
+        break;
+      case CS_UINT64:
+        v = ((const uint64_t *)cel_vals)[k];
+        break;
+      default:
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s: unhandled datatype for mesh \"%s\"."),
+                  __func__, post_mesh->name);
+      }
+      var_tmp[a_id*var_dim + j] += v * cell_vol[i];
+    }
+
+  }
+
+  for (cs_lnum_t i = 0; i < n_agg; i++) {
+    if (agg_vol[i] > 0.) {
+      for (cs_lnum_t j = 0; j < var_dim; j++)
+        var_tmp[i*var_dim + j] /= agg_vol[i];
+    }
+  }
+
+  BFT_FREE(agg_vol);
+}
+
 /*----------------------------------------------------------------------------
  * Assemble variable values defined on a mix of interior and boundary
  * faces (with no indirection) into an array defined on a single faces set.
@@ -2469,8 +2983,10 @@ _update_meshes(const cs_time_step_t  *ts)
         /* Update associated mesh */
         fvm_nodal_t *exp_mesh
           = cs_probe_set_export_mesh(pset, cs_probe_set_get_name(pset));
-        if (post_mesh->_exp_mesh != NULL)
+        if (post_mesh->_exp_mesh != NULL) {
+          _wait_writers();
           post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+        }
         post_mesh->_exp_mesh = exp_mesh;
         post_mesh->exp_mesh = exp_mesh;
       }
@@ -3197,6 +3713,19 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
       if (name == NULL)
         name = f->name;
 
+      /* Values stored by component are output through an interleaved copy */
+
+      const cs_real_t *f_vals = f->val;
+      cs_real_t *ilv_vals = NULL;
+
+      if (f->interleaved == false) {
+        const cs_lnum_t n_alloc
+          = cs_mesh_location_get_n_elts(f->location_id)[2];
+        BFT_MALLOC(ilv_vals, n_alloc*f->dim, cs_real_t);
+        cs_field_interleave_values(f, true, f->val, ilv_vals);
+        f_vals = ilv_vals;
+      }
+
       if (pset != NULL) {
         char interpolate_input[96];
         strncpy(interpolate_input, f->name, 95); interpolate_input[95] = '\0';
@@ -3215,7 +3744,7 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
                                    f->location_id,
                                    interpolate_func,
                                    interpolate_input,
-                                   f->val,
+                                   f_vals,
                                    ts);
       }
 
@@ -3223,7 +3752,7 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
                || field_loc_type == CS_MESH_LOCATION_BOUNDARY_FACES
                || field_loc_type == CS_MESH_LOCATION_INTERIOR_FACES) {
 
-        const cs_real_t *f_val = f->val;
+        const cs_real_t *f_val = f_vals;
         const cs_real_t *cell_val = NULL, *b_face_val = NULL, *i_face_val = NULL;
         cs_real_t *tmp_val = NULL;
 
@@ -3282,7 +3811,7 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
 
             cs_array_real_copy_subset(n_elts, f_dim, elt_ids,
                                       CS_ARRAY_SUBSET_OUT, /* elt_ids on dest */
-                                      f->val,              /* ref */
+                                      f_vals,              /* ref */
                                       tmp_val);            /* dest <-- ref */
 
             f_val = tmp_val;
@@ -3321,9 +3850,11 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
                                  true,
                                  use_parent,
                                  CS_POST_TYPE_cs_real_t,
-                                 f->val,
+                                 f_vals,
                                  ts);
 
+      BFT_FREE(ilv_vals);
+
     } /* End of loop on fields */
 
   } /* End of main output for cell or boundary mesh or submesh */
@@ -3365,10 +3896,24 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
       if (name == NULL)
         name = f->name;
 
+      /* Values stored by component are output through an interleaved copy
+         (and gradient-based interpolation requires interleaved values) */
+
+      const cs_real_t *f_vals = f->val;
+      cs_real_t *ilv_vals = NULL;
+
+      if (f->interleaved == false) {
+        const cs_lnum_t n_alloc
+          = cs_mesh_location_get_n_elts(f->location_id)[2];
+        BFT_MALLOC(ilv_vals, n_alloc*f->dim, cs_real_t);
+        cs_field_interleave_values(f, true, f->val, ilv_vals);
+        f_vals = ilv_vals;
+      }
+
       cs_interpolate_from_location_t
         *interpolate_func = cs_interpolate_from_location_p0;
       if (   field_loc_type == CS_MESH_LOCATION_CELLS
-          && pset_interpolation == 1) {
+          && pset_interpolation == 1 && f->interleaved) {
         interpolate_func = cs_interpolate_from_location_p1;
         if (_field_sync != NULL) {
           if (_field_sync[f->id] == 0) {
@@ -3389,9 +3934,11 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
                                  f->location_id,
                                  interpolate_func,
                                  interpolate_input,
-                                 f->val,
+                                 f_vals,
                                  ts);
 
+      BFT_FREE(ilv_vals);
+
     } /* End of loop on fields */
 
   } /* End of main output for probes */
@@ -4249,6 +4796,12 @@ cs_post_define_writer(int                     writer_id,
   w->id = writer_id;
   w->active = 0;
 
+  w->stagger_nt = 0;
+  w->nt_due = -1;
+  w->stagger_active = 0;
+  w->output_size_prev = 0;
+  w->io_size = 0;
+
   if (interval_t >= 0)
     cs_time_control_init_by_time(&(w->tc),
                                  -1,
@@ -4428,6 +4981,65 @@ cs_post_define_volume_mesh_by_func(int                    mesh_id,
     post_mesh->post_domain = true;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a decimated volume post-processing mesh.
+ *
+ * Selected cells are agglomerated using \p n_passes passes of pairwise
+ * agglomeration of neighboring cells (preferring pairs sharing the largest
+ * face surface), so each pass divides the number of output cells by up
+ * to 2. Agglomerates do not cross rank boundaries.
+ *
+ * Cell-based variables output with parent values on this mesh are
+ * averaged on agglomerates (weighted by cell volumes), so frequent
+ * visualization output costs only a fraction of that of a full-resolution
+ * mesh. Since element ids of this mesh refer to agglomerates and not to
+ * parent cells, only fields (and vertex values) are output automatically;
+ * other automatic or user outputs are not called for this mesh.
+ *
+ * \param[in]  mesh_id         id of mesh to define
+ *                             (< 0 reserved, > 0 for user)
+ * \param[in]  mesh_name       associated mesh name
+ * \param[in]  cell_criteria   selection criteria for cells
+ * \param[in]  n_passes        number of agglomeration passes
+ * \param[in]  auto_variables  if true, automatic output of main variables
+ * \param[in]  n_writers       number of associated writers
+ * \param[in]  writer_ids      ids of associated writers
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_define_decimated_mesh(int          mesh_id,
+                              const char  *mesh_name,
+                              const char  *cell_criteria,
+                              int          n_passes,
+                              bool         auto_variables,
+                              int          n_writers,
+                              const int    writer_ids[])
+{
+  /* Call common initialization */
+
+  cs_post_mesh_t *post_mesh = NULL;
+
+  post_mesh = _predefine_mesh(mesh_id, false, 0, n_writers, writer_ids);
+
+  /* Define mesh based on current arguments */
+
+  BFT_MALLOC(post_mesh->name, strlen(mesh_name) + 1, char);
+  strcpy(post_mesh->name, mesh_name);
+
+  if (cell_criteria != NULL) {
+    BFT_MALLOC(post_mesh->criteria[0], strlen(cell_criteria) + 1, char);
+    strcpy(post_mesh->criteria[0], cell_criteria);
+  }
+  post_mesh->ent_flag[0] = 1;
+
+  post_mesh->n_agg_passes = CS_MAX(n_passes, 1);
+
+  if (auto_variables)
+    post_mesh->cat_id = CS_POST_MESH_VOLUME;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define a surface post-processing mesh.
@@ -5759,6 +6371,10 @@ cs_post_activate_by_time_step(const cs_time_step_t  *ts)
     }
 
   }
+
+  /* Spread output of writers allowing delays */
+
+  _stagger_writers(ts);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -5780,6 +6396,49 @@ cs_post_writer_is_active(int  writer_id)
   return writer->active;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow output of a given writer to be delayed by a few time steps,
+ *        so as to spread output over time steps.
+ *
+ * When output of several writers or a checkpoint is due at the same time
+ * step, output of writers allowing a delay is deferred to the following
+ * time steps, based on the predicted output size of each writer
+ * (estimated from its previous output), so as to reduce the peak output
+ * volume at a given time step.
+ *
+ * Output is never delayed by more than the given number of time steps,
+ * nor past the last time step. Delayed output is associated with the
+ * time step at which it is actually done.
+ *
+ * \param[in]  writer_id  writer id, or 0 for all writers
+ * \param[in]  n_steps    maximum output delay, in time steps (0 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_writer_set_stagger(int  writer_id,
+                           int  n_steps)
+{
+  int n_steps_c = CS_MAX(n_steps, 0);
+
+  if (writer_id != 0) {
+    int i = _cs_post_writer_id(writer_id);
+    cs_post_writer_t  *writer = _cs_post_writers + i;
+    writer->stagger_nt = n_steps_c;
+    if (n_steps_c == 0)
+      writer->nt_due = -1;
+  }
+  else {
+    for (int i = 0; i < _cs_post_n_writers; i++) {
+      cs_post_writer_t  *writer = _cs_post_writers + i;
+      writer->stagger_nt = n_steps_c;
+      if (n_steps_c == 0)
+        writer->nt_due = -1;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Force the "active" or "inactive" flag for a specific writer or for all
@@ -6168,7 +6827,30 @@ cs_post_write_var(int                    mesh_id,
   /* Case of cells */
   /*---------------*/
 
-  if (post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1) {
+  if (   post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1
+      && post_mesh->c_agg_id != NULL && use_parent) {
+
+    /* Decimated mesh: parent numbers refer to agglomerates, so
+       average values on agglomerates first */
+
+    n_parent_lists = 1;
+    parent_num_shift[0] = 0;
+
+    BFT_MALLOC(var_tmp, post_mesh->n_agg*var_dim, cs_real_t);
+
+    _cs_post_agg_var_cells(post_mesh,
+                           var_dim,
+                           _interlace,
+                           datatype,
+                           cel_vals,
+                           var_tmp);
+
+    _interlace = CS_INTERLACE;
+    datatype = CS_REAL_TYPE;
+    var_ptr[0] = var_tmp;
+  }
+
+  else if (post_mesh->ent_flag[CS_POST_LOCATION_CELL] == 1) {
 
     if (use_parent) {
       n_parent_lists = 1;
@@ -6354,7 +7036,8 @@ cs_post_write_var(int                    mesh_id,
 
   }
 
-  /* Free memory (if both interior and boundary faces present) */
+  /* Free memory (if both interior and boundary faces present,
+     or values averaged on a decimated mesh) */
 
   if (var_tmp != NULL)
     BFT_FREE(var_tmp);
@@ -6903,7 +7586,10 @@ cs_post_write_particle_values(int                    mesh_id,
 
   var_ptr[0] = vals;
 
-  if (n_pts != n_particles) {
+  const bool buffered_traj = (   post_mesh->ent_flag[3] == 2
+                              && cs_lagr_trajectory_buffer_is_active());
+
+  if (n_pts != n_particles && !buffered_traj) {
     int parent_dim = (post_mesh->ent_flag[3] == 2) ? 1 : 0;
     BFT_MALLOC(particle_list, n_particles, cs_lnum_t);
     fvm_nodal_get_parent_num(post_mesh->exp_mesh, parent_dim, particle_list);
@@ -6921,6 +7607,18 @@ cs_post_write_particle_values(int                    mesh_id,
                                 particle_list,
                                 vals);
 
+  else if (buffered_traj) {
+    nt_cur = -1; t_cur = 0.;
+    if (cs_lagr_trajectory_buffer_get_values(attr,
+                                             datatype,
+                                             stride,
+                                             component_id,
+                                             vals) == false) {
+      BFT_FREE(vals);
+      return;
+    }
+  }
+
   else if (post_mesh->ent_flag[3] == 2) {
     nt_cur = -1; t_cur = 0.;
     cs_lagr_get_trajectory_values(p_set,
@@ -7960,6 +8658,13 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
       if (post_mesh->n_a_fields > 0)
         _cs_post_output_attached_fields(post_mesh, ts);
 
+      /* Element ids of decimated meshes refer to agglomerates, not to
+         parent cells, so only field values (averaged on agglomerates
+         by cs_post_write_var) are output */
+
+      if (post_mesh->c_agg_id != NULL)
+        continue;
+
       if (post_mesh->cat_id < 0)
         _output_function_data(post_mesh, ts);
 
@@ -8103,6 +8808,7 @@ cs_post_time_step_end(void)
     if (post_mesh->_exp_mesh != NULL) {
       if (   post_mesh->ent_flag[3]
           || post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT) {
+        _wait_writers();
         post_mesh->exp_mesh = NULL;
         post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
       }
@@ -8152,6 +8858,10 @@ cs_post_finalize(void)
   int i, j;
   cs_post_mesh_t  *post_mesh = NULL;
 
+  /* Complete pending output */
+
+  _wait_writers();
+
   /* Timings */
 
   for (i = 0; i < _cs_post_n_writers; i++) {
@@ -8193,6 +8903,7 @@ cs_post_finalize(void)
     BFT_FREE(post_mesh->writer_id);
     BFT_FREE(post_mesh->nt_last);
     BFT_FREE(post_mesh->a_field_info);
+    BFT_FREE(post_mesh->c_agg_id);
   }
 
   BFT_FREE(_cs_post_meshes);
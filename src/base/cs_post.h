@@ -367,6 +367,42 @@ cs_post_define_volume_mesh_by_func(int                    mesh_id,
                                    int                    n_writers,
                                    const int              writer_ids[]);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Define a decimated volume post-processing mesh.
+ *
+ * Selected cells are agglomerated using \p n_passes passes of pairwise
+ * agglomeration of neighboring cells (preferring pairs sharing the largest
+ * face surface), so each pass divides the number of output cells by up
+ * to 2. Agglomerates do not cross rank boundaries.
+ *
+ * Cell-based variables output with parent values on this mesh are
+ * averaged on agglomerates (weighted by cell volumes), so frequent
+ * visualization output costs only a fraction of that of a full-resolution
+ * mesh. Since element ids of this mesh refer to agglomerates and not to
+ * parent cells, only fields (and vertex values) are output automatically;
+ * other automatic or user outputs are not called for this mesh.
+ *
+ * \param[in]  mesh_id         id of mesh to define
+ *                             (< 0 reserved, > 0 for user)
+ * \param[in]  mesh_name       associated mesh name
+ * \param[in]  cell_criteria   selection criteria for cells
+ * \param[in]  n_passes        number of agglomeration passes
+ * \param[in]  auto_variables  if true, automatic output of main variables
+ * \param[in]  n_writers       number of associated writers
+ * \param[in]  writer_ids      ids of associated writers
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_define_decimated_mesh(int          mesh_id,
+                              const char  *mesh_name,
+                              const char  *cell_criteria,
+                              int          n_passes,
+                              bool         auto_variables,
+                              int          n_writers,
+                              const int    writer_ids[]);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Define a surface post-processing mesh.
@@ -984,6 +1020,30 @@ cs_post_activate_by_time_step(const cs_time_step_t  *ts);
 bool
 cs_post_writer_is_active(int  writer_id);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Allow output of a given writer to be delayed by a few time steps,
+ *        so as to spread output over time steps.
+ *
+ * When output of several writers or a checkpoint is due at the same time
+ * step, output of writers allowing a delay is deferred to the following
+ * time steps, based on the predicted output size of each writer
+ * (estimated from its previous output), so as to reduce the peak output
+ * volume at a given time step.
+ *
+ * Output is never delayed by more than the given number of time steps,
+ * nor past the last time step. Delayed output is associated with the
+ * time step at which it is actually done.
+ *
+ * \param[in]  writer_id  writer id, or 0 for all writers
+ * \param[in]  n_steps    maximum output delay, in time steps (0 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_writer_set_stagger(int  writer_id,
+                           int  n_steps);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Force the "active" or "inactive" flag for a specific writer or for all
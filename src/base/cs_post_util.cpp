@@ -46,6 +46,7 @@
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 #include "cs_field_operator.h"
+#include "cs_function_default.h"
 #include "cs_geom.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
@@ -1276,6 +1277,175 @@ cs_post_bnd_scalar_b_zone_mean(const cs_zone_t *z,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute wall quantities integrated over a boundary zone.
+ *
+ * The zone's face list is used directly, and all local sums are
+ * computed using threaded reductions, so that the global values require
+ * only one parallel sum and one parallel maximum.
+ *
+ * Quantities based on fields which are not available ("boundary_forces"
+ * for the total and shear forces, "yplus", and "tplus" with "tstar"
+ * for the Nusselt number) are set to 0.
+ *
+ * \param[in]   z     pointer to boundary zone
+ * \param[out]  wq    integrated wall quantities
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_b_zone_wall_quantities(const cs_zone_t        *z,
+                               cs_post_b_zone_wall_t  *wq)
+{
+  const cs_lnum_t n_elts = z->n_elts;
+  const cs_lnum_t *elt_ids = z->elt_ids;
+
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_real_t *b_face_surf = mq->b_face_surf;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)mq->b_face_normal;
+
+  const cs_field_t *f_forces = cs_field_by_name_try("boundary_forces");
+  const cs_field_t *f_yplus = cs_field_by_name_try("yplus");
+  const bool have_nusselt = (   cs_field_by_name_try("tplus") != nullptr
+                             && cs_field_by_name_try("tstar") != nullptr);
+
+  /* Local sums, packed for a single parallel sum:
+     surface, force, pressure force, shear force, then surface-weighted
+     sums of shear stress magnitude, y+ and Nusselt number */
+
+  double l_sum[13];
+  for (int i = 0; i < 13; i++)
+    l_sum[i] = 0.;
+
+  /* Local y+ extrema, packed as {-min, max} for a single parallel max */
+
+  double l_max[2] = {-HUGE_VAL, -HUGE_VAL};
+
+  double vmin[4], vmax[4], vsum[4], wsum[4];
+
+  cs_real_t *b_vals;
+  cs_real_3_t *b_vals_3;
+  BFT_MALLOC(b_vals, n_elts, cs_real_t);
+  BFT_MALLOC(b_vals_3, n_elts, cs_real_3_t);
+
+  /* Surface */
+
+  if (n_elts > 0) {
+    cs_array_reduce_sum_l(n_elts, 1, elt_ids, b_face_surf, vsum);
+    l_sum[0] = vsum[0];
+  }
+
+  /* Total force and shear force; the sum of shear force norms
+     is the surface-weighted sum of the shear stress magnitude */
+
+  if (f_forces != nullptr && n_elts > 0) {
+    const cs_real_3_t *forbr = (const cs_real_3_t *)f_forces->val;
+
+    cs_array_reduce_simple_stats_l(n_elts, 3, elt_ids, f_forces->val,
+                                   vmin, vmax, vsum);
+    for (int i = 0; i < 3; i++)
+      l_sum[1+i] = vsum[i];
+
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+      cs_lnum_t face_id = elt_ids[e_id];
+      cs_real_t srfnor[3];
+      for (int i = 0; i < 3; i++)
+        srfnor[i] = b_face_normal[face_id][i] / b_face_surf[face_id];
+      cs_real_t fornor = cs_math_3_dot_product(forbr[face_id], srfnor);
+      for (int i = 0; i < 3; i++)
+        b_vals_3[e_id][i] = forbr[face_id][i] - fornor*srfnor[i];
+    }
+
+    cs_array_reduce_simple_stats_l(n_elts, 3, nullptr,
+                                   (const cs_real_t *)b_vals_3,
+                                   vmin, vmax, vsum);
+    for (int i = 0; i < 3; i++)
+      l_sum[7+i] = vsum[i];
+    l_sum[10] = vsum[3];
+  }
+
+  /* Pressure force (the pressure gradient is computed on all ranks) */
+
+  cs_post_b_pressure(n_elts, elt_ids, b_vals);
+
+  if (n_elts > 0) {
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t e_id = 0; e_id < n_elts; e_id++) {
+      cs_lnum_t face_id = elt_ids[e_id];
+      for (int i = 0; i < 3; i++)
+        b_vals_3[e_id][i] = b_vals[e_id]*b_face_normal[face_id][i];
+    }
+
+    cs_array_reduce_simple_stats_l(n_elts, 3, nullptr,
+                                   (const cs_real_t *)b_vals_3,
+                                   vmin, vmax, vsum);
+    for (int i = 0; i < 3; i++)
+      l_sum[4+i] = vsum[i];
+  }
+
+  /* y+ */
+
+  if (f_yplus != nullptr && n_elts > 0) {
+    cs_array_reduce_simple_stats_l_w(n_elts, 1, elt_ids, nullptr,
+                                     f_yplus->val, b_face_surf,
+                                     vmin, vmax, vsum, wsum);
+    l_sum[11] = wsum[0];
+    l_max[0] = -vmin[0];
+    l_max[1] = vmax[0];
+  }
+
+  /* Nusselt number (gradients may be computed on all ranks) */
+
+  if (have_nusselt) {
+    cs_function_boundary_nusselt(CS_MESH_LOCATION_BOUNDARY_FACES,
+                                 n_elts,
+                                 elt_ids,
+                                 nullptr,
+                                 b_vals);
+    if (n_elts > 0) {
+      cs_array_reduce_wsum_l(n_elts, 1, nullptr, elt_ids,
+                             b_vals, b_face_surf, vsum);
+      l_sum[12] = vsum[0];
+    }
+  }
+
+  BFT_FREE(b_vals);
+  BFT_FREE(b_vals_3);
+
+  /* Parallel reductions */
+
+  cs_parall_sum(13, CS_DOUBLE, l_sum);
+  cs_parall_max(2, CS_DOUBLE, l_max);
+
+  /* Return values */
+
+  const double surface = l_sum[0];
+  const double s_inv = (surface > 0.) ? 1. / surface : 0.;
+
+  wq->surface = surface;
+  for (int i = 0; i < 3; i++) {
+    wq->force[i] = l_sum[1+i];
+    wq->pressure_force[i] = l_sum[4+i];
+    wq->shear_force[i] = l_sum[7+i];
+  }
+  wq->tau_mean = l_sum[10] * s_inv;
+
+  if (f_yplus != nullptr && l_max[1] > -HUGE_VAL) {
+    wq->yplus_min = -l_max[0];
+    wq->yplus_max = l_max[1];
+  }
+  else {
+    wq->yplus_min = 0.;
+    wq->yplus_max = 0.;
+  }
+  wq->yplus_mean = l_sum[11] * s_inv;
+
+  wq->nusselt_mean = l_sum[12] * s_inv;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -43,6 +43,29 @@ BEGIN_C_DECLS
  * Type Definitions
  *============================================================================*/
 
+/*! Wall quantities integrated over a boundary zone */
+
+typedef struct {
+
+  cs_real_t  surface;            /*!< zone surface */
+
+  cs_real_t  force[3];           /*!< total force, based on the
+                                      "boundary_forces" field */
+  cs_real_t  pressure_force[3];  /*!< static pressure force */
+  cs_real_t  shear_force[3];     /*!< tangential (friction) force */
+
+  cs_real_t  tau_mean;           /*!< surface mean of the wall shear
+                                      stress magnitude */
+
+  cs_real_t  yplus_min;          /*!< minimum of y+ */
+  cs_real_t  yplus_max;          /*!< maximum of y+ */
+  cs_real_t  yplus_mean;         /*!< surface mean of y+ */
+
+  cs_real_t  nusselt_mean;       /*!< surface mean of the local Nusselt
+                                      number */
+
+} cs_post_b_zone_wall_t;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -489,6 +512,27 @@ cs_real_t
 cs_post_bnd_scalar_b_zone_mean(const cs_zone_t *z,
                                const cs_real_t *scalar_vals);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute wall quantities integrated over a boundary zone.
+ *
+ * The zone's face list is used directly, and all local sums are
+ * computed using threaded reductions, so that the global values require
+ * only one parallel sum and one parallel maximum.
+ *
+ * Quantities based on fields which are not available ("boundary_forces"
+ * for the total and shear forces, "yplus", and "tplus" with "tstar"
+ * for the Nusselt number) are set to 0.
+ *
+ * \param[in]   z     pointer to boundary zone
+ * \param[out]  wq    integrated wall quantities
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_b_zone_wall_quantities(const cs_zone_t        *z,
+                               cs_post_b_zone_wall_t  *wq);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -54,7 +54,9 @@
 #include "cs_log.h"
 #include "cs_map.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
 #include "cs_mesh_cartesian.h"
+#include "cs_mesh_cache.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -68,6 +70,7 @@
 #include "cs_post.h"
 #include "cs_prototypes.h"
 #include "cs_preprocessor_data.h"
+#include "cs_startup_log.h"
 #include "cs_timer_stats.h"
 #include "cs_velocity_pressure.h"
 #include "cs_volume_zone.h"
@@ -145,86 +148,46 @@ extern void cs_f_majgeo(const cs_lnum_t    *ncel,
  * Private function definitions
  *============================================================================*/
 
-/*============================================================================
- * Fortran wrapper function definitions
- *============================================================================*/
-
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*=============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Define all mesh preprocessing operations.
- */
-/*----------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Start a mesh preprocessing phase.
+ *
+ * The matching timer statistic is made current, and a new phase is
+ * started for the startup log.
+ *
+ * parameters:
+ *   stat_name  <-- name of associated timer statistic
+ *   phase_name <-- name of associated startup phase
+ *----------------------------------------------------------------------------*/
 
-void
-cs_preprocess_mesh_define(void)
+static void
+_start_phase(const char  *stat_name,
+             const char  *phase_name)
 {
-  cs_gui_mesh_restart_mode();
-  cs_user_mesh_restart_mode();
-
-  if (   cs_preprocessor_data_get_restart_mode()
-      == CS_PREPROCESSOR_DATA_RESTART_ONLY)
-    return;
-
-  /* Define meshes to read */
-
-  cs_user_mesh_input();
-
-  /* Check if internally generated cartesian meshes are used. */
-
-  cs_gui_mesh_cartesian_define();
-  cs_user_mesh_cartesian_define();
-
-  /* Finalize definitions and compute global values if cartesian mesh
-     definitions are present. */
-
-  cs_mesh_cartesian_finalize_definition();
-
-  /* Define joining and periodicity parameters if requested
-     Must be done before cs_setup() for the sake of verification */
-
-  cs_gui_mesh_define_joinings();
-  cs_user_join();
-
-  cs_gui_mesh_define_periodicities();
-  cs_user_periodicity();
-
-  cs_gui_mesh_warping();
-  cs_user_mesh_warping();
+  cs_timer_stats_switch(cs_timer_stats_id_by_name(stat_name));
+  cs_startup_log_phase(phase_name);
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Apply all mesh preprocessing operations.
- */
-/*----------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Build main mesh from preprocessor data, up to renumbering.
+ *
+ * This includes joining, mesh modification, partitioning and halo
+ * construction steps.
+ *
+ * parameters:
+ *   m            <-> pointer to mesh structure
+ *   mq           <-> pointer to mesh quantities structure
+ *   halo_type    <-- type of halo (standard or extended)
+ *   allow_modify <-- allow mesh modification operations
+ *----------------------------------------------------------------------------*/
 
-void
-cs_preprocess_mesh(cs_halo_type_t   halo_type)
+static void
+_build_mesh(cs_mesh_t             *m,
+            cs_mesh_quantities_t  *mq,
+            cs_halo_type_t         halo_type,
+            bool                   allow_modify)
 {
   double  t1, t2;
 
-  int t_stat_id = cs_timer_stats_id_by_name("mesh_processing");
-
-  int t_top_id = cs_timer_stats_switch(t_stat_id);
-
-  bool allow_modify = true;
-  if (   cs_preprocessor_data_get_restart_mode()
-      == CS_PREPROCESSOR_DATA_RESTART_ONLY)
-    allow_modify = false;
-
-  cs_mesh_t *m = cs_glob_mesh;
-  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-
-  /* Disable all writers until explicitely enabled for this stage */
-
-  cs_post_disable_writer(0);
-
   /* Set partitioning options */
 
   {
@@ -254,6 +217,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
     /* Join meshes / build periodicity links if necessary */
 
+    _start_phase("mesh_joining", "mesh joining");
+
     cs_join_all(true);
 
     /* Insert boundaries if necessary */
@@ -268,9 +233,17 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   /* Initialize extended connectivity, ghost cells and other remaining
      parallelism-related structures */
 
+  _start_phase("mesh_halo", "halo creation");
+
   cs_mesh_init_halo(m, cs_glob_mesh_builder, halo_type, m->verbosity, true);
   cs_mesh_update_auxiliary(m);
 
+  _start_phase("mesh_processing", "mesh modification");
+
+  /* Adaptive refinement or coarsening based on flags from previous run */
+
+  cs_mesh_adapt_apply(m);
+
   if (allow_modify) {
 
     /* Possible geometry modification */
@@ -323,6 +296,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
     need_save = true;
 
   if (need_partition) {
+    _start_phase("mesh_partitioning", "mesh partitioning");
+
     cs_mesh_quantities_free_all(mq);
 
     if (need_save) {
@@ -353,12 +328,110 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   /* Renumber mesh based on code options */
 
+  _start_phase("mesh_renumbering", "mesh renumbering");
+
   cs_user_numbering();
 
   cs_renumber_mesh(m);
+}
+
+/*============================================================================
+ * Fortran wrapper function definitions
+ *============================================================================*/
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define all mesh preprocessing operations.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocess_mesh_define(void)
+{
+  cs_gui_mesh_restart_mode();
+  cs_user_mesh_restart_mode();
+
+  if (   cs_preprocessor_data_get_restart_mode()
+      == CS_PREPROCESSOR_DATA_RESTART_ONLY)
+    return;
+
+  /* Define meshes to read */
+
+  cs_user_mesh_input();
+
+  /* Check if internally generated cartesian meshes are used. */
+
+  cs_gui_mesh_cartesian_define();
+  cs_user_mesh_cartesian_define();
+
+  /* Finalize definitions and compute global values if cartesian mesh
+     definitions are present. */
+
+  cs_mesh_cartesian_finalize_definition();
+
+  /* Define joining and periodicity parameters if requested
+     Must be done before cs_setup() for the sake of verification */
+
+  cs_gui_mesh_define_joinings();
+  cs_user_join();
+
+  cs_gui_mesh_define_periodicities();
+  cs_user_periodicity();
+
+  cs_gui_mesh_warping();
+  cs_user_mesh_warping();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply all mesh preprocessing operations.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_preprocess_mesh(cs_halo_type_t   halo_type)
+{
+  double  t1, t2;
+
+  int t_stat_id = cs_timer_stats_id_by_name("mesh_processing");
+
+  int t_top_id = cs_timer_stats_switch(t_stat_id);
+
+  bool allow_modify = true;
+  if (   cs_preprocessor_data_get_restart_mode()
+      == CS_PREPROCESSOR_DATA_RESTART_ONLY)
+    allow_modify = false;
+
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  /* Disable all writers until explicitely enabled for this stage */
+
+  cs_post_disable_writer(0);
+
+  /* Read mesh from cache if available, build it otherwise */
+
+  _start_phase("mesh_io", "mesh reading");
+
+  if (cs_mesh_adapt_pending() == false && cs_mesh_cache_read(m, halo_type)) {
+    cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+    cs_mesh_cartesian_params_destroy();
+  }
+  else {
+    _build_mesh(m, mq, halo_type, allow_modify);
+    cs_mesh_cache_write(m);
+  }
 
   /* Initialize group classes */
 
+  _start_phase("mesh_processing", "mesh finalization");
+
   cs_mesh_init_group_classes(m);
 
   /* Print info on mesh */
@@ -369,6 +442,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   bft_printf_flush();
 
+  _start_phase("mesh_quantities", "mesh quantities");
+
   t1 = cs_timer_wtime();
 
   /* If fluid_solid mode is activated: disable solid cells for the dynamics */
@@ -384,6 +459,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
 
   bft_printf(_("\n Computing geometric quantities (%.3g s)\n"), t2-t1);
 
+  _start_phase("mesh_processing", "mesh locations and zones");
+
   /* Initialize selectors */
 
   cs_mesh_init_selectors();
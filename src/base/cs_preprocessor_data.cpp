@@ -59,6 +59,7 @@
 #include "cs_mesh_cartesian.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
+#include "cs_mesh_import.h"
 #include "cs_parall.h"
 #include "cs_partition.h"
 #include "cs_io.h"
@@ -137,6 +138,10 @@ static const char _cp_input_default_noext[] = "restart/mesh_input";
 
 static _mesh_reader_t *_cs_glob_mesh_reader = nullptr;
 
+/* Direct (parallel) import of CGNS or MED mesh */
+
+static bool _mesh_import = false;
+
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
 #else
@@ -1609,6 +1614,9 @@ _read_data(int                 file_id,
                              hints,
                              block_comm,
                              comm);
+
+    /* Ensemble members share the same mesh, which is read only once */
+    cs_io_set_shared_read(pp_in, cs_glob_ensemble_peer_comm);
   }
 #else
   {
@@ -2364,7 +2372,10 @@ cs_preprocessor_check_perio(void)
   _n_max_mesh_files = 0;
 
   for (int i = 0; i < _n_mesh_files; i++) {
-    retval = _read_perio_info((_mesh_file_info + i)->filename);
+    const char *filename = (_mesh_file_info + i)->filename;
+    if (cs_mesh_import_is_supported(filename))
+      continue;
+    retval = _read_perio_info(filename);
     perio_flag = CS_MAX(retval, perio_flag);
   }
 
@@ -2415,8 +2426,33 @@ cs_preprocessor_data_read_headers(cs_mesh_t          *mesh,
 
     mr = _cs_glob_mesh_reader;
 
-    for (file_id = 0; file_id < mr->n_files; file_id++)
-      _read_dimensions(mesh, mesh_builder, mr, file_id);
+    /* CGNS or MED files are read directly, in parallel,
+       and may not be combined with other inputs */
+
+    _mesh_import = false;
+    for (file_id = 0; file_id < mr->n_files; file_id++) {
+      if (cs_mesh_import_is_supported(mr->file_info[file_id].filename))
+        _mesh_import = true;
+    }
+
+    if (_mesh_import) {
+      const _mesh_file_info_t *f = mr->file_info;
+      if (mr->n_files > 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Mesh file \"%s\" is imported directly, and may not be\n"
+                    "combined with other mesh inputs."), f->filename);
+      cs_mesh_import_read_headers(f->filename, mesh);
+      if (f->n_group_renames > 0)
+        _mesh_groups_rename(mesh,
+                            0,
+                            f->n_group_renames,
+                            f->old_group_names,
+                            f->new_group_names);
+    }
+    else {
+      for (file_id = 0; file_id < mr->n_files; file_id++)
+        _read_dimensions(mesh, mesh_builder, mr, file_id);
+    }
   }
 
   /* Return values */
@@ -2513,6 +2549,16 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
       cs_mesh_cartesian_block_connectivity(m_id, mesh, mesh_builder, echo);
     mesh->modified |= CS_MESH_MODIFIED;
   }
+  else if (_mesh_import) {
+    const _mesh_file_info_t *f = mr->file_info;
+    cs_mesh_import_read_data(mesh, mesh_builder);
+    if (f->matrix != nullptr)
+      _transform_coords(  mesh_builder->vertex_bi.gnum_range[1]
+                        - mesh_builder->vertex_bi.gnum_range[0],
+                        mesh_builder->vertex_coords,
+                        f->matrix);
+    _mesh_import = false;
+  }
   else {
     for (file_id = 0; file_id < mr->n_files; file_id++)
       _read_data(file_id, mesh, mesh_builder, mr, echo);
@@ -66,6 +66,7 @@
 #include "cs_lagr.h"
 #include "cs_log.h"
 #include "cs_matrix_building.h"
+#include "cs_matrix_default.h"
 #include "cs_mesh_location.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
@@ -112,6 +113,27 @@ BEGIN_C_DECLS
 
 #define CS_PRESSURE_CORRECTION_CDO_DBG  0
 
+/* Maximum number of vectors for the projection of the initial guess */
+
+#define CS_PRESSURE_CORRECTION_PROJ_MAX  16
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Basis of previous pressure increments, used to build the initial guess
+   of the first pressure increment solve by projection (Fischer, 1998) */
+
+typedef struct {
+
+  int         n_max;      /* maximum number of vectors */
+  int         n_vecs;     /* current number of vectors */
+  cs_lnum_t   n_rows;     /* number of rows of each vector */
+
+  cs_real_t  *x;          /* A-orthonormal basis */
+
+} _projection_t;
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -128,10 +150,165 @@ static bool cs_pressure_correction_cdo_active = false;
 
 static cs_pressure_correction_cdo_t *cs_pressure_correction_cdo = nullptr;
 
+static _projection_t _p_proj = {0, 0, 0, nullptr};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the initial guess of a pressure increment solve by projection
+ *        of the right-hand side on a basis of previous solutions.
+ *
+ * Since the basis is A-orthonormal, the A-norm optimal guess in the
+ * subspace is \f$ \sum_i (x_i \cdot b) x_i \f$, requiring only one
+ * reduction.
+ *
+ * \param[in]       n_cells  number of cells
+ * \param[in]       n_max    maximum number of basis vectors
+ * \param[in]       rhs      right-hand side
+ * \param[in, out]  dphi     initial guess (should be initialized to 0)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_projection_initial_guess(cs_lnum_t        n_cells,
+                          int              n_max,
+                          const cs_real_t  rhs[],
+                          cs_real_t        dphi[])
+{
+  _projection_t *pj = &_p_proj;
+
+  n_max = CS_MIN(n_max, CS_PRESSURE_CORRECTION_PROJ_MAX);
+
+  /* (Re)initialize basis when needed */
+
+  if (pj->n_max != n_max || pj->n_rows != n_cells) {
+    CS_FREE_HD(pj->x);
+    pj->n_max = n_max;
+    pj->n_vecs = 0;
+    pj->n_rows = n_cells;
+    CS_MALLOC_HD(pj->x, (size_t)n_max*n_cells, cs_real_t, cs_alloc_mode);
+  }
+
+  if (pj->n_vecs < 1)
+    return;
+
+  const int n_vecs = pj->n_vecs;
+  const cs_real_t *x = pj->x;
+
+  cs_real_t alpha[CS_PRESSURE_CORRECTION_PROJ_MAX];
+  for (int i = 0; i < n_vecs; i++)
+    alpha[i] = cs_dot(n_cells, x + (size_t)i*n_cells, rhs);
+
+  cs_parall_sum(n_vecs, CS_REAL_TYPE, alpha);
+
+  cs_dispatch_context ctx;
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    cs_real_t s = 0.;
+    for (int i = 0; i < n_vecs; i++)
+      s += alpha[i] * x[(size_t)i*n_cells + c_id];
+    dphi[c_id] = s;
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the solution of a pressure increment solve to the projection
+ *        basis.
+ *
+ * The solution is A-orthonormalized against the current basis, using
+ * a single matrix-vector product. When the basis is full (or has lost
+ * its A-orthogonality due to matrix changes), it is restarted from the
+ * latest solution only.
+ *
+ * \param[in]       f_id         associated field id
+ * \param[in]       n_cells      number of cells
+ * \param[in]       n_cells_ext  number of cells with ghosts
+ * \param[in]       dam          matrix diagonal
+ * \param[in]       xam          matrix extra-diagonal terms
+ * \param[in, out]  dphi         solution (halo may be synchronized)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_projection_update(int              f_id,
+                   cs_lnum_t        n_cells,
+                   cs_lnum_t        n_cells_ext,
+                   const cs_real_t  dam[],
+                   const cs_real_t  xam[],
+                   cs_real_t        dphi[])
+{
+  _projection_t *pj = &_p_proj;
+
+  if (pj->x == nullptr)
+    return;
+
+  cs_real_t *adphi;
+  CS_MALLOC_HD(adphi, n_cells_ext, cs_real_t, cs_alloc_mode);
+
+  cs_matrix_vector_native_multiply(true, 1, 1, f_id,
+                                   dam, xam, dphi, adphi);
+
+  const int n_vecs = pj->n_vecs;
+  cs_real_t *x = pj->x;
+
+  /* beta_i = x_i.A.dphi, and dphi.A.dphi in last position */
+
+  cs_real_t beta[CS_PRESSURE_CORRECTION_PROJ_MAX + 1];
+  for (int i = 0; i < n_vecs; i++)
+    beta[i] = cs_dot(n_cells, x + (size_t)i*n_cells, adphi);
+  beta[n_vecs] = cs_dot(n_cells, dphi, adphi);
+
+  cs_parall_sum(n_vecs + 1, CS_REAL_TYPE, beta);
+
+  CS_FREE_HD(adphi);
+
+  const cs_real_t a_norm2_ref = beta[n_vecs];
+  cs_real_t a_norm2 = a_norm2_ref;
+  for (int i = 0; i < n_vecs; i++)
+    a_norm2 -= beta[i]*beta[i];
+
+  cs_dispatch_context ctx;
+
+  if (n_vecs < pj->n_max && a_norm2 > 1e-10*a_norm2_ref) {
+
+    const cs_real_t scale = 1. / sqrt(a_norm2);
+    cs_real_t *x_n = x + (size_t)n_vecs*n_cells;
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      cs_real_t s = dphi[c_id];
+      for (int i = 0; i < n_vecs; i++)
+        s -= beta[i] * x[(size_t)i*n_cells + c_id];
+      x_n[c_id] = s * scale;
+    });
+
+    pj->n_vecs += 1;
+
+  }
+  else if (n_vecs == pj->n_max || a_norm2 < 0) {
+
+    /* Restart from the last solution */
+
+    if (a_norm2_ref > 0) {
+      const cs_real_t scale = 1. / sqrt(a_norm2_ref);
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+        x[c_id] = dphi[c_id] * scale;
+      });
+      pj->n_vecs = 1;
+    }
+    else
+      pj->n_vecs = 0;
+
+  }
+
+  ctx.wait();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  *  \brief Poisson equation resolution for hydrostatic pressure:
@@ -2191,6 +2368,16 @@ _pressure_correction_fv(int                   iterns,
 
     ctx.wait();
 
+    /* Initial guess by projection on previous solutions
+       (only for the first sweep, whose right-hand side is comparable
+       from one time step to the next) */
+
+    const bool use_proj = (   vp_param->n_p_proj > 0
+                           && symmetric && isweep == 1);
+
+    if (use_proj)
+      _projection_initial_guess(n_cells, vp_param->n_p_proj, rhs, dphi);
+
     cs_real_t ressol = residual;   /* solver residual */
 
     cs_sles_solve_native(f_p->id, nullptr,
@@ -2203,6 +2390,9 @@ _pressure_correction_fv(int                   iterns,
                          rhs,
                          dphi);
 
+    if (use_proj)
+      _projection_update(f_p->id, n_cells, n_cells_ext, dam, xam, dphi);
+
 
     /* Dynamic relaxation of the system
        -------------------------------- */
@@ -2524,27 +2714,48 @@ _pressure_correction_fv(int                   iterns,
         || vp_param->staggered == 1)
       inc = 1;
 
-    if (eqp_p->idften & CS_ISOTROPIC_DIFFUSION)
-      cs_face_diffusion_potential(-1,
-                                  m,
-                                  fvq,
-                                  0,  /* init */
-                                  inc,
-                                  eqp_p->imrgra,
-                                  eqp_p->nswrgr,
-                                  eqp_p->imligr,
-                                  vp_param->iphydr,
-                                  eqp_p->iwgrec,
-                                  eqp_p->verbosity,
-                                  eqp_p->epsrgr,
-                                  eqp_p->climgr,
-                                  dfrcxt,
-                                  phia,
-                                  bc_coeffs_dp,
-                                  i_visc, b_visc, c_visc,
-                                  imasfl, bmasfl);
+    /* The last increment is not reconstructed so as to fulfill exactly
+       the continuity equation (see theory guide). The value of dfrcxt has
+       no importance for this increment. */
+
+    if (eqp_p->idften & CS_ISOTROPIC_DIFFUSION) {
+
+      /* Both increments (and the divergence of the corrected mass flux
+         when it is logged) are handled in a single pass over faces */
+
+      cs_real_t *div_corr = (eqp_p->iwarni >= 2) ? res : nullptr;
+
+      cs_face_diffusion_potential_fused(-1,
+                                        m,
+                                        fvq,
+                                        inc,
+                                        eqp_p->imrgra,
+                                        eqp_p->nswrgr,
+                                        eqp_p->imligr,
+                                        vp_param->iphydr,
+                                        eqp_p->iwgrec,
+                                        eqp_p->verbosity,
+                                        eqp_p->epsrgr,
+                                        eqp_p->climgr,
+                                        dfrcxt,
+                                        phia,
+                                        dphi,
+                                        bc_coeffs_dp,
+                                        i_visc, b_visc, c_visc,
+                                        imasfl, bmasfl,
+                                        div_corr);
+
+      if (div_corr != nullptr) {
+        cs_real_t rnormc = sqrt(cs_gdot(n_cells, div_corr, div_corr));
+        cs_log_printf(CS_LOG_DEFAULT,
+                      _(" %-16s : corrected mass flux divergence = %14.6e\n"),
+                      f_p->name, rnormc);
+      }
+
+    }
+
+    else if (eqp_p->idften & CS_ANISOTROPIC_DIFFUSION) {
 
-    else if (eqp_p->idften & CS_ANISOTROPIC_DIFFUSION)
       cs_face_anisotropic_diffusion_potential(-1,
                                               m,
                                               fvq,
@@ -2567,31 +2778,6 @@ _pressure_correction_fv(int                   iterns,
                                               weighf, weighb,
                                               imasfl, bmasfl);
 
-    /* The last increment is not reconstructed so as to fulfill exactly
-       the continuity equation (see theory guide). The value of dfrcxt has
-       no importance. */
-
-    if (eqp_p->idften & CS_ISOTROPIC_DIFFUSION)
-      cs_face_diffusion_potential(-1,
-                                  m,
-                                  fvq,
-                                  0,  /* init */
-                                  0,  /* inc */
-                                  eqp_p->imrgra,
-                                  0,  /* nswrgr (no reconstruction) */
-                                  eqp_p->imligr,
-                                  vp_param->iphydr,
-                                  eqp_p->iwgrec,
-                                  eqp_p->verbosity,
-                                  eqp_p->epsrgr,
-                                  eqp_p->climgr,
-                                  dfrcxt,
-                                  dphi,
-                                  bc_coeffs_dp,
-                                  i_visc, b_visc, c_visc,
-                                  imasfl, bmasfl);
-
-    else if (eqp_p->idften & CS_ANISOTROPIC_DIFFUSION)
       cs_face_anisotropic_diffusion_potential(-1,
                                               m,
                                               fvq,
@@ -2614,6 +2800,8 @@ _pressure_correction_fv(int                   iterns,
                                               weighf, weighb,
                                               imasfl, bmasfl);
 
+    }
+
   }
 
   /* Update density
@@ -3759,6 +3947,23 @@ cs_pressure_correction_cdo_destroy_all(void)
   cs_pressure_correction_cdo = nullptr;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data used to build the initial guess of pressure increment
+ *        solves by projection on previous solutions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_pressure_correction_finalize(void)
+{
+  CS_FREE_HD(_p_proj.x);
+
+  _p_proj.n_max = 0;
+  _p_proj.n_vecs = 0;
+  _p_proj.n_rows = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Perform the pressure correction step of the Navier-Stokes equations
@@ -109,6 +109,16 @@ cs_pressure_correction_fv_activate(void);
 void
 cs_pressure_correction_cdo_destroy_all(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data used to build the initial guess of pressure increment
+ *        solves by projection on previous solutions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_pressure_correction_finalize(void);
+
 
 /*----------------------------------------------------------------------------*/
 /*
@@ -2213,6 +2213,25 @@ cs_probe_set_get_loc_curvilinear_abscissa(const cs_probe_set_t   *pset)
   return s;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the ids of a probe set's local probes in the full set.
+ *
+ * \param[in]  pset  pointer to a cs_probe_set_t structure
+ *
+ * \return  ids of local probes (size: number of local probes)
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_probe_set_get_loc_ids(const cs_probe_set_t  *pset)
+{
+  if (pset == nullptr)
+    return nullptr;
+
+  return pset->loc_id;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return the ids of a probe set's local matching elements, relative
@@ -0,0 +1,730 @@
+/*============================================================================
+ * In-situ spectral analysis of field values on probe sets.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_field.h"
+#include "cs_file.h"
+#include "cs_math.h"
+#include "cs_parall.h"
+#include "cs_probe.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_probe_spectra.h"
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_probe_spectra.cpp
+        In-situ spectral analysis of field values on probe sets.
+
+  Field values at probe locations are buffered over segments of a given
+  number of samples. Once a segment is complete, its (mean-removed,
+  Hann-windowed) discrete Fourier transform is computed for each local
+  probe and its squared magnitude is accumulated; segments overlap by
+  half their length (Welch's method). Cross spectra relative to a
+  reference probe are accumulated in the same manner, the reference
+  probe's segment being shared by all ranks.
+
+  Only local probe values are buffered, so the memory cost is
+  proportional to the number of local probes times the segment length.
+  Sampling assumes a uniform time step; a warning is printed otherwise.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+typedef struct {
+
+  char                  *pset_name;     /* associated probe set name */
+  char                  *field_name;    /* associated field name */
+  int                    comp_id;       /* sampled component id */
+  int                    n_fft;         /* number of samples per segment */
+  int                    nt_interval;   /* sampling interval (time steps) */
+  int                    ref_probe_id;  /* reference probe id, or -1 */
+
+  const cs_probe_set_t  *pset;          /* associated probe set, or nullptr
+                                           before first sample */
+  const cs_field_t      *f;             /* associated field */
+
+  int                    n_probes;      /* global number of probes */
+  int                    n_loc;         /* number of local probes */
+  cs_lnum_t             *probe_id;      /* global ids of local probes */
+  int                    ref_loc;       /* local id of reference probe,
+                                           or -1 */
+
+  int                    n_buf;         /* number of buffered samples */
+  cs_real_t             *buf;           /* sample buffer (n_loc*n_fft) */
+
+  int                    n_samples;     /* total number of samples */
+  double                 t_first;       /* time of first sample */
+  double                 t_last;        /* time of last sample */
+  bool                   dt_warned;     /* non-uniform sampling warning
+                                           already printed ? */
+
+  int                    n_segments;    /* number of accumulated segments */
+  double                *psd;           /* accumulated squared magnitudes
+                                           (n_loc*n_freq) */
+  double                *csd;           /* accumulated cross products with
+                                           reference (n_loc*n_freq*2) */
+  double                *ref_psd;       /* accumulated squared magnitudes
+                                           of reference (n_freq) */
+
+} cs_probe_spectra_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int                   _n_spectra = 0;
+static cs_probe_spectra_t  **_spectra = nullptr;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * In-place radix-2 complex discrete Fourier transform.
+ *
+ * parameters:
+ *   n  <-- number of values (power of 2)
+ *   re <-> real parts
+ *   im <-> imaginary parts
+ *----------------------------------------------------------------------------*/
+
+static void
+_fft(int     n,
+     double  re[],
+     double  im[])
+{
+  /* Bit-reversal permutation */
+
+  for (int i = 1, j = 0; i < n; i++) {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      double t = re[i]; re[i] = re[j]; re[j] = t;
+      t = im[i]; im[i] = im[j]; im[j] = t;
+    }
+  }
+
+  /* Butterflies */
+
+  for (int len = 2; len <= n; len <<= 1) {
+    const int h = len / 2;
+    const double a = -2.*cs_math_pi/len;
+    const double w_re = cos(a), w_im = sin(a);
+    for (int i = 0; i < n; i += len) {
+      double c_re = 1., c_im = 0.;
+      for (int j = 0; j < h; j++) {
+        const int k0 = i + j, k1 = i + j + h;
+        const double v_re = re[k1]*c_re - im[k1]*c_im;
+        const double v_im = re[k1]*c_im + im[k1]*c_re;
+        re[k1] = re[k0] - v_re;
+        im[k1] = im[k0] - v_im;
+        re[k0] += v_re;
+        im[k0] += v_im;
+        const double t = c_re*w_re - c_im*w_im;
+        c_im = c_re*w_im + c_im*w_re;
+        c_re = t;
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Prepare and transform a segment: remove mean, apply Hann window,
+ * and compute discrete Fourier transform.
+ *
+ * parameters:
+ *   n  <-- number of values (power of 2)
+ *   x  <-- segment values
+ *   re --> real parts of transform
+ *   im --> imaginary parts of transform
+ *----------------------------------------------------------------------------*/
+
+static void
+_transform_segment(int              n,
+                   const cs_real_t  x[],
+                   double           re[],
+                   double           im[])
+{
+  double mean = 0.;
+  for (int j = 0; j < n; j++)
+    mean += x[j];
+  mean /= n;
+
+  for (int j = 0; j < n; j++) {
+    double w = 0.5*(1. - cos(2.*cs_math_pi*j/n));
+    re[j] = (x[j] - mean) * w;
+    im[j] = 0.;
+  }
+
+  _fft(n, re, im);
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize a spectral analysis at its first sample.
+ *
+ * parameters:
+ *   ps <-> spectral analysis
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_spectra(cs_probe_spectra_t  *ps)
+{
+  ps->pset = cs_probe_set_get(ps->pset_name);
+  if (ps->pset == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: probe set \"%s\" is not defined."),
+              __func__, ps->pset_name);
+
+  ps->f = cs_field_by_name(ps->field_name);
+  if (ps->comp_id < 0 || ps->comp_id >= ps->f->dim)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: component %d is not valid for field \"%s\"."),
+              __func__, ps->comp_id, ps->field_name);
+
+  if (cs_probe_set_get_elt_ids(ps->pset, ps->f->location_id) == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: location of field \"%s\" is not compatible with\n"
+                "probe set \"%s\"."),
+              __func__, ps->field_name, ps->pset_name);
+
+  cs_probe_set_get_members(ps->pset, nullptr, &(ps->n_probes), nullptr);
+  if (ps->ref_probe_id >= ps->n_probes)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: reference probe %d is not in probe set \"%s\"\n"
+                "(%d probes)."),
+              __func__, ps->ref_probe_id, ps->pset_name, ps->n_probes);
+
+  ps->n_loc = cs_probe_set_get_n_local(ps->pset);
+
+  const cs_lnum_t *loc_ids = cs_probe_set_get_loc_ids(ps->pset);
+
+  BFT_MALLOC(ps->probe_id, ps->n_loc, cs_lnum_t);
+  ps->ref_loc = -1;
+  for (int i = 0; i < ps->n_loc; i++) {
+    ps->probe_id[i] = loc_ids[i];
+    if (loc_ids[i] == ps->ref_probe_id)
+      ps->ref_loc = i;
+  }
+
+  const int n_freq = ps->n_fft/2 + 1;
+
+  BFT_MALLOC(ps->buf, ps->n_loc*ps->n_fft, cs_real_t);
+  BFT_MALLOC(ps->psd, ps->n_loc*n_freq, double);
+  for (int i = 0; i < ps->n_loc*n_freq; i++)
+    ps->psd[i] = 0.;
+
+  if (ps->ref_probe_id > -1) {
+    BFT_MALLOC(ps->csd, ps->n_loc*n_freq*2, double);
+    BFT_MALLOC(ps->ref_psd, n_freq, double);
+    for (int i = 0; i < ps->n_loc*n_freq*2; i++)
+      ps->csd[i] = 0.;
+    for (int i = 0; i < n_freq; i++)
+      ps->ref_psd[i] = 0.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Accumulate spectra for a complete segment, then shift buffer by
+ * half a segment.
+ *
+ * parameters:
+ *   ps <-> spectral analysis
+ *----------------------------------------------------------------------------*/
+
+static void
+_process_segment(cs_probe_spectra_t  *ps)
+{
+  const int n = ps->n_fft;
+  const int n_freq = n/2 + 1;
+
+  double *re, *im, *r_re = nullptr, *r_im = nullptr;
+  BFT_MALLOC(re, n, double);
+  BFT_MALLOC(im, n, double);
+
+  /* Reference probe segment, shared by all ranks */
+
+  if (ps->ref_probe_id > -1) {
+
+    cs_real_t *r_x;
+    BFT_MALLOC(r_x, n, cs_real_t);
+    BFT_MALLOC(r_re, n, double);
+    BFT_MALLOC(r_im, n, double);
+
+    for (int j = 0; j < n; j++)
+      r_x[j] = (ps->ref_loc > -1) ? ps->buf[ps->ref_loc*n + j] : 0.;
+    cs_parall_sum(n, CS_REAL_TYPE, r_x);
+
+    _transform_segment(n, r_x, r_re, r_im);
+    for (int k = 0; k < n_freq; k++)
+      ps->ref_psd[k] += r_re[k]*r_re[k] + r_im[k]*r_im[k];
+
+    BFT_FREE(r_x);
+  }
+
+  /* Local probes */
+
+  for (int i = 0; i < ps->n_loc; i++) {
+
+    _transform_segment(n, ps->buf + i*n, re, im);
+
+    double *psd = ps->psd + i*n_freq;
+    for (int k = 0; k < n_freq; k++)
+      psd[k] += re[k]*re[k] + im[k]*im[k];
+
+    if (r_re != nullptr) {
+      double *csd = ps->csd + i*n_freq*2;
+      for (int k = 0; k < n_freq; k++) {
+        csd[k*2]     += r_re[k]*re[k] + r_im[k]*im[k];
+        csd[k*2 + 1] += r_re[k]*im[k] - r_im[k]*re[k];
+      }
+    }
+
+    /* Keep second half of segment (50% overlap) */
+
+    memmove(ps->buf + i*n, ps->buf + i*n + n/2, (n/2)*sizeof(cs_real_t));
+  }
+
+  ps->n_buf = n/2;
+  ps->n_segments += 1;
+
+  BFT_FREE(r_im);
+  BFT_FREE(r_re);
+  BFT_FREE(im);
+  BFT_FREE(re);
+}
+
+/*----------------------------------------------------------------------------
+ * Gather local probe arrays to a global array on rank 0.
+ *
+ * parameters:
+ *   ps     <-- spectral analysis
+ *   stride <-- values per probe
+ *   l_vals <-- local values (n_loc*stride)
+ *
+ * returns:
+ *   newly allocated global values (n_probes*stride) on rank 0,
+ *   nullptr on other ranks
+ *----------------------------------------------------------------------------*/
+
+static double *
+_gather_probe_values(const cs_probe_spectra_t  *ps,
+                     int                        stride,
+                     const double               l_vals[])
+{
+  const cs_lnum_t n_g_vals = (cs_lnum_t)(ps->n_probes)*stride;
+
+  double *g_vals;
+  BFT_MALLOC(g_vals, n_g_vals, double);
+  for (cs_lnum_t i = 0; i < n_g_vals; i++)
+    g_vals[i] = 0.;
+
+  for (int i = 0; i < ps->n_loc; i++) {
+    for (int k = 0; k < stride; k++)
+      g_vals[ps->probe_id[i]*stride + k] = l_vals[i*stride + k];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    if (cs_glob_rank_id == 0)
+      MPI_Reduce(MPI_IN_PLACE, g_vals, n_g_vals, MPI_DOUBLE, MPI_SUM, 0,
+                 cs_glob_mpi_comm);
+    else {
+      MPI_Reduce(g_vals, nullptr, n_g_vals, MPI_DOUBLE, MPI_SUM, 0,
+                 cs_glob_mpi_comm);
+      BFT_FREE(g_vals);
+    }
+  }
+#endif
+
+  return g_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Open an output file for a spectral analysis on rank 0.
+ *
+ * parameters:
+ *   ps     <-- spectral analysis
+ *   prefix <-- file name prefix
+ *
+ * returns:
+ *   pointer to opened file
+ *----------------------------------------------------------------------------*/
+
+static FILE *
+_open_output(const cs_probe_spectra_t  *ps,
+             const char                *prefix)
+{
+  char file_name[256];
+
+  if (ps->f->dim > 1)
+    snprintf(file_name, 255, "monitoring/%s_%s_%s_%d.csv",
+             prefix, ps->pset_name, ps->field_name, ps->comp_id);
+  else
+    snprintf(file_name, 255, "monitoring/%s_%s_%s.csv",
+             prefix, ps->pset_name, ps->field_name);
+  file_name[255] = '\0';
+
+  FILE *fp = fopen(file_name, "w");
+  if (fp == nullptr)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), file_name);
+
+  return fp;
+}
+
+/*----------------------------------------------------------------------------
+ * Write accumulated spectra of a spectral analysis.
+ *
+ * parameters:
+ *   ps <-- spectral analysis
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_spectra(const cs_probe_spectra_t  *ps)
+{
+  if (ps->pset == nullptr || ps->n_segments < 1)
+    return;
+
+  const int n = ps->n_fft;
+  const int n_freq = n/2 + 1;
+
+  /* Sampling frequency and normalization (one-sided spectra) */
+
+  const double dt = (ps->t_last - ps->t_first) / (ps->n_samples - 1);
+  const double fs = (dt > 0.) ? 1./dt : 1.;
+
+  double w2 = 0.;
+  for (int j = 0; j < n; j++) {
+    double w = 0.5*(1. - cos(2.*cs_math_pi*j/n));
+    w2 += w*w;
+  }
+  const double scale = 1. / (ps->n_segments * fs * w2);
+
+  double *psd = _gather_probe_values(ps, n_freq, ps->psd);
+  double *csd = nullptr;
+  if (ps->ref_probe_id > -1)
+    csd = _gather_probe_values(ps, n_freq*2, ps->csd);
+
+  if (cs_glob_rank_id < 1) {
+
+    cs_file_mkdir_default("monitoring");
+
+    FILE *fp = _open_output(ps, "psd");
+
+    fprintf(fp,
+            "# Power spectral density of %s[%d] on probe set %s\n"
+            "# (Welch, %d samples per segment, %d segments)\n"
+            "frequency",
+            ps->field_name, ps->comp_id, ps->pset_name, n, ps->n_segments);
+    for (int i = 0; i < ps->n_probes; i++)
+      fprintf(fp, ", probe_%d", i+1);
+    fprintf(fp, "\n");
+
+    for (int k = 0; k < n_freq; k++) {
+      const double c = (k == 0 || k == n/2) ? scale : 2.*scale;
+      fprintf(fp, "%.8e", k*fs/n);
+      for (int i = 0; i < ps->n_probes; i++)
+        fprintf(fp, ", %.8e", c*psd[i*n_freq + k]);
+      fprintf(fp, "\n");
+    }
+
+    fclose(fp);
+
+    if (csd != nullptr) {
+
+      fp = _open_output(ps, "csd");
+
+      fprintf(fp,
+              "# Cross spectral density of %s[%d] on probe set %s\n"
+              "# relative to probe %d (magnitude, phase, coherence)\n"
+              "frequency",
+              ps->field_name, ps->comp_id, ps->pset_name,
+              ps->ref_probe_id + 1);
+      for (int i = 0; i < ps->n_probes; i++)
+        fprintf(fp, ", mag_%d, phase_%d, coh_%d", i+1, i+1, i+1);
+      fprintf(fp, "\n");
+
+      for (int k = 0; k < n_freq; k++) {
+        const double c = (k == 0 || k == n/2) ? scale : 2.*scale;
+        const double s_rr = c*ps->ref_psd[k];
+        fprintf(fp, "%.8e", k*fs/n);
+        for (int i = 0; i < ps->n_probes; i++) {
+          const double s_re = c*csd[(i*n_freq + k)*2];
+          const double s_im = c*csd[(i*n_freq + k)*2 + 1];
+          const double s_xx = c*psd[i*n_freq + k];
+          const double mag2 = s_re*s_re + s_im*s_im;
+          const double coh = (s_rr*s_xx > 0.) ? mag2/(s_rr*s_xx) : 0.;
+          fprintf(fp, ", %.8e, %.8e, %.8e",
+                  sqrt(mag2), atan2(s_im, s_re), coh);
+        }
+        fprintf(fp, "\n");
+      }
+
+      fclose(fp);
+    }
+
+  }
+
+  BFT_FREE(csd);
+  BFT_FREE(psd);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define an in-situ spectral analysis on a probe set.
+ *
+ * Values of the given field component at the probe set's points are
+ * sampled every \p nt_interval time steps, and power spectral densities
+ * are accumulated using Welch's method (Hann window, 50% overlap of
+ * segments of \p n_fft samples). If \p ref_probe_id is not negative,
+ * cross spectral densities relative to that probe are also accumulated.
+ *
+ * Only the resulting spectra are written, to the "monitoring" directory,
+ * so raw time series need not be output.
+ *
+ * The probe set and field are looked up by name at the first sample, so
+ * they may be defined after this function is called.
+ *
+ * \param[in]  pset_name     name of associated probe set
+ * \param[in]  field_name    name of sampled field
+ * \param[in]  comp_id       sampled field component id
+ * \param[in]  n_fft         number of samples per segment (power of 2)
+ * \param[in]  nt_interval   sampling interval, in time steps
+ * \param[in]  ref_probe_id  id of reference probe for cross spectra, or -1
+ *
+ * \return  id of new spectral analysis definition
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_probe_spectra_define(const char  *pset_name,
+                        const char  *field_name,
+                        int          comp_id,
+                        int          n_fft,
+                        int          nt_interval,
+                        int          ref_probe_id)
+{
+  if (n_fft < 4 || (n_fft & (n_fft - 1)) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: number of samples per segment (%d) must be\n"
+                "a power of 2, at least 4."),
+              __func__, n_fft);
+
+  cs_probe_spectra_t *ps;
+  BFT_MALLOC(ps, 1, cs_probe_spectra_t);
+
+  BFT_MALLOC(ps->pset_name, strlen(pset_name) + 1, char);
+  strcpy(ps->pset_name, pset_name);
+  BFT_MALLOC(ps->field_name, strlen(field_name) + 1, char);
+  strcpy(ps->field_name, field_name);
+
+  ps->comp_id = comp_id;
+  ps->n_fft = n_fft;
+  ps->nt_interval = (nt_interval > 0) ? nt_interval : 1;
+  ps->ref_probe_id = (ref_probe_id > -1) ? ref_probe_id : -1;
+
+  ps->pset = nullptr;
+  ps->f = nullptr;
+  ps->n_probes = 0;
+  ps->n_loc = 0;
+  ps->probe_id = nullptr;
+  ps->ref_loc = -1;
+
+  ps->n_buf = 0;
+  ps->buf = nullptr;
+
+  ps->n_samples = 0;
+  ps->t_first = 0.;
+  ps->t_last = 0.;
+  ps->dt_warned = false;
+
+  ps->n_segments = 0;
+  ps->psd = nullptr;
+  ps->csd = nullptr;
+  ps->ref_psd = nullptr;
+
+  BFT_REALLOC(_spectra, _n_spectra + 1, cs_probe_spectra_t *);
+  _spectra[_n_spectra] = ps;
+  _n_spectra += 1;
+
+  return _n_spectra - 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sample values for all spectral analyses at the current time step.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_sample(void)
+{
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  for (int s_id = 0; s_id < _n_spectra; s_id++) {
+
+    cs_probe_spectra_t *ps = _spectra[s_id];
+
+    if (ts->nt_cur % ps->nt_interval != 0)
+      continue;
+
+    if (ps->pset == nullptr)
+      _init_spectra(ps);
+
+    if (cs_probe_set_get_n_local(ps->pset) != ps->n_loc)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: the number of local probes of probe set \"%s\"\n"
+                  "has changed; spectral analysis requires fixed probes."),
+                __func__, ps->pset_name);
+
+    /* Check sampling uniformity */
+
+    if (ps->n_samples == 0)
+      ps->t_first = ts->t_cur;
+    else if (ps->n_samples > 1 && ps->dt_warned == false) {
+      const double dt_ref = (ps->t_last - ps->t_first) / (ps->n_samples - 1);
+      if (fabs((ts->t_cur - ps->t_last) - dt_ref) > 1e-3*dt_ref) {
+        bft_printf(_("\n Warning: spectral analysis of \"%s\" on probe set"
+                     " \"%s\"\n"
+                     "   uses a non-uniform sampling interval.\n"),
+                   ps->field_name, ps->pset_name);
+        ps->dt_warned = true;
+      }
+    }
+    ps->t_last = ts->t_cur;
+    ps->n_samples += 1;
+
+    /* Sample values */
+
+    const cs_lnum_t *elt_ids
+      = cs_probe_set_get_elt_ids(ps->pset, ps->f->location_id);
+    const cs_real_t *val = ps->f->val;
+    const cs_lnum_t dim = ps->f->dim;
+
+    for (int i = 0; i < ps->n_loc; i++) {
+      const cs_lnum_t e_id = elt_ids[i];
+      ps->buf[i*ps->n_fft + ps->n_buf]
+        = (e_id > -1) ? val[e_id*dim + ps->comp_id] : 0.;
+    }
+
+    ps->n_buf += 1;
+
+    if (ps->n_buf == ps->n_fft)
+      _process_segment(ps);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write accumulated spectra for all spectral analyses.
+ *
+ * Spectra are written to "monitoring/psd_<probe_set>_<field>.csv", and
+ * cross spectra (magnitude, phase and coherence) to
+ * "monitoring/csd_<probe_set>_<field>.csv", with a "_<component>" suffix
+ * added to the field name for multidimensional fields.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_write(void)
+{
+  for (int s_id = 0; s_id < _n_spectra; s_id++)
+    _write_spectra(_spectra[s_id]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write accumulated spectra and free all spectral analyses.
+ *
+ * This function must be called by all ranks, before probe sets are freed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_finalize(void)
+{
+  cs_probe_spectra_write();
+
+  for (int s_id = 0; s_id < _n_spectra; s_id++) {
+    cs_probe_spectra_t *ps = _spectra[s_id];
+    BFT_FREE(ps->pset_name);
+    BFT_FREE(ps->field_name);
+    BFT_FREE(ps->probe_id);
+    BFT_FREE(ps->buf);
+    BFT_FREE(ps->psd);
+    BFT_FREE(ps->csd);
+    BFT_FREE(ps->ref_psd);
+    BFT_FREE(ps);
+  }
+
+  BFT_FREE(_spectra);
+  _n_spectra = 0;
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,121 @@
+#ifndef __CS_PROBE_SPECTRA_H__
+#define __CS_PROBE_SPECTRA_H__
+
+/*============================================================================
+ * In-situ spectral analysis of field values on probe sets.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define an in-situ spectral analysis on a probe set.
+ *
+ * Values of the given field component at the probe set's points are
+ * sampled every \p nt_interval time steps, and power spectral densities
+ * are accumulated using Welch's method (Hann window, 50% overlap of
+ * segments of \p n_fft samples). If \p ref_probe_id is not negative,
+ * cross spectral densities relative to that probe are also accumulated.
+ *
+ * Only the resulting spectra are written, to the "monitoring" directory,
+ * so raw time series need not be output.
+ *
+ * The probe set and field are looked up by name at the first sample, so
+ * they may be defined after this function is called.
+ *
+ * \param[in]  pset_name     name of associated probe set
+ * \param[in]  field_name    name of sampled field
+ * \param[in]  comp_id       sampled field component id
+ * \param[in]  n_fft         number of samples per segment (power of 2)
+ * \param[in]  nt_interval   sampling interval, in time steps
+ * \param[in]  ref_probe_id  id of reference probe for cross spectra, or -1
+ *
+ * \return  id of new spectral analysis definition
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_probe_spectra_define(const char  *pset_name,
+                        const char  *field_name,
+                        int          comp_id,
+                        int          n_fft,
+                        int          nt_interval,
+                        int          ref_probe_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sample values for all spectral analyses at the current time step.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_sample(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write accumulated spectra for all spectral analyses.
+ *
+ * Spectra are written to "monitoring/psd_<probe_set>_<field>.csv", and
+ * cross spectra (magnitude, phase and coherence) to
+ * "monitoring/csd_<probe_set>_<field>.csv", with a "_<component>" suffix
+ * added to the field name for multidimensional fields.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_write(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write accumulated spectra and free all spectral analyses.
+ *
+ * This function must be called by all ranks, before probe sets are freed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_spectra_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_PROBE_SPECTRA_H__ */
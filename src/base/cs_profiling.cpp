@@ -0,0 +1,284 @@
+/*============================================================================
+ * Annotations for external profiling tools.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*----------------------------------------------------------------------------
+ * External library headers
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_NVTX)
+#include <nvtx3/nvToolsExt.h>
+#elif defined(HAVE_ITTNOTIFY)
+#include <ittnotify.h>
+#elif defined(HAVE_CALIPER)
+#include <caliper/cali.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_profiling.h"
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_profiling.cpp
+        Annotations for external profiling tools.
+
+  Annotation ranges allow profiler timelines (such as those of
+  Nsight Systems, VTune, or tools based on Caliper) to show the code
+  structure. The annotation backend is chosen at build time
+  (using NVTX, ITT, or Caliper); with no backend, the associated
+  functions do nothing.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#if defined(HAVE_NVTX) || defined(HAVE_ITTNOTIFY)
+#define _CS_PROFILING_NAME_MAX 128
+#endif
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+#if defined(HAVE_ITTNOTIFY)
+
+static __itt_domain  *_itt_domain = nullptr;
+static uint64_t       _itt_range_count = 0;
+
+#endif
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+#if defined(HAVE_NVTX) || defined(HAVE_ITTNOTIFY)
+
+/*----------------------------------------------------------------------------
+ * Build a range name from a category and name.
+ *
+ * parameters:
+ *   category <-- range category
+ *   name     <-- range name, or NULL
+ *   s        --> range name buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_range_name(const char  *category,
+            const char  *name,
+            char         s[_CS_PROFILING_NAME_MAX])
+{
+  if (name != nullptr)
+    snprintf(s, _CS_PROFILING_NAME_MAX, "%s: %s", category, name);
+  else
+    snprintf(s, _CS_PROFILING_NAME_MAX, "%s", category);
+  s[_CS_PROFILING_NAME_MAX - 1] = '\0';
+}
+
+#endif
+
+#if defined(HAVE_ITTNOTIFY)
+
+/*----------------------------------------------------------------------------
+ * Return ITT domain, creating it if needed.
+ *----------------------------------------------------------------------------*/
+
+static inline __itt_domain *
+_itt_get_domain(void)
+{
+  if (_itt_domain == nullptr)
+    _itt_domain = __itt_domain_create("code_saturne");
+
+  return _itt_domain;
+}
+
+#endif
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open a nested annotation range.
+ *
+ * The range is named "category: name" for NVTX and ITT, while for Caliper,
+ * the name is associated with an attribute named by the category.
+ * Ranges must be closed in reverse order of opening
+ * (using \ref cs_profiling_range_pop).
+ *
+ * \param[in]  category  range category
+ * \param[in]  name      range name, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_profiling_range_push([[maybe_unused]] const char  *category,
+                        [[maybe_unused]] const char  *name)
+{
+#if defined(HAVE_NVTX)
+
+  char s[_CS_PROFILING_NAME_MAX];
+  _range_name(category, name, s);
+  nvtxRangePushA(s);
+
+#elif defined(HAVE_ITTNOTIFY)
+
+  char s[_CS_PROFILING_NAME_MAX];
+  _range_name(category, name, s);
+  __itt_task_begin(_itt_get_domain(), __itt_null, __itt_null,
+                   __itt_string_handle_create(s));
+
+#elif defined(HAVE_CALIPER)
+
+  cali_begin_string_byname(category, (name != nullptr) ? name : category);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close the last opened nested annotation range.
+ *
+ * \param[in]  category  range category (must match that of matching push)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_profiling_range_pop([[maybe_unused]] const char  *category)
+{
+#if defined(HAVE_NVTX)
+
+  nvtxRangePop();
+
+#elif defined(HAVE_ITTNOTIFY)
+
+  __itt_task_end(_itt_get_domain());
+
+#elif defined(HAVE_CALIPER)
+
+  cali_end_byname(category);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open an annotation range which may overlap ranges of
+ *        other categories.
+ *
+ * Ranges of a given category must be nested, but ranges of different
+ * categories may overlap.
+ *
+ * \param[in]  category  range category
+ * \param[in]  name      range name
+ *
+ * \return  id of range, to be passed to \ref cs_profiling_range_end
+ */
+/*----------------------------------------------------------------------------*/
+
+uint64_t
+cs_profiling_range_start([[maybe_unused]] const char  *category,
+                         [[maybe_unused]] const char  *name)
+{
+  uint64_t retval = 0;
+
+#if defined(HAVE_NVTX)
+
+  char s[_CS_PROFILING_NAME_MAX];
+  _range_name(category, name, s);
+  retval = nvtxRangeStartA(s);
+
+#elif defined(HAVE_ITTNOTIFY)
+
+  char s[_CS_PROFILING_NAME_MAX];
+  _range_name(category, name, s);
+  _itt_range_count += 1;
+  retval = _itt_range_count;
+  __itt_task_begin_overlapped(_itt_get_domain(),
+                              __itt_id_make(nullptr, retval),
+                              __itt_null,
+                              __itt_string_handle_create(s));
+
+#elif defined(HAVE_CALIPER)
+
+  cali_begin_string_byname(category, name);
+
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close an annotation range opened with
+ *        \ref cs_profiling_range_start.
+ *
+ * \param[in]  category  range category
+ * \param[in]  id        id of range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_profiling_range_end([[maybe_unused]] const char  *category,
+                       [[maybe_unused]] uint64_t     id)
+{
+#if defined(HAVE_NVTX)
+
+  nvtxRangeEnd(id);
+
+#elif defined(HAVE_ITTNOTIFY)
+
+  __itt_task_end_overlapped(_itt_get_domain(), __itt_id_make(nullptr, id));
+
+#elif defined(HAVE_CALIPER)
+
+  cali_end_byname(category);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
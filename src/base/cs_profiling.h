@@ -0,0 +1,110 @@
+#ifndef __CS_PROFILING_H__
+#define __CS_PROFILING_H__
+
+/*============================================================================
+ * Annotations for external profiling tools.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open a nested annotation range.
+ *
+ * The range is named "category: name" for NVTX and ITT, while for Caliper,
+ * the name is associated with an attribute named by the category.
+ * Ranges must be closed in reverse order of opening
+ * (using \ref cs_profiling_range_pop).
+ *
+ * \param[in]  category  range category
+ * \param[in]  name      range name, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_profiling_range_push(const char  *category,
+                        const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close the last opened nested annotation range.
+ *
+ * \param[in]  category  range category (must match that of matching push)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_profiling_range_pop(const char  *category);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open an annotation range which may overlap ranges of
+ *        other categories.
+ *
+ * Ranges of a given category must be nested, but ranges of different
+ * categories may overlap.
+ *
+ * \param[in]  category  range category
+ * \param[in]  name      range name
+ *
+ * \return  id of range, to be passed to \ref cs_profiling_range_end
+ */
+/*----------------------------------------------------------------------------*/
+
+uint64_t
+cs_profiling_range_start(const char  *category,
+                         const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close an annotation range opened with
+ *        \ref cs_profiling_range_start.
+ *
+ * \param[in]  category  range category
+ * \param[in]  id        id of range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_profiling_range_end(const char  *category,
+                       uint64_t     id);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_PROFILING_H__ */
@@ -60,6 +60,11 @@ BEGIN_C_DECLS
   Based on the uniform, gaussian, and poisson random number generation code
   from netlib.org: lagged (-273,-607) Fibonacci; Box-Muller;
   by W.P. Petersen, IPS, ETH Zuerich.
+
+  Counter-based generation (Philox4x32-10, Salmon et al., SC'11) is also
+  provided. As values depend only on a (stream, position) pair, they may
+  be computed in parallel, independently of the number of threads, and
+  in device kernels.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -90,6 +95,10 @@ static struct {
   double   e_3;
 } klotz1_1 = {{0}, 0, 0, 0.};
 
+/* Key for counter-based generator */
+
+static uint64_t _counter_key = 0x5A17u;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -199,8 +208,10 @@ cs_random_seed(int  seed)
   klotz0_1.buff = (double *)(klotz0_1.fill_1);
 
   /* Seed should be > 0 and < 31328 */
-  if (seed > 0)
+  if (seed > 0) {
     ij = seed % 31328;
+    _counter_key = (uint64_t)seed;
+  }
 
   int i = ij / 177 % 177 + 2;
   int j = ij % 177 + 2;
@@ -585,6 +596,107 @@ cs_random_restore(cs_real_t  save_block[1634])
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the key used by counter-based random number generation.
+ *
+ * This allows calling \ref cs_random_counter_normal2 or
+ * \ref cs_random_counter_uniform2 directly in computational kernels.
+ *
+ * \return  generator key
+ */
+/*----------------------------------------------------------------------------*/
+
+uint64_t
+cs_random_counter_key(void)
+{
+  return _counter_key;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Value i is the (offset + i)-th value of the given stream, independently
+ * of the number of threads or of previous calls.
+ *
+ * \param[in]   stream  stream id
+ * \param[in]   offset  position of first value in stream
+ * \param[in]   n       number of values to compute
+ * \param[out]  a       pseudo-random numbers following uniform distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(uint64_t   stream,
+                          uint64_t   offset,
+                          cs_lnum_t  n,
+                          cs_real_t  a[])
+{
+  if (n <= 0)
+    return;
+
+  /* Each block provides 2 values */
+
+  const uint64_t key = _counter_key;
+  const uint64_t b_s = offset / 2;
+  const cs_lnum_t n_blocks = (cs_lnum_t)((offset + n - 1)/2 - b_s + 1);
+
+# pragma omp parallel for simd if (n_blocks > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    cs_real_t u[2];
+    uint64_t b = b_s + b_id;
+    cs_random_counter_uniform2(key, stream, b, u);
+    for (int j = 0; j < 2; j++) {
+      int64_t i = (int64_t)(2*b + j - offset);
+      if (i >= 0 && i < n)
+        a[i] = u[j];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Value i is the (offset + i)-th value of the given stream, independently
+ * of the number of threads or of previous calls.
+ *
+ * \param[in]   stream  stream id
+ * \param[in]   offset  position of first value in stream
+ * \param[in]   n       number of values to compute
+ * \param[out]  x       pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_normal(uint64_t   stream,
+                         uint64_t   offset,
+                         cs_lnum_t  n,
+                         cs_real_t  x[])
+{
+  if (n <= 0)
+    return;
+
+  /* Each block provides 2 values */
+
+  const uint64_t key = _counter_key;
+  const uint64_t b_s = offset / 2;
+  const cs_lnum_t n_blocks = (cs_lnum_t)((offset + n - 1)/2 - b_s + 1);
+
+# pragma omp parallel for simd if (n_blocks > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    cs_real_t v[2];
+    uint64_t b = b_s + b_id;
+    cs_random_counter_normal2(key, stream, b, v);
+    for (int j = 0; j < 2; j++) {
+      int64_t i = (int64_t)(2*b + j - offset);
+      if (i >= 0 && i < n)
+        x[i] = v[j];
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
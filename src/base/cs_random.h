@@ -37,6 +37,12 @@
 
 #include "cs_defs.h"
 
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <math.h>
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -53,6 +59,106 @@ BEGIN_C_DECLS
  * Global variables
  *============================================================================*/
 
+/*=============================================================================
+ * Inline public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox4x32-10 counter-based random number generator block function.
+ *
+ * Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11.
+ *
+ * \param[in, out]  ctr  counter in, pseudo-random bits out
+ * \param[in]       key  generator key
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline void
+cs_random_philox4x32(uint32_t        ctr[4],
+                     const uint32_t  key[2])
+{
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for (int r = 0; r < 10; r++) {
+    uint64_t p0 = (uint64_t)0xD2511F53u * ctr[0];
+    uint64_t p1 = (uint64_t)0xCD9E8D57u * ctr[2];
+    uint32_t c0 = (uint32_t)(p1 >> 32) ^ ctr[1] ^ k0;
+    uint32_t c2 = (uint32_t)(p0 >> 32) ^ ctr[3] ^ k1;
+    ctr[0] = c0;
+    ctr[1] = (uint32_t)p1;
+    ctr[2] = c2;
+    ctr[3] = (uint32_t)p0;
+    k0 += 0x9E3779B9u;
+    k1 += 0xBB67AE85u;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute 2 uniformly distributed values in [0, 1) based on
+ *        a counter-based generator.
+ *
+ * Values depend only on the key, stream, and block number, so they may be
+ * computed in any order, on any thread, rank, or device.
+ *
+ * \param[in]   key     generator key (seed)
+ * \param[in]   stream  stream id
+ * \param[in]   block   block number in stream
+ * \param[out]  u       pseudo-random values
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline void
+cs_random_counter_uniform2(uint64_t   key,
+                           uint64_t   stream,
+                           uint64_t   block,
+                           cs_real_t  u[2])
+{
+  const uint32_t k[2] = {(uint32_t)key, (uint32_t)(key >> 32)};
+  uint32_t c[4] = {(uint32_t)block, (uint32_t)(block >> 32),
+                   (uint32_t)stream, (uint32_t)(stream >> 32)};
+
+  cs_random_philox4x32(c, k);
+
+  /* 53-bit mantissa from 2 x 32 bits */
+
+  const double scale = 1.0 / 9007199254740992.0;
+  u[0] = ((c[0] >> 5) * 67108864.0 + (c[1] >> 6)) * scale;
+  u[1] = ((c[2] >> 5) * 67108864.0 + (c[3] >> 6)) * scale;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute 2 normally distributed values based on a counter-based
+ *        generator (Box-Muller method).
+ *
+ * Values depend only on the key, stream, and block number, so they may be
+ * computed in any order, on any thread, rank, or device.
+ *
+ * \param[in]   key     generator key (seed)
+ * \param[in]   stream  stream id
+ * \param[in]   block   block number in stream
+ * \param[out]  x       pseudo-random values
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline void
+cs_random_counter_normal2(uint64_t   key,
+                          uint64_t   stream,
+                          uint64_t   block,
+                          cs_real_t  x[2])
+{
+  cs_real_t u[2];
+  cs_random_counter_uniform2(key, stream, block, u);
+
+  const double r = sqrt(-2.0 * log(1.0 - u[0]));  /* 1 - u in (0, 1] */
+  const double theta = 6.283185307179586 * u[1];
+
+  x[0] = r * cos(theta);
+  x[1] = r * sin(theta);
+}
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -142,6 +248,60 @@ cs_random_save(cs_real_t  save_block[1634]);
 void
 cs_random_restore(cs_real_t  save_block[1634]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the key used by counter-based random number generation.
+ *
+ * This allows calling \ref cs_random_counter_normal2 or
+ * \ref cs_random_counter_uniform2 directly in computational kernels.
+ *
+ * \return  generator key
+ */
+/*----------------------------------------------------------------------------*/
+
+uint64_t
+cs_random_counter_key(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Value i is the (offset + i)-th value of the given stream, independently
+ * of the number of threads or of previous calls.
+ *
+ * \param[in]   stream  stream id
+ * \param[in]   offset  position of first value in stream
+ * \param[in]   n       number of values to compute
+ * \param[out]  a       pseudo-random numbers following uniform distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(uint64_t   stream,
+                          uint64_t   offset,
+                          cs_lnum_t  n,
+                          cs_real_t  a[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Value i is the (offset + i)-th value of the given stream, independently
+ * of the number of threads or of previous calls.
+ *
+ * \param[in]   stream  stream id
+ * \param[in]   offset  position of first value in stream
+ * \param[in]   n       number of values to compute
+ * \param[out]  x       pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_normal(uint64_t   stream,
+                         uint64_t   offset,
+                         cs_lnum_t  n,
+                         cs_real_t  x[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -90,15 +90,18 @@ extern "C" {
 #include "fvm_hilbert.h"
 
 #include "cs_array.h"
+#include "cs_array_primitives.h"
 #include "cs_defs.h"
 #include "cs_halo.h"
 #include "cs_join.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_post.h"
 #include "cs_sort.h"
+#include "cs_timer.h"
 #include "cs_prototypes.h"
 
 /*----------------------------------------------------------------------------
@@ -155,6 +158,11 @@ BEGIN_C_DECLS
   \var CS_RENUMBER_I_FACES_SIMD
        Renumber to allow SIMD operations in interior face->cell gather
        operations (such as SpMV products with native matrix representation).
+  \var CS_RENUMBER_I_FACES_COLOR
+       Balanced conflict-free colors, with no cell shared by faces of
+       a same color. This allows device kernels to run scatter sums
+       without atomics (one kernel per color), and may also be used
+       with host threads.
   \var CS_RENUMBER_I_FACES_NONE
        No interior face renumbering.
 
@@ -182,6 +190,19 @@ BEGIN_C_DECLS
   \var CS_RENUMBER_VERTICES_NONE
        No vertex renumbering.
 
+  \enum cs_renumber_ghost_cells_type_t
+
+  \brief Ghost cells ordering types (inside each halo section)
+
+  \var CS_RENUMBER_GHOST_CELLS_ADJACENT
+       Order by lowest adjacent local cell id, so that face loops access
+       ghost values in a streaming manner.
+  \var CS_RENUMBER_GHOST_CELLS_SEND_ORDER
+       Order by cell id on the distant rank, so that halo send lists are
+       increasing and packing halo values is a streaming gather.
+  \var CS_RENUMBER_GHOST_CELLS_NONE
+       No ghost cells renumbering.
+
   \enum cs_renumber_ordering_t
 
   \brief Ordering options for adjacency arrays
@@ -218,7 +239,8 @@ static int _cs_renumber_n_threads = 0;
 static cs_lnum_t  _min_i_subset_size = 256;
 static cs_lnum_t  _min_b_subset_size = 256;
 
-static bool _renumber_ghost_cells = true;
+static cs_renumber_ghost_cells_type_t _ghost_cells_algorithm
+  = CS_RENUMBER_GHOST_CELLS_ADJACENT;
 static bool _cells_adjacent_to_halo_last = false;
 static bool _i_faces_adjacent_to_halo_last = false;
 static cs_renumber_ordering_t _i_faces_base_ordering = CS_RENUMBER_ADJACENT_LOW;
@@ -246,6 +268,10 @@ static cs_renumber_b_faces_type_t _b_faces_algorithm
 static cs_renumber_vertices_type_t _vertices_algorithm
   = CS_RENUMBER_VERTICES_NONE;
 
+/* Number of kernel iterations for numbering auto-selection (0: off) */
+
+static int _tune_n_iter = 0;
+
 static const char *_cell_renum_name[]
   = {N_("sub-partitioning with LibScotch"),
      N_("fill-reducing ordering with LibScotch"),
@@ -260,6 +286,7 @@ static const char *_i_face_renum_name[]
   = {N_("coloring, no shared cell in block"),
      N_("multipass"),
      N_("vectorizing"),
+     N_("balanced conflict-free colors"),
      N_("adjacent cells")};
 
 static const char *_b_face_renum_name[]
@@ -276,6 +303,35 @@ static const char *_vertices_renum_name[]
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Order elements by unique global number, using a parallel radix sort.
+ *
+ * As global numbers are unique, the result is the same as that of
+ * cs_order_gnum.
+ *
+ * parameters:
+ *   gnum   <--  global element numbers
+ *   n_elts <--  number of elements
+ *
+ * returns:
+ *   pointer to allocated ordering array
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t *
+_order_unique_gnum(const cs_gnum_t  gnum[],
+                   cs_lnum_t        n_elts)
+{
+  cs_lnum_t *order;
+  BFT_MALLOC(order, n_elts, cs_lnum_t);
+
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+
+  cs_array_sort_by_key(ctx, n_elts, gnum, order);
+
+  return order;
+}
+
 /*----------------------------------------------------------------------------
  * Redistribute family (group class) ids in case of renubering
  *
@@ -379,7 +435,14 @@ _update_global_num(size_t             n_elts,
  *
  * Reordering keeps cells in a section based halo class (separated based on
  * domain first, transform id second), but reorders cells within a section
- * based on their adjacency.
+ * based on their adjacency and on their id on the distant rank.
+ *
+ * With CS_RENUMBER_GHOST_CELLS_ADJACENT ordering, ghost cells are ordered
+ * by their lowest adjacent local cell id, so that ghost values are accessed
+ * in a streaming manner by face loops; the distant id is only used to
+ * break ties. With CS_RENUMBER_GHOST_CELLS_SEND_ORDER ordering, ghost cells
+ * are ordered by their id on the distant rank, so that the matching send
+ * lists are increasing, and packing halo data becomes a streaming gather.
  *
  * parameters:
  *   mesh       <-> pointer to mesh structure
@@ -405,50 +468,57 @@ _reorder_halo_cells(const cs_mesh_t  *mesh,
 
   assert(mesh->n_ghost_cells == mesh->halo->n_elts[1]);
 
-  BFT_MALLOC(keys, mesh->n_ghost_cells*2, cs_lnum_t);
+  /* Key positions for adjacency and distant id, based on ordering type */
+
+  const int a_k
+    = (_ghost_cells_algorithm == CS_RENUMBER_GHOST_CELLS_ADJACENT) ? 1 : 2;
+  const int d_k = 3 - a_k;
+
+  BFT_MALLOC(keys, mesh->n_ghost_cells*3, cs_lnum_t);
 
   for (int i = 0; i < n_c_domains; i++) {
 
-    for (cs_lnum_t j = index[2*i]; j < index[2*i+1]; j++) {
-      keys[j*2] = i*stride;
-      keys[j*2 + 1] = -1;
-    }
+    for (cs_lnum_t j = index[2*i]; j < index[2*i+1]; j++)
+      keys[j*3] = i*stride;
 
     for (int t_id = 0; t_id < n_transforms; t_id++) {
       int shift = 4 * n_c_domains * t_id;
       cs_lnum_t s = perio_lst[shift + 4*i];
       cs_lnum_t e = s + perio_lst[shift + 4*i + 1];
       for (cs_lnum_t j = s; j < e; j++)
-        keys[j*2] = i*stride + t_id + 1;
+        keys[j*3] = i*stride + t_id + 1;
     }
 
-    for (cs_lnum_t j = index[2*i+1]; j < index[2*i+2]; j++) {
-      keys[j*2] = i*stride + n_transforms + 1;
-      keys[j*2 + 1] = -1;
-    }
+    for (cs_lnum_t j = index[2*i+1]; j < index[2*i+2]; j++)
+      keys[j*3] = i*stride + n_transforms + 1;
 
     for (int t_id = 0; t_id < n_transforms; t_id++) {
       int shift = 4 * n_c_domains * t_id;
       cs_lnum_t s = perio_lst[shift + 4*i + 2];
       cs_lnum_t e = s + perio_lst[shift + 4*i + 3];
       for (cs_lnum_t j = s; j < e; j++)
-        keys[j*2] = i*stride + n_transforms + t_id + 2;
+        keys[j*3] = i*stride + n_transforms + t_id + 2;
     }
 
   } /* End of loop on involved ranks */
 
-  /* Order standard halo by adjacency */
+  for (cs_lnum_t j = 0; j < mesh->n_ghost_cells; j++)
+    keys[j*3 + a_k] = -1;
+
+  /* Order standard halo by adjacency (lowest adjacent cell id) */
 
   for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
     cs_lnum_t gc_id_0 = mesh->i_face_cells[f_id][0] - n_cells;
     cs_lnum_t gc_id_1 = mesh->i_face_cells[f_id][1] - n_cells;
     if (gc_id_0 > -1) {
-      if (keys[gc_id_0*2 + 1] < 0)
-        keys[gc_id_0*2 + 1] = old_to_new[mesh->i_face_cells[f_id][1]];
+      cs_lnum_t c_id = old_to_new[mesh->i_face_cells[f_id][1]];
+      if (keys[gc_id_0*3 + a_k] < 0 || c_id < keys[gc_id_0*3 + a_k])
+        keys[gc_id_0*3 + a_k] = c_id;
     }
     if (gc_id_1 > -1) {
-      if (keys[gc_id_1*2 + 1] < 0)
-        keys[gc_id_1*2 + 1] = old_to_new[mesh->i_face_cells[f_id][0]];
+      cs_lnum_t c_id = old_to_new[mesh->i_face_cells[f_id][0]];
+      if (keys[gc_id_1*3 + a_k] < 0 || c_id < keys[gc_id_1*3 + a_k])
+        keys[gc_id_1*3 + a_k] = c_id;
     }
   }
 
@@ -456,13 +526,14 @@ _reorder_halo_cells(const cs_mesh_t  *mesh,
 
   if (mesh->cell_cells_lst != nullptr) {
     for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      cs_lnum_t c_id = old_to_new[ii];
       for (cs_lnum_t kk = mesh->cell_cells_idx[ii];
-           kk < mesh->cell_cells_idx[ii];
+           kk < mesh->cell_cells_idx[ii+1];
            kk++) {
         cs_lnum_t gc_id = mesh->cell_cells_lst[kk] - n_cells;
         if (gc_id > -1) {
-          if (keys[gc_id*2 + 1] < 0)
-            keys[gc_id*2 + 1] = old_to_new[ii];
+          if (keys[gc_id*3 + a_k] < 0 || c_id < keys[gc_id*3 + a_k])
+            keys[gc_id*3 + a_k] = c_id;
         }
       }
     }
@@ -471,17 +542,33 @@ _reorder_halo_cells(const cs_mesh_t  *mesh,
   /* Ensure all keys are initialized */
 
   for (cs_lnum_t j = 0; j < mesh->n_ghost_cells; j++) {
-    if (keys[j*2 + 1] < 0)
-      keys[j*2 + 1] = j;
+    if (keys[j*3 + a_k] < 0)
+      keys[j*3 + a_k] = j;
+  }
+
+  /* Ids of matching cells on distant ranks (the halo send lists
+     are already updated to the new local numbering) */
+
+  {
+    cs_lnum_t *d_id;
+    BFT_MALLOC(d_id, mesh->n_cells_with_ghosts, cs_lnum_t);
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      d_id[c_id] = c_id;
+
+    cs_halo_sync(mesh->halo, mesh->halo_type, CS_LNUM_TYPE, 1, d_id);
+
+    for (cs_lnum_t j = 0; j < mesh->n_ghost_cells; j++)
+      keys[j*3 + d_k] = d_id[n_cells + j];
+
+    BFT_FREE(d_id);
   }
 
   cs_order_lnum_allocated_s(nullptr,
                             keys,
-                            2,
+                            3,
                             new_to_old + n_cells,
                             mesh->n_ghost_cells);
 
-
   BFT_FREE(keys);
 
   for (cs_lnum_t j = 0; j < mesh->n_ghost_cells; j++) {
@@ -538,7 +625,8 @@ _cs_renumber_update_cells(cs_mesh_t  *mesh,
 
   /* Try to optimize ghost cells, based on adjacency */
 
-  if (_renumber_ghost_cells && mesh->halo != nullptr) {
+  if (   _ghost_cells_algorithm != CS_RENUMBER_GHOST_CELLS_NONE
+      && mesh->halo != nullptr) {
     _reorder_halo_cells(mesh, new_cell_id, new_to_old);
     cs_halo_renumber_ghost_cells(mesh->halo, new_to_old);
   }
@@ -2681,6 +2769,133 @@ _renum_b_faces_no_share_cell_across_thread(cs_mesh_t   *mesh,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute renumbering of interior faces by conflict-free colors.
+ *
+ * Faces are colored so that no two faces of a same color share an adjacent
+ * cell (including ghost cells). Each face is assigned the least-used
+ * compatible color, which balances color sizes. Faces are then ordered
+ * by color, keeping their previous relative order inside a color for
+ * locality, and each color is split evenly between threads.
+ *
+ * Each color may thus be processed without atomic operations either by
+ * host threads or by one device thread per face.
+ *
+ * parameters:
+ *   mesh          <-> pointer to global mesh structure
+ *   n_i_threads   <-- number of threads required for interior faces
+ *   new_to_old_i  --> interior faces renumbering array
+ *   n_i_groups    --> number of groups (colors) of interior faces
+ *   i_group_index --> group/thread index
+ *
+ * returns:
+ *   0 on success, -1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_renum_i_faces_colors(cs_mesh_t   *mesh,
+                      int          n_i_threads,
+                      cs_lnum_t    new_to_old_i[],
+                      int         *n_i_groups,
+                      cs_lnum_t  **i_group_index)
+{
+  const int max_colors = 64;
+
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
+
+  *n_i_groups = 0;
+  *i_group_index = nullptr;
+
+  if (n_i_faces < 1)
+    return -1;
+
+  /* Greedy coloring, using bit masks of colors used by adjacent faces */
+
+  uint64_t *c_mask;
+  BFT_MALLOC(c_mask, n_cells_ext, uint64_t);
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    c_mask[c_id] = 0;
+
+  int *f_color;
+  BFT_MALLOC(f_color, n_i_faces, int);
+
+  cs_lnum_t color_size[64];
+  for (int i = 0; i < max_colors; i++)
+    color_size[i] = 0;
+
+  int n_colors = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    cs_lnum_t c_id0 = i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = i_face_cells[f_id][1];
+    uint64_t used = c_mask[c_id0] | c_mask[c_id1];
+
+    int color = -1;
+    for (int i = 0; i < n_colors; i++) {
+      if ((used & ((uint64_t)1 << i)) == 0) {
+        if (color < 0 || color_size[i] < color_size[color])
+          color = i;
+      }
+    }
+
+    if (color < 0) {
+      if (n_colors >= max_colors) {
+        BFT_FREE(f_color);
+        BFT_FREE(c_mask);
+        return -1;
+      }
+      color = n_colors++;
+    }
+
+    f_color[f_id] = color;
+    color_size[color] += 1;
+    c_mask[c_id0] |= ((uint64_t)1 << color);
+    c_mask[c_id1] |= ((uint64_t)1 << color);
+
+  }
+
+  BFT_FREE(c_mask);
+
+  /* Order faces by color */
+
+  cs_lnum_t color_index[65];
+  color_index[0] = 0;
+  for (int i = 0; i < n_colors; i++)
+    color_index[i+1] = color_index[i] + color_size[i];
+
+  for (int i = 0; i < n_colors; i++)
+    color_size[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    int color = f_color[f_id];
+    new_to_old_i[color_index[color] + color_size[color]] = f_id;
+    color_size[color] += 1;
+  }
+
+  BFT_FREE(f_color);
+
+  /* Split each color evenly between threads */
+
+  BFT_MALLOC(*i_group_index, n_i_threads*n_colors*2, cs_lnum_t);
+
+  for (int g_id = 0; g_id < n_colors; g_id++) {
+    cs_lnum_t n_g_faces = color_index[g_id+1] - color_index[g_id];
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      cs_lnum_t s_id = color_index[g_id] + (n_g_faces*t_id) / n_i_threads;
+      cs_lnum_t e_id = color_index[g_id] + (n_g_faces*(t_id+1)) / n_i_threads;
+      (*i_group_index)[(t_id*n_colors + g_id)*2] = s_id;
+      (*i_group_index)[(t_id*n_colors + g_id)*2 + 1] = e_id;
+    }
+  }
+
+  *n_i_groups = n_colors;
+
+  return 0;
+}
+
 /*----------------------------------------------------------------------------
  * Compute renumbering of interior faces for vectorizing.
  *
@@ -5002,6 +5217,16 @@ _renumber_i_faces(cs_mesh_t  *mesh)
                                    &i_group_index);
     break;
 
+  case CS_RENUMBER_I_FACES_COLOR:
+    numbering_type = CS_NUMBERING_THREADS;
+    _renumber_i_faces_by_cell_adjacency(mesh);
+    retval = _renum_i_faces_colors(mesh,
+                                   n_i_threads,
+                                   new_to_old_i,
+                                   &n_i_groups,
+                                   &i_group_index);
+    break;
+
   case CS_RENUMBER_I_FACES_SIMD:
     numbering_type = CS_NUMBERING_VECTORIZE;
     _renumber_i_faces_by_cell_adjacency(mesh);
@@ -5038,7 +5263,9 @@ _renumber_i_faces(cs_mesh_t  *mesh)
                                                           n_i_groups,
                                                           i_group_index);
     mesh->i_face_numbering->n_no_adj_halo_groups = n_i_no_adj_halo_groups;
-    if (n_i_threads == 1)
+    if (_i_faces_algorithm == CS_RENUMBER_I_FACES_COLOR && retval == 0)
+      mesh->i_face_numbering->colored = true;
+    else if (n_i_threads == 1)
       mesh->i_face_numbering->type = CS_NUMBERING_DEFAULT;
   }
   else if (numbering_type == CS_NUMBERING_VECTORIZE && retval == 0) {
@@ -5564,6 +5791,242 @@ _renumber_b_test(cs_mesh_t  *mesh)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Time representative interior face kernels with the current numbering.
+ *
+ * Kernels are a native matrix-vector product, a gradient-like face
+ * gather/scatter of 3-vectors, and an upwind convection face loop,
+ * all using the interior faces numbering for thread safety.
+ *
+ * parameters:
+ *   mesh   <-- pointer to mesh structure
+ *   n_iter <-- number of kernel calls
+ *
+ * returns:
+ *   elapsed time (maximum over ranks)
+ *----------------------------------------------------------------------------*/
+
+static double
+_time_face_kernels(const cs_mesh_t  *mesh,
+                   int               n_iter)
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells = mesh->i_face_cells;
+
+  const int n_i_groups = mesh->i_face_numbering->n_groups;
+  const int n_i_threads = mesh->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index
+    = mesh->i_face_numbering->group_index;
+
+  cs_real_t *x, *y, *xa, *i_massflux, *wf;
+  cs_real_3_t *grad;
+
+  BFT_MALLOC(x, n_cells_ext, cs_real_t);
+  BFT_MALLOC(y, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(xa, n_i_faces, cs_real_t);
+  BFT_MALLOC(i_massflux, n_i_faces, cs_real_t);
+  BFT_MALLOC(wf, n_i_faces*3, cs_real_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    x[c_id] = 1. + (c_id%7)*0.1;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    xa[f_id] = -0.1;
+    i_massflux[f_id] = (f_id%3) - 1.;
+    for (cs_lnum_t k = 0; k < 3; k++)
+      wf[f_id*3 + k] = 0.5*(k+1);
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  double t0 = cs_timer_wtime();
+
+  for (int iter = 0; iter < n_iter; iter++) {
+
+    /* Matrix-vector product (native storage) */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+      y[c_id] = 4.*x[c_id];
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
+          cs_lnum_t ii = i_face_cells[f_id][0];
+          cs_lnum_t jj = i_face_cells[f_id][1];
+          y[ii] += xa[f_id] * x[jj];
+          y[jj] += xa[f_id] * x[ii];
+        }
+      }
+    }
+
+    /* Gradient-like face loop */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+      for (cs_lnum_t k = 0; k < 3; k++)
+        grad[c_id][k] = 0.;
+    }
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
+          cs_lnum_t ii = i_face_cells[f_id][0];
+          cs_lnum_t jj = i_face_cells[f_id][1];
+          cs_real_t pfac = 0.5*(y[ii] + y[jj]);
+          for (cs_lnum_t k = 0; k < 3; k++) {
+            grad[ii][k] += pfac*wf[f_id*3 + k];
+            grad[jj][k] -= pfac*wf[f_id*3 + k];
+          }
+        }
+      }
+    }
+
+    /* Upwind convection face loop */
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             f_id++) {
+          cs_lnum_t ii = i_face_cells[f_id][0];
+          cs_lnum_t jj = i_face_cells[f_id][1];
+          cs_real_t flux =   cs_math_fmax(i_massflux[f_id], 0.)*grad[ii][0]
+                           + cs_math_fmin(i_massflux[f_id], 0.)*grad[jj][0];
+          x[ii] -= 1e-6*flux;
+          x[jj] += 1e-6*flux;
+        }
+      }
+    }
+
+  }
+
+  double t1 = cs_timer_wtime();
+  double elapsed = t1 - t0;
+
+  cs_parall_max(1, CS_DOUBLE, &elapsed);
+
+  BFT_FREE(wf);
+  BFT_FREE(i_massflux);
+  BFT_FREE(xa);
+  BFT_FREE(grad);
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  return elapsed;
+}
+
+/*----------------------------------------------------------------------------
+ * Select cells and interior faces numbering by timing representative
+ * kernels for each candidate combination, then apply the fastest one.
+ *
+ * Renumbering is applied to the current (already renumbered) mesh for
+ * each candidate, which is equivalent for geometric (space-filling curve)
+ * orderings, and close enough for graph-based orderings.
+ *
+ * parameters:
+ *   mesh <-> pointer to global mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_renumber_tune(cs_mesh_t  *mesh)
+{
+  const cs_renumber_cells_type_t c_candidates[]
+    = {CS_RENUMBER_CELLS_MORTON,
+       CS_RENUMBER_CELLS_HILBERT,
+       CS_RENUMBER_CELLS_RCM,
+#if defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+       CS_RENUMBER_CELLS_SCOTCH_ORDER,
+#endif
+#if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
+       CS_RENUMBER_CELLS_METIS_ORDER,
+#endif
+    };
+
+  const cs_renumber_i_faces_type_t f_candidates[]
+    = {CS_RENUMBER_I_FACES_MULTIPASS,
+       CS_RENUMBER_I_FACES_BLOCK,
+       CS_RENUMBER_I_FACES_COLOR,
+       CS_RENUMBER_I_FACES_SIMD,
+       CS_RENUMBER_I_FACES_NONE};
+
+  const int n_c_candidates = sizeof(c_candidates) / sizeof(c_candidates[0]);
+
+  /* Threaded face numberings are only useful with multiple threads */
+
+  int f_start = (_cs_renumber_n_threads > 1) ? 0 : 3;
+
+  int mv_save = mesh->verbosity;
+  mesh->verbosity = 0;
+
+  double t_best = -1;
+  cs_renumber_cells_type_t c_best = _cells_algorithm[1];
+  cs_renumber_i_faces_type_t f_best = _i_faces_algorithm;
+
+  bft_printf(_("\n   numbering auto-selection (%d kernel iterations):\n\n"),
+             _tune_n_iter);
+
+  for (int i = 0; i < n_c_candidates; i++) {
+
+    _cells_algorithm[1] = c_candidates[i];
+    _renumber_cells(mesh);
+
+    for (int j = f_start; j < 5; j++) {
+
+      _i_faces_algorithm = f_candidates[j];
+      if (mesh->i_face_numbering != nullptr)
+        cs_numbering_destroy(&(mesh->i_face_numbering));
+      _renumber_i_faces(mesh);
+
+      double t = _time_face_kernels(mesh, _tune_n_iter);
+
+      bft_printf(_("     %-38s %-34s %12.5g s\n"),
+                 _(_cell_renum_name[c_candidates[i]]),
+                 _(_i_face_renum_name[f_candidates[j]]),
+                 t);
+
+      if (t < t_best || t_best < 0) {
+        t_best = t;
+        c_best = c_candidates[i];
+        f_best = f_candidates[j];
+      }
+
+    }
+
+  }
+
+  mesh->verbosity = mv_save;
+
+  /* Apply selected numbering */
+
+  _cells_algorithm[1] = c_best;
+  _i_faces_algorithm = f_best;
+
+  bft_printf(_("\n   selected numbering:\n"
+               "     cells:                               %s\n"
+               "     interior faces:                      %s\n"),
+             _(_cell_renum_name[c_best]),
+             _(_i_face_renum_name[f_best]));
+
+  _renumber_cells(mesh);
+  if (mesh->i_face_numbering != nullptr)
+    cs_numbering_destroy(&(mesh->i_face_numbering));
+  _renumber_i_faces(mesh);
+}
+
 /*----------------------------------------------------------------------------
  * Renumber mesh elements for vectorization or OpenMP depending on code
  * options and target machine.
@@ -5591,6 +6054,9 @@ _renumber_mesh(cs_mesh_t  *mesh)
       return;
     }
 
+    if (strcmp(p, "tune") == 0 && _tune_n_iter < 1)
+      _tune_n_iter = 10;
+
 #if defined(HAVE_IBM_RENUMBERING_LIB)
     if (strcmp(p, "IBM") == 0) {
       bft_printf("\n Use IBM Mesh renumbering.\n\n");
@@ -5673,13 +6139,17 @@ _renumber_mesh(cs_mesh_t  *mesh)
 
   }
 
-  /* Renumber cells first */
+  /* Renumber cells first, then faces (possibly selecting
+     the fastest combination) */
 
-  _renumber_cells(mesh);
+  if (_tune_n_iter > 0)
+    _renumber_tune(mesh);
 
-  /* Renumber faces afterwards */
+  else {
+    _renumber_cells(mesh);
+    _renumber_i_faces(mesh);
+  }
 
-  _renumber_i_faces(mesh);
   _renumber_b_faces(mesh);
 
   /* Renumber vertices afterwards */
@@ -5871,6 +6341,61 @@ cs_renumber_get_algorithm(bool                        *halo_adjacent_cells_last,
     *vertices_numbering = _vertices_algorithm;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the ordering of ghost cells inside each halo section.
+ *
+ * Ghost cells remain grouped by distant rank and periodic transform,
+ * and the send lists of matching ranks are updated accordingly.
+ *
+ * \param[in]  ordering  ghost cells ordering type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_ghost_cells_ordering(cs_renumber_ghost_cells_type_t  ordering)
+{
+  _ghost_cells_algorithm = ordering;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the ordering of ghost cells inside each halo section.
+ *
+ * \return  ghost cells ordering type
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_renumber_ghost_cells_type_t
+cs_renumber_get_ghost_cells_ordering(void)
+{
+  return _ghost_cells_algorithm;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate automatic selection of cells and interior
+ *        faces numbering.
+ *
+ * When active, each available cells numbering is combined with each
+ * relevant interior faces numbering, representative face-based kernels
+ * (matrix-vector product, gradient and convection face loops) are timed
+ * with each combination, and the fastest one is selected and logged.
+ *
+ * This may also be activated by setting the CS_RENUMBER environment
+ * variable to "tune" (using 10 iterations).
+ *
+ * \param[in]  n_iter  number of kernel iterations timed for each
+ *                     combination, or 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_tuning(int  n_iter)
+{
+  _tune_n_iter = CS_MAX(n_iter, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Renumber mesh elements for vectorization or threading depending on
@@ -6027,9 +6552,8 @@ cs_renumber_i_faces_by_gnum(cs_mesh_t  *mesh)
 
   if (mesh->global_i_face_num != nullptr) {
 
-    cs_lnum_t *new_to_old_i = cs_order_gnum(nullptr,
-                                            mesh->global_i_face_num,
-                                            mesh->n_i_faces);
+    cs_lnum_t *new_to_old_i = _order_unique_gnum(mesh->global_i_face_num,
+                                                 mesh->n_i_faces);
 
     _cs_renumber_update_i_faces(mesh, new_to_old_i);
 
@@ -6109,9 +6633,8 @@ cs_renumber_b_faces_by_gnum(cs_mesh_t  *mesh)
 
   if (mesh->global_b_face_num != nullptr) {
 
-    cs_lnum_t *new_to_old_b = cs_order_gnum(nullptr,
-                                            mesh->global_b_face_num,
-                                            mesh->n_b_faces);
+    cs_lnum_t *new_to_old_b = _order_unique_gnum(mesh->global_b_face_num,
+                                                 mesh->n_b_faces);
 
     _cs_renumber_update_b_faces(mesh, new_to_old_b);
 
@@ -6175,9 +6698,8 @@ cs_renumber_b_faces_select_ignore(cs_mesh_t        *mesh,
     const cs_lnum_t n_s = n_faces;
     const cs_lnum_t *s_id = face_ids;
 
-    cs_lnum_t *new_to_old_b = cs_order_gnum(nullptr,
-                                            mesh->global_b_face_num,
-                                            mesh->n_b_faces);
+    cs_lnum_t *new_to_old_b = _order_unique_gnum(mesh->global_b_face_num,
+                                                 mesh->n_b_faces);
     _cs_renumber_update_b_faces(mesh, new_to_old_b);
 
     BFT_MALLOC(sel_flag, mesh->n_b_faces, char);
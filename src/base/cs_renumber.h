@@ -66,6 +66,7 @@ typedef enum {
   CS_RENUMBER_I_FACES_BLOCK,         /* No shared cell in block */
   CS_RENUMBER_I_FACES_MULTIPASS,     /* Use multipass face numbering */
   CS_RENUMBER_I_FACES_SIMD,          /* Renumber for vector (SIMD) operations */
+  CS_RENUMBER_I_FACES_COLOR,         /* Balanced conflict-free colors */
   CS_RENUMBER_I_FACES_NONE           /* No interior face numbering */
 
 } cs_renumber_i_faces_type_t;
@@ -86,6 +87,14 @@ typedef enum {
 
 } cs_renumber_vertices_type_t;
 
+typedef enum {
+
+  CS_RENUMBER_GHOST_CELLS_ADJACENT,   /* Order by adjacent local cell */
+  CS_RENUMBER_GHOST_CELLS_SEND_ORDER, /* Order by distant cell id */
+  CS_RENUMBER_GHOST_CELLS_NONE        /* No ghost cells numbering */
+
+} cs_renumber_ghost_cells_type_t;
+
 /* Ordering options for adjacency arrays */
 
 typedef enum {
@@ -212,6 +221,52 @@ cs_renumber_get_algorithm(bool                        *halo_adjacent_cells_last,
                           cs_renumber_b_faces_type_t  *b_faces_numbering,
                           cs_renumber_vertices_type_t *vertices_numbering);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the ordering of ghost cells inside each halo section.
+ *
+ * Ghost cells remain grouped by distant rank and periodic transform,
+ * and the send lists of matching ranks are updated accordingly.
+ *
+ * \param[in]  ordering  ghost cells ordering type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_ghost_cells_ordering(cs_renumber_ghost_cells_type_t  ordering);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the ordering of ghost cells inside each halo section.
+ *
+ * \return  ghost cells ordering type
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_renumber_ghost_cells_type_t
+cs_renumber_get_ghost_cells_ordering(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate automatic selection of cells and interior
+ *        faces numbering.
+ *
+ * When active, each available cells numbering is combined with each
+ * relevant interior faces numbering, representative face-based kernels
+ * (matrix-vector product, gradient and convection face loops) are timed
+ * with each combination, and the fastest one is selected and logged.
+ *
+ * This may also be activated by setting the CS_RENUMBER environment
+ * variable to "tune" (using 10 iterations).
+ *
+ * \param[in]  n_iter  number of kernel iterations timed for each
+ *                     combination, or 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_renumber_set_tuning(int  n_iter);
+
 /*----------------------------------------------------------------------------
  * Renumber mesh elements for vectorization or threading depending on code
  * options and target machine.
@@ -0,0 +1,1103 @@
+/*============================================================================
+ * In-run mesh repartitioning for dynamic load balancing.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_ale.h"
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_base_accel.h"
+#include "cs_block_dist.h"
+#include "cs_boundary_conditions.h"
+#include "cs_boundary_zone.h"
+#include "cs_cell_to_vertex.h"
+#include "cs_ext_neighborhood.h"
+#include "cs_field.h"
+#include "cs_field_default.h"
+#include "cs_gradient.h"
+#include "cs_halo.h"
+#include "cs_halo_perio.h"
+#include "cs_internal_coupling.h"
+#include "cs_lagr_query.h"
+#include "cs_log.h"
+#include "cs_matrix_default.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_bad_cells.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_from_builder.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_mesh_to_builder.h"
+#include "cs_part_to_block.h"
+#include "cs_partition.h"
+#include "cs_post.h"
+#include "cs_preprocess.h"
+#include "cs_prototypes.h"
+#include "cs_renumber.h"
+#include "cs_sat_coupling.h"
+#include "cs_syr_coupling.h"
+#include "cs_timer.h"
+#include "cs_turbomachinery.h"
+#include "cs_volume_zone.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_repartition.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_repartition.cpp
+        In-run mesh repartitioning for dynamic load balancing.
+
+  The mesh is transferred to a mesh builder, partitioned again using
+  optional cell weights, and rebuilt, following the same path as
+  repartitioning at the preprocessing stage. Field values are then
+  migrated from the previous to the new distribution based on global
+  element numbers, through an intermediate block distribution.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Remapping of values for one main mesh location */
+
+typedef struct {
+
+  cs_block_dist_info_t   bi;        /* Intermediate block distribution */
+
+  cs_lnum_t              n_elts;    /* Number of elements in new
+                                       distribution */
+
+#if defined(HAVE_MPI)
+  cs_part_to_block_t    *p2b;       /* Previous partition to block
+                                       distributor */
+  cs_all_to_all_t       *b2p;       /* Block to new partition distributor */
+#endif
+
+} _remap_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static bool  _repartition_enabled = false;
+
+/* Measured per-cell costs (for partitioning of subsequent runs) */
+
+static int          _cost_n_steps_max = 0;      /* 0 if inactive */
+static int          _cost_n_steps = 0;
+static int          _n_costs = 0;
+static char       **_cost_name = nullptr;
+static cs_real_t  **_cost_val = nullptr;
+
+/* Main mesh locations whose values are migrated */
+
+static const int  _n_remap_locations = 4;
+
+static const cs_mesh_location_type_t _remap_location[]
+  = {CS_MESH_LOCATION_CELLS,
+     CS_MESH_LOCATION_INTERIOR_FACES,
+     CS_MESH_LOCATION_BOUNDARY_FACES,
+     CS_MESH_LOCATION_VERTICES};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check that active models are compatible with in-run repartitioning.
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_compatibility(void)
+{
+  const char *model = nullptr;
+
+  if (cs_lagr_model_type() > 0)
+    model = _("Lagrangian particle tracking");
+  else if (cs_glob_ale > CS_ALE_NONE)
+    model = _("ALE mesh movement");
+  else if (cs_turbomachinery_get_model() != CS_TURBOMACHINERY_NONE)
+    model = _("turbomachinery modeling");
+  else if (cs_internal_coupling_n_couplings() > 0)
+    model = _("internal coupling");
+  else if (cs_sat_coupling_n_couplings() + cs_syr_coupling_n_couplings() > 0)
+    model = _("code coupling");
+  else if (cs_glob_mesh_quantities->has_disable_flag)
+    model = _("disabled (solid) cells");
+
+  if (model != nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: in-run mesh repartitioning is not available\n"
+                "with %s."),
+              __func__, model);
+}
+
+/*----------------------------------------------------------------------------
+ * Return global numbers of a mesh location's elements.
+ *
+ * parameters:
+ *   m           <-- pointer to mesh
+ *   location_id <-- mesh location id
+ *   n_elts      --> number of elements
+ *   n_g_elts    --> global number of elements
+ *
+ * returns:
+ *   pointer to global numbers, or nullptr if not defined
+ *----------------------------------------------------------------------------*/
+
+static const cs_gnum_t *
+_location_gnum(const cs_mesh_t          *m,
+               cs_mesh_location_type_t   location_id,
+               cs_lnum_t                *n_elts,
+               cs_gnum_t                *n_g_elts)
+{
+  const cs_gnum_t *gnum = nullptr;
+
+  switch(location_id) {
+  case CS_MESH_LOCATION_CELLS:
+    *n_elts = m->n_cells;
+    *n_g_elts = m->n_g_cells;
+    gnum = m->global_cell_num;
+    break;
+  case CS_MESH_LOCATION_INTERIOR_FACES:
+    *n_elts = m->n_i_faces;
+    *n_g_elts = m->n_g_i_faces;
+    gnum = m->global_i_face_num;
+    break;
+  case CS_MESH_LOCATION_BOUNDARY_FACES:
+    *n_elts = m->n_b_faces;
+    *n_g_elts = m->n_g_b_faces;
+    gnum = m->global_b_face_num;
+    break;
+  case CS_MESH_LOCATION_VERTICES:
+    *n_elts = m->n_vertices;
+    *n_g_elts = m->n_g_vertices;
+    gnum = m->global_vtx_num;
+    break;
+  default:
+    assert(0);
+    *n_elts = 0;
+    *n_g_elts = 0;
+  }
+
+  return gnum;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Initialize the source (previous distribution) part of a remapping.
+ *
+ * This must be called before the mesh is transferred to a builder.
+ *
+ * parameters:
+ *   m           <-- pointer to mesh
+ *   location_id <-- mesh location id
+ *   r           --> remapping structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_init_source(const cs_mesh_t          *m,
+                   cs_mesh_location_type_t   location_id,
+                   _remap_t                 *r)
+{
+  cs_lnum_t n_elts = 0;
+  cs_gnum_t n_g_elts = 0;
+
+  const cs_gnum_t *gnum = _location_gnum(m, location_id, &n_elts, &n_g_elts);
+
+  r->bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                      cs_glob_n_ranks,
+                                      1,
+                                      0,
+                                      n_g_elts);
+
+  /* The mesh's global numbers will be freed, so use a private copy */
+
+  cs_gnum_t *_gnum;
+  BFT_MALLOC(_gnum, n_elts, cs_gnum_t);
+
+  if (gnum != nullptr)
+    memcpy(_gnum, gnum, n_elts*sizeof(cs_gnum_t));
+  else {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      _gnum[i] = i+1;
+  }
+
+  r->n_elts = 0;
+  r->p2b = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                           r->bi,
+                                           n_elts,
+                                           _gnum);
+  cs_part_to_block_transfer_gnum(r->p2b, _gnum);
+
+  r->b2p = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Complete a remapping with the destination (new distribution) part.
+ *
+ * parameters:
+ *   m           <-- pointer to rebuilt mesh
+ *   location_id <-- mesh location id
+ *   r           <-> remapping structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_init_dest(const cs_mesh_t          *m,
+                 cs_mesh_location_type_t   location_id,
+                 _remap_t                 *r)
+{
+  cs_lnum_t n_elts = 0;
+  cs_gnum_t n_g_elts = 0;
+
+  const cs_gnum_t *gnum = _location_gnum(m, location_id, &n_elts, &n_g_elts);
+
+  assert(gnum != nullptr || n_elts == 0);
+
+  r->n_elts = n_elts;
+  r->b2p = cs_all_to_all_create_from_block(n_elts,
+                                           CS_ALL_TO_ALL_USE_DEST_ID,
+                                           gnum,
+                                           r->bi,
+                                           cs_glob_mpi_comm);
+}
+
+/*----------------------------------------------------------------------------
+ * Free a remapping structure's distributors.
+ *
+ * parameters:
+ *   r <-> remapping structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_free(_remap_t  *r)
+{
+  cs_part_to_block_destroy(&(r->p2b));
+  if (r->b2p != nullptr)
+    cs_all_to_all_destroy(&(r->b2p));
+}
+
+/*----------------------------------------------------------------------------
+ * Copy interleaved values from the previous to the new distribution.
+ *
+ * parameters:
+ *   r          <-- remapping structure
+ *   stride     <-- number of values per element
+ *   src_vals   <-- values in previous distribution
+ *   dest_vals  --> values in new distribution
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_copy(const _remap_t   *r,
+            int               stride,
+            const cs_real_t   src_vals[],
+            cs_real_t         dest_vals[])
+{
+  cs_lnum_t n_block_vals
+    = (r->bi.gnum_range[1] - r->bi.gnum_range[0]) * (cs_lnum_t)stride;
+
+  cs_real_t *block_vals;
+  BFT_MALLOC(block_vals, n_block_vals, cs_real_t);
+
+  cs_part_to_block_copy_array(r->p2b,
+                              CS_REAL_TYPE,
+                              stride,
+                              src_vals,
+                              block_vals);
+
+  cs_all_to_all_copy_array(r->b2p,
+                           CS_REAL_TYPE,
+                           stride,
+                           true, /* reverse */
+                           block_vals,
+                           dest_vals);
+
+  BFT_FREE(block_vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Migrate an array to the new distribution, replacing it.
+ *
+ * Values beyond the new number of elements (i.e. ghost values) are
+ * set to zero, and should be synchronized by the caller.
+ *
+ * parameters:
+ *   r        <-- remapping structure
+ *   stride   <-- number of values per element
+ *   n_alloc  <-- allocated number of elements (including ghosts)
+ *   hd       <-- if true, array uses host/device allocation
+ *   array    <-> pointer to array
+ *----------------------------------------------------------------------------*/
+
+static void
+_remap_array(const _remap_t   *r,
+             int               stride,
+             cs_lnum_t         n_alloc,
+             bool              hd,
+             cs_real_t       **array)
+{
+  if (*array == nullptr)
+    return;
+
+  cs_real_t *vals = nullptr;
+
+  if (hd)
+    CS_MALLOC_HD(vals, n_alloc*stride, cs_real_t, cs_alloc_mode);
+  else
+    BFT_MALLOC(vals, n_alloc*stride, cs_real_t);
+
+  _remap_copy(r, stride, *array, vals);
+
+  for (cs_lnum_t i = r->n_elts*stride; i < n_alloc*stride; i++)
+    vals[i] = 0.;
+
+  if (hd)
+    CS_FREE_HD(*array);
+  else
+    BFT_FREE(*array);
+
+  *array = vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize cell-based interleaved values.
+ *
+ * parameters:
+ *   halo   <-- pointer to halo structure
+ *   dim    <-- number of values per cell
+ *   vals   <-> values to synchronize
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_cell_values(const cs_halo_t  *halo,
+                  int               dim,
+                  cs_real_t         vals[])
+{
+  cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, vals, dim);
+
+  if (cs_glob_mesh->n_init_perio > 0) {
+    switch(dim) {
+    case 9:
+      cs_halo_perio_sync_var_tens(halo, CS_HALO_EXTENDED, vals);
+      break;
+    case 6:
+      cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, vals);
+      break;
+    case 3:
+      cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, vals, 3);
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Migrate field values to the new distribution.
+ *
+ * parameters:
+ *   remap <-- remapping structures for main mesh locations
+ *----------------------------------------------------------------------------*/
+
+static void
+_migrate_fields(const _remap_t  remap[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_halo_t *halo = m->halo;
+
+  const int n_fields = cs_field_n_fields();
+  const int coupled_key_id = cs_field_key_id_try("coupled");
+
+  int n_reset = 0;
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (f->is_owner == false || f->vals == nullptr)
+      continue;
+
+    if (f->location_id == CS_MESH_LOCATION_NONE)
+      continue;
+
+    int r_id = -1;
+    for (int i = 0; i < _n_remap_locations; i++) {
+      if (f->location_id == _remap_location[i])
+        r_id = i;
+    }
+
+    /* Values on other locations (such as zones) cannot be migrated
+       based on this location's numbering, so they are reinitialized */
+
+    if (r_id < 0) {
+      cs_field_allocate_values(f);
+      n_reset += 1;
+      continue;
+    }
+
+    const _remap_t *r = remap + r_id;
+    const cs_lnum_t n_alloc
+      = cs_mesh_location_get_n_elts(f->location_id)[2];
+
+    for (int kk = 0; kk < f->n_time_vals; kk++) {
+      _remap_array(r, f->dim, n_alloc, true, &(f->vals[kk]));
+      if (halo != nullptr && f->location_id == CS_MESH_LOCATION_CELLS)
+        _sync_cell_values(halo, f->dim, f->vals[kk]);
+    }
+
+    f->val = f->vals[0];
+    if (f->n_time_vals > 1)
+      f->val_pre = f->vals[1];
+
+    if (f->location_id != CS_MESH_LOCATION_CELLS)
+      continue;
+
+    if (f->grad != nullptr) {
+
+      _remap_array(r, 3*f->dim, n_alloc, false, &(f->grad));
+
+      if (halo != nullptr) {
+        cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, f->grad, 3*f->dim);
+        if (f->dim == 1)
+          cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, f->grad, 3);
+        else if (f->dim == 3)
+          cs_halo_perio_sync_var_tens(halo, CS_HALO_EXTENDED, f->grad);
+      }
+
+    }
+
+    /* Boundary condition coefficients (see cs_field_allocate_bc_coeffs) */
+
+    if (f->bc_coeffs != nullptr) {
+
+      cs_field_bc_coeffs_t *bc_coeffs = f->bc_coeffs;
+      const _remap_t *rb = remap + 2;
+      const cs_lnum_t n_b_faces = rb->n_elts;
+
+      int a_mult = f->dim;
+      int b_mult = f->dim;
+      if (   (f->type & CS_FIELD_VARIABLE) && coupled_key_id > -1
+          && cs_field_get_key_int(f, coupled_key_id))
+        b_mult *= f->dim;
+
+      _remap_array(rb, a_mult, n_b_faces, true, &(bc_coeffs->a));
+      _remap_array(rb, b_mult, n_b_faces, true, &(bc_coeffs->b));
+      _remap_array(rb, a_mult, n_b_faces, true, &(bc_coeffs->af));
+      _remap_array(rb, b_mult, n_b_faces, true, &(bc_coeffs->bf));
+      _remap_array(rb, a_mult, n_b_faces, true, &(bc_coeffs->ad));
+      _remap_array(rb, b_mult, n_b_faces, true, &(bc_coeffs->bd));
+      _remap_array(rb, a_mult, n_b_faces, true, &(bc_coeffs->ac));
+      _remap_array(rb, b_mult, n_b_faces, true, &(bc_coeffs->bc));
+      _remap_array(rb, 1, n_b_faces, false, &(bc_coeffs->hint));
+      _remap_array(rb, 1, n_b_faces, false, &(bc_coeffs->_hext));
+
+    }
+
+  }
+
+  /* Boundary condition codes are reset at each time step,
+     so they only need to be remapped */
+
+  cs_field_build_bc_codes_all();
+
+  if (n_reset > 0)
+    bft_printf(_("\n  %d field(s) defined on mesh sub-locations were"
+                 " reinitialized.\n"), n_reset);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Free measured per-cell costs and deactivate their accumulation.
+ *----------------------------------------------------------------------------*/
+
+static void
+_cost_free(void)
+{
+  for (int i = 0; i < _n_costs; i++) {
+    BFT_FREE(_cost_name[i]);
+    BFT_FREE(_cost_val[i]);
+  }
+  BFT_FREE(_cost_name);
+  BFT_FREE(_cost_val);
+
+  _n_costs = 0;
+  _cost_n_steps = 0;
+  _cost_n_steps_max = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Write measured per-cell costs to file as partitioning weights.
+ *
+ * The first weight is the number of faces adjacent to each cell, followed
+ * by measured costs whose global sum is non-zero.
+ *----------------------------------------------------------------------------*/
+
+static void
+_cost_write(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  /* Select non-empty costs */
+
+  double *c_sum;
+  BFT_MALLOC(c_sum, _n_costs + 1, double);
+
+  for (int j = 0; j < _n_costs; j++) {
+    c_sum[j] = 0;
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      c_sum[j] += _cost_val[j][i];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1 && _n_costs > 0)
+    MPI_Allreduce(MPI_IN_PLACE, c_sum, _n_costs, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+#endif
+
+  int n_w = 1;
+  for (int j = 0; j < _n_costs; j++) {
+    if (c_sum[j] > 0)
+      n_w++;
+  }
+
+  /* Build interleaved weights */
+
+  cs_real_t *w;
+  BFT_MALLOC(w, n_cells*n_w, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    w[i*n_w] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = m->i_face_cells[f_id][k];
+      if (c_id < n_cells)
+        w[c_id*n_w] += 1;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++)
+    w[m->b_face_cells[f_id]*n_w] += 1;
+
+  bft_printf(_("\n Writing measured cell costs for partitioning:\n"
+               "   cell faces\n"));
+
+  int k = 1;
+  for (int j = 0; j < _n_costs; j++) {
+    if (c_sum[j] > 0) {
+      for (cs_lnum_t i = 0; i < n_cells; i++)
+        w[i*n_w + k] = _cost_val[j][i];
+      bft_printf("   %s\n", _cost_name[j]);
+      k++;
+    }
+  }
+
+  BFT_FREE(c_sum);
+
+  cs_partition_write_cell_weights(m, n_w, w);
+
+  BFT_FREE(w);
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild mesh-dependent structures after redistribution.
+ *
+ * This follows the same sequence as the preprocessing stage and the
+ * turbomachinery mesh update.
+ *
+ * parameters:
+ *   m   <-> pointer to mesh
+ *   mq  <-> pointer to mesh quantities
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_mesh_structures(cs_mesh_t             *m,
+                        cs_mesh_quantities_t  *mq)
+{
+  cs_renumber_mesh(m);
+
+  cs_mesh_init_group_classes(m);
+
+  if (m->verbosity > 0)
+    cs_mesh_print_info(m, _("Mesh"));
+
+  cs_mesh_quantities_compute(m, mq);
+  cs_mesh_bad_cells_detect(m, mq);
+  cs_user_mesh_bad_cells_tag(m, mq);
+
+  cs_ext_neighborhood_reduce(m, mq);
+
+  /* Initialize selectors and locations for the mesh */
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_build(m, -1);
+  cs_volume_zone_build_all(true);
+  cs_boundary_zone_build_all(true);
+
+  /* Update Fortran mesh sizes and quantities */
+
+  cs_preprocess_mesh_update_fortran();
+
+  /* Update mapping for accelerated devices */
+
+#if defined(HAVE_ACCEL)
+  cs_preprocess_mesh_update_device();
+#endif
+
+  cs_boundary_conditions_update_mesh();
+
+  cs_gradient_free_quantities();
+  cs_cell_to_vertex_free();
+  cs_mesh_adjacencies_update_mesh();
+
+  /* Update linear algebra APIs relative to mesh */
+
+  cs_matrix_update_mesh();
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow repartitioning of the computational mesh during the run.
+ *
+ * Postprocessing meshes are then defined so as to allow changing
+ * connectivity.
+ *
+ * \note This function should be called during the setup stage
+ *       (for example in \ref cs_user_parameters), before
+ *       postprocessing meshes are defined.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_enable(void)
+{
+  _repartition_enabled = true;
+
+  cs_post_set_changing_connectivity();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the load imbalance of the current mesh distribution.
+ *
+ * The imbalance is defined as the ratio of the maximum load on any rank
+ * to the mean load.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  cell_weight  weight of each cell, or NULL for uniform weights
+ *
+ * \return  load imbalance (1 for a perfectly balanced distribution)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_repartition_imbalance(const cs_real_t  cell_weight[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  double load = n_cells;
+
+  if (cell_weight != nullptr) {
+    load = 0;
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      load += cell_weight[i];
+  }
+
+  double load_max = load, load_sum = load;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(&load, &load_max, 1, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(&load, &load_sum, 1, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  if (load_sum <= 0)
+    return 1.;
+
+  return load_max * cs_glob_n_ranks / load_sum;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell weights based on a cost measured on each rank.
+ *
+ * Each cell of the local rank is assigned an equal share of the rank's
+ * cost (such as the elapsed time of the time steps since the previous
+ * repartitioning, or the time measured by a given timer statistic), so
+ * that the sum of weights on each rank matches its measured cost.
+ *
+ * \param[in]   rank_cost    cost measured on the local rank
+ * \param[out]  cell_weight  weight of each cell (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_weights_from_rank_cost(double      rank_cost,
+                                      cs_real_t   cell_weight[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  if (n_cells < 1)
+    return;
+
+  const cs_real_t w = rank_cost / n_cells;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_weight[i] = w;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition the computational mesh during the run if the load
+ *        imbalance exceeds a given threshold.
+ *
+ * The mesh is redistributed using the current partitioning options,
+ * balancing the sum of cell weights on each rank. Halos, numberings,
+ * mesh quantities, locations, zones and matrix structures are rebuilt,
+ * and values of fields owning their values on cells, faces or vertices
+ * (including their previous time values, gradients, and boundary condition
+ * coefficients) are migrated to the new distribution.
+ *
+ * Other mesh-dependent arrays are not migrated, so this function should
+ * be called between time steps (for example from
+ * \ref cs_user_extra_operations), and bft_error is called if models
+ * keeping such data (Lagrangian particles, ALE, turbomachinery,
+ * internal or code couplings, disabled solid cells) are active.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  cell_weight  weight of each cell, or NULL for uniform weights
+ * \param[in]  threshold    repartition only if the imbalance is higher
+ *                          than this value
+ *
+ * \return  true if the mesh was repartitioned, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_repartition_mesh(const cs_real_t  cell_weight[],
+                    double           threshold)
+{
+  if (cs_glob_n_ranks < 2)
+    return false;
+
+  double imbalance = cs_repartition_imbalance(cell_weight);
+
+  if (imbalance <= threshold)
+    return false;
+
+  if (_repartition_enabled == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: in-run mesh repartitioning must be enabled\n"
+                "at the setup stage, using cs_repartition_enable."),
+              __func__);
+
+  _check_compatibility();
+
+#if defined(HAVE_MPI)
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  bft_printf(_("\n Repartitioning mesh (load imbalance: %g)\n"), imbalance);
+
+  /* Save previous distribution */
+
+  _remap_t remap[4];
+
+  for (int i = 0; i < _n_remap_locations; i++)
+    _remap_init_source(m, _remap_location[i], remap + i);
+
+  /* Redistribute mesh, following the same path as for preprocessing */
+
+  cs_mesh_quantities_free_all(mq);
+
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  cs_mesh_to_builder(m, mb, true, nullptr);
+
+  if (cell_weight != nullptr) {
+    assert(   mb->cell_bi.gnum_range[0] == remap[0].bi.gnum_range[0]
+           && mb->cell_bi.gnum_range[1] == remap[0].bi.gnum_range[1]);
+    BFT_MALLOC(mb->cell_weight,
+               mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0],
+               cs_real_t);
+    cs_part_to_block_copy_array(remap[0].p2b,
+                                CS_REAL_TYPE,
+                                1,
+                                cell_weight,
+                                mb->cell_weight);
+  }
+
+  cs_partition(m, mb, CS_PARTITION_MAIN);
+  cs_mesh_from_builder(m, mb);
+  cs_mesh_init_halo(m, mb, m->halo_type, m->verbosity, true);
+  cs_mesh_update_auxiliary(m);
+
+  m->n_b_faces_all = m->n_b_faces;
+  m->n_g_b_faces_all = m->n_g_b_faces;
+
+  cs_mesh_builder_destroy(&mb);
+
+  _update_mesh_structures(m, mq);
+
+  /* Migrate values */
+
+  for (int i = 0; i < _n_remap_locations; i++)
+    _remap_init_dest(m, _remap_location[i], remap + i);
+
+  _migrate_fields(remap);
+
+  for (int i = 0; i < _n_costs; i++)
+    _remap_array(remap, 1, m->n_cells, false, &(_cost_val[i]));
+
+  double new_imbalance = 1.;
+
+  if (cell_weight != nullptr) {
+    cs_real_t *new_weight;
+    BFT_MALLOC(new_weight, m->n_cells, cs_real_t);
+    _remap_copy(remap, 1, cell_weight, new_weight);
+    new_imbalance = cs_repartition_imbalance(new_weight);
+    BFT_FREE(new_weight);
+  }
+  else
+    new_imbalance = cs_repartition_imbalance(nullptr);
+
+  for (int i = 0; i < _n_remap_locations; i++)
+    _remap_free(remap + i);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt = cs_timer_diff(&t0, &t1);
+
+  bft_printf(_("\n Mesh repartitioned (%.3g s); estimated load imbalance:"
+               " %g\n"),
+             (double)(dt.nsec)/1.e9, new_imbalance);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nIn-run mesh repartitioning:\n\n"
+                  "  load imbalance before:      %g\n"
+                  "  estimated imbalance after:  %g\n"
+                  "  wall clock time:            %.3g s\n"),
+                imbalance, new_imbalance, (double)(dt.nsec)/1.e9);
+
+  return true;
+
+#else
+
+  return false;
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate accumulation of measured per-cell costs.
+ *
+ * During the given number of time steps (a short warm-up run), costs
+ * reported using \ref cs_repartition_cost_add (by instrumented models or
+ * by the user) are accumulated for each cell. At the end of this period
+ * (or at the last time step if the run is shorter), those costs, along
+ * with the number of faces of each cell, are written as multiple cell
+ * weights to the "partition_output/cell_weights" file, which is used to
+ * partition the mesh for subsequent (production) runs when present in
+ * "partition_input" (see \ref cs_partition_write_cell_weights).
+ *
+ * \param[in]  n_time_steps  number of time steps over which costs are
+ *                           measured
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_cost_enable(int  n_time_steps)
+{
+  if (n_time_steps < 1)
+    _cost_free();
+  else
+    _cost_n_steps_max = n_time_steps;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the id of a measured per-cell cost, defining it if needed.
+ *
+ * Each measured cost is used as a separate balance constraint for
+ * multi-constraint partitioning.
+ *
+ * \param[in]  name  name of associated cost
+ *
+ * \return  id of cost, or -1 if cost measurement is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_repartition_cost_id(const char  *name)
+{
+  if (_cost_n_steps_max < 1)
+    return -1;
+
+  for (int i = 0; i < _n_costs; i++) {
+    if (strcmp(_cost_name[i], name) == 0)
+      return i;
+  }
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  int cost_id = _n_costs;
+  _n_costs += 1;
+
+  BFT_REALLOC(_cost_name, _n_costs, char *);
+  BFT_REALLOC(_cost_val, _n_costs, cs_real_t *);
+
+  BFT_MALLOC(_cost_name[cost_id], strlen(name) + 1, char);
+  strcpy(_cost_name[cost_id], name);
+
+  BFT_MALLOC(_cost_val[cost_id], n_cells, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _cost_val[cost_id][i] = 0;
+
+  return cost_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add contributions to a measured per-cell cost.
+ *
+ * Cell ids may appear multiple times in the list, in which case their
+ * contributions are summed.
+ *
+ * \param[in]  cost_id   id of measured cost, or -1 (ignored)
+ * \param[in]  n_elts    number of contributions
+ * \param[in]  elt_ids   ids of associated cells, or NULL for all cells
+ * \param[in]  cost      contributions, or NULL for unit contributions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_cost_add(int              cost_id,
+                        cs_lnum_t        n_elts,
+                        const cs_lnum_t  elt_ids[],
+                        const cs_real_t  cost[])
+{
+  if (cost_id < 0 || cost_id >= _n_costs)
+    return;
+
+  cs_real_t *c = _cost_val[cost_id];
+
+  if (elt_ids != nullptr) {
+    if (cost != nullptr) {
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        c[elt_ids[i]] += cost[i];
+    }
+    else {
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        c[elt_ids[i]] += 1;
+    }
+  }
+  else {
+    if (cost != nullptr) {
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        c[i] += cost[i];
+    }
+    else {
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        c[i] += 1;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update measured per-cell cost status at the end of a time step.
+ *
+ * When the measurement period is complete, accumulated costs are
+ * written to file and freed.
+ *
+ * \param[in]  last_time_step  true if this is the last time step
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_cost_time_step(bool  last_time_step)
+{
+  if (_cost_n_steps_max < 1)
+    return;
+
+  _cost_n_steps += 1;
+
+  if (_cost_n_steps >= _cost_n_steps_max || last_time_step) {
+    _cost_write();
+    _cost_free();
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,199 @@
+#ifndef __CS_REPARTITION_H__
+#define __CS_REPARTITION_H__
+
+/*============================================================================
+ * In-run mesh repartitioning for dynamic load balancing.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow repartitioning of the computational mesh during the run.
+ *
+ * Postprocessing meshes are then defined so as to allow changing
+ * connectivity.
+ *
+ * \note This function should be called during the setup stage
+ *       (for example in \ref cs_user_parameters), before
+ *       postprocessing meshes are defined.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_enable(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the load imbalance of the current mesh distribution.
+ *
+ * The imbalance is defined as the ratio of the maximum load on any rank
+ * to the mean load.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  cell_weight  weight of each cell, or NULL for uniform weights
+ *
+ * \return  load imbalance (1 for a perfectly balanced distribution)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_repartition_imbalance(const cs_real_t  cell_weight[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell weights based on a cost measured on each rank.
+ *
+ * Each cell of the local rank is assigned an equal share of the rank's
+ * cost (such as the elapsed time of the time steps since the previous
+ * repartitioning, or the time measured by a given timer statistic), so
+ * that the sum of weights on each rank matches its measured cost.
+ *
+ * \param[in]   rank_cost    cost measured on the local rank
+ * \param[out]  cell_weight  weight of each cell (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_weights_from_rank_cost(double      rank_cost,
+                                      cs_real_t   cell_weight[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition the computational mesh during the run if the load
+ *        imbalance exceeds a given threshold.
+ *
+ * The mesh is redistributed using the current partitioning options,
+ * balancing the sum of cell weights on each rank. Halos, numberings,
+ * mesh quantities, locations, zones and matrix structures are rebuilt,
+ * and values of fields owning their values on cells, faces or vertices
+ * (including their previous time values, gradients, and boundary condition
+ * coefficients) are migrated to the new distribution.
+ *
+ * Other mesh-dependent arrays are not migrated, so this function should
+ * be called between time steps (for example from
+ * \ref cs_user_extra_operations), and bft_error is called if models
+ * keeping such data (Lagrangian particles, ALE, turbomachinery,
+ * internal or code couplings, disabled solid cells) are active.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  cell_weight  weight of each cell, or NULL for uniform weights
+ * \param[in]  threshold    repartition only if the imbalance is higher
+ *                          than this value
+ *
+ * \return  true if the mesh was repartitioned, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_repartition_mesh(const cs_real_t  cell_weight[],
+                    double           threshold);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate accumulation of measured per-cell costs.
+ *
+ * During the given number of time steps (a short warm-up run), costs
+ * reported using \ref cs_repartition_cost_add (by instrumented models or
+ * by the user) are accumulated for each cell. At the end of this period
+ * (or at the last time step if the run is shorter), those costs, along
+ * with the number of faces of each cell, are written as multiple cell
+ * weights to the "partition_output/cell_weights" file, which is used to
+ * partition the mesh for subsequent (production) runs when present in
+ * "partition_input" (see \ref cs_partition_write_cell_weights).
+ *
+ * \param[in]  n_time_steps  number of time steps over which costs are
+ *                           measured
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_cost_enable(int  n_time_steps);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the id of a measured per-cell cost, defining it if needed.
+ *
+ * Each measured cost is used as a separate balance constraint for
+ * multi-constraint partitioning.
+ *
+ * \param[in]  name  name of associated cost
+ *
+ * \return  id of cost, or -1 if cost measurement is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_repartition_cost_id(const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add contributions to a measured per-cell cost.
+ *
+ * Cell ids may appear multiple times in the list, in which case their
+ * contributions are summed.
+ *
+ * \param[in]  cost_id   id of measured cost, or -1 (ignored)
+ * \param[in]  n_elts    number of contributions
+ * \param[in]  elt_ids   ids of associated cells, or NULL for all cells
+ * \param[in]  cost      contributions, or NULL for unit contributions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_cost_add(int              cost_id,
+                        cs_lnum_t        n_elts,
+                        const cs_lnum_t  elt_ids[],
+                        const cs_real_t  cost[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update measured per-cell cost status at the end of a time step.
+ *
+ * When the measurement period is complete, accumulated costs are
+ * written to file and freed.
+ *
+ * \param[in]  last_time_step  true if this is the last time step
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_repartition_cost_time_step(bool  last_time_step);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_REPARTITION_H__ */
@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,6 +49,19 @@
 #include <mpi.h>
 #endif
 
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * Standard C++ library headers
+ *----------------------------------------------------------------------------*/
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -113,8 +127,89 @@ typedef struct _location_t {
   cs_gnum_t        *_ent_global_num;  /* Private global entity numbers,
                                          or nullptr */
 
+#if defined(HAVE_MPI)
+  cs_block_dist_info_t  read_bi;      /* Block distribution used for reading */
+  cs_all_to_all_t      *read_d;       /* Cached block to entities distributor
+                                         for reading, or nullptr */
+#endif
+
 } _location_t;
 
+/* Section staged for asynchronous writing */
+
+typedef struct {
+
+  char           *name;             /* Section name */
+  bool            global;           /* Write as global section if true,
+                                       as block otherwise */
+  cs_gnum_t       n_vals;           /* Global number of values (global
+                                       sections) or entities (blocks) */
+  cs_gnum_t       gnum_range[2];    /* Global number range of block */
+  int             location_id;      /* Id of corresponding location */
+  int             n_location_vals;  /* Number of values per location */
+  cs_datatype_t   elt_type;         /* Element type */
+  cs_byte_t      *buffer;           /* Staged values */
+
+} _staged_section_t;
+
+/* Checkpoint file staged for asynchronous writing */
+
+typedef struct {
+
+  char               *name;            /* Name of associated file */
+  cs_io_t            *fh;              /* Associated (open) file handle */
+
+  int                 n_sections;      /* Number of staged sections */
+  int                 n_sections_max;  /* Size of sections array */
+  _staged_section_t  *sections;        /* Staged sections */
+
+  bool                invalidate_local; /* Invalidate node-local tier
+                                           checkpoint once written */
+
+#if defined(HAVE_MPI)
+  MPI_Comm            block_comm;      /* Private block communicator */
+  MPI_Comm            comm;            /* Private associated communicator */
+#endif
+
+} _staged_file_t;
+
+/* File of an in-memory checkpoint store entry */
+
+typedef struct {
+
+  char      *name;             /* File name (relative to checkpoint or
+                                  restart directory) */
+  size_t     nb;               /* Size of serialized data */
+  void      *data;             /* Serialized data (rank-local values) */
+  bool       in_use;           /* Data currently used by an open
+                                  restart or checkpoint file */
+
+} _stored_file_t;
+
+/* In-memory checkpoint store entry */
+
+typedef struct {
+
+  char            *name;       /* Checkpoint name, or nullptr for
+                                  a free entry */
+  int              n_files;    /* Number of files */
+  _stored_file_t  *files;      /* Files */
+
+} _stored_checkpoint_t;
+
+/* Section block read ahead by a background thread */
+
+typedef struct {
+
+  cs_restart_t          *r;           /* Associated restart file, or nullptr
+                                         if no section is read ahead */
+  size_t                 rec_id;      /* Index id of section */
+  cs_io_sec_header_t     header;      /* Associated section header */
+  cs_block_dist_info_t   bi;          /* Block distribution */
+  cs_byte_t             *buffer;      /* Block values */
+
+} _read_ahead_t;
+
 struct _cs_restart_t {
 
   char              *name;           /* Name of restart file */
@@ -128,6 +223,25 @@ struct _cs_restart_t {
 
   cs_restart_mode_t  mode;           /* Read or write */
 
+  _staged_file_t    *staged;         /* Staged data for asynchronous
+                                        writing, or nullptr */
+
+  bool               local;          /* Rank-local file (node-local
+                                        checkpoint tier or in-memory
+                                        checkpoint store) if true */
+
+  int                store_id;       /* Id of in-memory checkpoint store
+                                        entry, or -1 */
+  int                store_file_id;  /* Id of file in store entry, or -1 */
+
+  cs_io_t           *fh_ra;          /* Secondary file handle used by the
+                                        read-ahead thread, or nullptr */
+#if defined(HAVE_MPI)
+  MPI_Comm           ra_block_comm;  /* Private read-ahead block
+                                        communicator */
+  MPI_Comm           ra_comm;        /* Private read-ahead communicator */
+#endif
+
 };
 
 typedef struct {
@@ -235,511 +349,2008 @@ static bool      _need_finalize = false;
 static cs_io_t  *_checkpoint_serialized_memory = nullptr;
 static cs_io_t  *_restart_serialized_memory = nullptr;
 
+/* In-memory checkpoint store */
+
+static int                    _n_stored_checkpoints = 0;
+static _stored_checkpoint_t  *_stored_checkpoints = nullptr;
+static int                    _checkpoint_store_id = -1;  /* entry written */
+static int                    _restart_store_id = -1;     /* entry read */
+
+/* Asynchronous checkpoint writing: staged files are written
+   in order by a background thread */
+
+static bool                          _checkpoint_async = false;
+static double                        _checkpoint_async_wtime = 0.;
+
+static std::thread                   _async_thread;
+static std::mutex                    _async_mutex;
+static std::condition_variable       _async_cv;
+static std::deque<_staged_file_t *>  _async_queue;
+static _staged_file_t               *_async_current = nullptr;
+static bool                          _async_stop = false;
+
+/* Read-ahead of sections */
+
+static bool                          _restart_read_ahead = false;
+static std::thread                   _read_ahead_thread;
+static _read_ahead_t                 _read_ahead = {nullptr, 0, {}, {},
+                                                    nullptr};
+
+/* Compression of sections defined on mesh locations */
+
+static bool      _compress_lossless = false;      /* lossless compression */
+static size_t    _compress_min_size = 4096;       /* minimum section size */
+static int       _n_compress_tolerances = 0;      /* number of lossy
+                                                     compression tolerances */
+static char    **_compress_tolerance_name = nullptr;
+static double   *_compress_tolerance = nullptr;
+
+/* Node-local checkpoint tier: each rank writes its own files to a
+   node-local directory, and only every Nth checkpoint is written to
+   the global checkpoint directory */
+
+static char     *_local_tier_path = nullptr;      /* node-local directory */
+static int       _local_tier_flush_interval = 1;  /* global flush interval */
+static int       _local_tier_partner_shift = 0;   /* rank shift to partner
+                                                     (0 for no copy) */
+static int       _checkpoint_count = 0;           /* checkpoints done */
+static int       _checkpoint_level = 0;           /* current checkpoint:
+                                                     0: not started,
+                                                     1: node-local,
+                                                     2: global */
+static int       _local_restart = -1;             /* restart from node-local
+                                                     tier (-1: unknown) */
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
- * Call cleanup operations for checkpoint/restart subsystem.
+ * Build the name of a rank's directory in the node-local checkpoint tier.
+ *
+ * parameters:
+ *   rank_id <-- rank id
+ *   partner <-- if true, directory containing the partner copy of the
+ *               given rank's files, held by the local rank
+ *
+ * returns:
+ *   pointer to allocated name
  *----------------------------------------------------------------------------*/
 
-static void
-_restart_finalize(void)
+static char *
+_local_tier_dir(int   rank_id,
+                bool  partner)
 {
-  if (_checkpoint_serialized_memory != nullptr)
-    cs_io_finalize(&_checkpoint_serialized_memory);
-  if (_restart_serialized_memory != nullptr)
-    cs_io_finalize(&_restart_serialized_memory);
+  char sub_dir[32];
+  snprintf(sub_dir, 31, (partner) ? "partner_%05d" : "rank_%05d", rank_id);
+  sub_dir[31] = '\0';
+
+  size_t l = strlen(_local_tier_path);
+
+  char *name;
+  BFT_MALLOC(name, l + strlen(sub_dir) + 2, char);
+
+  strcpy(name, _local_tier_path);
+  name[l] = _dir_separator;
+  name[l+1] = '\0';
+  strcat(name, sub_dir);
+
+  return name;
 }
 
 /*----------------------------------------------------------------------------
- * Compute number of values in a record
+ * Build the name of a file in a given directory.
  *
  * parameters:
- *   r               <-- associated restart file pointer
- *   location_id     <-- location id
- *   n_location_vals <-- number of values per location
+ *   dir  <-- directory name
+ *   name <-- file name
+ *
+ * returns:
+ *   pointer to allocated path
  *----------------------------------------------------------------------------*/
 
-static cs_gnum_t
-_compute_n_ents(const cs_restart_t  *r,
-                size_t               location_id,
-                size_t               n_location_vals)
+static char *
+_local_tier_path_join(const char  *dir,
+                      const char  *name)
 {
-  cs_gnum_t retval = 0;
+  size_t l = strlen(dir);
 
-  if (location_id == 0)
-    retval = n_location_vals;
+  char *path;
+  BFT_MALLOC(path, l + strlen(name) + 2, char);
 
-  else if (location_id > 0 && location_id <= r->n_locations)
-    retval =   r->location[location_id-1].n_glob_ents_f
-             * (cs_gnum_t)n_location_vals;
+  strcpy(path, dir);
+  path[l] = _dir_separator;
+  path[l+1] = '\0';
+  strcat(path, name);
 
-  else
-    bft_error(__FILE__, __LINE__, 0,
-              _("Location number %d given for restart file\n"
-                "\"%s\" is not valid."),
-              (int)location_id, r->name);
+  return path;
+}
 
-  return retval;
+/*----------------------------------------------------------------------------
+ * Read the marker of a complete checkpoint in a node-local tier directory.
+ *
+ * The marker contains the time step of the checkpoint and the number
+ * of ranks which wrote it.
+ *
+ * parameters:
+ *   dir <-- directory name
+ *
+ * returns:
+ *   checkpoint time step, or -1 if no matching checkpoint is present
+ *----------------------------------------------------------------------------*/
+
+static int
+_local_tier_read_marker(const char  *dir)
+{
+  int nt = -1, n_ranks = -1;
+
+  char *path = _local_tier_path_join(dir, "checkpoint_id");
+
+  FILE *f = fopen(path, "r");
+  if (f != nullptr) {
+    if (fscanf(f, "%d %d", &nt, &n_ranks) != 2 || n_ranks != cs_glob_n_ranks)
+      nt = -1;
+    fclose(f);
+  }
+
+  BFT_FREE(path);
+
+  return nt;
 }
 
 /*----------------------------------------------------------------------------
- * Analyze the content of a restart file to build locations
+ * Write the marker of a complete checkpoint in a node-local tier directory.
  *
  * parameters:
- *   r <-> associated restart file pointer
+ *   dir <-- directory name
+ *   nt  <-- checkpoint time step
  *----------------------------------------------------------------------------*/
 
 static void
-_locations_from_index(cs_restart_t  *r)
+_local_tier_write_marker(const char  *dir,
+                         int          nt)
 {
-  cs_io_sec_header_t h;
-
-  size_t rec_id = 0;
-  size_t index_size = 0;
+  char *path = _local_tier_path_join(dir, "checkpoint_id");
 
-  /* Initialization */
+  FILE *f = fopen(path, "w");
+  if (f != nullptr) {
+    fprintf(f, "%d %d\n", nt, cs_glob_n_ranks);
+    fclose(f);
+  }
+  else
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error writing node-local checkpoint marker \"%s\"."), path);
 
-  index_size = cs_io_get_index_size(r->fh);
+  BFT_FREE(path);
+}
 
-  /* Analyze records to determine locations */
+/*----------------------------------------------------------------------------
+ * Remove the marker of a complete checkpoint in a node-local tier directory.
+ *
+ * parameters:
+ *   dir <-- directory name
+ *----------------------------------------------------------------------------*/
 
-  for (rec_id = 0; rec_id < index_size; rec_id++) {
+static void
+_local_tier_remove_marker(const char  *dir)
+{
+  char *path = _local_tier_path_join(dir, "checkpoint_id");
+  cs_file_remove(path);
+  BFT_FREE(path);
+}
 
-    h = cs_io_get_indexed_sec_header(r->fh, rec_id);
+/*----------------------------------------------------------------------------
+ * Invalidate the node-local tier checkpoint (and the partner copy held
+ * by the local rank), once a more recent global checkpoint is written.
+ *
+ * This function may be called from the background writing thread.
+ *----------------------------------------------------------------------------*/
 
-    if (h.location_id > r->n_locations) {
+static void
+_local_tier_remove_markers(void)
+{
+  if (_local_tier_path == nullptr)
+    return;
 
-      _location_t  *loc = nullptr;
+  char *dir = _local_tier_dir(cs_glob_rank_id, false);
+  _local_tier_remove_marker(dir);
+  BFT_FREE(dir);
 
-      if (h.location_id != r->n_locations + 1)
-        bft_error(__FILE__, __LINE__, 0,
-                  _("Restart file \"%s\" declares a location number %d\n"
-                    "but no location %d has been declared."),
-                  r->name, (int)(h.location_id),
-                  (int)(r->n_locations + 1));
+  if (_local_tier_partner_shift > 0) {
+    int src_id =   (cs_glob_rank_id - _local_tier_partner_shift
+                    + cs_glob_n_ranks) % cs_glob_n_ranks;
+    dir = _local_tier_dir(src_id, true);
+    _local_tier_remove_marker(dir);
+    BFT_FREE(dir);
+  }
+}
 
-      BFT_REALLOC(r->location, r->n_locations + 1, _location_t);
+#if defined(HAVE_MPI)
 
-      loc = r->location + r->n_locations;
-      BFT_MALLOC(loc->name, strlen(h.sec_name) + 1, char);
-      strcpy(loc->name, h.sec_name);
+/*----------------------------------------------------------------------------
+ * Pack the files of a node-local tier directory to a buffer.
+ *
+ * The buffer contains the checkpoint time step, the number of files,
+ * and for each file, its name length, name, size, and contents
+ * (the checkpoint marker is not included).
+ *
+ * parameters:
+ *   dir  <-- directory name
+ *   nt   <-- checkpoint time step
+ *   size --> buffer size
+ *
+ * returns:
+ *   pointer to allocated buffer
+ *----------------------------------------------------------------------------*/
 
-      loc->id = h.location_id;
-      loc->n_ents = 0;
-      loc->n_glob_ents = 0;
+static unsigned char *
+_local_tier_pack(const char  *dir,
+                 int          nt,
+                 uint64_t    *size)
+{
+  char **names = cs_file_listdir(dir);
 
-      cs_io_set_indexed_position(r->fh, &h, rec_id);
-      cs_io_set_cs_gnum(&h, r->fh);
-      cs_io_read_global(&h, &(loc->n_glob_ents_f), r->fh);
+  /* Count files and buffer size */
 
-      loc->ent_global_num = nullptr;
-      loc->_ent_global_num = nullptr;
+  uint64_t n_files = 0;
+  uint64_t _size = 2*sizeof(uint64_t);
 
-      r->n_locations += 1;
+  for (int i = 0; names != nullptr && names[i] != nullptr; i++) {
+    char *path = _local_tier_path_join(dir, names[i]);
+    if (cs_file_isreg(path) && strcmp(names[i], "checkpoint_id") != 0) {
+      n_files++;
+      _size += 2*sizeof(uint64_t) + strlen(names[i]) + cs_file_size(path);
     }
+    BFT_FREE(path);
+  }
 
+  unsigned char *buf;
+  BFT_MALLOC(buf, _size, unsigned char);
+
+  uint64_t header[2] = {(uint64_t)nt, n_files};
+  memcpy(buf, header, 2*sizeof(uint64_t));
+
+  unsigned char *p = buf + 2*sizeof(uint64_t);
+
+  for (int i = 0; names != nullptr && names[i] != nullptr; i++) {
+    char *path = _local_tier_path_join(dir, names[i]);
+    if (cs_file_isreg(path) && strcmp(names[i], "checkpoint_id") != 0) {
+      uint64_t l = strlen(names[i]);
+      uint64_t f_size = cs_file_size(path);
+      memcpy(p, &l, sizeof(uint64_t));
+      memcpy(p + sizeof(uint64_t), names[i], l);
+      memcpy(p + sizeof(uint64_t) + l, &f_size, sizeof(uint64_t));
+      p += 2*sizeof(uint64_t) + l;
+      FILE *f = fopen(path, "rb");
+      if (f == nullptr || fread(p, 1, f_size, f) != f_size)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error reading node-local checkpoint file \"%s\"."),
+                  path);
+      fclose(f);
+      p += f_size;
+    }
+    BFT_FREE(path);
+    BFT_FREE(names[i]);
   }
+
+  BFT_FREE(names);
+
+  *size = _size;
+
+  return buf;
 }
 
 /*----------------------------------------------------------------------------
- * Initialize a checkpoint / restart file management structure;
+ * Unpack files packed by _local_tier_pack to a node-local tier directory.
+ *
+ * The checkpoint marker is removed first and written last, so that
+ * the directory is not considered complete if unpacking is interrupted.
  *
  * parameters:
- *   r <-> associated restart file pointer
+ *   dir  <-- directory name
+ *   buf  <-- packed files
  *----------------------------------------------------------------------------*/
 
 static void
-_add_file(cs_restart_t  *r)
+_local_tier_unpack(const char           *dir,
+                   const unsigned char  *buf)
 {
-  double timing[2];
-  cs_file_access_t method;
+  if (   cs_file_mkdir_default(_local_tier_path) != 0
+      || cs_file_mkdir_default(dir) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The %s directory cannot be created"), dir);
+
+  _local_tier_remove_marker(dir);
+
+  uint64_t header[2];
+  memcpy(header, buf, 2*sizeof(uint64_t));
+
+  const unsigned char *p = buf + 2*sizeof(uint64_t);
+
+  for (uint64_t i = 0; i < header[1]; i++) {
+    uint64_t l, f_size;
+    memcpy(&l, p, sizeof(uint64_t));
+    char *name;
+    BFT_MALLOC(name, l + 1, char);
+    memcpy(name, p + sizeof(uint64_t), l);
+    name[l] = '\0';
+    memcpy(&f_size, p + sizeof(uint64_t) + l, sizeof(uint64_t));
+    p += 2*sizeof(uint64_t) + l;
+
+    char *path = _local_tier_path_join(dir, name);
+    FILE *f = fopen(path, "wb");
+    if (f == nullptr || fwrite(p, 1, f_size, f) != f_size)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error writing node-local checkpoint file \"%s\"."),
+                path);
+    fclose(f);
+    p += f_size;
+
+    BFT_FREE(path);
+    BFT_FREE(name);
+  }
 
-  const char magic_string[] = "Checkpoint / restart, R0";
-  const long echo = CS_IO_ECHO_NONE;
+  _local_tier_write_marker(dir, header[0]);
+}
 
-  timing[0] = cs_timer_wtime();
+/*----------------------------------------------------------------------------
+ * Send a buffer to a rank while receiving one from another rank.
+ *
+ * Empty buffers are not sent. Large buffers are sent in chunks, so that
+ * counts fit in an int.
+ *
+ * parameters:
+ *   s_buf     <-- buffer to send
+ *   s_size    <-- size of buffer to send
+ *   dest_rank <-- rank to which the buffer is sent
+ *   src_rank  <-- rank from which a buffer is received
+ *   r_size    --> size of received buffer
+ *
+ * returns:
+ *   pointer to allocated received buffer, or nullptr if empty
+ *----------------------------------------------------------------------------*/
 
-  /* In read mode, open file to detect header first */
+static unsigned char *
+_local_tier_exchange(const unsigned char  *s_buf,
+                     uint64_t              s_size,
+                     int                   dest_rank,
+                     int                   src_rank,
+                     uint64_t             *r_size)
+{
+  const int tag = 0;
+  const uint64_t chunk_size = 1 << 30;
 
-#if defined(HAVE_MPI)
-  {
-    MPI_Info           hints;
-    MPI_Comm           block_comm, comm;
+  MPI_Sendrecv(&s_size, 1, MPI_UINT64_T, dest_rank, tag,
+               r_size, 1, MPI_UINT64_T, src_rank, tag,
+               cs_glob_mpi_comm, MPI_STATUS_IGNORE);
 
-    cs_file_get_default_comm(nullptr, &block_comm, &comm);
+  unsigned char *r_buf = nullptr;
+  if (*r_size > 0)
+    BFT_MALLOC(r_buf, *r_size, unsigned char);
 
-    r->rank_step = 1;
-    r->min_block_size = cs_parall_get_min_coll_buf_size();
-    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+  int n_s = (s_size + chunk_size - 1) / chunk_size;
+  int n_r = (*r_size + chunk_size - 1) / chunk_size;
 
-    if (r->mode == CS_RESTART_MODE_READ) {
-      cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
-      r->fh = cs_io_initialize_with_index(r->name,
-                                          magic_string,
-                                          method,
-                                          echo,
-                                          hints,
-                                          block_comm,
-                                          comm);
-      _locations_from_index(r);
-    }
-    else {
-      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
-      r->fh = cs_io_initialize(r->name,
-                               magic_string,
-                               CS_IO_MODE_WRITE,
-                               method,
-                               echo,
-                               hints,
-                               block_comm,
-                               comm);
-    }
+  MPI_Request *request;
+  BFT_MALLOC(request, n_s + n_r, MPI_Request);
+
+  for (int i = 0; i < n_r; i++) {
+    uint64_t s = i*chunk_size;
+    int count = CS_MIN(chunk_size, *r_size - s);
+    MPI_Irecv(r_buf + s, count, MPI_BYTE, src_rank, tag,
+              cs_glob_mpi_comm, request + i);
   }
-#else
-  {
-    if (r->mode == CS_RESTART_MODE_READ) {
-      cs_file_get_default_access(CS_FILE_MODE_READ, &method);
-      r->fh = cs_io_initialize_with_index(r->name,
-                                          magic_string,
-                                          method,
-                                          echo);
-      _locations_from_index(r);
-    }
-    else {
-      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
-      r->fh = cs_io_initialize(r->name,
-                               magic_string,
-                               CS_IO_MODE_WRITE,
-                               method,
-                               echo);
-    }
+
+  for (int i = 0; i < n_s; i++) {
+    uint64_t s = i*chunk_size;
+    int count = CS_MIN(chunk_size, s_size - s);
+    MPI_Isend(s_buf + s, count, MPI_BYTE, dest_rank, tag,
+              cs_glob_mpi_comm, request + n_r + i);
   }
-#endif
 
-  timing[1] = cs_timer_wtime();
-  _restart_wtime[r->mode] += timing[1] - timing[0];
+  MPI_Waitall(n_s + n_r, request, MPI_STATUSES_IGNORE);
 
-  _restart_n_opens[r->mode] += 1;
+  BFT_FREE(request);
+
+  return r_buf;
 }
 
-#if defined(HAVE_MPI)
+#endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
- * Read variable values defined on a mesh location.
+ * Check if a complete node-local tier checkpoint is available for restart.
  *
- * parameters:
- *   r           <-> associated restart file pointer
- *   header          <-- header associated with current position in file
- *   n_glob_ents     <-- global number of entities
- *   n_ents          <-- local number of entities
- *   ent_global_num  <-- global entity numbers (1 to n numbering)
- *   n_location_vals <-- number of values par location
- *   val_type        <-- data type
- *   vals            --> array of values
+ * If partner copies are active, files missing on a rank are first
+ * recovered from the partner copy held by another rank.
+ *
+ * The result is determined on the first call and the same for all ranks.
+ *
+ * returns:
+ *   1 if restart should use the node-local tier, 0 otherwise
  *----------------------------------------------------------------------------*/
 
-static void
-_read_ent_values(cs_restart_t           *r,
-                 cs_io_sec_header_t     *header,
-                 cs_gnum_t               n_glob_ents,
-                 cs_lnum_t               n_ents,
-                 const cs_gnum_t         ent_global_num[],
-                 int                     n_location_vals,
-                 cs_restart_val_type_t   val_type,
-                 cs_byte_t               vals[])
+static int
+_local_restart_check(void)
 {
-  cs_byte_t  *buffer = nullptr;
+  if (_local_restart > -1)
+    return _local_restart;
 
-  cs_lnum_t  block_buf_size = 0;
+  if (   _local_tier_path == nullptr
+      || _restart_serialized_memory != nullptr
+      || _restart_store_id > -1)
+    return 0;
 
-  size_t  nbr_byte_ent;
+  _local_restart = 0;
 
-  /* Initialization */
+  char *dir = _local_tier_dir(cs_glob_rank_id, false);
 
-  switch (val_type) {
-  case CS_TYPE_char:
-    nbr_byte_ent = n_location_vals;
-    break;
-  case CS_TYPE_int:
-    nbr_byte_ent = n_location_vals * sizeof(int);
-    cs_io_set_cs_lnum(header, r->fh);
-    break;
-  case CS_TYPE_cs_gnum_t:
-    nbr_byte_ent = n_location_vals * sizeof(cs_gnum_t);
-    cs_io_set_cs_gnum(header, r->fh);
-    break;
-  case CS_TYPE_cs_real_t:
-    nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
-    break;
-  default:
-    nbr_byte_ent = 0;
-    assert(0);
-  }
+  int nt = _local_tier_read_marker(dir);
+
+#if defined(HAVE_MPI)
 
-  cs_block_dist_info_t bi
-    = cs_block_dist_compute_sizes(cs_glob_rank_id,
-                                  cs_glob_n_ranks,
-                                  r->rank_step,
-                                  r->min_block_size / nbr_byte_ent,
-                                  n_glob_ents);
+  /* Recover missing files from partner copies */
 
-  cs_all_to_all_t *d
-    = cs_all_to_all_create_from_block(n_ents,
-                                      CS_ALL_TO_ALL_USE_DEST_ID,
-                                      ent_global_num,
-                                      bi,
-                                      cs_glob_mpi_comm);
+  if (_local_tier_partner_shift > 0) {
 
-  /* Read blocks */
+    const int shift = _local_tier_partner_shift;
+    const int dest_id = (cs_glob_rank_id + shift) % cs_glob_n_ranks;
+    const int src_id = (cs_glob_rank_id - shift + cs_glob_n_ranks)
+                       % cs_glob_n_ranks;
 
-  block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+    int need = (nt < 0) ? 1 : 0, src_need = 0;
 
-  if (block_buf_size > 0)
-    BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+    MPI_Sendrecv(&need, 1, MPI_INT, dest_id, 0,
+                 &src_need, 1, MPI_INT, src_id, 0,
+                 cs_glob_mpi_comm, MPI_STATUS_IGNORE);
 
-  cs_io_read_block(header,
-                   bi.gnum_range[0],
-                   bi.gnum_range[1],
-                   buffer,
-                   r->fh);
+    unsigned char *s_buf = nullptr;
+    uint64_t s_size = 0, r_size = 0;
 
- /* Distribute blocks on ranks */
+    if (src_need) {
+      char *p_dir = _local_tier_dir(src_id, true);
+      int p_nt = _local_tier_read_marker(p_dir);
+      if (p_nt > -1)
+        s_buf = _local_tier_pack(p_dir, p_nt, &s_size);
+      BFT_FREE(p_dir);
+    }
 
-  cs_all_to_all_copy_array(d,
-                           header->elt_type,
-                           n_location_vals,
-                           true,  /* reverse */
-                           buffer,
-                           vals);
+    unsigned char *r_buf = _local_tier_exchange(s_buf, s_size,
+                                                src_id, dest_id,
+                                                &r_size);
 
-  /* Free buffer */
+    BFT_FREE(s_buf);
 
-  BFT_FREE(buffer);
+    if (r_buf != nullptr) {
+      _local_tier_unpack(dir, r_buf);
+      BFT_FREE(r_buf);
+      nt = _local_tier_read_marker(dir);
+    }
+
+  }
 
-  cs_all_to_all_destroy(&d);
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(dir);
+
+  /* All ranks must have files from the same checkpoint */
+
+  int nt_min = nt, nt_max = nt;
+  cs_parall_min(1, CS_INT_TYPE, &nt_min);
+  cs_parall_max(1, CS_INT_TYPE, &nt_max);
+
+  if (nt_min > -1 && nt_min == nt_max) {
+    _local_restart = 1;
+    bft_printf(_("\n"
+                 "  Restarting from node-local checkpoint of time step %d\n"
+                 "  in \"%s\".\n"),
+               nt_min, _local_tier_path);
+  }
+
+  return _local_restart;
 }
 
 /*----------------------------------------------------------------------------
- * Write variable values defined on a mesh location.
+ * Determine if the current checkpoint is written to the node-local tier,
+ * and prepare the associated directory on the first call for a given
+ * checkpoint.
  *
- * parameters:
- *   r               <-> associated restart file pointer
- *   sec_name        <-- section name
- *   n_glob_ents     <-- global number of entities
- *   n_ents          <-- local number of entities
- *   ent_global_num  <-- global entity numbers (1 to n numbering)
- *   location_id     <-- id of corresponding location
- *   n_location_vals <-- number of values par location
- *   val_type        <-- data type
- *   vals            --> array of values
+ * Every Nth checkpoint, as well as the checkpoint at the last time step,
+ * is written to the global checkpoint directory.
+ *
+ * returns:
+ *   true if checkpoint files are written to the node-local tier
  *----------------------------------------------------------------------------*/
 
-static void
-_write_ent_values(const cs_restart_t     *r,
-                  const char             *sec_name,
-                  cs_gnum_t               n_glob_ents,
-                  cs_lnum_t               n_ents,
-                  const cs_gnum_t        *ent_global_num,
-                  int                     location_id,
-                  int                     n_location_vals,
-                  cs_restart_val_type_t   val_type,
-                  const cs_byte_t        *vals)
+static bool
+_local_tier_checkpoint(void)
 {
-  cs_lnum_t  block_buf_size = 0;
-
-  cs_datatype_t elt_type     = CS_DATATYPE_NULL;
-  size_t      nbr_byte_ent = 0;
-  cs_byte_t  *buffer = nullptr;
-
-  cs_block_dist_info_t bi;
-
-  cs_part_to_block_t *d = nullptr;
-
-  /* Initialization */
+  if (   _local_tier_path == nullptr
+      || _checkpoint_serialized_memory != nullptr
+      || _checkpoint_store_id > -1)
+    return false;
 
-  switch (val_type) {
-  case CS_TYPE_char:
-    nbr_byte_ent = n_location_vals;
-    elt_type = CS_CHAR;
-    break;
-  case CS_TYPE_int:
-    nbr_byte_ent = n_location_vals * sizeof(int);
-    elt_type = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
-    break;
-  case CS_TYPE_cs_gnum_t:
-    nbr_byte_ent = n_location_vals * sizeof(cs_gnum_t);
-    elt_type = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
-    break;
-  case CS_TYPE_cs_real_t:
-    nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
-    elt_type =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
-               ? CS_DOUBLE : CS_FLOAT;
-    break;
-  default:
-    assert(0);
-  }
+  if (_checkpoint_level == 0) {
 
-  bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
-                                   cs_glob_n_ranks,
-                                   r->rank_step,
-                                   r->min_block_size / nbr_byte_ent,
-                                   n_glob_ents);
+    const cs_time_step_t *ts = cs_glob_time_step;
 
-  d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
-                                      bi,
-                                      n_ents,
-                                      ent_global_num);
+    bool last = (ts->nt_max > -1 && ts->nt_cur >= ts->nt_max);
 
-  /* Distribute to blocks */
+    _checkpoint_level = 2;
 
-  block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+    if (   _local_tier_flush_interval > 1 && last == false
+        && (_checkpoint_count + 1) % _local_tier_flush_interval != 0) {
 
-  if (block_buf_size > 0)
-    BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+      _checkpoint_level = 1;
 
-  /* Distribute blocks on ranks */
+      char *dir = _local_tier_dir(cs_glob_rank_id, false);
 
-  cs_part_to_block_copy_array(d,
-                              elt_type,
-                              n_location_vals,
-                              vals,
-                              buffer);
+      if (   cs_file_mkdir_default(_local_tier_path) != 0
+          || cs_file_mkdir_default(dir) != 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("The %s directory cannot be created"), dir);
 
-  /* Write blocks */
+      /* Files will be overwritten, so the previous checkpoint
+         is not complete anymore */
 
-  cs_io_write_block_buffer(sec_name,
-                           n_glob_ents,
-                           bi.gnum_range[0],
-                           bi.gnum_range[1],
-                           location_id,
-                           0,
-                           n_location_vals,
-                           elt_type,
-                           buffer,
-                           r->fh);
+      _local_tier_remove_marker(dir);
 
-  /* Free buffer */
+      BFT_FREE(dir);
+    }
 
-  BFT_FREE(buffer);
+  }
 
-  cs_part_to_block_destroy(&d);
+  return (_checkpoint_level == 1);
 }
 
-#endif /* #if defined(HAVE_MPI) */
-
 /*----------------------------------------------------------------------------
- * Swap values of a renumbered array when reading
+ * Complete a checkpoint written to the node-local tier.
+ *
+ * If partner copies are active, each rank's files are copied to its
+ * partner rank, on another node, before the checkpoint is marked as
+ * complete.
  *
  * parameters:
- *   n_ents          --> number of local entities
- *   ini_ent_num     --> initial entity numbers
- *   n_location_vals --> number of values per entity
- *   val_type        --> data type
- *   vals            --> array of values
+ *   nt <-- checkpoint time step
  *----------------------------------------------------------------------------*/
 
 static void
-_restart_permute_read(cs_lnum_t               n_ents,
-                      const cs_gnum_t        *ini_ent_num,
-                      int                     n_location_vals,
-                      cs_restart_val_type_t   val_type,
-                      cs_byte_t              *vals)
+_local_tier_commit(int  nt)
 {
-  cs_lnum_t ent_id, jj;
+  char *dir = _local_tier_dir(cs_glob_rank_id, false);
 
-  cs_lnum_t ii = 0;
+#if defined(HAVE_MPI)
 
-  /* Instructions */
+  if (_local_tier_partner_shift > 0) {
 
-  if (ini_ent_num == nullptr)
-    return;
+    const int shift = _local_tier_partner_shift;
+    const int dest_id = (cs_glob_rank_id + shift) % cs_glob_n_ranks;
+    const int src_id = (cs_glob_rank_id - shift + cs_glob_n_ranks)
+                       % cs_glob_n_ranks;
 
-  switch (val_type) {
+    uint64_t s_size = 0, r_size = 0;
+    unsigned char *s_buf = _local_tier_pack(dir, nt, &s_size);
 
-  case CS_TYPE_char:
-    {
-      char  *val_ord;
-      char  *val_cur = (char *)vals;
+    unsigned char *r_buf = _local_tier_exchange(s_buf, s_size,
+                                                dest_id, src_id,
+                                                &r_size);
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, char);
+    BFT_FREE(s_buf);
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[ii++]
-            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
-      }
+    char *p_dir = _local_tier_dir(src_id, true);
+    _local_tier_unpack(p_dir, r_buf);
+    BFT_FREE(p_dir);
 
-      for (ii = 0; ii < n_ents * n_location_vals; ii++)
-        val_cur[ii] = val_ord[ii];
+    BFT_FREE(r_buf);
 
-      BFT_FREE(val_ord);
-    }
-    break;
+  }
 
-  case CS_TYPE_int:
-    {
-      int  *val_ord;
-      int  *val_cur = (int *)vals;
+#endif /* defined(HAVE_MPI) */
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, int);
+  _local_tier_write_marker(dir, nt);
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[ii++]
-            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
-      }
+  BFT_FREE(dir);
+}
 
-      for (ii = 0; ii < n_ents * n_location_vals; ii++)
-        val_cur[ii] = val_ord[ii];
+/*----------------------------------------------------------------------------
+ * Invalidate the node-local tier checkpoint after a global checkpoint.
+ *
+ * In asynchronous mode, this is deferred until the global checkpoint
+ * files have been written.
+ *----------------------------------------------------------------------------*/
 
-      BFT_FREE(val_ord);
+static void
+_local_tier_invalidate(void)
+{
+  if (_checkpoint_async) {
+    std::unique_lock<std::mutex> lock(_async_mutex);
+    _staged_file_t *f = nullptr;
+    if (!_async_queue.empty())
+      f = _async_queue.back();
+    else
+      f = _async_current;
+    if (f != nullptr) {
+      f->invalidate_local = true;
+      return;
     }
-    break;
-
-  case CS_TYPE_cs_gnum_t:
-    {
-      cs_gnum_t  *val_ord;
-      cs_gnum_t  *val_cur = (cs_gnum_t *)vals;
+  }
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_gnum_t);
+  _local_tier_remove_markers();
+}
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[ii++]
-            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
-      }
+/*----------------------------------------------------------------------------
+ * Create a staged file structure.
+ *
+ * parameters:
+ *   name  <-- associated file name
+ *
+ * returns:
+ *   pointer to staged file structure
+ *----------------------------------------------------------------------------*/
 
-      for (ii = 0; ii < n_ents * n_location_vals; ii++)
-        val_cur[ii] = val_ord[ii];
+static _staged_file_t *
+_staged_file_create(const char  *name)
+{
+  _staged_file_t *f;
+  BFT_MALLOC(f, 1, _staged_file_t);
 
-      BFT_FREE(val_ord);
-    }
-    break;
+  BFT_MALLOC(f->name, strlen(name) + 1, char);
+  strcpy(f->name, name);
 
-  case CS_TYPE_cs_real_t:
-    {
-      cs_real_t  *val_ord;
-      cs_real_t  *val_cur = (cs_real_t *)vals;
+  f->fh = nullptr;
 
-      BFT_MALLOC (val_ord, n_ents * n_location_vals, cs_real_t);
+  f->n_sections = 0;
+  f->n_sections_max = 0;
+  f->sections = nullptr;
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[ii++]
-            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
-      }
+  f->invalidate_local = false;
 
-      for (ii = 0; ii < n_ents * n_location_vals; ii++)
-        val_cur[ii] = val_ord[ii];
+#if defined(HAVE_MPI)
+  f->block_comm = MPI_COMM_NULL;
+  f->comm = MPI_COMM_NULL;
+
+  MPI_Comm block_comm, comm;
+  cs_file_get_default_comm(nullptr, &block_comm, &comm);
+
+  if (comm != MPI_COMM_NULL)
+    MPI_Comm_dup(comm, &(f->comm));
+  if (block_comm == comm)
+    f->block_comm = f->comm;
+  else if (block_comm != MPI_COMM_NULL)
+    MPI_Comm_dup(block_comm, &(f->block_comm));
+#endif
 
-      BFT_FREE(val_ord);
-    }
-    break;
+  return f;
+}
 
-  default:
-    assert(0);
+/*----------------------------------------------------------------------------
+ * Add a section to a staged file structure.
+ *
+ * The values buffer is owned by the staged structure.
+ *
+ * parameters:
+ *   f               <-> staged file structure
+ *   sec_name        <-- section name
+ *   global          <-- true for a global section, false for a block
+ *   n_vals          <-- global number of values (global section)
+ *                       or entities (block)
+ *   gnum_range      <-- global number range of block, or nullptr
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location
+ *   elt_type        <-- element type
+ *   buffer          <-- values buffer (ownership transferred)
+ *----------------------------------------------------------------------------*/
+
+static void
+_staged_file_add_section(_staged_file_t    *f,
+                         const char        *sec_name,
+                         bool               global,
+                         cs_gnum_t          n_vals,
+                         const cs_gnum_t    gnum_range[2],
+                         int                location_id,
+                         int                n_location_vals,
+                         cs_datatype_t      elt_type,
+                         cs_byte_t         *buffer)
+{
+  if (f->n_sections >= f->n_sections_max) {
+    f->n_sections_max = (f->n_sections_max > 0) ? f->n_sections_max*2 : 16;
+    BFT_REALLOC(f->sections, f->n_sections_max, _staged_section_t);
+  }
+
+  _staged_section_t *sec = f->sections + f->n_sections;
+  f->n_sections += 1;
+
+  BFT_MALLOC(sec->name, strlen(sec_name) + 1, char);
+  strcpy(sec->name, sec_name);
+
+  sec->global = global;
+  sec->n_vals = n_vals;
+  sec->gnum_range[0] = (gnum_range != nullptr) ? gnum_range[0] : 0;
+  sec->gnum_range[1] = (gnum_range != nullptr) ? gnum_range[1] : 0;
+  sec->location_id = location_id;
+  sec->n_location_vals = n_location_vals;
+  sec->elt_type = elt_type;
+  sec->buffer = buffer;
+}
+
+/*----------------------------------------------------------------------------
+ * Write and close a staged file, freeing staged values.
+ *
+ * This function may be called from the background writing thread, so
+ * it only uses the staged file's private communicators.
+ *
+ * parameters:
+ *   f <-> staged file structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_staged_file_write(_staged_file_t  *f)
+{
+  for (int i = 0; i < f->n_sections; i++) {
+    _staged_section_t *sec = f->sections + i;
+
+    if (sec->global)
+      cs_io_write_global(sec->name,
+                         sec->n_vals,
+                         sec->location_id,
+                         0,
+                         sec->n_location_vals,
+                         sec->elt_type,
+                         sec->buffer,
+                         f->fh);
+    else
+      cs_io_write_block_buffer(sec->name,
+                               sec->n_vals,
+                               sec->gnum_range[0],
+                               sec->gnum_range[1],
+                               sec->location_id,
+                               0,
+                               sec->n_location_vals,
+                               sec->elt_type,
+                               sec->buffer,
+                               f->fh);
+
+    BFT_FREE(sec->buffer);
+    BFT_FREE(sec->name);
+  }
+
+  f->n_sections = 0;
+
+  cs_io_finalize(&(f->fh));
+
+#if defined(HAVE_MPI)
+  if (f->block_comm != f->comm && f->block_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(f->block_comm));
+  if (f->comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(f->comm));
+  f->block_comm = MPI_COMM_NULL;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a staged file structure.
+ *
+ * parameters:
+ *   f <-> pointer to staged file structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_staged_file_destroy(_staged_file_t  **f)
+{
+  _staged_file_t *_f = *f;
+
+  if (_f->fh != nullptr)
+    _staged_file_write(_f);
+
+  if (_f->invalidate_local)
+    _local_tier_remove_markers();
+
+  BFT_FREE(_f->sections);
+  BFT_FREE(_f->name);
+
+  BFT_FREE(*f);
+}
+
+/*----------------------------------------------------------------------------
+ * Background thread writing staged files.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_worker(void)
+{
+  std::unique_lock<std::mutex> lock(_async_mutex);
+
+  while (true) {
+
+    _async_cv.wait(lock, []{ return _async_stop || !_async_queue.empty(); });
+
+    if (_async_queue.empty())  /* stop requested and nothing left to do */
+      break;
+
+    _async_current = _async_queue.front();
+    _async_queue.pop_front();
+
+    lock.unlock();
+
+    double t0 = cs_timer_wtime();
+    _staged_file_write(_async_current);
+    double t1 = cs_timer_wtime();
+
+    lock.lock();
+
+    _checkpoint_async_wtime += t1 - t0;
+    _staged_file_destroy(&_async_current);
+
+    _async_cv.notify_all();
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a file (or any file) is pending asynchronous writing.
+ *
+ * The asynchronous writing mutex must be locked by the caller.
+ *
+ * parameters:
+ *   name <-- file name, or nullptr for any file
+ *
+ * returns:
+ *   true if writing of the file is pending.
+ *----------------------------------------------------------------------------*/
+
+static bool
+_async_pending(const char  *name)
+{
+  if (_async_current != nullptr) {
+    if (name == nullptr || strcmp(_async_current->name, name) == 0)
+      return true;
+  }
+  for (auto f : _async_queue) {
+    if (name == nullptr || strcmp(f->name, name) == 0)
+      return true;
+  }
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of asynchronous writing of a file (or all files).
+ *
+ * parameters:
+ *   name <-- file name, or nullptr for all files
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_wait(const char  *name)
+{
+  std::unique_lock<std::mutex> lock(_async_mutex);
+  _async_cv.wait(lock, [name]{ return !_async_pending(name); });
+}
+
+/*----------------------------------------------------------------------------
+ * Hand a staged file over to the background writing thread.
+ *
+ * parameters:
+ *   f <-- staged file structure (ownership transferred)
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_submit(_staged_file_t  *f)
+{
+  std::unique_lock<std::mutex> lock(_async_mutex);
+
+  if (_async_thread.joinable() == false) {
+    _async_stop = false;
+    _async_thread = std::thread(_async_worker);
+  }
+
+  _async_queue.push_back(f);
+  _async_cv.notify_all();
+}
+
+/*----------------------------------------------------------------------------
+ * Complete asynchronous writing and stop the background thread.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_finalize(void)
+{
+  if (_async_thread.joinable() == false)
+    return;
+
+  {
+    std::unique_lock<std::mutex> lock(_async_mutex);
+    _async_stop = true;
+    _async_cv.notify_all();
+  }
+
+  _async_thread.join();
+}
+
+/*----------------------------------------------------------------------------
+ * Free files of an in-memory checkpoint store entry.
+ *
+ * parameters:
+ *   c <-> pointer to store entry
+ *----------------------------------------------------------------------------*/
+
+static void
+_store_clear(_stored_checkpoint_t  *c)
+{
+  for (int i = 0; i < c->n_files; i++) {
+    if (c->files[i].in_use)
+      bft_error(__FILE__, __LINE__, 0,
+                _("In-memory checkpoint \"%s\" file \"%s\" is still in use."),
+                c->name, c->files[i].name);
+    BFT_FREE(c->files[i].name);
+    BFT_FREE(c->files[i].data);
+  }
+  BFT_FREE(c->files);
+  c->n_files = 0;
+  BFT_FREE(c->name);
+}
+
+/*----------------------------------------------------------------------------
+ * Call cleanup operations for checkpoint/restart subsystem.
+ *----------------------------------------------------------------------------*/
+
+static void
+_restart_finalize(void)
+{
+  _async_finalize();
+
+  if (_checkpoint_serialized_memory != nullptr)
+    cs_io_finalize(&_checkpoint_serialized_memory);
+  if (_restart_serialized_memory != nullptr)
+    cs_io_finalize(&_restart_serialized_memory);
+
+  for (int i = 0; i < _n_stored_checkpoints; i++)
+    _store_clear(_stored_checkpoints + i);
+  BFT_FREE(_stored_checkpoints);
+  _n_stored_checkpoints = 0;
+  _checkpoint_store_id = -1;
+  _restart_store_id = -1;
+
+  for (int i = 0; i < _n_compress_tolerances; i++)
+    BFT_FREE(_compress_tolerance_name[i]);
+  BFT_FREE(_compress_tolerance_name);
+  BFT_FREE(_compress_tolerance);
+  _n_compress_tolerances = 0;
+
+  BFT_FREE(_local_tier_path);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute number of values in a record
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   location_id     <-- location id
+ *   n_location_vals <-- number of values per location
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_compute_n_ents(const cs_restart_t  *r,
+                size_t               location_id,
+                size_t               n_location_vals)
+{
+  cs_gnum_t retval = 0;
+
+  if (location_id == 0)
+    retval = n_location_vals;
+
+  else if (location_id > 0 && location_id <= r->n_locations)
+    retval =   r->location[location_id-1].n_glob_ents_f
+             * (cs_gnum_t)n_location_vals;
+
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("Location number %d given for restart file\n"
+                "\"%s\" is not valid."),
+              (int)location_id, r->name);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Analyze the content of a restart file to build locations
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_locations_from_index(cs_restart_t  *r)
+{
+  cs_io_sec_header_t h;
+
+  size_t rec_id = 0;
+  size_t index_size = 0;
+
+  /* Initialization */
+
+  index_size = cs_io_get_index_size(r->fh);
+
+  /* Analyze records to determine locations */
+
+  for (rec_id = 0; rec_id < index_size; rec_id++) {
+
+    h = cs_io_get_indexed_sec_header(r->fh, rec_id);
+
+    if (h.location_id > r->n_locations) {
+
+      _location_t  *loc = nullptr;
+
+      if (h.location_id != r->n_locations + 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Restart file \"%s\" declares a location number %d\n"
+                    "but no location %d has been declared."),
+                  r->name, (int)(h.location_id),
+                  (int)(r->n_locations + 1));
+
+      BFT_REALLOC(r->location, r->n_locations + 1, _location_t);
+
+      loc = r->location + r->n_locations;
+      BFT_MALLOC(loc->name, strlen(h.sec_name) + 1, char);
+      strcpy(loc->name, h.sec_name);
+
+      loc->id = h.location_id;
+      loc->n_ents = 0;
+      loc->n_glob_ents = 0;
+
+      cs_io_set_indexed_position(r->fh, &h, rec_id);
+      cs_io_set_cs_gnum(&h, r->fh);
+      cs_io_read_global(&h, &(loc->n_glob_ents_f), r->fh);
+
+      loc->ent_global_num = nullptr;
+      loc->_ent_global_num = nullptr;
+#if defined(HAVE_MPI)
+      loc->read_d = nullptr;
+#endif
+
+      r->n_locations += 1;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return id of an in-memory checkpoint store entry.
+ *
+ * parameters:
+ *   name <-- checkpoint name
+ *
+ * returns:
+ *   id of matching entry, or -1 if not present
+ *----------------------------------------------------------------------------*/
+
+static int
+_store_id(const char  *name)
+{
+  for (int i = 0; i < _n_stored_checkpoints; i++) {
+    const char *c_name = _stored_checkpoints[i].name;
+    if (c_name != nullptr && strcmp(c_name, name) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Return id of a file in an in-memory checkpoint store entry.
+ *
+ * parameters:
+ *   c    <-- pointer to store entry
+ *   name <-- file name
+ *
+ * returns:
+ *   id of matching file, or -1 if not present
+ *----------------------------------------------------------------------------*/
+
+static int
+_store_file_id(const _stored_checkpoint_t  *c,
+               const char                  *name)
+{
+  for (int i = 0; i < c->n_files; i++) {
+    if (strcmp(c->files[i].name, name) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Open a restart or checkpoint file in an in-memory checkpoint store entry.
+ *
+ * In read mode, the stored data is used directly (not copied) until the
+ * file is closed, so any number of successive restarts may share it.
+ *
+ * parameters:
+ *   r        <-> associated restart file pointer
+ *   store_id <-- id of store entry
+ *   name     <-- file name (relative to checkpoint or restart directory)
+ *----------------------------------------------------------------------------*/
+
+static void
+_store_open(cs_restart_t  *r,
+            int            store_id,
+            const char    *name)
+{
+  const char magic_string[] = "Checkpoint / restart, R0";
+  const long echo = CS_IO_ECHO_NONE;
+
+  _stored_checkpoint_t *c = _stored_checkpoints + store_id;
+
+  int f_id = _store_file_id(c, name);
+
+  if (r->mode == CS_RESTART_MODE_READ) {
+
+    /* Check for file without extension, as for files on disk */
+
+    if (f_id < 0 && cs_file_endswith(name, ".csc")) {
+      size_t l = strlen(name) - 4;
+      for (int i = 0; i < c->n_files && f_id < 0; i++) {
+        if (   strlen(c->files[i].name) == l
+            && strncmp(c->files[i].name, name, l) == 0)
+          f_id = i;
+      }
+    }
+
+    if (f_id < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("File \"%s\" is not present in in-memory checkpoint \"%s\"."),
+                name, c->name);
+
+  }
+  else {
+
+    if (f_id < 0) {
+      f_id = c->n_files;
+      c->n_files += 1;
+      BFT_REALLOC(c->files, c->n_files, _stored_file_t);
+      BFT_MALLOC(c->files[f_id].name, strlen(name) + 1, char);
+      strcpy(c->files[f_id].name, name);
+      c->files[f_id].nb = 0;
+      c->files[f_id].data = nullptr;
+      c->files[f_id].in_use = false;
+    }
+    else if (c->files[f_id].in_use == false)
+      BFT_FREE(c->files[f_id].data);
+
+  }
+
+  _stored_file_t *f = c->files + f_id;
+
+  if (f->in_use)
+    bft_error(__FILE__, __LINE__, 0,
+              _("In-memory checkpoint \"%s\" file \"%s\" is already in use."),
+              c->name, f->name);
+
+  f->in_use = true;
+
+  r->store_id = store_id;
+  r->store_file_id = f_id;
+  r->rank_step = 1;
+  r->min_block_size = cs_parall_get_min_coll_buf_size();
+
+  /* Values are rank-local, so no communicator is used */
+
+#if defined(HAVE_MPI)
+
+  if (r->mode == CS_RESTART_MODE_READ) {
+    r->fh = cs_io_initialize_with_index_from_mem(f->name,
+                                                 magic_string,
+                                                 CS_FILE_IN_MEMORY_SERIAL,
+                                                 echo,
+                                                 f->nb, f->data,
+                                                 MPI_COMM_NULL,
+                                                 MPI_COMM_NULL);
+    _locations_from_index(r);
+  }
+  else
+    r->fh = cs_io_initialize(f->name,
+                             magic_string,
+                             CS_IO_MODE_WRITE,
+                             CS_FILE_IN_MEMORY_SERIAL,
+                             echo,
+                             MPI_INFO_NULL,
+                             MPI_COMM_NULL,
+                             MPI_COMM_NULL);
+
+#else
+
+  if (r->mode == CS_RESTART_MODE_READ) {
+    r->fh = cs_io_initialize_with_index_from_mem(f->name,
+                                                 magic_string,
+                                                 CS_FILE_IN_MEMORY_SERIAL,
+                                                 echo,
+                                                 f->nb, f->data);
+    _locations_from_index(r);
+  }
+  else
+    r->fh = cs_io_initialize(f->name,
+                             magic_string,
+                             CS_IO_MODE_WRITE,
+                             CS_FILE_IN_MEMORY_SERIAL,
+                             echo);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Close a restart or checkpoint file of the in-memory checkpoint store,
+ * returning its data to the store.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_store_close(cs_restart_t  *r)
+{
+  _stored_checkpoint_t *c = _stored_checkpoints + r->store_id;
+  _stored_file_t *f = c->files + r->store_file_id;
+
+  cs_io_finalize_to_mem(&(r->fh), &(f->nb), &(f->data));
+
+  f->in_use = false;
+
+  r->store_id = -1;
+  r->store_file_id = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize a checkpoint / restart file management structure;
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_file(cs_restart_t  *r)
+{
+  double timing[2];
+  cs_file_access_t method;
+
+  const char magic_string[] = "Checkpoint / restart, R0";
+  const long echo = CS_IO_ECHO_NONE;
+
+  timing[0] = cs_timer_wtime();
+
+  /* In read mode, open file to detect header first */
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info           hints;
+    MPI_Comm           block_comm, comm;
+
+    cs_file_get_default_comm(nullptr, &block_comm, &comm);
+
+    r->rank_step = 1;
+    r->min_block_size = cs_parall_get_min_coll_buf_size();
+    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+
+    if (r->mode == CS_RESTART_MODE_READ) {
+      cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+      if (r->local) {
+        method = CS_FILE_STDIO_SERIAL;
+        hints = MPI_INFO_NULL;
+        block_comm = MPI_COMM_NULL;
+        comm = MPI_COMM_NULL;
+      }
+      r->fh = cs_io_initialize_with_index(r->name,
+                                          magic_string,
+                                          method,
+                                          echo,
+                                          hints,
+                                          block_comm,
+                                          comm);
+      _locations_from_index(r);
+    }
+    else {
+      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+      if (r->staged != nullptr) {
+        block_comm = r->staged->block_comm;
+        comm = r->staged->comm;
+      }
+      else if (r->local) {
+        method = CS_FILE_STDIO_SERIAL;
+        hints = MPI_INFO_NULL;
+        block_comm = MPI_COMM_NULL;
+        comm = MPI_COMM_NULL;
+      }
+      r->fh = cs_io_initialize(r->name,
+                               magic_string,
+                               CS_IO_MODE_WRITE,
+                               method,
+                               echo,
+                               hints,
+                               block_comm,
+                               comm);
+    }
+  }
+#else
+  {
+    if (r->mode == CS_RESTART_MODE_READ) {
+      cs_file_get_default_access(CS_FILE_MODE_READ, &method);
+      r->fh = cs_io_initialize_with_index(r->name,
+                                          magic_string,
+                                          method,
+                                          echo);
+      _locations_from_index(r);
+    }
+    else {
+      cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+      r->fh = cs_io_initialize(r->name,
+                               magic_string,
+                               CS_IO_MODE_WRITE,
+                               method,
+                               echo);
+    }
+  }
+#endif
+
+  timing[1] = cs_timer_wtime();
+  _restart_wtime[r->mode] += timing[1] - timing[0];
+
+  _restart_n_opens[r->mode] += 1;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Compute block distribution used to read values defined on a mesh location.
+ *
+ * parameters:
+ *   r            <-- associated restart file pointer
+ *   n_glob_ents  <-- global number of entities
+ *   nbr_byte_ent <-- number of bytes per entity
+ *
+ * returns:
+ *   block distribution info
+ *----------------------------------------------------------------------------*/
+
+static cs_block_dist_info_t
+_read_block_dist(const cs_restart_t  *r,
+                 cs_gnum_t            n_glob_ents,
+                 size_t               nbr_byte_ent)
+{
+  return cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                     cs_glob_n_ranks,
+                                     r->rank_step,
+                                     r->min_block_size / nbr_byte_ent,
+                                     n_glob_ents);
+}
+
+/*----------------------------------------------------------------------------
+ * Free the cached read distributor of a location, if present.
+ *
+ * parameters:
+ *   loc <-> pointer to location structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_location_reset_read_dist(_location_t  *loc)
+{
+  if (loc->read_d != nullptr)
+    cs_all_to_all_destroy(&(loc->read_d));
+}
+
+/*----------------------------------------------------------------------------
+ * Read a section block on the secondary file handle.
+ *
+ * This function is run by the read-ahead thread, so it only uses the
+ * restart file's secondary handle (with private communicators).
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ahead_worker(void)
+{
+  cs_io_t *fh = _read_ahead.r->fh_ra;
+  cs_io_sec_header_t *header = &(_read_ahead.header);
+
+  cs_io_set_indexed_position(fh, header, _read_ahead.rec_id);
+
+  if (sizeof(cs_real_t) != cs_datatype_size[header->elt_type]) {
+    if (sizeof(cs_real_t) == cs_datatype_size[CS_FLOAT])
+      header->elt_type = CS_FLOAT;
+    else
+      header->elt_type = CS_DOUBLE;
+  }
+
+  cs_io_read_block(header,
+                   _read_ahead.bi.gnum_range[0],
+                   _read_ahead.bi.gnum_range[1],
+                   _read_ahead.buffer,
+                   fh);
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of the current section read-ahead, and transfer
+ * its values if they match the requested section.
+ *
+ * Non-matching values are discarded.
+ *
+ * parameters:
+ *   r      <-- associated restart file pointer
+ *   rec_id <-- index id of requested section
+ *   bi     <-- block distribution of requested section
+ *   buffer --> pointer to block values (to be freed by caller)
+ *
+ * returns:
+ *   true if values were read ahead, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_read_ahead_take(const cs_restart_t          *r,
+                 size_t                       rec_id,
+                 const cs_block_dist_info_t  *bi,
+                 cs_byte_t                  **buffer)
+{
+  bool retval = false;
+
+  if (_read_ahead_thread.joinable())
+    _read_ahead_thread.join();
+
+  if (   _read_ahead.r == r
+      && _read_ahead.rec_id == rec_id
+      && _read_ahead.bi.block_size == bi->block_size
+      && _read_ahead.bi.rank_step == bi->rank_step) {
+    *buffer = _read_ahead.buffer;
+    _read_ahead.buffer = nullptr;
+    retval = true;
+  }
+
+  BFT_FREE(_read_ahead.buffer);
+  _read_ahead.r = nullptr;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Start reading ahead the next section defined on a distributed mesh
+ * location, following a given section in the file's index.
+ *
+ * All ranks select the same section based on the (global) index, so
+ * the read-ahead thread's collective operations match.
+ *
+ * parameters:
+ *   r      <-> associated restart file pointer
+ *   rec_id <-- index id of current section
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ahead_start(cs_restart_t  *r,
+                  size_t         rec_id)
+{
+  if (   _restart_read_ahead == false
+      || r->local
+      || r->fh == _restart_serialized_memory)
+    return;
+
+  /* Find next real-valued section on a defined location */
+
+  cs_io_sec_header_t header;
+  const _location_t *loc = nullptr;
+
+  size_t index_size = cs_io_get_index_size(r->fh);
+  size_t next_id = rec_id + 1;
+
+  for (; next_id < index_size; next_id++) {
+    header = cs_io_get_indexed_sec_header(r->fh, next_id);
+    if (   header.location_id < 1
+        || header.location_id > r->n_locations
+        || (header.elt_type != CS_FLOAT && header.elt_type != CS_DOUBLE))
+      continue;
+    loc = r->location + header.location_id - 1;
+    if (loc->n_glob_ents > 0 && loc->n_glob_ents_f == loc->n_glob_ents)
+      break;
+  }
+
+  if (next_id >= index_size)
+    return;
+
+  /* Open secondary file handle on first use */
+
+  if (r->fh_ra == nullptr) {
+
+    const char magic_string[] = "Checkpoint / restart, R0";
+
+    cs_file_access_t   method;
+    MPI_Info           hints;
+    MPI_Comm           block_comm, comm;
+
+    cs_file_get_default_comm(nullptr, &block_comm, &comm);
+    cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+
+    if (comm != MPI_COMM_NULL)
+      MPI_Comm_dup(comm, &(r->ra_comm));
+    if (block_comm == comm)
+      r->ra_block_comm = r->ra_comm;
+    else if (block_comm != MPI_COMM_NULL)
+      MPI_Comm_dup(block_comm, &(r->ra_block_comm));
+
+    r->fh_ra = cs_io_initialize_with_index(r->name,
+                                           magic_string,
+                                           method,
+                                           CS_IO_ECHO_NONE,
+                                           hints,
+                                           r->ra_block_comm,
+                                           r->ra_comm);
+    cs_io_disable_log(r->fh_ra);
+
+  }
+
+  /* Prepare buffer and start reading */
+
+  size_t n_loc_vals = (header.n_location_vals > 0) ? header.n_location_vals : 1;
+  size_t nbr_byte_ent = n_loc_vals * sizeof(cs_real_t);
+
+  _read_ahead.r = r;
+  _read_ahead.rec_id = next_id;
+  _read_ahead.header = header;
+  _read_ahead.bi = _read_block_dist(r, loc->n_glob_ents, nbr_byte_ent);
+
+  size_t block_buf_size
+    = (  _read_ahead.bi.gnum_range[1]
+       - _read_ahead.bi.gnum_range[0]) * nbr_byte_ent;
+
+  BFT_MALLOC(_read_ahead.buffer, block_buf_size, cs_byte_t);
+
+  _read_ahead_thread = std::thread(_read_ahead_worker);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete read-ahead associated with a restart file and close its
+ * secondary file handle.
+ *
+ * parameters:
+ *   r <-> associated restart file pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ahead_close(cs_restart_t  *r)
+{
+  if (_read_ahead.r == r) {
+    if (_read_ahead_thread.joinable())
+      _read_ahead_thread.join();
+    BFT_FREE(_read_ahead.buffer);
+    _read_ahead.r = nullptr;
+  }
+
+  if (r->fh_ra != nullptr)
+    cs_io_finalize(&(r->fh_ra));
+
+  if (r->ra_block_comm != r->ra_comm && r->ra_block_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(r->ra_block_comm));
+  if (r->ra_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(r->ra_comm));
+  r->ra_block_comm = MPI_COMM_NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Read variable values defined on a mesh location.
+ *
+ * The block to entities distributor is cached with the location, so it
+ * is built only once for all sections of a given location. If read-ahead
+ * is active, the next section's block is read by a background thread
+ * while the current section's values are distributed.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   header          <-- header associated with current position in file
+ *   rec_id          <-- index id of section
+ *   location_id     <-- id of corresponding location
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering)
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_ent_values(cs_restart_t           *r,
+                 cs_io_sec_header_t     *header,
+                 size_t                  rec_id,
+                 int                     location_id,
+                 cs_gnum_t               n_glob_ents,
+                 cs_lnum_t               n_ents,
+                 const cs_gnum_t         ent_global_num[],
+                 int                     n_location_vals,
+                 cs_restart_val_type_t   val_type,
+                 cs_byte_t               vals[])
+{
+  cs_byte_t  *buffer = nullptr;
+
+  cs_lnum_t  block_buf_size = 0;
+
+  size_t  nbr_byte_ent;
+
+  _location_t *loc = r->location + location_id - 1;
+
+  /* Initialization */
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    nbr_byte_ent = n_location_vals;
+    break;
+  case CS_TYPE_int:
+    nbr_byte_ent = n_location_vals * sizeof(int);
+    cs_io_set_cs_lnum(header, r->fh);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_gnum_t);
+    cs_io_set_cs_gnum(header, r->fh);
+    break;
+  case CS_TYPE_cs_real_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
+    break;
+  default:
+    nbr_byte_ent = 0;
+    assert(0);
+  }
+
+  cs_block_dist_info_t bi = _read_block_dist(r, n_glob_ents, nbr_byte_ent);
+
+  /* Reuse the location's distributor if the block distribution matches
+     (block_size and rank_step are global, so all ranks decide alike) */
+
+  if (   loc->read_d != nullptr
+      && (   loc->read_bi.block_size != bi.block_size
+          || loc->read_bi.rank_step != bi.rank_step))
+    _location_reset_read_dist(loc);
+
+  if (loc->read_d == nullptr) {
+    loc->read_d = cs_all_to_all_create_from_block(n_ents,
+                                                  CS_ALL_TO_ALL_USE_DEST_ID,
+                                                  ent_global_num,
+                                                  bi,
+                                                  cs_glob_mpi_comm);
+    loc->read_bi = bi;
+  }
+
+  /* Use values read ahead if available; otherwise, read blocks
+     (directly from a memory-mapped file if possible) */
+
+  const void *block_vals = nullptr;
+
+  if (_read_ahead_take(r, rec_id, &bi, &buffer))
+    block_vals = buffer;
+
+  else if (cs_io_read_block_view(header,
+                                 bi.gnum_range[0],
+                                 bi.gnum_range[1],
+                                 &block_vals,
+                                 r->fh) == false) {
+
+    block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+
+    if (block_buf_size > 0)
+      BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+
+    cs_io_read_block(header,
+                     bi.gnum_range[0],
+                     bi.gnum_range[1],
+                     buffer,
+                     r->fh);
+
+    block_vals = buffer;
+
+  }
+
+  /* Read next section in the background while distributing this one */
+
+  _read_ahead_start(r, rec_id);
+
+  /* Distribute blocks on ranks */
+
+  cs_all_to_all_copy_array(loc->read_d,
+                           header->elt_type,
+                           n_location_vals,
+                           true,  /* reverse */
+                           block_vals,
+                           vals);
+
+  /* Free buffer */
+
+  BFT_FREE(buffer);
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute variable values defined on a mesh location to blocks.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering)
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            <-- array of values
+ *   gnum_range      --> global number range of local block
+ *
+ * returns:
+ *   pointer to allocated block values
+ *----------------------------------------------------------------------------*/
+
+static cs_byte_t *
+_part_to_block_values(const cs_restart_t     *r,
+                      cs_gnum_t               n_glob_ents,
+                      cs_lnum_t               n_ents,
+                      const cs_gnum_t        *ent_global_num,
+                      int                     n_location_vals,
+                      cs_restart_val_type_t   val_type,
+                      const cs_byte_t        *vals,
+                      cs_gnum_t               gnum_range[2])
+{
+  cs_lnum_t  block_buf_size = 0;
+
+  cs_datatype_t elt_type     = CS_DATATYPE_NULL;
+  size_t      nbr_byte_ent = 0;
+  cs_byte_t  *buffer = nullptr;
+
+  cs_block_dist_info_t bi;
+
+  cs_part_to_block_t *d = nullptr;
+
+  /* Initialization */
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    nbr_byte_ent = n_location_vals;
+    elt_type = CS_CHAR;
+    break;
+  case CS_TYPE_int:
+    nbr_byte_ent = n_location_vals * sizeof(int);
+    elt_type = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+    break;
+  case CS_TYPE_cs_gnum_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_gnum_t);
+    elt_type = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+    break;
+  case CS_TYPE_cs_real_t:
+    nbr_byte_ent = n_location_vals * sizeof(cs_real_t);
+    elt_type =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
+               ? CS_DOUBLE : CS_FLOAT;
+    break;
+  default:
+    assert(0);
+  }
+
+  bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                   cs_glob_n_ranks,
+                                   r->rank_step,
+                                   r->min_block_size / nbr_byte_ent,
+                                   n_glob_ents);
+
+  d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                      bi,
+                                      n_ents,
+                                      ent_global_num);
+
+  /* Distribute to blocks */
+
+  block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+
+  if (block_buf_size > 0)
+    BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+
+  /* Distribute blocks on ranks */
+
+  cs_part_to_block_copy_array(d,
+                              elt_type,
+                              n_location_vals,
+                              vals,
+                              buffer);
+
+  cs_part_to_block_destroy(&d);
+
+  gnum_range[0] = bi.gnum_range[0];
+  gnum_range[1] = bi.gnum_range[1];
+
+  return buffer;
+}
+
+/*----------------------------------------------------------------------------
+ * Write variable values defined on a mesh location.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering)
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            --> array of values
+ *
+ * If the restart file is staged for asynchronous writing, the block
+ * values are staged instead of being written.
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_ent_values(const cs_restart_t     *r,
+                  const char             *sec_name,
+                  cs_gnum_t               n_glob_ents,
+                  cs_lnum_t               n_ents,
+                  const cs_gnum_t        *ent_global_num,
+                  int                     location_id,
+                  int                     n_location_vals,
+                  cs_restart_val_type_t   val_type,
+                  const cs_byte_t        *vals)
+{
+  cs_datatype_t elt_type = CS_DATATYPE_NULL;
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    elt_type = CS_CHAR;
+    break;
+  case CS_TYPE_int:
+    elt_type = (sizeof(int) == 8) ? CS_INT64 : CS_INT32;
+    break;
+  case CS_TYPE_cs_gnum_t:
+    elt_type = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+    break;
+  case CS_TYPE_cs_real_t:
+    elt_type =   (sizeof(cs_real_t) == cs_datatype_size[CS_DOUBLE])
+               ? CS_DOUBLE : CS_FLOAT;
+    break;
+  default:
+    assert(0);
+  }
+
+  cs_gnum_t gnum_range[2];
+
+  cs_byte_t *buffer = _part_to_block_values(r,
+                                            n_glob_ents,
+                                            n_ents,
+                                            ent_global_num,
+                                            n_location_vals,
+                                            val_type,
+                                            vals,
+                                            gnum_range);
+
+  /* Write or stage blocks */
+
+  if (r->staged != nullptr)
+    _staged_file_add_section(r->staged,
+                             sec_name,
+                             false,
+                             n_glob_ents,
+                             gnum_range,
+                             location_id,
+                             n_location_vals,
+                             elt_type,
+                             buffer);
+
+  else {
+    cs_io_write_block_buffer(sec_name,
+                             n_glob_ents,
+                             gnum_range[0],
+                             gnum_range[1],
+                             location_id,
+                             0,
+                             n_location_vals,
+                             elt_type,
+                             buffer,
+                             r->fh);
+
+    BFT_FREE(buffer);
+  }
+}
+
+#endif /* #if defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Swap values of a renumbered array when reading
+ *
+ * parameters:
+ *   n_ents          --> number of local entities
+ *   ini_ent_num     --> initial entity numbers
+ *   n_location_vals --> number of values per entity
+ *   val_type        --> data type
+ *   vals            --> array of values
+ *----------------------------------------------------------------------------*/
+
+static void
+_restart_permute_read(cs_lnum_t               n_ents,
+                      const cs_gnum_t        *ini_ent_num,
+                      int                     n_location_vals,
+                      cs_restart_val_type_t   val_type,
+                      cs_byte_t              *vals)
+{
+  cs_lnum_t ent_id, jj;
+
+  cs_lnum_t ii = 0;
+
+  /* Instructions */
+
+  if (ini_ent_num == nullptr)
+    return;
+
+  switch (val_type) {
+
+  case CS_TYPE_char:
+    {
+      char  *val_ord;
+      char  *val_cur = (char *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, char);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[ii++]
+            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
+      }
+
+      for (ii = 0; ii < n_ents * n_location_vals; ii++)
+        val_cur[ii] = val_ord[ii];
+
+      BFT_FREE(val_ord);
+    }
+    break;
+
+  case CS_TYPE_int:
+    {
+      int  *val_ord;
+      int  *val_cur = (int *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, int);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[ii++]
+            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
+      }
+
+      for (ii = 0; ii < n_ents * n_location_vals; ii++)
+        val_cur[ii] = val_ord[ii];
+
+      BFT_FREE(val_ord);
+    }
+    break;
+
+  case CS_TYPE_cs_gnum_t:
+    {
+      cs_gnum_t  *val_ord;
+      cs_gnum_t  *val_cur = (cs_gnum_t *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_gnum_t);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[ii++]
+            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
+      }
+
+      for (ii = 0; ii < n_ents * n_location_vals; ii++)
+        val_cur[ii] = val_ord[ii];
+
+      BFT_FREE(val_ord);
+    }
+    break;
+
+  case CS_TYPE_cs_real_t:
+    {
+      cs_real_t  *val_ord;
+      cs_real_t  *val_cur = (cs_real_t *)vals;
+
+      BFT_MALLOC (val_ord, n_ents * n_location_vals, cs_real_t);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[ii++]
+            = val_cur[(ini_ent_num[ent_id] - 1) * n_location_vals + jj];
+      }
+
+      for (ii = 0; ii < n_ents * n_location_vals; ii++)
+        val_cur[ii] = val_ord[ii];
+
+      BFT_FREE(val_ord);
+    }
+    break;
+
+  default:
+    assert(0);
 
   }
 }
@@ -748,287 +2359,1375 @@ _restart_permute_read(cs_lnum_t               n_ents,
  * Swap values of a renumbered array when writing
  *
  * parameters:
- *   n_ents          --> number of local entities
- *   ini_ent_num     --> initial entity numbers
- *   n_location_vals --> number of values per entity
- *   val_type        --> data type
- *   vals            --> array of values
+ *   n_ents          --> number of local entities
+ *   ini_ent_num     --> initial entity numbers
+ *   n_location_vals --> number of values per entity
+ *   val_type        --> data type
+ *   vals            --> array of values
+ *
+ * returns:
+ *   pointer to array of values in initial entity order
+ *----------------------------------------------------------------------------*/
+
+static cs_byte_t *
+_restart_permute_write(cs_lnum_t               n_ents,
+                       const cs_gnum_t        *ini_ent_num,
+                       int                     n_location_vals,
+                       cs_restart_val_type_t   val_type,
+                       const cs_byte_t        *vals)
+{
+  cs_lnum_t  ent_id, jj;
+
+  cs_lnum_t  ii = 0;
+
+  /* Instructions */
+
+  if (ini_ent_num == nullptr)
+    return nullptr;
+
+  switch (val_type) {
+
+  case CS_TYPE_char:
+    {
+      char  *val_ord;
+      const char  *val_cur = (const char *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, char);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
+            = val_cur[ii++];
+      }
+
+      return (cs_byte_t *)val_ord;
+    }
+    break;
+
+  case CS_TYPE_int:
+    {
+      int  *val_ord;
+      const int  *val_cur = (const int *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, int);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
+            = val_cur[ii++];
+      }
+
+      return (cs_byte_t *)val_ord;
+    }
+    break;
+
+  case CS_TYPE_cs_gnum_t:
+    {
+      cs_gnum_t  *val_ord;
+      const cs_gnum_t  *val_cur = (const cs_gnum_t *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_gnum_t);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
+            = val_cur[ii++];
+      }
+
+      return (cs_byte_t *)val_ord;
+    }
+    break;
+
+  case CS_TYPE_cs_real_t:
+    {
+      cs_real_t  *val_ord;
+      const cs_real_t  *val_cur = (const cs_real_t *)vals;
+
+      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_real_t);
+
+      for (ent_id = 0; ent_id < n_ents; ent_id++) {
+        for (jj = 0; jj < n_location_vals; jj++)
+          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
+            = val_cur[ii++];
+      }
+
+      return (cs_byte_t *)val_ord;
+    }
+    break;
+
+  default:
+    assert(0);
+    return nullptr;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Find a given record in an indexed restart file.
+ *
+ * parameters:
+ *   restart   <-- associated restart file pointer
+ *   prefix    <-- prefix to name of record
+ *   name      <-- base name of record
+ *   postfix   <-- postfix to name of record
+ *
+ * returns:
+ *   the id assigned to the record, or -1 if not found
+ *----------------------------------------------------------------------------*/
+
+static int
+_restart_section_id(cs_restart_t     *restart,
+                    const char       *prefix,
+                    const char       *name,
+                    const char       *postfix)
+{
+  size_t index_size = cs_io_get_index_size(restart->fh);
+
+  char *_sec_name = nullptr;
+  const char *sec_name = name;
+
+  int rec_id = -1;
+
+  if (prefix != nullptr || postfix != nullptr) {
+
+
+    size_t sec_name_l = strlen(name);
+
+    if (prefix != nullptr)
+      sec_name_l += strlen(prefix);
+    if (postfix != nullptr)
+      sec_name_l += strlen(postfix);
+
+    BFT_MALLOC(_sec_name, sec_name_l + 1, char);
+    sec_name = _sec_name;
+
+    if (prefix != nullptr) {
+      strcpy(_sec_name, prefix);
+      strcat(_sec_name, name);
+    }
+    else
+      strcpy(_sec_name, name);
+
+    if (postfix != nullptr)
+      strcat(_sec_name, postfix);
+
+  }
+
+  /* Search for the record in the index */
+
+  for (rec_id = 0; rec_id < (int)index_size; rec_id++) {
+    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
+    if (strcmp(cmp_name, sec_name) == 0)
+      break;
+  }
+
+  if (rec_id >= (int)index_size) {
+    bft_printf(_("  %s: section \"%s\" not present.\n"),
+               restart->name, sec_name);
+    rec_id = -1;
+  }
+
+  BFT_FREE(_sec_name);
+
+  return rec_id;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Compute default particle destination rank array in case of untracked
+ * particles.
+ *
+ * For simplicity, those particles are simply distributed among ranks
+ * (as it is possible to define a global numbering based on a space-filling
+ * curve when generating the restart file, this may be made "geometrically"
+ * balanced also).
+ *
+ * parameters:
+ *   p_bi         <-- pointer to particles bock distribution info
+ *   p_cell_num   <-- global cell number associated with each particle
+ *                    (0 for untracked particles)
+ *   comm         <-- associated MPI communicator
+ *
+ * returns:
+ *   default rank array for particles (>= 0 for untracked particles)
+ *----------------------------------------------------------------------------*/
+
+static int *
+_default_p_rank(cs_block_dist_info_t  *p_bi,
+                const cs_gnum_t       *p_cell_num,
+                MPI_Comm               comm)
+{
+  cs_lnum_t i;
+  cs_block_dist_info_t free_particle_bi;
+
+  int n_ranks = 0, rank_id = -1;
+
+  cs_lnum_t _n_particles = 0, n_free_particles = 0;
+  cs_gnum_t _n_g_free_particles = 0, n_g_free_particles = 0;
+
+  cs_lnum_t *free_particle_ids = nullptr;
+
+  fvm_io_num_t *free_particle_io_num = nullptr;
+  const cs_gnum_t *free_particle_num = nullptr;
+
+  int *default_rank = nullptr;
+
+  /* Initialization */
+
+  assert((sizeof(cs_lnum_t) == 4) || (sizeof(cs_lnum_t) == 8));
+
+  /* Count number of untracked particles */
+
+  _n_particles = p_bi->gnum_range[1] - p_bi->gnum_range[0];
+  n_free_particles = 0;
+
+  for (i = 0; i < _n_particles; i++) {
+    if (p_cell_num[i] == 0)
+      n_free_particles += 1;
+  }
+
+  _n_g_free_particles = n_free_particles;
+  MPI_Allreduce(&_n_g_free_particles, &n_g_free_particles, 1,
+                CS_MPI_GNUM, MPI_SUM, comm);
+
+  /* Return if we do not have untracked particles */
+
+  if (n_g_free_particles == 0)
+    return nullptr;
+
+  /* Initialize rank info */
+
+  MPI_Comm_size(comm, &n_ranks);
+  MPI_Comm_size(comm, &rank_id);
+  free_particle_bi = cs_block_dist_compute_sizes(rank_id,
+                                                 n_ranks,
+                                                 0,
+                                                 0,
+                                                 n_g_free_particles);
+
+  /* Define distribution of untracked particles based on scan;
+   *
+   *  The main objective of this function
+   *  is to ensure some measure of load balancing. */
+
+  BFT_MALLOC(default_rank, _n_particles, int);
+  for (i = 0; i < _n_particles; i++)
+    default_rank[i] = -1;
+
+  BFT_MALLOC(free_particle_ids, n_free_particles, cs_lnum_t);
+
+  n_free_particles = 0;
+  for (i = 0; i < _n_particles; i++) {
+    if (p_cell_num[i] == 0)
+      free_particle_ids[n_free_particles++] = i;
+  }
+
+  free_particle_io_num = fvm_io_num_create_from_scan(n_free_particles);
+  free_particle_num = fvm_io_num_get_global_num(free_particle_io_num);
+
+  /* Determine rank based on global numbering */
+  for (i = 0; i < n_free_particles; i++) {
+    default_rank[free_particle_ids[i]]
+      =    ((free_particle_num[i] - 1) / free_particle_bi.block_size)
+         * free_particle_bi.rank_step;
+  }
+
+  free_particle_io_num = fvm_io_num_destroy(free_particle_io_num);
+  BFT_FREE(free_particle_ids);
+
+  return default_rank;
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Return the size of a value type.
+ *
+ * parameters:
+ *   val_type <-- data type
+ *
+ * returns:
+ *   size of given type, in bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_val_type_size(cs_restart_val_type_t  val_type)
+{
+  size_t retval = 0;
+
+  switch (val_type) {
+  case CS_TYPE_char:
+    retval = 1;
+    break;
+  case CS_TYPE_int:
+    retval = sizeof(int);
+    break;
+  case CS_TYPE_cs_gnum_t:
+    retval = sizeof(cs_gnum_t);
+    break;
+  case CS_TYPE_cs_real_t:
+    retval = sizeof(cs_real_t);
+    break;
+  default:
+    assert(0);
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the host is big-endian.
+ *
+ * returns:
+ *   true if the host is big-endian, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_host_is_big_endian(void)
+{
+  const unsigned int x = 1;
+
+  return (*((const unsigned char *)&x) == 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Shuffle bytes of an array so that bytes of same significance are
+ * contiguous (least significant bytes first, independently of the
+ * host's endianness), which usually improves compression.
+ *
+ * parameters:
+ *   n_elts   <-- number of elements
+ *   elt_size <-- element size
+ *   src      <-- source array
+ *   dest     --> shuffled array
+ *----------------------------------------------------------------------------*/
+
+static void
+_byte_shuffle(size_t                n_elts,
+              size_t                elt_size,
+              const unsigned char  *src,
+              unsigned char        *dest)
+{
+  const bool big_endian = _host_is_big_endian();
+
+  for (size_t j = 0; j < elt_size; j++) {
+    const size_t k = (big_endian) ? elt_size - 1 - j : j;
+    unsigned char *_dest = dest + j*n_elts;
+    for (size_t i = 0; i < n_elts; i++)
+      _dest[i] = src[i*elt_size + k];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Unshuffle bytes of an array shuffled by _byte_shuffle.
+ *
+ * parameters:
+ *   n_elts   <-- number of elements
+ *   elt_size <-- element size
+ *   src      <-- shuffled array
+ *   dest     --> unshuffled array
+ *----------------------------------------------------------------------------*/
+
+static void
+_byte_unshuffle(size_t                n_elts,
+                size_t                elt_size,
+                const unsigned char  *src,
+                unsigned char        *dest)
+{
+  const bool big_endian = _host_is_big_endian();
+
+  for (size_t j = 0; j < elt_size; j++) {
+    const size_t k = (big_endian) ? elt_size - 1 - j : j;
+    const unsigned char *_src = src + j*n_elts;
+    for (size_t i = 0; i < n_elts; i++)
+      dest[i*elt_size + k] = _src[i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return the absolute error tolerance defined for lossy compression
+ * of a given section.
+ *
+ * A tolerance defined for a given name applies to sections of the same
+ * name, or whose name starts with that name followed by "::".
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *
+ * returns:
+ *   tolerance, or -1 if not defined
+ *----------------------------------------------------------------------------*/
+
+static double
+_section_tolerance(const char  *sec_name)
+{
+  double tolerance = -1;
+
+  for (int i = 0; i < _n_compress_tolerances; i++) {
+    const char *name = _compress_tolerance_name[i];
+    size_t l = strlen(name);
+    if (   strncmp(sec_name, name, l) == 0
+        && (sec_name[l] == '\0' || strncmp(sec_name + l, "::", 2) == 0))
+      tolerance = _compress_tolerance[i];
+  }
+
+  return tolerance;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the name of a section associated with a compressed section.
+ *
+ * parameters:
+ *   sec_name <-- base section name
+ *   suffix   <-- suffix ("::z_index" or "::z_data")
  *
  * returns:
- *   pointer to array of values in initial entity order
+ *   pointer to allocated name
  *----------------------------------------------------------------------------*/
 
-static cs_byte_t *
-_restart_permute_write(cs_lnum_t               n_ents,
-                       const cs_gnum_t        *ini_ent_num,
-                       int                     n_location_vals,
-                       cs_restart_val_type_t   val_type,
-                       const cs_byte_t        *vals)
+static char *
+_compressed_section_name(const char  *sec_name,
+                         const char  *suffix)
 {
-  cs_lnum_t  ent_id, jj;
+  char *name;
+  BFT_MALLOC(name, strlen(sec_name) + strlen(suffix) + 1, char);
 
-  cs_lnum_t  ii = 0;
+  strcpy(name, sec_name);
+  strcat(name, suffix);
 
-  /* Instructions */
+  return name;
+}
 
-  if (ini_ent_num == nullptr)
+/*----------------------------------------------------------------------------
+ * Quantize floating-point values using a given step, and encode them as
+ * zigzag-encoded differences with the previous entity's value.
+ *
+ * parameters:
+ *   n_vals   <-- number of values
+ *   stride   <-- number of values per entity
+ *   elt_type <-- element type (CS_FLOAT or CS_DOUBLE)
+ *   quantum  <-- quantization step
+ *   vals     <-- values
+ *   q        --> encoded values
+ *
+ * returns:
+ *   true if all values could be quantized, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_quantize(size_t            n_vals,
+          int               stride,
+          cs_datatype_t     elt_type,
+          double            quantum,
+          const cs_byte_t  *vals,
+          uint64_t         *q)
+{
+  const double q_max = 4503599627370496.; /* 2^52 */
+  const double inv_q = 1. / quantum;
+
+  bool retval = true;
+  int64_t *k = (int64_t *)q;
+
+  for (size_t i = 0; i < n_vals; i++) {
+    double v = (elt_type == CS_DOUBLE) ?
+      ((const double *)vals)[i] : ((const float *)vals)[i];
+    double vq = v * inv_q;
+    if (!(fabs(vq) < q_max)) {  /* also handles non-finite values */
+      retval = false;
+      break;
+    }
+    k[i] = llround(vq);
+  }
+
+  if (retval == false)
+    return retval;
+
+  size_t _stride = stride;
+
+  for (size_t i = n_vals; i > _stride; i--)
+    k[i-1] -= k[i-1-_stride];
+
+  for (size_t i = 0; i < n_vals; i++)
+    q[i] = ((uint64_t)k[i] << 1) ^ (uint64_t)(k[i] >> 63);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Decode values encoded by _quantize.
+ *
+ * parameters:
+ *   n_vals   <-- number of values
+ *   stride   <-- number of values per entity
+ *   elt_type <-- element type (CS_FLOAT or CS_DOUBLE)
+ *   quantum  <-- quantization step
+ *   q        <-> encoded values (overwritten)
+ *   vals     --> decoded values
+ *----------------------------------------------------------------------------*/
+
+static void
+_unquantize(size_t          n_vals,
+            int             stride,
+            cs_datatype_t   elt_type,
+            double          quantum,
+            uint64_t       *q,
+            cs_byte_t      *vals)
+{
+  int64_t *k = (int64_t *)q;
+
+  for (size_t i = 0; i < n_vals; i++)
+    k[i] = (int64_t)(q[i] >> 1) ^ -(int64_t)(q[i] & 1);
+
+  for (size_t i = stride; i < n_vals; i++)
+    k[i] += k[i-stride];
+
+  if (elt_type == CS_DOUBLE) {
+    double *_vals = (double *)vals;
+    for (size_t i = 0; i < n_vals; i++)
+      _vals[i] = k[i] * quantum;
+  }
+  else {
+    float *_vals = (float *)vals;
+    for (size_t i = 0; i < n_vals; i++)
+      _vals[i] = k[i] * quantum;
+  }
+}
+
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Shuffle and compress an array.
+ *
+ * parameters:
+ *   n_elts   <-- number of elements
+ *   elt_size <-- element size
+ *   src      <-- source array
+ *   z_size   --> size of compressed data
+ *
+ * returns:
+ *   pointer to allocated compressed data, or nullptr if empty
+ *----------------------------------------------------------------------------*/
+
+static cs_byte_t *
+_compress_buffer(size_t       n_elts,
+                 size_t       elt_size,
+                 const void  *src,
+                 size_t      *z_size)
+{
+  *z_size = 0;
+
+  if (n_elts == 0)
     return nullptr;
 
-  switch (val_type) {
+  size_t raw_size = n_elts*elt_size;
 
-  case CS_TYPE_char:
-    {
-      char  *val_ord;
-      const char  *val_cur = (const char *)vals;
+  unsigned char *shuffled;
+  BFT_MALLOC(shuffled, raw_size, unsigned char);
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, char);
+  _byte_shuffle(n_elts, elt_size, (const unsigned char *)src, shuffled);
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
-            = val_cur[ii++];
-      }
+  uLongf _z_size = compressBound(raw_size);
 
-      return (cs_byte_t *)val_ord;
-    }
-    break;
+  cs_byte_t *z;
+  BFT_MALLOC(z, _z_size, cs_byte_t);
 
-  case CS_TYPE_int:
-    {
-      int  *val_ord;
-      const int  *val_cur = (const int *)vals;
+  int ret = compress2((Bytef *)z, &_z_size, shuffled, raw_size,
+                      Z_BEST_SPEED);
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, int);
+  if (ret != Z_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error compressing checkpoint data: %s"), zError(ret));
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
-            = val_cur[ii++];
-      }
+  BFT_FREE(shuffled);
 
-      return (cs_byte_t *)val_ord;
+  BFT_REALLOC(z, _z_size, cs_byte_t);
+  *z_size = _z_size;
+
+  return z;
+}
+
+/*----------------------------------------------------------------------------
+ * Uncompress and unshuffle an array compressed by _compress_buffer.
+ *
+ * parameters:
+ *   n_elts   <-- number of elements
+ *   elt_size <-- element size
+ *   z_size   <-- size of compressed data
+ *   z        <-- compressed data
+ *   dest     --> uncompressed array
+ *----------------------------------------------------------------------------*/
+
+static void
+_uncompress_buffer(size_t            n_elts,
+                   size_t            elt_size,
+                   size_t            z_size,
+                   const cs_byte_t  *z,
+                   void             *dest)
+{
+  if (n_elts == 0)
+    return;
+
+  uLongf raw_size = n_elts*elt_size;
+
+  unsigned char *shuffled;
+  BFT_MALLOC(shuffled, raw_size, unsigned char);
+
+  int ret = uncompress(shuffled, &raw_size, (const Bytef *)z, z_size);
+
+  if (ret != Z_OK || raw_size != n_elts*elt_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error uncompressing checkpoint data: %s"),
+              (ret != Z_OK) ? zError(ret) : _("unexpected size"));
+
+  _byte_unshuffle(n_elts, elt_size, shuffled, (unsigned char *)dest);
+
+  BFT_FREE(shuffled);
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
+/*----------------------------------------------------------------------------
+ * Check whether a section should be compressed.
+ *
+ * parameters:
+ *   sec_name    <-- section name
+ *   location_id <-- id of corresponding location
+ *   n_glob_ents <-- global number of entities
+ *   elt_type    <-- element type
+ *   n_bytes     <-- global section size, in bytes
+ *   tolerance   --> absolute error tolerance, or -1 for lossless
+ *                   compression
+ *
+ * returns:
+ *   true if the section should be compressed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_compress_section(const char     *sec_name,
+                  int             location_id,
+                  cs_gnum_t       n_glob_ents,
+                  cs_datatype_t   elt_type,
+                  cs_gnum_t       n_bytes,
+                  double         *tolerance)
+{
+  *tolerance = -1;
+
+#if defined(HAVE_ZLIB)
+
+  if (location_id < 1 || n_glob_ents == 0 || n_bytes < _compress_min_size)
+    return false;
+
+  if (elt_type == CS_FLOAT || elt_type == CS_DOUBLE)
+    *tolerance = _section_tolerance(sec_name);
+
+  return (_compress_lossless || *tolerance > 0);
+
+#else
+
+  CS_UNUSED(sec_name);
+  CS_UNUSED(location_id);
+  CS_UNUSED(n_glob_ents);
+  CS_UNUSED(elt_type);
+  CS_UNUSED(n_bytes);
+
+  return false;
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Return values of a distributed section in global numbering order,
+ * for the block assigned to the local rank.
+ *
+ * parameters:
+ *   r               <-- associated restart file pointer
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering), or nullptr
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            <-- array of values
+ *   gnum_range      --> global number range of local block
+ *
+ * returns:
+ *   pointer to allocated block values
+ *----------------------------------------------------------------------------*/
+
+static cs_byte_t *
+_block_values(const cs_restart_t     *r,
+              cs_gnum_t               n_glob_ents,
+              cs_lnum_t               n_ents,
+              const cs_gnum_t        *ent_global_num,
+              int                     n_location_vals,
+              cs_restart_val_type_t   val_type,
+              const cs_byte_t        *vals,
+              cs_gnum_t               gnum_range[2])
+{
+  cs_byte_t  *block_vals = nullptr;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    return _part_to_block_values(r,
+                                 n_glob_ents,
+                                 n_ents,
+                                 ent_global_num,
+                                 n_location_vals,
+                                 val_type,
+                                 vals,
+                                 gnum_range);
+#else
+  CS_UNUSED(r);
+#endif
+
+  gnum_range[0] = 1;
+  gnum_range[1] = n_glob_ents + 1;
+
+  if (ent_global_num != nullptr)
+    block_vals = _restart_permute_write(n_ents,
+                                        ent_global_num,
+                                        n_location_vals,
+                                        val_type,
+                                        vals);
+  else {
+    size_t n_bytes = n_ents * n_location_vals * _val_type_size(val_type);
+    BFT_MALLOC(block_vals, n_bytes, cs_byte_t);
+    memcpy(block_vals, vals, n_bytes);
+  }
+
+  return block_vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a compressed section.
+ *
+ * Instead of a section named sec_name, two sections are written:
+ * - sec_name::z_index, defined on the section's location, contains
+ *   the format version, element type, encoding method (0 for lossless,
+ *   1 for quantized values), quantization step (as a 64-bit pattern),
+ *   the number of compressed chunks, and for each chunk, its global
+ *   number range and the byte offset and size of its compressed data.
+ * - sec_name::z_data contains the compressed chunks.
+ *
+ * Each rank's block (in global numbering order) is compressed as
+ * one chunk.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   gnum_range      <-- global number range of local block
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values par location
+ *   elt_type        <-- element type
+ *   tolerance       <-- absolute error tolerance, or -1 for lossless
+ *                       compression
+ *   block_vals      <-- block values (freed by this function)
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_compressed(cs_restart_t     *r,
+                  const char       *sec_name,
+                  const cs_gnum_t   gnum_range[2],
+                  int               location_id,
+                  int               n_location_vals,
+                  cs_datatype_t     elt_type,
+                  double            tolerance,
+                  cs_byte_t        *block_vals)
+{
+#if defined(HAVE_ZLIB)
+
+  const int n_ranks = cs_glob_n_ranks;
+  const size_t n_vals = (gnum_range[1] - gnum_range[0]) * n_location_vals;
+
+  /* Quantize values if possible; all ranks must use the same method */
+
+  int method = 0;
+  double quantum = 0.;
+  uint64_t *q = nullptr;
+
+  if (tolerance > 0) {
+    quantum = 2.*tolerance;
+    BFT_MALLOC(q, n_vals, uint64_t);
+    int q_ok = _quantize(n_vals, n_location_vals, elt_type, quantum,
+                         block_vals, q);
+    cs_parall_min(1, CS_INT_TYPE, &q_ok);
+    if (q_ok)
+      method = 1;
+    else {
+      quantum = 0.;
+      BFT_FREE(q);
     }
-    break;
+  }
 
-  case CS_TYPE_cs_gnum_t:
-    {
-      cs_gnum_t  *val_ord;
-      const cs_gnum_t  *val_cur = (const cs_gnum_t *)vals;
+  size_t z_size = 0;
+  cs_byte_t *z = nullptr;
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_gnum_t);
+  if (method == 1)
+    z = _compress_buffer(n_vals, sizeof(uint64_t), q, &z_size);
+  else
+    z = _compress_buffer(n_vals, cs_datatype_size[elt_type], block_vals,
+                         &z_size);
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
-            = val_cur[ii++];
-      }
+  BFT_FREE(q);
+  BFT_FREE(block_vals);
 
-      return (cs_byte_t *)val_ord;
+  /* Build index */
+
+  uint64_t chunk[4] = {gnum_range[0], gnum_range[1], 0, z_size};
+  uint64_t z_tot = z_size;
+
+  const size_t idx_size = 5 + 4*n_ranks;
+  uint64_t *idx;
+  BFT_MALLOC(idx, idx_size, uint64_t);
+
+  idx[0] = 1;
+  idx[1] = elt_type;
+  idx[2] = method;
+  memcpy(idx + 3, &quantum, sizeof(uint64_t));
+  idx[4] = n_ranks;
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1) {
+    uint64_t z_offset = 0;
+    MPI_Exscan(&z_tot, &z_offset, 1, MPI_UINT64_T, MPI_SUM,
+               cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      z_offset = 0;
+    chunk[2] = z_offset;
+    MPI_Allreduce(MPI_IN_PLACE, &z_tot, 1, MPI_UINT64_T, MPI_SUM,
+                  cs_glob_mpi_comm);
+    MPI_Allgather(chunk, 4, MPI_UINT64_T, idx + 5, 4, MPI_UINT64_T,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  if (n_ranks == 1)
+    memcpy(idx + 5, chunk, 4*sizeof(uint64_t));
+
+  /* Write or stage sections */
+
+  char *idx_name = _compressed_section_name(sec_name, "::z_index");
+  char *z_name = _compressed_section_name(sec_name, "::z_data");
+
+  cs_gnum_t z_range[2] = {(cs_gnum_t)(chunk[2] + 1),
+                          (cs_gnum_t)(chunk[2] + z_size + 1)};
+
+  if (r->staged != nullptr) {
+    _staged_file_add_section(r->staged,
+                             idx_name,
+                             true,
+                             idx_size,
+                             nullptr,
+                             location_id,
+                             n_location_vals,
+                             CS_UINT64,
+                             (cs_byte_t *)idx);
+    _staged_file_add_section(r->staged,
+                             z_name,
+                             (n_ranks == 1),
+                             z_tot,
+                             z_range,
+                             0,
+                             1,
+                             CS_CHAR,
+                             z);
+  }
+
+  else {
+    cs_io_write_global(idx_name,
+                       idx_size,
+                       location_id,
+                       0,
+                       n_location_vals,
+                       CS_UINT64,
+                       idx,
+                       r->fh);
+
+    if (n_ranks == 1)
+      cs_io_write_global(z_name, z_tot, 0, 0, 1, CS_CHAR, z, r->fh);
+    else
+      cs_io_write_block_buffer(z_name,
+                               z_tot,
+                               z_range[0],
+                               z_range[1],
+                               0,
+                               0,
+                               1,
+                               CS_CHAR,
+                               z,
+                               r->fh);
+
+    BFT_FREE(idx);
+    BFT_FREE(z);
+  }
+
+  BFT_FREE(z_name);
+  BFT_FREE(idx_name);
+
+#else
+
+  CS_UNUSED(r);
+  CS_UNUSED(sec_name);
+  CS_UNUSED(gnum_range);
+  CS_UNUSED(location_id);
+  CS_UNUSED(n_location_vals);
+  CS_UNUSED(elt_type);
+  CS_UNUSED(tolerance);
+
+  BFT_FREE(block_vals);
+
+#endif /* defined(HAVE_ZLIB) */
+}
+
+/*----------------------------------------------------------------------------
+ * Search for the index of a compressed section.
+ *
+ * parameters:
+ *   r           <-- associated restart file pointer
+ *   sec_name    <-- section name
+ *   location_id <-- id of corresponding location
+ *
+ * returns:
+ *   id of index record, or -1 if not found
+ *----------------------------------------------------------------------------*/
+
+static int
+_compressed_index_id(const cs_restart_t  *r,
+                     const char          *sec_name,
+                     int                  location_id)
+{
+  int retval = -1;
+
+  if (location_id < 1)
+    return retval;
+
+  char *idx_name = _compressed_section_name(sec_name, "::z_index");
+
+  size_t index_size = cs_io_get_index_size(r->fh);
+
+  for (size_t rec_id = 0; rec_id < index_size; rec_id++) {
+    const char *cmp_name = cs_io_get_indexed_sec_name(r->fh, rec_id);
+    if (strcmp(cmp_name, idx_name) == 0) {
+      cs_io_sec_header_t header = cs_io_get_indexed_sec_header(r->fh, rec_id);
+      if (header.location_id == (size_t)location_id) {
+        retval = rec_id;
+        break;
+      }
     }
-    break;
+  }
+
+  BFT_FREE(idx_name);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Read the index of a compressed section.
+ *
+ * parameters:
+ *   r               <-> associated restart file pointer
+ *   rec_id          <-- id of index record
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   idx             --> pointer to allocated index
+ *
+ * returns:
+ *   0 (CS_RESTART_SUCCESS) in case of success,
+ *   or error code (CS_RESTART_ERR_xxx) in case of error
+ *----------------------------------------------------------------------------*/
+
+static int
+_read_compressed_index(cs_restart_t           *r,
+                       int                     rec_id,
+                       int                     n_location_vals,
+                       cs_restart_val_type_t   val_type,
+                       uint64_t              **idx)
+{
+  *idx = nullptr;
+
+  cs_io_sec_header_t header = cs_io_get_indexed_sec_header(r->fh, rec_id);
+
+  if (header.n_location_vals != (size_t)n_location_vals)
+    return CS_RESTART_ERR_N_VALS;
+
+  if (header.type_read != CS_UINT64 || header.n_vals < 5)
+    return CS_RESTART_ERR_VAL_TYPE;
 
-  case CS_TYPE_cs_real_t:
-    {
-      cs_real_t  *val_ord;
-      const cs_real_t  *val_cur = (const cs_real_t *)vals;
+  cs_io_set_indexed_position(r->fh, &header, rec_id);
+  header.elt_type = CS_UINT64;
 
-      BFT_MALLOC(val_ord, n_ents * n_location_vals, cs_real_t);
+  uint64_t *_idx;
+  BFT_MALLOC(_idx, header.n_vals, uint64_t);
+  cs_io_read_global(&header, _idx, r->fh);
 
-      for (ent_id = 0; ent_id < n_ents; ent_id++) {
-        for (jj = 0; jj < n_location_vals; jj++)
-          val_ord[(ini_ent_num[ent_id] - 1) * n_location_vals + jj]
-            = val_cur[ii++];
-      }
+  if (_idx[0] != 1 || (uint64_t)header.n_vals != 5 + 4*_idx[4]) {
+    bft_printf(_("  %s: compressed section \"%s\" has "
+                 "an unhandled format.\n"),
+               r->name, header.sec_name);
+    BFT_FREE(_idx);
+    return CS_RESTART_ERR_VAL_TYPE;
+  }
 
-      return (cs_byte_t *)val_ord;
-    }
-    break;
+  /* Check type (requiring same integer sizes) */
 
-  default:
-    assert(0);
-    return nullptr;
+  int retval = CS_RESTART_SUCCESS;
+  cs_datatype_t elt_type = (cs_datatype_t)_idx[1];
 
+  if (elt_type == CS_FLOAT || elt_type == CS_DOUBLE) {
+    if (val_type != CS_TYPE_cs_real_t)
+      retval = CS_RESTART_ERR_VAL_TYPE;
+  }
+  else if (elt_type == CS_CHAR) {
+    if (val_type != CS_TYPE_char)
+      retval = CS_RESTART_ERR_VAL_TYPE;
   }
+  else if (   (   val_type != CS_TYPE_int
+               && val_type != CS_TYPE_cs_gnum_t)
+           || (cs_datatype_size[elt_type] != _val_type_size(val_type)))
+    retval = CS_RESTART_ERR_VAL_TYPE;
+
+  if (retval == CS_RESTART_SUCCESS)
+    *idx = _idx;
+  else
+    BFT_FREE(_idx);
+
+  return retval;
 }
 
 /*----------------------------------------------------------------------------
- * Find a given record in an indexed restart file.
+ * Read a compressed section.
+ *
+ * Whole chunks are read by ranks which are multiples of the rank step,
+ * balancing the compressed data size, then uncompressed and distributed.
  *
  * parameters:
- *   restart   <-- associated restart file pointer
- *   prefix    <-- prefix to name of record
- *   name      <-- base name of record
- *   postfix   <-- postfix to name of record
+ *   r               <-> associated restart file pointer
+ *   sec_name        <-- section name
+ *   idx             <-- compressed section index
+ *   n_glob_ents     <-- global number of entities
+ *   n_ents          <-- local number of entities
+ *   ent_global_num  <-- global entity numbers (1 to n numbering), or nullptr
+ *   n_location_vals <-- number of values par location
+ *   val_type        <-- data type
+ *   vals            --> array of values
  *
  * returns:
- *   the id assigned to the record, or -1 if not found
+ *   0 (CS_RESTART_SUCCESS) in case of success,
+ *   or error code (CS_RESTART_ERR_xxx) in case of error
  *----------------------------------------------------------------------------*/
 
 static int
-_restart_section_id(cs_restart_t     *restart,
-                    const char       *prefix,
-                    const char       *name,
-                    const char       *postfix)
+_read_compressed(cs_restart_t           *r,
+                 const char             *sec_name,
+                 const uint64_t          idx[],
+                 cs_gnum_t               n_glob_ents,
+                 cs_lnum_t               n_ents,
+                 const cs_gnum_t        *ent_global_num,
+                 int                     n_location_vals,
+                 cs_restart_val_type_t   val_type,
+                 cs_byte_t               vals[])
 {
-  size_t index_size = cs_io_get_index_size(restart->fh);
+#if defined(HAVE_ZLIB)
 
-  char *_sec_name = nullptr;
-  const char *sec_name = name;
+  const cs_datatype_t elt_type = (cs_datatype_t)idx[1];
+  const int method = idx[2];
+  double quantum;
+  memcpy(&quantum, idx + 3, sizeof(uint64_t));
+  const uint64_t n_chunks = idx[4];
+  const uint64_t *chunk = idx + 5;
 
-  int rec_id = -1;
+  const size_t elt_size = _val_type_size(val_type);
+  const cs_datatype_t dest_type
+    = (val_type == CS_TYPE_cs_real_t) ?
+        ((elt_size == cs_datatype_size[CS_DOUBLE]) ? CS_DOUBLE : CS_FLOAT)
+      : elt_type;
 
-  if (prefix != nullptr || postfix != nullptr) {
+  /* Locate data */
 
+  int z_rec_id = -1;
+  {
+    char *z_name = _compressed_section_name(sec_name, "::z_data");
+    size_t index_size = cs_io_get_index_size(r->fh);
+    for (size_t rec_id = 0; rec_id < index_size; rec_id++) {
+      if (strcmp(cs_io_get_indexed_sec_name(r->fh, rec_id), z_name) == 0) {
+        z_rec_id = rec_id;
+        break;
+      }
+    }
+    BFT_FREE(z_name);
+  }
 
-    size_t sec_name_l = strlen(name);
+  if (z_rec_id < 0) {
+    bft_printf(_("  %s: data of compressed section \"%s\" not present.\n"),
+               r->name, sec_name);
+    return CS_RESTART_ERR_EXISTS;
+  }
 
-    if (prefix != nullptr)
-      sec_name_l += strlen(prefix);
-    if (postfix != nullptr)
-      sec_name_l += strlen(postfix);
+  cs_io_sec_header_t header = cs_io_get_indexed_sec_header(r->fh, z_rec_id);
 
-    BFT_MALLOC(_sec_name, sec_name_l + 1, char);
-    sec_name = _sec_name;
+  /* Check chunks (non-empty chunks should be ordered and contiguous) */
 
-    if (prefix != nullptr) {
-      strcpy(_sec_name, prefix);
-      strcat(_sec_name, name);
+  uint64_t n_c = 0, z_tot = 0;
+  uint64_t *c_ids;
+  BFT_MALLOC(c_ids, n_chunks, uint64_t);
+
+  {
+    uint64_t g_next = 1;
+    for (uint64_t i = 0; i < n_chunks; i++) {
+      const uint64_t *c = chunk + 4*i;
+      if (c[1] <= c[0])
+        continue;
+      if (c[0] != g_next || c[2] != z_tot)
+        break;
+      g_next = c[1];
+      z_tot += c[3];
+      c_ids[n_c++] = i;
     }
-    else
-      strcpy(_sec_name, name);
+    if (g_next != n_glob_ents + 1 || z_tot != (uint64_t)header.n_vals)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: compressed section \"%s\" is inconsistent."),
+                r->name, sec_name);
+  }
 
-    if (postfix != nullptr)
-      strcat(_sec_name, postfix);
+  /* Assign consecutive chunks to reader ranks, balancing data size */
+
+  int n_readers = 1, rank_step = 1, reader_id = 0;
 
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    rank_step = CS_MAX(r->rank_step, 1);
+    n_readers = (cs_glob_n_ranks + rank_step - 1) / rank_step;
+    reader_id = cs_glob_rank_id / rank_step;
   }
+#endif
 
-  /* Search for the record in the index */
+  uint64_t *r_c_start, *r_g_start;
+  BFT_MALLOC(r_c_start, n_readers + 1, uint64_t);
+  BFT_MALLOC(r_g_start, n_readers + 1, uint64_t);
 
-  for (rec_id = 0; rec_id < (int)index_size; rec_id++) {
-    const char * cmp_name = cs_io_get_indexed_sec_name(restart->fh, rec_id);
-    if (strcmp(cmp_name, sec_name) == 0)
-      break;
+  {
+    uint64_t j = 0;
+    for (int i = 0; i < n_readers; i++) {
+      while (j < n_c) {
+        const uint64_t *c = chunk + 4*c_ids[j];
+        if (z_tot > 0 && (c[2]*(uint64_t)n_readers) / z_tot >= (uint64_t)i)
+          break;
+        j++;
+      }
+      r_c_start[i] = j;
+      r_g_start[i] = (j < n_c) ? chunk[4*c_ids[j]] : n_glob_ents + 1;
+    }
+    r_c_start[0] = 0;
+    r_g_start[0] = 1;
+    r_c_start[n_readers] = n_c;
+    r_g_start[n_readers] = n_glob_ents + 1;
   }
 
-  if (rec_id >= (int)index_size) {
-    bft_printf(_("  %s: section \"%s\" not present.\n"),
-               restart->name, sec_name);
-    rec_id = -1;
+  /* Read compressed data */
+
+  uint64_t c_s = 0, c_e = 0;
+  if (cs_glob_rank_id % rank_step == 0 || cs_glob_n_ranks == 1) {
+    c_s = r_c_start[reader_id];
+    c_e = r_c_start[reader_id + 1];
+  }
+  else {
+    c_s = r_c_start[CS_MIN(reader_id + 1, n_readers)];
+    c_e = c_s;
   }
 
-  BFT_FREE(_sec_name);
+  uint64_t z_s = (c_s < n_c) ? chunk[4*c_ids[c_s] + 2] : z_tot;
+  uint64_t z_e = (c_e < n_c) ? chunk[4*c_ids[c_e] + 2] : z_tot;
+  uint64_t g_s = (c_s < n_c) ? chunk[4*c_ids[c_s]] : n_glob_ents + 1;
+  uint64_t g_e = (c_e < n_c) ? chunk[4*c_ids[c_e]] : n_glob_ents + 1;
 
-  return rec_id;
-}
+  cs_byte_t *z = nullptr;
+  BFT_MALLOC(z, z_e - z_s, cs_byte_t);
 
-#if defined(HAVE_MPI)
+  cs_io_set_indexed_position(r->fh, &header, z_rec_id);
 
-/*----------------------------------------------------------------------------
- * Compute default particle destination rank array in case of untracked
- * particles.
- *
- * For simplicity, those particles are simply distributed among ranks
- * (as it is possible to define a global numbering based on a space-filling
- * curve when generating the restart file, this may be made "geometrically"
- * balanced also).
- *
- * parameters:
- *   p_bi         <-- pointer to particles bock distribution info
- *   p_cell_num   <-- global cell number associated with each particle
- *                    (0 for untracked particles)
- *   comm         <-- associated MPI communicator
- *
- * returns:
- *   default rank array for particles (>= 0 for untracked particles)
- *----------------------------------------------------------------------------*/
+  if (cs_glob_n_ranks == 1)
+    cs_io_read_global(&header, z, r->fh);
+  else
+    cs_io_read_block(&header, z_s + 1, z_e + 1, z, r->fh);
 
-static int *
-_default_p_rank(cs_block_dist_info_t  *p_bi,
-                const cs_gnum_t       *p_cell_num,
-                MPI_Comm               comm)
-{
-  cs_lnum_t i;
-  cs_block_dist_info_t free_particle_bi;
+  /* Uncompress and decode chunks */
 
-  int n_ranks = 0, rank_id = -1;
+  const size_t dest_size = cs_datatype_size[dest_type];
+  const size_t ent_size = n_location_vals * dest_size;
 
-  cs_lnum_t _n_particles = 0, n_free_particles = 0;
-  cs_gnum_t _n_g_free_particles = 0, n_g_free_particles = 0;
+  cs_byte_t *block_vals = vals;
+  if (cs_glob_n_ranks > 1)
+    BFT_MALLOC(block_vals, (g_e - g_s)*ent_size, cs_byte_t);
 
-  cs_lnum_t *free_particle_ids = nullptr;
+  uint64_t *q = nullptr;
+  cs_byte_t *tmp = nullptr;
 
-  fvm_io_num_t *free_particle_io_num = nullptr;
-  const cs_gnum_t *free_particle_num = nullptr;
+  for (uint64_t j = c_s; j < c_e; j++) {
+    const uint64_t *c = chunk + 4*c_ids[j];
+    size_t n_vals = (c[1] - c[0]) * n_location_vals;
+    cs_byte_t *dest = block_vals + (c[0] - g_s)*ent_size;
+    const cs_byte_t *_z = z + (c[2] - z_s);
 
-  int *default_rank = nullptr;
+    if (method == 1) {
+      BFT_REALLOC(q, n_vals, uint64_t);
+      _uncompress_buffer(n_vals, sizeof(uint64_t), c[3], _z, q);
+      _unquantize(n_vals, n_location_vals, dest_type, quantum, q, dest);
+    }
+    else if (elt_type != dest_type) { /* single/double precision */
+      BFT_REALLOC(tmp, n_vals*cs_datatype_size[elt_type], cs_byte_t);
+      _uncompress_buffer(n_vals, cs_datatype_size[elt_type], c[3], _z, tmp);
+      if (dest_type == CS_DOUBLE) {
+        for (size_t k = 0; k < n_vals; k++)
+          ((double *)dest)[k] = ((const float *)tmp)[k];
+      }
+      else {
+        for (size_t k = 0; k < n_vals; k++)
+          ((float *)dest)[k] = ((const double *)tmp)[k];
+      }
+    }
+    else
+      _uncompress_buffer(n_vals, dest_size, c[3], _z, dest);
+  }
 
-  /* Initialization */
+  BFT_FREE(tmp);
+  BFT_FREE(q);
+  BFT_FREE(z);
 
-  assert((sizeof(cs_lnum_t) == 4) || (sizeof(cs_lnum_t) == 8));
+  /* Distribute values */
 
-  /* Count number of untracked particles */
+  if (cs_glob_n_ranks == 1) {
+    if (ent_global_num != nullptr)
+      _restart_permute_read(n_ents,
+                            ent_global_num,
+                            n_location_vals,
+                            val_type,
+                            vals);
+  }
 
-  _n_particles = p_bi->gnum_range[1] - p_bi->gnum_range[0];
-  n_free_particles = 0;
+#if defined(HAVE_MPI)
 
-  for (i = 0; i < _n_particles; i++) {
-    if (p_cell_num[i] == 0)
-      n_free_particles += 1;
+  else {
+    int *dest_rank;
+    cs_lnum_t *dest_id;
+    BFT_MALLOC(dest_rank, n_ents, int);
+    BFT_MALLOC(dest_id, n_ents, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_ents; i++) {
+      uint64_t g = ent_global_num[i];
+      int s = 0, e = n_readers;
+      while (e - s > 1) {
+        int m = (s + e) / 2;
+        if (r_g_start[m] <= g)
+          s = m;
+        else
+          e = m;
+      }
+      dest_rank[i] = s * rank_step;
+      dest_id[i] = g - r_g_start[s];
+    }
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create(n_ents,
+                             CS_ALL_TO_ALL_USE_DEST_ID,
+                             dest_id,
+                             dest_rank,
+                             cs_glob_mpi_comm);
+
+    cs_all_to_all_copy_array(d,
+                             dest_type,
+                             n_location_vals,
+                             true,  /* reverse */
+                             block_vals,
+                             vals);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(dest_id);
+    BFT_FREE(dest_rank);
+    BFT_FREE(block_vals);
   }
 
-  _n_g_free_particles = n_free_particles;
-  MPI_Allreduce(&_n_g_free_particles, &n_g_free_particles, 1,
-                CS_MPI_GNUM, MPI_SUM, comm);
+#endif /* defined(HAVE_MPI) */
 
-  /* Return if we do not have untracked particles */
+  BFT_FREE(r_g_start);
+  BFT_FREE(r_c_start);
+  BFT_FREE(c_ids);
 
-  if (n_g_free_particles == 0)
-    return nullptr;
+  return CS_RESTART_SUCCESS;
 
-  /* Initialize rank info */
+#else
 
-  MPI_Comm_size(comm, &n_ranks);
-  MPI_Comm_size(comm, &rank_id);
-  free_particle_bi = cs_block_dist_compute_sizes(rank_id,
-                                                 n_ranks,
-                                                 0,
-                                                 0,
-                                                 n_g_free_particles);
+  CS_UNUSED(idx);
+  CS_UNUSED(n_glob_ents);
+  CS_UNUSED(n_ents);
+  CS_UNUSED(ent_global_num);
+  CS_UNUSED(n_location_vals);
+  CS_UNUSED(val_type);
+  CS_UNUSED(vals);
 
-  /* Define distribution of untracked particles based on scan;
-   *
-   *  The main objective of this function
-   *  is to ensure some measure of load balancing. */
+  bft_error(__FILE__, __LINE__, 0,
+            _("%s: section \"%s\" is compressed, but code_saturne\n"
+              "was built without zlib support."),
+            r->name, sec_name);
 
-  BFT_MALLOC(default_rank, _n_particles, int);
-  for (i = 0; i < _n_particles; i++)
-    default_rank[i] = -1;
+  return CS_RESTART_ERR_VAL_TYPE;
 
-  BFT_MALLOC(free_particle_ids, n_free_particles, cs_lnum_t);
+#endif /* defined(HAVE_ZLIB) */
+}
 
-  n_free_particles = 0;
-  for (i = 0; i < _n_particles; i++) {
-    if (p_cell_num[i] == 0)
-      free_particle_ids[n_free_particles++] = i;
-  }
+/*----------------------------------------------------------------------------
+ * Compute values used to check that a location's local entities in a
+ * rank-local file match those of the current mesh partitioning.
+ *
+ * parameters:
+ *   n_glob_ents    <-- global number of entities
+ *   n_ents         <-- local number of entities
+ *   ent_global_num <-- global entity numbers, or nullptr
+ *   check          --> global number of entities and hash of local
+ *                      global numbers
+ *----------------------------------------------------------------------------*/
 
-  free_particle_io_num = fvm_io_num_create_from_scan(n_free_particles);
-  free_particle_num = fvm_io_num_get_global_num(free_particle_io_num);
+static void
+_local_location_check_vals(cs_gnum_t         n_glob_ents,
+                           cs_lnum_t         n_ents,
+                           const cs_gnum_t  *ent_global_num,
+                           cs_gnum_t         check[2])
+{
+  uint64_t h = 14695981039346656037ULL;  /* FNV-1a hash */
 
-  /* Determine rank based on global numbering */
-  for (i = 0; i < n_free_particles; i++) {
-    default_rank[free_particle_ids[i]]
-      =    ((free_particle_num[i] - 1) / free_particle_bi.block_size)
-         * free_particle_bi.rank_step;
+  for (cs_lnum_t i = 0; i < n_ents; i++) {
+    uint64_t g = (ent_global_num != nullptr) ? ent_global_num[i] : i+1;
+    h = (h ^ g) * 1099511628211ULL;
   }
 
-  free_particle_io_num = fvm_io_num_destroy(free_particle_io_num);
-  BFT_FREE(free_particle_ids);
-
-  return default_rank;
+  check[0] = n_glob_ents;
+  check[1] = h;
 }
 
-#endif /* defined(HAVE_MPI) */
+/*----------------------------------------------------------------------------
+ * Build the name of the section used to check a location in a
+ * rank-local file.
+ *
+ * parameters:
+ *   location_name <-- location name
+ *
+ * returns:
+ *   pointer to allocated name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_local_location_check_name(const char  *location_name)
+{
+  const char suffix[] = "::local_check";
+
+  char *name;
+  BFT_MALLOC(name, strlen(location_name) + strlen(suffix) + 1, char);
+
+  strcpy(name, location_name);
+  strcat(name, suffix);
+
+  return name;
+}
 
 /*----------------------------------------------------------------------------*/
 /*!
@@ -1079,9 +3778,11 @@ _check_section(cs_restart_t           *restart,
     if (location_id < 0 || location_id > (int)(restart->n_locations))
       return CS_RESTART_ERR_LOCATION;
     n_glob_ents = (restart->location[location_id-1]).n_glob_ents;
+    n_ents  = (restart->location[location_id-1]).n_ents;
+    if (restart->local)
+      n_glob_ents = n_ents;
     if ((restart->location[location_id-1]).n_glob_ents_f != n_glob_ents)
       return CS_RESTART_ERR_LOCATION;
-    n_ents  = (restart->location[location_id-1]).n_ents;
   }
 
   /* Search for the corresponding record in the index */
@@ -1092,10 +3793,21 @@ _check_section(cs_restart_t           *restart,
       break;
   }
 
-  /* If the record was not found */
+  /* If the record was not found, check for a compressed section */
 
-  if (rec_id >= index_size)
-    return CS_RESTART_ERR_EXISTS;
+  if (rec_id >= index_size) {
+    int z_rec_id = _compressed_index_id(restart, sec_name, location_id);
+    if (z_rec_id < 0)
+      return CS_RESTART_ERR_EXISTS;
+    uint64_t *idx = nullptr;
+    int retval = _read_compressed_index(restart,
+                                        z_rec_id,
+                                        n_location_vals,
+                                        val_type,
+                                        &idx);
+    BFT_FREE(idx);
+    return retval;
+  }
 
   /*
     If the location does not fit: we search for a location of same
@@ -1211,6 +3923,12 @@ _read_section(cs_restart_t           *restart,
       return CS_RESTART_ERR_LOCATION;
     }
     n_glob_ents = (restart->location[location_id-1]).n_glob_ents;
+    n_ents  = (restart->location[location_id-1]).n_ents;
+    ent_global_num = (restart->location[location_id-1]).ent_global_num;
+    if (restart->local) {  /* rank-local values */
+      n_glob_ents = n_ents;
+      ent_global_num = nullptr;
+    }
     if ((restart->location[location_id-1]).n_glob_ents_f != n_glob_ents) {
       bft_printf
         (_("  %s: location id %d for \"%s\" has "
@@ -1220,8 +3938,6 @@ _read_section(cs_restart_t           *restart,
          (unsigned long long)n_glob_ents);
       return CS_RESTART_ERR_LOCATION;
     }
-    n_ents  = (restart->location[location_id-1]).n_ents;
-    ent_global_num = (restart->location[location_id-1]).ent_global_num;
   }
 
   /* Search for the corresponding record in the index */
@@ -1232,12 +3948,37 @@ _read_section(cs_restart_t           *restart,
       break;
   }
 
-  /* If the record was not found */
+  /* If the record was not found, check for a compressed section */
 
   if (rec_id >= index_size) {
-    bft_printf(_("  %s: section \"%s\" not present.\n"),
-               restart->name, sec_name);
-    return CS_RESTART_ERR_EXISTS;
+    int z_rec_id = _compressed_index_id(restart, sec_name, location_id);
+    if (z_rec_id < 0) {
+      bft_printf(_("  %s: section \"%s\" not present.\n"),
+                 restart->name, sec_name);
+      return CS_RESTART_ERR_EXISTS;
+    }
+    uint64_t *idx = nullptr;
+    int retval = _read_compressed_index(restart,
+                                        z_rec_id,
+                                        n_location_vals,
+                                        val_type,
+                                        &idx);
+    if (retval == CS_RESTART_SUCCESS)
+      retval = _read_compressed(restart,
+                                sec_name,
+                                idx,
+                                n_glob_ents,
+                                n_ents,
+                                ent_global_num,
+                                _n_location_vals,
+                                val_type,
+                                (cs_byte_t *)val);
+    else
+      bft_printf(_("  %s: compressed section \"%s\" does not match "
+                   "the expected type or number of values.\n"),
+                 restart->name, sec_name);
+    BFT_FREE(idx);
+    return retval;
   }
 
   /*
@@ -1341,9 +4082,9 @@ _read_section(cs_restart_t           *restart,
   /* Section contents */
   /*------------------*/
 
-  /* In single processor mode or for global values */
+  /* In single processor mode, for global values, or rank-local files */
 
-  if (cs_glob_n_ranks == 1 || location_id == 0) {
+  if (cs_glob_n_ranks == 1 || location_id == 0 || restart->local) {
 
     cs_io_read_global(&header, val, restart->fh);
 
@@ -1362,6 +4103,8 @@ _read_section(cs_restart_t           *restart,
   else if (n_glob_ents > 0)
     _read_ent_values(restart,
                      &header,
+                     rec_id,
+                     location_id,
                      n_glob_ents,
                      n_ents,
                      ent_global_num,
@@ -1426,6 +4169,10 @@ _write_section(cs_restart_t           *restart,
     n_glob_ents = (restart->location[location_id-1]).n_glob_ents;
     n_ents  = (restart->location[location_id-1]).n_ents;
     ent_global_num = (restart->location[location_id-1]).ent_global_num;
+    if (restart->local) {  /* rank-local values */
+      n_glob_ents = n_ents;
+      ent_global_num = nullptr;
+    }
   }
 
   /* Set val_type */
@@ -1448,12 +4195,78 @@ _write_section(cs_restart_t           *restart,
     assert(0);
   }
 
-  /* Section contents */
-  /*------------------*/
+  /* Section contents */
+  /*------------------*/
+
+  /* Compressed sections (for mesh locations and global files only) */
+
+  double tolerance = -1;
+
+  if (   restart->local == false
+      && _compress_section(sec_name,
+                           location_id,
+                           n_glob_ents,
+                           elt_type,
+                           n_tot_vals * cs_datatype_size[elt_type],
+                           &tolerance)) {
+
+    cs_gnum_t gnum_range[2];
+    cs_byte_t *block_vals = _block_values(restart,
+                                          n_glob_ents,
+                                          n_ents,
+                                          ent_global_num,
+                                          _n_location_vals,
+                                          val_type,
+                                          (const cs_byte_t *)val,
+                                          gnum_range);
+
+    _write_compressed(restart,
+                      sec_name,
+                      gnum_range,
+                      location_id,
+                      _n_location_vals,
+                      elt_type,
+                      tolerance,
+                      block_vals);
+  }
+
+  /* In asynchronous mode, values are copied (in global numbering order)
+     to a staging buffer, except for distributed locations, handled
+     by _write_ent_values */
+
+  else if (   restart->staged != nullptr
+           && (location_id == 0 || cs_glob_n_ranks == 1 || n_glob_ents == 0)) {
+
+    cs_byte_t  *val_tmp = nullptr;
+    int         n_vals_stride = (location_id == 0) ? 1 : _n_location_vals;
+
+    if (location_id != 0 && ent_global_num != nullptr)
+      val_tmp = _restart_permute_write(n_ents,
+                                       ent_global_num,
+                                       _n_location_vals,
+                                       val_type,
+                                       (cs_byte_t *)val);
+    else {
+      size_t n_bytes = n_tot_vals * cs_datatype_size[elt_type];
+      BFT_MALLOC(val_tmp, n_bytes, cs_byte_t);
+      if (n_bytes > 0)
+        memcpy(val_tmp, val, n_bytes);
+    }
+
+    _staged_file_add_section(restart->staged,
+                             sec_name,
+                             true,
+                             n_tot_vals,
+                             nullptr,
+                             location_id,
+                             n_vals_stride,
+                             elt_type,
+                             val_tmp);
+  }
 
   /* In single processor mode of for global values */
 
-  if (location_id == 0)
+  else if (location_id == 0)
     cs_io_write_global(sec_name,
                        n_tot_vals,
                        location_id,
@@ -1464,7 +4277,7 @@ _write_section(cs_restart_t           *restart,
                        restart->fh);
 
 
-  else if (cs_glob_n_ranks == 1 || n_glob_ents == 0) {
+  else if (cs_glob_n_ranks == 1 || n_glob_ents == 0 || restart->local) {
 
     cs_byte_t  *val_tmp = nullptr;
 
@@ -1859,6 +4672,300 @@ cs_restart_checkpoint_set_mesh_mode(int  mode)
   _checkpoint_mesh = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, section values are copied to staging buffers
+ * (after redistribution to blocks in parallel) when written, and the
+ * staged data is written to file by a background thread when the
+ * checkpoint file is closed, so the computation may proceed while
+ * the checkpoint is being written. Host memory usage is thus increased
+ * by the size of one set of checkpoint files until writing is complete.
+ * Writing the same file again waits for completion of its previous
+ * writing.
+ *
+ * In parallel, this requires full MPI thread support (MPI_THREAD_MULTIPLE,
+ * which is requested at initialization when the CS_MPI_THREAD_MULTIPLE
+ * environment variable is set) and OpenMP support; otherwise, a warning
+ * is printed and checkpoints are written synchronously.
+ *
+ * \param[in]  async  write checkpoint files asynchronously if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async)
+{
+  bool _async = async;
+
+#if defined(HAVE_MPI)
+  if (_async && cs_glob_n_ranks > 1) {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      bft_printf(_("\n"
+                   "Warning: asynchronous checkpoint writing requires\n"
+                   "         MPI_THREAD_MULTIPLE support (see the\n"
+                   "         CS_MPI_THREAD_MULTIPLE environment variable);\n"
+                   "         checkpoints will be written synchronously.\n"));
+      _async = false;
+    }
+  }
+#endif
+
+  if (_async && bft_mem_set_thread_safe(true) == 0) {
+    bft_printf(_("\n"
+                 "Warning: asynchronous checkpoint writing requires\n"
+                 "         OpenMP support;\n"
+                 "         checkpoints will be written synchronously.\n"));
+    _async = false;
+  }
+
+  if (_async == false && _checkpoint_async)
+    _async_wait(nullptr);
+
+  _checkpoint_async = _async;
+
+  if (_checkpoint_async && _need_finalize == false) {
+    _need_finalize = true;
+    cs_base_at_finalize(_restart_finalize);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether sections of checkpoint files defined on mesh
+ *         locations are compressed.
+ *
+ * Values are byte-shuffled (so that bytes of the same significance are
+ * contiguous) and compressed using zlib. Sections smaller than a few
+ * kilobytes are not compressed. Reading compressed sections is
+ * transparent.
+ *
+ * If code_saturne was built without zlib support, a warning is printed
+ * and sections are not compressed.
+ *
+ * \param[in]  compress  compress sections if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_lossless_compression(bool  compress)
+{
+#if defined(HAVE_ZLIB)
+  _compress_lossless = compress;
+#else
+  if (compress)
+    bft_printf(_("\n"
+                 "Warning: checkpoint compression requires zlib support;\n"
+                 "         checkpoint sections will not be compressed.\n"));
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define an absolute error tolerance for lossy compression
+ *         of floating-point checkpoint sections.
+ *
+ * The tolerance applies to sections defined on mesh locations whose name
+ * is the given name, or starts with the given name followed by "::"
+ * (so that a field's name applies to all its time values, such as
+ * "velocity::vals::0" and "velocity::vals::1").
+ *
+ * Values are quantized with a step of twice the tolerance, so the absolute
+ * error on values read at restart is bounded by the tolerance, then
+ * compressed as for \ref cs_restart_set_lossless_compression. If values
+ * are not finite or too large relative to the tolerance, the section is
+ * compressed losslessly.
+ *
+ * \param[in]  name       section or field name
+ * \param[in]  tolerance  absolute error tolerance, or a value <= 0
+ *                        to remove a previous definition
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_section_tolerance(const char  *name,
+                                 double       tolerance)
+{
+  int i;
+
+  for (i = 0; i < _n_compress_tolerances; i++) {
+    if (strcmp(_compress_tolerance_name[i], name) == 0)
+      break;
+  }
+
+  if (i >= _n_compress_tolerances) {
+    if (tolerance <= 0)
+      return;
+    _n_compress_tolerances += 1;
+    BFT_REALLOC(_compress_tolerance_name, _n_compress_tolerances, char *);
+    BFT_REALLOC(_compress_tolerance, _n_compress_tolerances, double);
+    BFT_MALLOC(_compress_tolerance_name[i], strlen(name) + 1, char);
+    strcpy(_compress_tolerance_name[i], name);
+  }
+
+  _compress_tolerance[i] = (tolerance > 0) ? tolerance : -1;
+
+#if !defined(HAVE_ZLIB)
+  if (tolerance > 0)
+    bft_printf(_("\n"
+                 "Warning: checkpoint compression requires zlib support;\n"
+                 "         section \"%s\" will not be compressed.\n"),
+               name);
+#endif
+
+  if (_need_finalize == false) {
+    _need_finalize = true;
+    cs_base_at_finalize(_restart_finalize);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether restart files are read ahead in parallel.
+ *
+ * When active, after a section defined on a distributed mesh location
+ * is read, the block of the next such section in the file's index is
+ * read by a background thread (through a secondary file handle with
+ * private communicators) while values of the current section are
+ * distributed to ranks, so reading and redistribution overlap when
+ * sections are read in file order, as is usually the case. Block
+ * to entities distributors are cached per location in all cases.
+ *
+ * This requires full MPI thread support (MPI_THREAD_MULTIPLE, which is
+ * requested at initialization when the CS_MPI_THREAD_MULTIPLE environment
+ * variable is set) and OpenMP support; otherwise, a warning is printed
+ * and read-ahead is not activated. It has no effect in serial runs.
+ *
+ * This function must be called by all ranks.
+ *
+ * \param[in]  read_ahead  read sections ahead if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_read_ahead(bool  read_ahead)
+{
+  bool _read_ahead_flag = read_ahead;
+
+#if defined(HAVE_MPI)
+  if (_read_ahead_flag && cs_glob_n_ranks > 1) {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      bft_printf(_("\n"
+                   "Warning: restart file read-ahead requires\n"
+                   "         MPI_THREAD_MULTIPLE support (see the\n"
+                   "         CS_MPI_THREAD_MULTIPLE environment variable);\n"
+                   "         restart files will be read without read-ahead.\n"));
+      _read_ahead_flag = false;
+    }
+  }
+#else
+  _read_ahead_flag = false;
+#endif
+
+  if (_read_ahead_flag && bft_mem_set_thread_safe(true) == 0) {
+    bft_printf(_("\n"
+                 "Warning: restart file read-ahead requires\n"
+                 "         OpenMP support;\n"
+                 "         restart files will be read without read-ahead.\n"));
+    _read_ahead_flag = false;
+  }
+
+  _restart_read_ahead = _read_ahead_flag;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define a node-local tier for checkpoint files.
+ *
+ * When active, checkpoint files in the default checkpoint directory are
+ * written by each rank (with its local values only) to a subdirectory of
+ * the given node-local directory (such as a local SSD or tmpfs), which
+ * is much faster than writing to a shared file system. Only every Nth
+ * checkpoint, and the checkpoint at the last time step, is written to the
+ * global checkpoint directory (asynchronously if
+ * \ref cs_restart_checkpoint_set_async is active).
+ *
+ * If partner copies are requested, the files of each rank are also copied
+ * to a partner rank, assumed to be on another node (ranks being placed
+ * consecutively on nodes), so that files lost with a node may be recovered
+ * at restart.
+ *
+ * At restart, if a complete node-local checkpoint more recent than the
+ * last global checkpoint is found for all ranks, it is used instead of
+ * the restart directory. This requires the same number of ranks and
+ * mesh partitioning as the run which wrote it.
+ *
+ * This function must be called by all ranks.
+ *
+ * \param[in]  path            node-local directory, or nullptr to
+ *                             deactivate the node-local tier
+ * \param[in]  flush_interval  write every flush_interval checkpoints
+ *                             to the global checkpoint directory
+ * \param[in]  partner_copy    copy files to a partner rank if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_local_tier(const char  *path,
+                                     int          flush_interval,
+                                     bool         partner_copy)
+{
+  BFT_FREE(_local_tier_path);
+
+  _local_tier_flush_interval = CS_MAX(flush_interval, 1);
+  _local_tier_partner_shift = 0;
+
+  if (path != nullptr) {
+    if (strlen(path) > 0) {
+      BFT_MALLOC(_local_tier_path, strlen(path) + 1, char);
+      strcpy(_local_tier_path, path);
+    }
+  }
+
+  if (_local_tier_path == nullptr)
+    return;
+
+#if defined(HAVE_MPI)
+
+  /* Partner rank is on the next node, assuming nodes have the same
+     number of ranks */
+
+  if (partner_copy && cs_glob_n_ranks > 1) {
+    MPI_Comm node_comm;
+    int node_n_ranks = 1;
+    MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED,
+                        cs_glob_rank_id, MPI_INFO_NULL, &node_comm);
+    MPI_Comm_size(node_comm, &node_n_ranks);
+    MPI_Comm_free(&node_comm);
+    cs_parall_max(1, CS_INT_TYPE, &node_n_ranks);
+    if (node_n_ranks < cs_glob_n_ranks)
+      _local_tier_partner_shift = node_n_ranks;
+  }
+
+#endif
+
+  if (partner_copy && _local_tier_partner_shift == 0)
+    bft_printf(_("\n"
+                 "Warning: all ranks are on the same node, so node-local\n"
+                 "         checkpoint files are not copied to\n"
+                 "         partner ranks.\n"));
+
+  /* Restart status may need to be updated */
+
+  if (_restart_present == 0)
+    _restart_present = -1;
+
+  if (_need_finalize == false) {
+    _need_finalize = true;
+    cs_base_at_finalize(_restart_finalize);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -2026,6 +5133,17 @@ cs_restart_checkpoint_done(const cs_time_step_t  *ts)
     if (wt - _checkpoint_wt_last >= _checkpoint_wt_interval)
       _checkpoint_wt_last = wt;
   }
+
+  /* Complete node-local tier checkpoint, or invalidate it
+     once a global checkpoint is written */
+
+  if (_checkpoint_level == 1)
+    _local_tier_commit(ts->nt_cur);
+  else if (_checkpoint_level == 2)
+    _local_tier_invalidate();
+
+  _checkpoint_level = 0;
+  _checkpoint_count += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2156,10 +5274,126 @@ cs_checkpoint_set_to_memory_serialized(bool  status)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate checkpoints will be written to a named entry of the
+ *         in-memory checkpoint store.
+ *
+ * Files written to the default checkpoint directory are then serialized
+ * in memory instead. Values are rank-local (as for the node-local tier),
+ * so the store may only be used for restarts with the same partitioning.
+ *
+ * If the named entry already exists, it is emptied; successive checkpoints
+ * overwrite its files.
+ *
+ * \param[in]  name  name of store entry, or nullptr to checkpoint to files
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_checkpoint_set_to_memory_store(const char  *name)
+{
+  _checkpoint_store_id = -1;
+
+  if (name == nullptr)
+    return;
+
+  int store_id = _store_id(name);
+
+  if (store_id > -1)
+    _store_clear(_stored_checkpoints + store_id);
+
+  else {
+    for (int i = 0; i < _n_stored_checkpoints && store_id < 0; i++) {
+      if (_stored_checkpoints[i].name == nullptr)
+        store_id = i;
+    }
+    if (store_id < 0) {
+      store_id = _n_stored_checkpoints;
+      _n_stored_checkpoints += 1;
+      BFT_REALLOC(_stored_checkpoints, _n_stored_checkpoints,
+                  _stored_checkpoint_t);
+      _stored_checkpoints[store_id].n_files = 0;
+      _stored_checkpoints[store_id].files = nullptr;
+    }
+  }
+
+  _stored_checkpoint_t *c = _stored_checkpoints + store_id;
+  BFT_MALLOC(c->name, strlen(name) + 1, char);
+  strcpy(c->name, name);
+
+  _checkpoint_store_id = store_id;
+
+  if (_need_finalize == false) {
+    _need_finalize = true;
+    cs_base_at_finalize(_restart_finalize);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate restart will be read from a named entry of the
+ *         in-memory checkpoint store.
+ *
+ * The stored data is not copied nor consumed by the restart, so several
+ * successive computations (such as ensemble members or coupling
+ * iterations) may be restarted from the same entry.
+ *
+ * \param[in]  name  name of store entry, or nullptr to restart from files
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_from_memory_store(const char  *name)
+{
+  _restart_store_id = -1;
+  _restart_present = -1;
+
+  if (name == nullptr)
+    return;
+
+  _restart_store_id = _store_id(name);
+
+  if (_restart_store_id < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("In-memory checkpoint \"%s\" is not defined."), name);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Remove a named entry of the in-memory checkpoint store,
+ *         freeing the associated memory.
+ *
+ * \param[in]  name  name of store entry
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_memory_store_remove(const char  *name)
+{
+  int store_id = _store_id(name);
+
+  if (store_id < 0)
+    return;
+
+  _store_clear(_stored_checkpoints + store_id);
+
+  if (_checkpoint_store_id == store_id)
+    _checkpoint_store_id = -1;
+  if (_restart_store_id == store_id) {
+    _restart_store_id = -1;
+    _restart_present = -1;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if we have a restart directory.
  *
+ * A complete node-local tier checkpoint (see
+ * \ref cs_restart_checkpoint_set_local_tier) is also considered
+ * as a restart directory.
+ *
  * \return  1 if a restart directory is present, 0 otherwise
  */
 /*----------------------------------------------------------------------------*/
@@ -2170,12 +5404,15 @@ cs_restart_present(void)
   if (_restart_present < 0) {
     if (cs_glob_rank_id < 1) {
       if (  _restart_serialized_memory != nullptr
+          || _restart_store_id > -1
           || cs_file_isdir("restart"))
         _restart_present = 1;
       else
         _restart_present = 0;
     }
     cs_parall_bcast(0, 1, CS_INT_TYPE, &_restart_present);
+    if (_restart_present == 0 && _local_restart_check() == 1)
+      _restart_present = 1;
   }
 
   return _restart_present;
@@ -2229,6 +5466,36 @@ cs_restart_create(const char         *name,
       _path = nullptr;
   }
 
+  /* Files in default directories may use the in-memory checkpoint store
+     or the node-local tier (both with rank-local values) */
+
+  int store_id = -1;
+  bool local = false;
+  char *_local_path = nullptr;
+
+  if (mode == CS_RESTART_MODE_WRITE) {
+    if (_path == nullptr || strcmp(_path, _checkpoint) == 0) {
+      store_id = _checkpoint_store_id;
+      if (store_id < 0)
+        local = _local_tier_checkpoint();
+    }
+  }
+  else if (mode == CS_RESTART_MODE_READ) {
+    if (_path == nullptr || strcmp(_path, _restart) == 0) {
+      store_id = _restart_store_id;
+      if (store_id < 0)
+        local = (_local_restart_check() == 1);
+    }
+  }
+
+  if (store_id > -1)
+    local = true;
+
+  else if (local) {
+    _local_path = _local_tier_dir(cs_glob_rank_id, false);
+    _path = _local_path;
+  }
+
   if (_path == nullptr) {
     if (mode == CS_RESTART_MODE_WRITE)
       _path = _checkpoint;
@@ -2236,9 +5503,10 @@ cs_restart_create(const char         *name,
       _path = _restart;
   }
 
-  /* Create 'checkpoint' directory or read from 'restart' directory */
+  /* Create 'checkpoint' directory or read from 'restart' directory
+     (node-local tier directories are handled separately) */
 
-  if (cs_glob_rank_id < 1) {
+  if (cs_glob_rank_id < 1 && local == false) {
     if (mode == CS_RESTART_MODE_WRITE) {
       if (cs_file_mkdir_default(_path) != 0)
         bft_error(__FILE__, __LINE__, 0,
@@ -2284,7 +5552,11 @@ cs_restart_create(const char         *name,
       _name[ldir+lname-lext+1] = '\0';
     }
 
-  } else if (mode == CS_RESTART_MODE_WRITE) {
+  } else if (mode == CS_RESTART_MODE_WRITE && local == false) {
+
+    /* Previous asynchronous writing of the same file must be complete */
+    if (_checkpoint_async)
+      _async_wait(_name);
 
     /* Check if file already exists, and if so rename and delete if needed */
     int writer_id = _add_restart_multiwriter(name, _name);
@@ -2341,6 +5613,7 @@ cs_restart_create(const char         *name,
   strcpy(restart->name, _name);
 
   BFT_FREE(_name);
+  BFT_FREE(_local_path);
 
   /* Initialize other fields */
 
@@ -2351,6 +5624,19 @@ cs_restart_create(const char         *name,
   restart->rank_step = 1;
   restart->min_block_size = 0;
 
+  restart->staged = nullptr;
+
+  restart->local = local;
+
+  restart->store_id = -1;
+  restart->store_file_id = -1;
+
+  restart->fh_ra = nullptr;
+#if defined(HAVE_MPI)
+  restart->ra_block_comm = MPI_COMM_NULL;
+  restart->ra_comm = MPI_COMM_NULL;
+#endif
+
   /* Initialize location data */
 
   restart->n_locations = 0;
@@ -2358,7 +5644,10 @@ cs_restart_create(const char         *name,
 
   /* Open associated file, and build an index of sections in read mode */
 
-  if (mode == CS_RESTART_MODE_READ) {
+  if (store_id > -1)
+    _store_open(restart, store_id, name);
+
+  else if (mode == CS_RESTART_MODE_READ) {
     if (_restart_serialized_memory == nullptr)
       _add_file(restart);
     else {
@@ -2370,8 +5659,15 @@ cs_restart_create(const char         *name,
   }
 
   else {
-    if (_checkpoint_serialized_memory == nullptr)
+    if (_checkpoint_serialized_memory == nullptr) {
+      if (_checkpoint_async && local == false)
+        restart->staged = _staged_file_create(restart->name);
       _add_file(restart);
+      if (restart->staged != nullptr) {
+        restart->staged->fh = restart->fh;
+        cs_io_disable_log(restart->fh);
+      }
+    }
     else {
       restart->fh = _checkpoint_serialized_memory;
       restart->rank_step = 1;
@@ -2423,11 +5719,27 @@ cs_restart_destroy(cs_restart_t  **restart)
 
   mode = r->mode;
 
-  if (   r->fh != nullptr
-      && r->fh != _checkpoint_serialized_memory
-      && r->fh != _restart_serialized_memory)
+  /* In asynchronous mode, staged sections are written (and the file
+     closed) by the background thread */
+
+  if (r->store_id > -1)
+    _store_close(r);
+
+  else if (r->staged != nullptr) {
+    r->fh = nullptr;
+    _async_submit(r->staged);
+    r->staged = nullptr;
+  }
+
+  else if (   r->fh != nullptr
+           && r->fh != _checkpoint_serialized_memory
+           && r->fh != _restart_serialized_memory)
     cs_io_finalize(&(r->fh));
 
+#if defined(HAVE_MPI)
+  _read_ahead_close(r);
+#endif
+
   /* Free locations array */
 
   if (r->n_locations > 0) {
@@ -2435,6 +5747,9 @@ cs_restart_destroy(cs_restart_t  **restart)
     for (loc_id = 0; loc_id < r->n_locations; loc_id++) {
       BFT_FREE((r->location[loc_id]).name);
       BFT_FREE((r->location[loc_id])._ent_global_num);
+#if defined(HAVE_MPI)
+      _location_reset_read_dist(r->location + loc_id);
+#endif
     }
   }
   if (r->location != nullptr)
@@ -2545,11 +5860,47 @@ cs_restart_add_location(cs_restart_t     *restart,
 
       if ((strcmp((restart->location[loc_id]).name, location_name) == 0)) {
 
+        /* Rank-local files require the same partitioning */
+
+        if (restart->local) {
+          cs_gnum_t check[2], check_f[2] = {0, 0};
+          _local_location_check_vals(n_glob_ents, n_ents, ent_global_num,
+                                     check);
+          char *sec_name = _local_location_check_name(location_name);
+          if (_check_section(restart, nullptr, sec_name, 0, 2,
+                             CS_TYPE_cs_gnum_t) == CS_RESTART_SUCCESS)
+            _read_section(restart, nullptr, sec_name, 0, 2,
+                          CS_TYPE_cs_gnum_t, check_f);
+          BFT_FREE(sec_name);
+          if (   restart->store_id > -1
+              && (   (restart->location[loc_id]).n_glob_ents_f
+                                                   != (cs_gnum_t)n_ents
+                  || check_f[0] != check[0] || check_f[1] != check[1]))
+            bft_error(__FILE__, __LINE__, 0,
+                      _("The in-memory checkpoint file \"%s\"\n"
+                        "does not match the current partitioning of "
+                        "location \"%s\"."),
+                      restart->name, location_name);
+          else if (   (restart->location[loc_id]).n_glob_ents_f
+                                                   != (cs_gnum_t)n_ents
+                   || check_f[0] != check[0] || check_f[1] != check[1])
+            bft_error(__FILE__, __LINE__, 0,
+                      _("The node-local checkpoint file \"%s\"\n"
+                        "does not match the current partitioning of "
+                        "location \"%s\".\n"
+                        "Remove the node-local checkpoint directory \"%s\"\n"
+                        "to restart from the global restart directory."),
+                      restart->name, location_name, _local_tier_path);
+        }
+
         (restart->location[loc_id]).n_glob_ents = n_glob_ents;
 
         (restart->location[loc_id]).n_ents  = n_ents;
         (restart->location[loc_id]).ent_global_num = ent_global_num;
         (restart->location[loc_id])._ent_global_num = nullptr;
+#if defined(HAVE_MPI)
+        _location_reset_read_dist(restart->location + loc_id);
+#endif
 
         timing[1] = cs_timer_wtime();
         _restart_wtime[restart->mode] += timing[1] - timing[0];
@@ -2572,6 +5923,10 @@ cs_restart_add_location(cs_restart_t     *restart,
     cs_datatype_t gnum_type
       = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
 
+    /* Rank-local files contain local entities only */
+
+    cs_gnum_t n_glob_ents_f = (restart->local) ? n_ents : n_glob_ents;
+
     /* Create a new location */
 
     restart->n_locations += 1;
@@ -2585,15 +5940,26 @@ cs_restart_add_location(cs_restart_t     *restart,
 
     (restart->location[restart->n_locations-1]).id = restart->n_locations;
     (restart->location[restart->n_locations-1]).n_glob_ents    = n_glob_ents;
-    (restart->location[restart->n_locations-1]).n_glob_ents_f  = n_glob_ents;
+    (restart->location[restart->n_locations-1]).n_glob_ents_f  = n_glob_ents_f;
     (restart->location[restart->n_locations-1]).n_ents         = n_ents;
     (restart->location[restart->n_locations-1]).ent_global_num = ent_global_num;
     (restart->location[restart->n_locations-1])._ent_global_num = nullptr;
+#if defined(HAVE_MPI)
+    (restart->location[restart->n_locations-1]).read_d = nullptr;
+#endif
 
     cs_io_write_global(location_name, 1, restart->n_locations, 0, 0,
-                       gnum_type, &n_glob_ents,
+                       gnum_type, &n_glob_ents_f,
                        restart->fh);
 
+    if (restart->local) {
+      cs_gnum_t check[2];
+      _local_location_check_vals(n_glob_ents, n_ents, ent_global_num, check);
+      char *sec_name = _local_location_check_name(location_name);
+      cs_io_write_global(sec_name, 2, 0, 0, 1, gnum_type, check, restart->fh);
+      BFT_FREE(sec_name);
+    }
+
     timing[1] = cs_timer_wtime();
     _restart_wtime[restart->mode] += timing[1] - timing[0];
 
@@ -2653,6 +6019,9 @@ cs_restart_add_location_ref(const char       *location_name,
   (_location_ref[_n_locations_ref-1]).n_ents         = n_ents;
   (_location_ref[_n_locations_ref-1]).ent_global_num
     = (_location_ref[_n_locations_ref-1])._ent_global_num;
+#if defined(HAVE_MPI)
+  (_location_ref[_n_locations_ref-1]).read_d = nullptr;
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3018,7 +6387,7 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_n_ranks > 1) {
+  if (cs_glob_n_ranks > 1 && restart->local == false) {
 
     int  *b_cell_rank, *p_cell_rank;
     cs_gnum_t  *part_cell_num = nullptr;
@@ -3111,6 +6480,7 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
     (restart->location[loc_id])._ent_global_num = ent_global_num;
     (restart->location[loc_id]).ent_global_num
       = (restart->location[loc_id])._ent_global_num;
+    _location_reset_read_dist(restart->location + loc_id);
 
     (restart->location[loc_id]).n_glob_ents = n_glob_particles;
     (restart->location[loc_id]).n_ents = n_part_ents;
@@ -3123,7 +6493,7 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
 
 #endif /* #if defined(HAVE_MPI) */
 
-  if (cs_glob_n_ranks == 1) {
+  if (cs_glob_n_ranks == 1 || restart->local) {
 
     (restart->location[loc_id]).n_glob_ents = n_glob_particles;
     (restart->location[loc_id]).n_ents = n_glob_particles;
@@ -4100,6 +7470,18 @@ cs_restart_log_setup(void)
     cs_log_printf(CS_LOG_SETUP,
                   _("                      : every %g s (wall-clock time)\n"),
                   _checkpoint_wt_interval);
+
+  cs_log_printf(CS_LOG_SETUP,
+                _("  Asynchronous writing: %s\n"),
+                cf_yn[_checkpoint_async]);
+
+  if (_local_tier_path != nullptr)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Node-local tier:      %s\n"
+                    "    global flush:       every %d checkpoints\n"
+                    "    partner copy:       %s\n"),
+                  _local_tier_path, _local_tier_flush_interval,
+                  cf_yn[(_local_tier_partner_shift > 0) ? 1 : 0]);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4111,6 +7493,9 @@ cs_restart_log_setup(void)
 void
 cs_restart_print_stats(void)
 {
+  if (_checkpoint_async)
+    _async_wait(nullptr);
+
   bft_printf(_("\n"
                "Checkpoint / restart files summary:\n"
                "\n"
@@ -4121,6 +7506,10 @@ cs_restart_print_stats(void)
                "  Elapsed time for writing:         %12.3f\n"),
              _restart_n_opens[0], _restart_n_opens[1],
              _restart_wtime[0], _restart_wtime[1]);
+
+  if (_checkpoint_async)
+    bft_printf(_("  Elapsed time for async. writing:  %12.3f\n"),
+               _checkpoint_async_wtime);
 }
 
 /*----------------------------------------------------------------------------*/
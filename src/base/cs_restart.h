@@ -253,6 +253,140 @@ cs_restart_checkpoint_set_interval(int     nt_interval,
 void
 cs_restart_checkpoint_set_mesh_mode(int  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, section values are copied to staging buffers
+ * (after redistribution to blocks in parallel) when written, and the
+ * staged data is written to file by a background thread when the
+ * checkpoint file is closed, so the computation may proceed while
+ * the checkpoint is being written. Host memory usage is thus increased
+ * by the size of one set of checkpoint files until writing is complete.
+ * Writing the same file again waits for completion of its previous
+ * writing.
+ *
+ * In parallel, this requires full MPI thread support (MPI_THREAD_MULTIPLE,
+ * which is requested at initialization when the CS_MPI_THREAD_MULTIPLE
+ * environment variable is set) and OpenMP support; otherwise, a warning
+ * is printed and checkpoints are written synchronously.
+ *
+ * \param[in]  async  write checkpoint files asynchronously if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether sections of checkpoint files defined on mesh
+ *         locations are compressed.
+ *
+ * Values are byte-shuffled (so that bytes of the same significance are
+ * contiguous) and compressed using zlib. Sections smaller than a few
+ * kilobytes are not compressed. Reading compressed sections is
+ * transparent.
+ *
+ * If code_saturne was built without zlib support, a warning is printed
+ * and sections are not compressed.
+ *
+ * \param[in]  compress  compress sections if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_lossless_compression(bool  compress);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define an absolute error tolerance for lossy compression
+ *         of floating-point checkpoint sections.
+ *
+ * The tolerance applies to sections defined on mesh locations whose name
+ * is the given name, or starts with the given name followed by "::"
+ * (so that a field's name applies to all its time values, such as
+ * "velocity::vals::0" and "velocity::vals::1").
+ *
+ * Values are quantized with a step of twice the tolerance, so the absolute
+ * error on values read at restart is bounded by the tolerance, then
+ * compressed as for \ref cs_restart_set_lossless_compression. If values
+ * are not finite or too large relative to the tolerance, the section is
+ * compressed losslessly.
+ *
+ * \param[in]  name       section or field name
+ * \param[in]  tolerance  absolute error tolerance, or a value <= 0
+ *                        to remove a previous definition
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_section_tolerance(const char  *name,
+                                 double       tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether restart files are read ahead in parallel.
+ *
+ * When active, after a section defined on a distributed mesh location
+ * is read, the block of the next such section in the file's index is
+ * read by a background thread (through a secondary file handle with
+ * private communicators) while values of the current section are
+ * distributed to ranks, so reading and redistribution overlap when
+ * sections are read in file order, as is usually the case. Block
+ * to entities distributors are cached per location in all cases.
+ *
+ * This requires full MPI thread support (MPI_THREAD_MULTIPLE, which is
+ * requested at initialization when the CS_MPI_THREAD_MULTIPLE environment
+ * variable is set) and OpenMP support; otherwise, a warning is printed
+ * and read-ahead is not activated. It has no effect in serial runs.
+ *
+ * This function must be called by all ranks.
+ *
+ * \param[in]  read_ahead  read sections ahead if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_read_ahead(bool  read_ahead);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define a node-local tier for checkpoint files.
+ *
+ * When active, checkpoint files in the default checkpoint directory are
+ * written by each rank (with its local values only) to a subdirectory of
+ * the given node-local directory (such as a local SSD or tmpfs), which
+ * is much faster than writing to a shared file system. Only every Nth
+ * checkpoint, and the checkpoint at the last time step, is written to the
+ * global checkpoint directory (asynchronously if
+ * \ref cs_restart_checkpoint_set_async is active).
+ *
+ * If partner copies are requested, the files of each rank are also copied
+ * to a partner rank, assumed to be on another node (ranks being placed
+ * consecutively on nodes), so that files lost with a node may be recovered
+ * at restart.
+ *
+ * At restart, if a complete node-local checkpoint more recent than the
+ * last global checkpoint is found for all ranks, it is used instead of
+ * the restart directory. This requires the same number of ranks and
+ * mesh partitioning as the run which wrote it.
+ *
+ * This function must be called by all ranks.
+ *
+ * \param[in]  path            node-local directory, or nullptr to
+ *                             deactivate the node-local tier
+ * \param[in]  flush_interval  write every flush_interval checkpoints
+ *                             to the global checkpoint directory
+ * \param[in]  partner_copy    copy files to a partner rank if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_local_tier(const char  *path,
+                                     int          flush_interval,
+                                     bool         partner_copy);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -367,10 +501,61 @@ cs_restart_set_from_memory_serialized(size_t   nb,
 void
 cs_checkpoint_set_to_memory_serialized(bool  status);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief  Indicate checkpoints will be written to a named entry of the
+ *         in-memory checkpoint store.
+ *
+ * Files written to the default checkpoint directory are then serialized
+ * in memory instead. Values are rank-local (as for the node-local tier),
+ * so the store may only be used for restarts with the same partitioning.
+ *
+ * If the named entry already exists, it is emptied; successive checkpoints
+ * overwrite its files.
+ *
+ * \param[in]  name  name of store entry, or nullptr to checkpoint to files
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_checkpoint_set_to_memory_store(const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief  Indicate restart will be read from a named entry of the
+ *         in-memory checkpoint store.
+ *
+ * The stored data is not copied nor consumed by the restart, so several
+ * successive computations (such as ensemble members or coupling
+ * iterations) may be restarted from the same entry.
+ *
+ * \param[in]  name  name of store entry, or nullptr to restart from files
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_from_memory_store(const char  *name);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief  Remove a named entry of the in-memory checkpoint store,
+ *         freeing the associated memory.
+ *
+ * \param[in]  name  name of store entry
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_memory_store_remove(const char  *name);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if we have a restart directory.
  *
+ * A complete node-local tier checkpoint (see
+ * \ref cs_restart_checkpoint_set_local_tier) is also considered
+ * as a restart directory.
+ *
  * \return  1 if a restart directory is present, 0 otherwise
  */
 /*----------------------------------------------------------------------------*/
@@ -3099,6 +3099,11 @@ cs_restart_read_field_vals(cs_restart_t  *r,
       BFT_FREE(v_tmp);
   }
 
+  /* Checkpoint values are interleaved */
+
+  if (retcode == CS_RESTART_SUCCESS && f->interleaved == false)
+    cs_field_interleave_values(f, false, f->vals[t_id], f->vals[t_id]);
+
   /* Store retcode in read status */
   _restart_set_field_read_status(f, retcode);
 
@@ -3125,12 +3130,26 @@ cs_restart_write_field_vals(cs_restart_t  *r,
 
   snprintf(sec_name, 127, "%s::vals::%d", f->name, t_id);
 
+  /* Checkpoint values are interleaved, whatever the field layout */
+
+  const cs_real_t *vals = f->vals[t_id];
+  cs_real_t *ilv_vals = nullptr;
+
+  if (f->interleaved == false) {
+    const cs_lnum_t n_alloc = cs_mesh_location_get_n_elts(f->location_id)[2];
+    BFT_MALLOC(ilv_vals, n_alloc*f->dim, cs_real_t);
+    cs_field_interleave_values(f, true, vals, ilv_vals);
+    vals = ilv_vals;
+  }
+
   cs_restart_write_section(r,
                            sec_name,
                            f->location_id,
                            f->dim,
                            CS_TYPE_cs_real_t,
-                           f->vals[t_id]);
+                           vals);
+
+  BFT_FREE(ilv_vals);
 }
 
 /*----------------------------------------------------------------------------*/
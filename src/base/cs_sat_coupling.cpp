@@ -2199,7 +2199,10 @@ cs_sat_coupling_locate_all
 
   #endif
 
-    /* Initialization of the distant point localization */
+    /* Initialization of the distant point localization; on updates
+       (transient mesh), points are first relocated on their previous
+       owner rank, so only points which changed rank are searched
+       globally */
 
     if (coupl->cell_cpl_sel != nullptr) {
       BFT_MALLOC(c_elt_list, cs_glob_mesh->n_cells, cs_lnum_t);
@@ -2218,19 +2221,19 @@ cs_sat_coupling_locate_all
                       point_tag);
     }
 
-    ple_locator_set_mesh(coupl->localis_cel,
-                         coupl->cells_sup,
-                         locator_options,
-                         0.,
-                         coupl->tolerance,
-                         3,
-                         nbr_cel_cpl,
-                         c_elt_list,
-                         point_tag,
-                         mesh_quantities->cell_cen,
-                         nullptr,
-                         cs_coupling_mesh_extents,
-                         cs_coupling_point_in_mesh_p);
+    ple_locator_update_mesh(coupl->localis_cel,
+                            coupl->cells_sup,
+                            locator_options,
+                            0.,
+                            coupl->tolerance,
+                            3,
+                            nbr_cel_cpl,
+                            c_elt_list,
+                            point_tag,
+                            mesh_quantities->cell_cen,
+                            nullptr,
+                            cs_coupling_mesh_extents,
+                            cs_coupling_point_in_mesh_p);
 
     ple_locator_shift_locations(coupl->localis_cel, -1);
 
@@ -2262,19 +2265,19 @@ cs_sat_coupling_locate_all
                       point_tag);
     }
 
-    ple_locator_set_mesh(coupl->localis_fbr,
-                         support_fbr,
-                         locator_options,
-                         0.,
-                         coupl->tolerance,
-                         3,
-                         nbr_fbr_cpl,
-                         f_elt_list,
-                         point_tag,
-                         mesh_quantities->b_face_cog,
-                         nullptr,
-                         cs_coupling_mesh_extents,
-                         cs_coupling_point_in_mesh_p);
+    ple_locator_update_mesh(coupl->localis_fbr,
+                            support_fbr,
+                            locator_options,
+                            0.,
+                            coupl->tolerance,
+                            3,
+                            nbr_fbr_cpl,
+                            f_elt_list,
+                            point_tag,
+                            mesh_quantities->b_face_cog,
+                            nullptr,
+                            cs_coupling_mesh_extents,
+                            cs_coupling_point_in_mesh_p);
 
     ple_locator_shift_locations(coupl->localis_fbr, -1);
 
@@ -2883,18 +2886,26 @@ cs_sat_coupling_exchange_at_bnd_faces
                                     distant_dist_fbr, distant_pond_fbr,
                                     distant_of, rvdis);
 
+      /* All variables are exchanged simultaneously, so that
+         the cost of the exchange is not multiplied by their number */
+
       if (n_g_b_faces_dist > 0 || n_g_b_faces_loc > 0) {
+        ple_locator_exchange_t **ex = nullptr;
+        BFT_MALLOC(ex, cpl->nvarto, ple_locator_exchange_t *);
         for (int i = 0; i < cpl->nvarto; i++) {
           cs_real_t *val_dist = (n_b_faces_dist > 0) ? rvdis[i] : nullptr;
           cs_real_t *val_loc = (n_b_faces_loc > 0) ? rvfbr[i] : nullptr;
-          ple_locator_exchange_point_var(locator,
-                                         val_dist,
-                                         val_loc,
-                                         nullptr,
-                                         sizeof(cs_real_t),
-                                         1, /* stride */
-                                         cpl->reverse);
+          ex[i] = ple_locator_exchange_point_var_start(locator,
+                                                       val_dist,
+                                                       val_loc,
+                                                       nullptr,
+                                                       sizeof(cs_real_t),
+                                                       1, /* stride */
+                                                       cpl->reverse);
         }
+        for (int i = 0; i < cpl->nvarto; i++)
+          ple_locator_exchange_point_var_wait(&(ex[i]));
+        BFT_FREE(ex);
       }
 
       for (int i = 0; i < cpl->nvarto; i++)
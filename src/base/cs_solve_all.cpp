@@ -146,6 +146,31 @@ cs_f_atr1vf(void);
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start transfer to the device of values of fields used by the
+ *        next computation stage.
+ *
+ * Only values whose device copy is out of date are transferred.
+ *
+ * \param[in]  n_fields  number of fields
+ * \param[in]  fields    pointers to fields (nullptr entries are ignored)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_prefetch_fields(int                n_fields,
+                 const cs_field_t  *fields[])
+{
+  for (int i = 0; i < n_fields; i++) {
+    const cs_field_t *f = fields[i];
+    if (f == nullptr)
+      continue;
+    for (int t_id = 0; t_id < f->n_time_vals; t_id++)
+      cs_field_prefetch_device(f, t_id);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update previous values for variables fields
@@ -515,10 +540,12 @@ _solve_most(int              n_var,
       if (   cs_glob_wall_distance_options->need_compute == 1
           && cs_glob_wall_distance_options->is_up_to_date == 0) {
 
-        if (cs_glob_wall_distance_options->method != 2)
-          cs_wall_distance(iterns);
+        if (cs_glob_wall_distance_options->method == 3)
+          cs_wall_distance_sweeping();
         else if (cs_glob_wall_distance_options->method == 2)
           cs_wall_distance_geometric();
+        else
+          cs_wall_distance(iterns);
         // Wall distance is not updated except if ALE is switched on
         if (cs_glob_ale == CS_ALE_NONE)
           cs_get_glob_wall_distance_options()->is_up_to_date = 1;
@@ -1096,6 +1123,24 @@ cs_solve_all(int  itrale)
   const cs_time_step_t *ts = cs_glob_time_step;
   bool _active_dyn = cs_time_control_is_active(vp_tc, ts);
 
+  /* Prefetch fields used by the velocity-pressure and turbulence stages */
+
+  {
+    const int i_mf_id
+      = cs_field_get_key_int(CS_F_(vel), cs_field_key_id("inner_mass_flux_id"));
+    const int b_mf_id
+      = cs_field_get_key_int(CS_F_(vel),
+                             cs_field_key_id("boundary_mass_flux_id"));
+
+    const cs_field_t *vp_fields[]
+      = {CS_F_(vel), CS_F_(p), CS_F_(dt), CS_F_(rho), CS_F_(rho_b),
+         CS_F_(mu), CS_F_(mu_t),
+         (i_mf_id > -1) ? cs_field_by_id(i_mf_id) : nullptr,
+         (b_mf_id > -1) ? cs_field_by_id(b_mf_id) : nullptr};
+
+    _prefetch_fields(sizeof(vp_fields)/sizeof(vp_fields[0]), vp_fields);
+  }
+
   while (need_new_solve) {
 
     _solve_most(n_var,
@@ -1150,6 +1195,13 @@ cs_solve_all(int  itrale)
     /* Solve turbulence
        ---------------- */
 
+    const cs_field_t *turb_fields[]
+      = {CS_F_(k), CS_F_(eps), CS_F_(rij), CS_F_(phi), CS_F_(f_bar),
+         CS_F_(alp_bl), CS_F_(omg), CS_F_(nusa)};
+
+    _prefetch_fields(sizeof(turb_fields)/sizeof(turb_fields[0]),
+                     turb_fields);
+
     _solve_turbulence(n_cells, n_cells_ext, eqp_vel->verbosity);
 
   } // end if _active_dyn
@@ -1179,6 +1231,12 @@ cs_solve_all(int  itrale)
   }
 
   if (n_scal > 0) {
+    const cs_field_t *sc_fields[n_scal];
+    for (int ii = 0; ii < n_scal; ii++)
+      sc_fields[ii] = cs_field_by_id(scalar_idx[ii]);
+
+    _prefetch_fields(n_scal, sc_fields);
+
     if (eqp_vel->verbosity > 0) {
       bft_printf
         (_(" ------------------------------------------------------------\n\n"
@@ -126,6 +126,15 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Count and log host/device transfers during a velocity-pressure step */
+
+static bool _check_transfers = false;
+
+/* Number of stages of the explicit Runge-Kutta velocity prediction
+   (0 for the implicit prediction) */
+
+static int _n_rk_stages = 0;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -1909,6 +1918,149 @@ _log_norm(const cs_mesh_t                *m,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Explicit low-storage Runge-Kutta velocity prediction.
+ *
+ * This replaces the implicit solve of the momentum equation by
+ * n_stages explicit stages (Jameson-type low-storage scheme):
+ *
+ * \f[
+ * \vect{u}^{(s)} = \vect{u}^n + \alpha_s \tens{f_s}^{imp,-1}
+ *   \left( \vect{Rhs} + \vect{B}(\vect{u}^{(s-1)}) \right)
+ * \f]
+ *
+ * where \f$ \vect{B} \f$ is the explicit convection/diffusion balance
+ * (\ref cs_balance_vector), and \f$ \tens{f_s}^{imp} \f$ contains the
+ * unsteady term and the implicit part of source terms, which are thus
+ * handled point-implicitly. Only the velocity and one work array are
+ * stored in addition to the stage coefficients.
+ *
+ * The time step must satisfy the explicit (CFL and Fourier) stability
+ * constraints, which are not checked here.
+ *
+ * \param[in]       n_stages  number of stages (3 or 4)
+ * \param[in]       ivisep    indicator to take transposed gradient and
+ *                            secondary viscosity into account
+ * \param[in]       eqp       velocity equation parameters
+ * \param[in]       vela      velocity at the previous time step
+ * \param[in]       velk      velocity at the previous sub-iteration
+ * \param[in]       bc_coeffs_v  velocity boundary condition structure
+ * \param[in]       imasfl    mass flux at interior faces
+ * \param[in]       bmasfl    mass flux at boundary faces
+ * \param[in]       viscf     visc*surface/dist at interior faces
+ * \param[in]       viscb     visc*surface/dist at boundary faces
+ * \param[in]       secvif    secondary viscosity at interior faces
+ * \param[in]       secvib    secondary viscosity at boundary faces
+ * \param[in]       icvflb    global indicator of boundary convection flux
+ * \param[in]       icvfli    boundary face indicator of convection flux
+ * \param[in]       fimp      implicit part of the unsteady and source terms
+ * \param[in]       smbr      explicit right hand side
+ * \param[in, out]  vel       predicted velocity
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_velocity_prediction_explicit_rk(int                          n_stages,
+                                 int                          ivisep,
+                                 cs_equation_param_t         *eqp,
+                                 const cs_real_3_t            vela[],
+                                 const cs_real_3_t            velk[],
+                                 const cs_field_bc_coeffs_t  *bc_coeffs_v,
+                                 const cs_real_t              imasfl[],
+                                 const cs_real_t              bmasfl[],
+                                 const cs_real_t              viscf[],
+                                 const cs_real_t              viscb[],
+                                 const cs_real_t              secvif[],
+                                 const cs_real_t              secvib[],
+                                 int                          icvflb,
+                                 const int                    icvfli[],
+                                 const cs_real_33_t           fimp[],
+                                 const cs_real_3_t            smbr[],
+                                 cs_real_3_t                  vel[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  /* Low-storage stage coefficients */
+  const cs_real_t alpha_3[3] = {1./3., 1./2., 1.};
+  const cs_real_t alpha_4[4] = {1./4., 1./3., 1./2., 1.};
+  const cs_real_t *alpha = (n_stages == 3) ? alpha_3 : alpha_4;
+
+  cs_dispatch_context ctx;
+
+  cs_real_33_t *fimp_inv;
+  cs_real_3_t *rhs;
+  CS_MALLOC_HD(fimp_inv, n_cells, cs_real_33_t, cs_alloc_mode);
+  CS_MALLOC_HD(rhs, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+
+  ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    for (cs_lnum_t ii = 0; ii < 3; ii++)
+      vel[c_id][ii] = velk[c_id][ii];
+  });
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    cs_math_33_inv_cramer(fimp[c_id], fimp_inv[c_id]);
+  });
+
+  for (int s_id = 0; s_id < n_stages; s_id++) {
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      for (cs_lnum_t ii = 0; ii < 3; ii++)
+        rhs[c_id][ii] = smbr[c_id][ii];
+    });
+
+    ctx.wait();
+
+    /* Mass accumulation is taken into account (imasac = 1), as the
+       convective part is not in the matrix */
+
+    cs_balance_vector(cs_glob_time_step_options->idtvar,
+                      CS_F_(vel)->id,
+                      1,  /* imasac */
+                      1,  /* inc */
+                      ivisep,
+                      eqp,
+                      vel,
+                      vela,
+                      bc_coeffs_v,
+                      imasfl,
+                      bmasfl,
+                      viscf,
+                      viscb,
+                      secvif,
+                      secvib,
+                      nullptr,
+                      nullptr,
+                      nullptr,
+                      icvflb,
+                      icvfli,
+                      nullptr,
+                      nullptr,
+                      rhs);
+
+    const cs_real_t a_s = alpha[s_id];
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      for (cs_lnum_t ii = 0; ii < 3; ii++) {
+        cs_real_t du = 0.;
+        for (cs_lnum_t jj = 0; jj < 3; jj++)
+          du += fimp_inv[c_id][ii][jj] * rhs[c_id][jj];
+        vel[c_id][ii] = vela[c_id][ii] + a_s*du;
+      }
+    });
+
+    ctx.wait();
+
+    cs_mesh_sync_var_vect((cs_real_t *)vel);
+
+  }
+
+  CS_FREE_HD(rhs);
+  CS_FREE_HD(fimp_inv);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
   * \brief Velocity prediction step of the Navier-Stokes equations for
@@ -3105,33 +3257,57 @@ _velocity_prediction(const cs_mesh_t             *m,
 
     int *icvfli = cs_cf_boundary_conditions_get_icvfli();
 
-    cs_equation_iterative_solve_vector(cs_glob_time_step_options->idtvar,
-                                       iterns,
-                                       CS_F_(vel)->id,
-                                       nullptr,
+    if (_n_rk_stages > 0) {
+      _velocity_prediction_explicit_rk(_n_rk_stages,
                                        vp_model->ivisse,
-                                       iescap,
                                        &eqp_loc,
                                        vela,
                                        velk,
                                        bc_coeffs_v,
                                        imasfl,
                                        bmasfl,
-                                       viscfi,
-                                       viscbi,
                                        viscf,
                                        viscb,
                                        secvif,
                                        secvib,
-                                       nullptr,
-                                       nullptr,
-                                       nullptr,
                                        icvflb,
                                        icvfli,
                                        fimp,
                                        smbr,
-                                       vel,
-                                       eswork);
+                                       vel);
+
+      /* No convergence estimator for the explicit prediction */
+      if (eswork != nullptr)
+        cs_array_real_fill_zero(3*n_cells, (cs_real_t *)eswork);
+    }
+    else
+      cs_equation_iterative_solve_vector(cs_glob_time_step_options->idtvar,
+                                         iterns,
+                                         CS_F_(vel)->id,
+                                         nullptr,
+                                         vp_model->ivisse,
+                                         iescap,
+                                         &eqp_loc,
+                                         vela,
+                                         velk,
+                                         bc_coeffs_v,
+                                         imasfl,
+                                         bmasfl,
+                                         viscfi,
+                                         viscbi,
+                                         viscf,
+                                         viscb,
+                                         secvif,
+                                         secvib,
+                                         nullptr,
+                                         nullptr,
+                                         nullptr,
+                                         icvflb,
+                                         icvfli,
+                                         fimp,
+                                         smbr,
+                                         vel,
+                                         eswork);
 
     /* Compute kinetic energy balance for compressible algorithm
      * See H. Amino thesis */
@@ -3571,6 +3747,38 @@ _hydrostatic_pressure_prediction(cs_real_t        grdphd[][3],
   CS_FREE_HD(bc_coeffs_dp.bf);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log host/device transfers which occurred since the beginning of the
+ *        current velocity-pressure step (when transfer checking is active).
+ *
+ * \param[in]  iterns  index of the iteration on Navier-Stokes
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_log_transfer_count(int  iterns)
+{
+  cs_gnum_t n_transfers[2], n_bytes[2];
+  cs_transfer_count_stop(n_transfers, n_bytes);
+
+  cs_parall_counter(n_transfers, 2);
+  cs_parall_counter(n_bytes, 2);
+
+  if (n_transfers[0] + n_transfers[1] == 0)
+    return;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n  Velocity-pressure step %d: host/device transfers\n"
+                  "    host to device: %llu (%llu bytes)\n"
+                  "    device to host: %llu (%llu bytes)\n"),
+                iterns,
+                (unsigned long long)n_transfers[0],
+                (unsigned long long)n_bytes[0],
+                (unsigned long long)n_transfers[1],
+                (unsigned long long)n_bytes[1]);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -3618,6 +3826,53 @@ cs_f_navier_stokes_total_pressure(void)
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate counting of host/device transfers during
+ *        each velocity-pressure step (\ref cs_solve_navier_stokes).
+ *
+ * When active, the number and size of transfers between host and device
+ * memory are logged after each step in which some transfer occurred.
+ * This is a diagnostic tool to detect host-only operations in the
+ * device-resident velocity-pressure sequence.
+ *
+ * \param[in]  check  true to count and log transfers, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_solve_navier_stokes_set_transfer_check(bool  check)
+{
+  _check_transfers = check;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select an explicit low-storage Runge-Kutta scheme for the
+ *        velocity prediction step.
+ *
+ * With 3 or 4 stages, the momentum equation is advanced explicitly
+ * (using the same convection/diffusion balance operators as the implicit
+ * scheme), so no linear system is solved for the velocity; the pressure
+ * correction step is unchanged. This is intended for LES with small
+ * time steps, which must respect the explicit stability constraints.
+ *
+ * \param[in]  n_stages  number of stages: 3, 4, or 0 for the default
+ *                       implicit prediction
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_solve_navier_stokes_set_explicit_rk(int  n_stages)
+{
+  if (n_stages != 0 && n_stages != 3 && n_stages != 4)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: %d stages requested, but only 0 (implicit), 3 or 4\n"
+                "stages are handled."), __func__, n_stages);
+
+  _n_rk_stages = n_stages;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update total pressure (defined as a post-processed property).
@@ -3764,6 +4019,9 @@ cs_solve_navier_stokes(const int        iterns,
 
   int nbrcpl = cs_sat_coupling_n_couplings();
 
+  if (_check_transfers)
+    cs_transfer_count_start();
+
   cs_dispatch_context ctx, ctx_c;
 #if defined(HAVE_CUDA)
   ctx_c.set_cuda_stream(cs_cuda_get_stream(1));
@@ -3820,12 +4078,12 @@ cs_solve_navier_stokes(const int        iterns,
     /* Compute the L2 velocity norm
        (it is zero at the first time step, so we recompute it) */
     if (iterns == 1 || fabs(vp_param->xnrmu0) <= 0) {
-      cs_real_t xnrtmp = 0.0;
-#     pragma omp parallel for reduction(+:xnrtmp) if(n_cells > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        xnrtmp += cs_math_3_dot_product(vel[c_id],
-                                        vel[c_id])*cell_f_vol[c_id];
-      }
+      double xnrtmp = 0.0;
+      ctx.parallel_for_reduce_sum
+        (n_cells, xnrtmp, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id, double &sum) {
+        sum += cs_math_3_dot_product(vel[c_id],
+                                     vel[c_id])*cell_f_vol[c_id];
+      });
       cs_parall_sum(1, CS_REAL_TYPE, &xnrtmp);
       vp_param->xnrmu0 = xnrtmp;
 
@@ -4168,6 +4426,9 @@ cs_solve_navier_stokes(const int        iterns,
     CS_FREE_HD(_xyzp0);
 #endif
 
+    if (_check_transfers)
+      _log_transfer_count(iterns);
+
     return;
   }
 
@@ -4694,14 +4955,14 @@ cs_solve_navier_stokes(const int        iterns,
 
     const cs_real_t *cell_f_vol = mq->cell_f_vol;
 
-    cs_real_t xnrtmp = 0;
-#   pragma omp parallel for reduction(+:xnrtmp) if(n_cells > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    double xnrtmp = 0;
+    ctx.parallel_for_reduce_sum
+      (n_cells, xnrtmp, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id, double &sum) {
       cs_real_t xduvw[3] = {vel[c_id][0] - velk[c_id][0],
                             vel[c_id][1] - velk[c_id][1],
                             vel[c_id][2] - velk[c_id][2]};
-      xnrtmp += cs_math_3_dot_product(xduvw, xduvw) * cell_f_vol[c_id];
-    }
+      sum += cs_math_3_dot_product(xduvw, xduvw) * cell_f_vol[c_id];
+    });
     cs_parall_sum(1, CS_REAL_TYPE, &xnrtmp);
     vp_param->xnrmu = xnrtmp;
 
@@ -4794,6 +5055,9 @@ cs_solve_navier_stokes(const int        iterns,
   CS_FREE_HD(_gxyz);
   CS_FREE_HD(_xyzp0);
 #endif
+
+  if (_check_transfers)
+    _log_transfer_count(iterns);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -57,6 +57,42 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate counting of host/device transfers during
+ *        each velocity-pressure step (\ref cs_solve_navier_stokes).
+ *
+ * When active, the number and size of transfers between host and device
+ * memory are logged after each step in which some transfer occurred.
+ * This is a diagnostic tool to detect host-only operations in the
+ * device-resident velocity-pressure sequence.
+ *
+ * \param[in]  check  true to count and log transfers, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_solve_navier_stokes_set_transfer_check(bool  check);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select an explicit low-storage Runge-Kutta scheme for the
+ *        velocity prediction step.
+ *
+ * With 3 or 4 stages, the momentum equation is advanced explicitly
+ * (using the same convection/diffusion balance operators as the implicit
+ * scheme), so no linear system is solved for the velocity; the pressure
+ * correction step is unchanged. This is intended for LES with small
+ * time steps, which must respect the explicit stability constraints.
+ *
+ * \param[in]  n_stages  number of stages: 3, 4, or 0 for the default
+ *                       implicit prediction
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_solve_navier_stokes_set_explicit_rk(int  n_stages);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Solve Navier-Stokes equations for incompressible or slightly
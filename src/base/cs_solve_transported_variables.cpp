@@ -60,6 +60,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_physical_constants.h"
 #include "cs_physical_model.h"
+#include "cs_repartition.h"
 #include "cs_restart.h"
 #include "cs_solve_equation.h"
 #include "cs_time_step.h"
@@ -112,7 +113,8 @@ cs_f_max_mid_min_progvar(const cs_real_t  *zmo,
                          cs_real_t        *cmin);
 
 void
-cs_f_compute_gaseous_chemistry(cs_real_t dt[]);
+cs_f_compute_gaseous_chemistry(cs_real_t  dt[],
+                               cs_real_t  cost[]);
 
 /*============================================================================
  * Type definitions
@@ -557,8 +559,27 @@ cs_solve_transported_variables(int iterns)
 
   if (   atmo_chem->model >= 1
       && atmo_chem->aerosol_model == CS_ATMO_AEROSOL_OFF
-      && nespg > 0 && iterns == -1)
-    cs_f_compute_gaseous_chemistry(dt);
+      && nespg > 0 && iterns == -1) {
+
+    /* Integration steps are counted for partitioning
+       based on measured costs */
+
+    cs_real_t *chem_cost = nullptr;
+    int cost_id = cs_repartition_cost_id("atmospheric_chemistry");
+    if (cost_id > -1) {
+      BFT_MALLOC(chem_cost, m->n_cells, cs_real_t);
+      for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++)
+        chem_cost[c_id] = 0.;
+    }
+
+    cs_f_compute_gaseous_chemistry(dt, chem_cost);
+
+    if (cost_id > -1) {
+      cs_repartition_cost_add(cost_id, m->n_cells, nullptr, chem_cost);
+      BFT_FREE(chem_cost);
+    }
+
+  }
 
   /* Atmospheric gas + aerosol chemistry */
   if (   atmo_chem->model >= 1
@@ -0,0 +1,277 @@
+/*============================================================================
+ * Startup phase timing and memory high-water marks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_mem_usage.h"
+
+#include "cs_log.h"
+#include "cs_parall.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_startup_log.h"
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_startup_log.cpp
+        Startup phase timing and memory high-water marks.
+
+  Startup phases are delimited by calls to \ref cs_startup_log_phase,
+  and complement the "mesh_processing" and "calculation_setup" timer
+  statistics, for which only cumulative times are available. Process
+  memory high-water marks are sampled at the end of each phase, so the
+  phase responsible for the peak memory usage during startup can be
+  identified.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#define CS_STARTUP_LOG_N_MAX  64
+#define CS_STARTUP_LOG_NAME_LEN  40
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Startup phase info */
+
+typedef struct {
+
+  char    name[CS_STARTUP_LOG_NAME_LEN];  /* phase name */
+
+  double  t_start;                        /* wall clock time at start */
+  double  t_elapsed;                      /* elapsed wall clock time */
+
+  double  pr_hwm;                         /* process memory high-water
+                                             mark at end (kB) */
+  double  heap_hwm;                       /* instrumented memory high-water
+                                             mark at end (kB) */
+
+} _phase_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int       _n_phases = 0;
+static bool      _finalized = false;
+static _phase_t  _phases[CS_STARTUP_LOG_N_MAX];
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * End current phase, if present.
+ *
+ * parameters:
+ *   t <-- current wall clock time
+ *----------------------------------------------------------------------------*/
+
+static void
+_end_phase(double  t)
+{
+  if (_n_phases < 1)
+    return;
+
+  _phase_t *p = _phases + _n_phases - 1;
+
+  p->t_elapsed = t - p->t_start;
+  p->pr_hwm = 0;
+  if (bft_mem_usage_initialized())
+    p->pr_hwm = bft_mem_usage_max_pr_size();
+  p->heap_hwm = bft_mem_size_max();
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a new startup phase, ending the previous one.
+ *
+ * The first phase starts at program start (the first call to
+ * \ref cs_timer_wtime). This function does not allocate memory, so it may
+ * be called before memory management is initialized. It does nothing
+ * once \ref cs_startup_log_finalize has been called.
+ *
+ * \param[in]  phase_name  name of phase starting now
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_startup_log_phase(const char  *phase_name)
+{
+  if (_finalized)
+    return;
+
+  double t = (_n_phases > 0) ? cs_timer_wtime() : 0.;
+
+  /* When the maximum number of phases is reached, the last phase
+     accumulates all following ones. */
+
+  if (_n_phases >= CS_STARTUP_LOG_N_MAX) {
+    strcpy(_phases[_n_phases - 1].name, "other");
+    return;
+  }
+
+  _end_phase(t);
+
+  _phase_t *p = _phases + _n_phases;
+
+  strncpy(p->name, phase_name, CS_STARTUP_LOG_NAME_LEN - 1);
+  p->name[CS_STARTUP_LOG_NAME_LEN - 1] = '\0';
+  p->t_start = t;
+  p->t_elapsed = 0;
+  p->pr_hwm = 0;
+  p->heap_hwm = 0;
+
+  _n_phases += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief End the current startup phase and log startup phases summary.
+ *
+ * For each phase, the elapsed time and the process memory high-water
+ * mark at the end of the phase (mean and max over ranks) are logged to
+ * the performance log. Further calls to this function or to
+ * \ref cs_startup_log_phase are ignored.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_startup_log_finalize(void)
+{
+  if (_finalized)
+    return;
+
+  _end_phase(cs_timer_wtime());
+  _finalized = true;
+
+  const int n_phases = _n_phases;
+  if (n_phases < 1)
+    return;
+
+  /* Phases should be the same on all ranks; if not, only
+     local values are logged. */
+
+  int n_min = n_phases, n_max = n_phases;
+  cs_parall_min(1, CS_INT_TYPE, &n_min);
+  cs_parall_max(1, CS_INT_TYPE, &n_max);
+
+  const bool reduce = (n_min == n_max);
+
+  /* Values: elapsed time and process high-water mark (sum and max),
+     instrumented high-water mark (max) */
+
+  double *v_sum, *v_max;
+  BFT_MALLOC(v_sum, n_phases*2, double);
+  BFT_MALLOC(v_max, n_phases*3, double);
+
+  for (int i = 0; i < n_phases; i++) {
+    v_sum[i*2]     = _phases[i].t_elapsed;
+    v_sum[i*2 + 1] = _phases[i].pr_hwm;
+    v_max[i*3]     = _phases[i].t_elapsed;
+    v_max[i*3 + 1] = _phases[i].pr_hwm;
+    v_max[i*3 + 2] = _phases[i].heap_hwm;
+  }
+
+  double n_ranks = 1;
+
+  if (reduce) {
+    cs_parall_sum(n_phases*2, CS_DOUBLE, v_sum);
+    cs_parall_max(n_phases*3, CS_DOUBLE, v_max);
+    n_ranks = cs_glob_n_ranks;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Startup phases:\n\n"
+                  "                                   "
+                  "   elapsed time (s)     "
+                  "memory high-water mark (MiB)\n"
+                  "  %-32s %10s %10s %10s %10s %10s\n"),
+                _("phase"), _("mean"), _("max"),
+                _("mean"), _("max"), _("instr."));
+
+  double t_sum = 0, t_max = 0;
+
+  for (int i = 0; i < n_phases; i++) {
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-32s %10.3f %10.3f %10.1f %10.1f %10.1f\n",
+                  _phases[i].name,
+                  v_sum[i*2]/n_ranks, v_max[i*3],
+                  v_sum[i*2 + 1]/n_ranks/1024., v_max[i*3 + 1]/1024.,
+                  v_max[i*3 + 2]/1024.);
+    t_sum += v_sum[i*2];
+    t_max += v_max[i*3];
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n  %-32s %10.3f %10.3f\n",
+                _("total"), t_sum/n_ranks, t_max);
+
+  if (!reduce)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n  Phases differ between ranks;"
+                    " only values for rank 0 are shown.\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  BFT_FREE(v_max);
+  BFT_FREE(v_sum);
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,80 @@
+#ifndef __CS_STARTUP_LOG_H__
+#define __CS_STARTUP_LOG_H__
+
+/*============================================================================
+ * Startup phase timing and memory high-water marks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a new startup phase, ending the previous one.
+ *
+ * The first phase starts at program start (the first call to
+ * \ref cs_timer_wtime). This function does not allocate memory, so it may
+ * be called before memory management is initialized. It does nothing
+ * once \ref cs_startup_log_finalize has been called.
+ *
+ * \param[in]  phase_name  name of phase starting now
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_startup_log_phase(const char  *phase_name);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief End the current startup phase and log startup phases summary.
+ *
+ * For each phase, the elapsed time and the process memory high-water
+ * mark at the end of the phase (mean and max over ranks) are logged to
+ * the performance log. Further calls to this function or to
+ * \ref cs_startup_log_phase are ignored.
+ *
+ * This function must be called by all ranks.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_startup_log_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_STARTUP_LOG_H__ */
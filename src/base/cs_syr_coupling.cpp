@@ -1813,15 +1813,17 @@ _syr_coupling_send_tf_hf(cs_syr_coupling_t  *syr_coupling,
     send_var[ii*2 + 1] = hf[dist_loc[ii]];
   }
 
-  ple_locator_exchange_point_var(coupling_ent->locator,
-                                 send_var,
-                                 nullptr,
-                                 nullptr,
-                                 sizeof(double),
-                                 2,
-                                 0);
-
-  BFT_FREE(send_var);
+  /* Local updates below do not depend on the exchange,
+     so they are done while values are sent */
+
+  ple_locator_exchange_t *ex
+    = ple_locator_exchange_point_var_start(coupling_ent->locator,
+                                           send_var,
+                                           nullptr,
+                                           nullptr,
+                                           sizeof(double),
+                                           2,
+                                           0);
 
   if (mode == 1 && coupling_ent->n_elts > 0) {
 
@@ -1836,6 +1838,10 @@ _syr_coupling_send_tf_hf(cs_syr_coupling_t  *syr_coupling,
 
   }
 
+  ple_locator_exchange_point_var_wait(&ex);
+
+  BFT_FREE(send_var);
+
   /* Exchange flux and corrector coefficient to ensure conservativity */
 
   if (_syr_coupling_conservativity > 0 && mode == 0)
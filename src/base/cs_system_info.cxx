@@ -591,6 +591,11 @@ _system_info(bool  log)
           cs_log_printf(logs[log_id],
                         "  %s%d\n", _("MPI_COMM_WORLD size: "),
                         n_world_ranks);
+        if (cs_glob_ensemble_n_members > 1)
+          cs_log_printf(logs[log_id],
+                        "  %s%d / %d\n", _("Ensemble member:     "),
+                        cs_glob_ensemble_member_id + 1,
+                        cs_glob_ensemble_n_members);
       }
     }
 
@@ -178,6 +178,27 @@ typedef struct {
 
 } cs_time_moment_t;
 
+/* Moment update descriptor, for fused update of moments sharing
+   a weight accumulator and location */
+/*----------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_time_moment_t       *mt;           /* Associated moment */
+
+  cs_real_t              *val;          /* Moment values */
+  cs_real_t              *m;            /* Mean values for variance,
+                                           or NULL */
+
+  const int              *msd;          /* Simple data definition, or NULL */
+  const cs_real_t       **f_val;        /* Simple data field values */
+  cs_lnum_t              *f_stride;     /* Simple data field element strides */
+
+  cs_real_t              *x;            /* Precomputed data values if not
+                                           based on simple data, or NULL */
+
+} cs_time_moment_update_t;
+
 /* Moment restart metadata */
 /*-------------------------*/
 
@@ -1455,6 +1476,235 @@ _ensure_init_moment(cs_time_moment_t  *mt)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Initialize a moment update descriptor.
+ *
+ * For moments based on simple data (field component products), field
+ * values are accessed directly during the update sweep, so no temporary
+ * data array is needed. For other moments, data values are computed
+ * and stored in a temporary array.
+ *
+ * parameters:
+ *   mt <-> moment
+ *   mu --> moment update descriptor
+ *----------------------------------------------------------------------------*/
+
+static void
+_moment_update_init(cs_time_moment_t         *mt,
+                    cs_time_moment_update_t  *mu)
+{
+  mu->mt = mt;
+
+  _ensure_init_moment(mt);
+  mu->val = mt->val;
+  if (mt->f_id > -1)
+    mu->val = cs_field_by_id(mt->f_id)->val;
+
+  mu->m = NULL;
+  if (mt->type == CS_TIME_MOMENT_VARIANCE) {
+    assert(mt->l_id > -1);
+    cs_time_moment_t *mt_mean = _moment + mt->l_id;
+    _ensure_init_moment(mt_mean);
+    mu->m = mt_mean->val;
+    if (mt_mean->f_id > -1)
+      mu->m = cs_field_by_id(mt_mean->f_id)->val;
+  }
+
+  mu->msd = NULL;
+  mu->f_val = NULL;
+  mu->f_stride = NULL;
+  mu->x = NULL;
+
+  if (mt->data_func == _sd_moment_data) {
+    const int *msd = mt->data_input;
+    const int n_fields = msd[2];
+    mu->msd = msd;
+    BFT_MALLOC(mu->f_val, n_fields, const cs_real_t *);
+    BFT_MALLOC(mu->f_stride, n_fields, cs_lnum_t);
+    for (int i = 0; i < n_fields; i++) {
+      const cs_field_t *f = cs_field_by_id(msd[3 + (2 + msd[1])*i]);
+      mu->f_val[i] = (const cs_real_t *)f->val;
+      mu->f_stride[i] = (f->location_id != 0) ? f->dim : 0;
+    }
+  }
+  else {
+    const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(mt->location_id)[0];
+    BFT_MALLOC(mu->x, n_elts*mt->data_dim, cs_real_t);
+    mt->data_func(mt->data_input, mu->x);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free temporary arrays of a moment update descriptor.
+ *
+ * parameters:
+ *   mu <-> moment update descriptor
+ *----------------------------------------------------------------------------*/
+
+static void
+_moment_update_free(cs_time_moment_update_t  *mu)
+{
+  BFT_FREE(mu->f_val);
+  BFT_FREE(mu->f_stride);
+  BFT_FREE(mu->x);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute data values of a moment for a given element.
+ *
+ * parameters:
+ *   mu   <-- moment update descriptor
+ *   dim  <-- data dimension
+ *   e_id <-- element id
+ *   x    --> data values for this element
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_moment_update_data(const cs_time_moment_update_t  *mu,
+                    int                             dim,
+                    cs_lnum_t                       e_id,
+                    double                          x[])
+{
+  if (mu->msd == NULL) {
+    for (int k = 0; k < dim; k++)
+      x[k] = mu->x[e_id*dim + k];
+    return;
+  }
+
+  const int *msd = mu->msd;
+  const int stride = 2 + msd[1];
+  const int n_fields = msd[2];
+
+  const cs_real_t *v = mu->f_val[0] + mu->f_stride[0]*e_id;
+  for (int k = 0; k < dim; k++)
+    x[k] = v[msd[3 + 2 + k]];
+
+  for (int j = 1; j < n_fields; j++) {
+    v = mu->f_val[j] + mu->f_stride[j]*e_id;
+    for (int k = 0; k < dim; k++)
+      x[k] *= v[msd[3 + j*stride + 2 + k]];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update a group of moments sharing a weight accumulator and location
+ * in a single sweep over elements.
+ *
+ * Data values are computed on the fly for each element, so that field
+ * values shared by several moments are reused while in cache, and
+ * means and variances are updated using Welford's algorithm.
+ *
+ * parameters:
+ *   n_elts    <-- number of elements
+ *   wa_stride <-- weight accumulator stride (0 for global weights)
+ *   w         <-- current weight
+ *   wa_sum    <-- accumulated weight
+ *   n_mu      <-- number of moments in group
+ *   mu        <-- moment update descriptors
+ *----------------------------------------------------------------------------*/
+
+static void
+_moment_update_group(cs_lnum_t                       n_elts,
+                     cs_lnum_t                       wa_stride,
+                     const cs_real_t                 w[],
+                     const cs_real_t                 wa_sum[],
+                     int                             n_mu,
+                     const cs_time_moment_update_t   mu[])
+{
+# pragma omp parallel for if (n_elts*n_mu > CS_THR_MIN)
+  for (cs_lnum_t je = 0; je < n_elts; je++) {
+
+    const cs_lnum_t k = je*wa_stride;
+    const double wa_sum_n = w[k] + wa_sum[k];
+    const double c = w[k] / wa_sum_n;
+
+    for (int i = 0; i < n_mu; i++) {
+
+      const cs_time_moment_t *mt = mu[i].mt;
+      const int dim = mt->dim;
+      const int data_dim = mt->data_dim;
+      cs_real_t *restrict val = mu[i].val + je*dim;
+
+      double x[9];
+      _moment_update_data(mu + i, data_dim, je, x);
+
+      if (mt->type == CS_TIME_MOMENT_MEAN) {
+        for (int l = 0; l < dim; l++)
+          val[l] += (x[l] - val[l]) * c;
+      }
+
+      else if (dim == 6 && data_dim == 3) { /* variance-covariance matrix */
+        cs_real_t *restrict m = mu[i].m + je*3;
+        double delta[3], delta_n[3], r[3];
+        for (int l = 0; l < 3; l++) {
+          delta[l] = x[l] - m[l];
+          r[l] = delta[l] * c;
+          delta_n[l] = x[l] - (m[l] + r[l]);
+          val[l] = (val[l]*wa_sum[k] + (w[k]*delta[l]*delta_n[l])) / wa_sum_n;
+        }
+        /* Covariance terms.
+           Note we could have a symmetric formula using
+             0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+           instead of
+             delta[i]*delta_n[j]
+           but unit tests in cs_moment_test.c do not seem to favor
+           one variant over the other; we use the simplest one.
+        */
+        val[3] = (val[3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1])) / wa_sum_n;
+        val[4] = (val[4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2])) / wa_sum_n;
+        val[5] = (val[5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2])) / wa_sum_n;
+        for (int l = 0; l < 3; l++)
+          m[l] += r[l];
+      }
+
+      else { /* simple variance */
+        cs_real_t *restrict m = mu[i].m + je*dim;
+        for (int l = 0; l < dim; l++) {
+          double delta = x[l] - m[l];
+          double r = delta * c;
+          double m_n = m[l] + r;
+          val[l] = (val[l]*wa_sum[k] + (w[k]*delta*(x[l]-m_n))) / wa_sum_n;
+          m[l] += r;
+        }
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize ghost values of a moment defined on cells.
+ *
+ * parameters:
+ *   mt  <-- moment
+ *   val <-> moment values
+ *----------------------------------------------------------------------------*/
+
+static void
+_moment_sync(const cs_time_moment_t  *mt,
+             cs_real_t               *val)
+{
+  if (mt->location_id != CS_MESH_LOCATION_CELLS)
+    return;
+
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+  if (halo == NULL)
+    return;
+
+  if (mt->dim == 1)
+    cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
+  else {
+    cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, mt->dim);
+    if (halo->n_transforms > 0) {
+      if (mt->dim == 3)
+        cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
+      else if (mt->dim == 6)
+        cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
+    }
+  }
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -1990,6 +2240,9 @@ cs_time_moment_map_cell_dt(const cs_real_t  *dt)
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all moment accumulators.
+ *
+ * Moments sharing a weight accumulator and location are updated together,
+ * in a single sweep over elements.
  */
 /*----------------------------------------------------------------------------*/
 
@@ -2047,155 +2300,84 @@ cs_time_moment_update_all(void)
       wa_cur_data[i] = NULL;
   }
 
-  /* Loop on variances first */
-
-  for (int m_type = CS_TIME_MOMENT_VARIANCE;
-       m_type >= (int)CS_TIME_MOMENT_MEAN;
-       m_type --) {
-
-    for (i = 0; i < _n_moments; i++) {
-
-      cs_time_moment_t *mt = _moment + i;
-      cs_time_moment_wa_t *mwa = _moment_wa + mt->wa_id;
-
-      if (   mt->nt_cur < ts->nt_cur
-          && (int)(mt->type) == m_type
-          && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur)) {
-
-        /* Current and accumulated weight */
-
-        cs_lnum_t  wa_stride;
-        cs_real_t *restrict wa_sum, *restrict x;
+  /* Moments are grouped by weight accumulator and location, so that
+     all moments of a group are updated in a single sweep over elements;
+     means updated as part of a variance computation are skipped. */
 
-        cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
+  bool *skip;
+  cs_time_moment_update_t *mu;
+  BFT_MALLOC(skip, _n_moments, bool);
+  BFT_MALLOC(mu, _n_moments, cs_time_moment_update_t);
 
-        if (mwa->location_id == CS_MESH_LOCATION_NONE) {
-          wa_sum = &(mwa->val0);
-          wa_stride = 0;
-        }
-        else {
-          wa_sum = mwa->val;
-          wa_stride = 1;
-        }
-
-        /* Current value */
-
-        const cs_lnum_t n_elts
-          = cs_mesh_location_get_n_elts(mt->location_id)[0];
-        const cs_lnum_t nd = n_elts * mt->dim;
-
-        BFT_MALLOC(x, nd, cs_real_t);
-
-        mt->data_func(mt->data_input, x);
-
-        _ensure_init_moment(mt);
+  for (i = 0; i < _n_moments; i++) {
+    cs_time_moment_t *mt = _moment + i;
+    cs_time_moment_wa_t *mwa = _moment_wa + mt->wa_id;
+    skip[i] = (   mt->nt_cur >= ts->nt_cur
+               || mwa->nt_start < 0 || mwa->nt_start > ts->nt_cur);
+  }
+  for (i = 0; i < _n_moments; i++) {
+    cs_time_moment_t *mt = _moment + i;
+    if (skip[i] == false && mt->type == CS_TIME_MOMENT_VARIANCE)
+      skip[mt->l_id] = true;
+  }
 
-        cs_real_t *restrict val = mt->val;
-        if (mt->f_id > -1) {
-          cs_field_t *f = cs_field_by_id(mt->f_id);
-          val = f->val;
-        }
+  for (i = 0; i < _n_moments; i++) {
 
-        if (mt->type == CS_TIME_MOMENT_VARIANCE) {
+    if (skip[i])
+      continue;
 
-          assert(mt->l_id > -1);
+    const int wa_id = _moment[i].wa_id;
+    const int location_id = _moment[i].location_id;
 
-          cs_time_moment_t *mt_mean = _moment + mt->l_id;
+    /* Build group */
 
-          _ensure_init_moment(mt_mean);
-          cs_real_t *restrict m = mt_mean->val;
-          if (mt_mean->f_id > -1) {
-            cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-            m = f_mean->val;
-          }
+    int n_mu = 0;
+    for (int j = i; j < _n_moments; j++) {
+      cs_time_moment_t *mt = _moment + j;
+      if (   skip[j] == false
+          && mt->wa_id == wa_id && mt->location_id == location_id) {
+        _moment_update_init(mt, mu + n_mu);
+        n_mu++;
+        skip[j] = true;
+      }
+    }
 
-          if (mt->dim == 6) { /* variance-covariance matrix */
-            assert(mt->data_dim == 3);
-            for (cs_lnum_t je = 0; je < n_elts; je++) {
-              double delta[3], delta_n[3], r[3], m_n[3];
-              const cs_lnum_t k = je*wa_stride;
-              const double wa_sum_n = w[k] + wa_sum[k];
-              for (cs_lnum_t l = 0; l < 3; l++) {
-                cs_lnum_t jl = je*6 + l, jml = je*3 + l;
-                delta[l]   = x[jml] - m[jml];
-                r[l] = delta[l] * (w[k] / wa_sum_n);
-                m_n[l] = m[jml] + r[l];
-                delta_n[l] = x[jml] - m_n[l];
-                val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
-                          / wa_sum_n;
-              }
-              /* Covariance terms.
-                 Note we could have a symmetric formula using
-                   0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                 instead of
-                   delta[i]*delta_n[j]
-                 but unit tests in cs_moment_test.c do not seem to favor
-                 one variant over the other; we use the simplest one.
-              */
-              cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
-              val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
-                        / wa_sum_n;
-              val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
-                        / wa_sum_n;
-              val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
-                        / wa_sum_n;
-              for (cs_lnum_t l = 0; l < 3; l++)
-                m[je*3 + l] += r[l];
-            }
-          }
+    /* Current and accumulated weight */
 
-          else { /* simple variance */
-            for (cs_lnum_t j = 0; j < nd; j++) {
-              const cs_lnum_t k = (j*wa_stride) / mt->dim;
-              double wa_sum_n = w[k] + wa_sum[k];
-              double delta = x[j] - m[j];
-              double r = delta * (w[k] / wa_sum_n);
-              double m_n = m[j] + r;
-              val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
-              m[j] += r;
-            }
-          }
+    cs_time_moment_wa_t *mwa = _moment_wa + wa_id;
 
-          mt_mean->nt_cur = ts->nt_cur;
-        }
+    cs_lnum_t  wa_stride;
+    const cs_real_t *wa_sum;
 
-        else if (mt->type == CS_TIME_MOMENT_MEAN) {
+    if (mwa->location_id == CS_MESH_LOCATION_NONE) {
+      wa_sum = &(mwa->val0);
+      wa_stride = 0;
+    }
+    else {
+      wa_sum = mwa->val;
+      wa_stride = 1;
+    }
 
-          for (cs_lnum_t j = 0; j < nd; j++) {
-            const cs_lnum_t k = (j*wa_stride) / mt->dim;
-            val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
-          }
+    const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
 
-        }
+    _moment_update_group(n_elts, wa_stride, wa_cur_data[wa_id], wa_sum,
+                         n_mu, mu);
 
-        mt->nt_cur = ts->nt_cur;
-
-        BFT_FREE(x);
-
-        /* Sync ghost cells so downstream use is safe */
-
-        if (mt->location_id == CS_MESH_LOCATION_CELLS) {
-          const cs_halo_t *halo = cs_glob_mesh->halo;
-          if (halo != NULL) {
-            if (mt->dim == 1)
-              cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
-            else {
-              cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, mt->dim);
-              if (halo->n_transforms > 0) {
-                if (mt->dim == 3)
-                  cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
-                else if (mt->dim == 6)
-                  cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
-              }
-            }
-          }
-        }
+    for (int j = 0; j < n_mu; j++) {
+      cs_time_moment_t *mt = mu[j].mt;
+      mt->nt_cur = ts->nt_cur;
+      if (mt->type == CS_TIME_MOMENT_VARIANCE)
+        _moment[mt->l_id].nt_cur = ts->nt_cur;
+      _moment_update_free(mu + j);
 
-      } /* End of test if moment is active */
+      /* Sync ghost cells so downstream use is safe */
+      _moment_sync(mt, mu[j].val);
+    }
 
-    } /* End of loop on moments */
+  }
 
-  } /* End of loop on moment types */
+  BFT_FREE(mu);
+  BFT_FREE(skip);
 
   /* Update and free weight data */
 
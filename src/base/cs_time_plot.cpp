@@ -401,6 +401,66 @@ _write_probe_header_csv(cs_time_plot_t    *p,
     p->f = _f;
 }
 
+/*----------------------------------------------------------------------------
+ * Write file header for binary files
+ *
+ * parameters:
+ *   p            <-> time plot values file handler
+ *   n_vals       <-- number of values per time step
+ *   probe_list   <-- numbers (1 to n) of probes if filtered, or NULL
+ *   probe_coords <-- probe coordinates, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_header_bin(cs_time_plot_t    *p,
+                  int                n_vals,
+                  const int         *probe_list,
+                  const cs_real_t    probe_coords[])
+{
+  FILE *_f = p->f;
+
+  if (_f != NULL) {
+    fclose(_f);
+    p->f = NULL;
+  }
+
+  _f = fopen(p->file_name, "wb");
+  if (_f == NULL) {
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), p->file_name);
+    return;
+  }
+
+  char magic[32];
+  memset(magic, 0, 32);
+  strcpy(magic, "code_saturne time plot 1.0");
+
+  int32_t header[2] = {n_vals, (probe_coords != NULL) ? 1 : 0};
+
+  fwrite(magic, 1, 32, _f);
+  fwrite(header, sizeof(int32_t), 2, _f);
+
+  if (probe_coords != NULL) {
+    for (int i = 0; i < n_vals; i++) {
+      int probe_id = (probe_list != NULL) ? probe_list[i] - 1 : i;
+      double coords[3] = {probe_coords[probe_id*3],
+                          probe_coords[probe_id*3 + 1],
+                          probe_coords[probe_id*3 + 2]};
+      fwrite(coords, sizeof(double), 3, _f);
+    }
+  }
+
+  /* Close file or assign it to handler depending on options */
+
+  if (p->buffer_steps[0] > 0) {
+    if (fclose(_f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), p->file_name);
+  }
+  else
+    p->f = _f;
+}
+
 /*----------------------------------------------------------------------------
  * Write file header for xmgrace/qsplotlib readable .dat files
  *
@@ -645,6 +705,9 @@ _plot_file_create(const char             *plot_name,
   case CS_TIME_PLOT_CSV:
     sprintf(p->file_name, "%s%s.csv", file_prefix, plot_name);
     break;
+  case CS_TIME_PLOT_BIN:
+    sprintf(p->file_name, "%s%s.bin", file_prefix, plot_name);
+    break;
   default:
     break;
   }
@@ -799,6 +862,9 @@ cs_time_plot_init_probe(const char             *plot_name,
                             probe_coords);
     _write_probe_header_csv(p, n_probes, probe_list, probe_coords, probe_names);
     break;
+  case CS_TIME_PLOT_BIN:
+    _write_header_bin(p, n_probes, probe_list, probe_coords);
+    break;
   default:
     break;
   }
@@ -861,6 +927,9 @@ cs_time_plot_init_struct(const char             *plot_name,
   case CS_TIME_PLOT_CSV:
     _write_struct_header_csv(p, n_structures);
   break;
+  case CS_TIME_PLOT_BIN:
+    _write_header_bin(p, n_structures, NULL, NULL);
+    break;
   default:
     break;
   }
@@ -970,6 +1039,23 @@ cs_time_plot_vals_write(cs_time_plot_t  *p,
 
     break;
 
+  case CS_TIME_PLOT_BIN:
+
+    {
+      int32_t _tn = tn;
+      _ensure_buffer_size(p, p->buffer_end + 12 + n_vals*sizeof(double));
+      memcpy(p->buffer + p->buffer_end, &_tn, 4);
+      memcpy(p->buffer + p->buffer_end + 4, &t, 8);
+      p->buffer_end += 12;
+      for (i = 0; i < n_vals; i++) {
+        double v = vals[i];
+        memcpy(p->buffer + p->buffer_end, &v, 8);
+        p->buffer_end += 8;
+      }
+    }
+
+    break;
+
   default:
     break;
   }
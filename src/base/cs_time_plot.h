@@ -55,7 +55,14 @@ typedef struct _cs_time_plot_t  cs_time_plot_t;
 
 typedef enum {
   CS_TIME_PLOT_DAT,  /* .dat file (usable by Qtplot or Grace) */
-  CS_TIME_PLOT_CSV   /* .csv file (readable by ParaView or spreadsheat) */
+  CS_TIME_PLOT_CSV,  /* .csv file (readable by ParaView or spreadsheat) */
+  CS_TIME_PLOT_BIN   /* .bin file (native binary, for large probe sets):
+                        header with a 32-byte "code_saturne time plot 1.0"
+                        string, the number of values per record and a
+                        coordinates flag (int32), followed by coordinates
+                        (3 doubles per value) if this flag is 1; then one
+                        record per time step with the time step number
+                        (int32), time value and values (doubles) */
 } cs_time_plot_format_t;
 
 /*============================================================================
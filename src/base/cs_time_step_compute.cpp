@@ -85,10 +85,87 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Residual-driven CFL ramping for local time steps (disabled if ramp <= 1) */
+
+static cs_real_t   _cfl_ramp = 1.;
+static cs_real_t   _cfl_max_factor = 1.;
+
+static cs_lnum_t   _cfl_n_cells = 0;
+static cs_real_t  *_cfl_factor = nullptr;   /* per-cell CFL multiplier */
+static cs_real_t  *_cfl_res_prev = nullptr; /* previous local residual */
+static cs_real_t  *_cfl_vel_prev = nullptr; /* velocity at previous call */
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Update the per-cell CFL factor based on the local velocity residual.
+ *
+ * The local residual is the rate of change of the velocity over the last
+ * time step. Where it decreases, the local CFL factor is increased
+ * (at most by _cfl_ramp per time step, up to _cfl_max_factor);
+ * where it increases, the factor is decreased in the same manner
+ * (down to 1), in the spirit of switched evolution relaxation.
+ *
+ * parameters:
+ *   n_cells <-- number of cells
+ *   dt      <-- current (previous step) time step
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cfl_factor(cs_lnum_t         n_cells,
+                   const cs_real_t   dt[])
+{
+  const cs_real_3_t *vel = (const cs_real_3_t *)CS_F_(vel)->val;
+
+  /* (Re)initialize on first call or mesh change */
+
+  if (_cfl_n_cells != n_cells) {
+    _cfl_n_cells = n_cells;
+    BFT_REALLOC(_cfl_factor, n_cells, cs_real_t);
+    BFT_REALLOC(_cfl_res_prev, n_cells, cs_real_t);
+    BFT_REALLOC(_cfl_vel_prev, n_cells*3, cs_real_t);
+
+    cs_array_real_set_scalar(n_cells, 1., _cfl_factor);
+    cs_array_real_set_scalar(n_cells, -1., _cfl_res_prev);
+    cs_array_real_copy(n_cells*3, (const cs_real_t *)vel, _cfl_vel_prev);
+    return;
+  }
+
+  const cs_real_t ramp = _cfl_ramp;
+  const cs_real_t i_ramp = 1. / _cfl_ramp;
+  const cs_real_t max_factor = _cfl_max_factor;
+
+  cs_real_3_t *vel_prev = (cs_real_3_t *)_cfl_vel_prev;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_real_t du[3] = {vel[c_id][0] - vel_prev[c_id][0],
+                       vel[c_id][1] - vel_prev[c_id][1],
+                       vel[c_id][2] - vel_prev[c_id][2]};
+    cs_real_t res = cs_math_3_norm(du) / cs_math_fmax(dt[c_id],
+                                                      cs_math_epzero);
+
+    if (_cfl_res_prev[c_id] > 0.) {
+      cs_real_t ratio =   _cfl_res_prev[c_id]
+                       / cs_math_fmax(res, cs_math_epzero);
+      ratio = cs_math_fmax(cs_math_fmin(ratio, ramp), i_ramp);
+      _cfl_factor[c_id] = cs_math_fmax(cs_math_fmin(_cfl_factor[c_id]*ratio,
+                                                    max_factor),
+                                       1.);
+    }
+
+    _cfl_res_prev[c_id] = res;
+    for (cs_lnum_t ii = 0; ii < 3; ii++)
+      vel_prev[c_id][ii] = vel[c_id][ii];
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -510,6 +587,25 @@ cs_local_time_step_compute(int  itrale)
 
       }
 
+      /* Residual-driven CFL ramping for local time steps
+         ------------------------------------------------ */
+
+      if (idtvar == 2 && _cfl_ramp > 1.) {
+
+        _update_cfl_factor(n_cells, dt);
+
+#       pragma omp parallel for if (n_cells > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+          if (icou == 1)
+            w1[c_id] *= _cfl_factor[c_id];
+          if (ifou == 1)
+            w2[c_id] *= _cfl_factor[c_id];
+          if (icoucf == 1)
+            dam[c_id] *= _cfl_factor[c_id];
+        }
+
+      }
+
       /* We take the most restrictive limitation
          --------------------------------------- */
 
@@ -845,6 +941,47 @@ cs_local_time_step_compute(int  itrale)
   BFT_FREE(bc_coeffs_loc.bf);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate residual-driven CFL ramping for local time steps.
+ *
+ * With a local time step (idtvar = 2), the Courant and Fourier based
+ * time step limits of each cell are multiplied by a factor which
+ * adapts to the local velocity residual: it grows by at most \p ramp
+ * per time step where the residual decreases (up to \p max_factor),
+ * and decreases in the same manner where it increases.
+ * Since the time step increase is also limited by varrdt, this should be
+ * set accordingly.
+ *
+ * \param[in]  ramp        maximum factor variation per time step
+ *                         (ramping is disabled if <= 1)
+ * \param[in]  max_factor  maximum CFL factor
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_local_time_step_set_cfl_ramping(cs_real_t  ramp,
+                                   cs_real_t  max_factor)
+{
+  _cfl_ramp = ramp;
+  _cfl_max_factor = cs_math_fmax(max_factor, 1.);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays used for local time step computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_local_time_step_finalize(void)
+{
+  _cfl_n_cells = 0;
+  BFT_FREE(_cfl_factor);
+  BFT_FREE(_cfl_res_prev);
+  BFT_FREE(_cfl_vel_prev);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  *\brief Compute the local Courant and Fourier number to the log.
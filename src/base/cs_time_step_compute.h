@@ -61,6 +61,28 @@ BEGIN_C_DECLS
 void
 cs_local_time_step_compute(int itrale);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Activate residual-driven CFL ramping for local time steps.
+ *
+ * \param[in]  ramp        maximum factor variation per time step
+ *                         (ramping is disabled if <= 1)
+ * \param[in]  max_factor  maximum CFL factor
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_local_time_step_set_cfl_ramping(cs_real_t  ramp,
+                                   cs_real_t  max_factor);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Free arrays used for local time step computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_local_time_step_finalize(void);
 /*----------------------------------------------------------------------------*/
 
 void
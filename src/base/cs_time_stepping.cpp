@@ -54,6 +54,7 @@
 #include "cs_ale.h"
 #include "cs_at_data_assim.h"
 #include "cs_atmo.h"
+#include "cs_base_accel.h"
 #include "cs_boundary_conditions.h"
 #include "cs_boundary_conditions_set_coeffs.h"
 #include "cs_cdo_main.h"
@@ -65,6 +66,7 @@
 #include "cs_field_pointer.h"
 #include "cs_gas_mix.h"
 #include "cs_gui.h"
+#include "cs_head_losses.h"
 #include "cs_turbulence_htles.h"
 #include "cs_ibm.h"
 #include "cs_initialize_fields.h"
@@ -73,7 +75,9 @@
 #include "cs_les_balance.h"
 #include "cs_les_inflow.h"
 #include "cs_log_iteration.h"
+#include "cs_mem_footprint.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
 #include "cs_mesh_save.h"
 #include "cs_mobile_structures.h"
 #include "cs_parall.h"
@@ -84,9 +88,12 @@
 #include "cs_porous_model.h"
 #include "cs_post.h"
 #include "cs_post_default.h"
+#include "cs_pressure_correction.h"
+#include "cs_probe_spectra.h"
 #include "cs_prototypes.h"
 #include "cs_rad_transfer.h"
 #include "cs_rad_transfer_restart.h"
+#include "cs_repartition.h"
 #include "cs_resource.h"
 #include "cs_restart.h"
 #include "cs_restart_default.h"
@@ -94,15 +101,18 @@
 #include "cs_restart_map.h"
 #include "cs_sat_coupling.h"
 #include "cs_solve_all.h"
+#include "cs_startup_log.h"
 #include "cs_runaway_check.h"
 #include "cs_time_moment.h"
 #include "cs_time_step.h"
+#include "cs_time_step_compute.h"
 #include "cs_timer_stats.h"
 #include "cs_turbomachinery.h"
 #include "cs_turbulence_bc.h"
 #include "cs_turbulence_model.h"
 #include "cs_volume_mass_injection.h"
 #include "cs_vof.h"
+#include "cs_wall_distance.h"
 #include "cs_wall_condensation.h"
 #include "cs_wall_condensation_1d_thermal.h"
 
@@ -343,6 +353,8 @@ cs_time_stepping(void)
 
   const int *bc_type = cs_glob_bc_type;
 
+  cs_startup_log_phase("field allocation");
+
   cs_field_map_and_init_bcs();
 
   cs_field_allocate_or_map_all();
@@ -358,6 +370,8 @@ cs_time_stepping(void)
   /* Possible restart
      ---------------- */
 
+  cs_startup_log_phase("restart and initialization");
+
   /* Timer statistics */
 
   int restart_stats_id = cs_timer_stats_id_by_name("checkpoint_restart_stage");
@@ -657,6 +671,8 @@ cs_time_stepping(void)
 
   cs_real_t dt_cpl;
 
+  cs_startup_log_finalize();
+
   /* Start time loop */
 
   do {
@@ -751,6 +767,11 @@ cs_time_stepping(void)
 
       cs_time_moment_update_all();
 
+      /* In-situ spectral analysis on probes
+         ---------------------------------- */
+
+      cs_probe_spectra_sample();
+
     }
 
     /* Update mesh (ALE)
@@ -805,6 +826,12 @@ cs_time_stepping(void)
 
     }
 
+    /* Measured per-cell costs for partitioning
+       ---------------------------------------- */
+
+    if (itrale > 0)
+      cs_repartition_cost_time_step(ts->nt_cur == ts->nt_max);
+
     /* Possible output of checkpoint files
        ----------------------------------- */
 
@@ -856,6 +883,8 @@ cs_time_stepping(void)
     /* Standard visualization output
        ----------------------------- */
 
+    cs_field_sync_host_all();
+
     cs_post_default_write_variables();
 
     /* CDO module (user-defined equations)
@@ -895,6 +924,15 @@ cs_time_stepping(void)
 
     itrale = itrale + 1;
 
+    /* Memory footprint once working arrays are allocated */
+
+    if (ts->nt_cur == ts->nt_prev + 1)
+      cs_mem_footprint_log(_("after first time step"));
+
+    /* Return host/device blocks not reused during this time step */
+
+    cs_mem_pool_trim();
+
   } while (ts->nt_cur < ts->nt_max);
 
   /* Final synchronization for time step.
@@ -934,6 +972,9 @@ cs_time_stepping(void)
 
   cs_rad_transfer_finalize();
 
+  cs_local_time_step_finalize();
+  cs_wall_distance_finalize();
+
   cs_turbulence_bc_free_pointers();
   cs_boundary_conditions_free();
 
@@ -960,6 +1001,9 @@ cs_time_stepping(void)
   if (cs_glob_ale >= 1)
     cs_mobile_structures_finalize();
 
+  cs_head_losses_finalize();
+  cs_pressure_correction_finalize();
+
   if (   cs_glob_1d_wall_thermal->nfpt1d > 0
       || cs_get_glob_1d_wall_thermal()->nfpt1t == 0)
     cs_1d_wall_thermal_finalize();
@@ -967,6 +1011,8 @@ cs_time_stepping(void)
   if (cs_glob_les_balance->i_les_balance > 0)
     cs_les_balance_finalize();
 
+  cs_mem_pool_release();
+
   cs_log_printf
     (CS_LOG_DEFAULT,
      _("\n\n"
@@ -991,11 +1037,15 @@ cs_time_stepping(void)
 void
 cs_time_stepping_write_checkpoint(bool  checkpoint_mesh)
 {
+  cs_field_sync_host_all();
+
   cs_restart_main_and_aux_write();
 
   if (checkpoint_mesh)
     cs_mesh_save(cs_glob_mesh, nullptr, "checkpoint", "mesh.csm");
 
+  cs_mesh_adapt_write_checkpoint();
+
   if (cs_get_glob_1d_wall_thermal()->nfpt1t > 0)
     cs_1d_wall_thermal_write();
 
@@ -44,6 +44,7 @@
 #include "cs_defs.h"
 #include "cs_file.h"
 #include "cs_file_csv_parser.h"
+#include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -412,14 +413,25 @@ cs_time_table_from_csv_file(const char  *name,
   int _n_rows = 0;
   int _n_cols = 0;
 
-  char ***_data = cs_file_csv_parse(file_name,
-                                    separator,
-                                    n_headers,
-                                    n_columns,
-                                    col_idx,
-                                    ignore_missing_tokens,
-                                    &_n_rows,
-                                    &_n_cols);
+  /* File is parsed on the root rank only, then numerical values
+     are broadcast to other ranks */
+
+  char ***_data = nullptr;
+
+  if (cs_glob_rank_id < 1)
+    _data = cs_file_csv_parse(file_name,
+                              separator,
+                              n_headers,
+                              n_columns,
+                              col_idx,
+                              ignore_missing_tokens,
+                              &_n_rows,
+                              &_n_cols);
+
+  int sizes[2] = {_n_rows, _n_cols};
+  cs_parall_bcast(0, 2, CS_INT_TYPE, sizes);
+  _n_rows = sizes[0];
+  _n_cols = sizes[1];
 
   t = _time_table_create(name);
 
@@ -430,19 +442,24 @@ cs_time_table_from_csv_file(const char  *name,
   for (int i = 0; i < _n_cols; i++)
     BFT_MALLOC(t->columns[i], _n_rows, cs_real_t);
 
-  for (int ir = 0; ir < _n_rows; ir++) {
-    char **_row = _data[ir];
-    for (int ic = 0; ic < _n_cols; ic++)
-      t->columns[ic][ir] = atof(_row[ic]);
-  }
+  if (_data != nullptr) {
+    for (int ir = 0; ir < _n_rows; ir++) {
+      char **_row = _data[ir];
+      for (int ic = 0; ic < _n_cols; ic++)
+        t->columns[ic][ir] = atof(_row[ic]);
+    }
 
-  // Free data which is no longer needed.
-  for (int i = 0; i < _n_rows; i++) {
-    for (int j = 0; j < _n_cols; j++)
-      BFT_FREE(_data[i][j]);
-    BFT_FREE(_data[i]);
+    // Free data which is no longer needed.
+    for (int i = 0; i < _n_rows; i++) {
+      for (int j = 0; j < _n_cols; j++)
+        BFT_FREE(_data[i][j]);
+      BFT_FREE(_data[i]);
+    }
+    BFT_FREE(_data);
   }
-  BFT_FREE(_data);
+
+  for (int i = 0; i < _n_cols; i++)
+    cs_parall_bcast(0, _n_rows, CS_REAL_TYPE, t->columns[i]);
 
   return t;
 }
@@ -612,17 +629,43 @@ cs_time_table_update_position(cs_time_table_t *table,
     coeffs[1].val = 0.;
   }
   else {
-    for (int i = t0_id; i < n_rows - 1; i++) {
-      if (_time >= time_vals[i] && _time < time_vals[i+1]) {
-        coeffs[1].id = i + 1;
-        coeffs[1].val = (_time - time_vals[i]) / (time_vals[i+1] - time_vals[i]);
+    /* Check interval at current position and the following one first
+       (usual case for increasing time), and use a binary search
+       otherwise; the search interval is [i, i+1[, or [n_rows-2, n_rows-1]
+       for the final time value. */
 
-        coeffs[0].id = i;
-        coeffs[0].val = 1. - coeffs[1].val;
+    int i = -1;
 
+    for (int j = t0_id; j < t0_id + 2 && j < n_rows - 1; j++) {
+      if (_time >= time_vals[j] && _time < time_vals[j+1]) {
+        i = j;
         break;
       }
     }
+
+    if (i < 0) {
+      int s_id = 0, e_id = n_rows - 1;
+      while (e_id - s_id > 1) {
+        int m_id = (s_id + e_id) / 2;
+        if (_time < time_vals[m_id])
+          e_id = m_id;
+        else
+          s_id = m_id;
+      }
+      i = s_id;
+    }
+
+    if (n_rows > 1) {
+      coeffs[1].id = i + 1;
+      coeffs[1].val = (_time - time_vals[i]) / (time_vals[i+1] - time_vals[i]);
+    }
+    else {
+      coeffs[1].id = i;
+      coeffs[1].val = 0.;
+    }
+
+    coeffs[0].id = i;
+    coeffs[0].val = 1. - coeffs[1].val;
   }
 }
 
@@ -43,9 +43,21 @@
  *----------------------------------------------------------------------------*/
 
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -53,7 +65,10 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "cs_log.h"
 #include "cs_map.h"
+#include "cs_parall.h"
+#include "cs_profiling.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
 
@@ -84,10 +99,34 @@ BEGIN_C_DECLS
   Timer statistics also allow for incrementing results from base timers
   (in addition to starting/stopping their own timers), so they may be used
   to assist logging and plotting of other timers.
+
+  Hardware performance counters (retired instructions, last level cache
+  misses, and optionally floating-point operations) may also be
+  associated with statistics, using the Linux perf_event interface. In
+  this case, a summary including achieved bandwidth and the likely
+  bound (memory, compute or latency) of each statistic is logged to
+  the performance log.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*-----------------------------------------------------------------------------
+ * Local macro definitions
+ *-----------------------------------------------------------------------------*/
+
+/* Hardware counters: retired instructions, last level cache misses,
+   and floating-point operations (raw event, optional) */
+
+#define _HW_N_COUNTERS      3
+
+#define _HW_INSTRUCTIONS    0
+#define _HW_CACHE_MISSES    1
+#define _HW_FLOPS           2
+
+/* Bytes transferred per last level cache miss */
+
+#define _HW_CACHE_LINE_SIZE 64
+
 /*-----------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
@@ -108,6 +147,13 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  uint64_t             hw_start[_HW_N_COUNTERS];  /* Hardware counter values
+                                                     at start if active */
+  uint64_t             hw_tot[_HW_N_COUNTERS];    /* Total hardware counts */
+
+  bool                 range_open;      /* true if profiler range open */
+  uint64_t             range_id;        /* Profiler range id if open */
+
 } cs_timer_stats_t;
 
 /*-------------------------------------------------------------------------------
@@ -140,6 +186,12 @@ static cs_timer_stats_t  *_stats= nullptr;
 
 static cs_map_name_to_id_t  *_name_map = nullptr;
 
+/* Hardware counter file descriptors (per thread and counter) */
+
+static int   _hw_n_threads = 0;
+static int  *_hw_fd = nullptr;
+static bool  _hw_available[_HW_N_COUNTERS] = {false, false, false};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -211,6 +263,323 @@ _common_parent_id(int  id_0,
   return p0;
 }
 
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+/*----------------------------------------------------------------------------
+ * Open a hardware counter for a given thread.
+ *
+ * parameters:
+ *   type    <-- perf event type
+ *   config  <-- perf event configuration
+ *   tid     <-- thread id
+ *
+ * return:
+ *   file descriptor, or -1 if the counter is not available
+ *----------------------------------------------------------------------------*/
+
+static int
+_hw_open(uint32_t  type,
+         uint64_t  config,
+         pid_t     tid)
+{
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  return (int)syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0);
+}
+
+#endif /* defined(HAVE_LINUX_PERF_EVENT_H) */
+
+/*----------------------------------------------------------------------------
+ * Read current hardware counter values, summed over threads.
+ *
+ * parameters:
+ *   c  --> counter values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_read(uint64_t  c[_HW_N_COUNTERS])
+{
+  for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++)
+    c[e_id] = 0;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+  for (int t_id = 0; t_id < _hw_n_threads; t_id++) {
+    for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++) {
+      int fd = _hw_fd[t_id*_HW_N_COUNTERS + e_id];
+      uint64_t v = 0;
+      if (fd > -1 && read(fd, &v, sizeof(uint64_t)) == sizeof(uint64_t))
+        c[e_id] += v;
+    }
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Add hardware counts since start to a statistic's totals.
+ *
+ * parameters:
+ *   s     <-> pointer to statistic
+ *   c     <-- current counter values
+ *   reset <-- if true, reset start values to current values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_add_diff(cs_timer_stats_t  *s,
+             const uint64_t     c[_HW_N_COUNTERS],
+             bool               reset)
+{
+  if (_hw_n_threads < 1)
+    return;
+
+  for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++) {
+    s->hw_tot[e_id] += c[e_id] - s->hw_start[e_id];
+    if (reset)
+      s->hw_start[e_id] = c[e_id];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set hardware counter start values of a statistic.
+ *
+ * parameters:
+ *   s  <-> pointer to statistic
+ *   c  <-- current counter values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_set_start(cs_timer_stats_t  *s,
+              const uint64_t     c[_HW_N_COUNTERS])
+{
+  for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++)
+    s->hw_start[e_id] = c[e_id];
+}
+
+/*----------------------------------------------------------------------------
+ * Close hardware counters.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_finalize(void)
+{
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+  for (int i = 0; i < _hw_n_threads*_HW_N_COUNTERS; i++) {
+    if (_hw_fd[i] > -1)
+      close(_hw_fd[i]);
+  }
+#endif
+
+  BFT_FREE(_hw_fd);
+  _hw_n_threads = 0;
+
+  for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++)
+    _hw_available[e_id] = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Return peak value per rank defined by an environment variable,
+ * summed over ranks.
+ *
+ * parameters:
+ *   name  <-- environment variable name
+ *
+ * return:
+ *   peak value, or -1 if not defined
+ *----------------------------------------------------------------------------*/
+
+static double
+_hw_env_peak(const char  *name)
+{
+  double retval = -1;
+
+  const char *s = getenv(name);
+  if (s != nullptr) {
+    double v = atof(s);
+    if (v > 0)
+      retval = v * cs_glob_n_ranks;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Log a roofline summary of statistics based on hardware counters.
+ *
+ * Counts are summed over ranks, and times are the maximum over ranks.
+ * Peak bandwidth and flop rates per rank may be defined using the
+ * CS_BENCHMARK_PEAK_GBS and CS_BENCHMARK_PEAK_GFLOPS environment
+ * variables, and are used to determine the likely bound of each
+ * statistic.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_log_summary(void)
+{
+  int available[_HW_N_COUNTERS];
+  for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++)
+    available[e_id] = (_hw_available[e_id]) ? 1 : 0;
+
+  cs_parall_min(_HW_N_COUNTERS, CS_INT_TYPE, available);
+
+  if (available[_HW_INSTRUCTIONS] == 0 && available[_HW_CACHE_MISSES] == 0)
+    return;
+
+  uint64_t *counts;
+  double *wtimes;
+  BFT_MALLOC(counts, _n_stats*_HW_N_COUNTERS, uint64_t);
+  BFT_MALLOC(wtimes, _n_stats, double);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++)
+      counts[stats_id*_HW_N_COUNTERS + e_id] = s->hw_tot[e_id];
+    wtimes[stats_id] = s->t_tot.nsec*1e-9;
+  }
+
+  cs_parall_sum(_n_stats*_HW_N_COUNTERS, CS_UINT64, counts);
+  cs_parall_max(_n_stats, CS_DOUBLE, wtimes);
+
+  const double peak_gbs = _hw_env_peak("CS_BENCHMARK_PEAK_GBS");
+  const double peak_gflops = _hw_env_peak("CS_BENCHMARK_PEAK_GFLOPS");
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Timer statistics hardware counters summary:\n\n"
+                  "  memory traffic estimated from last level cache misses "
+                  "(%d bytes per miss)\n\n"),
+                _HW_CACHE_LINE_SIZE);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  %-32s %10s %10s %10s %10s %10s %8s\n",
+                _("statistic"), _("time (s)"), _("Ginstr."), _("GB"),
+                _("GB/s"), _("GFLOP/s"), _("bound"));
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+
+    const cs_timer_stats_t  *s = _stats + stats_id;
+    const uint64_t *c = counts + stats_id*_HW_N_COUNTERS;
+    const double wt = wtimes[stats_id];
+
+    if (wt <= 0)
+      continue;
+
+    /* Indent label based on depth */
+
+    char label[33];
+    int depth = 0;
+    for (int p_id = s->parent_id; p_id > -1; p_id = (_stats + p_id)->parent_id)
+      depth++;
+    depth = CS_MIN(depth, 8);
+    snprintf(label, 33, "%*s%s", 2*depth, "", s->label);
+
+    const double gb = (double)c[_HW_CACHE_MISSES]*_HW_CACHE_LINE_SIZE*1e-9;
+    const double gbs = gb / wt;
+    const double gflops = (double)c[_HW_FLOPS]*1e-9 / wt;
+
+    char gflops_s[16] = "         -";
+    if (available[_HW_FLOPS])
+      snprintf(gflops_s, 16, "%10.3f", gflops);
+
+    /* Likely bound: latency if far from both peaks, memory or compute
+       based on arithmetic intensity relative to machine balance */
+
+    const char *bound = "-";
+    if (peak_gbs > 0 && available[_HW_CACHE_MISSES]) {
+      double bw_frac = gbs / peak_gbs;
+      if (available[_HW_FLOPS] && peak_gflops > 0) {
+        double fl_frac = gflops / peak_gflops;
+        if (bw_frac < 0.1 && fl_frac < 0.1)
+          bound = "latency";
+        else if (gb > 0 && gflops/gbs < peak_gflops/peak_gbs)
+          bound = "memory";
+        else
+          bound = "compute";
+      }
+      else
+        bound = (bw_frac < 0.1) ? "latency" : "memory";
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-32s %10.3f %10.3f %10.3f %10.3f %s %8s\n",
+                  label, wt, (double)c[_HW_INSTRUCTIONS]*1e-9, gb, gbs,
+                  gflops_s, bound);
+  }
+
+  BFT_FREE(wtimes);
+  BFT_FREE(counts);
+}
+
+/*----------------------------------------------------------------------------
+ * Return name of the root statistic of a given statistic, used as
+ * profiler range category.
+ *
+ * parameters:
+ *   id  <-- id of statistic
+ *
+ * return:
+ *   name of root statistic
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_range_category(int  id)
+{
+  int r_id = id;
+  while ((_stats + r_id)->parent_id > -1)
+    r_id = (_stats + r_id)->parent_id;
+
+  return cs_map_name_to_id_reverse(_name_map, r_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Open profiler ranges for a statistic and its parents up to (but not
+ * including) a given parent, starting with the highest level.
+ *
+ * parameters:
+ *   id         <-- id of statistic
+ *   parent_id  <-- id of parent statistic, or -1
+ *----------------------------------------------------------------------------*/
+
+static void
+_range_start(int  id,
+             int  parent_id)
+{
+  if (id <= parent_id)
+    return;
+
+  cs_timer_stats_t  *s = _stats + id;
+
+  _range_start(s->parent_id, parent_id);
+
+  if (s->range_open == false && s->active) {
+    s->range_id = cs_profiling_range_start(_range_category(id), s->label);
+    s->range_open = true;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Close profiler range of a statistic if open.
+ *
+ * parameters:
+ *   id  <-- id of statistic
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_range_end(int  id)
+{
+  cs_timer_stats_t  *s = _stats + id;
+
+  if (s->range_open) {
+    cs_profiling_range_end(_range_category(id), s->range_id);
+    s->range_open = false;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Create time plots
  *----------------------------------------------------------------------------*/
@@ -313,6 +682,12 @@ cs_timer_stats_initialize(void)
   cs_timer_stats_start(id);
   cs_timer_stats_set_plot(id, 0);
 
+  const char *s = getenv("CS_TIMER_STATS_HW_COUNTERS");
+  if (s != nullptr) {
+    if (atoi(s) > 0)
+      cs_timer_stats_enable_hw_counters();
+  }
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -329,6 +704,14 @@ cs_timer_stats_finalize(void)
   if (_time_plot != nullptr)
     cs_time_plot_finalize(&_time_plot);
 
+  if (_hw_n_threads > 0 || cs_glob_n_ranks > 1)
+    _hw_log_summary();
+
+  _hw_finalize();
+
+  for (int stats_id = _n_stats - 1; stats_id > -1; stats_id--)
+    _range_end(stats_id);
+
   _time_id = -1;
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
@@ -407,6 +790,9 @@ cs_timer_stats_increment_time_step(void)
 {
   cs_timer_t t_incr = cs_timer_time();
 
+  uint64_t hw_c[_HW_N_COUNTERS];
+  _hw_read(hw_c);
+
   /* Update start and current time for active statistics
      (should be only root statistics if used properly) */
 
@@ -415,6 +801,7 @@ cs_timer_stats_increment_time_step(void)
     if (s->active) {
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_incr);
       s->t_start = t_incr;
+      _hw_add_diff(s, hw_c, true);
     }
   }
 
@@ -538,6 +925,14 @@ cs_timer_stats_create(const char  *parent_name,
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
 
+  for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++) {
+    s->hw_start[e_id] = 0;
+    s->hw_tot[e_id] = 0;
+  }
+
+  s->range_open = false;
+  s->range_id = 0;
+
   return stats_id;
 }
 
@@ -559,6 +954,90 @@ cs_timer_stats_id_by_name(const char  *name)
   return cs_map_name_to_id_try(_name_map, name);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of defined statistics.
+ *
+ * \return  number of statistics
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_n_stats(void)
+{
+  return _n_stats;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the label of a defined statistic.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  label of the statistic, or nullptr if not defined
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_timer_stats_get_label(int  id)
+{
+  if (id < 0 || id >= _n_stats)
+    return nullptr;
+
+  return (_stats + id)->label;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the parent id of a defined statistic.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  id of parent statistic, or -1 for a root or undefined statistic
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_get_parent_id(int  id)
+{
+  if (id < 0 || id >= _n_stats)
+    return -1;
+
+  return (_stats + id)->parent_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the total elapsed time of a statistic.
+ *
+ * This includes the time elapsed since the statistic was started
+ * if it is currently active.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  total elapsed time (in seconds)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_timer_stats_get_wtime(int  id)
+{
+  if (id < 0 || id >= _n_stats)
+    return 0.;
+
+  const cs_timer_stats_t  *s = _stats + id;
+
+  cs_timer_counter_t t;
+  CS_TIMER_COUNTER_ADD(t, s->t_tot, s->t_cur);
+
+  if (s->active) {
+    cs_timer_t t_now = cs_timer_time();
+    cs_timer_counter_add_diff(&t, &(s->t_start), &t_now);
+  }
+
+  return t.nsec*1e-9;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Enable or disable plotting for a timer statistic.
@@ -637,6 +1116,9 @@ cs_timer_stats_start(int  id)
   if (! _is_parent(_active_id[root_id], id))
     return;
 
+  uint64_t hw_c[_HW_N_COUNTERS];
+  _hw_read(hw_c);
+
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
   /* Start timer and inactive parents */
@@ -648,10 +1130,13 @@ cs_timer_stats_start(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_start;
+      _hw_set_start(s, hw_c);
     }
 
   }
 
+  _range_start(id, parent_id);
+
   _active_id[root_id] = id;
 }
 
@@ -674,6 +1159,9 @@ cs_timer_stats_stop(int  id)
 
   cs_timer_t t_stop = cs_timer_time();
 
+  uint64_t hw_c[_HW_N_COUNTERS];
+  _hw_read(hw_c);
+
   /* Stop timer and active children */
 
   const int root_id = s->root_id;
@@ -686,6 +1174,8 @@ cs_timer_stats_stop(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
+      _hw_add_diff(s, hw_c, false);
+      _range_end(s - _stats);
     }
 
   }
@@ -721,6 +1211,9 @@ cs_timer_stats_switch(int  id)
   if (_active_id[root_id] == id)
     return retval; /* Nothing to do, already current */
 
+  uint64_t hw_c[_HW_N_COUNTERS];
+  _hw_read(hw_c);
+
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
   /* Stop all active timers of same type which are lower level than the
@@ -734,6 +1227,8 @@ cs_timer_stats_switch(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
+      _hw_add_diff(s, hw_c, false);
+      _range_end(s - _stats);
     }
 
   }
@@ -748,15 +1243,112 @@ cs_timer_stats_switch(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_switch;
+      _hw_set_start(s, hw_c);
     }
 
   }
 
+  _range_start(id, parent_id);
+
   _active_id[root_id] = id;
 
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable hardware performance counters for timer statistics.
+ *
+ * Counters are opened for each OpenMP thread of the calling process using
+ * the Linux perf_event interface, so this function should be called from
+ * outside parallel regions, once the thread pool is created.
+ * Retired instructions and last level cache misses are counted; floating
+ * point operations are also counted if the CS_TIMER_STATS_FLOPS_EVENT
+ * environment variable defines a matching raw (architecture-specific)
+ * event code.
+ *
+ * Counts are accumulated for statistics while they are active, and a
+ * summary is logged when timer statistics are finalized.
+ *
+ * \return  number of available counters (0 if not supported)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_enable_hw_counters(void)
+{
+  int n_available = 0;
+
+  if (_hw_n_threads > 0)
+    _hw_finalize();
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  uint64_t flops_config = 0;
+  const char *s = getenv("CS_TIMER_STATS_FLOPS_EVENT");
+  if (s != nullptr)
+    flops_config = strtoull(s, nullptr, 0);
+
+  _hw_n_threads = cs_glob_n_threads;
+  BFT_MALLOC(_hw_fd, _hw_n_threads*_HW_N_COUNTERS, int);
+
+  for (int i = 0; i < _hw_n_threads*_HW_N_COUNTERS; i++)
+    _hw_fd[i] = -1;
+
+  /* Counters are per thread, so open them from each thread */
+
+  #pragma omp parallel num_threads(_hw_n_threads)
+  {
+    int t_id = 0;
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+#endif
+    pid_t tid = (pid_t)syscall(SYS_gettid);
+    int *fd = _hw_fd + t_id*_HW_N_COUNTERS;
+
+    fd[_HW_INSTRUCTIONS] = _hw_open(PERF_TYPE_HARDWARE,
+                                    PERF_COUNT_HW_INSTRUCTIONS,
+                                    tid);
+    fd[_HW_CACHE_MISSES] = _hw_open(PERF_TYPE_HARDWARE,
+                                    PERF_COUNT_HW_CACHE_MISSES,
+                                    tid);
+    if (flops_config > 0)
+      fd[_HW_FLOPS] = _hw_open(PERF_TYPE_RAW, flops_config, tid);
+  }
+
+  for (int e_id = 0; e_id < _HW_N_COUNTERS; e_id++) {
+    _hw_available[e_id] = true;
+    for (int t_id = 0; t_id < _hw_n_threads; t_id++) {
+      if (_hw_fd[t_id*_HW_N_COUNTERS + e_id] < 0)
+        _hw_available[e_id] = false;
+    }
+    if (_hw_available[e_id])
+      n_available += 1;
+  }
+
+  if (n_available == 0)
+    _hw_finalize();
+
+  else {
+
+    /* Set start values for already active statistics */
+
+    uint64_t hw_c[_HW_N_COUNTERS];
+    _hw_read(hw_c);
+
+    for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+      cs_timer_stats_t  *st = _stats + stats_id;
+      if (st->active)
+        _hw_set_start(st, hw_c);
+    }
+
+  }
+
+#endif /* defined(HAVE_LINUX_PERF_EVENT_H) */
+
+  return n_available;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add a timing range to an inactive timer.
@@ -809,6 +1401,24 @@ cs_timer_stats_define_defaults(void)
                              "mesh io");
   cs_timer_stats_set_plot(id, 0);
 
+  const char *mesh_stats[][2] = {{"mesh_joining", "joining"},
+                                 {"mesh_halo", "halo creation"},
+                                 {"mesh_partitioning", "partitioning"},
+                                 {"mesh_renumbering", "renumbering"},
+                                 {"mesh_quantities", "mesh quantities"}};
+
+  for (int i = 0; i < 5; i++) {
+    id = cs_timer_stats_create("mesh_processing",
+                               mesh_stats[i][0],
+                               mesh_stats[i][1]);
+    cs_timer_stats_set_plot(id, 0);
+  }
+
+  id = cs_timer_stats_create("operations",
+                             "calculation_setup",
+                             "calculation setup");
+  cs_timer_stats_set_plot(id, 0);
+
   id = cs_timer_stats_create("operations",
                              "postprocessing_output",
                              "post-processing output");
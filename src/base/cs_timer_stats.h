@@ -146,6 +146,59 @@ cs_timer_stats_create(const char  *parent_name,
 int
 cs_timer_stats_id_by_name(const char  *name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the number of defined statistics.
+ *
+ * \return  number of statistics
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_n_stats(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the label of a defined statistic.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  label of the statistic, or nullptr if not defined
+ */
+/*----------------------------------------------------------------------------*/
+
+const char *
+cs_timer_stats_get_label(int  id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the parent id of a defined statistic.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  id of parent statistic, or -1 for a root or undefined statistic
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_get_parent_id(int  id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the total elapsed time of a statistic.
+ *
+ * This includes the time elapsed since the statistic was started
+ * if it is currently active.
+ *
+ * \param[in]  id  id of statistic
+ *
+ * \return  total elapsed time (in seconds)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_timer_stats_get_wtime(int  id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Enable or disable plotting for a timer statistic.
@@ -223,6 +276,28 @@ cs_timer_stats_stop(int  id);
 int
 cs_timer_stats_switch(int  id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable hardware performance counters for timer statistics.
+ *
+ * Counters are opened for each OpenMP thread of the calling process using
+ * the Linux perf_event interface, so this function should be called from
+ * outside parallel regions, once the thread pool is created.
+ * Retired instructions and last level cache misses are counted; floating
+ * point operations are also counted if the CS_TIMER_STATS_FLOPS_EVENT
+ * environment variable defines a matching raw (architecture-specific)
+ * event code.
+ *
+ * Counts are accumulated for statistics while they are active, and a
+ * summary is logged when timer statistics are finalized.
+ *
+ * \return  number of available counters (0 if not supported)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_enable_hw_counters(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add a timing range to an inactive timer.
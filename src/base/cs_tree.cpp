@@ -68,10 +68,24 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of slots of the path lookup index (power of 2) */
+
+#define CS_TREE_PATH_INDEX_SIZE 1024
+
 /*============================================================================
  * Type and structure definitions
  *============================================================================*/
 
+/* Path lookup index entry */
+
+typedef struct {
+
+  const cs_tree_node_t  *start;  /* node from which the path is searched */
+  char                  *path;   /* searched path, or nullptr if unused */
+  cs_tree_node_t        *node;   /* matching node, or nullptr if not found */
+
+} _path_index_entry_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -83,10 +97,59 @@ static const int _any_type
 static const int _no_char_type
   = (CS_TREE_NODE_INT | CS_TREE_NODE_REAL | CS_TREE_NODE_BOOL);
 
+/* Direct-mapped path lookup index (allocated on first use, and
+   cleared whenever the tree structure is modified) */
+
+static _path_index_entry_t  *_path_index = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute the path index slot for a given start node and path.
+ *
+ * parameters:
+ *   start <-- node from which the path is searched
+ *   path  <-- path string
+ *
+ * returns:
+ *   slot id in path index
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_path_index_slot(const cs_tree_node_t  *start,
+                 const char            *path)
+{
+  /* FNV-1a hash of path, combined with start node address */
+
+  uint64_t h = 14695981039346656037ULL;
+  for (const unsigned char *p = (const unsigned char *)path; *p != '\0'; p++) {
+    h ^= *p;
+    h *= 1099511628211ULL;
+  }
+  h ^= ((uint64_t)(uintptr_t)start) >> 4;
+  h *= 1099511628211ULL;
+
+  return (size_t)(h ^ (h >> 32)) & (CS_TREE_PATH_INDEX_SIZE - 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Clear the path lookup index.
+ *----------------------------------------------------------------------------*/
+
+static void
+_path_index_clear(void)
+{
+  if (_path_index == nullptr)
+    return;
+
+  for (int i = 0; i < CS_TREE_PATH_INDEX_SIZE; i++)
+    BFT_FREE(_path_index[i].path);
+
+  BFT_FREE(_path_index);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Normalize a string, converting it to lowercase and
@@ -414,6 +477,8 @@ cs_tree_node_free(cs_tree_node_t  **pnode)
   if (root == nullptr)
     return;
 
+  _path_index_clear();
+
   if (root->children != nullptr) { /* There is at least one child */
     cs_tree_node_t  *next_child = root->children->next;
     while (next_child != nullptr) {
@@ -440,6 +505,8 @@ void
 cs_tree_node_set_name(cs_tree_node_t  *node,
                       const char      *name)
 {
+  _path_index_clear();
+
   if (name == nullptr)
     BFT_FREE(node->name);
 
@@ -1362,10 +1429,36 @@ cs_tree_get_node(cs_tree_node_t  *node,
     return nullptr;
   if (path == nullptr)
     return node;
-  if (strlen(path) == 0)
+  if (path[0] == '\0')
     return node;
 
-  return _find_node(node, path);
+  /* Check path index first */
+
+  if (_path_index == nullptr) {
+    BFT_MALLOC(_path_index, CS_TREE_PATH_INDEX_SIZE, _path_index_entry_t);
+    for (int i = 0; i < CS_TREE_PATH_INDEX_SIZE; i++) {
+      _path_index[i].start = nullptr;
+      _path_index[i].path = nullptr;
+      _path_index[i].node = nullptr;
+    }
+  }
+
+  _path_index_entry_t *e = _path_index + _path_index_slot(node, path);
+
+  if (   e->start == node && e->path != nullptr
+      && strcmp(e->path, path) == 0)
+    return e->node;
+
+  /* Otherwise, search and update index */
+
+  cs_tree_node_t *retval = _find_node(node, path);
+
+  BFT_REALLOC(e->path, strlen(path) + 1, char);
+  strcpy(e->path, path);
+  e->start = node;
+  e->node = retval;
+
+  return retval;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1416,6 +1509,8 @@ cs_tree_node_t *
 cs_tree_add_child(cs_tree_node_t  *parent,
                   const char      *name)
 {
+  _path_index_clear();
+
   /* Allocate a new node */
   cs_tree_node_t  *node = cs_tree_node_create(name);
 
@@ -1460,6 +1555,8 @@ cs_tree_node_t *
 cs_tree_add_sibling(cs_tree_node_t  *sibling,
                     const char      *name)
 {
+  _path_index_clear();
+
   /* Allocate a new node */
   cs_tree_node_t  *node = cs_tree_node_create(name);
 
@@ -1785,6 +1882,22 @@ cs_tree_dump(cs_log_t                log,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Clear the path lookup index used by \ref cs_tree_get_node.
+ *
+ * The index is cleared automatically when nodes are added, renamed, or
+ * freed using the functions of this module, so this only needs to be
+ * called when the tree structure is modified directly.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_clear_path_index(void)
+{
+  _path_index_clear();
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
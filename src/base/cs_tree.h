@@ -907,6 +907,19 @@ cs_tree_dump(cs_log_t                log,
              int                     depth,
              const cs_tree_node_t   *node);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Clear the path lookup index used by \ref cs_tree_get_node.
+ *
+ * The index is cleared automatically when nodes are added, renamed, or
+ * freed using the functions of this module, so this only needs to be
+ * called when the tree structure is modified directly.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_clear_path_index(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -136,6 +136,13 @@ typedef struct {
                                                    for update after that
                                                    of geometry */
 
+  bool                       incremental_update; /* rotate mesh quantities
+                                                    instead of recomputing
+                                                    them when possible */
+  double                    *q_angle;           /* rotation angles associated
+                                                   with current mesh
+                                                   quantities, or NULL */
+
   bool active;
 
 } cs_turbomachinery_t;
@@ -316,6 +323,8 @@ _turbomachinery_create(void)
   tbm->n_b_faces_ref = -1;
   tbm->coftur = NULL;
   tbm->hfltur = NULL;
+  tbm->incremental_update = false;
+  tbm->q_angle = NULL;
   tbm->cell_rotor_num = NULL;
   tbm->model = CS_TURBOMACHINERY_NONE;
   tbm->n_couplings = 0;
@@ -421,6 +430,39 @@ _apply_sym_tensor_rotation(cs_real_t  matrix[3][4],
   t[5] = _t0[2][0];
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a matrix * tensor * Tmatrix product to apply a rotation to a
+ * given (non-symmetric) tensor
+ *
+ * parameters:
+ *   matrix[3][4]        --> transformation matrix in homogeneous coords.
+ *                           last line = [0; 0; 0; 1] (Not used here)
+ *   t[3][3]             <-> incoming (3x3) tensor
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_apply_tensor_rotation(double     matrix[3][4],
+                       cs_real_t  t[3][3])
+{
+  double  _t[3][3];
+
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      _t[i][j] = 0.;
+      for (int k = 0; k < 3; k++)
+        _t[i][j] += matrix[i][k] * t[k][j];
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      t[i][j] = 0.;
+      for (int k = 0; k < 3; k++)
+        t[i][j] += _t[i][k] * matrix[j][k];
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute velocity relative to fixed coordinates at a given point
  *
@@ -853,6 +895,129 @@ _select_rotor_cells(cs_turbomachinery_t  *tbm)
     _check_geometry(m);
 }
 
+/*----------------------------------------------------------------------------
+ * Update mesh quantities by rotating those of rotor elements.
+ *
+ * As rotors move rigidly and are disjoint from stator sections when no
+ * joining is used, lengths, surfaces and volumes are unchanged, while
+ * points, vectors and tensors are simply rotated from the angle at which
+ * they were last computed to the current angle.
+ *
+ * parameters:
+ *   mesh <-- mesh (already rotated)
+ *   mq   <-> associated mesh quantities
+ *
+ * returns:
+ *   true if quantities were updated, false if a full computation is needed
+ *----------------------------------------------------------------------------*/
+
+static bool
+_rotate_mesh_quantities(const cs_mesh_t       *mesh,
+                        cs_mesh_quantities_t  *mq)
+{
+  cs_turbomachinery_t *tbm = _turbomachinery;
+
+  /* Fluid (porous) quantities and periodic ghost cells
+     are not handled here */
+
+  if (   tbm->incremental_update == false || tbm->q_angle == NULL
+      || mesh->n_init_perio > 0
+      || mq->cell_cen == NULL || mq->i_face_u_normal == NULL
+      || mq->dijpf == NULL || mq->diipf == NULL
+      || mq->cell_f_cen != mq->cell_cen
+      || mq->i_f_face_normal != mq->i_face_normal
+      || mq->b_f_face_normal != mq->b_face_normal)
+    return false;
+
+  const int *cell_rotor_num = tbm->cell_rotor_num;
+
+  cs_real_34_t  *m;
+  BFT_MALLOC(m, tbm->n_rotors+1, cs_real_34_t);
+
+  for (int j = 0; j < tbm->n_rotors+1; j++) {
+    cs_rotation_t *r = tbm->rotation + j;
+    cs_rotation_matrix(r->angle - tbm->q_angle[j],
+                       r->axis,
+                       r->invariant,
+                       m[j]);
+  }
+
+  cs_real_3_t *cell_cen = (cs_real_3_t *)mq->cell_cen;
+  cs_real_3_t *i_face_cog = (cs_real_3_t *)mq->i_face_cog;
+  cs_real_3_t *i_face_normal = (cs_real_3_t *)mq->i_face_normal;
+  cs_real_3_t *b_face_cog = (cs_real_3_t *)mq->b_face_cog;
+  cs_real_3_t *b_face_normal = (cs_real_3_t *)mq->b_face_normal;
+  cs_real_3_t *dijpf = (cs_real_3_t *)mq->dijpf;
+  cs_real_3_t *dofij = (cs_real_3_t *)mq->dofij;
+  cs_real_3_t *diipf = (cs_real_3_t *)mq->diipf;
+  cs_real_3_t *djjpf = (cs_real_3_t *)mq->djjpf;
+  cs_real_3_t *diipb = (cs_real_3_t *)mq->diipb;
+
+  /* Cells (including ghost cells) */
+
+# pragma omp parallel for if (mesh->n_cells_with_ghosts > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < mesh->n_cells_with_ghosts; c_id++) {
+    int r_num = cell_rotor_num[c_id];
+    if (r_num > 0) {
+      _apply_vector_transfo(m[r_num], cell_cen[c_id]);
+      if (mq->corr_grad_lin != NULL)
+        _apply_tensor_rotation(m[r_num], mq->corr_grad_lin[c_id]);
+    }
+  }
+
+  /* Interior faces (both adjacent cells belong to the same section) */
+
+# pragma omp parallel for if (mesh->n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    int r_num = cell_rotor_num[mesh->i_face_cells[f_id][0]];
+    if (r_num > 0) {
+      _apply_vector_transfo(m[r_num], i_face_cog[f_id]);
+      _apply_vector_rotation(m[r_num], i_face_normal[f_id]);
+      _apply_vector_rotation(m[r_num], mq->i_face_u_normal[f_id]);
+      _apply_vector_rotation(m[r_num], dijpf[f_id]);
+      _apply_vector_rotation(m[r_num], dofij[f_id]);
+      _apply_vector_rotation(m[r_num], diipf[f_id]);
+      _apply_vector_rotation(m[r_num], djjpf[f_id]);
+    }
+  }
+
+  /* Boundary faces */
+
+# pragma omp parallel for if (mesh->n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+    int r_num = cell_rotor_num[mesh->b_face_cells[f_id]];
+    if (r_num > 0) {
+      _apply_vector_transfo(m[r_num], b_face_cog[f_id]);
+      _apply_vector_rotation(m[r_num], b_face_normal[f_id]);
+      _apply_vector_rotation(m[r_num], mq->b_face_u_normal[f_id]);
+      _apply_vector_rotation(m[r_num], diipb[f_id]);
+    }
+  }
+
+  BFT_FREE(m);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Save rotation angles associated with current mesh quantities.
+ *
+ * parameters:
+ *   tbm <-> turbomachinery options structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_save_quantities_angle(cs_turbomachinery_t  *tbm)
+{
+  if (tbm->incremental_update == false)
+    return;
+
+  BFT_REALLOC(tbm->q_angle, tbm->n_rotors+1, double);
+
+  for (int j = 0; j < tbm->n_rotors+1; j++)
+    tbm->q_angle[j] = tbm->rotation[j].angle;
+}
+
 /*----------------------------------------------------------------------------
  * Update mesh for unsteady rotor/stator computation when no joining is used.
  *
@@ -890,9 +1055,13 @@ _update_mesh_coupling(double  *t_elapsed)
   if (tbm->n_rotors > 0)
     _update_geometry(cs_glob_mesh, 0);
 
-  /* Recompute geometric quantities related to the mesh */
+  /* Recompute geometric quantities related to the mesh, or simply
+     rotate them in incremental mode */
 
-  cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+  if (_rotate_mesh_quantities(cs_glob_mesh, cs_glob_mesh_quantities) == false)
+    cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+
+  _save_quantities_angle(tbm);
 
   /* Update linear algebra APIs relative to mesh */
 
@@ -1709,6 +1878,7 @@ cs_turbomachinery_finalize(void)
 
     BFT_FREE(tbm->coftur);
     BFT_FREE(tbm->hfltur);
+    BFT_FREE(tbm->q_angle);
 
     /* Unset global rotations pointer for safety */
     cs_glob_rotation = NULL;
@@ -1949,6 +2119,32 @@ cs_turbomachinery_set_rotation_retry(int     n_max_join_retries,
   tbm->dt_retry = dt_retry_multiplier;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set incremental mesh quantities update mode.
+ *
+ * When active, and rotor/stator interfaces are handled by coupling rather
+ * than joining, the geometric quantities of rotor cells and faces are
+ * rotated at each mesh update instead of being recomputed.
+ *
+ * \param[in]  incremental  true to activate incremental update,
+ *                          false for full recomputation (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbomachinery_set_incremental_update(bool  incremental)
+{
+  cs_turbomachinery_t *tbm = _turbomachinery;
+
+  if (tbm == NULL)
+    return;
+
+  tbm->incremental_update = incremental;
+  if (incremental == false)
+    BFT_FREE(tbm->q_angle);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build rotation matrices for a given time interval.
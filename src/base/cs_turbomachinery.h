@@ -320,6 +320,22 @@ void
 cs_turbomachinery_set_rotation_retry(int     n_max_join_retries,
                                      double  dt_retry_multiplier);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set incremental mesh quantities update mode.
+ *
+ * When active, and rotor/stator interfaces are handled by coupling rather
+ * than joining, the geometric quantities of rotor cells and faces are
+ * rotated at each mesh update instead of being recomputed.
+ *
+ * \param[in]  incremental  true to activate incremental update,
+ *                          false for full recomputation (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbomachinery_set_incremental_update(bool  incremental);
+
 /*----------------------------------------------------------------------------
  * Rotation of vector and tensor fields.
  *
@@ -282,6 +282,11 @@ BEGIN_C_DECLS
 
   \var  cs_velocity_pressure_param_t::epsdp
         parameter of diagonal pressure strengthening
+
+  \var  cs_velocity_pressure_param_t::n_p_proj
+        number of previous solutions kept to build the initial guess of
+        the (symmetric) pressure increment system by projection of its
+        right-hand side (Fischer's method); 0 (default) to deactivate
 */
 
 /*----------------------------------------------------------------------------*/
@@ -338,6 +343,7 @@ static cs_velocity_pressure_param_t  _velocity_pressure_param =
   .xnrmu = 0.,
   .xnrmu0 = 0.,
   .epsdp  = 1.e-12,
+  .n_p_proj = 0,
   .time_control = {
     .type = CS_TIME_CONTROL_TIME_STEP,
     .at_start = true,
@@ -604,6 +610,12 @@ cs_velocity_pressure_param_log_setup(void)
                   vp_param->epsup);
   }
 
+  if (vp_param->n_p_proj > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("    n_p_proj:      %d (previous solutions used for\n"
+                    "                       the initial pressure increment)\n"),
+                  vp_param->n_p_proj);
+
   const char *iphydr_value_str[]
     = {N_("0 (no treatment (default) for the improvement of\n"
           "                   "
@@ -178,6 +178,10 @@ typedef struct {
 
   double      epsdp;          /* parameter of diagonal pressure strengthening */
 
+  int         n_p_proj;       /* number of previous solutions used to build
+                                 the initial guess of the pressure increment
+                                 by projection (0: not used) */
+
   cs_time_control_t  time_control;   /* Time control for radiation updates */
 
 } cs_velocity_pressure_param_t;
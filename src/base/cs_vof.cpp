@@ -38,10 +38,12 @@
 
 #include "cs_array.h"
 #include "cs_base.h"
+#include "cs_base_accel.h"
 #include "cs_blas.h"
 #include "cs_boundary_conditions.h"
 #include "cs_convection_diffusion.h"
 #include "cs_convection_diffusion_priv.h"
+#include "cs_dispatch.h"
 #include "cs_divergence.h"
 #include "cs_equation.h"
 #include "cs_equation_iterative_solve.h"
@@ -792,8 +794,8 @@ cs_vof_compute_linear_rho_mu(const cs_mesh_t  *m)
   }
 
   cs_halo_type_t halo_type = m->halo_type;
-  cs_field_synchronize(CS_F_(rho), halo_type);
-  cs_field_synchronize(CS_F_(mu), halo_type);
+  cs_field_t *rho_mu[2] = {CS_F_(rho), CS_F_(mu)};
+  cs_field_synchronize_multi(2, rho_mu, halo_type);
 
   /* Update mixture density on boundary faces */
 
@@ -1018,13 +1020,22 @@ cs_vof_log_mass_budget(const cs_mesh_t             *m,
 
   /* Unsteady term  and mass budget */
 
-  cs_real_t glob_m_budget = 0.;
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  const cs_real_t *restrict dt = CS_F_(dt)->val;
+
+  cs_dispatch_context ctx;
+  if (cs_check_device_ptr(divro) == CS_ALLOC_HOST)
+    ctx.set_use_gpu(false);
+
+  double glob_m_budget = 0.;
+  ctx.parallel_for_reduce_sum
+    (n_cells, glob_m_budget, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id,
+                                                   double &sum) {
     cs_real_t tinsro =  cell_f_vol[c_id]
-                      * (cpro_rom[c_id]-cproa_rom[c_id]) / CS_F_(dt)->val[c_id];
+                      * (cpro_rom[c_id]-cproa_rom[c_id]) / dt[c_id];
 
-    glob_m_budget += tinsro + divro[c_id];
-  }
+    sum += tinsro + divro[c_id];
+  });
+  ctx.wait();
 
   cs_parall_sum(1, CS_DOUBLE, &glob_m_budget);
 
@@ -1391,14 +1402,14 @@ cs_vof_drift_term(int                        imrgra,
 
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
 
   const cs_lnum_2_t *restrict i_face_cells
     = (const cs_lnum_2_t *)m->i_face_cells;
   const cs_real_t *restrict i_dist = fvq->i_dist;
   const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *)fvq->i_face_normal;
 
   /* Handle cases where only the previous values (already synchronized)
      or current values are provided */
@@ -1426,12 +1437,10 @@ cs_vof_drift_term(int                        imrgra,
   cs_field_t *idriftflux = cs_field_by_name_try("inner_drift_velocity_flux");
   cs_field_t *bdriftflux = cs_field_by_name_try("boundary_drift_velocity_flux");
 
-  if (_vof_parameters.idrift == 1) {
+  /* The Deshpande et al. drift flux is computed along with its
+     contribution in the interior faces loop below. */
 
-    // FIXME Handle boundary terms bdriftflux
-    cs_vof_deshpande_drift_flux(cs_glob_mesh, cs_glob_mesh_quantities);
-
-  } else {
+  if (_vof_parameters.idrift != 1) {
 
     const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
     int f_id, itypfl, iflmb0, init, inc;
@@ -1499,7 +1508,55 @@ cs_vof_drift_term(int                        imrgra,
 
   const int kiflux = cs_field_key_id("inner_flux_id");
   int i_flux_id = cs_field_get_key_int(CS_F_(void_f), kiflux);
-  cs_field_t *i_flux = cs_field_by_id(i_flux_id);
+  cs_real_t *restrict i_voidflux = cs_field_by_id(i_flux_id)->val;
+
+  cs_real_t *restrict i_driftflux
+    = (idriftflux != nullptr) ? idriftflux->val : nullptr;
+
+  const bool deshpande = (_vof_parameters.idrift == 1);
+  const cs_real_t cdrift = _vof_parameters.cdrift;
+  const cs_real_t kdrift = _vof_parameters.kdrift;
+
+  /* For the Deshpande et al. model, only the void fraction gradient and
+     the flux factor bound are computed here, face values of the drift
+     flux being computed in the face loop below. */
+
+  const cs_real_t *restrict i_volflux = nullptr;
+  cs_real_3_t *voidf_grad = nullptr;
+  cs_real_t delta = 0., maxfluxsurf = 0.;
+
+  if (deshpande) {
+
+    // FIXME Handle boundary terms bdriftflux
+    if (i_driftflux == nullptr)
+      bft_error(__FILE__, __LINE__, 0,_("error drift velocity not defined\n"));
+
+    const int kimasf = cs_field_key_id("inner_mass_flux_id");
+    i_volflux = cs_field_by_id(cs_field_get_key_int(CS_F_(void_f),
+                                                    kimasf))->val;
+
+    CS_MALLOC_HD(voidf_grad, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+
+    cs_field_gradient_scalar(CS_F_(void_f),
+                             true,           // use_previous_t
+                             1,              // inc
+                             voidf_grad);
+
+    /* Stabilization factor */
+    delta = pow(10,-8)/pow(fvq->tot_vol/m->n_g_cells,(1./3.));
+
+    /* Max of flux/Surf over the entire domain */
+#   pragma omp parallel for reduction(max:maxfluxsurf) \
+                            if (n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      cs_real_t fluxsurf = std::abs(i_volflux[f_id])/i_face_surf[f_id];
+      if (maxfluxsurf < fluxsurf)
+        maxfluxsurf = fluxsurf;
+    }
+    cs_parall_max(1, CS_REAL_TYPE, &maxfluxsurf);
+  }
+
+  const cs_real_3_t *restrict voidf_grad_c = voidf_grad;
 
   if (n_cells_ext > n_cells) {
 #   pragma omp parallel for if(n_cells_ext - n_cells > CS_THR_MIN)
@@ -1508,54 +1565,87 @@ cs_vof_drift_term(int                        imrgra,
     }
   }
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
-      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           face_id++) {
-
-        cs_lnum_t ii = i_face_cells[face_id][0];
-        cs_lnum_t jj = i_face_cells[face_id][1];
-
-        cs_real_t irvf = 0.;
-        if (idriftflux != nullptr)
-          irvf = idriftflux->val[face_id];
-
-        cs_real_2_t fluxij = {0.,0.};
-
-        cs_i_conv_flux(1,
-                       1.,
-                       0,
-                       _pvar[ii],
-                       _pvar[jj],
-                       _pvar[ii]*(1.-_pvar[jj]),
-                       _pvar[ii]*(1.-_pvar[jj]),
-                       _pvar[jj]*(1.-_pvar[ii]),
-                       _pvar[jj]*(1.-_pvar[ii]),
-                       irvf,
-                       1.,
-                       1.,
-                       fluxij);
-
-        const cs_real_t kdrift = _vof_parameters.kdrift;
-        cs_i_diff_flux(1,
-                       1.,
-                       _pvar[ii],
-                       _pvar[jj],
-                       _pvar[ii],
-                       _pvar[jj],
-                       kdrift*(2.-_pvar[ii]-_pvar[jj])
-                        / 2.*i_face_surf[face_id]/i_dist[face_id],
-                       fluxij);
-
-        rhs[ii] -= fluxij[0];
-        rhs[jj] += fluxij[1];
-        /* store void fraction convection flux contribution */
-        i_flux->val[face_id] += fluxij[0];
-      }
+  /* Drift flux, compressive convection flux and drift diffusion are
+     computed and assembled in a single pass over interior faces. */
+
+  cs_dispatch_context ctx;
+  if (   cs_check_device_ptr(_pvar) == CS_ALLOC_HOST
+      || cs_check_device_ptr(rhs) == CS_ALLOC_HOST)
+    ctx.set_use_gpu(false);
+
+  cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t irvf = 0.;
+
+    if (deshpande) {
+      cs_real_t fluxfactor
+        = cs_math_fmin(cdrift*cs_math_fabs(i_volflux[face_id])
+                       /i_face_surf[face_id],
+                       maxfluxsurf);
+
+      cs_real_t gradface[3];
+      for (cs_lnum_t idim = 0; idim < 3; idim++)
+        gradface[idim] = (  voidf_grad_c[ii][idim]
+                          + voidf_grad_c[jj][idim])/2.;
+
+      cs_real_t normgrad = cs_math_3_norm(gradface);
+
+      irvf =   fluxfactor / (normgrad+delta)
+             * cs_math_3_dot_product(gradface, i_face_normal[face_id]);
+
+      i_driftflux[face_id] = irvf;
     }
-  }
+    else if (i_driftflux != nullptr)
+      irvf = i_driftflux[face_id];
+
+    const cs_real_t pi = _pvar[ii];
+    const cs_real_t pj = _pvar[jj];
+
+    /* Narrow band: both the compressive and diffusive drift fluxes
+       vanish between two cells of the same pure phase */
+    if (pi == pj && pi*(1.-pi) == 0.)
+      return;
+
+    cs_real_2_t fluxij = {0.,0.};
+
+    cs_i_conv_flux(1,
+                   1.,
+                   0,
+                   pi,
+                   pj,
+                   pi*(1.-pj),
+                   pi*(1.-pj),
+                   pj*(1.-pi),
+                   pj*(1.-pi),
+                   irvf,
+                   1.,
+                   1.,
+                   fluxij);
+
+    cs_i_diff_flux(1,
+                   1.,
+                   pi,
+                   pj,
+                   pi,
+                   pj,
+                   kdrift*(2.-pi-pj)
+                    / 2.*i_face_surf[face_id]/i_dist[face_id],
+                   fluxij);
+
+    cs_dispatch_sum(&rhs[ii], -fluxij[0], i_sum_type);
+    cs_dispatch_sum(&rhs[jj], fluxij[1], i_sum_type);
+
+    /* store void fraction convection flux contribution */
+    i_voidflux[face_id] += fluxij[0];
+  });
+
+  ctx.wait();
+
+  CS_FREE_HD(voidf_grad);
 }
 
 /*----------------------------------------------------------------------------*/
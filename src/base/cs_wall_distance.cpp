@@ -90,6 +90,13 @@ static bool _initialized = false;
 
 static cs_lnum_t n_wall = 0;
 
+/* Closest wall point and distance, and associated local boundary face,
+   kept between calls of the sweeping method for incremental updates */
+
+static cs_lnum_t    _sweep_n_cells = 0;
+static cs_real_4_t *_sweep_wpd = nullptr;
+static cs_lnum_t   *_sweep_w_face = nullptr;
+
 /* Fortran mapping int values for wall distance. These should eventually
  * be removed in the future.
  */
@@ -109,6 +116,45 @@ const cs_wall_distance_options_t *cs_glob_wall_distance_options
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Update the closest wall point of a cell from that of a neighbor.
+ *
+ * parameters:
+ *   c_id     <-- id of cell to update
+ *   n_id     <-- id of neighbor cell
+ *   n_cells  <-- number of local cells
+ *   cell_cen <-- cell centers
+ *   wpd      <-> closest wall point and distance (x, y, z, d) per cell
+ *   w_face   <-> associated local boundary face id, or -1
+ *
+ * returns:
+ *   1 if the cell was updated, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_sweep_update(cs_lnum_t           c_id,
+              cs_lnum_t           n_id,
+              cs_lnum_t           n_cells,
+              const cs_real_3_t   cell_cen[],
+              cs_real_4_t         wpd[],
+              cs_lnum_t           w_face[])
+{
+  if (wpd[n_id][3] >= cs_math_big_r)
+    return 0;
+
+  cs_real_t d = cs_math_3_distance(cell_cen[c_id], wpd[n_id]);
+
+  if (d < wpd[c_id][3]*(1. - 1e-12)) {
+    for (int k = 0; k < 3; k++)
+      wpd[c_id][k] = wpd[n_id][k];
+    wpd[c_id][3] = d;
+    w_face[c_id] = (n_id < n_cells) ? w_face[n_id] : -1;
+    return (c_id < n_cells) ? 1 : 0;
+  }
+
+  return 0;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1130,6 +1176,211 @@ cs_wall_distance_geometric(void)
      dismin, dismax);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute distance to wall by closest wall point propagation
+ *        (fast sweeping approach for the eikonal equation).
+ *
+ * Each cell holds the closest wall point found so far, which is
+ * propagated to neighboring cells through interior faces, in alternating
+ * forward and backward sweeps, with a halo synchronization between
+ * sweeps, until no distance decreases on any rank. Cells adjacent to
+ * a wall face are initialized with the face's wall distance, and
+ * immersed boundary cells with their immersed wall distance.
+ *
+ * On meshes with moving vertices, the closest wall points of the previous
+ * call are reused as a starting point when they belong to a local wall
+ * face (updated with the current face position), so that only a few
+ * sweeps are needed when walls move by a small amount.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_distance_sweeping(void)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
+
+  const int *bc_type = cs_glob_bc_type;
+
+  const cs_lnum_t n_cells     = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces   = mesh->n_i_faces;
+  const cs_lnum_t n_b_faces   = mesh->n_b_faces;
+  const cs_lnum_2_t *i_face_cells = mesh->i_face_cells;
+  const cs_lnum_t *b_face_cells = mesh->b_face_cells;
+  const cs_real_3_t *b_face_cog = (const cs_real_3_t *)fvq->b_face_cog;
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)fvq->cell_cen;
+  const cs_real_t *b_dist = fvq->b_dist;
+  const cs_real_t *c_w_dist_inv = fvq->c_w_dist_inv;
+
+  if (mesh->n_init_perio > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: not compatible with periodicity."), __func__);
+
+  cs_field_t *f_w_dist = cs_field_by_name("wall_distance");
+  cs_real_t *wall_dist = f_w_dist->val;
+
+  /* Reuse previous closest points only if the connectivity is unchanged */
+
+  bool incremental = (   mesh->time_dep != CS_MESH_TRANSIENT_CONNECT
+                      && _sweep_n_cells == n_cells
+                      && _sweep_wpd != nullptr);
+
+  if (!incremental) {
+    _sweep_n_cells = n_cells;
+    BFT_REALLOC(_sweep_wpd, n_cells_ext, cs_real_4_t);
+    BFT_REALLOC(_sweep_w_face, n_cells_ext, cs_lnum_t);
+  }
+
+  cs_real_4_t *wpd = _sweep_wpd;
+  cs_lnum_t *w_face = _sweep_w_face;
+
+  /* Initialization
+     -------------- */
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    cs_lnum_t f_id = (incremental && c_id < n_cells) ? w_face[c_id] : -1;
+    if (   f_id > -1
+        && (bc_type[f_id] == CS_SMOOTHWALL || bc_type[f_id] == CS_ROUGHWALL)) {
+      for (int k = 0; k < 3; k++)
+        wpd[c_id][k] = b_face_cog[f_id][k];
+      wpd[c_id][3] = cs_math_3_distance(cell_cen[c_id], b_face_cog[f_id]);
+    }
+    else {
+      for (int k = 0; k < 3; k++)
+        wpd[c_id][k] = 0.;
+      wpd[c_id][3] = cs_math_big_r;
+      w_face[c_id] = -1;
+    }
+  }
+
+  /* Wall-adjacent cells */
+
+  cs_gnum_t n_wall_g = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (bc_type[f_id] == CS_SMOOTHWALL || bc_type[f_id] == CS_ROUGHWALL) {
+      cs_lnum_t c_id = b_face_cells[f_id];
+      if (b_dist[f_id] < wpd[c_id][3]) {
+        for (int k = 0; k < 3; k++)
+          wpd[c_id][k] = b_face_cog[f_id][k];
+        wpd[c_id][3] = b_dist[f_id];
+        w_face[c_id] = f_id;
+      }
+      n_wall_g++;
+    }
+  }
+
+  /* Immersed boundaries (the cell center is used as wall point
+     for propagation) */
+
+  if (c_w_dist_inv != nullptr) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (c_w_dist_inv[c_id] > DBL_MIN) {
+        cs_real_t d = 1. / c_w_dist_inv[c_id];
+        if (d < wpd[c_id][3]) {
+          for (int k = 0; k < 3; k++)
+            wpd[c_id][k] = cell_cen[c_id][k];
+          wpd[c_id][3] = d;
+          w_face[c_id] = -1;
+        }
+        n_wall_g++;
+      }
+    }
+  }
+
+  cs_parall_counter(&n_wall_g, 1);
+
+  /* If no wall, initialization to a big value */
+
+  if (n_wall_g == 0) {
+    cs_array_real_set_scalar(n_cells, cs_math_big_r, wall_dist);
+    return;
+  }
+
+  /* Sweeps
+     ------ */
+
+  const int n_max_sweeps = 10000;
+  int n_sweeps = 0;
+
+  while (n_sweeps < n_max_sweeps) {
+
+    if (mesh->halo != nullptr)
+      cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD,
+                               (cs_real_t *)wpd, 4);
+
+    cs_gnum_t n_upd = 0;
+
+    /* Alternate face order (Gauss-Seidel type sweeps) */
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      cs_lnum_t c_id0 = i_face_cells[f_id][0];
+      cs_lnum_t c_id1 = i_face_cells[f_id][1];
+      n_upd += _sweep_update(c_id0, c_id1, n_cells, cell_cen, wpd, w_face);
+      n_upd += _sweep_update(c_id1, c_id0, n_cells, cell_cen, wpd, w_face);
+    }
+
+    for (cs_lnum_t f_id = n_i_faces - 1; f_id > -1; f_id--) {
+      cs_lnum_t c_id0 = i_face_cells[f_id][0];
+      cs_lnum_t c_id1 = i_face_cells[f_id][1];
+      n_upd += _sweep_update(c_id0, c_id1, n_cells, cell_cen, wpd, w_face);
+      n_upd += _sweep_update(c_id1, c_id0, n_cells, cell_cen, wpd, w_face);
+    }
+
+    n_sweeps++;
+
+    cs_parall_counter(&n_upd, 1);
+    if (n_upd == 0)
+      break;
+  }
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    wall_dist[c_id] = wpd[c_id][3];
+
+  /* Compute bounds and print info
+     ----------------------------- */
+
+  cs_real_t dismax = -cs_math_big_r;
+  cs_real_t dismin =  cs_math_big_r;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    dismin = cs_math_fmin(wall_dist[c_id], dismin);
+    dismax = cs_math_fmax(wall_dist[c_id], dismax);
+  }
+
+  cs_parall_min(1, CS_REAL_TYPE, &dismin);
+  cs_parall_max(1, CS_REAL_TYPE, &dismax);
+
+  cs_log_printf
+    (CS_LOG_DEFAULT,
+     _("\n"
+       " ** WALL DISTANCE (sweeping algorithm) \n"
+       "    ------------- \n"
+       " \n"
+       " Number of sweeps = %d%s\n"
+       " Min distance = %14.5f, Max distance = %14.5f \n"),
+     n_sweeps, (incremental) ? " (incremental)" : "",
+     dismin, dismax);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data kept between wall distance computations.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_distance_finalize(void)
+{
+  _sweep_n_cells = 0;
+  BFT_FREE(_sweep_wpd);
+  BFT_FREE(_sweep_w_face);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Provide read/write access to cs_glob_wall_distance
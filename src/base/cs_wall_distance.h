@@ -59,6 +59,8 @@ typedef struct {
    * - 2: brute force algorithm (based on geometrical considerations),
    *      for serial mode without periodicity only; useful only
    *      as a reference for testing.
+   * - 3: closest wall point propagation (fast sweeping), without
+   *      periodicity; incremental on moving meshes.
    *
    * Note that in the case of restarts, reading the distance from the
    * restart file will avoid minor differences due to the fact that
@@ -111,6 +113,25 @@ cs_wall_distance_yplus(cs_real_t  visvdr[]);
 void
 cs_wall_distance_geometric(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute distance to wall by closest wall point propagation
+ *        (fast sweeping approach for the eikonal equation).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_distance_sweeping(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data kept between wall distance computations.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_distance_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Provide read/write access to cs_glob_wall_distance
@@ -89,18 +89,33 @@ contains
 
     implicit none
 
+    call cs_f_boundary_conditions_create
+
+    call boundary_conditions_map_pointers
+
+  end subroutine boundary_conditions_init
+
+  !=============================================================================
+
+  subroutine boundary_conditions_map_pointers() &
+    bind(C, name='cs_f_boundary_conditions_map')
+
+    use, intrinsic :: iso_c_binding
+    use mesh
+    use cs_c_bindings
+
+    implicit none
+
     ! Local variables
 
     type(c_ptr) :: c_itypfb, c_izfppp
 
-    call cs_f_boundary_conditions_create
-
     call cs_f_boundary_conditions_get_pointers(c_itypfb, c_izfppp)
 
     call c_f_pointer(c_itypfb, itypfb, [nfabor])
     call c_f_pointer(c_izfppp, izfppp, [nfabor])
 
-  end subroutine boundary_conditions_init
+  end subroutine boundary_conditions_map_pointers
 
   !=============================================================================
 
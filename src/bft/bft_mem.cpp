@@ -41,7 +41,10 @@
  * Standard C and C++ library headers
  */
 
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <vector>
 
 #include <assert.h>
 #include <errno.h>
@@ -143,10 +146,25 @@
 
 #define DIR_SEPARATOR '/'
 
+/* Sampled allocation tracking: size of lock-free table of sampled
+   pointers (power of 2), and maximum probe length in that table */
+
+#define BFT_MEM_SAMPLE_TABLE_SIZE  65536
+#define BFT_MEM_SAMPLE_MAX_PROBE      64
+
 /*-------------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
 
+/* Sampled pointer record */
+
+typedef struct {
+
+  int     site_id;   /* associated allocation site id */
+  size_t  weight;    /* estimated memory size represented by sample */
+
+} _bft_mem_sample_t;
+
 /*-----------------------------------------------------------------------------
  * Local function prototypes
  *-----------------------------------------------------------------------------*/
@@ -198,6 +216,43 @@ static bft_mem_free_t      *_bft_alt_free_func = NULL;
 
 #if defined(HAVE_OPENMP)
 static omp_lock_t _bft_mem_lock;
+static bool _bft_mem_thread_safe = false;  /* always lock map updates */
+#endif
+
+/* Sampled allocation tracking; the sampled pointers table is lock-free,
+   so that non-sampled allocations and frees do not require a lock. */
+
+static size_t _bft_mem_sample_period = 0;  /* 0 if sampling not active */
+
+static thread_local long long _bft_mem_sample_countdown = 0;
+
+static std::atomic<const void *>
+  _bft_mem_sample_ptr[BFT_MEM_SAMPLE_TABLE_SIZE];
+static _bft_mem_sample_t  _bft_mem_sample[BFT_MEM_SAMPLE_TABLE_SIZE];
+
+static std::atomic<size_t>  _bft_mem_sample_n_live(0);
+static std::atomic<size_t>  _bft_mem_sample_n_dropped(0);
+
+static std::mutex  _bft_mem_sample_mutex;
+
+static std::map<std::pair<const char *, int>, int>  _bft_mem_site_map;
+static std::vector<bft_mem_site_t>                  _bft_mem_sites;
+
+static size_t  _bft_mem_sample_cur = 0;
+static size_t  _bft_mem_sample_max = 0;
+
+/* Device memory tracking by allocation site (device and host-device
+   blocks are always in the block map, so tracking is exact) */
+
+#if defined(HAVE_ACCEL)
+
+static std::map<const void *, int>                  _bft_mem_device_block_site;
+static std::map<std::pair<const char *, int>, int>  _bft_mem_device_site_map;
+static std::vector<bft_mem_site_t>                  _bft_mem_device_sites;
+
+static size_t  _bft_mem_device_cur = 0;
+static size_t  _bft_mem_device_max = 0;
+
 #endif
 
 /*-----------------------------------------------------------------------------
@@ -417,6 +472,274 @@ _bft_mem_block_info_error(const void  *p)
                  p);
 }
 
+/*
+ * Hash function for sampled pointers table.
+ *
+ * parameters:
+ *   p: <-- pointer
+ *
+ * returns:
+ *   initial slot in sampled pointers table
+ */
+
+static inline size_t
+_bft_mem_sample_hash(const void  *p)
+{
+  uint64_t h = (uint64_t)(uintptr_t)p;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+
+  return (size_t)h & (BFT_MEM_SAMPLE_TABLE_SIZE - 1);
+}
+
+/*
+ * Record a sampled allocation.
+ *
+ * parameters:
+ *   p:         <-- allocated pointer
+ *   size:      <-- allocated size
+ *   file_name: <-- name of calling source file
+ *   line_num:  <-- line number in calling source file
+ */
+
+static void
+_bft_mem_sample_add(const void  *p,
+                    size_t       size,
+                    const char  *file_name,
+                    int          line_num)
+{
+  const void *tombstone = (const void *)(uintptr_t)1;
+
+  /* Claim a slot in the sampled pointers table */
+
+  size_t s_id = _bft_mem_sample_hash(p);
+  int n_probe = 0;
+
+  for (n_probe = 0; n_probe < BFT_MEM_SAMPLE_MAX_PROBE; n_probe++) {
+    const void *k = _bft_mem_sample_ptr[s_id].load(std::memory_order_relaxed);
+    if (   (k == nullptr || k == tombstone)
+        && _bft_mem_sample_ptr[s_id].compare_exchange_strong(k, p))
+      break;
+    s_id = (s_id + 1) & (BFT_MEM_SAMPLE_TABLE_SIZE - 1);
+  }
+
+  if (n_probe >= BFT_MEM_SAMPLE_MAX_PROBE) {
+    _bft_mem_sample_n_dropped += 1;
+    return;
+  }
+
+  /* A sample larger than the sampling period represents itself only */
+
+  size_t weight = (size > _bft_mem_sample_period) ?
+    size : _bft_mem_sample_period;
+
+  std::lock_guard<std::mutex> lock(_bft_mem_sample_mutex);
+
+  auto key = std::make_pair(file_name, line_num);
+  auto it = _bft_mem_site_map.find(key);
+
+  int site_id = 0;
+  if (it != _bft_mem_site_map.end())
+    site_id = it->second;
+  else {
+    site_id = _bft_mem_sites.size();
+    _bft_mem_site_map[key] = site_id;
+    bft_mem_site_t site = {file_name, line_num, 0, 0, 0, 0};
+    _bft_mem_sites.push_back(site);
+  }
+
+  _bft_mem_sample[s_id].site_id = site_id;
+  _bft_mem_sample[s_id].weight = weight;
+  _bft_mem_sample_n_live += 1;
+
+  bft_mem_site_t *site = _bft_mem_sites.data() + site_id;
+  site->cur_size += weight;
+  site->n_samples += 1;
+  if (site->max_size < site->cur_size)
+    site->max_size = site->cur_size;
+
+  /* On a new (sampled) peak, save contribution of each site */
+
+  _bft_mem_sample_cur += weight;
+
+  if (_bft_mem_sample_max < _bft_mem_sample_cur) {
+    _bft_mem_sample_max = _bft_mem_sample_cur;
+    for (auto &x : _bft_mem_sites)
+      x.peak_size = x.cur_size;
+  }
+}
+
+/*
+ * Count an allocation for sampled tracking, and record it if sampled.
+ *
+ * Each thread samples one allocation every _bft_mem_sample_period bytes,
+ * so only a per-thread counter is updated for most allocations.
+ *
+ * parameters:
+ *   p:         <-- allocated pointer
+ *   size:      <-- allocated size
+ *   file_name: <-- name of calling source file
+ *   line_num:  <-- line number in calling source file
+ */
+
+static inline void
+_bft_mem_sample_alloc(const void  *p,
+                      size_t       size,
+                      const char  *file_name,
+                      int          line_num)
+{
+  if (_bft_mem_sample_period == 0 || file_name == nullptr)
+    return;
+
+  _bft_mem_sample_countdown -= (long long)size;
+  if (_bft_mem_sample_countdown > 0)
+    return;
+
+  long long period = _bft_mem_sample_period;
+  _bft_mem_sample_countdown += (1 - _bft_mem_sample_countdown/period) * period;
+
+  _bft_mem_sample_add(p, size, file_name, line_num);
+}
+
+/*
+ * Remove a pointer from sampled tracking if it was sampled.
+ *
+ * parameters:
+ *   p: <-- pointer being freed or reallocated
+ */
+
+static inline void
+_bft_mem_sample_free(const void  *p)
+{
+  if (_bft_mem_sample_n_live.load(std::memory_order_relaxed) == 0)
+    return;
+
+  size_t s_id = _bft_mem_sample_hash(p);
+
+  for (int n_probe = 0; n_probe < BFT_MEM_SAMPLE_MAX_PROBE; n_probe++) {
+    const void *k = _bft_mem_sample_ptr[s_id].load(std::memory_order_acquire);
+    if (k == nullptr)
+      return;
+    else if (k == p) {
+      std::lock_guard<std::mutex> lock(_bft_mem_sample_mutex);
+      size_t weight = _bft_mem_sample[s_id].weight;
+      _bft_mem_sites[_bft_mem_sample[s_id].site_id].cur_size -= weight;
+      _bft_mem_sample_cur -= weight;
+      _bft_mem_sample_n_live -= 1;
+      /* Release slot only once its record has been read */
+      _bft_mem_sample_ptr[s_id].store((const void *)(uintptr_t)1);
+      return;
+    }
+    s_id = (s_id + 1) & (BFT_MEM_SAMPLE_TABLE_SIZE - 1);
+  }
+}
+
+#if defined(HAVE_ACCEL)
+
+/*
+ * Return device memory size associated with a block.
+ *
+ * parameters:
+ *   b: <-- pointer to block info, or NULL
+ *
+ * returns:
+ *   size of device (or shared) memory associated with block
+ */
+
+static inline size_t
+_bft_mem_device_size(const cs_mem_block_t  *b)
+{
+  if (b == nullptr)
+    return 0;
+
+  if (   b->mode == CS_ALLOC_DEVICE
+      || b->mode == CS_ALLOC_HOST_DEVICE_SHARED
+      || (b->mode == CS_ALLOC_HOST_DEVICE && b->device_ptr != nullptr))
+    return b->size;
+
+  return 0;
+}
+
+/*
+ * Update device memory statistics by allocation site.
+ *
+ * A block keeps the site of its initial allocation, so that device
+ * memory associated later with a host block (or reallocated) is
+ * attributed to the same site. Must be called with block map lock held.
+ *
+ * parameters:
+ *   file_name: <-- name of calling source file
+ *   line_num:  <-- line number in calling source file
+ *   p_m_old:   <-- old block map key, or NULL
+ *   old_block: <-- pointer to old block info, or NULL
+ *   p_m_new:   <-- new block map key, or NULL
+ *   new_block: <-- pointer to new block info, or NULL
+ */
+
+static void
+_bft_mem_device_update(const char            *file_name,
+                       int                    line_num,
+                       const void            *p_m_old,
+                       const cs_mem_block_t  *old_block,
+                       const void            *p_m_new,
+                       const cs_mem_block_t  *new_block)
+{
+  int site_id = -1;
+
+  if (old_block != nullptr) {
+    auto it = _bft_mem_device_block_site.find(p_m_old);
+    if (it != _bft_mem_device_block_site.end()) {
+      site_id = it->second;
+      _bft_mem_device_block_site.erase(it);
+    }
+  }
+
+  if (   site_id < 0 && new_block != nullptr
+      && new_block->mode > CS_ALLOC_HOST && file_name != nullptr) {
+    auto key = std::make_pair(file_name, line_num);
+    auto it = _bft_mem_device_site_map.find(key);
+    if (it != _bft_mem_device_site_map.end())
+      site_id = it->second;
+    else {
+      site_id = _bft_mem_device_sites.size();
+      _bft_mem_device_site_map[key] = site_id;
+      bft_mem_site_t site = {file_name, line_num, 0, 0, 0, 0};
+      _bft_mem_device_sites.push_back(site);
+    }
+    _bft_mem_device_sites[site_id].n_samples += 1;
+  }
+
+  if (site_id < 0)
+    return;
+
+  if (new_block != nullptr && p_m_new != nullptr)
+    _bft_mem_device_block_site[p_m_new] = site_id;
+
+  size_t old_size = _bft_mem_device_size(old_block);
+  size_t new_size = _bft_mem_device_size(new_block);
+
+  if (old_size == new_size)
+    return;
+
+  bft_mem_site_t *site = _bft_mem_device_sites.data() + site_id;
+  site->cur_size += new_size;
+  site->cur_size -= old_size;
+  if (site->max_size < site->cur_size)
+    site->max_size = site->cur_size;
+
+  _bft_mem_device_cur += new_size;
+  _bft_mem_device_cur -= old_size;
+
+  if (_bft_mem_device_max < _bft_mem_device_cur) {
+    _bft_mem_device_max = _bft_mem_device_cur;
+    for (auto &x : _bft_mem_device_sites)
+      x.peak_size = x.cur_size;
+  }
+}
+
+#endif /* defined(HAVE_ACCEL) */
+
 /*
  * Fill a cs_mem_block_t structure for an allocated pointer.
  */
@@ -547,7 +870,7 @@ bft_mem_update_block_info(const char            *var_name,
       ||  old_mode > CS_ALLOC_HOST || new_mode > CS_ALLOC_HOST) {
 
 #if defined(HAVE_OPENMP)
-    int in_parallel = omp_in_parallel();
+    int in_parallel = (omp_in_parallel() || _bft_mem_thread_safe);
     if (in_parallel)
       omp_set_lock(&_bft_mem_lock);
 #endif
@@ -559,6 +882,12 @@ bft_mem_update_block_info(const char            *var_name,
     if (new_block != nullptr && p_m_new != nullptr)
       _bft_alloc_map[p_m_new] = *new_block;
 
+#if defined(HAVE_ACCEL)
+    if (old_mode > CS_ALLOC_HOST || new_mode > CS_ALLOC_HOST)
+      _bft_mem_device_update(file_name, line_num,
+                             p_m_old, old_block, p_m_new, new_block);
+#endif
+
     /* Memory allocation counting */
 
     if (_bft_mem_global_init_mode > 1) {
@@ -804,6 +1133,30 @@ bft_mem_initialized(void)
   return (_bft_mem_global_init_mode > 0) ? 1 : 0;
 }
 
+/*!
+ * \brief Indicate whether memory management functions may be called
+ *        from threads which are not OpenMP threads.
+ *
+ * In this case, allocation map updates are always protected by a lock,
+ * so that functions may be called from other threads (such as a
+ * background I/O thread). This is only possible when OpenMP is available.
+ *
+ * \param [in] thread_safe  if true, always lock allocation map updates
+ *
+ * \returns 1 if the requested mode is available, 0 otherwise.
+ */
+
+int
+bft_mem_set_thread_safe(bool  thread_safe)
+{
+#if defined(HAVE_OPENMP)
+  _bft_mem_thread_safe = thread_safe;
+  return 1;
+#else
+  return (thread_safe) ? 0 : 1;
+#endif
+}
+
 /*!
  * \brief Allocate memory for ni elements of size bytes.
  *
@@ -847,7 +1200,10 @@ bft_mem_malloc(size_t       ni,
                    var_name, (unsigned long)alloc_size);
     return NULL;
   }
-  else if (_bft_mem_global_init_mode < 2)
+
+  _bft_mem_sample_alloc(p_new, alloc_size, file_name, line_num);
+
+  if (_bft_mem_global_init_mode < 2)
     return p_new;
 
   cs_mem_block_t mib = _bft_mem_block_new(p_new, alloc_size);
@@ -943,6 +1299,9 @@ bft_mem_realloc(void        *ptr,
 
   void *p_new = realloc(ptr, new_size);
 
+  _bft_mem_sample_free(ptr);
+  _bft_mem_sample_alloc(p_new, new_size, file_name, line_num);
+
   if (file_name != nullptr) {
     cs_mem_block_t mib_new = _bft_mem_block_new(p_new, new_size);
 
@@ -1001,6 +1360,8 @@ bft_mem_free(void        *ptr,
   }
 #endif
 
+  _bft_mem_sample_free(ptr);
+
   free(ptr);
   if (   mib_old.host_ptr != nullptr
       && file_name != nullptr)
@@ -1070,7 +1431,10 @@ bft_mem_memalign(size_t       alignment,
     }
     return NULL;
   }
-  else if (_bft_mem_global_init_mode < 2)
+
+  _bft_mem_sample_alloc(p_loc, alloc_size, file_name, line_num);
+
+  if (_bft_mem_global_init_mode < 2)
     return p_loc;
 
   cs_mem_block_t mib = _bft_mem_block_new(p_loc, alloc_size);
@@ -1120,6 +1484,138 @@ bft_mem_size_max(void)
   return (_bft_mem_global_alloc_max / 1024);
 }
 
+/*!
+ * \brief Set sampled allocation tracking mode.
+ *
+ * In this mode, which is independent of the tracing mode set by
+ * \ref bft_mem_init, allocations are sampled on average once every
+ * sample_period bytes in each thread, and aggregated by allocation site.
+ * Only the sampled pointers are tracked, using a lock-free table, so the
+ * overhead remains low enough for production runs.
+ *
+ * Each sample represents an estimated sample_period bytes (or its actual
+ * size if larger), so the resulting sizes are estimates, whose precision
+ * improves for sites allocating a large amount of memory.
+ *
+ * \param [in] sample_period  average bytes between samples, or 0 to
+ *                            deactivate sampling
+ */
+
+void
+bft_mem_sampling_set(size_t  sample_period)
+{
+  _bft_mem_sample_period = sample_period;
+}
+
+/*!
+ * \brief Return the number of sampled allocation sites.
+ *
+ * \return number of allocation sites with at least one sample.
+ */
+
+int
+bft_mem_sampling_n_sites(void)
+{
+  std::lock_guard<std::mutex> lock(_bft_mem_sample_mutex);
+
+  return _bft_mem_sites.size();
+}
+
+/*!
+ * \brief Return sampled memory statistics for a given allocation site.
+ *
+ * \param [in]   site_id  allocation site id (< bft_mem_sampling_n_sites())
+ * \param [out]  site     associated allocation site statistics
+ */
+
+void
+bft_mem_sampling_site_info(int              site_id,
+                           bft_mem_site_t  *site)
+{
+  std::lock_guard<std::mutex> lock(_bft_mem_sample_mutex);
+
+  *site = _bft_mem_sites[site_id];
+}
+
+/*!
+ * \brief Return global sampled memory statistics.
+ *
+ * \param [out]  cur_size   estimated current sampled memory (bytes)
+ * \param [out]  max_size   estimated peak sampled memory (bytes)
+ * \param [out]  n_dropped  number of samples dropped due to a full
+ *                          sampled pointers table
+ */
+
+void
+bft_mem_sampling_summary(size_t  *cur_size,
+                         size_t  *max_size,
+                         size_t  *n_dropped)
+{
+  std::lock_guard<std::mutex> lock(_bft_mem_sample_mutex);
+
+  *cur_size = _bft_mem_sample_cur;
+  *max_size = _bft_mem_sample_max;
+  *n_dropped = _bft_mem_sample_n_dropped;
+}
+
+/*!
+ * \brief Return the number of device memory allocation sites.
+ *
+ * Memory allocated on devices (through the cs_base_accel allocation
+ * functions) is always tracked exactly, by allocation site.
+ *
+ * \return number of allocation sites with device or host-device allocations.
+ */
+
+int
+bft_mem_device_n_sites(void)
+{
+#if defined(HAVE_ACCEL)
+  return _bft_mem_device_sites.size();
+#else
+  return 0;
+#endif
+}
+
+/*!
+ * \brief Return device memory statistics for a given allocation site.
+ *
+ * \param [in]   site_id  allocation site id (< bft_mem_device_n_sites())
+ * \param [out]  site     associated allocation site statistics
+ */
+
+void
+bft_mem_device_site_info(int              site_id,
+                         bft_mem_site_t  *site)
+{
+#if defined(HAVE_ACCEL)
+  *site = _bft_mem_device_sites[site_id];
+#else
+  CS_UNUSED(site_id);
+  memset(site, 0, sizeof(bft_mem_site_t));
+#endif
+}
+
+/*!
+ * \brief Return global device memory statistics.
+ *
+ * \param [out]  cur_size  current device memory (bytes)
+ * \param [out]  max_size  peak device memory (bytes)
+ */
+
+void
+bft_mem_device_summary(size_t  *cur_size,
+                       size_t  *max_size)
+{
+#if defined(HAVE_ACCEL)
+  *cur_size = _bft_mem_device_cur;
+  *max_size = _bft_mem_device_max;
+#else
+  *cur_size = 0;
+  *max_size = 0;
+#endif
+}
+
 /*!
  * \brief Indicate if a memory aligned allocation variant is available.
  *
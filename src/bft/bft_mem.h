@@ -78,6 +78,22 @@ typedef struct
 
 } cs_mem_block_t;
 
+/*
+ * Sampled memory statistics for an allocation site
+ */
+
+typedef struct
+{
+  const char  *file_name;   //!< name of source file
+  int          line_num;    //!< line number in source file
+
+  size_t       cur_size;    //!< estimated current size (bytes)
+  size_t       max_size;    //!< estimated maximum size (bytes)
+  size_t       peak_size;   //!< estimated size at sampled peak (bytes)
+  size_t       n_samples;   //!< number of sampled allocations
+
+} bft_mem_site_t;
+
 /*============================================================================
  * Public macros
  *============================================================================*/
@@ -295,6 +311,24 @@ bft_mem_end(void);
 int
 bft_mem_initialized(void);
 
+/*
+ * Indicate whether memory management functions may be called
+ * from threads which are not OpenMP threads.
+ *
+ * In this case, allocation map updates are always protected by a lock,
+ * so that functions may be called from other threads (such as a
+ * background I/O thread). This is only possible when OpenMP is available.
+ *
+ * parameters:
+ *   thread_safe <-- if true, always lock allocation map updates
+ *
+ * returns:
+ *   1 if the requested mode is available, 0 otherwise.
+ */
+
+int
+bft_mem_set_thread_safe(bool  thread_safe);
+
 /*
  * Allocate memory for ni items of size bytes.
  *
@@ -426,6 +460,101 @@ bft_mem_size_current(void);
 size_t
 bft_mem_size_max(void);
 
+/*
+ * Set sampled allocation tracking mode.
+ *
+ * In this mode, which is independent of the tracing mode set by
+ * bft_mem_init(), allocations are sampled on average once every
+ * sample_period bytes in each thread, and aggregated by allocation site.
+ * Only the sampled pointers are tracked, using a lock-free table, so the
+ * overhead remains low enough for production runs.
+ *
+ * Each sample represents an estimated sample_period bytes (or its actual
+ * size if larger), so the resulting sizes are estimates, whose precision
+ * improves for sites allocating a large amount of memory.
+ *
+ * parameters:
+ *   sample_period <-- average bytes between samples, or 0 to deactivate
+ *                     sampling
+ */
+
+void
+bft_mem_sampling_set(size_t  sample_period);
+
+/*
+ * Return the number of sampled allocation sites.
+ *
+ * returns:
+ *   number of allocation sites with at least one sample.
+ */
+
+int
+bft_mem_sampling_n_sites(void);
+
+/*
+ * Return sampled memory statistics for a given allocation site.
+ *
+ * parameters:
+ *   site_id <-- allocation site id (< bft_mem_sampling_n_sites())
+ *   site    --> associated allocation site statistics
+ */
+
+void
+bft_mem_sampling_site_info(int              site_id,
+                           bft_mem_site_t  *site);
+
+/*
+ * Return global sampled memory statistics.
+ *
+ * parameters:
+ *   cur_size  --> estimated current sampled memory (bytes)
+ *   max_size  --> estimated peak sampled memory (bytes)
+ *   n_dropped --> number of samples dropped due to a full
+ *                 sampled pointers table
+ */
+
+void
+bft_mem_sampling_summary(size_t  *cur_size,
+                         size_t  *max_size,
+                         size_t  *n_dropped);
+
+/*
+ * Return the number of device memory allocation sites.
+ *
+ * Memory allocated on devices (through the cs_base_accel allocation
+ * functions) is always tracked exactly, by allocation site.
+ *
+ * returns:
+ *   number of allocation sites with device or host-device allocations.
+ */
+
+int
+bft_mem_device_n_sites(void);
+
+/*
+ * Return device memory statistics for a given allocation site.
+ *
+ * parameters:
+ *   site_id <-- allocation site id (< bft_mem_device_n_sites())
+ *   site    --> associated allocation site statistics
+ */
+
+void
+bft_mem_device_site_info(int              site_id,
+                         bft_mem_site_t  *site);
+
+/*
+ * Return global device memory statistics.
+ *
+ * parameters:
+ *   cur_size --> current device memory (bytes)
+ *   max_size --> peak device memory (bytes)
+ */
+
+void
+bft_mem_device_summary(size_t  *cur_size,
+                       size_t  *max_size);
+
 /*
  * Indicate if a memory aligned allocation variant is available.
  *
@@ -42,6 +42,7 @@
 #include "bft_mem.h"
 
 #include "cs_defs.h"
+#include "cs_dispatch.h"
 #include "cs_log.h"
 #include "cs_matrix_priv.h"
 #include "cs_matrix_assembler_priv.h"
@@ -1428,6 +1429,201 @@ cs_cdo_assembly_set_shift(cs_cdo_assembly_t *asb,
   asb->l_col_shift = l_col_shift;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the positions of the entries of cellwise scalar-valued
+ *        matrices in the values of a MSR matrix built from a given matrix
+ *        assembler. This is done once at setup, so that assembly steps then
+ *        reduce to a scatter (see \ref cs_cdo_assembly_matrix_scal_mapped).
+ *
+ * Cellwise matrices are assumed to follow the ordering of the DoFs given by
+ * the c2x adjacency. Only the case where all DoFs are owned by the local
+ * rank and the diagonal is stored separately is handled. Otherwise, nullptr
+ * is returned and the assembly functions relying on the matrix assembler
+ * values have to be used.
+ *
+ * \param[in] c2x    cell -> DoFs connectivity
+ * \param[in] rset   pointer to a cs_range_set_t structure
+ * \param[in] ma     pointer to the related matrix assembler
+ *
+ * \return a pointer to a new allocated cs_cdo_assembly_map_t or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cdo_assembly_map_t *
+cs_cdo_assembly_map_create(const cs_adjacency_t          *c2x,
+                           const cs_range_set_t          *rset,
+                           const cs_matrix_assembler_t   *ma)
+{
+  if (c2x == nullptr || rset == nullptr || ma == nullptr)
+    return nullptr;
+  if (ma->separate_diag == false)
+    return nullptr;
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+  const cs_lnum_t  n_rows = ma->n_rows;
+
+  /* Check that all DoFs are owned by the local rank */
+
+  int  n_dist = 0;
+  for (cs_lnum_t i = 0; i < c2x->idx[n_cells]; i++) {
+    const cs_gnum_t  g_id = rset->g_id[c2x->ids[i]];
+    if (g_id < ma->l_range[0] || g_id >= ma->l_range[1])
+      n_dist++;
+  }
+
+  cs_parall_max(1, CS_INT_TYPE, &n_dist);
+  if (n_dist > 0)
+    return nullptr;
+
+  cs_cdo_assembly_map_t  *map = nullptr;
+  BFT_MALLOC(map, 1, cs_cdo_assembly_map_t);
+
+  map->n_cells = n_cells;
+  map->n_rows = n_rows;
+
+  CS_MALLOC_HD(map->idx, n_cells + 1, cs_lnum_t, cs_alloc_mode);
+
+  map->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n_dofs = c2x->idx[c_id+1] - c2x->idx[c_id];
+    map->idx[c_id+1] = map->idx[c_id] + n_dofs*n_dofs;
+  }
+
+  CS_MALLOC_HD(map->pos, map->idx[n_cells], cs_lnum_t, cs_alloc_mode);
+
+  int  n_missing = 0;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN) reduction(+:n_missing)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    const cs_lnum_t  *dof_ids = c2x->ids + c2x->idx[c_id];
+    const int  n_dofs = c2x->idx[c_id+1] - c2x->idx[c_id];
+    cs_lnum_t  *pos = map->pos + map->idx[c_id];
+
+    for (int i = 0; i < n_dofs; i++) {
+
+      const cs_lnum_t  r_id = rset->g_id[dof_ids[i]] - ma->l_range[0];
+      const cs_lnum_t  l_start = ma->r_idx[r_id];
+      const int  n_l_cols = ma->r_idx[r_id+1] - l_start;
+
+      for (int j = 0; j < n_dofs; j++) {
+
+        if (i == j) {
+          pos[i*n_dofs + j] = -(r_id + 1);
+          continue;
+        }
+
+        const cs_lnum_t  l_c_id = rset->g_id[dof_ids[j]] - ma->l_range[0];
+        const int  col_idx = _l_binary_search(0,
+                                              n_l_cols,
+                                              l_c_id,
+                                              ma->c_id + l_start);
+
+        if (col_idx < 0) {
+          n_missing++;
+          pos[i*n_dofs + j] = -(r_id + 1); /* Not reachable with a matrix
+                                              assembler built from c2x */
+        }
+        else
+          pos[i*n_dofs + j] = l_start + col_idx;
+
+      } /* Loop on columns */
+
+    } /* Loop on rows */
+
+  } /* Loop on cells */
+
+  if (n_missing > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: %d cellwise entries are not in the matrix structure.\n",
+              __func__, n_missing);
+
+  return map;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a cs_cdo_assembly_map_t structure
+ *
+ * \param[in, out] p_map    double pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_map_free(cs_cdo_assembly_map_t   **p_map)
+{
+  if (p_map == nullptr)
+    return;
+
+  cs_cdo_assembly_map_t  *map = *p_map;
+  if (map == nullptr)
+    return;
+
+  CS_FREE_HD(map->idx);
+  CS_FREE_HD(map->pos);
+
+  BFT_FREE(map);
+  *p_map = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the values of all cellwise scalar-valued matrices to a MSR
+ *        matrix using precomputed positions. The scatter relies on a
+ *        dispatch context so that it is performed on the device when one is
+ *        available (cw_val should then be accessible from the device).
+ *
+ * The matrix values should have been initialized (for instance by
+ * \ref cs_matrix_assembler_values_init) before calling this function.
+ *
+ * \param[in]      map      pointer to a cs_cdo_assembly_map_t structure
+ * \param[in]      cw_val   values of the cellwise matrices (size idx[n_cells])
+ * \param[in, out] matrix   pointer to the MSR matrix to update
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_matrix_scal_mapped(const cs_cdo_assembly_map_t   *map,
+                                   const cs_real_t               *cw_val,
+                                   cs_matrix_t                   *matrix)
+{
+  if (map == nullptr || map->n_cells < 1)
+    return;
+
+  if (matrix->type != CS_MATRIX_MSR || matrix->n_rows != map->n_rows)
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Only MSR matrices matching the assembly map are handled.",
+              __func__);
+
+  cs_matrix_coeff_dist_t  *mc = (cs_matrix_coeff_dist_t *)matrix->coeffs;
+  assert(mc->_d_val != nullptr && mc->_e_val != nullptr);
+
+  cs_real_t  *d_val = mc->_d_val;
+  cs_real_t  *e_val = mc->_e_val;
+
+  const cs_lnum_t  *idx = map->idx;
+  const cs_lnum_t  *pos = map->pos;
+
+  cs_dispatch_context  ctx;
+
+  /* Cells sharing a DoF update the same entries */
+
+  const cs_dispatch_sum_type_t  sum_type = CS_DISPATCH_SUM_ATOMIC;
+
+  ctx.parallel_for(map->n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    for (cs_lnum_t k = idx[c_id]; k < idx[c_id+1]; k++) {
+      const cs_lnum_t  p = pos[k];
+      if (p < 0)
+        cs_dispatch_sum(d_val - p - 1, cw_val[k], sum_type);
+      else
+        cs_dispatch_sum(e_val + p, cw_val[k], sum_type);
+    }
+  });
+
+  ctx.wait();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Assemble a cellwise matrix into the global matrix.
@@ -33,6 +33,7 @@
 
 #include "cs_matrix.h"
 #include "cs_matrix_assembler.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_param_types.h"
 #include "cs_range_set.h"
 #include "cs_sdm.h"
@@ -125,6 +126,23 @@ struct _cs_cdo_assembly_t {
 
 };
 
+/* Precomputed positions of cellwise matrix entries in the values of a MSR
+ * matrix. This enables a scatter of all the cellwise contributions at once
+ * (on the host or on a device) without any search of column indexes. */
+
+typedef struct {
+
+  cs_lnum_t   n_cells;  /* Number of cells */
+  cs_lnum_t   n_rows;   /* Number of matrix rows */
+
+  cs_lnum_t  *idx;      /* size n_cells + 1; offsets of the cellwise
+                           (n_dofs x n_dofs) matrices */
+  cs_lnum_t  *pos;      /* size idx[n_cells]; position in the extra-diagonal
+                           values if >= 0, -(row_id + 1) for a diagonal
+                           entry */
+
+} cs_cdo_assembly_map_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -196,6 +214,64 @@ cs_cdo_assembly_set_shift(cs_cdo_assembly_t    *asb,
                           cs_lnum_t             l_row_shift,
                           cs_lnum_t             l_col_shift);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the positions of the entries of cellwise scalar-valued
+ *        matrices in the values of a MSR matrix built from a given matrix
+ *        assembler. This is done once at setup, so that assembly steps then
+ *        reduce to a scatter (see \ref cs_cdo_assembly_matrix_scal_mapped).
+ *
+ * Cellwise matrices are assumed to follow the ordering of the DoFs given by
+ * the c2x adjacency. Only the case where all DoFs are owned by the local
+ * rank and the diagonal is stored separately is handled. Otherwise, nullptr
+ * is returned and the assembly functions relying on the matrix assembler
+ * values have to be used.
+ *
+ * \param[in] c2x    cell -> DoFs connectivity
+ * \param[in] rset   pointer to a cs_range_set_t structure
+ * \param[in] ma     pointer to the related matrix assembler
+ *
+ * \return a pointer to a new allocated cs_cdo_assembly_map_t or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cdo_assembly_map_t *
+cs_cdo_assembly_map_create(const cs_adjacency_t          *c2x,
+                           const cs_range_set_t          *rset,
+                           const cs_matrix_assembler_t   *ma);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a cs_cdo_assembly_map_t structure
+ *
+ * \param[in, out] p_map    double pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_map_free(cs_cdo_assembly_map_t   **p_map);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the values of all cellwise scalar-valued matrices to a MSR
+ *        matrix using precomputed positions. The scatter relies on a
+ *        dispatch context so that it is performed on the device when one is
+ *        available (cw_val should then be accessible from the device).
+ *
+ * The matrix values should have been initialized (for instance by
+ * \ref cs_matrix_assembler_values_init) before calling this function.
+ *
+ * \param[in]      map      pointer to a cs_cdo_assembly_map_t structure
+ * \param[in]      cw_val   values of the cellwise matrices (size idx[n_cells])
+ * \param[in, out] matrix   pointer to the MSR matrix to update
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_matrix_scal_mapped(const cs_cdo_assembly_map_t   *map,
+                                   const cs_real_t               *cw_val,
+                                   cs_matrix_t                   *matrix);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Assemble a cellwise matrix into the global matrix.
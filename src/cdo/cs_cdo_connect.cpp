@@ -899,14 +899,38 @@ _assign_edge_ifs_rs(const cs_mesh_t     *mesh,
        into interior and border faces to do this, since only boundary faces
        can be associated to a periodicity */
 
-    ifs = cs_interface_set_create(n_edges,
-                                  nullptr,
-                                  edge_gnum,
-                                  mesh->periodicity,
-                                  0,
-                                  nullptr,
-                                  nullptr,
-                                  nullptr);
+    if (mesh->periodicity == nullptr && mesh->vtx_interfaces != nullptr) {
+
+      /* Ranks sharing an edge also share its vertices, so exchanges may be
+         restricted to the ranks of the vertex interfaces */
+
+      const cs_interface_set_t *vtx_ifs = mesh->vtx_interfaces;
+      const int n_neighbors = cs_interface_set_size(vtx_ifs);
+
+      int *neighbor_rank = nullptr;
+      BFT_MALLOC(neighbor_rank, n_neighbors, int);
+      for (int i = 0; i < n_neighbors; i++)
+        neighbor_rank[i]
+          = cs_interface_rank(cs_interface_set_get(vtx_ifs, i));
+
+      ifs = cs_interface_set_create_from_neighbors(n_edges,
+                                                   nullptr,
+                                                   edge_gnum,
+                                                   n_neighbors,
+                                                   neighbor_rank);
+
+      BFT_FREE(neighbor_rank);
+
+    }
+    else
+      ifs = cs_interface_set_create(n_edges,
+                                    nullptr,
+                                    edge_gnum,
+                                    mesh->periodicity,
+                                    0,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr);
 
     rs = cs_range_set_create(ifs,     /* interface set */
                              nullptr, /* halo */
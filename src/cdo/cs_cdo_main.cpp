@@ -54,6 +54,7 @@
 #include "cs_domain_setup.h"
 #include "cs_equation.h"
 #include "cs_equation_system.h"
+#include "cs_evaluate.h"
 #include "cs_gwf.h"
 #include "cs_log.h"
 #include "cs_log_iteration.h"
@@ -938,6 +939,10 @@ cs_cdo_finalize(cs_domain_t    *domain)
 
   cs_advection_field_destroy_all();
 
+  /* Free quadrature points stored for the evaluation of definitions */
+
+  cs_evaluate_free_quadrature_cache();
+
   /* Free the memory used inside modules using CDO schemes */
   /* ----------------------------------------------------- */
 
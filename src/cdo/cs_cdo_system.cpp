@@ -1796,8 +1796,9 @@ cs_cdo_system_build_block(cs_cdo_system_helper_t  *sh,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Allocate and initialize the matrix, rhs and the matrix assembler
- *        values. If p_rhs is nullptr then one allocates the rhs inside this
+ * \brief Initialize only the right-hand side of the system. Matrices are
+ *        kept as they are, which enables one to reuse them from one solve to
+ *        another. If p_rhs is nullptr then one allocates the rhs inside this
  *        function. The ownership is transfered to this structure in that case.
  *
  * \param[in, out] sh       pointer to a system helper structure
@@ -1806,14 +1807,12 @@ cs_cdo_system_build_block(cs_cdo_system_helper_t  *sh,
 /*----------------------------------------------------------------------------*/
 
 void
-cs_cdo_system_helper_init_system(cs_cdo_system_helper_t    *sh,
-                                 cs_real_t                **p_rhs)
+cs_cdo_system_helper_init_rhs(cs_cdo_system_helper_t    *sh,
+                              cs_real_t                **p_rhs)
 {
   if (sh == nullptr)
     return;
 
-  /* Right-hand side */
-
   cs_real_t *rhs = *p_rhs;
   if (rhs == nullptr) {
 
@@ -1839,6 +1838,29 @@ cs_cdo_system_helper_init_system(cs_cdo_system_helper_t    *sh,
     sh->rhs = rhs;
 
   cs_array_real_fill_zero(sh->full_rhs_size, sh->rhs);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate and initialize the matrix, rhs and the matrix assembler
+ *        values. If p_rhs is nullptr then one allocates the rhs inside this
+ *        function. The ownership is transfered to this structure in that case.
+ *
+ * \param[in, out] sh       pointer to a system helper structure
+ * \param[in, out] p_rhs    double pointer to the RHS array to initialize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_system_helper_init_system(cs_cdo_system_helper_t    *sh,
+                                 cs_real_t                **p_rhs)
+{
+  if (sh == nullptr)
+    return;
+
+  /* Right-hand side */
+
+  cs_cdo_system_helper_init_rhs(sh, p_rhs);
 
   /* Initialize structures */
 
@@ -1970,6 +1992,48 @@ cs_cdo_system_helper_init_system(cs_cdo_system_helper_t    *sh,
   } /* Loop on blocks */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate the matrix related to a default block without any matrix
+ *        assembler values, so that coefficients are set directly afterwards
+ *        (for instance, a matrix-free operator). The matrix is freed with
+ *        \ref cs_cdo_system_helper_reset
+ *
+ * \param[in, out] sh         pointer to a system helper structure
+ * \param[in]      block_id   id of the (default) block to consider
+ *
+ * \return a pointer to the new matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_cdo_system_helper_init_bare_matrix(cs_cdo_system_helper_t    *sh,
+                                      int                        block_id)
+{
+  if (sh == nullptr)
+    return nullptr;
+
+  assert(block_id > -1 && block_id < sh->n_blocks);
+
+  cs_cdo_system_block_t  *b = sh->blocks[block_id];
+
+  if (b->type != CS_CDO_SYSTEM_BLOCK_DEFAULT)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: Only default blocks are handled.\n", __func__);
+
+  cs_cdo_system_dblock_t *db = (cs_cdo_system_dblock_t *)b->block_pointer;
+
+  if (db->matrix != nullptr) {
+    cs_matrix_release_coefficients(db->matrix);
+    cs_matrix_destroy(&(db->matrix));
+  }
+
+  assert(db->matrix_structure != nullptr);
+  db->matrix = cs_matrix_create(db->matrix_structure);
+
+  return db->matrix;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize the assembly after the cellwise building and assembly
@@ -2033,20 +2097,37 @@ cs_cdo_system_helper_finalize_assembly(cs_cdo_system_helper_t    *sh)
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Free matrix and rhs after the solve step
+ * \brief Free only the rhs after the solve step. Matrices are kept.
  *
  * \param[in, out]      sh       pointer to a system helper structure
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_cdo_system_helper_reset(cs_cdo_system_helper_t    *sh)
+cs_cdo_system_helper_reset_rhs(cs_cdo_system_helper_t    *sh)
 {
   if (sh == nullptr)
     return;
 
   BFT_FREE(sh->_rhs);
   sh->rhs = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free matrix and rhs after the solve step
+ *
+ * \param[in, out]      sh       pointer to a system helper structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_system_helper_reset(cs_cdo_system_helper_t    *sh)
+{
+  if (sh == nullptr)
+    return;
+
+  cs_cdo_system_helper_reset_rhs(sh);
 
   /* Free matrix (or matrices) */
 
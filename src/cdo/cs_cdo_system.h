@@ -699,6 +699,22 @@ void
 cs_cdo_system_build_block(cs_cdo_system_helper_t  *sh,
                           int                      block_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize only the right-hand side of the system. Matrices are
+ *        kept as they are, which enables one to reuse them from one solve to
+ *        another. If p_rhs is nullptr then one allocates the rhs inside this
+ *        function. The ownership is transfered to this structure in that case.
+ *
+ * \param[in, out] sh       pointer to a system helper structure
+ * \param[in, out] p_rhs    double pointer to the RHS array to initialize
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_system_helper_init_rhs(cs_cdo_system_helper_t    *sh,
+                              cs_real_t                **p_rhs);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Allocate and initialize the matrix, rhs and the matrix assembler
@@ -713,6 +729,24 @@ void
 cs_cdo_system_helper_init_system(cs_cdo_system_helper_t    *sh,
                                  cs_real_t                **p_rhs);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate the matrix related to a default block without any matrix
+ *        assembler values, so that coefficients are set directly afterwards
+ *        (for instance, a matrix-free operator). The matrix is freed with
+ *        \ref cs_cdo_system_helper_reset
+ *
+ * \param[in, out] sh         pointer to a system helper structure
+ * \param[in]      block_id   id of the (default) block to consider
+ *
+ * \return a pointer to the new matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_cdo_system_helper_init_bare_matrix(cs_cdo_system_helper_t    *sh,
+                                      int                        block_id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize the assembly after the cellwise building and assembly
@@ -724,6 +758,17 @@ cs_cdo_system_helper_init_system(cs_cdo_system_helper_t    *sh,
 void
 cs_cdo_system_helper_finalize_assembly(cs_cdo_system_helper_t    *sh);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free only the rhs after the solve step. Matrices are kept.
+ *
+ * \param[in, out]      sh       pointer to a system helper structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_system_helper_reset_rhs(cs_cdo_system_helper_t    *sh);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free matrix and rhs after the solve step
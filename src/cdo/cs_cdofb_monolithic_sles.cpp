@@ -326,8 +326,11 @@ _get_scaled_diag_m22(const cs_navsto_param_t  *nsp,
   const cs_cdo_quantities_t  *cdoq = cs_shared_quant;
   const cs_lnum_t  n_cells = cdoq->n_cells;
 
+  /* Accessible from the device so that the Schur complement approximation
+     may be applied there */
+
   cs_real_t *m22_mass_diag = nullptr;
-  BFT_MALLOC(m22_mass_diag, n_cells, cs_real_t);
+  CS_MALLOC_HD(m22_mass_diag, n_cells, cs_real_t, cs_alloc_mode);
 
   /* Compute scaling coefficients */
 
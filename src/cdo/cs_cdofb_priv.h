@@ -104,6 +104,13 @@ struct  _cs_cdofb_t {
   cs_hodge_t               **mass_hodge;
   cs_hodge_compute_t        *get_mass_matrix;
 
+  /* Reuse of the condensed system matrix (and of the setup of the linear
+     solver) from one time step to another when it does not change */
+
+  bool                       keep_system;
+  bool                       system_is_kept;
+  cs_real_t                  kept_dt;    /* time step used in the matrix */
+
 };
 
 typedef struct _cs_cdofb_t  cs_cdofb_priv_t;
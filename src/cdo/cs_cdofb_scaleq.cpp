@@ -103,6 +103,10 @@ BEGIN_C_DECLS
 static cs_cell_sys_t     **cs_cdofb_cell_sys = nullptr;
 static cs_cell_builder_t **cs_cdofb_cell_bld = nullptr;
 
+/* Reuse the condensed system matrix for new contexts */
+
+static bool  _sfb_keep_system = false;
+
 /* Pointer to shared structures */
 
 static const cs_cdo_quantities_t    *cs_shared_quant;
@@ -608,9 +612,11 @@ _sfb_assemble(const cs_cell_sys_t         *csys,
   assert(block->type == CS_CDO_SYSTEM_BLOCK_DEFAULT);
   cs_cdo_system_dblock_t *db = (cs_cdo_system_dblock_t *)block->block_pointer;
 
-  /* Matrix assembly */
+  /* Matrix assembly (skipped when the system matrix is kept from a
+     previous solve; there are no assembler values in this case) */
 
-  db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
+  if (db->mav != nullptr)
+    db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
 
   /* RHS assembly (only on faces since a static condensation has been performed
      to reduce the size) so that n_dofs = n_fc */
@@ -630,6 +636,46 @@ _sfb_assemble(const cs_cell_sys_t         *csys,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the condensed system matrix does not change from one time
+ *         step to another (the time step apart) so that it can be kept.
+ *         Case of scalar-valued CDO-Fb schemes
+ *
+ * \param[in] eqp    pointer to a cs_equation_param_t structure
+ * \param[in] eqb    pointer to a cs_equation_builder_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_sfb_system_can_be_kept(const cs_equation_param_t     *eqp,
+                        const cs_equation_builder_t   *eqb)
+{
+  if (!cs_property_is_steady(eqp->diffusion_property))
+    return false;
+  if (!cs_property_is_steady(eqp->time_property))
+    return false;
+
+  for (int i = 0; i < eqp->n_reaction_terms; i++)
+    if (!cs_property_is_steady(eqp->reaction_properties[i]))
+      return false;
+
+  if (cs_equation_param_has_convection(eqp)) {
+    const cs_xdef_t  *adv_def = eqp->adv_field->definition;
+    if (!(adv_def->state & CS_FLAG_STATE_STEADY))
+      return false;
+  }
+
+  /* Robin coefficients may vary in time */
+
+  if (eqb->face_bc->n_robin_faces > 0)
+    return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Update the variables related to CDO-Fb system after a resolution
@@ -691,6 +737,28 @@ cs_cdofb_scaleq_is_initialized(void)
     return true;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the reuse of the condensed system matrix for the
+ *         scalar-valued CDO-Fb equations defined afterwards (implicit Euler
+ *         time scheme).
+ *
+ *         The condensed matrix and the setup of the linear solver (e.g. the
+ *         multigrid hierarchy) are kept from one time step to another as long
+ *         as the time step is unchanged and the properties, the advection
+ *         field and the boundary conditions do not modify the matrix. Only
+ *         the right-hand side is then assembled.
+ *
+ * \param[in]  status  true to activate the reuse
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdofb_scaleq_set_system_reuse(bool  status)
+{
+  _sfb_keep_system = status;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate work buffer and general structures related to CDO
@@ -1004,6 +1072,12 @@ cs_cdofb_scaleq_init_context(cs_equation_param_t    *eqp,
   eqc->get_mass_matrix = nullptr;
   eqc->mass_hodge      = nullptr;
 
+  /* Reuse of the system matrix */
+
+  eqc->keep_system = _sfb_keep_system;
+  eqc->system_is_kept = false;
+  eqc->kept_dt = 0.;
+
   if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) {
 
     eqc->get_mass_matrix = cs_hodge_fb_get;
@@ -1775,12 +1849,24 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   _setup(ts->t_cur + ts->dt[0], mesh, eqp, eqb);
 
+  /* Check if the matrix (and the setup of the linear solver) related to the
+     previous time step can be reused. In this case, only the rhs is
+     assembled. */
+
+  const bool  keep_system =
+    eqc->keep_system && _sfb_system_can_be_kept(eqp, eqb);
+  const bool  reuse_system = keep_system && eqc->system_is_kept
+    && !(fabs(ts->dt[0] - eqc->kept_dt) > 0);
+
   /* Initialize the local system: rhs, matrix and assembler values */
 
   double  rhs_norm = 0.;
   cs_real_t *rhs      = nullptr;
 
-  cs_cdo_system_helper_init_system(sh, &rhs);
+  if (reuse_system)
+    cs_cdo_system_helper_init_rhs(sh, &rhs);
+  else
+    cs_cdo_system_helper_init_system(sh, &rhs);
 
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
@@ -1972,7 +2058,8 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   /* Free temporary buffers and structures */
 
-  cs_cdo_system_helper_finalize_assembly(sh);
+  if (!reuse_system)
+    cs_cdo_system_helper_finalize_assembly(sh);
   cs_equation_builder_reset(eqb);
 
   /* End of the system building */
@@ -1998,6 +2085,11 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
   cs_matrix_t  *matrix = cs_cdo_system_get_matrix(sh, 0);
   cs_range_set_t  *range_set = cs_cdo_system_get_range_set(sh, 0);
 
+  /* The setup of the linear solver relies on a previous matrix */
+
+  if (!reuse_system && eqc->system_is_kept)
+    cs_sles_free(sles);
+
   cs_cdo_solve_scalar_system(n_faces,
                              eqp->sles_param,
                              matrix,
@@ -2015,8 +2107,20 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   _update_cell_fields(&(eqb->tce), fld, eqc, cur2prev);
 
-  cs_sles_free(sles);
-  cs_cdo_system_helper_reset(sh);      /* free rhs and matrix */
+  if (keep_system) { /* Keep the matrix and the setup of the linear solver */
+
+    eqc->system_is_kept = true;
+    eqc->kept_dt = ts->dt[0];
+    cs_cdo_system_helper_reset_rhs(sh);
+
+  }
+  else {
+
+    eqc->system_is_kept = false;
+    cs_sles_free(sles);
+    cs_cdo_system_helper_reset(sh);      /* free rhs and matrix */
+
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -84,6 +84,25 @@ typedef struct _cs_cdofb_t cs_cdofb_scaleq_t;
 bool
 cs_cdofb_scaleq_is_initialized(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the reuse of the condensed system matrix for the
+ *         scalar-valued CDO-Fb equations defined afterwards (implicit Euler
+ *         time scheme).
+ *
+ *         The condensed matrix and the setup of the linear solver (e.g. the
+ *         multigrid hierarchy) are kept from one time step to another as long
+ *         as the time step is unchanged and the properties, the advection
+ *         field and the boundary conditions do not modify the matrix. Only
+ *         the right-hand side is then assembled.
+ *
+ * \param[in]  status  true to activate the reuse
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdofb_scaleq_set_system_reuse(bool  status);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate work buffer and general structures related to CDO
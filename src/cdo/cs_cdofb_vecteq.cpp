@@ -1820,6 +1820,12 @@ cs_cdofb_vecteq_init_context(cs_equation_param_t    *eqp,
   eqc->get_mass_matrix = nullptr;
   eqc->mass_hodge      = nullptr;
 
+  /* No reuse of the system matrix */
+
+  eqc->keep_system = false;
+  eqc->system_is_kept = false;
+  eqc->kept_dt = 0.;
+
   if (eqb->sys_flag & CS_FLAG_SYS_MASS_MATRIX) {
 
     eqc->get_mass_matrix = cs_hodge_fb_get;
@@ -139,6 +139,30 @@ struct _cs_cdovb_t {
   cs_hodge_t              **diffusion_hodge;
   cs_hodge_compute_t       *get_stiffness_matrix;
 
+  /* Batched application of the stiffness operator (scalar-valued only).
+     Cells with the same number of vertices are gathered into batches of
+     CS_SDM_BATCH_SIZE cells (padded with -1). Local matrices are stored in
+     an interleaved layout and kept as long as the property is uniform and
+     steady. */
+
+  bool                      batched_stiffness;
+  cs_lnum_t                 n_stiffness_batches;
+  cs_lnum_t                *stiffness_batch_cells;
+  cs_lnum_t                *stiffness_batch_idx;   /* index in values */
+  cs_real_t                *stiffness_batch_val;   /* NULL if not cached */
+  const cs_property_t      *stiffness_batch_pty;   /* related to cache */
+
+  /* Cellwise stiffness matrices reused while the diffusion property does
+     not change (nullptr if not activated) */
+
+  cs_hodge_cache_t         *stiffness_cache;
+
+  /* Steady systems are solved without assembling extra-diagonal terms, the
+     matrix-vector product being computed cellwise (only the diagonal is
+     stored to build a preconditioner) */
+
+  bool                      matrix_free;
+
   /* Pointer of function to build the advection term */
 
   cs_cdovb_advection_t     *get_advection_matrix;
@@ -109,6 +109,22 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/* Input of the matrix-free operator related to a steady-state system */
+
+typedef struct {
+
+  const cs_equation_param_t    *eqp;
+  cs_equation_builder_t        *eqb;
+  const cs_cdovb_scaleq_t      *eqc;
+  const cs_real_t              *fld_val;   /* field values (not modified) */
+  const cs_range_set_t         *rset;      /* range set of vertices */
+  cs_real_t                     t_eval;    /* time of evaluation */
+
+  cs_real_t                    *x_v;       /* buffer of size n_vertices */
+  cs_real_t                    *y_v;       /* buffer of size n_vertices */
+
+} _svb_mf_input_t;
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -118,6 +134,18 @@ BEGIN_C_DECLS
 static cs_cell_sys_t     **_svb_cell_system  = nullptr;
 static cs_cell_builder_t **_svb_cell_builder = nullptr;
 
+/* Use batched application of the stiffness operator for new contexts */
+
+static bool  _svb_batched_stiffness = false;
+
+/* Store cellwise stiffness matrices for new contexts */
+
+static bool  _svb_stiffness_cache = false;
+
+/* Solve steady-state systems in a matrix-free way for new contexts */
+
+static bool  _svb_matrix_free = false;
+
 /* Pointer to shared structures */
 
 static const cs_cdo_quantities_t    *cs_shared_quant;
@@ -451,7 +479,18 @@ _svb_conv_diff_reac(const cs_equation_param_t     *eqp,
     /* Define the local stiffness matrix: local matrix owned by the cellwise
        builder (store in cb->loc) */
 
-    bool  computed = eqc->get_stiffness_matrix(cm, diff_hodge, cb);
+    bool  computed = false;
+
+    /* Stored matrices are not used in boundary cells since the enforcement
+       of boundary conditions may rely on diff_hodge->matrix */
+
+    if (eqc->stiffness_cache != nullptr && !cs_cell_has_boundary_elements(cb))
+      computed = cs_hodge_cache_compute(eqc->stiffness_cache,
+                                        eqc->get_stiffness_matrix,
+                                        cm, cb->t_pty_eval,
+                                        diff_hodge, cb, cb->loc);
+    else
+      computed = eqc->get_stiffness_matrix(cm, diff_hodge, cb);
 
     /* Add the local diffusion operator to the local system */
 
@@ -1211,6 +1250,563 @@ _svb_assemble(const cs_cell_sys_t        *csys,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Perform the assembly step for scalar-valued CDO Vb schemes when
+ *          the matrix is not assembled. Only the diagonal of the cellwise
+ *          matrix is added to the (vertex-based) array diag.
+ *
+ * \param[in]      csys   pointer to a cellwise view of the system
+ * \param[in, out] rhs    right-hand side array
+ * \param[in, out] diag   diagonal array
+ * \param[in, out] eqc    context for this kind of discretization
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_assemble_matrix_free(const cs_cell_sys_t        *csys,
+                          cs_real_t                  *rhs,
+                          cs_real_t                  *diag,
+                          cs_cdovb_scaleq_t          *eqc)
+{
+  const int  n_dofs = csys->n_dofs;
+  const cs_real_t  *mval = csys->mat->val;
+
+  for (int v = 0; v < n_dofs; v++) {
+
+    const cs_lnum_t  v_id = csys->dof_ids[v];
+
+#   pragma omp atomic
+    rhs[v_id] += csys->rhs[v];
+#   pragma omp atomic
+    diag[v_id] += mval[v*(n_dofs + 1)];
+
+    if (eqc->source_terms != nullptr) {
+#     pragma omp atomic
+      eqc->source_terms[v_id] += csys->source[v];
+    }
+
+  } /* Loop on cell vertices */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build the cellwise system related to a steady-state equation for
+ *          the cell c_id: diffusion/advection/reaction terms, source terms
+ *          (optional), weak boundary conditions and enforcement of values
+ *
+ * \param[in]      c_id         id of the cell to consider
+ * \param[in]      with_source  add the source term contribution or not
+ * \param[in]      eqp          pointer to a cs_equation_param_t structure
+ * \param[in]      eqb          pointer to a cs_equation_builder_t structure
+ * \param[in]      eqc          context for this kind of discretization
+ * \param[in]      fld_val      values of the field at vertices
+ * \param[in, out] fm           pointer to a facewise view of the mesh
+ * \param[in, out] cm           pointer to a cellwise view of the mesh
+ * \param[in, out] mass_hodge   pointer to a cs_hodge_t structure (mass)
+ * \param[in, out] diff_hodge   pointer to a cs_hodge_t structure (diffusion)
+ * \param[in, out] csys         pointer to a cellwise view of the system
+ * \param[in, out] cb           pointer to a cellwise builder
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_build_steady_cell_system(cs_lnum_t                      c_id,
+                              bool                           with_source,
+                              const cs_equation_param_t     *eqp,
+                              cs_equation_builder_t         *eqb,
+                              const cs_cdovb_scaleq_t       *eqc,
+                              const cs_real_t                fld_val[],
+                              cs_face_mesh_t                *fm,
+                              cs_cell_mesh_t                *cm,
+                              cs_hodge_t                    *mass_hodge,
+                              cs_hodge_t                    *diff_hodge,
+                              cs_cell_sys_t                 *csys,
+                              cs_cell_builder_t             *cb)
+{
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+
+  /* Set the current cell flag */
+
+  cb->cell_flag = connect->cell_flag[c_id];
+
+  /* Set the local mesh structure for the current cell */
+
+  cs_cell_mesh_build(c_id,
+                     cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
+                     connect, quant, cm);
+
+  /* Set the local (i.e. cellwise) structures for the current cell */
+
+  _svb_init_cell_system(
+    cm, eqp, eqb, eqc->vtx_bc_flag, fld_val, nullptr, csys, cb);
+
+  /* Build and add the diffusion/advection/reaction terms into the local
+   * system.
+   * A mass matrix is also built if needed (stored in mass_hodge->matrix)
+   */
+
+  _svb_conv_diff_reac(eqp, eqb, eqc, cm, fm, mass_hodge, diff_hodge, csys, cb);
+
+  if (with_source && cs_equation_param_has_sourceterm(eqp)) {
+
+    /* SOURCE TERM
+     * =========== */
+
+    /* Reset the local contribution */
+
+    memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+
+    /* Source term contribution to the algebraic system */
+
+    cs_source_term_compute_cellwise(eqp->n_source_terms,
+                (cs_xdef_t *const *)eqp->source_terms,
+                                    cm,
+                                    eqb->source_mask,
+                                    eqb->compute_source,
+                                    cb->t_st_eval,
+                                    mass_hodge,
+                                    cb,
+                                    csys->source);
+
+    /* Update the RHS */
+
+    for (short int v = 0; v < cm->n_vc; v++)
+      csys->rhs[v] += csys->source[v];
+
+  } /* End of term source */
+
+  /* Apply boundary conditions (those which are weakly enforced) */
+
+  _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+
+  /* Enforce values if needed (internal or Dirichlet) */
+
+  _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Matrix-free operator y = A.x related to a steady-state system.
+ *          Cellwise systems are rebuilt and applied to the scattered values
+ *          of x. Vectors are defined on the rows of the matrix (gathered
+ *          view).
+ *
+ * \param[in]      input   pointer to a _svb_mf_input_t structure
+ * \param[in]      x       input vector
+ * \param[in, out] y       resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_matrix_free_operator(void             *input,
+                          const cs_real_t  *x,
+                          cs_real_t        *y)
+{
+  _svb_mf_input_t  *mfi = (_svb_mf_input_t *)input;
+
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_lnum_t  n_vertices = quant->n_vertices;
+  const cs_equation_param_t  *eqp = mfi->eqp;
+  cs_equation_builder_t  *eqb = mfi->eqb;
+  const cs_cdovb_scaleq_t  *eqc = mfi->eqc;
+
+  cs_real_t  *x_v = mfi->x_v, *y_v = mfi->y_v;
+
+  cs_range_set_scatter(mfi->rset, CS_REAL_TYPE, 1, x, x_v);
+  cs_array_real_fill_zero(n_vertices, y_v);
+
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)
+  {
+    const int  t_id = cs_get_thread_id();
+
+    cs_face_mesh_t  *fm = cs_cdo_local_get_face_mesh(t_id);
+    cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
+    cs_cell_sys_t  *csys = _svb_cell_system[t_id];
+    cs_cell_builder_t  *cb = _svb_cell_builder[t_id];
+    cs_hodge_t  *diff_hodge = (eqc->diffusion_hodge == nullptr)
+                                ? nullptr
+                                : eqc->diffusion_hodge[t_id];
+    cs_hodge_t  *mass_hodge
+      = (eqc->mass_hodge == nullptr) ? nullptr : eqc->mass_hodge[t_id];
+
+    cb->t_pty_eval = mfi->t_eval;
+    cb->t_bc_eval = mfi->t_eval;
+    cb->t_st_eval = mfi->t_eval;
+
+    cs_equation_builder_init_properties(eqp, eqb, diff_hodge, cb);
+
+#   pragma omp for CS_CDO_OMP_SCHEDULE
+    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+
+      _svb_build_steady_cell_system(c_id, false, /* no source term */
+                                    eqp, eqb, eqc, mfi->fld_val,
+                                    fm, cm, mass_hodge, diff_hodge, csys, cb);
+
+      /* Local matrix-vector product and scatter */
+
+      const int  n_dofs = csys->n_dofs;
+      const cs_real_t  *mval = csys->mat->val;
+
+      for (int i = 0; i < n_dofs; i++) {
+
+        const cs_real_t  *mi = mval + i*n_dofs;
+
+        cs_real_t  _y = 0.;
+        for (int j = 0; j < n_dofs; j++)
+          _y += mi[j] * x_v[csys->dof_ids[j]];
+
+#       pragma omp atomic
+        y_v[csys->dof_ids[i]] += _y;
+
+      }
+
+    } /* Loop on cells */
+
+  } /* OpenMP block */
+
+  if (connect->vtx_ifs != nullptr)
+    cs_interface_set_sum(connect->vtx_ifs,
+                         n_vertices,
+                         1,
+                         false,
+                         CS_REAL_TYPE,
+                         y_v);
+
+  cs_range_set_gather(mfi->rset, CS_REAL_TYPE, 1, y_v, y);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check if the settings of the linear solver are compatible with a
+ *          matrix-free solve (no assembled extra-diagonal terms)
+ *
+ * \param[in] slesp   pointer to a cs_param_sles_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_svb_matrix_free_is_compatible(const cs_param_sles_t  *slesp)
+{
+  if (slesp->solver_class != CS_PARAM_SOLVER_CLASS_CS)
+    return false;
+
+  if (   slesp->precond != CS_PARAM_PRECOND_NONE
+      && slesp->precond != CS_PARAM_PRECOND_DIAG)
+    return false;
+
+  switch (slesp->solver) {
+
+  case CS_PARAM_SOLVER_BICGS:
+  case CS_PARAM_SOLVER_BICGS2:
+  case CS_PARAM_SOLVER_CG:
+  case CS_PARAM_SOLVER_CR3:
+  case CS_PARAM_SOLVER_FCG:
+  case CS_PARAM_SOLVER_FGMRES:
+  case CS_PARAM_SOLVER_GCR:
+  case CS_PARAM_SOLVER_GMRES:
+    return true;
+
+  default:
+    return false;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define batches of cells with the same number of vertices, used for
+ *         the batched application of the stiffness operator
+ *
+ * \param[in]      connect  pointer to a cs_cdo_connect_t structure
+ * \param[in, out] eqc      pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_define_stiffness_batches(const cs_cdo_connect_t   *connect,
+                              cs_cdovb_scaleq_t        *eqc)
+{
+  if (eqc->stiffness_batch_cells != nullptr)
+    return;
+
+  const int  bs = CS_SDM_BATCH_SIZE;
+  const cs_lnum_t  n_cells = connect->n_cells;
+  const cs_lnum_t  *c2v_idx = connect->c2v->idx;
+  const int  n_max_vc = connect->n_max_vbyc;
+
+  /* Count cells by number of vertices */
+
+  cs_lnum_t  *n_vc_count = nullptr, *batch_shift = nullptr;
+  BFT_MALLOC(n_vc_count, n_max_vc + 1, cs_lnum_t);
+  BFT_MALLOC(batch_shift, n_max_vc + 1, cs_lnum_t);
+
+  for (int k = 0; k < n_max_vc + 1; k++)
+    n_vc_count[k] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    n_vc_count[c2v_idx[c_id+1] - c2v_idx[c_id]] += 1;
+
+  cs_lnum_t  n_batches = 0;
+  for (int k = 0; k < n_max_vc + 1; k++) {
+    batch_shift[k] = n_batches;
+    n_batches += (n_vc_count[k] + bs - 1) / bs;
+  }
+
+  eqc->n_stiffness_batches = n_batches;
+  BFT_MALLOC(eqc->stiffness_batch_cells, n_batches*bs, cs_lnum_t);
+  BFT_MALLOC(eqc->stiffness_batch_idx, n_batches + 1, cs_lnum_t);
+
+  cs_lnum_t  *b_cells = eqc->stiffness_batch_cells;
+  for (cs_lnum_t i = 0; i < n_batches*bs; i++)
+    b_cells[i] = -1;
+
+  /* Values index */
+
+  cs_lnum_t  *b_idx = eqc->stiffness_batch_idx;
+  b_idx[0] = 0;
+  for (int k = 0; k < n_max_vc + 1; k++) {
+    cs_lnum_t  n_k_batches = (n_vc_count[k] + bs - 1) / bs;
+    for (cs_lnum_t b_id = batch_shift[k]; b_id < batch_shift[k] + n_k_batches;
+         b_id++)
+      b_idx[b_id+1] = b_idx[b_id] + k*k*bs;
+  }
+
+  /* Distribute cells (n_vc_count is reused as a position counter) */
+
+  for (int k = 0; k < n_max_vc + 1; k++)
+    n_vc_count[k] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const int  k = c2v_idx[c_id+1] - c2v_idx[c_id];
+    b_cells[batch_shift[k]*bs + n_vc_count[k]] = c_id;
+    n_vc_count[k] += 1;
+  }
+
+  BFT_FREE(n_vc_count);
+  BFT_FREE(batch_shift);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free the structures related to the batched application of the
+ *         stiffness operator
+ *
+ * \param[in, out] eqc      pointer to a cs_cdovb_scaleq_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_free_stiffness_batches(cs_cdovb_scaleq_t        *eqc)
+{
+  eqc->n_stiffness_batches = 0;
+  eqc->stiffness_batch_pty = nullptr;
+
+  BFT_FREE(eqc->stiffness_batch_cells);
+  BFT_FREE(eqc->stiffness_batch_idx);
+  BFT_FREE(eqc->stiffness_batch_val);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Apply the stiffness operator using batches of cells with the same
+ *         number of vertices. Local matrices of a batch are stored in an
+ *         interleaved layout so that the local matrix-vector products are
+ *         vectorized across cells. If the property is uniform and steady,
+ *         local matrices are built once and kept for the next calls.
+ *
+ * \param[in]      eqb          pointer to a \ref cs_equation_builder_t
+ * \param[in, out] eqc          pointer to a cs_cdovb_scaleq_t structure
+ * \param[in]      pty          pointer to the property related to the op.
+ * \param[in]      hodge_array  array of pointers to cs_hodge_t (one by thread)
+ * \param[in]      pot          array to multiply with the stiffness matrix
+ * \param[in]      res_loc      location of entities in the resulting array
+ * \param[in, out] res          resulting array
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_apply_stiffness_batched(const cs_equation_builder_t   *eqb,
+                             cs_cdovb_scaleq_t             *eqc,
+                             const cs_property_t           *pty,
+                             cs_hodge_t                   **hodge_array,
+                             const cs_real_t               *pot,
+                             cs_flag_t                      res_loc,
+                             cs_real_t                     *res)
+{
+  const int  bs = CS_SDM_BATCH_SIZE;
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const cs_adjacency_t  *c2v = connect->c2v;
+  const cs_real_t  t_cur = cs_shared_time_step->t_cur;
+
+  _svb_define_stiffness_batches(connect, eqc);
+
+  const cs_lnum_t  n_batches = eqc->n_stiffness_batches;
+  const cs_lnum_t  *b_cells = eqc->stiffness_batch_cells;
+  const cs_lnum_t  *b_idx = eqc->stiffness_batch_idx;
+
+  /* Check if cached local matrices can be used (or built for next calls) */
+
+  const bool  pty_uniform = cs_property_is_uniform(pty);
+  bool  do_build = true;
+
+  if (pty_uniform && cs_property_is_steady(pty)) {
+    if (   eqc->stiffness_batch_val != nullptr
+        && eqc->stiffness_batch_pty == pty)
+      do_build = false;
+    else {
+      BFT_REALLOC(eqc->stiffness_batch_val, b_idx[n_batches], cs_real_t);
+      eqc->stiffness_batch_pty = pty;
+    }
+  }
+  else
+    BFT_FREE(eqc->stiffness_batch_val);
+
+  cs_real_t  *b_val = eqc->stiffness_batch_val;
+
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)
+  {
+    const int  t_id = cs_get_thread_id();
+
+    cs_cell_mesh_t  *cm = cs_cdo_local_get_cell_mesh(t_id);
+    cs_cell_builder_t  *cb = _svb_cell_builder[t_id];
+    cs_hodge_t  *hodge = hodge_array[t_id];
+
+    if (do_build && pty_uniform)
+      cs_hodge_evaluate_property(0, /* cell_id */
+                                 t_cur,
+                                 CS_FLAG_BOUNDARY_CELL_BY_FACE,
+                                 hodge);
+
+    const int  n_max_vc = connect->n_max_vbyc;
+
+    cs_sdm_batch_t  *bm = nullptr;
+    if (b_val == nullptr)
+      bm = cs_sdm_batch_create(n_max_vc);
+
+    cs_real_t  *p_cur = nullptr, *b_res = nullptr;
+    BFT_MALLOC(p_cur, 2*n_max_vc*bs, cs_real_t);
+    b_res = p_cur + n_max_vc*bs;
+
+#   pragma omp for CS_CDO_OMP_SCHEDULE
+    for (cs_lnum_t b_id = 0; b_id < n_batches; b_id++) {
+
+      const cs_lnum_t  *_cells = b_cells + b_id*bs;
+      const int  n_vc = c2v->idx[_cells[0]+1] - c2v->idx[_cells[0]];
+
+      cs_sdm_batch_t  _bm;
+      if (b_val != nullptr) {
+        cs_sdm_batch_map_array(n_vc, &_bm, b_val + b_idx[b_id]);
+        bm = &_bm;
+      }
+
+      /* Build local matrices of the batch if needed */
+
+      if (do_build) {
+
+        cs_sdm_batch_init(n_vc, bm);
+
+        for (int l = 0; l < bs; l++) {
+
+          const cs_lnum_t  c_id = _cells[l];
+          if (c_id < 0)
+            break;
+
+          cb->cell_flag = connect->cell_flag[c_id];
+          cs_cell_mesh_build(c_id,
+                             cs_equation_builder_cell_mesh_flag(cb->cell_flag,
+                                                                eqb),
+                             connect, quant, cm);
+
+          if (!pty_uniform)
+            cs_hodge_evaluate_property_cw(cm, t_cur, cb->cell_flag, hodge);
+
+          eqc->get_stiffness_matrix(cm, hodge, cb);
+
+          cs_sdm_batch_set_lane(cb->loc, l, bm);
+
+        }
+
+      }
+
+      /* Gather the potential (cell vertices are ordered as in c2v) */
+
+      for (int l = 0; l < bs; l++) {
+        const cs_lnum_t  c_id = _cells[l];
+        if (c_id < 0) {
+          for (int v = 0; v < n_vc; v++)
+            p_cur[v*bs + l] = 0.;
+        }
+        else {
+          const cs_lnum_t  *v_ids = c2v->ids + c2v->idx[c_id];
+          for (int v = 0; v < n_vc; v++)
+            p_cur[v*bs + l] = pot[v_ids[v]];
+        }
+      }
+
+      cs_sdm_batch_square_matvec(bm, p_cur, b_res);
+
+      /* Update the resulting array */
+
+      for (int l = 0; l < bs; l++) {
+
+        const cs_lnum_t  c_id = _cells[l];
+        if (c_id < 0)
+          break;
+
+        const cs_lnum_t  *v_ids = c2v->ids + c2v->idx[c_id];
+
+        if (cs_flag_test(res_loc, cs_flag_primal_vtx)) {
+
+          for (int v = 0; v < n_vc; v++) {
+#           pragma omp atomic
+            res[v_ids[v]] += b_res[v*bs + l];
+          }
+
+        }
+        else if (cs_flag_test(res_loc, cs_flag_primal_cell)) {
+
+          for (int v = 0; v < n_vc; v++)
+            res[c_id] += b_res[v*bs + l];
+
+        }
+        else {
+
+          assert(cs_flag_test(res_loc, cs_flag_dual_cell_byc));
+          cs_real_t  *_res = res + c2v->idx[c_id];
+
+          for (int v = 0; v < n_vc; v++)
+            _res[v] = b_res[v*bs + l];
+
+        }
+
+      } /* Loop on lanes */
+
+    } /* Loop on batches */
+
+    if (b_val == nullptr)
+      bm = cs_sdm_batch_free(bm);
+
+    BFT_FREE(p_cur);
+
+  } /* OpenMP Block */
+
+  /* Parallel or periodic synchronization */
+
+  if (cs_flag_test(res_loc, cs_flag_primal_vtx)) {
+    if (connect->vtx_ifs != nullptr)
+      cs_interface_set_sum(connect->vtx_ifs,
+                           connect->n_vertices,
+                           1, false, CS_REAL_TYPE,
+                           res);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1235,6 +1831,67 @@ cs_cdovb_scaleq_is_initialized(void)
     return true;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the batched application of the stiffness operator
+ *         for the scalar-valued CDO-Vb equations defined afterwards.
+ *
+ *         In this mode, cells with the same number of vertices (for instance
+ *         all hexahedra) are processed by batches of CS_SDM_BATCH_SIZE cells,
+ *         local matrix-vector products being vectorized across cells. Local
+ *         matrices are kept between calls when the property is uniform and
+ *         steady, which requires additional memory.
+ *
+ * \param[in]  status  true to activate the batched mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_set_batched_stiffness(bool  status)
+{
+  _svb_batched_stiffness = status;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the storage of the cellwise stiffness matrices for
+ *         the scalar-valued CDO-Vb equations defined afterwards.
+ *
+ *         Stored matrices are reused in interior cells at each build of the
+ *         system as long as the diffusion property does not change (for the
+ *         whole computation if the property is steady).
+ *
+ * \param[in]  status  true to activate the storage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_set_stiffness_cache(bool  status)
+{
+  _svb_stiffness_cache = status;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the matrix-free solve of steady-state systems for
+ *         the scalar-valued CDO-Vb equations defined afterwards.
+ *
+ *         The global matrix is not assembled: the matrix-vector product is
+ *         computed by rebuilding and applying the cellwise systems, and only
+ *         the diagonal is stored (Jacobi preconditioning). This is only
+ *         available with Krylov solvers of the code_saturne class using no
+ *         or a diagonal preconditioner; otherwise the assembled mode is kept.
+ *
+ * \param[in]  status  true to activate the matrix-free mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_set_matrix_free(bool  status)
+{
+  _svb_matrix_free = status;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate work buffer and general structures related to CDO
@@ -1395,6 +2052,14 @@ cs_cdovb_scaleq_init_context(cs_equation_param_t    *eqp,
   eqc->diffusion_hodge      = nullptr;
   eqc->get_stiffness_matrix = nullptr;
 
+  eqc->batched_stiffness = _svb_batched_stiffness;
+  eqc->n_stiffness_batches = 0;
+  eqc->stiffness_batch_cells = nullptr;
+  eqc->stiffness_batch_idx = nullptr;
+  eqc->stiffness_batch_val = nullptr;
+  eqc->stiffness_batch_pty = nullptr;
+  eqc->stiffness_cache = nullptr;
+
   if (cs_equation_param_has_diffusion(eqp)) {
 
     eqc->diffusion_hodge = cs_hodge_init_context(connect,
@@ -1443,8 +2108,31 @@ cs_cdovb_scaleq_init_context(cs_equation_param_t    *eqp,
 
     } /* Switch on Hodge algo. */
 
+    if (_svb_stiffness_cache)
+      eqc->stiffness_cache = cs_hodge_cache_create(connect->c2v,
+                                                   false, /* cell dof ? */
+                                                   eqp->diffusion_property);
+
   } /* Diffusion term is requested */
 
+  /* Matrix-free solve of steady-state systems */
+
+  eqc->matrix_free = false;
+  if (_svb_matrix_free) {
+
+    if (_svb_matrix_free_is_compatible(eqp->sles_param))
+      eqc->matrix_free = true;
+
+    else {
+      cs_base_warn(__FILE__, __LINE__);
+      cs_log_printf(CS_LOG_WARNINGS,
+                    " %s: Eq. \"%s\": The matrix-free mode requires a Krylov"
+                    " solver with no or a diagonal preconditioner.\n"
+                    " The system is assembled.\n", __func__, eqp->name);
+    }
+
+  }
+
   /* Boundary conditions */
   /* ------------------- */
 
@@ -2010,6 +2698,9 @@ cs_cdovb_scaleq_free_context(void   *scheme_context)
   cs_hodge_free_context(&(eqc->diffusion_hodge));
   cs_hodge_free_context(&(eqc->mass_hodge));
 
+  _svb_free_stiffness_batches(eqc);
+  cs_hodge_cache_free(&(eqc->stiffness_cache));
+
   /* Last free */
 
   BFT_FREE(eqc);
@@ -2487,8 +3178,20 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
 
   double  rhs_norm = 0.;
   cs_real_t *rhs      = nullptr;
+  cs_real_t *diag     = nullptr;
 
-  cs_cdo_system_helper_init_system(sh, &rhs);
+  const bool  matrix_free = eqc->matrix_free;
+
+  if (matrix_free) { /* Only the rhs and the diagonal are assembled */
+
+    cs_cdo_system_helper_init_rhs(sh, &rhs);
+
+    BFT_MALLOC(diag, quant->n_vertices, cs_real_t);
+    cs_array_real_fill_zero(quant->n_vertices, diag);
+
+  }
+  else
+    cs_cdo_system_helper_init_system(sh, &rhs);
 
   /* ------------------------- */
   /* Main OpenMP block on cell */
@@ -2532,62 +3235,11 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
     for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
 
-      /* Set the current cell flag */
-
-      cb->cell_flag = connect->cell_flag[c_id];
-
-      /* Set the local mesh structure for the current cell */
-
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
-
-      /* Set the local (i.e. cellwise) structures for the current cell */
-
-      _svb_init_cell_system(
-        cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, nullptr, csys, cb);
-
-      /* Build and add the diffusion/advection/reaction terms into the local
-       * system.
-       * A mass matrix is also built if needed (stored in mass_hodge->matrix)
-       */
-
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
-
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-
-        /* Reset the local contribution */
-
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
-
-        /* Source term contribution to the algebraic system */
-
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
-
-        /* Update the RHS */
+      /* Build the cellwise system (with source terms) */
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
-
-      } /* End of term source */
-
-      /* Apply boundary conditions (those which are weakly enforced) */
-
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
-
-      /* Enforce values if needed (internal or Dirichlet) */
-
-      _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+      _svb_build_steady_cell_system(c_id, true,
+                                    eqp, eqb, eqc, fld->val,
+                                    fm, cm, mass_hodge, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
       if (cs_dbg_cw_test(eqp, cm, csys))
@@ -2603,7 +3255,10 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
       /* Assembly process
        * ================ */
 
-      _svb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+      if (matrix_free)
+        _svb_assemble_matrix_free(csys, rhs, diag, eqc);
+      else
+        _svb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
 
     } /* Main loop on cells */
 
@@ -2611,8 +3266,10 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
 
   /* Free temporary buffers and structures */
 
-  cs_cdo_system_helper_finalize_assembly(sh);
-  cs_equation_builder_reset(eqb);
+  if (!matrix_free) {
+    cs_cdo_system_helper_finalize_assembly(sh);
+    cs_equation_builder_reset(eqb);
+  }
 
   /* End of the system building */
 
@@ -2636,9 +3293,51 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
                              &rhs_norm);
 
   cs_sles_t    *sles = cs_sles_find_or_add(eqp->sles_param->field_id, nullptr);
-  cs_matrix_t  *matrix = cs_cdo_system_get_matrix(sh, 0);
+  cs_matrix_t  *matrix = nullptr;
   cs_range_set_t  *range_set = cs_cdo_system_get_range_set(sh, 0);
 
+  _svb_mf_input_t  mfi = {.eqp = eqp,
+                          .eqb = eqb,
+                          .eqc = eqc,
+                          .fld_val = fld->val,
+                          .rset = range_set,
+                          .t_eval = time_eval,
+                          .x_v = nullptr,
+                          .y_v = nullptr};
+
+  if (matrix_free) {
+
+    /* Diagonal values are summed over interfaces and gathered (in place) */
+
+    if (connect->vtx_ifs != nullptr)
+      cs_interface_set_sum(connect->vtx_ifs,
+                           quant->n_vertices,
+                           1,
+                           false,
+                           CS_REAL_TYPE,
+                           diag);
+
+    cs_range_set_gather(range_set, CS_REAL_TYPE, 1, diag, diag);
+
+    BFT_MALLOC(mfi.x_v, 2*quant->n_vertices, cs_real_t);
+    mfi.y_v = mfi.x_v + quant->n_vertices;
+
+    const bool  symmetric = (   cs_equation_param_has_convection(eqp)
+                             || eqp->default_enforcement
+                                == CS_PARAM_BC_ENFORCE_WEAK_NITSCHE)
+      ? false : true;
+
+    matrix = cs_cdo_system_helper_init_bare_matrix(sh, 0);
+    cs_matrix_set_coefficients_operator(matrix,
+                                        symmetric,
+                                        diag,
+                                        _svb_matrix_free_operator,
+                                        &mfi);
+
+  }
+  else
+    matrix = cs_cdo_system_get_matrix(sh, 0);
+
   cs_cdo_solve_scalar_system(eqc->n_dofs,
                              eqp->sles_param,
                              matrix,
@@ -2654,6 +3353,12 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
 
   cs_sles_free(sles);
   cs_cdo_system_helper_reset(sh);      /* free rhs and matrix */
+
+  if (matrix_free) {
+    BFT_FREE(diag);
+    BFT_FREE(mfi.x_v);
+    cs_equation_builder_reset(eqb);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4219,6 +4924,17 @@ cs_cdovb_scaleq_apply_stiffness(const cs_equation_param_t     *eqp,
                                                     true,   /* tensor ? */
                                                     false); /* eigen ? */
 
+  if (eqc->batched_stiffness) {
+
+    _svb_apply_stiffness_batched(eqb, eqc, pty, hodge_array,
+                                 pot, res_loc, res);
+
+    cs_timer_t  t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&(eqb->tce), &t0, &t1);
+    return;
+
+  }
+
   /* OpenMP block */
 
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)                  \
@@ -67,6 +67,58 @@ BEGIN_C_DECLS
 bool
 cs_cdovb_scaleq_is_initialized(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the batched application of the stiffness operator
+ *         for the scalar-valued CDO-Vb equations defined afterwards.
+ *
+ *         In this mode, cells with the same number of vertices (for instance
+ *         all hexahedra) are processed by batches of CS_SDM_BATCH_SIZE cells,
+ *         local matrix-vector products being vectorized across cells. Local
+ *         matrices are kept between calls when the property is uniform and
+ *         steady, which requires additional memory.
+ *
+ * \param[in]  status  true to activate the batched mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_set_batched_stiffness(bool  status);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the storage of the cellwise stiffness matrices for
+ *         the scalar-valued CDO-Vb equations defined afterwards.
+ *
+ *         Stored matrices are reused in interior cells at each build of the
+ *         system as long as the diffusion property does not change (for the
+ *         whole computation if the property is steady).
+ *
+ * \param[in]  status  true to activate the storage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_set_stiffness_cache(bool  status);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Activate or not the matrix-free solve of steady-state systems for
+ *         the scalar-valued CDO-Vb equations defined afterwards.
+ *
+ *         The global matrix is not assembled: the matrix-vector product is
+ *         computed by rebuilding and applying the cellwise systems, and only
+ *         the diagonal is stored (Jacobi preconditioning). This is only
+ *         available with Krylov solvers of the code_saturne class using no
+ *         or a diagonal preconditioner; otherwise the assembled mode is kept.
+ *
+ * \param[in]  status  true to activate the matrix-free mode
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdovb_scaleq_set_matrix_free(bool  status);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate work buffer and general structures related to CDO
@@ -432,7 +432,9 @@ _solve_mumps(int                                   n_eqs,
   cs_solving_info_t sinfo = {
     .n_it = 0, .rhs_norm = 1, .res_norm = 1e16, .derive = 0., .l2residual = 0.
   };
-  cs_real_t  eps = 1e-6;        /* useless in case of a direct solver */
+  /* Useless in case of a direct solver */
+
+  cs_real_t  eps = sysp->sles_param->cvg_param.rtol;
 
   /* Solve the system as a scalar-valued system of size n_dofs */
 
@@ -877,6 +877,14 @@ cs_cdovb_vecteq_init_context(cs_equation_param_t    *eqp,
   /* Diffusion term */
 
   eqc->get_stiffness_matrix = nullptr;
+  eqc->batched_stiffness = false;
+  eqc->n_stiffness_batches = 0;
+  eqc->stiffness_batch_cells = nullptr;
+  eqc->stiffness_batch_idx = nullptr;
+  eqc->stiffness_batch_val = nullptr;
+  eqc->stiffness_batch_pty = nullptr;
+  eqc->stiffness_cache = nullptr;
+  eqc->matrix_free = false;
 
   if (cs_equation_param_has_diffusion(eqp)) {
 
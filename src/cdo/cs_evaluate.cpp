@@ -76,6 +76,27 @@ BEGIN_C_DECLS
 
 #define CS_CL  (CS_CL_SIZE/8)
 
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Quadrature points and weights related to the cells of a volume zone.
+   Cells are split into tetrahedra (as in _pcsa_by_analytic) and each
+   tetrahedron is handled with the rule associated to qtype. */
+
+typedef struct {
+
+  int                    z_id;      /* id of the volume zone */
+  cs_quadrature_type_t   qtype;     /* type of quadrature */
+
+  cs_lnum_t              n_cells;   /* number of cells in the zone */
+  cs_lnum_t              n_pts;     /* total number of quadrature points */
+  cs_lnum_t             *idx;       /* index on points (size n_cells + 1) */
+  cs_real_t             *xyz;       /* coordinates (size 3*n_pts) */
+  cs_real_t             *w;         /* weights (size n_pts) */
+
+} _cell_quad_cache_t;
+
 /*=============================================================================
  * Local static variables
  *============================================================================*/
@@ -91,6 +112,12 @@ static const char _err_empty_array[] =
   " to this function.";
 static const char _err_not_handled[] = " %s: Case not handled yet.";
 
+/* Caches of cell quadrature points (one per zone and type of quadrature) */
+
+static bool  _use_quad_caches = false;
+static int  _n_quad_caches = 0;
+static _cell_quad_cache_t  **_quad_caches = nullptr;
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -868,6 +895,292 @@ _pcvd_by_analytic(cs_real_t                        time_eval,
   } /* Loop on cells */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the number of quadrature points in a tetrahedron according
+ *         to the type of quadrature
+ *
+ * \param[in] qtype  type of quadrature
+ *
+ * \return the number of points
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+_n_tetra_quad_pts(cs_quadrature_type_t  qtype)
+{
+  switch (qtype) {
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+    return 1;
+  case CS_QUADRATURE_HIGHER:
+    return 4;
+  case CS_QUADRATURE_HIGHEST:
+    return 5;
+  default:
+    bft_error(__FILE__, __LINE__, 0, " %s: Invalid quadrature type\n",
+              __func__);
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Add the quadrature points and weights of a tetrahedron
+ *
+ * \param[in]      qtype  type of quadrature
+ * \param[in]      v1     first vertex
+ * \param[in]      v2     second vertex
+ * \param[in]      v3     third vertex
+ * \param[in]      v4     fourth vertex
+ * \param[in]      vol    volume of the tetrahedron
+ * \param[in, out] xyz    coordinates of the points to set
+ * \param[in, out] w      weights to set
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_add_tetra_quad_pts(cs_quadrature_type_t   qtype,
+                    const cs_real_t       *v1,
+                    const cs_real_t       *v2,
+                    const cs_real_t       *v3,
+                    const cs_real_t       *v4,
+                    double                 vol,
+                    cs_real_t             *xyz,
+                    cs_real_t             *w)
+{
+  cs_real_3_t  *gpts = (cs_real_3_t *)xyz;
+
+  switch (qtype) {
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+    cs_quadrature_tet_1pt(v1, v2, v3, v4, vol, gpts, w);
+    break;
+  case CS_QUADRATURE_HIGHER:
+    {
+      double  w0;
+      cs_quadrature_tet_4pts(v1, v2, v3, v4, vol, gpts, &w0);
+      for (int p = 0; p < 4; p++)
+        w[p] = w0;
+    }
+    break;
+  case CS_QUADRATURE_HIGHEST:
+    cs_quadrature_tet_5pts(v1, v2, v3, v4, vol, gpts, w);
+    break;
+  default:
+    break; /* Already checked */
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the quadrature points of a cell (or only count them when xyz
+ *         is nullptr). Cells are split into tetrahedra as in the function
+ *         _pcsa_by_analytic
+ *
+ * \param[in]      c_id   cell id
+ * \param[in]      qtype  type of quadrature
+ * \param[in, out] xyz    coordinates of the points to set or nullptr
+ * \param[in, out] w      weights to set or nullptr
+ *
+ * \return the number of quadrature points in the cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_cell_quad_pts(cs_lnum_t              c_id,
+               cs_quadrature_type_t   qtype,
+               cs_real_t             *xyz,
+               cs_real_t             *w)
+{
+  constexpr cs_real_t c_1ov3 = 1./3.;
+
+  const cs_cdo_quantities_t  *quant = cs_cdo_quant;
+  const cs_real_t  *xv = quant->vtx_coord;
+  const cs_cdo_connect_t  *connect = cs_cdo_connect;
+  const cs_adjacency_t  *c2f = connect->c2f;
+  const cs_adjacency_t  *f2e = connect->f2e;
+  const int  n_tpts = _n_tetra_quad_pts(qtype);
+
+  cs_lnum_t  n_pts = 0;
+
+  if (connect->cell_type[c_id] == FVM_CELL_TETRA) {
+
+    if (xyz != nullptr) {
+      const cs_lnum_t  *v = connect->c2v->ids + connect->c2v->idx[c_id];
+      _add_tetra_quad_pts(qtype,
+                          xv+3*v[0], xv+3*v[1], xv+3*v[2], xv+3*v[3],
+                          quant->cell_vol[c_id], xyz, w);
+    }
+
+    return n_tpts;
+  }
+
+  const cs_real_t  *xc = quant->cell_centers + 3*c_id;
+
+  for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
+
+    const cs_lnum_t  f_id = c2f->ids[i];
+    const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
+
+    if (xyz == nullptr) {
+      n_pts += (end - start == 3) ? n_tpts : (end - start)*n_tpts;
+      continue;
+    }
+
+    const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
+    const double  hfco =
+      c_1ov3 * cs_math_3_dot_product(pfq.unitv, quant->dedge_vector+3*i);
+
+    if (end - start == 3) {
+
+      cs_lnum_t v0, v1, v2;
+      cs_connect_get_next_3_vertices(f2e->ids, connect->e2v->ids,
+                                     start, &v0, &v1, &v2);
+      _add_tetra_quad_pts(qtype, xv + 3*v0, xv + 3*v1, xv + 3*v2, xc,
+                          hfco * pfq.meas,
+                          xyz + 3*n_pts, w + n_pts);
+      n_pts += n_tpts;
+
+    }
+    else {
+
+      for (cs_lnum_t j = start; j < end; j++) {
+
+        const cs_lnum_t  _2e = 2*f2e->ids[j];
+        const cs_lnum_t  v1 = connect->e2v->ids[_2e];
+        const cs_lnum_t  v2 = connect->e2v->ids[_2e+1];
+
+        _add_tetra_quad_pts(qtype, xv + 3*v1, xv + 3*v2, pfq.center, xc,
+                            hfco*cs_math_surftri(xv+3*v1, xv+3*v2, pfq.center),
+                            xyz + 3*n_pts, w + n_pts);
+        n_pts += n_tpts;
+
+      } /* Loop on edges */
+
+    } /* Current face is triangle or not ? */
+
+  } /* Loop on faces */
+
+  return n_pts;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve (and build if needed) the cache of quadrature points
+ *         related to the cells of a volume zone
+ *
+ * \param[in] z      pointer to a volume zone
+ * \param[in] qtype  type of quadrature
+ *
+ * \return a pointer to the cache structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static const _cell_quad_cache_t *
+_get_cell_quad_cache(const cs_zone_t       *z,
+                     cs_quadrature_type_t   qtype)
+{
+  for (int i = 0; i < _n_quad_caches; i++) {
+    const _cell_quad_cache_t  *qc = _quad_caches[i];
+    if (qc->z_id == z->id && qc->qtype == qtype)
+      return qc;
+  }
+
+  const cs_lnum_t  n_cells = cs_cdo_quant->n_cells;
+  const cs_lnum_t  *elt_ids = (n_cells == z->n_elts) ? nullptr : z->elt_ids;
+
+  _cell_quad_cache_t  *qc = nullptr;
+  BFT_MALLOC(qc, 1, _cell_quad_cache_t);
+
+  qc->z_id = z->id;
+  qc->qtype = qtype;
+  qc->n_cells = z->n_elts;
+
+  BFT_MALLOC(qc->idx, qc->n_cells + 1, cs_lnum_t);
+  qc->idx[0] = 0;
+
+  for (cs_lnum_t id = 0; id < qc->n_cells; id++) {
+    const cs_lnum_t c_id = (elt_ids == nullptr) ? id : elt_ids[id];
+    qc->idx[id+1] = qc->idx[id] + _cell_quad_pts(c_id, qtype, nullptr, nullptr);
+  }
+
+  qc->n_pts = qc->idx[qc->n_cells];
+  BFT_MALLOC(qc->xyz, 3*qc->n_pts, cs_real_t);
+  BFT_MALLOC(qc->w, qc->n_pts, cs_real_t);
+
+# pragma omp parallel for if (qc->n_cells > CS_THR_MIN)
+  for (cs_lnum_t id = 0; id < qc->n_cells; id++) {
+    const cs_lnum_t c_id = (elt_ids == nullptr) ? id : elt_ids[id];
+    const cs_lnum_t  s = qc->idx[id];
+    _cell_quad_pts(c_id, qtype, qc->xyz + 3*s, qc->w + s);
+  }
+
+  BFT_REALLOC(_quad_caches, _n_quad_caches + 1, _cell_quad_cache_t *);
+  _quad_caches[_n_quad_caches] = qc;
+  _n_quad_caches += 1;
+
+  return qc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the average over primal cells of a field defined by an
+ *         analytical function using cached quadrature points. The analytic
+ *         function is called once for all the points of the zone.
+ *
+ * \param[in]      time_eval  physical time at which one evaluates the term
+ * \param[in]      dim        dimension of the function
+ * \param[in]      ana        pointer to the analytic function
+ * \param[in]      input      nullptr or pointer cast on-the-fly
+ * \param[in]      qc         pointer to a cache of quadrature points
+ * \param[in]      elt_ids    pointer to the list of selected ids or nullptr
+ * \param[in, out] values     pointer to the computed values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_pca_by_analytic_cached(cs_real_t                  time_eval,
+                        int                        dim,
+                        cs_analytic_func_t        *ana,
+                        void                      *input,
+                        const _cell_quad_cache_t  *qc,
+                        const cs_lnum_t           *elt_ids,
+                        cs_real_t                  values[])
+{
+  const cs_real_t  *cell_vol = cs_cdo_quant->cell_vol;
+
+  cs_real_t  *eval = nullptr;
+  BFT_MALLOC(eval, dim*qc->n_pts, cs_real_t);
+
+  /* Batched evaluation at all quadrature points (dense output) */
+
+  ana(time_eval, qc->n_pts, nullptr, qc->xyz, true, input, eval);
+
+# pragma omp parallel for if (qc->n_cells > CS_THR_MIN)
+  for (cs_lnum_t id = 0; id < qc->n_cells; id++) {
+
+    const cs_lnum_t c_id = (elt_ids == nullptr) ? id : elt_ids[id];
+    const double  inv_vol = 1./cell_vol[c_id];
+
+    cs_real_t  *_val = values + dim*c_id;
+
+    for (int k = 0; k < dim; k++)
+      _val[k] = 0.;
+
+    for (cs_lnum_t p = qc->idx[id]; p < qc->idx[id+1]; p++)
+      for (int k = 0; k < dim; k++)
+        _val[k] += qc->w[p] * eval[dim*p + k];
+
+    for (int k = 0; k < dim; k++)
+      _val[k] *= inv_vol;
+
+  } /* Loop on cells */
+
+  BFT_FREE(eval);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the average over primal cells of a scalar field defined
@@ -1378,6 +1691,49 @@ cs_evaluate_init_sharing(const cs_cdo_quantities_t    *quant,
   cs_shared_mesh = mesh;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or not the storage of quadrature points and weights used
+ *        to compute cell averages of analytic definitions. When activated,
+ *        points are computed once for each volume zone and type of
+ *        quadrature, and the analytic function is evaluated in one call for
+ *        all the points of a zone.
+ *
+ * \param[in] status  true to activate the storage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_evaluate_set_quadrature_cache(bool  status)
+{
+  _use_quad_caches = status;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the quadrature points and weights stored to compute cell
+ *        averages of analytic definitions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_evaluate_free_quadrature_cache(void)
+{
+  for (int i = 0; i < _n_quad_caches; i++) {
+
+    _cell_quad_cache_t  *qc = _quad_caches[i];
+
+    BFT_FREE(qc->idx);
+    BFT_FREE(qc->xyz);
+    BFT_FREE(qc->w);
+    BFT_FREE(qc);
+
+  }
+
+  BFT_FREE(_quad_caches);
+  _n_quad_caches = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute reduced quantities for an array of size equal to dim * n_x
@@ -2633,9 +2989,20 @@ cs_evaluate_average_on_cells_by_analytic(const cs_xdef_t   *def,
   const cs_zone_t  *z = cs_volume_zone_by_id(def->z_id);
   const cs_lnum_t  *elt_ids = (n_cells == z->n_elts) ? nullptr : z->elt_ids;
 
+  cs_xdef_analytic_context_t *ac = (cs_xdef_analytic_context_t *)def->context;
+
+  if (_use_quad_caches && (def->dim == 1 || def->dim == 3)) {
+
+    const _cell_quad_cache_t  *qc = _get_cell_quad_cache(z, def->qtype);
+
+    _pca_by_analytic_cached(time_eval, def->dim, ac->func, ac->input, qc,
+                            elt_ids, retval);
+    return;
+
+  }
+
   cs_quadrature_tetra_integral_t
     *qfunc = cs_quadrature_get_tetra_integral(def->dim, def->qtype);
-  cs_xdef_analytic_context_t *ac = (cs_xdef_analytic_context_t *)def->context;
 
   switch (def->dim) {
 
@@ -72,6 +72,31 @@ cs_evaluate_init_sharing(const cs_cdo_quantities_t    *quant,
                          const cs_cdo_connect_t       *connect,
                          const cs_mesh_t              *mesh);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or not the storage of quadrature points and weights used
+ *        to compute cell averages of analytic definitions. When activated,
+ *        points are computed once for each volume zone and type of
+ *        quadrature, and the analytic function is evaluated in one call for
+ *        all the points of a zone.
+ *
+ * \param[in] status  true to activate the storage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_evaluate_set_quadrature_cache(bool  status);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the quadrature points and weights stored to compute cell
+ *        averages of analytic definitions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_evaluate_free_quadrature_cache(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute reduced quantities for an array of size equal to dim * n_x
@@ -67,6 +67,8 @@ BEGIN_C_DECLS
  * Private variables
  *============================================================================*/
 
+static bool  _use_operator_cache = false;
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -1441,6 +1443,174 @@ cs_hho_builder_diffusion(const cs_cell_mesh_t      *cm,
     BFT_FREE(array);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set if the cellwise diffusion operators are cached when the
+ *         diffusion property is steady (false by default)
+ *
+ * \param[in]  use_cache    true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_set_operator_cache(bool  use_cache)
+{
+  _use_operator_cache = use_cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return true if cellwise diffusion operators should be cached
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_hho_builder_use_operator_cache(void)
+{
+  return _use_operator_cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a cs_hho_builder_cache_t structure
+ *
+ * \param[in]  c2f           pointer to the cell --> faces connectivity
+ * \param[in]  n_face_dofs   number of (scalar-valued) DoFs for a face
+ * \param[in]  n_cell_dofs   number of (scalar-valued) DoFs for a cell
+ *
+ * \return a pointer to a new allocated cs_hho_builder_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hho_builder_cache_t *
+cs_hho_builder_cache_create(const cs_adjacency_t  *c2f,
+                            int                    n_face_dofs,
+                            int                    n_cell_dofs)
+{
+  assert(c2f != nullptr);
+
+  cs_hho_builder_cache_t *cache = nullptr;
+
+  BFT_MALLOC(cache, 1, cs_hho_builder_cache_t);
+
+  const cs_lnum_t  n_cells = c2f->n_elts;
+
+  cache->n_cells = n_cells;
+  cache->n_face_dofs = n_face_dofs;
+  cache->n_cell_dofs = n_cell_dofs;
+
+  BFT_MALLOC(cache->idx, n_cells + 1, cs_lnum_t);
+  cache->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n_fc = c2f->idx[c_id+1] - c2f->idx[c_id];
+    const cs_lnum_t  n_dofs = n_fc*n_face_dofs + n_cell_dofs;
+    cache->idx[c_id+1] = cache->idx[c_id] + n_dofs*n_dofs;
+  }
+
+  BFT_MALLOC(cache->val, cache->idx[n_cells], cs_real_t);
+  BFT_MALLOC(cache->is_set, n_cells, bool);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    cache->is_set[c_id] = false;
+
+  return cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_hho_builder_cache_t structure
+ *
+ * \param[in, out] p_cache  pointer of pointer on a cs_hho_builder_cache_t
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cache_free(cs_hho_builder_cache_t  **p_cache)
+{
+  if (p_cache == nullptr)
+    return;
+
+  cs_hho_builder_cache_t  *cache = *p_cache;
+  if (cache == nullptr)
+    return;
+
+  BFT_FREE(cache->idx);
+  BFT_FREE(cache->val);
+  BFT_FREE(cache->is_set);
+
+  BFT_FREE(cache);
+
+  *p_cache = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the diffusion operator (gradient reconstruction and
+ *         stabilization) or retrieve it from a cache. The result is stored
+ *         in cb->loc as in \ref cs_hho_builder_diffusion.
+ *         If cache is null, this is equivalent to a call to
+ *         \ref cs_hho_builder_compute_grad_reco followed by a call to
+ *         \ref cs_hho_builder_diffusion
+ *
+ * \param[in]       cm         pointer to a cs_cell_mesh_t structure
+ * \param[in]       diff_pty   pointer to a cs_property_data_t structure
+ * \param[in, out]  cb         pointer to a cell builder_t structure
+ * \param[in, out]  hhob       pointer to a cs_hho_builder_t structure
+ * \param[in, out]  cache      pointer to a cs_hho_builder_cache_t or null
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cached_diffusion(const cs_cell_mesh_t      *cm,
+                                const cs_property_data_t  *diff_pty,
+                                cs_cell_builder_t         *cb,
+                                cs_hho_builder_t          *hhob,
+                                cs_hho_builder_cache_t    *cache)
+{
+  if (hhob == nullptr)
+    return;
+
+  if (cache == nullptr) {
+    cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
+    cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+    return;
+  }
+
+  const cs_lnum_t  c_id = cm->c_id;
+  assert(c_id < cache->n_cells);
+  assert(cache->n_face_dofs == hhob->face_basis[0]->size);
+  assert(cache->n_cell_dofs == hhob->cell_basis->size);
+
+  cs_real_t  *c_val = cache->val + cache->idx[c_id];
+  const size_t  n_vals = cache->idx[c_id+1] - cache->idx[c_id];
+
+  if (cache->is_set[c_id]) { /* Retrieve the stored operator */
+
+    for (int f = 0; f < cm->n_fc; f++)
+      cb->ids[f] = cache->n_face_dofs;
+    cb->ids[cm->n_fc] = cache->n_cell_dofs;
+
+    cs_sdm_block_init(cb->loc, cm->n_fc + 1, cm->n_fc + 1, cb->ids, cb->ids);
+    assert((size_t)(cb->loc->n_rows*cb->loc->n_cols) == n_vals);
+
+    memcpy(cb->loc->val, c_val, n_vals*sizeof(cs_real_t));
+
+  }
+  else { /* Build and store the operator */
+
+    cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
+    cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+
+    assert((size_t)(cb->loc->n_rows*cb->loc->n_cols) == n_vals);
+    memcpy(c_val, cb->loc->val, n_vals*sizeof(cs_real_t));
+    cache->is_set[c_id] = true;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the reduction onto the polynomial spaces (cell and faces)
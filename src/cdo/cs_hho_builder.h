@@ -72,6 +72,22 @@ typedef struct {
 
 } cs_hho_builder_t;
 
+/* Cache of the cellwise diffusion operators (consistent and stabilization
+   parts). Valid as long as the mesh and the diffusion property do not change.
+   Only the scalar-valued operator is stored (it is replicated for each
+   component in the vector-valued case) */
+typedef struct {
+
+  cs_lnum_t    n_cells;
+  int          n_face_dofs;   /* Size of a face block */
+  int          n_cell_dofs;   /* Size of the cell block */
+
+  cs_lnum_t   *idx;           /* Shift in val for each cell (n_cells + 1) */
+  cs_real_t   *val;           /* Cellwise operators (row-major storage) */
+  bool        *is_set;        /* true if the operator of a cell is stored */
+
+} cs_hho_builder_cache_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -185,6 +201,81 @@ cs_hho_builder_diffusion(const cs_cell_mesh_t      *cm,
                          cs_cell_builder_t         *cb,
                          cs_hho_builder_t          *hhob);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set if the cellwise diffusion operators are cached when the
+ *         diffusion property is steady (false by default)
+ *
+ * \param[in]  use_cache    true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_set_operator_cache(bool  use_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return true if cellwise diffusion operators should be cached
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_hho_builder_use_operator_cache(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a cs_hho_builder_cache_t structure
+ *
+ * \param[in]  c2f           pointer to the cell --> faces connectivity
+ * \param[in]  n_face_dofs   number of (scalar-valued) DoFs for a face
+ * \param[in]  n_cell_dofs   number of (scalar-valued) DoFs for a cell
+ *
+ * \return a pointer to a new allocated cs_hho_builder_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hho_builder_cache_t *
+cs_hho_builder_cache_create(const cs_adjacency_t  *c2f,
+                            int                    n_face_dofs,
+                            int                    n_cell_dofs);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_hho_builder_cache_t structure
+ *
+ * \param[in, out] p_cache  pointer of pointer on a cs_hho_builder_cache_t
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cache_free(cs_hho_builder_cache_t  **p_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute the diffusion operator (gradient reconstruction and
+ *         stabilization) or retrieve it from a cache. The result is stored
+ *         in cb->loc as in \ref cs_hho_builder_diffusion.
+ *         If cache is null, this is equivalent to a call to
+ *         \ref cs_hho_builder_compute_grad_reco followed by a call to
+ *         \ref cs_hho_builder_diffusion
+ *
+ * \param[in]       cm         pointer to a cs_cell_mesh_t structure
+ * \param[in]       diff_pty   pointer to a cs_property_data_t structure
+ * \param[in, out]  cb         pointer to a cell builder_t structure
+ * \param[in, out]  hhob       pointer to a cs_hho_builder_t structure
+ * \param[in, out]  cache      pointer to a cs_hho_builder_cache_t or null
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cached_diffusion(const cs_cell_mesh_t      *cm,
+                                const cs_property_data_t  *diff_pty,
+                                cs_cell_builder_t         *cb,
+                                cs_hho_builder_t          *hhob,
+                                cs_hho_builder_cache_t    *cache);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the reduction onto the polynomial spaces (cell and faces)
@@ -127,6 +127,9 @@ struct _cs_hho_vecteq_t {
      usage */
   cs_sdm_t                      *acf_tilda;
 
+  /* Cache of the cellwise diffusion operators (null if not used) */
+  cs_hho_builder_cache_t        *diff_cache;
+
 };
 
 /*============================================================================
@@ -920,6 +923,16 @@ cs_hho_vecteq_init_context(cs_equation_param_t    *eqp,
 
   } /* Loop on BC definitions */
 
+  /* Cache of the cellwise diffusion operators. Only relevant if the
+     diffusion property does not change in time */
+  eqc->diff_cache = nullptr;
+  if (cs_equation_param_has_diffusion(eqp) &&
+      cs_hho_builder_use_operator_cache() &&
+      cs_property_is_steady(eqp->diffusion_property))
+    eqc->diff_cache = cs_hho_builder_cache_create(connect->c2f,
+                                                  eqc->n_face_dofs/3,
+                                                  eqc->n_cell_dofs/3);
+
   return eqc;
 }
 
@@ -949,6 +962,7 @@ cs_hho_vecteq_free_context(void   *data)
   BFT_FREE(eqc->bf2def_ids);
 
   cs_sdm_free(eqc->acf_tilda);
+  cs_hho_builder_cache_free(&(eqc->diff_cache));
 
   /* Last free */
   BFT_FREE(eqc);
@@ -1228,11 +1242,10 @@ cs_hho_vecteq_build_system(const cs_mesh_t            *mesh,
 
         }
 
-        /* Define the local stiffness matrix */
-        cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
-
-        /* Local matrix owned by the cellwise builder (store in cb->loc) */
-        cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+        /* Define the local stiffness matrix. Local matrix owned by the
+           cellwise builder (store in cb->loc) */
+        cs_hho_builder_cached_diffusion(cm, diff_pty, cb, hhob,
+                                        eqc->diff_cache);
 
         /* Add the local diffusion operator to the local system */
         int n_blocks = cb->loc->block_desc->n_col_blocks;
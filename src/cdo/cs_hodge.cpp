@@ -34,6 +34,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <float.h>
+#include <string.h>
 #include <assert.h>
 
 /*----------------------------------------------------------------------------
@@ -1306,6 +1307,175 @@ cs_hodge_free_context(cs_hodge_t    ***p_hodges)
   *p_hodges = nullptr;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cs_hodge_cache_t structure. The size of each cellwise
+ *         matrix is given by the number of DoFs in the c2x connectivity
+ *         (plus one if a cell DoF is added).
+ *
+ * \param[in] c2x            cell -> DoFs connectivity
+ * \param[in] with_cell_dof  true if a DoF is attached to the cell
+ * \param[in] property       pointer to the associated property
+ *
+ * \return a pointer to the new allocated cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_create(const cs_adjacency_t    *c2x,
+                      bool                     with_cell_dof,
+                      const cs_property_t     *property)
+{
+  assert(c2x != nullptr);
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+  const int  shift = (with_cell_dof) ? 1 : 0;
+
+  cs_hodge_cache_t  *cache = nullptr;
+  BFT_MALLOC(cache, 1, cs_hodge_cache_t);
+
+  cache->property = property;
+  cache->n_cells = n_cells;
+
+  BFT_MALLOC(cache->idx, n_cells + 1, cs_lnum_t);
+  cache->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n = c2x->idx[c_id+1] - c2x->idx[c_id] + shift;
+    cache->idx[c_id+1] = cache->idx[c_id] + n*n;
+  }
+
+  BFT_MALLOC(cache->val, cache->idx[n_cells], cs_real_t);
+  BFT_MALLOC(cache->status, n_cells, char);
+  BFT_MALLOC(cache->t_eval, n_cells, cs_real_t);
+
+  cs_hodge_cache_reset(cache);
+
+  return cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_hodge_cache_t structure
+ *
+ * \param[in, out] p_cache    double pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_free(cs_hodge_cache_t    **p_cache)
+{
+  cs_hodge_cache_t  *cache = *p_cache;
+
+  if (cache == nullptr)
+    return;
+
+  BFT_FREE(cache->idx);
+  BFT_FREE(cache->val);
+  BFT_FREE(cache->status);
+  BFT_FREE(cache->t_eval);
+
+  BFT_FREE(cache);
+  *p_cache = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate all values stored in a cs_hodge_cache_t structure.
+ *         This should be called when the definition of the associated
+ *         property is modified.
+ *
+ * \param[in, out] cache    pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset(cs_hodge_cache_t    *cache)
+{
+  if (cache == nullptr)
+    return;
+
+# pragma omp parallel for if (cache->n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < cache->n_cells; c_id++)
+    cache->status[c_id] = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the cellwise matrix stored in the cache if available.
+ *         Otherwise, call the given function to compute it and store the
+ *         result. The resulting matrix is op (for instance cb->loc for a
+ *         stiffness matrix or hodge->matrix for a discrete Hodge operator).
+ *
+ *         When values are retrieved from the cache, hodge->matrix (or cb->loc)
+ *         is not updated if it is not the requested matrix.
+ *
+ * \param[in, out] cache     pointer to a cs_hodge_cache_t structure
+ * \param[in]      func      function used to compute the matrix
+ * \param[in]      cm        pointer to a cs_cell_mesh_t structure
+ * \param[in]      t_eval    time at which the property is evaluated
+ * \param[in, out] hodge     pointer to a cs_hodge_t structure
+ * \param[in, out] cb        pointer to a cs_cell_builder_t structure
+ * \param[in, out] op        matrix resulting from func
+ *
+ * \return true if something has been computed or false otherwise.
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_hodge_cache_compute(cs_hodge_cache_t        *cache,
+                       cs_hodge_compute_t      *func,
+                       const cs_cell_mesh_t    *cm,
+                       cs_real_t                t_eval,
+                       cs_hodge_t              *hodge,
+                       cs_cell_builder_t       *cb,
+                       cs_sdm_t                *op)
+{
+  assert(cache != nullptr && func != nullptr && op != nullptr);
+
+  const cs_lnum_t  c_id = cm->c_id;
+  const cs_lnum_t  size = cache->idx[c_id+1] - cache->idx[c_id];
+  const bool  steady = cs_property_is_steady(cache->property);
+
+  cs_real_t  *c_val = cache->val + cache->idx[c_id];
+
+  if (cache->status[c_id] > 0) {
+
+    if (steady || fabs(cache->t_eval[c_id] - t_eval) < DBL_MIN) {
+
+      if (cache->status[c_id] == 2)
+        return false;
+
+      const int  n = (int)sqrt((double)size);
+      assert(n*n == size);
+
+      cs_sdm_square_init(n, op);
+      memcpy(op->val, c_val, size*sizeof(cs_real_t));
+
+      return true;
+
+    }
+
+  }
+
+  /* Values have to be (re)computed */
+
+  bool  computed = func(cm, hodge, cb);
+
+  cache->t_eval[c_id] = t_eval;
+
+  if (computed) {
+
+    assert(op->n_rows*op->n_cols == size);
+    memcpy(c_val, op->val, size*sizeof(cs_real_t));
+    cache->status[c_id] = 1;
+
+  }
+  else
+    cache->status[c_id] = 2;
+
+  return computed;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve a function pointer to compute a discrete Hodge operator
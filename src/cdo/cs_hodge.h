@@ -196,6 +196,33 @@ typedef struct {
 
 } cs_hodge_t;
 
+/*!
+ * \struct cs_hodge_cache_t
+ * \brief Cellwise storage of the matrices resulting from a cs_hodge_compute_t
+ *        function (a discrete Hodge operator or a related stiffness matrix).
+ *
+ * Stored values are reused as long as the associated property does not
+ * change. If the property is steady, values are kept for the whole
+ * computation. Otherwise, values are only reused for the same time
+ * evaluation.
+ */
+
+typedef struct {
+
+  const cs_property_t  *property;  /*!< Associated property (shared) */
+
+  cs_lnum_t    n_cells;    /*!< Number of cells */
+  cs_lnum_t   *idx;        /*!< Offsets of the cellwise matrices (size:
+                                n_cells + 1) */
+  cs_real_t   *val;        /*!< Cellwise matrix values (size: idx[n_cells]) */
+
+  char        *status;     /*!< 0: not stored; 1: stored; 2: stored and
+                                nothing to compute (null property) */
+  cs_real_t   *t_eval;     /*!< Time of the property evaluation related to
+                                stored values (unsteady property only) */
+
+} cs_hodge_cache_t;
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build a discrete Hodge operator or a related operator (such as the
@@ -324,6 +351,80 @@ cs_hodge_free(cs_hodge_t    **p_hodge);
 void
 cs_hodge_free_context(cs_hodge_t    ***p_hodges);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Create a cs_hodge_cache_t structure. The size of each cellwise
+ *         matrix is given by the number of DoFs in the c2x connectivity
+ *         (plus one if a cell DoF is added).
+ *
+ * \param[in] c2x            cell -> DoFs connectivity
+ * \param[in] with_cell_dof  true if a DoF is attached to the cell
+ * \param[in] property       pointer to the associated property
+ *
+ * \return a pointer to the new allocated cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_hodge_cache_t *
+cs_hodge_cache_create(const cs_adjacency_t    *c2x,
+                      bool                     with_cell_dof,
+                      const cs_property_t     *property);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free a cs_hodge_cache_t structure
+ *
+ * \param[in, out] p_cache    double pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_free(cs_hodge_cache_t    **p_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Invalidate all values stored in a cs_hodge_cache_t structure.
+ *         This should be called when the definition of the associated
+ *         property is modified.
+ *
+ * \param[in, out] cache    pointer to a cs_hodge_cache_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_cache_reset(cs_hodge_cache_t    *cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the cellwise matrix stored in the cache if available.
+ *         Otherwise, call the given function to compute it and store the
+ *         result. The resulting matrix is op (for instance cb->loc for a
+ *         stiffness matrix or hodge->matrix for a discrete Hodge operator).
+ *
+ *         When values are retrieved from the cache, hodge->matrix (or cb->loc)
+ *         is not updated if it is not the requested matrix.
+ *
+ * \param[in, out] cache     pointer to a cs_hodge_cache_t structure
+ * \param[in]      func      function used to compute the matrix
+ * \param[in]      cm        pointer to a cs_cell_mesh_t structure
+ * \param[in]      t_eval    time at which the property is evaluated
+ * \param[in, out] hodge     pointer to a cs_hodge_t structure
+ * \param[in, out] cb        pointer to a cs_cell_builder_t structure
+ * \param[in, out] op        matrix resulting from func
+ *
+ * \return true if something has been computed or false otherwise.
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_hodge_cache_compute(cs_hodge_cache_t        *cache,
+                       cs_hodge_compute_t      *func,
+                       const cs_cell_mesh_t    *cm,
+                       cs_real_t                t_eval,
+                       cs_hodge_t              *hodge,
+                       cs_cell_builder_t       *cb,
+                       cs_sdm_t                *op);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve a function pointer to compute a discrete Hodge operator
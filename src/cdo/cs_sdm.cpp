@@ -51,9 +51,6 @@
 
 #include "cs_sdm.h"
 
-/*----------------------------------------------------------------------------*/
-BEGIN_C_DECLS
-
 /*============================================================================
  * Static definitions
  *============================================================================*/
@@ -115,10 +112,133 @@ _create_sdm(cs_flag_t   flag,
   return mat;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Dense matrix-vector product for a square matrix of size known at
+ *          compile time. Loops are fully unrolled by the compiler.
+ *
+ * \param[in]      m      values of the local matrix (row-major, size n*n)
+ * \param[in]      x      local vector to use
+ * \param[in, out] mv     result of the operation
+ */
+/*----------------------------------------------------------------------------*/
+
+template <int n>
+static inline void
+_square_matvec_fixed(const cs_real_t  *m,
+                     const cs_real_t  *x,
+                     cs_real_t        *mv)
+{
+  for (int i = 0; i < n; i++) {
+    const cs_real_t *m_i = m + i*n;
+    cs_real_t  s = 0.;
+    for (int j = 0; j < n; j++)
+      s += m_i[j] * x[j];
+    mv[i] = s;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  LDL^T factorization of a SPD matrix of size known at compile time.
+ *         Same storage of facto as in \ref cs_sdm_ldlt_compute
+ *
+ * \param[in]      a        values of the local matrix (row-major, size n*n)
+ * \param[in, out] facto    coefficients of the decomposition
+ * \param[in, out] dkk      store temporary the diagonal (size = n)
+ */
+/*----------------------------------------------------------------------------*/
+
+template <int n>
+static inline void
+_ldlt_compute_fixed(const cs_real_t  *a,
+                    cs_real_t        *facto,
+                    cs_real_t        *dkk)
+{
+  int  rowj_idx = 0;
+
+  for (int j = 0; j < n; j++) {
+
+    rowj_idx += j;
+
+    /* d_jj = a_jj - \sum_{k=0}^{j-1} l_jk^2 * d_kk */
+
+    const cs_real_t  *l_j = facto + rowj_idx;
+
+    cs_real_t  sum = 0.;
+    for (int k = 0; k < j; k++)
+      sum += l_j[k]*l_j[k] * dkk[k];
+    const cs_real_t  djj = dkk[j] = a[j*n+j] - sum;
+
+    if (fabs(djj) < cs_math_zero_threshold)
+      bft_error(__FILE__, __LINE__, 0, _msg_small_p, "cs_sdm_ldlt_compute");
+
+    const cs_real_t  inv_djj = facto[rowj_idx + j] = 1. / djj;
+
+    /* l_ij = (a_ij - \sum_{k=0}^{j-1} l_ik * d_kk * l_jk ) / d_jj */
+
+    int  rowi_idx = rowj_idx;
+    const cs_real_t  *a_j = a + j*n;  /* a_ij = a_ji */
+    for (int i = j+1; i < n; i++) {
+
+      rowi_idx += i;
+      cs_real_t  *l_i = facto + rowi_idx;
+      sum = 0.;
+      for (int k = 0; k < j; k++)
+        sum += l_i[k] * dkk[k] * l_j[k];
+      l_i[j] = (a_j[i] - sum) * inv_djj;
+
+    }
+
+  } /* Loop on column j */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve a SPD system of size known at compile time using its L.D.L^T
+ *         factorization (same storage as in \ref cs_sdm_ldlt_compute)
+ *
+ * \param[in]      facto    coefficients of the decomposition
+ * \param[in]      rhs      right-hand side
+ * \param[in, out] sol      solution
+ */
+/*----------------------------------------------------------------------------*/
+
+template <int n>
+static inline void
+_ldlt_solve_fixed(const cs_real_t  *facto,
+                  const cs_real_t  *rhs,
+                  cs_real_t        *sol)
+{
+  /* Forward substitution: z_i = b_i - \sum_{k=0}^{i-1} l_ik * z_k */
+
+  int  rowi_idx = 0;
+  sol[0] = rhs[0];
+  for (int i = 1; i < n; i++) {
+    rowi_idx += i;
+    const cs_real_t  *l_i = facto + rowi_idx;
+    cs_real_t  sum = 0.;
+    for (int k = 0; k < i; k++)
+      sum += sol[k] * l_i[k];
+    sol[i] = rhs[i] - sum;
+  }
+
+  /* Backward substitution: x_i = z_i/d_ii - \sum_{k=i+1}^{n} l_ki * x_k */
+
+  for (int i = n - 1; i >= 0; i--) {
+    cs_real_t  s = sol[i] * facto[i*(i+1)/2 + i];
+    for (int k = i + 1; k < n; k++)
+      s -= facto[k*(k+1)/2 + i] * sol[k];
+    sol[i] = s;
+  }
+}
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+BEGIN_C_DECLS
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Allocate and initialize a cs_sdm_t structure
@@ -347,6 +467,106 @@ cs_sdm_free(cs_sdm_t  *mat)
   return nullptr;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate and initialize a cs_sdm_batch_t structure
+ *
+ * \param[in] n_max_rows  max. number of rows (and columns) of each matrix
+ *
+ * \return a new allocated cs_sdm_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_batch_t *
+cs_sdm_batch_create(int  n_max_rows)
+{
+  cs_sdm_batch_t *b = nullptr;
+
+  BFT_MALLOC(b, 1, cs_sdm_batch_t);
+
+  b->flag = 0;
+  b->n_max_rows = n_max_rows;
+  b->n_rows = n_max_rows;
+
+  const int  size = n_max_rows*n_max_rows*CS_SDM_BATCH_SIZE;
+
+  BFT_MALLOC(b->val, size, cs_real_t);
+  memset(b->val, 0, size*sizeof(cs_real_t));
+
+  return b;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a cs_sdm_batch_t structure
+ *
+ * \param[in] b  pointer to a cs_sdm_batch_t struct. to free
+ *
+ * \return a null pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_batch_t *
+cs_sdm_batch_free(cs_sdm_batch_t  *b)
+{
+  if (b == nullptr)
+    return b;
+
+  if ((b->flag & CS_SDM_SHARED_VAL) == 0)
+    BFT_FREE(b->val);
+
+  BFT_FREE(b);
+
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize a cs_sdm_batch_t structure: set the number of rows and
+ *        reset all values (in all lanes) to zero
+ *
+ * \param[in]      n_rows  number of rows (and columns) of each matrix
+ * \param[in, out] b       pointer to the cs_sdm_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_batch_init(int               n_rows,
+                  cs_sdm_batch_t   *b)
+{
+  assert(b != nullptr);
+  assert(n_rows <= b->n_max_rows);
+
+  b->n_rows = n_rows;
+  memset(b->val, 0, n_rows*n_rows*CS_SDM_BATCH_SIZE*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy a square matrix into a lane of a batch
+ *
+ * \param[in]      m     pointer to the cs_sdm_t structure to copy
+ * \param[in]      lane  id of the lane to set (< CS_SDM_BATCH_SIZE)
+ * \param[in, out] b     pointer to the cs_sdm_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_batch_set_lane(const cs_sdm_t   *m,
+                      int               lane,
+                      cs_sdm_batch_t   *b)
+{
+  assert(m != nullptr && b != nullptr);
+  assert(m->n_rows == b->n_rows && m->n_cols == b->n_rows);
+  assert(lane >= 0 && lane < CS_SDM_BATCH_SIZE);
+
+  const int  n = b->n_rows*b->n_rows;
+
+  cs_real_t  *_val = b->val + lane;
+  for (int k = 0; k < n; k++)
+    _val[k*CS_SDM_BATCH_SIZE] = m->val[k];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Initialize the pattern of cs_sdm_t structure defined by block
@@ -829,6 +1049,26 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
 
   const int  n = mat->n_rows;
 
+  /* Fixed-size variants for the most common cell types (number of vertices
+     or faces of a tetrahedron, a prism or a hexahedron) */
+
+  switch (n) {
+  case 4:
+    _square_matvec_fixed<4>(mat->val, vec, mv);
+    return;
+  case 5:
+    _square_matvec_fixed<5>(mat->val, vec, mv);
+    return;
+  case 6:
+    _square_matvec_fixed<6>(mat->val, vec, mv);
+    return;
+  case 8:
+    _square_matvec_fixed<8>(mat->val, vec, mv);
+    return;
+  default:
+    break;
+  }
+
   /* Initialize mv */
 
   const cs_real_t  v = vec[0];
@@ -844,6 +1084,51 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute a dense matrix-vector product for each lane of a batch of
+ *          small square matrices. Vectors are interleaved:
+ *          vec[j*CS_SDM_BATCH_SIZE + l] is the j-th entry for lane l.
+ *          mv has been previously allocated
+ *
+ * \param[in]      b      batch of local matrices to use
+ * \param[in]      vec    interleaved local vectors to use
+ * \param[in, out] mv     interleaved result of the matrix-vector products
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_batch_square_matvec(const cs_sdm_batch_t   *b,
+                           const cs_real_t        *vec,
+                           cs_real_t              *mv)
+{
+  assert(b != nullptr && vec != nullptr && mv != nullptr);
+
+  const int  n = b->n_rows;
+
+  for (int i = 0; i < n; i++) {
+
+    cs_real_t  *mv_i = mv + i*CS_SDM_BATCH_SIZE;
+    const cs_real_t  *m_i = b->val + i*n*CS_SDM_BATCH_SIZE;
+
+#   pragma omp simd
+    for (int l = 0; l < CS_SDM_BATCH_SIZE; l++)
+      mv_i[l] = m_i[l] * vec[l];
+
+    for (int j = 1; j < n; j++) {
+
+      const cs_real_t  *m_ij = m_i + j*CS_SDM_BATCH_SIZE;
+      const cs_real_t  *v_j = vec + j*CS_SDM_BATCH_SIZE;
+
+#     pragma omp simd
+      for (int l = 0; l < CS_SDM_BATCH_SIZE; l++)
+        mv_i[l] += m_ij[l] * v_j[l];
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute a dense matrix-vector product for a rectangular matrix
@@ -1822,9 +2107,24 @@ cs_sdm_ldlt_compute(const cs_sdm_t     *m,
 
   const short int n = m->n_cols;
 
-  if (n == 1) {
+  switch (n) {
+  case 1:
     facto[0] = 1. / m->val[0];
     return;
+  case 4:
+    _ldlt_compute_fixed<4>(m->val, facto, dkk);
+    return;
+  case 5:
+    _ldlt_compute_fixed<5>(m->val, facto, dkk);
+    return;
+  case 6:
+    _ldlt_compute_fixed<6>(m->val, facto, dkk);
+    return;
+  case 8:
+    _ldlt_compute_fixed<8>(m->val, facto, dkk);
+    return;
+  default:
+    break;
   }
 
   int  rowj_idx = 0;
@@ -2036,9 +2336,24 @@ cs_sdm_ldlt_solve(int                n_rows,
 {
   assert(facto != nullptr && rhs != nullptr && sol != nullptr);
 
-  if (n_rows == 1) {
+  switch (n_rows) {
+  case 1:
     sol[0] = rhs[0] * facto[0];
     return;
+  case 4:
+    _ldlt_solve_fixed<4>(facto, rhs, sol);
+    return;
+  case 5:
+    _ldlt_solve_fixed<5>(facto, rhs, sol);
+    return;
+  case 6:
+    _ldlt_solve_fixed<6>(facto, rhs, sol);
+    return;
+  case 8:
+    _ldlt_solve_fixed<8>(facto, rhs, sol);
+    return;
+  default:
+    break;
   }
 
   /* 1 - Solving Lz = b with forward substitution :
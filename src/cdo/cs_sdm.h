@@ -50,6 +50,8 @@ BEGIN_C_DECLS
 #define CS_SDM_SYMMETRIC   (1 << 1) /* Matrix is symmetric by construction */
 #define CS_SDM_SHARED_VAL  (1 << 2) /* Matrix is not owner of its values */
 
+#define CS_SDM_BATCH_SIZE  8        /* Number of lanes in a batch of SDMs */
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -92,6 +94,24 @@ struct _cs_sdm_t {
 
 };
 
+/* Batch of CS_SDM_BATCH_SIZE small dense square matrices with the same number
+   of rows. Values are interleaved: entry (i,j) of the matrix in lane l is
+   stored in val[(i*n_rows + j)*CS_SDM_BATCH_SIZE + l], so that an operation
+   is applied to all the lanes at once (SIMD across matrices).
+   Vectors related to a batch use the same interleaved layout. */
+
+typedef struct {
+
+  cs_flag_t   flag;        /* Metadata */
+
+  int         n_max_rows;  // max number of rows (and columns)
+  int         n_rows;      // current number of rows (and columns)
+
+  cs_real_t  *val;         // interleaved values
+                           // (size: n_max_rows*n_max_rows*CS_SDM_BATCH_SIZE)
+
+} cs_sdm_batch_t;
+
 /*============================================================================
  * Prototypes for pointer of functions
  *============================================================================*/
@@ -357,6 +377,86 @@ cs_sdm_map_array(int         n_max_rows,
   m->block_desc = NULL;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Map an array into a predefined cs_sdm_batch_t structure. This array
+ *        is shared and the lifecycle of this array is not managed by the
+ *        cs_sdm_batch_t structure
+ *
+ * \param[in]      n_rows  number of rows (and columns) of each matrix
+ * \param[in, out] b       pointer to a cs_sdm_batch_t structure to set
+ * \param[in, out] array   pointer to an array of values of size equal to
+ *                         n_rows x n_rows x CS_SDM_BATCH_SIZE
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_sdm_batch_map_array(int               n_rows,
+                       cs_sdm_batch_t   *b,
+                       cs_real_t        *array)
+{
+  assert(array != NULL && b != NULL);  /* Sanity check */
+
+  b->flag = CS_SDM_SHARED_VAL;
+  b->n_rows = b->n_max_rows = n_rows;
+  b->val = array;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate and initialize a cs_sdm_batch_t structure
+ *
+ * \param[in] n_max_rows  max. number of rows (and columns) of each matrix
+ *
+ * \return a new allocated cs_sdm_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_batch_t *
+cs_sdm_batch_create(int  n_max_rows);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a cs_sdm_batch_t structure
+ *
+ * \param[in] b  pointer to a cs_sdm_batch_t struct. to free
+ *
+ * \return a NULL pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_batch_t *
+cs_sdm_batch_free(cs_sdm_batch_t  *b);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize a cs_sdm_batch_t structure: set the number of rows and
+ *        reset all values (in all lanes) to zero
+ *
+ * \param[in]      n_rows  number of rows (and columns) of each matrix
+ * \param[in, out] b       pointer to the cs_sdm_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_batch_init(int               n_rows,
+                  cs_sdm_batch_t   *b);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy a square matrix into a lane of a batch
+ *
+ * \param[in]      m     pointer to the cs_sdm_t structure to copy
+ * \param[in]      lane  id of the lane to set (< CS_SDM_BATCH_SIZE)
+ * \param[in, out] b     pointer to the cs_sdm_batch_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_batch_set_lane(const cs_sdm_t   *m,
+                      int               lane,
+                      cs_sdm_batch_t   *b);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free a cs_sdm_t structure
@@ -797,6 +897,24 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
                      const cs_real_t   *vec,
                      cs_real_t         *mv);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute a dense matrix-vector product for each lane of a batch of
+ *          small square matrices. Vectors are interleaved:
+ *          vec[j*CS_SDM_BATCH_SIZE + l] is the j-th entry for lane l.
+ *          mv has been previously allocated
+ *
+ * \param[in]      b      batch of local matrices to use
+ * \param[in]      vec    interleaved local vectors to use
+ * \param[in, out] mv     interleaved result of the matrix-vector products
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_batch_square_matvec(const cs_sdm_batch_t   *b,
+                           const cs_real_t        *vec,
+                           cs_real_t              *mv);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute a dense matrix-vector product for a rectangular matrix
@@ -44,6 +44,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_base_accel.h"
+#include "cs_dispatch.h"
 #include "cs_field.h"
 #include "cs_field_default.h"
 #include "cs_field_pointer.h"
@@ -64,6 +66,292 @@
 
 /*----------------------------------------------------------------------------*/
 
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Constant gamma (perfect or stiffened gas) equation of state.
+ *
+ * The stiffened gas pressure only appears when the template parameter is
+ * true, so that perfect gas kernels are specialized at compile time.
+ *----------------------------------------------------------------------------*/
+
+template <bool stiffened>
+struct _const_gamma_eos_t {
+
+  cs_real_t  gamma;   /* ratio of specific heats */
+  cs_real_t  cv;      /* isochoric specific heat */
+  cs_real_t  psginf;  /* stiffened gas pressure */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  pinf(void) const
+  {
+    return (stiffened) ? psginf : 0.;
+  }
+
+  /* Temperature from density and pressure */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  t_from_dp(cs_real_t  rho,
+            cs_real_t  pres) const
+  {
+    return (pres + pinf()) / ((gamma-1.)*rho*cv);
+  }
+
+  /* Internal energy from density and pressure */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  e_from_dp(cs_real_t  rho,
+            cs_real_t  pres) const
+  {
+    return (pres + gamma*pinf()) / ((gamma-1.)*rho);
+  }
+
+  /* Density from pressure and temperature */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  d_from_pt(cs_real_t  pres,
+            cs_real_t  temp) const
+  {
+    return (pres + pinf()) / ((gamma-1.)*temp*cv);
+  }
+
+  /* Density from pressure and internal energy */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  d_from_pe(cs_real_t  pres,
+            cs_real_t  enint) const
+  {
+    return (pres + gamma*pinf()) / ((gamma-1.)*enint);
+  }
+
+  /* Pressure from density and temperature */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  p_from_dt(cs_real_t  rho,
+            cs_real_t  temp) const
+  {
+    return (gamma-1.)*cv*rho*temp - pinf();
+  }
+
+  /* Pressure from density and internal energy */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  p_from_de(cs_real_t  rho,
+            cs_real_t  enint) const
+  {
+    return (gamma-1.)*rho*enint - gamma*pinf();
+  }
+
+  /* Square of sound velocity from pressure and density */
+
+  CS_F_HOST_DEVICE inline cs_real_t
+  c_square(cs_real_t  pres,
+           cs_real_t  rho) const
+  {
+    return gamma * (pres + pinf()) / rho;
+  }
+
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Initialize a dispatch context for constant gamma kernels.
+ *
+ * Computations are run on the device only when all arrays are accessible
+ * from the device.
+ *
+ * parameters:
+ *   ptrs <-- arrays used by the kernel
+ *----------------------------------------------------------------------------*/
+
+static cs_dispatch_context
+_const_gamma_context(std::initializer_list<const void *>  ptrs)
+{
+  cs_dispatch_context ctx;
+
+  for (const void *p : ptrs) {
+    if (cs_check_device_ptr(p) == CS_ALLOC_HOST)
+      ctx.set_use_gpu(false);
+  }
+
+  return ctx;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute temperature and total energy from density and pressure
+ * for a constant gamma equation of state.
+ *----------------------------------------------------------------------------*/
+
+template <bool stiffened>
+static void
+_const_gamma_te_from_dp(const _const_gamma_eos_t<stiffened>   eos,
+                        const cs_real_t                      *pres,
+                        const cs_real_t                      *rho,
+                        cs_real_t                            *temp,
+                        cs_real_t                            *ener,
+                        const cs_real_3_t                    *vel,
+                        cs_lnum_t                             n_elts)
+{
+  cs_dispatch_context ctx
+    = _const_gamma_context({pres, rho, temp, ener, vel});
+
+  ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    cs_real_t v2 = cs_math_3_square_norm(vel[i]);
+    temp[i] = eos.t_from_dp(rho[i], pres[i]);
+    ener[i] = eos.e_from_dp(rho[i], pres[i]) + 0.5*v2;
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------
+ * Compute density and total energy from pressure and temperature
+ * for a constant gamma equation of state.
+ *----------------------------------------------------------------------------*/
+
+template <bool stiffened>
+static void
+_const_gamma_de_from_pt(const _const_gamma_eos_t<stiffened>   eos,
+                        const cs_real_t                      *pres,
+                        const cs_real_t                      *temp,
+                        cs_real_t                            *rho,
+                        cs_real_t                            *ener,
+                        const cs_real_3_t                    *vel,
+                        cs_lnum_t                             n_elts)
+{
+  cs_dispatch_context ctx
+    = _const_gamma_context({pres, temp, rho, ener, vel});
+
+  ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    cs_real_t v2 = cs_math_3_square_norm(vel[i]);
+    cs_real_t rho_i = eos.d_from_pt(pres[i], temp[i]);
+    rho[i] = rho_i;
+    ener[i] = eos.e_from_dp(rho_i, pres[i]) + 0.5*v2;
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------
+ * Compute density and temperature from pressure and total energy
+ * for a constant gamma equation of state.
+ *----------------------------------------------------------------------------*/
+
+template <bool stiffened>
+static void
+_const_gamma_dt_from_pe(const _const_gamma_eos_t<stiffened>   eos,
+                        const cs_real_t                      *pres,
+                        const cs_real_t                      *ener,
+                        cs_real_t                            *rho,
+                        cs_real_t                            *temp,
+                        const cs_real_3_t                    *vel,
+                        cs_lnum_t                             n_elts)
+{
+  cs_dispatch_context ctx
+    = _const_gamma_context({pres, ener, rho, temp, vel});
+
+  ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    /* Internal energy (to avoid the need to divide by the temperature
+       to compute density) */
+    cs_real_t enint = ener[i] - 0.5*cs_math_3_square_norm(vel[i]);
+    cs_real_t rho_i = eos.d_from_pe(pres[i], enint);
+    rho[i] = rho_i;
+    temp[i] = eos.t_from_dp(rho_i, pres[i]);
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------
+ * Compute pressure and total energy from density and temperature
+ * for a constant gamma equation of state.
+ *----------------------------------------------------------------------------*/
+
+template <bool stiffened>
+static void
+_const_gamma_pe_from_dt(const _const_gamma_eos_t<stiffened>   eos,
+                        const cs_real_t                      *rho,
+                        const cs_real_t                      *temp,
+                        cs_real_t                            *pres,
+                        cs_real_t                            *ener,
+                        const cs_real_3_t                    *vel,
+                        cs_lnum_t                             n_elts)
+{
+  cs_dispatch_context ctx
+    = _const_gamma_context({rho, temp, pres, ener, vel});
+
+  ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    cs_real_t v2 = cs_math_3_square_norm(vel[i]);
+    cs_real_t p_i = eos.p_from_dt(rho[i], temp[i]);
+    pres[i] = p_i;
+    ener[i] = eos.e_from_dp(rho[i], p_i) + 0.5*v2;
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------
+ * Compute pressure and temperature from density and total energy
+ * for a constant gamma equation of state.
+ *----------------------------------------------------------------------------*/
+
+template <bool stiffened>
+static void
+_const_gamma_pt_from_de(const _const_gamma_eos_t<stiffened>   eos,
+                        const cs_real_t                      *rho,
+                        const cs_real_t                      *ener,
+                        cs_real_t                            *pres,
+                        cs_real_t                            *temp,
+                        const cs_real_3_t                    *vel,
+                        cs_lnum_t                             n_elts)
+{
+  cs_dispatch_context ctx
+    = _const_gamma_context({rho, ener, pres, temp, vel});
+
+  ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    /* Internal energy (to avoid the need to divide by the temperature
+       to compute density) */
+    cs_real_t enint = ener[i] - 0.5*cs_math_3_square_norm(vel[i]);
+    cs_real_t p_i = eos.p_from_de(rho[i], enint);
+    pres[i] = p_i;
+    temp[i] = eos.t_from_dp(rho[i], p_i);
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------
+ * Compute square of sound velocity for a constant gamma equation of state.
+ *----------------------------------------------------------------------------*/
+
+template <bool stiffened>
+static void
+_const_gamma_c_square(const _const_gamma_eos_t<stiffened>   eos,
+                      const cs_real_t                      *pres,
+                      const cs_real_t                      *rho,
+                      cs_real_t                            *c2,
+                      cs_lnum_t                             n_elts)
+{
+  cs_dispatch_context ctx = _const_gamma_context({pres, rho, c2});
+
+  ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    c2[i] = eos.c_square(pres[i], rho[i]);
+  });
+
+  ctx.wait();
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*----------------------------------------------------------------------------*/
+
 BEGIN_C_DECLS
 
 /*=============================================================================
@@ -361,12 +649,13 @@ cs_cf_thermo_te_from_dp(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
-    for (cs_lnum_t i = 0; i < n_elts; i++) {
-      /*  temperature */
-      temp[i] = (pres[i]+psginf) / ((gamma0-1.)*rho[i]*cv0);
-      /*  total energy */
-      cs_real_t v2 = cs_math_3_square_norm(vel[i]);
-      ener[i] = (pres[i]+gamma0*psginf) / ((gamma0-1.)*rho[i]) + 0.5*v2;
+    if (psginf != 0) {
+      _const_gamma_eos_t<true> eos = {gamma0, cv0, psginf};
+      _const_gamma_te_from_dp(eos, pres, rho, temp, ener, vel, n_elts);
+    }
+    else {
+      _const_gamma_eos_t<false> eos = {gamma0, cv0, psginf};
+      _const_gamma_te_from_dp(eos, pres, rho, temp, ener, vel, n_elts);
     }
   }
   /* ideal gas mixture */
@@ -429,12 +718,13 @@ cs_cf_thermo_de_from_pt(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
-    for (cs_lnum_t i = 0; i < n_elts; i++) {
-      /*  Density */
-      rho[i] = (pres[i]+psginf) / ((gamma0-1.)*temp[i]*cv0);
-      /*  Total energy */
-      cs_real_t v2 = cs_math_3_square_norm(vel[i]);
-      ener[i] = (pres[i]+gamma0*psginf) / ((gamma0-1.)*rho[i]) + 0.5*v2;
+    if (psginf != 0) {
+      _const_gamma_eos_t<true> eos = {gamma0, cv0, psginf};
+      _const_gamma_de_from_pt(eos, pres, temp, rho, ener, vel, n_elts);
+    }
+    else {
+      _const_gamma_eos_t<false> eos = {gamma0, cv0, psginf};
+      _const_gamma_de_from_pt(eos, pres, temp, rho, ener, vel, n_elts);
     }
   }
   /* ideal gas mixture */
@@ -498,16 +788,13 @@ cs_cf_thermo_dt_from_pe(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
-    for (cs_lnum_t i = 0; i < n_elts; i++) {
-      /*  Internal energy (to avoid the need to divide by the temperature
-          to compute density) */
-      cs_real_t v2 = cs_math_3_square_norm(vel[i]);
-      enint =  ener[i] - 0.5*v2;
-
-      /*  Density */
-      rho[i] = (pres[i]+gamma0*psginf) / ((gamma0-1.)*enint);
-      /*  Temperature */
-      temp[i] = (pres[i]+psginf) / ((gamma0-1.)*rho[i]*cv0);
+    if (psginf != 0) {
+      _const_gamma_eos_t<true> eos = {gamma0, cv0, psginf};
+      _const_gamma_dt_from_pe(eos, pres, ener, rho, temp, vel, n_elts);
+    }
+    else {
+      _const_gamma_eos_t<false> eos = {gamma0, cv0, psginf};
+      _const_gamma_dt_from_pe(eos, pres, ener, rho, temp, vel, n_elts);
     }
   }
   /* ideal gas mixture */
@@ -573,12 +860,13 @@ cs_cf_thermo_pe_from_dt(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
-    for (cs_lnum_t i = 0; i < n_elts; i++) {
-      /*  Pressure */
-      pres[i] = (gamma0-1.)*cv0*rho[i]*temp[i] - psginf;
-      /*  Total energy */
-      cs_real_t v2 = cs_math_3_square_norm(vel[i]);
-      ener[i] = (pres[i]+gamma0*psginf) / ((gamma0-1.)*rho[i]) + 0.5*v2;
+    if (psginf != 0) {
+      _const_gamma_eos_t<true> eos = {gamma0, cv0, psginf};
+      _const_gamma_pe_from_dt(eos, rho, temp, pres, ener, vel, n_elts);
+    }
+    else {
+      _const_gamma_eos_t<false> eos = {gamma0, cv0, psginf};
+      _const_gamma_pe_from_dt(eos, rho, temp, pres, ener, vel, n_elts);
     }
   }
   /* ideal gas mixture */
@@ -646,16 +934,13 @@ cs_cf_thermo_pt_from_de(cs_real_t   *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
-    for (cs_lnum_t i = 0; i < n_elts; i++) {
-      /*  Internal energy (to avoid the need to divide by the temperature
-          to compute density) */
-      cs_real_t v2 = cs_math_3_square_norm(vel[i]);
-      enint =  ener[i] - 0.5*v2;
-
-      /*  Pressure */
-      pres[i] = (gamma0-1.)*rho[i]*enint - gamma0*psginf;
-      /*  Temperature */
-      temp[i] = (pres[i]+psginf) / ((gamma0-1.)*rho[i]*cv0);
+    if (psginf != 0) {
+      _const_gamma_eos_t<true> eos = {gamma0, cv0, psginf};
+      _const_gamma_pt_from_de(eos, rho, ener, pres, temp, vel, n_elts);
+    }
+    else {
+      _const_gamma_eos_t<false> eos = {gamma0, cv0, psginf};
+      _const_gamma_pt_from_de(eos, rho, ener, pres, temp, vel, n_elts);
     }
   }
   /* ideal gas mixture */
@@ -746,8 +1031,14 @@ cs_cf_thermo_c_square(cs_real_t *cp,
 
     cs_cf_thermo_gamma(&cp0, &cv0, &gamma0, l_size0);
 
-    for (cs_lnum_t i = 0; i < n_elts; i++)
-      c2[i] = gamma0 * (pres[i]+psginf) / rho[i];
+    if (psginf != 0) {
+      _const_gamma_eos_t<true> eos = {gamma0, cv0, psginf};
+      _const_gamma_c_square(eos, pres, rho, c2, n_elts);
+    }
+    else {
+      _const_gamma_eos_t<false> eos = {gamma0, cv0, psginf};
+      _const_gamma_c_square(eos, pres, rho, c2, n_elts);
+    }
   }
   /* ideal gas mixture */
   else if (ieos == CS_EOS_GAS_MIX) {
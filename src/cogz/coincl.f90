@@ -123,13 +123,13 @@ module coincl
   !========================================================================
 
   !> Library for thermochemical properties in SLFM
-  double precision, allocatable, dimension(:,:,:,:,:) :: flamelet_library
+  double precision, pointer, dimension(:,:,:,:,:) :: flamelet_library => null()
 
   !========================================================================
   ! Rayonnement
 
   !> Library for radiative properties in SLFM
-  double precision, allocatable, dimension(:,:,:,:,:,:) :: radiation_library
+  double precision, pointer, dimension(:,:,:,:,:,:) :: radiation_library => null()
 
   !========================================================================
 
@@ -353,6 +353,93 @@ module coincl
 
     !---------------------------------------------------------------------------
 
+    ! Interface to C function creating a (node-shared) flamelet library table
+
+    function cs_f_steady_laminar_flamelet_table_create(t_id, rec_size,     &
+                                                       nxr, nki,           &
+                                                       nzvar, nzm)         &
+      result(p_table)                                                      &
+      bind(C, name='cs_f_steady_laminar_flamelet_table_create')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: t_id, rec_size, nxr, nki, nzvar, nzm
+      type(c_ptr) :: p_table
+    end function cs_f_steady_laminar_flamelet_table_create
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function defining flamelet library variable ids
+
+    subroutine cs_f_steady_laminar_flamelet_table_set_var_ids              &
+      (i_zm, i_zvar, i_ki, i_xr, i_c, i_omg_c, i_rho)                     &
+      bind(C, name='cs_f_steady_laminar_flamelet_table_set_var_ids')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: i_zm, i_zvar, i_ki, i_xr, i_c, i_omg_c, i_rho
+    end subroutine cs_f_steady_laminar_flamelet_table_set_var_ids
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function indicating if the local rank fills tables
+
+    function cs_f_steady_laminar_flamelet_table_is_writer()                &
+      result(is_writer)                                                    &
+      bind(C, name='cs_f_steady_laminar_flamelet_table_is_writer')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int) :: is_writer
+    end function cs_f_steady_laminar_flamelet_table_is_writer
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function synchronizing tables once filled
+
+    subroutine cs_f_steady_laminar_flamelet_table_sync()                   &
+      bind(C, name='cs_f_steady_laminar_flamelet_table_sync')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_f_steady_laminar_flamelet_table_sync
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function interpolating flamelet and radiation libraries
+
+    subroutine cs_f_steady_laminar_flamelet_table_interpolate              &
+      (progvar, zm, zvar, x, xr, update_rad, phim, rad)                    &
+      bind(C, name='cs_f_steady_laminar_flamelet_table_interpolate')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: progvar, update_rad
+      real(c_double), value :: zm, zvar, x, xr
+      real(c_double), dimension(*), intent(out) :: phim, rad
+    end subroutine cs_f_steady_laminar_flamelet_table_interpolate
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function interpolating density in flamelet library
+
+    function cs_f_steady_laminar_flamelet_table_density                    &
+      (progvar, zm, zvar, x, xr) result(rho)                               &
+      bind(C, name='cs_f_steady_laminar_flamelet_table_density')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value :: progvar
+      real(c_double), value :: zm, zvar, x, xr
+      real(c_double) :: rho
+    end function cs_f_steady_laminar_flamelet_table_density
+
+    !---------------------------------------------------------------------------
+
+    ! Interface to C function freeing flamelet and radiation libraries
+
+    subroutine cs_f_steady_laminar_flamelet_table_finalize()               &
+      bind(C, name='cs_f_steady_laminar_flamelet_table_finalize')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine cs_f_steady_laminar_flamelet_table_finalize
+
+    !---------------------------------------------------------------------------
+
     !> (DOXYGEN_SHOULD_SKIP_THIS) \endcond
 
     !---------------------------------------------------------------------------
@@ -446,15 +533,27 @@ contains
     use radiat
     implicit none
 
-    if(.not.allocated(flamelet_library)) then
-      allocate(flamelet_library(nlibvar, nxr, nki, nzvar, nzm))
-      flamelet_library = 0.d0
+    type(c_ptr) :: c_p
+
+    ! Tables are shared by ranks of a same compute node when possible
+    ! (and initialized to zero), so only ranks for which
+    ! cs_f_steady_laminar_flamelet_table_is_writer() returns 1 fill them.
+
+    if (.not.associated(flamelet_library)) then
+      call cs_f_steady_laminar_flamelet_table_set_var_ids                     &
+        (FLAMELET_ZM, FLAMELET_ZVAR, FLAMELET_KI, FLAMELET_XR,                &
+         FLAMELET_C, FLAMELET_OMG_C, FLAMELET_RHO)
+      c_p = cs_f_steady_laminar_flamelet_table_create(0, nlibvar,             &
+                                                      nxr, nki, nzvar, nzm)
+      call c_f_pointer(c_p, flamelet_library, [nlibvar, nxr, nki, nzvar, nzm])
     endif
 
     if (iirayo.eq.1) then
-      if(.not.allocated(radiation_library)) then
-        allocate(radiation_library(2, nwsgg, nxr, nki, nzvar, nzm))
-        radiation_library = 0.d0
+      if (.not.associated(radiation_library)) then
+        c_p = cs_f_steady_laminar_flamelet_table_create(1, 2*nwsgg,           &
+                                                        nxr, nki, nzvar, nzm)
+        call c_f_pointer(c_p, radiation_library,                              &
+                         [2, nwsgg, nxr, nki, nzvar, nzm])
       endif
     endif
 
@@ -470,8 +569,10 @@ contains
 
     implicit none
 
-    if(allocated(flamelet_library)) deallocate(flamelet_library)
-    if(allocated(radiation_library)) deallocate(radiation_library)
+    call cs_f_steady_laminar_flamelet_table_finalize()
+
+    flamelet_library => null()
+    radiation_library => null()
 
     return
 
@@ -31,6 +31,7 @@
 
 #include "cs_combustion_gas.h"
 #include "cs_soot_model.h"
+#include "cs_steady_laminar_flamelet_table.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -196,18 +196,25 @@ cs_soot_production(int        f_id,
     cs_real_t tcc = 12.6e3; // K
     cs_real_t d1s3 = 1./3.;
 
+    /* Cell-independent constants */
+    const cs_real_t nn0 = 6.0223e23;
+    const cs_real_t nn0_1s3 = pow(nn0, d1s3);
+    const cs_real_t dd = pow(36. * acos(-1.) / cs_math_pow2(cm->rosoot), d1s3);
+
+    const bool is_fsm = (f_id == CS_F_(fsm)->id);
+    const bool is_npm = (f_id == CS_F_(npm)->id);
+
     # pragma omp parallel for  if (n_cells > CS_THR_MIN)
     for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
       cs_real_t po2, ka, kb, kt, kz, zetas, zetan;
-      cs_real_t chi, wox, aa, bb, cc, dd;
+      cs_real_t chi, wox, aa, bb, cc;
 
       cs_real_t rho = crom[c_id];
       cs_real_t temp = cvar_temp[c_id];
 
       cs_real_t cexp = 0.;
       cs_real_t cimp = 0.;
-      cs_real_t nn0 = 6.0223e23;
 
       cs_real_t xm = 1./ (  cvar_ym1[c_id] / cm->wmolg[0]
                           + cvar_ym2[c_id] / cm->wmolg[1]
@@ -237,21 +244,18 @@ cs_soot_production(int        f_id,
       wox =   1.2e2 * (  (ka * po2 * chi) / (1. + kz * po2)
                        + kb * po2 * (1. - chi));
 
-      dd = pow(36. * acos(-1.) / cs_math_pow2(cm->rosoot), d1s3);
-
       zetas = cvara_ys[c_id];
       zetan = cvara_yp[c_id];
 
-      if (f_id == CS_F_(fsm)->id) {
+      if (is_fsm) {
         /* Surface growth : quadratic */
         if (zetas >= epsi) {
-          cimp =   volume[c_id] *(pow(nn0, d1s3) * rho * cc * pow(zetas, -d1s3)
-                 * pow(zetan, d1s3) - rho * dd * pow(nn0, d1s3)
-                 * pow(zetan, d1s3) * pow(zetas, -d1s3) * wox);
+          cs_real_t z_1s3 = nn0_1s3 * pow(zetan, d1s3) * pow(zetas, -d1s3);
+          cimp = volume[c_id] * z_1s3 * rho * (cc - dd * wox);
         }
         cexp = volume[c_id] * (144. * aa);
       }
-      if (f_id == CS_F_(npm)->id) {
+      if (is_npm) {
         cimp = volume[c_id] * (-cs_math_pow2(rho) * bb * zetan);
         cexp = volume[c_id] * aa;
       }
@@ -266,18 +270,10 @@ cs_soot_production(int        f_id,
     cs_real_t a0 = 120., as = 160.e3, af = 4.e-5;
     cs_real_t gama = 2.25, tact = 2000., yft = 1.;
     cs_real_t lspref = 0.11, lspfuel = 0.16, rcto0 = 0.58;
-    cs_real_t yg[n_gas_g], ye[n_gas_e], xe[n_gas_e];
     cs_real_t *cvar_ys = CS_F_(fsm)->val;
 
     if (f_id == CS_F_(fsm)->id) {
 
-      cs_real_t *wsf, *wso;
-      BFT_MALLOC(wsf, n_cells, cs_real_t);
-      BFT_MALLOC(wso, n_cells, cs_real_t);
-
-      cs_array_real_fill_zero(n_cells, wso);
-      cs_array_real_fill_zero(n_cells, wsf);
-
       cs_real_t rfst = (1. / fst - 1.) / (2. + 0.5 * (8. / 3.));
       cs_real_t zso = rcto0 / (rcto0 + rfst);
 
@@ -287,9 +283,13 @@ cs_soot_production(int        f_id,
 
       const cs_real_t *cvar_fm = CS_F_(fm)->val;
 
-      # pragma omp parallel for
+      # pragma omp parallel for if (n_cells > CS_THR_MIN)
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
+        /* Work arrays are private to each thread */
+        cs_real_t yg[n_gas_g], ye[n_gas_e], xe[n_gas_e];
+        cs_real_t wsf = 0., wso = 0.;
+
         cs_real_t fm = cvar_fm[c_id];
         cs_real_t rho = crom[c_id]; // Mixture density (kg/m3)
         cs_real_t temp = cvar_temp[c_id]; // Temperature
@@ -304,21 +304,17 @@ cs_soot_production(int        f_id,
         cs_real_t cxo2 = xe[1];
 
         if ((fm >= zso) && (fm <= zsf)) {
-          wsf[c_id] =   afuel * pow(rho, 2) * (yft *(fm - fst)
-                      / (1. - fst)) * pow(temp, gama) * exp(-tact / temp);
-          wso[c_id] = -rho * a0 * cxo2 * sqrt(temp) * exp(-19670./temp) * as;
+          wsf =   afuel * pow(rho, 2) * (yft *(fm - fst)
+                / (1. - fst)) * pow(temp, gama) * exp(-tact / temp);
+          wso = -rho * a0 * cxo2 * sqrt(temp) * exp(-19670./temp) * as;
         }
         if (fm < zso) {
-          wso[c_id] = -rho * a0 * cxo2 * sqrt(temp) * exp(-19670./temp) * as;
+          wso = -rho * a0 * cxo2 * sqrt(temp) * exp(-19670./temp) * as;
         }
-        smbrs[c_id]  += (wsf[c_id] + wso[c_id] *zetas) * volume[c_id];
-        rovsdt[c_id] += cs_math_fmax(-wso[c_id], 0.) * volume[c_id];
+        smbrs[c_id]  += (wsf + wso *zetas) * volume[c_id];
+        rovsdt[c_id] += cs_math_fmax(-wso, 0.) * volume[c_id];
       }
 
-      /* Free memory */
-      BFT_FREE(wsf);
-      BFT_FREE(wso);
-
     }
 
     else if (f_id == CS_F_(npm)->id) {
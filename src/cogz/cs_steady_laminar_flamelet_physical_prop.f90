@@ -77,7 +77,7 @@ integer          izfppp(nfabor)
 
 ! Local variables
 
-integer           iel, ifac, izone, ifcvsl, isc, iscal, iesp, ig, iprev
+integer           iel, ifac, izone, ifcvsl, isc, iscal, iesp, ig, iprev, i_rad
 integer           viscls_counter, viscls_number
 
 double precision  had, cmin, cmid, cmax
@@ -228,10 +228,12 @@ if (is_vploop .eqv. .false.) then ! Outside the rho(Y)-v-p coupling
   enddo
 
   ! Map spectral absorption and emission pointers
+  allocate(rad_work(2,nwsgg))
+  i_rad = 0
   if (update_rad.eqv..TRUE.) then
+    i_rad = 1
     allocate(cpro_kg(nwsgg))
     allocate(cpro_emi(nwsgg))
-    allocate(rad_work(2,nwsgg))
 
     do ig = 1, nwsgg
       write(f_name, '(a, i2.2)') 'spectral_absorption_coeff_', ig
@@ -248,13 +250,13 @@ if (is_vploop .eqv. .false.) then ! Outside the rho(Y)-v-p coupling
   do iel = 1, ncel
 
     if (ippmod(islfm).lt.2) then
-      call filtered_physical_prop(cvar_fm(iel),     fp2m(iel),                &
-                                  cpro_totki(iel), cpro_xr(iel),              &
-                                  phim, rad_work, update_rad)
+      call cs_f_steady_laminar_flamelet_table_interpolate                     &
+        (0, cvar_fm(iel), fp2m(iel), cpro_totki(iel), cpro_xr(iel),           &
+         i_rad, phim, rad_work)
     else
-      call filtered_physical_prop_progvar(cvar_fm(iel), fp2m(iel),            &
-                                          cvar_progvar(iel), cpro_xr(iel),    &
-                                          phim, rad_work, update_rad)
+      call cs_f_steady_laminar_flamelet_table_interpolate                     &
+        (1, cvar_fm(iel), fp2m(iel), cvar_progvar(iel), cpro_xr(iel),         &
+         i_rad, phim, rad_work)
     endif
     ! Affectation des variables dans les tableaux appropries
 
@@ -295,9 +297,9 @@ if (is_vploop .eqv. .false.) then ! Outside the rho(Y)-v-p coupling
   enddo
 
   if(update_rad.eqv..TRUE.) then
-    deallocate(rad_work)
     deallocate(cpro_kg, cpro_emi)
   endif
+  deallocate(rad_work)
 
   deallocate(phim)
   deallocate(cpro_species)
@@ -311,14 +313,13 @@ else  ! Inside the rho(Y)-v-p coupling
 
   if (ippmod(islfm).lt.2) then
     do iel= 1, ncel
-      call filtered_density(cvar_fm(iel), fp2m(iel), cpro_totki(iel), &
-                            cpro_xr(iel), rom_eos(iel))
+      rom_eos(iel) = cs_f_steady_laminar_flamelet_table_density       &
+        (0, cvar_fm(iel), fp2m(iel), cpro_totki(iel), cpro_xr(iel))
     enddo
   else
     do iel= 1, ncel
-      call filtered_density_progvar(cvar_fm(iel), fp2m(iel),          &
-                                    cvar_progvar(iel), cpro_xr(iel),  &
-                                    rom_eos(iel))
+      rom_eos(iel) = cs_f_steady_laminar_flamelet_table_density       &
+        (1, cvar_fm(iel), fp2m(iel), cvar_progvar(iel), cpro_xr(iel))
     enddo
   endif
 
@@ -362,676 +363,6 @@ end subroutine
 ! Function:
 ! ---------
 
-!> \file cs_steady_laminar_flamelet_physical_prop.f90
-!>
-!> \brief Specific physic subroutine: diffusion flame.
-!>
-!> Interpolation of mean thermophysic properties as a
-!> function of fm, fp2m, ki, xr
-!-------------------------------------------------------------------------------
-
-subroutine filtered_physical_prop(zm0, zvar0, kim0, xrm0,         &
-                                  phim, rad_work, update_rad)
-
-!===============================================================================
-! Module files
-!===============================================================================
-
-use coincl
-use radiat
-
-implicit none
-
-integer :: dataIndex
-
-double precision :: zm0, zvar0, kim0, xrm0, phim(nlibvar)
-double precision :: weight_zm, weight_zvar, weight_kim, weight_xrm
-
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2
-double precision, dimension(:), allocatable :: xData
-
-! Work arrays for radiation
-double precision, dimension(:,:,:,:,:), allocatable :: rad_work4
-double precision, dimension(:,:,:,:), allocatable  :: rad_work3
-double precision, dimension(:,:,:), allocatable    :: rad_work2
-double precision  rad_work(2, nwsgg)
-
-logical  update_rad
-
-allocate(phi_4(nlibvar,nxr,nki,nzvar))
-allocate(phi_3(nlibvar,nxr,nki))
-allocate(phi_2(nlibvar,nxr))
-
-if (update_rad.eqv..TRUE.) then
-  allocate(rad_work4(2,nwsgg,nxr,nki,nzvar))
-  allocate(rad_work3(2,nwsgg,nxr,nki))
-  allocate(rad_work2(2,nwsgg,nxr))
-endif
-
-! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
-
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,nzm)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0-weight_zm)*flamelet_library(:,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(:,:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work4(:,:,:,:,:) = (1.0-weight_zm)*radiation_library(:,:,:,:,:,dataIndex-1) &
-        + weight_zm*radiation_library(:,:,:,:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(FLAMELET_ZVAR,1,1,:)
-
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,nzvar)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work3(:,:,:,:) = (1.0-weight_zvar)*rad_work4(:,:,:,:,dataIndex-1) &
-        + weight_zvar*rad_work4(:,:,:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over Ki_m
-allocate(xData(nki))
-xData(:) = phi_3(FLAMELET_KI,1,:)
-
-if(xData(1).ge.kim0) then
-  phi_2(:,:) = phi_3(:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work2(:,:,:) = rad_work3(:,:,:,1)
-elseif(xData(size(xData)).le.kim0) then
-  phi_2(:,:) = phi_3(:,:,nki)
-  if (update_rad.eqv..TRUE.) rad_work2(:,:,:) = rad_work3(:,:,:,nki)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. kim0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt. 1) then
-    weight_kim = (kim0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_2(:,:) = (1.0-weight_kim)*phi_3(:,:,dataIndex-1) &
-      + weight_kim*phi_3(:,:,dataIndex)
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work2(:,:,:) = (1.0-weight_kim)*rad_work3(:,:,:,dataIndex-1) &
-        + weight_kim*rad_work3(:,:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over XR_m
-allocate(xData(nxr))
-xData(:) = phi_2(FLAMELET_XR,:)
-
-if(xData(1).ge.xrm0) then
-  phim(:) = phi_2(:,1)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,1)
-elseif(xData(size(xData)).le.xrm0) then
-  phim(:) = phi_2(:,nxr)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,nxr)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. xrm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex.gt.1) then
-    weight_xrm = (xrm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phim(:) = (1.0-weight_xrm)*phi_2(:,dataIndex-1) &
-      + weight_xrm*phi_2(:,dataIndex)
-    if (update_rad.eqv..TRUE.) then
-      rad_work(:,:) = (1.0-weight_xrm)*rad_work2(:,:,dataIndex-1) &
-        + weight_xrm*rad_work2(:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-deallocate(phi_4,phi_3,phi_2)
-if (update_rad.eqv..TRUE.) deallocate(rad_work4, rad_work3, rad_work2)
-
-end subroutine
-
-!===============================================================================
-! Function:
-! ---------
-
-!> \file cs_steady_laminar_flamelet_physical_prop.f90
-!>
-!> \brief Specific physic subroutine: diffusion flame.
-!>
-!> Interpolation of mean density as a function of
-!> fm, fp2m, ki, xr
-!-------------------------------------------------------------------------------
-
-subroutine filtered_density(zm0, zvar0, kim0, xrm0, rhom)
-
-!===============================================================================
-! Module files
-!===============================================================================
-
-use coincl
-
-implicit none
-
-double precision :: zm0, zvar0, kim0, xrm0, rhom
-double precision :: weight_zm, weight_zvar, weight_kim, weight_xrm
-
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2
-double precision, dimension(:), allocatable :: xData
-
-integer :: dataIndex, n_var_local = 5
-integer :: var_sel(5)
-
-var_sel = (/FLAMELET_ZM, FLAMELET_ZVAR, FLAMELET_XR,          &
-            FLAMELET_RHO, FLAMELET_KI/)
-
-allocate(phi_4(n_var_local,nxr,nki,nzvar))
-allocate(phi_3(n_var_local,nxr,nki))
-allocate(phi_2(n_var_local,nxr))
-
-! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
-
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0-weight_zm)*flamelet_library(var_sel,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(var_sel,:,:,:,dataIndex)
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(2,1,1,:)
-
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over Ki_m
-allocate(xData(nki))
-xData(:) = phi_3(5,1,:)
-
-if(xData(1).ge.kim0) then
-  phi_2(:,:) = phi_3(:,:,1)
-elseif(xData(size(xData)).le.kim0) then
-  phi_2(:,:) = phi_3(:,:,nki)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. kim0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt. 1) then
-    weight_kim = (kim0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_2(:,:) = (1.0-weight_kim)*phi_3(:,:,dataIndex-1) &
-      + weight_kim*phi_3(:,:,dataIndex)
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over XR_m
-allocate(xData(nxr))
-xData(:) = phi_2(3,:)
-
-if(xData(1).ge.xrm0) then
-  rhom = phi_2(4,1)
-elseif(xData(size(xData)).le.xrm0) then
-  rhom = phi_2(4,nxr)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. xrm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex.gt.1) then
-    weight_xrm = (xrm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    rhom = (1.0-weight_xrm)*phi_2(4,dataIndex-1) &
-      + weight_xrm*phi_2(4,dataIndex)
-  endif
-endif
-
-deallocate(xData)
-deallocate(phi_4,phi_3,phi_2)
-
-end subroutine
-
-!===============================================================================
-! Function:
-! ---------
-
-!> \file cs_steady_laminar_flamelet_physical_prop.f90
-!>
-!> \brief Specific physic subroutine: diffusion flame.
-!>
-!> Interpolation of mean thermophysic properties as a
-!> function of fm, fp2m, c, xr
-!-------------------------------------------------------------------------------
-
-subroutine filtered_physical_prop_progvar(zm0, zvar0, cm0, xrm0,          &
-                                          phim, rad_work, update_rad)
-
-!===============================================================================
-! Module files
-!===============================================================================
-
-use coincl
-use radiat
-
-implicit none
-
-integer :: dataIndex, i_ki
-
-double precision :: zm0, zvar0, cm0, xrm0, phim(nlibvar)
-double precision :: weight_zm, weight_zvar, weight_cm, weight_xrm(nki)
-
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2, xData2D
-double precision, dimension(:), allocatable :: xData
-
-! Work arrays for radiation
-double precision, dimension(:,:,:,:,:), allocatable :: rad_work4
-double precision, dimension(:,:,:,:), allocatable  :: rad_work3
-double precision, dimension(:,:,:), allocatable    :: rad_work2
-double precision  rad_work(2, nwsgg)
-
-logical update_rad
-
-allocate(phi_4(nlibvar,nki,nxr,nzvar))
-allocate(phi_3(nlibvar,nki,nxr))
-allocate(phi_2(nlibvar,nki))
-
-if (update_rad.eqv..TRUE.) then
-  allocate(rad_work4(2,nwsgg,nki,nxr,nzvar))
-  allocate(rad_work3(2,nwsgg,nki,nxr))
-  allocate(rad_work2(2,nwsgg,nki))
-endif
-
-! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
-
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,nzm)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  weight_zm = 0.d0
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0d0-weight_zm)*flamelet_library(:,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(:,:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work4(:,:,:,:,:) = (1.0d0-weight_zm)*radiation_library(:,:,:,:,:,dataIndex-1) &
-        + weight_zm*radiation_library(:,:,:,:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(FLAMELET_ZVAR,1,1,:)
-
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,nzvar)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  weight_zvar = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0d0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work3(:,:,:,:) = (1.0d0-weight_zvar)*rad_work4(:,:,:,:,dataIndex-1) &
-        + weight_zvar*rad_work4(:,:,:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over XR_m
-allocate(xData2D(nki,nxr))
-xData2D(:,:) = phi_3(4,:,:)
-
-do i_ki = 1, nki
-
-  if(xData2D(i_ki,1).ge.xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,1)
-    if (update_rad.eqv..TRUE.) rad_work2(:,:,i_ki) = rad_work3(:,:,i_ki,1)
-  elseif(xData2D(i_ki,nxr).le. xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,nxr)
-    if (update_rad.eqv..TRUE.) rad_work2(:,:,i_ki) = rad_work3(:,:,i_ki,nxr)
-  else
-
-    dataIndex = 1
-    do while(xData2D(i_ki,dataIndex) .lt. xrm0 &
-        .and. dataIndex .lt. nxr)
-      dataIndex = dataIndex + 1
-    enddo
-
-    if(dataIndex .gt. 1) then
-      weight_xrm(i_ki) = (xrm0-xData2D(i_ki,dataIndex-1))/ &
-        (xData2D(i_ki,dataIndex)-xData2D(i_ki,dataIndex-1))
-      phi_2(:,i_ki) = (1.d0-weight_xrm(i_ki))*phi_3(:,i_ki,dataIndex-1) &
-        + weight_xrm(i_ki)*phi_3(:,i_ki,dataIndex)
-      if (update_rad.eqv..TRUE.) then
-        rad_work2(:,:,i_ki) = (1.0d0-weight_xrm(i_ki))*rad_work3(:,:,i_ki,dataIndex-1) &
-          + weight_xrm(i_ki)*rad_work3(:,:,i_ki,dataIndex)
-      endif
-    endif
-  endif
-
-enddo
-
-deallocate(xData2D)
-
-! Then interpolate over c_m
-allocate(xData(nki))
-xData(:) = phi_2(FLAMELET_C,:)
-
-if(xData(1).ge.cm0) then
-  phim(:) = phi_2(:,1)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,1)
-elseif(xData(size(xData)).le.cm0) then
-  phim(:) = phi_2(:,nki)
-  phim(FLAMELET_OMG_C) = 0.0d0
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,nki)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. cm0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  weight_cm = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_cm = (cm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phim(:) = (1.0d0-weight_cm)*phi_2(:,dataIndex-1) &
-      + weight_cm*phi_2(:,dataIndex)
-    if (update_rad.eqv..TRUE.) then
-      rad_work(:,:) = (1.0d0-weight_cm)*rad_work2(:,:,dataIndex-1) &
-        + weight_cm*rad_work2(:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-
-deallocate(phi_4,phi_3,phi_2)
-if (update_rad.eqv..TRUE.) deallocate(rad_work4, rad_work3, rad_work2)
-
-end subroutine
-
-!===============================================================================
-! Function:
-! ---------
-
-!> \file cs_steady_laminar_flamelet_physical_prop.f90
-!>
-!> \brief Specific physic subroutine: diffusion flame.
-!>
-!> Interpolation of mean density as a function of
-!> fm, fp2m, c, xr
-!-------------------------------------------------------------------------------
-
-subroutine filtered_density_progvar(zm0, zvar0, cm0, xrm0, rhom)
-
-!===============================================================================
-! Module files
-!===============================================================================
-
-use coincl
-
-implicit none
-
-double precision, dimension(:), allocatable :: xData
-double precision :: zm0, zvar0, cm0, xrm0, rhom
-
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2, xData2D
-double precision :: weight_zm, weight_zvar, weight_cm, weight_xrm(nki)
-
-integer :: dataIndex, i_ki, n_var_local = 5
-integer :: var_sel(5)
-
-var_sel = (/FLAMELET_ZM, FLAMELET_ZVAR, FLAMELET_XR,          &
-            FLAMELET_RHO, FLAMELET_KI/)
-
-allocate(phi_4(n_var_local,nki,nxr,nzvar))
-allocate(phi_3(n_var_local,nki,nxr))
-allocate(phi_2(n_var_local,nki))
-
-! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
-
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  weight_zm = 0.d0
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0d0-weight_zm)*flamelet_library(var_sel,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(var_sel,:,:,:,dataIndex)
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(2,1,1,:)
-
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  weight_zvar = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0d0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over XR_m
-allocate(xData2D(nki,nxr))
-xData2D(:,:) = phi_3(3,:,:)
-do i_ki = 1, nki
-
-  if(xData2D(i_ki,1).ge.xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,1)
-  elseif(xData2D(i_ki,nxr).le. xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,nxr)
-  else
-
-    dataIndex = 1
-    do while(xData2D(i_ki,dataIndex) .lt. xrm0 &
-        .and. dataIndex .lt. nxr)
-      dataIndex = dataIndex + 1
-    enddo
-
-    if(dataIndex .gt. 1) then
-      weight_xrm(i_ki) = (xrm0-xData2D(i_ki,dataIndex-1))/ &
-        (xData2D(i_ki,dataIndex)-xData2D(i_ki,dataIndex-1))
-      phi_2(:,i_ki) = (1.d0-weight_xrm(i_ki))*phi_3(:,i_ki,dataIndex-1) &
-        + weight_xrm(i_ki)*phi_3(:,i_ki,dataIndex)
-    endif
-  endif
-
-enddo
-deallocate(xData2D)
-
-! Then interpolate over c_m
-allocate(xData(nki))
-xData(:) = phi_2(5,:)
-
-if(xData(1).ge.cm0) then
-  rhom = phi_2(4,1)
-elseif(xData(size(xData)).le.cm0) then
-  rhom = phi_2(4,nki)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. cm0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt. 1) then
-    weight_cm = (cm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    rhom = (1.0d0-weight_cm)*phi_2(4,dataIndex-1) &
-      + weight_cm*phi_2(4,dataIndex)
-  endif
-endif
-
-deallocate(xData)
-
-deallocate(phi_4,phi_3,phi_2)
-
-end subroutine
-
-!===============================================================================
-! Function:
-! ---------
-
 !> \file cs_steady_laminar_flamelet_physical_prop.f90
 !>
 !> \brief Specific physic subroutine: diffusion flame.
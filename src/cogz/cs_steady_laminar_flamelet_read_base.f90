@@ -58,11 +58,20 @@ implicit none
 
 call init_steady_laminar_flamelet_library
 
-! Lecture de librairie flamelettes turbulentes
-call read_flamelet_library
+! Libraries may be shared by ranks of a same node, in which case
+! they are read by a single rank of that node.
 
-! Lecture de librairie flamelettes radiatives
-if (iirayo .eq. 1) call read_radiation_library
+if (cs_f_steady_laminar_flamelet_table_is_writer() .eq. 1) then
+
+  ! Lecture de librairie flamelettes turbulentes
+  call read_flamelet_library
+
+  ! Lecture de librairie flamelettes radiatives
+  if (iirayo .eq. 1) call read_radiation_library
+
+endif
+
+call cs_f_steady_laminar_flamelet_table_sync()
 
 return
 
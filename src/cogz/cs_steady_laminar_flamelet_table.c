@@ -0,0 +1,777 @@
+/*============================================================================
+ * Steady laminar flamelet library storage and interpolation.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_steady_laminar_flamelet_table.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_steady_laminar_flamelet_table.c
+
+  Steady laminar flamelet library storage and interpolation.
+
+  The flamelet library is stored with all variables of a given table node
+  contiguous (node dimensions being, from fastest to slowest varying,
+  the enthalpy defect and the scalar dissipation rate, or the progress
+  variable and the enthalpy defect, then the mixture fraction variance and
+  the mean mixture fraction), and the radiation library uses the same node
+  ordering.
+
+  When MPI-3 is available, both libraries are allocated in a shared memory
+  window on each compute node, so that a single copy is read and stored
+  per node.
+
+  Interpolation is successively linear along each dimension, the grid of
+  each dimension being itself interpolated along the previous dimensions.
+  Rather than interpolating whole sub-tables, only the bracketing nodes
+  are determined (by bisection, grid values being computed on the fly),
+  leading to a stencil of at most 16 nodes and associated weights, which
+  is then applied to all variables.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Interpolation stencil */
+
+typedef struct {
+
+  int        n_c;      /* number of nodes */
+  cs_lnum_t  r[16];    /* node ids */
+  cs_real_t  w[16];    /* node weights */
+
+} _stencil_t;
+
+/* Library table */
+
+typedef struct {
+
+  cs_real_t  *val;       /* values */
+  int         rec_size;  /* number of values per node */
+
+#if defined(HAVE_MPI) && MPI_VERSION >= 3
+  MPI_Win     win;       /* shared memory window, or MPI_WIN_NULL */
+#endif
+
+} _table_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Flamelet (0) and radiation (1) libraries */
+
+#if defined(HAVE_MPI) && MPI_VERSION >= 3
+static _table_t  _tables[2] = {{NULL, 0, MPI_WIN_NULL},
+                               {NULL, 0, MPI_WIN_NULL}};
+static MPI_Comm  _node_comm = MPI_COMM_NULL;
+#else
+static _table_t  _tables[2] = {{NULL, 0}, {NULL, 0}};
+#endif
+
+/* Number of enthalpy defect, scalar dissipation rate (or progress variable),
+   variance and mixture fraction nodes */
+
+static int  _n_nodes[4] = {0, 0, 0, 0};
+
+/* Ids of mixture fraction, variance, scalar dissipation rate, enthalpy
+   defect, progress variable, progress variable source term and density
+   variables (-1 if absent) */
+
+static int  _var_id[7] = {-1, -1, -1, -1, -1, -1, -1};
+
+/*============================================================================
+ * Prototypes for functions intended for use only by Fortran wrappers.
+ * (descriptions follow, with function bodies).
+ *============================================================================*/
+
+void *
+cs_f_steady_laminar_flamelet_table_create(int  t_id,
+                                          int  rec_size,
+                                          int  nxr,
+                                          int  nki,
+                                          int  nzvar,
+                                          int  nzm);
+
+void
+cs_f_steady_laminar_flamelet_table_set_var_ids(int  i_zm,
+                                               int  i_zvar,
+                                               int  i_ki,
+                                               int  i_xr,
+                                               int  i_c,
+                                               int  i_omg_c,
+                                               int  i_rho);
+
+int
+cs_f_steady_laminar_flamelet_table_is_writer(void);
+
+void
+cs_f_steady_laminar_flamelet_table_sync(void);
+
+void
+cs_f_steady_laminar_flamelet_table_interpolate(int        progvar,
+                                               cs_real_t  zm,
+                                               cs_real_t  zvar,
+                                               cs_real_t  x,
+                                               cs_real_t  xr,
+                                               int        update_rad,
+                                               cs_real_t  phi[],
+                                               cs_real_t  rad[]);
+
+cs_real_t
+cs_f_steady_laminar_flamelet_table_density(int        progvar,
+                                           cs_real_t  zm,
+                                           cs_real_t  zvar,
+                                           cs_real_t  x,
+                                           cs_real_t  xr);
+
+void
+cs_f_steady_laminar_flamelet_table_finalize(void);
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return rank id in the compute node, or 0 if libraries are not shared.
+ *----------------------------------------------------------------------------*/
+
+static int
+_node_rank_id(void)
+{
+  int rank_id = 0;
+
+#if defined(HAVE_MPI) && MPI_VERSION >= 3
+  if (_node_comm != MPI_COMM_NULL)
+    MPI_Comm_rank(_node_comm, &rank_id);
+#endif
+
+  return rank_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute an interpolated grid value.
+ *
+ * parameters:
+ *   st     <-- current stencil
+ *   var_id <-- grid variable id
+ *   shift  <-- node id shift relative to stencil
+ *
+ * returns:
+ *   grid value
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_grid_value(const _stencil_t  *st,
+            int                var_id,
+            cs_lnum_t          shift)
+{
+  const cs_real_t *t = _tables[0].val;
+  const int rec_size = _tables[0].rec_size;
+
+  cs_real_t g = 0;
+  for (int c = 0; c < st->n_c; c++)
+    g += st->w[c] * t[(size_t)(st->r[c] + shift)*rec_size + var_id];
+
+  return g;
+}
+
+/*----------------------------------------------------------------------------
+ * Refine a stencil along a given dimension.
+ *
+ * The grid along that dimension is interpolated using the current stencil,
+ * and values outside the grid are clipped to its bounds.
+ *
+ * parameters:
+ *   st     <-> stencil
+ *   var_id <-- grid variable id
+ *   stride <-- node id stride along dimension
+ *   n      <-- number of nodes along dimension
+ *   x      <-- coordinate along dimension
+ *
+ * returns:
+ *   1 if x is above the grid upper bound, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_refine(_stencil_t  *st,
+        int          var_id,
+        cs_lnum_t    stride,
+        int          n,
+        cs_real_t    x)
+{
+  int i0 = 0, retval = 0;
+  cs_real_t w = 0;
+
+  if (n > 1 && _grid_value(st, var_id, 0) < x) {
+
+    if (_grid_value(st, var_id, (n-1)*stride) <= x) {
+      i0 = n-1;
+      retval = 1;
+    }
+    else {
+      int i1 = n-1;
+      while (i1 - i0 > 1) {
+        int im = (i0 + i1) / 2;
+        if (_grid_value(st, var_id, im*stride) < x)
+          i0 = im;
+        else
+          i1 = im;
+      }
+      cs_real_t g0 = _grid_value(st, var_id, i0*stride);
+      cs_real_t g1 = _grid_value(st, var_id, i1*stride);
+      w = (x - g0) / (g1 - g0);
+    }
+
+  }
+
+  const int n_c = st->n_c;
+
+  if (w > 0) {
+    for (int c = 0; c < n_c; c++) {
+      st->r[n_c + c] = st->r[c] + (i0+1)*stride;
+      st->w[n_c + c] = st->w[c] * w;
+      st->r[c] += i0*stride;
+      st->w[c] *= (1. - w);
+    }
+    st->n_c = 2*n_c;
+  }
+  else {
+    for (int c = 0; c < n_c; c++)
+      st->r[c] += i0*stride;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Build stencil for a given progress variable level.
+ *
+ * The enthalpy defect grid depends on the progress variable level.
+ * With the progress variable model, the progress variable is the fastest
+ * varying node dimension, followed by the enthalpy defect.
+ *
+ * parameters:
+ *   st   <-- stencil refined along mixture fraction and variance
+ *   m    <-- progress variable level
+ *   xr   <-- enthalpy defect
+ *   st_m --> stencil for level m
+ *----------------------------------------------------------------------------*/
+
+static void
+_progvar_level(const _stencil_t  *st,
+               int                m,
+               cs_real_t          xr,
+               _stencil_t        *st_m)
+{
+  st_m->n_c = st->n_c;
+  for (int c = 0; c < st->n_c; c++) {
+    st_m->r[c] = st->r[c] + m;
+    st_m->w[c] = st->w[c];
+  }
+
+  _refine(st_m, _var_id[3], _n_nodes[1], _n_nodes[0], xr);
+}
+
+/*----------------------------------------------------------------------------
+ * Build interpolation stencil.
+ *
+ * parameters:
+ *   progvar <-- true for progress variable model
+ *   coo     <-- point coordinates in library
+ *   st      --> interpolation stencil
+ *
+ * returns:
+ *   1 if the progress variable is above its maximum, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_stencil(bool              progvar,
+         const cs_real_t   coo[4],
+         _stencil_t       *st)
+{
+  const int nxr = _n_nodes[0], nki = _n_nodes[1];
+  const int nzvar = _n_nodes[2], nzm = _n_nodes[3];
+
+  const cs_lnum_t s_zvar = (cs_lnum_t)nxr*nki;
+  const cs_lnum_t s_zm = s_zvar*nzvar;
+
+  st->n_c = 1;
+  st->r[0] = 0;
+  st->w[0] = 1.;
+
+  _refine(st, _var_id[0], s_zm, nzm, coo[0]);
+  _refine(st, _var_id[1], s_zvar, nzvar, coo[1]);
+
+  if (progvar == false) {
+    _refine(st, _var_id[2], nxr, nki, coo[2]);
+    _refine(st, _var_id[3], 1, nxr, coo[3]);
+    return 0;
+  }
+
+  /* With the progress variable, the enthalpy defect is interpolated
+     for each progress variable level, and the progress variable grid
+     is based on these interpolated values. */
+
+  const int i_c = _var_id[4];
+  const cs_real_t c = coo[2];
+
+  _stencil_t st_0, st_1;
+
+  _progvar_level(st, 0, coo[3], &st_0);
+  if (nki < 2 || _grid_value(&st_0, i_c, 0) >= c) {
+    *st = st_0;
+    return 0;
+  }
+
+  _progvar_level(st, nki-1, coo[3], &st_1);
+  if (_grid_value(&st_1, i_c, 0) <= c) {
+    *st = st_1;
+    return 1;
+  }
+
+  int m0 = 0, m1 = nki-1;
+  while (m1 - m0 > 1) {
+    int mm = (m0 + m1) / 2;
+    _stencil_t st_m;
+    _progvar_level(st, mm, coo[3], &st_m);
+    if (_grid_value(&st_m, i_c, 0) < c) {
+      m0 = mm;
+      st_0 = st_m;
+    }
+    else {
+      m1 = mm;
+      st_1 = st_m;
+    }
+  }
+
+  cs_real_t g0 = _grid_value(&st_0, i_c, 0);
+  cs_real_t g1 = _grid_value(&st_1, i_c, 0);
+  cs_real_t w = (c - g0) / (g1 - g0);
+
+  st->n_c = st_0.n_c + st_1.n_c;
+  for (int i = 0; i < st_0.n_c; i++) {
+    st->r[i] = st_0.r[i];
+    st->w[i] = st_0.w[i] * (1. - w);
+  }
+  for (int i = 0; i < st_1.n_c; i++) {
+    st->r[st_0.n_c + i] = st_1.r[i];
+    st->w[st_0.n_c + i] = st_1.w[i] * w;
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply interpolation stencil to all variables of a table.
+ *
+ * parameters:
+ *   st  <-- interpolation stencil
+ *   t   <-- library table
+ *   val --> interpolated values
+ *----------------------------------------------------------------------------*/
+
+static void
+_apply(const _stencil_t  *st,
+       const _table_t    *t,
+       cs_real_t          val[])
+{
+  const int rec_size = t->rec_size;
+
+  for (int j = 0; j < rec_size; j++)
+    val[j] = 0;
+
+  for (int c = 0; c < st->n_c; c++) {
+    const cs_real_t w = st->w[c];
+    const cs_real_t *restrict rec = t->val + (size_t)st->r[c]*rec_size;
+    for (int j = 0; j < rec_size; j++)
+      val[j] += w * rec[j];
+  }
+}
+
+/*============================================================================
+ * Fortran wrapper function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create a library table.
+ *
+ * Tables are shared by all ranks of a compute node when possible,
+ * and initialized to zero.
+ *
+ * This function is intended for use by Fortran wrappers.
+ *
+ * parameters:
+ *   t_id     <-- 0 for flamelet library, 1 for radiation library
+ *   rec_size <-- number of values per table node
+ *   nxr      <-- number of enthalpy defect nodes
+ *   nki      <-- number of scalar dissipation rate (or progress
+ *                variable) nodes
+ *   nzvar    <-- number of mixture fraction variance nodes
+ *   nzm      <-- number of mean mixture fraction nodes
+ *
+ * returns:
+ *   pointer to table values
+ *----------------------------------------------------------------------------*/
+
+void *
+cs_f_steady_laminar_flamelet_table_create(int  t_id,
+                                          int  rec_size,
+                                          int  nxr,
+                                          int  nki,
+                                          int  nzvar,
+                                          int  nzm)
+{
+  assert(t_id == 0 || t_id == 1);
+
+  _table_t *t = _tables + t_id;
+
+  if (t->val != NULL)
+    return t->val;
+
+  _n_nodes[0] = nxr;
+  _n_nodes[1] = nki;
+  _n_nodes[2] = nzvar;
+  _n_nodes[3] = nzm;
+
+  t->rec_size = rec_size;
+
+  size_t n_vals = (size_t)rec_size * nxr * nki * nzvar * nzm;
+
+#if defined(HAVE_MPI) && MPI_VERSION >= 3
+
+  if (cs_glob_n_ranks > 1 && _node_comm == MPI_COMM_NULL)
+    MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED,
+                        cs_glob_rank_id, MPI_INFO_NULL, &_node_comm);
+
+  if (_node_comm != MPI_COMM_NULL) {
+
+    int node_rank_id = _node_rank_id();
+
+    MPI_Aint w_size = (node_rank_id == 0) ? n_vals*sizeof(cs_real_t) : 0;
+    void *w_ptr = NULL;
+
+    MPI_Win_allocate_shared(w_size, sizeof(cs_real_t), MPI_INFO_NULL,
+                            _node_comm, &w_ptr, &(t->win));
+
+    if (node_rank_id != 0) {
+      int disp_unit;
+      MPI_Win_shared_query(t->win, 0, &w_size, &disp_unit, &w_ptr);
+    }
+
+    t->val = w_ptr;
+
+  }
+
+#endif
+
+  if (t->val == NULL)
+    BFT_MALLOC(t->val, n_vals, cs_real_t);
+
+  if (_node_rank_id() == 0)
+    memset(t->val, 0, n_vals*sizeof(cs_real_t));
+
+  cs_f_steady_laminar_flamelet_table_sync();
+
+  return t->val;
+}
+
+/*----------------------------------------------------------------------------
+ * Define (1-based) ids of grid and specific variables in the flamelet
+ * library.
+ *
+ * This function is intended for use by Fortran wrappers.
+ *
+ * parameters:
+ *   i_zm    <-- mean mixture fraction
+ *   i_zvar  <-- mixture fraction variance
+ *   i_ki    <-- scalar dissipation rate
+ *   i_xr    <-- enthalpy defect
+ *   i_c     <-- progress variable
+ *   i_omg_c <-- progress variable source term
+ *   i_rho   <-- density
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_steady_laminar_flamelet_table_set_var_ids(int  i_zm,
+                                               int  i_zvar,
+                                               int  i_ki,
+                                               int  i_xr,
+                                               int  i_c,
+                                               int  i_omg_c,
+                                               int  i_rho)
+{
+  const int var_id[7] = {i_zm, i_zvar, i_ki, i_xr, i_c, i_omg_c, i_rho};
+
+  for (int i = 0; i < 7; i++)
+    _var_id[i] = (var_id[i] > 0) ? var_id[i] - 1 : -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate if the local rank should fill library tables.
+ *
+ * This function is intended for use by Fortran wrappers.
+ *
+ * returns:
+ *   1 if tables should be filled by the local rank, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+cs_f_steady_laminar_flamelet_table_is_writer(void)
+{
+  return (_node_rank_id() == 0) ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize library tables after they have been filled.
+ *
+ * This function is intended for use by Fortran wrappers.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_steady_laminar_flamelet_table_sync(void)
+{
+#if defined(HAVE_MPI) && MPI_VERSION >= 3
+  for (int t_id = 0; t_id < 2; t_id++) {
+    if (_tables[t_id].win != MPI_WIN_NULL)
+      MPI_Win_fence(0, _tables[t_id].win);
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Interpolate flamelet (and radiation) libraries.
+ *
+ * This function is intended for use by Fortran wrappers.
+ *
+ * parameters:
+ *   progvar    <-- 1 for progress variable model, 0 otherwise
+ *   zm         <-- mean mixture fraction
+ *   zvar       <-- mixture fraction variance
+ *   x          <-- scalar dissipation rate or progress variable
+ *   xr         <-- enthalpy defect
+ *   update_rad <-- 1 if radiative properties are interpolated
+ *   phi        --> interpolated flamelet library variables
+ *   rad        --> interpolated radiative properties
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_steady_laminar_flamelet_table_interpolate(int        progvar,
+                                               cs_real_t  zm,
+                                               cs_real_t  zvar,
+                                               cs_real_t  x,
+                                               cs_real_t  xr,
+                                               int        update_rad,
+                                               cs_real_t  phi[],
+                                               cs_real_t  rad[])
+{
+  const cs_real_t coo[4] = {zm, zvar, x, xr};
+
+  cs_steady_laminar_flamelet_table_interpolate((progvar > 0) ? true : false,
+                                               coo,
+                                               phi,
+                                               (update_rad > 0) ? rad : NULL);
+}
+
+/*----------------------------------------------------------------------------
+ * Interpolate density in flamelet library.
+ *
+ * This function is intended for use by Fortran wrappers.
+ *
+ * parameters:
+ *   progvar <-- 1 for progress variable model, 0 otherwise
+ *   zm      <-- mean mixture fraction
+ *   zvar    <-- mixture fraction variance
+ *   x       <-- scalar dissipation rate or progress variable
+ *   xr      <-- enthalpy defect
+ *
+ * returns:
+ *   interpolated density
+ *----------------------------------------------------------------------------*/
+
+cs_real_t
+cs_f_steady_laminar_flamelet_table_density(int        progvar,
+                                           cs_real_t  zm,
+                                           cs_real_t  zvar,
+                                           cs_real_t  x,
+                                           cs_real_t  xr)
+{
+  const cs_real_t coo[4] = {zm, zvar, x, xr};
+
+  return cs_steady_laminar_flamelet_table_density((progvar > 0) ? true : false,
+                                                  coo);
+}
+
+/*----------------------------------------------------------------------------
+ * Free flamelet and radiation libraries.
+ *
+ * This function is intended for use by Fortran wrappers.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_steady_laminar_flamelet_table_finalize(void)
+{
+  cs_steady_laminar_flamelet_table_finalize();
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate all variables of the flamelet library (and
+ *        optionally of the radiation library) at a given point.
+ *
+ * Coordinates are the mean mixture fraction, its variance, the scalar
+ * dissipation rate (or the progress variable if \p progvar is true)
+ * and the enthalpy defect.
+ *
+ * \param[in]   progvar  true for the progress variable model
+ * \param[in]   coo      point coordinates in the library
+ * \param[out]  phi      interpolated flamelet library variables
+ * \param[out]  rad      interpolated radiative properties, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_laminar_flamelet_table_interpolate(bool             progvar,
+                                             const cs_real_t  coo[4],
+                                             cs_real_t        phi[],
+                                             cs_real_t        rad[])
+{
+  _stencil_t st;
+
+  int c_max = _stencil(progvar, coo, &st);
+
+  _apply(&st, _tables, phi);
+
+  /* No progress variable source term above its maximum */
+
+  if (c_max && _var_id[5] > -1)
+    phi[_var_id[5]] = 0.;
+
+  if (rad != NULL && _tables[1].val != NULL)
+    _apply(&st, _tables + 1, rad);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate the density of the flamelet library at a given point.
+ *
+ * \param[in]  progvar  true for the progress variable model
+ * \param[in]  coo      point coordinates in the library
+ *
+ * \return  interpolated density
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t
+cs_steady_laminar_flamelet_table_density(bool             progvar,
+                                         const cs_real_t  coo[4])
+{
+  _stencil_t st;
+
+  _stencil(progvar, coo, &st);
+
+  const cs_real_t *t = _tables[0].val;
+  const int rec_size = _tables[0].rec_size;
+  const int i_rho = _var_id[6];
+
+  cs_real_t rho = 0;
+  for (int c = 0; c < st.n_c; c++)
+    rho += st.w[c] * t[(size_t)st.r[c]*rec_size + i_rho];
+
+  return rho;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free flamelet and radiation libraries.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_laminar_flamelet_table_finalize(void)
+{
+  for (int t_id = 0; t_id < 2; t_id++) {
+    _table_t *t = _tables + t_id;
+#if defined(HAVE_MPI) && MPI_VERSION >= 3
+    if (t->win != MPI_WIN_NULL) {
+      MPI_Win_free(&(t->win));
+      t->val = NULL;
+    }
+#endif
+    BFT_FREE(t->val);
+    t->rec_size = 0;
+  }
+
+#if defined(HAVE_MPI) && MPI_VERSION >= 3
+  if (_node_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_node_comm);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,94 @@
+#ifndef __CS_STEADY_LAMINAR_FLAMELET_TABLE_H__
+#define __CS_STEADY_LAMINAR_FLAMELET_TABLE_H__
+
+/*============================================================================
+ * Steady laminar flamelet library storage and interpolation.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate all variables of the flamelet library (and
+ *        optionally of the radiation library) at a given point.
+ *
+ * Coordinates are the mean mixture fraction, its variance, the scalar
+ * dissipation rate (or the progress variable if \p progvar is true)
+ * and the enthalpy defect.
+ *
+ * \param[in]   progvar  true for the progress variable model
+ * \param[in]   coo      point coordinates in the library
+ * \param[out]  phi      interpolated flamelet library variables
+ * \param[out]  rad      interpolated radiative properties, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_laminar_flamelet_table_interpolate(bool             progvar,
+                                             const cs_real_t  coo[4],
+                                             cs_real_t        phi[],
+                                             cs_real_t        rad[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate the density of the flamelet library at a given point.
+ *
+ * \param[in]  progvar  true for the progress variable model
+ * \param[in]  coo      point coordinates in the library
+ *
+ * \return  interpolated density
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t
+cs_steady_laminar_flamelet_table_density(bool             progvar,
+                                         const cs_real_t  coo[4]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free flamelet and radiation libraries.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_laminar_flamelet_table_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_STEADY_LAMINAR_FLAMELET_TABLE_H__ */
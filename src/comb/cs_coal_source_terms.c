@@ -101,6 +101,126 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Gather value arrays of per-class fields, so that class values can be
+ * accessed in the inner loop of a loop on cells.
+ *
+ * parameters:
+ *   n_classes <-- number of classes
+ *   f_ids     <-- field id for each class
+ *   previous  <-- use values at previous time step if true
+ *   vals      --> pointer to values for each class
+ *----------------------------------------------------------------------------*/
+
+static void
+_class_vals(int               n_classes,
+            const int         f_ids[],
+            bool              previous,
+            const cs_real_t  *vals[])
+{
+  for (int class_id = 0; class_id < n_classes; class_id++) {
+    const cs_field_t *f = cs_field_by_id(f_ids[class_id]);
+    vals[class_id] = (previous) ? f->val_pre : f->val;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add devolatilization source term for volatile matter tracer of a given
+ * coal (sum over the classes of that coal of -rho.XCH.GMDV).
+ *
+ * parameters:
+ *   numcha    <-- coal number (1 to n)
+ *   gmdv_ids  <-- devolatilization rate field id for each class
+ *   crom      <-- density
+ *   smbrs     <-> explicit second member
+ *----------------------------------------------------------------------------*/
+
+static void
+_devolatilization_st(int              numcha,
+                     const int        gmdv_ids[],
+                     const cs_real_t  crom[],
+                     cs_real_t        smbrs[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_t *cell_f_vol = cs_glob_mesh_quantities->cell_f_vol;
+
+  const cs_coal_model_t *cm = cs_glob_coal_model;
+
+  int n_cl = 0;
+  int cl_gmdv_ids[CS_COMBUSTION_COAL_MAX_CLASSES];
+  int cl_xch_ids[CS_COMBUSTION_COAL_MAX_CLASSES];
+
+  for (int class_id = 0; class_id < cm->nclacp; class_id++) {
+    if (cm->ichcor[class_id] == numcha) {
+      cl_gmdv_ids[n_cl] = gmdv_ids[class_id];
+      cl_xch_ids[n_cl] = cm->ixch[class_id];
+      n_cl++;
+    }
+  }
+
+  const cs_real_t *cpro_cgd[CS_COMBUSTION_COAL_MAX_CLASSES];
+  const cs_real_t *cvar_xchcl[CS_COMBUSTION_COAL_MAX_CLASSES];
+
+  _class_vals(n_cl, cl_gmdv_ids, false, cpro_cgd);
+  _class_vals(n_cl, cl_xch_ids, false, cvar_xchcl);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_real_t w1 = 0;
+    for (int i = 0; i < n_cl; i++)
+      w1 -= crom[c_id]*cvar_xchcl[i][c_id] * cpro_cgd[i][c_id];
+
+    smbrs[c_id] += cell_f_vol[c_id] * w1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add char burnout source term for the tracer of an heterogeneous
+ * reaction gaseous reactant (same source term as for Xck, to be
+ * conservative).
+ *
+ * parameters:
+ *   gh_ids <-- heterogeneous reaction rate field id for each class
+ *   crom   <-- density
+ *   smbrs  <-> explicit second member
+ *----------------------------------------------------------------------------*/
+
+static void
+_char_burnout_st(const int        gh_ids[],
+                 const cs_real_t  crom[],
+                 cs_real_t        smbrs[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_t *cell_f_vol = cs_glob_mesh_quantities->cell_f_vol;
+
+  const cs_coal_model_t *cm = cs_glob_coal_model;
+  const int n_cl = cm->nclacp;
+
+  const cs_real_t *cpro_gh[CS_COMBUSTION_COAL_MAX_CLASSES];
+  const cs_real_t *cvar_xckcl[CS_COMBUSTION_COAL_MAX_CLASSES];
+  const cs_real_t *cvara_xckcl[CS_COMBUSTION_COAL_MAX_CLASSES];
+
+  _class_vals(n_cl, gh_ids, false, cpro_gh);
+  _class_vals(n_cl, cm->ixck, false, cvar_xckcl);
+  _class_vals(n_cl, cm->ixck, true, cvara_xckcl);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_real_t w1 = 0;
+    for (int i = 0; i < n_cl; i++) {
+      const cs_real_t xck_a = cvara_xckcl[i][c_id];
+      if (xck_a > cs_coal_epsilon) {
+        w1 -=  crom[c_id]*cpro_gh[i][c_id]
+               * (   pow(xck_a, 2./3.)
+                  + 2./3.*(cvar_xckcl[i][c_id] - xck_a)
+                         / pow(xck_a, 1./3.));
+      }
+    }
+
+    smbrs[c_id] += cell_f_vol[c_id] * w1;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute variance source terms for pulverized coal flame.
@@ -184,21 +304,29 @@ _coal_fp2st(const cs_field_t  *fld_scal,
     BFT_MALLOC(x1, n_cells_ext, cs_real_t);
     cs_array_real_set_scalar(n_cells_ext, 1.0, x1);
 
-    for (int class_id = 0; class_id < cm->nclacp; class_id++) {
-      const cs_real_t xmash = cm->xmash[class_id];
-      const cs_real_t *cvar_xchcl = cs_field_by_id(cm->ixch[class_id])->val;
-      const cs_real_t *cvar_xckcl = cs_field_by_id(cm->ixck[class_id])->val;
-      const cs_real_t *cvar_xnpcl = cs_field_by_id(cm->inp[class_id])->val;
-      const cs_real_t *cvar_xwtcl = NULL;
-      if (cm->type == CS_COMBUSTION_COAL_WITH_DRYING)
-        cvar_xwtcl = cs_field_by_id(cm->ixwt[class_id])->val;
+    const int n_cl = cm->nclacp;
+    const bool drying = (cm->type == CS_COMBUSTION_COAL_WITH_DRYING);
+    const cs_real_t *xmash = cm->xmash;
 
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        x1[c_id] -= (  cvar_xchcl[c_id]
-                     + cvar_xckcl[c_id]
-                     + cvar_xnpcl[c_id]*xmash);
-        if (cvar_xwtcl != NULL)
-          x1[c_id] -= cvar_xwtcl[c_id];
+    const cs_real_t *cvar_xchcl[CS_COMBUSTION_COAL_MAX_CLASSES];
+    const cs_real_t *cvar_xckcl[CS_COMBUSTION_COAL_MAX_CLASSES];
+    const cs_real_t *cvar_xnpcl[CS_COMBUSTION_COAL_MAX_CLASSES];
+    const cs_real_t *cvar_xwtcl[CS_COMBUSTION_COAL_MAX_CLASSES];
+
+    _class_vals(n_cl, cm->ixch, false, cvar_xchcl);
+    _class_vals(n_cl, cm->ixck, false, cvar_xckcl);
+    _class_vals(n_cl, cm->inp, false, cvar_xnpcl);
+    if (drying)
+      _class_vals(n_cl, cm->ixwt, false, cvar_xwtcl);
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int i = 0; i < n_cl; i++) {
+        x1[c_id] -= (  cvar_xchcl[i][c_id]
+                     + cvar_xckcl[i][c_id]
+                     + cvar_xnpcl[i][c_id]*xmash[i]);
+        if (drying)
+          x1[c_id] -= cvar_xwtcl[i][c_id];
       }
     }
 
@@ -1108,14 +1236,20 @@ cs_coal_source_terms_scalar(int        fld_id,
 
     /* Explicit contribution due to implicit source term on particle
        * class enthalpy */
-    for (int class_id = 0; class_id < cm->nclacp; class_id++) {
-      const cs_real_t *cpro_rovsdt2 = cs_field_by_id(cm->igmtr[class_id])->val;
-      const cs_real_t *cvar_x2h2 = cs_field_by_id(cm->ih2[class_id])->val;
-      const cs_real_t *cvara_x2h2 = cs_field_by_id(cm->ih2[class_id])->val_pre;
+    const int n_cl = cm->nclacp;
+    const cs_real_t *cpro_rovsdt2[CS_COMBUSTION_COAL_MAX_CLASSES];
+    const cs_real_t *cvar_x2h2[CS_COMBUSTION_COAL_MAX_CLASSES];
+    const cs_real_t *cvara_x2h2[CS_COMBUSTION_COAL_MAX_CLASSES];
 
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        smbrs[c_id] += cpro_rovsdt2[c_id]*(cvar_x2h2[c_id] - cvara_x2h2[c_id]);
-      }
+    _class_vals(n_cl, cm->igmtr, false, cpro_rovsdt2);
+    _class_vals(n_cl, cm->ih2, false, cvar_x2h2);
+    _class_vals(n_cl, cm->ih2, true, cvara_x2h2);
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int i = 0; i < n_cl; i++)
+        smbrs[c_id] += cpro_rovsdt2[i][c_id]*(  cvar_x2h2[i][c_id]
+                                              - cvara_x2h2[i][c_id]);
     }
 
   }
@@ -1127,27 +1261,12 @@ cs_coal_source_terms_scalar(int        fld_id,
     if (eqp->verbosity >= 1)
       bft_printf(_(log_st_fmt), fld_scal->name);
 
-    /* Calculation of GMDEV1 = - Sum (rho.XCH.GMDV1) > 0  --> W1 */
+    /* Calculation of GMDEV1 = - Sum (rho.XCH.GMDV1) > 0  --> W1
+       and contribution of interfacial source term to balances */
 
     int numcha = fld_id - cm->if1m[0] + 1;
 
-    cs_array_real_fill_zero(n_cells, w1);
-    for (int class_id = 0; class_id < cm->nclacp; class_id++) {
-      const cs_real_t *cpro_cgd1 = cs_field_by_id(cm->igmdv1[class_id])->val;
-      const cs_real_t *cvar_xchcl = cs_field_by_id(cm->ixch[class_id])->val;
-
-      if (cm->ichcor[class_id] == numcha) {
-        for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-          w1[c_id] -= crom[c_id]*cvar_xchcl[c_id] * cpro_cgd1[c_id];
-        }
-      }
-    }
-
-    /* Contribution of interfacial source term to balances */
-
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      smbrs[c_id] += cell_f_vol[c_id] * w1[c_id];
-    }
+    _devolatilization_st(numcha, cm->igmdv1, crom, smbrs);
 
   }
 
@@ -1158,26 +1277,12 @@ cs_coal_source_terms_scalar(int        fld_id,
     if (eqp->verbosity >= 1)
       bft_printf(_(log_st_fmt), fld_scal->name);
 
-    /* Calculation of GMDEV2 = - Sum (rho.XCH.GMDV2) > 0 --> W1 */
+    /* Calculation of GMDEV2 = - Sum (rho.XCH.GMDV2) > 0 --> W1
+       and contribution of interfacial source term to explicit balance */
 
     int numcha = fld_id - cm->if2m[0] + 1;
-    cs_array_real_fill_zero(n_cells, w1);
-    for (int class_id = 0; class_id < cm->nclacp; class_id++) {
-      const cs_real_t *cpro_cgd2 = cs_field_by_id(cm->igmdv2[class_id])->val;
-      const cs_real_t *cvar_xchcl = cs_field_by_id(cm->ixch[class_id])->val;
-
-      if (cm->ichcor[class_id] == numcha) {
-        for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-          w1[c_id] -= crom[c_id]*cvar_xchcl[c_id] * cpro_cgd2[c_id];
-        }
-      }
-    }
 
-    /* Contribution of interfacial source term to explicit balance */
-
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      smbrs[c_id] += cell_f_vol[c_id] * w1[c_id];
-    }
+    _devolatilization_st(numcha, cm->igmdv2, crom, smbrs);
 
   }
 
@@ -1190,26 +1295,7 @@ cs_coal_source_terms_scalar(int        fld_id,
     if (eqp->verbosity >= 1)
       bft_printf(_(log_st_fmt), fld_scal->name);
 
-    cs_array_real_fill_zero(n_cells, w1);
-    for (int class_id = 0; class_id < cm->nclacp; class_id++) {
-      const cs_real_t *cpro_cght = cs_field_by_id(cm->igmhet[class_id])->val;
-      const cs_real_t *cvar_xckcl = cs_field_by_id(cm->ixck[class_id])->val;
-      const cs_real_t *cvara_xckcl = cs_field_by_id(cm->ixck[class_id])->val_pre;
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        if (cvara_xckcl[c_id] > cs_coal_epsilon) {
-          w1[c_id] -=  crom[c_id]*cpro_cght[c_id]
-                       * (   pow(cvara_xckcl[c_id], 2./3.)
-                          + 2./3.*(cvar_xckcl[c_id] - cvara_xckcl[c_id])
-                                 / pow(cvara_xckcl[c_id], 1./3.));
-        }
-      }
-    }
-
-    /* Contribution of interfacial source term to balances */
-
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      smbrs[c_id] += cell_f_vol[c_id] * w1[c_id];
-    }
+    _char_burnout_st(cm->igmhet, crom, smbrs);
 
   }
 
@@ -1222,26 +1308,7 @@ cs_coal_source_terms_scalar(int        fld_id,
     if (eqp->verbosity >= 1)
       bft_printf(_(log_st_fmt), fld_scal->name);
 
-    cs_array_real_fill_zero(n_cells, w1);
-    for (int class_id = 0; class_id < cm->nclacp; class_id++) {
-      const cs_real_t *cpro_ghco2 = cs_field_by_id(cm->ighco2[class_id])->val;
-      const cs_real_t *cvar_xckcl = cs_field_by_id(cm->ixck[class_id])->val;
-      const cs_real_t *cvara_xckcl = cs_field_by_id(cm->ixck[class_id])->val_pre;
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        if (cvara_xckcl[c_id] > cs_coal_epsilon) {
-          w1[c_id] -=  crom[c_id]*cpro_ghco2[c_id]
-                       * (   pow(cvara_xckcl[c_id], 2./3.)
-                          + 2./3.*(cvar_xckcl[c_id] - cvara_xckcl[c_id])
-                                 / pow(cvara_xckcl[c_id], 1./3.));
-        }
-      }
-    }
-
-    /* Contribution of interfacial source term to balances */
-
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      smbrs[c_id] += cell_f_vol[c_id] * w1[c_id];
-    }
+    _char_burnout_st(cm->ighco2, crom, smbrs);
 
   }
 
@@ -1254,26 +1321,7 @@ cs_coal_source_terms_scalar(int        fld_id,
     if (eqp->verbosity >= 1)
       bft_printf(_(log_st_fmt), fld_scal->name);
 
-    cs_array_real_fill_zero(n_cells, w1);
-    for (int class_id = 0; class_id < cm->nclacp; class_id++) {
-      const cs_real_t *cpro_ghh2o = cs_field_by_id(cm->ighh2o[class_id])->val;
-      const cs_real_t *cvar_xckcl = cs_field_by_id(cm->ixck[class_id])->val;
-      const cs_real_t *cvara_xckcl = cs_field_by_id(cm->ixck[class_id])->val_pre;
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        if (cvara_xckcl[c_id] > cs_coal_epsilon) {
-          w1[c_id] -=  crom[c_id]*cpro_ghh2o[c_id]
-                       * (   pow(cvara_xckcl[c_id], 2./3.)
-                          + 2./3.*(cvar_xckcl[c_id] - cvara_xckcl[c_id])
-                                 / pow(cvara_xckcl[c_id], 1./3.));
-        }
-      }
-    }
-
-    /* Contribution of interfacial source term to balances */
-
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      smbrs[c_id] += cell_f_vol[c_id] * w1[c_id];
-    }
+    _char_burnout_st(cm->ighh2o, crom, smbrs);
 
   }
 
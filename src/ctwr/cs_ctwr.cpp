@@ -110,12 +110,67 @@ static int               _n_ct_zones_max = 0;
 static int               _n_ct_zones     = 0;
 static cs_ctwr_zone_t  **_ct_zone   = NULL;
 
+/* Packing zone id of each cell (with ghosts), -1 outside packings,
+   and interior faces adjacent to at least one packing cell */
+
+static int              *_packing_cell       = NULL;
+static cs_lnum_t         _n_packing_i_faces  = 0;
+static cs_lnum_t        *_packing_i_face_ids = NULL;
+
 /* Restart file */
 
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Build the packing zone id of each cell and the list of interior faces
+ * adjacent to packing cells.
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_packing_lists(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  BFT_MALLOC(_packing_cell, n_cells_ext, int);
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    _packing_cell[i] = -1;
+
+  for (int ict = 0; ict < _n_ct_zones; ict++) {
+    cs_ctwr_zone_t *ct = _ct_zone[ict];
+    if (ct->type == CS_CTWR_INJECTION)
+      continue;
+
+    const cs_zone_t *z = cs_volume_zone_by_name(ct->name);
+    for (cs_lnum_t i = 0; i < z->n_elts; i++)
+      _packing_cell[z->elt_ids[i]] = ict;
+  }
+
+  if (m->halo != NULL)
+    cs_halo_sync_untyped(m->halo, CS_HALO_STANDARD, sizeof(int),
+                         _packing_cell);
+
+  _n_packing_i_faces = 0;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (   _packing_cell[i_face_cells[f_id][0]] > -1
+        || _packing_cell[i_face_cells[f_id][1]] > -1)
+      _n_packing_i_faces++;
+  }
+
+  BFT_MALLOC(_packing_i_face_ids, _n_packing_i_faces, cs_lnum_t);
+
+  _n_packing_i_faces = 0;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (   _packing_cell[i_face_cells[f_id][0]] > -1
+        || _packing_cell[i_face_cells[f_id][1]] > -1)
+      _packing_i_face_ids[_n_packing_i_faces++] = f_id;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Additional output for cooling towers
  *
@@ -327,6 +382,41 @@ cs_get_glob_ctwr_n_zones(void)
   return &_n_ct_zones;
 }
 
+/*----------------------------------------------------------------------------
+ * Provide access to the packing zone id of each cell (including ghost
+ * cells), -1 for cells outside packing zones
+ *----------------------------------------------------------------------------*/
+
+const int *
+cs_ctwr_get_packing_cell_zone_ids(void)
+{
+  if (_packing_cell == NULL)
+    _build_packing_lists();
+
+  return _packing_cell;
+}
+
+/*----------------------------------------------------------------------------
+ * Provide access to the list of interior faces adjacent to packing cells
+ *
+ * parameters:
+ *   n_faces --> number of faces in list
+ *
+ * returns:
+ *   pointer to list of interior face ids
+ *----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_ctwr_get_packing_i_faces(cs_lnum_t  *n_faces)
+{
+  if (_packing_cell == NULL)
+    _build_packing_lists();
+
+  *n_faces = _n_packing_i_faces;
+
+  return _packing_i_face_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define a cooling tower exchange zone
@@ -712,6 +802,10 @@ cs_ctwr_all_destroy(void)
   _n_ct_zones = 0;
 
   BFT_FREE(_ct_zone);
+
+  BFT_FREE(_packing_cell);
+  BFT_FREE(_packing_i_face_ids);
+  _n_packing_i_faces = 0;
 }
 
 /*----------------------------------------------------------------------------*/
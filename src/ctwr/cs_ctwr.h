@@ -194,6 +194,27 @@ cs_get_glob_ctwr_zone(void);
 int *
 cs_get_glob_ctwr_n_zones(void);
 
+/*----------------------------------------------------------------------------
+ * Provide access to the packing zone id of each cell (including ghost
+ * cells), -1 for cells outside packing zones
+ *----------------------------------------------------------------------------*/
+
+const int *
+cs_ctwr_get_packing_cell_zone_ids(void);
+
+/*----------------------------------------------------------------------------
+ * Provide access to the list of interior faces adjacent to packing cells
+ *
+ * parameters:
+ *   n_faces --> number of faces in list
+ *
+ * returns:
+ *   pointer to list of interior face ids
+ *----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_ctwr_get_packing_i_faces(cs_lnum_t  *n_faces);
+
 
 /*----------------------------------------------------------------------------*/
 /*!
@@ -521,7 +521,6 @@ cs_ctwr_source_term(int              f_id,
   const cs_mesh_t *m = cs_glob_mesh;
   const cs_lnum_2_t *i_face_cells
     = (const cs_lnum_2_t *)(m->i_face_cells);
-  const cs_lnum_t n_i_faces = m->n_i_faces;
 
   const cs_real_t *cell_f_vol = cs_glob_mesh_quantities->cell_f_vol;
 
@@ -604,12 +603,8 @@ cs_ctwr_source_term(int              f_id,
   thermal_power_pack = cs_field_by_name("thermal_power_packing")->val;
   thermal_power_rain = cs_field_by_name("thermal_power_rain")->val;
 
-  /* Table to track cells belonging to packing zones */
-  cs_lnum_t  *packing_cell;
-  BFT_MALLOC(packing_cell, m->n_cells_with_ghosts, int);
-# pragma omp parallel for if (m->n_cells> CS_THR_MIN)
-  for (cs_lnum_t cell_id = 0; cell_id < m->n_cells_with_ghosts; cell_id++)
-    packing_cell[cell_id] = -1;
+  /* Packing zone id of cells (-1 outside packing zones) */
+  const int *packing_cell = cs_ctwr_get_packing_cell_zone_ids();
 
   /* Air / fluid properties */
   cs_real_t cp_d = fp->cp0;
@@ -667,9 +662,6 @@ cs_ctwr_source_term(int              f_id,
       for (cs_lnum_t j = 0; j < ct->n_cells; j++) {
 
         cs_lnum_t cell_id = ze_cell_ids[j];
-        /* Identify packing cells ids */
-        if (ct->type != CS_CTWR_INJECTION)
-          packing_cell[cell_id] = ict;
 
         /* Compute cell reference pressure */
         cs_real_t pphy = cs_ctwr_compute_reference_pressure(cell_id,
@@ -856,203 +848,216 @@ cs_ctwr_source_term(int              f_id,
       cs_real_t *y_rain = (cs_real_t *)cfld_yp->val;
       cs_real_t *t_l_r = (cs_real_t *)cs_field_by_name("temp_l_r")->val;
 
+      /* Compact list of cells containing rain, which usually
+         cover a small part of the domain */
+
+      cs_lnum_t n_rain_cells = 0;
+      cs_lnum_t *rain_cell_ids;
+      BFT_MALLOC(rain_cell_ids, m->n_cells, cs_lnum_t);
+
       for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id++) {
+        if (y_rain[cell_id] > 0.)
+          rain_cell_ids[n_rain_cells++] = cell_id;
+      }
 
-        if (y_rain[cell_id] > 0.) {
+#     pragma omp parallel for if (n_rain_cells > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_rain_cells; i++) {
 
-          /* Compute cell reference pressure */
-          cs_real_t pphy = cs_ctwr_compute_reference_pressure
-                            (cell_id, p0, meteo_pressure);
+        cs_lnum_t cell_id = rain_cell_ids[i];
 
-          /* For correlations, T_h cannot be greater than T_p */
-          cs_real_t temp_h = CS_MIN(t_h[cell_id], t_l_r[cell_id]);
+        /* Compute cell reference pressure */
+        cs_real_t pphy = cs_ctwr_compute_reference_pressure
+                          (cell_id, p0, meteo_pressure);
 
-          /* Saturation humidity at the temperature of the humid air */
-          cs_real_t x_s_th = cs_air_x_sat(temp_h, pphy);
+        /* For correlations, T_h cannot be greater than T_p */
+        cs_real_t temp_h = CS_MIN(t_h[cell_id], t_l_r[cell_id]);
 
-          /* Saturation humidity at the temperature of the rain drop  */
-          cs_real_t x_s_tl = cs_air_x_sat(t_l_r[cell_id], pphy);
+        /* Saturation humidity at the temperature of the humid air */
+        cs_real_t x_s_th = cs_air_x_sat(temp_h, pphy);
 
-          cs_real_3_t *drift_vel_rain
-            = (cs_real_3_t *restrict)(cfld_drift_vel->val);
-          cs_real_t drift_vel_mag = cs_math_3_norm(drift_vel_rain[cell_id]);
+        /* Saturation humidity at the temperature of the rain drop  */
+        cs_real_t x_s_tl = cs_air_x_sat(t_l_r[cell_id], pphy);
 
-          /* Lewis factor computation */
-          cs_real_t le_f = _lewis_factor(evap_model,
-                                         molmassrat,
-                                         x[cell_id],
-                                         x_s_tl);
+        cs_real_3_t *drift_vel_rain
+          = (cs_real_3_t *restrict)(cfld_drift_vel->val);
+        cs_real_t drift_vel_mag = cs_math_3_norm(drift_vel_rain[cell_id]);
 
-          cs_real_t cp_h = cs_air_cp_humidair(x[cell_id], x_s[cell_id]);
+        /* Lewis factor computation */
+        cs_real_t le_f = _lewis_factor(evap_model,
+                                       molmassrat,
+                                       x[cell_id],
+                                       x_s_tl);
 
-          /* Rain droplets Reynolds number */
-          cs_real_t rey = rho_h[cell_id] * drift_vel_mag * droplet_diam / visc;
+        cs_real_t cp_h = cs_air_cp_humidair(x[cell_id], x_s[cell_id]);
 
-          /* Prandtl number */
-          cs_real_t pr = cp_h * visc / lambda_h;
+        /* Rain droplets Reynolds number */
+        cs_real_t rey = rho_h[cell_id] * drift_vel_mag * droplet_diam / visc;
 
-          /* Nusselt number correlations */
-          /* Ranz-Marshall or Hughmark when rey <= 776.06 && pr <= 250. */
-          cs_real_t nusselt = 2. + 0.6 * sqrt(rey) * pow(pr,(1./3.));
-          /* Hughmark when rey > 776.06 && pr <= 250. */
-          if (rey > 776.06 && pr <= 250.) {
-            nusselt = 2. + 0.27 * pow(rey, 0.62) * pow(pr,(1./3.));
-          }
+        /* Prandtl number */
+        cs_real_t pr = cp_h * visc / lambda_h;
 
-          /* Convective exchange coefficient 'a_c' */
-          cs_real_t a_c = (nusselt * lambda_h) / droplet_diam;
-
-          /* beta_x coefficient */
-          cs_real_t beta_x = a_c / (le_f * cp_h);
-
-          /* Exchange surface area per unit volume based on the total droplets
-           * surface in the cell
-           * NOTE: Use rho_h to compute the number of particles per unit volume
-           * since conservation equation for Y_p based on rho_h
-           *   --> Should really be rho_mixture!?
-           * Use the symmetric relationship:
-           *   a_i = 6*alpha_p*(1.-alpha_p)/droplet_diam
-           * where alpha_p is the droplets volume fraction
-           * - this kills transfer when there is only one phase (pure humid air
-           *   or pure rain) */
-          cs_real_t vol_frac_rain = y_rain[cell_id] * rho_m[cell_id] / rho_l;
-          cs_real_t vol_frac_rain_oy = rho_m[cell_id] / rho_l;
-
-          if (vol_frac_rain >= 1.0)
-            vol_frac_rain = 1.0;
-          cs_real_t a_i =  6.0 * vol_frac_rain * (1.0 - vol_frac_rain)
-                           / droplet_diam;
-          cs_real_t a_i_oy = 6.0 * vol_frac_rain_oy * (1.0 - vol_frac_rain)
-                           / droplet_diam;
-
-          /* Evaporation coefficient 'Beta_x' times exchange surface 'ai' */
-          cs_real_t beta_x_ai = beta_x * a_i;
-          cs_real_t beta_x_ai_oy = beta_x * a_i_oy;
-
-          /* Source terms for the different equations */
-
-          /* Humid air mass source term */
-          cs_real_t mass_source = 0.0;
-          cs_real_t mass_source_oy = 0.0;
+        /* Nusselt number correlations */
+        /* Ranz-Marshall or Hughmark when rey <= 776.06 && pr <= 250. */
+        cs_real_t nusselt = 2. + 0.6 * sqrt(rey) * pow(pr,(1./3.));
+        /* Hughmark when rey > 776.06 && pr <= 250. */
+        if (rey > 776.06 && pr <= 250.) {
+          nusselt = 2. + 0.27 * pow(rey, 0.62) * pow(pr,(1./3.));
+        }
 
-          if (x[cell_id] <= x_s_th) {
-            mass_source = beta_x_ai * (x_s_tl - x[cell_id]);
-            mass_source_oy = beta_x_ai_oy * (x_s_tl - x[cell_id]);
-          }
-          else {
-            mass_source = beta_x_ai * (x_s_tl - x_s_th);
-            mass_source_oy = beta_x_ai_oy * (x_s_tl - x_s_th);
-          }
-          mass_source = CS_MAX(mass_source, 0.);
-          mass_source_oy = CS_MAX(mass_source_oy, 0.);
+        /* Convective exchange coefficient 'a_c' */
+        cs_real_t a_c = (nusselt * lambda_h) / droplet_diam;
+
+        /* beta_x coefficient */
+        cs_real_t beta_x = a_c / (le_f * cp_h);
+
+        /* Exchange surface area per unit volume based on the total droplets
+         * surface in the cell
+         * NOTE: Use rho_h to compute the number of particles per unit volume
+         * since conservation equation for Y_p based on rho_h
+         *   --> Should really be rho_mixture!?
+         * Use the symmetric relationship:
+         *   a_i = 6*alpha_p*(1.-alpha_p)/droplet_diam
+         * where alpha_p is the droplets volume fraction
+         * - this kills transfer when there is only one phase (pure humid air
+         *   or pure rain) */
+        cs_real_t vol_frac_rain = y_rain[cell_id] * rho_m[cell_id] / rho_l;
+        cs_real_t vol_frac_rain_oy = rho_m[cell_id] / rho_l;
+
+        if (vol_frac_rain >= 1.0)
+          vol_frac_rain = 1.0;
+        cs_real_t a_i =  6.0 * vol_frac_rain * (1.0 - vol_frac_rain)
+                         / droplet_diam;
+        cs_real_t a_i_oy = 6.0 * vol_frac_rain_oy * (1.0 - vol_frac_rain)
+                         / droplet_diam;
+
+        /* Evaporation coefficient 'Beta_x' times exchange surface 'ai' */
+        cs_real_t beta_x_ai = beta_x * a_i;
+        cs_real_t beta_x_ai_oy = beta_x * a_i_oy;
 
-          cs_real_t vol_mass_source = mass_source * cell_f_vol[cell_id];
-          cs_real_t vol_mass_source_oy = mass_source_oy * cell_f_vol[cell_id];
+        /* Source terms for the different equations */
 
-          cs_real_t vol_beta_x_ai = beta_x_ai * cell_f_vol[cell_id];
-          /* Note: global bulk mass - continuity is taken with
-           * cs_ctwr_volume_mass_injection_dof_func */
+        /* Humid air mass source term */
+        cs_real_t mass_source = 0.0;
+        cs_real_t mass_source_oy = 0.0;
 
-          /* Water (vapor + condensate) in gas mass fraction equation
-             except rain */
-          if (f_id == (CS_F_(ym_w)->id)) {
-            exp_st[cell_id] += vol_mass_source * (1. - f_var[cell_id]);
-            imp_st[cell_id] += vol_mass_source;
+        if (x[cell_id] <= x_s_th) {
+          mass_source = beta_x_ai * (x_s_tl - x[cell_id]);
+          mass_source_oy = beta_x_ai_oy * (x_s_tl - x[cell_id]);
+        }
+        else {
+          mass_source = beta_x_ai * (x_s_tl - x_s_th);
+          mass_source_oy = beta_x_ai_oy * (x_s_tl - x_s_th);
+        }
+        mass_source = CS_MAX(mass_source, 0.);
+        mass_source_oy = CS_MAX(mass_source_oy, 0.);
+
+        cs_real_t vol_mass_source = mass_source * cell_f_vol[cell_id];
+        cs_real_t vol_mass_source_oy = mass_source_oy * cell_f_vol[cell_id];
+
+        cs_real_t vol_beta_x_ai = beta_x_ai * cell_f_vol[cell_id];
+        /* Note: global bulk mass - continuity is taken with
+         * cs_ctwr_volume_mass_injection_dof_func */
 
-            /* Saving evaporation rate for post-processing */
-            evap_rate_rain[cell_id] = mass_source;
+        /* Water (vapor + condensate) in gas mass fraction equation
+           except rain */
+        if (f_id == (CS_F_(ym_w)->id)) {
+          exp_st[cell_id] += vol_mass_source * (1. - f_var[cell_id]);
+          imp_st[cell_id] += vol_mass_source;
+
+          /* Saving evaporation rate for post-processing */
+          evap_rate_rain[cell_id] = mass_source;
+        }
+
+        /* Rain drop mass equation (solve in drift model form) */
+        else if (f_id == cfld_yp->id) {
+          exp_st[cell_id] -= vol_mass_source_oy * y_rain[cell_id];
+          imp_st[cell_id] += vol_mass_source_oy;
+        }
+
+        /* Humid air temperature equation */
+        else if (f_id == (CS_F_(t)->id)) {
+          /* Because the writing is in a non-conservative form */
+          cs_real_t l_imp_st = 0.; //vol_mass_source * cp_h;
+          cs_real_t l_exp_st = 0.;
+
+          cs_real_t coef = 1.;
+          cs_real_t t_shift = 0.;
+          if (cs_glob_physical_model_flag[CS_ATMOSPHERIC] == CS_ATMO_HUMID) {
+            /* Coefficient to convert T into theta_l */
+            coef = pow((ps / pphy), rscp);
+            t_shift = cs_physical_constants_celsius_to_kelvin;
           }
 
-          /* Rain drop mass equation (solve in drift model form) */
-          else if (f_id == cfld_yp->id) {
-            exp_st[cell_id] -= vol_mass_source_oy * y_rain[cell_id];
-            imp_st[cell_id] += vol_mass_source_oy;
+          if (x[cell_id] <= x_s_th) {
+            /* Implicit and explicit terms for temperature T */
+            l_imp_st += vol_beta_x_ai * (le_f * cp_h
+                                         + (x_s_tl - x[cell_id]) * cp_v
+                                           / (1. + x[cell_id]));
+            l_exp_st = l_imp_st * (coef * (t_l_p[cell_id] + t_shift)
+                                   - f_var[cell_id]);
+          }
+          else {
+            /* Implicit and explicit terms for temperature T */
+            l_imp_st += vol_beta_x_ai * (le_f * cp_h + (x_s_tl - x_s_th) * cp_l
+                / (1. + x[cell_id]));
+            l_exp_st =   vol_beta_x_ai
+                       * (  le_f * cp_h * coef * (t_l_p[cell_id] + t_shift)
+                          + (  x_s_tl - x_s_th)
+                             * (cp_v * coef * (t_l_p[cell_id] + t_shift ))
+                             / (1. + x[cell_id]))
+                       - l_imp_st * f_var[cell_id];
+          }
+          /* If humid atmosphere model, temperature is liquid potential
+           * temperature theta_l */
+          if (cs_glob_physical_model_flag[CS_ATMOSPHERIC] == CS_ATMO_HUMID) {
+            l_exp_st -= l_imp_st * coef * (hv0 / cp_d) * yw_liq->val[cell_id];
           }
+          imp_st[cell_id] += CS_MAX(l_imp_st, 0.);
+          exp_st[cell_id] += l_exp_st;
+        }
+
+        /* Rain enthalpy equation (solve in drift model form)
+         * NB: The actual variable being solved is y_rain x h_rain */
+        else if (f_id == cfld_yh_rain->id) {
+          /* Liquid temperature in Kelvin */
+          cs_real_t t_l_k = t_l_r[cell_id]
+            + cs_physical_constants_celsius_to_kelvin;
 
-          /* Humid air temperature equation */
-          else if (f_id == (CS_F_(t)->id)) {
-            /* Because the writing is in a non-conservative form */
-            cs_real_t l_imp_st = 0.; //vol_mass_source * cp_h;
-            cs_real_t l_exp_st = 0.;
-
-            cs_real_t coef = 1.;
-            cs_real_t t_shift = 0.;
-            if (cs_glob_physical_model_flag[CS_ATMOSPHERIC] == CS_ATMO_HUMID) {
-              /* Coefficient to convert T into theta_l */
-              coef = pow((ps / pphy), rscp);
-              t_shift = cs_physical_constants_celsius_to_kelvin;
-            }
-
-            if (x[cell_id] <= x_s_th) {
-              /* Implicit and explicit terms for temperature T */
-              l_imp_st += vol_beta_x_ai * (le_f * cp_h
-                                           + (x_s_tl - x[cell_id]) * cp_v
-                                             / (1. + x[cell_id]));
-              l_exp_st = l_imp_st * (coef * (t_l_p[cell_id] + t_shift)
-                                     - f_var[cell_id]);
-            }
-            else {
-              /* Implicit and explicit terms for temperature T */
-              l_imp_st += vol_beta_x_ai * (le_f * cp_h + (x_s_tl - x_s_th) * cp_l
-                  / (1. + x[cell_id]));
-              l_exp_st =   vol_beta_x_ai
-                         * (  le_f * cp_h * coef * (t_l_p[cell_id] + t_shift)
-                            + (  x_s_tl - x_s_th)
-                               * (cp_v * coef * (t_l_p[cell_id] + t_shift ))
-                               / (1. + x[cell_id]))
-                         - l_imp_st * f_var[cell_id];
-            }
-            /* If humid atmosphere model, temperature is liquid potential
-             * temperature theta_l */
-            if (cs_glob_physical_model_flag[CS_ATMOSPHERIC] == CS_ATMO_HUMID) {
-              l_exp_st -= l_imp_st * coef * (hv0 / cp_d) * yw_liq->val[cell_id];
-            }
-            imp_st[cell_id] += CS_MAX(l_imp_st, 0.);
-            exp_st[cell_id] += l_exp_st;
+          cs_real_t l_exp_st = 0.;
+          cs_real_t l_imp_st = 0.;
+
+          if (x[cell_id] <= x_s_th) {
+            /* Explicit term */
+            l_exp_st -= vol_beta_x_ai * ((x_s_tl - x[cell_id])
+                * (cp_v * t_l_k + hv0)
+                + le_f * cp_h
+                * (t_l_r[cell_id] - t_h[cell_id]));
+          }
+          /* Over saturated */
+          else {
+            cs_real_t coefh = le_f * cp_h;
+            /* Explicit term */
+            l_exp_st +=   vol_beta_x_ai
+                        * (  coefh * (t_h[cell_id] - t_l_r[cell_id])
+                           +   (x_s_tl - x_s_th) / (1. + x[cell_id])
+                             * (  cp_l * t_h[cell_id]
+                                - (cp_v * t_l_r[cell_id] + hv0)));
           }
+          /* Because we deal with an increment */
+          exp_st[cell_id] += l_exp_st;
+          imp_st[cell_id] += CS_MAX(l_imp_st, 0.);
 
-          /* Rain enthalpy equation (solve in drift model form)
-           * NB: The actual variable being solved is y_rain x h_rain */
-          else if (f_id == cfld_yh_rain->id) {
-            /* Liquid temperature in Kelvin */
-            cs_real_t t_l_k = t_l_r[cell_id]
-              + cs_physical_constants_celsius_to_kelvin;
-
-            cs_real_t l_exp_st = 0.;
-            cs_real_t l_imp_st = 0.;
-
-            if (x[cell_id] <= x_s_th) {
-              /* Explicit term */
-              l_exp_st -= vol_beta_x_ai * ((x_s_tl - x[cell_id])
-                  * (cp_v * t_l_k + hv0)
-                  + le_f * cp_h
-                  * (t_l_r[cell_id] - t_h[cell_id]));
-            }
-            /* Over saturated */
-            else {
-              cs_real_t coefh = le_f * cp_h;
-              /* Explicit term */
-              l_exp_st +=   vol_beta_x_ai
-                          * (  coefh * (t_h[cell_id] - t_l_r[cell_id])
-                             +   (x_s_tl - x_s_th) / (1. + x[cell_id])
-                               * (  cp_l * t_h[cell_id]
-                                  - (cp_v * t_l_r[cell_id] + hv0)));
-            }
-            /* Because we deal with an increment */
-            exp_st[cell_id] += l_exp_st;
-            imp_st[cell_id] += CS_MAX(l_imp_st, 0.);
-
-            /* Saving thermal power for post-processing */
-            if (t_l_r[cell_id] > 0.) {
-              thermal_power_rain[cell_id]
-                = -(l_exp_st + l_imp_st * f_var[cell_id])
-                  / cell_f_vol[cell_id];
-            }
+          /* Saving thermal power for post-processing */
+          if (t_l_r[cell_id] > 0.) {
+            thermal_power_rain[cell_id]
+              = -(l_exp_st + l_imp_st * f_var[cell_id])
+                / cell_f_vol[cell_id];
           }
+        }
 
-        } /* End if (y_rain > 0) */
+      } /* End loop over rain cells */
 
-      } /* End loop over all the cells of the domain */
+      BFT_FREE(rain_cell_ids);
     }
   } /* End evaporation model active */
 
@@ -1081,63 +1086,65 @@ cs_ctwr_source_term(int              f_id,
      * better not use it for the moment */
     if  (ct_opt->rain_to_packing) {
       //TODO create list of inlet_faces as we do for outlet faces
-      for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+      cs_lnum_t n_packing_i_faces = 0;
+      const cs_lnum_t *packing_i_face_ids
+        = cs_ctwr_get_packing_i_faces(&n_packing_i_faces);
+
+      /* Loop on faces for which one of neigh. cells is in packing */
+      for (cs_lnum_t i = 0; i < n_packing_i_faces; i++) {
+        cs_lnum_t face_id = packing_i_face_ids[i];
         cs_lnum_t cell_id_0 = i_face_cells[face_id][0];
         cs_lnum_t cell_id_1 = i_face_cells[face_id][1];
 
-        /* one of neigh. cells is in packing */
-        if (packing_cell[cell_id_0] != -1 || packing_cell[cell_id_1] != -1) {
-
-          /* Rain sink term in packing zones */
-          //TODO : Add rain leak portion inside packing
-          if (f_id == cfld_yp->id) {
-            if (packing_cell[cell_id_0] != -1) {
-              imp_st[cell_id_0] += CS_MAX(imasfl_r[face_id], 0.);
-              exp_st[cell_id_0] -=   CS_MAX(imasfl_r[face_id], 0)
-                                   * f_var[cell_id_0];
-            }
-            if (packing_cell[cell_id_1] != -1) {
-              imp_st[cell_id_1] += CS_MAX(-imasfl_r[face_id], 0.);
-              exp_st[cell_id_1] -=   CS_MAX(-imasfl_r[face_id], 0)
-                                   * f_var[cell_id_1];
-            }
+        /* Rain sink term in packing zones */
+        //TODO : Add rain leak portion inside packing
+        if (f_id == cfld_yp->id) {
+          if (packing_cell[cell_id_0] != -1) {
+            imp_st[cell_id_0] += CS_MAX(imasfl_r[face_id], 0.);
+            exp_st[cell_id_0] -=   CS_MAX(imasfl_r[face_id], 0)
+                                 * f_var[cell_id_0];
+          }
+          if (packing_cell[cell_id_1] != -1) {
+            imp_st[cell_id_1] += CS_MAX(-imasfl_r[face_id], 0.);
+            exp_st[cell_id_1] -=   CS_MAX(-imasfl_r[face_id], 0)
+                                 * f_var[cell_id_1];
           }
+        }
 
-          if (f_id == cfld_yh_rain->id) {
-            if (packing_cell[cell_id_0] != -1) {
-              imp_st[cell_id_0] += CS_MAX(imasfl_r[face_id], 0.);
-              exp_st[cell_id_0] -=   CS_MAX(imasfl_r[face_id], 0)
-                                   * f_var[cell_id_0];
-            }
-            if (packing_cell[cell_id_1] != -1) {
-              imp_st[cell_id_1] += CS_MAX(-imasfl_r[face_id], 0.);
-              exp_st[cell_id_1] -=   CS_MAX(-imasfl_r[face_id], 0)
-                                   * f_var[cell_id_1];
-            }
+        if (f_id == cfld_yh_rain->id) {
+          if (packing_cell[cell_id_0] != -1) {
+            imp_st[cell_id_0] += CS_MAX(imasfl_r[face_id], 0.);
+            exp_st[cell_id_0] -=   CS_MAX(imasfl_r[face_id], 0)
+                                 * f_var[cell_id_0];
           }
+          if (packing_cell[cell_id_1] != -1) {
+            imp_st[cell_id_1] += CS_MAX(-imasfl_r[face_id], 0.);
+            exp_st[cell_id_1] -=   CS_MAX(-imasfl_r[face_id], 0)
+                                 * f_var[cell_id_1];
+          }
+        }
 
-          /* Liquid source term in packing zones from rain */
-          if (f_id == CS_F_(y_l_pack)->id) {
-            if (packing_cell[cell_id_0] != -1) {
-              exp_st[cell_id_0] +=   CS_MAX(imasfl_r[face_id], 0)
-                                   * cfld_yp->val[cell_id_0];
-            }
-            if (packing_cell[cell_id_1] != -1) {
-              exp_st[cell_id_1] +=   CS_MAX(-imasfl_r[face_id], 0)
-                                   * cfld_yp->val[cell_id_1];
-            }
+        /* Liquid source term in packing zones from rain */
+        if (f_id == CS_F_(y_l_pack)->id) {
+          if (packing_cell[cell_id_0] != -1) {
+            exp_st[cell_id_0] +=   CS_MAX(imasfl_r[face_id], 0)
+                                 * cfld_yp->val[cell_id_0];
+          }
+          if (packing_cell[cell_id_1] != -1) {
+            exp_st[cell_id_1] +=   CS_MAX(-imasfl_r[face_id], 0)
+                                 * cfld_yp->val[cell_id_1];
           }
+        }
 
-          if (f_id == CS_F_(yh_l_pack)->id) {
-            if (packing_cell[cell_id_0] != -1) {
-              exp_st[cell_id_0] +=   CS_MAX(imasfl_r[face_id], 0)
-                                   * cfld_yh_rain->val[cell_id_0];
-            }
+        if (f_id == CS_F_(yh_l_pack)->id) {
+          if (packing_cell[cell_id_0] != -1) {
+            exp_st[cell_id_0] +=   CS_MAX(imasfl_r[face_id], 0)
+                                 * cfld_yh_rain->val[cell_id_0];
+          }
 
-            if (packing_cell[cell_id_1] != -1) {
-              exp_st[cell_id_1] +=   CS_MAX(-imasfl_r[face_id], 0)
-                                   * cfld_yh_rain->val[cell_id_1];
-            }
+          if (packing_cell[cell_id_1] != -1) {
+            exp_st[cell_id_1] +=   CS_MAX(-imasfl_r[face_id], 0)
+                                 * cfld_yh_rain->val[cell_id_1];
           }
         }
       }
@@ -1269,8 +1276,6 @@ cs_ctwr_source_term(int              f_id,
       }
     }
  } /* End of solve_rain variable check */
-
-  BFT_FREE(packing_cell);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -67,6 +67,22 @@ BEGIN_C_DECLS
  * Local Macro and Type definitions
  *============================================================================*/
 
+/* Maximum number of hashed grid cells in each direction */
+
+#define _HASHED_GRID_MAX_CELLS  (1 << 21)
+
+/* Uniform grid used for hashed search */
+/*-------------------------------------*/
+
+typedef struct {
+
+  int         dim;                     /* Spatial dimension */
+  cs_coord_t  origin[3];               /* Grid origin */
+  double      inv_h[3];                /* Inverse of cell size */
+  cs_gnum_t   n_cells[3];              /* Number of cells per direction */
+
+} _hashed_grid_t;
+
 /* Neighborhood statistics (using box tree) */
 /*------------------------------------------*/
 
@@ -108,6 +124,8 @@ struct _fvm_neighborhood_t {
 
   /* Algorithm-related options */
 
+  fvm_neighborhood_method_t  method; /* Search method */
+
   int  max_tree_depth;               /* Maximum search tree depth */
   int  leaf_threshold;               /* Maximum number of boxes which can
                                         be related to a leaf of the tree if
@@ -588,6 +606,465 @@ _sync_by_block(fvm_neighborhood_t  *n,
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------
+ * Compute uniform grid cell coordinates containing a given point.
+ *
+ * parameters:
+ *   g      <-- pointer to hashed grid definition
+ *   coords <-- point coordinates
+ *   c      --> matching cell coordinates
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hashed_grid_cell(const _hashed_grid_t  *g,
+                  const cs_coord_t       coords[],
+                  cs_gnum_t              c[3])
+{
+  for (int k = 0; k < 3; k++) {
+    c[k] = 0;
+    if (k < g->dim && g->n_cells[k] > 1) {
+      double x = (coords[k] - g->origin[k]) * g->inv_h[k];
+      if (x > 0) {
+        c[k] = (cs_gnum_t)x;
+        if (c[k] >= g->n_cells[k])
+          c[k] = g->n_cells[k] - 1;
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Determine the rank owning a given uniform grid cell.
+ *
+ * parameters:
+ *   c       <-- cell coordinates
+ *   n_ranks <-- number of ranks
+ *
+ * returns:
+ *   id of rank owning cell
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_hashed_grid_cell_rank(const cs_gnum_t  c[3],
+                       int              n_ranks)
+{
+  if (n_ranks < 2)
+    return 0;
+
+  uint64_t h =   ((uint64_t)c[0] * 73856093ULL)
+               ^ ((uint64_t)c[1] * 19349663ULL)
+               ^ ((uint64_t)c[2] * 83492791ULL);
+
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+
+  return (int)(h % (uint64_t)n_ranks);
+}
+
+/*----------------------------------------------------------------------------
+ * Define a uniform grid adapted to a set of boxes.
+ *
+ * The cell size in each direction is based on the mean box size, so that
+ * a box usually overlaps only a few cells.
+ *
+ * parameters:
+ *   n        <-- pointer to neighborhood management structure
+ *   dim      <-- spatial dimension
+ *   n_boxes  <-- local number of boxes
+ *   box_gnum <-- global numbering of boxes
+ *   extents  <-- coordinate extents
+ *   g        --> hashed grid definition
+ *
+ * returns:
+ *   maximum global box number
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_hashed_grid_define(const fvm_neighborhood_t  *n,
+                    int                        dim,
+                    cs_lnum_t                  n_boxes,
+                    const cs_gnum_t            box_gnum[],
+                    const cs_coord_t           extents[],
+                    _hashed_grid_t            *g)
+{
+  double g_min[3] = {HUGE_VAL, HUGE_VAL, HUGE_VAL};
+  double g_max[3] = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+  double g_sum[4] = {0., 0., 0., (double)n_boxes};
+  cs_gnum_t max_gnum = 0;
+
+  for (cs_lnum_t i = 0; i < n_boxes; i++) {
+    const cs_coord_t *e = extents + 2*dim*i;
+    for (int k = 0; k < dim; k++) {
+      g_min[k] = CS_MIN(g_min[k], e[k]);
+      g_max[k] = CS_MAX(g_max[k], e[dim + k]);
+      g_sum[k] += e[dim + k] - e[k];
+    }
+    max_gnum = CS_MAX(max_gnum, box_gnum[i]);
+  }
+
+#if defined(HAVE_MPI)
+  if (n->comm != MPI_COMM_NULL) {
+    double l_min[3], l_max[3], l_sum[4];
+    cs_gnum_t l_max_gnum = max_gnum;
+    for (int k = 0; k < 3; k++) {
+      l_min[k] = g_min[k];
+      l_max[k] = g_max[k];
+      l_sum[k] = g_sum[k];
+    }
+    l_sum[3] = g_sum[3];
+    MPI_Allreduce(l_min, g_min, 3, MPI_DOUBLE, MPI_MIN, n->comm);
+    MPI_Allreduce(l_max, g_max, 3, MPI_DOUBLE, MPI_MAX, n->comm);
+    MPI_Allreduce(l_sum, g_sum, 4, MPI_DOUBLE, MPI_SUM, n->comm);
+    MPI_Allreduce(&l_max_gnum, &max_gnum, 1, CS_MPI_GNUM, MPI_MAX, n->comm);
+  }
+#else
+  CS_UNUSED(n);
+#endif
+
+  g->dim = dim;
+
+  for (int k = 0; k < 3; k++) {
+    g->origin[k] = 0.;
+    g->inv_h[k] = 0.;
+    g->n_cells[k] = 1;
+    if (k >= dim || g_sum[3] < 1)
+      continue;
+    double l = g_max[k] - g_min[k];
+    double h = g_sum[k] / g_sum[3];
+    g->origin[k] = g_min[k];
+    if (l > 0 && h > 0) {
+      double n_cells = ceil(l / h);
+      if (n_cells > (double)_HASHED_GRID_MAX_CELLS)
+        n_cells = _HASHED_GRID_MAX_CELLS;
+      g->n_cells[k] = CS_MAX((cs_gnum_t)n_cells, 1);
+      g->inv_h[k] = (double)(g->n_cells[k]) / l;
+    }
+  }
+
+  return max_gnum;
+}
+
+/*----------------------------------------------------------------------------
+ * Determine intersecting boxes using a uniform grid whose cells are
+ * hashed over ranks.
+ *
+ * Each box is sent once to every rank owning one of the cells it overlaps;
+ * each rank then tests boxes sharing a cell it owns. An intersection is
+ * only retained in the cell containing the lower corner of the
+ * intersection of both boxes, so each pair is found only once.
+ *
+ * parameters:
+ *   n        <-> pointer to neighborhood management structure
+ *   dim      <-- spatial dimension
+ *   n_boxes  <-- local number of boxes
+ *   box_gnum <-- global numbering of boxes
+ *   extents  <-- coordinate extents
+ *----------------------------------------------------------------------------*/
+
+static void
+_by_boxes_hashed_grid(fvm_neighborhood_t  *n,
+                      int                  dim,
+                      cs_lnum_t            n_boxes,
+                      const cs_gnum_t      box_gnum[],
+                      const cs_coord_t     extents[])
+{
+  double  clock_start = cs_timer_wtime();
+  double  cpu_start = cs_timer_cpu_time();
+
+  const int stride = 2*dim;
+
+  int  rank_id = 0, n_ranks = 1;
+
+#if defined(HAVE_MPI)
+  if (n->comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(n->comm, &rank_id);
+    MPI_Comm_size(n->comm, &n_ranks);
+  }
+#endif
+
+  _hashed_grid_t  g;
+  cs_gnum_t n_g_boxes = _hashed_grid_define(n, dim, n_boxes, box_gnum,
+                                            extents, &g);
+
+  /* Send boxes to ranks owning the grid cells they overlap */
+
+  cs_lnum_t  n_recv = n_boxes;
+  const cs_gnum_t  *recv_gnum = box_gnum;
+  const cs_coord_t  *recv_extents = extents;
+
+#if defined(HAVE_MPI)
+
+  cs_gnum_t  *_recv_gnum = nullptr;
+  cs_coord_t  *_recv_extents = nullptr;
+
+  if (n_ranks > 1) {
+
+    int *rank_mark, *dest_rank;
+    cs_lnum_t *src_id;
+    BFT_MALLOC(rank_mark, n_ranks, int);
+    for (int r = 0; r < n_ranks; r++)
+      rank_mark[r] = -1;
+
+    size_t n_send = 0, send_size = n_boxes;
+    BFT_MALLOC(dest_rank, send_size, int);
+    BFT_MALLOC(src_id, send_size, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < n_boxes; i++) {
+      cs_gnum_t c_min[3], c_max[3], c[3];
+      _hashed_grid_cell(&g, extents + stride*i, c_min);
+      _hashed_grid_cell(&g, extents + stride*i + dim, c_max);
+      for (c[0] = c_min[0]; c[0] <= c_max[0]; c[0]++) {
+        for (c[1] = c_min[1]; c[1] <= c_max[1]; c[1]++) {
+          for (c[2] = c_min[2]; c[2] <= c_max[2]; c[2]++) {
+            int r = _hashed_grid_cell_rank(c, n_ranks);
+            if (rank_mark[r] == i)
+              continue;
+            rank_mark[r] = i;
+            if (n_send >= send_size) {
+              send_size *= 2;
+              BFT_REALLOC(dest_rank, send_size, int);
+              BFT_REALLOC(src_id, send_size, cs_lnum_t);
+            }
+            dest_rank[n_send] = r;
+            src_id[n_send] = i;
+            n_send++;
+          }
+        }
+      }
+    }
+
+    BFT_FREE(rank_mark);
+
+    cs_gnum_t *send_gnum;
+    cs_coord_t *send_extents;
+    BFT_MALLOC(send_gnum, n_send, cs_gnum_t);
+    BFT_MALLOC(send_extents, n_send*stride, cs_coord_t);
+
+    for (size_t j = 0; j < n_send; j++) {
+      cs_lnum_t i = src_id[j];
+      send_gnum[j] = box_gnum[i];
+      for (int k = 0; k < stride; k++)
+        send_extents[j*stride + k] = extents[i*stride + k];
+    }
+
+    BFT_FREE(src_id);
+
+    cs_all_to_all_t *d = cs_all_to_all_create(n_send,
+                                              0, /* flags */
+                                              nullptr,
+                                              dest_rank,
+                                              n->comm);
+
+    _recv_gnum = cs_all_to_all_copy_array(d, 1, false, send_gnum);
+    _recv_extents = cs_all_to_all_copy_array(d, stride, false, send_extents);
+
+    n_recv = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(send_extents);
+    BFT_FREE(send_gnum);
+    BFT_FREE(dest_rank);
+
+    recv_gnum = _recv_gnum;
+    recv_extents = _recv_extents;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Build list of (owned cell, box) entries */
+
+  size_t  n_entries = 0, entries_size = n_recv;
+  cs_gnum_t  *cell_key;
+  cs_lnum_t  *cell_box_id;
+  BFT_MALLOC(cell_key, entries_size*3, cs_gnum_t);
+  BFT_MALLOC(cell_box_id, entries_size, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_recv; i++) {
+    cs_gnum_t c_min[3], c_max[3], c[3];
+    _hashed_grid_cell(&g, recv_extents + stride*i, c_min);
+    _hashed_grid_cell(&g, recv_extents + stride*i + dim, c_max);
+    for (c[0] = c_min[0]; c[0] <= c_max[0]; c[0]++) {
+      for (c[1] = c_min[1]; c[1] <= c_max[1]; c[1]++) {
+        for (c[2] = c_min[2]; c[2] <= c_max[2]; c[2]++) {
+          if (_hashed_grid_cell_rank(c, n_ranks) != rank_id)
+            continue;
+          if (n_entries >= entries_size) {
+            entries_size = CS_MAX(entries_size*2, 16);
+            BFT_REALLOC(cell_key, entries_size*3, cs_gnum_t);
+            BFT_REALLOC(cell_box_id, entries_size, cs_lnum_t);
+          }
+          for (int k = 0; k < 3; k++)
+            cell_key[n_entries*3 + k] = c[k];
+          cell_box_id[n_entries] = i;
+          n_entries++;
+        }
+      }
+    }
+  }
+
+  cs_lnum_t *order;
+  BFT_MALLOC(order, n_entries, cs_lnum_t);
+
+  cs_order_gnum_allocated_s(nullptr, cell_key, 3, order, n_entries);
+
+  /* Update construction times. */
+
+  double clock_end = cs_timer_wtime();
+  double cpu_end = cs_timer_cpu_time();
+
+  n->cpu_time[0] = cpu_end - cpu_start;
+  n->wtime[0] = clock_end - clock_start;
+
+  clock_start = clock_end;
+  cpu_start = cpu_end;
+
+  /* Test boxes sharing a same cell; each pair is stored in both
+     directions, as (element, neighbor) */
+
+  size_t  n_pairs = 0, pairs_size = n_boxes + 16;
+  cs_gnum_t  *pairs;
+  BFT_MALLOC(pairs, pairs_size*2, cs_gnum_t);
+
+  size_t s_id = 0;
+  while (s_id < n_entries) {
+
+    const cs_gnum_t *c = cell_key + order[s_id]*3;
+
+    size_t e_id = s_id + 1;
+    while (e_id < n_entries) {
+      const cs_gnum_t *c1 = cell_key + order[e_id]*3;
+      if (c1[0] != c[0] || c1[1] != c[1] || c1[2] != c[2])
+        break;
+      e_id++;
+    }
+
+    for (size_t j0 = s_id; j0 < e_id; j0++) {
+      cs_lnum_t b0 = cell_box_id[order[j0]];
+      const cs_coord_t *e0 = recv_extents + stride*b0;
+
+      for (size_t j1 = j0 + 1; j1 < e_id; j1++) {
+        cs_lnum_t b1 = cell_box_id[order[j1]];
+        const cs_coord_t *e1 = recv_extents + stride*b1;
+
+        if (recv_gnum[b0] == recv_gnum[b1])
+          continue;
+
+        bool intersect = true;
+        cs_coord_t i_min[3] = {0., 0., 0.};
+        for (int k = 0; k < dim; k++) {
+          if (e0[k] > e1[dim + k] || e1[k] > e0[dim + k]) {
+            intersect = false;
+            break;
+          }
+          i_min[k] = CS_MAX(e0[k], e1[k]);
+        }
+        if (intersect == false)
+          continue;
+
+        cs_gnum_t c_ref[3];
+        _hashed_grid_cell(&g, i_min, c_ref);
+        if (c_ref[0] != c[0] || c_ref[1] != c[1] || c_ref[2] != c[2])
+          continue;
+
+        if (n_pairs + 2 > pairs_size) {
+          pairs_size *= 2;
+          BFT_REALLOC(pairs, pairs_size*2, cs_gnum_t);
+        }
+        pairs[n_pairs*2]     = recv_gnum[b0];
+        pairs[n_pairs*2 + 1] = recv_gnum[b1];
+        pairs[n_pairs*2 + 2] = recv_gnum[b1];
+        pairs[n_pairs*2 + 3] = recv_gnum[b0];
+        n_pairs += 2;
+      }
+    }
+
+    s_id = e_id;
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(cell_box_id);
+  BFT_FREE(cell_key);
+
+#if defined(HAVE_MPI)
+  BFT_FREE(_recv_extents);
+  BFT_FREE(_recv_gnum);
+#endif
+
+  /* Build neighborhood from local boxes (so that all global numbers
+     have a matching entry) and intersecting pairs */
+
+  {
+    size_t n_ent = n_boxes + n_pairs;
+
+    cs_gnum_t *ent_num;
+    BFT_MALLOC(ent_num, n_ent, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_boxes; i++)
+      ent_num[i] = box_gnum[i];
+    for (size_t i = 0; i < n_pairs; i++)
+      ent_num[n_boxes + i] = pairs[i*2];
+
+    BFT_MALLOC(order, n_ent, cs_lnum_t);
+    cs_order_gnum_allocated(nullptr, ent_num, order, n_ent);
+
+    BFT_MALLOC(n->elt_num, n_ent, cs_gnum_t);
+    BFT_MALLOC(n->neighbor_index, n_ent + 1, cs_lnum_t);
+    BFT_MALLOC(n->neighbor_num, n_pairs, cs_gnum_t);
+
+    cs_lnum_t n_elts = 0, n_neighbors = 0;
+    n->neighbor_index[0] = 0;
+
+    for (size_t j = 0; j < n_ent; j++) {
+      size_t i = order[j];
+      if (n_elts == 0 || n->elt_num[n_elts-1] != ent_num[i]) {
+        n->elt_num[n_elts] = ent_num[i];
+        n_elts++;
+        n->neighbor_index[n_elts] = n_neighbors;
+      }
+      if (i >= (size_t)n_boxes) {
+        n->neighbor_num[n_neighbors++] = pairs[(i - n_boxes)*2 + 1];
+        n->neighbor_index[n_elts] = n_neighbors;
+      }
+    }
+
+    BFT_FREE(order);
+    BFT_FREE(ent_num);
+    BFT_FREE(pairs);
+
+    n->n_elts = n_elts;
+    BFT_REALLOC(n->elt_num, n_elts, cs_gnum_t);
+    BFT_REALLOC(n->neighbor_index, n_elts + 1, cs_lnum_t);
+  }
+
+  _clean_neighbor_nums(n);
+
+#if defined(HAVE_MPI)
+
+  /* Synchronize list of intersections for each element of the list
+     and distribute it by block over the ranks */
+
+  if (n_ranks > 1)
+    _sync_by_block(n, n_g_boxes);
+
+#else
+
+  CS_UNUSED(n_g_boxes);
+
+#endif /* HAVE_MPI */
+
+  _init_bt_statistics(&(n->bt_stats));
+  n->bt_stats.dim = dim;
+
+  /* Update query times. */
+
+  clock_end = cs_timer_wtime();
+  cpu_end = cs_timer_cpu_time();
+
+  n->cpu_time[1] = cpu_end - cpu_start;
+  n->wtime[1] = clock_end - clock_start;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -636,6 +1113,8 @@ fvm_neighborhood_create(void)
 
   /* Algorithm options */
 
+  n->method = FVM_NEIGHBORHOOD_BOX_TREE;
+
   n->max_tree_depth = 30; /* defaults */
   n->leaf_threshold = 30;
   n->max_box_ratio = 10.0;
@@ -712,6 +1191,24 @@ fvm_neighborhood_set_options(fvm_neighborhood_t  *n,
   n->max_box_ratio_distrib = max_box_ratio_distrib;
 }
 
+/*----------------------------------------------------------------------------
+ * Select the search method used by a neighborhood management structure.
+ *
+ * parameters:
+ *   n      <-> pointer to neighborhood management structure
+ *   method <-- search method
+ *---------------------------------------------------------------------------*/
+
+void
+fvm_neighborhood_set_method(fvm_neighborhood_t         *n,
+                            fvm_neighborhood_method_t   method)
+{
+  if (n == nullptr)
+    return;
+
+  n->method = method;
+}
+
 /*----------------------------------------------------------------------------
  * Retrieve pointers to of arrays from a neighborhood_t structure.
  *
@@ -865,6 +1362,20 @@ fvm_neighborhood_by_boxes(fvm_neighborhood_t  *n,
   if (n->neighbor_num != nullptr)
     BFT_FREE(n->neighbor_num);
 
+  /* Use hashed uniform grid if requested */
+
+  if (n->method == FVM_NEIGHBORHOOD_HASHED_GRID) {
+
+    _by_boxes_hashed_grid(n, dim, n_boxes, _box_gnum, _extents);
+
+    if (box_gnum_assigned != nullptr)
+      BFT_FREE(*box_gnum_assigned);
+    if (extents_assigned != nullptr)
+      BFT_FREE(*extents_assigned);
+
+    return;
+  }
+
   /* Allocate fvm_box_set_t structure and initialize it */
 
 #if defined(HAVE_MPI)
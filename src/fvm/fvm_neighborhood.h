@@ -47,6 +47,17 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Neighborhood search method */
+
+typedef enum {
+
+  FVM_NEIGHBORHOOD_BOX_TREE,      /* Box tree, with prior Morton-based
+                                     redistribution in parallel */
+  FVM_NEIGHBORHOOD_HASHED_GRID    /* Uniform grid with cells hashed
+                                     over ranks */
+
+} fvm_neighborhood_method_t;
+
 typedef struct _fvm_neighborhood_t fvm_neighborhood_t;
 
 /*============================================================================
@@ -106,6 +117,24 @@ fvm_neighborhood_set_options(fvm_neighborhood_t  *n,
                              float                max_box_ratio,
                              float                max_box_ratio_distrib);
 
+/*----------------------------------------------------------------------------
+ * Select the search method used by a neighborhood management structure.
+ *
+ * The default box tree method adapts well to strongly varying box sizes.
+ * The hashed grid method uses a uniform grid based on the mean box size,
+ * whose cells are hashed over ranks, avoiding the coarse tree construction
+ * and Morton-based redistribution; it is usually faster when boxes have
+ * similar sizes.
+ *
+ * parameters:
+ *   n      <-> pointer to neighborhood management structure
+ *   method <-- search method
+ *---------------------------------------------------------------------------*/
+
+void
+fvm_neighborhood_set_method(fvm_neighborhood_t         *n,
+                            fvm_neighborhood_method_t   method);
+
 /*----------------------------------------------------------------------------
  * Retrieve pointers to of arrays from a neighborhood_t structure.
  *
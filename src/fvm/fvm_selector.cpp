@@ -92,6 +92,13 @@ typedef struct {
                                           for each operation */
   int   **group_class_set;             /* Array of group class lists
                                           for each operation */
+
+  cs_lnum_t  *n_elements;              /* Number of cached selected elements
+                                          for each operation, or -1 */
+  cs_lnum_t **elements;                /* Cached selected elements (0 to n-1)
+                                          for each operation, or nullptr
+                                          (only for operations not depending
+                                          on coordinates or normals) */
 } _operation_list_t;
 
 /*----------------------------------------------------------------------------
@@ -507,11 +514,16 @@ _operation_list_allocate(void)
   BFT_MALLOC(ops->n_group_classes, ops->n_max_operations, int);
   BFT_MALLOC(ops->group_class_set, ops->n_max_operations, int *);
 
+  BFT_MALLOC(ops->n_elements, ops->n_max_operations, cs_lnum_t);
+  BFT_MALLOC(ops->elements, ops->n_max_operations, cs_lnum_t *);
+
   for (i = 0; i < ops->n_max_operations; i++) {
     ops->postfix[i] = nullptr;
     ops->group_class_set[i] = nullptr;
     ops->n_calls[i] = 0;
     ops->n_group_classes[i] = 0;
+    ops->n_elements[i] = -1;
+    ops->elements[i] = nullptr;
   }
 
   return ops;
@@ -547,11 +559,16 @@ _operation_list_reallocate(_operation_list_t  *ops)
   BFT_REALLOC(ops->n_group_classes, ops->n_max_operations, int);
   BFT_REALLOC(ops->group_class_set, ops->n_max_operations, int *);
 
+  BFT_REALLOC(ops->n_elements, ops->n_max_operations, cs_lnum_t);
+  BFT_REALLOC(ops->elements, ops->n_max_operations, cs_lnum_t *);
+
   for (i = old_size; i < ops->n_max_operations; i++) {
     ops->postfix[i] = nullptr;
     ops->group_class_set[i] = nullptr;
     ops->n_calls[i] = 0;
     ops->n_group_classes[i] = 0;
+    ops->n_elements[i] = -1;
+    ops->elements[i] = nullptr;
   }
 }
 
@@ -578,9 +595,12 @@ _operation_list_free(_operation_list_t  *ops)
         BFT_FREE(ops->group_class_set[i]);
       if (ops->postfix[i] != nullptr)
         fvm_selector_postfix_destroy(ops->postfix + i);
+      BFT_FREE(ops->elements[i]);
     }
     BFT_FREE(ops->postfix);
     BFT_FREE(ops->group_class_set);
+    BFT_FREE(ops->n_elements);
+    BFT_FREE(ops->elements);
     BFT_FREE(ops);
   }
 
@@ -956,7 +976,25 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
   if (   fvm_selector_postfix_coords_dep(pf) == false
       && fvm_selector_postfix_normals_dep(pf) == false) {
 
-    if (ts->_operations->group_class_set[c_id] != nullptr) {
+    /* Selection already cached: simple copy */
+
+    if (ts->_operations->n_elements[c_id] > -1) {
+
+      const cs_lnum_t n_elts = ts->_operations->n_elements[c_id];
+      const cs_lnum_t *elts = ts->_operations->elements[c_id];
+
+      if (elt_id_base == 0 && n_elts > 0)
+        memcpy(selected_elements, elts, n_elts*sizeof(cs_lnum_t));
+      else {
+        for (i = 0; i < n_elts; i++)
+          selected_elements[i] = elts[i] + elt_id_base;
+      }
+
+      *n_selected_elements = n_elts;
+
+    }
+
+    else if (ts->_operations->group_class_set[c_id] != nullptr) {
 
       int n_criteria_group_classes
         = ts->_operations->n_group_classes[c_id];
@@ -977,6 +1015,17 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
         }
 
       }
+
+      /* Cache selection, as it depends only on (immutable) group classes */
+
+      const cs_lnum_t n_elts = *n_selected_elements;
+      cs_lnum_t *elts;
+      BFT_MALLOC(elts, n_elts, cs_lnum_t);
+      for (i = 0; i < n_elts; i++)
+        elts[i] = selected_elements[i] - elt_id_base;
+
+      ts->_operations->n_elements[c_id] = n_elts;
+      ts->_operations->elements[c_id] = elts;
     }
 
   }
@@ -0,0 +1,1220 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to ADIOS2 output (BP files or SST staging).
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * ADIOS2 library headers
+ *----------------------------------------------------------------------------*/
+
+#include <adios2_c.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "fvm_defs.h"
+#include "fvm_io_num.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_block_dist.h"
+#include "cs_parall.h"
+#include "cs_part_to_block.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_adios2.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * ADIOS2 output writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char          *name;             /* Writer name */
+  char          *filename;         /* Output file (or stream) name */
+
+  adios2_adios  *adios;            /* ADIOS2 handle */
+  adios2_io     *io;               /* ADIOS2 IO handle */
+  adios2_engine *engine;           /* ADIOS2 engine */
+
+  fvm_writer_time_dep_t time_dependency;  /* Mesh time dependency */
+
+  bool           single_precision; /* Output real field values as float32 */
+
+  bool           step_open;        /* Is an ADIOS2 step currently open ? */
+  int            time_step;        /* Time step of current ADIOS2 step */
+  double         time_value;       /* Time value of current ADIOS2 step */
+
+  int            rank;             /* Rank of current process in communicator */
+  int            n_ranks;          /* Number of processes in communicator */
+
+#if defined(HAVE_MPI)
+  int            min_rank_step;    /* Minimum rank step */
+  int            min_block_size;   /* Minimum block buffer size */
+  MPI_Comm       comm;             /* Associated MPI communicator */
+#endif
+
+} fvm_to_adios2_writer_t;
+
+/*----------------------------------------------------------------------------
+ * Context structure for fvm_writer_field_helper_output_* functions.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  fvm_to_adios2_writer_t  *writer;      /* pointer to writer structure */
+  const char              *name;        /* current variable name */
+  cs_gnum_t                n_g_ent;     /* global number of entities */
+
+} _adios2_context_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char _adios2_version_string[32] = "";
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Map a code_saturne datatype to an ADIOS2 datatype.
+ *
+ * parameters:
+ *   datatype <-- code_saturne datatype
+ *
+ * returns:
+ *   matching ADIOS2 datatype
+ *----------------------------------------------------------------------------*/
+
+static adios2_type
+_adios2_type(cs_datatype_t  datatype)
+{
+  adios2_type retval = adios2_type_unknown;
+
+  switch(datatype) {
+  case CS_FLOAT:
+    retval = adios2_type_float;
+    break;
+  case CS_DOUBLE:
+    retval = adios2_type_double;
+    break;
+  case CS_INT32:
+    retval = adios2_type_int32_t;
+    break;
+  case CS_INT64:
+    retval = adios2_type_int64_t;
+    break;
+  case CS_UINT32:
+    retval = adios2_type_uint32_t;
+    break;
+  case CS_UINT64:
+    retval = adios2_type_uint64_t;
+    break;
+  default:
+    assert(0);
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Build an ADIOS2 variable name from a mesh name and a suffix.
+ *
+ * The returned string must be freed by the caller.
+ *
+ * parameters:
+ *   mesh_name <-- mesh name
+ *   suffix    <-- variable name relative to mesh
+ *
+ * returns:
+ *   newly allocated variable name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_var_name(const char  *mesh_name,
+          const char  *suffix)
+{
+  char *name;
+  size_t l = strlen(mesh_name) + strlen(suffix) + 2;
+
+  BFT_MALLOC(name, l, char);
+  snprintf(name, l, "%s/%s", mesh_name, suffix);
+
+  return name;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a block of a global array.
+ *
+ * The variable is defined on first use and its shape and selection
+ * updated on subsequent uses, so that meshes with transient connectivity
+ * may be rewritten. Data is put in synchronous mode, so the caller may
+ * free the buffer on return; with the BP5 engine, actual file output
+ * only occurs at the end of the step (and may be asynchronous).
+ *
+ * parameters:
+ *   w        <-- pointer to writer structure
+ *   name     <-- variable name
+ *   datatype <-- data type
+ *   ndims    <-- number of dimensions (1 or 2)
+ *   shape    <-- global shape
+ *   start    <-- start of local block in global array
+ *   count    <-- size of local block
+ *   values   <-- local block values
+ *----------------------------------------------------------------------------*/
+
+static void
+_put_block(fvm_to_adios2_writer_t  *w,
+           const char              *name,
+           cs_datatype_t            datatype,
+           size_t                   ndims,
+           const size_t             shape[],
+           const size_t             start[],
+           const size_t             count[],
+           const void              *values)
+{
+  adios2_error ierr = adios2_error_none;
+
+  adios2_variable *var = adios2_inquire_variable(w->io, name);
+
+  if (var == nullptr)
+    var = adios2_define_variable(w->io,
+                                 name,
+                                 _adios2_type(datatype),
+                                 ndims,
+                                 shape,
+                                 start,
+                                 count,
+                                 adios2_constant_dims_false);
+  else {
+    ierr = adios2_set_shape(var, ndims, shape);
+    if (ierr == adios2_error_none)
+      ierr = adios2_set_selection(var, ndims, start, count);
+  }
+
+  if (var == nullptr || ierr != adios2_error_none)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ADIOS2 error defining variable \"%s\"\n"
+                "for writer \"%s\"."), name, w->name);
+
+  size_t n_vals = 1;
+  for (size_t i = 0; i < ndims; i++)
+    n_vals *= count[i];
+
+  if (n_vals > 0) {
+    ierr = adios2_put(w->engine, var, values, adios2_mode_sync);
+    if (ierr != adios2_error_none)
+      bft_error(__FILE__, __LINE__, 0,
+                _("ADIOS2 error writing variable \"%s\"\n"
+                  "for writer \"%s\"."), name, w->name);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write a global scalar value (from rank 0 only).
+ *
+ * parameters:
+ *   w        <-- pointer to writer structure
+ *   name     <-- variable name
+ *   datatype <-- data type
+ *   value    <-- pointer to value
+ *----------------------------------------------------------------------------*/
+
+static void
+_put_global_value(fvm_to_adios2_writer_t  *w,
+                  const char              *name,
+                  cs_datatype_t            datatype,
+                  const void              *value)
+{
+  adios2_variable *var = adios2_inquire_variable(w->io, name);
+
+  if (var == nullptr)
+    var = adios2_define_variable(w->io,
+                                 name,
+                                 _adios2_type(datatype),
+                                 0,
+                                 nullptr,
+                                 nullptr,
+                                 nullptr,
+                                 adios2_constant_dims_true);
+
+  if (var == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ADIOS2 error defining variable \"%s\"\n"
+                "for writer \"%s\"."), name, w->name);
+
+  if (w->rank < 1)
+    adios2_put(w->engine, var, value, adios2_mode_sync);
+}
+
+/*----------------------------------------------------------------------------
+ * Define a string attribute if not already present.
+ *
+ * parameters:
+ *   w     <-- pointer to writer structure
+ *   name  <-- attribute name
+ *   value <-- attribute value
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_attribute(fvm_to_adios2_writer_t  *w,
+                  const char              *name,
+                  const char              *value)
+{
+  if (adios2_inquire_attribute(w->io, name) == nullptr)
+    adios2_define_attribute(w->io, name, adios2_type_string, value);
+}
+
+/*----------------------------------------------------------------------------
+ * End current ADIOS2 step if one is open.
+ *
+ * parameters:
+ *   w <-> pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_end_step(fvm_to_adios2_writer_t  *w)
+{
+  if (w->step_open == false)
+    return;
+
+  if (adios2_end_step(w->engine) != adios2_error_none)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ADIOS2 error ending step for writer \"%s\"."), w->name);
+
+  w->step_open = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Ensure an ADIOS2 step matching a given time step is open.
+ *
+ * A new step is started if none is open or if the time step changed;
+ * a negative time step (time-independent output) uses the current step.
+ *
+ * parameters:
+ *   w          <-> pointer to writer structure
+ *   time_step  <-- time step number
+ *   time_value <-- time value
+ *----------------------------------------------------------------------------*/
+
+static void
+_begin_step(fvm_to_adios2_writer_t  *w,
+            int                      time_step,
+            double                   time_value)
+{
+  if (w->step_open) {
+    if (time_step < 0 || time_step == w->time_step)
+      return;
+    _end_step(w);
+  }
+
+  adios2_step_status status;
+  adios2_error ierr = adios2_begin_step(w->engine,
+                                        adios2_step_mode_append,
+                                        -1.f,
+                                        &status);
+
+  if (ierr != adios2_error_none || status != adios2_step_status_ok)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ADIOS2 error beginning step for writer \"%s\"."), w->name);
+
+  w->step_open = true;
+
+  if (time_step >= 0) {
+    w->time_step = time_step;
+    w->time_value = time_value;
+  }
+
+  int32_t ts = w->time_step;
+  _put_global_value(w, "time_step", CS_INT32, &ts);
+  _put_global_value(w, "time_value", CS_DOUBLE, &(w->time_value));
+}
+
+/*----------------------------------------------------------------------------
+ * Build element records for a given section.
+ *
+ * Vertex numbers are output as 0-based global numbers. Strided elements
+ * use a fixed number of vertices per element, polygons a variable one,
+ * and polyhedra are described as:
+ *   n_faces, (n_face_vertices, face vertices) for each face,
+ * with face vertices oriented outwards.
+ *
+ * parameters:
+ *   section   <-- pointer to nodal mesh section
+ *   g_vtx_num <-- vertex global numbers, or null for local numbering
+ *   index     --> element record index (size: n_elements + 1)
+ *   records   --> element records (allocated here)
+ *----------------------------------------------------------------------------*/
+
+static void
+_section_records(const fvm_nodal_section_t  *section,
+                 const cs_gnum_t            *g_vtx_num,
+                 cs_lnum_t                   index[],
+                 cs_gnum_t                 **records)
+{
+  const cs_lnum_t n_elts = section->n_elements;
+
+  cs_gnum_t *r = nullptr;
+
+  index[0] = 0;
+
+  if (section->type == FVM_CELL_POLY) {
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      cs_lnum_t n = 1;
+      for (cs_lnum_t j = section->face_index[i];
+           j < section->face_index[i+1];
+           j++) {
+        cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+        n += 1 + section->vertex_index[f_id+1] - section->vertex_index[f_id];
+      }
+      index[i+1] = index[i] + n;
+    }
+
+    BFT_MALLOC(r, index[n_elts], cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      cs_lnum_t k = index[i];
+      r[k++] = section->face_index[i+1] - section->face_index[i];
+      for (cs_lnum_t j = section->face_index[i];
+           j < section->face_index[i+1];
+           j++) {
+        cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+        cs_lnum_t s_id = section->vertex_index[f_id];
+        cs_lnum_t e_id = section->vertex_index[f_id+1];
+        r[k++] = e_id - s_id;
+        for (cs_lnum_t l = 0; l < e_id - s_id; l++) {
+          cs_lnum_t v_id = (section->face_num[j] > 0) ?
+            section->vertex_num[s_id + l] - 1 :
+            section->vertex_num[e_id - 1 - l] - 1;
+          r[k++] = (g_vtx_num != nullptr) ? g_vtx_num[v_id] - 1 : v_id;
+        }
+      }
+    }
+
+  }
+  else {
+
+    if (section->type == FVM_FACE_POLY) {
+      for (cs_lnum_t i = 0; i < n_elts + 1; i++)
+        index[i] = section->vertex_index[i];
+    }
+    else {
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        index[i+1] = index[i] + section->stride;
+    }
+
+    BFT_MALLOC(r, index[n_elts], cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < index[n_elts]; i++) {
+      cs_lnum_t v_id = section->vertex_num[i] - 1;
+      r[i] = (g_vtx_num != nullptr) ? g_vtx_num[v_id] - 1 : v_id;
+    }
+
+  }
+
+  *records = r;
+}
+
+/*----------------------------------------------------------------------------
+ * Write vertex coordinates.
+ *
+ * parameters:
+ *   w    <-- pointer to writer structure
+ *   mesh <-- pointer to nodal mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_vertex_coords(fvm_to_adios2_writer_t  *w,
+                      const fvm_nodal_t       *mesh)
+{
+  const cs_coord_t  *vertex_coords = mesh->vertex_coords;
+  const cs_lnum_t   *parent_vertex_id = mesh->parent_vertex_id;
+  const cs_lnum_t    n_vertices = mesh->n_vertices;
+  const int          dim = mesh->dim;
+
+  /* Always output 3D coordinates */
+
+  double *part_coords;
+  BFT_MALLOC(part_coords, n_vertices*3, double);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    cs_lnum_t j = (parent_vertex_id != nullptr) ? parent_vertex_id[i] : i;
+    for (int k = 0; k < 3; k++)
+      part_coords[i*3 + k] = (k < dim) ? vertex_coords[j*dim + k] : 0.;
+  }
+
+  char *name = _var_name(mesh->name, "coordinates");
+
+  size_t shape[2] = {(size_t)n_vertices, 3};
+  size_t start[2] = {0, 0};
+  size_t count[2] = {(size_t)n_vertices, 3};
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+
+    cs_block_dist_info_t  bi;
+    cs_part_to_block_t   *d = nullptr;
+
+    fvm_writer_vertex_part_to_block_create(w->min_rank_step,
+                                           w->min_block_size,
+                                           0,
+                                           0,
+                                           mesh,
+                                           &bi,
+                                           &d,
+                                           w->comm);
+
+    cs_lnum_t block_size = bi.gnum_range[1] - bi.gnum_range[0];
+
+    double *block_coords;
+    BFT_MALLOC(block_coords, block_size*3, double);
+
+    cs_part_to_block_copy_array(d, CS_DOUBLE, 3, part_coords, block_coords);
+
+    cs_part_to_block_destroy(&d);
+
+    shape[0] = fvm_io_num_get_global_count(mesh->global_vertex_num);
+    start[0] = bi.gnum_range[0] - 1;
+    count[0] = block_size;
+
+    _put_block(w, name, CS_DOUBLE, 2, shape, start, count, block_coords);
+
+    BFT_FREE(block_coords);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (w->n_ranks == 1)
+    _put_block(w, name, CS_DOUBLE, 2, shape, start, count, part_coords);
+
+  BFT_FREE(name);
+  BFT_FREE(part_coords);
+}
+
+/*----------------------------------------------------------------------------
+ * Write connectivity of a given section.
+ *
+ * Each section is written as a "connectivity" array of element records,
+ * with an additional "sizes" array giving the record size of each element
+ * for polygons and polyhedra.
+ *
+ * parameters:
+ *   w          <-- pointer to writer structure
+ *   mesh       <-- pointer to nodal mesh structure
+ *   section    <-- pointer to nodal mesh section
+ *   section_id <-- id of exported section
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_section(fvm_to_adios2_writer_t     *w,
+                const fvm_nodal_t          *mesh,
+                const fvm_nodal_section_t  *section,
+                int                         section_id)
+{
+  const cs_lnum_t n_elts = section->n_elements;
+  const bool indexed = (section->stride == 0);
+
+  char s_name[64];
+  snprintf(s_name, 63, "section_%d/type", section_id);
+  s_name[63] = '\0';
+
+  char *a_name = _var_name(mesh->name, s_name);
+  _define_attribute(w, a_name, fvm_elements_type_name[section->type]);
+  BFT_FREE(a_name);
+
+  snprintf(s_name, 63, "section_%d/connectivity", section_id);
+  char *c_name = _var_name(mesh->name, s_name);
+  snprintf(s_name, 63, "section_%d/sizes", section_id);
+  char *s_v_name = _var_name(mesh->name, s_name);
+
+  /* Build local records */
+
+  const cs_gnum_t *g_vtx_num = nullptr;
+  if (w->n_ranks > 1)
+    g_vtx_num = fvm_io_num_get_global_num(mesh->global_vertex_num);
+
+  cs_lnum_t *part_index;
+  cs_gnum_t *part_records = nullptr;
+  BFT_MALLOC(part_index, n_elts + 1, cs_lnum_t);
+
+  _section_records(section, g_vtx_num, part_index, &part_records);
+
+  cs_lnum_t block_size = n_elts;
+  cs_gnum_t n_g_elts = n_elts, block_start = 0;
+  cs_lnum_t *block_index = part_index;
+  cs_gnum_t *block_records = part_records;
+
+#if defined(HAVE_MPI)
+
+  cs_part_to_block_t *d = nullptr;
+
+  if (w->n_ranks > 1) {
+
+    n_g_elts = fvm_io_num_get_global_count(section->global_element_num);
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(w->rank,
+                                    w->n_ranks,
+                                    w->min_rank_step,
+                                    w->min_block_size / sizeof(cs_gnum_t),
+                                    n_g_elts);
+
+    d = cs_part_to_block_create_by_gnum
+          (w->comm,
+           bi,
+           n_elts,
+           fvm_io_num_get_global_num(section->global_element_num));
+
+    block_size = bi.gnum_range[1] - bi.gnum_range[0];
+    block_start = bi.gnum_range[0] - 1;
+
+    BFT_MALLOC(block_index, block_size + 1, cs_lnum_t);
+    cs_part_to_block_copy_index(d, part_index, block_index);
+
+    BFT_MALLOC(block_records, block_index[block_size], cs_gnum_t);
+    cs_part_to_block_copy_indexed(d,
+                                  CS_GNUM_TYPE,
+                                  part_index,
+                                  part_records,
+                                  block_index,
+                                  block_records);
+
+    cs_part_to_block_destroy(&d);
+
+    BFT_FREE(part_records);
+    BFT_FREE(part_index);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Global position of local records */
+
+  cs_gnum_t n_l_records = block_index[block_size];
+  cs_gnum_t n_g_records = n_l_records, records_start = 0;
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    MPI_Exscan(&n_l_records, &records_start, 1, CS_MPI_GNUM, MPI_SUM,
+               w->comm);
+    if (w->rank == 0)
+      records_start = 0;
+    MPI_Allreduce(&n_l_records, &n_g_records, 1, CS_MPI_GNUM, MPI_SUM,
+                  w->comm);
+  }
+#endif
+
+  size_t shape[1] = {n_g_records};
+  size_t start[1] = {records_start};
+  size_t count[1] = {n_l_records};
+
+  _put_block(w, c_name, CS_GNUM_TYPE, 1, shape, start, count, block_records);
+
+  if (indexed) {
+    cs_gnum_t *block_sizes;
+    BFT_MALLOC(block_sizes, block_size, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < block_size; i++)
+      block_sizes[i] = block_index[i+1] - block_index[i];
+
+    shape[0] = n_g_elts;
+    start[0] = block_start;
+    count[0] = block_size;
+
+    _put_block(w, s_v_name, CS_GNUM_TYPE, 1, shape, start, count, block_sizes);
+
+    BFT_FREE(block_sizes);
+  }
+
+  BFT_FREE(block_records);
+  BFT_FREE(block_index);
+
+  BFT_FREE(s_v_name);
+  BFT_FREE(c_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Output function for field values.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and field context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start global number of element for current block
+ *   block_end    <-- past-the-end global number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output(void           *context,
+              cs_datatype_t   datatype,
+              int             dimension,
+              int             component_id,
+              cs_gnum_t       block_start,
+              cs_gnum_t       block_end,
+              void           *buffer)
+{
+  CS_UNUSED(component_id);
+
+  _adios2_context_t *c = (_adios2_context_t *)context;
+
+  size_t shape[2] = {c->n_g_ent, (size_t)dimension};
+  size_t start[2] = {block_start - 1, 0};
+  size_t count[2] = {block_end - block_start, (size_t)dimension};
+
+  size_t ndims = (dimension > 1) ? 2 : 1;
+
+  _put_block(c->writer, c->name, datatype, ndims, shape, start, count, buffer);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Returns number of library version strings associated with the ADIOS2
+ * format.
+ *
+ * returns:
+ *   number of library version strings associated with the ADIOS2 format.
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_adios2_n_version_strings(void)
+{
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Returns a library version string associated with the ADIOS2 format.
+ *
+ * parameters:
+ *   string_index <-- index in format's version string list (0 to n-1)
+ *   compile_time <-- 0 by default, 1 if we want the compile-time version
+ *                    string, if different from the run-time version.
+ *
+ * returns:
+ *   pointer to constant string containing the library's version.
+ *----------------------------------------------------------------------------*/
+
+const char *
+fvm_to_adios2_version_string(int string_index,
+                             int compile_time_version)
+{
+  CS_UNUSED(compile_time_version);
+
+  const char * retval = nullptr;
+
+  if (string_index == 0) {
+#if defined(ADIOS2_VERSION_STR)
+    snprintf(_adios2_version_string, 31, "ADIOS2 %s", ADIOS2_VERSION_STR);
+#else
+    snprintf(_adios2_version_string, 31, "ADIOS2");
+#endif
+    _adios2_version_string[31] = '\0';
+    retval = _adios2_version_string;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to ADIOS2 output writer.
+ *
+ * Options are:
+ *   bp4                   use the BP4 file engine
+ *   bp5                   use the BP5 file engine (default)
+ *   sst                   use the SST staging engine (in-transit output)
+ *   async                 let the BP5 engine write data asynchronously
+ *   aggregators=<integer> number of ADIOS2 aggregators (subfiles)
+ *   rank_step=<integer>   MPI rank step for block distribution
+ *   single_precision      output field values in single precision
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   path           <-- base output path.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque ADIOS2 output writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_adios2_init_writer(const char             *name,
+                          const char             *path,
+                          const char             *options,
+                          fvm_writer_time_dep_t   time_dependency,
+                          MPI_Comm                comm)
+#else
+void *
+fvm_to_adios2_init_writer(const char             *name,
+                          const char             *path,
+                          const char             *options,
+                          fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_adios2_writer_t  *w = nullptr;
+
+  /* Parse options */
+
+  int rank_step = 1;
+  int n_aggregators = 0;
+  bool async = false;
+  bool single_precision = false;
+  const char *engine_type = "BP5";
+
+  if (options != nullptr) {
+
+    int i1 = 0, i2 = 0;
+    int l_tot = strlen(options);
+
+    const char rs[] = "rank_step=";
+    const int l_rs = strlen(rs);
+    const char ag[] = "aggregators=";
+    const int l_ag = strlen(ag);
+
+    while (i1 < l_tot) {
+
+      for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
+      int l_opt = i2 - i1;
+
+      if ((l_opt == 3) && (strncmp(options + i1, "bp4", l_opt) == 0))
+        engine_type = "BP4";
+      else if ((l_opt == 3) && (strncmp(options + i1, "bp5", l_opt) == 0))
+        engine_type = "BP5";
+      else if ((l_opt == 3) && (strncmp(options + i1, "sst", l_opt) == 0))
+        engine_type = "SST";
+      else if ((l_opt == 5) && (strncmp(options + i1, "async", l_opt) == 0))
+        async = true;
+      else if (   (l_opt == 16)
+               && (strncmp(options + i1, "single_precision", l_opt) == 0))
+        single_precision = true;
+
+      else if ((strncmp(options + i1, rs, l_rs) == 0)) {
+        if (l_opt < l_rs+32) {
+          char options_c[32];
+          strncpy(options_c, options+i1+l_rs, l_opt-l_rs);
+          options_c[l_opt-l_rs] = '\0';
+          rank_step = atoi(options_c);
+        }
+      }
+
+      else if ((strncmp(options + i1, ag, l_ag) == 0)) {
+        if (l_opt < l_ag+32) {
+          char options_c[32];
+          strncpy(options_c, options+i1+l_ag, l_opt-l_ag);
+          options_c[l_opt-l_ag] = '\0';
+          n_aggregators = atoi(options_c);
+        }
+      }
+
+      for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
+
+    }
+  }
+
+  /* Initialize writer */
+
+  BFT_MALLOC(w, 1, fvm_to_adios2_writer_t);
+
+  BFT_MALLOC(w->name, strlen(name) + 1, char);
+  strcpy(w->name, name);
+
+  int path_len = (path != nullptr) ? strlen(path) : 0;
+  BFT_MALLOC(w->filename, path_len + strlen(name) + strlen(".bp") + 1, char);
+  if (path != nullptr)
+    strcpy(w->filename, path);
+  else
+    w->filename[0] = '\0';
+  strcat(w->filename, name);
+  strcat(w->filename, ".bp");
+
+  w->time_dependency = time_dependency;
+
+  w->single_precision = single_precision;
+
+  w->step_open = false;
+  w->time_step = -1;
+  w->time_value = 0.;
+
+  w->rank = 0;
+  w->n_ranks = 1;
+
+  w->adios = nullptr;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks;
+    w->min_rank_step = 1;
+    w->min_block_size = 1024*1024*8;
+    w->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      w->comm = comm;
+      MPI_Comm_rank(w->comm, &rank);
+      MPI_Comm_size(w->comm, &n_ranks);
+      w->rank = rank;
+      w->n_ranks = n_ranks;
+      if (rank_step < 1)
+        rank_step = 1;
+      else if (rank_step > n_ranks)
+        rank_step = n_ranks;
+      w->min_rank_step = rank_step;
+      w->adios = adios2_init_mpi(comm);
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  if (w->adios == nullptr)
+    w->adios = adios2_init_serial();
+
+  if (w->adios == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error initializing ADIOS2 for writer \"%s\"."), name);
+
+  /* Engine configuration */
+
+  w->io = adios2_declare_io(w->adios, name);
+
+  adios2_set_engine(w->io, engine_type);
+
+  if (strcmp(engine_type, "SST") != 0) {
+    if (async)
+      adios2_set_parameter(w->io, "AsyncWrite", "true");
+    if (n_aggregators > 0) {
+      char n_ag_s[32];
+      snprintf(n_ag_s, 31, "%d", n_aggregators);
+      n_ag_s[31] = '\0';
+      adios2_set_parameter(w->io, "NumAggregators", n_ag_s);
+    }
+  }
+
+  w->engine = adios2_open(w->io, w->filename, adios2_mode_write);
+
+  if (w->engine == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening ADIOS2 output \"%s\" (%s engine)."),
+              w->filename, engine_type);
+
+  /* Return writer */
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to ADIOS2 output writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque ADIOS2 writer structure.
+ *
+ * returns:
+ *   nullptr pointer
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_adios2_finalize_writer(void  *this_writer_p)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _end_step(w);
+
+  if (w->engine != nullptr)
+    adios2_close(w->engine);
+
+  if (w->adios != nullptr)
+    adios2_finalize(w->adios);
+
+  BFT_FREE(w->filename);
+  BFT_FREE(w->name);
+
+  BFT_FREE(w);
+
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an ADIOS2 output.
+ *
+ * A new ADIOS2 step is started when the time step changes.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_set_mesh_time(void          *this_writer_p,
+                            const int      time_step,
+                            const double   time_value)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _begin_step(w, time_step, time_value);
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to an ADIOS2 output.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   mesh          <-- pointer to nodal mesh structure that should be written
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_export_nodal(void               *this_writer_p,
+                           const fvm_nodal_t  *mesh)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _begin_step(w, -1, 0.);
+
+  _export_vertex_coords(w, mesh);
+
+  /* Export sections of highest dimension, in the same order as
+     per-element field values */
+
+  int export_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             export_dim,
+                             export_dim,
+                             -1,
+                             false, /* group by type */
+                             true,  /* group all */
+                             false,
+                             false,
+                             false,
+                             false);
+
+  int section_id = 0;
+  for (const fvm_writer_section_t *s = export_list;
+       s != nullptr;
+       s = s->next)
+    _export_section(w, mesh, s->section, section_id++);
+
+  BFT_FREE(export_list);
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to an ADIOS2 output.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field.
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_export_field(void                  *this_writer_p,
+                           const fvm_nodal_t     *mesh,
+                           const char            *name,
+                           fvm_writer_var_loc_t   location,
+                           int                    dimension,
+                           cs_interlace_t         interlace,
+                           int                    n_parent_lists,
+                           const cs_lnum_t        parent_num_shift[],
+                           cs_datatype_t          datatype,
+                           int                    time_step,
+                           double                 time_value,
+                           const void      *const field_values[])
+{
+  fvm_to_adios2_writer_t  *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _begin_step(w, time_step, time_value);
+
+  char *v_name = _var_name(mesh->name, name);
+
+  _adios2_context_t  c;
+  c.writer = w;
+  c.name = v_name;
+  c.n_g_ent = 0;
+
+  /* Initialize writer helper */
+
+  int export_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             export_dim,
+                             export_dim,
+                             -1,
+                             false, /* group by type */
+                             true,  /* group all */
+                             false,
+                             false,
+                             false,
+                             false);
+
+  fvm_writer_field_helper_t *helper
+    = fvm_writer_field_helper_create(mesh,
+                                     export_list,
+                                     dimension,
+                                     CS_INTERLACE,
+                                     (w->single_precision) ?
+                                       CS_FLOAT : CS_DOUBLE,
+                                     location);
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1)
+    fvm_writer_field_helper_init_g(helper,
+                                   w->min_rank_step,
+                                   w->min_block_size,
+                                   w->comm);
+#endif
+
+  if (location == FVM_WRITER_PER_NODE) {
+
+    c.n_g_ent = mesh->n_vertices;
+    if (w->n_ranks > 1)
+      c.n_g_ent = fvm_io_num_get_global_count(mesh->global_vertex_num);
+
+    fvm_writer_field_helper_output_n(helper,
+                                     &c,
+                                     mesh,
+                                     dimension,
+                                     interlace,
+                                     nullptr,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  }
+
+  else if (location == FVM_WRITER_PER_ELEMENT) {
+
+    for (const fvm_writer_section_t *s = export_list;
+         s != nullptr;
+         s = s->next) {
+      if (w->n_ranks > 1)
+        c.n_g_ent += fvm_io_num_get_global_count(s->section->global_element_num);
+      else
+        c.n_g_ent += s->section->n_elements;
+    }
+
+    fvm_writer_field_helper_output_e(helper,
+                                     &c,
+                                     export_list,
+                                     dimension,
+                                     interlace,
+                                     nullptr,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  }
+
+  /* Free helper structures */
+
+  fvm_writer_field_helper_destroy(&helper);
+  BFT_FREE(export_list);
+
+  BFT_FREE(v_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * The current ADIOS2 step is ended, so that its data is committed
+ * (or made available to staging readers).
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_adios2_flush(void  *this_writer_p)
+{
+  fvm_to_adios2_writer_t *w = (fvm_to_adios2_writer_t *)this_writer_p;
+
+  _end_step(w);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -137,6 +137,8 @@ typedef struct {
   int                   mesh_id;       /* Associated mesh structure id */
   int                   dim;           /* Field dimension */
   vtkUnstructuredGrid  *f;             /* Pointer to VTK writer fields */
+  bool                  shared;        /* Are VTK array values shared with
+                                          (not copied from) caller values ? */
 
 } fvm_catalyst_field_t;
 
@@ -168,6 +170,9 @@ typedef struct {
   bool                        private_comm;    /* Use private communicator */
   bool                        ensight_names;   /* Use EnSight rules for
                                                   field names */
+  bool                        zero_copy;       /* Share compatible field
+                                                  value arrays instead of
+                                                  copying them */
 
   bool                        modified;        /* Has output been added since
                                                   last coprocessing ? */
@@ -976,6 +981,7 @@ _add_catalyst_field(fvm_to_catalyst_t         *writer,
 
   writer->fields[f_id]->dim = dim;
   writer->fields[f_id]->f = f;
+  writer->fields[f_id]->shared = false;
 
   writer->n_fields++;
 
@@ -1009,9 +1015,20 @@ _export_vertex_coords(const fvm_nodal_t        *mesh,
 
   vtkNew<vtkPoints> points;
 
-  points->Allocate(mesh->n_vertices);
+  /* Coordinates with no indirection which are not owned by the nodal mesh
+     (so belong to the parent mesh, and are not freed when the nodal mesh
+     is reduced) are shared rather than copied */
 
-  if (mesh->parent_vertex_id != NULL) {
+  if (   mesh->dim == 3 && mesh->parent_vertex_id == NULL
+      && mesh->_vertex_coords == NULL) {
+    vtkNew<vtkDoubleArray> coords;
+    coords->SetNumberOfComponents(3);
+    coords->SetArray(const_cast<double *>(vertex_coords), n_vertices*3, 1);
+    points->SetData(coords);
+  }
+
+  else if (mesh->parent_vertex_id != NULL) {
+    points->Allocate(mesh->n_vertices);
     const cs_lnum_t  *parent_vertex_id = mesh->parent_vertex_id;
     for (i = 0; i < n_vertices; i++) {
       for (j = 0; j < mesh->dim; j++)
@@ -1022,6 +1039,7 @@ _export_vertex_coords(const fvm_nodal_t        *mesh,
     }
   }
   else {
+    points->Allocate(mesh->n_vertices);
     for (i = 0; i < n_vertices; i++) {
       for (j = 0; j < mesh->dim; j++)
         point[j] = vertex_coords[i*stride + j];
@@ -1232,6 +1250,66 @@ _export_nodal_polyhedra(cs_lnum_t                   n_vertices,
   BFT_FREE(vtx_marker);
 }
 
+/*----------------------------------------------------------------------------
+ * Return pointer to field values which may be shared directly with VTK,
+ * or NULL if values must be converted or reordered.
+ *
+ * Values may be shared when they are double precision, interlaced
+ * (or scalar), not symmetric tensors (which are expanded), and the
+ * exported entities map to the first values of the array in the same order.
+ *
+ * parameters:
+ *   mesh             <-- pointer to nodal mesh structure
+ *   location         <-- variable definition location (nodes or elements)
+ *   dim              <-- field dimension
+ *   interlace        <-- indicates if field in memory is interlaced
+ *   n_parent_lists   <-- number of parent lists
+ *   parent_num_shift <-- parent list to common number index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   field_values     <-- array of associated field value arrays
+ *
+ * returns:
+ *   pointer to shareable values, or NULL
+ *----------------------------------------------------------------------------*/
+
+static const double *
+_shared_field_values(const fvm_nodal_t     *mesh,
+                     fvm_writer_var_loc_t   location,
+                     int                    dim,
+                     cs_interlace_t         interlace,
+                     int                    n_parent_lists,
+                     const cs_lnum_t        parent_num_shift[],
+                     cs_datatype_t          datatype,
+                     const void      *const field_values[])
+{
+  if (   datatype != CS_DOUBLE || dim == 6
+      || (dim > 1 && interlace != CS_INTERLACE))
+    return NULL;
+
+  if (n_parent_lists > 1 || (n_parent_lists == 1 && parent_num_shift[0] != 0))
+    return NULL;
+
+  if (n_parent_lists == 1) {
+
+    if (location == FVM_WRITER_PER_NODE) {
+      if (mesh->parent_vertex_id != NULL)
+        return NULL;
+    }
+    else {
+      const int  elt_dim = fvm_nodal_get_max_entity_dim(mesh);
+      for (int i = 0; i < mesh->n_sections; i++) {
+        const fvm_nodal_section_t  *section = mesh->sections[i];
+        if (section->entity_dim == elt_dim && section->parent_element_id != NULL)
+          return NULL;
+      }
+    }
+
+  }
+
+  return (const double *)field_values[0];
+}
+
 /*----------------------------------------------------------------------------
  * Write field values associated with nodal values of a nodal mesh to VTK.
  *
@@ -1417,6 +1495,9 @@ BEGIN_C_DECLS
  *   names=<fmt>         use same naming rules as <fmt> format
  *                       (default: ensight)
  *   input_name=<name>   define input name (default: writer name)
+ *   zero_copy           share compatible field value arrays with Catalyst
+ *                       instead of copying them; values must remain valid
+ *                       until the writer is flushed (default: false)
  *
  * parameters:
  *   name           <-- base output case name.
@@ -1467,6 +1548,7 @@ fvm_to_catalyst_init_writer(const char             *name,
   w->time_value = 0.0;
 
   w->ensight_names = true;
+  w->zero_copy = false;
   w->input_name = NULL;
 
   /* Writer name */
@@ -1496,6 +1578,8 @@ fvm_to_catalyst_init_writer(const char             *name,
 
       if ((l_opt == 12) && (strncmp(options + i1, "private_comm", l_opt) == 0))
         private_comm = true;
+      else if ((l_opt == 9) && (strncmp(options + i1, "zero_copy", l_opt) == 0))
+        w->zero_copy = true;
       else if ((l_opt > 6) && (strncmp(options + i1, "names=", 6) == 0)) {
         if ((l_opt == 6+7) && (strncmp(options + i1 + 6, "ensight", 7) == 0))
           w->ensight_names = true;
@@ -1674,6 +1758,14 @@ fvm_to_catalyst_export_nodal(void               *this_writer_p,
 
   _export_vertex_coords(mesh, ugrid);
 
+  /* Connectivity is built only once unless it may change with time */
+
+  if (   w->time_dependency != FVM_WRITER_TRANSIENT_CONNECT
+      && ugrid->GetNumberOfCells() > 0) {
+    w->modified = true;
+    return;
+  }
+
   /* Element connectivity size */
   /*---------------------------*/
 
@@ -1829,12 +1921,50 @@ fvm_to_catalyst_export_field(void                  *this_writer_p,
                                    datatype,
                                    location);
 
-  vtkUnstructuredGrid  *f = w->fields[field_id]->f;
+  fvm_catalyst_field_t  *cf = w->fields[field_id];
+  vtkUnstructuredGrid  *f = cf->f;
+
+  /* Share values with VTK when possible (zero-copy) */
+  /*-------------------------------------------------*/
+
+  const double *s_vals = NULL;
+  if (w->zero_copy && location != FVM_WRITER_PER_PARTICLE)
+    s_vals = _shared_field_values(mesh,
+                                  location,
+                                  dimension,
+                                  interlace,
+                                  n_parent_lists,
+                                  parent_num_shift,
+                                  datatype,
+                                  field_values);
+
+  vtkDataSetAttributes *f_data = (location == FVM_WRITER_PER_NODE) ?
+    vtkDataSetAttributes::SafeDownCast(f->GetPointData()) :
+    vtkDataSetAttributes::SafeDownCast(f->GetCellData());
+  vtkDoubleArray *f_array
+    = vtkDoubleArray::SafeDownCast(f_data->GetArray(_name));
+
+  if (s_vals != NULL) {
+    vtkIdType n_tuples = f_array->GetNumberOfTuples();
+    f_array->SetArray(const_cast<double *>(s_vals), n_tuples*dimension, 1);
+    f_array->Modified();
+    cf->shared = true;
+  }
+
+  /* Values previously shared must not be overwritten in place */
+
+  else if (cf->shared) {
+    vtkIdType n_tuples = f_array->GetNumberOfTuples();
+    f_array->Initialize();
+    f_array->SetNumberOfComponents((dimension == 6) ? 9 : dimension);
+    f_array->SetNumberOfTuples(n_tuples);
+    cf->shared = false;
+  }
 
   /* Per node variable */
   /*-------------------*/
 
-  if (location == FVM_WRITER_PER_NODE)
+  if (location == FVM_WRITER_PER_NODE && s_vals == NULL)
     _export_field_values_n(mesh,
                            _name,
                            dimension,
@@ -1849,7 +1979,7 @@ fvm_to_catalyst_export_field(void                  *this_writer_p,
   /* Per element variable */
   /*----------------------*/
 
-  else if (location == FVM_WRITER_PER_ELEMENT)
+  else if (location == FVM_WRITER_PER_ELEMENT && s_vals == NULL)
     _export_field_values_e(mesh,
                            _name,
                            dimension,
@@ -64,6 +64,9 @@ BEGIN_C_DECLS
  *   names=<fmt>         use same naming rules as <fmt> format
  *                       (default: ensight)
  *   input_name=<name>   define input name (default: writer name)
+ *   zero_copy           share compatible field value arrays with Catalyst
+ *                       instead of copying them; values must remain valid
+ *                       until the writer is flushed (default: false)
  *
  * parameters:
  *   name           <-- base output case name.
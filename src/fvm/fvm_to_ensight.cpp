@@ -96,6 +96,10 @@ typedef struct {
 
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
+  fvm_writer_helper_cache_t  *helper_cache;  /* Field output distributions
+                                                cache (fixed meshes only),
+                                                or nullptr */
+
 #if defined(HAVE_MPI)
   int          min_rank_step;      /* Minimum rank step */
   int          min_block_size;     /* Minimum block buffer size */
@@ -2650,6 +2654,12 @@ fvm_to_ensight_init_writer(const char             *name,
                                                       path,
                                                       time_dependency);
 
+  /* With fixed meshes, field output distributions may be reused */
+
+  this_writer->helper_cache = nullptr;
+  if (time_dependency == FVM_WRITER_FIXED_MESH && this_writer->n_ranks > 1)
+    this_writer->helper_cache = fvm_writer_helper_cache_create();
+
   /* Return writer */
 
   return this_writer;
@@ -2675,6 +2685,8 @@ fvm_to_ensight_finalize_writer(void  *this_writer_p)
 
   fvm_to_ensight_case_destroy(this_writer->case_info);
 
+  fvm_writer_helper_cache_destroy(&(this_writer->helper_cache));
+
   BFT_FREE(this_writer);
 
   return nullptr;
@@ -3123,11 +3135,13 @@ fvm_to_ensight_export_field(void                  *this_writer_p,
 
 #if defined(HAVE_MPI)
 
-  if (n_ranks > 1)
+  if (n_ranks > 1) {
     fvm_writer_field_helper_init_g(helper,
                                    w->min_rank_step,
                                    w->min_block_size,
                                    w->comm);
+    fvm_writer_field_helper_set_cache(helper, w->helper_cache);
+  }
 
 #endif
 
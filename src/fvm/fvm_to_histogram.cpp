@@ -35,6 +35,7 @@
 #include <ctype.h>
 #include <errno.h>
 #include <float.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -79,6 +80,10 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Number of weighted points in quantile sketches */
+
+#define _SKETCH_SIZE  256
+
 /*============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -93,6 +98,11 @@ typedef struct {
 
   const char                 *name;      /* Field name */
 
+  int                         n_comps;   /* Number of components */
+  cs_lnum_t                  *n_vals;    /* Number of local values
+                                            per component */
+  cs_real_t                 **vals;      /* Local values per component */
+
 } _histogram_context_t;
 
 /*============================================================================
@@ -107,6 +117,15 @@ static void * _catalyst_plugin = nullptr;
 static fvm_to_histogram_display_t  *_fvm_to_vtk_display_histogram_png = nullptr;
 #endif
 
+/* Quantile levels */
+
+static const double _quantile_levels[CS_HISTOGRAM_N_QUANTILES]
+  = {0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99};
+
+/* Number of histogram subdivisions for sketch merge operator */
+
+static int _sketch_n_sub = 0;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -184,7 +203,16 @@ _display_histogram_txt(cs_real_t                   var_min,
   fprintf(w->f, "# Variable : %s\n\n",var_name);
 
   fprintf(w->f, _("    minimum value =         %10.5e\n"), (double)var_min);
-  fprintf(w->f, _("    maximum value =         %10.5e\n\n"), (double)var_max);
+  fprintf(w->f, _("    maximum value =         %10.5e\n"), (double)var_max);
+  fprintf(w->f, _("    mean value =            %10.5e\n"), w->mean);
+  fprintf(w->f, _("    standard deviation =    %10.5e\n\n"), w->std_dev);
+
+  fprintf(w->f, _("    quantiles (estimated from %llu values):\n"),
+          (unsigned long long)(w->n_g_vals));
+  for (i = 0; i < CS_HISTOGRAM_N_QUANTILES; i++)
+    fprintf(w->f, "      %5.1f %% : %10.5e\n",
+            _quantile_levels[i]*100., w->quantiles[i]);
+  fprintf(w->f, "\n");
 
   var_step = CS_ABS(var_max - var_min) / w->n_sub;
 
@@ -304,58 +332,164 @@ _compute_local_minmax(cs_lnum_t        n_vals,
 }
 
 /*----------------------------------------------------------------------------
- * Display the distribution of values of a real vector.
+ * Compare two real values (qsort function).
  *
  * parameters:
- *   var_min      <--  minimum variable value
- *   var_max      <--  maximum variable value
- *   count        <->  count for each histogram slice (size: w->n_sub)
- *                     local values in, global values out
- *   display_func <--  function pointer to display the histogram
- *   w            <--> histogram writer
- *   var_name     <--  name of the variable
+ *   x <-> pointer to first value
+ *   y <-> pointer to second value
+ *
+ * returns:
+ *   -1 if x < y, 0 if x = y, or 1 if x > y
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_reals(const void  *x,
+               const void  *y)
+{
+  cs_real_t v0 = *(const cs_real_t *)x;
+  cs_real_t v1 = *(const cs_real_t *)y;
+
+  if (v0 < v1)
+    return -1;
+  else if (v0 > v1)
+    return 1;
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Compact sorted, weighted values to a quantile sketch.
+ *
+ * The sketch is a set of _SKETCH_SIZE weighted points; when more values
+ * are given, equal-weight points are placed at regularly spaced cumulative
+ * weights, so the rank error of quantiles is bounded by the total weight
+ * divided by _SKETCH_SIZE. Unused points have a zero weight.
+ *
+ * parameters:
+ *   n   <-- number of values
+ *   x   <-- sorted values
+ *   wt  <-- associated weights, or nullptr for unit weights
+ *   sx  --> sketch point values (size: _SKETCH_SIZE)
+ *   swt --> sketch point weights (size: _SKETCH_SIZE)
  *----------------------------------------------------------------------------*/
 
 static void
-_display_histograms(cs_real_t                   var_min,
-                    cs_real_t                   var_max,
-                    cs_gnum_t                   count[],
-                    fvm_to_histogram_display_t  *display_func,
-                    fvm_to_histogram_writer_t   *w,
-                    char                        *var_name)
+_sketch_compact(cs_lnum_t       n,
+                const double    x[],
+                const double    wt[],
+                double          sx[],
+                double          swt[])
 {
-  int  i;
+  if (n <= _SKETCH_SIZE) {
+    for (cs_lnum_t i = 0; i < n; i++) {
+      sx[i] = x[i];
+      swt[i] = (wt != nullptr) ? wt[i] : 1.;
+    }
+    for (cs_lnum_t i = n; i < _SKETCH_SIZE; i++) {
+      sx[i] = 0.;
+      swt[i] = 0.;
+    }
+    return;
+  }
+
+  double w_tot = 0.;
+  if (wt != nullptr) {
+    for (cs_lnum_t i = 0; i < n; i++)
+      w_tot += wt[i];
+  }
+  else
+    w_tot = n;
+
+  const double w_pt = w_tot / _SKETCH_SIZE;
+
+  cs_lnum_t j = 0;
+  double w_cum = (wt != nullptr) ? wt[0] : 1.;
+
+  for (int i = 0; i < _SKETCH_SIZE; i++) {
+    double w_target = (i + 0.5)*w_pt;
+    while (w_cum < w_target && j < n - 1) {
+      j++;
+      w_cum += (wt != nullptr) ? wt[j] : 1.;
+    }
+    sx[i] = x[j];
+    swt[i] = w_pt;
+  }
+}
 
 #if defined(HAVE_MPI)
 
-  if (w->n_ranks > 1) {
+/*----------------------------------------------------------------------------
+ * Merge histogram sketches (MPI user reduction operator).
+ *
+ * Each sketch is an array of doubles containing the number of values,
+ * the sum and sum of squares of values relative to the global minimum,
+ * the _sketch_n_sub subdivision counts, then the quantile sketch values
+ * and weights.
+ *
+ * parameters:
+ *   invec    <-- input sketches
+ *   inoutvec <-> input and output sketches
+ *   len      <-- number of sketches
+ *   dtype    <-- associated MPI datatype
+ *----------------------------------------------------------------------------*/
 
-    cs_gnum_t *g_count = nullptr;
+static void
+_sketch_merge(void          *invec,
+              void          *inoutvec,
+              int           *len,
+              MPI_Datatype  *dtype)
+{
+  CS_UNUSED(dtype);
 
-    BFT_MALLOC(g_count, w->n_sub, cs_gnum_t);
+  const int n_sub = _sketch_n_sub;
+  const int s_size = 3 + n_sub + 2*_SKETCH_SIZE;
 
-    MPI_Allreduce(count, g_count, w->n_sub, CS_MPI_GNUM, MPI_SUM,
-                  w->comm);
+  double x[2*_SKETCH_SIZE], wt[2*_SKETCH_SIZE];
 
-    for (i = 0; i < w->n_sub; i++)
-      count[i] = g_count[i];
+  for (int s_id = 0; s_id < *len; s_id++) {
 
-    BFT_FREE(g_count);
-  }
+    const double *a = (const double *)invec + s_id*s_size;
+    double *b = (double *)inoutvec + s_id*s_size;
 
-#endif
+    for (int i = 0; i < 3 + n_sub; i++)
+      b[i] += a[i];
+
+    /* Merge sorted sketch points (skipping unused points) */
+
+    const double *ax = a + 3 + n_sub, *aw = ax + _SKETCH_SIZE;
+    double *bx = b + 3 + n_sub, *bw = bx + _SKETCH_SIZE;
+
+    int i = 0, j = 0, n = 0;
+    while (i < _SKETCH_SIZE || j < _SKETCH_SIZE) {
+      if (i < _SKETCH_SIZE && aw[i] <= 0.)
+        i = _SKETCH_SIZE;
+      if (j < _SKETCH_SIZE && bw[j] <= 0.)
+        j = _SKETCH_SIZE;
+      if (i < _SKETCH_SIZE && (j >= _SKETCH_SIZE || ax[i] <= bx[j])) {
+        x[n] = ax[i]; wt[n] = aw[i]; i++; n++;
+      }
+      else if (j < _SKETCH_SIZE) {
+        x[n] = bx[j]; wt[n] = bw[j]; j++; n++;
+      }
+    }
+
+    _sketch_compact(n, x, wt, bx, bw);
 
-  if (w->rank == 0)
-    display_func(var_min, var_max, count, w, var_name);
+  }
 }
 
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Display the distribution of values of a real vector on cells or
  * boundary faces.
  *
+ * Values are binned and summarized locally; the global histogram, moments,
+ * and quantile sketch are then obtained through a single reduction
+ * (after that of the global bounds), so no field values are exchanged.
+ *
  * parameters:
  *   n_vals       <--  number of values
- *   var          <--  variable values
+ *   var          <->  variable values (sorted on output)
  *   display_func <--  function pointer to display the histogram
  *   w            <--> histogram writer
  *   var_name     <--  name of the variable
@@ -363,21 +497,13 @@ _display_histograms(cs_real_t                   var_min,
 
 static void
 _histogram(cs_lnum_t                    n_vals,
-           const cs_real_t              var[],
+           cs_real_t                    var[],
            fvm_to_histogram_display_t  *display_func,
            fvm_to_histogram_writer_t   *w,
            char                        *var_name)
 {
-  cs_lnum_t  i;
-  int        j, k;
-
-  cs_real_t  step;
   cs_real_t  max, min, _max, _min;
 
-  cs_gnum_t *count = nullptr;
-
-  BFT_MALLOC(count, w->n_sub, cs_gnum_t);
-
   assert (sizeof(double) == sizeof(cs_real_t));
 
   /* Compute global min and max */
@@ -392,77 +518,155 @@ _histogram(cs_lnum_t                    n_vals,
 #if defined(HAVE_MPI)
 
   if (w->n_ranks > 1) {
-    MPI_Allreduce(&_min, &min, 1, CS_MPI_REAL, MPI_MIN,
-                  w->comm);
-
-    MPI_Allreduce(&_max, &max, 1, CS_MPI_REAL, MPI_MAX,
-                  w->comm);
+    double minmax[2] = {-_min, _max};
+    MPI_Allreduce(MPI_IN_PLACE, minmax, 2, MPI_DOUBLE, MPI_MAX, w->comm);
+    min = -minmax[0];
+    max = minmax[1];
   }
 
 #endif
 
-  /* Define axis subdivisions */
+  /* Local sketch: number of values, shifted sums, counts, and
+     quantile sketch points */
+
+  const int n_sub = w->n_sub;
+  const int s_size = 3 + n_sub + 2*_SKETCH_SIZE;
+
+  double *sketch = nullptr;
+  BFT_MALLOC(sketch, s_size, double);
 
-  for (j = 0; j < w->n_sub; j++)
-    count[j] = 0;
+  for (int j = 0; j < 3 + n_sub; j++)
+    sketch[j] = 0.;
+
+  double *count = sketch + 3;
+
+  sketch[0] = n_vals;
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    double d = var[i] - min;
+    sketch[1] += d;
+    sketch[2] += d*d;
+  }
 
   if (CS_ABS(max - min) > 0.) {
 
-    step = CS_ABS(max - min) / w->n_sub;
+    const cs_real_t step = CS_ABS(max - min) / n_sub;
 
-    /* Loop on values */
+    for (cs_lnum_t i = 0; i < n_vals; i++) {
+      int j = (int)((var[i] - min) / step);
+      if (j >= n_sub)
+        j = n_sub - 1;
+      else if (j < 0)
+        j = 0;
+      count[j] += 1;
+    }
 
-    for (i = 0; i < n_vals; i++) {
+  }
 
-      /* Associated subdivision */
+  qsort(var, n_vals, sizeof(cs_real_t), _compare_reals);
+
+  _sketch_compact(n_vals,
+                  var,
+                  nullptr,
+                  sketch + 3 + n_sub,
+                  sketch + 3 + n_sub + _SKETCH_SIZE);
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
 
-      for (j = 0, k = 1; k < w->n_sub; j++, k++) {
-        if (var[i] < min + k*step)
+    double *g_sketch = nullptr;
+    BFT_MALLOC(g_sketch, s_size, double);
+
+    MPI_Datatype s_type;
+    MPI_Op s_op;
+
+    _sketch_n_sub = n_sub;
+
+    MPI_Type_contiguous(s_size, MPI_DOUBLE, &s_type);
+    MPI_Type_commit(&s_type);
+    MPI_Op_create(_sketch_merge, 1, &s_op);
+
+    MPI_Reduce(sketch, g_sketch, 1, s_type, s_op, 0, w->comm);
+
+    MPI_Op_free(&s_op);
+    MPI_Type_free(&s_type);
+
+    BFT_FREE(sketch);
+    sketch = g_sketch;
+    count = sketch + 3;
+
+  }
+
+#endif
+
+  if (w->rank == 0) {
+
+    /* Moments */
+
+    w->n_g_vals = (cs_gnum_t)(sketch[0] + 0.5);
+    w->mean = min;
+    w->std_dev = 0.;
+    if (sketch[0] > 0) {
+      double m = sketch[1] / sketch[0];
+      w->mean = min + m;
+      w->std_dev = sqrt(CS_MAX(sketch[2]/sketch[0] - m*m, 0.));
+    }
+
+    /* Quantiles from the (sorted) sketch points */
+
+    const double *sx = sketch + 3 + n_sub;
+    const double *swt = sx + _SKETCH_SIZE;
+
+    double w_tot = 0.;
+    for (int i = 0; i < _SKETCH_SIZE; i++)
+      w_tot += swt[i];
+
+    for (int q_id = 0; q_id < CS_HISTOGRAM_N_QUANTILES; q_id++) {
+      double w_target = _quantile_levels[q_id]*w_tot;
+      double w_cum = 0.;
+      int i = 0;
+      while (i < _SKETCH_SIZE - 1 && swt[i+1] > 0.) {
+        w_cum += swt[i];
+        if (w_cum >= w_target)
           break;
+        i++;
       }
-      count[j] += 1;
-
+      w->quantiles[q_id] = CS_MIN(CS_MAX(sx[i], min), max);
     }
 
-  }
+    /* Histogram */
 
-  _display_histograms(min, max, count, display_func, w, var_name);
+    cs_gnum_t *g_count = nullptr;
+    BFT_MALLOC(g_count, n_sub, cs_gnum_t);
+
+    for (int j = 0; j < n_sub; j++)
+      g_count[j] = (cs_gnum_t)(count[j] + 0.5);
+
+    display_func(min, max, g_count, w, var_name);
 
-  BFT_FREE(count);
+    BFT_FREE(g_count);
+
+  }
+
+  BFT_FREE(sketch);
 }
 
 /*----------------------------------------------------------------------------
- * Output function for field values.
- *
- * This function is passed to fvm_writer_field_helper_output_* functions.
+ * Output histogram of a given field component.
  *
  * parameters:
- *   context      <-> pointer to writer and field context
- *   datatype     <-- output datatype
+ *   c            <-> pointer to writer and field context
  *   dimension    <-- output field dimension
- *   component_id <-- output component id (if non-interleaved)
- *   block_start  <-- start global number of element for current block
- *   block_end    <-- past-the-end global number of element for current block
- *   buffer       <-> associated output buffer
+ *   component_id <-- output component id
  *----------------------------------------------------------------------------*/
 
 static void
-_field_output(void           *context,
-              cs_datatype_t   datatype,
-              int             dimension,
-              int             component_id,
-              cs_gnum_t       block_start,
-              cs_gnum_t       block_end,
-              void           *buffer)
+_component_output(_histogram_context_t  *c,
+                  int                    dimension,
+                  int                    component_id)
 {
-  CS_UNUSED(datatype);
-
-  _histogram_context_t *c = (_histogram_context_t *)context;
-
   fvm_to_histogram_writer_t  *w = c->writer;
 
-  const int n_vals = (block_end > block_start) ? block_end - block_start : 0;
-
   char tmpn[128], tmpe[6];
 
   char *var_name = tmpn;
@@ -491,7 +695,8 @@ _field_output(void           *context,
 
   BFT_REALLOC(w->file_name, l, char);
 
-  const cs_real_t *vals = (const cs_real_t *)buffer;
+  const cs_lnum_t n_vals = c->n_vals[component_id];
+  cs_real_t *vals = c->vals[component_id];
 
   if (w->format == CS_HISTOGRAM_TXT) {
 
@@ -511,6 +716,59 @@ _field_output(void           *context,
 
 #endif
   }
+
+  if (var_name != tmpn)
+    BFT_FREE(var_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Output function for field values.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and field context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start global number of element for current block
+ *   block_end    <-- past-the-end global number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output(void           *context,
+              cs_datatype_t   datatype,
+              int             dimension,
+              int             component_id,
+              cs_gnum_t       block_start,
+              cs_gnum_t       block_end,
+              void           *buffer)
+{
+  CS_UNUSED(dimension);
+
+  _histogram_context_t *c = (_histogram_context_t *)context;
+
+  const cs_lnum_t n_vals = (block_end > block_start) ? block_end - block_start : 0;
+
+  /* Values are appended to those of previous sections;
+     the histogram is built once all sections are processed. */
+
+  cs_lnum_t n_prev = c->n_vals[component_id];
+
+  BFT_REALLOC(c->vals[component_id], n_prev + n_vals, cs_real_t);
+
+  cs_real_t *vals = c->vals[component_id] + n_prev;
+
+  if (datatype == CS_INT64) {
+    const int64_t *src = (const int64_t *)buffer;
+    for (cs_lnum_t i = 0; i < n_vals; i++)
+      vals[i] = src[i];
+  }
+  else
+    memcpy(vals, buffer, n_vals*sizeof(cs_real_t));
+
+  c->n_vals[component_id] += n_vals;
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -598,6 +856,12 @@ fvm_to_histogram_init_writer(const char             *name,
 
   w->n_sub = 5; /* default */
 
+  w->n_g_vals = 0;
+  w->mean = 0.;
+  w->std_dev = 0.;
+  for (int i = 0; i < CS_HISTOGRAM_N_QUANTILES; i++)
+    w->quantiles[i] = 0.;
+
   /* Parse options */
 
   if (options != nullptr) {
@@ -785,35 +1049,50 @@ fvm_to_histogram_export_field(void                  *writer,
                                      dest_datatype,
                                      location);
 
-#if defined(HAVE_MPI)
+  /* Values are extracted locally (in partition order), since only
+     local summaries need to be reduced */
 
-  if (w->n_ranks > 1)
-    fvm_writer_field_helper_init_g(helper,
-                                   w->n_ranks,
-                                   0,
-                                   w->comm);
-
-#endif
+  _histogram_context_t c = {.writer = w, .name = name,
+                            .n_comps = dimension, .n_vals = nullptr,
+                            .vals = nullptr};
 
-  _histogram_context_t c = {.writer = w, .name = name};
+  BFT_MALLOC(c.n_vals, dimension, cs_lnum_t);
+  BFT_MALLOC(c.vals, dimension, cs_real_t *);
+  for (int i = 0; i < dimension; i++) {
+    c.n_vals[i] = 0;
+    c.vals[i] = nullptr;
+  }
 
-  fvm_writer_field_helper_output_e(helper,
-                                   &c,
-                                   export_list,
-                                   dimension,
-                                   interlace,
-                                   nullptr,
-                                   n_parent_lists,
-                                   parent_num_shift,
-                                   datatype,
-                                   field_values,
-                                   _field_output);
+  const fvm_writer_section_t  *export_sec = export_list;
+
+  while (export_sec != nullptr)
+    export_sec = fvm_writer_field_helper_output_e(helper,
+                                                  &c,
+                                                  export_sec,
+                                                  dimension,
+                                                  interlace,
+                                                  nullptr,
+                                                  n_parent_lists,
+                                                  parent_num_shift,
+                                                  datatype,
+                                                  field_values,
+                                                  _field_output);
 
   BFT_FREE(export_list);
 
   /* Free helper structures */
 
   fvm_writer_field_helper_destroy(&helper);
+
+  /* Output histograms */
+
+  for (int i = 0; i < dimension; i++) {
+    _component_output(&c, dimension, i);
+    BFT_FREE(c.vals[i]);
+  }
+
+  BFT_FREE(c.vals);
+  BFT_FREE(c.n_vals);
 }
 
 /*----------------------------------------------------------------------------
@@ -46,6 +46,10 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of quantiles reported with histograms */
+
+#define CS_HISTOGRAM_N_QUANTILES  7
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -82,6 +86,16 @@ typedef struct {
 
   int               n_sub;         /* Number of subdivisions */
 
+  /* Statistics of the variable being output
+     (based on a mergeable quantile sketch for quantiles) */
+
+  cs_gnum_t         n_g_vals;      /* Global number of values */
+  double            mean;          /* Mean value */
+  double            std_dev;       /* Standard deviation */
+  double            quantiles[CS_HISTOGRAM_N_QUANTILES];  /* Quantiles at
+                                                  levels 1, 5, 25, 50, 75,
+                                                  95 and 99 % */
+
 #if defined(HAVE_MPI)
   MPI_Comm     comm;               /* Associated MPI communicator */
 #endif
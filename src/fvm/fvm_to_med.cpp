@@ -147,6 +147,7 @@ typedef struct {
   bool        discard_polyhedra;  /* Option to discard polyhedral elements */
   bool        divide_polygons;    /* Option to tesselate polygonal elements */
   bool        divide_polyhedra;   /* Option to tesselate polyhedral elements */
+  bool        single_precision;   /* Output real field values as float32 */
 
   int         rank;            /* Rank of current process in communicator */
   int         n_ranks;         /* Number of processes in communicator */
@@ -973,6 +974,7 @@ _get_connect_buffer_size(const fvm_to_med_writer_t   *writer,
  *
  * parameters:
  *   input_cs_datatype   <-- input field datatype in FVM.
+ *   single_precision    <-- output real values in single precision
  *   output_cs_datatype  --> output field datatype in FVM.
  *   med_datatype        --> associated MED field datatype.
  *   data_sizeof         --> size of datatype to be exported.
@@ -980,6 +982,7 @@ _get_connect_buffer_size(const fvm_to_med_writer_t   *writer,
 
 static void
 _get_datatypes(const cs_datatype_t    input_cs_datatype,
+               bool                   single_precision,
                cs_datatype_t         *output_cs_datatype,
                med_field_type        *med_datatype,
                int                   *data_sizeof)
@@ -1065,6 +1068,19 @@ _get_datatypes(const cs_datatype_t    input_cs_datatype,
   *med_datatype = MED_FLOAT64;
 #endif
 
+  /* Real values may be reduced to single precision (values are converted
+     block by block by the writer helper, so no full copy is needed) */
+
+#if MED_MAJOR_NUM >= 4
+  if (single_precision && *med_datatype == MED_FLOAT64) {
+    *output_cs_datatype = CS_FLOAT;
+    *med_datatype = MED_FLOAT32;
+    *data_sizeof = 4;
+  }
+#else
+  CS_UNUSED(single_precision);
+#endif
+
   return;
 }
 
@@ -4113,6 +4129,8 @@ fvm_to_med_version_string(int string_index,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   serial_io           force serial IO even when parallel IO is available
+ *   single_precision    output real field values in single precision
+ *                       (requires MED 4.0 or above)
  *   update              open file in update mode
  *
  * parameters:
@@ -4216,6 +4234,7 @@ fvm_to_med_init_writer(const char                   *name,
   writer->discard_polyhedra = false;
   writer->divide_polygons = false;
   writer->divide_polyhedra = false;
+  writer->single_precision = false;
 
   if (options != nullptr) {
 
@@ -4256,6 +4275,17 @@ fvm_to_med_init_writer(const char                   *name,
                && (strncmp(options + i1, "update", l_opt) == 0))
         writer->allow_update = true;
 
+      else if (   (l_opt == 16)
+               && (strncmp(options + i1, "single_precision", l_opt) == 0)) {
+#if MED_MAJOR_NUM >= 4
+        writer->single_precision = true;
+#else
+        if (writer->rank == 0)
+          bft_printf(_("MED writer \"%s\": single_precision option requires\n"
+                       "MED 4.0 or above; ignored.\n"), name);
+#endif
+      }
+
       for (i1 = i2 + 1 ; i1 < l_tot && options[i1] == ' ' ; i1++);
 
     }
@@ -4822,6 +4852,7 @@ fvm_to_med_export_field(void                            *this_writer,
   /* Adapt cs_datatype and find corresponding MED datatype */
 
   _get_datatypes(datatype,
+                 writer->single_precision,
                  &datatype_convert,
                  &datatype_med,
                  &data_sizeof);
@@ -108,6 +108,8 @@ fvm_to_med_version_string(int string_index,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   serial_io           force serial IO even when parallel IO is available
+ *   single_precision    output real field values in single precision
+ *                       (requires MED 4.0 or above)
  *
  * parameters:
  *   name           <-- base output case name.
@@ -75,6 +75,18 @@ BEGIN_C_DECLS
  * Local Type Definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Field values staged for batched output
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char       *name;                /* Field name */
+  int         dim;                 /* Field dimension */
+  cs_real_t  *vals;                /* Local values (interlaced) */
+
+} _staged_field_t;
+
 /*----------------------------------------------------------------------------
  * time plot writer structure
  *----------------------------------------------------------------------------*/
@@ -105,6 +117,13 @@ typedef struct {
   cs_map_name_to_id_t   *f_map;    /* field names to plots mapping */
   cs_time_plot_t  **tp;            /* Associated plots */
 
+  const fvm_nodal_t  *staged_mesh; /* Mesh associated with staged fields */
+  int               n_staged;      /* Number of staged fields */
+  int               n_staged_max;  /* Size of staged fields array */
+  _staged_field_t  *staged;        /* Real field values staged for the
+                                      current time step, gathered and
+                                      written together on flush */
+
 #if defined(HAVE_MPI)
   MPI_Comm     comm;               /* Associated MPI communicator */
 #endif
@@ -182,9 +201,11 @@ _coords_output(void           *context,
 
   BFT_MALLOC(file_name, l, char);
 
+  /* Coordinates are written in CSV format for binary plots */
+
   if (w->format == CS_TIME_PLOT_DAT)
     sprintf(file_name, "%scoords%s.dat", w->prefix, t_stamp);
-  else if (w->format == CS_TIME_PLOT_CSV)
+  else
     sprintf(file_name, "%scoords%s.csv", w->prefix, t_stamp);
 
   _f = fopen(file_name, "w");
@@ -239,7 +260,7 @@ _coords_output(void           *context,
 
   /* CSV format */
 
-  else if (w->format == CS_TIME_PLOT_CSV) {
+  else {
 
     switch(dimension) {
     case 3:
@@ -275,6 +296,79 @@ _coords_output(void           *context,
   BFT_FREE(file_name);
 }
 
+/*----------------------------------------------------------------------------
+ * Return plot for a given field component, creating it if necessary.
+ *
+ * parameters:
+ *   w            <-> pointer to writer structure
+ *   mesh         <-- pointer to associated mesh
+ *   name         <-- field name
+ *   dimension    <-- field dimension
+ *   component_id <-- component id
+ *   n_probes     <-- number of probes
+ *
+ * returns:
+ *   pointer to associated plot
+ *----------------------------------------------------------------------------*/
+
+static cs_time_plot_t *
+_get_plot(fvm_to_time_plot_writer_t  *w,
+          const fvm_nodal_t          *mesh,
+          const char                 *name,
+          int                         dimension,
+          int                         component_id,
+          int                         n_probes)
+{
+  /* Build plot name */
+
+  char tmpn[128], tmpe[6];
+
+  char *plot_name = tmpn;
+
+  fvm_writer_field_component_name(tmpe, 6, false, dimension, component_id);
+
+  size_t lce = strlen(tmpe);
+  size_t l =  strlen(name) + 1;
+
+  if (lce > 0)
+    l += 2 + lce;
+
+  if (l > 128)
+    BFT_MALLOC(plot_name, l, char);
+
+  if (lce > 0)
+    sprintf(plot_name, "%s[%s]", name, tmpe);
+  else
+    strcpy(plot_name, name);
+
+  int p_id = cs_map_name_to_id(w->f_map, plot_name);
+
+  if (p_id >= w->n_plots) {
+
+    w->n_plots += 1;
+    BFT_REALLOC(w->tp, w->n_plots, cs_time_plot_t *);
+
+    const char **probe_names = fvm_nodal_get_global_vertex_labels(mesh);
+
+    w->tp[p_id] = cs_time_plot_init_probe(plot_name,
+                                          w->prefix,
+                                          w->format,
+                                          w->use_iteration,
+                                          w->flush_wtime,
+                                          w->n_buf_steps,
+                                          n_probes,
+                                          nullptr,
+                                          nullptr, /* probe_coords */
+                                          probe_names);
+
+  }
+
+  if (plot_name != tmpn)
+    BFT_FREE(plot_name);
+
+  return w->tp[p_id];
+}
+
 /*----------------------------------------------------------------------------
  * Output function for field values.
  *
@@ -317,75 +411,228 @@ _field_output(void           *context,
   if (dimension > 1)
     BFT_MALLOC(_vals, n_vals, cs_real_t);
 
+  int n_probes = (block_end > block_start) ? block_end - block_start : 0;
+
   for (int _component_id = 0; _component_id < dimension; _component_id++) {
 
-    /* Build plot name */
+    p = _get_plot(w, c->mesh, c->name, dimension, _component_id, n_probes);
 
-    char tmpn[128], tmpe[6];
+    if (p != nullptr) {
+      const cs_real_t *vals = (const cs_real_t *)buffer;
+      if (dimension > 1) {
+        for (int i = 0; i < n_vals; i++)
+          _vals[i] = vals[i*dimension + _component_id];
+        vals = _vals;
+      }
+      cs_time_plot_vals_write(p,
+                              w->nt,
+                              w->t,
+                              n_vals,
+                              vals);
+    }
+  }
 
-    char *plot_name = tmpn;
+  BFT_FREE(_vals);
+}
 
-    fvm_writer_field_component_name(tmpe, 6, false, dimension, _component_id);
+/*----------------------------------------------------------------------------
+ * Gather and write staged field values.
+ *
+ * All staged fields are gathered to rank 0 in a single operation.
+ *
+ * parameters:
+ *   w <-> pointer to writer structure
+ *----------------------------------------------------------------------------*/
 
-    size_t lce = strlen(tmpe);
-    size_t l =  strlen(c->name) + 1;
+static void
+_staged_output(fvm_to_time_plot_writer_t  *w)
+{
+  if (w->n_staged < 1)
+    return;
 
-    if (lce > 0)
-      l += 2 + lce;
+  const fvm_nodal_t *mesh = w->staged_mesh;
 
-    if (l > 128)
-      BFT_MALLOC(plot_name, l, char);
+  const cs_lnum_t n_vtx = mesh->n_vertices;
+  const cs_gnum_t n_g_vtx = fvm_nodal_get_n_g_vertices(mesh);
 
-    if (lce > 0)
-      sprintf(plot_name, "%s[%s]", c->name, tmpe);
-    else
-      strcpy(plot_name, c->name);
+  int stride = 0;
+  for (int i = 0; i < w->n_staged; i++)
+    stride += w->staged[i].dim;
 
-    int p_id = cs_map_name_to_id(w->f_map, plot_name);
+  /* Pack local values by probe */
 
-    if (p_id >= w->n_plots) {
+  cs_real_t *l_vals;
+  BFT_MALLOC(l_vals, (size_t)n_vtx*stride, cs_real_t);
 
-      w->n_plots += 1;
-      BFT_REALLOC(w->tp, w->n_plots, cs_time_plot_t *);
+  int s_id = 0;
+  for (int i = 0; i < w->n_staged; i++) {
+    const _staged_field_t *sf = w->staged + i;
+    for (cs_lnum_t j = 0; j < n_vtx; j++) {
+      for (int k = 0; k < sf->dim; k++)
+        l_vals[(size_t)j*stride + s_id + k] = sf->vals[j*sf->dim + k];
+    }
+    s_id += sf->dim;
+  }
+
+  /* Gather values in global probe order */
+
+  cs_real_t *g_vals = l_vals;
 
-      int n_probes = (block_end > block_start) ? block_end - block_start : 0;
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
 
-      const char **probe_names = fvm_nodal_get_global_vertex_labels(c->mesh);
+    const cs_gnum_t *g_num = nullptr;
+    if (mesh->global_vertex_num != nullptr)
+      g_num = fvm_io_num_get_global_num(mesh->global_vertex_num);
 
-      w->tp[p_id] = cs_time_plot_init_probe(plot_name,
-                                            w->prefix,
-                                            w->format,
-                                            w->use_iteration,
-                                            w->flush_wtime,
-                                            w->n_buf_steps,
-                                            n_probes,
-                                            nullptr,
-                                            nullptr, /* probe_coords */
-                                            probe_names);
+    int n_send = n_vtx;
+    int *recv_count = nullptr, *recv_displ = nullptr;
+    cs_gnum_t *r_g_num = nullptr;
+    cs_real_t *r_vals = nullptr;
 
+    if (w->rank == 0) {
+      BFT_MALLOC(recv_count, w->n_ranks, int);
+      BFT_MALLOC(recv_displ, w->n_ranks + 1, int);
     }
 
-    if (plot_name != tmpn)
-      BFT_FREE(plot_name);
+    MPI_Gather(&n_send, 1, MPI_INT, recv_count, 1, MPI_INT, 0, w->comm);
 
-    p = w->tp[p_id];
+    if (w->rank == 0) {
+      recv_displ[0] = 0;
+      for (int i = 0; i < w->n_ranks; i++)
+        recv_displ[i+1] = recv_displ[i] + recv_count[i];
+      BFT_MALLOC(r_g_num, recv_displ[w->n_ranks], cs_gnum_t);
+    }
 
-    if (p != nullptr) {
-      const cs_real_t *vals = (const cs_real_t *)buffer;
-      if (dimension > 1) {
-        for (int i = 0; i < n_vals; i++)
-          _vals[i] = vals[i*dimension + _component_id];
-        vals = _vals;
+    MPI_Gatherv(g_num, n_send, CS_MPI_GNUM,
+                r_g_num, recv_count, recv_displ, CS_MPI_GNUM,
+                0, w->comm);
+
+    if (w->rank == 0) {
+      for (int i = 0; i < w->n_ranks; i++) {
+        recv_count[i] *= stride;
+        recv_displ[i] *= stride;
       }
-      cs_time_plot_vals_write(p,
-                              w->nt,
-                              w->t,
-                              n_vals,
-                              vals);
+      BFT_MALLOC(r_vals, (size_t)recv_displ[w->n_ranks]*stride, cs_real_t);
+    }
+
+    MPI_Gatherv(l_vals, n_send*stride, CS_MPI_REAL,
+                r_vals, recv_count, recv_displ, CS_MPI_REAL,
+                0, w->comm);
+
+    if (w->rank == 0) {
+      BFT_MALLOC(g_vals, (size_t)n_g_vtx*stride, cs_real_t);
+      const cs_lnum_t n_recv = recv_displ[w->n_ranks] / stride;
+      for (cs_lnum_t j = 0; j < n_recv; j++) {
+        cs_gnum_t g_id = r_g_num[j] - 1;
+        for (int k = 0; k < stride; k++)
+          g_vals[g_id*stride + k] = r_vals[(size_t)j*stride + k];
+      }
+      BFT_FREE(r_vals);
+      BFT_FREE(r_g_num);
+      BFT_FREE(recv_displ);
+      BFT_FREE(recv_count);
     }
+
   }
 
-  BFT_FREE(_vals);
+#endif /* defined(HAVE_MPI) */
+
+  /* Write plots */
+
+  if (w->rank == 0) {
+
+    cs_real_t *p_vals;
+    BFT_MALLOC(p_vals, n_g_vtx, cs_real_t);
+
+    s_id = 0;
+    for (int i = 0; i < w->n_staged; i++) {
+      const _staged_field_t *sf = w->staged + i;
+      for (int k = 0; k < sf->dim; k++) {
+        cs_time_plot_t *p = _get_plot(w, mesh, sf->name, sf->dim, k, n_g_vtx);
+        for (cs_gnum_t j = 0; j < n_g_vtx; j++)
+          p_vals[j] = g_vals[j*stride + s_id + k];
+        cs_time_plot_vals_write(p, w->nt, w->t, n_g_vtx, p_vals);
+      }
+      s_id += sf->dim;
+    }
+
+    BFT_FREE(p_vals);
+
+  }
+
+  if (g_vals != l_vals)
+    BFT_FREE(g_vals);
+  BFT_FREE(l_vals);
+
+  /* Clear staged values */
+
+  for (int i = 0; i < w->n_staged; i++) {
+    BFT_FREE(w->staged[i].name);
+    BFT_FREE(w->staged[i].vals);
+  }
+  w->n_staged = 0;
+  w->staged_mesh = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Stage real field values for batched output.
+ *
+ * parameters:
+ *   w            <-> pointer to writer structure
+ *   mesh         <-- pointer to associated mesh
+ *   name         <-- field name
+ *   dimension    <-- field dimension
+ *   interlace    <-- indicates if field values are interlaced
+ *   datatype     <-- field values datatype (CS_FLOAT or CS_DOUBLE)
+ *   field_values <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_stage_field(fvm_to_time_plot_writer_t  *w,
+             const fvm_nodal_t          *mesh,
+             const char                 *name,
+             int                         dimension,
+             cs_interlace_t              interlace,
+             cs_datatype_t               datatype,
+             const void           *const field_values[])
+{
+  if (mesh != w->staged_mesh)
+    _staged_output(w);
+
+  w->staged_mesh = mesh;
+
+  if (w->n_staged >= w->n_staged_max) {
+    w->n_staged_max = CS_MAX(w->n_staged_max*2, 8);
+    BFT_REALLOC(w->staged, w->n_staged_max, _staged_field_t);
+  }
+
+  _staged_field_t *sf = w->staged + w->n_staged;
+  w->n_staged += 1;
+
+  const cs_lnum_t n_vtx = mesh->n_vertices;
+
+  BFT_MALLOC(sf->name, strlen(name) + 1, char);
+  strcpy(sf->name, name);
+  sf->dim = dimension;
+  BFT_MALLOC(sf->vals, n_vtx*dimension, cs_real_t);
+
+  for (int k = 0; k < dimension; k++) {
+    int src_id = (interlace == CS_INTERLACE) ? 0 : k;
+    int src_stride = (interlace == CS_INTERLACE) ? dimension : 1;
+    int src_shift = (interlace == CS_INTERLACE) ? k : 0;
+    if (datatype == CS_DOUBLE) {
+      const double *src = (const double *)field_values[src_id];
+      for (cs_lnum_t j = 0; j < n_vtx; j++)
+        sf->vals[j*dimension + k] = src[j*src_stride + src_shift];
+    }
+    else {
+      const float *src = (const float *)field_values[src_id];
+      for (cs_lnum_t j = 0; j < n_vtx; j++)
+        sf->vals[j*dimension + k] = src[j*src_stride + src_shift];
+    }
+  }
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -400,6 +647,7 @@ _field_output(void           *context,
  * Options are:
  *   csv                 output CSV (comma-separated-values) files
  *   dat                 output dat (space-separated) files
+ *   binary              output binary files (see cs_time_plot.h)
  *   use_iteration       use time step id instead of time value for
  *                       first column
  *   flush_wtime=<wt>    flush output file every 'wt' seconds
@@ -484,6 +732,11 @@ fvm_to_time_plot_init_writer(const char             *name,
   w->f_map = (w->rank > 0) ? nullptr : cs_map_name_to_id_create();
   w->tp = nullptr;
 
+  w->staged_mesh = nullptr;
+  w->n_staged = 0;
+  w->n_staged_max = 0;
+  w->staged = nullptr;
+
   /* Parse options */
 
   if (options != nullptr) {
@@ -501,6 +754,8 @@ fvm_to_time_plot_init_writer(const char             *name,
         w->format = CS_TIME_PLOT_CSV;
       else if ((l_opt == 3) && (strncmp(options + i1, "dat", l_opt) == 0))
         w->format = CS_TIME_PLOT_DAT;
+      else if ((l_opt == 6) && (strncmp(options + i1, "binary", l_opt) == 0))
+        w->format = CS_TIME_PLOT_BIN;
       else if ((l_opt == 13) && (strcmp(options + i1, "use_iteration") == 0))
         w->use_iteration = true;
       else if (strncmp(options + i1, "n_buf_steps=", 12) == 0) {
@@ -545,6 +800,9 @@ fvm_to_time_plot_finalize_writer(void  *writer)
 {
   fvm_to_time_plot_writer_t  *w  = (fvm_to_time_plot_writer_t *)writer;
 
+  _staged_output(w);
+  BFT_FREE(w->staged);
+
   BFT_FREE(w->name);
   BFT_FREE(w->prefix);
 
@@ -576,6 +834,9 @@ fvm_to_time_plot_set_mesh_time(void          *writer,
 {
   fvm_to_time_plot_writer_t  *w = (fvm_to_time_plot_writer_t *)writer;
 
+  if (time_step != w->nt)
+    _staged_output(w);
+
   w->nt = time_step;
   w->t = time_value;
 }
@@ -597,6 +858,8 @@ fvm_to_time_plot_export_nodal(void               *writer,
     fvm_to_time_plot_writer_t  *w
       = (fvm_to_time_plot_writer_t *)writer;
 
+    _staged_output(w);
+
     fvm_writer_field_helper_t  *helper
       = fvm_writer_field_helper_create(mesh,
                                        nullptr, /* section list */
@@ -685,6 +948,16 @@ fvm_to_time_plot_export_field(void                  *writer,
                                    time_step,
                                    time_value);
 
+  /* Real values on probes are staged, so that all fields are gathered
+     together when the writer is flushed */
+
+  if (   location == FVM_WRITER_PER_NODE
+      && n_parent_lists == 0
+      && (datatype == CS_DOUBLE || datatype == CS_FLOAT)) {
+    _stage_field(w, mesh, name, dimension, interlace, datatype, field_values);
+    return;
+  }
+
   /* Initialize writer helper */
 
   cs_datatype_t  dest_datatype = CS_REAL_TYPE;
@@ -737,6 +1010,23 @@ fvm_to_time_plot_export_field(void                  *writer,
   fvm_writer_field_helper_destroy(&helper);
 }
 
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * Staged field values are gathered and written.
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_time_plot_flush(void  *writer)
+{
+  fvm_to_time_plot_writer_t  *w = (fvm_to_time_plot_writer_t *)writer;
+
+  _staged_output(w);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
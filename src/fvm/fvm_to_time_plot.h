@@ -60,6 +60,7 @@ BEGIN_C_DECLS
  * Options are:
  *   csv                 output CSV (comma-separated-values) files
  *   dat                 output dat (space-separated) files
+ *   binary              output binary files (see cs_time_plot.h)
  *   use_iteration       use time step id instead of time value for
  *                       first column
  *   flush_wtime=<wt>    flush output file every 'wt' seconds
@@ -172,6 +173,18 @@ fvm_to_time_plot_export_field(void                  *writer,
                               double                 time_value,
                               const void      *const field_values[]);
 
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * Staged field values are gathered and written.
+ *
+ * parameters:
+ *   writer <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_time_plot_flush(void  *writer);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
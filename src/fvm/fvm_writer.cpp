@@ -40,6 +40,15 @@
 #include <dlfcn.h>
 #endif
 
+/*----------------------------------------------------------------------------
+ * Standard C++ library headers
+ *----------------------------------------------------------------------------*/
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -81,6 +90,10 @@
 #include "fvm_to_melissa.h"
 #endif
 
+#if defined(HAVE_ADIOS2)
+#include "fvm_to_adios2.h"
+#endif
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -91,6 +104,55 @@ BEGIN_C_DECLS
  * Local Type Definitions
  *============================================================================*/
 
+/* Operation staged for asynchronous output */
+
+typedef struct {
+
+  bool                    is_field;          /* field output if true,
+                                                time step change otherwise */
+  void                   *format_writer;     /* Target format writer
+                                                (nullptr for all) */
+  const fvm_nodal_t      *mesh;              /* Associated mesh */
+  char                   *name;              /* Field name */
+  fvm_writer_var_loc_t    location;          /* Field location */
+  int                     dimension;         /* Field dimension */
+  cs_interlace_t          interlace;         /* Field values interlacing */
+  int                     n_parent_lists;    /* Number of parent lists */
+  cs_lnum_t              *parent_num_shift;  /* Parent list shifts */
+  cs_datatype_t           datatype;          /* Field datatype */
+  int                     time_step;         /* Time step number */
+  double                  time_value;        /* Time value */
+  int                     n_arrays;          /* Number of value arrays */
+  void                  **field_values;      /* Copied field value arrays */
+
+} _async_op_t;
+
+/* Batch of operations staged for asynchronous output (one output step) */
+
+typedef struct {
+
+  fvm_writer_t           *writer;            /* Associated writer */
+  bool                    flush;             /* Flush writer after output */
+  int                     n_ops;             /* Number of operations */
+  int                     n_ops_max;         /* Size of operations array */
+  _async_op_t            *ops;               /* Staged operations */
+
+} _async_batch_t;
+
+/* Per-writer asynchronous output state */
+
+struct _fvm_writer_async_t {
+
+  _async_batch_t         *batch;             /* Batch being staged */
+  int                     n_pending;         /* Number of submitted batches
+                                                not written yet */
+
+#if defined(HAVE_MPI)
+  MPI_Comm                comm;              /* Private communicator */
+#endif
+
+};
+
 /*============================================================================
  * Local macro definitions
  *============================================================================*/
@@ -107,9 +169,9 @@ BEGIN_C_DECLS
 
 /* Number and status of defined formats */
 
-static const int _fvm_writer_n_formats = 10;
+static const int _fvm_writer_n_formats = 11;
 
-static fvm_writer_format_t _fvm_writer_format_list[10] = {
+static fvm_writer_format_t _fvm_writer_format_list[11] = {
 
   /* Built-in EnSight Gold writer */
   {
@@ -410,7 +472,7 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     nullptr,                              /* needs_tesselation_func */
     fvm_to_time_plot_export_nodal,     /* export_nodal_func */
     fvm_to_time_plot_export_field,     /* export_field_func */
-    nullptr                               /* flush_func */
+    fvm_to_time_plot_flush             /* flush_func */
   },
 
   /* CCM-IO writer */
@@ -446,6 +508,42 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     nullptr,
     nullptr,
     nullptr
+#endif
+  },
+
+  /* ADIOS2 writer */
+  {
+    "ADIOS2",
+    "2.8 +",
+    (  FVM_WRITER_FORMAT_USE_EXTERNAL
+     | FVM_WRITER_FORMAT_HAS_POLYGON
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON),
+    FVM_WRITER_TRANSIENT_CONNECT,
+    0,                                 /* dynamic library count */
+    0,                                 /* dynamic library flags */
+    nullptr,                              /* dynamic library */
+    nullptr,                              /* dynamic library name */
+    nullptr,                              /* dynamic library prefix */
+#if defined(HAVE_ADIOS2)
+    fvm_to_adios2_n_version_strings,   /* n_version_strings_func */
+    fvm_to_adios2_version_string,      /* version_string_func */
+    fvm_to_adios2_init_writer,         /* init_func */
+    fvm_to_adios2_finalize_writer,     /* finalize_func */
+    fvm_to_adios2_set_mesh_time,       /* set_mesh_time_func */
+    nullptr,                              /* needs_tesselation_func */
+    fvm_to_adios2_export_nodal,        /* export_nodal_func */
+    fvm_to_adios2_export_field,        /* export_field_func */
+    fvm_to_adios2_flush                /* flush_func */
+#else
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr
 #endif
   }
 
@@ -465,6 +563,17 @@ const char  *fvm_writer_time_dep_name[] = {N_("fixed mesh"),
 
 const char _empty_string[] = "";
 
+/* Asynchronous output: staged batches are written in order by
+   a background thread, shared by all asynchronous writers */
+
+static int                            _n_async_writers = 0;
+
+static std::thread                    _async_thread;
+static std::mutex                     _async_mutex;
+static std::condition_variable        _async_cv;
+static std::deque<_async_batch_t *>   _async_queue;
+static bool                           _async_stop = false;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
@@ -754,11 +863,14 @@ _format_writer_init(fvm_writer_t  *this_writer,
     cs_fp_exception_disable_trap();
 
 #if defined(HAVE_MPI)
+    MPI_Comm comm = cs_glob_mpi_comm;
+    if (this_writer->async != nullptr)
+      comm = this_writer->async->comm;
     format_writer = init_func(name,
                               path,
                               this_writer->options,
                               this_writer->time_dep,
-                              cs_glob_mpi_comm);
+                              comm);
 #else
     format_writer = init_func(name,
                               path,
@@ -778,6 +890,434 @@ _format_writer_init(fvm_writer_t  *this_writer,
   return format_writer;
 }
 
+/*----------------------------------------------------------------------------
+ * Check whether asynchronous output is possible.
+ *
+ * A warning is printed if it is not.
+ *
+ * parameters:
+ *   name <-- writer name
+ *
+ * returns:
+ *   true if asynchronous output is possible, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_async_check(const char  *name)
+{
+  bool retval = true;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      bft_printf(_("\n"
+                   "Warning: asynchronous output for writer \"%s\" requires\n"
+                   "         MPI_THREAD_MULTIPLE support (see the\n"
+                   "         CS_MPI_THREAD_MULTIPLE environment variable);\n"
+                   "         output will be synchronous.\n"), name);
+      retval = false;
+    }
+  }
+#endif
+
+  if (retval && bft_mem_set_thread_safe(true) == 0) {
+    bft_printf(_("\n"
+                 "Warning: asynchronous output for writer \"%s\" requires\n"
+                 "         OpenMP support; output will be synchronous.\n"),
+               name);
+    retval = false;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Free staged operations of a batch.
+ *
+ * parameters:
+ *   b <-> pointer to batch
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_batch_clear(_async_batch_t  *b)
+{
+  for (int i = 0; i < b->n_ops; i++) {
+    _async_op_t *op = b->ops + i;
+    for (int j = 0; j < op->n_arrays; j++)
+      BFT_FREE(op->field_values[j]);
+    BFT_FREE(op->field_values);
+    BFT_FREE(op->parent_num_shift);
+    BFT_FREE(op->name);
+  }
+  b->n_ops = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the batch being staged for a writer, creating it if needed.
+ *
+ * parameters:
+ *   w <-> pointer to writer
+ *
+ * returns:
+ *   pointer to staged batch
+ *----------------------------------------------------------------------------*/
+
+static _async_batch_t *
+_async_get_batch(fvm_writer_t  *w)
+{
+  fvm_writer_async_t *a = w->async;
+
+  if (a->batch == nullptr) {
+    BFT_MALLOC(a->batch, 1, _async_batch_t);
+    a->batch->writer = w;
+    a->batch->flush = false;
+    a->batch->n_ops = 0;
+    a->batch->n_ops_max = 0;
+    a->batch->ops = nullptr;
+  }
+
+  return a->batch;
+}
+
+/*----------------------------------------------------------------------------
+ * Add an operation to the batch being staged for a writer.
+ *
+ * parameters:
+ *   w <-> pointer to writer
+ *
+ * returns:
+ *   pointer to new (initialized) operation
+ *----------------------------------------------------------------------------*/
+
+static _async_op_t *
+_async_add_op(fvm_writer_t  *w)
+{
+  _async_batch_t *b = _async_get_batch(w);
+
+  if (b->n_ops >= b->n_ops_max) {
+    b->n_ops_max = (b->n_ops_max > 0) ? b->n_ops_max*2 : 16;
+    BFT_REALLOC(b->ops, b->n_ops_max, _async_op_t);
+  }
+
+  _async_op_t *op = b->ops + b->n_ops;
+  b->n_ops += 1;
+
+  memset(op, 0, sizeof(_async_op_t));
+
+  return op;
+}
+
+/*----------------------------------------------------------------------------
+ * Update the number of entities referenced in each parent list.
+ *
+ * parameters:
+ *   op        <-- staged operation (with parent lists set)
+ *   n_ids     <-- number of local entities
+ *   parent_id <-- parent ids, or nullptr for implicit numbering
+ *   n_ents    <-> number of referenced entities per parent list
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_count_referenced(const _async_op_t  *op,
+                        cs_lnum_t           n_ids,
+                        const cs_lnum_t     parent_id[],
+                        cs_lnum_t           n_ents[])
+{
+  if (op->n_parent_lists == 0) {
+    n_ents[0] = CS_MAX(n_ents[0], n_ids);
+    return;
+  }
+
+  for (cs_lnum_t j = 0; j < n_ids; j++) {
+    cs_lnum_t p_id = (parent_id != nullptr) ? parent_id[j] : j;
+    int pl;
+    for (pl = op->n_parent_lists - 1;
+         pl > 0 && p_id < op->parent_num_shift[pl];
+         pl--);
+    p_id -= op->parent_num_shift[pl];
+    if (p_id + 1 > n_ents[pl])
+      n_ents[pl] = p_id + 1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy field values for staged output.
+ *
+ * Only the part of each source array actually referenced by the mesh
+ * (through parent ids and parent list shifts) is copied, so that the
+ * staged operation may be replayed with the same arguments.
+ *
+ * parameters:
+ *   op           <-> staged operation (with location, dimension,
+ *                    interlace, parent lists and datatype set)
+ *   field_values <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_copy_values(_async_op_t        *op,
+                   const void  *const  field_values[])
+{
+  const fvm_nodal_t *mesh = op->mesh;
+  const int n_lists = (op->n_parent_lists > 0) ? op->n_parent_lists : 1;
+
+  cs_lnum_t *n_ents;
+  BFT_MALLOC(n_ents, n_lists, cs_lnum_t);
+  for (int i = 0; i < n_lists; i++)
+    n_ents[i] = 0;
+
+  /* Count referenced entities for each list */
+
+  if (op->location == FVM_WRITER_PER_NODE)
+    _async_count_referenced(op, mesh->n_vertices, mesh->parent_vertex_id,
+                            n_ents);
+
+  else {
+    cs_lnum_t n_elts = 0;
+    int max_dim = fvm_nodal_get_max_entity_dim(mesh);
+    for (int i = 0; i < mesh->n_sections; i++) {
+      const fvm_nodal_section_t *section = mesh->sections[i];
+      if (section->entity_dim != max_dim)
+        continue;
+      if (op->n_parent_lists == 0)
+        n_elts += section->n_elements;
+      else
+        _async_count_referenced(op, section->n_elements,
+                                section->parent_element_id, n_ents);
+    }
+    if (op->n_parent_lists == 0)
+      n_ents[0] = n_elts;
+  }
+
+  /* Copy values */
+
+  const int dim = op->dimension;
+  const size_t elt_size = cs_datatype_size[op->datatype];
+  const int n_comp_arrays = (op->interlace == CS_INTERLACE) ? 1 : dim;
+  const size_t stride = (op->interlace == CS_INTERLACE) ? dim : 1;
+
+  op->n_arrays = n_lists * n_comp_arrays;
+  BFT_MALLOC(op->field_values, op->n_arrays, void *);
+
+  for (int i = 0; i < n_lists; i++) {
+    size_t n_bytes = n_ents[i] * stride * elt_size;
+    for (int j = 0; j < n_comp_arrays; j++) {
+      int k = i*n_comp_arrays + j;
+      op->field_values[k] = nullptr;
+      if (field_values[k] != nullptr) {
+        unsigned char *v;
+        BFT_MALLOC(v, n_bytes, unsigned char);
+        if (n_bytes > 0)
+          memcpy(v, field_values[k], n_bytes);
+        op->field_values[k] = v;
+      }
+    }
+  }
+
+  BFT_FREE(n_ents);
+}
+
+/*----------------------------------------------------------------------------
+ * Execute a staged batch.
+ *
+ * This function is called from the background output thread, and only
+ * uses the writer's private communicator (through its format writers).
+ *
+ * parameters:
+ *   b <-> pointer to batch
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_batch_write(_async_batch_t  *b)
+{
+  fvm_writer_t *w = b->writer;
+  fvm_writer_format_t *format = w->format;
+
+  for (int i = 0; i < b->n_ops; i++) {
+
+    _async_op_t *op = b->ops + i;
+
+    if (op->is_field) {
+      if (format->export_field_func != nullptr)
+        format->export_field_func(op->format_writer,
+                                  op->mesh,
+                                  op->name,
+                                  op->location,
+                                  op->dimension,
+                                  op->interlace,
+                                  op->n_parent_lists,
+                                  op->parent_num_shift,
+                                  op->datatype,
+                                  op->time_step,
+                                  op->time_value,
+                                  (const void *const *)op->field_values);
+    }
+    else if (format->set_mesh_time_func != nullptr) {
+      for (int j = 0; j < w->n_format_writers; j++)
+        format->set_mesh_time_func(w->format_writer[j],
+                                   op->time_step,
+                                   op->time_value);
+    }
+
+  }
+
+  if (b->flush && format->flush_func != nullptr) {
+    for (int j = 0; j < w->n_format_writers; j++)
+      format->flush_func(w->format_writer[j]);
+  }
+
+  _async_batch_clear(b);
+}
+
+/*----------------------------------------------------------------------------
+ * Background thread writing staged batches.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_worker(void)
+{
+  std::unique_lock<std::mutex> lock(_async_mutex);
+
+  while (true) {
+
+    _async_cv.wait(lock, []{ return _async_stop || !_async_queue.empty(); });
+
+    if (_async_queue.empty())  /* stop requested and nothing left to do */
+      break;
+
+    _async_batch_t *b = _async_queue.front();
+    _async_queue.pop_front();
+
+    lock.unlock();
+
+    _async_batch_write(b);
+
+    lock.lock();
+
+    b->writer->async->n_pending -= 1;
+
+    BFT_FREE(b->ops);
+    BFT_FREE(b);
+
+    _async_cv.notify_all();
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Submit the batch staged for a writer to the background thread.
+ *
+ * If a previous batch of the same writer is still being written,
+ * wait for its completion first, so that at most one batch per writer
+ * is being written while the next one is staged.
+ *
+ * parameters:
+ *   w <-> pointer to writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_submit(fvm_writer_t  *w)
+{
+  fvm_writer_async_t *a = w->async;
+
+  std::unique_lock<std::mutex> lock(_async_mutex);
+
+  _async_cv.wait(lock, [a]{ return a->n_pending == 0; });
+
+  if (a->batch == nullptr)
+    return;
+
+  if (_async_thread.joinable() == false) {
+    _async_stop = false;
+    cs_fp_exception_disable_trap();
+    _async_thread = std::thread(_async_worker);
+    cs_fp_exception_restore_trap();
+  }
+
+  _async_queue.push_back(a->batch);
+  a->batch = nullptr;
+  a->n_pending += 1;
+
+  _async_cv.notify_all();
+}
+
+/*----------------------------------------------------------------------------
+ * Write all staged output of a writer and wait for completion.
+ *
+ * On return, the background thread does not use the writer anymore,
+ * so it may safely be used from the calling thread.
+ *
+ * parameters:
+ *   w <-> pointer to writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_sync(fvm_writer_t  *w)
+{
+  fvm_writer_async_t *a = w->async;
+
+  if (a == nullptr)
+    return;
+
+  _async_submit(w);
+
+  std::unique_lock<std::mutex> lock(_async_mutex);
+  _async_cv.wait(lock, [a]{ return a->n_pending == 0; });
+}
+
+/*----------------------------------------------------------------------------
+ * Stop the background output thread once no asynchronous writer remains.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_finalize(void)
+{
+  if (_n_async_writers > 0 || _async_thread.joinable() == false)
+    return;
+
+  {
+    std::unique_lock<std::mutex> lock(_async_mutex);
+    _async_stop = true;
+    _async_cv.notify_all();
+  }
+
+  _async_thread.join();
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate the global number of values of a field exported on a nodal mesh.
+ *
+ * parameters:
+ *   mesh      <-- pointer to nodal mesh
+ *   location  <-- variable location
+ *
+ * returns:
+ *   global number of values per component
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_n_g_field_values(const fvm_nodal_t     *mesh,
+                  fvm_writer_var_loc_t   location)
+{
+  if (location != FVM_WRITER_PER_ELEMENT)
+    return fvm_nodal_get_n_g_vertices(mesh);
+
+  cs_gnum_t n_g_elts = 0;
+  int max_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  for (int i = 0; i < mesh->n_sections; i++) {
+    const fvm_nodal_section_t *section = mesh->sections[i];
+    if (section->entity_dim < max_dim)
+      continue;
+    if (section->global_element_num != nullptr)
+      n_g_elts += fvm_io_num_get_global_count(section->global_element_num);
+    else
+      n_g_elts += section->n_elements;
+  }
+
+  return n_g_elts;
+}
+
 /*----------------------------------------------------------------------------
  * Find or add a specific format writer based on writer and optional
  * mesh name info.
@@ -811,6 +1351,7 @@ _find_or_add_format_writer(fvm_writer_t        *this_writer,
         break;
     }
     if (i >= this_writer->n_format_writers) {
+      _async_sync(this_writer);
       BFT_REALLOC(this_writer->format_writer, i + 1, void *);
       BFT_REALLOC(this_writer->mesh_names, i + 1, char *);
       BFT_MALLOC(this_writer->mesh_names[i], strlen(name) + 1, char);
@@ -883,6 +1424,8 @@ fvm_writer_get_format_id(const char  *format_name)
     strcpy(closest_name, "CCM-IO");
   else if (strncmp(tmp_name, "melissa", 7) == 0)
     strcpy(closest_name, "Melissa");
+  else if (strncmp(tmp_name, "adios", 5) == 0)
+    strcpy(closest_name, "ADIOS2");
   else
     strcpy(closest_name, tmp_name);
 
@@ -1109,6 +1652,8 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   async               stage field values and write them from a
+ *                       background thread when the writer is flushed
  *
  * parameters:
  *   name            <-- base name of output
@@ -1134,6 +1679,7 @@ fvm_writer_init(const char             *name,
   char  *tmp_options = nullptr;
   fvm_writer_t  *this_writer = nullptr;
   bool separate_meshes = false;
+  bool async = false;
 
   /* Find corresponding format and check coherency */
 
@@ -1169,9 +1715,20 @@ fvm_writer_init(const char             *name,
       for (i1 = i0; tmp_options[i1] != '\0' && tmp_options[i1] != ' '; i1++);
       int l_opt = i1 - i0;
 
+      bool consumed = false;
+
       if (   (l_opt == 15)
           && (strncmp(tmp_options + i0, "separate_meshes", l_opt) == 0)) {
         separate_meshes = true;
+        consumed = true;
+      }
+      else if (   (l_opt == 5)
+               && (strncmp(tmp_options + i0, "async", l_opt) == 0)) {
+        async = true;
+        consumed = true;
+      }
+
+      if (consumed) {
         if (tmp_options[i1] == ' ')
           strcpy(tmp_options + i0, tmp_options + i1 + 1);
         else {
@@ -1233,6 +1790,8 @@ fvm_writer_init(const char             *name,
   CS_TIMER_COUNTER_INIT(this_writer->field_time);
   CS_TIMER_COUNTER_INIT(this_writer->flush_time);
 
+  this_writer->output_size = 0;
+
   if (this_writer->format->info_mask & FVM_WRITER_FORMAT_SEPARATE_MESHES)
     separate_meshes = true;
   else if (  this_writer->format->info_mask
@@ -1246,6 +1805,23 @@ fvm_writer_init(const char             *name,
 
   this_writer->mesh_names = nullptr;
 
+  /* Asynchronous output state; format writers use a private communicator
+     so that the background thread never shares one with the main thread */
+
+  this_writer->async = nullptr;
+
+  if (async && _async_check(name)) {
+    BFT_MALLOC(this_writer->async, 1, fvm_writer_async_t);
+    this_writer->async->batch = nullptr;
+    this_writer->async->n_pending = 0;
+#if defined(HAVE_MPI)
+    this_writer->async->comm = cs_glob_mpi_comm;
+    if (cs_glob_mpi_comm != MPI_COMM_NULL)
+      MPI_Comm_dup(cs_glob_mpi_comm, &(this_writer->async->comm));
+#endif
+    _n_async_writers += 1;
+  }
+
   /* Initialize format-specific writer */
 
   if  (this_writer->n_format_writers > 0) {
@@ -1279,6 +1855,8 @@ fvm_writer_finalize(fvm_writer_t  *this_writer)
   assert(this_writer != nullptr);
   assert(this_writer->format != nullptr);
 
+  _async_sync(this_writer);
+
   BFT_FREE(this_writer->name);
   BFT_FREE(this_writer->path);
   BFT_FREE(this_writer->options);
@@ -1301,6 +1879,16 @@ fvm_writer_finalize(fvm_writer_t  *this_writer)
   }
   BFT_FREE(this_writer->mesh_names);
 
+  if (this_writer->async != nullptr) {
+#if defined(HAVE_MPI)
+    if (this_writer->async->comm != cs_glob_mpi_comm)
+      MPI_Comm_free(&(this_writer->async->comm));
+#endif
+    BFT_FREE(this_writer->async);
+    _n_async_writers -= 1;
+    _async_finalize();
+  }
+
   /* Unload plugin if required */
 
 #if defined(HAVE_DLOPEN)
@@ -1420,7 +2008,14 @@ fvm_writer_set_mesh_time(fvm_writer_t  *this_writer,
 
   set_mesh_time_func = this_writer->format->set_mesh_time_func;
 
-  if (set_mesh_time_func != nullptr) {
+  if (this_writer->async != nullptr) {
+    _async_op_t *op = _async_add_op(this_writer);
+    op->is_field = false;
+    op->time_step = time_step;
+    op->time_value = time_value;
+  }
+
+  else if (set_mesh_time_func != nullptr) {
     cs_fp_exception_disable_trap();
     for (int i = 0; i < this_writer->n_format_writers; i++)
       set_mesh_time_func(this_writer->format_writer[i],
@@ -1482,10 +2077,15 @@ fvm_writer_export_nodal(fvm_writer_t        *this_writer,
   assert(this_writer != nullptr);
   assert(this_writer->format != nullptr);
 
-  void  *format_writer = _find_or_add_format_writer(this_writer, mesh);
-
   t0 = cs_timer_time();
 
+  /* Meshes are written synchronously, as they may be modified
+     or freed by the caller after output */
+
+  _async_sync(this_writer);
+
+  void  *format_writer = _find_or_add_format_writer(this_writer, mesh);
+
   export_nodal_func = this_writer->format->export_nodal_func;
 
   if (export_nodal_func != nullptr) {
@@ -1494,6 +2094,9 @@ fvm_writer_export_nodal(fvm_writer_t        *this_writer,
     cs_fp_exception_restore_trap();
   }
 
+  this_writer->output_size
+    += fvm_nodal_get_n_g_vertices(mesh) * 3 * sizeof(cs_coord_t);
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&(this_writer->mesh_time), &t0, &t1);
@@ -1551,7 +2154,34 @@ fvm_writer_export_field(fvm_writer_t                 *this_writer,
 
   export_field_func = this_writer->format->export_field_func;
 
-  if (export_field_func != nullptr) {
+  /* In asynchronous mode, stage a copy of the values */
+
+  if (this_writer->async != nullptr) {
+
+    _async_op_t *op = _async_add_op(this_writer);
+
+    op->is_field = true;
+    op->format_writer = format_writer;
+    op->mesh = mesh;
+    BFT_MALLOC(op->name, strlen(name) + 1, char);
+    strcpy(op->name, name);
+    op->location = location;
+    op->dimension = dimension;
+    op->interlace = interlace;
+    op->n_parent_lists = n_parent_lists;
+    BFT_MALLOC(op->parent_num_shift, CS_MAX(n_parent_lists, 1), cs_lnum_t);
+    op->parent_num_shift[0] = 0;
+    for (int i = 0; i < n_parent_lists; i++)
+      op->parent_num_shift[i] = parent_num_shift[i];
+    op->datatype = datatype;
+    op->time_step = time_step;
+    op->time_value = time_value;
+
+    _async_copy_values(op, field_values);
+
+  }
+
+  else if (export_field_func != nullptr) {
     cs_fp_exception_disable_trap();
     export_field_func(format_writer,
                       mesh,
@@ -1569,6 +2199,10 @@ fvm_writer_export_field(fvm_writer_t                 *this_writer,
     cs_fp_exception_restore_trap();
   }
 
+  this_writer->output_size
+    +=   _n_g_field_values(mesh, location) * dimension
+       * cs_datatype_size[datatype];
+
   t1 = cs_timer_time();
 
   cs_timer_counter_add_diff(&(this_writer->field_time), &t0, &t1);
@@ -1592,7 +2226,26 @@ fvm_writer_flush(fvm_writer_t  *this_writer)
 
   flush_func = this_writer->format->flush_func;
 
-  if (flush_func != nullptr) {
+  /* In asynchronous mode, hand staged output over to the background
+     thread (which also flushes); this only blocks if the previous
+     output of this writer is not complete yet */
+
+  if (this_writer->async != nullptr) {
+
+    cs_timer_t  t0 = cs_timer_time();
+
+    if (flush_func != nullptr)
+      _async_get_batch(this_writer)->flush = true;
+
+    _async_submit(this_writer);
+
+    cs_timer_t  t1 = cs_timer_time();
+
+    cs_timer_counter_add_diff(&(this_writer->flush_time), &t0, &t1);
+
+  }
+
+  else if (flush_func != nullptr) {
 
     cs_timer_t  t0, t1;
 
@@ -1638,6 +2291,59 @@ fvm_writer_get_times(fvm_writer_t        *this_writer,
     *flush_time = this_writer->flush_time;
 }
 
+/*----------------------------------------------------------------------------
+ * Return estimated size of data exported by a given writer.
+ *
+ * This size is accumulated over all exported meshes and fields, and is
+ * based on the global number of coordinates and field values, independently
+ * of the format's actual encoding, so it is mostly useful to compare
+ * the output volume of writers or time steps.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   estimated accumulated output size, in bytes
+ *----------------------------------------------------------------------------*/
+
+cs_gnum_t
+fvm_writer_get_output_size(const fvm_writer_t  *this_writer)
+{
+  assert(this_writer != nullptr);
+
+  return this_writer->output_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending asynchronous output of a given writer.
+ *
+ * Meshes used in fields output since the last call to fvm_writer_flush
+ * may be referenced until the output is complete, so this function must
+ * be called before modifying or freeing such meshes. It does nothing for
+ * writers not using the "async" option.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_wait(fvm_writer_t  *this_writer)
+{
+  assert(this_writer != nullptr);
+
+  if (this_writer->async != nullptr) {
+
+    cs_timer_t  t0 = cs_timer_time();
+
+    _async_sync(this_writer);
+
+    cs_timer_t  t1 = cs_timer_time();
+
+    cs_timer_counter_add_diff(&(this_writer->flush_time), &t0, &t1);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -219,6 +219,9 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
  *   separate_meshes     use a different writer for each mesh
+ *   async               stage field values and write them from a
+ *                       background thread when the writer is flushed
+ *                       (requires MPI_THREAD_MULTIPLE in parallel)
  *
  * parameters:
  *   name            <-- base name of output
@@ -429,6 +432,39 @@ fvm_writer_get_times(fvm_writer_t        *this_writer,
                      cs_timer_counter_t  *field_time,
                      cs_timer_counter_t  *flush_time);
 
+/*----------------------------------------------------------------------------
+ * Return estimated size of data exported by a given writer.
+ *
+ * This size is accumulated over all exported meshes and fields, and is
+ * based on the global number of coordinates and field values, independently
+ * of the format's actual encoding, so it is mostly useful to compare
+ * the output volume of writers or time steps.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   estimated accumulated output size, in bytes
+ *----------------------------------------------------------------------------*/
+
+cs_gnum_t
+fvm_writer_get_output_size(const fvm_writer_t  *this_writer);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending asynchronous output of a given writer.
+ *
+ * Meshes used in fields output since the last call to fvm_writer_flush
+ * may be referenced until the output is complete, so this function must
+ * be called before modifying or freeing such meshes. It does nothing for
+ * writers not using the "async" option.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_wait(fvm_writer_t  *this_writer);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -72,6 +72,49 @@ BEGIN_C_DECLS
  * Local Type Definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Cached part to block distribution for a group of exported sections
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+typedef struct {
+
+  const fvm_nodal_section_t   *section;         /* First exported section */
+  fvm_element_t                type;            /* Exported element type */
+  int                          n_sections;      /* Number of grouped
+                                                   sections */
+  cs_lnum_t                    part_size;       /* Local number of elements */
+  cs_gnum_t                    n_g_elements;    /* Global number of elements */
+  size_t                       min_block_size;  /* Minimum block size
+                                                   (in elements) */
+
+  cs_part_to_block_t          *d;               /* Part to block distributor */
+  int                         *block_n_sub;     /* Number of sub-elements per
+                                                   block element, or nullptr */
+  cs_lnum_t                    block_size;      /* Block size */
+  cs_gnum_t                    block_sub_size;  /* Block size (sub-elements) */
+  cs_gnum_t                    block_start;     /* Output block start */
+  cs_gnum_t                    block_end;       /* Output block end */
+
+} _part_to_block_cache_entry_t;
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Cache of part to block distributions for a writer
+ *----------------------------------------------------------------------------*/
+
+struct _fvm_writer_helper_cache_t {
+
+  int  n_entries;                          /* Number of cached entries */
+
+#if defined(HAVE_MPI)
+  _part_to_block_cache_entry_t  *entries;  /* Cached entries */
+#endif
+
+};
+
 /*----------------------------------------------------------------------------
  * FVM nodal to writer field output helper
  *----------------------------------------------------------------------------*/
@@ -109,6 +152,9 @@ struct _fvm_writer_field_helper_t {
   int         n_ranks;                       /* Number of ranks
                                                 in communicator */
 
+  fvm_writer_helper_cache_t  *cache;         /* Associated distribution
+                                                cache, or nullptr */
+
 #if defined(HAVE_MPI)
 
   /* Additionnal parallel state */
@@ -393,112 +439,172 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
   } while (   current_section != nullptr
            && current_section->continues_previous == true);
 
-  /* Build global numbering if necessary */
+  /* Reuse cached distribution if available */
+
+  _part_to_block_cache_entry_t *ce = nullptr;
+
+  if (h->cache != nullptr) {
+    for (int i = 0; i < h->cache->n_entries; i++) {
+      _part_to_block_cache_entry_t *e = h->cache->entries + i;
+      if (   e->section == export_section->section
+          && e->type == export_section->type
+          && e->n_sections == n_sections
+          && e->part_size == part_size
+          && e->n_g_elements == n_g_elements
+          && e->min_block_size == min_block_size) {
+        ce = e;
+        break;
+      }
+    }
+  }
 
-  if (n_sections > 1) {
+  if (ce != nullptr) {
+    d = ce->d;
+    block_n_sub = ce->block_n_sub;
+    block_size = ce->block_size;
+    block_sub_size = ce->block_sub_size;
+    block_start = ce->block_start;
+    block_end = ce->block_end;
+  }
 
-    cs_lnum_t start_id = 0;
-    cs_gnum_t gnum_shift = 0;
+  else {
 
-    BFT_MALLOC(_g_elt_num, part_size, cs_gnum_t);
-    g_elt_num = _g_elt_num;
+    /* Build global numbering if necessary */
 
-    /* loop on sections which should be appended */
+    if (n_sections > 1) {
 
-    current_section = export_section;
-    do {
+      cs_lnum_t start_id = 0;
+      cs_gnum_t gnum_shift = 0;
 
-      const fvm_nodal_section_t  *section = current_section->section;
-      const cs_lnum_t section_size
-        = fvm_io_num_get_local_count(section->global_element_num);
+      BFT_MALLOC(_g_elt_num, part_size, cs_gnum_t);
+      g_elt_num = _g_elt_num;
 
-      const cs_gnum_t * s_gnum
-        = fvm_io_num_get_global_num(section->global_element_num);
+      /* loop on sections which should be appended */
 
-      for (cs_lnum_t j = 0, k = start_id; j < section_size; j++, k++)
-        _g_elt_num[k] = s_gnum[j] + gnum_shift;
+      current_section = export_section;
+      do {
 
-      start_id += section_size;
-      gnum_shift += fvm_io_num_get_global_count(section->global_element_num);
+        const fvm_nodal_section_t  *section = current_section->section;
+        const cs_lnum_t section_size
+          = fvm_io_num_get_local_count(section->global_element_num);
 
-      current_section = current_section->next;
+        const cs_gnum_t * s_gnum
+          = fvm_io_num_get_global_num(section->global_element_num);
 
+        for (cs_lnum_t j = 0, k = start_id; j < section_size; j++, k++)
+          _g_elt_num[k] = s_gnum[j] + gnum_shift;
 
-    } while (   current_section != nullptr
-             && current_section->continues_previous == true);
-  }
+        start_id += section_size;
+        gnum_shift += fvm_io_num_get_global_count(section->global_element_num);
 
-  /* Build sub-element count if necessary */
+        current_section = current_section->next;
 
-  if (have_tesselation) {
+      } while (   current_section != nullptr
+               && current_section->continues_previous == true);
+    }
 
-    cs_lnum_t start_id = 0;
+    /* Build sub-element count if necessary */
 
-    BFT_MALLOC(part_n_sub, part_size, int);
+    if (have_tesselation) {
 
-    current_section = export_section;
-    do {
+      cs_lnum_t start_id = 0;
 
-      const fvm_nodal_section_t  *section = current_section->section;
-      const cs_lnum_t section_size
-        = fvm_io_num_get_local_count(section->global_element_num);
+      BFT_MALLOC(part_n_sub, part_size, int);
 
-      if (current_section->type != section->type) {
-        const cs_lnum_t   *sub_element_idx
-          = fvm_tesselation_sub_elt_index(section->tesselation,
-                                          current_section->type);
-        for (cs_lnum_t j = 0; j < section_size; j++)
-          part_n_sub[start_id + j] = sub_element_idx[j+1] - sub_element_idx[j];
-      }
-      else {
-        for (cs_lnum_t j = 0; j < section_size; j++)
-          part_n_sub[start_id + j] = 1;
-      }
-      start_id += section_size;
+      current_section = export_section;
+      do {
 
-      current_section = current_section->next;
+        const fvm_nodal_section_t  *section = current_section->section;
+        const cs_lnum_t section_size
+          = fvm_io_num_get_local_count(section->global_element_num);
 
-    } while (   current_section != nullptr
-             && current_section->continues_previous == true);
-  }
+        if (current_section->type != section->type) {
+          const cs_lnum_t   *sub_element_idx
+            = fvm_tesselation_sub_elt_index(section->tesselation,
+                                            current_section->type);
+          for (cs_lnum_t j = 0; j < section_size; j++)
+            part_n_sub[start_id + j]
+              = sub_element_idx[j+1] - sub_element_idx[j];
+        }
+        else {
+          for (cs_lnum_t j = 0; j < section_size; j++)
+            part_n_sub[start_id + j] = 1;
+        }
+        start_id += section_size;
 
-  /* Build distribution structures */
+        current_section = current_section->next;
 
-  bi = cs_block_dist_compute_sizes(h->rank,
-                                   h->n_ranks,
-                                   h->min_rank_step,
-                                   min_block_size,
-                                   n_g_elements);
+      } while (   current_section != nullptr
+               && current_section->continues_previous == true);
+    }
 
-  block_size = bi.gnum_range[1] - bi.gnum_range[0];
+    /* Build distribution structures */
 
-  d = cs_part_to_block_create_by_gnum(h->comm, bi, part_size, g_elt_num);
+    bi = cs_block_dist_compute_sizes(h->rank,
+                                     h->n_ranks,
+                                     h->min_rank_step,
+                                     min_block_size,
+                                     n_g_elements);
 
-  if (_g_elt_num != nullptr)
-    cs_part_to_block_transfer_gnum(d, _g_elt_num);
+    block_size = bi.gnum_range[1] - bi.gnum_range[0];
 
-  g_elt_num = nullptr;
-  _g_elt_num = nullptr;
+    d = cs_part_to_block_create_by_gnum(h->comm, bi, part_size, g_elt_num);
 
-  /* Distribute sub-element info in case of tesselation */
+    if (_g_elt_num != nullptr)
+      cs_part_to_block_transfer_gnum(d, _g_elt_num);
 
-  if (have_tesselation) {
+    g_elt_num = nullptr;
+    _g_elt_num = nullptr;
 
-    BFT_MALLOC(block_n_sub, block_size, int);
+    /* Distribute sub-element info in case of tesselation */
 
-    cs_part_to_block_copy_array(d,
-                                CS_INT_TYPE,
-                                1,
-                                part_n_sub,
-                                block_n_sub);
-    BFT_FREE(part_n_sub);
+    if (have_tesselation) {
 
-    for (cs_lnum_t j = 0; j < block_size; j++)
-      block_sub_size += block_n_sub[j];
+      BFT_MALLOC(block_n_sub, block_size, int);
+
+      cs_part_to_block_copy_array(d,
+                                  CS_INT_TYPE,
+                                  1,
+                                  part_n_sub,
+                                  block_n_sub);
+      BFT_FREE(part_n_sub);
+
+      for (cs_lnum_t j = 0; j < block_size; j++)
+        block_sub_size += block_n_sub[j];
+
+      MPI_Scan(&block_sub_size, &block_end, 1, CS_MPI_GNUM, MPI_SUM, h->comm);
+      block_end += 1;
+      block_start = block_end - block_sub_size;
+
+    }
+    else {
+      block_sub_size = block_size;
+      block_start = bi.gnum_range[0];
+      block_end = bi.gnum_range[1];
+    }
+
+    /* Save distribution for future outputs */
+
+    if (h->cache != nullptr) {
+      fvm_writer_helper_cache_t *c = h->cache;
+      BFT_REALLOC(c->entries, c->n_entries + 1, _part_to_block_cache_entry_t);
+      ce = c->entries + c->n_entries;
+      c->n_entries += 1;
+      ce->section = export_section->section;
+      ce->type = export_section->type;
+      ce->n_sections = n_sections;
+      ce->part_size = part_size;
+      ce->n_g_elements = n_g_elements;
+      ce->min_block_size = min_block_size;
+      ce->d = d;
+      ce->block_n_sub = block_n_sub;
+      ce->block_size = block_size;
+      ce->block_sub_size = block_sub_size;
+      ce->block_start = block_start;
+      ce->block_end = block_end;
+    }
 
   }
-  else
-    block_sub_size = block_size;
 
   /* Number of loops on dimension and conversion output dimension */
 
@@ -516,15 +622,10 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
                (  CS_MAX(part_size, (cs_lnum_t)block_sub_size)
                 * elt_size*convert_dim),
                unsigned char);
-    MPI_Scan(&block_sub_size, &block_end, 1, CS_MPI_GNUM, MPI_SUM, h->comm);
-    block_end += 1;
-    block_start = block_end - block_sub_size;
     _block_values = part_values;
   }
   else {
     BFT_MALLOC(part_values, part_size*elt_size*convert_dim, unsigned char);
-    block_start = bi.gnum_range[0];
-    block_end = bi.gnum_range[1];
     _block_values = block_values;
   }
 
@@ -629,10 +730,13 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
   BFT_FREE(block_values);
   BFT_FREE(part_values);
 
-  cs_part_to_block_destroy(&d);
+  /* Cached distributions are kept for future outputs */
 
-  if (block_n_sub != nullptr)
-    BFT_FREE(block_n_sub);
+  if (ce == nullptr) {
+    cs_part_to_block_destroy(&d);
+    if (block_n_sub != nullptr)
+      BFT_FREE(block_n_sub);
+  }
 
   /* Return pointer to next section */
 
@@ -1625,6 +1729,8 @@ fvm_writer_field_helper_create(const fvm_nodal_t          *mesh,
 
   h->n_ranks = 1;
 
+  h->cache = nullptr;
+
 #if defined(HAVE_MPI)
 
   h->comm = MPI_COMM_NULL;
@@ -1745,6 +1851,81 @@ fvm_writer_field_helper_destroy(fvm_writer_field_helper_t **helper)
     BFT_FREE(*helper);
 }
 
+/*----------------------------------------------------------------------------
+ * Create a cache for part to block distributions used by field writer
+ * helpers.
+ *
+ * Such a cache may be associated with a writer whose meshes do not change,
+ * so that distributions (and tesselation sub-element counts) built for
+ * a given group of exported sections are reused by subsequent field
+ * outputs instead of being rebuilt.
+ *
+ * returns:
+ *   pointer to allocated cache
+ *----------------------------------------------------------------------------*/
+
+fvm_writer_helper_cache_t *
+fvm_writer_helper_cache_create(void)
+{
+  fvm_writer_helper_cache_t *c = nullptr;
+
+  BFT_MALLOC(c, 1, fvm_writer_helper_cache_t);
+
+  c->n_entries = 0;
+
+#if defined(HAVE_MPI)
+  c->entries = nullptr;
+#endif
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a field writer helper distribution cache.
+ *
+ * parameters:
+ *   cache <-> pointer to pointer to structure that should be destroyed
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_helper_cache_destroy(fvm_writer_helper_cache_t  **cache)
+{
+  if (cache == nullptr)
+    return;
+
+  fvm_writer_helper_cache_t *c = *cache;
+
+  if (c != nullptr) {
+
+#if defined(HAVE_MPI)
+    for (int i = 0; i < c->n_entries; i++) {
+      cs_part_to_block_destroy(&(c->entries[i].d));
+      BFT_FREE(c->entries[i].block_n_sub);
+    }
+    BFT_FREE(c->entries);
+#endif
+
+    BFT_FREE(*cache);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Associate a distribution cache with a field writer helper.
+ *
+ * The cache is only used for per-element output in parallel mode.
+ *
+ * parameters:
+ *   helper <-> pointer to helper structure
+ *   cache  <-> pointer to associated cache, or nullptr
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_field_helper_set_cache(fvm_writer_field_helper_t  *helper,
+                                  fvm_writer_helper_cache_t  *cache)
+{
+  helper->cache = cache;
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
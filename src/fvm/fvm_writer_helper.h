@@ -88,6 +88,14 @@ typedef struct _fvm_writer_section_t {
 
 typedef struct _fvm_writer_field_helper_t fvm_writer_field_helper_t;
 
+/*
+  Pointer to a cache of part to block distributions used by field writer
+  helpers. The structure itself is private, and is defined in
+  fvm_writer_helper.cpp
+*/
+
+typedef struct _fvm_writer_helper_cache_t fvm_writer_helper_cache_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer for output of field values by a writer helper
  *
@@ -245,6 +253,46 @@ fvm_writer_field_helper_create(const fvm_nodal_t          *mesh,
 void
 fvm_writer_field_helper_destroy(fvm_writer_field_helper_t **helper);
 
+/*----------------------------------------------------------------------------
+ * Create a cache for part to block distributions used by field writer
+ * helpers.
+ *
+ * Such a cache may be associated with a writer whose meshes do not change,
+ * so that distributions (and tesselation sub-element counts) built for
+ * a given group of exported sections are reused by subsequent field
+ * outputs instead of being rebuilt.
+ *
+ * returns:
+ *   pointer to allocated cache
+ *----------------------------------------------------------------------------*/
+
+fvm_writer_helper_cache_t *
+fvm_writer_helper_cache_create(void);
+
+/*----------------------------------------------------------------------------
+ * Destroy a field writer helper distribution cache.
+ *
+ * parameters:
+ *   cache <-> pointer to pointer to structure that should be destroyed
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_helper_cache_destroy(fvm_writer_helper_cache_t  **cache);
+
+/*----------------------------------------------------------------------------
+ * Associate a distribution cache with a field writer helper.
+ *
+ * The cache is only used for per-element output in parallel mode.
+ *
+ * parameters:
+ *   helper <-> pointer to helper structure
+ *   cache  <-> pointer to associated cache, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_writer_field_helper_set_cache(fvm_writer_field_helper_t  *helper,
+                                  fvm_writer_helper_cache_t  *cache);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -167,6 +167,12 @@ typedef struct {
 
 } fvm_writer_format_t;
 
+/*----------------------------------------------------------------------------
+ * Asynchronous output state (opaque, private to fvm_writer)
+ *----------------------------------------------------------------------------*/
+
+typedef struct _fvm_writer_async_t fvm_writer_async_t;
+
 /*----------------------------------------------------------------------------
  * Structure defining a writer definition
  *----------------------------------------------------------------------------*/
@@ -187,6 +193,12 @@ struct _fvm_writer_t {
   cs_timer_counter_t      field_time;        /* Fields output timer */
   cs_timer_counter_t      flush_time;        /* output "completion" timer */
 
+  cs_gnum_t               output_size;       /* Estimated size of exported
+                                                data (bytes) */
+
+  fvm_writer_async_t     *async;             /* Asynchronous output state,
+                                                or NULL */
+
 };
 
 /*----------------------------------------------------------------------------*/
@@ -3889,6 +3889,8 @@ cs_gui_mpi_algorithms(void)
       a = CS_ALL_TO_ALL_MPI_DEFAULT;
     else if (!strcmp(all_to_all_name, "crystal router"))
       a = CS_ALL_TO_ALL_CRYSTAL_ROUTER;
+    else if (!strcmp(all_to_all_name, "hierarchical"))
+      a = CS_ALL_TO_ALL_HIERARCHICAL;
     cs_all_to_all_set_type(a);
   }
 }
@@ -415,6 +415,104 @@ _eval_vgm(const cs_gwf_soil_vgm_tpf_param_t    *sp,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the values of the different properties related to a soil in
+ *        the case of a Van Genuchten-Mualem model and a two-phase flow model.
+ *        Case of tabulated laws: values are linearly interpolated in log(pc)
+ *        inside the tabulated range and exactly evaluated outside.
+ *
+ * \param[in]  sp        set of modelling parameters
+ * \param[in]  pc        capillarity pressure
+ * \param[out] sl        liquid saturation
+ * \param[out] dsldpc    liquid capacity
+ * \param[out] krl       relative permeability for the liquid phase
+ * \param[out] krg       relative permeability for the gas phase
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_eval_vgm_table(const cs_gwf_soil_vgm_tpf_param_t    *sp,
+                const double                          pc,
+                double                               *sl,
+                double                               *dsldpc,
+                double                               *krl,
+                double                               *krg)
+{
+  if (pc <= sp->table_pc_min || pc >= sp->table_pc_max) {
+    sp->eval_exact(sp, pc, sl, dsldpc, krl, krg);
+    return;
+  }
+
+  const double  t = (log(pc) - sp->table_log_pc_min) * sp->table_inv_dlog_pc;
+
+  int  i = (int)t;
+  if (i > sp->table_n_points - 2)
+    i = sp->table_n_points - 2;
+
+  const double  w = t - i;
+  const double  *v0 = sp->table_vals + 4*i;
+  const double  *v1 = v0 + 4;
+
+  *sl     = v0[0] + w*(v1[0] - v0[0]);
+  *dsldpc = v0[1] + w*(v1[1] - v0[1]);
+  *krl    = v0[2] + w*(v1[2] - v0[2]);
+  *krg    = v0[3] + w*(v1[3] - v0[3]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the table of the soil laws for a soil associated to a Van
+ *        Genuchten-Mualem model and a two-phase flow model. The evaluation
+ *        function is replaced by a tabulated one.
+ *
+ * \param[in, out] sp         set of modelling parameters
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_vgm_table(cs_gwf_soil_vgm_tpf_param_t    *sp)
+{
+  const int  n_points = sp->table_n_points;
+
+  assert(n_points > 1);
+
+  /* Set the tabulated range if automatic */
+
+  if (sp->table_pc_min <= 0)
+    sp->table_pc_min = (sp->sle_jtype != CS_GWF_SOIL_JOIN_NOTHING) ?
+      sp->pc_star : 1e-4*sp->pr_r;
+
+  if (sp->table_pc_max <= sp->table_pc_min)
+    sp->table_pc_max = CS_MAX(1e4*sp->pr_r, 1e4*sp->table_pc_min);
+
+  const double  log_pc_min = log(sp->table_pc_min);
+  const double  dlog_pc = (log(sp->table_pc_max) - log_pc_min)/(n_points - 1);
+
+  sp->table_log_pc_min = log_pc_min;
+  sp->table_inv_dlog_pc = 1./dlog_pc;
+
+  /* Tabulate the exact laws */
+
+  if (sp->eval_properties != _eval_vgm_table)
+    sp->eval_exact = sp->eval_properties;
+
+  BFT_REALLOC(sp->table_vals, 4*n_points, double);
+
+  for (int i = 0; i < n_points; i++) {
+
+    const double  pc = (i < n_points - 1) ?
+      exp(log_pc_min + i*dlog_pc) : sp->table_pc_max;
+
+    double  *v = sp->table_vals + 4*i;
+
+    sp->eval_exact(sp, pc, v, v + 1, v + 2, v + 3);
+
+  }
+
+  sp->eval_properties = _eval_vgm_table;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the joining parameters for a soil associated to a Van
@@ -1050,6 +1148,14 @@ cs_gwf_soil_create(const cs_zone_t                 *zone,
     BFT_MALLOC(sp, 1, cs_gwf_soil_vgm_tpf_param_t);
     soil->model_param = sp;
 
+    /* No tabulation by default */
+
+    sp->table_n_points = 0;
+    sp->table_pc_min = 0;
+    sp->table_pc_max = 0;
+    sp->table_vals = nullptr;
+    sp->eval_exact = nullptr;
+
     /* Default values */
 
     cs_gwf_soil_set_vgm_tpf_param(soil,
@@ -1187,6 +1293,7 @@ cs_gwf_soil_free_all(void)
         cs_gwf_soil_vgm_tpf_param_t *sp
           = (cs_gwf_soil_vgm_tpf_param_t *)soil->model_param;
 
+        BFT_FREE(sp->table_vals);
         BFT_FREE(sp);
         sp = nullptr;
       } break;
@@ -1236,6 +1343,24 @@ cs_gwf_soil_finalize_setup(cs_gwf_model_type_t gwf_model,
 
   _build_cell2soil(n_cells);
 
+  /* Tabulate the soil laws if requested */
+
+  for (int i = 0; i < _n_soils; i++) {
+
+    cs_gwf_soil_t  *soil = _soils[i];
+
+    if (soil->model == CS_GWF_SOIL_VGM_TWO_PHASE) {
+
+      cs_gwf_soil_vgm_tpf_param_t *sp
+        = (cs_gwf_soil_vgm_tpf_param_t *)soil->model_param;
+
+      if (sp->table_n_points > 1)
+        _build_vgm_table(sp);
+
+    }
+
+  } /* Loop on soils */
+
   /* Allocate if needed the soil state */
 
   if ((post_flag & CS_GWF_POST_SOIL_STATE)
@@ -1383,6 +1508,14 @@ cs_gwf_soil_log_setup(void)
         bft_error(
           __FILE__, __LINE__, 0, "%s: Invalid joining function.", __func__);
       }
+
+      if (sp->table_n_points > 1)
+        cs_log_printf(CS_LOG_SETUP,
+                      "%s Tabulated laws: %d points; pc in [%5.3e, %5.3e]\n",
+                      id,
+                      sp->table_n_points,
+                      sp->table_pc_min,
+                      sp->table_pc_max);
     } break;
 
     case CS_GWF_SOIL_USER:
@@ -1976,6 +2109,51 @@ cs_gwf_soil_set_vgm_tpf_advanced_param(cs_gwf_soil_t             *soil,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate the tabulation of the Van Genuchten-Mualen laws (liquid
+ *        saturation, liquid capacity and relative permeabilities) of a soil
+ *        in the case of a two-phase flow model.
+ *
+ *        Values are tabulated at n_points capillarity pressures evenly
+ *        spaced in log(pc) between pc_min and pc_max, and evaluated by
+ *        linear interpolation (which preserves the monotonicity of the laws).
+ *        The exact laws are used outside this range. The table is built
+ *        during the last setup stage. If pc_min <= 0, the lower bound is
+ *        set automatically (joining pressure or 1e-4 pr_r), and if pc_max
+ *        <= pc_min, the upper bound is set to 1e4 pr_r.
+ *
+ * \param[in, out] soil        pointer to a cs_gwf_soil_t structure
+ * \param[in]      n_points    number of tabulation points (< 2: no table)
+ * \param[in]      pc_min      lower bound of the tabulated range
+ * \param[in]      pc_max      upper bound of the tabulated range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gwf_soil_set_vgm_tpf_table(cs_gwf_soil_t    *soil,
+                              int               n_points,
+                              double            pc_min,
+                              double            pc_max)
+{
+  if (soil == nullptr)
+    bft_error(__FILE__, __LINE__, 0, _(_err_empty_soil));
+
+  cs_gwf_soil_vgm_tpf_param_t *sp
+    = (cs_gwf_soil_vgm_tpf_param_t *)soil->model_param;
+
+  if (soil->model != CS_GWF_SOIL_VGM_TWO_PHASE)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: soil model is not the one expected\n", __func__);
+  if (sp == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              "%s: soil context not allocated\n", __func__);
+
+  sp->table_n_points = (n_points > 1) ? n_points : 0;
+  sp->table_pc_min = pc_min;
+  sp->table_pc_max = pc_max;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set a soil defined by a user-defined model
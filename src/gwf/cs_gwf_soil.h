@@ -337,6 +337,43 @@ struct _gwf_soil_vgm_tpf_param_t {
   double                     dkrldsl_star;
   double                     krl_alpha;
 
+  /*!
+   * Optional tabulation of the soil laws
+   *
+   * \var table_n_points
+   *      number of tabulation points (tabulation is used if > 1)
+   *
+   * \var table_pc_min
+   *      lower bound of the tabulated range of capillarity pressures
+   *
+   * \var table_pc_max
+   *      upper bound of the tabulated range of capillarity pressures
+   *
+   * \var table_log_pc_min
+   *      Derived quantity: log(table_pc_min)
+   *
+   * \var table_inv_dlog_pc
+   *      Derived quantity: reciprocal of the spacing between two tabulation
+   *      points (in log(pc))
+   *
+   * \var table_vals
+   *      tabulated values of sl, dsldpc, krl and krg (interlaced) at each
+   *      tabulation point
+   *
+   * \var eval_exact
+   *      function performing the exact evaluation of the soil laws (used to
+   *      build the table and outside the tabulated range)
+   */
+
+  int                        table_n_points;
+  double                     table_pc_min;
+  double                     table_pc_max;
+  double                     table_log_pc_min;
+  double                     table_inv_dlog_pc;
+  double                    *table_vals;
+
+  cs_gwf_soil_tpf_eval_t    *eval_exact;
+
 };
 
 typedef struct _gwf_soil_vgm_tpf_param_t cs_gwf_soil_vgm_tpf_param_t;
@@ -792,6 +829,33 @@ cs_gwf_soil_set_vgm_tpf_advanced_param(cs_gwf_soil_t             *soil,
                                        cs_gwf_soil_join_type_t    kr_jtype,
                                        double                     sle_thres);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate the tabulation of the Van Genuchten-Mualen laws (liquid
+ *        saturation, liquid capacity and relative permeabilities) of a soil
+ *        in the case of a two-phase flow model.
+ *
+ *        Values are tabulated at n_points capillarity pressures evenly
+ *        spaced in log(pc) between pc_min and pc_max, and evaluated by
+ *        linear interpolation (which preserves the monotonicity of the laws).
+ *        The exact laws are used outside this range. The table is built
+ *        during the last setup stage. If pc_min <= 0, the lower bound is
+ *        set automatically (joining pressure or 1e-4 pr_r), and if pc_max
+ *        <= pc_min, the upper bound is set to 1e4 pr_r.
+ *
+ * \param[in, out] soil        pointer to a cs_gwf_soil_t structure
+ * \param[in]      n_points    number of tabulation points (< 2: no table)
+ * \param[in]      pc_min      lower bound of the tabulated range
+ * \param[in]      pc_max      upper bound of the tabulated range
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gwf_soil_set_vgm_tpf_table(cs_gwf_soil_t    *soil,
+                              int               n_points,
+                              double            pc_min,
+                              double            pc_max);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set a soil defined by a user-defined model
@@ -2047,6 +2047,12 @@ _compute_coupled_anderson(const cs_mesh_t              *mesh,
   cs_array_real_copy(cdoq->n_vertices, pa->val, pa_kp1);
   cs_array_real_copy(cdoq->n_vertices, pb->val, pb_kp1);
 
+  /* The soil state (relative permeabilities, saturation, capacity) and the
+     related property arrays are up to date with the pressure fields. The
+     (costly) update is only performed when the pressures have changed. */
+
+  bool  state_is_current = true;
+
   /* Main non-linear loop */
 
   while (_check_cvg_nl(tpf->nl_algo_type,
@@ -2064,18 +2070,21 @@ _compute_coupled_anderson(const cs_mesh_t              *mesh,
 
       cs_array_real_copy(cdoq->n_vertices, pa_kp1, pa->val);
       cs_array_real_copy(cdoq->n_vertices, pb_kp1, pb->val);
+      state_is_current = false;
 
     }
 
-    cs_gwf_tpf_update(mesh, connect, cdoq, time_step,
-                      update_flag,
-                      option_flag,
-                      tpf);
+    if (!state_is_current)
+      cs_gwf_tpf_update(mesh, connect, cdoq, time_step,
+                        update_flag,
+                        option_flag,
+                        tpf);
 
     /* Build and solve the linear system related to the coupled system of
        equations. First call: current --> previous and then no operation */
 
     cs_equation_system_solve(cur2prev, tpf->system);
+    state_is_current = false;
 
     cs_array_real_copy(cdoq->n_vertices, pa->val, pa_kp1);
     cs_array_real_copy(cdoq->n_vertices, pb->val, pb_kp1);
@@ -2085,10 +2094,11 @@ _compute_coupled_anderson(const cs_mesh_t              *mesh,
   /* Get the soil state up to date with the last compute values for the
      liquid and gas pressures */
 
-  cs_gwf_tpf_update(mesh, connect, cdoq, time_step,
-                    update_flag,
-                    option_flag,
-                    tpf);
+  if (!state_is_current)
+    cs_gwf_tpf_update(mesh, connect, cdoq, time_step,
+                      update_flag,
+                      option_flag,
+                      tpf);
 
   if (algo->verbosity > 0)
     cs_log_printf(CS_LOG_DEFAULT,
@@ -76,6 +76,7 @@
 #include "cs_post_default.h"
 #include "cs_prototypes.h"
 #include "cs_rad_transfer.h"
+#include "cs_repartition.h"
 
 #include "cs_gui_particles.h"
 #include "cs_gui_util.h"
@@ -92,10 +93,12 @@
 #include "cs_lagr_car.h"
 #include "cs_lagr_coupling.h"
 #include "cs_lagr_new.h"
+#include "cs_lagr_population.h"
 #include "cs_lagr_particle.h"
 #include "cs_lagr_resuspension.h"
 #include "cs_lagr_stat.h"
 #include "cs_lagr_tracking.h"
+#include "cs_lagr_trajectory.h"
 #include "cs_lagr_print.h"
 #include "cs_lagr_poisson.h"
 #include "cs_lagr_post.h"
@@ -164,7 +167,8 @@ static cs_lagr_time_scheme_t _lagr_time_scheme
      .interpol_field = 1,
      .ilapoi = 0,
      .iadded_mass = 0,
-     .added_mass_const = 0};
+     .added_mass_const = 0,
+     .counter_rng = 0};
 
 /* Main Lagrangian physical model parameters */
 
@@ -272,6 +276,18 @@ static cs_lagr_consolidation_model_t _cs_glob_lagr_consolidation_model
 cs_lagr_consolidation_model_t *cs_glob_lagr_consolidation_model
   = &_cs_glob_lagr_consolidation_model;
 
+/* lagr population control structure and associated pointer */
+static cs_lagr_population_model_t _cs_glob_lagr_population_model
+  = {
+    .frequency = 0,
+    .n_min_per_cell = 0,
+    .n_max_per_cell = 0,
+    .min_stat_weight = 0.,
+    .max_stat_weight = 0.};
+
+cs_lagr_population_model_t *cs_glob_lagr_population_model
+  = &_cs_glob_lagr_population_model;
+
 /*! current time step status */
 
 static cs_lagr_time_step_t _cs_glob_lagr_time_step
@@ -707,13 +723,61 @@ _get_n_occupied_cells(const cs_lagr_particle_set_t  *p_set,
       prev_cell_id = curr_cell_id;
     }
   }
-  else if (p_set->n_particles == 1) {
+  else if (end - start == 1) {
     counter_particle_cells = 1;
   }
 
   return counter_particle_cells;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Obtain the cells occupied by at least one particle in the range
+ *        of particles sorted by cell, using the cell -> particles index.
+ *
+ * If occupied_cell_ids and particle_gaps are NULL, only the number of
+ * occupied cells is computed.
+ *
+ * \param[in]   p_set              pointer to particle data structure
+ * \param[out]  occupied_cell_ids  occupied cell ids, or NULL
+ * \param[out]  particle_gaps      start index of particles of each occupied
+ *                                 cell, or NULL
+ *
+ * \return
+ *   number of cells occupied by at least one sorted particle
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_occupied_cells_sorted(const cs_lagr_particle_set_t  *p_set,
+                       cs_lnum_t                      occupied_cell_ids[],
+                       cs_lnum_t                      particle_gaps[])
+{
+  if (p_set->cell_p_idx == NULL || p_set->n_cell_sorted < 1)
+    return 0;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_sorted = p_set->n_cell_sorted;
+  const cs_lnum_t *cell_p_idx = p_set->cell_p_idx;
+
+  cs_lnum_t counter = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t s_id = cell_p_idx[c_id];
+    if (s_id >= n_sorted)
+      break;
+    if (cell_p_idx[c_id+1] > s_id) {
+      if (occupied_cell_ids != NULL) {
+        occupied_cell_ids[counter] = c_id;
+        particle_gaps[counter] = s_id;
+      }
+      counter++;
+    }
+  }
+
+  return counter;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Obtain the index of cells that are occupied by at least one
@@ -752,7 +816,7 @@ _occupied_cells(cs_lagr_particle_set_t  *p_set,
     cs_lnum_t curr_cell_id = prev_cell_id;
     cs_lnum_t counter = 0;
     occupied_cell_ids[0] = curr_cell_id;
-    particle_gaps[0] = 0;
+    particle_gaps[0] = start;
 
     counter = 1;
 
@@ -861,6 +925,14 @@ cs_lagr_finalize(void)
 
   cs_lagr_stat_finalize();
 
+  /* Injection placement tables */
+
+  cs_lagr_new_finalize();
+
+  /* Buffered trajectories */
+
+  cs_lagr_trajectory_buffer_finalize();
+
   /* Also close log file (TODO move this) */
 
   cs_lagr_print_finalize();
@@ -1032,6 +1104,7 @@ cs_lagr_injection_set_default(cs_lagr_injection_set_t  *zis)
 
   zis->n_inject             =  0;
   zis->injection_frequency  =  0;
+  zis->bulk_injection       =  0;
 
   zis->injection_profile_func = NULL;
   zis->injection_profile_input = NULL;
@@ -1253,6 +1326,18 @@ cs_get_lagr_consolidation_model(void)
   return &_cs_glob_lagr_consolidation_model;
 }
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_population_model_t
+ *
+ * needed to initialize structure with GUI
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_population_model_t *
+cs_get_lagr_population_model(void)
+{
+  return &_cs_glob_lagr_population_model;
+}
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_time_step_t
  *
@@ -1872,6 +1957,23 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
     }
 
+    /* Particle residence, for partitioning based on measured costs */
+
+    int cost_id = cs_repartition_cost_id("particle_residence");
+    if (cost_id > -1) {
+      cs_lnum_t n_p_cells = 0;
+      cs_lnum_t *p_cell_id;
+      BFT_MALLOC(p_cell_id, p_set->n_particles, cs_lnum_t);
+      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
+        cs_lnum_t c_id = cs_lagr_particles_get_lnum(p_set, ip,
+                                                    CS_LAGR_CELL_ID);
+        if (c_id > -1)
+          p_cell_id[n_p_cells++] = c_id;
+      }
+      cs_repartition_cost_add(cost_id, n_p_cells, p_cell_id, nullptr);
+      BFT_FREE(p_cell_id);
+    }
+
     /* Compute the Lagrangian time */
     /* Pressure fluid velocity and Lagrangian time  gradients
        ----------------------------------------------------- */
@@ -2120,16 +2222,29 @@ cs_lagr_solve_time_step(const int         itypfb[],
       if (   cs_glob_lagr_model->agglomeration == 1
           || cs_glob_lagr_model->fragmentation == 1 ) {
 
+        /* Use cell -> particles index for particles sorted by cell,
+           and scan remaining ones */
+
+        cs_lnum_t n_sorted = 0, n_sorted_cells = 0;
+        if (p_set->cell_p_idx != NULL) {
+          n_sorted = p_set->n_cell_sorted;
+          n_sorted_cells = _occupied_cells_sorted(p_set, NULL, NULL);
+        }
+
         n_occupied_cells
-          = _get_n_occupied_cells(p_set, 0, p_set->n_particles);
+          =   n_sorted_cells
+            + _get_n_occupied_cells(p_set, n_sorted, p_set->n_particles);
 
         BFT_MALLOC(occupied_cell_ids, n_occupied_cells, cs_lnum_t);
         BFT_MALLOC(particle_list, n_occupied_cells+1, cs_lnum_t);
 
-        _occupied_cells(p_set, 0, p_set->n_particles,
-                        n_occupied_cells,
-                        occupied_cell_ids,
-                        particle_list);
+        _occupied_cells_sorted(p_set, occupied_cell_ids, particle_list);
+
+        _occupied_cells(p_set, n_sorted, p_set->n_particles,
+                        n_occupied_cells - n_sorted_cells,
+                        occupied_cell_ids + n_sorted_cells,
+                        particle_list + n_sorted_cells);
+        particle_list[n_occupied_cells] = p_set->n_particles;
 
       }
 
@@ -2147,6 +2262,19 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
         cs_lnum_t enter_parts = p_set->n_particles;
 
+        /* Work buffer used to move deleted particles to the end of each
+           cell's sub-list (sized for the most populated cell) */
+
+        cs_lnum_t max_local_size = 0;
+        for (cs_lnum_t icell = 0; icell < n_occupied_cells; ++icell)
+          max_local_size = CS_MAX(max_local_size,
+                                  particle_list[icell+1] - particle_list[icell]);
+
+        unsigned char *swap_buffer;
+        BFT_MALLOC(swap_buffer,
+                   p_set->p_am->extents * max_local_size,
+                   unsigned char);
+
         /* Loop on all cells that contain at least one particle */
         for (cs_lnum_t icell = 0; icell < n_occupied_cells; ++icell) {
 
@@ -2172,18 +2300,13 @@ cs_lagr_solve_time_step(const int         itypfb[],
 
           cs_lnum_t inserted_parts_agglo = p_set->n_particles - init_particles;
 
-          /* Create local buffer (deleted particles at the end) */
+          /* Use local buffer (deleted particles at the end) */
 
           cs_lnum_t local_size = end_part - start_part;
           cs_lnum_t deleted_parts = _get_n_deleted(p_set, start_part, end_part);
           size_t swap_buffer_size =   p_set->p_am->extents
                                     * (local_size - deleted_parts);
-          size_t swap_buffer_deleted = p_set->p_am->extents * deleted_parts;
-
-          /* Create buffers for deleted particles */
-          unsigned char * swap_buffer, *deleted_buffer;
-          BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
-          BFT_MALLOC(deleted_buffer, swap_buffer_deleted, unsigned char);
+          unsigned char *deleted_buffer = swap_buffer + swap_buffer_size;
 
           /* Update buffer for existing particles */
           cs_lnum_t count_del = 0, count_swap = 0;
@@ -2204,13 +2327,7 @@ cs_lagr_solve_time_step(const int         itypfb[],
           }
 
           memcpy(p_set->p_buffer + p_set->p_am->extents * start_part,
-                 swap_buffer, swap_buffer_size);
-          memcpy(  p_set->p_buffer
-                 + p_set->p_am->extents * (local_size-deleted_parts+start_part),
-                 deleted_buffer, swap_buffer_deleted);
-
-          BFT_FREE(deleted_buffer);
-          BFT_FREE(swap_buffer);
+                 swap_buffer, p_set->p_am->extents * local_size);
 
           /* Treat fragmentation */
           init_particles = p_set->n_particles;
@@ -2229,6 +2346,8 @@ cs_lagr_solve_time_step(const int         itypfb[],
                                      + inserted_parts_agglo + inserted_parts_frag;
         }
 
+        BFT_FREE(swap_buffer);
+
         p_set->n_particles = enter_parts;
 
         /* Introduce new particles (uniformly in the cell) */
@@ -2316,6 +2435,12 @@ cs_lagr_solve_time_step(const int         itypfb[],
         cs_lagr_tracking_particle_movement(vislen, particle_range);
       }
 
+      /* Population control (splitting/merging) on particles sorted by cell
+         ---------------------------------------------------------------- */
+
+      if (cs_glob_lagr_time_step->nor == cs_glob_lagr_time_scheme->t_order)
+        cs_lagr_population_control();
+
       /* Update residence time */
 
       if (cs_glob_lagr_time_step->nor == cs_glob_lagr_time_scheme->t_order) {
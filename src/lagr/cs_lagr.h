@@ -254,6 +254,12 @@ typedef struct {
   /*! Added-mass constant (\f$ C_A = 1\f$) */
   cs_real_t        added_mass_const;
 
+  /*! use counter-based random numbers (=1) or the default sequential
+    generator (=0) for the stochastic terms of the particle equations.
+    Counter-based numbers are generated in parallel, and do not depend on
+    the number of threads */
+  int     counter_rng;
+
 } cs_lagr_time_scheme_t;
 
 /*! Main physical model parameters for the Lagrangian module */
@@ -544,6 +550,24 @@ typedef struct {
 
 } cs_lagr_consolidation_model_t;
 
+/*! Parameters of the particle population control */
+/* ----------------------------------------------- */
+
+typedef struct {
+
+  int                frequency;        /*!< apply every frequency time
+                                            steps (0: off) */
+  cs_lnum_t          n_min_per_cell;   /*!< split particles in cells with
+                                            fewer particles */
+  cs_lnum_t          n_max_per_cell;   /*!< merge particles in cells with
+                                            more particles (0: no limit) */
+  cs_real_t          min_stat_weight;  /*!< do not split particles into
+                                            parts lighter than this */
+  cs_real_t          max_stat_weight;  /*!< do not merge particles into
+                                            heavier ones (0: no limit) */
+
+} cs_lagr_population_model_t;
+
 /*! Lagrangian time stepping status */
 /*----------------------------------*/
 
@@ -575,6 +599,11 @@ typedef struct {
   int         injection_frequency;   /*!< injection frequency
                                           (if =< 0, only at first iteration) */
 
+  int         bulk_injection;        /*!< if > 0, place particles in parallel
+                                          using cached per-zone placement
+                                          tables and counter-based random
+                                          numbers */
+
   /*! optional injection profile computation function, or NULL */
   cs_lagr_injection_profile_compute_t  *injection_profile_func;
 
@@ -1005,6 +1034,7 @@ extern cs_lagr_agglomeration_model_t         *cs_glob_lagr_agglomeration_model;
 extern cs_lagr_fragmentation_model_t         *cs_glob_lagr_fragmentation_model;
 
 extern cs_lagr_consolidation_model_t         *cs_glob_lagr_consolidation_model;
+extern cs_lagr_population_model_t            *cs_glob_lagr_population_model;
 extern cs_lagr_time_step_t                   *cs_glob_lagr_time_step;
 extern cs_lagr_source_terms_t                *cs_glob_lagr_source_terms;
 extern cs_lagr_encrustation_t                *cs_glob_lagr_encrustation;
@@ -1153,6 +1183,15 @@ cs_get_lagr_agglomeration_model(void);
 cs_lagr_consolidation_model_t *
 cs_get_lagr_consolidation_model(void);
 
+/*----------------------------------------------------------------------------
+ * Provide access to cs_lagr_population_model_t
+ *
+ * needed to initialize structure with GUI
+ *----------------------------------------------------------------------------*/
+
+cs_lagr_population_model_t *
+cs_get_lagr_population_model(void);
+
 /*----------------------------------------------------------------------------
  * Provide access to cs_lagr_time_step_t
  *
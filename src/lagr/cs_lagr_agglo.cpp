@@ -292,6 +292,120 @@ _gaps_classes(cs_lnum_2_t  *array,
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first parcel of a given class in a class index.
+ *
+ * Following parcels of the same class are obtained through
+ * the index's next array.
+ *
+ * \param[in]  ci        pointer to class index
+ * \param[in]  class_id  agglomeration class id
+ *
+ * \return  local id of the first parcel of the class, or -1
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_index_first(const cs_lagr_agglo_class_index_t  *ci,
+                                cs_lnum_t                           class_id)
+{
+  cs_lnum_t first = 0;
+  cs_lnum_t last = ci->n_classes - 1;
+
+  while (first <= last) {
+    cs_lnum_t middle = (first + last) / 2;
+    if (ci->cls[middle*3] < class_id)
+      first = middle + 1;
+    else if (ci->cls[middle*3] > class_id)
+      last = middle - 1;
+    else
+      return ci->cls[middle*3 + 1];
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append a parcel to a class index.
+ *
+ * \param[in, out]  ci         pointer to class index
+ * \param[in]       class_id   agglomeration class id of the parcel
+ * \param[in]       parcel_id  local id of the parcel
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_index_add(cs_lagr_agglo_class_index_t  *ci,
+                              cs_lnum_t                     class_id,
+                              cs_lnum_t                     parcel_id)
+{
+  if (parcel_id >= ci->n_parcels_max) {
+    ci->n_parcels_max = CS_MAX(parcel_id + 1, 2*ci->n_parcels_max);
+    BFT_REALLOC(ci->next, ci->n_parcels_max, cs_lnum_t);
+  }
+  ci->next[parcel_id] = -1;
+
+  /* Search for insertion position */
+
+  cs_lnum_t first = 0;
+  cs_lnum_t last = ci->n_classes;
+
+  while (first < last) {
+    cs_lnum_t middle = (first + last) / 2;
+    if (ci->cls[middle*3] < class_id)
+      first = middle + 1;
+    else
+      last = middle;
+  }
+
+  /* Existing class: append to chain */
+
+  if (first < ci->n_classes && ci->cls[first*3] == class_id) {
+    ci->next[ci->cls[first*3 + 2]] = parcel_id;
+    ci->cls[first*3 + 2] = parcel_id;
+    return;
+  }
+
+  /* New class: insert */
+
+  if (ci->n_classes >= ci->n_classes_max) {
+    ci->n_classes_max = CS_MAX(8, 2*ci->n_classes_max);
+    BFT_REALLOC(ci->cls, 3*ci->n_classes_max, cs_lnum_t);
+  }
+
+  for (cs_lnum_t i = ci->n_classes; i > first; i--) {
+    for (int j = 0; j < 3; j++)
+      ci->cls[i*3 + j] = ci->cls[(i-1)*3 + j];
+  }
+
+  ci->cls[first*3] = class_id;
+  ci->cls[first*3 + 1] = parcel_id;
+  ci->cls[first*3 + 2] = parcel_id;
+
+  ci->n_classes += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays of a class index.
+ *
+ * \param[in, out]  ci  pointer to class index
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_index_free(cs_lagr_agglo_class_index_t  *ci)
+{
+  BFT_FREE(ci->cls);
+  BFT_FREE(ci->next);
+
+  ci->n_classes = 0;
+  ci->n_classes_max = 0;
+  ci->n_parcels_max = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -449,6 +563,9 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
   long long int vp = 0;
   cs_lnum_t n_classes_new = 0;
 
+  /* Parcels created here, binned by class */
+  cs_lagr_agglo_class_index_t new_cls = {0, 0, NULL, 0, NULL};
+
   /* Treat agglomeration between pairs*/
   while (kk >= 0) {
     cs_real_t rand;
@@ -565,15 +682,14 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
 
       cs_lnum_t add_to_end = 1;
 
-      for (cs_lnum_t indx = p_set->n_particles;
-          indx < p_set->n_particles + newpart;
-          indx++) {
-        cs_lnum_t stat_class
-          = cs_lagr_particles_get_lnum(p_set, indx, CS_LAGR_AGGLO_CLASS_ID);
+      for (cs_lnum_t j = cs_lagr_agglo_class_index_first(&new_cls,
+                                                         n_classes_new);
+           j > -1;
+           j = new_cls.next[j]) {
+        cs_lnum_t indx = p_set->n_particles + j;
         cs_real_t stat_weight
           = cs_lagr_particles_get_real(p_set, indx, CS_LAGR_STAT_WEIGHT);
-        if (   (stat_class == n_classes_new)
-            && (stat_weight + vp <= agglo_max_weight)) {
+        if (stat_weight + vp <= agglo_max_weight) {
           cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT,
                                      round(stat_weight)+vp);
 
@@ -585,6 +701,7 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
       /* Else, create a new parcel at the end
          Principle: copy parcel p1 and modify its properties */
       if ( add_to_end == 1 ) {
+        cs_lagr_agglo_class_index_add(&new_cls, n_classes_new, newpart);
         newpart++;
 
         /* Copy parcel p1 into a new parcel */
@@ -651,6 +768,8 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
     kk--;
   }
 
+  cs_lagr_agglo_class_index_free(&new_cls);
+
   /* Store class and index of newly created particles */
   cs_lnum_2_t *interf_agglo;
   BFT_MALLOC(interf_agglo, newpart, cs_lnum_2_t);
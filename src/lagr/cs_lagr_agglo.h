@@ -41,10 +41,74 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Index of parcels created in a cell, binned by agglomeration class */
+
+typedef struct {
+
+  cs_lnum_t   n_classes;      /*!< number of distinct classes */
+  cs_lnum_t   n_classes_max;  /*!< allocated size of cls */
+  cs_lnum_t  *cls;            /*!< class id, first and last parcel of
+                                   each class, sorted by class id
+                                   (size: 3*n_classes_max) */
+
+  cs_lnum_t   n_parcels_max;  /*!< allocated size of next */
+  cs_lnum_t  *next;           /*!< next parcel of the same class in
+                                   creation order, or -1 */
+
+} cs_lagr_agglo_class_index_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first parcel of a given class in a class index.
+ *
+ * Following parcels of the same class are obtained through
+ * the index's next array.
+ *
+ * \param[in]  ci        pointer to class index
+ * \param[in]  class_id  agglomeration class id
+ *
+ * \return  local id of the first parcel of the class, or -1
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_index_first(const cs_lagr_agglo_class_index_t  *ci,
+                                cs_lnum_t                           class_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append a parcel to a class index.
+ *
+ * \param[in, out]  ci         pointer to class index
+ * \param[in]       class_id   agglomeration class id of the parcel
+ * \param[in]       parcel_id  local id of the parcel
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_index_add(cs_lagr_agglo_class_index_t  *ci,
+                              cs_lnum_t                     class_id,
+                              cs_lnum_t                     parcel_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays of a class index.
+ *
+ * \param[in, out]  ci  pointer to class index
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_index_free(cs_lagr_agglo_class_index_t  *ci);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -93,6 +93,56 @@ static const cs_lnum_t _t2v[3][3] = {{0, 3, 5},
                                      {3, 1, 4},
                                      {5, 4, 2}};
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Add a particle's contribution to momentum source terms of its cell
+ * (not yet divided by the cell volume).
+ *
+ * parameters:
+ *   particle   <-- pointer to particle data
+ *   p_am       <-- pointer to particle attributes map
+ *   taup       <-- particle dynamic characteristic time
+ *   auxl       <-- particle momentum exchange
+ *   volp       <-> volume of particles in cell
+ *   volm       <-> mass of particles in cell
+ *   st_vel     <-> explicit momentum source term
+ *   st_imp_vel <-> implicit momentum source term
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_add_momentum_st(const unsigned char            *particle,
+                 const cs_lagr_attribute_map_t  *p_am,
+                 cs_real_t                       taup,
+                 const cs_real_t                 auxl[3],
+                 cs_real_t                      *volp,
+                 cs_real_t                      *volm,
+                 cs_real_t                       st_vel[3],
+                 cs_real_t                      *st_imp_vel)
+{
+  cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
+                                                  CS_LAGR_STAT_WEIGHT);
+
+  cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                                       CS_LAGR_DIAMETER);
+  cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                                       CS_LAGR_MASS);
+  cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am,
+                                                CS_LAGR_MASS);
+
+  /* Volume and mass of particles in cell */
+  *volp += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
+  *volm += p_stat_w * prev_p_mass;
+
+  /* Momentum source term */
+  for (cs_lnum_t i = 0; i < 3; i++)
+    st_vel[i] -= auxl[i];
+
+  *st_imp_vel -= 2.0 * p_stat_w * p_mass / taup;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -286,35 +336,80 @@ cs_lagr_coupling(const cs_real_t    taup[],
     cs_array_real_fill_zero(3 * n_cells_ext, (cs_real_t *) t_st_vel);
     cs_array_real_fill_zero(n_cells_ext,  t_st_imp_vel);
 
-    for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
+    /* Particles sorted by cell: accumulate per cell */
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+    cs_lnum_t n_sorted = 0;
+
+    if (p_set->cell_p_idx != NULL) {
 
-      cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
-                                                      CS_LAGR_STAT_WEIGHT);
+      n_sorted = p_set->n_cell_sorted;
+      const cs_lnum_t *cell_p_idx = p_set->cell_p_idx;
+
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
 
-      cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                           CS_LAGR_DIAMETER);
-      cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                           CS_LAGR_MASS);
-      cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am,
-                                                    CS_LAGR_MASS);
+        cs_lnum_t s_id = CS_MIN(cell_p_idx[c_id], n_sorted);
+        cs_lnum_t e_id = CS_MIN(cell_p_idx[c_id+1], n_sorted);
+
+        if (s_id >= e_id)
+          continue;
+
+        cs_real_t c_volp = 0., c_volm = 0., c_st_imp_vel = 0.;
+        cs_real_t c_st_vel[3] = {0., 0., 0.};
+
+        for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++)
+          _add_momentum_st(p_set->p_buffer + p_am->extents * p_id,
+                           p_am,
+                           taup[p_id],
+                           auxl[p_id],
+                           &c_volp,
+                           &c_volm,
+                           c_st_vel,
+                           &c_st_imp_vel);
+
+        cs_real_t dvol = 0.;
+        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+          dvol = 1. / cell_f_vol[c_id];
+
+        volp[c_id] += c_volp;
+        volm[c_id] += c_volm;
+        for (cs_lnum_t i = 0; i < 3; i++)
+          t_st_vel[c_id][i] += dvol * c_st_vel[i];
+        t_st_imp_vel[c_id] += dvol * c_st_imp_vel;
+
+      }
+
+    }
+
+    /* Remaining particles */
+
+    for (cs_lnum_t p_id = n_sorted; p_id < nbpart; p_id++) {
+
+      unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
 
       cs_lnum_t c_id = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_CELL_ID);
 
-      /* Volume and mass of particles in cell */
-      volp[c_id] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
-      volm[c_id] += p_stat_w * prev_p_mass;
+      cs_real_t p_volp = 0., p_volm = 0., p_st_imp_vel = 0.;
+      cs_real_t p_st_vel[3] = {0., 0., 0.};
+
+      _add_momentum_st(particle,
+                       p_am,
+                       taup[p_id],
+                       auxl[p_id],
+                       &p_volp,
+                       &p_volm,
+                       p_st_vel,
+                       &p_st_imp_vel);
 
-      /* Momentum source term */
       cs_real_t dvol = 0.;
       if (has_dc * c_disable_flag[has_dc * c_id] == 0)
         dvol = 1. / cell_f_vol[c_id];
 
+      volp[c_id] += p_volp;
+      volm[c_id] += p_volm;
       for (cs_lnum_t i = 0; i < 3; i++)
-        t_st_vel[c_id][i] -= dvol * auxl[p_id][i];
-
-      t_st_imp_vel[c_id] -= 2.0 * dvol * p_stat_w * p_mass / taup[p_id];
+        t_st_vel[c_id][i] += dvol * p_st_vel[i];
+      t_st_imp_vel[c_id] += dvol * p_st_imp_vel;
 
     }
 
@@ -131,6 +131,89 @@ _segment_binary_search(cs_lnum_t     n,
   return mid_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return counter-based random number stream for injection.
+ *
+ * \param[in]  tag  tag identifying the calling operation
+ *
+ * \return  stream id, unique for the time step, operation, and rank
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_rng_stream(int  tag)
+{
+  return   ((uint64_t)cs_glob_time_step->nt_cur << 40)
+         | ((uint64_t)tag << 32)
+         | (uint64_t)CS_MAX(cs_glob_rank_id, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return counter-based random number offset for an injection set.
+ *
+ * Each set is given a separate range of 2^42 values, so that draws for
+ * different zones and sets in the same stream do not overlap.
+ *
+ * \param[in]  zis  pointer to injection data for a given zone and set
+ *
+ * \return  offset of first random value for this set
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_rng_offset(const cs_lagr_injection_set_t  *zis)
+{
+  uint64_t l_id = (zis->location_id == CS_MESH_LOCATION_BOUNDARY_FACES) ? 0 : 1;
+
+  return   (l_id << 62)
+         | (((uint64_t)zis->zone_id & 0xfff) << 50)
+         | (((uint64_t)zis->set_id & 0xff) << 42);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Count random samples falling in each segment of a cumulative
+ *        distribution, using counter-based random numbers.
+ *
+ * Samples are drawn in parallel, and results do not depend on the number
+ * of threads.
+ *
+ * \param[in]       rng_stream  counter-based random number stream
+ * \param[in]       rng_offset  position of first random value in stream
+ * \param[in]       n_samples   number of samples
+ * \param[in]       n           number of segments
+ * \param[in]       cm_weight   cumulative weights, scaled to [0, 1]
+ * \param[in, out]  count       number of samples per segment (incremented)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_bulk_segment_counts(uint64_t       rng_stream,
+                     uint64_t       rng_offset,
+                     cs_gnum_t      n_samples,
+                     cs_lnum_t      n,
+                     const double   cm_weight[],
+                     cs_lnum_t      count[])
+{
+  const uint64_t key = cs_random_counter_key();
+  const uint64_t b_s = rng_offset / 2;
+  const cs_gnum_t n_blocks = (n_samples + 1) / 2;
+
+# pragma omp parallel for if (n_blocks > CS_THR_MIN)
+  for (cs_gnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    cs_real_t r[2];
+    cs_random_counter_uniform2(key, rng_stream, b_s + b_id, r);
+    int n_r = (2*b_id + 1 < n_samples) ? 2 : 1;
+    for (int k = 0; k < n_r; k++) {
+      cs_lnum_t s_id = _segment_binary_search(n, r[k], cm_weight);
+      #pragma omp atomic
+      count[s_id] += 1;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Distribute new particles in a given region.
@@ -141,6 +224,10 @@ _segment_binary_search(cs_lnum_t     n,
  * \param[in]   elt_weight        parent element weights
  *                                (i.e. all local surfaces or volumes)
  * \param[in]   elt_profile       optional profile values for elements (or NULL)
+ * \param[in]   bulk              if true, use counter-based random numbers
+ *                                and parallel sampling
+ * \param[in]   rng_offset        position of first random value in
+ *                                streams (for bulk mode)
  * \param[out]  elt_particle_idx  start index of added particles for each
  *                                element (size: n_elts + 1)
  *
@@ -154,6 +241,8 @@ _distribute_particles(cs_gnum_t         n_g_particles,
                       const cs_lnum_t   elt_id[],
                       const cs_real_t   elt_weight[],
                       const cs_real_t  *elt_profile,
+                      bool              bulk,
+                      uint64_t          rng_offset,
                       cs_lnum_t         elt_particle_idx[])
 {
   cs_lnum_t n_particles = (cs_glob_n_ranks > 1) ? 0 : n_g_particles;
@@ -246,11 +335,17 @@ _distribute_particles(cs_gnum_t         n_g_particles,
 
         /* Compute distribution */
 
-        for (cs_gnum_t i = 0; i < n_g_particles; i++) {
-          cs_real_t r;
-          cs_random_uniform(1, &r);
-          int r_id = _segment_binary_search(n_ranks, r, cm_weight);
-          n_rank_particles[r_id] += 1;
+        if (bulk)
+          _bulk_segment_counts(_rng_stream(3), rng_offset, n_g_particles,
+                               n_ranks, cm_weight, n_rank_particles);
+
+        else {
+          for (cs_gnum_t i = 0; i < n_g_particles; i++) {
+            cs_real_t r;
+            cs_random_uniform(1, &r);
+            int r_id = _segment_binary_search(n_ranks, r, cm_weight);
+            n_rank_particles[r_id] += 1;
+          }
         }
 
       }
@@ -283,11 +378,17 @@ _distribute_particles(cs_gnum_t         n_g_particles,
 
   /* Compute distribution */
 
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-    cs_real_t r;
-    cs_random_uniform(1, &r);
-    cs_lnum_t e_id = _segment_binary_search(n_elts, r, elt_cm_weight);
-    elt_particle_idx[e_id+1] += 1;
+  if (bulk && n_particles > 0)
+    _bulk_segment_counts(_rng_stream(2), rng_offset, n_particles,
+                         n_elts, elt_cm_weight, elt_particle_idx + 1);
+
+  else {
+    for (cs_lnum_t i = 0; i < n_particles; i++) {
+      cs_real_t r;
+      cs_random_uniform(1, &r);
+      cs_lnum_t e_id = _segment_binary_search(n_elts, r, elt_cm_weight);
+      elt_particle_idx[e_id+1] += 1;
+    }
   }
 
   BFT_FREE(elt_cm_weight);
@@ -1025,6 +1126,9 @@ cs_lagr_injection(int        time_id,
         if (ts->nt_cur % injection_frequency != 0)
           continue;
 
+        const bool bulk = (zis->bulk_injection > 0) ? true : false;
+        const uint64_t rng_offset = _rng_offset(zis);
+
         cs_real_t *elt_profile = NULL;
         if (zis->injection_profile_func != NULL) {
           BFT_MALLOC(elt_profile, n_z_elts, cs_real_t);
@@ -1041,6 +1145,8 @@ cs_lagr_injection(int        time_id,
                                                    z_elt_ids,
                                                    elt_weight,
                                                    elt_profile,
+                                                   bulk,
+                                                   rng_offset,
                                                    elt_particle_idx);
 
         BFT_FREE(elt_profile);
@@ -1066,7 +1172,16 @@ cs_lagr_injection(int        time_id,
 
         /* Define particle coordinates and place on faces/cells */
 
-        if (zis->location_id == CS_MESH_LOCATION_BOUNDARY_FACES)
+        if (bulk)
+          cs_lagr_new_bulk(p_set,
+                           zis->location_id,
+                           zis->zone_id,
+                           n_z_elts,
+                           z_elt_ids,
+                           elt_particle_idx,
+                           _rng_stream(4),
+                           rng_offset);
+        else if (zis->location_id == CS_MESH_LOCATION_BOUNDARY_FACES)
           cs_lagr_new(p_set,
                       n_z_elts,
                       z_elt_ids,
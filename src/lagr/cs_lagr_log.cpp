@@ -485,10 +485,12 @@ cs_lagr_log_setup(void)
        "  Statistics options:\n"
        "  starting iteration for statistics:        %d\n"
        "  starting iteration for steady statistics: %d\n"
-       "  threshold for statistical meaning:        %11.3e\n"),
+       "  threshold for statistical meaning:        %11.3e\n"
+       "  deferred moment computation:              %s\n"),
      cs_glob_lagr_stat_options->idstnt,
      cs_glob_lagr_stat_options->nstist,
-     cs_glob_lagr_stat_options->threshold);
+     cs_glob_lagr_stat_options->threshold,
+     _status(cs_glob_lagr_stat_options->deferred));
 
   cs_log_printf
     (CS_LOG_SETUP,
@@ -512,10 +514,27 @@ cs_lagr_log_setup(void)
      _("\n  Numerical options:\n"
        "    trajectory time scheme order:                 %d\n"
        "    Extended time scheme:                         %s\n"
-       "    Poisson correction for particle velocity:     %s\n"),
+       "    Poisson correction for particle velocity:     %s\n"
+       "    Counter-based random numbers:                 %s\n"),
      cs_glob_lagr_time_scheme->t_order,
      _status(cs_glob_lagr_time_scheme->extended_t_scheme),
-     _status(cs_glob_lagr_time_scheme->ilapoi));
+     _status(cs_glob_lagr_time_scheme->ilapoi),
+     _status(cs_glob_lagr_time_scheme->counter_rng));
+
+  if (cs_glob_lagr_population_model->frequency > 0)
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("\n  Population control:\n"
+         "    frequency:                                    %d\n"
+         "    minimum number of particles per cell:         %ld\n"
+         "    maximum number of particles per cell:         %ld\n"
+         "    minimum statistical weight:                   %14.5e\n"
+         "    maximum statistical weight:                   %14.5e\n"),
+       cs_glob_lagr_population_model->frequency,
+       (long)cs_glob_lagr_population_model->n_min_per_cell,
+       (long)cs_glob_lagr_population_model->n_max_per_cell,
+       cs_glob_lagr_population_model->min_stat_weight,
+       cs_glob_lagr_population_model->max_stat_weight);
 
   cs_log_printf
     (CS_LOG_SETUP,
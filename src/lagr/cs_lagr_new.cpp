@@ -61,6 +61,7 @@
 #include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_order.h"
 #include "cs_parall.h"
@@ -92,12 +93,43 @@
 
 BEGIN_C_DECLS
 
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Precomputed placement data for bulk injection in a zone */
+
+typedef struct {
+
+  int               location_id;  /* associated mesh location */
+  int               zone_id;      /* associated zone id */
+
+  cs_lnum_t         n_elts;       /* number of zone elements */
+  const cs_lnum_t  *elt_ids;      /* zone element ids used for build */
+
+  cs_lnum_t        *sub_idx;      /* faces: index of sub-surfaces;
+                                     cells: index of cell faces */
+  cs_lnum_t        *cf_sub_idx;   /* cells: start of each cell face's
+                                     sub-surfaces in acc_surf_r */
+  cs_real_t        *acc_vol_r;    /* cells: accumulated cone volume ratios */
+  bool             *fallback;     /* cells: non star-shaped cell flag */
+  cs_real_t        *acc_surf_r;   /* accumulated sub-surface ratios */
+
+} cs_lagr_new_table_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int                   _n_placement_tables = 0;
+static cs_lagr_new_table_t  *_placement_tables = NULL;
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
 
-/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
-
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Determine accumulated surfaces of an implicit decomposition
@@ -200,7 +232,7 @@ _face_sub_surfaces(cs_lnum_t        n_vertices,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Position a point randomly on a given face
+ * \brief Position a point on a given face based on given random values
  *
  * If the face has one or more concave angles, the point will be assigned
  * to a randomly determined edge.
@@ -212,25 +244,25 @@ _face_sub_surfaces(cs_lnum_t        n_vertices,
  * \param[in]   acc_surf_r     accumulated surface ratio associated to
  *                             each edge (or negative edge lengths in
  *                             degenerate cases)
+ * \param[in]   r_in           uniformly distributed values in [0, 1]
  * \param[out]  coords         coordinates of point in face
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_random_point_in_face(cs_lnum_t        n_vertices,
-                      const cs_lnum_t  vertex_ids[],
-                      const cs_real_t  vertex_coords[][3],
-                      const cs_real_t  face_center[3],
-                      const cs_real_t  acc_surf_r[],
-                      cs_real_t        coords[3])
+_point_in_face(cs_lnum_t        n_vertices,
+               const cs_lnum_t  vertex_ids[],
+               const cs_real_t  vertex_coords[][3],
+               const cs_real_t  face_center[3],
+               const cs_real_t  acc_surf_r[],
+               const cs_real_t  r_in[3],
+               cs_real_t        coords[3])
 {
   cs_lnum_t tri_id = 0;
-  cs_real_t r[3];
+  cs_real_t r[3] = {r_in[0], r_in[1], r_in[2]};
 
   /* determine triangle to choose */
 
-  cs_random_uniform(3, r);
-
   if (r[2] > 1) /* account for possible ? rounding errors */
     r[2] = 1;
 
@@ -282,6 +314,585 @@ _random_point_in_face(cs_lnum_t        n_vertices,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Position a point randomly on a given face
+ *
+ * If the face has one or more concave angles, the point will be assigned
+ * to a randomly determined edge.
+ *
+ * \param[in]   n_vertices     number of face vertices
+ * \param[in]   vertex_ids     ids of face vertices
+ * \param[in]   vertex_coords  vertex coordinates
+ * \param[in]   face_center    coordinates of face center
+ * \param[in]   acc_surf_r     accumulated surface ratio associated to
+ *                             each edge (or negative edge lengths in
+ *                             degenerate cases)
+ * \param[out]  coords         coordinates of point in face
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_random_point_in_face(cs_lnum_t        n_vertices,
+                      const cs_lnum_t  vertex_ids[],
+                      const cs_real_t  vertex_coords[][3],
+                      const cs_real_t  face_center[3],
+                      const cs_real_t  acc_surf_r[],
+                      cs_real_t        coords[3])
+{
+  cs_real_t r[3];
+  cs_random_uniform(3, r);
+
+  _point_in_face(n_vertices, vertex_ids, vertex_coords, face_center,
+                 acc_surf_r, r, coords);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Position a particle on a given boundary face, slightly inside
+ *        the adjacent cell.
+ *
+ * \param[in]   mesh        pointer to mesh
+ * \param[in]   fvq         pointer to mesh quantities
+ * \param[in]   face_id     boundary face id
+ * \param[in]   acc_surf_r  accumulated surface ratios of face
+ * \param[in]   r           uniformly distributed values in [0, 1]
+ * \param[out]  coords      particle coordinates
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_point_in_b_face(const cs_mesh_t             *mesh,
+                 const cs_mesh_quantities_t  *fvq,
+                 cs_lnum_t                    face_id,
+                 const cs_real_t              acc_surf_r[],
+                 const cs_real_t              r[3],
+                 cs_real_t                    coords[3])
+{
+  const double d_eps = 1e-3;
+
+  cs_lnum_t n_vertices =   mesh->b_face_vtx_idx[face_id+1]
+                         - mesh->b_face_vtx_idx[face_id];
+
+  const cs_lnum_t *vertex_ids =   mesh->b_face_vtx_lst
+                                + mesh->b_face_vtx_idx[face_id];
+
+  _point_in_face(n_vertices,
+                 vertex_ids,
+                 (const cs_real_3_t *)mesh->vtx_coord,
+                 fvq->b_face_cog + 3*face_id,
+                 acc_surf_r,
+                 r,
+                 coords);
+
+  /* For safety, move particle slightly inside cell */
+
+  cs_lnum_t c_id = mesh->b_face_cells[face_id];
+  const cs_real_t *c_cen = fvq->cell_cen + c_id*3;
+
+  for (cs_lnum_t j = 0; j < 3; j++)
+    coords[j] += (c_cen[j] - coords[j])*d_eps;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return number of faces of a cell.
+ *
+ * \param[in]  ma       pointer to mesh adjacencies
+ * \param[in]  cell_id  cell id
+ *
+ * \return  number of cell faces
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_n_cell_faces(const cs_mesh_adjacencies_t  *ma,
+              cs_lnum_t                     cell_id)
+{
+  cs_lnum_t n_cell_faces =   ma->cell_cells_idx[cell_id+1]
+                           - ma->cell_cells_idx[cell_id]
+                           + ma->cell_b_faces_idx[cell_id+1]
+                           - ma->cell_b_faces_idx[cell_id];
+
+  if (ma->cell_hb_faces_idx != NULL) {
+    n_cell_faces +=   ma->cell_hb_faces_idx[cell_id+1]
+                    - ma->cell_hb_faces_idx[cell_id];
+  }
+
+  return n_cell_faces;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return vertices and center of the i-th face of a cell.
+ *
+ * \param[in]   mesh        pointer to mesh
+ * \param[in]   fvq         pointer to mesh quantities
+ * \param[in]   ma          pointer to mesh adjacencies
+ * \param[in]   cell_id     cell id
+ * \param[in]   i           face rank in cell (interior faces first)
+ * \param[out]  n_vertices  number of face vertices
+ * \param[out]  vertex_ids  ids of face vertices
+ * \param[out]  face_cog    face center
+ *
+ * \return  outward normal of face
+ */
+/*----------------------------------------------------------------------------*/
+
+static const cs_real_t *
+_cell_face(const cs_mesh_t               *mesh,
+           const cs_mesh_quantities_t    *fvq,
+           const cs_mesh_adjacencies_t   *ma,
+           cs_lnum_t                      cell_id,
+           cs_lnum_t                      i,
+           cs_lnum_t                     *n_vertices,
+           const cs_lnum_t              **vertex_ids,
+           const cs_real_t              **face_cog)
+{
+  const cs_lnum_t n_cell_i_faces =   ma->cell_cells_idx[cell_id+1]
+                                   - ma->cell_cells_idx[cell_id];
+  const cs_lnum_t n_cell_b_faces =   ma->cell_b_faces_idx[cell_id+1]
+                                   - ma->cell_b_faces_idx[cell_id];
+
+  if (i < n_cell_i_faces) { /* Interior face */
+
+    cs_lnum_t face_id = ma->cell_i_faces[ma->cell_cells_idx[cell_id] + i];
+
+    cs_lnum_t vtx_s = mesh->i_face_vtx_idx[face_id];
+    *n_vertices = mesh->i_face_vtx_idx[face_id+1] - vtx_s;
+    *vertex_ids = mesh->i_face_vtx_lst + vtx_s;
+    *face_cog = fvq->i_face_cog + (3*face_id);
+
+    return fvq->i_face_normal + (3*face_id);
+
+  }
+
+  /* Boundary faces */
+
+  cs_lnum_t face_id;
+  cs_lnum_t j = i - n_cell_i_faces;
+  if (j < n_cell_b_faces)
+    face_id = ma->cell_b_faces[ma->cell_b_faces_idx[cell_id] + j];
+
+  else {
+    assert(ma->cell_hb_faces_idx != NULL);
+    j -= n_cell_b_faces;
+    face_id = ma->cell_hb_faces[ma->cell_hb_faces_idx[cell_id] + j];
+  }
+
+  cs_lnum_t vtx_s = mesh->b_face_vtx_idx[face_id];
+  *n_vertices = mesh->b_face_vtx_idx[face_id+1] - vtx_s;
+  *vertex_ids = mesh->b_face_vtx_lst + vtx_s;
+  *face_cog = fvq->b_face_cog + (3*face_id);
+
+  return fvq->b_face_normal + (3*face_id);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return total number of face vertices of a cell.
+ *
+ * \param[in]  mesh          pointer to mesh
+ * \param[in]  fvq           pointer to mesh quantities
+ * \param[in]  ma            pointer to mesh adjacencies
+ * \param[in]  cell_id       cell id
+ * \param[in]  n_cell_faces  number of cell faces
+ *
+ * \return  number of center-to-edge sub-triangles of cell faces
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_n_cell_sub_faces(const cs_mesh_t              *mesh,
+                  const cs_mesh_quantities_t   *fvq,
+                  const cs_mesh_adjacencies_t  *ma,
+                  cs_lnum_t                     cell_id,
+                  cs_lnum_t                     n_cell_faces)
+{
+  cs_lnum_t n_sub = 0;
+
+  for (cs_lnum_t i = 0; i < n_cell_faces; i++) {
+    cs_lnum_t n_vertices;
+    const cs_lnum_t *vertex_ids;
+    const cs_real_t *face_cog;
+    _cell_face(mesh, fvq, ma, cell_id, i, &n_vertices, &vertex_ids, &face_cog);
+    n_sub += n_vertices;
+  }
+
+  return n_sub;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Determine accumulated volumes of the center-to-face cones
+ *        of a cell, and accumulated surfaces of its faces.
+ *
+ * cell_subface_index[0] must be set by the caller, and acc_surf_r must
+ * be large enough for cell_subface_index[0] + the number of cell face
+ * vertices (see \ref _n_cell_sub_faces).
+ *
+ * \param[in]       mesh                pointer to mesh
+ * \param[in]       fvq                 pointer to mesh quantities
+ * \param[in]       ma                  pointer to mesh adjacencies
+ * \param[in]       cell_id             cell id
+ * \param[in]       n_cell_faces        number of cell faces
+ * \param[in, out]  cell_subface_index  start of each face's values in
+ *                                      acc_surf_r (size: n_cell_faces + 1)
+ * \param[out]      acc_vol_r           accumulated volume ratio of
+ *                                      each face cone
+ * \param[out]      acc_surf_r          accumulated surface ratios
+ *
+ * \return  true if cell is not star-shaped relative to its center,
+ *          so a fallback distribution must be used
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_cell_sub_volumes(const cs_mesh_t               *mesh,
+                  const cs_mesh_quantities_t    *fvq,
+                  const cs_mesh_adjacencies_t   *ma,
+                  cs_lnum_t                      cell_id,
+                  cs_lnum_t                      n_cell_faces,
+                  cs_lnum_t                      cell_subface_index[],
+                  cs_real_t                      acc_vol_r[],
+                  cs_real_t                      acc_surf_r[])
+{
+  const double w_eps = 1e-24;
+
+  const cs_real_t *cell_cen = fvq->cell_cen + cell_id*3;
+
+  const cs_lnum_t n_cell_i_faces =   ma->cell_cells_idx[cell_id+1]
+                                   - ma->cell_cells_idx[cell_id];
+
+  /* Loop on cell faces to determine volumes */
+
+  bool fallback = false;
+  cs_real_t t_vol = 0;
+
+  for (cs_lnum_t i = 0; i < n_cell_faces; i++) {
+
+    cs_lnum_t n_vertices;
+    const cs_lnum_t *vertex_ids;
+    const cs_real_t *face_cog;
+
+    const cs_real_t *face_normal
+      = _cell_face(mesh, fvq, ma, cell_id, i,
+                   &n_vertices, &vertex_ids, &face_cog);
+
+    /* Outward normal: always well oriented for external faces,
+       depend on the connectivity for internal faces */
+
+    cs_real_t v_mult = 1;
+
+    if (i < n_cell_i_faces) {
+      cs_lnum_t face_id = ma->cell_i_faces[ma->cell_cells_idx[cell_id] + i];
+      if (cell_id == mesh->i_face_cells[face_id][1])
+        v_mult = -1;
+    }
+
+    cell_subface_index[i+1] = cell_subface_index[i] + n_vertices;
+
+    cs_real_t f_surf
+      = _face_sub_surfaces(n_vertices,
+                           vertex_ids,
+                           (const cs_real_3_t *)mesh->vtx_coord,
+                           face_cog,
+                           acc_surf_r + cell_subface_index[i]);
+
+    cs_real_t fh = 0;
+    if (f_surf > 0) {
+      /* face normal should have length f_surf, so no need to divide here */
+      for (cs_lnum_t j = 0; j < 3; j++)
+        fh += (face_cog[j] - cell_cen[j]) * face_normal[j];
+    }
+    fh *= v_mult;
+
+    t_vol += CS_ABS(fh);
+    acc_vol_r[i] = t_vol;
+
+    if (fh <= 0 || f_surf <= 0)
+      fallback = true;
+
+  }
+
+  if (t_vol >= w_eps) {
+    for (cs_lnum_t i = 0; i < n_cell_faces; i++)
+      acc_vol_r[i] /= t_vol;
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_cell_faces; i++)
+      acc_vol_r[i] = 1;
+  }
+  acc_vol_r[n_cell_faces - 1] = 1;
+
+  /* If needed, apply fallback to all faces, as in non-convex cases,
+     some cones may be partially masked by inverted cones;
+     weight is not based strictly on edge length in this case,
+     but bias cannot be avoid in this mode anyways, so do not bother
+     with extra steps. */
+
+  if (fallback) {
+    for (cs_lnum_t i = cell_subface_index[0];
+         i < cell_subface_index[n_cell_faces];
+         i++) {
+      if (acc_surf_r[i] > 0)
+        acc_surf_r[i] *= -1;
+    }
+  }
+
+  return fallback;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Position a point in a given cell based on given random values
+ *
+ * \param[in]   mesh                pointer to mesh
+ * \param[in]   fvq                 pointer to mesh quantities
+ * \param[in]   ma                  pointer to mesh adjacencies
+ * \param[in]   cell_id             cell id
+ * \param[in]   n_cell_faces        number of cell faces
+ * \param[in]   cell_subface_index  start of each face's values in acc_surf_r
+ * \param[in]   acc_vol_r           accumulated volume ratio of face cones
+ * \param[in]   acc_surf_r          accumulated surface ratios
+ * \param[in]   fallback            true if cell is not star-shaped
+ * \param[in]   r                   uniformly distributed values in [0, 1]
+ *                                  for cone selection and position
+ * \param[in]   r_f                 uniformly distributed values in [0, 1]
+ *                                  for position on face
+ * \param[out]  coords              coordinates of point in cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_point_in_cell(const cs_mesh_t               *mesh,
+               const cs_mesh_quantities_t    *fvq,
+               const cs_mesh_adjacencies_t   *ma,
+               cs_lnum_t                      cell_id,
+               cs_lnum_t                      n_cell_faces,
+               const cs_lnum_t                cell_subface_index[],
+               const cs_real_t                acc_vol_r[],
+               const cs_real_t                acc_surf_r[],
+               bool                           fallback,
+               const cs_real_t                r[2],
+               const cs_real_t                r_f[3],
+               cs_real_t                      coords[3])
+{
+  const double d_eps = 1e-3;
+
+  const cs_real_t *cell_cen = fvq->cell_cen + cell_id*3;
+
+  /* search for matching center-to-face cone */
+
+  cs_lnum_t i = 0;
+  while (i < n_cell_faces && r[0] > acc_vol_r[i])
+    i++;
+
+  cs_lnum_t n_vertices;
+  const cs_lnum_t *vertex_ids;
+  const cs_real_t *face_cog;
+
+  _cell_face(mesh, fvq, ma, cell_id, i, &n_vertices, &vertex_ids, &face_cog);
+
+  _point_in_face(n_vertices,
+                 vertex_ids,
+                 (const cs_real_3_t *)mesh->vtx_coord,
+                 face_cog,
+                 acc_surf_r + cell_subface_index[i],
+                 r_f,
+                 coords);
+
+  /* In regular case, place point on segment joining cell center and
+     point in cell; volume of truncated cone proportional to
+     cube of distance along segment, so distribution compensates for this */
+
+  if (fallback == false) {
+
+    cs_real_t t = pow(r[1], 1./3.) * (1.0 - d_eps);
+    for (cs_lnum_t j = 0; j < 3; j++)
+      coords[j] += (cell_cen[j] - coords[j]) * (1. - t);
+  }
+
+  /* Move particle slightly towards cell center cell
+     (assuming cell is star-shaped) */
+
+  else {
+    if (fvq->cell_vol[cell_id] > 0) {
+      for (cs_lnum_t j = 0; j < 3; j++)
+        coords[j] += (cell_cen[j] - coords[j])*d_eps;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a placement table.
+ *
+ * \param[in, out]  t  pointer to placement table
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_placement_table_free(cs_lagr_new_table_t  *t)
+{
+  BFT_FREE(t->sub_idx);
+  BFT_FREE(t->cf_sub_idx);
+  BFT_FREE(t->acc_vol_r);
+  BFT_FREE(t->fallback);
+  BFT_FREE(t->acc_surf_r);
+
+  t->n_elts = 0;
+  t->elt_ids = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a placement table for a given set of boundary faces or cells.
+ *
+ * \param[in, out]  t         pointer to placement table
+ * \param[in]       n_elts    number of elements in zone
+ * \param[in]       elt_ids   ids of elements in zone, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_placement_table_build(cs_lagr_new_table_t  *t,
+                       cs_lnum_t             n_elts,
+                       const cs_lnum_t       elt_ids[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq  = cs_glob_mesh_quantities;
+
+  _placement_table_free(t);
+
+  t->n_elts = n_elts;
+  t->elt_ids = elt_ids;
+
+  BFT_MALLOC(t->sub_idx, n_elts+1, cs_lnum_t);
+  t->sub_idx[0] = 0;
+
+  /* Boundary faces: sub-surfaces of each face */
+
+  if (t->location_id == CS_MESH_LOCATION_BOUNDARY_FACES) {
+
+    for (cs_lnum_t li = 0; li < n_elts; li++) {
+      const cs_lnum_t face_id = (elt_ids != NULL) ? elt_ids[li] : li;
+      t->sub_idx[li+1] =   t->sub_idx[li]
+                         + mesh->b_face_vtx_idx[face_id+1]
+                         - mesh->b_face_vtx_idx[face_id];
+    }
+
+    BFT_MALLOC(t->acc_surf_r, t->sub_idx[n_elts], cs_real_t);
+
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t li = 0; li < n_elts; li++) {
+      const cs_lnum_t face_id = (elt_ids != NULL) ? elt_ids[li] : li;
+      const cs_lnum_t s_id = mesh->b_face_vtx_idx[face_id];
+      _face_sub_surfaces(mesh->b_face_vtx_idx[face_id+1] - s_id,
+                         mesh->b_face_vtx_lst + s_id,
+                         (const cs_real_3_t *)mesh->vtx_coord,
+                         fvq->b_face_cog + 3*face_id,
+                         t->acc_surf_r + t->sub_idx[li]);
+    }
+
+  }
+
+  /* Cells: sub-volumes of cell face cones and sub-surfaces of faces;
+     sub_idx is the index of cell faces, and cf_sub_idx the index of
+     cell face sub-surfaces. */
+
+  else {
+
+    const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+
+    cs_lnum_t *n_sub;
+    BFT_MALLOC(n_sub, n_elts+1, cs_lnum_t);
+    n_sub[0] = 0;
+
+    for (cs_lnum_t li = 0; li < n_elts; li++) {
+      const cs_lnum_t cell_id = (elt_ids != NULL) ? elt_ids[li] : li;
+      const cs_lnum_t n_cell_faces = _n_cell_faces(ma, cell_id);
+      t->sub_idx[li+1] = t->sub_idx[li] + n_cell_faces;
+      n_sub[li+1] = n_sub[li] + _n_cell_sub_faces(mesh, fvq, ma, cell_id,
+                                                  n_cell_faces);
+    }
+
+    BFT_MALLOC(t->cf_sub_idx, t->sub_idx[n_elts]+1, cs_lnum_t);
+    BFT_MALLOC(t->acc_vol_r, t->sub_idx[n_elts], cs_real_t);
+    BFT_MALLOC(t->fallback, n_elts, bool);
+    BFT_MALLOC(t->acc_surf_r, n_sub[n_elts], cs_real_t);
+
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t li = 0; li < n_elts; li++) {
+      const cs_lnum_t cell_id = (elt_ids != NULL) ? elt_ids[li] : li;
+      const cs_lnum_t s_id = t->sub_idx[li];
+      t->cf_sub_idx[s_id] = n_sub[li];
+      t->fallback[li] = _cell_sub_volumes(mesh, fvq, ma, cell_id,
+                                          t->sub_idx[li+1] - s_id,
+                                          t->cf_sub_idx + s_id,
+                                          t->acc_vol_r + s_id,
+                                          t->acc_surf_r);
+    }
+
+    BFT_FREE(n_sub);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return placement table for a given zone, building it if needed.
+ *
+ * \param[in]  location_id  mesh location id
+ * \param[in]  zone_id      zone id
+ * \param[in]  n_elts       number of elements in zone
+ * \param[in]  elt_ids      ids of elements in zone, or NULL
+ *
+ * \return  pointer to placement table
+ */
+/*----------------------------------------------------------------------------*/
+
+static const cs_lagr_new_table_t *
+_placement_table(int               location_id,
+                 int               zone_id,
+                 cs_lnum_t         n_elts,
+                 const cs_lnum_t   elt_ids[])
+{
+  cs_lagr_new_table_t *t = NULL;
+
+  for (int i = 0; i < _n_placement_tables; i++) {
+    if (   _placement_tables[i].location_id == location_id
+        && _placement_tables[i].zone_id == zone_id) {
+      t = _placement_tables + i;
+      break;
+    }
+  }
+
+  if (t == NULL) {
+    BFT_REALLOC(_placement_tables, _n_placement_tables + 1,
+                cs_lagr_new_table_t);
+    t = _placement_tables + _n_placement_tables;
+    _n_placement_tables += 1;
+
+    t->location_id = location_id;
+    t->zone_id = zone_id;
+    t->n_elts = -1;
+    t->elt_ids = NULL;
+    t->sub_idx = NULL;
+    t->cf_sub_idx = NULL;
+    t->acc_vol_r = NULL;
+    t->fallback = NULL;
+    t->acc_surf_r = NULL;
+  }
+
+  /* (Re)build if zone definition has changed */
+
+  if (t->n_elts != n_elts || t->elt_ids != elt_ids)
+    _placement_table_build(t, n_elts, elt_ids);
+
+  return t;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -308,8 +919,6 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
             const cs_lnum_t          face_ids[],
             const cs_lnum_t          face_particle_idx[])
 {
-  const double d_eps = 1e-3;
-
   cs_mesh_t  *mesh = cs_glob_mesh;
   cs_mesh_quantities_t *fvq  = cs_glob_mesh_quantities;
 
@@ -349,7 +958,6 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
     /* distribute new particles */
 
     cs_lnum_t c_id = mesh->b_face_cells[face_id];
-    const cs_real_t *c_cen = fvq->cell_cen + c_id*3;
 
     for (cs_lnum_t i = 0; i < n_f_p; i++) {
 
@@ -360,17 +968,10 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
       cs_real_t *part_coord
         = cs_lagr_particles_attr_get_ptr<cs_real_t>(particles, p_id, CS_LAGR_COORDS);
 
-      _random_point_in_face(n_vertices,
-                            vertex_ids,
-                            (const cs_real_3_t *)mesh->vtx_coord,
-                            fvq->b_face_cog + 3*face_id,
-                            acc_surf_r,
-                            part_coord);
+      cs_real_t r[3];
+      cs_random_uniform(3, r);
 
-      /* For safety, move particle slightly inside cell */
-
-      for (cs_lnum_t j = 0; j < 3; j++)
-        part_coord[j] += (c_cen[j] - part_coord[j])*d_eps;
+      _point_in_b_face(mesh, fvq, face_id, acc_surf_r, r, part_coord);
 
     }
 
@@ -401,9 +1002,6 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
               const cs_lnum_t          cell_ids[],
               const cs_lnum_t          cell_particle_idx[])
 {
-  const double w_eps = 1e-24;
-  const double d_eps = 1e-3;
-
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t *fvq  = cs_glob_mesh_quantities;
 
@@ -429,20 +1027,7 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
 
     const cs_lnum_t cell_id = (cell_ids != NULL) ? cell_ids[li] : li;
 
-    const cs_real_t *cell_cen = fvq->cell_cen + cell_id*3;
-
-
-    const cs_lnum_t n_cell_i_faces =   ma->cell_cells_idx[cell_id+1]
-                                     - ma->cell_cells_idx[cell_id];
-    const cs_lnum_t n_cell_b_faces =   ma->cell_b_faces_idx[cell_id+1]
-                                     - ma->cell_b_faces_idx[cell_id];
-
-    cs_lnum_t n_cell_faces = n_cell_i_faces + n_cell_b_faces;
-
-    if (ma->cell_hb_faces_idx != NULL) {
-      n_cell_faces +=   ma->cell_hb_faces_idx[cell_id+1]
-                      - ma->cell_hb_faces_idx[cell_id];
-    }
+    const cs_lnum_t n_cell_faces = _n_cell_faces(ma, cell_id);
 
     if (n_cell_faces > n_faces_max) {
       n_faces_max = n_cell_faces*2;
@@ -450,109 +1035,20 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
       BFT_REALLOC(acc_vol_r, n_faces_max, cs_real_t);
     }
 
-    cell_subface_index[0] = 0;
-
-    /* Loop on cell faces to determine volumes */
-
-    bool fallback = false;
-    cs_real_t t_vol = 0;
-
-    for (cs_lnum_t i = 0; i < n_cell_faces; i++) {
-
-      cs_lnum_t face_id, n_vertices;
-      const cs_lnum_t *vertex_ids;
-      const cs_real_t *face_cog, *face_normal;
-
-      /* Outward normal: always well oriented for external faces,
-         depend on the connectivity for internal faces */
-
-      cs_real_t v_mult = 1;
-
-      if (i < n_cell_i_faces) { /* Interior face */
-
-        face_id = ma->cell_i_faces[ma->cell_cells_idx[cell_id] + i];
-
-        if (cell_id == mesh->i_face_cells[face_id][1])
-          v_mult = -1;
-        cs_lnum_t vtx_s = mesh->i_face_vtx_idx[face_id];
-        n_vertices = mesh->i_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->i_face_vtx_lst + vtx_s;
-        face_cog = fvq->i_face_cog + (3*face_id);
-        face_normal = fvq->i_face_normal + (3*face_id);
-
-      }
-      else { /* Boundary faces */
-
-        cs_lnum_t j = i - n_cell_i_faces;
-        if (j < n_cell_b_faces)
-          face_id = ma->cell_b_faces[ma->cell_b_faces_idx[cell_id] + j];
-
-        else {
-          assert(ma->cell_hb_faces_idx != NULL);
-          j -= n_cell_b_faces;
-          face_id = ma->cell_hb_faces[ma->cell_hb_faces_idx[cell_id] + j];
-        }
-
-        cs_lnum_t vtx_s = mesh->b_face_vtx_idx[face_id];
-        n_vertices = mesh->b_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->b_face_vtx_lst + vtx_s;
-        face_cog = fvq->b_face_cog + (3*face_id);
-        face_normal = fvq->b_face_normal + (3*face_id);
-
-      }
-
-      cell_subface_index[i+1] = cell_subface_index[i] + n_vertices;
-
-      if (cell_subface_index[i+1] > n_divisions_max) {
-        n_divisions_max = cell_subface_index[i+1]*2;
-        BFT_REALLOC(acc_surf_r, n_divisions_max, cs_real_t);
-      }
-
-      cs_real_t f_surf
-        = _face_sub_surfaces(n_vertices,
-                             vertex_ids,
-                             (const cs_real_3_t *)mesh->vtx_coord,
-                             face_cog,
-                             acc_surf_r + cell_subface_index[i]);
-
-      cs_real_t fh = 0;
-      if (f_surf > 0) {
-        /* face normal should have length f_surf, so no need to divide here */
-        for (cs_lnum_t j = 0; j < 3; j++)
-          fh += (face_cog[j] - cell_cen[j]) * face_normal[j];
-      }
-      fh *= v_mult;
-
-      t_vol += CS_ABS(fh);
-      acc_vol_r[i] = t_vol;
-
-      if (fh <= 0 || f_surf <= 0)
-        fallback = true;
+    cs_lnum_t n_divisions = _n_cell_sub_faces(mesh, fvq, ma, cell_id,
+                                              n_cell_faces);
 
+    if (n_divisions > n_divisions_max) {
+      n_divisions_max = n_divisions*2;
+      BFT_REALLOC(acc_surf_r, n_divisions_max, cs_real_t);
     }
 
-    if (t_vol >= w_eps) {
-      for (cs_lnum_t i = 0; i < n_cell_faces; i++)
-        acc_vol_r[i] /= t_vol;
-    }
-    else {
-      for (cs_lnum_t i = 0; i < n_cell_faces; i++)
-        acc_vol_r[i] = 1;
-    }
-    acc_vol_r[n_cell_faces - 1] = 1;
-
-    /* If needed, apply fallback to all faces, as in non-convex cases,
-       some cones may be partially masked by inverted cones;
-       weight is not based strictly on edge length in this case,
-       but bias cannot be avoid in this mode anyways, so do not bother
-       with extra steps. */
-
-    if (fallback) {
-      for (cs_lnum_t i = 0; i < cell_subface_index[n_cell_faces]; i++) {
-        if (acc_surf_r[i] > 0)
-          acc_surf_r[i] *= -1;
-      }
-    }
+    cell_subface_index[0] = 0;
+
+    bool fallback = _cell_sub_volumes(mesh, fvq, ma, cell_id, n_cell_faces,
+                                      cell_subface_index,
+                                      acc_vol_r,
+                                      acc_surf_r);
 
     /* distribute new particles */
 
@@ -565,83 +1061,129 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
       cs_real_t *part_coord
         = cs_lagr_particles_attr_get_ptr<cs_real_t>(particles, p_id, CS_LAGR_COORDS);
 
-      /* search for matching center-to-face cone */
-
-      cs_real_t r[2];
+      cs_real_t r[2], r_f[3];
       cs_random_uniform(2, r);
+      cs_random_uniform(3, r_f);
 
-      cs_lnum_t i = 0;
-      while (i < n_cell_faces && r[0] > acc_vol_r[i])
-        i++;
-
-      cs_lnum_t face_id, n_vertices;
-      const cs_lnum_t *vertex_ids;
-      const cs_real_t *face_cog;
+      _point_in_cell(mesh, fvq, ma, cell_id, n_cell_faces,
+                     cell_subface_index, acc_vol_r, acc_surf_r,
+                     fallback, r, r_f, part_coord);
 
-      if (i < n_cell_i_faces) { /* Interior face */
+    } /* end of loop on new particles */
 
-        face_id = ma->cell_i_faces[ma->cell_cells_idx[cell_id] + i];
+  } /* end of loop on cells */
 
-        cs_lnum_t vtx_s = mesh->i_face_vtx_idx[face_id];
-        n_vertices = mesh->i_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->i_face_vtx_lst + vtx_s;
-        face_cog = fvq->i_face_cog + (3*face_id);
+  BFT_FREE(acc_surf_r);
+  BFT_FREE(acc_vol_r);
+  BFT_FREE(cell_subface_index);
+}
 
-      }
-      else { /* Boundary faces */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Inject a series of particles at random positions on given faces
+ *        or cells, in bulk mode.
+ *
+ * Placement tables (accumulated sub-surfaces of faces, and sub-volumes of
+ * cells) are computed on first use for a given zone and reused afterwards.
+ * Particles are then placed in parallel, using counter-based random
+ * numbers: the i-th particle of the injection uses values at positions
+ * offset + 6*i to offset + 6*i + 5 of the given stream, so results do not
+ * depend on the number of threads.
+ *
+ * \param[in,out]  particles         pointer to particle set
+ * \param[in]      location_id       mesh location id (boundary faces or cells)
+ * \param[in]      zone_id           zone id
+ * \param[in]      n_elts            number of elements in zone
+ * \param[in]      elt_ids           ids of elements in zone, or NULL
+ * \param[in]      elt_particle_idx  starting index of added particles
+ *                                   for each element in zone
+ * \param[in]      rng_stream        counter-based random number stream
+ * \param[in]      rng_offset        position of first random number in
+ *                                   stream (must be even)
+ */
+/*----------------------------------------------------------------------------*/
 
-        cs_lnum_t j = i - n_cell_i_faces;
-        if (j < n_cell_b_faces)
-          face_id = ma->cell_b_faces[ma->cell_b_faces_idx[cell_id] + j];
+void
+cs_lagr_new_bulk(cs_lagr_particle_set_t  *particles,
+                 int                      location_id,
+                 int                      zone_id,
+                 cs_lnum_t                n_elts,
+                 const cs_lnum_t          elt_ids[],
+                 const cs_lnum_t          elt_particle_idx[],
+                 uint64_t                 rng_stream,
+                 uint64_t                 rng_offset)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t *fvq  = cs_glob_mesh_quantities;
 
-        else {
-          assert(ma->cell_hb_faces_idx != NULL);
-          j -= n_cell_b_faces;
-          face_id = ma->cell_hb_faces[ma->cell_hb_faces_idx[cell_id] + j];
-        }
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  if (   location_id != CS_MESH_LOCATION_BOUNDARY_FACES
+      && ma->cell_i_faces == NULL)
+    cs_mesh_adjacencies_update_cell_i_faces();
 
-        cs_lnum_t vtx_s = mesh->b_face_vtx_idx[face_id];
-        n_vertices = mesh->b_face_vtx_idx[face_id+1] - vtx_s;
-        vertex_ids = mesh->b_face_vtx_lst + vtx_s;
-        face_cog = fvq->b_face_cog + (3*face_id);
+  const cs_lagr_new_table_t *t
+    = _placement_table(location_id, zone_id, n_elts, elt_ids);
 
-      }
+  const uint64_t key = cs_random_counter_key();
+  const uint64_t b_s = rng_offset / 2;
+  const cs_lnum_t n_p = elt_particle_idx[n_elts];
 
-      _random_point_in_face(n_vertices,
-                            vertex_ids,
-                            (const cs_real_3_t *)mesh->vtx_coord,
-                            face_cog,
-                            acc_surf_r + cell_subface_index[i],
-                            part_coord);
+# pragma omp parallel for schedule(dynamic, CS_THR_MIN) \
+                          if (n_p > CS_THR_MIN)
+  for (cs_lnum_t li = 0; li < n_elts; li++) {
 
-      /* In regular case, place point on segment joining cell center and
-         point in cell; volume of truncated cone proportional to
-         cube of distance along segment, so distribution compensates for this */
+    const cs_lnum_t elt_id = (elt_ids != NULL) ? elt_ids[li] : li;
 
-      if (fallback == false) {
+    for (cs_lnum_t i = elt_particle_idx[li]; i < elt_particle_idx[li+1]; i++) {
 
-        cs_real_t t = pow(r[1], 1./3.) * (1.0 - d_eps);
-        for (cs_lnum_t j = 0; j < 3; j++)
-          part_coord[j] += (cell_cen[j] - part_coord[j]) * (1. - t);
-      }
+      cs_lnum_t p_id = particles->n_particles + i;
 
-      /* Move particle slightly towards cell center cell
-         (assuming cell is star-shaped) */
+      cs_real_t r[6];
+      for (int k = 0; k < 3; k++)
+        cs_random_counter_uniform2(key, rng_stream, b_s + 3*i + k, r + 2*k);
 
+      cs_real_t *part_coord
+        = cs_lagr_particles_attr_get_ptr<cs_real_t>(particles, p_id,
+                                                    CS_LAGR_COORDS);
+
+      if (location_id == CS_MESH_LOCATION_BOUNDARY_FACES) {
+        cs_lagr_particles_set_lnum(particles, p_id, CS_LAGR_CELL_ID,
+                                   mesh->b_face_cells[elt_id]);
+        _point_in_b_face(mesh, fvq, elt_id, t->acc_surf_r + t->sub_idx[li],
+                         r, part_coord);
+      }
       else {
-        if (fvq->cell_vol[cell_id] > 0) {
-          for (cs_lnum_t j = 0; j < 3; j++)
-            part_coord[j] += (cell_cen[j] - part_coord[j])*d_eps;
-        }
+        const cs_lnum_t s_id = t->sub_idx[li];
+        cs_lagr_particles_set_lnum(particles, p_id, CS_LAGR_CELL_ID, elt_id);
+        _point_in_cell(mesh, fvq, ma, elt_id,
+                       t->sub_idx[li+1] - s_id,
+                       t->cf_sub_idx + s_id,
+                       t->acc_vol_r + s_id,
+                       t->acc_surf_r,
+                       t->fallback[li],
+                       r, r + 2,
+                       part_coord);
       }
 
-    } /* end of loop on new particles */
+    }
 
-  } /* end of loop on cells */
+  }
+}
 
-  BFT_FREE(acc_surf_r);
-  BFT_FREE(acc_vol_r);
-  BFT_FREE(cell_subface_index);
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free placement tables used for bulk injection.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_new_finalize(void)
+{
+  for (int i = 0; i < _n_placement_tables; i++)
+    _placement_table_free(_placement_tables + i);
+
+  BFT_FREE(_placement_tables);
+  _n_placement_tables = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -97,6 +97,50 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
               const cs_lnum_t          cell_ids[],
               const cs_lnum_t          cell_particle_idx[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Inject a series of particles at random positions on given faces
+ *        or cells, in bulk mode.
+ *
+ * Placement tables (accumulated sub-surfaces of faces, and sub-volumes of
+ * cells) are computed on first use for a given zone and reused afterwards.
+ * Particles are then placed in parallel, using counter-based random
+ * numbers: the i-th particle of the injection uses values at positions
+ * offset + 6*i to offset + 6*i + 5 of the given stream, so results do not
+ * depend on the number of threads.
+ *
+ * \param[in,out]  particles         pointer to particle set
+ * \param[in]      location_id       mesh location id (boundary faces or cells)
+ * \param[in]      zone_id           zone id
+ * \param[in]      n_elts            number of elements in zone
+ * \param[in]      elt_ids           ids of elements in zone, or NULL
+ * \param[in]      elt_particle_idx  starting index of added particles
+ *                                   for each element in zone
+ * \param[in]      rng_stream        counter-based random number stream
+ * \param[in]      rng_offset        position of first random number in
+ *                                   stream (must be even)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_new_bulk(cs_lagr_particle_set_t  *particles,
+                 int                      location_id,
+                 int                      zone_id,
+                 cs_lnum_t                n_elts,
+                 const cs_lnum_t          elt_ids[],
+                 const cs_lnum_t          elt_particle_idx[],
+                 uint64_t                 rng_stream,
+                 uint64_t                 rng_offset);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free placement tables used for bulk injection.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_new_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialization for new particles.
@@ -51,7 +51,9 @@
 #include "fvm_periodicity.h"
 
 #include "cs_base.h"
+#include "cs_base_accel.h"
 #include "cs_math.h"
+#include "cs_mesh.h"
 #include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_random.h"
@@ -500,7 +502,10 @@ _create_particle_set(cs_lnum_t                       n_particles_max,
 
   BFT_MALLOC(new_set, 1, cs_lagr_particle_set_t);
 
-  BFT_MALLOC(new_set->p_buffer, n_particles_max * p_am->extents, unsigned char);
+  /* Particle data may be accessed on device for tracking */
+
+  CS_MALLOC_HD(new_set->p_buffer, n_particles_max * p_am->extents,
+               unsigned char, cs_alloc_mode);
 
   new_set->n_particles = 0;
   new_set->n_part_new = 0;
@@ -522,6 +527,15 @@ _create_particle_set(cs_lnum_t                       n_particles_max,
 
   new_set->n_particles_max = n_particles_max;
 
+  new_set->n_soa_max = 0;
+  for (int time_id = 0; time_id < 2; time_id++) {
+    for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++)
+      new_set->p_soa[time_id][i] = NULL;
+  }
+
+  new_set->n_cell_sorted = 0;
+  new_set->cell_p_idx = NULL;
+
   assert(n_particles_max >= 1);
 
   new_set->p_am = p_am;
@@ -542,7 +556,10 @@ _destroy_particle_set(cs_lagr_particle_set_t **set)
   if (set != NULL) {
 
     cs_lagr_particle_set_t *_set = *set;
-    BFT_FREE(_set->p_buffer);
+    CS_FREE(_set->p_buffer);
+
+    cs_lagr_particles_soa_free(_set);
+    BFT_FREE(_set->cell_p_idx);
 
     BFT_FREE(*set);
   }
@@ -652,9 +669,9 @@ _particle_set_resize(cs_lagr_particle_set_t   *particle_set,
     while (particle_set->n_particles_max < n_particles_max_min)
       particle_set->n_particles_max *= _reallocation_factor;
 
-    BFT_REALLOC(particle_set->p_buffer,
-                particle_set->n_particles_max * particle_set->p_am->extents,
-                unsigned char);
+    CS_REALLOC_HD(particle_set->p_buffer,
+                  particle_set->n_particles_max * particle_set->p_am->extents,
+                  unsigned char, cs_alloc_mode);
 
     retval = 1;
   }
@@ -1339,6 +1356,210 @@ cs_lagr_particle_set_dump(const cs_lagr_particle_set_t  *particles)
   bft_printf_flush();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute for all particles of a set to
+ *        a contiguous array (structure of arrays layout).
+ *
+ * The array is owned by the particle set, and remains valid until
+ * \ref cs_lagr_particles_soa_free is called. It is interleaved for
+ * multicomponent attributes, and is not updated automatically: if values
+ * are modified, they must be copied back to the particle set using
+ * \ref cs_lagr_particles_soa_scatter before any record-based access.
+ *
+ * This allows loops over particles operating on a few attributes to
+ * access memory contiguously, so as to vectorize.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ * \param[in]       time_id       0 for current, 1 for previous
+ * \param[in]       attr          requested attribute id
+ *
+ * \return  pointer to contiguous attribute values, or NULL if the
+ *          attribute is not present
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_lagr_particles_soa_gather(cs_lagr_particle_set_t  *particle_set,
+                             int                      time_id,
+                             cs_lagr_attribute_t      attr)
+{
+  const cs_lagr_attribute_map_t  *p_am = particle_set->p_am;
+
+  if (p_am->count[time_id][attr] < 1)
+    return NULL;
+
+  const cs_lnum_t n_particles = particle_set->n_particles;
+  const size_t size = p_am->size[attr];
+
+  /* Resize all arrays if needed, so that previously obtained
+     arrays keep the same values */
+
+  if (particle_set->n_soa_max < n_particles) {
+    particle_set->n_soa_max = particle_set->n_particles_max;
+    for (int t_id = 0; t_id < 2; t_id++) {
+      for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++) {
+        if (particle_set->p_soa[t_id][i] != NULL)
+          BFT_REALLOC(particle_set->p_soa[t_id][i],
+                      particle_set->n_soa_max * p_am->size[i],
+                      unsigned char);
+      }
+    }
+  }
+
+  if (particle_set->p_soa[time_id][attr] == NULL)
+    BFT_MALLOC(particle_set->p_soa[time_id][attr],
+               particle_set->n_soa_max * size,
+               unsigned char);
+
+  unsigned char *vals = particle_set->p_soa[time_id][attr];
+  const unsigned char *src = particle_set->p_buffer + p_am->displ[time_id][attr];
+  const size_t extents = p_am->extents;
+
+# pragma omp parallel for if (n_particles > CS_THR_MIN)
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++)
+    memcpy(vals + size*p_id, src + extents*p_id, size);
+
+  return vals;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute from its contiguous array
+ *        back to the particle set.
+ *
+ * The array must have been defined by \ref cs_lagr_particles_soa_gather.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ * \param[in]       time_id       0 for current, 1 for previous
+ * \param[in]       attr          requested attribute id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_soa_scatter(cs_lagr_particle_set_t  *particle_set,
+                              int                      time_id,
+                              cs_lagr_attribute_t      attr)
+{
+  const cs_lagr_attribute_map_t  *p_am = particle_set->p_am;
+
+  const unsigned char *vals = particle_set->p_soa[time_id][attr];
+
+  if (vals == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: no contiguous array defined for attribute %s."),
+              __func__, cs_lagr_attribute_name[attr]);
+
+  const cs_lnum_t n_particles = CS_MIN(particle_set->n_particles,
+                                       particle_set->n_soa_max);
+  const size_t size = p_am->size[attr];
+  unsigned char *dest = particle_set->p_buffer + p_am->displ[time_id][attr];
+  const size_t extents = p_am->extents;
+
+# pragma omp parallel for if (n_particles > CS_THR_MIN)
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++)
+    memcpy(dest + extents*p_id, vals + size*p_id, size);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free contiguous attribute arrays of a particle set.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_soa_free(cs_lagr_particle_set_t  *particle_set)
+{
+  for (int time_id = 0; time_id < 2; time_id++) {
+    for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++)
+      BFT_FREE(particle_set->p_soa[time_id][i]);
+  }
+
+  particle_set->n_soa_max = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort particles of a set by cell id, and build the associated
+ *        cell -> particles index.
+ *
+ * Particles of cell c_id are then those with ids in the range
+ * [cell_p_idx[c_id], cell_p_idx[c_id+1]), and their relative order is
+ * preserved.
+ *
+ * The index remains valid for the first n_cell_sorted particles of the
+ * set, as long as those are not moved: particles added later (for
+ * example by injection) are appended after the sorted range and must be
+ * handled separately, and particle tracking reduces n_cell_sorted to
+ * the start of the range of particles it displaces. Index values must
+ * thus be clipped to n_cell_sorted.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particle_set)
+{
+  const cs_lagr_attribute_map_t  *p_am = particle_set->p_am;
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_particles = particle_set->n_particles;
+
+  const size_t extents = p_am->extents;
+  const ptrdiff_t cell_id_displ = p_am->displ[0][CS_LAGR_CELL_ID];
+
+  const unsigned char *src = particle_set->p_buffer;
+
+  /* Cell index (count first) */
+
+  BFT_REALLOC(particle_set->cell_p_idx, n_cells+1, cs_lnum_t);
+  cs_lnum_t *cell_idx = particle_set->cell_p_idx;
+
+  for (cs_lnum_t i = 0; i < n_cells+1; i++)
+    cell_idx[i] = 0;
+
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+    cs_lnum_t cell_id
+      = *((const cs_lnum_t *)(src + extents*p_id + cell_id_displ));
+    assert(cell_id > -1 && cell_id < n_cells);
+    cell_idx[cell_id+1] += 1;
+  }
+
+  /* Convert count to index */
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_idx[i+1] += cell_idx[i];
+
+  assert(n_particles == cell_idx[n_cells]);
+
+  /* Copy particle data to a new buffer, in cell order */
+
+  cs_lnum_t *cell_shift;
+  BFT_MALLOC(cell_shift, n_cells, cs_lnum_t);
+  memcpy(cell_shift, cell_idx, n_cells*sizeof(cs_lnum_t));
+
+  unsigned char *p_buffer;
+  CS_MALLOC_HD(p_buffer, particle_set->n_particles_max * extents,
+               unsigned char, cs_alloc_mode);
+
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+    cs_lnum_t cell_id
+      = *((const cs_lnum_t *)(src + extents*p_id + cell_id_displ));
+    cs_lnum_t dest_id = cell_shift[cell_id];
+    cell_shift[cell_id] += 1;
+    memcpy(p_buffer + extents*dest_id, src + extents*p_id, extents);
+  }
+
+  BFT_FREE(cell_shift);
+
+  CS_FREE(particle_set->p_buffer);
+  particle_set->p_buffer = p_buffer;
+
+  particle_set->n_cell_sorted = n_particles;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set number of user particle variables.
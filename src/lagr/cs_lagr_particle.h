@@ -246,6 +246,21 @@ typedef struct {
                                                    (p_am + i for time n-i) */
   unsigned char                  *p_buffer;   /*!< Particles data buffer */
 
+  cs_lnum_t       n_soa_max;                  /*!< allocated size (in
+                                                   particles) of attribute
+                                                   arrays */
+  unsigned char  *p_soa[2][CS_LAGR_N_ATTRIBUTES];  /*!< contiguous copies of
+                                                        selected attributes
+                                                        (structure of arrays),
+                                                        per time_id, or NULL */
+
+  cs_lnum_t       n_cell_sorted;              /*!< number of particles (from
+                                                   start of set) sorted by cell
+                                                   and covered by cell_p_idx */
+  cs_lnum_t      *cell_p_idx;                 /*!< cell -> particles index of
+                                                   sorted particles (size:
+                                                   n_cells + 1), or NULL */
+
 } cs_lagr_particle_set_t;
 
 /*=============================================================================
@@ -1474,6 +1489,86 @@ cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
 void
 cs_lagr_particle_set_dump(const cs_lagr_particle_set_t  *particles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute for all particles of a set to
+ *        a contiguous array (structure of arrays layout).
+ *
+ * The array is owned by the particle set, and remains valid until
+ * \ref cs_lagr_particles_soa_free is called. It is interleaved for
+ * multicomponent attributes, and is not updated automatically: if values
+ * are modified, they must be copied back to the particle set using
+ * \ref cs_lagr_particles_soa_scatter before any record-based access.
+ *
+ * This allows loops over particles operating on a few attributes to
+ * access memory contiguously, so as to vectorize.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ * \param[in]       time_id       0 for current, 1 for previous
+ * \param[in]       attr          requested attribute id
+ *
+ * \return  pointer to contiguous attribute values, or NULL if the
+ *          attribute is not present
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_lagr_particles_soa_gather(cs_lagr_particle_set_t  *particle_set,
+                             int                      time_id,
+                             cs_lagr_attribute_t      attr);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy values of a given attribute from its contiguous array
+ *        back to the particle set.
+ *
+ * The array must have been defined by \ref cs_lagr_particles_soa_gather.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ * \param[in]       time_id       0 for current, 1 for previous
+ * \param[in]       attr          requested attribute id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_soa_scatter(cs_lagr_particle_set_t  *particle_set,
+                              int                      time_id,
+                              cs_lagr_attribute_t      attr);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free contiguous attribute arrays of a particle set.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_soa_free(cs_lagr_particle_set_t  *particle_set);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sort particles of a set by cell id, and build the associated
+ *        cell -> particles index.
+ *
+ * Particles of cell c_id are then those with ids in the range
+ * [cell_p_idx[c_id], cell_p_idx[c_id+1]), and their relative order is
+ * preserved.
+ *
+ * The index remains valid for the first n_cell_sorted particles of the
+ * set, as long as those are not moved: particles added later (for
+ * example by injection) are appended after the sorted range and must be
+ * handled separately, and particle tracking reduces n_cell_sorted to
+ * the start of the range of particles it displaces. Index values must
+ * thus be clipped to n_cell_sorted.
+ *
+ * \param[in, out]  particle_set  pointer to particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_sort_by_cell(cs_lagr_particle_set_t  *particle_set);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set number of user particle variables.
@@ -1605,6 +1700,17 @@ cs_lagr_particles_attr_n_set_val(cs_lagr_particle_set_t  *particle_set,
         + particle_set->p_am->displ[time_id][attr]) = value;
 }
 
+template <typename T>
+T *
+cs_lagr_particles_soa_get_ptr(cs_lagr_particle_set_t  *particle_set,
+                              int                      time_id,
+                              cs_lagr_attribute_t      attr)
+{
+  assert(particle_set->p_soa[time_id][attr] != NULL);
+
+  return (T *)(particle_set->p_soa[time_id][attr]);
+}
+
 template <typename T>
 T *
 cs_lagr_particle_attr_get_ptr(void                           *particle,
@@ -0,0 +1,481 @@
+/*============================================================================
+ * Particle population control (splitting and merging).
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_math.h"
+#include "cs_mesh.h"
+#include "cs_order.h"
+#include "cs_time_step.h"
+
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_population.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Gather free-flying particles of a cell and their weights.
+ *
+ * Particles which are deposited, fixed, or marked for deletion are ignored.
+ *
+ * \param[in]   p_set  pointer to particle set
+ * \param[in]   s_id   id of first particle in cell
+ * \param[in]   e_id   past-the-end id of particles in cell
+ * \param[out]  p_ids  ids of selected particles
+ * \param[out]  w      statistical weight of selected particles
+ *
+ * \return  number of selected particles
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_cell_particles(const cs_lagr_particle_set_t  *p_set,
+                cs_lnum_t                      s_id,
+                cs_lnum_t                      e_id,
+                cs_lnum_t                      p_ids[],
+                cs_real_t                      w[])
+{
+  cs_lnum_t n = 0;
+
+  for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++) {
+
+    if (cs_lagr_particles_get_flag(p_set, p_id,
+                                   CS_LAGR_PART_DEPOSITION_FLAGS))
+      continue;
+
+    cs_real_t p_w = cs_lagr_particles_get_real(p_set, p_id,
+                                               CS_LAGR_STAT_WEIGHT);
+    if (p_w <= 0.)
+      continue;
+
+    p_ids[n] = p_id;
+    w[n] = p_w;
+    n++;
+
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge two particles.
+ *
+ * The particle with the highest total mass (weight x mass) is kept, and
+ * the other one is marked for deletion. Velocities and temperatures are
+ * averaged based on total mass, and the diameter is updated so as to
+ * conserve mass at constant density.
+ *
+ * \param[in, out]  p_set  pointer to particle set
+ * \param[in]       a_id   id of first particle
+ * \param[in]       b_id   id of second particle
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_merge_particles(cs_lagr_particle_set_t  *p_set,
+                 cs_lnum_t                a_id,
+                 cs_lnum_t                b_id)
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+
+  const cs_lagr_attribute_t avg_attrs[] = {CS_LAGR_VELOCITY,
+                                           CS_LAGR_VELOCITY_SEEN,
+                                           CS_LAGR_TEMPERATURE,
+                                           CS_LAGR_FLUID_TEMPERATURE};
+  const int n_avg_attrs = sizeof(avg_attrs) / sizeof(avg_attrs[0]);
+
+  cs_real_t w_a = cs_lagr_particles_get_real(p_set, a_id, CS_LAGR_STAT_WEIGHT);
+  cs_real_t w_b = cs_lagr_particles_get_real(p_set, b_id, CS_LAGR_STAT_WEIGHT);
+  cs_real_t m_a = cs_lagr_particles_get_real(p_set, a_id, CS_LAGR_MASS);
+  cs_real_t m_b = cs_lagr_particles_get_real(p_set, b_id, CS_LAGR_MASS);
+
+  cs_real_t f_a = w_a*m_a, f_b = w_b*m_b;
+  if (f_a + f_b <= 0.) {
+    f_a = w_a;
+    f_b = w_b;
+  }
+
+  /* Keep dominant particle */
+
+  cs_lnum_t r_id = a_id, d_id = b_id;
+  cs_real_t w_r = w_a, w_d = w_b, m_r = m_a, m_d = m_b;
+  cs_real_t c_r = f_a / (f_a + f_b);
+
+  if (f_b > f_a) {
+    r_id = b_id; d_id = a_id;
+    w_r = w_b; w_d = w_a; m_r = m_b; m_d = m_a;
+    c_r = f_b / (f_a + f_b);
+  }
+
+  const cs_real_t c_d = 1. - c_r;
+
+  for (int i = 0; i < n_avg_attrs; i++) {
+    cs_lagr_attribute_t attr = avg_attrs[i];
+    int count = p_am->count[0][attr];
+    if (count < 1)
+      continue;
+    cs_real_t *v_r
+      = cs_lagr_particles_attr_get_ptr<cs_real_t>(p_set, r_id, attr);
+    const cs_real_t *v_d
+      = cs_lagr_particles_attr_get_ptr<cs_real_t>(p_set, d_id, attr);
+    for (int j = 0; j < count; j++)
+      v_r[j] = c_r*v_r[j] + c_d*v_d[j];
+  }
+
+  /* Conserve mass; diameter follows at constant density */
+
+  cs_real_t w = w_r + w_d;
+  cs_real_t m = (w_r*m_r + w_d*m_d) / w;
+
+  if (m_r > 0. && p_am->count[0][CS_LAGR_DIAMETER] > 0) {
+    cs_real_t d = cs_lagr_particles_get_real(p_set, r_id, CS_LAGR_DIAMETER);
+    cs_lagr_particles_set_real(p_set, r_id, CS_LAGR_DIAMETER,
+                               d * cbrt(m / m_r));
+  }
+
+  cs_lagr_particles_set_real(p_set, r_id, CS_LAGR_MASS, m);
+  cs_lagr_particles_set_real(p_set, r_id, CS_LAGR_STAT_WEIGHT, w);
+
+  cs_lagr_particles_set_real(p_set, d_id, CS_LAGR_STAT_WEIGHT, 0);
+  cs_lagr_particles_set_flag(p_set, d_id, CS_LAGR_PART_TO_DELETE);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge particles of a cell until the target count is reached.
+ *
+ * Particles are considered by increasing weight, and each one is merged
+ * with the previous unpaired particle of the same statistical class.
+ *
+ * \param[in, out]  p_set      pointer to particle set
+ * \param[in]       n          number of free-flying particles in cell
+ * \param[in]       n_merge    requested number of merges
+ * \param[in]       max_w      maximum weight of merged particle, or 0
+ * \param[in]       n_classes  number of statistical classes
+ * \param[in]       p_ids      ids of cell particles
+ * \param[in]       w          weights of cell particles
+ * \param[in, out]  order      work array (size: n)
+ * \param[in, out]  pending    work array (size: n_classes + 1)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_merge_cell_particles(cs_lagr_particle_set_t  *p_set,
+                      cs_lnum_t                n,
+                      cs_lnum_t                n_merge,
+                      cs_real_t                max_w,
+                      int                      n_classes,
+                      const cs_lnum_t          p_ids[],
+                      const cs_real_t          w[],
+                      cs_lnum_t                order[],
+                      cs_lnum_t                pending[])
+{
+  const bool have_class
+    = (p_set->p_am->count[0][CS_LAGR_STAT_CLASS] > 0) ? true : false;
+
+  cs_order_real_allocated(NULL, w, order, n);
+
+  for (int i = 0; i < n_classes + 1; i++)
+    pending[i] = -1;
+
+  cs_lnum_t n_merged = 0;
+
+  for (cs_lnum_t i = 0; i < n && n_merged < n_merge; i++) {
+
+    cs_lnum_t j = order[i];
+
+    int c_id = 0;
+    if (have_class)
+      c_id = cs_lagr_particles_get_lnum(p_set, p_ids[j], CS_LAGR_STAT_CLASS);
+    if (c_id < 0 || c_id > n_classes)
+      continue;
+
+    cs_lnum_t k = pending[c_id];
+
+    if (k == -2) /* class closed: heavier particles would exceed max_w */
+      continue;
+
+    else if (k < 0)
+      pending[c_id] = j;
+
+    else if (max_w > 0 && w[j] + w[k] > max_w)
+      pending[c_id] = -2;
+
+    else {
+      _merge_particles(p_set, p_ids[k], p_ids[j]);
+      pending[c_id] = -1;
+      n_merged++;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select particles of a cell to split.
+ *
+ * The heaviest particles are selected first, as long as their half
+ * weight is above the minimum weight.
+ *
+ * \param[in]       n         number of free-flying particles in cell
+ * \param[in]       n_split   requested number of splits
+ * \param[in]       min_w     minimum weight of split particles
+ * \param[in]       w         weights of cell particles
+ * \param[in, out]  order     ordering of selected particles, heaviest
+ *                            first (size: n)
+ *
+ * \return  number of particles to split
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_select_split_particles(cs_lnum_t        n,
+                        cs_lnum_t        n_split,
+                        cs_real_t        min_w,
+                        const cs_real_t  w[],
+                        cs_lnum_t        order[])
+{
+  cs_order_real_allocated(NULL, w, order, n);
+
+  /* Reverse to get heaviest first */
+
+  for (cs_lnum_t i = 0; i < n/2; i++) {
+    cs_lnum_t tmp = order[i];
+    order[i] = order[n-1-i];
+    order[n-1-i] = tmp;
+  }
+
+  cs_lnum_t n_s = 0;
+  while (n_s < n_split && n_s < n && w[order[n_s]]*0.5 >= min_w)
+    n_s++;
+
+  return n_s;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply particle population control.
+ *
+ * Based on \ref cs_glob_lagr_population_model settings, in cells containing
+ * more than n_max_per_cell free-flying particles, the lightest particles
+ * of a same statistical class are merged pairwise, and in cells containing
+ * less than n_min_per_cell particles, the heaviest ones are split into
+ * two particles of half weight.
+ *
+ * Merging conserves the statistical weight, mass and momentum of the
+ * merged particles; the resulting particle is placed at the position of
+ * the dominant (by mass) particle. Merged particles are marked for deletion
+ * (as with agglomeration), and split particles are appended to the set.
+ *
+ * This must be called when particles are sorted by cell (i.e. after
+ * particle tracking).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void)
+{
+  const cs_lagr_population_model_t *pm = cs_glob_lagr_population_model;
+
+  if (pm->frequency < 1 || cs_glob_time_step->nt_cur % pm->frequency != 0)
+    return;
+
+  cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  if (p_set->cell_p_idx == NULL || p_set->n_cell_sorted < 1)
+    return;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_sorted = p_set->n_cell_sorted;
+  const cs_lnum_t *cell_p_idx = p_set->cell_p_idx;
+
+  const cs_lnum_t n_min = pm->n_min_per_cell;
+  const cs_lnum_t n_max = pm->n_max_per_cell;
+  const int n_classes = cs_glob_lagr_model->n_stat_classes;
+
+  /* Models with class-specific attributes handle their own merging */
+
+  const bool merge
+    = (   n_max > 0
+       && cs_glob_lagr_model->physical_model != CS_LAGR_PHYS_COAL
+       && cs_glob_lagr_model->agglomeration == 0
+       && cs_glob_lagr_model->fragmentation == 0) ? true : false;
+
+  cs_lnum_t max_cell_size = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t s_id = CS_MIN(cell_p_idx[c_id], n_sorted);
+    cs_lnum_t e_id = CS_MIN(cell_p_idx[c_id+1], n_sorted);
+    max_cell_size = CS_MAX(max_cell_size, e_id - s_id);
+  }
+
+  cs_lnum_t *split_idx;
+  BFT_MALLOC(split_idx, n_cells+1, cs_lnum_t);
+  split_idx[0] = 0;
+
+  /* Merge particles and count splits */
+
+# pragma omp parallel if (n_sorted > CS_THR_MIN)
+  {
+    cs_lnum_t *p_ids, *order, *pending;
+    cs_real_t *w;
+    BFT_MALLOC(p_ids, max_cell_size, cs_lnum_t);
+    BFT_MALLOC(order, max_cell_size, cs_lnum_t);
+    BFT_MALLOC(pending, n_classes + 1, cs_lnum_t);
+    BFT_MALLOC(w, max_cell_size, cs_real_t);
+
+#   pragma omp for schedule(dynamic, CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+      split_idx[c_id+1] = 0;
+
+      cs_lnum_t s_id = CS_MIN(cell_p_idx[c_id], n_sorted);
+      cs_lnum_t e_id = CS_MIN(cell_p_idx[c_id+1], n_sorted);
+
+      if (e_id <= s_id)
+        continue;
+
+      cs_lnum_t n = _cell_particles(p_set, s_id, e_id, p_ids, w);
+
+      if (merge && n > n_max)
+        _merge_cell_particles(p_set, n, n - n_max, pm->max_stat_weight,
+                              n_classes, p_ids, w, order, pending);
+
+      else if (n > 0 && n < n_min)
+        split_idx[c_id+1]
+          = _select_split_particles(n, n_min - n, pm->min_stat_weight,
+                                    w, order);
+
+    }
+
+    BFT_FREE(p_ids);
+    BFT_FREE(order);
+    BFT_FREE(pending);
+    BFT_FREE(w);
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    split_idx[c_id+1] += split_idx[c_id];
+
+  const cs_lnum_t n_new = split_idx[n_cells];
+
+  /* Split particles, appending copies at the end of the set
+     (if the set cannot grow, particles are not split) */
+
+  if (   n_new > 0
+      && cs_lagr_particle_set_resize(p_set->n_particles + n_new) >= 0) {
+
+    const size_t extents = p_set->p_am->extents;
+    const cs_lnum_t n_particles = p_set->n_particles;
+
+#   pragma omp parallel if (n_new > CS_THR_MIN)
+    {
+      cs_lnum_t *p_ids, *order;
+      cs_real_t *w;
+      BFT_MALLOC(p_ids, max_cell_size, cs_lnum_t);
+      BFT_MALLOC(order, max_cell_size, cs_lnum_t);
+      BFT_MALLOC(w, max_cell_size, cs_real_t);
+
+#     pragma omp for schedule(dynamic, CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+        cs_lnum_t n_split = split_idx[c_id+1] - split_idx[c_id];
+        if (n_split < 1)
+          continue;
+
+        cs_lnum_t s_id = CS_MIN(cell_p_idx[c_id], n_sorted);
+        cs_lnum_t e_id = CS_MIN(cell_p_idx[c_id+1], n_sorted);
+
+        cs_lnum_t n = _cell_particles(p_set, s_id, e_id, p_ids, w);
+        _select_split_particles(n, n_split, pm->min_stat_weight, w, order);
+
+        for (cs_lnum_t i = 0; i < n_split; i++) {
+          cs_lnum_t src_id = p_ids[order[i]];
+          cs_lnum_t dst_id = n_particles + split_idx[c_id] + i;
+
+          cs_lagr_particles_set_real(p_set, src_id, CS_LAGR_STAT_WEIGHT,
+                                     0.5*w[order[i]]);
+          memcpy(p_set->p_buffer + extents*dst_id,
+                 p_set->p_buffer + extents*src_id,
+                 extents);
+        }
+
+      }
+
+      BFT_FREE(p_ids);
+      BFT_FREE(order);
+      BFT_FREE(w);
+    }
+
+    p_set->n_particles += n_new;
+
+  }
+
+  BFT_FREE(split_idx);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,71 @@
+#ifndef __CS_LAGR_POPULATION_H__
+#define __CS_LAGR_POPULATION_H__
+
+/*============================================================================
+ * Particle population control (splitting and merging).
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply particle population control.
+ *
+ * Based on \ref cs_glob_lagr_population_model settings, in cells containing
+ * more than n_max_per_cell free-flying particles, the lightest particles
+ * of a same statistical class are merged pairwise, and in cells containing
+ * less than n_min_per_cell particles, the heaviest ones are split into
+ * two particles of half weight.
+ *
+ * Merging conserves the statistical weight, mass and momentum of the
+ * merged particles; the resulting particle is placed at the position of
+ * the dominant (by mass) particle. Merged particles are marked for deletion
+ * (as with agglomeration), and split particles are appended to the set.
+ *
+ * This must be called when particles are sorted by cell (i.e. after
+ * particle tracking).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_population_control(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_POPULATION_H__ */
@@ -91,6 +91,25 @@ static const double _k_boltz = 1.38e-23;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the counter-based random number stream for a given use
+ *        at the current time step on this rank.
+ *
+ * \param[in]  tag  stream use (0: turbulent dispersion, 1: brownian motion)
+ *
+ * \return  stream id
+ */
+/*----------------------------------------------------------------------------*/
+
+static uint64_t
+_rng_stream(int  tag)
+{
+  return   ((uint64_t)cs_glob_time_step->nt_cur << 40)
+         | ((uint64_t)tag << 32)
+         | (uint64_t)CS_MAX(cs_glob_rank_id, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Add a resulspension event
@@ -886,52 +905,60 @@ _lages2(cs_real_t           dtp,
     }
 
     /* Load terms at t = t_n : */
-    for (cs_lnum_t p_id = 0; p_id < n_particles_prev; p_id++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+    /* Use contiguous copies of the required attributes, so that
+       the loop accesses memory contiguously */
+
+    const cs_real_3_t *old_part_vel
+      = (const cs_real_3_t *)cs_lagr_particles_soa_gather(p_set, 1,
+                                                          CS_LAGR_VELOCITY);
+    const cs_real_3_t *old_part_vel_seen
+      = (const cs_real_3_t *)cs_lagr_particles_soa_gather
+                               (p_set, 1, CS_LAGR_VELOCITY_SEEN);
+    cs_real_3_t *pred_part_vel_seen
+      = (cs_real_3_t *)cs_lagr_particles_soa_gather
+                         (p_set, 0, CS_LAGR_PRED_VELOCITY_SEEN);
+    cs_real_3_t *pred_part_vel
+      = (cs_real_3_t *)cs_lagr_particles_soa_gather(p_set, 0,
+                                                    CS_LAGR_PRED_VELOCITY);
+
+#   pragma omp parallel for if (n_particles_prev > CS_THR_MIN)
+    for (cs_lnum_t p_id = 0; p_id < n_particles_prev; p_id++) {
 
       if (cs_lagr_particles_get_flag(p_set, p_id, CS_LAGR_PART_FIXED)
           || cs_lagr_particles_get_flag(p_set, p_id, CS_LAGR_PART_IMPOSED_MOTION))
         continue;
 
-      auto *old_part_vel      =
-        cs_lagr_particle_attr_n_get_ptr<cs_real_t>(particle, p_am,
-                                                   1, CS_LAGR_VELOCITY);
-      auto *old_part_vel_seen =
-        cs_lagr_particle_attr_n_get_ptr<cs_real_t>(particle, p_am,
-                                                   1, CS_LAGR_VELOCITY_SEEN);
-      auto *pred_part_vel_seen =
-        cs_lagr_particle_attr_get_ptr<cs_real_t>(particle, p_am,
-                                                 CS_LAGR_PRED_VELOCITY_SEEN);
-      auto *pred_part_vel =
-        cs_lagr_particle_attr_get_ptr<cs_real_t>(particle, p_am,
-                                                 CS_LAGR_PRED_VELOCITY);
-
       for (cs_lnum_t id = 0; id < 3; id++) {
 
-        aux0    =  -dtp / taup[p_id];
-        aux1    =  -dtp / tlag[p_id][id];
-        aux2    = exp(aux0);
-        aux3    = exp(aux1);
-        aux4    = tlag[p_id][id] / (tlag[p_id][id] - taup[p_id]);
-        aux5    = aux3 - aux2;
-
-        pred_part_vel_seen[id] =   0.5 * old_part_vel_seen[id]
-                                 * aux3 + auxl[p_id * 6 + id + 3]
-                                 * (-aux3 + (aux3 - 1.0) / aux1);
-
-        ter1    = 0.5 * old_part_vel[id] * aux2;
-        ter2    = 0.5 * old_part_vel_seen[id] * aux4 * aux5;
-        ter3    =   auxl[p_id * 6 + id + 3]
-                  * (  -aux2 + ((tlag[p_id][id] + taup[p_id]) / dtp) * (1.0 - aux2)
-                     - (1.0 + tlag[p_id][id] / dtp) * aux4 * aux5);
-        ter4    = auxl[p_id * 6 + id] * (-aux2 + (aux2 - 1.0) / aux0);
-        pred_part_vel[id] = ter1 + ter2 + ter3 + ter4;
+        cs_real_t _aux0 = -dtp / taup[p_id];
+        cs_real_t _aux1 = -dtp / tlag[p_id][id];
+        cs_real_t _aux2 = exp(_aux0);
+        cs_real_t _aux3 = exp(_aux1);
+        cs_real_t _aux4 = tlag[p_id][id] / (tlag[p_id][id] - taup[p_id]);
+        cs_real_t _aux5 = _aux3 - _aux2;
+
+        pred_part_vel_seen[p_id][id] =   0.5 * old_part_vel_seen[p_id][id]
+                                       * _aux3 + auxl[p_id * 6 + id + 3]
+                                       * (-_aux3 + (_aux3 - 1.0) / _aux1);
+
+        cs_real_t _ter1 = 0.5 * old_part_vel[p_id][id] * _aux2;
+        cs_real_t _ter2 = 0.5 * old_part_vel_seen[p_id][id] * _aux4 * _aux5;
+        cs_real_t _ter3
+          =   auxl[p_id * 6 + id + 3]
+            * (  -_aux2 + ((tlag[p_id][id] + taup[p_id]) / dtp) * (1.0 - _aux2)
+               - (1.0 + tlag[p_id][id] / dtp) * _aux4 * _aux5);
+        cs_real_t _ter4 = auxl[p_id * 6 + id] * (-_aux2 + (_aux2 - 1.0) / _aux0);
+        pred_part_vel[p_id][id] = _ter1 + _ter2 + _ter3 + _ter4;
 
       }
 
     }
 
+    cs_lagr_particles_soa_scatter(p_set, 0, CS_LAGR_PRED_VELOCITY_SEEN);
+    cs_lagr_particles_soa_scatter(p_set, 0, CS_LAGR_PRED_VELOCITY);
+    cs_lagr_particles_soa_free(p_set);
+
     /* Euler scheme */
 
     _lages1(dtp,
@@ -2838,6 +2865,9 @@ cs_lagr_sde(cs_real_t           dt_p,
         }
       }
     }
+    else if (cs_glob_lagr_time_scheme->counter_rng > 0)
+      cs_random_counter_normal(_rng_stream(0), 0, p_set->n_particles*9,
+                               &(vagaus[0][0][0]));
     else {
       for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++)
         cs_random_normal(9, &(vagaus[p_id][0][0]));
@@ -2868,6 +2898,9 @@ cs_lagr_sde(cs_real_t           dt_p,
           brgaus[p_id*6 + id] = _br_gauss[id];
       }
     }
+    else if (cs_glob_lagr_time_scheme->counter_rng > 0)
+      cs_random_counter_normal(_rng_stream(1), 0, p_set->n_particles*6,
+                               brgaus);
     else {
       for (cs_lnum_t p_id = 0; p_id < p_set->n_particles; p_id++)
         cs_random_normal(6, &(brgaus[6 * p_id]));
@@ -58,6 +58,8 @@
 #include "cs_mesh_quantities.h"
 #include "cs_order.h"
 #include "cs_parall.h"
+#include "cs_post.h"
+#include "cs_restart.h"
 #include "cs_restart_default.h"
 #include "cs_timer_stats.h"
 #include "cs_time_step.h"
@@ -174,6 +176,13 @@ typedef struct {
 
   int                       nt_cur;      /* Time step number of last update */
 
+  cs_real_t                *s_val;       /* Weighted sums of values (means) or
+                                            of squares (variances) in deferred
+                                            mode, or NULL */
+  int                       nt_sync;     /* Time step number of last
+                                            computation of values from sums
+                                            in deferred mode */
+
 } cs_lagr_moment_t;
 
 /* Mesh-based statistics definitions */
@@ -310,7 +319,8 @@ static cs_lagr_stat_options_t _lagr_stat_options
   = {.isuist = 1,
      .idstnt = 0,
      .nstist = 0,
-     .threshold = 1e-12};
+     .threshold = 1e-12,
+     .deferred = 0};
 
 cs_lagr_stat_options_t *cs_glob_lagr_stat_options = &_lagr_stat_options;
 
@@ -504,7 +514,47 @@ _vol_fraction(const void                 *input,
 
   if (class_id == 0) {
 
-    for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
+    /* Particles sorted by cell: gather per cell */
+
+    cs_lnum_t n_sorted = 0;
+
+    if (p_set->cell_p_idx != NULL && location_id == CS_MESH_LOCATION_CELLS) {
+
+      n_sorted = p_set->n_cell_sorted;
+      const cs_lnum_t *cell_p_idx = p_set->cell_p_idx;
+
+#     pragma omp parallel for if (n_elts > CS_THR_MIN)
+      for (cs_lnum_t cell_id = 0; cell_id < n_elts; cell_id++) {
+
+        cs_lnum_t s_id = CS_MIN(cell_p_idx[cell_id], n_sorted);
+        cs_lnum_t e_id = CS_MIN(cell_p_idx[cell_id+1], n_sorted);
+
+        cs_real_t c_val = 0.;
+
+        for (cs_lnum_t part = s_id; part < e_id; part++) {
+
+          unsigned char *particle
+            = p_set->p_buffer + p_set->p_am->extents * part;
+
+          cs_real_t diam = cs_lagr_particle_get_real(particle, p_set->p_am,
+                                                     CS_LAGR_DIAMETER);
+
+          cs_real_t p_weight = cs_lagr_particle_get_real(particle, p_set->p_am,
+                                                         CS_LAGR_STAT_WEIGHT);
+
+          c_val += diam*diam*diam * cs_math_pi / 6.0 * p_weight;
+
+        }
+
+        vals[cell_id] = c_val / cs_glob_mesh_quantities->cell_vol[cell_id];
+
+      }
+
+    }
+
+    /* Remaining particles */
+
+    for (cs_lnum_t part = n_sorted; part < p_set->n_particles; part++) {
 
       unsigned char *particle
         = p_set->p_buffer + p_set->p_am->extents * part;
@@ -2326,6 +2376,9 @@ _find_or_add_moment(int                       location_id,
 
   mt->nt_cur = -1;
 
+  mt->s_val = NULL;
+  mt->nt_sync = -1;
+
   return moment_id;
 }
 
@@ -2634,6 +2687,7 @@ _cs_lagr_stat_reset_unsteady(cs_lagr_stat_group_t   stat_group,
     if (mwa->group == stat_group && mwa->allow_reset) {
       cs_field_t *f = cs_field_by_id(mt->f_id);
       cs_field_set_values(f, 0.);
+      BFT_FREE(mt->s_val);
     }
 
   }
@@ -2814,6 +2868,397 @@ _location_attr(int location_id)
   return location_attr;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check whether a moment is handled in deferred mode.
+ *
+ * \param[in]  mt   pointer to moment
+ * \param[in]  mwa  pointer to associated weight accumulator
+ *
+ * \return  true if sums are accumulated instead of moment values
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_is_deferred(const cs_lagr_moment_t     *mt,
+             const cs_lagr_moment_wa_t  *mwa)
+{
+  return (   _lagr_stat_options.deferred > 0
+          && mwa->group == CS_LAGR_STAT_GROUP_PARTICLE
+          && mwa->m_data_func == NULL
+          && mt->m_data_func == NULL
+          && (mt->dim == mt->data_dim || mt->dim == 6));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize weighted sums of a deferred moment from its current
+ *        values.
+ *
+ * \param[in, out]  mt      pointer to moment
+ * \param[in]       wa_sum  associated accumulated weight
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_ensure_init_deferred(cs_lagr_moment_t  *mt,
+                      const cs_real_t    wa_sum[])
+{
+  if (mt->s_val != NULL)
+    return;
+
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(mt->location_id)[0];
+  const cs_lnum_t dim = mt->dim;
+
+  BFT_MALLOC(mt->s_val, n_elts*dim, cs_real_t);
+
+  cs_real_t *restrict s = mt->s_val;
+  const cs_real_t *restrict val = cs_field_by_id(mt->f_id)->val;
+
+  if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      for (cs_lnum_t l = 0; l < dim; l++)
+        s[i*dim + l] = val[i*dim + l] * wa_sum[i];
+    }
+  }
+
+  else { /* variance: sum of squares from variance and mean */
+
+    assert(mt->l_id > -1);
+    const cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
+    const cs_real_t *restrict m = cs_field_by_id(mt_mean->f_id)->val;
+    const cs_lnum_t m_dim = mt_mean->dim;
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      const cs_real_t *_m = m + i*m_dim;
+      if (dim == 6) {
+        cs_real_t mm[6] = {_m[0]*_m[0], _m[1]*_m[1], _m[2]*_m[2],
+                           _m[0]*_m[1], _m[1]*_m[2], _m[0]*_m[2]};
+        for (cs_lnum_t l = 0; l < 6; l++)
+          s[i*6 + l] = (val[i*6 + l] + mm[l]) * wa_sum[i];
+      }
+      else {
+        for (cs_lnum_t l = 0; l < dim; l++)
+          s[i*dim + l] = (val[i*dim + l] + _m[l]*_m[l]) * wa_sum[i];
+      }
+    }
+
+  }
+
+  mt->nt_sync = mt->nt_cur;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add contribution of a particle to deferred moments sums and
+ *        to the associated weight accumulator.
+ *
+ * \param[in]       p_set     pointer to particle set
+ * \param[in]       p_id      particle id
+ * \param[in]       mwa       pointer to weight accumulator
+ * \param[in]       n_dm      number of deferred moments
+ * \param[in]       dm_ids    ids of deferred moments
+ * \param[in]       attr_ids  associated particle attribute ids
+ * \param[in]       dt_val    cell time step values
+ * \param[in]       dt_mult   time step multiplier (1 if local, 0 if uniform)
+ * \param[in, out]  pval      work array for particle values
+ * \param[in, out]  wa_sum    accumulated weight
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_accumulate_deferred(const cs_lagr_particle_set_t  *p_set,
+                     cs_lnum_t                      p_id,
+                     const cs_lagr_moment_wa_t     *mwa,
+                     int                            n_dm,
+                     const int                      dm_ids[],
+                     const cs_lagr_attribute_t      attr_ids[],
+                     const cs_real_t                dt_val[],
+                     cs_lnum_t                      dt_mult,
+                     cs_real_t                      pval[],
+                     cs_real_t                      wa_sum[])
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+
+  cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
+                                                CS_LAGR_CELL_ID);
+
+  int p_class = 0;
+  if (p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
+    p_class = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
+
+  if (cell_id < 0 || (p_class != mwa->class_id && mwa->class_id != 0))
+    return;
+
+  /* weight associated to current particle */
+
+  cs_real_t p_weight;
+
+  if (mwa->p_data_func == NULL)
+    p_weight = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+  else
+    mwa->p_data_func(mwa->data_input, particle, p_am, &p_weight);
+  p_weight *= dt_val[cell_id*dt_mult];
+
+  /* Add weighted values for all moments */
+
+  for (int i = 0; i < n_dm; i++) {
+
+    const cs_lagr_moment_t *mt = _lagr_moments + dm_ids[i];
+    const cs_lnum_t dim = mt->dim;
+    cs_real_t *restrict s = mt->s_val + cell_id*dim;
+
+    const cs_real_t *p_v = pval;
+    if (mt->p_data_func == NULL)
+      p_v = cs_lagr_particle_attr_get_const_ptr<cs_real_t>(particle, p_am,
+                                                           attr_ids[i]);
+    else
+      mt->p_data_func(mt->data_input, particle, p_am, pval);
+
+    if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+      for (cs_lnum_t l = 0; l < dim; l++)
+        s[l] += p_weight * p_v[l];
+    }
+    else if (dim == 6) { /* variance-covariance matrix */
+      s[0] += p_weight * p_v[0]*p_v[0];
+      s[1] += p_weight * p_v[1]*p_v[1];
+      s[2] += p_weight * p_v[2]*p_v[2];
+      s[3] += p_weight * p_v[0]*p_v[1];
+      s[4] += p_weight * p_v[1]*p_v[2];
+      s[5] += p_weight * p_v[0]*p_v[2];
+    }
+    else {
+      for (cs_lnum_t l = 0; l < dim; l++)
+        s[l] += p_weight * p_v[l]*p_v[l];
+    }
+
+  }
+
+  wa_sum[cell_id] += p_weight;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute values of deferred moments from accumulated sums.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sync_deferred_moments(void)
+{
+  /* Means first, as variances are based on them */
+
+  for (int m_type = CS_LAGR_MOMENT_MEAN;
+       m_type <= (int)CS_LAGR_MOMENT_VARIANCE;
+       m_type++) {
+
+    for (int i = 0; i < _n_lagr_moments; i++) {
+
+      cs_lagr_moment_t *mt = _lagr_moments + i;
+
+      if (   (int)mt->m_type != m_type
+          || mt->s_val == NULL
+          || mt->nt_sync >= mt->nt_cur)
+        continue;
+
+      const cs_lagr_moment_wa_t *mwa = _lagr_moments_wa + mt->wa_id;
+      const cs_real_t *restrict wa_sum = _mwa_const_val(mwa);
+
+      const cs_lnum_t n_elts
+        = cs_mesh_location_get_n_elts(mt->location_id)[0];
+      const cs_lnum_t dim = mt->dim;
+
+      const cs_real_t *restrict s = mt->s_val;
+      cs_real_t *restrict val = cs_field_by_id(mt->f_id)->val;
+
+      if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+
+#       pragma omp parallel for if (n_elts > CS_THR_MIN)
+        for (cs_lnum_t j = 0; j < n_elts; j++) {
+          const double w_inv = 1. / CS_MAX(wa_sum[j], 1e-100);
+          for (cs_lnum_t l = 0; l < dim; l++)
+            val[j*dim + l] = s[j*dim + l] * w_inv;
+        }
+
+      }
+
+      else {
+
+        const cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
+        const cs_real_t *restrict m = cs_field_by_id(mt_mean->f_id)->val;
+        const cs_lnum_t m_dim = mt_mean->dim;
+
+#       pragma omp parallel for if (n_elts > CS_THR_MIN)
+        for (cs_lnum_t j = 0; j < n_elts; j++) {
+          const double w_inv = 1. / CS_MAX(wa_sum[j], 1e-100);
+          const cs_real_t *_m = m + j*m_dim;
+          if (dim == 6) {
+            cs_real_t mm[6] = {_m[0]*_m[0], _m[1]*_m[1], _m[2]*_m[2],
+                               _m[0]*_m[1], _m[1]*_m[2], _m[0]*_m[2]};
+            for (cs_lnum_t l = 0; l < 6; l++)
+              val[j*6 + l] = s[j*6 + l] * w_inv - mm[l];
+            for (cs_lnum_t l = 0; l < 3; l++)
+              val[j*6 + l] = CS_MAX(val[j*6 + l], 0.);
+          }
+          else {
+            for (cs_lnum_t l = 0; l < dim; l++)
+              val[j*dim + l] = CS_MAX(s[j*dim + l] * w_inv - _m[l]*_m[l],
+                                      0.);
+          }
+        }
+
+      }
+
+      mt->nt_sync = mt->nt_cur;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update weighted sums of deferred particle-based moments of a given
+ *        weight accumulator, and the accumulator itself, in a single pass
+ *        on particles.
+ *
+ * \param[in, out]  mwa       pointer to weight accumulator
+ * \param[in]       wa_id     weight accumulator id
+ * \param[in]       dt_val    cell time step values
+ * \param[in]       dt_mult   time step multiplier (1 if local, 0 if uniform)
+ *
+ * \return  true if deferred moments were updated (and the accumulator with
+ *          them), false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_update_deferred_moments(cs_lagr_moment_wa_t  *mwa,
+                         int                   wa_id,
+                         const cs_real_t       dt_val[],
+                         cs_lnum_t             dt_mult)
+{
+  const cs_time_step_t  *ts = cs_glob_time_step;
+  const cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
+
+  int n_dm = 0, pval_size = 1;
+  int *dm_ids = NULL;
+  cs_lagr_attribute_t *attr_ids = NULL;
+
+  BFT_MALLOC(dm_ids, _n_lagr_moments, int);
+  BFT_MALLOC(attr_ids, _n_lagr_moments, cs_lagr_attribute_t);
+
+  for (int i = 0; i < _n_lagr_moments; i++) {
+    cs_lagr_moment_t *mt = _lagr_moments + i;
+    if (   mt->wa_id == wa_id
+        && mt->nt_cur < ts->nt_cur
+        && _is_deferred(mt, mwa)) {
+      dm_ids[n_dm] = i;
+      attr_ids[n_dm]
+        = (cs_lagr_attribute_t) cs_lagr_stat_type_to_attr_id(mt->stat_type);
+      pval_size = CS_MAX(pval_size, mt->data_dim);
+      n_dm++;
+    }
+  }
+
+  if (n_dm == 0) {
+    BFT_FREE(attr_ids);
+    BFT_FREE(dm_ids);
+    return false;
+  }
+
+  cs_real_t *wa_sum = _mwa_val(mwa);
+
+  /* Sums are initialized from values if needed (at first update,
+     after a restart or reset) */
+
+  for (int i = 0; i < n_dm; i++) {
+    cs_lagr_moment_t *mt = _lagr_moments + dm_ids[i];
+    _ensure_init_moment(mt);
+    if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
+      _ensure_init_moment(_lagr_moments + mt->l_id);
+  }
+  bool need_init = false;
+  for (int i = 0; i < n_dm; i++) {
+    if (_lagr_moments[dm_ids[i]].s_val == NULL)
+      need_init = true;
+  }
+  if (need_init) {
+    _sync_deferred_moments(); /* so that values used for init are current */
+    for (int i = 0; i < n_dm; i++)
+      _ensure_init_deferred(_lagr_moments + dm_ids[i], wa_sum);
+  }
+
+  /* Particles sorted by cell are handled per cell, in parallel,
+     remaining ones sequentially */
+
+  cs_lnum_t n_sorted = 0;
+
+  if (p_set->cell_p_idx != NULL) {
+
+    n_sorted = p_set->n_cell_sorted;
+    const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+    const cs_lnum_t *cell_p_idx = p_set->cell_p_idx;
+
+#   pragma omp parallel if (n_cells > CS_THR_MIN)
+    {
+      cs_real_t *pval;
+      BFT_MALLOC(pval, pval_size, cs_real_t);
+
+#     pragma omp for
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        cs_lnum_t s_id = CS_MIN(cell_p_idx[c_id], n_sorted);
+        cs_lnum_t e_id = CS_MIN(cell_p_idx[c_id+1], n_sorted);
+        for (cs_lnum_t p_id = s_id; p_id < e_id; p_id++)
+          _accumulate_deferred(p_set, p_id, mwa, n_dm, dm_ids, attr_ids,
+                               dt_val, dt_mult, pval, wa_sum);
+      }
+
+      BFT_FREE(pval);
+    }
+
+  }
+
+  cs_real_t *pval;
+  BFT_MALLOC(pval, pval_size, cs_real_t);
+
+  for (cs_lnum_t p_id = n_sorted; p_id < p_set->n_particles; p_id++)
+    _accumulate_deferred(p_set, p_id, mwa, n_dm, dm_ids, attr_ids,
+                         dt_val, dt_mult, pval, wa_sum);
+
+  BFT_FREE(pval);
+
+  for (int i = 0; i < n_dm; i++)
+    _lagr_moments[dm_ids[i]].nt_cur = ts->nt_cur;
+
+  BFT_FREE(attr_ids);
+  BFT_FREE(dm_ids);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute values of deferred moments before postprocessing output.
+ *
+ * This function matches the cs_post_time_dep_output_t prototype.
+ *
+ * \param[in]  input  pointer to optional (untyped) value or structure
+ * \param[in]  ts     time step status structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sync_deferred_moments_post(void                  *input,
+                            const cs_time_step_t  *ts)
+{
+  CS_UNUSED(input);
+  CS_UNUSED(ts);
+
+  _sync_deferred_moments();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all particle-based moment and time moment accumulators.
@@ -2862,6 +3307,13 @@ _cs_lagr_stat_update_all(void)
     cs_real_t m_w0[1];
     cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
 
+    /* In deferred mode, particle-based moments and the accumulator are
+       updated together in a single pass on particles */
+
+    bool wa_updated = false;
+    if (m_weight == NULL && _lagr_stat_options.deferred > 0)
+      wa_updated = _update_deferred_moments(mwa, wa_id, dt_val, dt_mult);
+
     /* Loop on variances first, then means */
 
     for (int m_type = CS_LAGR_MOMENT_VARIANCE;
@@ -3091,7 +3543,8 @@ _cs_lagr_stat_update_all(void)
       if (m_weight != m_w0)
         BFT_FREE(m_weight);
     }
-    else if (n_w_elts > 0) { /* Case where accumulator has no moments */
+    else if (n_w_elts > 0 && !wa_updated) { /* Case where accumulator
+                                                 has no moments */
 
       for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
 
@@ -3182,6 +3635,7 @@ _free_all_moments(void)
   for (i = 0; i < _n_lagr_moments; i++) {
     cs_lagr_moment_t *mt = _lagr_moments + i;
     BFT_FREE(mt->name);
+    BFT_FREE(mt->s_val);
   }
 
   BFT_FREE(_lagr_moments);
@@ -4575,6 +5029,12 @@ cs_lagr_stat_initialize(void)
     }
   }
 
+  /* In deferred mode, moment values are computed from sums when needed
+     for output */
+
+  if (_lagr_stat_options.deferred > 0)
+    cs_post_add_time_dep_output(_sync_deferred_moments_post, NULL);
+
   /* Activation status not needed after this stage */
 
   BFT_FREE(_base_stat_activate);
@@ -4712,6 +5172,13 @@ cs_lagr_stat_update(void)
 
   _cs_lagr_stat_update_all();
 
+  /* Values of deferred moments needed for log or checkpoint
+     (postprocessing output is handled through a dedicated hook) */
+
+  if (   _lagr_stat_options.deferred > 0
+      && (cs_log_default_is_active() || cs_restart_checkpoint_required(ts)))
+    _sync_deferred_moments();
+
   /* Update current time step for active event moments */
 
   _cs_lagr_stat_set_active_event_time(CS_LAGR_STAT_GROUP_TRACKING_EVENT,
@@ -5373,6 +5840,8 @@ cs_lagr_stat_restart_write(cs_restart_t  *restart)
   if (_n_lagr_moments < 1)
     return;
 
+  _sync_deferred_moments();
+
   const cs_time_step_t  *ts = cs_glob_time_step;
 
   /* General information */
@@ -5747,8 +6216,10 @@ cs_lagr_stat_get_moment(int                    stat_type,
         && (   mwa->group   == stat_group
             || mwa->group   == CS_LAGR_STAT_GROUP_PARTICLE)
         && mt->class_id        == class_id
-        && mt->component_id == component_id)
+        && mt->component_id == component_id) {
+      _sync_deferred_moments();
       return cs_field_by_id(mt->f_id);
+    }
 
   }
 
@@ -216,6 +216,13 @@ typedef struct {
     features (such as the Poisson correction) */
   cs_real_t  threshold;
 
+  /*! if 1, only weighted sums of values (and squares) are accumulated for
+    particle-based moments at each time step, and means and variances are
+    computed from those only when required (for postprocessing, logging,
+    checkpointing, or access through \ref cs_lagr_stat_get_moment);
+    if 0 (default), moments are updated at each time step */
+  int  deferred;
+
 } cs_lagr_stat_options_t;
 
 /*============================================================================
@@ -44,6 +44,10 @@
 #include <float.h>
 #include <assert.h>
 
+#if defined(HAVE_OPENMP)
+#include <omp.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -55,7 +59,9 @@
 #include "fvm_periodicity.h"
 
 #include "cs_base.h"
+#include "cs_base_accel.h"
 #include "cs_boundary_zone.h"
+#include "cs_dispatch.h"
 #include "cs_physical_constants.h"
 #include "cs_geom.h"
 #include "cs_halo.h"
@@ -950,6 +956,43 @@ _internal_treatment(cs_lagr_particle_set_t  *particles,
   return particle_state;
 }
 
+/*----------------------------------------------------------------------------
+ * Return id of next event in an event set, making room if necessary.
+ *
+ * Full event sets are flushed to statistics, except inside a parallel
+ * region, where (thread-local) sets are enlarged instead; these are then
+ * merged into the main set after the parallel region.
+ *
+ * parameters:
+ *   events <-> events structure
+ *
+ * returns:
+ *   id of next event
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_next_event_id(cs_lagr_event_set_t  *events)
+{
+  cs_lnum_t event_id = events->n_events;
+
+  if (event_id >= events->n_events_max) {
+
+#if defined(HAVE_OPENMP)
+    if (omp_in_parallel()) {
+      cs_lagr_event_set_resize(events, CS_MAX(events->n_events_max*2, 16));
+      return event_id;
+    }
+#endif
+
+    cs_lagr_stat_update_event(events,
+                              CS_LAGR_STAT_GROUP_TRACKING_EVENT);
+    events->n_events = 0;
+    event_id = 0;
+  }
+
+  return event_id;
+}
+
 /*----------------------------------------------------------------------------
  * Add event when particle rolls off an interior face
  *
@@ -968,13 +1011,7 @@ _roll_off_event(cs_lagr_particle_set_t    *particles,
 {
   /* Get event id, flushing events if necessary */
 
-  cs_lnum_t event_id = events->n_events;
-  if (event_id >= events->n_events_max) {
-    cs_lagr_stat_update_event(events,
-                              CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-    events->n_events = 0;
-    event_id = 0;
-  }
+  cs_lnum_t event_id = _next_event_id(events);
   events->n_events += 1;
 
   /* Now set event values */
@@ -1103,14 +1140,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
   if (events != NULL) {
 
-    event_id = events->n_events;
-    if (event_id >= events->n_events_max) {
-      /* flush events */
-      cs_lagr_stat_update_event(events,
-                                CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-      events->n_events = 0;
-      event_id = 0;
-    }
+    event_id = _next_event_id(events);
 
     cs_lagr_event_init_from_particle(events, particles, event_id, p_id);
 
@@ -1783,14 +1813,17 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     cs_real_t fr =   particle_stat_weight
                    * cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
 
+    #pragma omp atomic
     bdy_conditions->particle_flow_rate[b_z_id*n_stats] -= fr;
 
     if (n_stats > 1) {
       int class_id
         = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
-      if (class_id > 0 && class_id < n_stats)
+      if (class_id > 0 && class_id < n_stats) {
+        #pragma omp atomic
         bdy_conditions->particle_flow_rate[  b_z_id*n_stats
                                            + class_id] -= fr;
+      }
     }
   }
 
@@ -1801,15 +1834,88 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
        || b_type == CS_LAGR_FOULING) {
 
     /* Number of particle-boundary interactions  */
-    if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0)
+    if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0) {
+      #pragma omp atomic
       bound_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
         += particle_stat_weight;
+    }
 
   }
 
   return particle_state;
 }
 
+/*----------------------------------------------------------------------------
+ * Check whether local particle propagation may be multithreaded.
+ *
+ * Propagation is threaded only when interactions do not modify other
+ * particles, draw random numbers, or call user functions.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh
+ *
+ * returns:
+ *   true if threading may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_use_threaded_propagation(const cs_mesh_t  *mesh)
+{
+  if (cs_glob_n_threads < 2 || cs_glob_lagr_model->clogging)
+    return false;
+
+  const char *b_type = cs_glob_lagr_boundary_conditions->elt_type;
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+    if (b_type[f_id] == CS_LAGR_FOULING || b_type[f_id] == CS_LAGR_BC_USER)
+      return false;
+  }
+
+  const cs_lagr_internal_condition_t *internal_conditions
+    = cs_glob_lagr_internal_conditions;
+  if (internal_conditions != NULL) {
+    for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+      if (internal_conditions->i_face_zone_id[f_id] == CS_LAGR_BC_USER)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Append events of a thread-local event set to a main event set,
+ * flushing the latter when full.
+ *
+ * parameters:
+ *   events   <-> main events structure
+ *   t_events <-> thread-local events structure (emptied on return)
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_event_set(cs_lagr_event_set_t  *events,
+                 cs_lagr_event_set_t  *t_events)
+{
+  const size_t extents = events->e_am->extents;
+
+  cs_lnum_t s_id = 0;
+  while (s_id < t_events->n_events) {
+    if (events->n_events >= events->n_events_max) {
+      cs_lagr_stat_update_event(events,
+                                CS_LAGR_STAT_GROUP_TRACKING_EVENT);
+      events->n_events = 0;
+    }
+    cs_lnum_t n = CS_MIN(t_events->n_events - s_id,
+                         events->n_events_max - events->n_events);
+    memcpy(events->e_buffer + extents*events->n_events,
+           t_events->e_buffer + extents*s_id,
+           extents*n);
+    events->n_events += n;
+    s_id += n;
+  }
+
+  t_events->n_events = 0;
+}
+
 /*----------------------------------------------------------------------------
  * Move a particle as far as possible while remaining on a given rank.
  *
@@ -2157,7 +2263,7 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
       */
 
       particle_state
-        = _internal_treatment(cs_glob_lagr_particle_set,
+        = _internal_treatment(particles,
                               p_id,
                               face_id,
                               t_intersect);
@@ -2264,85 +2370,230 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
 }
 
 /*----------------------------------------------------------------------------
- * Exchange counters on the number of particles to send and to receive
+ * Move particles across interior faces on the device, as long as no
+ * specific treatment is required.
+ *
+ * Particles are moved from cell to cell while their trajectory only crosses
+ * interior faces leading to local cells. Particles whose trajectory ends
+ * in the current cell are marked as treated; the others keep the
+ * CS_LAGR_PART_TO_SYNC state, with updated cell and last face ids, and are
+ * handled by _local_propagation on the host from that point on (boundary
+ * interactions, rank changes, and repositioning in case of tracking issues),
+ * so results are identical to those of a host-only propagation.
+ *
+ * This requires that no deposition model nor internal conditions be active.
  *
  * parameters:
- *  halo        <--  pointer to a cs_halo_t structure
- *  lag_halo    <--  pointer to a cs_lagr_halo_t structure
+ *   ctx                  <-> reference to dispatch context
+ *   particles            <-> pointer to particle set
+ *   particle_range       <-- start and past-the-end ids of tracked particles
+ *   displacement_step_id <-- id of displacement step
  *----------------------------------------------------------------------------*/
 
 static void
-_exchange_counter(const cs_halo_t  *halo,
-                  cs_lagr_halo_t   *lag_halo)
+_device_propagation(cs_dispatch_context     &ctx,
+                    cs_lagr_particle_set_t  *particles,
+                    const cs_lnum_t          particle_range[2],
+                    int                      displacement_step_id)
 {
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
 
-#if defined(HAVE_MPI)
-  if (cs_glob_n_ranks > 1) {
+  const int max_loops = _max_propagation_loops - displacement_step_id;
 
-    int  rank;
-    int  request_count = 0;
-    const int  local_rank = cs_glob_rank_id;
+  if (max_loops < 1 || ma->cell_i_faces == nullptr)
+    return;
 
-    /* Receive data from distant ranks */
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+
+  const cs_lnum_2_t *i_face_cells
+    = (const cs_lnum_2_t *)cs_get_device_ptr_const_pf(mesh->i_face_cells);
+  const cs_lnum_t *i_face_vtx_idx
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(mesh->i_face_vtx_idx);
+  const cs_lnum_t *i_face_vtx_lst
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(mesh->i_face_vtx_lst);
+  const cs_lnum_t *b_face_vtx_idx
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(mesh->b_face_vtx_idx);
+  const cs_lnum_t *b_face_vtx_lst
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(mesh->b_face_vtx_lst);
+  const cs_real_3_t *vtx_coord
+    = (const cs_real_3_t *)cs_get_device_ptr_const_pf(mesh->vtx_coord);
+
+  const cs_real_3_t *i_face_cog
+    = (const cs_real_3_t *)cs_get_device_ptr_const_pf(fvq->i_face_cog);
+  const cs_real_3_t *b_face_cog
+    = (const cs_real_3_t *)cs_get_device_ptr_const_pf(fvq->b_face_cog);
+  const cs_real_t *cell_vol
+    = (const cs_real_t *)cs_get_device_ptr_const_pf(fvq->cell_vol);
+
+  const cs_lnum_t *c2c_idx
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ma->cell_cells_idx);
+  const cs_lnum_t *c2i
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ma->cell_i_faces);
+  const cs_lnum_t *c2b_idx
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ma->cell_b_faces_idx);
+  const cs_lnum_t *c2b
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ma->cell_b_faces);
+  const cs_lnum_t *c2hb_idx = nullptr, *c2hb = nullptr;
+  if (ma->cell_hb_faces_idx != nullptr) {
+    c2hb_idx
+      = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ma->cell_hb_faces_idx);
+    c2hb = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ma->cell_hb_faces);
+  }
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const size_t extents = p_am->extents;
+  const ptrdiff_t cell_id_displ = p_am->displ[0][CS_LAGR_CELL_ID];
+  const ptrdiff_t coords_displ = p_am->displ[0][CS_LAGR_COORDS];
 
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Irecv(&(lag_halo->recv_count[rank]),
-                  1,
-                  CS_MPI_LNUM,
-                  halo->c_domain_rank[rank],
-                  halo->c_domain_rank[rank],
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
-      else
-        local_rank_id = rank;
+  cs_sync_h2d(particles->p_buffer);
+  unsigned char *p_buffer
+    = (unsigned char *)cs_get_device_ptr(particles->p_buffer);
 
-    }
+  const cs_lnum_t p_s_id = particle_range[0];
+  const cs_lnum_t n_p = particle_range[1] - particle_range[0];
 
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
+  ctx.parallel_for(n_p, [=] CS_F_HOST_DEVICE (cs_lnum_t p_idx) {
 
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm)
-#endif
+    unsigned char *particle = p_buffer + extents*(p_s_id + p_idx);
+    cs_lagr_tracking_info_t *p_info = (cs_lagr_tracking_info_t *)particle;
 
-    /* Send data to distant ranks */
+    if (p_info->state != CS_LAGR_PART_TO_SYNC)
+      return;
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+    cs_lnum_t *p_cell_id = (cs_lnum_t *)(particle + cell_id_displ);
+    const cs_real_t *prev_location = p_info->start_coords;
+    const cs_real_t *next_location
+      = (const cs_real_t *)(particle + coords_displ);
 
-      /* If this is not the local rank */
+    cs_lnum_t cell_id = *p_cell_id;
 
-      if (halo->c_domain_rank[rank] != local_rank)
-        MPI_Isend(&(lag_halo->send_count[rank]),
-                  1,
-                  CS_MPI_LNUM,
-                  halo->c_domain_rank[rank],
-                  local_rank,
-                  cs_glob_mpi_comm,
-                  &(lag_halo->request[request_count++]));
+    /* Dimension less test: no movement ? */
 
+    cs_real_t inv_ref_length = 1./pow(cell_vol[cell_id], 1./3.);
+    bool no_move = true;
+    for (int k = 0; k < 3; k++) {
+      if (fabs((next_location[k] - prev_location[k])*inv_ref_length) >= 1e-15)
+        no_move = false;
+    }
+    if (no_move) {
+      p_info->state = CS_LAGR_PART_TREATED;
+      return;
     }
 
-    /* Wait for all exchanges */
+    for (int n_loops = 0; n_loops < max_loops; n_loops++) {
+
+      cs_lnum_t exit_face = -1; /* id in [interior faces + boundary faces] */
+      double adist_min = 2.;
+      int n_in = 0, n_out = 0;
+
+      /* Interior faces */
+
+      for (cs_lnum_t j = c2c_idx[cell_id]; j < c2c_idx[cell_id+1]; j++) {
+        cs_lnum_t face_id = c2i[j];
+        int reorient_face = (cell_id == i_face_cells[face_id][1]) ? -1 : 1;
+        cs_lnum_t vtx_start = i_face_vtx_idx[face_id];
+        int n_crossings[2] = {0, 0};
+
+        double t = cs_geom_segment_intersect_face
+                     (reorient_face,
+                      i_face_vtx_idx[face_id+1] - vtx_start,
+                      i_face_vtx_lst + vtx_start,
+                      vtx_coord,
+                      i_face_cog[face_id],
+                      prev_location,
+                      next_location,
+                      n_crossings,
+                      nullptr);
+
+        n_in += n_crossings[0];
+        n_out += n_crossings[1];
+
+        if (t < adist_min && t >= 0) {
+          exit_face = face_id;
+          adist_min = t;
+        }
+      }
 
-    MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
+      /* Boundary faces (including isolated boundary faces) */
+
+      for (int k = 0; k < 2; k++) {
+        const cs_lnum_t *_idx = (k == 0) ? c2b_idx : c2hb_idx;
+        const cs_lnum_t *_ids = (k == 0) ? c2b : c2hb;
+        if (_idx == nullptr)
+          continue;
+        for (cs_lnum_t j = _idx[cell_id]; j < _idx[cell_id+1]; j++) {
+          cs_lnum_t face_id = _ids[j];
+          cs_lnum_t vtx_start = b_face_vtx_idx[face_id];
+          int n_crossings[2] = {0, 0};
+
+          double t = cs_geom_segment_intersect_face
+                       (1,
+                        b_face_vtx_idx[face_id+1] - vtx_start,
+                        b_face_vtx_lst + vtx_start,
+                        vtx_coord,
+                        b_face_cog[face_id],
+                        prev_location,
+                        next_location,
+                        n_crossings,
+                        nullptr);
+
+          n_in += n_crossings[0];
+          n_out += n_crossings[1];
+
+          if (t < adist_min && t >= 0) {
+            exit_face = face_id + n_i_faces;
+            adist_min = t;
+          }
+        }
+      }
 
-  }
-#endif /* defined(HAVE_MPI) */
+      /* Repositioning required: handled on host */
 
-  /* Copy local values in case of periodicity */
+      if (n_in != n_out || (n_in == 0 && n_out == 0))
+        return;
 
-  if (halo->n_transforms > 0)
-    if (local_rank_id > -1)
-      lag_halo->recv_count[local_rank_id] = lag_halo->send_count[local_rank_id];
+      if (exit_face < 0) {
+        p_info->state = CS_LAGR_PART_TREATED;
+        return;
+      }
+
+      /* Boundary interaction: handled on host */
+
+      if (exit_face >= n_i_faces)
+        return;
+
+      cs_lnum_t c_id1 = i_face_cells[exit_face][0];
+      cs_lnum_t c_id2 = i_face_cells[exit_face][1];
+      cs_lnum_t next_cell_id = (cell_id == c_id1) ? c_id2 : c_id1;
+
+      /* Rank change: handled on host */
+
+      if (next_cell_id >= n_cells)
+        return;
+
+      cell_id = next_cell_id;
+      *p_cell_id = cell_id;
+      p_info->last_face_id = exit_face;
+
+    }
+
+  });
 
+  ctx.wait();
+
+  cs_sync_d2h(particles->p_buffer);
 }
 
 /*----------------------------------------------------------------------------
  * Exchange particles
  *
+ * Messages are sent to all communicating ranks, even when empty, so that
+ * receive counts are determined from incoming message sizes rather than
+ * through a separate counts exchange.
+ *
  * parameters:
  *  halo           <-- pointer to a cs_halo_t structure
  *  lag_halo       <-> pointer to a cs_lagr_halo_t structure
@@ -2370,64 +2621,94 @@ _exchange_particles(const cs_halo_t         *halo,
 
 #if defined(HAVE_MPI)
 
+  int  request_count = 0;
+
   if (cs_glob_n_ranks > 1) {
 
-    int  rank;
-    int  request_count = 0;
     const int  local_rank = cs_glob_rank_id;
 
-    /* Receive data from distant ranks */
+    /* Send data to distant ranks */
+
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+      /* If this is not the local rank */
 
-      cs_lnum_t shift =   particles->n_particles
-                        + lag_halo->recv_shift[rank];
+      if (halo->c_domain_rank[rank] != local_rank) {
+        cs_lnum_t shift = lag_halo->send_shift[rank];
+        void  *send_buf = lag_halo->send_buf + tot_extents*shift;
+        MPI_Isend(send_buf,
+                  lag_halo->send_count[rank],
+                  _cs_mpi_particle_type,
+                  halo->c_domain_rank[rank],
+                  local_rank,
+                  cs_glob_mpi_comm,
+                  &(lag_halo->request[request_count++]));
+      }
+      else
+        local_rank_id = rank;
 
-      if (lag_halo->recv_count[rank] > 0) {
+    }
 
-        if (halo->c_domain_rank[rank] != local_rank) {
-          void  *recv_buf = particles->p_buffer + tot_extents*shift;
-          n_recv_particles += lag_halo->recv_count[rank];
-          MPI_Irecv(recv_buf,
-                    lag_halo->recv_count[rank],
-                    _cs_mpi_particle_type,
-                    halo->c_domain_rank[rank],
-                    halo->c_domain_rank[rank],
-                    cs_glob_mpi_comm,
-                    &(lag_halo->request[request_count++]));
-        }
-        else
-          local_rank_id = rank;
+    /* Determine receive counts from incoming messages */
 
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
+
+      if (halo->c_domain_rank[rank] != local_rank) {
+        MPI_Status  status;
+        int  count = 0;
+        MPI_Probe(halo->c_domain_rank[rank],
+                  halo->c_domain_rank[rank],
+                  cs_glob_mpi_comm,
+                  &status);
+        MPI_Get_count(&status, _cs_mpi_particle_type, &count);
+        lag_halo->recv_count[rank] = count;
       }
 
     }
 
-    /* We wait for posting all receives
-       (often recommended in the past, apparently not anymore) */
+  }
 
-#if 0
-    MPI_Barrier(cs_glob_mpi_comm);
-#endif
+#endif /* defined(HAVE_MPI) */
 
-    /* Send data to distant ranks */
+  /* Local values in case of periodicity */
 
-    for (rank = 0; rank < halo->n_c_domains; rank++) {
+  if (halo->n_transforms > 0)
+    if (local_rank_id > -1)
+      lag_halo->recv_count[local_rank_id] = lag_halo->send_count[local_rank_id];
 
-      /* If this is not the local rank */
+  /* Resize particle set if needed */
 
-      if (   halo->c_domain_rank[rank] != local_rank
-          && lag_halo->send_count[rank] > 0) {
-        cs_lnum_t shift = lag_halo->send_shift[rank];
-        void  *send_buf = lag_halo->send_buf + tot_extents*shift;
-        MPI_Isend(send_buf,
-                  lag_halo->send_count[rank],
+  cs_lnum_t  n_recv_tot = 0;
+
+  for (int rank = 0; rank < halo->n_c_domains; rank++) {
+    lag_halo->recv_shift[rank] = n_recv_tot;
+    n_recv_tot += lag_halo->recv_count[rank];
+  }
+
+  cs_lagr_particle_set_resize(particles->n_particles + n_recv_tot);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const int  local_rank = cs_glob_rank_id;
+
+    /* Receive data from distant ranks (including empty messages) */
+
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
+
+      if (halo->c_domain_rank[rank] != local_rank) {
+        cs_lnum_t shift =   particles->n_particles
+                          + lag_halo->recv_shift[rank];
+        void  *recv_buf = particles->p_buffer + tot_extents*shift;
+        n_recv_particles += lag_halo->recv_count[rank];
+        MPI_Irecv(recv_buf,
+                  lag_halo->recv_count[rank],
                   _cs_mpi_particle_type,
                   halo->c_domain_rank[rank],
-                  local_rank,
+                  halo->c_domain_rank[rank],
                   cs_glob_mpi_comm,
                   &(lag_halo->request[request_count++]));
-
       }
 
     }
@@ -2437,6 +2718,7 @@ _exchange_particles(const cs_halo_t         *halo,
     MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
 
   }
+
 #endif /* defined(HAVE_MPI) */
 
   /* Copy local values in case of periodicity */
@@ -2484,16 +2766,19 @@ _exchange_particles(const cs_halo_t         *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Determine particle halo sizes
+ * Determine particle halo send counts
  *
  * parameters:
  *   mesh           <-- pointer to associated mesh
  *   lag_halo       <-> pointer to particle halo structure to update
  *   particles      <-- set of particles to update
  *   particle_range <-- start and past-the-end ids of tracked particles
+ *
+ * returns:
+ *   number of particles to send
  *----------------------------------------------------------------------------*/
 
-static void
+static cs_lnum_t
 _lagr_halo_count(const cs_mesh_t               *mesh,
                  cs_lagr_halo_t                *lag_halo,
                  const cs_lagr_particle_set_t  *particles,
@@ -2501,7 +2786,7 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 {
   cs_lnum_t  i, ghost_id;
 
-  cs_lnum_t  n_recv_particles = 0, n_send_particles = 0;
+  cs_lnum_t  n_send_particles = 0;
 
   const cs_halo_t  *halo = mesh->halo;
 
@@ -2528,32 +2813,20 @@ _lagr_halo_count(const cs_mesh_t               *mesh,
 
   } /* End of loop on particles */
 
-  /* Exchange counters */
-
-  _exchange_counter(halo, lag_halo);
-
-  for (i = 0; i < halo->n_c_domains; i++) {
-    n_recv_particles += lag_halo->recv_count[i];
-    n_send_particles += lag_halo->send_count[i];
-  }
-
   lag_halo->send_shift[0] = 0;
-  lag_halo->recv_shift[0] = 0;
-
-  for (i = 1; i < halo->n_c_domains; i++) {
 
+  for (i = 1; i < halo->n_c_domains; i++)
     lag_halo->send_shift[i] =  lag_halo->send_shift[i-1]
                              + lag_halo->send_count[i-1];
 
-    lag_halo->recv_shift[i] =  lag_halo->recv_shift[i-1]
-                             + lag_halo->recv_count[i-1];
-
-  }
+  for (i = 0; i < halo->n_c_domains; i++)
+    n_send_particles += lag_halo->send_count[i];
 
-  /* Resize particle set and/or halo only if needed */
+  /* Resize halo only if needed */
 
-  cs_lagr_particle_set_resize(particles->n_particles + n_recv_particles);
   _resize_lagr_halo(lag_halo, n_send_particles);
+
+  return n_send_particles;
 }
 
 /*----------------------------------------------------------------------------
@@ -2601,13 +2874,32 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles,
 
   if (halo != NULL) {
 
-    _lagr_halo_count(mesh, lag_halo, particles, particle_range);
+    if (_lagr_halo_count(mesh, lag_halo, particles, particle_range) > 0)
+      continue_displacement = 1;
 
     for (i = 0; i < halo->n_c_domains; i++) {
       lag_halo->send_count[i] = 0;
     }
   }
 
+  /* Start global check for continuation (if no rank has particles
+     to send, exchanges may be skipped), overlapped with local updates */
+
+#if defined(HAVE_MPI)
+  int l_continue_displacement = continue_displacement;
+  MPI_Request c_request = MPI_REQUEST_NULL;
+
+  if (cs_glob_n_ranks > 1) {
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(&l_continue_displacement, &continue_displacement, 1,
+                   MPI_INT, MPI_MAX, cs_glob_mpi_comm, &c_request);
+#else
+    MPI_Allreduce(&l_continue_displacement, &continue_displacement, 1,
+                  MPI_INT, MPI_MAX, cs_glob_mpi_comm);
+#endif
+  }
+#endif
+
   /* Loop on particles, transferring particles to synchronize to send_buf
      for particle set, and removing particles that otherwise exited the domain */
 
@@ -2623,8 +2915,6 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles,
 
     if (cur_part_state == CS_LAGR_PART_TO_SYNC_NEXT) {
 
-      continue_displacement = 1;
-
       ghost_id =   cs_lagr_particles_get_lnum(particles, i, CS_LAGR_CELL_ID)
                  - halo->n_local_elts;
       rank = lag_halo->rank[ghost_id];
@@ -2812,13 +3102,16 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles,
   particles->n_part_merged += n_merged_particles;
   particles->weight_merged += merged_weight;
 
+#if defined(HAVE_MPI)
+  if (c_request != MPI_REQUEST_NULL)
+    MPI_Wait(&c_request, MPI_STATUS_IGNORE);
+#endif
+
   /* Exchange particles, then update set */
 
-  if (halo != NULL)
+  if (halo != NULL && continue_displacement)
     _exchange_particles(halo, lag_halo, particles, particle_range);
 
-  cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
-
   return continue_displacement;
 }
 
@@ -2845,6 +3138,11 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
 
   assert(am->lb >= sizeof(cs_lagr_tracking_info_t));
 
+  /* Particles in the displaced range may move or change cells */
+
+  particles->n_cell_sorted = CS_MIN(particles->n_cell_sorted,
+                                    particle_range[0]);
+
   /* Info for rotor-stator cases; the time step should actually
      be based on the global (non-Lagrangian) time step in case
      the two differ. Currently both are in lock-step; if one
@@ -2927,7 +3225,7 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
 }
 
 /*----------------------------------------------------------------------------
- * Update particle set structures: compact array.
+ * Update particle set structures: sort particles by cell.
  *
  * parameters:
  *   particles      <-> pointer to particle set structure
@@ -2936,74 +3234,17 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
 static void
 _finalize_displacement(cs_lagr_particle_set_t  *particles)
 {
-  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
-  const cs_lnum_t  n_cells = cs_glob_mesh->n_cells;
-
-  const cs_lnum_t n_particles = particles->n_particles;
-
-  cs_lnum_t *cell_idx;
-  unsigned char *swap_buffer;
-  size_t swap_buffer_size = p_am->extents * ((size_t)n_particles);
-
-  BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
-  BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
-
-  /* Cell index (count first) */
-
-  for (cs_lnum_t i = 0; i < n_cells+1; i++)
-    cell_idx[i] = 0;
-
-  /* Copy unordered particle data to buffer */
-
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-
+#if defined(DEBUG) && !defined(NDEBUG)
+  for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
     cs_lnum_t cur_part_state = _get_tracking_info(particles, i)->state;
-
     assert(   cur_part_state < CS_LAGR_PART_OUT
            && cur_part_state != CS_LAGR_PART_TO_SYNC);
-
-    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(particles, i,
-                                                   CS_LAGR_CELL_ID);
-
-    memcpy(swap_buffer + p_am->extents*i,
-           particles->p_buffer + p_am->extents*i,
-           p_am->extents);
-
-    cell_idx[cell_id+1] += 1;
-
   }
+#endif
 
-  /* Convert count to index */
-
-  for (cs_lnum_t i = 1; i < n_cells; i++)
-    cell_idx[i+1] += cell_idx[i];
-
-  assert(n_particles == cell_idx[n_cells]);
-
-  /* Now copy particle data and update some statistics */
-
-  const cs_lnum_t p_extents = particles->p_am->extents;
-  const cs_lnum_t cell_num_displ = particles->p_am->displ[0][CS_LAGR_CELL_ID];
-
-  for (cs_lnum_t i = 0; i < n_particles; i++) {
-
-    cs_lnum_t cell_id
-      = *((const cs_lnum_t *)(swap_buffer + p_extents*i + cell_num_displ));
-
-    assert(cell_id > -1);
-
-    cs_lnum_t particle_id = cell_idx[cell_id];
-
-    cell_idx[cell_id] += 1;
-
-    memcpy(particles->p_buffer + p_am->extents*particle_id,
-           swap_buffer + p_am->extents*i,
-           p_am->extents);
-
-  }
+  /* Counting sort by cell, also defining the cell -> particles index */
 
-  BFT_FREE(swap_buffer);
-  BFT_FREE(cell_idx);
+  cs_lagr_particle_set_sort_by_cell(particles);
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   bft_printf("\n Particle set after %s\n", __func__);
@@ -3052,6 +3293,28 @@ cs_lagr_tracking_initialize(void)
     _cs_mpi_particle_type = _define_particle_datatype(p_set->p_am);
   }
 #endif
+
+  /* Face -> vertices connectivity and vertex coordinates are used
+     by device-side tracking */
+
+  if (cs_get_device_id() > -1) {
+    cs_mesh_t *m = cs_glob_mesh;
+    const cs_alloc_mode_t amode = cs_alloc_mode_read_mostly;
+
+    CS_REALLOC_HD(m->i_face_vtx_idx, m->n_i_faces + 1, cs_lnum_t, amode);
+    CS_REALLOC_HD(m->i_face_vtx_lst, m->i_face_vtx_idx[m->n_i_faces],
+                  cs_lnum_t, amode);
+    CS_REALLOC_HD(m->b_face_vtx_idx, m->n_b_faces + 1, cs_lnum_t, amode);
+    CS_REALLOC_HD(m->b_face_vtx_lst, m->b_face_vtx_idx[m->n_b_faces],
+                  cs_lnum_t, amode);
+    CS_REALLOC_HD(m->vtx_coord, m->n_vertices*3, cs_real_t, amode);
+
+    cs_mem_advise_set_read_mostly(m->i_face_vtx_idx);
+    cs_mem_advise_set_read_mostly(m->i_face_vtx_lst);
+    cs_mem_advise_set_read_mostly(m->b_face_vtx_idx);
+    cs_mem_advise_set_read_mostly(m->b_face_vtx_lst);
+    cs_mem_advise_set_read_mostly(m->vtx_coord);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3103,38 +3366,102 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
 
   _initialize_displacement(particles, particle_range);
 
+  /* Device-side propagation, if possible */
+
+  cs_dispatch_context ctx;
+
+  const bool use_device = (   ctx.use_gpu()
+                           && lagr_model->deposition == 0
+                           && cs_glob_lagr_internal_conditions == NULL);
+
+  /* Host-side threading, if possible */
+
+  const bool use_threads = _use_threaded_propagation(mesh);
+
+  int n_t_events = (use_threads && events != NULL) ? cs_glob_n_threads : 1;
+  cs_lagr_event_set_t **t_events = NULL;
+  BFT_MALLOC(t_events, n_t_events, cs_lagr_event_set_t *);
+  t_events[0] = events;
+  for (int t_id = 1; t_id < n_t_events; t_id++)
+    t_events[t_id] = cs_lagr_event_set_create();
+
   /* Main loop on particles: global propagation */
 
   while (continue_displacement) {
 
     /* Local propagation */
-    for (cs_lnum_t i = particle_range[0]; i < particle_range[1]; i++) {
 
-      /* Local copies of the current and previous particles state vectors
-         to be used in case of the first pass of _local_propagation fails */
+    if (use_device)
+      _device_propagation(ctx, particles, particle_range,
+                          displacement_step_id);
+
+    const cs_lnum_t p_s_id = particle_range[0];
+    const cs_lnum_t p_e_id = particle_range[1];
+
+    #pragma omp parallel if (use_threads)
+    {
+      /* Thread-local copy of particle set counters, and events */
+
+      int t_id = 0;
+#if defined(HAVE_OPENMP)
+      t_id = omp_get_thread_num();
+#endif
+
+      cs_lagr_particle_set_t t_particles = *particles;
+      t_particles.n_part_dep = 0;
+      t_particles.n_part_fou = 0;
+      t_particles.weight_dep = 0;
+      t_particles.weight_fou = 0;
+
+      cs_lagr_particle_set_t *t_p_set = (use_threads) ? &t_particles : particles;
+      cs_lagr_event_set_t *t_p_events
+        = (t_id < n_t_events) ? t_events[t_id] : events;
+
+      #pragma omp for schedule(dynamic, CS_THR_MIN)
+      for (cs_lnum_t i = p_s_id; i < p_e_id; i++) {
 
-      cs_lagr_tracking_state_t cur_part_state
-        = _get_tracking_info(particles, i)->state;
+        /* Local copies of the current and previous particles state vectors
+           to be used in case of the first pass of _local_propagation fails */
 
-      if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
+        cs_lagr_tracking_state_t cur_part_state
+          = _get_tracking_info(t_p_set, i)->state;
 
-        /* Main particle displacement stage */
+        if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
 
-        cur_part_state =
-          (cs_lagr_tracking_state_t) _local_propagation(particles,
-                                                        events,
-                                                        i,
-                                                        displacement_step_id,
-                                                        failsafe_mode,
-                                                        b_face_zone_id,
-                                                        visc_length,
-                                                        u);
+          /* Main particle displacement stage */
 
-        _tracking_info(particles, i)->state = cur_part_state;
+          cur_part_state =
+            (cs_lagr_tracking_state_t) _local_propagation(t_p_set,
+                                                          t_p_events,
+                                                          i,
+                                                          displacement_step_id,
+                                                          failsafe_mode,
+                                                          b_face_zone_id,
+                                                          visc_length,
+                                                          u);
 
+          _tracking_info(t_p_set, i)->state = cur_part_state;
+
+        }
+
+      } /* End of loop on particles */
+
+      if (use_threads) {
+        #pragma omp critical
+        {
+          particles->n_part_dep += t_particles.n_part_dep;
+          particles->weight_dep += t_particles.weight_dep;
+          particles->n_part_fou += t_particles.n_part_fou;
+          particles->weight_fou += t_particles.weight_fou;
+        }
       }
 
-    } /* End of loop on particles */
+    } /* End of parallel region */
+
+    /* Merge thread-local events */
+
+    for (int t_id = 1; t_id < n_t_events; t_id++)
+      _merge_event_set(events, t_events[t_id]);
 
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
@@ -3153,6 +3480,10 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
 
   } /* End of while (global displacement) */
 
+  for (int t_id = 1; t_id < n_t_events; t_id++)
+    cs_lagr_event_set_destroy(&(t_events[t_id]));
+  BFT_FREE(t_events);
+
   /* Deposition sub-model additional loop */
 
   if (lagr_model->deposition > 0) {
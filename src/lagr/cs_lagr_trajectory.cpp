@@ -0,0 +1,582 @@
+/*============================================================================
+ * Buffered, compressed Lagrangian trajectory segments.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_mesh.h"
+#include "cs_parall.h"
+
+#include "cs_lagr_extract.h"
+#include "cs_lagr_particle.h"
+#include "cs_lagr_post.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_lagr_trajectory.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local types and structures
+ *============================================================================*/
+
+/* Buffered values of a given attribute */
+/*--------------------------------------*/
+
+typedef struct {
+
+  cs_lagr_attribute_t   attr;         /* Attribute id */
+  cs_datatype_t         datatype;     /* Attribute datatype */
+  int                   stride;       /* Number of values per particle */
+  size_t                elt_size;     /* Stored size of each value */
+
+  unsigned char        *vals;         /* Values at segment end and start
+                                         (real values stored as float) */
+
+} _traj_attr_buffer_t;
+
+/* Trajectory buffer */
+/*-------------------*/
+
+typedef struct {
+
+  int                   n_steps_max;  /* Number of time steps per chunk */
+  int                   n_steps;      /* Number of buffered time steps */
+  bool                  complete;     /* Is the current chunk complete ? */
+
+  double                quantum;      /* Position quantization step */
+  double                origin[3];    /* Quantization origin */
+
+  cs_lnum_t             n_segs;       /* Number of buffered segments */
+  cs_lnum_t             n_segs_max;   /* Allocated number of segments */
+
+  int32_t              *x;            /* Quantized segment end positions */
+  int16_t              *dx;           /* Quantized start to end deltas,
+                                         or INT16_MIN if escaped */
+
+  cs_lnum_t             n_esc;        /* Number of escaped deltas */
+  cs_lnum_t             n_esc_max;    /* Allocated number of escapes */
+  int32_t              *esc;          /* Escaped deltas */
+
+  int                   n_attrs;      /* Number of buffered attributes */
+  _traj_attr_buffer_t  *attrs;        /* Buffered attributes */
+
+} _traj_buffer_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static _traj_buffer_t  _traj_buffer = {
+  .n_steps_max = 1, .n_steps = 0, .complete = false,
+  .quantum = 0, .origin = {0, 0, 0},
+  .n_segs = 0, .n_segs_max = 0, .x = nullptr, .dx = nullptr,
+  .n_esc = 0, .n_esc_max = 0, .esc = nullptr,
+  .n_attrs = -1, .attrs = nullptr};
+
+/*=============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Define quantization origin and step based on mesh extents.
+ *
+ * The step is chosen (or checked) so that quantized positions fit
+ * in 32-bit integers.
+ *
+ * parameters:
+ *   tb <-> pointer to trajectory buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_quantization(_traj_buffer_t  *tb)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  double v_min[3] = {DBL_MAX, DBL_MAX, DBL_MAX};
+  double v_max[3] = {-DBL_MAX, -DBL_MAX, -DBL_MAX};
+
+  for (cs_lnum_t i = 0; i < m->n_vertices; i++) {
+    for (int j = 0; j < 3; j++) {
+      v_min[j] = CS_MIN(v_min[j], m->vtx_coord[i*3 + j]);
+      v_max[j] = CS_MAX(v_max[j], m->vtx_coord[i*3 + j]);
+    }
+  }
+
+  cs_parall_min(3, CS_DOUBLE, v_min);
+  cs_parall_max(3, CS_DOUBLE, v_max);
+
+  double extent = 0;
+  for (int j = 0; j < 3; j++) {
+    tb->origin[j] = v_min[j];
+    extent = CS_MAX(extent, v_max[j] - v_min[j]);
+  }
+
+  /* Keep a margin of a factor 2 for particles on or near the boundary */
+
+  const double q_min = extent / (double)(1 << 30);
+
+  if (tb->quantum <= 0)
+    tb->quantum = q_min;
+  else if (tb->quantum < q_min)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: trajectory quantization step %g too small\n"
+                "for mesh extents %g (minimum: %g)."),
+              __func__, tb->quantum, extent, q_min);
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize list of buffered attributes.
+ *
+ * Attributes buffered are those for which postprocessing is active.
+ *
+ * parameters:
+ *   tb    <-> pointer to trajectory buffer
+ *   p_set <-- pointer to particle set
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_attrs(_traj_buffer_t                *tb,
+            const cs_lagr_particle_set_t  *p_set)
+{
+  tb->n_attrs = 0;
+
+  for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++) {
+
+    cs_lagr_attribute_t attr = static_cast<cs_lagr_attribute_t>(i);
+
+    if (attr == CS_LAGR_COORDS || cs_lagr_post_get_attr(attr) == false)
+      continue;
+
+    size_t  extents, size;
+    ptrdiff_t  displ;
+    cs_datatype_t  datatype;
+    int  stride;
+
+    cs_lagr_get_attr_info(p_set, 0, attr,
+                          &extents, &size, &displ, &datatype, &stride);
+
+    if (stride == 0)
+      continue;
+
+    BFT_REALLOC(tb->attrs, tb->n_attrs + 1, _traj_attr_buffer_t);
+
+    _traj_attr_buffer_t *ab = tb->attrs + tb->n_attrs;
+
+    ab->attr = attr;
+    ab->datatype = datatype;
+    ab->stride = stride;
+    ab->elt_size = (datatype == CS_REAL_TYPE) ? sizeof(float) : size/stride;
+    ab->vals = nullptr;
+
+    tb->n_attrs += 1;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Ensure trajectory buffer may contain a given number of segments.
+ *
+ * parameters:
+ *   tb     <-> pointer to trajectory buffer
+ *   n_segs <-- required number of segments
+ *----------------------------------------------------------------------------*/
+
+static void
+_reserve_segments(_traj_buffer_t  *tb,
+                  cs_lnum_t        n_segs)
+{
+  if (n_segs <= tb->n_segs_max)
+    return;
+
+  cs_lnum_t n_segs_max = CS_MAX(tb->n_segs_max*2, n_segs);
+
+  BFT_REALLOC(tb->x, n_segs_max*3, int32_t);
+  BFT_REALLOC(tb->dx, n_segs_max*3, int16_t);
+
+  for (int i = 0; i < tb->n_attrs; i++) {
+    _traj_attr_buffer_t *ab = tb->attrs + i;
+    BFT_REALLOC(ab->vals, n_segs_max*2*ab->stride*ab->elt_size,
+                unsigned char);
+  }
+
+  tb->n_segs_max = n_segs_max;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define trajectory buffering options.
+ *
+ * When buffering is active (n_steps > 1), trajectory segments of
+ * successive time steps are accumulated in compressed form, and the
+ * trajectories post-processing mesh is only built and output once
+ * per chunk of n_steps time steps (and at the last time step).
+ *
+ * Segment end positions are quantized to 32-bit integers, and start
+ * positions are stored as 16-bit deltas relative to the end positions
+ * (with an escape to 32-bit values for large displacements). Real-valued
+ * attributes are stored in single precision.
+ *
+ * \param[in]  n_steps  number of time steps per output chunk
+ *                      (1 or less for no buffering)
+ * \param[in]  quantum  position quantization step, or 0 for automatic
+ *                      (based on the mesh extents)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_buffer_set_options(int     n_steps,
+                                      double  quantum)
+{
+  _traj_buffer_t *tb = &_traj_buffer;
+
+  if (tb->n_segs > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s should not be called once trajectories are buffered."),
+              __func__);
+
+  tb->n_steps_max = CS_MAX(n_steps, 1);
+  tb->quantum = quantum;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if trajectory buffering is active.
+ *
+ * \return  true if trajectory buffering is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_trajectory_buffer_is_active(void)
+{
+  return (_traj_buffer.n_steps_max > 1) ? true : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append current trajectory segments of a set of particles
+ *        to the trajectory buffer.
+ *
+ * If the previous chunk was complete, it is discarded first.
+ *
+ * \param[in]  p_set          pointer to particle set
+ * \param[in]  n_particles    number of particles in list
+ * \param[in]  particle_list  particle (1 to n) list, or NULL
+ * \param[in]  force_flush    if true, mark chunk as complete
+ *
+ * \return  true if the buffered chunk is complete and should be output
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_trajectory_buffer_append(const cs_lagr_particle_set_t  *p_set,
+                                 cs_lnum_t                      n_particles,
+                                 const cs_lnum_t                particle_list[],
+                                 bool                           force_flush)
+{
+  _traj_buffer_t *tb = &_traj_buffer;
+
+  if (tb->n_attrs < 0) {
+    _init_quantization(tb);
+    _init_attrs(tb, p_set);
+  }
+
+  if (tb->complete) {
+    tb->n_steps = 0;
+    tb->n_segs = 0;
+    tb->n_esc = 0;
+    tb->complete = false;
+  }
+
+  const cs_lnum_t s_id = tb->n_segs;
+
+  _reserve_segments(tb, s_id + n_particles);
+
+  /* Positions */
+
+  cs_real_t *seg_coords;
+  BFT_MALLOC(seg_coords, n_particles*6, cs_real_t);
+
+  cs_lagr_get_trajectory_values(p_set,
+                                CS_LAGR_COORDS,
+                                CS_REAL_TYPE,
+                                3,
+                                -1,
+                                n_particles,
+                                particle_list,
+                                seg_coords);
+
+  const double q_inv = 1. / tb->quantum;
+
+  cs_lnum_t n_esc = 0;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    int32_t *x = tb->x + (s_id + i)*3;
+    int16_t *dx = tb->dx + (s_id + i)*3;
+    for (int j = 0; j < 3; j++) {
+      x[j] = (int32_t)lround((seg_coords[i*6 + j] - tb->origin[j])*q_inv);
+      double d =   (seg_coords[i*6 + 3 + j] - tb->origin[j])*q_inv
+                 - (double)x[j];
+      long d_q = lround(d);
+      if (d_q > INT16_MAX || d_q <= INT16_MIN) {
+        dx[j] = INT16_MIN;
+        if (tb->n_esc + n_esc >= tb->n_esc_max) {
+          tb->n_esc_max = CS_MAX(tb->n_esc_max*2, 64);
+          BFT_REALLOC(tb->esc, tb->n_esc_max, int32_t);
+        }
+        tb->esc[tb->n_esc + n_esc] = (int32_t)d_q;
+        n_esc++;
+      }
+      else
+        dx[j] = (int16_t)d_q;
+    }
+  }
+
+  tb->n_esc += n_esc;
+
+  BFT_FREE(seg_coords);
+
+  /* Other attributes */
+
+  for (int a_id = 0; a_id < tb->n_attrs; a_id++) {
+
+    _traj_attr_buffer_t *ab = tb->attrs + a_id;
+
+    unsigned char *dest = ab->vals + s_id*2*ab->stride*ab->elt_size;
+
+    if (ab->datatype == CS_REAL_TYPE) {
+
+      cs_real_t *vals;
+      BFT_MALLOC(vals, n_particles*2*ab->stride, cs_real_t);
+
+      cs_lagr_get_trajectory_values(p_set,
+                                    ab->attr,
+                                    ab->datatype,
+                                    ab->stride,
+                                    -1,
+                                    n_particles,
+                                    particle_list,
+                                    vals);
+
+      float *_dest = (float *)dest;
+      for (cs_lnum_t i = 0; i < n_particles*2*ab->stride; i++)
+        _dest[i] = (float)vals[i];
+
+      BFT_FREE(vals);
+
+    }
+    else
+      cs_lagr_get_trajectory_values(p_set,
+                                    ab->attr,
+                                    ab->datatype,
+                                    ab->stride,
+                                    -1,
+                                    n_particles,
+                                    particle_list,
+                                    dest);
+
+  }
+
+  tb->n_segs += n_particles;
+  tb->n_steps += 1;
+
+  if (tb->n_steps >= tb->n_steps_max || force_flush)
+    tb->complete = true;
+
+  return tb->complete;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode buffered trajectory segment coordinates.
+ *
+ * For each segment, the end (current) position is followed by the
+ * start (previous) position, as with \ref cs_lagr_get_trajectory_values.
+ *
+ * \param[out]  coords  decoded coordinates (size: n_segments*2, allocated
+ *                      here, to be freed by the caller)
+ *
+ * \return  number of buffered segments
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_trajectory_buffer_get_coords(cs_coord_3_t  **coords)
+{
+  const _traj_buffer_t *tb = &_traj_buffer;
+
+  const cs_lnum_t n_segs = tb->n_segs;
+  const double q = tb->quantum;
+
+  cs_coord_3_t *_coords;
+  BFT_MALLOC(_coords, n_segs*2, cs_coord_3_t);
+
+  cs_lnum_t e_id = 0;
+
+  for (cs_lnum_t i = 0; i < n_segs; i++) {
+    const int32_t *x = tb->x + i*3;
+    const int16_t *dx = tb->dx + i*3;
+    for (int j = 0; j < 3; j++) {
+      int64_t x_s = x[j];
+      if (dx[j] == INT16_MIN)
+        x_s += tb->esc[e_id++];
+      else
+        x_s += dx[j];
+      _coords[i*2][j] = tb->origin[j] + x[j]*q;
+      _coords[i*2 + 1][j] = tb->origin[j] + x_s*q;
+    }
+  }
+
+  assert(e_id == tb->n_esc);
+
+  *coords = _coords;
+
+  return n_segs;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode buffered trajectory segment values of a given attribute.
+ *
+ * \param[in]   attr            attribute id
+ * \param[in]   datatype        associated value type
+ * \param[in]   stride          number of values per particle
+ * \param[in]   component_id    if -1 : extract the whole attribute
+ *                              if >0 : id of the component to extract
+ * \param[out]  segment_values  particle values at segment end and start
+ *                              (size: n_segments*2*stride)
+ *
+ * \return  true if attribute values are buffered, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_trajectory_buffer_get_values(cs_lagr_attribute_t  attr,
+                                     cs_datatype_t        datatype,
+                                     int                  stride,
+                                     int                  component_id,
+                                     void                *segment_values)
+{
+  const _traj_buffer_t *tb = &_traj_buffer;
+
+  const _traj_attr_buffer_t *ab = nullptr;
+  for (int i = 0; i < tb->n_attrs; i++) {
+    if (tb->attrs[i].attr == attr)
+      ab = tb->attrs + i;
+  }
+
+  if (ab == nullptr || ab->datatype != datatype || ab->stride != stride)
+    return false;
+
+  const int s_stride = ab->stride;
+  const int d_stride = (component_id == -1) ? s_stride : 1;
+  const int c_shift = (component_id == -1) ? 0 : component_id;
+
+  const cs_lnum_t n_vals = tb->n_segs*2;
+
+  if (datatype == CS_REAL_TYPE) {
+    const float *src = (const float *)ab->vals;
+    cs_real_t *dest = (cs_real_t *)segment_values;
+    for (cs_lnum_t i = 0; i < n_vals; i++) {
+      for (int j = 0; j < d_stride; j++)
+        dest[i*d_stride + j] = src[i*s_stride + c_shift + j];
+    }
+  }
+  else {
+    const size_t elt_size = ab->elt_size;
+    unsigned char *dest = (unsigned char *)segment_values;
+    for (cs_lnum_t i = 0; i < n_vals; i++)
+      memcpy(dest + i*d_stride*elt_size,
+             ab->vals + (i*s_stride + c_shift)*elt_size,
+             d_stride*elt_size);
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free trajectory buffer.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_buffer_finalize(void)
+{
+  _traj_buffer_t *tb = &_traj_buffer;
+
+  for (int i = 0; i < tb->n_attrs; i++)
+    BFT_FREE(tb->attrs[i].vals);
+  BFT_FREE(tb->attrs);
+
+  BFT_FREE(tb->x);
+  BFT_FREE(tb->dx);
+  BFT_FREE(tb->esc);
+
+  tb->n_attrs = -1;
+  tb->n_segs = 0;
+  tb->n_segs_max = 0;
+  tb->n_esc = 0;
+  tb->n_esc_max = 0;
+  tb->n_steps = 0;
+  tb->complete = false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,153 @@
+#ifndef __CS_LAGR_TRAJECTORY_H__
+#define __CS_LAGR_TRAJECTORY_H__
+
+/*============================================================================
+ * Buffered, compressed Lagrangian trajectory segments.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_base.h"
+#include "cs_lagr_particle.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define trajectory buffering options.
+ *
+ * When buffering is active (n_steps > 1), trajectory segments of
+ * successive time steps are accumulated in compressed form, and the
+ * trajectories post-processing mesh is only built and output once
+ * per chunk of n_steps time steps (and at the last time step).
+ *
+ * \param[in]  n_steps  number of time steps per output chunk
+ *                      (1 or less for no buffering)
+ * \param[in]  quantum  position quantization step, or 0 for automatic
+ *                      (based on the mesh extents)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_buffer_set_options(int     n_steps,
+                                      double  quantum);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if trajectory buffering is active.
+ *
+ * \return  true if trajectory buffering is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_trajectory_buffer_is_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append current trajectory segments of a set of particles
+ *        to the trajectory buffer.
+ *
+ * If the previous chunk was complete, it is discarded first.
+ *
+ * \param[in]  p_set          pointer to particle set
+ * \param[in]  n_particles    number of particles in list
+ * \param[in]  particle_list  particle (1 to n) list, or NULL
+ * \param[in]  force_flush    if true, mark chunk as complete
+ *
+ * \return  true if the buffered chunk is complete and should be output
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_trajectory_buffer_append(const cs_lagr_particle_set_t  *p_set,
+                                 cs_lnum_t                      n_particles,
+                                 const cs_lnum_t                particle_list[],
+                                 bool                           force_flush);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode buffered trajectory segment coordinates.
+ *
+ * For each segment, the end (current) position is followed by the
+ * start (previous) position, as with \ref cs_lagr_get_trajectory_values.
+ *
+ * \param[out]  coords  decoded coordinates (size: n_segments*2, allocated
+ *                      here, to be freed by the caller)
+ *
+ * \return  number of buffered segments
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_trajectory_buffer_get_coords(cs_coord_3_t  **coords);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Decode buffered trajectory segment values of a given attribute.
+ *
+ * \param[in]   attr            attribute id
+ * \param[in]   datatype        associated value type
+ * \param[in]   stride          number of values per particle
+ * \param[in]   component_id    if -1 : extract the whole attribute
+ *                              if >0 : id of the component to extract
+ * \param[out]  segment_values  particle values at segment end and start
+ *                              (size: n_segments*2*stride)
+ *
+ * \return  true if attribute values are buffered, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_lagr_trajectory_buffer_get_values(cs_lagr_attribute_t  attr,
+                                     cs_datatype_t        datatype,
+                                     int                  stride,
+                                     int                  component_id,
+                                     void                *segment_values);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free trajectory buffer.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_trajectory_buffer_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_LAGR_TRAJECTORY_H__ */
@@ -236,4 +236,48 @@ cs_meg_post_calculator(const char       *name,
 
 END_C_DECLS
 
+#if defined(__cplusplus)
+
+/*----------------------------------------------------------------------------
+ *  Additional C++ headers
+ *----------------------------------------------------------------------------*/
+
+#include <initializer_list>
+
+#include "cs_dispatch.h"
+
+/*=============================================================================
+ * Inline C++ functions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize a dispatch context for a generated MEG loop.
+ *
+ * The loop is run on the device only if all arrays it accesses are
+ * accessible from the device; otherwise, OpenMP threads are used.
+ *
+ * \param[in]  ptrs  arrays accessed in the loop (nullptr entries are ignored)
+ *
+ * \return  dispatch context
+ */
+/*----------------------------------------------------------------------------*/
+
+inline static cs_dispatch_context
+cs_meg_dispatch_context(std::initializer_list<const void *>  ptrs)
+{
+  cs_dispatch_context ctx;
+
+  for (const void *p : ptrs) {
+    if (p != nullptr && cs_check_device_ptr(p) == CS_ALLOC_HOST) {
+      ctx.set_use_gpu(false);
+      break;
+    }
+  }
+
+  return ctx;
+}
+
+#endif /* defined(__cplusplus) */
+
 #endif /* __CS_MEG_PROTOTYPES_H__ */
@@ -1276,6 +1276,7 @@ _print_join_info(cs_mesh_t  *mesh,
                  "    Max boxes by leaf:                        %8d\n"
                  "    Max ratio of linked boxes / init. boxes:  %8.5f\n"
                  "    Max ratio of boxes for distribution:      %8.5f\n"
+                 "    Bounding box search mode:                 %8d\n"
                  "    Merge step tolerance multiplier:          %8.5f\n"
                  "    Pre-merge factor:                         %8.5f\n"
                  "    Tolerance computation mode:               %8d\n"
@@ -1288,6 +1289,7 @@ _print_join_info(cs_mesh_t  *mesh,
                join_param.tree_n_max_boxes,
                join_param.tree_max_box_ratio,
                join_param.tree_max_box_ratio_distrib,
+               join_param.search_mode,
                join_param.merge_tol_coef,
                join_param.pre_merge_factor,
                join_param.tcm, join_param.icm,
@@ -1728,6 +1730,56 @@ cs_join_set_advanced_param(int      join_num,
                       tmr_distrib);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the face bounding box search mode for a joining operation.
+ *
+ * With mode `0` (default), intersecting face bounding boxes are determined
+ * using an octree-like structure, built after a Morton-based redistribution
+ * of boxes in parallel.
+ *
+ * With mode `1`, a uniform grid whose cell size is based on the mean
+ * bounding box size is used, and its cells are hashed over ranks. This
+ * avoids the coarse tree construction and redistribution steps, and is
+ * usually faster for conformal or nearly conformal joinings in which faces
+ * have similar sizes. The tree parameters are ignored in this case.
+ *
+ * \param[in]  join_num  joining operation number
+ * \param[in]  mode      search mode (0: box tree, 1: hashed grid)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_join_set_search_mode(int  join_num,
+                        int  mode)
+{
+  int  i, join_id = -1;
+  cs_join_t  *join = nullptr;
+
+  /* Search for the joining structure related to join_num */
+
+  for (i = 0; i < cs_glob_n_joinings; i++) {
+
+    join = cs_glob_join_array[i];
+    if (join_num == join->param.num) {
+      join_id = i;
+      break;
+    }
+
+  }
+
+  if (join_id < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("  Joining number %d is not defined.\n"), join_num);
+
+  if (mode != 0 && mode != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("  Forbidden value for the search mode parameter.\n"
+                "  It must be 0 or 1 and not: %d\n"), mode);
+
+  join->param.search_mode = mode;
+}
+
 /*----------------------------------------------------------------------------
  * Apply all the defined joining operations.
  *
@@ -106,6 +106,18 @@ cs_join_set_advanced_param(int      join_num,
                            double   tmr,
                            double   tmr_distrib);
 
+/*----------------------------------------------------------------------------
+ * Set the face bounding box search mode for a joining operation.
+ *
+ * parameters:
+ *   join_num <-- joining operation number
+ *   mode     <-- search mode (0: box tree, 1: hashed uniform grid)
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_set_search_mode(int  join_num,
+                        int  mode);
+
 /*----------------------------------------------------------------------------
  * Apply all the defined joining operations.
  *
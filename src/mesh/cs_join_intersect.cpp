@@ -3696,6 +3696,10 @@ cs_join_intersect_faces(const cs_join_param_t   param,
                                param.tree_max_box_ratio,
                                param.tree_max_box_ratio_distrib);
 
+  if (param.search_mode == 1)
+    fvm_neighborhood_set_method(face_neighborhood,
+                                FVM_NEIGHBORHOOD_HASHED_GRID);
+
   /* Allocate temporary extent arrays */
 
   BFT_MALLOC(f_extents, join_mesh->n_faces*6, cs_coord_t);
@@ -3726,8 +3730,12 @@ cs_join_intersect_faces(const cs_join_param_t   param,
                           stats);
 
   if (param.verbosity > 0) {
-    bft_printf(_("  Determination of possible face intersections:\n\n"
-                 "    bounding-box tree layout: %dD\n"), box_dim);
+    if (param.search_mode == 1)
+      bft_printf(_("  Determination of possible face intersections:\n\n"
+                   "    hashed uniform grid: %dD\n"), box_dim);
+    else
+      bft_printf(_("  Determination of possible face intersections:\n\n"
+                   "    bounding-box tree layout: %dD\n"), box_dim);
     bft_printf_flush();
   }
 
@@ -209,6 +209,12 @@ _join_param_define(int                      join_num,
    param.tree_max_box_ratio = 5.0;
    param.tree_max_box_ratio_distrib = 2.0;
 
+   /* Face bounding box search mode
+      0: (default) box tree
+      1: uniform grid with cells hashed over ranks */
+
+   param.search_mode = 0;
+
    /* Level of display */
 
    param.verbosity = verbosity;
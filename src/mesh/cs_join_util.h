@@ -134,6 +134,11 @@ typedef struct {
                                         initial coarse tree used to
                                         determine load-distribution */
 
+  int    search_mode;        /* Face bounding box search mode:
+                                0: (default) box tree
+                                1: uniform grid with cells hashed over
+                                   ranks (faster for similar face sizes) */
+
   /* Geometric parameters */
   /* -------------------- */
 
@@ -2864,6 +2864,10 @@ cs_mesh_init_halo(cs_mesh_t          *mesh,
     t2 = cs_timer_wtime();
     halo_time = t2-t1;
 
+    /* Choose best halo exchange mode for this mesh */
+
+    cs_halo_select_comm_mode(mesh->halo);
+
   } /* end if (mesh->n_domains > 1 || mesh->n_init_perio > 0) */
 
   /* Define a cell -> cells connectivity for the extended neighborhood
@@ -0,0 +1,545 @@
+/*============================================================================
+ * Adaptive mesh refinement and coarsening driven by error indicators.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_field.h"
+#include "cs_field_operator.h"
+#include "cs_file.h"
+#include "cs_halo.h"
+#include "cs_log.h"
+#include "cs_mesh_coarsen.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_refine.h"
+#include "cs_parall.h"
+#include "cs_preprocessor_data.h"
+#include "cs_restart.h"
+#include "cs_restart_map.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_adapt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_adapt.cpp
+        Adaptive mesh refinement and coarsening driven by error indicators.
+
+  As mesh-dependent structures (fields, matrices, coupling and
+  postprocessing meshes) are built once for a given computation,
+  adaptation is applied between restart segments: flags computed from
+  the indicator are saved with each checkpoint, and applied to the restart
+  mesh in the next run, which is then repartitioned. Fields are interpolated
+  from the previous mesh using the restart mapping.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char _flag_file_name[] = "mesh_adapt.csc";
+static const char _flag_section_name[] = "mesh_adapt:cell_flag";
+static const char _restart_mesh_path[] = "restart/mesh_input.csm";
+
+static cs_mesh_adapt_indicator_type_t _type = CS_MESH_ADAPT_INDICATOR_NONE;
+
+static char *_field_name = nullptr;
+
+static cs_mesh_adapt_indicator_t  *_indicator_func = nullptr;
+static void                       *_indicator_input = nullptr;
+
+static double _refine_threshold = 0.25;
+static double _coarsen_threshold = 0.05;
+static double _min_volume = 0;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return field associated with a built-in indicator.
+ *
+ * parameters:
+ *   dim <-- expected field dimension
+ *
+ * returns:
+ *   pointer to field
+ *----------------------------------------------------------------------------*/
+
+static const cs_field_t *
+_indicator_field(int  dim)
+{
+  const cs_field_t *f = cs_field_by_name_try(_field_name);
+
+  if (f == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: field \"%s\" is not defined."),
+              __func__, _field_name);
+
+  if (f->location_id != CS_MESH_LOCATION_CELLS || f->dim != dim)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: field \"%s\" should be a cell-based field\n"
+                "of dimension %d."),
+              __func__, _field_name, dim);
+
+  return f;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute maximum jump of a scalar field across interior faces.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh
+ *   indicator --> indicator per cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_indicator_jump(const cs_mesh_t  *m,
+                cs_real_t         indicator[])
+{
+  const cs_field_t *f = _indicator_field(1);
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  cs_real_t *val;
+  BFT_MALLOC(val, n_cells_ext, cs_real_t);
+  memcpy(val, f->val, n_cells*sizeof(cs_real_t));
+
+  if (m->halo != nullptr)
+    cs_halo_sync_var(m->halo, CS_HALO_STANDARD, val);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    indicator[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    cs_lnum_t c_id0 = m->i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = m->i_face_cells[f_id][1];
+    cs_real_t d = fabs(val[c_id1] - val[c_id0]);
+    if (c_id0 < n_cells && d > indicator[c_id0])
+      indicator[c_id0] = d;
+    if (c_id1 < n_cells && d > indicator[c_id1])
+      indicator[c_id1] = d;
+  }
+
+  BFT_FREE(val);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute vorticity magnitude of a vector field, scaled by cell size.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh
+ *   mq        <-- pointer to mesh quantities
+ *   indicator --> indicator per cell
+ *----------------------------------------------------------------------------*/
+
+static void
+_indicator_vorticity(const cs_mesh_t             *m,
+                     const cs_mesh_quantities_t  *mq,
+                     cs_real_t                    indicator[])
+{
+  const cs_field_t *f = _indicator_field(3);
+
+  cs_real_33_t *grad;
+  BFT_MALLOC(grad, m->n_cells_with_ghosts, cs_real_33_t);
+
+  cs_field_gradient_vector(f, false, 1, grad);
+
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+    const cs_real_t *g[3] = {grad[c_id][0], grad[c_id][1], grad[c_id][2]};
+    cs_real_t w[3] = {g[2][1] - g[1][2],
+                      g[0][2] - g[2][0],
+                      g[1][0] - g[0][1]};
+    indicator[c_id] =   sqrt(w[0]*w[0] + w[1]*w[1] + w[2]*w[2])
+                      * cbrt(mq->cell_vol[c_id]);
+  }
+
+  BFT_FREE(grad);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute adaptation flags for the current mesh.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh
+ *   mq        <-- pointer to mesh quantities
+ *   cell_flag --> 1 for refinement, -1 for coarsening, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_flags(const cs_mesh_t             *m,
+               const cs_mesh_quantities_t  *mq,
+               int                          cell_flag[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  cs_real_t *indicator;
+  BFT_MALLOC(indicator, n_cells, cs_real_t);
+
+  switch(_type) {
+  case CS_MESH_ADAPT_INDICATOR_JUMP:
+    _indicator_jump(m, indicator);
+    break;
+  case CS_MESH_ADAPT_INDICATOR_VORTICITY:
+    _indicator_vorticity(m, mq, indicator);
+    break;
+  case CS_MESH_ADAPT_INDICATOR_USER:
+    _indicator_func(_indicator_input, m, mq, indicator);
+    break;
+  default:
+    assert(0);
+  }
+
+  /* Normalize built-in indicators */
+
+  if (_type != CS_MESH_ADAPT_INDICATOR_USER) {
+    cs_real_t i_max = 0;
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (indicator[c_id] > i_max)
+        i_max = indicator[c_id];
+    }
+    cs_parall_max(1, CS_REAL_TYPE, &i_max);
+    if (i_max > 0) {
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        indicator[c_id] /= i_max;
+    }
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cell_flag[c_id] = 0;
+    if (indicator[c_id] > _refine_threshold) {
+      if (mq->cell_vol[c_id] > _min_volume)
+        cell_flag[c_id] = 1;
+    }
+    else if (indicator[c_id] < _coarsen_threshold)
+      cell_flag[c_id] = -1;
+  }
+
+  BFT_FREE(indicator);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the error indicator used for mesh adaptation.
+ *
+ * Adaptation is done in restart segments: cells are flagged based on the
+ * indicator each time a checkpoint is written, and the restart mesh is
+ * refined or coarsened accordingly when the computation is restarted,
+ * before partitioning. Fields are then interpolated from the previous
+ * mesh through restart mapping.
+ *
+ * For built-in indicators, values are normalized by their global maximum,
+ * so thresholds are in the [0, 1] range.
+ *
+ * \param[in]  type        indicator type
+ * \param[in]  field_name  name of associated field for built-in indicators
+ *                         (scalar for jump, vector for vorticity), or nullptr
+ * \param[in]  func        user indicator function, or nullptr
+ * \param[in]  input       pointer to user indicator input, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_define(cs_mesh_adapt_indicator_type_t   type,
+                     const char                      *field_name,
+                     cs_mesh_adapt_indicator_t       *func,
+                     void                            *input)
+{
+  if (   type == CS_MESH_ADAPT_INDICATOR_JUMP
+      || type == CS_MESH_ADAPT_INDICATOR_VORTICITY) {
+    if (field_name == nullptr)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: a field name is required for built-in indicators."),
+                __func__);
+  }
+  else if (type == CS_MESH_ADAPT_INDICATOR_USER && func == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: a function is required for user indicators."),
+              __func__);
+
+  _type = type;
+
+  BFT_FREE(_field_name);
+  if (field_name != nullptr) {
+    BFT_MALLOC(_field_name, strlen(field_name) + 1, char);
+    strcpy(_field_name, field_name);
+  }
+
+  _indicator_func = func;
+  _indicator_input = input;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set mesh adaptation thresholds.
+ *
+ * \param[in]  refine_threshold   cells with indicator above this value
+ *                                are refined
+ * \param[in]  coarsen_threshold  cells with indicator below this value
+ *                                are coarsened (if they result from a
+ *                                previous refinement)
+ * \param[in]  min_volume         cells with a volume below this value are
+ *                                not refined further (0 for no limit)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_thresholds(double  refine_threshold,
+                             double  coarsen_threshold,
+                             double  min_volume)
+{
+  if (coarsen_threshold > refine_threshold)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: coarsening threshold (%g) should not be larger\n"
+                "than refinement threshold (%g)."),
+              __func__, coarsen_threshold, refine_threshold);
+
+  _refine_threshold = refine_threshold;
+  _coarsen_threshold = coarsen_threshold;
+  _min_volume = min_volume;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute adaptation flags and write them to the checkpoint
+ *        directory.
+ *
+ * Does nothing if no indicator is defined.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_write_checkpoint(void)
+{
+  if (_type == CS_MESH_ADAPT_INDICATOR_NONE)
+    return;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  int *cell_flag;
+  BFT_MALLOC(cell_flag, m->n_cells, int);
+
+  _compute_flags(m, cs_glob_mesh_quantities, cell_flag);
+
+  cs_gnum_t n_flagged[2] = {0, 0};
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+    if (cell_flag[c_id] > 0)
+      n_flagged[0] += 1;
+    else if (cell_flag[c_id] < 0)
+      n_flagged[1] += 1;
+  }
+  cs_parall_counter(n_flagged, 2);
+
+  cs_restart_t *r = cs_restart_create(_flag_file_name,
+                                      nullptr,
+                                      CS_RESTART_MODE_WRITE);
+
+  cs_restart_write_section(r,
+                           _flag_section_name,
+                           CS_MESH_LOCATION_CELLS,
+                           1,
+                           CS_TYPE_int,
+                           cell_flag);
+
+  cs_restart_destroy(&r);
+
+  BFT_FREE(cell_flag);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n Mesh adaptation flags for next restart:\n"
+                  "   cells to refine:   %llu\n"
+                  "   cells to coarsen:  %llu\n"),
+                (unsigned long long)n_flagged[0],
+                (unsigned long long)n_flagged[1]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check whether adaptation flags from a previous run should be
+ *        applied to the restart mesh.
+ *
+ * \return  true if adaptation is pending, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_pending(void)
+{
+  if (   cs_preprocessor_data_get_restart_mode()
+      == CS_PREPROCESSOR_DATA_RESTART_NONE)
+    return false;
+
+  int retval = 0;
+
+  if (cs_glob_rank_id < 1) {
+    char path[] = "restart/mesh_adapt.csc";
+    retval = cs_file_isreg(path);
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&retval, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  return (retval != 0) ? true : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply adaptation flags from a previous run to the restart mesh.
+ *
+ * Refinement takes precedence: if any cell is flagged for refinement,
+ * coarsening flags are ignored for this restart. The mesh is marked for
+ * repartitioning, and restart files are mapped from the previous mesh.
+ *
+ * \param[in, out]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_apply(cs_mesh_t  *m)
+{
+  if (cs_mesh_adapt_pending() == false)
+    return;
+
+  cs_restart_t *r = cs_restart_create(_flag_file_name,
+                                      nullptr,
+                                      CS_RESTART_MODE_READ);
+
+  bool match_cell, match_i_face, match_b_face, match_vertex;
+  cs_restart_check_base_location(r, &match_cell, &match_i_face,
+                                 &match_b_face, &match_vertex);
+
+  if (match_cell == false) {
+    cs_restart_destroy(&r);
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Mesh adaptation flags in restart/%s do not match\n"
+                 "the restart mesh; they are ignored.\n"),
+               _flag_file_name);
+    return;
+  }
+
+  int *cell_flag;
+  BFT_MALLOC(cell_flag, m->n_cells, int);
+
+  int retcode = cs_restart_read_section(r,
+                                        _flag_section_name,
+                                        CS_MESH_LOCATION_CELLS,
+                                        1,
+                                        CS_TYPE_int,
+                                        cell_flag);
+
+  cs_restart_destroy(&r);
+
+  if (retcode != CS_RESTART_SUCCESS)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: error reading section \"%s\" in restart/%s."),
+              __func__, _flag_section_name, _flag_file_name);
+
+  cs_gnum_t n_flagged[2] = {0, 0};
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+    if (cell_flag[c_id] > 0)
+      n_flagged[0] += 1;
+    else if (cell_flag[c_id] < 0)
+      n_flagged[1] += 1;
+  }
+  cs_parall_counter(n_flagged, 2);
+
+  if (n_flagged[0] > 0) {
+    for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++) {
+      if (cell_flag[c_id] < 0)
+        cell_flag[c_id] = 0;
+    }
+
+    bft_printf(_("\n Mesh adaptation: refining %llu cells\n"),
+               (unsigned long long)n_flagged[0]);
+
+    cs_mesh_refine_simple(m, false, cell_flag);
+  }
+
+  else if (n_flagged[1] > 0) {
+    for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++)
+      cell_flag[c_id] = (cell_flag[c_id] < 0) ? 1 : 0;
+
+    bft_printf(_("\n Mesh adaptation: coarsening up to %llu cells\n"),
+               (unsigned long long)n_flagged[1]);
+
+    cs_mesh_coarsen_simple(m, cell_flag);
+  }
+
+  BFT_FREE(cell_flag);
+
+  /* Fields will be read from the previous mesh */
+
+  if (n_flagged[0] + n_flagged[1] > 0)
+    cs_restart_map_set_mesh_input(_restart_mesh_path);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,173 @@
+#ifndef __CS_MESH_ADAPT_H__
+#define __CS_MESH_ADAPT_H__
+
+/*============================================================================
+ * Adaptive mesh refinement and coarsening driven by error indicators.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Error indicator type */
+
+typedef enum {
+
+  CS_MESH_ADAPT_INDICATOR_NONE,       /*!< no adaptation (default) */
+  CS_MESH_ADAPT_INDICATOR_JUMP,       /*!< maximum jump of a scalar field
+                                        across interior faces */
+  CS_MESH_ADAPT_INDICATOR_VORTICITY,  /*!< vorticity magnitude of a vector
+                                        field, scaled by cell size */
+  CS_MESH_ADAPT_INDICATOR_USER        /*!< user-defined indicator */
+
+} cs_mesh_adapt_indicator_type_t;
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function pointer for user-defined error indicator.
+ *
+ * Cells whose indicator is above the refinement threshold are flagged for
+ * refinement, and those whose indicator is below the coarsening threshold
+ * are flagged for coarsening.
+ *
+ * \param[in, out]  input      pointer to optional (untyped) value or structure
+ * \param[in]       m          pointer to mesh
+ * \param[in]       mq         pointer to mesh quantities
+ * \param[out]      indicator  error indicator per cell (size: n_cells)
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_mesh_adapt_indicator_t) (void                        *input,
+                             const cs_mesh_t             *m,
+                             const cs_mesh_quantities_t  *mq,
+                             cs_real_t                    indicator[]);
+
+/*============================================================================
+ *  Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the error indicator used for mesh adaptation.
+ *
+ * Adaptation is done in restart segments: cells are flagged based on the
+ * indicator each time a checkpoint is written, and the restart mesh is
+ * refined or coarsened accordingly when the computation is restarted,
+ * before partitioning. Fields are then interpolated from the previous
+ * mesh through restart mapping.
+ *
+ * For built-in indicators, values are normalized by their global maximum,
+ * so thresholds are in the [0, 1] range.
+ *
+ * \param[in]  type        indicator type
+ * \param[in]  field_name  name of associated field for built-in indicators
+ *                         (scalar for jump, vector for vorticity), or nullptr
+ * \param[in]  func        user indicator function, or nullptr
+ * \param[in]  input       pointer to user indicator input, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_define(cs_mesh_adapt_indicator_type_t   type,
+                     const char                      *field_name,
+                     cs_mesh_adapt_indicator_t       *func,
+                     void                            *input);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set mesh adaptation thresholds.
+ *
+ * \param[in]  refine_threshold   cells with indicator above this value
+ *                                are refined
+ * \param[in]  coarsen_threshold  cells with indicator below this value
+ *                                are coarsened (if they result from a
+ *                                previous refinement)
+ * \param[in]  min_volume         cells with a volume below this value are
+ *                                not refined further (0 for no limit)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_set_thresholds(double  refine_threshold,
+                             double  coarsen_threshold,
+                             double  min_volume);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute adaptation flags and write them to the checkpoint
+ *        directory.
+ *
+ * Does nothing if no indicator is defined.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_write_checkpoint(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check whether adaptation flags from a previous run should be
+ *        applied to the restart mesh.
+ *
+ * \return  true if adaptation is pending, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_adapt_pending(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply adaptation flags from a previous run to the restart mesh.
+ *
+ * Refinement takes precedence: if any cell is flagged for refinement,
+ * coarsening flags are ignored for this restart. The mesh is marked for
+ * repartitioning, and restart files are mapped from the previous mesh.
+ *
+ * \param[in, out]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_apply(cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_ADAPT_H__ */
@@ -641,6 +641,120 @@ _update_cell_vertices(cs_mesh_adjacencies_t  *ma,
   BFT_REALLOC(c2v->ids, c2v->idx[n_cells], cs_lnum_t);
 }
 
+/*----------------------------------------------------------------------------
+ * Zigzag-encode a signed difference, so that small absolute values
+ * map to small unsigned values.
+ *
+ * parameters:
+ *   d <-- signed value
+ *
+ * returns:
+ *   encoded value
+ *----------------------------------------------------------------------------*/
+
+static inline uint64_t
+_zigzag(int64_t  d)
+{
+  return ((uint64_t)d << 1) ^ (uint64_t)(d >> 63);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of bytes needed to encode an unsigned value.
+ *
+ * parameters:
+ *   v <-- value to encode
+ *
+ * returns:
+ *   number of bytes
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_compact_uint_size(uint64_t  v)
+{
+  size_t n = 1;
+  while (v >= 0x80) {
+    v >>= 7;
+    n++;
+  }
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Encode an unsigned value using variable-length bytes.
+ *
+ * parameters:
+ *   v <-- value to encode
+ *   p <-- pointer to write position
+ *
+ * returns:
+ *   pointer to position following written bytes
+ *----------------------------------------------------------------------------*/
+
+static inline unsigned char *
+_compact_write_uint(uint64_t        v,
+                    unsigned char  *p)
+{
+  while (v >= 0x80) {
+    *p++ = (unsigned char)((v & 0x7f) | 0x80);
+    v >>= 7;
+  }
+  *p++ = (unsigned char)v;
+  return p;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of bytes needed to encode an element's adjacency.
+ *
+ * parameters:
+ *   elt_id <-- element id
+ *   idx    <-- adjacency index
+ *   ids    <-- adjacent ids
+ *
+ * returns:
+ *   number of bytes
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_compact_elt_size(cs_lnum_t         elt_id,
+                  const cs_lnum_t   idx[],
+                  const cs_lnum_t   ids[])
+{
+  size_t n = _compact_uint_size(idx[elt_id+1] - idx[elt_id]);
+
+  cs_lnum_t prev = elt_id;
+  for (cs_lnum_t j = idx[elt_id]; j < idx[elt_id+1]; j++) {
+    n += _compact_uint_size(_zigzag((int64_t)ids[j] - (int64_t)prev));
+    prev = ids[j];
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Update compressed connectivities.
+ *
+ * parameters:
+ *   ma <-> mesh adjacecies structure to update
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_compact(cs_mesh_adjacencies_t  *ma)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  cs_adjacency_compact_destroy(&(ma->cell_cells_c));
+  cs_adjacency_compact_destroy(&(ma->cell_i_faces_c));
+
+  ma->cell_cells_c = cs_adjacency_compact_create(n_cells,
+                                                 ma->cell_cells_idx,
+                                                 ma->cell_cells);
+
+  if (ma->cell_i_faces != nullptr)
+    ma->cell_i_faces_c = cs_adjacency_compact_create(n_cells,
+                                                     ma->cell_cells_idx,
+                                                     ma->cell_i_faces);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -691,6 +805,9 @@ cs_mesh_adjacencies_initialize(void)
   ma->c2v = nullptr;
   ma->_c2v = nullptr;
 
+  ma->cell_cells_c = nullptr;
+  ma->cell_i_faces_c = nullptr;
+
   cs_glob_mesh_adjacencies = ma;
 }
 
@@ -721,6 +838,9 @@ cs_mesh_adjacencies_finalize(void)
 
   cs_adjacency_destroy(&(ma->_c2v));
 
+  cs_adjacency_compact_destroy(&(ma->cell_cells_c));
+  cs_adjacency_compact_destroy(&(ma->cell_i_faces_c));
+
   cs_glob_mesh_adjacencies = nullptr;
 }
 
@@ -761,6 +881,11 @@ cs_mesh_adjacencies_update_mesh(void)
 
   if (ma->c2v != nullptr)
     _update_cell_vertices(ma, m);
+
+  /* (re)build compressed connectivities */
+
+  if (ma->cell_cells_c != nullptr)
+    _update_compact(ma);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -797,6 +922,26 @@ cs_mesh_adjacencies_update_cell_i_faces(void)
     _update_cell_i_faces(ma);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build or update compressed cell -> cells connectivity, and
+ *         compressed cell -> interior faces connectivity if the matching
+ *         uncompressed connectivity is present, in mesh adjacencies
+ *         helper API relative to mesh.
+ *
+ * Once built, these connectivities are updated with the mesh. They are
+ * host-only, and are decoded using \ref cs_adjacency_compact_get.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_compact(void)
+{
+  cs_mesh_adjacencies_t *ma = &_cs_glob_mesh_adjacencies;
+
+  _update_compact(ma);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Map some global mesh adjacency arrays for use on device.
@@ -1085,6 +1230,136 @@ cs_adjacency_destroy(cs_adjacency_t   **p_adj)
   *p_adj = nullptr;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Create a compressed copy of an indexed adjacency.
+ *
+ * \param[in]  n_elts  number of elements
+ * \param[in]  idx     index (size: n_elts + 1)
+ * \param[in]  ids     adjacent ids (size: idx[n_elts])
+ *
+ * \return  a pointer to a new allocated cs_adjacency_compact_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_adjacency_compact_t *
+cs_adjacency_compact_create(cs_lnum_t         n_elts,
+                            const cs_lnum_t   idx[],
+                            const cs_lnum_t   ids[])
+{
+  cs_adjacency_compact_t *ca = nullptr;
+  BFT_MALLOC(ca, 1, cs_adjacency_compact_t);
+
+  ca->n_elts = n_elts;
+  ca->max_count = 0;
+  ca->block_shift = 8;
+
+  /* Encoded size per element */
+
+  size_t *elt_size;
+  BFT_MALLOC(elt_size, n_elts, size_t);
+
+  cs_lnum_t max_count = 0;
+
+# pragma omp parallel for reduction(max:max_count) if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    elt_size[i] = _compact_elt_size(i, idx, ids);
+    max_count = CS_MAX(max_count, idx[i+1] - idx[i]);
+  }
+
+  ca->max_count = max_count;
+
+  /* Reduce block size until relative positions fit in 16 bits */
+
+  bool fit = false;
+
+  while (!fit) {
+    const cs_lnum_t b_size = (cs_lnum_t)1 << ca->block_shift;
+    fit = true;
+    size_t b_pos = 0;
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      if (i % b_size == 0)
+        b_pos = 0;
+      if (b_pos > UINT16_MAX) {
+        fit = false;
+        break;
+      }
+      b_pos += elt_size[i];
+    }
+    if (!fit) {
+      if (ca->block_shift == 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s: encoded data for a single element exceeds %d bytes."),
+                  __func__, (int)UINT16_MAX);
+      ca->block_shift -= 1;
+    }
+  }
+
+  /* Build block and element positions */
+
+  const cs_lnum_t n_blocks = (n_elts >> ca->block_shift) + 1;
+  const cs_lnum_t b_size = (cs_lnum_t)1 << ca->block_shift;
+
+  BFT_MALLOC(ca->block_pos, n_blocks + 1, size_t);
+  BFT_MALLOC(ca->elt_pos, n_elts, uint16_t);
+
+  ca->block_pos[0] = 0;
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    cs_lnum_t s_id = b_id*b_size;
+    cs_lnum_t e_id = CS_MIN(s_id + b_size, n_elts);
+    size_t b_pos = 0;
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      ca->elt_pos[i] = (uint16_t)b_pos;
+      b_pos += elt_size[i];
+    }
+    ca->block_pos[b_id+1] = ca->block_pos[b_id] + b_pos;
+  }
+
+  BFT_FREE(elt_size);
+
+  /* Encode data */
+
+  BFT_MALLOC(ca->data, ca->block_pos[n_blocks], unsigned char);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    unsigned char *p =   ca->data + ca->block_pos[i >> ca->block_shift]
+                       + ca->elt_pos[i];
+    p = _compact_write_uint(idx[i+1] - idx[i], p);
+    cs_lnum_t prev = i;
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++) {
+      p = _compact_write_uint(_zigzag((int64_t)ids[j] - (int64_t)prev), p);
+      prev = ids[j];
+    }
+  }
+
+  return ca;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Destroy a cs_adjacency_compact_t structure.
+ *
+ * \param[in, out]  p_ca   pointer of pointer to structure to destroy
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_adjacency_compact_destroy(cs_adjacency_compact_t  **p_ca)
+{
+  cs_adjacency_compact_t *ca = *p_ca;
+
+  if (ca == nullptr)
+    return;
+
+  BFT_FREE(ca->block_pos);
+  BFT_FREE(ca->elt_pos);
+  BFT_FREE(ca->data);
+
+  BFT_FREE(ca);
+  *p_ca = nullptr;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a new cs_adjacency_t structure from the composition of
@@ -77,6 +77,33 @@ typedef struct {
 
 } cs_adjacency_t;
 
+/*! Compressed indexed adjacency structure.
+ *
+ * For each element, the number of adjacent ids is stored first, followed
+ * by the differences between successive ids (the first one relative to
+ * the element id), zigzag-encoded in variable-length bytes (7 bits per
+ * byte). Elements are grouped in blocks, using a byte position per block
+ * and 16-bit positions relative to the block start per element, so
+ * that each element's list may be decoded independently.
+ *
+ * Sorted lists on renumbered meshes compress best, as most differences
+ * then fit in a single byte. */
+
+typedef struct {
+
+  cs_lnum_t       n_elts;       /*!< number of elements */
+  cs_lnum_t       max_count;    /*!< maximum number of ids per element */
+  int             block_shift;  /*!< log2 of number of elements per block */
+
+  size_t         *block_pos;    /*!< start position of block data
+                                     (size = n_blocks + 1) */
+  uint16_t       *elt_pos;      /*!< start position of element data relative
+                                     to its block (size = n_elts) */
+  unsigned char  *data;         /*!< encoded ids
+                                     (size = block_pos[n_blocks]) */
+
+} cs_adjacency_compact_t;
+
 /*! Additional mesh adjacencies build from mesh structure */
 
 typedef struct {
@@ -130,12 +157,86 @@ typedef struct {
   cs_adjacency_t        *_c2v;         /*!< cells to vertices adjacency if owner,
                                          NULL otherwise */
 
+  /* compressed connectivities, if requested */
+
+  cs_adjacency_compact_t  *cell_cells_c;    /*!< compressed cells to cells
+                                              adjacency, or NULL */
+  cs_adjacency_compact_t  *cell_i_faces_c;  /*!< compressed cells to interior
+                                              faces adjacency, or NULL */
+
 } cs_mesh_adjacencies_t;
 
 /*============================================================================
  *  Global variables
  *============================================================================*/
 
+/*============================================================================
+ * Inline public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Read a variable-length encoded unsigned value from a compressed
+ *         adjacency, and advance the read position.
+ *
+ * \param[in, out]  p  pointer to read position
+ *
+ * \return  decoded value
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline uint64_t
+cs_adjacency_compact_read_uint(const unsigned char  **p)
+{
+  const unsigned char *_p = *p;
+
+  uint64_t v = _p[0] & 0x7f;
+  int shift = 7;
+
+  while (*_p & 0x80) {
+    _p++;
+    v |= (uint64_t)(*_p & 0x7f) << shift;
+    shift += 7;
+  }
+
+  *p = _p + 1;
+
+  return v;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Decode the ids adjacent to an element in a compressed adjacency.
+ *
+ * \param[in]   ca      pointer to compressed adjacency structure
+ * \param[in]   elt_id  element id
+ * \param[out]  ids     adjacent ids (size: at least ca->max_count)
+ *
+ * \return  number of adjacent ids
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+cs_adjacency_compact_get(const cs_adjacency_compact_t  *ca,
+                         cs_lnum_t                      elt_id,
+                         cs_lnum_t                     *ids)
+{
+  const unsigned char *p =   ca->data
+                           + ca->block_pos[elt_id >> ca->block_shift]
+                           + ca->elt_pos[elt_id];
+
+  cs_lnum_t n = (cs_lnum_t)cs_adjacency_compact_read_uint(&p);
+  cs_lnum_t prev = elt_id;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    uint64_t z = cs_adjacency_compact_read_uint(&p);
+    prev += (cs_lnum_t)((int64_t)(z >> 1) ^ -(int64_t)(z & 1));
+    ids[i] = prev;
+  }
+
+  return n;
+}
+
 /* Read-only pointer to global mesh additional adjacencies structure */
 
 extern const cs_mesh_adjacencies_t  *cs_glob_mesh_adjacencies;
@@ -200,6 +301,21 @@ cs_mesh_adjacencies_update_cell_cells_e(void);
 void
 cs_mesh_adjacencies_update_cell_i_faces(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build or update compressed cell -> cells connectivity, and
+ *         compressed cell -> interior faces connectivity if the matching
+ *         uncompressed connectivity is present, in mesh adjacencies
+ *         helper API relative to mesh.
+ *
+ * Once built, these connectivities are updated with the mesh. They are
+ * host-only, and are decoded using \ref cs_adjacency_compact_get.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_compact(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Map some global mesh adjacency arrays for use on device.
@@ -310,6 +426,34 @@ cs_adjacency_create_from_i_arrays(cs_lnum_t     n_elts,
 void
 cs_adjacency_destroy(cs_adjacency_t   **p_adj);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Create a compressed copy of an indexed adjacency.
+ *
+ * \param[in]  n_elts  number of elements
+ * \param[in]  idx     index (size: n_elts + 1)
+ * \param[in]  ids     adjacent ids (size: idx[n_elts])
+ *
+ * \return  a pointer to a new allocated cs_adjacency_compact_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_adjacency_compact_t *
+cs_adjacency_compact_create(cs_lnum_t         n_elts,
+                            const cs_lnum_t   idx[],
+                            const cs_lnum_t   ids[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Destroy a cs_adjacency_compact_t structure.
+ *
+ * \param[in, out]  p_ca   pointer of pointer to structure to destroy
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_adjacency_compact_destroy(cs_adjacency_compact_t  **p_ca);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a new cs_adjacency_t structure from the composition of
@@ -150,6 +150,7 @@ cs_mesh_builder_create(void)
   mb->n_perio = 0;
 
   mb->have_cell_rank = false;
+  mb->n_cell_weights = 1;
 
   /* Temporary mesh data */
 
@@ -176,6 +177,7 @@ cs_mesh_builder_create(void)
   /* Optional partitioning info */
 
   mb->cell_rank = nullptr;
+  mb->cell_weight = nullptr;
 
   /* Block ranges for parallel distribution */
 
@@ -234,6 +236,7 @@ cs_mesh_builder_destroy(cs_mesh_builder_t  **mb)
     /* Optional partitioning info */
 
     BFT_FREE(_mb->cell_rank);
+    BFT_FREE(_mb->cell_weight);
 
     /* Block ranges for parallel distribution */
 
@@ -64,6 +64,8 @@ typedef struct {
   int           n_perio;               /* Number of periodicities */
 
   bool          have_cell_rank;        /* True if cell_rank array is defined */
+  int           n_cell_weights;        /* Number of weights (balance
+                                          constraints) per cell */
 
   /* Temporary mesh data */
 
@@ -90,6 +92,10 @@ typedef struct {
   /* Optional partitioning info */
 
   int          *cell_rank;               /* Partition id for each cell */
+  cs_real_t    *cell_weight;             /* Optional weights for each cell
+                                            (interleaved, n_cell_weights
+                                            per cell), or NULL for uniform
+                                            weights */
 
   /* Block ranges for parallel distribution */
 
@@ -0,0 +1,986 @@
+/*============================================================================
+ * Cache of preprocessed mesh (with halos and numbering) for a given
+ * number of ranks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_halo.h"
+#include "cs_interface.h"
+#include "cs_io.h"
+#include "cs_log.h"
+#include "cs_mesh.h"
+#include "cs_numbering.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_cache.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_cache.cpp
+        Cache of preprocessed mesh.
+
+  The cache stores, for each rank, the local mesh as it is after joining,
+  partitioning, halo construction and renumbering, so that runs on the same
+  number of ranks may skip those steps. Mesh quantities and adjacencies,
+  which depend on run options and are cheap to compute, are rebuilt.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define _CACHE_VERSION 2
+
+#define _CACHE_MAGIC_STRING "code_saturne mesh cache, R0"
+
+/* Directory name separator */
+
+#define DIR_SEPARATOR '/'
+
+/* Header values */
+
+enum {
+  _H_VERSION,
+  _H_N_RANKS,
+  _H_N_THREADS,
+  _H_RANK_ID,
+  _H_HALO_TYPE,
+  _H_DIM,
+  _H_TIME_DEP,
+  _H_HAVE_R_GEN,
+  _H_N_GROUPS,
+  _H_N_FAMILIES,
+  _H_N_MAX_FAMILY_ITEMS,
+  _H_HAVE_HALO,
+  _H_HAVE_CELL_CELLS,
+  _H_HAVE_GCELL_VTX,
+  _H_SIZE
+};
+
+/* Local dimensions */
+
+enum {
+  _L_N_CELLS,
+  _L_N_I_FACES,
+  _L_N_B_FACES,
+  _L_N_VERTICES,
+  _L_I_FACE_VTX_SIZE,
+  _L_B_FACE_VTX_SIZE,
+  _L_N_GHOST_CELLS,
+  _L_N_B_FACES_ALL,
+  _L_SIZE
+};
+
+/* Global dimensions */
+
+enum {
+  _G_N_CELLS,
+  _G_N_I_FACES,
+  _G_N_B_FACES,
+  _G_N_VERTICES,
+  _G_N_I_C_FACES,
+  _G_N_FREE_FACES,
+  _G_N_B_FACES_ALL,
+  _G_SIZE
+};
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_mesh_cache_mode_t  _mode = CS_MESH_CACHE_NONE;
+static char                 *_path = nullptr;
+
+/*=============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build name of cache file for the local rank.
+ *
+ * returns:
+ *   pointer to allocated file name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_cache_file_name(void)
+{
+  const char *path = (_path != nullptr) ? _path : "mesh_cache";
+
+  size_t l = strlen(path) + 32;
+  char *name;
+  BFT_MALLOC(name, l, char);
+
+  snprintf(name, l, "%s%crank_%05d.csc",
+           path, DIR_SEPARATOR, CS_MAX(cs_glob_rank_id, 0));
+  name[l-1] = '\0';
+
+  return name;
+}
+
+/*----------------------------------------------------------------------------
+ * Open local cache file.
+ *
+ * parameters:
+ *   name <-- file name
+ *   mode <-- read or write mode
+ *
+ * returns:
+ *   pointer to kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static cs_io_t *
+_open_file(const char    *name,
+           cs_io_mode_t   mode)
+{
+#if defined(HAVE_MPI)
+  return cs_io_initialize(name,
+                          _CACHE_MAGIC_STRING,
+                          mode,
+                          CS_FILE_STDIO_SERIAL,
+                          CS_IO_ECHO_NONE,
+                          MPI_INFO_NULL,
+                          MPI_COMM_NULL,
+                          MPI_COMM_NULL);
+#else
+  return cs_io_initialize(name,
+                          _CACHE_MAGIC_STRING,
+                          mode,
+                          CS_FILE_STDIO_SERIAL,
+                          CS_IO_ECHO_NONE);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Write a section to the local cache file.
+ *
+ * parameters:
+ *   outp     <-> output kernel IO structure
+ *   sec_name <-- section name
+ *   type     <-- element type
+ *   n_vals   <-- number of values
+ *   vals     <-- pointer to values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_section(cs_io_t        *outp,
+               const char     *sec_name,
+               cs_datatype_t   type,
+               size_t          n_vals,
+               const void     *vals)
+{
+  cs_io_write_global(sec_name, n_vals, 0, 0, 1, type, vals, outp);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a section from the local cache file.
+ *
+ * If n_vals points to a value other than SIZE_MAX, the number of values
+ * in the file must match it.
+ *
+ * parameters:
+ *   inp      <-> input kernel IO structure
+ *   sec_name <-- expected section name
+ *   type     <-- element type
+ *   n_vals   <-> expected number of values, or SIZE_MAX on input;
+ *                number of values read on output
+ *   vals     <-> pointer to values, or nullptr to allocate
+ *
+ * returns:
+ *   pointer to values
+ *----------------------------------------------------------------------------*/
+
+static void *
+_read_section(cs_io_t        *inp,
+              const char     *sec_name,
+              cs_datatype_t   type,
+              size_t         *n_vals,
+              void           *vals)
+{
+  cs_io_sec_header_t  header;
+
+  if (   cs_io_read_header(inp, &header) != 0
+      || strcmp(header.sec_name, sec_name) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh cache file \"%s\":\n"
+                "  section \"%s\" expected but not found."),
+              cs_io_get_name(inp), sec_name);
+
+  if (*n_vals != SIZE_MAX && (size_t)(header.n_vals) != *n_vals)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh cache file \"%s\":\n"
+                "  section \"%s\" has %llu values instead of %llu."),
+              cs_io_get_name(inp), sec_name,
+              (unsigned long long)(header.n_vals),
+              (unsigned long long)(*n_vals));
+
+  *n_vals = header.n_vals;
+
+  if (type == CS_LNUM_TYPE)
+    cs_io_set_cs_lnum(&header, inp);
+  else if (type == CS_GNUM_TYPE)
+    cs_io_set_cs_gnum(&header, inp);
+  else if (type == CS_INT_TYPE)
+    cs_io_set_int(&header, inp);
+  else if (type == CS_REAL_TYPE)
+    cs_io_assert_cs_real(&header, inp);
+
+  if (*n_vals == 0)
+    return vals;
+
+  return cs_io_read_global(&header, vals, inp);
+}
+
+/*----------------------------------------------------------------------------
+ * Write numbering information.
+ *
+ * Values are: type, vector size, number of threads, number of groups,
+ * number of groups not adjacent to halo, number of elements not adjacent
+ * to halo, then group index.
+ *
+ * parameters:
+ *   outp      <-> output kernel IO structure
+ *   sec_name  <-- section name
+ *   numbering <-- pointer to numbering structure, or nullptr
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_numbering(cs_io_t               *outp,
+                 const char            *sec_name,
+                 const cs_numbering_t  *numbering)
+{
+  if (numbering == nullptr) {
+    _write_section(outp, sec_name, CS_LNUM_TYPE, 0, nullptr);
+    return;
+  }
+
+  size_t n_idx = numbering->n_threads * numbering->n_groups * 2;
+
+  cs_lnum_t *vals;
+  BFT_MALLOC(vals, 7 + n_idx, cs_lnum_t);
+
+  vals[0] = numbering->type;
+  vals[1] = numbering->vector_size;
+  vals[2] = numbering->n_threads;
+  vals[3] = numbering->n_groups;
+  vals[4] = numbering->n_no_adj_halo_groups;
+  vals[5] = numbering->n_no_adj_halo_elts;
+  vals[6] = (numbering->colored) ? 1 : 0;
+
+  for (size_t i = 0; i < n_idx; i++)
+    vals[7 + i] = numbering->group_index[i];
+
+  _write_section(outp, sec_name, CS_LNUM_TYPE, 7 + n_idx, vals);
+
+  BFT_FREE(vals);
+}
+
+/*----------------------------------------------------------------------------
+ * Read numbering information.
+ *
+ * parameters:
+ *   inp      <-> input kernel IO structure
+ *   sec_name <-- section name
+ *
+ * returns:
+ *   pointer to numbering structure, or nullptr
+ *----------------------------------------------------------------------------*/
+
+static cs_numbering_t *
+_read_numbering(cs_io_t     *inp,
+                const char  *sec_name)
+{
+  size_t n_vals = SIZE_MAX;
+  cs_lnum_t *vals = (cs_lnum_t *)_read_section(inp, sec_name, CS_LNUM_TYPE,
+                                               &n_vals, nullptr);
+
+  if (n_vals == 0)
+    return nullptr;
+
+  cs_numbering_t  *numbering = nullptr;
+  BFT_MALLOC(numbering, 1, cs_numbering_t);
+
+  numbering->type = (cs_numbering_type_t)vals[0];
+  numbering->vector_size = vals[1];
+  numbering->n_threads = vals[2];
+  numbering->n_groups = vals[3];
+  numbering->n_no_adj_halo_groups = vals[4];
+  numbering->n_no_adj_halo_elts = vals[5];
+  numbering->colored = (vals[6] != 0) ? true : false;
+
+  size_t n_idx = numbering->n_threads * numbering->n_groups * 2;
+  assert(n_vals == 7 + n_idx);
+
+  BFT_MALLOC(numbering->group_index, n_idx, cs_lnum_t);
+  for (size_t i = 0; i < n_idx; i++)
+    numbering->group_index[i] = vals[7 + i];
+
+  BFT_FREE(vals);
+
+  return numbering;
+}
+
+/*----------------------------------------------------------------------------
+ * Write halo information.
+ *
+ * parameters:
+ *   outp <-> output kernel IO structure
+ *   halo <-- pointer to halo structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_halo(cs_io_t          *outp,
+            const cs_halo_t  *halo)
+{
+  const int n_c_domains = halo->n_c_domains;
+
+  cs_lnum_t sizes[5] = {halo->n_local_elts,
+                        halo->n_send_elts[0], halo->n_send_elts[1],
+                        halo->n_elts[0], halo->n_elts[1]};
+
+  _write_section(outp, "halo_sizes", CS_LNUM_TYPE, 5, sizes);
+  _write_section(outp, "halo_c_domain_rank", CS_INT_TYPE,
+                 n_c_domains, halo->c_domain_rank);
+  _write_section(outp, "halo_send_index", CS_LNUM_TYPE,
+                 2*n_c_domains + 1, halo->send_index);
+  _write_section(outp, "halo_send_list", CS_LNUM_TYPE,
+                 halo->n_send_elts[1], halo->send_list);
+  _write_section(outp, "halo_index", CS_LNUM_TYPE,
+                 2*n_c_domains + 1, halo->index);
+}
+
+/*----------------------------------------------------------------------------
+ * Read halo information and build halo.
+ *
+ * The halo is based on the vertex interface set, whose ranks must match
+ * the cached ones.
+ *
+ * parameters:
+ *   inp  <-> input kernel IO structure
+ *   mesh <-> pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_halo(cs_io_t    *inp,
+           cs_mesh_t  *mesh)
+{
+  cs_halo_t *halo = cs_halo_create(mesh->vtx_interfaces);
+
+  const int n_c_domains = halo->n_c_domains;
+
+  cs_lnum_t sizes[5];
+  size_t n_vals = 5;
+  _read_section(inp, "halo_sizes", CS_LNUM_TYPE, &n_vals, sizes);
+
+  int *c_domain_rank = nullptr;
+  n_vals = n_c_domains;
+  c_domain_rank = (int *)_read_section(inp, "halo_c_domain_rank", CS_INT_TYPE,
+                                       &n_vals, nullptr);
+
+  for (int i = 0; i < n_c_domains; i++) {
+    if (c_domain_rank[i] != halo->c_domain_rank[i])
+      bft_error(__FILE__, __LINE__, 0,
+                _("Mesh cache file \"%s\":\n"
+                  "  halo ranks do not match vertex interfaces."),
+                cs_io_get_name(inp));
+  }
+
+  BFT_FREE(c_domain_rank);
+
+  halo->n_local_elts = sizes[0];
+  halo->n_send_elts[0] = sizes[1];
+  halo->n_send_elts[1] = sizes[2];
+  halo->n_elts[0] = sizes[3];
+  halo->n_elts[1] = sizes[4];
+
+  n_vals = 2*n_c_domains + 1;
+  _read_section(inp, "halo_send_index", CS_LNUM_TYPE,
+                &n_vals, halo->send_index);
+
+  CS_MALLOC_HD(halo->send_list, halo->n_send_elts[1], cs_lnum_t,
+               cs_halo_get_buffer_alloc_mode());
+
+  n_vals = halo->n_send_elts[1];
+  _read_section(inp, "halo_send_list", CS_LNUM_TYPE,
+                &n_vals, halo->send_list);
+
+  n_vals = 2*n_c_domains + 1;
+  _read_section(inp, "halo_index", CS_LNUM_TYPE,
+                &n_vals, halo->index);
+
+  cs_halo_create_complete(halo);
+
+  cs_halo_select_comm_mode(halo);
+
+  mesh->halo = halo;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define mesh cache usage.
+ *
+ * The mesh cache contains the mesh as it is after joining, partitioning,
+ * halo construction and renumbering, with one file per rank. It may only
+ * be used by runs with the same number of ranks, threads and halo type,
+ * and should be removed (or rewritten) when the mesh inputs or
+ * preprocessing options change.
+ *
+ * \param[in]  mode  mesh cache usage mode
+ * \param[in]  path  cache directory, or nullptr for default ("mesh_cache")
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_set_mode(cs_mesh_cache_mode_t   mode,
+                       const char            *path)
+{
+  _mode = mode;
+
+  BFT_FREE(_path);
+  if (path != nullptr) {
+    BFT_MALLOC(_path, strlen(path) + 1, char);
+    strcpy(_path, path);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return mesh cache usage mode.
+ *
+ * \return  mesh cache usage mode
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_cache_mode_t
+cs_mesh_cache_get_mode(void)
+{
+  return _mode;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh from cache if available and compatible.
+ *
+ * The mesh should be empty when calling this function. If no compatible
+ * cache is found on all ranks, the mesh is not modified and false is
+ * returned.
+ *
+ * \param[in, out]  mesh       pointer to mesh structure
+ * \param[in]       halo_type  expected halo type
+ *
+ * \return  true if the mesh was read from cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cache_read(cs_mesh_t       *mesh,
+                   cs_halo_type_t   halo_type)
+{
+  if (_mode != CS_MESH_CACHE_AUTO)
+    return false;
+
+  double t0 = cs_timer_wtime();
+
+  char *name = _cache_file_name();
+
+  cs_io_t *inp = nullptr;
+  int hdr[_H_SIZE];
+
+  /* Check compatibility of cache on all ranks */
+
+  int ok = 0;
+
+  if (cs_file_isreg(name)) {
+    inp = _open_file(name, CS_IO_MODE_READ);
+
+    size_t n_vals = _H_SIZE;
+    _read_section(inp, "header", CS_INT_TYPE, &n_vals, hdr);
+
+    if (   hdr[_H_VERSION] == _CACHE_VERSION
+        && hdr[_H_N_RANKS] == cs_glob_n_ranks
+        && hdr[_H_N_THREADS] == cs_glob_n_threads
+        && hdr[_H_RANK_ID] == CS_MAX(cs_glob_rank_id, 0)
+        && hdr[_H_HALO_TYPE] == (int)halo_type
+        && hdr[_H_DIM] == mesh->dim)
+      ok = 1;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int l_ok = ok;
+    MPI_Allreduce(&l_ok, &ok, 1, MPI_INT, MPI_MIN, cs_glob_mpi_comm);
+  }
+#endif
+
+  if (ok == 0) {
+    if (inp != nullptr)
+      cs_io_finalize(&inp);
+    bft_printf(_("\n No compatible mesh cache found in \"%s\".\n"),
+               (_path != nullptr) ? _path : "mesh_cache");
+    BFT_FREE(name);
+    return false;
+  }
+
+  BFT_FREE(name);
+
+  /* Dimensions */
+
+  cs_lnum_t l_sizes[_L_SIZE];
+  cs_gnum_t g_sizes[_G_SIZE];
+
+  size_t n_vals = _L_SIZE;
+  _read_section(inp, "local_sizes", CS_LNUM_TYPE, &n_vals, l_sizes);
+  n_vals = _G_SIZE;
+  _read_section(inp, "global_sizes", CS_GNUM_TYPE, &n_vals, g_sizes);
+
+  mesh->time_dep = (cs_mesh_time_dep_t)hdr[_H_TIME_DEP];
+
+  mesh->n_cells = l_sizes[_L_N_CELLS];
+  mesh->n_i_faces = l_sizes[_L_N_I_FACES];
+  mesh->n_b_faces = l_sizes[_L_N_B_FACES];
+  mesh->n_vertices = l_sizes[_L_N_VERTICES];
+  mesh->i_face_vtx_connect_size = l_sizes[_L_I_FACE_VTX_SIZE];
+  mesh->b_face_vtx_connect_size = l_sizes[_L_B_FACE_VTX_SIZE];
+  mesh->n_ghost_cells = l_sizes[_L_N_GHOST_CELLS];
+  mesh->n_cells_with_ghosts = mesh->n_cells + mesh->n_ghost_cells;
+  mesh->n_b_faces_all = l_sizes[_L_N_B_FACES_ALL];
+
+  mesh->n_g_cells = g_sizes[_G_N_CELLS];
+  mesh->n_g_i_faces = g_sizes[_G_N_I_FACES];
+  mesh->n_g_b_faces = g_sizes[_G_N_B_FACES];
+  mesh->n_g_vertices = g_sizes[_G_N_VERTICES];
+  mesh->n_g_i_c_faces = g_sizes[_G_N_I_C_FACES];
+  mesh->n_g_free_faces = g_sizes[_G_N_FREE_FACES];
+  mesh->n_g_b_faces_all = g_sizes[_G_N_B_FACES_ALL];
+
+  mesh->halo_type = halo_type;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+  /* Connectivity and coordinates */
+
+  n_vals = n_vertices*3;
+  mesh->vtx_coord = (cs_real_t *)_read_section(inp, "vtx_coord", CS_REAL_TYPE,
+                                               &n_vals, nullptr);
+
+  n_vals = n_i_faces*2;
+  mesh->i_face_cells
+    = (cs_lnum_2_t *)_read_section(inp, "i_face_cells", CS_LNUM_TYPE,
+                                   &n_vals, nullptr);
+  n_vals = n_b_faces;
+  mesh->b_face_cells
+    = (cs_lnum_t *)_read_section(inp, "b_face_cells", CS_LNUM_TYPE,
+                                 &n_vals, nullptr);
+
+  n_vals = n_i_faces + 1;
+  mesh->i_face_vtx_idx
+    = (cs_lnum_t *)_read_section(inp, "i_face_vtx_idx", CS_LNUM_TYPE,
+                                 &n_vals, nullptr);
+  n_vals = mesh->i_face_vtx_connect_size;
+  mesh->i_face_vtx_lst
+    = (cs_lnum_t *)_read_section(inp, "i_face_vtx_lst", CS_LNUM_TYPE,
+                                 &n_vals, nullptr);
+
+  n_vals = n_b_faces + 1;
+  mesh->b_face_vtx_idx
+    = (cs_lnum_t *)_read_section(inp, "b_face_vtx_idx", CS_LNUM_TYPE,
+                                 &n_vals, nullptr);
+  n_vals = mesh->b_face_vtx_connect_size;
+  mesh->b_face_vtx_lst
+    = (cs_lnum_t *)_read_section(inp, "b_face_vtx_lst", CS_LNUM_TYPE,
+                                 &n_vals, nullptr);
+
+  /* Global numbering (absent in serial mode) */
+
+  n_vals = SIZE_MAX;
+  mesh->global_cell_num
+    = (cs_gnum_t *)_read_section(inp, "global_cell_num", CS_GNUM_TYPE,
+                                 &n_vals, nullptr);
+  n_vals = SIZE_MAX;
+  mesh->global_i_face_num
+    = (cs_gnum_t *)_read_section(inp, "global_i_face_num", CS_GNUM_TYPE,
+                                 &n_vals, nullptr);
+  n_vals = SIZE_MAX;
+  mesh->global_b_face_num
+    = (cs_gnum_t *)_read_section(inp, "global_b_face_num", CS_GNUM_TYPE,
+                                 &n_vals, nullptr);
+  n_vals = SIZE_MAX;
+  mesh->global_vtx_num
+    = (cs_gnum_t *)_read_section(inp, "global_vtx_num", CS_GNUM_TYPE,
+                                 &n_vals, nullptr);
+
+  /* Groups and families */
+
+  mesh->n_groups = hdr[_H_N_GROUPS];
+  mesh->n_families = hdr[_H_N_FAMILIES];
+  mesh->n_max_family_items = hdr[_H_N_MAX_FAMILY_ITEMS];
+
+  if (mesh->n_groups > 0) {
+    n_vals = mesh->n_groups + 1;
+    mesh->group_idx = (int *)_read_section(inp, "group_idx", CS_INT_TYPE,
+                                           &n_vals, nullptr);
+    n_vals = mesh->group_idx[mesh->n_groups];
+    mesh->group = (char *)_read_section(inp, "group", CS_CHAR,
+                                        &n_vals, nullptr);
+  }
+
+  n_vals = (size_t)(mesh->n_families) * mesh->n_max_family_items;
+  mesh->family_item = (int *)_read_section(inp, "family_item", CS_INT_TYPE,
+                                           &n_vals, nullptr);
+
+  n_vals = SIZE_MAX;
+  mesh->cell_family = (int *)_read_section(inp, "cell_family", CS_INT_TYPE,
+                                           &n_vals, nullptr);
+  n_vals = SIZE_MAX;
+  mesh->i_face_family = (int *)_read_section(inp, "i_face_family", CS_INT_TYPE,
+                                             &n_vals, nullptr);
+  n_vals = SIZE_MAX;
+  mesh->b_face_family = (int *)_read_section(inp, "b_face_family", CS_INT_TYPE,
+                                             &n_vals, nullptr);
+
+  /* Refinement info */
+
+  if (hdr[_H_HAVE_R_GEN]) {
+    mesh->have_r_gen = true;
+    n_vals = n_i_faces;
+    mesh->i_face_r_gen = (char *)_read_section(inp, "i_face_r_gen", CS_CHAR,
+                                               &n_vals, nullptr);
+    n_vals = n_vertices;
+    mesh->vtx_r_gen = (char *)_read_section(inp, "vtx_r_gen", CS_CHAR,
+                                            &n_vals, nullptr);
+  }
+
+  /* Parallel structures */
+
+  if (cs_glob_n_ranks > 1)
+    mesh->vtx_interfaces = cs_interface_set_create(n_vertices,
+                                                   nullptr,
+                                                   mesh->global_vtx_num,
+                                                   nullptr,
+                                                   0,
+                                                   nullptr,
+                                                   nullptr,
+                                                   nullptr);
+
+  if (hdr[_H_HAVE_HALO])
+    _read_halo(inp, mesh);
+
+  /* Extended neighborhood */
+
+  if (hdr[_H_HAVE_CELL_CELLS]) {
+    n_vals = n_cells + 1;
+    mesh->cell_cells_idx
+      = (cs_lnum_t *)_read_section(inp, "cell_cells_idx", CS_LNUM_TYPE,
+                                   &n_vals, nullptr);
+    n_vals = mesh->cell_cells_idx[n_cells];
+    mesh->cell_cells_lst
+      = (cs_lnum_t *)_read_section(inp, "cell_cells_lst", CS_LNUM_TYPE,
+                                   &n_vals, nullptr);
+  }
+
+  if (hdr[_H_HAVE_GCELL_VTX]) {
+    n_vals = mesh->n_ghost_cells + 1;
+    mesh->gcell_vtx_idx
+      = (cs_lnum_t *)_read_section(inp, "gcell_vtx_idx", CS_LNUM_TYPE,
+                                   &n_vals, nullptr);
+    n_vals = mesh->gcell_vtx_idx[mesh->n_ghost_cells];
+    mesh->gcell_vtx_lst
+      = (cs_lnum_t *)_read_section(inp, "gcell_vtx_lst", CS_LNUM_TYPE,
+                                   &n_vals, nullptr);
+  }
+
+  /* Numbering */
+
+  mesh->cell_numbering = _read_numbering(inp, "cell_numbering");
+  mesh->vtx_numbering = _read_numbering(inp, "vtx_numbering");
+  mesh->i_face_numbering = _read_numbering(inp, "i_face_numbering");
+  mesh->b_face_numbering = _read_numbering(inp, "b_face_numbering");
+
+  cs_io_finalize(&inp);
+
+  /* Recompute boundary cells list */
+
+  cs_mesh_update_b_cells(mesh);
+
+  mesh->modified = 0;
+
+  double t1 = cs_timer_wtime();
+
+  bft_printf(_("\n Mesh read from cache \"%s\" (%.3g s)\n"),
+             (_path != nullptr) ? _path : "mesh_cache", t1 - t0);
+
+  /* The cache is used only once per run */
+
+  BFT_FREE(_path);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write mesh to cache.
+ *
+ * This should be called once preprocessing is done, after renumbering.
+ * Meshes with periodicity are not cached.
+ *
+ * \param[in]  mesh  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_write(const cs_mesh_t  *mesh)
+{
+  if (_mode == CS_MESH_CACHE_NONE)
+    return;
+
+  if (mesh->n_init_perio > 0) {
+    bft_printf(_("\n Mesh cache is not available for periodic meshes.\n"));
+    return;
+  }
+
+  double t0 = cs_timer_wtime();
+
+  const char *path = (_path != nullptr) ? _path : "mesh_cache";
+
+  if (cs_glob_rank_id < 1) {
+    if (cs_file_mkdir_default(path) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("The %s directory cannot be created"), path);
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  char *name = _cache_file_name();
+  cs_io_t *outp = _open_file(name, CS_IO_MODE_WRITE);
+  BFT_FREE(name);
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+
+  /* Header and dimensions */
+
+  int hdr[_H_SIZE];
+  hdr[_H_VERSION] = _CACHE_VERSION;
+  hdr[_H_N_RANKS] = cs_glob_n_ranks;
+  hdr[_H_N_THREADS] = cs_glob_n_threads;
+  hdr[_H_RANK_ID] = CS_MAX(cs_glob_rank_id, 0);
+  hdr[_H_HALO_TYPE] = mesh->halo_type;
+  hdr[_H_DIM] = mesh->dim;
+  hdr[_H_TIME_DEP] = mesh->time_dep;
+  hdr[_H_HAVE_R_GEN] = (mesh->have_r_gen) ? 1 : 0;
+  hdr[_H_N_GROUPS] = mesh->n_groups;
+  hdr[_H_N_FAMILIES] = mesh->n_families;
+  hdr[_H_N_MAX_FAMILY_ITEMS] = mesh->n_max_family_items;
+  hdr[_H_HAVE_HALO] = (mesh->halo != nullptr) ? 1 : 0;
+  hdr[_H_HAVE_CELL_CELLS] = (mesh->cell_cells_idx != nullptr) ? 1 : 0;
+  hdr[_H_HAVE_GCELL_VTX] = (mesh->gcell_vtx_idx != nullptr) ? 1 : 0;
+
+  _write_section(outp, "header", CS_INT_TYPE, _H_SIZE, hdr);
+
+  cs_lnum_t l_sizes[_L_SIZE];
+  l_sizes[_L_N_CELLS] = n_cells;
+  l_sizes[_L_N_I_FACES] = n_i_faces;
+  l_sizes[_L_N_B_FACES] = n_b_faces;
+  l_sizes[_L_N_VERTICES] = n_vertices;
+  l_sizes[_L_I_FACE_VTX_SIZE] = mesh->i_face_vtx_connect_size;
+  l_sizes[_L_B_FACE_VTX_SIZE] = mesh->b_face_vtx_connect_size;
+  l_sizes[_L_N_GHOST_CELLS] = mesh->n_ghost_cells;
+  l_sizes[_L_N_B_FACES_ALL] = mesh->n_b_faces_all;
+
+  _write_section(outp, "local_sizes", CS_LNUM_TYPE, _L_SIZE, l_sizes);
+
+  cs_gnum_t g_sizes[_G_SIZE];
+  g_sizes[_G_N_CELLS] = mesh->n_g_cells;
+  g_sizes[_G_N_I_FACES] = mesh->n_g_i_faces;
+  g_sizes[_G_N_B_FACES] = mesh->n_g_b_faces;
+  g_sizes[_G_N_VERTICES] = mesh->n_g_vertices;
+  g_sizes[_G_N_I_C_FACES] = mesh->n_g_i_c_faces;
+  g_sizes[_G_N_FREE_FACES] = mesh->n_g_free_faces;
+  g_sizes[_G_N_B_FACES_ALL] = mesh->n_g_b_faces_all;
+
+  _write_section(outp, "global_sizes", CS_GNUM_TYPE, _G_SIZE, g_sizes);
+
+  /* Connectivity and coordinates */
+
+  _write_section(outp, "vtx_coord", CS_REAL_TYPE,
+                 n_vertices*3, mesh->vtx_coord);
+
+  _write_section(outp, "i_face_cells", CS_LNUM_TYPE,
+                 n_i_faces*2, mesh->i_face_cells);
+  _write_section(outp, "b_face_cells", CS_LNUM_TYPE,
+                 n_b_faces, mesh->b_face_cells);
+
+  _write_section(outp, "i_face_vtx_idx", CS_LNUM_TYPE,
+                 n_i_faces + 1, mesh->i_face_vtx_idx);
+  _write_section(outp, "i_face_vtx_lst", CS_LNUM_TYPE,
+                 mesh->i_face_vtx_connect_size, mesh->i_face_vtx_lst);
+
+  _write_section(outp, "b_face_vtx_idx", CS_LNUM_TYPE,
+                 n_b_faces + 1, mesh->b_face_vtx_idx);
+  _write_section(outp, "b_face_vtx_lst", CS_LNUM_TYPE,
+                 mesh->b_face_vtx_connect_size, mesh->b_face_vtx_lst);
+
+  /* Global numbering */
+
+  _write_section(outp, "global_cell_num", CS_GNUM_TYPE,
+                 (mesh->global_cell_num != nullptr) ? n_cells : 0,
+                 mesh->global_cell_num);
+  _write_section(outp, "global_i_face_num", CS_GNUM_TYPE,
+                 (mesh->global_i_face_num != nullptr) ? n_i_faces : 0,
+                 mesh->global_i_face_num);
+  _write_section(outp, "global_b_face_num", CS_GNUM_TYPE,
+                 (mesh->global_b_face_num != nullptr) ? n_b_faces : 0,
+                 mesh->global_b_face_num);
+  _write_section(outp, "global_vtx_num", CS_GNUM_TYPE,
+                 (mesh->global_vtx_num != nullptr) ? n_vertices : 0,
+                 mesh->global_vtx_num);
+
+  /* Groups and families */
+
+  if (mesh->n_groups > 0) {
+    _write_section(outp, "group_idx", CS_INT_TYPE,
+                   mesh->n_groups + 1, mesh->group_idx);
+    _write_section(outp, "group", CS_CHAR,
+                   mesh->group_idx[mesh->n_groups], mesh->group);
+  }
+
+  _write_section(outp, "family_item", CS_INT_TYPE,
+                 (size_t)(mesh->n_families) * mesh->n_max_family_items,
+                 mesh->family_item);
+
+  _write_section(outp, "cell_family", CS_INT_TYPE,
+                 (mesh->cell_family != nullptr) ? mesh->n_cells_with_ghosts : 0,
+                 mesh->cell_family);
+  _write_section(outp, "i_face_family", CS_INT_TYPE,
+                 (mesh->i_face_family != nullptr) ? n_i_faces : 0,
+                 mesh->i_face_family);
+  _write_section(outp, "b_face_family", CS_INT_TYPE,
+                 (mesh->b_face_family != nullptr) ? n_b_faces : 0,
+                 mesh->b_face_family);
+
+  /* Refinement info */
+
+  if (mesh->have_r_gen) {
+    _write_section(outp, "i_face_r_gen", CS_CHAR,
+                   n_i_faces, mesh->i_face_r_gen);
+    _write_section(outp, "vtx_r_gen", CS_CHAR,
+                   n_vertices, mesh->vtx_r_gen);
+  }
+
+  /* Parallel structures (vertex interfaces are rebuilt from global
+     numbers, as this is fast and simple) */
+
+  if (mesh->halo != nullptr)
+    _write_halo(outp, mesh->halo);
+
+  /* Extended neighborhood */
+
+  if (mesh->cell_cells_idx != nullptr) {
+    _write_section(outp, "cell_cells_idx", CS_LNUM_TYPE,
+                   n_cells + 1, mesh->cell_cells_idx);
+    _write_section(outp, "cell_cells_lst", CS_LNUM_TYPE,
+                   mesh->cell_cells_idx[n_cells], mesh->cell_cells_lst);
+  }
+
+  if (mesh->gcell_vtx_idx != nullptr) {
+    _write_section(outp, "gcell_vtx_idx", CS_LNUM_TYPE,
+                   mesh->n_ghost_cells + 1, mesh->gcell_vtx_idx);
+    _write_section(outp, "gcell_vtx_lst", CS_LNUM_TYPE,
+                   mesh->gcell_vtx_idx[mesh->n_ghost_cells],
+                   mesh->gcell_vtx_lst);
+  }
+
+  /* Numbering */
+
+  _write_numbering(outp, "cell_numbering", mesh->cell_numbering);
+  _write_numbering(outp, "vtx_numbering", mesh->vtx_numbering);
+  _write_numbering(outp, "i_face_numbering", mesh->i_face_numbering);
+  _write_numbering(outp, "b_face_numbering", mesh->b_face_numbering);
+
+  cs_io_finalize(&outp);
+
+  double t1 = cs_timer_wtime();
+
+  bft_printf(_("\n Mesh written to cache \"%s\" (%.3g s)\n"), path, t1 - t0);
+
+  /* The cache is used only once per run */
+
+  BFT_FREE(_path);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,129 @@
+#ifndef __CS_MESH_CACHE_H__
+#define __CS_MESH_CACHE_H__
+
+/*============================================================================
+ * Cache of preprocessed mesh (with halos and numbering) for a given
+ * number of ranks.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_halo.h"
+#include "cs_mesh.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Mesh cache usage mode */
+
+typedef enum {
+
+  CS_MESH_CACHE_NONE,    /*!< do not use mesh cache (default) */
+  CS_MESH_CACHE_WRITE,   /*!< build mesh, then (over)write cache */
+  CS_MESH_CACHE_AUTO     /*!< read mesh from cache if compatible with
+                           current run; build and write it otherwise */
+
+} cs_mesh_cache_mode_t;
+
+/*============================================================================
+ *  Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define mesh cache usage.
+ *
+ * The mesh cache contains the mesh as it is after joining, partitioning,
+ * halo construction and renumbering, with one file per rank. It may only
+ * be used by runs with the same number of ranks, threads and halo type,
+ * and should be removed (or rewritten) when the mesh inputs or
+ * preprocessing options change.
+ *
+ * \param[in]  mode  mesh cache usage mode
+ * \param[in]  path  cache directory, or nullptr for default ("mesh_cache")
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_set_mode(cs_mesh_cache_mode_t   mode,
+                       const char            *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return mesh cache usage mode.
+ *
+ * \return  mesh cache usage mode
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_mesh_cache_mode_t
+cs_mesh_cache_get_mode(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh from cache if available and compatible.
+ *
+ * The mesh should be empty when calling this function. If no compatible
+ * cache is found on all ranks, the mesh is not modified and false is
+ * returned.
+ *
+ * \param[in, out]  mesh       pointer to mesh structure
+ * \param[in]       halo_type  expected halo type
+ *
+ * \return  true if the mesh was read from cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cache_read(cs_mesh_t       *mesh,
+                   cs_halo_type_t   halo_type);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write mesh to cache.
+ *
+ * This should be called once preprocessing is done, after renumbering.
+ * Meshes with periodicity are not cached.
+ *
+ * \param[in]  mesh  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_write(const cs_mesh_t  *mesh);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_CACHE_H__ */
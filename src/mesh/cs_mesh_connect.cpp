@@ -666,6 +666,160 @@ cs_mesh_connect_cells_to_nodal(const cs_mesh_t  *mesh,
   return extr_mesh;
 }
 
+/*----------------------------------------------------------------------------
+ * Build a nodal connectivity structure from agglomerated mesh cells.
+ *
+ * Each agglomerate is converted to a single (usually polyhedral) cell,
+ * whose faces are the faces of its member cells not shared by another
+ * member cell. The parent element ids of the resulting cells are
+ * agglomerate ids, and vertices are shared with the parent mesh.
+ *
+ * parameters:
+ *   mesh      <-- base mesh
+ *   name      <-- extracted mesh name
+ *   n_agg     <-- number of local agglomerates
+ *   c_agg_id  <-- agglomerate id for each cell, or -1 for unused cells
+ *   agg_gnum  <-- global agglomerate numbers (size: n_agg)
+ *
+ * returns:
+ *   pointer to extracted nodal mesh
+ *----------------------------------------------------------------------------*/
+
+fvm_nodal_t *
+cs_mesh_connect_agglomerated_cells_to_nodal(const cs_mesh_t  *mesh,
+                                            const char       *name,
+                                            cs_lnum_t         n_agg,
+                                            const cs_lnum_t   c_agg_id[],
+                                            const cs_gnum_t   agg_gnum[])
+{
+  cs_lnum_t  face_num_shift[3];
+  cs_lnum_t  *face_vertices_idx[2];
+  cs_lnum_t  *face_vertices_num[2];
+  cs_lnum_t  *polyhedra_faces = nullptr;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_b_faces = CS_MAX(mesh->n_b_faces_all, mesh->n_b_faces);
+
+  if (mesh->b_face_vtx_idx == nullptr || mesh->i_face_vtx_idx == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The main mesh does not contain any face -> vertices\n"
+                "connectivity, necessary for the nodal connectivity\n"
+                "reconstruction (%s)."), __func__);
+
+  /* Build "agglomerates -> faces" connectivity, ignoring faces
+     between cells of a same agglomerate */
+
+  cs_lnum_t *agg_face_idx, *agg_face_num, *agg_face_count;
+
+  BFT_MALLOC(agg_face_idx, n_agg + 1, cs_lnum_t);
+  BFT_MALLOC(agg_face_count, n_agg, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_agg + 1; i++)
+    agg_face_idx[i] = 0;
+  for (cs_lnum_t i = 0; i < n_agg; i++)
+    agg_face_count[i] = 0;
+
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+    cs_lnum_t c_id = mesh->b_face_cells[face_id];
+    cs_lnum_t a_id = (c_id > -1) ? c_agg_id[c_id] : -1;
+    if (a_id > -1)
+      agg_face_idx[a_id + 1] += 1;
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+    cs_lnum_t c_id0 = mesh->i_face_cells[face_id][0];
+    cs_lnum_t c_id1 = mesh->i_face_cells[face_id][1];
+    cs_lnum_t a_id0 = (c_id0 < n_cells) ? c_agg_id[c_id0] : -1;
+    cs_lnum_t a_id1 = (c_id1 < n_cells) ? c_agg_id[c_id1] : -1;
+    if (a_id0 == a_id1)
+      continue;
+    if (a_id0 > -1)
+      agg_face_idx[a_id0 + 1] += 1;
+    if (a_id1 > -1)
+      agg_face_idx[a_id1 + 1] += 1;
+  }
+
+  agg_face_idx[0] = 1;
+  for (cs_lnum_t i = 0; i < n_agg; i++)
+    agg_face_idx[i + 1] += agg_face_idx[i];
+
+  BFT_MALLOC(agg_face_num, agg_face_idx[n_agg] - 1, cs_lnum_t);
+
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+    cs_lnum_t c_id = mesh->b_face_cells[face_id];
+    cs_lnum_t a_id = (c_id > -1) ? c_agg_id[c_id] : -1;
+    if (a_id > -1) {
+      agg_face_num[agg_face_idx[a_id] + agg_face_count[a_id] - 1]
+        = face_id + 1;
+      agg_face_count[a_id] += 1;
+    }
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+    cs_lnum_t c_id0 = mesh->i_face_cells[face_id][0];
+    cs_lnum_t c_id1 = mesh->i_face_cells[face_id][1];
+    cs_lnum_t a_id0 = (c_id0 < n_cells) ? c_agg_id[c_id0] : -1;
+    cs_lnum_t a_id1 = (c_id1 < n_cells) ? c_agg_id[c_id1] : -1;
+    if (a_id0 == a_id1)
+      continue;
+    if (a_id0 > -1) {
+      agg_face_num[agg_face_idx[a_id0] + agg_face_count[a_id0] - 1]
+        = face_id + n_b_faces + 1;
+      agg_face_count[a_id0] += 1;
+    }
+    if (a_id1 > -1) {
+      agg_face_num[agg_face_idx[a_id1] + agg_face_count[a_id1] - 1]
+        = -(face_id + n_b_faces + 1);
+      agg_face_count[a_id1] += 1;
+    }
+  }
+
+  BFT_FREE(agg_face_count);
+
+  /* Build nodal connectivity */
+
+  face_num_shift[0] = 0;
+  face_num_shift[1] = n_b_faces + face_num_shift[0];
+  face_num_shift[2] = mesh->n_i_faces + face_num_shift[1];
+
+  face_vertices_idx[0] = mesh->b_face_vtx_idx;
+  face_vertices_idx[1] = mesh->i_face_vtx_idx;
+  face_vertices_num[0] = mesh->b_face_vtx_lst;
+  face_vertices_num[1] = mesh->i_face_vtx_lst;
+
+  fvm_nodal_t *extr_mesh = fvm_nodal_create(name, 3);
+
+  fvm_nodal_set_parent(extr_mesh, mesh);
+
+  fvm_nodal_from_desc_add_cells(extr_mesh,
+                                n_agg,
+                                2,
+                                face_num_shift,
+                                (const cs_lnum_t **)face_vertices_idx,
+                                (const cs_lnum_t **)face_vertices_num,
+                                agg_face_idx,
+                                agg_face_num,
+                                nullptr,
+                                nullptr,
+                                &polyhedra_faces);
+
+  fvm_nodal_set_shared_vertices(extr_mesh, mesh->vtx_coord);
+
+  BFT_FREE(polyhedra_faces);
+  BFT_FREE(agg_face_idx);
+  BFT_FREE(agg_face_num);
+
+  /* Sort agglomerates and vertices by increasing global number */
+
+  fvm_nodal_order_cells(extr_mesh, agg_gnum);
+  fvm_nodal_init_io_num(extr_mesh, agg_gnum, 3);
+
+  fvm_nodal_order_vertices(extr_mesh, mesh->global_vtx_num);
+  fvm_nodal_init_io_num(extr_mesh, mesh->global_vtx_num, 0);
+
+  return extr_mesh;
+}
+
 /*----------------------------------------------------------------------------
  * Build a nodal connectivity structure from a subset of a mesh's faces.
  *
@@ -107,6 +107,32 @@ cs_mesh_connect_cells_to_nodal(const cs_mesh_t  *mesh,
                                cs_lnum_t         cell_list_size,
                                const cs_lnum_t   cell_list[]);
 
+/*----------------------------------------------------------------------------
+ * Build a nodal connectivity structure from agglomerated mesh cells.
+ *
+ * Each agglomerate is converted to a single (usually polyhedral) cell,
+ * whose faces are the faces of its member cells not shared by another
+ * member cell. The parent element ids of the resulting cells are
+ * agglomerate ids, and vertices are shared with the parent mesh.
+ *
+ * parameters:
+ *   mesh      <-- base mesh
+ *   name      <-- extracted mesh name
+ *   n_agg     <-- number of local agglomerates
+ *   c_agg_id  <-- agglomerate id for each cell, or -1 for unused cells
+ *   agg_gnum  <-- global agglomerate numbers (size: n_agg)
+ *
+ * returns:
+ *   pointer to extracted nodal mesh
+ *----------------------------------------------------------------------------*/
+
+fvm_nodal_t *
+cs_mesh_connect_agglomerated_cells_to_nodal(const cs_mesh_t  *mesh,
+                                            const char       *name,
+                                            cs_lnum_t         n_agg,
+                                            const cs_lnum_t   c_agg_id[],
+                                            const cs_gnum_t   agg_gnum[]);
+
 /*----------------------------------------------------------------------------
  * Build a nodal connectivity structure from a subset of a mesh's faces.
  *
@@ -778,6 +778,7 @@ _add_extruded_vertices(cs_mesh_t          *m,
   BFT_REALLOC(m->vtx_coord, (n_vertices_ini + n_vertices_add)*3, cs_real_t);
 
   if (distribution != nullptr) {
+#   pragma omp parallel for if (n_vertices > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < n_vertices; i++) {
       cs_lnum_t v_id = vertices[i];
       const cs_real_t *s_coo = m->vtx_coord + 3*v_id;
@@ -791,6 +792,7 @@ _add_extruded_vertices(cs_mesh_t          *m,
   }
 
   else {
+#   pragma omp parallel for if (n_vertices > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < n_vertices; i++) {
       cs_lnum_t v_id = vertices[i];
       const cs_real_t *s_coo = m->vtx_coord + 3*v_id;
@@ -1843,6 +1845,7 @@ _cs_mesh_extrude_vectors_by_face_info(cs_mesh_extrude_vectors_t          *e,
   BFT_REALLOC(e->n_layers, e->n_vertices, cs_lnum_t);
   BFT_REALLOC(e->coord_shift, e->n_vertices, cs_coord_3_t);
 
+# pragma omp parallel for if (e->n_vertices > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < e->n_vertices; i++) {
     cs_lnum_t v_id = e->vertex_ids[i];
     e->n_layers[i] = _n_layers[v_id];
@@ -1861,8 +1864,10 @@ _cs_mesh_extrude_vectors_by_face_info(cs_mesh_extrude_vectors_t          *e,
 
   BFT_REALLOC(e->distribution, e->distribution_idx[e->n_vertices], float);
 
-  /* Compute distribution for each extruded vertex */
+  /* Compute distribution for each extruded vertex
+     (vertex ids are unique, so per-vertex updates are independent) */
 
+# pragma omp parallel for if (e->n_vertices > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < e->n_vertices; i++) {
 
     int n_l = e->n_layers[i];
@@ -41,11 +41,13 @@
 #include "cs_join_update.h"
 #include "cs_join_util.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adapt.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_bad_cells.h"
 #include "cs_mesh_boundary.h"
 #include "cs_mesh_boundary_layer.h"
 #include "cs_mesh_builder.h"
+#include "cs_mesh_cache.h"
 #include "cs_mesh_cartesian.h"
 #include "cs_mesh_coarsen.h"
 #include "cs_mesh_coherency.h"
@@ -54,6 +56,7 @@
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
 #include "cs_mesh_halo.h"
+#include "cs_mesh_import.h"
 #include "cs_mesh_intersect.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quality.h"
@@ -0,0 +1,2134 @@
+/*============================================================================
+ * Parallel, block-distributed import of CGNS and MED meshes.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ * CGNS and MED library headers
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_CGNS)
+#include <cgnslib.h>
+#if defined(HAVE_MPI) && defined(CG_BUILD_PARALLEL)
+#if CG_BUILD_PARALLEL > 0
+#include <pcgnslib.h>
+#define CS_MESH_IMPORT_CGNS_MPI
+#endif
+#endif
+#endif
+
+#if defined(HAVE_MED)
+#include <med.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_all_to_all.h"
+#include "cs_base.h"
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_import.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_import.cpp
+        Parallel, block-distributed import of CGNS and MED meshes.
+
+  Meshes are read directly by the solver, without going through the
+  serial Preprocessor: each rank reads the cells and vertices of its
+  block using the parallel (MPI-IO based) API of the CGNS or MED
+  library when available, or independent partial reads otherwise.
+  Faces are then built from cells, and matched in parallel using
+  a distribution based on their lowest vertex number.
+
+  Only single-zone meshes with standard (linear or quadratic) elements
+  are handled; polyhedra, mixed sections and multiple zones still require
+  the Preprocessor.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Compatibility with different CGNS library versions */
+
+#if defined(HAVE_CGNS)
+
+#if !defined(CGNS_ENUMV)
+#define CGNS_ENUMV(e) e
+#endif
+
+#if !defined(CGNS_ENUMT)
+#define CGNS_ENUMT(e) e
+#endif
+
+#if CGNS_VERSION < 3100
+#define cgsize_t int
+#endif
+
+#endif /* defined(HAVE_CGNS) */
+
+/* Stride of face records: 4 vertices, cell number, group class id */
+
+#define _FACE_REC_STRIDE 6
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Supported file formats */
+
+typedef enum {
+
+  _FORMAT_CGNS,
+  _FORMAT_MED
+
+} _format_t;
+
+/* Element section */
+
+typedef struct {
+
+  int         s_id;        /* section number (CGNS) or
+                              geometric type (MED) in file */
+  int         n_vtx;       /* number of vertices per element in file */
+  int         n_corners;   /* number of corner vertices (kept) */
+  bool        volume;      /* true for cells, false for boundary elements */
+  bool        has_family;  /* true if family numbers are defined
+                              per element (MED) */
+  int         gc_id;       /* group class id for all section elements
+                              (if has_family is false) */
+
+  cs_gnum_t   n_g_elts;    /* global number of elements */
+  cs_gnum_t   file_start;  /* number of first element in file (CGNS) */
+  cs_gnum_t   gnum_shift;  /* shift in global cell or boundary
+                              element numbering */
+
+} _section_t;
+
+/* Import state, kept between header and data reads */
+
+typedef struct {
+
+  _format_t    format;          /* file format */
+  char        *path;            /* file path */
+  bool         parallel_io;     /* use parallel library API */
+
+#if defined(HAVE_CGNS)
+  int          cg_fn;           /* CGNS file number */
+  int          base_id;         /* CGNS base number */
+  int          zone_id;         /* CGNS zone number */
+#endif
+
+#if defined(HAVE_MED)
+  med_idt      med_fid;         /* MED file id */
+  char         mesh_name[MED_NAME_SIZE + 1];  /* MED mesh name */
+#endif
+
+  int          space_dim;       /* spatial dimension */
+
+  int          n_families;      /* number of MED element families */
+  int         *family_num;      /* sorted MED element family numbers */
+
+  int          n_sections;      /* number of element sections */
+  _section_t  *sections;        /* element sections */
+
+  cs_gnum_t    n_g_vertices;    /* global number of vertices */
+  cs_gnum_t    n_g_cells;       /* global number of cells */
+  cs_gnum_t    n_g_b_elts;      /* global number of boundary elements */
+
+} _import_t;
+
+/* Block of elements read from file */
+
+typedef struct {
+
+  cs_lnum_t   n_elts;     /* number of elements */
+  cs_lnum_t  *vtx_idx;    /* element -> vertices index */
+  cs_gnum_t  *vtx;        /* element -> vertex global numbers */
+  int        *gc_id;      /* element group class id */
+
+} _elt_block_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static _import_t  *_import = nullptr;
+
+/* Cell faces for standard cell types (tetrahedra, pyramids, prisms,
+   hexahedra), using the local vertex numbering shared by code_saturne
+   and CGNS (faces oriented outwards, -1 for unused vertex) */
+
+static const int _n_cell_faces[4] = {4, 5, 5, 6};
+
+static const int _cell_face_vtx[4][6][4]
+  = {{{0, 2, 1, -1}, {0, 1, 3, -1}, {0, 3, 2, -1}, {1, 2, 3, -1}},
+     {{0, 1, 4, -1}, {0, 4, 3, -1}, {1, 2, 4, -1}, {2, 3, 4, -1},
+      {0, 3, 2, 1}},
+     {{0, 2, 1, -1}, {3, 4, 5, -1}, {0, 1, 4, 3}, {0, 3, 5, 2},
+      {1, 2, 5, 4}},
+     {{0, 3, 2, 1}, {0, 1, 5, 4}, {0, 4, 7, 3}, {1, 2, 6, 5},
+      {2, 3, 7, 6}, {4, 5, 6, 7}}};
+
+#if defined(HAVE_MED)
+
+/* MED geometric types handled */
+
+static const med_geometry_type _med_types[] = {
+  MED_TRIA3, MED_TRIA6, MED_TRIA7, MED_QUAD4, MED_QUAD8, MED_QUAD9,
+  MED_TETRA4, MED_TETRA10, MED_PYRA5, MED_PYRA13,
+  MED_PENTA6, MED_PENTA15, MED_HEXA8, MED_HEXA20, MED_HEXA27};
+
+/* MED to code_saturne vertex permutation for cells (MED cells have
+   the opposite orientation) */
+
+static const int _med_tetra_perm[4] = {0, 2, 1, 3};
+static const int _med_pyra_perm[5] = {0, 3, 2, 1, 4};
+static const int _med_penta_perm[6] = {0, 2, 1, 3, 5, 4};
+static const int _med_hexa_perm[8] = {0, 3, 2, 1, 4, 7, 6, 5};
+
+#endif /* defined(HAVE_MED) */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return cell type index in face tables based on its number of vertices.
+ *
+ * parameters:
+ *   n_vtx <-- number of cell vertices
+ *
+ * returns:
+ *   type index, or -1 for unhandled types
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_cell_type(cs_lnum_t  n_vtx)
+{
+  switch (n_vtx) {
+  case 4:
+    return 0;
+  case 5:
+    return 1;
+  case 6:
+    return 2;
+  case 8:
+    return 3;
+  default:
+    return -1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a path has a given extension (case-insensitive).
+ *
+ * parameters:
+ *   path <-- file path
+ *   ext  <-- extension, including '.'
+ *
+ * returns:
+ *   true if the path ends with the extension, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_has_extension(const char  *path,
+               const char  *ext)
+{
+  size_t l = strlen(path), le = strlen(ext);
+
+  if (l <= le)
+    return false;
+
+  const char *p = path + l - le;
+  for (size_t i = 0; i < le; i++) {
+    char c = p[i];
+    if (c >= 'A' && c <= 'Z')
+      c = c - 'A' + 'a';
+    if (c != ext[i])
+      return false;
+  }
+
+  return true;
+}
+
+#if defined(HAVE_CGNS) || defined(HAVE_MED)
+
+/*----------------------------------------------------------------------------
+ * Add a section to the import state.
+ *
+ * parameters:
+ *   imp <-> import state
+ *
+ * returns:
+ *   pointer to added section
+ *----------------------------------------------------------------------------*/
+
+static _section_t *
+_add_section(_import_t  *imp)
+{
+  BFT_REALLOC(imp->sections, imp->n_sections + 1, _section_t);
+
+  _section_t *s = imp->sections + imp->n_sections;
+  imp->n_sections += 1;
+
+  memset(s, 0, sizeof(_section_t));
+  s->gc_id = 1;
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Define mesh families and groups.
+ *
+ * The default family (with no group) is added as the first family.
+ *
+ * parameters:
+ *   mesh        <-> mesh being defined
+ *   n_families  <-- number of families (excluding default)
+ *   n_max_items <-- maximum number of groups per family
+ *   family_item <-- family groups, as -(group_id + 1), or 0
+ *                   (size: n_families*n_max_items, interlaced as in mesh)
+ *   n_groups    <-- number of groups
+ *   group_idx   <-- group names index (size: n_groups + 1)
+ *   group       <-- group names
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_families(cs_mesh_t   *mesh,
+                 int          n_families,
+                 int          n_max_items,
+                 const int    family_item[],
+                 int          n_groups,
+                 const int    group_idx[],
+                 const char   group[])
+{
+  assert(mesh->n_families == 0 && mesh->n_groups == 0);
+
+  mesh->n_families = n_families + 1;
+  mesh->n_max_family_items = CS_MAX(n_max_items, 1);
+
+  BFT_MALLOC(mesh->family_item,
+             mesh->n_families * mesh->n_max_family_items,
+             int);
+
+  for (int j = 0; j < mesh->n_max_family_items; j++) {
+    mesh->family_item[mesh->n_families*j] = 0;
+    for (int i = 0; i < n_families; i++)
+      mesh->family_item[mesh->n_families*j + i + 1]
+        = (j < n_max_items) ? family_item[n_families*j + i] : 0;
+  }
+
+  mesh->n_groups = n_groups;
+
+  if (n_groups > 0) {
+    BFT_MALLOC(mesh->group_idx, n_groups + 1, int);
+    BFT_MALLOC(mesh->group, group_idx[n_groups], char);
+    memcpy(mesh->group_idx, group_idx, (n_groups + 1)*sizeof(int));
+    memcpy(mesh->group, group, group_idx[n_groups]);
+  }
+}
+
+#endif /* defined(HAVE_CGNS) || defined(HAVE_MED) */
+
+#if defined(HAVE_MED)
+
+/*----------------------------------------------------------------------------
+ * Copy a name, removing trailing blanks.
+ *
+ * parameters:
+ *   dest     --> destination (size: max_size + 1)
+ *   src      <-- source name (not necessarily null-terminated)
+ *   max_size <-- maximum name size
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_name(char        *dest,
+           const char  *src,
+           size_t       max_size)
+{
+  strncpy(dest, src, max_size);
+  dest[max_size] = '\0';
+
+  for (int i = strlen(dest) - 1; i > -1 && dest[i] == ' '; i--)
+    dest[i] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Return group class id associated with a MED family number.
+ *
+ * parameters:
+ *   imp     <-- import state
+ *   fam_num <-- MED family number
+ *
+ * returns:
+ *   associated group class id (1 for default family)
+ *----------------------------------------------------------------------------*/
+
+static int
+_family_gc_id(const _import_t  *imp,
+              int               fam_num)
+{
+  int start_id = 0;
+  int end_id = imp->n_families;
+
+  while (start_id < end_id) {
+    int mid_id = start_id + (end_id - start_id)/2;
+    if (imp->family_num[mid_id] < fam_num)
+      start_id = mid_id + 1;
+    else
+      end_id = mid_id;
+  }
+
+  if (start_id < imp->n_families && imp->family_num[start_id] == fam_num)
+    return start_id + 2;
+
+  return 1;
+}
+
+#endif /* defined(HAVE_MED) */
+
+/*----------------------------------------------------------------------------
+ * Free import state.
+ *----------------------------------------------------------------------------*/
+
+static void
+_import_destroy(void)
+{
+  if (_import != nullptr) {
+    BFT_FREE(_import->path);
+    BFT_FREE(_import->family_num);
+    BFT_FREE(_import->sections);
+    BFT_FREE(_import);
+  }
+}
+
+#if defined(HAVE_CGNS) || defined(HAVE_MED)
+
+/*----------------------------------------------------------------------------
+ * Set shifts of section elements in global cell and boundary element
+ * numberings, and the associated global counts.
+ *
+ * parameters:
+ *   imp <-> import state
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_section_shifts(_import_t  *imp)
+{
+  imp->n_g_cells = 0;
+  imp->n_g_b_elts = 0;
+
+  for (int i = 0; i < imp->n_sections; i++) {
+    _section_t *s = imp->sections + i;
+    if (s->volume) {
+      s->gnum_shift = imp->n_g_cells;
+      imp->n_g_cells += s->n_g_elts;
+    }
+    else {
+      s->gnum_shift = imp->n_g_b_elts;
+      imp->n_g_b_elts += s->n_g_elts;
+    }
+  }
+}
+
+#endif /* defined(HAVE_CGNS) || defined(HAVE_MED) */
+
+#if defined(HAVE_CGNS)
+
+/*----------------------------------------------------------------------------
+ * Open CGNS file.
+ *
+ * parameters:
+ *   imp <-> import state
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_open(_import_t  *imp)
+{
+  int retval = CG_OK;
+
+#if defined(CS_MESH_IMPORT_CGNS_MPI)
+  if (imp->parallel_io) {
+    cgp_mpi_comm(cs_glob_mpi_comm);
+    retval = cgp_open(imp->path, CG_MODE_READ, &(imp->cg_fn));
+  }
+  else
+    retval = cg_open(imp->path, CG_MODE_READ, &(imp->cg_fn));
+#else
+  retval = cg_open(imp->path, CG_MODE_READ, &(imp->cg_fn));
+#endif
+
+  if (retval != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: error opening file \"%s\":\n%s"),
+              imp->path, cg_get_error());
+}
+
+/*----------------------------------------------------------------------------
+ * Close CGNS file.
+ *
+ * parameters:
+ *   imp <-> import state
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_close(_import_t  *imp)
+{
+#if defined(CS_MESH_IMPORT_CGNS_MPI)
+  if (imp->parallel_io)
+    cgp_close(imp->cg_fn);
+  else
+    cg_close(imp->cg_fn);
+#else
+  cg_close(imp->cg_fn);
+#endif
+
+  imp->cg_fn = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Read CGNS file metadata and define mesh families and groups.
+ *
+ * Each element section defines a family, with a group named after the
+ * section.
+ *
+ * parameters:
+ *   imp  <-> import state
+ *   mesh <-> mesh being defined
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_read_headers(_import_t  *imp,
+                   cs_mesh_t  *mesh)
+{
+  char name[33];
+  int n_bases = 0, n_zones = 0, n_sections = 0;
+  int cell_dim = 0, phys_dim = 0;
+  CGNS_ENUMT(ZoneType_t) zone_type;
+  cgsize_t zone_size[3];
+
+  const int fn = imp->cg_fn;
+
+  if (cg_nbases(fn, &n_bases) != CG_OK || n_bases < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: no base found in file \"%s\"."), imp->path);
+
+  imp->base_id = 1;
+  if (cg_base_read(fn, imp->base_id, name, &cell_dim, &phys_dim) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: error reading file \"%s\":\n%s"),
+              imp->path, cg_get_error());
+
+  if (cg_nzones(fn, imp->base_id, &n_zones) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: error reading file \"%s\":\n%s"),
+              imp->path, cg_get_error());
+
+  if (cell_dim != 3 || n_zones != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: file \"%s\" has %d zone(s) of dimension %d.\n"
+                "Only single-zone volume meshes may be imported directly;\n"
+                "use the Preprocessor for this mesh."),
+              imp->path, n_zones, cell_dim);
+
+  imp->zone_id = 1;
+  imp->space_dim = phys_dim;
+
+  if (   cg_zone_type(fn, imp->base_id, imp->zone_id, &zone_type) != CG_OK
+      || zone_type != CGNS_ENUMV(Unstructured))
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: only unstructured zones may be imported directly\n"
+                "(file \"%s\")."), imp->path);
+
+  if (   cg_zone_read(fn, imp->base_id, imp->zone_id, name, zone_size) != CG_OK
+      || cg_nsections(fn, imp->base_id, imp->zone_id, &n_sections) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: error reading file \"%s\":\n%s"),
+              imp->path, cg_get_error());
+
+  imp->n_g_vertices = zone_size[0];
+
+  /* Element sections; each section defines a group */
+
+  int *group_idx = nullptr;
+  char *group = nullptr;
+
+  BFT_MALLOC(group_idx, n_sections + 1, int);
+  BFT_MALLOC(group, n_sections*33, char);
+  group_idx[0] = 0;
+
+  for (int s_id = 1; s_id <= n_sections; s_id++) {
+
+    CGNS_ENUMT(ElementType_t) type;
+    cgsize_t start, end;
+    int n_bnd, parent_flag, npe = 0;
+
+    if (cg_section_read(fn, imp->base_id, imp->zone_id, s_id, name,
+                        &type, &start, &end, &n_bnd, &parent_flag) != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("CGNS: error reading file \"%s\":\n%s"),
+                imp->path, cg_get_error());
+
+    int n_corners = 0;
+    bool volume = true;
+
+    switch (type) {
+    case CGNS_ENUMV(TRI_3):
+    case CGNS_ENUMV(TRI_6):
+      n_corners = 3;
+      volume = false;
+      break;
+    case CGNS_ENUMV(QUAD_4):
+    case CGNS_ENUMV(QUAD_8):
+    case CGNS_ENUMV(QUAD_9):
+      n_corners = 4;
+      volume = false;
+      break;
+    case CGNS_ENUMV(TETRA_4):
+    case CGNS_ENUMV(TETRA_10):
+      n_corners = 4;
+      break;
+    case CGNS_ENUMV(PYRA_5):
+    case CGNS_ENUMV(PYRA_14):
+#if CGNS_VERSION >= 3000
+    case CGNS_ENUMV(PYRA_13):
+#endif
+      n_corners = 5;
+      break;
+    case CGNS_ENUMV(PENTA_6):
+    case CGNS_ENUMV(PENTA_15):
+    case CGNS_ENUMV(PENTA_18):
+      n_corners = 6;
+      break;
+    case CGNS_ENUMV(HEXA_8):
+    case CGNS_ENUMV(HEXA_20):
+    case CGNS_ENUMV(HEXA_27):
+      n_corners = 8;
+      break;
+    case CGNS_ENUMV(NODE):
+    case CGNS_ENUMV(BAR_2):
+    case CGNS_ENUMV(BAR_3):
+      continue;
+    default:
+      bft_error(__FILE__, __LINE__, 0,
+                _("CGNS: section \"%s\" of file \"%s\" has element type %s,\n"
+                  "which may not be imported directly;\n"
+                  "use the Preprocessor for this mesh."),
+                name, imp->path, ElementTypeName[type]);
+    }
+
+    cg_npe(type, &npe);
+
+    _section_t *s = _add_section(imp);
+
+    s->s_id = s_id;
+    s->n_vtx = npe;
+    s->n_corners = n_corners;
+    s->volume = volume;
+    s->has_family = false;
+    s->n_g_elts = end - start + 1;
+    s->file_start = start;
+
+    /* Section group */
+
+    int g_id = imp->n_sections - 1;
+    size_t l = strlen(name);
+    memcpy(group + group_idx[g_id], name, l + 1);
+    group_idx[g_id + 1] = group_idx[g_id] + l + 1;
+
+    s->gc_id = g_id + 2;
+
+  }
+
+  _set_section_shifts(imp);
+
+  /* Family i + 1 has group i */
+
+  int n_groups = imp->n_sections;
+  int *family_item = nullptr;
+  BFT_MALLOC(family_item, n_groups, int);
+  for (int i = 0; i < n_groups; i++)
+    family_item[i] = -(i + 1);
+
+  _define_families(mesh, n_groups, 1, family_item,
+                   n_groups, group_idx, group);
+
+  BFT_FREE(family_item);
+  BFT_FREE(group);
+  BFT_FREE(group_idx);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of elements from a CGNS section.
+ *
+ * This is a collective operation when using parallel IO.
+ *
+ * parameters:
+ *   imp    <-- import state
+ *   s      <-- section
+ *   offset <-- offset of first element to read in section
+ *   n      <-- number of elements to read
+ *   eb     <-> element block (elements are appended)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_read_section(const _import_t   *imp,
+                   const _section_t  *s,
+                   cs_gnum_t          offset,
+                   cs_lnum_t          n,
+                   _elt_block_t      *eb)
+{
+  int retval = CG_OK;
+
+  cgsize_t *buf = nullptr;
+  BFT_MALLOC(buf, (size_t)n*s->n_vtx, cgsize_t);
+
+  /* Empty requests still need a valid range for collective reads */
+
+  cgsize_t start = s->file_start + offset;
+  cgsize_t end = (n > 0) ? start + n - 1 : start;
+
+#if defined(CS_MESH_IMPORT_CGNS_MPI)
+  if (imp->parallel_io)
+    retval = cgp_elements_read_data(imp->cg_fn, imp->base_id, imp->zone_id,
+                                    s->s_id, start, end,
+                                    (n > 0) ? buf : nullptr);
+  else if (n > 0)
+    retval = cg_elements_partial_read(imp->cg_fn, imp->base_id, imp->zone_id,
+                                      s->s_id, start, end, buf, nullptr);
+#else
+  if (n > 0)
+    retval = cg_elements_partial_read(imp->cg_fn, imp->base_id, imp->zone_id,
+                                      s->s_id, start, end, buf, nullptr);
+#endif
+
+  if (retval != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: error reading elements from file \"%s\":\n%s"),
+              imp->path, cg_get_error());
+
+  cs_lnum_t e_id = eb->n_elts;
+  cs_lnum_t k = eb->vtx_idx[e_id];
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    for (int j = 0; j < s->n_corners; j++)
+      eb->vtx[k++] = buf[i*s->n_vtx + j];
+    eb->gc_id[e_id] = s->gc_id;
+    eb->vtx_idx[e_id + 1] = k;
+    e_id++;
+  }
+
+  eb->n_elts = e_id;
+
+  BFT_FREE(buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of vertex coordinates from a CGNS file.
+ *
+ * This is a collective operation when using parallel IO.
+ *
+ * parameters:
+ *   imp    <-- import state
+ *   range  <-- global vertex number range (past-the-end)
+ *   coords --> vertex coordinates (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cgns_read_vertices(const _import_t  *imp,
+                    const cs_gnum_t   range[2],
+                    cs_real_t         coords[])
+{
+  int n_coords = 0;
+
+  const cs_lnum_t n = range[1] - range[0];
+
+  if (cg_ncoords(imp->cg_fn, imp->base_id, imp->zone_id, &n_coords) != CG_OK)
+    bft_error(__FILE__, __LINE__, 0,
+              _("CGNS: error reading file \"%s\":\n%s"),
+              imp->path, cg_get_error());
+
+  for (cs_lnum_t i = 0; i < n*3; i++)
+    coords[i] = 0.;
+
+  double *buf = nullptr;
+  BFT_MALLOC(buf, n, double);
+
+  cgsize_t rmin = (n > 0) ? range[0] : 1;
+  cgsize_t rmax = (n > 0) ? range[1] - 1 : 1;
+
+  for (int c_id = 1; c_id <= CS_MIN(n_coords, 3); c_id++) {
+
+    char name[33];
+    CGNS_ENUMT(DataType_t) type;
+    int retval = cg_coord_info(imp->cg_fn, imp->base_id, imp->zone_id,
+                               c_id, &type, name);
+
+    int dim_id = c_id - 1;
+    if (strcmp(name, "CoordinateY") == 0)
+      dim_id = 1;
+    else if (strcmp(name, "CoordinateZ") == 0)
+      dim_id = 2;
+    else if (strcmp(name, "CoordinateX") == 0)
+      dim_id = 0;
+
+#if defined(CS_MESH_IMPORT_CGNS_MPI)
+    if (imp->parallel_io && retval == CG_OK) {
+      /* Data is read using the file's data type */
+      if (type == CGNS_ENUMV(RealSingle)) {
+        float *fbuf = nullptr;
+        BFT_MALLOC(fbuf, n, float);
+        retval = cgp_coord_read_data(imp->cg_fn, imp->base_id, imp->zone_id,
+                                     c_id, &rmin, &rmax,
+                                     (n > 0) ? fbuf : nullptr);
+        for (cs_lnum_t i = 0; i < n; i++)
+          buf[i] = fbuf[i];
+        BFT_FREE(fbuf);
+      }
+      else
+        retval = cgp_coord_read_data(imp->cg_fn, imp->base_id, imp->zone_id,
+                                     c_id, &rmin, &rmax,
+                                     (n > 0) ? buf : nullptr);
+    }
+    else if (n > 0 && retval == CG_OK)
+      retval = cg_coord_read(imp->cg_fn, imp->base_id, imp->zone_id, name,
+                             CGNS_ENUMV(RealDouble), &rmin, &rmax, buf);
+#else
+    if (n > 0 && retval == CG_OK)
+      retval = cg_coord_read(imp->cg_fn, imp->base_id, imp->zone_id, name,
+                             CGNS_ENUMV(RealDouble), &rmin, &rmax, buf);
+#endif
+
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("CGNS: error reading coordinates from file \"%s\":\n%s"),
+                imp->path, cg_get_error());
+
+    for (cs_lnum_t i = 0; i < n; i++)
+      coords[i*3 + dim_id] = buf[i];
+
+  }
+
+  BFT_FREE(buf);
+}
+
+#endif /* defined(HAVE_CGNS) */
+
+#if defined(HAVE_MED)
+
+/*----------------------------------------------------------------------------
+ * Open MED file.
+ *
+ * parameters:
+ *   imp <-> import state
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_open(_import_t  *imp)
+{
+#if defined(HAVE_MED_MPI)
+  if (imp->parallel_io) {
+
+    /* Get MPI IO hints from general code settings */
+
+    MPI_Info hints;
+    cs_file_get_default_access(CS_FILE_MODE_READ, nullptr, &hints);
+
+    imp->med_fid = MEDparFileOpen(imp->path, MED_ACC_RDONLY,
+                                  cs_glob_mpi_comm, hints);
+
+  }
+  else
+    imp->med_fid = MEDfileOpen(imp->path, MED_ACC_RDONLY);
+#else
+  imp->med_fid = MEDfileOpen(imp->path, MED_ACC_RDONLY);
+#endif
+
+  if (imp->med_fid < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED: error opening file \"%s\"."), imp->path);
+}
+
+/*----------------------------------------------------------------------------
+ * Close MED file.
+ *
+ * parameters:
+ *   imp <-> import state
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_close(_import_t  *imp)
+{
+  MEDfileClose(imp->med_fid);
+  imp->med_fid = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Return number of entities of a given type in a MED mesh.
+ *
+ * parameters:
+ *   imp       <-- import state
+ *   ent_type  <-- entity type
+ *   geo_type  <-- geometric type
+ *   data_type <-- data type
+ *
+ * returns:
+ *   number of entities
+ *----------------------------------------------------------------------------*/
+
+static med_int
+_med_n_entities(const _import_t    *imp,
+                med_entity_type     ent_type,
+                med_geometry_type   geo_type,
+                med_data_type       data_type)
+{
+  med_bool changement, transformation;
+
+  med_int n = MEDmeshnEntity(imp->med_fid,
+                             imp->mesh_name,
+                             MED_NO_DT,
+                             MED_NO_IT,
+                             ent_type,
+                             geo_type,
+                             data_type,
+                             MED_NODAL,
+                             &changement,
+                             &transformation);
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Read MED file metadata and define mesh families and groups.
+ *
+ * MED element families (with negative numbers) are mapped to mesh
+ * families, with the same groups.
+ *
+ * parameters:
+ *   imp  <-> import state
+ *   mesh <-> mesh being defined
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_read_headers(_import_t  *imp,
+                  cs_mesh_t  *mesh)
+{
+  const med_idt fid = imp->med_fid;
+
+  if (MEDnMesh(fid) < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED: no mesh found in file \"%s\"."), imp->path);
+
+  med_int space_dim = MEDmeshnAxis(fid, 1);
+  if (space_dim < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED: error reading file \"%s\"."), imp->path);
+
+  {
+    med_int mesh_dim, n_steps;
+    med_mesh_type mesh_type;
+    med_sorting_type sorting_type;
+    med_axis_type axis_type;
+    char desc[MED_COMMENT_SIZE + 1];
+    char dt_unit[MED_SNAME_SIZE + 1];
+    char *axis_name = nullptr, *axis_unit = nullptr;
+
+    BFT_MALLOC(axis_name, space_dim*MED_SNAME_SIZE + 1, char);
+    BFT_MALLOC(axis_unit, space_dim*MED_SNAME_SIZE + 1, char);
+
+    med_err retval = MEDmeshInfo(fid, 1, imp->mesh_name,
+                                 &space_dim, &mesh_dim, &mesh_type,
+                                 desc, dt_unit, &sorting_type, &n_steps,
+                                 &axis_type, axis_name, axis_unit);
+
+    BFT_FREE(axis_unit);
+    BFT_FREE(axis_name);
+
+    if (retval < 0 || mesh_dim != 3)
+      bft_error(__FILE__, __LINE__, 0,
+                _("MED: mesh of file \"%s\" is not a volume mesh."),
+                imp->path);
+
+    imp->mesh_name[MED_NAME_SIZE] = '\0';
+  }
+
+  imp->space_dim = space_dim;
+
+  imp->n_g_vertices = _med_n_entities(imp, MED_NODE, MED_NONE,
+                                      MED_COORDINATE);
+
+  /* Polyhedra and polygons require the Preprocessor */
+
+  if (   _med_n_entities(imp, MED_CELL, MED_POLYHEDRON, MED_INDEX_FACE) > 1
+      || _med_n_entities(imp, MED_CELL, MED_POLYGON, MED_INDEX_NODE) > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED: file \"%s\" contains polygons or polyhedra,\n"
+                "which may not be imported directly;\n"
+                "use the Preprocessor for this mesh."), imp->path);
+
+  /* Element sections (one per geometric type) */
+
+  const int n_types = sizeof(_med_types) / sizeof(_med_types[0]);
+
+  for (int i = 0; i < n_types; i++) {
+
+    med_geometry_type geo_type = _med_types[i];
+
+    med_int n = _med_n_entities(imp, MED_CELL, geo_type, MED_CONNECTIVITY);
+    if (n < 1)
+      continue;
+
+    _section_t *s = _add_section(imp);
+
+    s->s_id = geo_type;
+    s->n_vtx = geo_type % 100;
+    s->volume = (geo_type / 100 == 3);
+    s->n_g_elts = n;
+    s->has_family
+      = (_med_n_entities(imp, MED_CELL, geo_type, MED_FAMILY_NUMBER) > 0);
+
+    switch (geo_type) {
+    case MED_TRIA3:
+    case MED_TRIA6:
+    case MED_TRIA7:
+      s->n_corners = 3;
+      break;
+    case MED_QUAD4:
+    case MED_QUAD8:
+    case MED_QUAD9:
+    case MED_TETRA4:
+    case MED_TETRA10:
+      s->n_corners = 4;
+      break;
+    case MED_PYRA5:
+    case MED_PYRA13:
+      s->n_corners = 5;
+      break;
+    case MED_PENTA6:
+    case MED_PENTA15:
+      s->n_corners = 6;
+      break;
+    default:
+      s->n_corners = 8;
+    }
+
+  }
+
+  _set_section_shifts(imp);
+
+  /* Element families and groups */
+
+  med_int n_med_fam = MEDnFamily(fid, imp->mesh_name);
+
+  int n_families = 0, n_max_items = 0, n_groups = 0;
+  int *family_item = nullptr;
+  int *group_idx = nullptr;
+  char *group = nullptr;
+  int *n_fam_groups = nullptr;
+
+  BFT_MALLOC(imp->family_num, CS_MAX(n_med_fam, 1), int);
+  BFT_MALLOC(n_fam_groups, CS_MAX(n_med_fam, 1), int);
+  BFT_MALLOC(group_idx, 1, int);
+  group_idx[0] = 0;
+
+  for (int f_id = 0; f_id < n_med_fam; f_id++) {
+
+    char fam_name[MED_NAME_SIZE + 1];
+    char g_name[MED_LNAME_SIZE + 1];
+    char *g_names = nullptr;
+    med_int fam_num = 0;
+
+    med_int n_g = MEDnFamilyGroup(fid, imp->mesh_name, f_id + 1);
+    if (n_g < 0)
+      n_g = 0;
+
+    BFT_MALLOC(g_names, n_g*MED_LNAME_SIZE + 1, char);
+
+    if (MEDfamilyInfo(fid, imp->mesh_name, f_id + 1,
+                      fam_name, &fam_num, g_names) < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("MED: error reading families from file \"%s\"."),
+                imp->path);
+
+    /* Only element families are needed */
+
+    if (fam_num < 0) {
+
+      BFT_REALLOC(group_idx, n_groups + n_g + 1, int);
+
+      for (int j = 0; j < n_g; j++) {
+        _copy_name(g_name, g_names + j*MED_LNAME_SIZE, MED_LNAME_SIZE);
+        size_t l = strlen(g_name) + 1;
+        BFT_REALLOC(group, group_idx[n_groups] + l, char);
+        memcpy(group + group_idx[n_groups], g_name, l);
+        group_idx[n_groups + 1] = group_idx[n_groups] + l;
+        n_groups++;
+      }
+
+      imp->family_num[n_families] = fam_num;
+      n_fam_groups[n_families] = n_g;
+      n_families++;
+      n_max_items = CS_MAX(n_max_items, n_g);
+
+    }
+
+    BFT_FREE(g_names);
+
+  }
+
+  /* Order families by number (groups are numbered in family order) */
+
+  int *g_shift = nullptr;
+  BFT_MALLOC(g_shift, n_families + 1, int);
+  g_shift[0] = 0;
+  for (int i = 0; i < n_families; i++)
+    g_shift[i+1] = g_shift[i] + n_fam_groups[i];
+
+  cs_lnum_t *order = nullptr;
+  BFT_MALLOC(order, n_families, cs_lnum_t);
+  for (int i = 0; i < n_families; i++)
+    order[i] = i;
+  for (int i = 1; i < n_families; i++) {
+    cs_lnum_t o = order[i];
+    int j = i - 1;
+    while (j > -1 && imp->family_num[order[j]] > imp->family_num[o]) {
+      order[j+1] = order[j];
+      j--;
+    }
+    order[j+1] = o;
+  }
+
+  int *family_num = nullptr;
+  BFT_MALLOC(family_num, CS_MAX(n_families, 1), int);
+  BFT_MALLOC(family_item, n_families*n_max_items, int);
+
+  for (int i = 0; i < n_families; i++) {
+    cs_lnum_t o = order[i];
+    family_num[i] = imp->family_num[o];
+    for (int j = 0; j < n_max_items; j++)
+      family_item[n_families*j + i]
+        = (j < n_fam_groups[o]) ? -(g_shift[o] + j + 1) : 0;
+  }
+
+  BFT_FREE(imp->family_num);
+  imp->family_num = family_num;
+  imp->n_families = n_families;
+
+  _define_families(mesh, n_families, n_max_items, family_item,
+                   n_groups, group_idx, group);
+
+  BFT_FREE(order);
+  BFT_FREE(g_shift);
+  BFT_FREE(family_item);
+  BFT_FREE(n_fam_groups);
+  BFT_FREE(group);
+  BFT_FREE(group_idx);
+}
+
+/*----------------------------------------------------------------------------
+ * Create a MED filter for a contiguous block of entities.
+ *
+ * parameters:
+ *   imp        <-- import state
+ *   n_g_ents   <-- global number of entities
+ *   n_comp     <-- number of values per entity
+ *   offset     <-- offset of first entity in block
+ *   n          <-- number of entities in block
+ *   filter     --> associated filter
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_block_filter(const _import_t  *imp,
+                  cs_gnum_t         n_g_ents,
+                  int               n_comp,
+                  cs_gnum_t         offset,
+                  cs_lnum_t         n,
+                  med_filter       *filter)
+{
+  med_int count = (n > 0) ? 1 : 0;
+
+  med_err retval = MEDfilterBlockOfEntityCr(imp->med_fid,
+                                            n_g_ents,
+                                            1,
+                                            n_comp,
+                                            MED_ALL_CONSTITUENT,
+                                            MED_FULL_INTERLACE,
+                                            MED_COMPACT_STMODE,
+                                            MED_NO_PROFILE,
+                                            offset + 1,  /* start */
+                                            n,           /* stride */
+                                            count,
+                                            n,           /* blocksize */
+                                            0,           /* lastblocksize */
+                                            filter);
+
+  if (retval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MEDfilterBlockOfEntityCr() failed for file \"%s\"."),
+              imp->path);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of elements from a MED geometric type section.
+ *
+ * This is a collective operation when using parallel IO.
+ *
+ * parameters:
+ *   imp    <-- import state
+ *   s      <-- section
+ *   offset <-- offset of first element to read in section
+ *   n      <-- number of elements to read
+ *   eb     <-> element block (elements are appended)
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_read_section(const _import_t   *imp,
+                  const _section_t  *s,
+                  cs_gnum_t          offset,
+                  cs_lnum_t          n,
+                  _elt_block_t      *eb)
+{
+  med_int *buf = nullptr, *fam = nullptr;
+  med_filter filter = MED_FILTER_INIT;
+
+  BFT_MALLOC(buf, (size_t)n*s->n_vtx, med_int);
+  BFT_MALLOC(fam, n, med_int);
+
+  _med_block_filter(imp, s->n_g_elts, s->n_vtx, offset, n, &filter);
+
+  med_err retval
+    = MEDmeshElementConnectivityAdvancedRd(imp->med_fid,
+                                           imp->mesh_name,
+                                           MED_NO_DT,
+                                           MED_NO_IT,
+                                           MED_CELL,
+                                           s->s_id,
+                                           MED_NODAL,
+                                           &filter,
+                                           buf);
+
+  MEDfilterClose(&filter);
+
+  if (retval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED: error reading connectivity from file \"%s\"."),
+              imp->path);
+
+  /* Convention: no family data means family 0 */
+
+  for (cs_lnum_t i = 0; i < n; i++)
+    fam[i] = 0;
+
+  if (s->has_family) {
+
+    _med_block_filter(imp, s->n_g_elts, 1, offset, n, &filter);
+
+    retval = MEDmeshEntityAttributeAdvancedRd(imp->med_fid,
+                                              imp->mesh_name,
+                                              MED_FAMILY_NUMBER,
+                                              MED_NO_DT,
+                                              MED_NO_IT,
+                                              MED_CELL,
+                                              s->s_id,
+                                              &filter,
+                                              fam);
+
+    MEDfilterClose(&filter);
+
+    if (retval < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("MED: error reading family numbers from file \"%s\"."),
+                imp->path);
+
+  }
+
+  /* Vertex permutation (cells only, boundary element orientation
+     being unused) */
+
+  const int *perm = nullptr;
+  if (s->volume) {
+    switch (s->n_corners) {
+    case 4:
+      perm = _med_tetra_perm;
+      break;
+    case 5:
+      perm = _med_pyra_perm;
+      break;
+    case 6:
+      perm = _med_penta_perm;
+      break;
+    default:
+      perm = _med_hexa_perm;
+    }
+  }
+
+  cs_lnum_t e_id = eb->n_elts;
+  cs_lnum_t k = eb->vtx_idx[e_id];
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    const med_int *e_vtx = buf + i*s->n_vtx;
+    for (int j = 0; j < s->n_corners; j++) {
+      int l = (perm != nullptr) ? perm[j] : j;
+      eb->vtx[k++] = e_vtx[l];
+    }
+    eb->gc_id[e_id] = _family_gc_id(imp, fam[i]);
+    eb->vtx_idx[e_id + 1] = k;
+    e_id++;
+  }
+
+  eb->n_elts = e_id;
+
+  BFT_FREE(fam);
+  BFT_FREE(buf);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a block of vertex coordinates from a MED file.
+ *
+ * This is a collective operation when using parallel IO.
+ *
+ * parameters:
+ *   imp    <-- import state
+ *   range  <-- global vertex number range (past-the-end)
+ *   coords --> vertex coordinates (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_med_read_vertices(const _import_t  *imp,
+                   const cs_gnum_t   range[2],
+                   cs_real_t         coords[])
+{
+  const cs_lnum_t n = range[1] - range[0];
+  const int dim = imp->space_dim;
+
+  med_float *buf = nullptr;
+  med_filter filter = MED_FILTER_INIT;
+
+  BFT_MALLOC(buf, (size_t)n*dim, med_float);
+
+  _med_block_filter(imp, imp->n_g_vertices, dim, range[0] - 1, n, &filter);
+
+  med_err retval = MEDmeshNodeCoordinateAdvancedRd(imp->med_fid,
+                                                   imp->mesh_name,
+                                                   MED_NO_DT,
+                                                   MED_NO_IT,
+                                                   &filter,
+                                                   buf);
+
+  MEDfilterClose(&filter);
+
+  if (retval < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("MED: error reading coordinates from file \"%s\"."),
+              imp->path);
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    for (int j = 0; j < 3; j++)
+      coords[i*3 + j] = (j < dim) ? buf[i*dim + j] : 0.;
+  }
+
+  BFT_FREE(buf);
+}
+
+#endif /* defined(HAVE_MED) */
+
+/*----------------------------------------------------------------------------
+ * Open mesh file.
+ *
+ * parameters:
+ *   imp <-> import state
+ *----------------------------------------------------------------------------*/
+
+static void
+_open(_import_t  *imp)
+{
+#if !defined(HAVE_CGNS) && !defined(HAVE_MED)
+  CS_UNUSED(imp);
+#endif
+#if defined(HAVE_CGNS)
+  if (imp->format == _FORMAT_CGNS)
+    _cgns_open(imp);
+#endif
+#if defined(HAVE_MED)
+  if (imp->format == _FORMAT_MED)
+    _med_open(imp);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Close mesh file.
+ *
+ * parameters:
+ *   imp <-> import state
+ *----------------------------------------------------------------------------*/
+
+static void
+_close(_import_t  *imp)
+{
+#if !defined(HAVE_CGNS) && !defined(HAVE_MED)
+  CS_UNUSED(imp);
+#endif
+#if defined(HAVE_CGNS)
+  if (imp->format == _FORMAT_CGNS)
+    _cgns_close(imp);
+#endif
+#if defined(HAVE_MED)
+  if (imp->format == _FORMAT_MED)
+    _med_close(imp);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Read elements of a given kind in a global number range.
+ *
+ * All sections are visited on all ranks, so as to allow for collective
+ * reads.
+ *
+ * parameters:
+ *   imp    <-- import state
+ *   volume <-- true for cells, false for boundary elements
+ *   range  <-- global element number range (past-the-end)
+ *   eb     --> element block
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_elements(const _import_t  *imp,
+               bool              volume,
+               const cs_gnum_t   range[2],
+               _elt_block_t     *eb)
+{
+  /* Compute sizes */
+
+  cs_lnum_t n_elts = 0;
+  size_t connect_size = 0;
+
+  for (int i = 0; i < imp->n_sections; i++) {
+    const _section_t *s = imp->sections + i;
+    if (s->volume != volume)
+      continue;
+    cs_gnum_t s0 = CS_MAX(range[0], s->gnum_shift + 1);
+    cs_gnum_t s1 = CS_MIN(range[1], s->gnum_shift + 1 + s->n_g_elts);
+    if (s1 > s0) {
+      n_elts += s1 - s0;
+      connect_size += (size_t)(s1 - s0) * s->n_corners;
+    }
+  }
+
+  eb->n_elts = 0;
+  BFT_MALLOC(eb->vtx_idx, n_elts + 1, cs_lnum_t);
+  BFT_MALLOC(eb->vtx, connect_size, cs_gnum_t);
+  BFT_MALLOC(eb->gc_id, n_elts, int);
+  eb->vtx_idx[0] = 0;
+
+  /* Read data */
+
+  for (int i = 0; i < imp->n_sections; i++) {
+
+    const _section_t *s = imp->sections + i;
+    if (s->volume != volume)
+      continue;
+
+    cs_gnum_t s0 = CS_MAX(range[0], s->gnum_shift + 1);
+    cs_gnum_t s1 = CS_MIN(range[1], s->gnum_shift + 1 + s->n_g_elts);
+    cs_lnum_t n = 0;
+    cs_gnum_t offset = 0;
+    if (s1 > s0) {
+      n = s1 - s0;
+      offset = s0 - (s->gnum_shift + 1);
+    }
+
+#if !defined(HAVE_CGNS) && !defined(HAVE_MED)
+    CS_UNUSED(n);
+    CS_UNUSED(offset);
+#endif
+#if defined(HAVE_CGNS)
+    if (imp->format == _FORMAT_CGNS)
+      _cgns_read_section(imp, s, offset, n, eb);
+#endif
+#if defined(HAVE_MED)
+    if (imp->format == _FORMAT_MED)
+      _med_read_section(imp, s, offset, n, eb);
+#endif
+
+  }
+
+  assert(eb->n_elts == n_elts);
+}
+
+/*----------------------------------------------------------------------------
+ * Free element block arrays.
+ *
+ * parameters:
+ *   eb <-> element block
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_elements(_elt_block_t  *eb)
+{
+  BFT_FREE(eb->vtx_idx);
+  BFT_FREE(eb->vtx);
+  BFT_FREE(eb->gc_id);
+  eb->n_elts = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Build face records from cells and boundary elements.
+ *
+ * Each record contains up to 4 face vertices (0-padded), the global number
+ * of the adjacent cell (0 for boundary elements), and a group class id
+ * (0 for cell faces).
+ *
+ * parameters:
+ *   cell_gnum_shift <-- global cell number shift for cell block
+ *   cells           <-- cells block
+ *   b_elts          <-- boundary elements block
+ *   n_recs          --> number of face records
+ *
+ * returns:
+ *   face records array
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t *
+_face_records(cs_gnum_t            cell_gnum_shift,
+              const _elt_block_t  *cells,
+              const _elt_block_t  *b_elts,
+              cs_lnum_t           *n_recs)
+{
+  const int stride = _FACE_REC_STRIDE;
+
+  cs_lnum_t n = b_elts->n_elts;
+
+  for (cs_lnum_t i = 0; i < cells->n_elts; i++) {
+    int t = _cell_type(cells->vtx_idx[i+1] - cells->vtx_idx[i]);
+    assert(t > -1);
+    n += _n_cell_faces[t];
+  }
+
+  cs_gnum_t *recs = nullptr;
+  BFT_MALLOC(recs, (size_t)n*stride, cs_gnum_t);
+
+  cs_lnum_t r_id = 0;
+
+  for (cs_lnum_t i = 0; i < cells->n_elts; i++) {
+    const cs_gnum_t *c_vtx = cells->vtx + cells->vtx_idx[i];
+    int t = _cell_type(cells->vtx_idx[i+1] - cells->vtx_idx[i]);
+    for (int j = 0; j < _n_cell_faces[t]; j++) {
+      cs_gnum_t *r = recs + (size_t)r_id*stride;
+      for (int k = 0; k < 4; k++) {
+        int v_id = _cell_face_vtx[t][j][k];
+        r[k] = (v_id > -1) ? c_vtx[v_id] : 0;
+      }
+      r[4] = cell_gnum_shift + i + 1;
+      r[5] = 0;
+      r_id++;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < b_elts->n_elts; i++) {
+    cs_gnum_t *r = recs + (size_t)r_id*stride;
+    cs_lnum_t s_id = b_elts->vtx_idx[i];
+    cs_lnum_t n_vtx = b_elts->vtx_idx[i+1] - s_id;
+    for (int k = 0; k < 4; k++)
+      r[k] = (k < n_vtx) ? b_elts->vtx[s_id + k] : 0;
+    r[4] = 0;
+    r[5] = b_elts->gc_id[i];
+    r_id++;
+  }
+
+  *n_recs = n;
+
+  return recs;
+}
+
+/*----------------------------------------------------------------------------
+ * Match face records sharing the same vertices.
+ *
+ * Faces shared by 2 cells become interior faces, oriented from the cell
+ * with lowest number, and faces adjacent to a single cell become boundary
+ * faces. Group class ids from matching boundary elements are assigned
+ * to faces.
+ *
+ * parameters:
+ *   n_recs         <-- number of face records
+ *   recs           <-- face records
+ *   n_faces        --> number of faces
+ *   face_vtx_idx   --> face -> vertices index
+ *   face_vtx       --> face -> vertices connectivity
+ *   face_cells     --> face -> cells connectivity
+ *   face_gc_id     --> face group class ids
+ *   n_unmatched    --> number of unmatched boundary elements
+ *   n_nonconformal --> number of faces shared by more than 2 cells
+ *----------------------------------------------------------------------------*/
+
+static void
+_match_faces(cs_lnum_t          n_recs,
+             const cs_gnum_t    recs[],
+             cs_lnum_t         *n_faces,
+             cs_lnum_t        **face_vtx_idx,
+             cs_gnum_t        **face_vtx,
+             cs_gnum_t        **face_cells,
+             int              **face_gc_id,
+             cs_gnum_t         *n_unmatched,
+             cs_gnum_t         *n_nonconformal)
+{
+  const int stride = _FACE_REC_STRIDE;
+
+  /* Sorted vertex keys */
+
+  cs_gnum_t *keys = nullptr;
+  BFT_MALLOC(keys, (size_t)n_recs*4, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_recs; i++) {
+    cs_gnum_t *k = keys + (size_t)i*4;
+    for (int j = 0; j < 4; j++)
+      k[j] = recs[(size_t)i*stride + j];
+    for (int j = 1; j < 4; j++) {
+      cs_gnum_t v = k[j];
+      int l = j - 1;
+      while (l > -1 && k[l] > v) {
+        k[l+1] = k[l];
+        l--;
+      }
+      k[l+1] = v;
+    }
+  }
+
+  cs_lnum_t *order = cs_order_gnum_s(nullptr, keys, 4, n_recs);
+
+  cs_lnum_t *_face_vtx_idx = nullptr;
+  cs_gnum_t *_face_vtx = nullptr, *_face_cells = nullptr;
+  int *_face_gc_id = nullptr;
+
+  BFT_MALLOC(_face_vtx_idx, n_recs + 1, cs_lnum_t);
+  BFT_MALLOC(_face_vtx, (size_t)n_recs*4, cs_gnum_t);
+  BFT_MALLOC(_face_cells, (size_t)n_recs*2, cs_gnum_t);
+  BFT_MALLOC(_face_gc_id, n_recs, int);
+
+  _face_vtx_idx[0] = 0;
+
+  cs_lnum_t f_id = 0;
+  cs_gnum_t _n_unmatched = 0, _n_nonconformal = 0;
+
+  cs_lnum_t i = 0;
+  while (i < n_recs) {
+
+    const cs_gnum_t *k_i = keys + (size_t)order[i]*4;
+
+    cs_lnum_t j = i + 1;
+    while (j < n_recs) {
+      const cs_gnum_t *k_j = keys + (size_t)order[j]*4;
+      if (   k_i[0] != k_j[0] || k_i[1] != k_j[1]
+          || k_i[2] != k_j[2] || k_i[3] != k_j[3])
+        break;
+      j++;
+    }
+
+    cs_lnum_t c_rec[2] = {-1, -1};
+    int n_c = 0, gc_id = 0;
+
+    for (cs_lnum_t l = i; l < j; l++) {
+      const cs_gnum_t *r = recs + (size_t)order[l]*stride;
+      if (r[4] > 0) {
+        if (n_c < 2)
+          c_rec[n_c] = order[l];
+        n_c++;
+      }
+      else
+        gc_id = r[5];
+    }
+
+    if (n_c == 0)
+      _n_unmatched += 1;
+    else if (n_c > 2)
+      _n_nonconformal += 1;
+    else {
+      if (n_c == 2) {
+        cs_gnum_t c_num_0 = recs[(size_t)c_rec[0]*stride + 4];
+        cs_gnum_t c_num_1 = recs[(size_t)c_rec[1]*stride + 4];
+        if (c_num_1 < c_num_0) {
+          cs_lnum_t tmp = c_rec[0];
+          c_rec[0] = c_rec[1];
+          c_rec[1] = tmp;
+        }
+      }
+      const cs_gnum_t *r0 = recs + (size_t)c_rec[0]*stride;
+      cs_lnum_t s_id = _face_vtx_idx[f_id];
+      cs_lnum_t n_vtx = 0;
+      for (int l = 0; l < 4; l++) {
+        if (r0[l] > 0)
+          _face_vtx[s_id + n_vtx++] = r0[l];
+      }
+      _face_vtx_idx[f_id + 1] = s_id + n_vtx;
+      _face_cells[f_id*2] = r0[4];
+      _face_cells[f_id*2 + 1]
+        = (n_c == 2) ? recs[(size_t)c_rec[1]*stride + 4] : 0;
+      _face_gc_id[f_id] = (gc_id > 0) ? gc_id : 1;
+      f_id++;
+    }
+
+    i = j;
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(keys);
+
+  BFT_REALLOC(_face_vtx_idx, f_id + 1, cs_lnum_t);
+  BFT_REALLOC(_face_vtx, _face_vtx_idx[f_id], cs_gnum_t);
+  BFT_REALLOC(_face_cells, f_id*2, cs_gnum_t);
+  BFT_REALLOC(_face_gc_id, f_id, int);
+
+  *n_faces = f_id;
+  *face_vtx_idx = _face_vtx_idx;
+  *face_vtx = _face_vtx;
+  *face_cells = _face_cells;
+  *face_gc_id = _face_gc_id;
+  *n_unmatched = _n_unmatched;
+  *n_nonconformal = _n_nonconformal;
+}
+
+/*----------------------------------------------------------------------------
+ * Build faces from cells and boundary elements, and distribute them
+ * to the mesh builder's face blocks.
+ *
+ * parameters:
+ *   cells  <-- cells block
+ *   b_elts <-- boundary elements block
+ *   mb     <-> mesh builder
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_faces(const _elt_block_t  *cells,
+             const _elt_block_t  *b_elts,
+             cs_mesh_builder_t   *mb)
+{
+  const int stride = _FACE_REC_STRIDE;
+
+  cs_lnum_t n_recs = 0;
+  cs_gnum_t *recs = _face_records(mb->cell_bi.gnum_range[0] - 1,
+                                  cells,
+                                  b_elts,
+                                  &n_recs);
+
+  /* Send face records to the rank owning their lowest vertex,
+     so that matching faces end up on the same rank */
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_gnum_t *v_min = nullptr;
+    BFT_MALLOC(v_min, n_recs, cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < n_recs; i++) {
+      const cs_gnum_t *r = recs + (size_t)i*stride;
+      cs_gnum_t v = r[0];
+      for (int j = 1; j < 4; j++) {
+        if (r[j] > 0 && r[j] < v)
+          v = r[j];
+      }
+      v_min[i] = v;
+    }
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_recs,
+                                        0, /* flags */
+                                        v_min,
+                                        mb->vertex_bi,
+                                        cs_glob_mpi_comm);
+
+    cs_gnum_t *r_recs
+      = static_cast<cs_gnum_t *>(cs_all_to_all_copy_array(d,
+                                                          CS_GNUM_TYPE,
+                                                          stride,
+                                                          false, /* reverse */
+                                                          recs,
+                                                          nullptr));
+
+    n_recs = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(v_min);
+    BFT_FREE(recs);
+    recs = r_recs;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Match faces */
+
+  cs_lnum_t n_faces = 0;
+  cs_lnum_t *face_vtx_idx = nullptr;
+  cs_gnum_t *face_vtx = nullptr, *face_cells = nullptr;
+  int *face_gc_id = nullptr;
+  cs_gnum_t counts[3] = {0, 0, 0};
+
+  _match_faces(n_recs, recs,
+               &n_faces, &face_vtx_idx, &face_vtx, &face_cells, &face_gc_id,
+               counts, counts + 1);
+
+  BFT_FREE(recs);
+
+  counts[2] = face_vtx_idx[n_faces];
+  cs_parall_counter(counts, 3);
+
+  if (counts[1] > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%llu faces are shared by more than 2 cells.\n"
+                "Non-conforming meshes may not be imported directly;\n"
+                "use the Preprocessor for this mesh."),
+              (unsigned long long)counts[1]);
+
+  if (counts[0] > 0)
+    bft_printf(_("  %llu boundary elements do not match any cell face "
+                 "and are ignored.\n"),
+               (unsigned long long)counts[0]);
+
+  /* Global face numbering and block distribution */
+
+  cs_gnum_t n_g_faces = n_faces;
+  cs_parall_counter(&n_g_faces, 1);
+
+  size_t min_block_size = 0;
+#if defined(HAVE_MPI)
+  min_block_size = cs_parall_get_min_coll_buf_size();
+#endif
+
+  mb->n_g_faces = n_g_faces;
+  mb->n_g_face_connect_size = counts[2];
+
+  mb->face_bi
+    = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                  cs_glob_n_ranks,
+                                  mb->min_rank_step,
+                                  min_block_size/(sizeof(cs_gnum_t)*2),
+                                  n_g_faces);
+
+  BFT_FREE(mb->face_cells);
+  BFT_FREE(mb->face_vertices_idx);
+  BFT_FREE(mb->face_vertices);
+  BFT_FREE(mb->face_gc_id);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_gnum_t f_shift = 0, _n_faces = n_faces;
+    MPI_Scan(&_n_faces, &f_shift, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    f_shift -= _n_faces;
+
+    cs_gnum_t *face_gnum = nullptr;
+    BFT_MALLOC(face_gnum, n_faces, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_faces; i++)
+      face_gnum[i] = f_shift + i + 1;
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_faces,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        face_gnum,
+                                        mb->face_bi,
+                                        cs_glob_mpi_comm);
+
+    mb->face_cells
+      = static_cast<cs_gnum_t *>(cs_all_to_all_copy_array(d,
+                                                          CS_GNUM_TYPE,
+                                                          2,
+                                                          false,
+                                                          face_cells,
+                                                          nullptr));
+
+    mb->face_gc_id
+      = static_cast<int *>(cs_all_to_all_copy_array(d,
+                                                    CS_INT_TYPE,
+                                                    1,
+                                                    false,
+                                                    face_gc_id,
+                                                    nullptr));
+
+    cs_lnum_t n_b_faces = cs_all_to_all_n_elts_dest(d);
+
+    BFT_MALLOC(mb->face_vertices_idx, n_b_faces + 1, cs_lnum_t);
+
+    cs_all_to_all_copy_index(d,
+                             false,
+                             face_vtx_idx,
+                             mb->face_vertices_idx);
+
+    void *_face_vertices
+      = cs_all_to_all_copy_indexed(d,
+                                   CS_GNUM_TYPE,
+                                   false,
+                                   face_vtx_idx,
+                                   face_vtx,
+                                   mb->face_vertices_idx,
+                                   nullptr);
+    mb->face_vertices = static_cast<cs_gnum_t *>(_face_vertices);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(face_gnum);
+    BFT_FREE(face_gc_id);
+    BFT_FREE(face_cells);
+    BFT_FREE(face_vtx);
+    BFT_FREE(face_vtx_idx);
+
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Single block: transfer ownership */
+
+  mb->face_cells = face_cells;
+  mb->face_vertices_idx = face_vtx_idx;
+  mb->face_vertices = face_vtx;
+  mb->face_gc_id = face_gc_id;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh file may be imported directly by the solver.
+ *
+ * Files with a ".cgns" or ".med" extension are handled when code_saturne
+ * is built with the matching library.
+ *
+ * \param[in]  path  mesh file path
+ *
+ * \return  true if the file format is handled, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_import_is_supported(const char  *path)
+{
+  bool retval = false;
+
+  if (path == nullptr)
+    return retval;
+
+#if defined(HAVE_CGNS)
+  if (_has_extension(path, ".cgns"))
+    retval = true;
+#endif
+
+#if defined(HAVE_MED)
+  if (_has_extension(path, ".med"))
+    retval = true;
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh dimensions and group definitions from a CGNS or MED file.
+ *
+ * The mesh structure should be empty. Section metadata is kept until
+ * \ref cs_mesh_import_read_data is called.
+ *
+ * \param[in]       path  mesh file path
+ * \param[in, out]  mesh  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_read_headers(const char  *path,
+                            cs_mesh_t   *mesh)
+{
+  if (! cs_mesh_import_is_supported(path))
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh file \"%s\" may not be imported directly."), path);
+
+  _import_destroy();
+
+  BFT_MALLOC(_import, 1, _import_t);
+  memset(_import, 0, sizeof(_import_t));
+
+  _import_t *imp = _import;
+
+  BFT_MALLOC(imp->path, strlen(path) + 1, char);
+  strcpy(imp->path, path);
+
+  imp->format = (_has_extension(path, ".cgns")) ? _FORMAT_CGNS : _FORMAT_MED;
+  imp->parallel_io = (cs_glob_n_ranks > 1) ? true : false;
+
+  bft_printf(_(" Reading metadata from file: \"%s\"\n"), path);
+
+  _open(imp);
+
+#if defined(HAVE_CGNS)
+  if (imp->format == _FORMAT_CGNS)
+    _cgns_read_headers(imp, mesh);
+#endif
+#if defined(HAVE_MED)
+  if (imp->format == _FORMAT_MED)
+    _med_read_headers(imp, mesh);
+#endif
+
+  _close(imp);
+
+  mesh->dim = 3;
+  mesh->n_g_cells = imp->n_g_cells;
+  mesh->n_g_vertices = imp->n_g_vertices;
+
+  bft_printf(_("  Number of cells:              %llu\n"
+               "  Number of boundary elements:  %llu\n"
+               "  Number of vertices:           %llu\n"),
+             (unsigned long long)imp->n_g_cells,
+             (unsigned long long)imp->n_g_b_elts,
+             (unsigned long long)imp->n_g_vertices);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh data from a CGNS or MED file into a mesh builder.
+ *
+ * Each rank reads only the cells and vertices of its block (based on
+ * the builder's cell and vertex block distributions, which must be
+ * defined). Cell faces are then generated and matched in parallel,
+ * boundary elements from the file being used to assign face families,
+ * and the resulting faces are distributed into the builder's face
+ * blocks. The global number of faces and the face block distribution
+ * are defined here.
+ *
+ * \param[in, out]  mesh  pointer to mesh structure
+ * \param[in, out]  mb    pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_read_data(cs_mesh_t          *mesh,
+                         cs_mesh_builder_t  *mb)
+{
+  _import_t *imp = _import;
+
+  if (imp == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: mesh headers must be read first."), __func__);
+
+  assert(mesh->n_g_cells == imp->n_g_cells);
+
+  bft_printf(_(" Reading mesh from file in parallel: \"%s\"\n"), imp->path);
+
+  _open(imp);
+
+  /* Vertices (builder vertex block) */
+
+  const cs_gnum_t *v_range = mb->vertex_bi.gnum_range;
+  cs_lnum_t n_vertices = v_range[1] - v_range[0];
+
+  BFT_REALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+
+#if defined(HAVE_CGNS)
+  if (imp->format == _FORMAT_CGNS)
+    _cgns_read_vertices(imp, v_range, mb->vertex_coords);
+#endif
+#if defined(HAVE_MED)
+  if (imp->format == _FORMAT_MED)
+    _med_read_vertices(imp, v_range, mb->vertex_coords);
+#endif
+
+  /* Cells (builder cell block) and boundary elements (even distribution) */
+
+  _elt_block_t cells, b_elts;
+
+  _read_elements(imp, true, mb->cell_bi.gnum_range, &cells);
+
+  cs_block_dist_info_t b_bi
+    = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                  cs_glob_n_ranks,
+                                  1,
+                                  0,
+                                  imp->n_g_b_elts);
+
+  _read_elements(imp, false, b_bi.gnum_range, &b_elts);
+
+  _close(imp);
+
+  BFT_FREE(mb->cell_gc_id);
+  mb->cell_gc_id = cells.gc_id;
+  cells.gc_id = nullptr;
+
+  /* Faces */
+
+  _build_faces(&cells, &b_elts, mb);
+
+  _free_elements(&b_elts);
+  _free_elements(&cells);
+
+  bft_printf(_("  Number of faces:              %llu\n\n"),
+             (unsigned long long)mb->n_g_faces);
+
+  _import_destroy();
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
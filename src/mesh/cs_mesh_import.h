@@ -0,0 +1,103 @@
+#ifndef __CS_MESH_IMPORT_H__
+#define __CS_MESH_IMPORT_H__
+
+/*============================================================================
+ * Parallel, block-distributed import of CGNS and MED meshes.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ *  Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if a mesh file may be imported directly by the solver.
+ *
+ * Files with a ".cgns" or ".med" extension are handled when code_saturne
+ * is built with the matching library.
+ *
+ * \param[in]  path  mesh file path
+ *
+ * \return  true if the file format is handled, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_import_is_supported(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh dimensions and group definitions from a CGNS or MED file.
+ *
+ * The mesh structure should be empty. Section metadata is kept until
+ * \ref cs_mesh_import_read_data is called.
+ *
+ * \param[in]       path  mesh file path
+ * \param[in, out]  mesh  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_read_headers(const char  *path,
+                            cs_mesh_t   *mesh);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read mesh data from a CGNS or MED file into a mesh builder.
+ *
+ * Each rank reads only the cells and vertices of its block (based on
+ * the builder's cell and vertex block distributions, which must be
+ * defined). Cell faces are then generated and matched in parallel,
+ * boundary elements from the file being used to assign face families,
+ * and the resulting faces are distributed into the builder's face
+ * blocks. The global number of faces and the face block distribution
+ * are defined here.
+ *
+ * \param[in, out]  mesh  pointer to mesh structure
+ * \param[in, out]  mb    pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_import_read_data(cs_mesh_t          *mesh,
+                         cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_IMPORT_H__ */
@@ -47,6 +47,7 @@
 
 #include "cs_array.h"
 #include "cs_base.h"
+#include "cs_dispatch.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
 #include "cs_math.h"
@@ -89,6 +90,19 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+/* Subset of faces and cells for which quantities are computed */
+
+typedef struct {
+
+  cs_lnum_t         n_i_faces;   /* Number of interior faces in subset */
+  cs_lnum_t         n_b_faces;   /* Number of boundary faces in subset */
+  const cs_lnum_t  *i_face_ids;  /* Interior face ids, or nullptr for all */
+  const cs_lnum_t  *b_face_ids;  /* Boundary face ids, or nullptr for all */
+  const cs_lnum_t  *cell_flag;   /* Nonzero for cells in subset (with
+                                    ghosts), or nullptr for all */
+
+} _elt_subset_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -123,6 +137,121 @@ static int _n_computations = 0;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Run a dispatch context on the host if some arrays are not accessible
+ * from the device.
+ *
+ * parameters:
+ *   n_ptrs <--  number of arrays
+ *   ptrs   <--  arrays (nullptr entries are ignored)
+ *   ctx    <->  dispatch context
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_dispatch_ptrs(int                   n_ptrs,
+                     const void           *ptrs[],
+                     cs_dispatch_context  &ctx)
+{
+  if (ctx.use_gpu() == false)
+    return;
+
+  for (int i = 0; i < n_ptrs; i++) {
+    if (ptrs[i] != nullptr && cs_check_device_ptr(ptrs[i]) == CS_ALLOC_HOST) {
+      ctx.set_use_gpu(false);
+      break;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize a dispatch context for mesh quantities computation.
+ *
+ * Computations are run on the device only if the mesh coordinates and
+ * connectivity are accessible from it; otherwise, OpenMP threads are used.
+ *
+ * parameters:
+ *   m   <--  pointer to mesh structure
+ *   ctx <->  dispatch context
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_dispatch_context(const cs_mesh_t      *m,
+                       cs_dispatch_context  &ctx)
+{
+  const void *ptrs[] = {m->vtx_coord,
+                        m->i_face_cells, m->b_face_cells,
+                        m->i_face_vtx_idx, m->i_face_vtx_lst,
+                        m->b_face_vtx_idx, m->b_face_vtx_lst};
+
+  _check_dispatch_ptrs(7, ptrs, ctx);
+}
+
+/*----------------------------------------------------------------------------
+ * Return a subset containing all faces and cells of a mesh.
+ *
+ * parameters:
+ *   m   <--  pointer to mesh structure
+ *
+ * returns:
+ *   subset structure
+ *----------------------------------------------------------------------------*/
+
+static inline _elt_subset_t
+_subset_all(const cs_mesh_t  *m)
+{
+  _elt_subset_t ss = {m->n_i_faces,
+                      CS_MAX(m->n_b_faces, m->n_b_faces_all),
+                      nullptr,
+                      nullptr,
+                      nullptr};
+
+  return ss;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether a loop on interior faces may use the mesh's interior faces
+ * numbering (which allows simple sums on the host).
+ *
+ * parameters:
+ *   m        <--  pointer to mesh structure
+ *   n_faces  <--  number of faces in loop
+ *   face_ids <--  ids of faces in loop, or nullptr for all
+ *
+ * returns:
+ *   true if the loop may use the mesh numbering
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_i_faces_numbered(const cs_mesh_t  *m,
+                  cs_lnum_t         n_faces,
+                  const cs_lnum_t   face_ids[])
+{
+  return (   face_ids == nullptr && n_faces == m->n_i_faces
+          && m->i_face_numbering != nullptr);
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether a loop on boundary faces may use the mesh's boundary faces
+ * numbering (which allows simple sums on the host).
+ *
+ * parameters:
+ *   m        <--  pointer to mesh structure
+ *   n_faces  <--  number of faces in loop
+ *   face_ids <--  ids of faces in loop, or nullptr for all
+ *
+ * returns:
+ *   true if the loop may use the mesh numbering
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_b_faces_numbered(const cs_mesh_t  *m,
+                  cs_lnum_t         n_faces,
+                  const cs_lnum_t   face_ids[])
+{
+  return (   face_ids == nullptr && n_faces == m->n_b_faces
+          && m->b_face_numbering != nullptr);
+}
+
 /*----------------------------------------------------------------------------
  * Project solid vertices to a plane
  *
@@ -340,15 +469,15 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
 }
 
 /*----------------------------------------------------------------------------
- * Compute quantities associated to faces (border or internal)
+ * Compute quantities associated to a single face (border or internal)
  *
  * parameters:
- *   n_faces         <--  number of faces
+ *   s_id            <--  start of face vertices in connectivity
+ *   e_id            <--  end of face vertices in connectivity
  *   vtx_coord       <--  vertex coordinates
- *   face_vtx_idx    <--  "face -> vertices" connectivity index
  *   face_vtx        <--  "face -> vertices" connectivity
- *   face_cog        -->  coordinates of the center of gravity of the faces
- *   face_normal     -->  face surface normals
+ *   face_cog        -->  coordinates of the center of gravity of the face
+ *   face_normal     -->  face surface normal
  *
  *                          Pi+1
  *              *---------*                   B  : barycenter of the polygon
@@ -365,191 +494,218 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
  *            P0
  *----------------------------------------------------------------------------*/
 
-static void
-_compute_face_quantities(cs_lnum_t        n_faces,
-                         const cs_real_t  vtx_coord[][3],
-                         const cs_lnum_t  face_vtx_idx[],
-                         const cs_lnum_t  face_vtx[],
-                         cs_real_t        face_cog[][3],
-                         cs_real_t        face_normal[][3])
+CS_F_HOST_DEVICE static inline void
+_face_quantities(cs_lnum_t        s_id,
+                 cs_lnum_t        e_id,
+                 const cs_real_t  vtx_coord[][3],
+                 const cs_lnum_t  face_vtx[],
+                 cs_real_t        face_cog[3],
+                 cs_real_t        face_normal[3])
 {
-  /* Checking */
-
-  assert(face_cog != nullptr || n_faces == 0);
-  assert(face_normal != nullptr || n_faces == 0);
-
   const cs_real_t one_third = 1./3.;
   const cs_real_t s_epsilon = 1.e-32; /* TODO define better "zero" threshold */
 
-  /* Loop on faces */
+  /* Define the polygon (P) according to the vertices (Pi) of the face */
 
-# pragma omp parallel for  if (n_faces > CS_THR_MIN)
-  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+  cs_lnum_t n_face_vertices = e_id - s_id;
 
-    /* Define the polygon (P) according to the vertices (Pi) of the face */
+  if (n_face_vertices == 3) {
+    const cs_lnum_t v0 = face_vtx[s_id];
+    const cs_lnum_t v1 = face_vtx[s_id+1];
+    const cs_lnum_t v2 = face_vtx[s_id+2];
+    cs_real_t v01[3], v02[3], vn[3];
+    for (cs_lnum_t i = 0; i < 3; i++)
+      face_cog[i] = one_third * (  vtx_coord[v0][i]
+                                 + vtx_coord[v1][i]
+                                 + vtx_coord[v2][i]);
+    for (cs_lnum_t i = 0; i < 3; i++)
+      v01[i] = vtx_coord[v1][i] - vtx_coord[v0][i];
+    for (cs_lnum_t i = 0; i < 3; i++)
+      v02[i] = vtx_coord[v2][i] - vtx_coord[v0][i];
+    cs_math_3_cross_product(v01, v02, vn);
+    for (cs_lnum_t i = 0; i < 3; i++)
+      face_normal[i] = 0.5*vn[i];
+  }
 
-    cs_lnum_t s_id = face_vtx_idx[f_id];
-    cs_lnum_t e_id = face_vtx_idx[f_id + 1];
+  else { /* For non-triangle faces, assume a division into triangles
+            joining edges and an approximate face center */
 
-    cs_lnum_t n_face_vertices = e_id - s_id;
+    /* Compute approximate face center coordinates for the polygon */
 
-    if (n_face_vertices == 3) {
-      const cs_lnum_t v0 = face_vtx[s_id];
-      const cs_lnum_t v1 = face_vtx[s_id+1];
-      const cs_lnum_t v2 = face_vtx[s_id+2];
-      cs_real_t v01[3], v02[3], vn[3];
-      for (cs_lnum_t i = 0; i < 3; i++)
-        face_cog[f_id][i] = one_third * (  vtx_coord[v0][i]
-                                         + vtx_coord[v1][i]
-                                         + vtx_coord[v2][i]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        v01[i] = vtx_coord[v1][i] - vtx_coord[v0][i];
-      for (cs_lnum_t i = 0; i < 3; i++)
-        v02[i] = vtx_coord[v2][i] - vtx_coord[v0][i];
-      cs_math_3_cross_product(v01, v02, vn);
+    cs_real_t a_center[3] = {0, 0, 0};
+    cs_real_t f_center[3] = {0, 0, 0}, f_norm[3] = {0, 0, 0};
+
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      const cs_lnum_t v0 = face_vtx[j];
       for (cs_lnum_t i = 0; i < 3; i++)
-        face_normal[f_id][i] = 0.5*vn[i];
+        a_center[i] += vtx_coord[v0][i];
     }
 
-    else { /* For non-triangle faces, assume a division into triangles
-              joining edges and an approximate face center */
-
-      /* Compute approximate face center coordinates for the polygon */
+    for (cs_lnum_t i = 0; i < 3; i++)
+      a_center[i] /= n_face_vertices;
 
-      cs_real_t a_center[3] = {0, 0, 0};
-      cs_real_t f_center[3] = {0, 0, 0}, f_norm[3] = {0, 0, 0};
+    cs_real_t d_surf_d3 = 0.;
 
-      for (cs_lnum_t j = s_id; j < e_id; j++) {
-        const cs_lnum_t v0 = face_vtx[j];
-        for (cs_lnum_t i = 0; i < 3; i++)
-          a_center[i] += vtx_coord[v0][i];
-      }
+    /* In most cases, the following 2 loops can be merged into a single loop,
+       but for very bad quality faces, some sub-triangles could be oriented
+       differently, so we use 2 passes for safety. */
 
-      for (cs_lnum_t i = 0; i < 3; i++)
-        a_center[i] /= n_face_vertices;
+    if (n_face_vertices < 8) { /* version with local caching for most cases */
 
-      cs_real_t d_surf_d3 = 0.;
+      cs_real_t vc0[3], vc1[3], vn[8][3], vtc[8][3];
 
-      /* In most cases, the following 2 loops can be merged into a single loop,
-         but for very bad quality faces, some sub-triangles could be oriented
-         differently, so we use 2 passes for safety. */
+      /* First pass (face normal) */
 
-      if (n_face_vertices < 8) { /* version with local caching for most cases */
+      for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
 
-        cs_real_t vc0[3], vc1[3], vn[8][3], vtc[8][3];
+        const cs_lnum_t v0 = face_vtx[s_id + tri_id];
+        const cs_lnum_t v1 = face_vtx[s_id + (tri_id+1)%n_face_vertices];
 
-        /* First pass (face normal) */
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          vc0[i] = vtx_coord[v0][i] - a_center[i];
+          vc1[i] = vtx_coord[v1][i] - a_center[i];
+          /* center in the relative reference frame (shifted by a_center) */
+          vtc[tri_id][i] = vc0[i] + vc1[i];
+        }
 
-        for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
+        cs_math_3_cross_product(vc0, vc1, vn[tri_id]);
 
-          const cs_lnum_t v0 = face_vtx[s_id + tri_id];
-          const cs_lnum_t v1 = face_vtx[s_id + (tri_id+1)%n_face_vertices];
+        for (cs_lnum_t i = 0; i < 3; i++)
+          f_norm[i] += 0.5 * vn[tri_id][i];
 
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            vc0[i] = vtx_coord[v0][i] - a_center[i];
-            vc1[i] = vtx_coord[v1][i] - a_center[i];
-            /* center in the relative reference frame (shifted by a_center) */
-            vtc[tri_id][i] = vc0[i] + vc1[i];
-          }
+      }
 
-          cs_math_3_cross_product(vc0, vc1, vn[tri_id]);
+      /* Second pass (face center) */
 
-          for (cs_lnum_t i = 0; i < 3; i++)
-            f_norm[i] += 0.5 * vn[tri_id][i];
+      cs_real_t sum_w = cs_math_3_norm(f_norm);
+      cs_real_t inv_norm = 1.;
+      if (sum_w > s_epsilon) {
+        inv_norm = 1. / sum_w;
+        d_surf_d3 = one_third * inv_norm;
+      }
+      cs_real_t n[3];
+      for (int i = 0; i < 3; i++)
+        n[i] = inv_norm * f_norm[i];
 
-        }
+      for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
 
-        /* Second pass (face center) */
+        /* Projected surface of the triangle in the normal direction */
+        cs_real_t w = 0.5 * cs_math_3_dot_product(vn[tri_id], n);
 
-        cs_real_t sum_w = cs_math_3_norm(f_norm);
-        cs_real_t inv_norm = 1.;
-        if (sum_w > s_epsilon) {
-          inv_norm = 1. / sum_w;
-          d_surf_d3 = one_third * inv_norm;
-        }
-        cs_real_t n[3];
-        for (int i = 0; i < 3; i++)
-          n[i] = inv_norm * f_norm[i];
+        for (cs_lnum_t i = 0; i < 3; i++)
+          f_center[i] += w*vtc[tri_id][i];
 
-        for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
+      }
 
-          /* Projected surface of the triangle in the normal direction */
-          cs_real_t w = 0.5 * cs_math_3_dot_product(vn[tri_id], n);
+    }
+    else  { /* generic version */
 
-          for (cs_lnum_t i = 0; i < 3; i++)
-            f_center[i] += w*vtc[tri_id][i];
+      cs_real_t vc0[3], vc1[3], vn[3], vtc[3];
 
-        }
+      /* First pass (face normal) */
 
-      }
-      else  { /* generic version */
+      for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
 
-        cs_real_t vc0[3], vc1[3], vn[3], vtc[3];
+        const cs_lnum_t v0 = face_vtx[s_id + tri_id];
+        const cs_lnum_t v1 = face_vtx[s_id + (tri_id+1)%n_face_vertices];
 
-        /* First pass (face normal) */
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          vc0[i] = vtx_coord[v0][i] - a_center[i];
+          vc1[i] = vtx_coord[v1][i] - a_center[i];
+        }
 
-        for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
+        cs_math_3_cross_product(vc0, vc1, vn);
 
-          const cs_lnum_t v0 = face_vtx[s_id + tri_id];
-          const cs_lnum_t v1 = face_vtx[s_id + (tri_id+1)%n_face_vertices];
+        for (cs_lnum_t i = 0; i < 3; i++)
+          f_norm[i] += 0.5 * vn[i];
 
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            vc0[i] = vtx_coord[v0][i] - a_center[i];
-            vc1[i] = vtx_coord[v1][i] - a_center[i];
-          }
+      }
 
-          cs_math_3_cross_product(vc0, vc1, vn);
+      /* Second pass (face center) */
 
-          for (cs_lnum_t i = 0; i < 3; i++)
-            f_norm[i] += 0.5 * vn[i];
+      cs_real_t sum_w = cs_math_3_norm(f_norm);
+      cs_real_t inv_norm = 1.;
+      if (sum_w > s_epsilon) {
+        inv_norm = 1. / sum_w;
+        d_surf_d3 = one_third * inv_norm;
+      }
+      cs_real_t n[3];
+      for (int i = 0; i < 3; i++)
+        n[i] = inv_norm * f_norm[i];
 
-        }
+      for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
 
-        /* Second pass (face center) */
+        const cs_lnum_t v0 = face_vtx[s_id + tri_id];
+        const cs_lnum_t v1 = face_vtx[s_id + (tri_id+1)%n_face_vertices];
 
-        cs_real_t sum_w = cs_math_3_norm(f_norm);
-        cs_real_t inv_norm = 1.;
-        if (sum_w > s_epsilon) {
-          inv_norm = 1. / sum_w;
-          d_surf_d3 = one_third * inv_norm;
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          vc0[i] = vtx_coord[v0][i] - a_center[i];
+          vc1[i] = vtx_coord[v1][i] - a_center[i];
+          /* center in the relative reference frame (shifted by a_center) */
+          vtc[i] = vc0[i] + vc1[i];
         }
-        cs_real_t n[3];
-        for (int i = 0; i < 3; i++)
-          n[i] = inv_norm * f_norm[i];
 
-        for (cs_lnum_t tri_id = 0; tri_id < n_face_vertices; tri_id++) {
+        cs_math_3_cross_product(vc0, vc1, vn);
 
-          const cs_lnum_t v0 = face_vtx[s_id + tri_id];
-          const cs_lnum_t v1 = face_vtx[s_id + (tri_id+1)%n_face_vertices];
+        /* Projected surface of the triangle in the normal direction */
+        cs_real_t w = 0.5 * cs_math_3_dot_product(vn, n);
 
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            vc0[i] = vtx_coord[v0][i] - a_center[i];
-            vc1[i] = vtx_coord[v1][i] - a_center[i];
-            /* center in the relative reference frame (shifted by a_center) */
-            vtc[i] = vc0[i] + vc1[i];
-          }
+        for (cs_lnum_t i = 0; i < 3; i++)
+          f_center[i] += w*vtc[i];
 
-          cs_math_3_cross_product(vc0, vc1, vn);
+      }
 
-          /* Projected surface of the triangle in the normal direction */
-          cs_real_t w = 0.5 * cs_math_3_dot_product(vn, n);
+    }
 
-          for (cs_lnum_t i = 0; i < 3; i++)
-            f_center[i] += w*vtc[i];
+    for (cs_lnum_t i = 0; i < 3; i++)
+      face_normal[i] = f_norm[i];
 
-        }
+    for (cs_lnum_t i = 0; i < 3; i++)
+      face_cog[i] = a_center[i] + d_surf_d3 * f_center[i];
 
-      }
+  } /* end of test on triangle */
+}
 
-      for (cs_lnum_t i = 0; i < 3; i++)
-        face_normal[f_id][i] = f_norm[i];
+/*----------------------------------------------------------------------------
+ * Compute quantities associated to faces (border or internal)
+ *
+ * parameters:
+ *   ctx             <->  dispatch context
+ *   n_faces         <--  number of faces
+ *   face_ids        <--  ids of faces to compute, or nullptr for all
+ *   vtx_coord       <--  vertex coordinates
+ *   face_vtx_idx    <--  "face -> vertices" connectivity index
+ *   face_vtx        <--  "face -> vertices" connectivity
+ *   face_cog        -->  coordinates of the center of gravity of the faces
+ *   face_normal     -->  face surface normals
+ *----------------------------------------------------------------------------*/
 
-      for (cs_lnum_t i = 0; i < 3; i++)
-        face_cog[f_id][i] = a_center[i] + d_surf_d3 * f_center[i];
+static void
+_compute_face_quantities(cs_dispatch_context  &ctx,
+                         cs_lnum_t             n_faces,
+                         const cs_lnum_t       face_ids[],
+                         const cs_real_t       vtx_coord[][3],
+                         const cs_lnum_t       face_vtx_idx[],
+                         const cs_lnum_t       face_vtx[],
+                         cs_real_t             face_cog[][3],
+                         cs_real_t             face_normal[][3])
+{
+  /* Checking */
 
-    } /* end of test on triangle */
+  assert(face_cog != nullptr || n_faces == 0);
+  assert(face_normal != nullptr || n_faces == 0);
 
-  } /* end of loop on faces */
+  /* Loop on faces */
+
+  ctx.parallel_for(n_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t f_id = (face_ids != nullptr) ? face_ids[f_idx] : f_idx;
+    _face_quantities(face_vtx_idx[f_id],
+                     face_vtx_idx[f_id + 1],
+                     vtx_coord,
+                     face_vtx,
+                     face_cog[f_id],
+                     face_normal[f_id]);
+  });
 }
 
 /*----------------------------------------------------------------------------
@@ -665,19 +821,24 @@ _compute_face_normal(cs_lnum_t         n_faces,
  * Compute face surfaces based on face norms.
  *
  * parameters:
+ *   ctx             <->  dispatch context
  *   n_faces         <--  number of faces
+ *   face_ids        <--  ids of faces to compute, or nullptr for all
  *   face_norm       <--  face surface normals
  *   face_surf       -->  face surfaces
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_face_surface(cs_lnum_t        n_faces,
-                      const cs_real_t  face_norm[],
-                      cs_real_t        face_surf[])
+_compute_face_surface(cs_dispatch_context  &ctx,
+                      cs_lnum_t             n_faces,
+                      const cs_lnum_t       face_ids[],
+                      const cs_real_t       face_norm[],
+                      cs_real_t             face_surf[])
 {
-# pragma omp parallel for  if (n_faces > CS_THR_MIN)
-  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++)
+  ctx.parallel_for(n_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t f_id = (face_ids != nullptr) ? face_ids[f_idx] : f_idx;
     face_surf[f_id] = cs_math_3_norm(face_norm + f_id*3);
+  });
 }
 
 /*----------------------------------------------------------------------------
@@ -1172,70 +1333,227 @@ _correct_cell_face_center(const cs_mesh_t    *mesh,
   BFT_FREE(determinant);
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief  Compute cell centers and volumes.
+/*----------------------------------------------------------------------------
+ * Compute approximate cell centers as the surface-weighted mean of
+ * face centers.
  *
- * \param[in]   mesh         pointer to mesh structure
- * \param[in]   i_face_norm  surface normal of internal faces
- * \param[in]   i_face_cog   center of gravity of internal faces
- * \param[in]   b_face_norm  surface normal of border faces
- * \param[in]   b_face_cog   center of gravity of border faces
- * \param[out]  cell_cen     cell centers
- * \param[out]  cell_vol     cell volumes
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   m            <--  pointer to mesh structure
+ *   ctx          <->  dispatch context
+ *   ss           <--  faces and cells subset, or nullptr for all
+ *   i_face_norm  <--  surface normal of internal faces
+ *   i_face_cog   <--  center of gravity of internal faces
+ *   b_face_norm  <--  surface normal of border faces
+ *   b_face_cog   <--  center of gravity of border faces
+ *   cell_cen     <->  cell centers (updated for cells in subset)
+ *----------------------------------------------------------------------------*/
 
 static void
-_compute_cell_quantities(const cs_mesh_t      *mesh,
-                         const cs_real_3_t     i_face_norm[],
-                         const cs_real_3_t     i_face_cog[],
-                         const cs_real_3_t     b_face_norm[],
-                         const cs_real_3_t     b_face_cog[],
-                         cs_real_3_t *restrict cell_cen,
-                         cs_real_t   *restrict cell_vol)
+_cell_faces_cog(const cs_mesh_t      *m,
+                cs_dispatch_context  &ctx,
+                const _elt_subset_t  *ss,
+                const cs_real_t       i_face_norm[],
+                const cs_real_t       i_face_cog[],
+                const cs_real_t       b_face_norm[],
+                const cs_real_t       b_face_cog[],
+                cs_real_t             cell_cen[])
 {
-  /* Mesh connectivity */
-
-  const  cs_lnum_t  n_i_faces = mesh->n_i_faces;
-  const  cs_lnum_t  n_b_faces = CS_MAX(mesh->n_b_faces, mesh->n_b_faces_all);
-  const  cs_lnum_t  n_cells = mesh->n_cells;
-  const  cs_lnum_t  n_cells_ext = mesh->n_cells_with_ghosts;
-  const  cs_lnum_2_t  *i_face_cells
-    = (const cs_lnum_2_t *)(mesh->i_face_cells);
-  const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
-
-  /* Checking */
+  const _elt_subset_t _ss = (ss != nullptr) ? *ss : _subset_all(m);
 
-  assert(cell_cen != nullptr);
-  assert(cell_vol != nullptr);
+  const cs_lnum_t  n_cells = m->n_cells;
+  const cs_lnum_t  n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t  *i_face_cells = (const cs_lnum_2_t *)(m->i_face_cells);
+  const cs_lnum_t  *b_face_cells = m->b_face_cells;
 
-  /* Compute approximate cell center using face centers */
+  const cs_lnum_t  *i_face_ids = _ss.i_face_ids;
+  const cs_lnum_t  *b_face_ids = _ss.b_face_ids;
+  const cs_lnum_t  *cell_flag = _ss.cell_flag;
 
-  cs_real_3_t *a_cell_cen;
-  BFT_MALLOC(a_cell_cen, n_cells_ext, cs_real_3_t);
+  const bool null_surf = (cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE);
 
-  cs_mesh_quantities_cell_faces_cog(mesh,
-                                    (const cs_real_t *)i_face_norm,
-                                    (const cs_real_t *)i_face_cog,
-                                    (const cs_real_t *)b_face_norm,
-                                    (const cs_real_t *)b_face_cog,
-                                    (cs_real_t *)a_cell_cen);
+  cs_real_t *cell_area;
+  CS_MALLOC_HD(cell_area, n_cells_ext, cs_real_t, ctx.alloc_mode());
 
   /* Initialization */
 
-  for (cs_lnum_t j = 0; j < n_cells_ext; j++)
-    cell_vol[j] = 0.;
+  ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    if (cell_flag == nullptr || cell_flag[c_id] != 0) {
+      cell_area[c_id] = 0.;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[3*c_id + i] = 0.;
+    }
+  });
 
-  for (cs_lnum_t j = 0; j < n_cells_ext; j++) {
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[j][i] = 0.;
-  }
+  /* Loop on interior faces
+     ---------------------- */
+
+  const bool i_numbered = _i_faces_numbered(m, _ss.n_i_faces, i_face_ids);
+  const cs_dispatch_sum_type_t i_sum_type
+    = (i_numbered) ?
+      ctx.get_parallel_for_i_faces_sum_type(m) : CS_DISPATCH_SUM_ATOMIC;
+
+  auto i_face_contrib = [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t f_id = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
+
+    /* Computation of the area of the face */
+
+    const cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
+
+    if (null_surf && area <= 1.e-20)
+      return;
+
+    cs_real_t w_cog[3];
+    for (cs_lnum_t i = 0; i < 3; i++)
+      w_cog[i] = i_face_cog[3*f_id + i]*area;
+
+    /* For each cell sharing the internal face, we update
+     * cell_cen and cell_area */
+
+    for (cs_lnum_t j = 0; j < 2; j++) {
+      const cs_lnum_t c_id = i_face_cells[f_id][j];
+      if (c_id > -1 && (cell_flag == nullptr || cell_flag[c_id] != 0)) {
+        cs_dispatch_sum(cell_area + c_id, area, i_sum_type);
+        cs_dispatch_sum<3>(cell_cen + 3*c_id, w_cog, i_sum_type);
+      }
+    }
+  };
+
+  if (i_numbered)
+    ctx.parallel_for_i_faces(m, i_face_contrib);
+  else
+    ctx.parallel_for(_ss.n_i_faces, i_face_contrib);
+
+  /* Loop on boundary faces
+     --------------------- */
+
+  const bool b_numbered = _b_faces_numbered(m, _ss.n_b_faces, b_face_ids);
+  const cs_dispatch_sum_type_t b_sum_type
+    = (b_numbered) ?
+      ctx.get_parallel_for_b_faces_sum_type(m) : CS_DISPATCH_SUM_ATOMIC;
+
+  auto b_face_contrib = [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t f_id = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
+
+    /* Note that c_id == -1 may happen for isolated faces,
+       which are cleaned afterwards */
+
+    const cs_lnum_t c_id = b_face_cells[f_id];
+    if (c_id < 0 || (cell_flag != nullptr && cell_flag[c_id] == 0))
+      return;
+
+    const cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
+
+    if (null_surf && area <= 1.e-20)
+      return;
+
+    cs_real_t w_cog[3];
+    for (cs_lnum_t i = 0; i < 3; i++)
+      w_cog[i] = b_face_cog[3*f_id + i]*area;
+
+    cs_dispatch_sum(cell_area + c_id, area, b_sum_type);
+    cs_dispatch_sum<3>(cell_cen + 3*c_id, w_cog, b_sum_type);
+  };
+
+  if (b_numbered)
+    ctx.parallel_for_b_faces(m, b_face_contrib);
+  else
+    ctx.parallel_for(_ss.n_b_faces, b_face_contrib);
+
+  /* Loop on cells to finalize the computation of center of gravity
+     -------------------------------------------------------------- */
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    if (cell_flag == nullptr || cell_flag[c_id] != 0) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[c_id*3 + i] /= cell_area[c_id];
+    }
+  });
+
+  ctx.wait();
+
+  CS_FREE_HD(cell_area);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell centers and volumes.
+ *
+ * \param[in]   mesh         pointer to mesh structure
+ * \param[in]   ctx          dispatch context
+ * \param[in]   ss           faces and cells subset, or nullptr for all
+ * \param[in]   i_face_norm  surface normal of internal faces
+ * \param[in]   i_face_cog   center of gravity of internal faces
+ * \param[in]   b_face_norm  surface normal of border faces
+ * \param[in]   b_face_cog   center of gravity of border faces
+ * \param[out]  cell_cen     cell centers
+ * \param[out]  cell_vol     cell volumes
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_compute_cell_quantities(const cs_mesh_t      *mesh,
+                         cs_dispatch_context  &ctx,
+                         const _elt_subset_t  *ss,
+                         const cs_real_3_t     i_face_norm[],
+                         const cs_real_3_t     i_face_cog[],
+                         const cs_real_3_t     b_face_norm[],
+                         const cs_real_3_t     b_face_cog[],
+                         cs_real_3_t *restrict cell_cen,
+                         cs_real_t   *restrict cell_vol)
+{
+  const _elt_subset_t _ss = (ss != nullptr) ? *ss : _subset_all(mesh);
+
+  /* Mesh connectivity */
+
+  const  cs_lnum_t  n_cells = mesh->n_cells;
+  const  cs_lnum_t  n_cells_ext = mesh->n_cells_with_ghosts;
+  const  cs_lnum_2_t  *i_face_cells
+    = (const cs_lnum_2_t *)(mesh->i_face_cells);
+  const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
+
+  const cs_lnum_t  *i_face_ids = _ss.i_face_ids;
+  const cs_lnum_t  *b_face_ids = _ss.b_face_ids;
+  const cs_lnum_t  *cell_flag = _ss.cell_flag;
+
+  /* Checking */
+
+  assert(cell_cen != nullptr);
+  assert(cell_vol != nullptr);
+
+  /* Compute approximate cell center using face centers */
+
+  cs_real_3_t *a_cell_cen;
+  CS_MALLOC_HD(a_cell_cen, n_cells_ext, cs_real_3_t, ctx.alloc_mode());
+
+  _cell_faces_cog(mesh,
+                  ctx,
+                  &_ss,
+                  (const cs_real_t *)i_face_norm,
+                  (const cs_real_t *)i_face_cog,
+                  (const cs_real_t *)b_face_norm,
+                  (const cs_real_t *)b_face_cog,
+                  (cs_real_t *)a_cell_cen);
+
+  /* Initialization */
+
+  ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    if (cell_flag == nullptr || cell_flag[c_id] != 0) {
+      cell_vol[c_id] = 0.;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[c_id][i] = 0.;
+    }
+  });
 
   /* Loop on interior faces
      ---------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  const bool i_numbered = _i_faces_numbered(mesh, _ss.n_i_faces, i_face_ids);
+  const cs_dispatch_sum_type_t i_sum_type
+    = (i_numbered) ?
+      ctx.get_parallel_for_i_faces_sum_type(mesh) : CS_DISPATCH_SUM_ATOMIC;
+
+  auto i_face_contrib = [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t f_id = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
 
     /* For each cell sharing the internal face, we update
      * cell_cen and cell_area */
@@ -1245,66 +1563,86 @@ _compute_cell_quantities(const cs_mesh_t      *mesh,
 
     /* Implicit subdivision of cell into face vertices-cell-center pyramids */
 
-    if (c_id1 > -1) {
+    if (c_id1 > -1 && (cell_flag == nullptr || cell_flag[c_id1] != 0)) {
       cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
                                                             i_face_cog[f_id],
                                                             i_face_norm[f_id]);
+      cs_real_t w_cen[3];
       for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id1][i]);
-      cell_vol[c_id1] += pyra_vol_3;
+        w_cen[i] = pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                + 0.25*a_cell_cen[c_id1][i]);
+      cs_dispatch_sum<3>(cell_cen[c_id1], w_cen, i_sum_type);
+      cs_dispatch_sum(cell_vol + c_id1, pyra_vol_3, i_sum_type);
     }
-    if (c_id2 > -1) {
+    if (c_id2 > -1 && (cell_flag == nullptr || cell_flag[c_id2] != 0)) {
       cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(i_face_cog[f_id],
                                                             a_cell_cen[c_id2],
                                                             i_face_norm[f_id]);
+      cs_real_t w_cen[3];
       for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id2][i]);
-      cell_vol[c_id2] += pyra_vol_3;
+        w_cen[i] = pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                + 0.25*a_cell_cen[c_id2][i]);
+      cs_dispatch_sum<3>(cell_cen[c_id2], w_cen, i_sum_type);
+      cs_dispatch_sum(cell_vol + c_id2, pyra_vol_3, i_sum_type);
     }
+  };
 
-  } /* End of loop on interior faces */
+  if (i_numbered)
+    ctx.parallel_for_i_faces(mesh, i_face_contrib);
+  else
+    ctx.parallel_for(_ss.n_i_faces, i_face_contrib);
 
   /* Loop on boundary faces
      --------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  const bool b_numbered = _b_faces_numbered(mesh, _ss.n_b_faces, b_face_ids);
+  const cs_dispatch_sum_type_t b_sum_type
+    = (b_numbered) ?
+      ctx.get_parallel_for_b_faces_sum_type(mesh) : CS_DISPATCH_SUM_ATOMIC;
 
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
+  auto b_face_contrib = [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t f_id = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
 
-    const cs_lnum_t c_id1 = b_face_cells[f_id];
-
-    /* Computation of the area of the face
+    /* For each cell sharing a border face, we update the numerator
+     * of cell_cen and cell_area
        (note that c_id1 == -1 may happen for isolated faces,
        which are cleaned afterwards) */
 
-    if (c_id1 > -1) {
+    const cs_lnum_t c_id1 = b_face_cells[f_id];
+
+    if (c_id1 > -1 && (cell_flag == nullptr || cell_flag[c_id1] != 0)) {
       cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
                                                             b_face_cog[f_id],
                                                             b_face_norm[f_id]);
+      cs_real_t w_cen[3];
       for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id1][i]);
-      cell_vol[c_id1] += pyra_vol_3;
+        w_cen[i] = pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
+                                + 0.25*a_cell_cen[c_id1][i]);
+      cs_dispatch_sum<3>(cell_cen[c_id1], w_cen, b_sum_type);
+      cs_dispatch_sum(cell_vol + c_id1, pyra_vol_3, b_sum_type);
     }
+  };
 
-  } /* End of loop on boundary faces */
-
-  BFT_FREE(a_cell_cen);
+  if (b_numbered)
+    ctx.parallel_for_b_faces(mesh, b_face_contrib);
+  else
+    ctx.parallel_for(_ss.n_b_faces, b_face_contrib);
 
   /* Loop on cells to finalize the computation
      ----------------------------------------- */
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    if (cell_flag == nullptr || cell_flag[c_id] != 0) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[c_id][i] /= cell_vol[c_id];
 
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[c_id][i] /= cell_vol[c_id];
+      cell_vol[c_id] /= 3.0;
+    }
+  });
 
-    cell_vol[c_id] /= 3.0;
+  ctx.wait();
 
-  }
+  CS_FREE_HD(a_cell_cen);
 }
 
 /*----------------------------------------------------------------------------*
@@ -1594,6 +1932,8 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
  *
  * parameters:
  *   mesh           <--  pointer to mesh structure
+ *   ctx            <->  dispatch context
+ *   ss             <--  faces and cells subset, or nullptr for all
  *   i_face_norm    <--  surface normal of internal faces
  *   i_face_cog     <--  center of gravity of internal faces
  *   b_face_norm    <--  surface normal of border faces
@@ -1603,53 +1943,100 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_cell_volume(const cs_mesh_t   *mesh,
-                     const cs_real_3_t  i_face_norm[],
-                     const cs_real_3_t  i_face_cog[],
-                     const cs_real_3_t  b_face_norm[],
-                     const cs_real_3_t  b_face_cog[],
-                     const cs_real_3_t  cell_cen[],
-                     cs_real_t          cell_vol[])
+_compute_cell_volume(const cs_mesh_t      *mesh,
+                     cs_dispatch_context  &ctx,
+                     const _elt_subset_t  *ss,
+                     const cs_real_3_t     i_face_norm[],
+                     const cs_real_3_t     i_face_cog[],
+                     const cs_real_3_t     b_face_norm[],
+                     const cs_real_3_t     b_face_cog[],
+                     const cs_real_3_t     cell_cen[],
+                     cs_real_t             cell_vol[])
 {
-  const cs_lnum_t  n_b_faces = CS_MAX(mesh->n_b_faces, mesh->n_b_faces_all);
+  const _elt_subset_t _ss = (ss != nullptr) ? *ss : _subset_all(mesh);
+
   const cs_real_t  a_third = 1.0/3.0;
 
+  const cs_lnum_2_t  *i_face_cells = (const cs_lnum_2_t *)(mesh->i_face_cells);
+  const cs_lnum_t  *b_face_cells = mesh->b_face_cells;
+
+  const cs_lnum_t  *i_face_ids = _ss.i_face_ids;
+  const cs_lnum_t  *b_face_ids = _ss.b_face_ids;
+  const cs_lnum_t  *cell_flag = _ss.cell_flag;
+
   /* Initialization */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
-    cell_vol[cell_id] = 0;
+  ctx.parallel_for(mesh->n_cells_with_ghosts,
+                   [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
+    if (cell_flag == nullptr || cell_flag[cell_id] != 0)
+      cell_vol[cell_id] = 0;
+  });
 
   /* Loop on internal faces */
 
-  for (cs_lnum_t fac_id = 0; fac_id < mesh->n_i_faces; fac_id++) {
+  const bool i_numbered = _i_faces_numbered(mesh, _ss.n_i_faces, i_face_ids);
+  const cs_dispatch_sum_type_t i_sum_type
+    = (i_numbered) ?
+      ctx.get_parallel_for_i_faces_sum_type(mesh) : CS_DISPATCH_SUM_ATOMIC;
+
+  auto i_face_contrib = [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t fac_id = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
+
+    const cs_lnum_t cell_id1 = i_face_cells[fac_id][0];
+    const cs_lnum_t cell_id2 = i_face_cells[fac_id][1];
+
+    if (cell_flag == nullptr || cell_flag[cell_id1] != 0)
+      cs_dispatch_sum(cell_vol + cell_id1,
+                      cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                                     i_face_cog[fac_id],
+                                                     i_face_norm[fac_id]),
+                      i_sum_type);
+    if (cell_flag == nullptr || cell_flag[cell_id2] != 0)
+      cs_dispatch_sum(cell_vol + cell_id2,
+                      - cs_math_3_distance_dot_product(cell_cen[cell_id2],
+                                                       i_face_cog[fac_id],
+                                                       i_face_norm[fac_id]),
+                      i_sum_type);
+  };
+
+  if (i_numbered)
+    ctx.parallel_for_i_faces(mesh, i_face_contrib);
+  else
+    ctx.parallel_for(_ss.n_i_faces, i_face_contrib);
 
-    const cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
-    const cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
+  /* Loop on border faces */
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
-    cell_vol[cell_id2] -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
+  const bool b_numbered = _b_faces_numbered(mesh, _ss.n_b_faces, b_face_ids);
+  const cs_dispatch_sum_type_t b_sum_type
+    = (b_numbered) ?
+      ctx.get_parallel_for_b_faces_sum_type(mesh) : CS_DISPATCH_SUM_ATOMIC;
 
-  }
+  auto b_face_contrib = [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    const cs_lnum_t fac_id = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
 
-  /* Loop on border faces */
+    const cs_lnum_t cell_id1 = b_face_cells[fac_id];
 
-  for (cs_lnum_t fac_id = 0; fac_id < n_b_faces; fac_id++) {
+    if (cell_id1 > -1 && (cell_flag == nullptr || cell_flag[cell_id1] != 0))
+      cs_dispatch_sum(cell_vol + cell_id1,
+                      cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                                     b_face_cog[fac_id],
+                                                     b_face_norm[fac_id]),
+                      b_sum_type);
+  };
 
-    const cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
-
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         b_face_cog[fac_id],
-                                                         b_face_norm[fac_id]);
-  }
+  if (b_numbered)
+    ctx.parallel_for_b_faces(mesh, b_face_contrib);
+  else
+    ctx.parallel_for(_ss.n_b_faces, b_face_contrib);
 
   /* First computation of the volume */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++)
-    cell_vol[cell_id] *= a_third;
+  ctx.parallel_for(mesh->n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
+    if (cell_flag == nullptr || cell_flag[cell_id] != 0)
+      cell_vol[cell_id] *= a_third;
+  });
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------
@@ -1737,8 +2124,11 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
  * Compute some distances relative to faces and associated weighting.
  *
  * parameters:
+ *   ctx            <->  dispatch context
  *   n_i_faces      <--  number of interior faces
  *   n_b_faces      <--  number of border  faces
+ *   i_face_ids     <--  ids of interior faces, or nullptr for all
+ *   b_face_ids     <--  ids of border faces, or nullptr for all
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   b_face_cells   <--  border "faces -> cells" connectivity
  *   i_face_u_norm  <--  unit normal of interior faces
@@ -1755,27 +2145,36 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_face_distances(cs_lnum_t        n_i_faces,
-                        cs_lnum_t        n_b_faces,
-                        const cs_lnum_t  i_face_cells[][2],
-                        const cs_lnum_t  b_face_cells[],
-                        const cs_real_t  i_face_u_normal[][3],
-                        const cs_real_t  i_face_normal[][3],
-                        const cs_real_t  b_face_u_normal[][3],
-                        const cs_real_t  b_face_normal[][3],
-                        const cs_real_t  i_face_cog[][3],
-                        const cs_real_t  b_face_cog[][3],
-                        const cs_real_t  cell_cen[][3],
-                        const cs_real_t  cell_vol[],
-                        cs_real_t        i_dist[],
-                        cs_real_t        b_dist[],
-                        cs_real_t        weight[])
+_compute_face_distances(cs_dispatch_context  &ctx,
+                        cs_lnum_t             n_i_faces,
+                        cs_lnum_t             n_b_faces,
+                        const cs_lnum_t       i_face_ids[],
+                        const cs_lnum_t       b_face_ids[],
+                        const cs_lnum_t       i_face_cells[][2],
+                        const cs_lnum_t       b_face_cells[],
+                        const cs_real_t       i_face_u_normal[][3],
+                        const cs_real_t       i_face_normal[][3],
+                        const cs_real_t       b_face_u_normal[][3],
+                        const cs_real_t       b_face_normal[][3],
+                        const cs_real_t       i_face_cog[][3],
+                        const cs_real_t       b_face_cog[][3],
+                        const cs_real_t       cell_cen[][3],
+                        const cs_real_t       cell_vol[],
+                        cs_real_t             i_dist[],
+                        cs_real_t             b_dist[],
+                        cs_real_t             weight[])
 {
-  cs_gnum_t w_count[2] = {0};
+  const unsigned mq_flag = cs_glob_mesh_quantities_flag;
+
+  double i_count = 0, b_count = 0;
 
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+  ctx.parallel_for_reduce_sum
+    (n_i_faces, i_count, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx, double &sum) {
+
+    const cs_lnum_t face_id
+      = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
 
     const cs_real_t *u_normal = i_face_u_normal[face_id];
 
@@ -1802,7 +2201,7 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
     }
 
     /* Clipping of cell cell distances */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_DISTANCE_CLIP) {
+    if (mq_flag & CS_FACE_DISTANCE_CLIP) {
 
       /* Min value between IJ and
        * (Omega_i+Omega_j)/S_ij which is exactly the distance for tetras */
@@ -1813,7 +2212,7 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       /* If CS_FACE_NULL_SURFACE is used, only update distmax value
        * if the face surface is not 0.
        */
-      if (   !(cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE)
+      if (   !(mq_flag & CS_FACE_NULL_SURFACE)
           && face_normal_norm > 1.e-20)
         distmax = cs_math_fmin(cs_math_3_distance(cell_cen[cell_id1],
                                                   cell_cen[cell_id2]),
@@ -1824,12 +2223,12 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       /* 0.01 seems better and safer for the moment */
       const cs_real_t critmin = 0.01;
       if (i_dist[face_id] < critmin * distmax) {
-        w_count[0] += 1;
+        sum += 1;
         i_dist[face_id] = cs_math_fmax(i_dist[face_id], critmin * distmax);
       }
 
       /* Clippings due to null surface */
-      if (cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE) {
+      if (mq_flag & CS_FACE_NULL_SURFACE) {
         if (face_normal_norm <= 1.e-20)
           i_dist[face_id] = cs_math_3_distance(cell_cen[cell_id1],
                                                cell_cen[cell_id2]);
@@ -1845,11 +2244,15 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       weight[face_id] = cs_math_fmax(weight[face_id], 0.001);
       weight[face_id] = cs_math_fmin(weight[face_id], 0.999);
     }
-  }
+  });
 
   /* Boundary faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+  ctx.parallel_for_reduce_sum
+    (n_b_faces, b_count, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx, double &sum) {
+
+    const cs_lnum_t face_id
+      = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
 
     const cs_real_t *normal = b_face_u_normal[face_id];
 
@@ -1861,7 +2264,7 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
                                                      b_face_cog[face_id],
                                                      normal);
     /* Clipping of cell boundary distances */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_DISTANCE_CLIP) {
+    if (mq_flag & CS_FACE_DISTANCE_CLIP) {
 
       /* Min value between IF and
        * (Omega_i)/S which is exactly the distance for tetrahedra */
@@ -1871,21 +2274,21 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       /* If CS_FACE_NULL_SURFACE is used, only update distmax value
        * if the face surface is not 0.
        */
-      if (   !(cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE)
+      if (   !(mq_flag & CS_FACE_NULL_SURFACE)
           && face_normal_norm > 1.e-20) {
-        distmax = fmin(cs_math_3_distance(cell_cen[cell_id],
-                                          b_face_cog[face_id]),
-                       cell_vol[cell_id]/face_normal_norm);
+        distmax = cs_math_fmin(cs_math_3_distance(cell_cen[cell_id],
+                                                  b_face_cog[face_id]),
+                               cell_vol[cell_id]/face_normal_norm);
       }
 
-      double critmin = 0.01;
+      const cs_real_t critmin = 0.01;
       if (b_dist[face_id] < critmin * distmax) {
-        w_count[1] += 1;
-        b_dist[face_id] = fmax(b_dist[face_id], critmin * distmax);
+        sum += 1;
+        b_dist[face_id] = cs_math_fmax(b_dist[face_id], critmin * distmax);
       }
 
       /* Clippings due to null surface */
-      if (cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE) {
+      if (mq_flag & CS_FACE_NULL_SURFACE) {
         if (face_normal_norm <= 1.e-20)
           b_dist[face_id] = cs_math_3_distance(cell_cen[cell_id],
                                                b_face_cog[face_id]);
@@ -1898,7 +2301,11 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       }
 
     }
-  }
+  });
+
+  ctx.wait();
+
+  cs_gnum_t w_count[2] = {(cs_gnum_t)i_count, (cs_gnum_t)b_count};
 
   cs_parall_counter(w_count, 2);
 
@@ -1940,9 +2347,12 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
  *   JJ' = JG - (JG.Nij)Nij
  *
  * parameters:
+ *   ctx            <->  dispatch context
  *   dim            <--  dimension
  *   n_i_faces      <--  number of interior faces
  *   n_b_faces      <--  number of border  faces
+ *   i_face_ids     <--  ids of interior faces, or nullptr for all
+ *   b_face_ids     <--  ids of border faces, or nullptr for all
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   b_face_cells   <--  border "faces -> cells" connectivity
  *   i_face_u_norm  <--  unit normal of interior faces
@@ -1957,25 +2367,33 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_face_vectors(int              dim,
-                      cs_lnum_t        n_i_faces,
-                      cs_lnum_t        n_b_faces,
-                      const cs_lnum_t  i_face_cells[][2],
-                      const cs_lnum_t  b_face_cells[],
-                      const cs_real_t  i_face_u_normal[][3],
-                      const cs_real_t  b_face_u_normal[][3],
-                      const cs_real_t  i_face_cog[],
-                      const cs_real_t  b_face_cog[],
-                      const cs_real_t  cell_cen[],
-                      const cs_real_t  weight[],
-                      const cs_real_t  b_dist[],
-                      cs_real_t        dijpf[],
-                      cs_real_t        diipb[],
-                      cs_real_t        dofij[])
+_compute_face_vectors(cs_dispatch_context  &ctx,
+                      int                   dim,
+                      cs_lnum_t             n_i_faces,
+                      cs_lnum_t             n_b_faces,
+                      const cs_lnum_t       i_face_ids[],
+                      const cs_lnum_t       b_face_ids[],
+                      const cs_lnum_t       i_face_cells[][2],
+                      const cs_lnum_t       b_face_cells[],
+                      const cs_real_t       i_face_u_normal[][3],
+                      const cs_real_t       b_face_u_normal[][3],
+                      const cs_real_t       i_face_cog[],
+                      const cs_real_t       b_face_cog[],
+                      const cs_real_t       cell_cen[],
+                      const cs_real_t       weight[],
+                      const cs_real_t       b_dist[],
+                      cs_real_t             dijpf[],
+                      cs_real_t             diipb[],
+                      cs_real_t             dofij[])
 {
+  const unsigned mq_flag = cs_glob_mesh_quantities_flag;
+
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+  ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+
+    const cs_lnum_t face_id
+      = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
 
     const cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     const cs_lnum_t cell_id2 = i_face_cells[face_id][1];
@@ -2012,12 +2430,17 @@ _compute_face_vectors(int              dim,
     dofij[face_id*dim + 2] = i_face_cog[face_id*dim + 2]
       - (        pond *cell_cen[cell_id1*dim + 2]
          + (1. - pond)*cell_cen[cell_id2*dim + 2]);
-  }
+  });
 
   /* Boundary faces */
-  cs_gnum_t w_count = 0;
 
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+  double b_count = 0;
+
+  ctx.parallel_for_reduce_sum
+    (n_b_faces, b_count, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx, double &sum) {
+
+    const cs_lnum_t face_id
+      = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
 
     cs_lnum_t cell_id = b_face_cells[face_id];
 
@@ -2033,7 +2456,7 @@ _compute_face_vectors(int              dim,
     cs_math_3_orthogonal_projection(normal, vec_if, &diipb[face_id*dim]);
 
     /* Limiter on boundary face reconstruction */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_RECONSTRUCTION_CLIP) {
+    if (mq_flag & CS_FACE_RECONSTRUCTION_CLIP) {
       cs_real_t iip = cs_math_3_norm(&diipb[face_id*dim]);
 
       bool is_clipped = false;
@@ -2049,9 +2472,13 @@ _compute_face_vectors(int              dim,
       diipb[face_id*dim +2] *= corri;
 
       if (is_clipped)
-        w_count++;
+        sum += 1;
     }
-  }
+  });
+
+  ctx.wait();
+
+  cs_gnum_t w_count = b_count;
 
   cs_parall_counter(&w_count, 1);
 
@@ -2085,8 +2512,10 @@ _compute_face_vectors(int              dim,
  *   JJ' = JF - (JF.Nij)Nij
  *
  * parameters:
+ *   ctx            <->  dispatch context
  *   n_cells        <--  number of cells
  *   n_i_faces      <--  number of interior faces
+ *   i_face_ids     <--  ids of interior faces, or nullptr for all
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   i_face_u_norm  <--  unit normal of interior faces
  *   i_face_norm    <--  surface normal of interior faces
@@ -2099,23 +2528,31 @@ _compute_face_vectors(int              dim,
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_face_sup_vectors(cs_lnum_t          n_cells,
-                          cs_lnum_t          n_i_faces,
-                          const cs_lnum_2_t  i_face_cells[],
-                          const cs_real_t    i_face_u_normal[][3],
-                          const cs_real_t    i_face_normal[][3],
-                          const cs_real_t    i_face_cog[][3],
-                          const cs_real_t    cell_cen[][3],
-                          const cs_real_t    cell_vol[],
-                          const cs_real_t    dist[],
-                          cs_real_t          diipf[][3],
-                          cs_real_t          djjpf[][3])
+_compute_face_sup_vectors(cs_dispatch_context  &ctx,
+                          cs_lnum_t             n_cells,
+                          cs_lnum_t             n_i_faces,
+                          const cs_lnum_t       i_face_ids[],
+                          const cs_lnum_2_t     i_face_cells[],
+                          const cs_real_t       i_face_u_normal[][3],
+                          const cs_real_t       i_face_normal[][3],
+                          const cs_real_t       i_face_cog[][3],
+                          const cs_real_t       cell_cen[][3],
+                          const cs_real_t       cell_vol[],
+                          const cs_real_t       dist[],
+                          cs_real_t             diipf[][3],
+                          cs_real_t             djjpf[][3])
 {
-  cs_gnum_t w_count = 0;
+  const unsigned mq_flag = cs_glob_mesh_quantities_flag;
+
+  double i_count = 0;
 
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+  ctx.parallel_for_reduce_sum
+    (n_i_faces, i_count, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx, double &sum) {
+
+    const cs_lnum_t face_id
+      = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
 
     const cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     const cs_lnum_t cell_id2 = i_face_cells[face_id][1];
@@ -2141,7 +2578,7 @@ _compute_face_sup_vectors(cs_lnum_t          n_cells,
     cs_math_3_orthogonal_projection(u_normal, vec_jf, djjpf[face_id]);
 
     /* Limiter on interior face reconstruction */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_RECONSTRUCTION_CLIP) {
+    if (mq_flag & CS_FACE_RECONSTRUCTION_CLIP) {
 
       cs_real_t surfn = cs_math_3_norm(i_face_normal[face_id]);
       cs_real_t iip   = cs_math_3_norm(diipf[face_id]);
@@ -2193,14 +2630,18 @@ _compute_face_sup_vectors(cs_lnum_t          n_cells,
       }
 
       if (is_clipped && cell_id1 < n_cells)
-        w_count++;
+        sum += 1;
 
       djjpf[face_id][0] *= corrj;
       djjpf[face_id][1] *= corrj;
       djjpf[face_id][2] *= corrj;
 
     }
-  }
+  });
+
+  ctx.wait();
+
+  cs_gnum_t w_count = i_count;
 
   cs_parall_counter(&w_count, 1);
 
@@ -2578,16 +3019,20 @@ _compute_fluid_solid_cell_quantities
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief  Compute mesh quantities needed for preprocessing.
+ * \brief  Compute face unit normals.
  *
- * \param[in]       m   pointer to mesh structure
- * \param[in, out]  mq  pointer to mesh quantities structures.
+ * \param[in]       m    pointer to mesh structure
+ * \param[in, out]  mq   pointer to mesh quantities structures.
+ * \param[in, out]  ctx  dispatch context
+ * \param[in]       ss   faces subset, or nullptr for all
  */
 /*----------------------------------------------------------------------------*/
 
 static void
 _compute_unit_normals(const cs_mesh_t       *m,
-                      cs_mesh_quantities_t  *mq)
+                      cs_mesh_quantities_t  *mq,
+                      cs_dispatch_context   &ctx,
+                      const _elt_subset_t   *ss)
 {
   cs_lnum_t  n_i_faces = m->n_i_faces;
   cs_lnum_t  n_b_faces = CS_MAX(m->n_b_faces, m->n_b_faces_all);
@@ -2609,15 +3054,29 @@ _compute_unit_normals(const cs_mesh_t       *m,
     cs_mem_advise_set_read_mostly(mq->b_face_u_normal);
   }
 
-# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
-    cs_math_3_normalize(i_face_normal[i], mq->i_face_u_normal[i]);
-  }
+  cs_nreal_3_t *i_face_u_normal = mq->i_face_u_normal;
+  cs_nreal_3_t *b_face_u_normal = mq->b_face_u_normal;
 
-# pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
-    cs_math_3_normalize(b_face_normal[i], mq->b_face_u_normal[i]);
+  const cs_lnum_t *i_face_ids = nullptr, *b_face_ids = nullptr;
+
+  if (ss != nullptr) {
+    n_i_faces = ss->n_i_faces;
+    n_b_faces = ss->n_b_faces;
+    i_face_ids = ss->i_face_ids;
+    b_face_ids = ss->b_face_ids;
   }
+
+  ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    cs_lnum_t f_id = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
+    cs_math_3_normalize(i_face_normal[f_id], i_face_u_normal[f_id]);
+  });
+
+  ctx.parallel_for(n_b_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+    cs_lnum_t f_id = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
+    cs_math_3_normalize(b_face_normal[f_id], b_face_u_normal[f_id]);
+  });
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3082,30 +3541,43 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *m,
     cs_mem_advise_set_read_mostly(mq->b_face_surf);
   }
 
+  cs_dispatch_context ctx;
+  _init_dispatch_context(m, ctx);
+
   /* Compute face centers of gravity, normals, and surfaces */
 
-  _compute_face_quantities(n_i_faces,
+  _compute_face_quantities(ctx,
+                           n_i_faces,
+                           nullptr,
                            (const cs_real_3_t *)m->vtx_coord,
                            m->i_face_vtx_idx,
                            m->i_face_vtx_lst,
                            (cs_real_3_t *)mq->i_face_cog,
                            (cs_real_3_t *)mq->i_face_normal);
 
-  _compute_face_surface(n_i_faces,
+  _compute_face_surface(ctx,
+                        n_i_faces,
+                        nullptr,
                         mq->i_face_normal,
                         mq->i_face_surf);
 
-  _compute_face_quantities(n_b_faces,
+  _compute_face_quantities(ctx,
+                           n_b_faces,
+                           nullptr,
                            (const cs_real_3_t *)m->vtx_coord,
                            m->b_face_vtx_idx,
                            m->b_face_vtx_lst,
                            (cs_real_3_t *)mq->b_face_cog,
                            (cs_real_3_t *)mq->b_face_normal);
 
-  _compute_face_surface(n_b_faces,
+  _compute_face_surface(ctx,
+                        n_b_faces,
+                        nullptr,
                         mq->b_face_normal,
                         mq->b_face_surf);
 
+  ctx.wait();
+
   if (cs_glob_mesh_quantities_flag & CS_FACE_CENTER_REFINE) {
     _refine_warped_face_centers
       (n_i_faces,
@@ -3149,16 +3621,22 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *m,
   switch (_cell_cen_algorithm) {
 
   case 0:
-    cs_mesh_quantities_cell_faces_cog(m,
-                                      mq->i_face_normal,
-                                      mq->i_face_cog,
-                                      mq->b_face_normal,
-                                      mq->b_face_cog,
-                                      mq->cell_cen);
-
+    if (m->i_face_vtx_lst != nullptr || m->b_face_vtx_lst != nullptr) {
+      _elt_subset_t ss = {n_i_faces, m->n_b_faces, nullptr, nullptr, nullptr};
+      _cell_faces_cog(m,
+                      ctx,
+                      &ss,
+                      mq->i_face_normal,
+                      mq->i_face_cog,
+                      mq->b_face_normal,
+                      mq->b_face_cog,
+                      mq->cell_cen);
+    }
     break;
   case 1:
     _compute_cell_quantities(m,
+                             ctx,
+                             nullptr,
                              (const cs_real_3_t *)mq->i_face_normal,
                              (const cs_real_3_t *)mq->i_face_cog,
                              (const cs_real_3_t *)mq->b_face_normal,
@@ -3215,6 +3693,8 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *m,
 
   if (volume_computed == false)
     _compute_cell_volume(m,
+                         ctx,
+                         nullptr,
                          (const cs_real_3_t *)(mq->i_face_normal),
                          (const cs_real_3_t *)(mq->i_face_cog),
                          (const cs_real_3_t *)(mq->b_face_normal),
@@ -3231,7 +3711,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *m,
 
   /* Compute unit normals */
 
-  _compute_unit_normals(m, mq);
+  _compute_unit_normals(m, mq, ctx, nullptr);
 
   /* Synchronize geometric quantities */
 
@@ -3322,12 +3802,24 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
   const short int *cell_i_faces_sgn = ma->cell_i_faces_sgn;
 
   /* Initialization */
+  cs_dispatch_context ctx;
+  _init_dispatch_context(m, ctx);
+
+  {
+    const void *ptrs[] = {mq->i_f_face_normal, mq->b_f_face_normal,
+                          mq->i_f_face_cog, mq->b_f_face_cog,
+                          mq->cell_f_cen, mq->cell_f_vol};
+    _check_dispatch_ptrs(6, ptrs, ctx);
+  }
+
   _compute_cell_quantities(m,
-                          (const cs_real_3_t *)mq->i_face_normal,
-                          (const cs_real_3_t *)mq->i_face_cog,
-                          (const cs_real_3_t *)mq->b_face_normal,
-                          (const cs_real_3_t *)mq->b_face_cog,
-                          (cs_real_3_t *)mq->cell_f_cen,
+                           ctx,
+                           nullptr,
+                           (const cs_real_3_t *)mq->i_face_normal,
+                           (const cs_real_3_t *)mq->i_face_cog,
+                           (const cs_real_3_t *)mq->b_face_normal,
+                           (const cs_real_3_t *)mq->b_face_cog,
+                           (cs_real_3_t *)mq->cell_f_cen,
                            mq->cell_vol);
 
   /* If no points belonging to the plane are given, stop here */
@@ -3694,12 +4186,12 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
             f_vtx_coord_l[ffv][i] = f_vtx_coord[ffv][i];
         }
 
-        _compute_face_quantities(1,
-                                 f_vtx_coord_l,
-                                 f_vtx_idx,
-                                 f_face_pos,
-                                 _i_f_face_cog,
-                                 _i_f_face_normal);
+        _face_quantities(f_vtx_idx[0],
+                         f_vtx_idx[1],
+                         f_vtx_coord_l,
+                         f_face_pos,
+                         _i_f_face_cog[0],
+                         _i_f_face_normal[0]);
 
         if (f_vtx_coord_l != (cs_real_3_t *)_f_vtx_coord_l)
           BFT_FREE(f_vtx_coord_l);
@@ -3986,12 +4478,12 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
             f_vtx_coord_l[ffv][i] = f_vtx_coord[ffv][i];
         }
 
-        _compute_face_quantities(1,
-                                 f_vtx_coord_l,
-                                 f_vtx_idx,
-                                 f_face_pos,
-                                 face_cog,
-                                 face_normal);
+        _face_quantities(f_vtx_idx[0],
+                         f_vtx_idx[1],
+                         f_vtx_coord_l,
+                         f_face_pos,
+                         face_cog[0],
+                         face_normal[0]);
 
         if (f_vtx_coord_l != (cs_real_3_t *)_f_vtx_coord_l)
           BFT_FREE(f_vtx_coord_l);
@@ -4172,8 +4664,11 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
    * Note: only direction is used for "i_face_normal" and "b_face_normal"
    * */
 
-  _compute_face_distances(m->n_i_faces,
+  _compute_face_distances(ctx,
+                          m->n_i_faces,
                           m->n_b_faces,
+                          nullptr,
+                          nullptr,
                           (const cs_lnum_2_t *)(m->i_face_cells),
                           (const cs_lnum_t   *)(m->b_face_cells),
                           (const cs_real_3_t *)(mq->i_face_u_normal),
@@ -4188,9 +4683,12 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
                           mq->b_dist,
                           mq->weight);
 
-  _compute_face_vectors(m->dim,
+  _compute_face_vectors(ctx,
+                        m->dim,
                         m->n_i_faces,
                         m->n_b_faces,
+                        nullptr,
+                        nullptr,
                         (const cs_lnum_2_t *)(m->i_face_cells),
                         m->b_face_cells,
                         (const cs_real_3_t *)mq->i_face_u_normal,
@@ -4204,8 +4702,10 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
                         mq->diipb,
                         mq->dofij);
 
-  _compute_face_sup_vectors(m->n_cells,
+  _compute_face_sup_vectors(ctx,
+                            m->n_cells,
                             m->n_i_faces,
+                            nullptr,
                             (const cs_lnum_2_t *)(m->i_face_cells),
                             (const cs_real_3_t *)(mq->i_face_u_normal),
                             (const cs_real_3_t *)(mq->i_face_normal),
@@ -4590,10 +5090,16 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
     cs_mem_advise_set_read_mostly(mq->b_sym_flag);
   }
 
+  cs_dispatch_context ctx;
+  _init_dispatch_context(m, ctx);
+
   /* Compute some distances relative to faces and associated weighting */
 
-  _compute_face_distances(m->n_i_faces,
+  _compute_face_distances(ctx,
+                          m->n_i_faces,
                           m->n_b_faces,
+                          nullptr,
+                          nullptr,
                           (const cs_lnum_2_t *)(m->i_face_cells),
                           m->b_face_cells,
                           (const cs_real_3_t *)(mq->i_face_u_normal),
@@ -4610,9 +5116,12 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
 
   /* Compute some vectors relative to faces to handle non-orthogonalities */
 
-  _compute_face_vectors(dim,
+  _compute_face_vectors(ctx,
+                        dim,
                         m->n_i_faces,
                         m->n_b_faces,
+                        nullptr,
+                        nullptr,
                         (const cs_lnum_2_t *)(m->i_face_cells),
                         m->b_face_cells,
                         (const cs_real_3_t *)mq->i_face_u_normal,
@@ -4630,8 +5139,10 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
      to handle non-orthogonalities */
 
   _compute_face_sup_vectors
-    (m->n_cells,
+    (ctx,
+     m->n_cells,
      m->n_i_faces,
+     nullptr,
      (const cs_lnum_2_t *)(m->i_face_cells),
      (const cs_real_3_t *)(mq->i_face_u_normal),
      (const cs_real_3_t *)(mq->i_face_normal),
@@ -4669,6 +5180,348 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after a subset of vertices has moved.
+ *
+ * Only the quantities of faces containing a moved vertex, of their
+ * adjacent cells, and of the faces of those cells are recomputed.
+ * When options requiring a global recomputation are active (face center
+ * refinement, cell or face center corrections, volume ratio correction,
+ * porous fluid quantities), or if the quantities were not computed yet,
+ * this reverts to \ref cs_mesh_quantities_compute.
+ *
+ * The moved vertices list must be consistent across ranks for vertices
+ * shared by several ranks. If it is nullptr, all vertices are considered
+ * to have moved.
+ *
+ * \param[in]       m              pointer to mesh structure
+ * \param[in, out]  mq             pointer to mesh quantities structures.
+ * \param[in]       n_moved_vtx    number of moved vertices
+ * \param[in]       moved_vtx_ids  ids of moved vertices, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *m,
+                                cs_mesh_quantities_t  *mq,
+                                cs_lnum_t              n_moved_vtx,
+                                const cs_lnum_t        moved_vtx_ids[])
+{
+  const unsigned global_flags =   CS_FACE_CENTER_REFINE
+                                | CS_CELL_CENTER_CORRECTION
+                                | CS_CELL_FACE_CENTER_CORRECTION
+                                | CS_CELL_VOLUME_RATIO_CORRECTION;
+
+  if (   moved_vtx_ids == nullptr
+      || mq->cell_cen == nullptr || mq->i_dist == nullptr
+      || mq->i_face_u_normal == nullptr || mq->b_face_u_normal == nullptr
+      || mq->cell_f_vol != mq->cell_vol
+      || _ajust_face_cog_compat_v11_v52
+      || (cs_glob_mesh_quantities_flag & global_flags)) {
+    cs_mesh_quantities_compute(m, mq);
+    return;
+  }
+
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = CS_MAX(m->n_b_faces, m->n_b_faces_all);
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(m->i_face_cells);
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  _n_computations++;
+
+  cs_dispatch_context ctx;
+  _init_dispatch_context(m, ctx);
+
+  /* Mark moved vertices, then faces containing a moved vertex
+     and their adjacent cells */
+
+  char *vtx_flag;
+  BFT_MALLOC(vtx_flag, m->n_vertices, char);
+  memset(vtx_flag, 0, m->n_vertices);
+  for (cs_lnum_t i = 0; i < n_moved_vtx; i++)
+    vtx_flag[moved_vtx_ids[i]] = 1;
+
+  const cs_alloc_mode_t amode = ctx.alloc_mode(true);
+
+  cs_lnum_t *cell_flag, *i_face_ids, *b_face_ids;
+  CS_MALLOC_HD(cell_flag, n_cells_ext, cs_lnum_t, amode);
+  CS_MALLOC_HD(i_face_ids, n_i_faces, cs_lnum_t, amode);
+  CS_MALLOC_HD(b_face_ids, n_b_faces, cs_lnum_t, amode);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+    cell_flag[i] = 0;
+
+  cs_lnum_t n_m_i_faces = 0, n_m_b_faces = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (cs_lnum_t j = m->i_face_vtx_idx[f_id];
+         j < m->i_face_vtx_idx[f_id+1];
+         j++) {
+      if (vtx_flag[m->i_face_vtx_lst[j]]) {
+        i_face_ids[n_m_i_faces++] = f_id;
+        for (cs_lnum_t k = 0; k < 2; k++) {
+          if (i_face_cells[f_id][k] > -1)
+            cell_flag[i_face_cells[f_id][k]] = 1;
+        }
+        break;
+      }
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    for (cs_lnum_t j = m->b_face_vtx_idx[f_id];
+         j < m->b_face_vtx_idx[f_id+1];
+         j++) {
+      if (vtx_flag[m->b_face_vtx_lst[j]]) {
+        b_face_ids[n_m_b_faces++] = f_id;
+        if (b_face_cells[f_id] > -1)
+          cell_flag[b_face_cells[f_id]] = 1;
+        break;
+      }
+    }
+  }
+
+  BFT_FREE(vtx_flag);
+
+  if (m->halo != nullptr)
+    cs_halo_sync_num(m->halo, CS_HALO_EXTENDED, cell_flag);
+
+  /* Face centers of gravity, normals, and surfaces of moved faces */
+
+  _compute_face_quantities(ctx,
+                           n_m_i_faces,
+                           i_face_ids,
+                           (const cs_real_3_t *)m->vtx_coord,
+                           m->i_face_vtx_idx,
+                           m->i_face_vtx_lst,
+                           (cs_real_3_t *)mq->i_face_cog,
+                           (cs_real_3_t *)mq->i_face_normal);
+
+  _compute_face_surface(ctx,
+                        n_m_i_faces,
+                        i_face_ids,
+                        mq->i_face_normal,
+                        mq->i_face_surf);
+
+  _compute_face_quantities(ctx,
+                           n_m_b_faces,
+                           b_face_ids,
+                           (const cs_real_3_t *)m->vtx_coord,
+                           m->b_face_vtx_idx,
+                           m->b_face_vtx_lst,
+                           (cs_real_3_t *)mq->b_face_cog,
+                           (cs_real_3_t *)mq->b_face_normal);
+
+  _compute_face_surface(ctx,
+                        n_m_b_faces,
+                        b_face_ids,
+                        mq->b_face_normal,
+                        mq->b_face_surf);
+
+  _elt_subset_t ss = {n_m_i_faces, n_m_b_faces,
+                      i_face_ids, b_face_ids, nullptr};
+
+  _compute_unit_normals(m, mq, ctx, &ss);
+
+  /* Extend face lists to all faces adjacent to an updated cell, as cell
+     quantities require all faces of a cell, and distances and
+     reconstruction vectors depend on adjacent cell centers */
+
+  ctx.wait();
+
+  n_m_i_faces = 0;
+  n_m_b_faces = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t c_id0 = i_face_cells[f_id][0], c_id1 = i_face_cells[f_id][1];
+    if (   (c_id0 > -1 && cell_flag[c_id0])
+        || (c_id1 > -1 && cell_flag[c_id1]))
+      i_face_ids[n_m_i_faces++] = f_id;
+  }
+
+  cs_lnum_t n_m_b_faces_d = 0;  /* faces with distance-based quantities */
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    cs_lnum_t c_id = b_face_cells[f_id];
+    if (c_id > -1 && cell_flag[c_id]) {
+      b_face_ids[n_m_b_faces++] = f_id;
+      if (f_id < m->n_b_faces)
+        n_m_b_faces_d = n_m_b_faces;
+    }
+  }
+
+  ss.n_i_faces = n_m_i_faces;
+  ss.n_b_faces = n_m_b_faces;
+  ss.cell_flag = cell_flag;
+
+  /* Cell centers and volumes of updated cells */
+
+  switch (_cell_cen_algorithm) {
+
+  case 0:
+    _cell_faces_cog(m,
+                    ctx,
+                    &ss,
+                    mq->i_face_normal,
+                    mq->i_face_cog,
+                    mq->b_face_normal,
+                    mq->b_face_cog,
+                    mq->cell_cen);
+    _compute_cell_volume(m,
+                         ctx,
+                         &ss,
+                         (const cs_real_3_t *)(mq->i_face_normal),
+                         (const cs_real_3_t *)(mq->i_face_cog),
+                         (const cs_real_3_t *)(mq->b_face_normal),
+                         (const cs_real_3_t *)(mq->b_face_cog),
+                         (const cs_real_3_t *)(mq->cell_cen),
+                         mq->cell_vol);
+    break;
+
+  case 1:
+    _compute_cell_quantities(m,
+                             ctx,
+                             &ss,
+                             (const cs_real_3_t *)mq->i_face_normal,
+                             (const cs_real_3_t *)mq->i_face_cog,
+                             (const cs_real_3_t *)mq->b_face_normal,
+                             (const cs_real_3_t *)mq->b_face_cog,
+                             (cs_real_3_t *)mq->cell_cen,
+                             mq->cell_vol);
+    break;
+
+  default:
+    assert(0);
+
+  }
+
+  ctx.wait();
+
+  /* Synchronize geometric quantities */
+
+  if (m->halo != nullptr) {
+
+    cs_halo_sync_var_strided(m->halo, CS_HALO_EXTENDED,
+                             mq->cell_cen, 3);
+    if (m->n_init_perio > 0)
+      cs_halo_perio_sync_coords(m->halo, CS_HALO_EXTENDED,
+                                mq->cell_cen);
+
+    cs_halo_sync_var(m->halo, CS_HALO_EXTENDED, mq->cell_vol);
+
+  }
+
+  _cell_volume_reductions(m,
+                          mq->cell_vol,
+                          &(mq->min_vol),
+                          &(mq->max_vol),
+                          &(mq->tot_vol));
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+    cs_real_t  _min_vol, _max_vol, _tot_vol;
+
+    MPI_Allreduce(&(mq->min_vol), &_min_vol, 1, CS_MPI_REAL,
+                  MPI_MIN, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mq->max_vol), &_max_vol, 1, CS_MPI_REAL,
+                  MPI_MAX, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mq->tot_vol), &_tot_vol, 1, CS_MPI_REAL,
+                  MPI_SUM, cs_glob_mpi_comm);
+
+    mq->min_vol = _min_vol;
+    mq->max_vol = _max_vol;
+    mq->tot_vol = _tot_vol;
+
+  }
+#endif
+
+  mq->min_f_vol = mq->min_vol;
+  mq->max_f_vol = mq->max_vol;
+  mq->tot_f_vol = mq->tot_vol;
+
+  /* Distances, weights and reconstruction vectors of faces
+     adjacent to updated cells */
+
+  _compute_face_distances(ctx,
+                          n_m_i_faces,
+                          n_m_b_faces_d,
+                          i_face_ids,
+                          b_face_ids,
+                          (const cs_lnum_2_t *)(m->i_face_cells),
+                          m->b_face_cells,
+                          (const cs_real_3_t *)(mq->i_face_u_normal),
+                          (const cs_real_3_t *)(mq->i_face_normal),
+                          (const cs_real_3_t *)(mq->b_face_u_normal),
+                          (const cs_real_3_t *)(mq->b_face_normal),
+                          (const cs_real_3_t *)(mq->i_face_cog),
+                          (const cs_real_3_t *)(mq->b_face_cog),
+                          (const cs_real_3_t *)(mq->cell_cen),
+                          (const cs_real_t *)(mq->cell_vol),
+                          mq->i_dist,
+                          mq->b_dist,
+                          mq->weight);
+
+  _compute_face_vectors(ctx,
+                        m->dim,
+                        n_m_i_faces,
+                        n_m_b_faces_d,
+                        i_face_ids,
+                        b_face_ids,
+                        (const cs_lnum_2_t *)(m->i_face_cells),
+                        m->b_face_cells,
+                        (const cs_real_3_t *)mq->i_face_u_normal,
+                        (const cs_real_3_t *)mq->b_face_u_normal,
+                        mq->i_face_cog,
+                        mq->b_face_cog,
+                        mq->cell_cen,
+                        mq->weight,
+                        mq->b_dist,
+                        mq->dijpf,
+                        mq->diipb,
+                        mq->dofij);
+
+  _compute_face_sup_vectors
+    (ctx,
+     m->n_cells,
+     n_m_i_faces,
+     i_face_ids,
+     (const cs_lnum_2_t *)(m->i_face_cells),
+     (const cs_real_3_t *)(mq->i_face_u_normal),
+     (const cs_real_3_t *)(mq->i_face_normal),
+     (const cs_real_3_t *)(mq->i_face_cog),
+     (const cs_real_3_t *)(mq->cell_cen),
+     mq->cell_vol,
+     mq->i_dist,
+     (cs_real_3_t *)(mq->diipf),
+     (cs_real_3_t *)(mq->djjpf));
+
+  CS_FREE_HD(b_face_ids);
+  CS_FREE_HD(i_face_ids);
+  CS_FREE_HD(cell_flag);
+
+  /* Build the geometrical matrix linear gradient correction
+     (not restricted to updated cells, as it uses extended neighborhoods) */
+
+  if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
+    _compute_corr_grad_lin(m, mq);
+
+  if (mq->min_vol <= 0.) {
+    bft_printf(_(" --- Information on the volumes\n"
+                 "       Minimum control volume      = %14.7e\n"
+                 "       Maximum control volume      = %14.7e\n"
+                 "       Total volume for the domain = %14.7e\n"),
+               mq->min_vol, mq->max_vol,
+               mq->tot_vol);
+    bft_printf(_("\nAbort due to the detection of a negative control "
+                 "volume.\n"));
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute min, max, and total
  *
@@ -4792,9 +5645,17 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
   if (mesh_quantities->djjpf == nullptr)
     BFT_MALLOC(mesh_quantities->djjpf, n_i_faces*dim, cs_real_t);
 
+  cs_dispatch_context ctx;
+  _init_dispatch_context(mesh, ctx);
+
+  const void *ptrs[] = {mesh_quantities->diipf, mesh_quantities->djjpf};
+  _check_dispatch_ptrs(2, ptrs, ctx);
+
   _compute_face_sup_vectors
-    (mesh->n_cells,
+    (ctx,
+     mesh->n_cells,
      mesh->n_i_faces,
+     nullptr,
      (const cs_lnum_2_t *)(mesh->i_face_cells),
      (const cs_real_3_t *)(mesh_quantities->i_face_u_normal),
      (const cs_real_3_t *)(mesh_quantities->i_face_normal),
@@ -4872,12 +5733,19 @@ cs_mesh_quantities_i_faces(const cs_mesh_t   *mesh,
   BFT_MALLOC(i_face_cog, mesh->n_i_faces * mesh->dim, cs_real_t);
   BFT_MALLOC(i_face_normal, mesh->n_i_faces * mesh->dim, cs_real_t);
 
-  _compute_face_quantities(mesh->n_i_faces,
-                          (const cs_real_3_t *)mesh->vtx_coord,
-                          mesh->i_face_vtx_idx,
-                          mesh->i_face_vtx_lst,
-                          (cs_real_3_t *)i_face_cog,
-                          (cs_real_3_t *)i_face_normal);
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+
+  _compute_face_quantities(ctx,
+                           mesh->n_i_faces,
+                           nullptr,
+                           (const cs_real_3_t *)mesh->vtx_coord,
+                           mesh->i_face_vtx_idx,
+                           mesh->i_face_vtx_lst,
+                           (cs_real_3_t *)i_face_cog,
+                           (cs_real_3_t *)i_face_normal);
+
+  ctx.wait();
 
   *p_i_face_cog = i_face_cog;
   *p_i_face_normal = i_face_normal;
@@ -4905,13 +5773,20 @@ cs_mesh_quantities_b_faces(const cs_mesh_t   *mesh,
   BFT_MALLOC(b_face_cog, mesh->n_b_faces * mesh->dim, cs_real_t);
   BFT_MALLOC(b_face_normal, mesh->n_b_faces * mesh->dim, cs_real_t);
 
-  _compute_face_quantities(mesh->n_b_faces,
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+
+  _compute_face_quantities(ctx,
+                           mesh->n_b_faces,
+                           nullptr,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->b_face_vtx_idx,
                            mesh->b_face_vtx_lst,
                            (cs_real_3_t *)b_face_cog,
                            (cs_real_3_t *)b_face_normal);
 
+  ctx.wait();
+
   *p_b_face_cog = b_face_cog;
   *p_b_face_normal = b_face_normal;
 }
@@ -4946,18 +5821,6 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
                                   const cs_real_t   b_face_cog[],
                                   cs_real_t         cell_cen[])
 {
-  cs_real_t  *cell_area = nullptr;
-
-  /* Mesh connectivity */
-
-  const  cs_lnum_t  n_i_faces = mesh->n_i_faces;
-  const  cs_lnum_t  n_b_faces = mesh->n_b_faces;
-  const  cs_lnum_t  n_cells = mesh->n_cells;
-  const  cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
-  const  cs_lnum_2_t  *i_face_cells
-    = (const cs_lnum_2_t *)(mesh->i_face_cells);
-  const  cs_lnum_t  *b_face_cells = mesh->b_face_cells;
-
   /* Return if ther is not enough data (Solcom case except rediative module
      or Pre-processor 1.2.d without option "-n") */
 
@@ -4968,95 +5831,24 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
 
   assert(cell_cen != nullptr);
 
-  /* Initialization */
-
-  BFT_MALLOC(cell_area, n_cells_with_ghosts, cs_real_t);
-
-  for (cs_lnum_t j = 0; j < n_cells_with_ghosts; j++) {
+  cs_dispatch_context ctx;
+  _init_dispatch_context(mesh, ctx);
 
-    cell_area[j] = 0.;
+  const void *ptrs[] = {i_face_norm, i_face_cog, b_face_norm, b_face_cog,
+                        cell_cen};
+  _check_dispatch_ptrs(5, ptrs, ctx);
 
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[3*j + i] = 0.;
-
-  }
+  _elt_subset_t ss = {mesh->n_i_faces, mesh->n_b_faces,
+                      nullptr, nullptr, nullptr};
 
-  /* Loop on interior faces
-     ---------------------- */
-
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
-
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
-
-    /* Computation of the area of the face */
-
-    cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
-
-    if (   !(cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE)
-        || area > 1.e-20) {
-      if (c_id1 > -1) {
-        cell_area[c_id1] += area;
-        for (cs_lnum_t i = 0; i < 3; i++)
-          cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
-      }
-      if (c_id2 > -1) {
-        cell_area[c_id2] += area;
-        for (cs_lnum_t i = 0; i < 3; i++)
-          cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
-      }
-    }
-
-  } /* End of loop on interior faces */
-
-  /* Loop on boundary faces
-     --------------------- */
-
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
-
-    cs_lnum_t c_id1 = b_face_cells[f_id];
-
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
-
-    if (c_id1 > -1) {
-
-      cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
-
-      if (!(cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE) ||
-          area > 1.e-20) {
-        cell_area[c_id1] += area;
-
-        /* Computation of the numerator */
-
-        for (cs_lnum_t i = 0; i < 3; i++)
-          cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
-      }
-
-    }
-
-  } /* End of loop on boundary faces */
-
-  /* Loop on cells to finalize the computation of center of gravity
-     -------------------------------------------------------------- */
-
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[c_id*3 + i] /= cell_area[c_id];
-
-  }
-
-  /* Free memory */
-
-  BFT_FREE(cell_area);
+  _cell_faces_cog(mesh,
+                  ctx,
+                  &ss,
+                  i_face_norm,
+                  i_face_cog,
+                  b_face_norm,
+                  b_face_cog,
+                  cell_cen);
 }
 
 /*----------------------------------------------------------------------------
@@ -5087,7 +5879,12 @@ cs_mesh_quantities_cell_volume(const cs_mesh_t  *mesh)
   cs_mesh_quantities_i_faces(mesh, &i_face_cog, &i_face_normal);
   cs_mesh_quantities_b_faces(mesh, &b_face_cog, &b_face_normal);
 
+  cs_dispatch_context ctx;
+  ctx.set_use_gpu(false);
+
   _compute_cell_quantities(mesh,
+                           ctx,
+                           nullptr,
                            (const cs_real_3_t *)i_face_normal,
                            (const cs_real_3_t *)i_face_cog,
                            (const cs_real_3_t *)b_face_normal,
@@ -5423,12 +6220,22 @@ cs_mesh_quantities_compute_face_quantities(cs_lnum_t        n_faces,
                                            cs_real_t        face_cog[][3],
                                            cs_real_t        face_normal[][3])
 {
-  _compute_face_quantities(n_faces,
+  cs_dispatch_context ctx;
+
+  const void *ptrs[] = {vtx_coord, face_vtx_idx, face_vtx,
+                        face_cog, face_normal};
+  _check_dispatch_ptrs(5, ptrs, ctx);
+
+  _compute_face_quantities(ctx,
+                           n_faces,
+                           nullptr,
                            vtx_coord,
                            face_vtx_idx,
                            face_vtx,
                            face_cog,
                            face_normal);
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
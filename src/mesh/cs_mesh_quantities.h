@@ -293,6 +293,29 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *m,
                            cs_mesh_quantities_t  *mq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after a subset of vertices has moved.
+ *
+ * Only the quantities of faces containing a moved vertex, of their
+ * adjacent cells, and of the faces of those cells are recomputed.
+ * When options requiring a global recomputation are active, or if the
+ * quantities were not computed yet, this reverts to
+ * \ref cs_mesh_quantities_compute.
+ *
+ * \param[in]       m              pointer to mesh structure
+ * \param[in, out]  mq             pointer to mesh quantities structures.
+ * \param[in]       n_moved_vtx    number of moved vertices
+ * \param[in]       moved_vtx_ids  ids of moved vertices, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *m,
+                                cs_mesh_quantities_t  *mq,
+                                cs_lnum_t              n_moved_vtx,
+                                const cs_lnum_t        moved_vtx_ids[]);
+
 /*----------------------------------------------------------------------------
  * Compute fluid mesh quantities
  *
@@ -928,6 +928,226 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
   BFT_FREE(weight);
 }
 
+/*----------------------------------------------------------------------------
+ * Combine multiple cell weights (balance constraints) into a single weight.
+ *
+ * Each constraint is normalized by its global sum, so that all constraints
+ * contribute equally to the combined weight.
+ *
+ * parameters:
+ *   mb  <-- pointer to mesh builder structure
+ *
+ * returns:
+ *   newly allocated combined weights, in the builder's cell block
+ *   distribution, or nullptr if at most one weight is defined per cell
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_combined_cell_weights(const cs_mesh_builder_t  *mb)
+{
+  const int n_w = mb->n_cell_weights;
+
+  if (mb->cell_weight == nullptr || n_w < 2)
+    return nullptr;
+
+  const cs_lnum_t n_cells
+    = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  double *w_sum;
+  BFT_MALLOC(w_sum, n_w*2, double);
+
+  for (int j = 0; j < n_w; j++)
+    w_sum[j] = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    for (int j = 0; j < n_w; j++)
+      w_sum[j] += mb->cell_weight[i*n_w + j];
+  }
+
+  for (int j = 0; j < n_w; j++)
+    w_sum[n_w + j] = w_sum[j];
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(w_sum, w_sum + n_w, n_w, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+#endif
+
+  double *w_mult = w_sum;
+  for (int j = 0; j < n_w; j++)
+    w_mult[j] = (w_sum[n_w + j] > 0) ? 1. / w_sum[n_w + j] : 0.;
+
+  cs_real_t *cell_weight;
+  BFT_MALLOC(cell_weight, n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cell_weight[i] = 0;
+    for (int j = 0; j < n_w; j++)
+      cell_weight[i] += mb->cell_weight[i*n_w + j] * w_mult[j];
+  }
+
+  BFT_FREE(w_sum);
+
+  return cell_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Define cell ranks based on space-filling curve ordering and cell weights.
+ *
+ * The curve is cut so that each rank receives approximately the same
+ * sum of weights, rather than the same number of cells.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   n_ranks     <-- number of ranks in partition
+ *   n_cells     <-- number of cells in local block
+ *   cell_num    <-- global cell number along curve (1 to n)
+ *   cell_weight <-- cell weights
+ *   cell_rank   --> cell rank
+ *   comm        <-- associated MPI communicator
+ *
+ * returns:
+ *   true if cells were assigned, false if weights are all zero
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static bool
+_cell_rank_by_weighted_sfc(cs_gnum_t         n_g_cells,
+                           int               n_ranks,
+                           cs_lnum_t         n_cells,
+                           const cs_gnum_t   cell_num[],
+                           const cs_real_t   cell_weight[],
+                           int               cell_rank[],
+                           MPI_Comm          comm)
+
+#else
+
+static bool
+_cell_rank_by_weighted_sfc(cs_gnum_t         n_g_cells,
+                           int               n_ranks,
+                           cs_lnum_t         n_cells,
+                           const cs_gnum_t   cell_num[],
+                           const cs_real_t   cell_weight[],
+                           int               cell_rank[])
+
+#endif
+{
+  cs_lnum_t n_sfc_cells = n_cells;
+  cs_real_t *sfc_weight = nullptr;
+  int *sfc_rank = nullptr;
+
+  /* Reorder weights along the curve */
+
+#if defined(HAVE_MPI)
+
+  cs_all_to_all_t *d = nullptr;
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                          cs_glob_n_ranks,
+                                                          1,
+                                                          0,
+                                                          n_g_cells);
+
+    n_sfc_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+    d = cs_all_to_all_create_from_block(n_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        cell_num,
+                                        bi,
+                                        comm);
+
+    sfc_weight = static_cast<cs_real_t *>
+                   (cs_all_to_all_copy_array(d,
+                                             CS_REAL_TYPE,
+                                             1,
+                                             false,
+                                             cell_weight,
+                                             nullptr));
+
+  }
+
+#endif
+
+  if (sfc_weight == nullptr) {
+    BFT_MALLOC(sfc_weight, n_sfc_cells, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      sfc_weight[cell_num[i] - 1] = cell_weight[i];
+  }
+
+  /* Compute prefix sums of weights along the curve */
+
+  double w_sum[2] = {0, 0};
+
+  for (cs_lnum_t i = 0; i < n_sfc_cells; i++)
+    w_sum[0] += sfc_weight[i];
+
+  w_sum[1] = w_sum[0];
+
+#if defined(HAVE_MPI)
+  if (d != nullptr) {
+    double l_sum = w_sum[0];
+    MPI_Allreduce(&l_sum, w_sum + 1, 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Exscan(&l_sum, w_sum, 1, MPI_DOUBLE, MPI_SUM, comm);
+    if (cs_glob_rank_id == 0)
+      w_sum[0] = 0;
+  }
+  else
+#endif
+    w_sum[0] = 0;
+
+  bool retval = (w_sum[1] > 0);
+
+  if (retval) {
+
+    BFT_MALLOC(sfc_rank, n_sfc_cells, int);
+
+    /* Assign each cell to the rank containing its weight's midpoint */
+
+    double w_shift = w_sum[0];
+    const double r_mult = (double)n_ranks / w_sum[1];
+
+    for (cs_lnum_t i = 0; i < n_sfc_cells; i++) {
+      int r_id = (w_shift + 0.5*sfc_weight[i]) * r_mult;
+      if (r_id >= n_ranks)
+        r_id = n_ranks - 1;
+      else if (r_id < 0)
+        r_id = 0;
+      sfc_rank[i] = r_id;
+      w_shift += sfc_weight[i];
+    }
+
+  }
+
+  BFT_FREE(sfc_weight);
+
+  /* Return ranks to initial distribution */
+
+#if defined(HAVE_MPI)
+  if (d != nullptr) {
+    if (retval)
+      cs_all_to_all_copy_array(d,
+                               CS_INT_TYPE,
+                               1,
+                               true, /* reverse */
+                               sfc_rank,
+                               cell_rank);
+    cs_all_to_all_destroy(&d);
+  }
+  else
+#endif
+  if (retval) {
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_rank[i] = sfc_rank[cell_num[i] - 1];
+  }
+
+  BFT_FREE(sfc_rank);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Define cell ranks using a space-filling curve.
  *
@@ -1011,7 +1231,35 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   /* Determine rank based on global numbering with SFC ordering; */
 
-  if (_part_uniform_sfc_block_size == false) {
+  bool weighted = false;
+
+  if (mb->cell_weight != nullptr && _part_uniform_sfc_block_size == false) {
+    cs_real_t *_cell_weight = _combined_cell_weights(mb);
+    const cs_real_t *cell_weight
+      = (_cell_weight != nullptr) ? _cell_weight : mb->cell_weight;
+#if defined(HAVE_MPI)
+    weighted = _cell_rank_by_weighted_sfc(n_g_cells,
+                                          n_ranks,
+                                          n_cells,
+                                          cell_num,
+                                          cell_weight,
+                                          cell_rank,
+                                          comm);
+#else
+    weighted = _cell_rank_by_weighted_sfc(n_g_cells,
+                                          n_ranks,
+                                          n_cells,
+                                          cell_num,
+                                          cell_weight,
+                                          cell_rank);
+#endif
+    BFT_FREE(_cell_weight);
+  }
+
+  if (weighted)
+    bft_printf(_("  (curve cut based on cell weights)\n"));
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -1350,6 +1598,8 @@ _metis_cell_cells(size_t       n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   n_con         <-- number of weights (balance constraints) per cell
+ *   cell_wgt      <-- cell weights (interleaved), or nullptr
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
@@ -1358,12 +1608,14 @@ _part_metis(size_t   n_cells,
             int      n_parts,
             idx_t   *cell_idx,
             idx_t   *cell_neighbors,
+            int      n_con,
+            idx_t   *cell_wgt,
             int     *cell_part)
 {
   size_t i;
   double  start_time, end_time;
 
-  idx_t   _n_constraints = 1;
+  idx_t   _n_constraints = (cell_wgt != nullptr) ? n_con : 1;
 
   idx_t    edgecut    = 0; /* <-- Number of faces on partition */
 
@@ -1390,7 +1642,7 @@ _part_metis(size_t   n_cells,
                              &_n_constraints,
                              cell_idx,
                              cell_neighbors,
-                             nullptr,       /* vwgt:   cell weights */
+                             cell_wgt,      /* vwgt:   cell weights */
                              nullptr,       /* vsize:  size of the vertices */
                              nullptr,       /* adjwgt: face weights */
                              &_n_parts,
@@ -1413,7 +1665,7 @@ _part_metis(size_t   n_cells,
                         &_n_constraints,
                         cell_idx,
                         cell_neighbors,
-                        nullptr,       /* vwgt:   cell weights */
+                        cell_wgt,      /* vwgt:   cell weights */
                         nullptr,       /* vsize:  size of the vertices */
                         nullptr,       /* adjwgt: face weights */
                         &_n_parts,
@@ -1457,6 +1709,8 @@ _part_metis(size_t   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   n_con         <-- number of weights (balance constraints) per cell
+ *   cell_wgt      <-- cell weights (interleaved), or nullptr
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1467,6 +1721,8 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                int         n_parts,
                idx_t      *cell_idx,
                idx_t      *cell_neighbors,
+               int         n_con,
+               idx_t      *cell_wgt,
                int        *cell_part,
                MPI_Comm    comm)
 {
@@ -1529,19 +1785,28 @@ _part_parmetis(cs_gnum_t   n_g_cells,
     idx_t numflag    = 0;            /* 0 to n-1 numbering (C type) */
     idx_t wgtflag    = 0;            /* No weighting for faces or cells */
 
+    if (cell_wgt != nullptr) {
+      wgtflag = 2;                   /* Weights for cells only */
+      ncon = n_con;
+    }
+
     real_t  wgt     = 1.0 / n_parts;
-    real_t  ubvec[] = { 1.5 };
+    real_t *ubvec   = nullptr;
     real_t *tpwgts  = nullptr;
 
-    BFT_MALLOC(tpwgts, n_parts, real_t);
+    BFT_MALLOC(ubvec, ncon, real_t);
+    BFT_MALLOC(tpwgts, n_parts*ncon, real_t);
+
+    for (j = 0; j < ncon; j++)
+      ubvec[j] = 1.5;
 
-    for (j = 0; j < n_parts; j++)
+    for (j = 0; j < n_parts*ncon; j++)
       tpwgts[j] = wgt;
 
     int retval = ParMETIS_V3_PartKway(vtxdist,
                                       cell_idx,
                                       cell_neighbors,
-                                      nullptr, /* vwgt:   cell weights */
+                                      cell_wgt, /* vwgt:   cell weights */
                                       nullptr, /* adjwgt: face weights */
                                       &wgtflag,
                                       &numflag,
@@ -1555,6 +1820,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                                       &comm);
 
     BFT_FREE(tpwgts);
+    BFT_FREE(ubvec);
 
     edgecut = _edgecut;
 
@@ -1848,6 +2114,7 @@ _scotch_cell_cells(size_t        n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_wgt      <-- cell weights, or nullptr
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
@@ -1856,6 +2123,7 @@ _part_scotch(SCOTCH_Num   n_cells,
              int          n_parts,
              SCOTCH_Num  *cell_idx,
              SCOTCH_Num  *cell_neighbors,
+             SCOTCH_Num  *cell_wgt,
              int         *cell_part)
 {
   SCOTCH_Num  i;
@@ -1893,7 +2161,7 @@ _part_scotch(SCOTCH_Num   n_cells,
                         n_cells,            /* vertnbr */
                         cell_idx,           /* verttab */
                         nullptr,               /* vendtab: verttab + 1 or nullptr */
-                        nullptr,               /* velotab: vertex weights */
+                        cell_wgt,           /* velotab: vertex weights */
                         nullptr,               /* vlbltab; vertex labels */
                         cell_idx[n_cells],  /* edgenbr */
                         cell_neighbors,     /* edgetab */
@@ -1969,6 +2237,7 @@ _part_scotch(SCOTCH_Num   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_wgt      <-- cell weights, or nullptr
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -1979,6 +2248,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                int          n_parts,
                SCOTCH_Num  *cell_idx,
                SCOTCH_Num  *cell_neighbors,
+               SCOTCH_Num  *cell_wgt,
                int         *cell_part,
                MPI_Comm     comm)
 {
@@ -2021,7 +2291,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                 n_cells,            /* vertlocmax (= vertlocnbr) */
                 cell_idx,           /* vertloctab */
                 nullptr,               /* vendloctab: vertloctab + 1 or nullptr */
-                nullptr,               /* veloloctab: vertex weights */
+                cell_wgt,           /* veloloctab: vertex weights */
                 nullptr,               /* vlblloctab; vertex labels */
                 cell_idx[n_cells],  /* edgelocnbr */
                 cell_idx[n_cells],  /* edgelocsiz */
@@ -2096,6 +2366,165 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
 #endif /* defined(HAVE_PTSCOTCH) */
 
+#if    defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
+    || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+
+/*----------------------------------------------------------------------------
+ * Build integer cell weights for graph partitioners.
+ *
+ * Weights defined in the mesh builder's cell block distribution are
+ * redistributed to that used for partitioning, and scaled (separately
+ * for each constraint) so that the heaviest cell has a weight of about
+ * 1000 (and the lightest at least 1), while their global sum remains
+ * below a given limit.
+ *
+ * If the builder defines multiple weights per cell but a single weight
+ * is requested, weights are combined first.
+ *
+ * parameters:
+ *   mesh       <-- pointer to mesh structure
+ *   mb         <-- pointer to mesh builder structure
+ *   rank_step  <-- step between active partitioning ranks
+ *   max_sum    <-- maximum allowed global sum of weights
+ *   n_con      <-- number of weights per cell requested
+ *                  (1 or mb->n_cell_weights)
+ *
+ * returns:
+ *   newly allocated rounded weights for the partitioning distribution
+ *   (interleaved), or nullptr if no weights are defined
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_graph_cell_weights(const cs_mesh_t          *mesh,
+                    const cs_mesh_builder_t  *mb,
+                    int                       rank_step,
+                    double                    max_sum,
+                    int                       n_con)
+{
+  if (mb->cell_weight == nullptr)
+    return nullptr;
+
+  assert(n_con == 1 || n_con == mb->n_cell_weights);
+
+  cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+  cs_real_t *cell_wgt = nullptr;
+
+  cs_real_t *_src_wgt = _combined_cell_weights(mb);
+  const cs_real_t *src_wgt = mb->cell_weight;
+
+  if (n_con == 1 && _src_wgt != nullptr)
+    src_wgt = _src_wgt;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                          cs_glob_n_ranks,
+                                                          rank_step,
+                                                          0,
+                                                          mesh->n_g_cells);
+
+    cs_gnum_t *cell_gnum;
+    BFT_MALLOC(cell_gnum, n_cells, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_gnum[i] = mb->cell_bi.gnum_range[0] + i;
+
+    cs_part_to_block_t *d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                                            bi,
+                                                            n_cells,
+                                                            cell_gnum);
+    cs_part_to_block_transfer_gnum(d, cell_gnum);
+
+    n_cells = bi.gnum_range[1] - bi.gnum_range[0];
+    BFT_MALLOC(cell_wgt, n_cells*n_con, cs_real_t);
+
+    cs_part_to_block_copy_array(d,
+                                CS_REAL_TYPE,
+                                n_con,
+                                src_wgt,
+                                cell_wgt);
+
+    cs_part_to_block_destroy(&d);
+
+  }
+
+#endif
+
+  if (cell_wgt == nullptr) {
+    BFT_MALLOC(cell_wgt, n_cells*n_con, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_cells*n_con; i++)
+      cell_wgt[i] = src_wgt[i];
+  }
+
+  BFT_FREE(_src_wgt);
+
+  /* Determine scaling for each constraint */
+
+  double *w_max;
+  BFT_MALLOC(w_max, n_con*2, double);
+  double *w_sum = w_max + n_con;
+
+  for (int j = 0; j < n_con; j++) {
+    w_max[j] = 0;
+    w_sum[j] = 0;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    for (int j = 0; j < n_con; j++) {
+      cs_real_t w = cell_wgt[i*n_con + j];
+      if (w > w_max[j])
+        w_max[j] = w;
+      w_sum[j] += w;
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(MPI_IN_PLACE, w_max, n_con, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(MPI_IN_PLACE, w_sum, n_con, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  if (n_con == 1 && w_max[0] <= 0) {
+    BFT_FREE(w_max);
+    BFT_FREE(cell_wgt);
+    return nullptr;
+  }
+
+  /* Constraints with no weight reduce to uniform (unit) weights */
+
+  double n_g_cells = mesh->n_g_cells;
+
+  double *scale = w_max;
+  for (int j = 0; j < n_con; j++) {
+    if (w_max[j] > 0) {
+      scale[j] = 1000. / w_max[j];
+      if ((w_sum[j]*scale[j] + n_g_cells) > max_sum)
+        scale[j] = (max_sum - n_g_cells) / w_sum[j];
+    }
+    else
+      scale[j] = 0;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    for (int j = 0; j < n_con; j++) {
+      cs_real_t *w = cell_wgt + i*n_con + j;
+      *w = floor(*w * scale[j] + 0.5);
+      if (*w < 1)
+        *w = 1;
+    }
+  }
+
+  BFT_FREE(w_max);
+
+  return cell_wgt;
+}
+
+#endif /* defined(HAVE_METIS) || defined(HAVE_PARMETIS) ... */
+
 /*----------------------------------------------------------------------------
  * Prepare input from mesh builder for use by partitioner.
  *
@@ -2669,6 +3098,172 @@ _read_cell_rank(cs_mesh_t            *mesh,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Read cell weights if available
+ *
+ * parameters:
+ *   mesh  <-- pointer to mesh structure
+ *   mb    <-> pointer to mesh builder helper structure
+ *   echo  <-- echo (verbosity) level
+ *
+ * return:
+ *   0 if cell weights were read correctly, -1 if file is not available,
+ *   1 in case of error.
+ *----------------------------------------------------------------------------*/
+
+static int
+_read_cell_weights(cs_mesh_t          *mesh,
+                   cs_mesh_builder_t  *mb,
+                   long                echo)
+{
+  int retval = 0;
+
+  char file_name[64];
+  cs_file_access_t  method;
+  cs_io_sec_header_t  header;
+
+  cs_io_t  *w_pp_in = nullptr;
+  cs_lnum_t   n_weights = 0;
+  cs_gnum_t   n_g_cells = 0;
+
+  static bool  check_file = true;
+
+  const char magic_string[] = "Cell weights, R0";
+  const char  *unexpected_msg = N_("Section of type <%s> on <%s>\n"
+                                   "unexpected or of incorrect size");
+
+  if (check_file == false)
+    return retval;
+
+  snprintf(file_name, 64,
+           "partition_input%ccell_weights", _dir_separator);
+  file_name[63] = '\0';
+
+  /* Test if file exists */
+
+  if (! cs_file_isreg(file_name)) {
+    check_file = false;
+    return -1;
+  }
+
+  /* Open file */
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info           hints;
+    MPI_Comm           block_comm, comm;
+    cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+    cs_file_get_default_comm(nullptr, &block_comm, &comm);
+    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+    w_pp_in = cs_io_initialize(file_name,
+                               magic_string,
+                               CS_IO_MODE_READ,
+                               method,
+                               echo,
+                               hints,
+                               block_comm,
+                               comm);
+  }
+#else
+  {
+    cs_file_get_default_access(CS_FILE_MODE_READ, &method);
+    w_pp_in = cs_io_initialize(file_name,
+                               magic_string,
+                               CS_IO_MODE_READ,
+                               method,
+                               echo);
+  }
+#endif
+
+  if (echo > 0)
+    bft_printf("\n");
+
+  /* Loop on read sections */
+
+  while (w_pp_in != nullptr) {
+
+    cs_io_read_header(w_pp_in, &header);
+
+    if (strncmp(header.sec_name, "n_cells",
+                CS_IO_NAME_LEN) == 0) {
+
+      if (header.n_vals != 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name,
+                  cs_io_get_name(w_pp_in));
+      else {
+        cs_io_set_cs_gnum(&header, w_pp_in);
+        cs_io_read_global(&header, &n_g_cells, w_pp_in);
+        if (n_g_cells != mesh->n_g_cells) {
+          cs_base_warn(__FILE__, __LINE__);
+          bft_printf(_("The number of cells reported by file\n"
+                       "\"%s\" (%llu)\n"
+                       "does not correspond to those of the mesh (%llu);\n"
+                       "cell weights are ignored.\n"),
+                     cs_io_get_name(w_pp_in),
+                     (unsigned long long)(n_g_cells),
+                     (unsigned long long)(mesh->n_g_cells));
+          retval = 1;
+          break;
+        }
+      }
+
+    }
+    else if (strncmp(header.sec_name, "n_weights",
+                     CS_IO_NAME_LEN) == 0) {
+
+      if (header.n_vals != 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name,
+                  cs_io_get_name(w_pp_in));
+      else {
+        cs_io_set_cs_lnum(&header, w_pp_in);
+        cs_io_read_global(&header, &n_weights, w_pp_in);
+      }
+
+    }
+    else if (strncmp(header.sec_name, "cell:weights",
+                     CS_IO_NAME_LEN) == 0) {
+
+      if (   n_weights < 1
+          || (   header.n_vals
+              != (cs_file_off_t)(mesh->n_g_cells*n_weights)))
+        bft_error(__FILE__, __LINE__, 0,
+                  _(unexpected_msg), header.sec_name,
+                  cs_io_get_name(w_pp_in));
+      else {
+        cs_gnum_t n_elts = mesh->n_g_cells;
+        if (mb->cell_bi.gnum_range[0] > 0)
+          n_elts = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+        mb->n_cell_weights = n_weights;
+        BFT_MALLOC(mb->cell_weight, n_elts*n_weights, cs_real_t);
+        cs_io_assert_cs_real(&header, w_pp_in);
+        cs_io_read_block(&header,
+                         mb->cell_bi.gnum_range[0],
+                         mb->cell_bi.gnum_range[1],
+                         mb->cell_weight, w_pp_in);
+        bft_printf(_(" Using %d measured weight(s) per cell from \"%s\".\n"),
+                   (int)n_weights, file_name);
+      }
+      cs_io_finalize(&w_pp_in);
+      w_pp_in = nullptr;
+
+    }
+
+    else
+      bft_error(__FILE__, __LINE__, 0,
+                _("Section of type <%s> on <%s> is unexpected."),
+                header.sec_name, cs_io_get_name(w_pp_in));
+  }
+
+  if (w_pp_in != nullptr)
+    cs_io_finalize(&w_pp_in);
+
+  check_file = false;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*
  * Define a naive partitioning by blocks.
  *
@@ -3096,10 +3691,193 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write cell weights to file for use by subsequent calculations.
+ *
+ * Weights are written to the "partition_output/cell_weights" file,
+ * based on global cell numbers, so they may be used to partition the
+ * same mesh on any number of ranks. When copied or linked to
+ * "partition_input", they are used by \ref cs_partition.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  mesh         pointer to mesh structure
+ * \param[in]  n_weights    number of weights (balance constraints) per cell
+ * \param[in]  cell_weight  weights for each cell (interleaved)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_write_cell_weights(const cs_mesh_t  *mesh,
+                                int               n_weights,
+                                const cs_real_t   cell_weight[])
+{
+  cs_file_access_t method;
+  cs_io_t *fh = nullptr;
+  cs_datatype_t datatype_gnum = CS_DATATYPE_NULL;
+  cs_datatype_t datatype_int = CS_DATATYPE_NULL;
+
+  const char dir[] = "partition_output";
+  const char magic_string[] = "Cell weights, R0";
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_gnum_t n_g_cells = mesh->n_g_cells;
+
+  if (sizeof(int) == 4)
+    datatype_int = CS_INT32;
+  else if (sizeof(int) == 8)
+    datatype_int = CS_INT64;
+  else {
+    assert(0);
+  }
+
+  if (sizeof(cs_gnum_t) == 4)
+    datatype_gnum = CS_UINT32;
+  else if (sizeof(cs_gnum_t) == 8)
+    datatype_gnum = CS_UINT64;
+  else {
+    assert(0);
+  }
+
+  /* Distribute weights by blocks of global cell numbers */
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        n_g_cells);
+
+  cs_lnum_t n_b_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+  cs_real_t *b_weight;
+  BFT_MALLOC(b_weight, n_b_cells*n_weights, cs_real_t);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        bi,
+                                        n_cells,
+                                        mesh->global_cell_num);
+    cs_part_to_block_copy_array(d,
+                                CS_REAL_TYPE,
+                                n_weights,
+                                cell_weight,
+                                b_weight);
+    cs_part_to_block_destroy(&d);
+  }
+#endif
+
+  if (cs_glob_n_ranks == 1) {
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      cs_lnum_t j = (mesh->global_cell_num != nullptr) ?
+        mesh->global_cell_num[i] - 1 : i;
+      for (int k = 0; k < n_weights; k++)
+        b_weight[j*n_weights + k] = cell_weight[i*n_weights + k];
+    }
+  }
+
+  /* Create directory if required */
+
+  if (cs_glob_rank_id < 1) {
+    if (cs_file_isdir(dir) != 1) {
+      if (cs_file_mkdir_default(dir) != 0)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("The partitioning directory cannot be created"));
+    }
+  }
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  /* Open file */
+
+  char filename[64];
+  snprintf(filename, 64, "%s%ccell_weights", dir, _dir_separator);
+  filename[63] = '\0';
+
+#if defined(HAVE_MPI)
+  {
+    MPI_Info  hints;
+    MPI_Comm  block_comm, comm;
+    cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+    cs_file_get_default_comm(nullptr, &block_comm, &comm);
+    assert(comm == cs_glob_mpi_comm || comm == MPI_COMM_NULL);
+    fh = cs_io_initialize(filename,
+                          magic_string,
+                          CS_IO_MODE_WRITE,
+                          method,
+                          CS_IO_ECHO_OPEN_CLOSE,
+                          hints,
+                          block_comm,
+                          comm);
+  }
+#else
+  {
+    cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+    fh = cs_io_initialize(filename,
+                          magic_string,
+                          CS_IO_MODE_WRITE,
+                          method,
+                          CS_IO_ECHO_OPEN_CLOSE);
+  }
+#endif
+
+  /* Write headers and data */
+
+  cs_io_write_global("n_cells",
+                     1,
+                     1,
+                     0,
+                     1,
+                     datatype_gnum,
+                     &n_g_cells,
+                     fh);
+
+  cs_io_write_global("n_weights",
+                     1,
+                     1,
+                     0,
+                     1,
+                     datatype_int,
+                     &n_weights,
+                     fh);
+
+  cs_io_write_block_buffer("cell:weights",
+                           n_g_cells,
+                           bi.gnum_range[0],
+                           bi.gnum_range[1],
+                           1,
+                           0,
+                           n_weights,
+                           CS_REAL_TYPE,
+                           b_weight,
+                           fh);
+
+  cs_io_finalize(&fh);
+
+  BFT_FREE(b_weight);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
  *
+ * If cell weights are defined in the mesh builder, the partitioning
+ * based on space-filling curves or graph partitioning libraries balances
+ * the sum of cell weights rather than the number of cells, and any
+ * partitioning available from file is ignored.
+ *
+ * For the main partitioning stage, if no weights are defined but a
+ * "partition_input/cell_weights" file is present (see
+ * \ref cs_partition_write_cell_weights), weights are read from that file.
+ * With multiple weights per cell, ParMETIS and METIS use a multi-constraint
+ * partitioning, while other algorithms balance a combination of the
+ * normalized weights. The resulting partitioning is written to file
+ * unless the write level is 0.
+ *
  * \param[in]       mesh   pointer to mesh structure
  * \param[in, out]  mb     pointer to mesh builder structure
  * \param[in]       stage  associated partitioning stage
@@ -3155,10 +3933,21 @@ cs_partition(cs_mesh_t             *mesh,
   if (mb->cell_rank != nullptr)
     BFT_FREE(mb->cell_rank);
 
+  /* Read measured cell weights if available */
+
+  if (   stage == CS_PARTITION_MAIN && mb->cell_weight == nullptr
+      && (cs_glob_n_ranks > 1 || n_extra_partitions > 0))
+    _read_cell_weights(mesh, mb, CS_IO_ECHO_OPEN_CLOSE);
+
+  if (   stage == CS_PARTITION_MAIN && mb->cell_weight != nullptr
+      && _part_write_output > 0)
+    write_output = true;
+
   /* Read cell rank data if available */
 
   if (cs_glob_n_ranks > 1) {
-    _read_cell_rank(mesh, mb, stage, CS_IO_ECHO_OPEN_CLOSE);
+    if (mb->cell_weight == nullptr) /* weights imply a new partitioning */
+      _read_cell_rank(mesh, mb, stage, CS_IO_ECHO_OPEN_CLOSE);
     if (mb->have_cell_rank) {
       cs_partition_set_preprocess(false);
       return;
@@ -3214,6 +4003,8 @@ cs_partition(cs_mesh_t             *mesh,
     int  i;
     cs_timer_t  t2;
     idx_t  *cell_idx = nullptr, *cell_neighbors = nullptr;
+    idx_t  *cell_wgt = nullptr;
+    int     n_con = mb->n_cell_weights;
 
     _metis_cell_cells(n_cells,
                       n_faces,
@@ -3222,6 +4013,21 @@ cs_partition(cs_mesh_t             *mesh,
                       &cell_idx,
                       &cell_neighbors);
 
+    {
+      const double max_sum = (double)((size_t)1 << (sizeof(idx_t)*8 - 2));
+      cs_real_t *_cell_wgt = _graph_cell_weights(mesh,
+                                                 mb,
+                                                 _part_rank_step[stage],
+                                                 max_sum,
+                                                 n_con);
+      if (_cell_wgt != nullptr) {
+        BFT_MALLOC(cell_wgt, n_cells*n_con, idx_t);
+        for (cs_lnum_t j = 0; j < n_cells*n_con; j++)
+          cell_wgt[j] = _cell_wgt[j];
+        BFT_FREE(_cell_wgt);
+      }
+    }
+
     if (face_cells != mb->face_cells)
       BFT_FREE(face_cells);
 
@@ -3264,6 +4070,8 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         n_con,
+                         cell_wgt,
                          cell_part,
                          part_comm);
 
@@ -3311,6 +4119,8 @@ cs_partition(cs_mesh_t             *mesh,
                       n_ranks,
                       cell_idx,
                       cell_neighbors,
+                      n_con,
+                      cell_wgt,
                       cell_part);
 
         _distribute_output(mb,
@@ -3330,6 +4140,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
+    BFT_FREE(cell_wgt);
   }
 
 #endif /* defined(HAVE_METIS) || defined(HAVE_PARMETIS) */
@@ -3341,6 +4152,7 @@ cs_partition(cs_mesh_t             *mesh,
     int  i;
     cs_timer_t  t2;
     SCOTCH_Num  *cell_idx = nullptr, *cell_neighbors = nullptr;
+    SCOTCH_Num  *cell_wgt = nullptr;
 
     _scotch_cell_cells(n_cells,
                        n_faces,
@@ -3349,6 +4161,22 @@ cs_partition(cs_mesh_t             *mesh,
                        &cell_idx,
                        &cell_neighbors);
 
+    {
+      const double max_sum
+        = (double)((size_t)1 << (sizeof(SCOTCH_Num)*8 - 2));
+      cs_real_t *_cell_wgt = _graph_cell_weights(mesh,
+                                                 mb,
+                                                 _part_rank_step[stage],
+                                                 max_sum,
+                                                 1); /* single constraint */
+      if (_cell_wgt != nullptr) {
+        BFT_MALLOC(cell_wgt, n_cells, SCOTCH_Num);
+        for (cs_lnum_t j = 0; j < n_cells; j++)
+          cell_wgt[j] = _cell_wgt[j];
+        BFT_FREE(_cell_wgt);
+      }
+    }
+
     if (face_cells != mb->face_cells)
       BFT_FREE(face_cells);
 
@@ -3391,6 +4219,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         cell_wgt,
                          cell_part,
                          part_comm);
 
@@ -3438,6 +4267,7 @@ cs_partition(cs_mesh_t             *mesh,
                        n_ranks,
                        cell_idx,
                        cell_neighbors,
+                       cell_wgt,
                        cell_part);
 
         _distribute_output(mb,
@@ -3457,6 +4287,7 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_FREE(cell_idx);
     BFT_FREE(cell_neighbors);
+    BFT_FREE(cell_wgt);
   }
 
 #endif /* defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH) */
@@ -228,6 +228,27 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Write cell weights to file for use by subsequent calculations.
+ *
+ * Weights are written to the "partition_output/cell_weights" file,
+ * based on global cell numbers, so they may be used to partition the
+ * same mesh on any number of ranks. When copied or linked to
+ * "partition_input", they are used by cs_partition.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   n_weights   <-- number of weights (balance constraints) per cell
+ *   cell_weight <-- weights for each cell (interleaved)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_write_cell_weights(const cs_mesh_t  *mesh,
+                                int               n_weights,
+                                const cs_real_t   cell_weight[]);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
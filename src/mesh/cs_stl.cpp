@@ -2205,11 +2205,34 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
   BFT_MALLOC(stl_normals      , stl->n_faces*3  , cs_real_t);
   BFT_MALLOC(mean_plane_def   , m->n_cells*6    , cs_real_t);
 
-  /* Input cells are all[] cells and initialisation */
+  /* Compute the bounding boxes of the main mesh */
+  cs_real_6_t *bbox = nullptr;
+  bbox = cs_mesh_quantities_cell_extents(m, 0.0);
+
+  /* Bounding box of the STL mesh */
+  cs_real_t stl_extents[6] = {HUGE_VAL, HUGE_VAL, HUGE_VAL,
+                              -HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+  for (cs_lnum_t i = 0; i < 3*stl->n_faces; i++) {
+    for (int k = 0; k < 3; k++) {
+      stl_extents[k] = CS_MIN(stl_extents[k], stl_mesh->coords[i][k]);
+      stl_extents[k+3] = CS_MAX(stl_extents[k+3], stl_mesh->coords[i][k]);
+    }
+  }
+
+  /* Input cells are the cells whose bounding box overlaps that of the
+   * STL mesh (others can not intersect any triangle) and initialisation */
+  n_input_cells = 0;
   for (cs_lnum_t i = 0; i < m->n_cells; i++) {
-    input_cells[i] = i;
     cell_selected_idx[i] = -1;
     porosity[i] = 0.0;
+
+    if (   bbox[i][0] <= stl_extents[3] && bbox[i][3] >= stl_extents[0]
+        && bbox[i][1] <= stl_extents[4] && bbox[i][4] >= stl_extents[1]
+        && bbox[i][2] <= stl_extents[5] && bbox[i][5] >= stl_extents[2]) {
+      input_cells[n_input_cells] = i;
+      n_input_cells++;
+    }
   }
 
   /* Compute normals */
@@ -2227,10 +2250,6 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
                       &tria_in_cell_lst,
                       &max_size);
 
-  /* Compute the bounding boxes of the main mesh */
-  cs_real_6_t *bbox = nullptr;
-  bbox = cs_mesh_quantities_cell_extents(m, 0.0);
-
   /* If a cell is overlaped by more than 1 triangle,
    * replace those triangles by a mean plane
    * ============================================== */
@@ -2484,30 +2503,53 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
   if (m->halo!=nullptr)
     cs_halo_sync_num(m->halo, CS_HALO_STANDARD, cell_tag);
 
-  /* Loop on internal faces "Algo glouton" */
+  /* Propagate the outside tag to adjacent inside cells. Each pass tags
+   * all local cells reachable from an outside cell (including ghost cells
+   * updated by the previous synchronization) using a queue, so that passes
+   * are only repeated when propagation crosses rank boundaries. */
 
-  bool new_cells_found = true;
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t *c2c_idx = ma->cell_cells_idx;
+  const cs_lnum_t *c2c = ma->cell_cells;
 
-  while (new_cells_found) {
+  assert(c2c_idx != nullptr);
 
-    cs_gnum_t cpt = 0;
-
-    for (cs_lnum_t face_id = 0; face_id < m->n_i_faces; face_id ++) {
+  cs_lnum_t *cell_queue = nullptr;
+  BFT_MALLOC(cell_queue, m->n_cells, cs_lnum_t);
 
-      cs_lnum_t ii = ifacel[face_id][0];
-      cs_lnum_t jj = ifacel[face_id][1];
+  bool new_cells_found = true;
 
-      int ti = cell_tag[ii];
-      int tj = cell_tag[jj];
+  while (new_cells_found) {
 
-      if (ti == 1 && tj == -1) {
-        cell_tag[ii] = -1;
-        cpt ++;
+    cs_gnum_t cpt = 0;
+    cs_lnum_t n_queue = 0;
+
+    /* Seed with inside cells adjacent to an outside cell */
+
+    for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id++) {
+      if (cell_tag[cell_id] != 1)
+        continue;
+      for (cs_lnum_t j = c2c_idx[cell_id]; j < c2c_idx[cell_id+1]; j++) {
+        if (cell_tag[c2c[j]] == -1) {
+          cell_tag[cell_id] = -1;
+          cell_queue[n_queue++] = cell_id;
+          cpt++;
+          break;
+        }
       }
+    }
+
+    /* Breadth-first propagation on local cells */
 
-      if (ti == -1 && tj == 1) {
-        cell_tag[jj] = -1;
-        cpt ++;
+    for (cs_lnum_t q = 0; q < n_queue; q++) {
+      cs_lnum_t cell_id = cell_queue[q];
+      for (cs_lnum_t j = c2c_idx[cell_id]; j < c2c_idx[cell_id+1]; j++) {
+        cs_lnum_t c_id_n = c2c[j];
+        if (c_id_n < m->n_cells && cell_tag[c_id_n] == 1) {
+          cell_tag[c_id_n] = -1;
+          cell_queue[n_queue++] = c_id_n;
+          cpt++;
+        }
       }
     }
 
@@ -2528,6 +2570,7 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
       porosity[cell_id] = 1.0;
   }
 
+  BFT_FREE(cell_queue);
   BFT_FREE(cell_tag);
   BFT_FREE(cell_selected_idx);
   BFT_FREE(mean_plane_def);
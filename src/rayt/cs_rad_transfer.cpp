@@ -54,6 +54,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
+#include "cs_rad_transfer_solve.h"
 #include "cs_sles.h"
 #include "cs_sles_it.h"
 #include "cs_timer.h"
@@ -322,6 +323,8 @@ cs_rad_transfer_finalize(void)
   BFT_FREE(_rt_params.vect_s);
   BFT_FREE(_rt_params.angsol);
   BFT_FREE(_rt_params.wq);
+
+  cs_rad_transfer_solve_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
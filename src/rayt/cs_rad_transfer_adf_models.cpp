@@ -141,6 +141,92 @@ _line_to_array(FILE      *radfile,
   *nvalues = index;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Locate the interval of a sorted table for linear interpolation,
+ *        with values clipped to the table bounds.
+ *
+ * \param[in]   x   tabulated values (sorted)
+ * \param[in]   n   number of tabulated values
+ * \param[in]   v   value to locate
+ * \param[out]  r   interpolation weight of upper bound, in [0, 1]
+ *
+ * \return  lower bound index, in [0, n-2]
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+_interval(const cs_real_t  x[],
+          int              n,
+          cs_real_t        v,
+          cs_real_t       *r)
+{
+  if (v <= x[0]) {
+    *r = 0.0;
+    return 0;
+  }
+  else if (v >= x[n - 1]) {
+    *r = 1.0;
+    return n - 2;
+  }
+
+  int i = 0;
+  int j = n - 1;
+  while (j - i > 1) {
+    int ip = (i + j) / 2;
+    if (v > x[ip])
+      i = ip;
+    else
+      j = ip;
+  }
+
+  *r = (v - x[i]) / (x[i + 1] - x[i]);
+
+  return i;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Bilinear interpolation of the grey gas values of a table
+ *        tabulated in (gas, x, temperature), with gas values contiguous.
+ *
+ * \param[in]   tab    tabulated values
+ * \param[in]   nwsgg  number of grey gases
+ * \param[in]   nx     number of tabulated x values
+ * \param[in]   ix     lower x index
+ * \param[in]   it     lower temperature index
+ * \param[in]   rx     x interpolation weight
+ * \param[in]   rt     temperature interpolation weight
+ * \param[in]   stride output stride
+ * \param[out]  v      interpolated values for each grey gas
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_interp_xt(const cs_real_t  tab[],
+           int              nwsgg,
+           int              nx,
+           int              ix,
+           int              it,
+           cs_real_t        rx,
+           cs_real_t        rt,
+           cs_lnum_t        stride,
+           cs_real_t        v[])
+{
+  const cs_real_t *t00 = tab + ix*nwsgg + it*nx*nwsgg;
+  const cs_real_t *t10 = t00 + nwsgg;
+  const cs_real_t *t01 = t00 + nx*nwsgg;
+  const cs_real_t *t11 = t01 + nwsgg;
+
+  const cs_real_t w00 = (1.0 - rt) * (1.0 - rx);
+  const cs_real_t w10 = (1.0 - rt) * rx;
+  const cs_real_t w01 = rt * (1.0 - rx);
+  const cs_real_t w11 = rt * rx;
+
+  for (int i = 0; i < nwsgg; i++)
+    v[i*stride] = w00*t00[i] + w10*t10[i] + w01*t01[i] + w11*t11[i];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Determine the radiation coefficients of the ADF 08 model
@@ -169,13 +255,12 @@ cs_rad_transfer_adf08(const cs_real_t  pco2[],
   int nwsgg = cs_glob_rad_transfer_params->nwsgg;
   cs_real_t  tkelvi = 273.15;
 
-  cs_real_t  tref, xh2oref, rt, rx;
+  cs_real_t  tref, xh2oref;
 
   /* Memory allocation and initialization */
 
-  cs_real_t *y, *tpaadf;
+  cs_real_t *tpaadf;
   cs_field_t *f_b_temp = cs_field_by_name_try("boundary_temperature");
-  BFT_MALLOC(y, cs_glob_mesh->n_cells_with_ghosts, cs_real_t);
 
   if (cs_glob_thermal_model->temperature_scale == CS_TEMPERATURE_SCALE_CELSIUS) {
 
@@ -281,128 +366,42 @@ cs_rad_transfer_adf08(const cs_real_t  pco2[],
     }
   }
 
-  int it, ix, l;
-  for (cs_lnum_t iel = 0; iel < ncells; iel++) {
-    if (pco2[iel] > 0.0)
-      y[iel] = ph2o[iel] / pco2[iel];
-    else
-      y[iel] = ysto[nysto - 1];
+  const cs_real_t p_fac = 100.0 * (cs_glob_fluid_properties->p0 / 100000.0);
 
-    /* Interpolation temperature */
-    if (teloc[iel] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (teloc[iel] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (teloc[iel] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (teloc[iel] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+  /* Interpolation in temperature and ph2o/pco2 ratio */
 
-    /* Interpolation H2O-molefraction */
-    if (y[iel] <= ysto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (y[iel] >= ysto[nysto - 1]) {
-      rx = 1.0;
-      ix = nysto - 2;
-    }
-    else {
-      l = 0;
-      while (y[iel] > ysto[l])
-        l++;
-      ix = l - 1;
-      rx = (y[iel] - ysto[ix]) / (ysto[ix + 1] - ysto[ix]);
-    }
+# pragma omp parallel for if (ncells > CS_THR_MIN)
+  for (cs_lnum_t iel = 0; iel < ncells; iel++) {
+    cs_real_t y = (pco2[iel] > 0.0) ? ph2o[iel] / pco2[iel] : ysto[nysto - 1];
 
-    /* Absortion Coefficient */
+    cs_real_t rt, rx;
+    int it = _interval(tsto, ntsto, teloc[iel], &rt);
+    int ix = _interval(ysto, nysto, y, &rx);
 
-    for (int i = 0; i < nwsgg; i++) {
-      cs_real_t kmloc =    (1.0 - rt) * (1.0 - rx)
-                         * ksto2[i + ix * nwsgg + it * nysto * nwsgg]
-                       +   (1.0 - rt) * (rx)
-                         * ksto2[i + (ix + 1) * nwsgg + it * nysto * nwsgg]
-                       +   rt * (1.0 - rx)
-                         * ksto2[i + ix * nysto + (it + 1) * nysto * nwsgg]
-                       + rt * rx
-                         * ksto2[i + (ix + 1) * nwsgg + (it + 1) * nysto * nwsgg];
-
-      kloc[iel + i * ncells] =  pco2[iel] * kmloc * 100.0
-                              * (cs_glob_fluid_properties->p0 / 100000.0);
-
-      /* Local radiation coefficient of the i-th grey gas    */
-      aloc[iel + i * ncells]
-        =   (1.0 - rt) * (1.0 - rx) * asto[i + ix * nwsgg + it * nysto * nwsgg]
-          + (1.0 - rt) * (rx) * asto[i + (ix + 1) * nwsgg + it * nysto * nwsgg]
-          + rt * (1.0 - rx) * asto[i + ix * nysto + (it + 1) * nysto * nwsgg]
-          + rt * rx * asto[i + (ix + 1) * nwsgg + (it + 1) * nysto * nwsgg];
-      /* Local weight of the i-th grey gas   */
-    }
+    /* Absortion Coefficient */
+    _interp_xt(ksto2, nwsgg, nysto, ix, it, rx, rt, ncells, kloc + iel);
+    for (int i = 0; i < nwsgg; i++)
+      kloc[iel + i * ncells] *= pco2[iel] * p_fac;
 
+    /* Local weight of the i-th grey gas   */
+    _interp_xt(asto, nwsgg, nysto, ix, it, rx, rt, ncells, aloc + iel);
   }
 
+# pragma omp parallel for if (nfabor > CS_THR_MIN)
   for (cs_lnum_t ifac = 0; ifac < nfabor; ifac++) {
     cs_lnum_t iel = cs_glob_mesh->b_face_cells[ifac];
-    if (pco2[iel] > 0.0)
-      y[iel] = ph2o[iel] / pco2[iel];
-    else
-      y[iel] = ysto[nysto - 1];
+    cs_real_t y = (pco2[iel] > 0.0) ? ph2o[iel] / pco2[iel] : ysto[nysto - 1];
 
-    /* Interpolation temperature */
-    if (tpaadf[ifac] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (tpaadf[ifac] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (tpaadf[ifac] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (tpaadf[ifac] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
-
-    /* Interpolation H2O-molefraction */
-    if (y[iel] <= ysto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (y[iel] >= ysto[nysto - 1]) {
-      rx = 1.0;
-      ix = nysto - 2;
-    }
-    else {
-      l = 0;
-      while (y[iel] > ysto[l])
-        l++;
-      ix = l - 1;
-      rx = (y[iel] - ysto[ix]) / (ysto[ix + 1] - ysto[ix]);
-    }
-
-    /* Absortion Coefficient     */
-
-    for (int i = 0; i < nwsgg; i++)
-      alocb[ifac + i * nfabor]
-        =   (1.0 - rt) * (1.0 - rx) * asto[i + ix * nwsgg + it * nysto * nwsgg]
-          + (1.0 - rt) * rx * asto[i + (ix + 1) * nwsgg + it * nysto * nwsgg]
-          + rt * (1.0 - rx) * asto[i + ix * nwsgg + (it + 1) * nysto * nwsgg]
-          + rt * rx * asto[i + (ix + 1) * nwsgg + (it + 1) * nysto * nwsgg];
+    cs_real_t rt, rx;
+    int it = _interval(tsto, ntsto, tpaadf[ifac], &rt);
+    int ix = _interval(ysto, nysto, y, &rx);
 
     /* Local weight of the i-th grey gas   */
-
+    _interp_xt(asto, nwsgg, nysto, ix, it, rx, rt, nfabor, alocb + ifac);
   }
 
-  BFT_FREE(tpaadf);
+  if (tpaadf != f_b_temp->val)
+    BFT_FREE(tpaadf);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -439,7 +438,7 @@ cs_rad_transfer_adf50(const cs_real_t  pco2[],
   int nwsgg = cs_glob_rad_transfer_params->nwsgg;
   cs_real_t  tkelvi = 273.15;
 
-  cs_real_t  tref, xh2oref, rt, rx;
+  cs_real_t  tref, xh2oref;
 
   /* Memory allocation and initialization */
 
@@ -555,127 +554,45 @@ cs_rad_transfer_adf50(const cs_real_t  pco2[],
     }
   }
 
-  int it, ix, l;
-  for (cs_lnum_t iel = 0; iel < ncells; iel++) {
+  const cs_real_t p_fac = 100.0 * (cs_glob_fluid_properties->p0 / 100000.0);
 
-    /* Interpolation temperature */
-    if (teloc[iel] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (teloc[iel] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (teloc[iel] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (teloc[iel] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+  /* Interpolation in temperature and H2O volume fraction */
 
-    /* Interpolation H2O-molefraction */
-    if (ph2o[iel] <= xh2osto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (ph2o[iel] >= xh2osto[nxh2osto - 1]) {
-      rx = 1.0;
-      ix = nxh2osto - 2;
-    }
-    else {
-      l = 0;
-      while (ph2o[iel] > xh2osto[l])
-        l++;
-      ix = l - 1;
-      rx = (ph2o[iel] - xh2osto[ix]) / (xh2osto[ix + 1] - xh2osto[ix]);
-    }
+# pragma omp parallel for if (ncells > CS_THR_MIN)
+  for (cs_lnum_t iel = 0; iel < ncells; iel++) {
+    cs_real_t rt, rx;
+    int it = _interval(tsto, ntsto, teloc[iel], &rt);
+    int ix = _interval(xh2osto, nxh2osto, ph2o[iel], &rx);
 
     /* Absortion Coefficient */
+    _interp_xt(ksto2, nwsgg, nxh2osto, ix, it, rx, rt, ncells, kloc + iel);
     for (int i = 0; i < nwsgg; i++) {
       cs_real_t kco2loc =  ksto1[i + it * nwsgg]
                          + rt * (  ksto1[i + (it+1) * nwsgg]
                                  - ksto1[i + it * nwsgg]);
-      cs_real_t kh2oloc =   (1.0 - rt) * (1.0 - rx)
-                          * ksto2[i + ix * nwsgg + it * nxh2osto * nwsgg]
-                         +  (1.0 - rt) * (rx)
-                          * ksto2[i + (ix + 1) * nwsgg + it * nxh2osto * nwsgg]
-                         +  rt * (1.0 - rx)
-                          * ksto2[i + ix * nxh2osto + (it + 1) * nxh2osto * nwsgg]
-                         +  rt * rx
-                          * ksto2[i + (ix + 1) * nwsgg + (it + 1) * nxh2osto * nwsgg];
-
-      kloc[iel + i * ncells] =  (pco2[iel] * kco2loc + ph2o[iel] * kh2oloc) * 100.0
-                              * (cs_glob_fluid_properties->p0 / 100000.0);
-
-      /* Local radiation coefficient of the i-th grey gas */
-      aloc[iel + i * ncells] =   (1.0 - rt) * (1.0 - rx)
-                               * asto[i + ix * nwsgg + it * nxh2osto * nwsgg]
-                              +  (1.0 - rt) * (rx)
-                               * asto[i + (ix + 1) * nwsgg + it * nxh2osto * nwsgg]
-                              +  rt * (1.0 - rx)
-                               * asto[i + ix * nxh2osto + (it + 1) * nxh2osto * nwsgg]
-                              +  rt * rx
-                               * asto[i + (ix + 1) * nwsgg + (it + 1) * nxh2osto * nwsgg];
-                              /* Local weight of the i-th grey gas */
+      cs_real_t kh2oloc = kloc[iel + i * ncells];
+      kloc[iel + i * ncells]
+        = (pco2[iel] * kco2loc + ph2o[iel] * kh2oloc) * p_fac;
     }
 
+    /* Local weight of the i-th grey gas */
+    _interp_xt(asto, nwsgg, nxh2osto, ix, it, rx, rt, ncells, aloc + iel);
   }
 
+# pragma omp parallel for if (nfabor > CS_THR_MIN)
   for (cs_lnum_t ifac = 0; ifac < nfabor; ifac++) {
     cs_lnum_t iel = cs_glob_mesh->b_face_cells[ifac];
 
-    /* Interpolation temperature */
-    if (tpaadf[ifac] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (tpaadf[ifac] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (tpaadf[ifac] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (tpaadf[ifac] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
-
-    /* Interpolation H2O-molefraction */
-    if (ph2o[iel] <= xh2osto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (ph2o[iel] >= xh2osto[nxh2osto - 1]) {
-      rx = 1.0;
-      ix = nxh2osto - 2;
-    }
-    else {
-      l = 0;
-      while (ph2o[iel] > xh2osto[l])
-        l++;
-      ix = l - 1;
-      rx = (ph2o[iel] - xh2osto[ix]) / (xh2osto[ix + 1] - xh2osto[ix]);
-    }
-
-    /* Absortion Coefficient     */
-
-    for (int i = 0; i < nwsgg; i++)
-      alocb[ifac + i * nfabor] =   (1.0 - rt) * (1.0 - rx)
-                                  * asto[i + ix * nwsgg + it * nxh2osto * nwsgg]
-                                 +  (1.0 - rt) * rx
-                                  * asto[i + (ix + 1) * nwsgg + it * nxh2osto * nwsgg]
-                                 +  rt * (1.0 - rx)
-                                  * asto[i + ix * nwsgg + (it + 1) * nxh2osto * nwsgg]
-                                 +  rt * rx
-                                  * asto[i + (ix + 1) * nwsgg + (it + 1) * nxh2osto * nwsgg];
-                                 /* Local weight of the i-th grey gas   */
+    cs_real_t rt, rx;
+    int it = _interval(tsto, ntsto, tpaadf[ifac], &rt);
+    int ix = _interval(xh2osto, nxh2osto, ph2o[iel], &rx);
 
+    /* Local weight of the i-th grey gas   */
+    _interp_xt(asto, nwsgg, nxh2osto, ix, it, rx, rt, nfabor, alocb + ifac);
   }
 
-  BFT_FREE(tpaadf);
+  if (tpaadf != f_b_temp->val)
+    BFT_FREE(tpaadf);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -901,6 +901,200 @@ _interpolation4d(cs_real_t trad,
   BFT_FREE(kg_x2);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Locate the interval of a sorted table for linear interpolation.
+ *
+ * \param[in]   x   tabulated values (sorted)
+ * \param[in]   n   number of tabulated values
+ * \param[in]   v   value to locate
+ * \param[out]  w   interpolation weight of upper bound (not clipped)
+ *
+ * \return  lower bound index, in [0, n-2]
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+_lin_interval(const cs_real_t  x[],
+              int              n,
+              cs_real_t        v,
+              cs_real_t       *w)
+{
+  int i = 0;
+  int j = n - 1;
+  while (j - i > 1) {
+    int ip = (i + j) / 2;
+    if (v < x[ip])
+      j = ip;
+    else
+      i = ip;
+  }
+
+  *w = (v - x[i]) / (x[i+1] - x[i]);
+
+  return i;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the k-distribution table at a given Planck temperature.
+ *
+ * The database is linearly interpolated along the Planck temperature,
+ * and the result is stored with the quadrature points contiguous,
+ * kt[((ico2*nconc + ih2o)*nt + it)*ng + ig].
+ *
+ * \param[in]   trad  Planck temperature
+ * \param[out]  kt    k-distribution table (size nconc*nconc*nt*ng)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fsck_table_trad(cs_real_t  trad,
+                 cs_real_t  kt[])
+{
+  cs_real_t wt;
+  const int itrad = _lin_interval(tt, nt, trad, &wt);
+
+  const cs_lnum_t s_trad = nconc*nconc*nt;
+  const cs_lnum_t s_g = nconc*nconc*nt*nt;
+
+  for (int ico2 = 0; ico2 < nconc; ico2++) {
+    for (int ih2o = 0; ih2o < nconc; ih2o++) {
+      for (int it = 0; it < nt; it++) {
+        const cs_real_t *k0 = kmfs + ih2o + ico2*nconc + it*nconc*nconc
+                                   + itrad*s_trad;
+        cs_real_t *_kt = kt + ((ico2*nconc + ih2o)*nt + it)*ng;
+        for (int ig = 0; ig < ng; ig++)
+          _kt[ig] =          wt  * k0[ig*s_g + s_trad]
+                    + (1.0 - wt) * k0[ig*s_g];
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the k-distribution table at a given state for all
+ *        tabulated Planck temperatures.
+ *
+ * The result is stored as kr[itrad*ng + ig].
+ *
+ * \param[in]   t     gas temperature
+ * \param[in]   xco2  CO2 volume fraction
+ * \param[in]   xh2o  H2O volume fraction
+ * \param[out]  kr    k-distribution table (size nt*ng)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_fsck_table_state(cs_real_t  t,
+                  cs_real_t  xco2,
+                  cs_real_t  xh2o,
+                  cs_real_t  kr[])
+{
+  cs_real_t wt, wc, wh;
+  const int it = _lin_interval(tt, nt, t, &wt);
+  const int ico2 = _lin_interval(x_kg, nconc, xco2, &wc);
+  const int ih2o = _lin_interval(x_kg, nconc, xh2o, &wh);
+
+  const cs_real_t w[8] = {(1.-wc)*(1.-wh)*(1.-wt), (1.-wc)*(1.-wh)*wt,
+                          (1.-wc)*wh*(1.-wt),      (1.-wc)*wh*wt,
+                          wc*(1.-wh)*(1.-wt),      wc*(1.-wh)*wt,
+                          wc*wh*(1.-wt),           wc*wh*wt};
+
+  const cs_lnum_t s_g = nconc*nconc*nt*nt;
+
+  for (int itrad = 0; itrad < nt; itrad++) {
+    cs_lnum_t k_id[8];
+    for (int c = 0; c < 2; c++) {
+      for (int h = 0; h < 2; h++) {
+        for (int l = 0; l < 2; l++)
+          k_id[c*4 + h*2 + l] =   (ih2o + h) + (ico2 + c)*nconc
+                                + (it + l)*nconc*nconc
+                                + itrad*nconc*nconc*nt;
+      }
+    }
+    cs_real_t *_kr = kr + itrad*ng;
+    for (int ig = 0; ig < ng; ig++) {
+      const cs_real_t *k0 = kmfs + ig*s_g;
+      cs_real_t k = 0.;
+      for (int c = 0; c < 8; c++)
+        k += w[c] * k0[k_id[c]];
+      _kr[ig] = k;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate the k-distribution at a given local state
+ *        from a table built by \ref _fsck_table_trad.
+ *
+ * \param[in]   kt    k-distribution table
+ * \param[in]   t     gas temperature
+ * \param[in]   xco2  CO2 volume fraction
+ * \param[in]   xh2o  H2O volume fraction
+ * \param[out]  kdb   k-distribution (size ng)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_fsck_interp_state(const cs_real_t  kt[],
+                   cs_real_t        t,
+                   cs_real_t        xco2,
+                   cs_real_t        xh2o,
+                   cs_real_t        kdb[])
+{
+  cs_real_t wt, wc, wh;
+  const int it = _lin_interval(tt, nt, t, &wt);
+  const int ico2 = _lin_interval(x_kg, nconc, xco2, &wc);
+  const int ih2o = _lin_interval(x_kg, nconc, xh2o, &wh);
+
+  const cs_real_t w[8] = {(1.-wc)*(1.-wh)*(1.-wt), (1.-wc)*(1.-wh)*wt,
+                          (1.-wc)*wh*(1.-wt),      (1.-wc)*wh*wt,
+                          wc*(1.-wh)*(1.-wt),      wc*(1.-wh)*wt,
+                          wc*wh*(1.-wt),           wc*wh*wt};
+
+  const cs_real_t *k[8];
+  for (int c = 0; c < 2; c++) {
+    for (int h = 0; h < 2; h++) {
+      for (int l = 0; l < 2; l++)
+        k[c*4 + h*2 + l] = kt + (((ico2+c)*nconc + ih2o+h)*nt + it+l)*ng;
+    }
+  }
+
+  for (int ig = 0; ig < ng; ig++)
+    kdb[ig] =   w[0]*k[0][ig] + w[1]*k[1][ig] + w[2]*k[2][ig]
+              + w[3]*k[3][ig] + w[4]*k[4][ig] + w[5]*k[5][ig]
+              + w[6]*k[6][ig] + w[7]*k[7][ig];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Interpolate the k-distribution at a given Planck temperature
+ *        from a table built by \ref _fsck_table_state.
+ *
+ * \param[in]   kr    k-distribution table
+ * \param[in]   trad  Planck temperature
+ * \param[out]  kdb   k-distribution (size ng)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_fsck_interp_trad(const cs_real_t  kr[],
+                  cs_real_t        trad,
+                  cs_real_t        kdb[])
+{
+  cs_real_t wt;
+  const int itrad = _lin_interval(tt, nt, trad, &wt);
+
+  const cs_real_t *k0 = kr + itrad*ng;
+  const cs_real_t *k1 = k0 + ng;
+
+  for (int ig = 0; ig < ng; ig++)
+    kdb[ig] = wt * k1[ig] + (1.0 - wt) * k0[ig];
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -931,20 +1125,10 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
 {
   /* Initialization */
 
-  cs_real_t   *gfskref, *kfskref, *kfsk, *gfsk, *gg1;
-  cs_real_t   *kg1, *as, *ag, *aw, *kloctmp;
+  cs_real_t   *gfskref, *kfskref;
 
   BFT_MALLOC(gfskref, ng, cs_real_t);
   BFT_MALLOC(kfskref, ng, cs_real_t);
-  BFT_MALLOC(gfsk, ng, cs_real_t);
-  BFT_MALLOC(kfsk, ng, cs_real_t);
-  BFT_MALLOC(gg1, ng, cs_real_t);
-  BFT_MALLOC(kg1, ng, cs_real_t);
-  BFT_MALLOC(as, ng, cs_real_t);
-
-  BFT_MALLOC(ag, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
-  BFT_MALLOC(aw, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
-  BFT_MALLOC(kloctmp, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
 
   cs_field_t *f_bound_t = cs_field_by_name_try("boundary_temperature");
   cs_real_t *tpfsck = f_bound_t->val;
@@ -1161,17 +1345,22 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
 
   /* Compute the reference state */
 
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const int nwsgg = cs_glob_rad_transfer_params->nwsgg;
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
   cs_real_t pco2ref = 0.0;
   cs_real_t ph2oref = 0.0;
   cs_real_t tref   = 0.0;
   cs_real_t sum1   = 0.0;
   cs_real_t sum2   = 0.0;
 
-  for (cs_lnum_t iel = 0; iel < cs_glob_mesh->n_cells; iel++) {
+  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
 
     /* Calculation of pco2ref and ph2oref */
-    pco2ref += pco2[iel] * cs_glob_mesh_quantities->cell_vol[iel];
-    ph2oref += ph2o[iel] * cs_glob_mesh_quantities->cell_vol[iel];
+    pco2ref += pco2[iel] * cell_vol[iel];
+    ph2oref += ph2o[iel] * cell_vol[iel];
 
     /* Calculation of tref */
     /* Interplolation of Planck coefficient for mix */
@@ -1181,19 +1370,15 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     else if (teloc[iel] >= tt[nt - 1])
       kp = pco2[iel] * kpco2[nt - 1] + ph2o[iel] * kpco2[nt - 1];
     else {
-      kp = 0.;
-      for (int it = 0; it < nt - 1; it++) {
-        if ((teloc[iel] >= tt[it]) && (teloc[iel] < tt[it + 1])) {
-          cs_real_t kp1 = pco2[iel] * kpco2[it] + ph2o[iel] * kph2o[it];
-          cs_real_t kp2 = pco2[iel] * kpco2[it + 1] + ph2o[iel] * kph2o[it + 1];
-          kp = (kp2 - kp1) / (tt[it + 1] - tt[it]) * (teloc[iel] - tt[it]) + kp1;
-          break;
-        }
-      }
+      cs_real_t wt;
+      int it = _lin_interval(tt, nt, teloc[iel], &wt);
+      cs_real_t kp1 = pco2[iel] * kpco2[it] + ph2o[iel] * kph2o[it];
+      cs_real_t kp2 = pco2[iel] * kpco2[it + 1] + ph2o[iel] * kph2o[it + 1];
+      kp = (kp2 - kp1) * wt + kp1;
     }
     cs_real_t kpt4dv =  kp
                       * pow(teloc[iel], 4.0)
-                      * cs_glob_mesh_quantities->cell_vol[iel];
+                      * cell_vol[iel];
     sum1 += kpt4dv * teloc[iel];
     sum2 += kpt4dv;
   }
@@ -1225,100 +1410,87 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
   for (int i = 0; i < ng; i++)
     kfskref[i] *= 100.0;
 
-  for (cs_lnum_t iel = 0; iel < cs_glob_mesh->n_cells; iel++) {
+  /* Since the interpolation is multilinear, the database is first reduced
+     to the reference Planck temperature (for local absorption coefficients)
+     and to the reference state (for local weights), so that only
+     a trilinear (resp. linear) interpolation remains per cell or face. */
+
+  cs_real_t *kt_tref, *kr_ref;
+  BFT_MALLOC(kt_tref, nconc*nconc*nt*ng, cs_real_t);
+  BFT_MALLOC(kr_ref, nt*ng, cs_real_t);
+
+  _fsck_table_trad(tref, kt_tref);
+  _fsck_table_state(tref, pco2ref, ph2oref, kr_ref);
+
+  /* [m^-1] */
+  for (cs_lnum_t i = 0; i < nconc*nconc*nt*ng; i++)
+    kt_tref[i] *= 100.0;
+  for (cs_lnum_t i = 0; i < nt*ng; i++)
+    kr_ref[i] *= 100.0;
+
+  /* Note: _simple_interpg may write one value past the queried points,
+     so local work arrays are sized accordingly. */
+
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
+    cs_real_t _kfsk[ng+1], _gfsk[ng+1], _kg1[ng+1], _as[ng+1];
+
+    cs_real_t *_kloc, *_ag;
+    BFT_MALLOC(_kloc, nwsgg + 1, cs_real_t);
+    BFT_MALLOC(_ag, nwsgg + 1, cs_real_t);
+
+#   pragma omp for
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+
+      /* Determination of the local absorbtion coefficient */
+      _fsck_interp_state(kt_tref, teloc[iel], pco2[iel], ph2o[iel], _kfsk);
+
+      _simple_interpg(ng, gi, _kfsk, nwsgg, gq, _kloc);
+      for (int i = 0; i < nwsgg; i++)
+        kloc[i * n_cells + iel] = _kloc[i];
+
+      /* Determination of the local weights */
+      _fsck_interp_trad(kr_ref, teloc[iel], _kg1);
+
+      for (int i = 0; i < ng; i++)
+        _gfsk[i] = 0.;
+      _simple_interpg(ng, _kg1, gi, ng, kfskref, _gfsk);
+      _as[0] = (_gfsk[1] - _gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
+      _as[ng-1] =   (_gfsk[ng-1] - _gfsk[ng - 2])
+                  / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
+      for (int k = 1; k < ng - 1; k++)
+        _as[k] =   (_gfsk[k + 1] - _gfsk[k - 1])
+                 / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
+      _simple_interpg(ng, gfskref, _as, nwsgg, gq, _ag);
+      for (int i = 0; i < nwsgg; i++)
+        aloc[i * n_cells + iel] = _ag[i];
 
-    /* Determination of the local absorbtion coefficient */
-    for (int i = 0; i < ng; i++) {
-      kfsk[i] = 0.;
-      gfsk[i] = 0.;
     }
-    _interpolation4d (tref,
-                      teloc[iel],
-                      pco2[iel],
-                      ph2o[iel],
-                      interp_method,
-                      gfsk,
-                      kfsk);
-    /* [m^-1] */
-    for (int i = 0; i < ng; i++)
-      kfsk[i] *= 100.0;
-
-    _simple_interpg(ng,
-                    gfsk,
-                    kfsk,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    kloctmp);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      kloc[i * cs_glob_mesh->n_cells + iel] = kloctmp[i];
-
-    /* Determination of the local weights */
-    for (int i = 0; i < ng; i++) {
-      kfsk[i] = 0.;
-      gfsk[i] = 0.;
+
+#   pragma omp for
+    for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
+      _fsck_interp_trad(kr_ref, tpfsck[ifac], _kg1);
+
+      for (int i = 0; i < ng; i++)
+        _gfsk[i] = 0.;
+      _simple_interpg(ng, _kg1, gi, ng, kfskref, _gfsk);
+      _as[0] = (_gfsk[1] - _gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
+      _as[ng-1] =   (_gfsk[ng-1] - _gfsk[ng - 2])
+                  / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
+      for (int k = 1; k < ng - 1; k++)
+        _as[k] =   (_gfsk[k + 1] - _gfsk[k - 1])
+                 / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
+      _simple_interpg(ng, gfskref, _as, nwsgg, gq, _ag);
+      for (int i = 0; i < nwsgg; i++)
+        alocb[i * n_b_faces + ifac] = _ag[i];
     }
-    _interpolation4d(teloc[iel],
-                     tref,
-                     pco2ref,
-                     ph2oref,
-                     interp_method,
-                     gg1,
-                     kg1);
-    /* [m^-1] */
-    for (int i = 0; i < ng; i++)
-      kg1[i] *= 100.0;
-
-    _simple_interpg(ng,
-                    kg1,
-                    gg1,
-                    ng,
-                    kfskref,
-                    gfsk);
-    as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
-    as[ng-1] = (gfsk[ng-1] - gfsk[ng - 2]) / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
-    for (int k = 1; k < ng - 1; k++)
-      as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
-    _simple_interpg(ng,
-                    gfskref,
-                    as,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    ag);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      aloc[i * cs_glob_mesh->n_cells + iel] = ag[i];
 
+    BFT_FREE(_kloc);
+    BFT_FREE(_ag);
   }
 
-  for (cs_lnum_t ifac = 0; ifac < cs_glob_mesh->n_b_faces; ifac++) {
-    _interpolation4d(tpfsck[ifac],
-                     tref,
-                     pco2ref,
-                     ph2oref,
-                     interp_method,
-                     gg1,
-                     kg1);
-    for (int i = 0; i < ng; i++)
-      kg1[i] *= 100.0;
-
-    _simple_interpg(ng,
-                    kg1,
-                    gg1,
-                    ng,
-                    kfskref,
-                    gfsk);
-    as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
-    as[ng] = (gfsk[ng] - gfsk[ng - 1]) / (gfskref[ng] - gfskref[ng - 1] + 1e-15);
-    for (int k = 1; k < ng - 1; k++)
-      as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
-    _simple_interpg(ng,
-                    gfskref,
-                    as,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    aw);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      alocb[i * cs_glob_mesh->n_b_faces + ifac] = aw[i];
-  }
+  BFT_FREE(kt_tref);
+  BFT_FREE(kr_ref);
 
   /* free memory */
   if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_max) {
@@ -1332,7 +1504,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     BFT_FREE(gq);
   }
 
-  BFT_FREE(kloctmp);
+  BFT_FREE(gfskref);
+  BFT_FREE(kfskref);
 }
 
 /*----------------------------------------------------------------------------*/
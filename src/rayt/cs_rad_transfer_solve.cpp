@@ -48,6 +48,7 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_array.h"
 #include "cs_atmo.h"
 #include "cs_blas.h"
 #include "cs_boundary_conditions.h"
@@ -57,11 +58,14 @@
 #include "cs_field_default.h"
 #include "cs_field_pointer.h"
 #include "cs_gui_util.h"
+#include "cs_halo.h"
 #include "cs_ht_convert.h"
 #include "cs_internal_coupling.h"
 #include "cs_log.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_parameters_check.h"
@@ -102,6 +106,28 @@ BEGIN_C_DECLS
 
 static int ipadom = 0;
 
+/* Number of DOM directions solved simultaneously by sweeps
+   (0 for one linear solve per direction) */
+static int _n_dirs_batch = 0;
+
+/* Cell sweep orders for all directions (for sweep mode) */
+static cs_lnum_t *_sweep_order = nullptr;
+
+/* Adaptive update: relative change tolerance (< 0 if inactive),
+   maximum number of time steps between solves, and time step
+   of last solve */
+static cs_real_t _adapt_rtol = -1;
+static int _adapt_nt_max = 0;
+static int _adapt_nt_last = -1;
+
+/* Adaptive update: state at last solve (gas phase temperature in Kelvin,
+   density, emission, explicit and implicit source terms) */
+static cs_real_t *_adapt_tempk = nullptr;
+static cs_real_t *_adapt_rho = nullptr;
+static cs_real_t *_adapt_emi = nullptr;
+static cs_real_t *_adapt_est = nullptr;
+static cs_real_t *_adapt_ist = nullptr;
+
 /*=============================================================================
  * Local Macro Definitions
  *============================================================================*/
@@ -218,6 +244,184 @@ _order_axis(const cs_real_t  s[],
 
 }
 
+/*----------------------------------------------------------------------------
+ * Build cell orders along each direction for the sweep solver.
+ *
+ * Cells are ordered by increasing abscissa along the direction,
+ * so that upstream cells are visited first.
+ *
+ * parameters:
+ *   n_dirs <-- total number of directions
+ *   dirs   <-- direction vectors
+ *----------------------------------------------------------------------------*/
+
+static void
+_sweep_orders(int                n_dirs,
+              const cs_real_3_t  dirs[])
+{
+  if (_sweep_order != nullptr)
+    return;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  BFT_MALLOC(_sweep_order, (size_t)n_dirs*n_cells, cs_lnum_t);
+
+# pragma omp parallel if (n_dirs > 1)
+  {
+    cs_real_t *s;
+    BFT_MALLOC(s, n_cells, cs_real_t);
+
+#   pragma omp for schedule(dynamic)
+    for (int d_id = 0; d_id < n_dirs; d_id++) {
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        s[c_id] = cs_math_3_dot_product(dirs[d_id], cell_cen[c_id]);
+
+      _order_axis(s, _sweep_order + (size_t)d_id*n_cells, n_cells);
+    }
+
+    BFT_FREE(s);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solve the radiance for several directions using ordered sweeps.
+ *
+ * This solves the same upwind discretization as the matching linear
+ * system (no reconstruction, no dispersion), using Gauss-Seidel sweeps
+ * in the downwind order of each direction. Directions are distributed
+ * over threads, and sweeps are repeated (with a halo update) until
+ * all directions are converged.
+ *
+ * parameters:
+ *   n_dirs    <-- number of directions in batch
+ *   dirs      <-- direction vectors
+ *   orders    <-- cell sweep orders for each direction
+ *   eqp       <-- radiance equation parameters
+ *   coefap    <-- radiance boundary condition coefficients (explicit part)
+ *   coefbp    <-- radiance boundary condition coefficients (implicit part)
+ *   rhs       <-- explicit source term
+ *   rovsdt    <-- implicit source term
+ *   l_dirs    --> radiance for each direction (n_cells_ext per direction)
+ *
+ * returns:
+ *   number of sweeps
+ *----------------------------------------------------------------------------*/
+
+static int
+_sweep_directions(int                         n_dirs,
+                  const cs_real_3_t           dirs[],
+                  const cs_lnum_t            *orders,
+                  const cs_equation_param_t  *eqp,
+                  const cs_real_t            *coefap,
+                  const cs_real_t            *coefbp,
+                  const cs_real_t             rhs[],
+                  const cs_real_t             rovsdt[],
+                  cs_real_t                   l_dirs[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const cs_lnum_t *c2c_idx = ma->cell_cells_idx;
+  const cs_lnum_t *c2c = ma->cell_cells;
+  const cs_lnum_t *cell_i_faces = ma->cell_i_faces;
+  const short int *cell_i_faces_sgn = ma->cell_i_faces_sgn;
+  const cs_lnum_t *cell_b_faces_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *cell_b_faces = ma->cell_b_faces;
+
+  const cs_real_3_t *i_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->i_face_normal;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->b_face_normal;
+
+  const int n_max_sweeps = 1000;
+  const cs_real_t eps2 = cs_math_pow2(eqp->epsilo);
+
+  cs_array_real_fill_zero((cs_lnum_t)n_dirs*n_cells_ext, l_dirs);
+
+  cs_real_t *norms;
+  BFT_MALLOC(norms, 2*n_dirs, cs_real_t);
+
+  int n_sweeps = 0;
+  bool converged = false;
+
+  while (!converged && n_sweeps < n_max_sweeps) {
+
+    n_sweeps++;
+
+#   pragma omp parallel for schedule(dynamic) if (n_dirs > 1)
+    for (int d_id = 0; d_id < n_dirs; d_id++) {
+
+      const cs_real_t *s = dirs[d_id];
+      const cs_lnum_t *order = orders + (size_t)d_id*n_cells;
+      cs_real_t *l = l_dirs + (size_t)d_id*n_cells_ext;
+
+      cs_real_t dl2 = 0, l2 = 0;
+
+      for (cs_lnum_t o_id = 0; o_id < n_cells; o_id++) {
+        const cs_lnum_t c_id = order[o_id];
+
+        cs_real_t da = rovsdt[c_id];
+        cs_real_t b = rhs[c_id];
+
+        /* Upwind contributions of interior faces (incoming flux) */
+        for (cs_lnum_t j = c2c_idx[c_id]; j < c2c_idx[c_id+1]; j++) {
+          const cs_lnum_t f_id = cell_i_faces[j];
+          const cs_real_t flux
+            = cell_i_faces_sgn[j]*cs_math_3_dot_product(s, i_face_normal[f_id]);
+          if (flux < 0) {
+            da -= flux;
+            b -= flux*l[c2c[j]];
+          }
+        }
+
+        /* Upwind contributions of boundary faces (incoming flux) */
+        for (cs_lnum_t j = cell_b_faces_idx[c_id];
+             j < cell_b_faces_idx[c_id+1];
+             j++) {
+          const cs_lnum_t f_id = cell_b_faces[j];
+          const cs_real_t flux
+            = cs_math_3_dot_product(s, b_face_normal[f_id]);
+          if (flux < 0) {
+            da -= flux*(1. - coefbp[f_id]);
+            b -= flux*coefap[f_id];
+          }
+        }
+
+        const cs_real_t l_new = b / da;
+        dl2 += cs_math_pow2(l_new - l[c_id]);
+        l2 += cs_math_pow2(l_new);
+        l[c_id] = l_new;
+      }
+
+      norms[2*d_id] = dl2;
+      norms[2*d_id + 1] = l2;
+    }
+
+    cs_parall_sum(2*n_dirs, CS_REAL_TYPE, norms);
+
+    converged = true;
+    for (int d_id = 0; d_id < n_dirs; d_id++) {
+      if (norms[2*d_id] > eps2*norms[2*d_id + 1])
+        converged = false;
+    }
+
+    if (m->halo != nullptr && !converged) {
+      for (int d_id = 0; d_id < n_dirs; d_id++)
+        cs_halo_sync_var(m->halo, CS_HALO_STANDARD,
+                         l_dirs + (size_t)d_id*n_cells_ext);
+    }
+
+  }
+
+  BFT_FREE(norms);
+
+  return n_sweeps;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Order linear solvers for DOM radiative model.
@@ -300,6 +504,138 @@ _order_by_direction(void)
   BFT_FREE(s);
 }
 
+/*----------------------------------------------------------------------------
+ * Solve radiance for all DOM directions of a gray gas using batched sweeps,
+ * and integrate fluxes.
+ *
+ * parameters:
+ *   eqp            <-- radiance equation parameters
+ *   bc_coeffs_rad  <-- boundary condition coefficients for the radiance
+ *   rhs            <-- explicit source term
+ *   rovsdt         <-- implicit source term
+ *   radiance       --> radiance of last direction
+ *   q              <-> explicit flux density vector
+ *   int_rad_domega <-> integral of I dOmega
+ *   snplus         <-> integral of (s.n)^+ dOmega at boundary faces
+ *   qincid         <-> incident flux at boundary faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_rad_transfer_sol_sweep(const cs_equation_param_t   *eqp,
+                        const cs_field_bc_coeffs_t  *bc_coeffs_rad,
+                        const cs_real_t              rhs[],
+                        const cs_real_t              rovsdt[],
+                        cs_real_t          *restrict radiance,
+                        cs_real_3_t        *restrict q,
+                        cs_real_t          *restrict int_rad_domega,
+                        cs_real_t          *restrict snplus,
+                        cs_real_t          *restrict qincid)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->b_face_normal;
+  const cs_real_t *b_face_surf = cs_glob_mesh_quantities->b_face_surf;
+
+  const cs_rad_transfer_params_t *rt_params = cs_glob_rad_transfer_params;
+
+  /* Directions, in the same order as the per-direction solvers */
+
+  const int n_dirs = 8*rt_params->ndirs;
+
+  cs_real_3_t *dirs;
+  cs_real_t *domega;
+  BFT_MALLOC(dirs, n_dirs, cs_real_3_t);
+  BFT_MALLOC(domega, n_dirs, cs_real_t);
+
+  int kdir = 0;
+  for (int kk = -1; kk <= 1; kk+=2) {
+    for (int ii = -1; ii <= 1; ii+=2) {
+      for (int jj = -1; jj <= 1; jj+=2) {
+        for (int dir_id = 0; dir_id < rt_params->ndirs; dir_id++) {
+          dirs[kdir][0] = ii * rt_params->vect_s[dir_id][0];
+          dirs[kdir][1] = jj * rt_params->vect_s[dir_id][1];
+          dirs[kdir][2] = kk * rt_params->vect_s[dir_id][2];
+          domega[kdir] = rt_params->angsol[dir_id];
+          kdir++;
+        }
+      }
+    }
+  }
+
+  _sweep_orders(n_dirs, (const cs_real_3_t *)dirs);
+
+  if (cs_glob_mesh_adjacencies->cell_i_faces == nullptr)
+    cs_mesh_adjacencies_update_cell_i_faces();
+
+  const int n_batch = CS_MIN(_n_dirs_batch, n_dirs);
+
+  cs_real_t *l_dirs;
+  BFT_MALLOC(l_dirs, (size_t)n_batch*n_cells_ext, cs_real_t);
+
+  for (int s_id = 0; s_id < n_dirs; s_id += n_batch) {
+
+    const int n_b_dirs = CS_MIN(n_batch, n_dirs - s_id);
+
+    int n_sweeps = _sweep_directions(n_b_dirs,
+                                     (const cs_real_3_t *)(dirs + s_id),
+                                     _sweep_order + (size_t)s_id*n_cells,
+                                     eqp,
+                                     bc_coeffs_rad->a,
+                                     bc_coeffs_rad->b,
+                                     rhs,
+                                     rovsdt,
+                                     l_dirs);
+
+    if (eqp->verbosity > 0)
+      bft_printf(_("   Radiance: directions %d to %d solved in %d sweeps\n"),
+                 s_id + 1, s_id + n_b_dirs, n_sweeps);
+
+    /* Integration of fluxes */
+
+    for (int d_id = 0; d_id < n_b_dirs; d_id++) {
+
+      const cs_real_t *vect_s = dirs[s_id + d_id];
+      const cs_real_t domegat = domega[s_id + d_id];
+      const cs_real_t *l = l_dirs + (size_t)d_id*n_cells_ext;
+
+#     pragma omp parallel for if (n_cells > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        cs_real_t aa = l[c_id] * domegat;
+        int_rad_domega[c_id] += aa;
+        q[c_id][0] += aa * vect_s[0];
+        q[c_id][1] += aa * vect_s[1];
+        q[c_id][2] += aa * vect_s[2];
+      }
+
+#     pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+      for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+        cs_real_t aa = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
+        aa /= b_face_surf[face_id];
+        aa = 0.5 * (aa + CS_ABS(aa)) * domegat;
+        snplus[face_id] += aa;
+        qincid[face_id] += aa * l[b_face_cells[face_id]];
+      }
+
+    }
+
+    /* Keep last direction in radiance field, as with linear solves */
+
+    if (s_id + n_b_dirs == n_dirs)
+      cs_array_real_copy(n_cells_ext,
+                         l_dirs + (size_t)(n_b_dirs-1)*n_cells_ext,
+                         radiance);
+  }
+
+  BFT_FREE(l_dirs);
+  BFT_FREE(domega);
+  BFT_FREE(dirs);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Radiative flux and source term computation
@@ -578,13 +914,35 @@ _cs_rad_transfer_sol(int       gg_id,
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
     rovsdt[cell_id] = CS_MAX(rovsdt[cell_id], 0.0);
 
+  /* When having only one direction, one pass is enough... */
+  bool finished = false;
+
+  /* Batched sweeps over directions, when the discretization allows it */
+
+  if (   _n_dirs_batch > 0
+      && one_dir == false
+      && rt_params->dispersion == false
+      && rt_params->atmo_model == CS_RAD_ATMO_3D_NONE
+      && eqp->icoupl < 1
+      && cs_glob_mesh_quantities->has_disable_flag == 0) {
+
+    _rad_transfer_sol_sweep(eqp,
+                            bc_coeffs_rad,
+                            rhs,
+                            rovsdt,
+                            radiance,
+                            q,
+                            int_rad_domega,
+                            f_snplus->val,
+                            f_qincid->val);
+
+    finished = true;
+  }
+
   /* Angular discretization */
 
   int kdir = 0;
 
-  /* When having only one direction, one pass is enough... */
-  bool finished = false;
-
   for (int kk = -1; kk <= 1 && !finished; kk+=2) {
     for (int ii = -1; ii <= 1 && !finished; ii+=2) {
       for (int jj = -1; jj <= 1 && !finished; jj+=2) {
@@ -1090,6 +1448,142 @@ _net_flux_internal_coupling_contribution(cs_internal_coupling_t  *cpl,
   BFT_FREE(net_flux_distant);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the gas phase temperature (in Kelvin) from the thermal variable.
+ *
+ * parameters:
+ *   tempk --> cell temperature (in Kelvin)
+ *----------------------------------------------------------------------------*/
+
+static void
+_gas_temperature_kelvin(cs_real_t  tempk[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  if (cs_glob_thermal_model->thermal_variable == CS_THERMAL_MODEL_TEMPERATURE) {
+    cs_real_t xptk = 0.0;
+    if (   cs_glob_thermal_model->temperature_scale
+        == CS_TEMPERATURE_SCALE_CELSIUS)
+      xptk = cs_physical_constants_celsius_to_kelvin;
+
+    cs_field_t *temp_field = cs_field_by_name_try("temperature");
+    const cs_real_t *cvara_scalt;
+    if (temp_field != nullptr)
+      cvara_scalt = temp_field->vals[1];
+    else
+      cvara_scalt = CS_FI_(t, 0)->val;
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      tempk[cell_id] = cvara_scalt[cell_id] + xptk;
+  }
+  else
+    cs_ht_convert_h_to_t_cells(CS_F_(h)->vals[1], tempk);
+}
+
+/*----------------------------------------------------------------------------
+ * Save the state of the last radiative transfer solve for the adaptive
+ * update.
+ *
+ * parameters:
+ *   tempk <-- gas phase temperature (in Kelvin)
+ *----------------------------------------------------------------------------*/
+
+static void
+_adaptive_update_save(const cs_real_t  tempk[])
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  if (_adapt_tempk == nullptr) {
+    BFT_MALLOC(_adapt_tempk, n_cells, cs_real_t);
+    BFT_MALLOC(_adapt_rho, n_cells, cs_real_t);
+    BFT_MALLOC(_adapt_emi, n_cells, cs_real_t);
+    BFT_MALLOC(_adapt_est, n_cells, cs_real_t);
+    BFT_MALLOC(_adapt_ist, n_cells, cs_real_t);
+  }
+
+  cs_array_real_copy(n_cells, tempk, _adapt_tempk);
+  cs_array_real_copy(n_cells, CS_F_(rho)->val, _adapt_rho);
+  cs_array_real_copy(n_cells, CS_FI_(rad_emi, 0)->val, _adapt_emi);
+  cs_array_real_copy(n_cells, CS_FI_(rad_est, 0)->val, _adapt_est);
+  cs_array_real_copy(n_cells, CS_FI_(rad_ist, 0)->val, _adapt_ist);
+
+  _adapt_nt_last = cs_glob_time_step->nt_cur;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether the radiative transfer must be solved again, based on
+ * the relative change of the temperature and density since the last solve.
+ *
+ * Otherwise, the source terms of the last solve are extrapolated to
+ * the current temperature: the emission is linearized around
+ * the temperature of the last solve, and the implicit part is restored
+ * (since it is modified in place when added to the thermal equation).
+ *
+ * returns:
+ *   true if a solve is required, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_adaptive_update_check(void)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  if (_adapt_tempk == nullptr)
+    return true;
+  if (_adapt_nt_max > 0 && nt_cur - _adapt_nt_last >= _adapt_nt_max)
+    return true;
+
+  cs_real_t *tempk;
+  BFT_MALLOC(tempk, n_cells, cs_real_t);
+
+  _gas_temperature_kelvin(tempk);
+
+  const cs_real_t *rho = CS_F_(rho)->val;
+
+  cs_real_t d_max = 0.;
+
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    cs_real_t d_t =   CS_ABS(tempk[cell_id] - _adapt_tempk[cell_id])
+                    / CS_MAX(_adapt_tempk[cell_id], cs_math_epzero);
+    cs_real_t d_rho =   CS_ABS(rho[cell_id] - _adapt_rho[cell_id])
+                      / CS_MAX(_adapt_rho[cell_id], cs_math_epzero);
+    d_max = CS_MAX(d_max, CS_MAX(d_t, d_rho));
+  }
+
+  cs_parall_max(1, CS_REAL_TYPE, &d_max);
+
+  bool update = (d_max > _adapt_rtol);
+
+  if (update == false) {
+
+    cs_real_t *rad_estm = CS_FI_(rad_est, 0)->val;
+    cs_real_t *rad_istm = CS_FI_(rad_ist, 0)->val;
+
+    /* d(T^4)/dT = 4 T^3, so emi(T) ~ emi0 (1 + 4 (T - T0) / T0) */
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      cs_real_t t0 = CS_MAX(_adapt_tempk[cell_id], cs_math_epzero);
+      rad_estm[cell_id] =   _adapt_est[cell_id]
+                          + 4. * _adapt_emi[cell_id]
+                               * (tempk[cell_id] - t0) / t0;
+      rad_istm[cell_id] = _adapt_ist[cell_id];
+    }
+
+    if (cs_glob_rad_transfer_params->verbosity > 0)
+      cs_log_printf
+        (CS_LOG_DEFAULT,
+         _("   ** Radiative transfer not updated "
+           "(max. relative change: %10.3e, last solve at time step %d)\n"),
+         d_max, _adapt_nt_last);
+
+  }
+
+  BFT_FREE(tempk);
+
+  return update;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1141,6 +1635,11 @@ cs_rad_transfer_solve(int  bc_type[])
                                    cs_glob_time_step) == false)
     return;
 
+  /* Adaptive update: skip solve if the state has not changed enough */
+  if (   ipadom > 1 && _adapt_rtol >= 0
+      && _adaptive_update_check() == false)
+    return;
+
   /* Allocate temporary arrays for the radiative equations resolution */
   cs_real_t *viscf, *viscb, *rhs, *rovsdt;
   BFT_MALLOC(viscf,  n_i_faces, cs_real_t);
@@ -2269,6 +2768,10 @@ cs_rad_transfer_solve(int  bc_type[])
   if (verbosity > 0)
     cs_log_separator(CS_LOG_DEFAULT);
 
+  /* Save state for adaptive update */
+  if (_adapt_rtol >= 0)
+    _adaptive_update_save(tempk);
+
   /* Free memory */
 
   BFT_FREE(iflux);
@@ -2291,6 +2794,71 @@ cs_rad_transfer_solve(int  bc_type[])
   BFT_FREE(iqpar);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of DOM directions solved simultaneously.
+ *
+ * When > 0, and when the radiance discretization is pure upwind without
+ * dispersion (and outside the atmospheric model), the radiance is solved
+ * for batches of directions using Gauss-Seidel sweeps in the downwind
+ * order of each direction, directions of a batch being distributed over
+ * threads. Otherwise, a linear system is solved for each direction.
+ *
+ * \param[in]  n_dirs  number of directions per batch, or 0 for
+ *                     one linear solve per direction
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_set_direction_batch(int  n_dirs)
+{
+  _n_dirs_batch = CS_MAX(n_dirs, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate the adaptive update of radiative transfer.
+ *
+ * At time steps where the radiative transfer time control is active,
+ * the radiative transfer is solved only if the gas temperature or density
+ * (on which the absorption coefficient depends) has changed by more than
+ * a given relative tolerance in some cell since the last solve, or if
+ * a given number of time steps has elapsed. Otherwise, the source terms
+ * of the last solve are reused, with the emission linearized around
+ * the temperature of the last solve.
+ *
+ * \param[in]  rtol    relative change tolerance, or < 0 to deactivate
+ * \param[in]  nt_max  maximum number of time steps between solves,
+ *                     or 0 for no limit
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_set_adaptive_update(cs_real_t  rtol,
+                                          int        nt_max)
+{
+  _adapt_rtol = rtol;
+  _adapt_nt_max = CS_MAX(nt_max, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays used by the radiative transfer solver.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void)
+{
+  BFT_FREE(_sweep_order);
+
+  BFT_FREE(_adapt_tempk);
+  BFT_FREE(_adapt_rho);
+  BFT_FREE(_adapt_emi);
+  BFT_FREE(_adapt_est);
+  BFT_FREE(_adapt_ist);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
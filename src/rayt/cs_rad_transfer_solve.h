@@ -68,6 +68,53 @@ BEGIN_C_DECLS
 void
 cs_rad_transfer_solve(int  bc_type[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of DOM directions solved simultaneously.
+ *
+ * When > 0, and when the radiance discretization is pure upwind without
+ * dispersion (and outside the atmospheric model), the radiance is solved
+ * for batches of directions using ordered sweeps distributed over threads.
+ *
+ * \param[in]  n_dirs  number of directions per batch, or 0 for
+ *                     one linear solve per direction
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_set_direction_batch(int  n_dirs);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate the adaptive update of radiative transfer.
+ *
+ * At time steps where the radiative transfer time control is active,
+ * the radiative transfer is solved only if the gas temperature or density
+ * (on which the absorption coefficient depends) has changed by more than
+ * a given relative tolerance in some cell since the last solve, or if
+ * a given number of time steps has elapsed. Otherwise, the source terms
+ * of the last solve are reused, with the emission linearized around
+ * the temperature of the last solve.
+ *
+ * \param[in]  rtol    relative change tolerance, or < 0 to deactivate
+ * \param[in]  nt_max  maximum number of time steps between solves,
+ *                     or 0 for no limit
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_set_adaptive_update(cs_real_t  rtol,
+                                          int        nt_max);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays used by the radiative transfer solver.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
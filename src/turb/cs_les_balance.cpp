@@ -51,6 +51,7 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_array.h"
 #include "cs_base.h"
 #include "cs_file.h"
 #include "cs_mesh.h"
@@ -76,6 +77,7 @@
 #include "cs_time_moment.h"
 #include "cs_time_step.h"
 #include "cs_turbulence_model.h"
+#include "cs_volume_zone.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -221,6 +223,12 @@ static cs_field_t *_gradv   = nullptr;
 static cs_field_t *_gradnut = nullptr;
 static cs_field_t **_gradt  = nullptr;
 
+/* Streaming mode: reuse gradients from the main solve, and restrict
+   per-cell correlations to a volume zone (zone id 0: all cells) */
+static bool  _streaming = false;
+static char *_zone_name = nullptr;
+static int   _zone_id = 0;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -526,6 +534,41 @@ _les_balance_laplacian(cs_real_t   *wa,
   BFT_FREE(b_massflux);
 }
 
+/*----------------------------------------------------------------------------
+ * Return the cells on which per-cell correlations are evaluated.
+ *
+ * When the balance is restricted to a volume zone, values outside
+ * that zone are set to zero.
+ *
+ * parameters:
+ *   stride   <-- number of values per cell
+ *   vals     --> pointer to values (size: n_local elements*stride)
+ *   cell_ids --> zone cell ids, or nullptr for all cells
+ *
+ * returns:
+ *   number of cells on which values must be evaluated
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_les_balance_eval_cells(cs_lnum_t          stride,
+                        cs_real_t         *vals,
+                        const cs_lnum_t  **cell_ids)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  *cell_ids = nullptr;
+
+  if (_zone_id < 1)
+    return n_cells;
+
+  const cs_zone_t *z = cs_volume_zone_by_id(_zone_id);
+
+  cs_array_real_fill_zero(n_cells*stride, vals);
+  *cell_ids = z->elt_ids;
+
+  return z->n_elts;
+}
+
 /*----------------------------------------------------------------------------
  *  Compute the most needed gradients at each iteration.
  *----------------------------------------------------------------------------*/
@@ -533,6 +576,7 @@ _les_balance_laplacian(cs_real_t   *wa,
 static void
 _les_balance_compute_gradients(void)
 {
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
   const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
   const int *bc_type = cs_glob_bc_type;
   const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
@@ -548,11 +592,28 @@ _les_balance_compute_gradients(void)
   bool use_previous_t = false;
   int inc = 1;
 
-  bft_printf_flush();
-  cs_field_gradient_vector(CS_F_(vel),
-                           use_previous_t,
-                           inc,
-                           (cs_real_33_t *)_gradv->val);
+  /* In streaming mode, reuse the gradient computed by the main solve
+     (i.e. lagging by one time step) when it is available. */
+
+  const cs_real_t *gradv_s = nullptr;
+  if (_streaming) {
+    cs_field_t *f_vg = cs_field_by_name_try("algo:velocity_gradient");
+    if (CS_F_(vel)->grad != nullptr)
+      gradv_s = CS_F_(vel)->grad;
+    else if (f_vg != nullptr)
+      gradv_s = f_vg->val;
+  }
+
+  if (gradv_s != nullptr)
+    cs_array_real_copy(9*n_cells_ext, gradv_s, _gradv->val);
+
+  else {
+    bft_printf_flush();
+    cs_field_gradient_vector(CS_F_(vel),
+                             use_previous_t,
+                             inc,
+                             (cs_real_33_t *)_gradv->val);
+  }
 
   /* Computation of the nu_t gradient */
   if (_les_balance.type & CS_LES_BALANCE_RIJ_FULL ||
@@ -614,10 +675,13 @@ _les_balance_compute_gradients(void)
                                    &gradient_type,
                                    &halo_type);
 
-        cs_field_gradient_scalar(f,
-                                 false, /* use_previous_t */
-                                 inc,
-                                 (cs_real_3_t *)_gradt[iii]->val);
+        if (_streaming && f->grad != nullptr)
+          cs_array_real_copy(3*n_cells_ext, f->grad, _gradt[iii]->val);
+        else
+          cs_field_gradient_scalar(f,
+                                   false, /* use_previous_t */
+                                   inc,
+                                   (cs_real_3_t *)_gradt[iii]->val);
          iii++;
       }
     }
@@ -637,14 +701,16 @@ _les_balance_compute_pdjuisym(const void   *input,
                               cs_real_t    *vals)
 
 {
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   CS_UNUSED(input);
 
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(6, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     cs_real_t pre = CS_F_(p)->val[iel];
     for (cs_lnum_t ii = 0; ii < 6; ii++) {
       cs_lnum_t i = idirtens[ii][0];
@@ -667,15 +733,18 @@ _les_balance_compute_smag(const void   *input,
                           cs_real_t    *vals)
 
 {
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   CS_UNUSED(input);
 
   cs_real_t *cpro_smago = cs_field_by_name("smagorinsky_constant^2")->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(1, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     vals[iel] = cs_math_sq(cpro_smago[iel]);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -690,14 +759,16 @@ static void
 _les_balance_compute_dkuidkuj(const void   *input,
                               cs_real_t    *vals)
 {
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   CS_UNUSED(input);
 
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(6, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
 
     for (cs_lnum_t ii = 0; ii < 6; ii++)
       vals[6*iel + ii] = 0.;
@@ -773,14 +844,16 @@ static void
 _les_balance_compute_nutdkuidkuj(const void   *input,
                                  cs_real_t    *vals)
 {
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   CS_UNUSED(input);
 
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(6, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
 
     for (cs_lnum_t ii = 0; ii < 6; ii++)
       vals[6*iel + ii] = 0.;
@@ -807,8 +880,6 @@ static void
 _les_balance_compute_dknutuidjuksym(const void   *input,
                                     cs_real_t    *vals)
 {
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   CS_UNUSED(input);
 
   cs_real_3_t *vel;
@@ -817,8 +888,12 @@ _les_balance_compute_dknutuidjuksym(const void   *input,
   cs_real_33_t *grdv  = (cs_real_33_t *)_gradv->val;
   cs_real_3_t *grdnu = (cs_real_3_t *)_gradnut->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(6, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
 
     for (cs_lnum_t ii = 0; ii < 6; ii++)
       vals[6*iel + ii] = 0.;
@@ -847,15 +922,18 @@ _les_balance_compute_nutdkuiuj(const void   *input,
                                cs_real_t    *vals)
 {
   const int *k = (const int *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
   cs_real_3_t *vel   = (cs_real_3_t *)CS_F_(vel)->val;
   cs_real_t   *mu_t  = CS_F_(mu_t)->val;
   cs_real_6_t *tens  = (cs_real_6_t *)vals;
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(6, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t ii = 0; ii < 6; ii++) {
       cs_lnum_t i = idirtens[ii][0];
       cs_lnum_t j = idirtens[ii][1];
@@ -878,15 +956,17 @@ static void
 _les_balance_compute_dknutdiuk(const void   *input,
                                cs_real_t    *vals)
 {
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   CS_UNUSED(input);
 
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
   cs_real_3_t *grdnu = (cs_real_3_t *)_gradnut->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(3, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
 
     for (cs_lnum_t i = 0; i < 3; i++)
       vals[3*iel + i] = 0.;
@@ -909,16 +989,18 @@ static void
 _les_balance_compute_uidjnut(const void   *input,
                                cs_real_t    *vals)
 {
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   CS_UNUSED(input);
 
   cs_real_3_t *grdnu = (cs_real_3_t *)_gradnut->val;
   cs_real_3_t *vel   = (cs_real_3_t *)CS_F_(vel)->val;
   cs_real_33_t *tens = (cs_real_33_t *)vals;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(9, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t i = 0; i < 3; i++) {
       for (cs_lnum_t j = 0; j < 3; j++)
         tens[iel][i][j] = vel[iel][i]*grdnu[iel][j];
@@ -939,7 +1021,6 @@ _les_balance_compute_djtdjui(const void   *input,
                              cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
   const int keysca = cs_field_key_id("scalar_id");
   int isca = cs_field_get_key_int(sca, keysca) - 1;
@@ -948,8 +1029,12 @@ _les_balance_compute_djtdjui(const void   *input,
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
   cs_real_3_t *grdt = (cs_real_3_t *)_gradt[isca]->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(3, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t i = 0; i < 3; i++) {
       cs_real_t dtdxjduidxj = 0.;
       for (cs_lnum_t kk = 0; kk < 3; kk++)
@@ -973,11 +1058,14 @@ _les_balance_compute_tuiuj(const void   *input,
                            cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
   cs_real_3_t *vel = (cs_real_3_t *)CS_F_(vel)->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(6, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t ii = 0; ii < 6; ii++) {
       cs_lnum_t i = idirtens[ii][0];
       cs_lnum_t j = idirtens[ii][1];
@@ -999,7 +1087,6 @@ _les_balance_compute_uidjt(const void   *input,
                            cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
   cs_real_3_t *vel = (cs_real_3_t *)CS_F_(vel)->val;
   cs_real_33_t *tens = (cs_real_33_t *)vals;
 
@@ -1009,10 +1096,16 @@ _les_balance_compute_uidjt(const void   *input,
 
   cs_real_3_t *grdt = (cs_real_3_t *)_gradt[isca]->val;
 
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(9, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t i = 0; i < 3; i++)
       for (cs_lnum_t j = 0; j < 3; j++)
         tens[iel][i][j] = vel[iel][i]*grdt[iel][j];
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1028,7 +1121,6 @@ _les_balance_compute_ditdit(const void   *input,
                                 cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
   const int keysca = cs_field_key_id("scalar_id");
   int isca = cs_field_get_key_int(sca, keysca) - 1;
@@ -1036,8 +1128,12 @@ _les_balance_compute_ditdit(const void   *input,
 
   cs_real_3_t *grdt = (cs_real_3_t *)_gradt[isca]->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(1, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     cs_real_t dtdxidtdxi = 0.;
     for (cs_lnum_t i = 0; i < 3; i++)
       dtdxidtdxi += grdt[iel][i]; // FIXME: missing SQUARE??
@@ -1222,7 +1318,6 @@ _les_balance_compute_nutditdit(const void   *input,
                                cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
   const int keysca = cs_field_key_id("scalar_id");
   int isca = cs_field_get_key_int(sca, keysca) - 1;
@@ -1230,8 +1325,12 @@ _les_balance_compute_nutditdit(const void   *input,
 
   cs_real_3_t *grdt = (cs_real_3_t *)_gradt[isca]->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(1, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     cs_real_t nutditdit = 0.;
     for (cs_lnum_t i = 0; i < 3; i++)
       nutditdit +=  CS_F_(mu_t)->val[iel]*sca->val[iel]
@@ -1254,7 +1353,6 @@ _les_balance_compute_nutuidjt(const void   *input,
                               cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
   cs_real_3_t *vel = (cs_real_3_t *)CS_F_(vel)->val;
   cs_real_33_t *tens = (cs_real_33_t *)vals;
 
@@ -1264,8 +1362,12 @@ _les_balance_compute_nutuidjt(const void   *input,
 
   cs_real_3_t *grdt = (cs_real_3_t *)_gradt[isca]->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(9, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t i = 0; i < 3; i++)
       for (cs_lnum_t j = 0; j < 3; j++)
         tens[iel][i][j] = CS_F_(mu_t)->val[iel]*vel[iel][i]*grdt[iel][j];
@@ -1285,7 +1387,6 @@ _les_balance_compute_nutdjuidjt(const void   *input,
                                 cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
   const int keysca = cs_field_key_id("scalar_id");
   int isca = cs_field_get_key_int(sca, keysca) - 1;
@@ -1294,8 +1395,12 @@ _les_balance_compute_nutdjuidjt(const void   *input,
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
   cs_real_3_t *grdt = (cs_real_3_t *)_gradt[isca]->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(3, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t i = 0; i < 3; i++) {
       cs_real_t nutdjuidjt = 0.;
       for (cs_lnum_t kk = 0; kk < 3; kk++)
@@ -1320,13 +1425,15 @@ _les_balance_compute_djnutdiuj(const void   *input,
 {
   CS_UNUSED(input);
 
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
-
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
   cs_real_3_t *grdnu = (cs_real_3_t *)_gradnut->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(3, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t i = 0; i < 3; i++) {
       cs_real_t djnutdiuj = 0.;
       for (cs_lnum_t kk = 0; kk < 3; kk++)
@@ -1350,13 +1457,16 @@ _les_balance_compute_djnuttdiuj(const void   *input,
                                 cs_real_t    *vals)
 {
   const cs_field_t *sca = (const cs_field_t *)input;
-  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
 
   cs_real_33_t *grdv = (cs_real_33_t *)_gradv->val;
   cs_real_3_t *grdnu = (cs_real_3_t *)_gradnut->val;
 
-# pragma omp parallel for if (n_cells > CS_THR_MIN)
-  for (cs_lnum_t iel = 0; iel < n_cells; iel++) {
+  const cs_lnum_t *z_ids = nullptr;
+  const cs_lnum_t n_z_cells = _les_balance_eval_cells(3, vals, &z_ids);
+
+# pragma omp parallel for if (n_z_cells > CS_THR_MIN)
+  for (cs_lnum_t c_idx = 0; c_idx < n_z_cells; c_idx++) {
+    const cs_lnum_t iel = (z_ids != nullptr) ? z_ids[c_idx] : c_idx;
     for (cs_lnum_t i = 0; i < 3; i++) {
       cs_real_t djnuttdiuj = 0.;
       for (cs_lnum_t kk = 0; kk < 3; kk++)
@@ -2787,6 +2897,19 @@ cs_les_balance_create(void)
   if (cs_restart_present())
     _check_restart_type();
 
+  /* Streaming mode: keep the velocity gradient computed by the LES model
+     with the velocity field, and locate the restriction zone */
+  if (_streaming) {
+    if (   cs_glob_turb_model->itytur == 4
+        && CS_F_(vel)->grad == nullptr)
+      cs_field_allocate_gradient(CS_F_(vel));
+
+    if (_zone_name != nullptr) {
+      _zone_id = cs_volume_zone_by_name(_zone_name)->id;
+      BFT_FREE(_zone_name);
+    }
+  }
+
   cs_les_balance_create_fields();
 
   /* Creation of the generic time moments used for both Rij
@@ -3842,6 +3965,8 @@ cs_les_balance_finalize(void)
 
   /* Freeing of the btui structure */
   _les_balance.btui = _les_balance_destroy_tui(_les_balance.btui);
+
+  BFT_FREE(_zone_name);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3865,6 +3990,39 @@ cs_les_balance_activate(int     type_flag,
   _les_balance.frequency_n = frequency_n;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate the streaming mode of the LES balance module.
+ *
+ * In this mode, the velocity gradient computed by the LES viscosity
+ * model (and scalar gradients kept with their fields) are reused instead
+ * of being recomputed after each time step, so correlations involving
+ * gradients lag by one time step, which is acceptable for converged
+ * statistics. Correlation moments defined by functions may also be
+ * restricted to a volume zone, values outside that zone being zero.
+ *
+ * This must be called before the LES balance is created.
+ *
+ * \param[in]  zone_name   name of volume zone to which correlations
+ *                         are restricted, or nullptr for all cells
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_balance_set_streaming(const char  *zone_name)
+{
+  _streaming = true;
+
+  BFT_FREE(_zone_name);
+  _zone_id = 0;
+
+  if (zone_name != nullptr) {
+    size_t l = strlen(zone_name);
+    BFT_MALLOC(_zone_name, l + 1, char);
+    strcpy(_zone_name, zone_name);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the LES balance for Tui or Rij
@@ -215,6 +215,20 @@ void
 cs_les_balance_activate(int     type_flag,
                         int     frequency_n);
 
+/*----------------------------------------------------------------------------
+ * Activate the streaming mode of the LES balance module.
+ *
+ * Gradients computed by the main solve are reused (lagging by one
+ * time step), and correlations defined by functions may be restricted
+ * to a volume zone. This must be called before the balance is created.
+ *
+ * parameters:
+ *  zone_name --> name of restriction volume zone, or nullptr for all cells
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_balance_set_streaming(const char  *zone_name);
+
 /*----------------------------------------------------------------------------
  * Compute the LES balance
  *----------------------------------------------------------------------------*/
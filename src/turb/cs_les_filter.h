@@ -65,6 +65,25 @@ cs_les_filter(int        stride,
               cs_real_t  val[],
               cs_real_t  f_val[]);
 
+/*----------------------------------------------------------------------------
+ * Compute filters for dynamic models on several arrays at once.
+ *
+ * Filter weights are computed once and the neighborhood is traversed
+ * a single time for all arrays. Each stride is limited to 9.
+ *
+ * parameters:
+ *   n_fields  <--  number of arrays to filter
+ *   strides   <--  stride of each array to filter
+ *   vals      <->  arrays of values to filter
+ *   f_vals    -->  arrays of filtered values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int         n_fields,
+                    const int   strides[],
+                    cs_real_t  *vals[],
+                    cs_real_t  *f_vals[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
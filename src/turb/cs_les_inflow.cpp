@@ -2028,33 +2028,133 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   alpha = sqrt(box_volume / (double)inflow->n_structures);
 
+  /* Eddies are sorted in a uniform grid over the virtual box,
+     whose cell size is the largest eddy size, so that only
+     neighboring grid cells need to be checked for each point */
+
+  cs_real_t ls_max[3] = {0., 0., 0.};
   for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+      ls_max[coo_id] = cs_math_fmax(ls_max[coo_id],
+                                    length_scale[point_id][coo_id]);
+  }
+
+  cs_parall_max(3, CS_REAL_TYPE, ls_max);
+
+  cs_lnum_t n_bins[3];
+  cs_real_t bin_size[3];
+  for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+    n_bins[coo_id] = 1;
+    if (ls_max[coo_id] > 0)
+      n_bins[coo_id] = CS_MAX(1, (cs_lnum_t)(box_length[coo_id]
+                                             / ls_max[coo_id]));
+    bin_size[coo_id] = box_length[coo_id] / n_bins[coo_id];
+    if (bin_size[coo_id] <= 0)
+      bin_size[coo_id] = 1.;
+  }
+
+  /* Limit the grid size relative to the number of structures */
+
+  while (   n_bins[0]*n_bins[1]*n_bins[2] > 4*inflow->n_structures
+         && n_bins[0]*n_bins[1]*n_bins[2] > 1) {
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      if (n_bins[coo_id] > 1) {
+        n_bins[coo_id] /= 2;
+        bin_size[coo_id] = box_length[coo_id] / n_bins[coo_id];
+      }
+    }
+  }
+
+  const cs_lnum_t n_bins_tot = n_bins[0]*n_bins[1]*n_bins[2];
+
+  cs_lnum_t *bin_idx, *bin_struct, *struct_bin;
+  BFT_MALLOC(bin_idx, n_bins_tot + 1, cs_lnum_t);
+  BFT_MALLOC(bin_struct, inflow->n_structures, cs_lnum_t);
+  BFT_MALLOC(struct_bin, inflow->n_structures, cs_lnum_t);
+
+  for (cs_lnum_t bin_id = 0; bin_id < n_bins_tot + 1; bin_id++)
+    bin_idx[bin_id] = 0;
+
+  for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    cs_lnum_t b[3];
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      b[coo_id] = (cs_lnum_t)(  (  inflow->position[struct_id][coo_id]
+                                 - box_min_coord[coo_id])
+                              / bin_size[coo_id]);
+      b[coo_id] = CS_MAX(0, CS_MIN(b[coo_id], n_bins[coo_id] - 1));
+    }
+    struct_bin[struct_id] = (b[2]*n_bins[1] + b[1])*n_bins[0] + b[0];
+    bin_idx[struct_bin[struct_id] + 1] += 1;
+  }
+
+  for (cs_lnum_t bin_id = 0; bin_id < n_bins_tot; bin_id++)
+    bin_idx[bin_id + 1] += bin_idx[bin_id];
+
+  for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++)
+    bin_struct[bin_idx[struct_bin[struct_id]]++] = struct_id;
+
+  for (cs_lnum_t bin_id = n_bins_tot; bin_id > 0; bin_id--)
+    bin_idx[bin_id] = bin_idx[bin_id - 1];
+  bin_idx[0] = 0;
+
+  BFT_FREE(struct_bin);
+
+  const cs_real_3_t *position = (const cs_real_3_t *)inflow->position;
+  const cs_real_3_t *energy = (const cs_real_3_t *)inflow->energy;
+
+# pragma omp parallel for if (n_points > CS_THR_MIN)
+  for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+
+    const cs_real_t *xp = point_coordinates[point_id];
+    const cs_real_t *ls = length_scale[point_id];
+
+    /* Range of grid cells possibly containing an influencing eddy */
+
+    cs_lnum_t b_min[3], b_max[3];
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      cs_real_t x0 = xp[coo_id] - ls[coo_id] - box_min_coord[coo_id];
+      cs_real_t x1 = xp[coo_id] + ls[coo_id] - box_min_coord[coo_id];
+      b_min[coo_id] = CS_MAX(0, (cs_lnum_t)floor(x0 / bin_size[coo_id]));
+      b_max[coo_id] = CS_MIN(n_bins[coo_id] - 1,
+                             (cs_lnum_t)floor(x1 / bin_size[coo_id]));
+    }
 
     cs_real_t distance[3];
 
-    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    for (cs_lnum_t bk = b_min[2]; bk <= b_max[2]; bk++) {
+      for (cs_lnum_t bj = b_min[1]; bj <= b_max[1]; bj++) {
+        for (cs_lnum_t bi = b_min[0]; bi <= b_max[0]; bi++) {
 
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-        distance[coo_id] =
-          CS_ABS(point_coordinates[point_id][coo_id]
-                 - inflow->position[struct_id][coo_id]);
+          cs_lnum_t bin_id = (bk*n_bins[1] + bj)*n_bins[0] + bi;
 
-      if (   distance[0] < length_scale[point_id][0]
-          && distance[1] < length_scale[point_id][1]
-          && distance[2] < length_scale[point_id][2]) {
+          for (cs_lnum_t i = bin_idx[bin_id]; i < bin_idx[bin_id+1]; i++) {
 
-        cs_real_t form_function = 1.;
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id][coo_id])
-            /sqrt(2./3.*length_scale[point_id][coo_id]);
+            cs_lnum_t struct_id = bin_struct[i];
 
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id][coo_id]
-            += inflow->energy[struct_id][coo_id]*form_function;
+            for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+              distance[coo_id] =
+                CS_ABS(xp[coo_id] - position[struct_id][coo_id]);
 
-      }
+            if (   distance[0] < ls[0]
+                && distance[1] < ls[1]
+                && distance[2] < ls[2]) {
+
+              cs_real_t form_function = 1.;
+              for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+                form_function *=
+                  (1.-distance[coo_id]/ls[coo_id])
+                  /sqrt(2./3.*ls[coo_id]);
+
+              for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+                fluctuations[point_id][coo_id]
+                  += energy[struct_id][coo_id]*form_function;
+
+            }
 
+          }
+
+        }
+      }
     }
 
     for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
@@ -2062,6 +2162,9 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   }
 
+  BFT_FREE(bin_idx);
+  BFT_FREE(bin_struct);
+
   BFT_FREE(length_scale);
 }
 
@@ -126,9 +126,20 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
 
   cs_real_t *w0, *xro, *xrof;
   cs_real_6_t *mij;
-  cs_real_33_t *gradv;
 
-  BFT_MALLOC(gradv, n_cells_ext, cs_real_33_t);
+  /* Velocity gradient is kept with the field if requested
+     (for example by the LES balance module) */
+
+  cs_field_t *fld_vel = CS_F_(vel);
+  cs_real_33_t *gradv = nullptr, *_gradv = nullptr;
+
+  if (fld_vel->grad != nullptr)
+    gradv = (cs_real_33_t *)fld_vel->grad;
+  else {
+    BFT_MALLOC(_gradv, n_cells_ext, cs_real_33_t);
+    gradv = _gradv;
+  }
+
   BFT_MALLOC(w0, n_cells_ext, cs_real_t);
   BFT_MALLOC(mij, n_cells_ext, cs_real_6_t);
   BFT_MALLOC(xro, n_cells_ext, cs_real_t);
@@ -160,7 +171,7 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
   BFT_MALLOC(w61, n_cells_ext, cs_real_6_t);
   BFT_MALLOC(w62, n_cells_ext, cs_real_6_t);
 
-  cs_field_gradient_vector(CS_F_(vel),
+  cs_field_gradient_vector(fld_vel,
                            false, // no use_previous_t
                            1,     // inc
                            gradv);
@@ -187,7 +198,7 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
       w62[c_id][ij] = xro[c_id] * mij[c_id][ij];
   }
 
-  BFT_FREE(gradv);
+  BFT_FREE(_gradv);
 
   /* w62 temporarily contains rho*S */
 
@@ -220,23 +231,6 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
       mij[c_id][ij] *= -2.0 * xro[c_id] * cs_math_pow2(delta) * s_n[c_id];
   }
 
-  /* w62 now contains <-2*rho*delta^2*||S||*S> */
-  cs_les_filter(6, (cs_real_t*)mij, (cs_real_t*)w62);
-
-  /* Now compute final mij value: M_ij = alpha_ij - beta_ij */
-
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    const cs_real_t delta = w0[c_id];
-    const cs_real_t deltaf = cs_turb_xlesfd * delta;
-    for (cs_lnum_t ij = 0; ij < 6; ij++)
-      mij[c_id][ij] = -2.0 * xro[c_id] * cs_math_pow2(deltaf)
-                           * sf_n[c_id] * w61[c_id][ij]
-                      - w62[c_id][ij];
-  }
-
-  BFT_FREE(w61);
-  BFT_FREE(w62);
-
   /* Allocate work arrays */
   cs_real_6_t *lij;
   cs_real_6_t *rho_ui_uj;
@@ -248,21 +242,43 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
   BFT_MALLOC(w_t, n_cells_ext, cs_real_6_t);
   BFT_MALLOC(w_v, n_cells_ext, cs_real_3_t);
 
-  /* Filtering the velocity and its square */
-
-  /* Second order moment  <rho u_i u_j> */
+  /* Second order moment <rho u_i u_j> and <rho u_i> */
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
     for (cs_lnum_t ij = 0; ij < 6; ij++)
       w_t[c_id][ij] = xro[c_id]*vel[c_id][_iv2t[ij]]*vel[c_id][_jv2t[ij]];
-  }
-  cs_les_filter(6, (cs_real_t*)w_t, (cs_real_t*)rho_ui_uj);
-
-  /* <rho u_i>/rho */
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
     for (cs_lnum_t i = 0; i < 3; i++)
       w_v[c_id][i] = xro[c_id]*vel[c_id][i];
   }
-  cs_les_filter(3, (cs_real_t*)w_v, (cs_real_t*)f_vel);
+
+  /* Filter all Germano identity terms in a single neighborhood pass:
+   *   w62 now contains <-2*rho*delta^2*||S||*S>,
+   *   rho_ui_uj contains <rho u_i u_j>, f_vel contains <rho u_i> */
+  {
+    const int strides[3] = {6, 6, 3};
+    cs_real_t *vals[3] = {(cs_real_t *)mij,
+                          (cs_real_t *)w_t,
+                          (cs_real_t *)w_v};
+    cs_real_t *f_vals[3] = {(cs_real_t *)w62,
+                            (cs_real_t *)rho_ui_uj,
+                            (cs_real_t *)f_vel};
+    cs_les_filter_multi(3, strides, vals, f_vals);
+  }
+
+  /* Now compute final mij value: M_ij = alpha_ij - beta_ij */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_real_t delta = w0[c_id];
+    const cs_real_t deltaf = cs_turb_xlesfd * delta;
+    for (cs_lnum_t ij = 0; ij < 6; ij++)
+      mij[c_id][ij] = -2.0 * xro[c_id] * cs_math_pow2(deltaf)
+                           * sf_n[c_id] * w61[c_id][ij]
+                      - w62[c_id][ij];
+  }
+
+  BFT_FREE(w61);
+  BFT_FREE(w62);
+
+  /* <rho u_i>/rho */
 
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id ++) {
     for (cs_lnum_t i = 0; i < 3; i++)
@@ -285,7 +301,6 @@ cs_les_mu_t_smago_dyn_prepare(cs_real_t  s_n[],
   }
 
   /* Free memory */
-  BFT_FREE(gradv);
   BFT_FREE(w0);
   BFT_FREE(mij);
   BFT_FREE(xro);
@@ -389,8 +404,12 @@ cs_les_mu_t_smago_dyn(void)
      denominator, then only compute  the quotient. The user can overwrite
      this in cs_user_physical_properties_turb_viscosity. */
 
-  cs_les_filter(1, w1, w3);
-  cs_les_filter(1, w2, w4);
+  {
+    const int strides[2] = {1, 1};
+    cs_real_t *vals[2] = {w1, w2};
+    cs_real_t *f_vals[2] = {w3, w4};
+    cs_les_filter_multi(2, strides, vals, f_vals);
+  }
 
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     if (fabs(w4[c_id]) <= cs_math_epzero)
@@ -552,9 +571,36 @@ cs_les_mu_t_smago_dyn(void)
       BFT_MALLOC(scami, n_cells_ext, cs_real_3_t);
       BFT_MALLOC(scamif, n_cells_ext, cs_real_3_t);
 
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      cs_real_3_t *w_v, *f_sca_vel;
+      BFT_MALLOC(w_v, n_cells_ext, cs_real_3_t);
+      BFT_MALLOC(f_sca_vel, n_cells_ext, cs_real_3_t);
+
+      /* rho*Y, -rho*delta^2*||S||*grad(Y) and rho*Y*vel */
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        const cs_real_t delta = cs_turb_xlesfl * pow(cs_turb_ales*cell_vol[c_id],
+                                                     cs_turb_bles);
         w0[c_id] = cvar_sca[c_id]*xro[c_id];
-      cs_les_filter(1, w0, w4);
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          scami[c_id][i]
+            = -xro[c_id]*cs_math_pow2(delta)*s_n[c_id]*grads[c_id][i];
+          w_v[c_id][i] = xro[c_id]*vel[c_id][i]*cvar_sca[c_id];
+        }
+      }
+
+      /* Filter all terms in a single neighborhood pass */
+      {
+        const int strides[3] = {1, 3, 3};
+        cs_real_t *vals[3] = {w0,
+                              (cs_real_t *)scami,
+                              (cs_real_t *)w_v};
+        cs_real_t *f_vals[3] = {w4,
+                                (cs_real_t *)scamif,
+                                (cs_real_t *)f_sca_vel};
+        cs_les_filter_multi(3, strides, vals, f_vals);
+      }
+
+      BFT_FREE(w_v);
+
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
         w4[c_id] /= xrof[c_id];
 
@@ -586,15 +632,6 @@ cs_les_mu_t_smago_dyn(void)
                          nullptr, /* internal coupling */
                          gradsf);
 
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        const cs_real_t delta = cs_turb_xlesfl * pow(cs_turb_ales*cell_vol[c_id],
-                                                     cs_turb_bles);
-        for (cs_lnum_t i = 0; i < 3; i++)
-          scami[c_id][i]
-            = -xro[c_id]*cs_math_pow2(delta)*s_n[c_id]*grads[c_id][i];
-      }
-
-      cs_les_filter(3, (cs_real_t *)scami, (cs_real_t *)scamif);
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
         const cs_real_t deltaf  = cs_turb_xlesfd * pow(xa*cell_vol[c_id],xb);
         for (cs_lnum_t i = 0; i < 3; i++)
@@ -606,19 +643,6 @@ cs_les_mu_t_smago_dyn(void)
       /* Compute the Li for scalar
        * ========================= */
 
-      cs_real_3_t *w_v, *f_sca_vel;
-      BFT_MALLOC(w_v, n_cells_ext, cs_real_3_t);
-      BFT_MALLOC(f_sca_vel, n_cells_ext, cs_real_3_t);
-
-      /* rho*Y*vel */
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        for (cs_lnum_t i = 0; i < 3; i++)
-          w_v[c_id][i] = xro[c_id]*vel[c_id][i]*cvar_sca[c_id];
-      }
-      cs_les_filter(3, (cs_real_t*)w_v, (cs_real_t*)f_sca_vel);
-
-      BFT_FREE(w_v);
-
       for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
         /* filter(rho Y vel) - rho filter(rho vel)/rho filter(Y)/rho */
         cs_real_t variance[3];
@@ -631,8 +655,12 @@ cs_les_mu_t_smago_dyn(void)
 
       BFT_FREE(f_sca_vel);
 
-      cs_les_filter(1, w1, w3);
-      cs_les_filter(1, w2, w4);
+      {
+        const int strides[2] = {1, 1};
+        cs_real_t *vals[2] = {w1, w2};
+        cs_real_t *f_vals[2] = {w3, w4};
+        cs_les_filter_multi(2, strides, vals, f_vals);
+      }
 
       /*
        * Compute the SGS flux coefficient and SGS diffusivity
@@ -693,15 +721,22 @@ cs_les_mu_t_smago_const(void)
   /* Initialization
    * ============== */
 
-  cs_real_33_t *gradv;
-  BFT_MALLOC(gradv, n_cells_ext, cs_real_33_t);
+  cs_field_t *f_vel = CS_F_(vel);
+  cs_real_33_t *gradv = nullptr, *_gradv = nullptr;
+
+  if (f_vel->grad != nullptr)
+    gradv = (cs_real_33_t *)f_vel->grad;
+  else {
+    BFT_MALLOC(_gradv, n_cells_ext, cs_real_33_t);
+    gradv = _gradv;
+  }
 
   cs_real_t *visct =  CS_F_(mu_t)->val;
   const cs_real_t *crom  = CS_F_(rho)->val;
 
   /* We need the velocity gradient */
 
-  cs_field_gradient_vector(CS_F_(vel),
+  cs_field_gradient_vector(f_vel,
                            false,  /* no use_previous_t */
                            1,      /* inc */
                            gradv);
@@ -744,7 +779,7 @@ cs_les_mu_t_smago_const(void)
   }
 
   /* Free memory */
-  BFT_FREE(gradv);
+  BFT_FREE(_gradv);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -773,8 +808,15 @@ cs_les_mu_t_wale(void)
   /* Initialization
    * ============== */
 
-  cs_real_33_t *gradv;
-  BFT_MALLOC(gradv, n_cells_ext, cs_real_33_t);
+  cs_field_t *f_vel = CS_F_(vel);
+  cs_real_33_t *gradv = nullptr, *_gradv = nullptr;
+
+  if (f_vel->grad != nullptr)
+    gradv = (cs_real_33_t *)f_vel->grad;
+  else {
+    BFT_MALLOC(_gradv, n_cells_ext, cs_real_33_t);
+    gradv = _gradv;
+  }
 
   cs_real_t *visct = CS_F_(mu_t)->val;
   const cs_real_t *crom = CS_F_(rho)->val;
@@ -782,7 +824,7 @@ cs_les_mu_t_wale(void)
   /* Computation of the velocity gradient
    * ==================================== */
 
-  cs_field_gradient_vector(CS_F_(vel),
+  cs_field_gradient_vector(f_vel,
                            false,  /* no use_previous_t */
                            1,      /* inc */
                            gradv);
@@ -893,7 +935,7 @@ cs_les_mu_t_wale(void)
   }
 
   /* Free memory */
-  BFT_FREE(gradv);
+  BFT_FREE(_gradv);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -86,8 +86,6 @@
 
 /*----------------------------------------------------------------------------*/
 
-BEGIN_C_DECLS
-
 /*=============================================================================
  * Additional doxygen documentation
  *============================================================================*/
@@ -111,8 +109,69 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Add the implicit part of the k and omega destruction terms
+ * (uncoupled k-omega solve).
+ *
+ * The kernel is specialized for each hybrid model, so that the hybrid
+ * model selection is not tested in the cell loop.
+ *
+ * template parameters:
+ *   hybrid <-- hybrid RANS/LES model (CS_HYBRID_NONE, CS_HYBRID_DES, ...)
+ *
+ * parameters:
+ *   ctx        <-> reference to dispatch context
+ *   n_cells    <-- number of cells
+ *   cell_f_vol <-- cell fluid volumes
+ *   crom       <-- density
+ *   cvara_omg  <-- omega at previous time step
+ *   xf1        <-- SST blending function F1
+ *   fdes       <-- DES/DDES destruction term multiplier, or nullptr
+ *   htles_t    <-- HTLES time scale, or nullptr
+ *   tinstk     <-> implicit part of k source terms
+ *   tinstw     <-> implicit part of omega source terms
+ *----------------------------------------------------------------------------*/
+
+template <int hybrid>
+static void
+_implicit_destruction_terms(cs_dispatch_context  &ctx,
+                            cs_lnum_t             n_cells,
+                            const cs_real_t       cell_f_vol[],
+                            const cs_real_t       crom[],
+                            const cs_real_t       cvara_omg[],
+                            const cs_real_t       xf1[],
+                            const cs_real_t       fdes[],
+                            const cs_real_t       htles_t[],
+                            cs_real_t             tinstk[],
+                            cs_real_t             tinstw[])
+{
+  const cs_real_t cmu = cs_turb_cmu;
+  const cs_real_t ckwbt1 = cs_turb_ckwbt1;
+  const cs_real_t ckwbt2 = cs_turb_ckwbt2;
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    cs_real_t xw    = cvara_omg[c_id];
+    cs_real_t xxf1  = xf1[c_id];
+    cs_real_t xbeta = xxf1 * ckwbt1 + (1. - xxf1)*ckwbt2;
+    cs_real_t ro = crom[c_id];
+
+    cs_real_t fhybr = 1.;
+    if (hybrid == CS_HYBRID_DES || hybrid == CS_HYBRID_DDES)
+      fhybr = fdes[c_id];
+    else if (hybrid == CS_HYBRID_HTLES)
+      fhybr = 1./(cmu*xw*htles_t[c_id]);
+
+    tinstk[c_id] += cell_f_vol[c_id]*cmu*ro*xw*fhybr;
+    tinstw[c_id] += 2.*cell_f_vol[c_id]*xbeta*ro*xw;
+  });
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
 /*=============================================================================
  * Public function definitions
  *============================================================================*/
@@ -1033,24 +1092,28 @@ cs_turbulence_kw(int phase_id)
 
     if (cs_glob_turb_rans_model->ikecou == 0) {
 
-      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
-        cs_real_t xw    = cvara_omg[c_id];
-        cs_real_t xxf1  = xf1[c_id];
-        cs_real_t xbeta = xxf1 * ckwbt1 + (1. - xxf1)*ckwbt2;
-        cs_real_t ro = crom[c_id];
-
-        cs_real_t fhybr;
-        if (   hybrid_turb == CS_HYBRID_DES
-            || hybrid_turb == CS_HYBRID_DDES)
-          fhybr = w1[c_id];
-        else if (hybrid_turb == CS_HYBRID_HTLES)
-          fhybr = 1./(cmu*xw*htles_t[c_id]);
-        else
-          fhybr = 1.;
+      switch(hybrid_turb) {
+      case CS_HYBRID_DES:
+        _implicit_destruction_terms<CS_HYBRID_DES>
+          (ctx, n_cells, cell_f_vol, crom, cvara_omg, xf1, w1, htles_t,
+           tinstk, tinstw);
+        break;
+      case CS_HYBRID_DDES:
+        _implicit_destruction_terms<CS_HYBRID_DDES>
+          (ctx, n_cells, cell_f_vol, crom, cvara_omg, xf1, w1, htles_t,
+           tinstk, tinstw);
+        break;
+      case CS_HYBRID_HTLES:
+        _implicit_destruction_terms<CS_HYBRID_HTLES>
+          (ctx, n_cells, cell_f_vol, crom, cvara_omg, xf1, w1, htles_t,
+           tinstk, tinstw);
+        break;
+      default:
+        _implicit_destruction_terms<CS_HYBRID_NONE>
+          (ctx, n_cells, cell_f_vol, crom, cvara_omg, xf1, w1, htles_t,
+           tinstk, tinstw);
+      }
 
-        tinstk[c_id] += cell_f_vol[c_id]*cmu*ro*xw*fhybr;
-        tinstw[c_id] += 2.*cell_f_vol[c_id]*xbeta*ro*xw;
-      });
     }
 
   } /* End of potential kernel fusion section */
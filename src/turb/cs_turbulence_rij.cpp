@@ -1137,26 +1137,34 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
   const cs_real_t crijeps = cs_turb_crij_eps;
 
   const auto t2v = _t2v;
+  const auto iv2t = _iv2t;
+  const auto jv2t = _jv2t;
   const cs_real_t tdeltij[3][3] = {{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}};
   const cs_real_t vdeltij[6] = {1, 1, 1, 0, 0, 0};
 
+  cs_dispatch_context ctx;
+
   cs_lnum_t solid_stride = 1;
   int *c_is_solid_zone_flag = cs_solid_zone_flag(cs_glob_mesh);
   const int c_is_solid_ref[1] = {0};
-  const int *c_is_solid = c_is_solid_zone_flag;
-  if (c_is_solid == nullptr) {
-    c_is_solid = c_is_solid_ref;
+  if (c_is_solid_zone_flag == nullptr) {
+    if (cs_alloc_mode > CS_ALLOC_HOST) {
+      CS_MALLOC_HD(c_is_solid_zone_flag, 1, int, cs_alloc_mode);
+      c_is_solid_zone_flag[0] = 0;
+    }
     solid_stride = 0;
   }
+  const int *c_is_solid = c_is_solid_zone_flag;
+  if (c_is_solid == nullptr)
+    c_is_solid = c_is_solid_ref;
 
   /* Production, Pressure-Strain correlation, dissipation
    * ---------------------------------------------------- */
 
-# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
 
     if (c_is_solid[solid_stride*c_id])
-      continue;
+      return; // return from lambda function == continue in loop
 
     cs_real_t impl_lin_cst = 0, impl_id_cst = 0;
 
@@ -1216,7 +1224,7 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
 
     /* Compute the maximal eigenvalue (in terms of norm!) of S */
     cs_real_t eigen_vals[3];
-    cs_math_sym_33_eigen(sym_strain, eigen_vals);
+    _sym_33_eigen(sym_strain, eigen_vals);
     cs_real_t eigen_max = cs_math_fabs(eigen_vals[0]);
     for (cs_lnum_t i = 1; i < 3; i++)
       eigen_max = cs_math_fmax(cs_math_fabs(eigen_max),
@@ -1247,20 +1255,9 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
     cs_real_t impl_drsm[6][6];
     cs_math_reduce_sym_prod_33_to_66(implmat2add, impl_drsm);
 
-    /* Rotating frame of reference => "absolute" vorticity */
-    if (icorio == 1) {
-      cs_real_t matrot[3][3];
-      const cs_rotation_t *r = cs_glob_rotation + 1;
-      cs_rotation_add_coriolis_t(r, 1., matrot);
-      for (cs_lnum_t i = 0; i < 3; i++) {
-        for (cs_lnum_t j = 0; j < 3; j++)
-          xrotac[i][j] -= matrot[i][j];
-      }
-    }
-
     for (cs_lnum_t ij = 0; ij < 6; ij++) {
-      cs_lnum_t i = _iv2t[ij];
-      cs_lnum_t j = _jv2t[ij];
+      cs_lnum_t i = iv2t[ij];
+      cs_lnum_t j = jv2t[ij];
 
       /* Explicit terms */
       cs_real_t pij = (1.-crij2) * produc[c_id][t2v[j][i]];
@@ -1286,38 +1283,36 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
       }
     }
 
-  } /* end loop on cells */
-
-  BFT_FREE(c_is_solid_zone_flag);
+  }); /* end loop on cells */
 
   /* Coriolis terms in the Phi1 and production
    * ----------------------------------------- */
 
   cs_real_6_t *w2;
-  BFT_MALLOC(w2, n_cells_ext, cs_real_6_t);
+  CS_MALLOC_HD(w2, n_cells_ext, cs_real_6_t, cs_alloc_mode);
 
   if ((icorio == 1) || (tm_model == 1)) {
 
     const int *irotce = cs_turbomachinery_get_cell_rotor_num();
+    const cs_rotation_t *rotation = cs_glob_rotation;
 
-#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
 
       int rot_id = icorio;
       if (tm_model == 1) {
         rot_id = irotce[c_id];
         if (rot_id < 1)
-          continue;
+          return; // return from lambda function == continue in loop
       }
 
       cs_real_t matrot[3][3];
-      const cs_rotation_t *r = cs_glob_rotation + rot_id;
+      const cs_rotation_t *r = rotation + rot_id;
       cs_rotation_coriolis_t(r, 1., matrot);
 
       /* Compute Gij: (i,j) component of the Coriolis production */
       for (cs_lnum_t ij = 0; ij < 6; ij++) {
-        cs_lnum_t i = _iv2t[ij];
-        cs_lnum_t j = _jv2t[ij];
+        cs_lnum_t i = iv2t[ij];
+        cs_lnum_t j = jv2t[ij];
 
         w2[c_id][ij] = 0.;
         for (cs_lnum_t k = 0; k < 3; k++)
@@ -1344,10 +1339,14 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
           rhs[c_id][ij] += w2[c_id][ij];
       }
 
-    } /* End of loop on cells */
+    }); /* End of loop on cells */
 
   } /* End for Coriolis */
 
+  ctx.wait();
+
+  CS_FREE_HD(c_is_solid_zone_flag);
+
   /* Wall echo terms
    * --------------- */
 
@@ -1367,7 +1366,7 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
 
   }
 
-  BFT_FREE(w2);
+  CS_FREE_HD(w2);
 
   /* Buoyancy source term
    * -------------------- */
@@ -1385,13 +1384,14 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
       = cs_field_by_name("anisotropic_turbulent_viscosity");
     const cs_real_6_t *visten = (const cs_real_6_t *)f_a_t_visc->val;
 
-#   pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
       for (cs_lnum_t i = 0; i < 3; i++)
         viscce[c_id][i] = visten[c_id][i] + viscl[c_id];
       for (cs_lnum_t i = 3; i < 6; i++)
         viscce[c_id][i] = visten[c_id][i];
-    }
+    });
+
+    ctx.wait();
 
     cs_face_anisotropic_viscosity_scalar(m,
                                          fvq,
@@ -1408,21 +1408,27 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
   else {
 
     cs_real_t *w1;
-    BFT_MALLOC(w1, n_cells_ext, cs_real_t);
+    CS_MALLOC_HD(w1, n_cells_ext, cs_real_t, cs_alloc_mode);
 
     if (eqp->idifft == 1) {
-#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      const cs_real_t csrij = cs_turb_csrij;
+
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
         const cs_real_t trrij = .5 * cs_math_6_trace(cvara_var[c_id]);
 
-        const cs_real_t rctse =   crom[c_id] * cs_turb_csrij
+        const cs_real_t rctse =   crom[c_id] * csrij
                                 * cs_math_pow2(trrij) / cvara_ep[c_id];
 
         w1[c_id] = viscl[c_id] + rctse;
-      }
+      });
     }
-    else
-      cs_array_real_copy(n_cells, viscl, w1);
+    else {
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+        w1[c_id] = viscl[c_id];
+      });
+    }
+
+    ctx.wait();
 
     cs_face_viscosity(m,
                       fvq,
@@ -1431,7 +1437,7 @@ _pre_solve_lrr(const cs_field_t  *f_rij,
                       viscf,
                       viscb);
 
-    BFT_FREE(w1);
+    CS_FREE_HD(w1);
 
   }
 }
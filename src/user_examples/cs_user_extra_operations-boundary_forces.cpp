@@ -139,6 +139,27 @@ cs_user_extra_operations(cs_domain_t     *domain)
     cs_parall_sum(3, CS_REAL_TYPE, total_b_p_forces);
   }
   /*! [boundary_forces_ex2] */
+
+  /*! [boundary_forces_ex3] */
+  {
+    /* get zone from its name, here "selected_wall" */
+    const cs_zone_t *zn = cs_boundary_zone_by_name("selected_wall");
+
+    /* compute forces, wall shear stress and y+ statistics on the zone;
+       parallel reductions are already done */
+    cs_post_b_zone_wall_t wq;
+    cs_post_b_zone_wall_quantities(zn, &wq);
+
+    bft_printf("Zone %s: force = [%g, %g, %g], pressure force = [%g, %g, %g]\n"
+               "  mean wall shear stress = %g, y+ (min, mean, max) = "
+               "(%g, %g, %g)\n",
+               zn->name,
+               wq.force[0], wq.force[1], wq.force[2],
+               wq.pressure_force[0], wq.pressure_force[1],
+               wq.pressure_force[2],
+               wq.tau_mean, wq.yplus_min, wq.yplus_mean, wq.yplus_max);
+  }
+  /*! [boundary_forces_ex3] */
 }
 
 END_C_DECLS
@@ -372,6 +372,8 @@ cs_user_linear_solvers(void)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
+   *  CS_SLES_PIPELINED_PCG       (pipelined conjugate gradient, with a
+   *                               single non-blocking reduction per iteration)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
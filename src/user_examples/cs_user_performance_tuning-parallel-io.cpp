@@ -132,6 +132,13 @@ cs_user_parallel_io(void)
 
   cs_file_set_mpi_io_positioning(CS_FILE_MPI_INDIVIDUAL_POINTERS);
 
+  /* Alternatively, gather block data on 2 aggregator ranks per node
+     (replacing the block rank step above), and align blocks written
+     with MPI-IO to the file system stripe size */
+
+  if (false)
+    cs_file_set_default_aggregation(2, true);
+
   MPI_Info_free(&hints);
 
   cs_parall_set_min_coll_buf_size(block_min_size);
@@ -134,17 +134,21 @@ main (int argc, char *argv[])
 
 #if defined(HAVE_MPI)
 
-  cs_all_to_all_type_t a2at[5] = {CS_ALL_TO_ALL_MPI_DEFAULT,
+  cs_all_to_all_type_t a2at[7] = {CS_ALL_TO_ALL_MPI_DEFAULT,
                                   CS_ALL_TO_ALL_CRYSTAL_ROUTER,
                                   CS_ALL_TO_ALL_CRYSTAL_ROUTER,
                                   CS_ALL_TO_ALL_MPI_DEFAULT,
-                                  CS_ALL_TO_ALL_CRYSTAL_ROUTER};
+                                  CS_ALL_TO_ALL_CRYSTAL_ROUTER,
+                                  CS_ALL_TO_ALL_HIERARCHICAL,
+                                  CS_ALL_TO_ALL_HIERARCHICAL};
 
-  int a2a_flags[5] = {0, 0, CS_ALL_TO_ALL_ORDER_BY_SRC_RANK,
+  int a2a_flags[7] = {0, 0, CS_ALL_TO_ALL_ORDER_BY_SRC_RANK,
+                      CS_ALL_TO_ALL_USE_DEST_ID,
                       CS_ALL_TO_ALL_USE_DEST_ID,
+                      0,
                       CS_ALL_TO_ALL_USE_DEST_ID};
 
-  for (int test_id = 0; test_id < 5; test_id++) {
+  for (int test_id = 0; test_id < 7; test_id++) {
 
     cs_all_to_all_set_type(a2at[test_id]);
 
@@ -935,10 +935,12 @@ main(int argc, char *argv[])
     cs_lnum_t n_rows = cs_matrix_get_n_rows(m_0);
     cs_lnum_t n_cols = cs_matrix_get_n_columns(m_0);
 
-    cs_real_t *x, *y_0, *y_1;
+    cs_real_t *x, *y_0, *y_1, *y_2, *y_3;
     BFT_MALLOC(x, n_cols, cs_real_t);
     BFT_MALLOC(y_0, n_cols, cs_real_t);
     BFT_MALLOC(y_1, n_cols, cs_real_t);
+    BFT_MALLOC(y_2, n_cols, cs_real_t);
+    BFT_MALLOC(y_3, n_cols, cs_real_t);
     for (cs_lnum_t i = 0; i < _n_vtx; i++)
       x[i] = (_g_vtx_id[i]+1)*0.5;
 
@@ -956,9 +958,39 @@ main(int argc, char *argv[])
     cs_matrix_vector_multiply(m_0, x, y_0);
     cs_matrix_vector_multiply(m_1, x, y_1);
 
+    /* Same product with SELL-C-sigma mapping of MSR matrix */
+
+    {
+      cs_matrix_variant_t *mv = cs_matrix_variant_create(m_1);
+      cs_matrix_variant_set_func(mv,
+                                 CS_MATRIX_SCALAR,
+                                 CS_MATRIX_SPMV_N_TYPES,
+                                 NULL,
+                                 "sell");
+      cs_matrix_variant_apply(m_1, mv);
+      cs_matrix_variant_destroy(&mv);
+    }
+
+    cs_matrix_vector_multiply(m_1, x, y_2);
+
+    /* Same product with single-precision coefficients */
+
+    {
+      cs_matrix_variant_t *mv = cs_matrix_variant_create(m_1);
+      cs_matrix_variant_set_func(mv,
+                                 CS_MATRIX_SCALAR,
+                                 CS_MATRIX_SPMV_N_TYPES,
+                                 NULL,
+                                 "f32");
+      cs_matrix_variant_apply(m_1, mv);
+      cs_matrix_variant_destroy(&mv);
+    }
+
+    cs_matrix_vector_multiply(m_1, x, y_3);
+
     bft_printf("\nSpMV pass %d (on range set)\n", id_ie);
     for (cs_lnum_t i = 0; i < n_rows; i++)
-      bft_printf("%d: %f %f\n", i, y_0[i], y_1[i]);
+      bft_printf("%d: %f %f %f %f\n", i, y_0[i], y_1[i], y_2[i], y_3[i]);
 
     cs_range_set_scatter(rs,
                          CS_REAL_TYPE,
@@ -979,6 +1011,8 @@ main(int argc, char *argv[])
     BFT_FREE(x);
     BFT_FREE(y_0);
     BFT_FREE(y_1);
+    BFT_FREE(y_2);
+    BFT_FREE(y_3);
 
     cs_matrix_release_coefficients(m_0);
     cs_matrix_release_coefficients(m_1);
@@ -0,0 +1,466 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+#-------------------------------------------------------------------------------
+
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2024 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#-------------------------------------------------------------------------------
+
+"""
+Performance regression tests.
+
+Representative cases are generated on Cartesian meshes of fixed size,
+run for a fixed number of time steps, and throughput metrics are
+compared to those of a baseline file, with a given relative tolerance.
+
+Metrics are:
+  - cells x iterations / s, based on the total elapsed time;
+  - linear solver time per iteration, based on solver telemetry.
+
+Usage example (with the code_saturne Python modules in PYTHONPATH):
+
+  cs_perf_regression.py --nprocs 4 --update     # create baseline
+  cs_perf_regression.py --nprocs 4              # compare to baseline
+"""
+
+#-------------------------------------------------------------------------------
+# Library modules import
+#-------------------------------------------------------------------------------
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+#-------------------------------------------------------------------------------
+# Representative cases
+#-------------------------------------------------------------------------------
+
+# Boundary zones of Cartesian meshes are named based on face groups
+# X0, X1, Y0, Y1, Z0, Z1.
+
+_user_cdo_diffusion = """\
+#include "cs_headers.h"
+
+BEGIN_C_DECLS
+
+void
+cs_user_model(void)
+{
+  cs_param_cdo_mode_set(CS_PARAM_CDO_MODE_ONLY);
+
+  cs_equation_add_user("Laplacian", "potential", 1, CS_BC_SYMMETRY);
+}
+
+void
+cs_user_finalize_setup(cs_domain_t   *domain)
+{
+  CS_UNUSED(domain);
+
+  cs_equation_param_t  *eqp = cs_equation_param_by_name("Laplacian");
+
+  cs_equation_add_diffusion(eqp, cs_property_by_name("unity"));
+
+  cs_real_t  t0 = 0, t1 = 1;
+  cs_equation_add_bc_by_value(eqp, CS_BC_DIRICHLET, "X0", &t0);
+  cs_equation_add_bc_by_value(eqp, CS_BC_DIRICHLET, "X1", &t1);
+}
+
+END_C_DECLS
+"""
+
+_user_lagr_injection = """\
+#include "cs_headers.h"
+
+BEGIN_C_DECLS
+
+void
+cs_user_lagr_volume_conditions(void)
+{
+  cs_lagr_zone_data_t *lagr_vol_conds = cs_lagr_get_volume_conditions();
+
+  const cs_zone_t *z = cs_volume_zone_by_id(0);
+
+  cs_lagr_injection_set_t *zis
+    = cs_lagr_get_injection_set(lagr_vol_conds, z->id, 0);
+
+  zis->n_inject = 20000;
+  zis->injection_frequency = 1;
+  zis->velocity_profile = -1;
+  zis->stat_weight = 1.0;
+  zis->diameter = 5e-5;
+  zis->diameter_variance = 1e-6;
+  zis->density = 2500.;
+}
+
+END_C_DECLS
+"""
+
+_cases = {
+
+    'rans_channel': {
+        'description': 'k-epsilon channel flow',
+        'cells': (64, 32, 16),
+        'extents': ((0., 6.4), (0., 2.), (0., 3.2)),
+        'n_iter': 50,
+        'turbulence': 'k-epsilon-PL',
+        'boundaries': {'X0': 'inlet', 'X1': 'outlet',
+                       'Y0': 'wall', 'Y1': 'wall',
+                       'Z0': 'symmetry', 'Z1': 'symmetry'},
+        'inlet_velocity': 1.0,
+    },
+
+    'les_box': {
+        'description': 'LES (Smagorinsky) in a box',
+        'cells': (32, 32, 32),
+        'extents': ((0., 1.), (0., 1.), (0., 1.)),
+        'n_iter': 50,
+        'unsteady': True,
+        'turbulence': 'LES_Smagorinsky',
+        'boundaries': {'X0': 'inlet', 'X1': 'outlet',
+                       'Y0': 'wall', 'Y1': 'wall',
+                       'Z0': 'wall', 'Z1': 'wall'},
+        'inlet_velocity': 1.0,
+    },
+
+    'scalar_transport': {
+        'description': 'laminar flow with a transported scalar',
+        'cells': (64, 64, 8),
+        'extents': ((0., 1.), (0., 1.), (0., 0.125)),
+        'n_iter': 50,
+        'scalars': ['tracer'],
+        'boundaries': {'X0': 'inlet', 'X1': 'outlet',
+                       'Y0': 'wall', 'Y1': 'wall',
+                       'Z0': 'symmetry', 'Z1': 'symmetry'},
+        'inlet_velocity': 0.1,
+    },
+
+    'cdo_diffusion': {
+        'description': 'CDO vertex-based diffusion',
+        'cells': (48, 48, 48),
+        'extents': ((0., 1.), (0., 1.), (0., 1.)),
+        'n_iter': 5,
+        'boundaries': {'X0': 'wall', 'X1': 'wall'},
+        'user_sources': {'cs_user_parameters.cpp': _user_cdo_diffusion},
+    },
+
+    'particles': {
+        'description': 'one-way coupled Lagrangian particle tracking',
+        'cells': (32, 16, 16),
+        'extents': ((0., 2.), (0., 1.), (0., 1.)),
+        'n_iter': 20,
+        'unsteady': True,
+        'lagrangian': 'one_way',
+        'boundaries': {'X0': 'inlet', 'X1': 'outlet',
+                       'Y0': 'wall', 'Y1': 'wall',
+                       'Z0': 'wall', 'Z1': 'wall'},
+        'inlet_velocity': 1.0,
+        'user_sources': {'cs_user_lagr_volume_conditions.cpp':
+                         _user_lagr_injection},
+    },
+
+}
+
+#-------------------------------------------------------------------------------
+# Process the command line arguments
+#-------------------------------------------------------------------------------
+
+def process_cmd_line(argv):
+    """
+    Process the passed command line arguments.
+    """
+
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+
+    parser.add_argument("--cases", dest="cases", type=str, nargs='*',
+                        default=list(_cases.keys()),
+                        help="cases to run (default: all)")
+
+    parser.add_argument("-n", "--nprocs", dest="nprocs", type=int, default=1,
+                        help="number of MPI processes")
+
+    parser.add_argument("--work-dir", dest="work_dir", type=str,
+                        default="perf_regression",
+                        help="directory in which cases are created")
+
+    parser.add_argument("--baseline", dest="baseline", type=str,
+                        default="perf_baseline.json",
+                        help="baseline metrics file")
+
+    parser.add_argument("--tolerance", dest="tolerance", type=float,
+                        default=0.1,
+                        help="relative tolerance on metrics (default: 0.1)")
+
+    parser.add_argument("--update", dest="update", action="store_true",
+                        help="update baseline with current metrics")
+
+    parser.add_argument("--code-saturne", dest="cs_cmd", type=str,
+                        default="code_saturne",
+                        help="code_saturne command")
+
+    return parser.parse_args(argv)
+
+#-------------------------------------------------------------------------------
+# Case generation
+#-------------------------------------------------------------------------------
+
+def generate_case(options, name, c):
+    """
+    Create a case and define its setup.
+    """
+
+    from code_saturne.base.cs_parametric_study import load_case_setup_from_xml
+    from code_saturne.base.cs_parametric_setup import case_setup_filter
+    from code_saturne.model.SolutionDomainModel import SolutionDomainModel
+    from code_saturne.model.LocalizationModel import LocalizationModel, Zone
+
+    case_dir = os.path.join(options.work_dir, name.upper())
+
+    if not os.path.isdir(case_dir):
+        subprocess.check_call([options.cs_cmd, "create", "--noref",
+                               "-c", name.upper()],
+                              cwd=options.work_dir)
+
+    xml_path = os.path.join(case_dir, "DATA", "setup.xml")
+    case = load_case_setup_from_xml(xml_path)
+    f = case_setup_filter(case)
+
+    # Cartesian mesh
+
+    dm = SolutionDomainModel(case)
+    dm.setMeshOrigin('mesh_cartesian')
+    for i, d in enumerate(('x_direction', 'y_direction', 'z_direction')):
+        dm.setCartesianParam(d, 'ncells', str(c['cells'][i]))
+        dm.setCartesianParam(d, 'min', str(c['extents'][i][0]))
+        dm.setCartesianParam(d, 'max', str(c['extents'][i][1]))
+        dm.setCartesianParam(d, 'prog', '1.0')
+        dm.setCartesianParam(d, 'law', 'constant')
+
+    # Physical models
+
+    if 'turbulence' in c:
+        from code_saturne.model.TurbulenceModel import TurbulenceModel
+        TurbulenceModel(case).setTurbulenceModel(c['turbulence'])
+
+    for s in c.get('scalars', []):
+        from code_saturne.model.DefineUserScalarsModel \
+            import DefineUserScalarsModel
+        DefineUserScalarsModel(case).addUserScalar(s)
+
+    if 'lagrangian' in c:
+        from code_saturne.model.LagrangianModel import LagrangianModel
+        LagrangianModel(case).setLagrangianModel(c['lagrangian'])
+
+    # Boundary conditions
+
+    bm = LocalizationModel("BoundaryZone", case)
+    labels = bm.getLabelsZonesList()
+    for i, (label, nature) in enumerate(c['boundaries'].items()):
+        if label not in labels:
+            bm.addZone(Zone("BoundaryZone", case=case, label=label,
+                            codeNumber=len(labels)+i+1,
+                            localization=label, nature=nature))
+        else:
+            f.setBcType(label, nature)
+        if nature == 'inlet':
+            f.setInletVelocity(label, c['inlet_velocity'])
+            for s in c.get('scalars', []):
+                f.setInletScalar(label, s, 1.0)
+
+    # Time stepping
+
+    if c.get('unsteady', False):
+        f.setUnsteadySimulation()
+    f.setTimeIterationsNumber(c['n_iter'])
+
+    case.xmlSaveDocument()
+
+    # User sources
+
+    for file_name, source in c.get('user_sources', {}).items():
+        with open(os.path.join(case_dir, "SRC", file_name), "w") as fs:
+            fs.write(source)
+
+    return case_dir
+
+#-------------------------------------------------------------------------------
+# Case execution and metrics extraction
+#-------------------------------------------------------------------------------
+
+def run_case(options, case_dir):
+    """
+    Run a case, and return its results directory.
+    """
+
+    env = dict(os.environ)
+    env['CS_SLES_TELEMETRY'] = 'sles_telemetry.jsonl'
+
+    subprocess.check_call([options.cs_cmd, "run",
+                           "--nprocs", str(options.nprocs),
+                           "--id", "perf", "--force"],
+                          cwd=os.path.join(case_dir, "DATA"),
+                          env=env)
+
+    return os.path.join(case_dir, "RESU", "perf")
+
+
+def extract_metrics(run_dir, c):
+    """
+    Extract throughput metrics from a run's logs.
+    """
+
+    n_cells = c['cells'][0] * c['cells'][1] * c['cells'][2]
+    n_iter = c['n_iter']
+
+    elapsed = None
+    with open(os.path.join(run_dir, "performance.log")) as f:
+        for line in f:
+            m = re.match(r"\s*Elapsed time:\s+([0-9.eE+-]+)", line)
+            if m:
+                elapsed = float(m.group(1))
+
+    if elapsed is None or elapsed <= 0:
+        raise RuntimeError("no elapsed time found in %s" % run_dir)
+
+    metrics = {'cell_iterations_per_s': n_cells*n_iter/elapsed}
+
+    # Linear solver times (rank 0 solve times) from telemetry
+
+    p = os.path.join(run_dir, "sles_telemetry.jsonl")
+    if os.path.isfile(p):
+        t_sles = 0.
+        with open(p) as f:
+            for line in f:
+                r = json.loads(line)
+                t_sles += r.get('setup_time', 0) + r.get('solve_time', 0)
+        metrics['sles_time_per_iteration'] = t_sles / n_iter
+
+    return metrics
+
+#-------------------------------------------------------------------------------
+# Comparison to baseline
+#-------------------------------------------------------------------------------
+
+# Metrics for which higher values are better; lower values are better
+# for others.
+
+_higher_is_better = ('cell_iterations_per_s',)
+
+
+def compare_metrics(name, metrics, baseline, tolerance):
+    """
+    Compare metrics to baseline; return list of regressions.
+    """
+
+    regressions = []
+
+    for k, v in metrics.items():
+        if k not in baseline:
+            continue
+        ref = baseline[k]
+        if ref <= 0:
+            continue
+        if k in _higher_is_better:
+            ratio = v / ref
+        else:
+            ratio = ref / v if v > 0 else float('inf')
+        status = 'ok'
+        if ratio < 1. - tolerance:
+            status = 'REGRESSION'
+            regressions.append((name, k, ref, v))
+        elif ratio > 1. + tolerance:
+            status = 'improved'
+        print("  %-24s %12.4g (baseline %12.4g, ratio %6.3f) %s"
+              % (k, v, ref, ratio, status))
+
+    return regressions
+
+#-------------------------------------------------------------------------------
+# Main
+#-------------------------------------------------------------------------------
+
+def main(argv):
+
+    options = process_cmd_line(argv)
+
+    if not os.path.isdir(options.work_dir):
+        os.makedirs(options.work_dir)
+
+    baseline = {}
+    if os.path.isfile(options.baseline):
+        with open(options.baseline) as f:
+            baseline = json.load(f)
+
+    results = {}
+    regressions = []
+
+    for name in options.cases:
+        if name not in _cases:
+            print("Unknown case: %s" % name)
+            return 1
+        c = _cases[name]
+
+        print("\n%s (%s, %d x %d x %d cells, %d iterations)"
+              % (name, c['description'], c['cells'][0], c['cells'][1],
+                 c['cells'][2], c['n_iter']))
+
+        case_dir = generate_case(options, name, c)
+        run_dir = run_case(options, case_dir)
+        metrics = extract_metrics(run_dir, c)
+        metrics['n_procs'] = options.nprocs
+        results[name] = metrics
+
+        ref = baseline.get(name, {})
+        if ref.get('n_procs', options.nprocs) != options.nprocs:
+            print("  baseline defined for %d processes; not compared"
+                  % ref['n_procs'])
+        elif ref:
+            m = {k: v for k, v in metrics.items() if k != 'n_procs'}
+            regressions += compare_metrics(name, m, ref, options.tolerance)
+        else:
+            for k, v in metrics.items():
+                print("  %-24s %12.4g" % (k, v))
+
+    if options.update:
+        baseline.update(results)
+        with open(options.baseline, "w") as f:
+            json.dump(baseline, f, indent=2, sort_keys=True)
+        print("\nBaseline updated: %s" % options.baseline)
+        return 0
+
+    if regressions:
+        print("\nPerformance regressions (tolerance %g):" % options.tolerance)
+        for r in regressions:
+            print("  %s: %s %.4g -> %.4g" % r)
+        return 1
+
+    return 0
+
+#-------------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
+
+#-------------------------------------------------------------------------------
+# End
+#-------------------------------------------------------------------------------